@@ -0,0 +1,89 @@
+#include "benchmark/storm/BenchmarkInputs.h"
+
+#include <algorithm>
+#include <map>
+#include <random>
+
+#include "storm-config.h"
+#include "storm-parsers/api/storm-parsers.h"
+#include "storm/api/builder.h"
+#include "storm/models/sparse/Model.h"
+#include "storm/models/sparse/StandardRewardModel.h"
+
+namespace storm {
+namespace benchmark {
+
+storm::storage::SparseMatrix<double> createRandomTransitionMatrix(uint64_t numberOfRowGroups, uint64_t rowsPerGroup, uint64_t entriesPerRow) {
+    std::mt19937_64 generator(syntheticInputSeed);
+    std::uniform_int_distribution<uint64_t> columnDistribution(0, numberOfRowGroups - 1);
+    std::uniform_real_distribution<double> valueDistribution(0.1, 1.0);
+
+    bool trivialRowGrouping = rowsPerGroup == 1;
+    uint64_t numberOfRows = numberOfRowGroups * rowsPerGroup;
+    storm::storage::SparseMatrixBuilder<double> builder(numberOfRows, numberOfRowGroups, numberOfRows * entriesPerRow, true, !trivialRowGrouping,
+                                                        trivialRowGrouping ? 0 : numberOfRowGroups);
+    std::vector<uint64_t> columns;
+    std::vector<double> values;
+    for (uint64_t row = 0; row < numberOfRows; ++row) {
+        if (!trivialRowGrouping && row % rowsPerGroup == 0) {
+            builder.newRowGroup(row);
+        }
+        // Draw distinct columns, which need to be inserted in ascending order.
+        columns.clear();
+        while (columns.size() < std::min(entriesPerRow, numberOfRowGroups)) {
+            uint64_t column = columnDistribution(generator);
+            if (std::find(columns.begin(), columns.end(), column) == columns.end()) {
+                columns.push_back(column);
+            }
+        }
+        std::sort(columns.begin(), columns.end());
+        values.clear();
+        double sum = 0.0;
+        for (uint64_t i = 0; i < columns.size(); ++i) {
+            values.push_back(valueDistribution(generator));
+            sum += values.back();
+        }
+        for (uint64_t i = 0; i < columns.size(); ++i) {
+            builder.addNextValue(row, columns[i], values[i] / sum);
+        }
+    }
+    return builder.build();
+}
+
+storm::storage::BitVector createRandomBitVector(uint64_t size, double density, uint64_t seed) {
+    std::mt19937_64 generator(seed);
+    std::bernoulli_distribution distribution(density);
+    storm::storage::BitVector result(size);
+    for (uint64_t index = 0; index < size; ++index) {
+        if (distribution(generator)) {
+            result.set(index);
+        }
+    }
+    return result;
+}
+
+std::vector<double> createRandomVector(uint64_t size, uint64_t seed) {
+    std::mt19937_64 generator(seed);
+    std::uniform_real_distribution<double> distribution(0.0, 1.0);
+    std::vector<double> result(size);
+    for (auto& value : result) {
+        value = distribution(generator);
+    }
+    return result;
+}
+
+std::shared_ptr<storm::models::sparse::Model<double>> getModel(std::string const& prismFile) {
+    static std::map<std::string, std::shared_ptr<storm::models::sparse::Model<double>>> cache;
+    auto cacheIt = cache.find(prismFile);
+    if (cacheIt != cache.end()) {
+        return cacheIt->second;
+    }
+    storm::prism::Program program = storm::api::parseProgram(STORM_TEST_RESOURCES_DIR "/" + prismFile);
+    storm::builder::BuilderOptions options(false, true);
+    auto model = storm::api::buildSparseModel<double>(program, options);
+    cache.emplace(prismFile, model);
+    return model;
+}
+
+}  // namespace benchmark
+}  // namespace storm
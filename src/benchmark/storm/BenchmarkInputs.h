@@ -0,0 +1,54 @@
+#pragma once
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "storm/storage/BitVector.h"
+#include "storm/storage/SparseMatrix.h"
+
+namespace storm {
+namespace models {
+namespace sparse {
+template<typename ValueType, typename RewardModelType>
+class Model;
+template<typename ValueType>
+class StandardRewardModel;
+}  // namespace sparse
+}  // namespace models
+
+namespace benchmark {
+
+/*!
+ * The seed that is used for all synthetic inputs. It is fixed so that all runs operate on the same inputs.
+ */
+uint64_t const syntheticInputSeed = 42;
+
+/*!
+ * Creates a random row-grouped transition matrix with the given dimensions. The entries of each row are distributed over random columns and
+ * sum up to one.
+ *
+ * @param numberOfRowGroups The number of row groups (i.e. states).
+ * @param rowsPerGroup The number of rows (i.e. choices) in each row group. If this is one, the matrix has a trivial row grouping.
+ * @param entriesPerRow The number of (distinct) nonzero entries in each row.
+ */
+storm::storage::SparseMatrix<double> createRandomTransitionMatrix(uint64_t numberOfRowGroups, uint64_t rowsPerGroup, uint64_t entriesPerRow);
+
+/*!
+ * Creates a bit vector of the given size in which each bit is set with the given probability.
+ */
+storm::storage::BitVector createRandomBitVector(uint64_t size, double density, uint64_t seed = syntheticInputSeed);
+
+/*!
+ * Creates a vector of the given size with random values in [0,1].
+ */
+std::vector<double> createRandomVector(uint64_t size, uint64_t seed = syntheticInputSeed);
+
+/*!
+ * Builds the sparse model described by the given PRISM file. The file is given relative to the test resources, which contain (down-scaled)
+ * instances of several QVBS models. Models are cached, so each model is only built once per run.
+ */
+std::shared_ptr<storm::models::sparse::Model<double, storm::models::sparse::StandardRewardModel<double>>> getModel(std::string const& prismFile);
+
+}  // namespace benchmark
+}  // namespace storm
@@ -0,0 +1,83 @@
+#include <benchmark/benchmark.h>
+
+#include "benchmark/storm/BenchmarkInputs.h"
+#include "storm/models/sparse/Model.h"
+#include "storm/models/sparse/StandardRewardModel.h"
+#include "storm/solver/helper/ValueIterationOperator.h"
+#include "storm/storage/SparseMatrix.h"
+
+namespace {
+
+/*!
+ * A minimal backend that maximizes over the rows of each group without checking for convergence.
+ */
+class MaximizingBackend {
+   public:
+    void startNewIteration() {}
+
+    void firstRow(double&& value, [[maybe_unused]] uint64_t rowGroup, [[maybe_unused]] uint64_t row) {
+        best = value;
+    }
+
+    void nextRow(double&& value, [[maybe_unused]] uint64_t rowGroup, [[maybe_unused]] uint64_t row) {
+        best = std::max(best, value);
+    }
+
+    void applyUpdate(double& currValue, [[maybe_unused]] uint64_t rowGroup) {
+        currValue = best;
+    }
+
+    void endOfIteration() const {}
+
+    void mergeChunk([[maybe_unused]] MaximizingBackend const& chunkBackend) {}
+
+    bool converged() const {
+        return false;
+    }
+
+    bool constexpr abort() const {
+        return false;
+    }
+
+   private:
+    double best{0.0};
+};
+
+template<bool TrivialRowGrouping>
+void apply(benchmark::State& state, storm::storage::SparseMatrix<double> const& matrix) {
+    storm::solver::helper::ValueIterationOperator<double, TrivialRowGrouping> viOperator;
+    viOperator.setMatrixBackwards(matrix);
+    std::vector<double> x = storm::benchmark::createRandomVector(matrix.getRowGroupCount(), 1);
+    std::vector<double> y(matrix.getRowGroupCount());
+    std::vector<double> offsets = storm::benchmark::createRandomVector(matrix.getRowCount(), 2);
+    MaximizingBackend backend;
+    for (auto _ : state) {
+        viOperator.apply(x, y, offsets, backend);
+        std::swap(x, y);
+        benchmark::DoNotOptimize(x.data());
+    }
+    state.SetItemsProcessed(state.iterations() * matrix.getEntryCount());
+}
+
+void BM_ValueIterationOperator_apply_synthetic(benchmark::State& state) {
+    if (state.range(1) == 1) {
+        apply<true>(state, storm::benchmark::createRandomTransitionMatrix(state.range(0), 1, 4));
+    } else {
+        apply<false>(state, storm::benchmark::createRandomTransitionMatrix(state.range(0), state.range(1), 4));
+    }
+}
+BENCHMARK(BM_ValueIterationOperator_apply_synthetic)->ArgsProduct({{1 << 12, 1 << 16, 1 << 20}, {1, 4}});
+
+void BM_ValueIterationOperator_apply_dtmc(benchmark::State& state, std::string const& file) {
+    apply<true>(state, storm::benchmark::getModel(file)->getTransitionMatrix());
+}
+BENCHMARK_CAPTURE(BM_ValueIterationOperator_apply_dtmc, crowds, std::string("dtmc/crowds-5-5.pm"));
+BENCHMARK_CAPTURE(BM_ValueIterationOperator_apply_dtmc, nand, std::string("dtmc/nand-5-2.pm"));
+
+void BM_ValueIterationOperator_apply_mdp(benchmark::State& state, std::string const& file) {
+    apply<false>(state, storm::benchmark::getModel(file)->getTransitionMatrix());
+}
+BENCHMARK_CAPTURE(BM_ValueIterationOperator_apply_mdp, csma, std::string("mdp/csma2-2.nm"));
+BENCHMARK_CAPTURE(BM_ValueIterationOperator_apply_mdp, leader, std::string("mdp/leader4.nm"));
+
+}  // namespace
@@ -0,0 +1,83 @@
+#include <benchmark/benchmark.h>
+
+#include "benchmark/storm/BenchmarkInputs.h"
+#include "storm/storage/BitVector.h"
+#include "storm/storage/BitVectorHashMap.h"
+
+namespace {
+
+// The densities (in percent) of the random bit vectors.
+std::vector<int64_t> const densities = {1, 50};
+
+void BM_BitVector_and(benchmark::State& state) {
+    auto first = storm::benchmark::createRandomBitVector(state.range(0), state.range(1) / 100.0, 1);
+    auto second = storm::benchmark::createRandomBitVector(state.range(0), state.range(1) / 100.0, 2);
+    for (auto _ : state) {
+        storm::storage::BitVector result = first & second;
+        benchmark::DoNotOptimize(result);
+    }
+}
+BENCHMARK(BM_BitVector_and)->ArgsProduct({{1 << 12, 1 << 20}, densities});
+
+void BM_BitVector_or(benchmark::State& state) {
+    auto first = storm::benchmark::createRandomBitVector(state.range(0), state.range(1) / 100.0, 1);
+    auto second = storm::benchmark::createRandomBitVector(state.range(0), state.range(1) / 100.0, 2);
+    for (auto _ : state) {
+        storm::storage::BitVector result = first | second;
+        benchmark::DoNotOptimize(result);
+    }
+}
+BENCHMARK(BM_BitVector_or)->ArgsProduct({{1 << 12, 1 << 20}, densities});
+
+void BM_BitVector_complement(benchmark::State& state) {
+    auto vector = storm::benchmark::createRandomBitVector(state.range(0), state.range(1) / 100.0);
+    for (auto _ : state) {
+        storm::storage::BitVector result = ~vector;
+        benchmark::DoNotOptimize(result);
+    }
+}
+BENCHMARK(BM_BitVector_complement)->ArgsProduct({{1 << 12, 1 << 20}, densities});
+
+void BM_BitVector_getNumberOfSetBits(benchmark::State& state) {
+    auto vector = storm::benchmark::createRandomBitVector(state.range(0), state.range(1) / 100.0);
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(vector.getNumberOfSetBits());
+    }
+}
+BENCHMARK(BM_BitVector_getNumberOfSetBits)->ArgsProduct({{1 << 12, 1 << 20}, densities});
+
+void BM_BitVector_iterate(benchmark::State& state) {
+    auto vector = storm::benchmark::createRandomBitVector(state.range(0), state.range(1) / 100.0);
+    for (auto _ : state) {
+        uint64_t sum = 0;
+        for (auto index : vector) {
+            sum += index;
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+    state.SetItemsProcessed(state.iterations() * vector.getNumberOfSetBits());
+}
+BENCHMARK(BM_BitVector_iterate)->ArgsProduct({{1 << 12, 1 << 20}, densities});
+
+void BM_BitVectorHashMap_findOrAdd(benchmark::State& state) {
+    // Mimic the state storage of the model builder: many short keys, each of which is looked up multiple times.
+    uint64_t const bitsPerKey = state.range(1);
+    std::vector<storm::storage::BitVector> keys;
+    for (int64_t i = 0; i < state.range(0); ++i) {
+        keys.push_back(storm::benchmark::createRandomBitVector(bitsPerKey, 0.5, i));
+    }
+    for (auto _ : state) {
+        storm::storage::BitVectorHashMap<uint32_t> map(bitsPerKey, 1000);
+        for (uint32_t i = 0; i < keys.size(); ++i) {
+            benchmark::DoNotOptimize(map.findOrAdd(keys[i], i));
+        }
+        // Look up all keys a second time, as every state is typically reached multiple times.
+        for (uint32_t i = 0; i < keys.size(); ++i) {
+            benchmark::DoNotOptimize(map.findOrAdd(keys[i], i));
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * keys.size() * 2);
+}
+BENCHMARK(BM_BitVectorHashMap_findOrAdd)->ArgsProduct({{1 << 10, 1 << 16}, {32, 96}});
+
+}  // namespace
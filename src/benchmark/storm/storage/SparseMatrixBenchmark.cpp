@@ -0,0 +1,54 @@
+#include <benchmark/benchmark.h>
+
+#include "benchmark/storm/BenchmarkInputs.h"
+#include "storm/models/sparse/Model.h"
+#include "storm/models/sparse/StandardRewardModel.h"
+#include "storm/solver/OptimizationDirection.h"
+#include "storm/storage/SparseMatrix.h"
+
+namespace {
+
+void multiplyWithVector(benchmark::State& state, storm::storage::SparseMatrix<double> const& matrix) {
+    std::vector<double> x = storm::benchmark::createRandomVector(matrix.getColumnCount());
+    std::vector<double> result(matrix.getRowCount());
+    for (auto _ : state) {
+        matrix.multiplyWithVector(x, result);
+        benchmark::DoNotOptimize(result.data());
+    }
+    state.SetItemsProcessed(state.iterations() * matrix.getEntryCount());
+}
+
+void multiplyAndReduce(benchmark::State& state, storm::storage::SparseMatrix<double> const& matrix) {
+    std::vector<double> x = storm::benchmark::createRandomVector(matrix.getColumnCount());
+    std::vector<double> result(matrix.getRowGroupCount());
+    std::vector<uint64_t> choices(matrix.getRowGroupCount());
+    for (auto _ : state) {
+        matrix.multiplyAndReduce(storm::solver::OptimizationDirection::Maximize, matrix.getRowGroupIndices(), x, nullptr, result, &choices);
+        benchmark::DoNotOptimize(result.data());
+    }
+    state.SetItemsProcessed(state.iterations() * matrix.getEntryCount());
+}
+
+void BM_SparseMatrix_multiplyWithVector_synthetic(benchmark::State& state) {
+    multiplyWithVector(state, storm::benchmark::createRandomTransitionMatrix(state.range(0), 1, state.range(1)));
+}
+BENCHMARK(BM_SparseMatrix_multiplyWithVector_synthetic)->ArgsProduct({{1 << 12, 1 << 16, 1 << 20}, {2, 8}});
+
+void BM_SparseMatrix_multiplyWithVector_model(benchmark::State& state, std::string const& file) {
+    multiplyWithVector(state, storm::benchmark::getModel(file)->getTransitionMatrix());
+}
+BENCHMARK_CAPTURE(BM_SparseMatrix_multiplyWithVector_model, crowds, std::string("dtmc/crowds-5-5.pm"));
+BENCHMARK_CAPTURE(BM_SparseMatrix_multiplyWithVector_model, nand, std::string("dtmc/nand-5-2.pm"));
+
+void BM_SparseMatrix_multiplyAndReduce_synthetic(benchmark::State& state) {
+    multiplyAndReduce(state, storm::benchmark::createRandomTransitionMatrix(state.range(0), state.range(1), 4));
+}
+BENCHMARK(BM_SparseMatrix_multiplyAndReduce_synthetic)->ArgsProduct({{1 << 12, 1 << 16, 1 << 20}, {2, 4}});
+
+void BM_SparseMatrix_multiplyAndReduce_model(benchmark::State& state, std::string const& file) {
+    multiplyAndReduce(state, storm::benchmark::getModel(file)->getTransitionMatrix());
+}
+BENCHMARK_CAPTURE(BM_SparseMatrix_multiplyAndReduce_model, csma, std::string("mdp/csma2-2.nm"));
+BENCHMARK_CAPTURE(BM_SparseMatrix_multiplyAndReduce_model, leader, std::string("mdp/leader4.nm"));
+
+}  // namespace
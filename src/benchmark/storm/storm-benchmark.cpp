@@ -0,0 +1,19 @@
+#include <benchmark/benchmark.h>
+
+#include "storm/settings/SettingsManager.h"
+#include "storm/utility/initialize.h"
+
+int main(int argc, char** argv) {
+    storm::settings::initializeAll("Storm Microbenchmarks", "storm-microbenchmarks");
+    storm::utility::initializeLogger();
+    // Only enable error output so that logging does not distort the measurements.
+    storm::utility::setLogLevel(l3pp::LogLevel::ERR);
+
+    ::benchmark::Initialize(&argc, argv);
+    if (::benchmark::ReportUnrecognizedArguments(argc, argv)) {
+        return 1;
+    }
+    ::benchmark::RunSpecifiedBenchmarks();
+    ::benchmark::Shutdown();
+    return 0;
+}
@@ -0,0 +1,58 @@
+#include <benchmark/benchmark.h>
+
+#include "benchmark/storm/BenchmarkInputs.h"
+#include "storm/models/sparse/Model.h"
+#include "storm/models/sparse/StandardRewardModel.h"
+#include "storm/storage/SparseMatrix.h"
+#include "storm/storage/StronglyConnectedComponentDecomposition.h"
+#include "storm/utility/graph.h"
+
+namespace {
+
+void performSccDecomposition(benchmark::State& state, storm::storage::SparseMatrix<double> const& matrix) {
+    storm::storage::SccDecompositionResult result;
+    storm::storage::SccDecompositionMemoryCache cache;
+    auto options = storm::storage::StronglyConnectedComponentDecompositionOptions().dropNaiveSccs();
+    for (auto _ : state) {
+        storm::storage::performSccDecomposition(matrix, options, result, cache);
+        benchmark::DoNotOptimize(result.sccCount);
+    }
+    state.SetItemsProcessed(state.iterations() * matrix.getRowGroupCount());
+}
+
+void BM_Graph_performSccDecomposition_synthetic(benchmark::State& state) {
+    // Sparse random graphs consist of a giant SCC and many trivial ones.
+    performSccDecomposition(state, storm::benchmark::createRandomTransitionMatrix(state.range(0), 1, state.range(1)));
+}
+BENCHMARK(BM_Graph_performSccDecomposition_synthetic)->ArgsProduct({{1 << 12, 1 << 16, 1 << 20}, {1, 2}});
+
+void BM_Graph_performSccDecomposition_model(benchmark::State& state, std::string const& file) {
+    performSccDecomposition(state, storm::benchmark::getModel(file)->getTransitionMatrix());
+}
+BENCHMARK_CAPTURE(BM_Graph_performSccDecomposition_model, crowds, std::string("dtmc/crowds-5-5.pm"));
+BENCHMARK_CAPTURE(BM_Graph_performSccDecomposition_model, csma, std::string("mdp/csma2-2.nm"));
+
+void performProb01Max(benchmark::State& state, storm::storage::SparseMatrix<double> const& matrix, storm::storage::BitVector const& psiStates) {
+    auto backwardTransitions = matrix.transpose(true);
+    storm::storage::BitVector phiStates(matrix.getRowGroupCount(), true);
+    for (auto _ : state) {
+        auto result = storm::utility::graph::performProb01Max(matrix, matrix.getRowGroupIndices(), backwardTransitions, phiStates, psiStates);
+        benchmark::DoNotOptimize(result);
+    }
+    state.SetItemsProcessed(state.iterations() * matrix.getEntryCount());
+}
+
+void BM_Graph_performProb01Max_synthetic(benchmark::State& state) {
+    auto matrix = storm::benchmark::createRandomTransitionMatrix(state.range(0), 4, 2);
+    performProb01Max(state, matrix, storm::benchmark::createRandomBitVector(matrix.getRowGroupCount(), 0.001));
+}
+BENCHMARK(BM_Graph_performProb01Max_synthetic)->Arg(1 << 12)->Arg(1 << 16)->Arg(1 << 20);
+
+void BM_Graph_performProb01Max_model(benchmark::State& state, std::string const& file, std::string const& label) {
+    auto model = storm::benchmark::getModel(file);
+    performProb01Max(state, model->getTransitionMatrix(), model->getStates(label));
+}
+BENCHMARK_CAPTURE(BM_Graph_performProb01Max_model, csma, std::string("mdp/csma2-2.nm"), std::string("all_delivered"));
+BENCHMARK_CAPTURE(BM_Graph_performProb01Max_model, leader, std::string("mdp/leader4.nm"), std::string("elected"));
+
+}  // namespace
@@ -0,0 +1,16 @@
+#include "storm-bench-cli/settings/BenchSettings.h"
+
+#include "storm/settings/SettingsManager.h"
+
+#include "storm-bench-cli/settings/modules/BenchmarkSettings.h"
+
+namespace storm {
+namespace settings {
+void initializeBenchSettings(std::string const& name, std::string const& executableName) {
+    // The benchmarks run the regular storm pipeline, so all of its settings need to be available.
+    storm::settings::initializeAll(name, executableName);
+
+    storm::settings::addModule<storm::settings::modules::BenchmarkSettings>();
+}
+}  // namespace settings
+}  // namespace storm
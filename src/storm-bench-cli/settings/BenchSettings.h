@@ -0,0 +1,13 @@
+#pragma once
+
+#include <string>
+
+namespace storm {
+namespace settings {
+/*!
+ * Initialize the settings manager.
+ */
+void initializeBenchSettings(std::string const& name, std::string const& executableName);
+
+}  // namespace settings
+}  // namespace storm
@@ -0,0 +1,114 @@
+#include "storm-bench-cli/settings/modules/BenchmarkSettings.h"
+
+#include "storm/parser/CSVParser.h"
+#include "storm/settings/ArgumentBuilder.h"
+#include "storm/settings/Option.h"
+#include "storm/settings/OptionBuilder.h"
+#include "storm/settings/SettingsManager.h"
+
+namespace storm {
+namespace settings {
+namespace modules {
+
+const std::string BenchmarkSettings::moduleName = "benchmark";
+const std::string benchmarksOptionName = "benchmarks";
+const std::string repetitionsOptionName = "repetitions";
+const std::string outputOptionName = "output";
+const std::string compareOptionName = "compare";
+const std::string thresholdOptionName = "threshold";
+const std::string minimalTimeDifferenceOptionName = "mintimediff";
+const std::string exportDirectoryOptionName = "exportdir";
+
+// A subset of the QVBS that covers DTMCs, CTMCs and MDPs and that is solved within a few seconds each.
+const std::string defaultBenchmarks = "brp:0,crowds:0,leader_sync:0,nand:0,consensus:0,csma:0,embedded:0,polling:0";
+
+BenchmarkSettings::BenchmarkSettings() : ModuleSettings(moduleName) {
+    this->addOption(storm::settings::OptionBuilder(moduleName, benchmarksOptionName, false, "The QVBS benchmarks to run.")
+                        .addArgument(storm::settings::ArgumentBuilder::createStringArgument(
+                                         "benchmarks", "A comma separated list of entries <model name> or <model name>:<instance index>.")
+                                         .setDefaultValueString(defaultBenchmarks)
+                                         .build())
+                        .build());
+    this->addOption(storm::settings::OptionBuilder(moduleName, repetitionsOptionName, false, "How often each benchmark is run. The fastest run is reported.")
+                        .addArgument(storm::settings::ArgumentBuilder::createUnsignedIntegerArgument("count", "The number of runs.")
+                                         .setDefaultValueUnsignedInteger(3)
+                                         .addValidatorUnsignedInteger(ArgumentValidatorFactory::createUnsignedGreaterValidator(0))
+                                         .build())
+                        .build());
+    this->addOption(storm::settings::OptionBuilder(moduleName, outputOptionName, false, "Writes the measurements as JSON to the given file.")
+                        .setShortName("o")
+                        .addArgument(storm::settings::ArgumentBuilder::createStringArgument("filename", "The name of the file.").build())
+                        .build());
+    this->addOption(storm::settings::OptionBuilder(moduleName, compareOptionName, false,
+                                                   "Compares the measurements with the ones of a previous run and reports regressions.")
+                        .addArgument(storm::settings::ArgumentBuilder::createStringArgument("filename", "The JSON file written by the previous run.").build())
+                        .build());
+    this->addOption(storm::settings::OptionBuilder(moduleName, thresholdOptionName, false,
+                                                   "The relative increase of a time or memory measurement that is reported as regression.")
+                        .addArgument(storm::settings::ArgumentBuilder::createDoubleArgument("value", "The threshold.")
+                                         .setDefaultValueDouble(0.1)
+                                         .addValidatorDouble(ArgumentValidatorFactory::createDoubleGreaterEqualValidator(0.0))
+                                         .build())
+                        .build());
+    this->addOption(storm::settings::OptionBuilder(moduleName, minimalTimeDifferenceOptionName, false,
+                                                   "The minimal absolute increase (in seconds) of a time measurement that is reported as regression.")
+                        .addArgument(storm::settings::ArgumentBuilder::createDoubleArgument("value", "The time difference.")
+                                         .setDefaultValueDouble(0.05)
+                                         .addValidatorDouble(ArgumentValidatorFactory::createDoubleGreaterEqualValidator(0.0))
+                                         .build())
+                        .build());
+    this->addOption(storm::settings::OptionBuilder(moduleName, exportDirectoryOptionName, false,
+                                                   "The directory to which the built models are exported. Defaults to the temporary directory.")
+                        .addArgument(storm::settings::ArgumentBuilder::createStringArgument("directory", "The name of the directory.").build())
+                        .build());
+}
+
+std::vector<std::string> BenchmarkSettings::getBenchmarks() const {
+    return storm::parser::parseCommaSeperatedValues(this->getOption(benchmarksOptionName).getArgumentByName("benchmarks").getValueAsString());
+}
+
+uint64_t BenchmarkSettings::getRepetitions() const {
+    return this->getOption(repetitionsOptionName).getArgumentByName("count").getValueAsUnsignedInteger();
+}
+
+bool BenchmarkSettings::isOutputFilenameSet() const {
+    return this->getOption(outputOptionName).getHasOptionBeenSet();
+}
+
+std::string BenchmarkSettings::getOutputFilename() const {
+    return this->getOption(outputOptionName).getArgumentByName("filename").getValueAsString();
+}
+
+bool BenchmarkSettings::isCompareFilenameSet() const {
+    return this->getOption(compareOptionName).getHasOptionBeenSet();
+}
+
+std::string BenchmarkSettings::getCompareFilename() const {
+    return this->getOption(compareOptionName).getArgumentByName("filename").getValueAsString();
+}
+
+double BenchmarkSettings::getRegressionThreshold() const {
+    return this->getOption(thresholdOptionName).getArgumentByName("value").getValueAsDouble();
+}
+
+double BenchmarkSettings::getMinimalTimeDifference() const {
+    return this->getOption(minimalTimeDifferenceOptionName).getArgumentByName("value").getValueAsDouble();
+}
+
+bool BenchmarkSettings::isExportDirectorySet() const {
+    return this->getOption(exportDirectoryOptionName).getHasOptionBeenSet();
+}
+
+std::string BenchmarkSettings::getExportDirectory() const {
+    return this->getOption(exportDirectoryOptionName).getArgumentByName("directory").getValueAsString();
+}
+
+void BenchmarkSettings::finalize() {}
+
+bool BenchmarkSettings::check() const {
+    return true;
+}
+
+}  // namespace modules
+}  // namespace settings
+}  // namespace storm
@@ -0,0 +1,63 @@
+#pragma once
+
+#include <string>
+#include <vector>
+
+#include "storm/settings/modules/ModuleSettings.h"
+
+namespace storm {
+namespace settings {
+namespace modules {
+
+/*!
+ * This class represents the settings for running the QVBS benchmark suite.
+ */
+class BenchmarkSettings : public ModuleSettings {
+   public:
+    /*!
+     * Creates a new set of benchmark settings.
+     */
+    BenchmarkSettings();
+
+    virtual ~BenchmarkSettings() = default;
+
+    /*!
+     * Retrieves the benchmarks that are to be run, each given as "<qvbs model name>" or "<qvbs model name>:<instance index>".
+     */
+    std::vector<std::string> getBenchmarks() const;
+
+    /*!
+     * Retrieves the number of times each benchmark is run. The fastest run is reported.
+     */
+    uint64_t getRepetitions() const;
+
+    bool isOutputFilenameSet() const;
+    std::string getOutputFilename() const;
+
+    bool isCompareFilenameSet() const;
+    std::string getCompareFilename() const;
+
+    /*!
+     * Retrieves the relative increase of a measurement (compared to the previous run) that is considered a regression.
+     */
+    double getRegressionThreshold() const;
+
+    /*!
+     * Retrieves the minimal absolute increase of a time (in seconds) that is considered a regression.
+     * This avoids flagging noise on benchmarks that only take a few milliseconds.
+     */
+    double getMinimalTimeDifference() const;
+
+    bool isExportDirectorySet() const;
+    std::string getExportDirectory() const;
+
+    bool check() const override;
+    void finalize() override;
+
+    // The name of the module.
+    static const std::string moduleName;
+};
+
+}  // namespace modules
+}  // namespace settings
+}  // namespace storm
@@ -0,0 +1,266 @@
+#include "storm/utility/initialize.h"
+
+#include "storm-bench-cli/settings/BenchSettings.h"
+#include "storm-bench-cli/settings/modules/BenchmarkSettings.h"
+
+#include "storm-cli-utilities/cli.h"
+#include "storm-parsers/api/storm-parsers.h"
+#include "storm-version-info/storm-version.h"
+
+#include "storm/adapters/JsonAdapter.h"
+#include "storm/api/storm.h"
+#include "storm/environment/Environment.h"
+#include "storm/exceptions/BaseException.h"
+#include "storm/exceptions/WrongFormatException.h"
+#include "storm/io/file.h"
+#include "storm/modelchecker/results/ExplicitQualitativeCheckResult.h"
+#include "storm/settings/SettingsManager.h"
+#include "storm/storage/Qvbs.h"
+#include "storm/storage/SymbolicModelDescription.h"
+#include "storm/storage/jani/Property.h"
+#include "storm/utility/Stopwatch.h"
+#include "storm/utility/macros.h"
+
+#include <sys/resource.h>
+#include <algorithm>
+#include <filesystem>
+
+namespace storm {
+namespace bench {
+namespace cli {
+
+// Whether the comparison with a previous run found a regression. Determines the exit code.
+bool regressionFound = false;
+
+// The measured phases of a benchmark, as they appear in the JSON output.
+std::vector<std::string> const timeKeys = {"parse-time", "build-time", "solve-time", "export-time"};
+std::string const memoryKey = "peak-memory-mb";
+
+struct BenchmarkMeasurement {
+    std::map<std::string, double> times;
+    uint64_t states = 0;
+    uint64_t transitions = 0;
+    uint64_t choices = 0;
+    std::vector<std::pair<std::string, boost::optional<double>>> results;
+};
+
+uint64_t getPeakMemoryInMegabytes() {
+    struct rusage ru;
+    getrusage(RUSAGE_SELF, &ru);
+#ifdef MACOS
+    // For Mac OS, this is returned in bytes.
+    return ru.ru_maxrss / 1024 / 1024;
+#else
+    // For Linux, this is returned in kilobytes.
+    return ru.ru_maxrss / 1024;
+#endif
+}
+
+double toSeconds(storm::utility::Stopwatch const& watch) {
+    return static_cast<double>(watch.getTimeInMilliseconds()) / 1000.0;
+}
+
+std::pair<std::string, uint64_t> parseBenchmarkIdentifier(std::string const& identifier) {
+    auto separatorPos = identifier.find(':');
+    if (separatorPos == std::string::npos) {
+        return {identifier, 0};
+    }
+    try {
+        return {identifier.substr(0, separatorPos), std::stoull(identifier.substr(separatorPos + 1))};
+    } catch (std::logic_error const&) {
+        STORM_LOG_THROW(false, storm::exceptions::WrongFormatException, "Invalid benchmark '" << identifier << "'. Expected <model name>:<instance index>.");
+    }
+    return {identifier, 0};
+}
+
+/*!
+ * Runs the pipeline (parse, build, solve, export) once for the given benchmark.
+ */
+BenchmarkMeasurement runBenchmark(storm::storage::QvbsBenchmark const& benchmark, uint64_t instance, std::string const& exportFilename) {
+    BenchmarkMeasurement measurement;
+    // Always use the same, default-constructed environment so that the runs are comparable.
+    storm::Environment env;
+
+    storm::utility::Stopwatch parseWatch(true);
+    auto janiInput = storm::api::parseJaniModel(benchmark.getJaniFile(instance));
+    storm::storage::SymbolicModelDescription model(janiInput.first);
+    auto constantDefinitions = model.parseConstantDefinitions(benchmark.getConstantDefinition(instance));
+    model = model.preprocess(constantDefinitions);
+    std::vector<storm::jani::Property> properties = janiInput.second;
+    if (!properties.empty()) {
+        properties = storm::api::substituteConstantsInProperties(properties, constantDefinitions);
+    }
+    parseWatch.stop();
+    measurement.times["parse-time"] = toSeconds(parseWatch);
+
+    storm::utility::Stopwatch buildWatch(true);
+    auto sparseModel = storm::api::buildSparseModel<double>(model, storm::api::extractFormulasFromProperties(properties));
+    buildWatch.stop();
+    measurement.times["build-time"] = toSeconds(buildWatch);
+    measurement.states = sparseModel->getNumberOfStates();
+    measurement.transitions = sparseModel->getNumberOfTransitions();
+    measurement.choices = sparseModel->getNumberOfChoices();
+
+    storm::utility::Stopwatch solveWatch(true);
+    storm::modelchecker::ExplicitQualitativeCheckResult initialStatesFilter(sparseModel->getInitialStates());
+    for (auto const& property : properties) {
+        boost::optional<double> value;
+        try {
+            auto result = storm::api::verifyWithSparseEngine<double>(env, sparseModel, storm::api::createTask<double>(property.getRawFormula(), true));
+            if (result) {
+                result->filter(initialStatesFilter);
+                if (result->isQuantitative()) {
+                    value = result->asQuantitativeCheckResult<double>().getMin();
+                } else if (result->isQualitative()) {
+                    value = result->asQualitativeCheckResult().forallTrue() ? 1.0 : 0.0;
+                }
+            }
+        } catch (storm::exceptions::BaseException const& e) {
+            STORM_LOG_WARN("Property " << property.getName() << " could not be checked: " << e.what());
+        }
+        measurement.results.emplace_back(property.getName(), value);
+    }
+    solveWatch.stop();
+    measurement.times["solve-time"] = toSeconds(solveWatch);
+
+    storm::utility::Stopwatch exportWatch(true);
+    storm::api::exportSparseModelAsDrn(sparseModel, exportFilename);
+    exportWatch.stop();
+    measurement.times["export-time"] = toSeconds(exportWatch);
+    return measurement;
+}
+
+storm::json<double> runBenchmarks(storm::settings::modules::BenchmarkSettings const& settings) {
+    std::filesystem::path exportDirectory =
+        settings.isExportDirectorySet() ? std::filesystem::path(settings.getExportDirectory()) : std::filesystem::temp_directory_path();
+
+    storm::json<double> benchmarksJson = storm::json<double>::array();
+    for (auto const& identifier : settings.getBenchmarks()) {
+        auto [modelName, instance] = parseBenchmarkIdentifier(identifier);
+        storm::storage::QvbsBenchmark benchmark(modelName);
+        std::string exportFilename = (exportDirectory / (modelName + "-" + std::to_string(instance) + ".drn")).string();
+        STORM_PRINT_AND_LOG("Running benchmark " << identifier << " ...");
+
+        // Report the fastest of all runs for each phase.
+        BenchmarkMeasurement measurement = runBenchmark(benchmark, instance, exportFilename);
+        for (uint64_t repetition = 1; repetition < settings.getRepetitions(); ++repetition) {
+            BenchmarkMeasurement nextMeasurement = runBenchmark(benchmark, instance, exportFilename);
+            for (auto& time : measurement.times) {
+                time.second = std::min(time.second, nextMeasurement.times.at(time.first));
+            }
+        }
+        std::filesystem::remove(exportFilename);
+
+        storm::json<double> benchmarkJson;
+        benchmarkJson["id"] = identifier;
+        benchmarkJson["model"] = modelName;
+        benchmarkJson["instance"] = instance;
+        benchmarkJson["constants"] = benchmark.getConstantDefinition(instance);
+        benchmarkJson["states"] = measurement.states;
+        benchmarkJson["transitions"] = measurement.transitions;
+        benchmarkJson["choices"] = measurement.choices;
+        for (auto const& time : measurement.times) {
+            benchmarkJson[time.first] = time.second;
+        }
+        // The peak memory is measured for the whole process, i.e., it also covers all previous benchmarks.
+        benchmarkJson[memoryKey] = getPeakMemoryInMegabytes();
+        for (auto const& result : measurement.results) {
+            storm::json<double> resultJson;
+            resultJson["property"] = result.first;
+            if (result.second) {
+                resultJson["value"] = result.second.get();
+            }
+            benchmarkJson["results"].push_back(resultJson);
+        }
+        benchmarksJson.push_back(benchmarkJson);
+        STORM_PRINT_AND_LOG(" done (" << measurement.times.at("build-time") << "s build, " << measurement.times.at("solve-time") << "s solve).\n");
+    }
+
+    storm::json<double> resultJson;
+    resultJson["storm-version"] = storm::StormVersion::shortVersionString();
+    resultJson["repetitions"] = settings.getRepetitions();
+    resultJson["benchmarks"] = benchmarksJson;
+    return resultJson;
+}
+
+/*!
+ * Compares the given measurements with the ones of a previous run and reports all regressions.
+ * @return true iff a regression was found.
+ */
+bool compareWithPrevious(storm::json<double> const& current, storm::json<double> const& previous, double threshold, double minimalTimeDifference) {
+    bool result = false;
+    auto reportIfRegression = [&](std::string const& id, std::string const& key, double oldValue, double newValue, double minimalDifference) {
+        if (newValue > oldValue * (1.0 + threshold) && newValue - oldValue > minimalDifference) {
+            STORM_PRINT_AND_LOG("REGRESSION in " << id << ": " << key << " increased from " << oldValue << " to " << newValue << ".\n");
+            result = true;
+        }
+    };
+
+    for (auto const& benchmarkJson : current["benchmarks"]) {
+        std::string id = benchmarkJson["id"].get<std::string>();
+        auto previousIt = std::find_if(previous["benchmarks"].begin(), previous["benchmarks"].end(),
+                                       [&id](storm::json<double> const& entry) { return entry.count("id") == 1 && entry["id"].get<std::string>() == id; });
+        if (previousIt == previous["benchmarks"].end()) {
+            STORM_PRINT_AND_LOG("Benchmark " << id << " is not contained in the previous run.\n");
+            continue;
+        }
+        auto const& previousJson = *previousIt;
+        for (auto const& key : timeKeys) {
+            if (previousJson.count(key) == 1) {
+                reportIfRegression(id, key, previousJson[key].get<double>(), benchmarkJson[key].get<double>(), minimalTimeDifference);
+            }
+        }
+        if (previousJson.count(memoryKey) == 1) {
+            reportIfRegression(id, memoryKey, previousJson[memoryKey].get<double>(), benchmarkJson[memoryKey].get<double>(), 0.0);
+        }
+        if (previousJson.count("states") == 1 && previousJson["states"] != benchmarkJson["states"]) {
+            STORM_PRINT_AND_LOG("REGRESSION in " << id << ": number of states changed from " << previousJson["states"] << " to " << benchmarkJson["states"]
+                                                 << ".\n");
+            result = true;
+        }
+    }
+    return result;
+}
+
+void processOptions() {
+    auto const& settings = storm::settings::getModule<storm::settings::modules::BenchmarkSettings>();
+    storm::json<double> measurements = runBenchmarks(settings);
+
+    if (settings.isOutputFilenameSet()) {
+        std::ofstream stream;
+        storm::utility::openFile(settings.getOutputFilename(), stream);
+        stream << storm::dumpJson(measurements);
+        storm::utility::closeFile(stream);
+    } else {
+        STORM_PRINT(storm::dumpJson(measurements) << '\n');
+    }
+
+    if (settings.isCompareFilenameSet()) {
+        storm::json<double> previous;
+        std::ifstream file;
+        storm::utility::openFile(settings.getCompareFilename(), file);
+        file >> previous;
+        storm::utility::closeFile(file);
+        STORM_LOG_THROW(previous.count("benchmarks") == 1, storm::exceptions::WrongFormatException,
+                        "File " << settings.getCompareFilename() << " does not contain benchmark measurements.");
+        regressionFound = compareWithPrevious(measurements, previous, settings.getRegressionThreshold(), settings.getMinimalTimeDifference());
+        if (!regressionFound) {
+            STORM_PRINT_AND_LOG("No regressions found.\n");
+        }
+    }
+}
+
+}  // namespace cli
+}  // namespace bench
+}  // namespace storm
+
+/*!
+ * Entry point for the benchmark suite. Returns 1 if the comparison with a previous run found a regression.
+ */
+int main(const int argc, const char** argv) {
+    int result = storm::cli::process("Storm-bench", "storm-bench", storm::settings::initializeBenchSettings, storm::bench::cli::processOptions, argc, argv);
+    if (result == 0 && storm::bench::cli::regressionFound) {
+        return 1;
+    }
+    return result;
+}
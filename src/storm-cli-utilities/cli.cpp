@@ -5,13 +5,17 @@
 #include "storm/exceptions/OptionParserException.h"
 #include "storm/io/file.h"
 #include "storm/settings/SettingsManager.h"
+#include "storm/settings/modules/CoreSettings.h"
 #include "storm/settings/modules/DebugSettings.h"
 #include "storm/settings/modules/GeneralSettings.h"
+#include "storm/settings/modules/IOSettings.h"
 #include "storm/settings/modules/ResourceSettings.h"
+#include "storm/utility/Instrumentation.h"
 #include "storm/utility/SignalHandler.h"
 #include "storm/utility/Stopwatch.h"
 #include "storm/utility/initialize.h"
 #include "storm/utility/macros.h"
+#include "storm/utility/threads.h"
 
 #include "storm-cli-utilities/model-handling.h"
 
@@ -51,6 +55,14 @@ void setResourceLimits() {
         storm::utility::resources::setTimeoutAlarm(resources.getTimeoutInSeconds());
     }
 
+    // All parallel computations draw their threads from the same budget.
+    if (resources.isNumberOfThreadsSet()) {
+        storm::utility::setNumberOfThreads(resources.getNumberOfThreads());
+    }
+    if (resources.isPinThreadsSet()) {
+        storm::utility::setThreadPinning(true);
+    }
+
     // register signal handler to handle aborts
     storm::utility::resources::installSignalHandler(storm::settings::getModule<storm::settings::modules::ResourceSettings>().getSignalWaitingTimeInSeconds());
 }
@@ -62,6 +74,31 @@ void setFileLogging() {
     }
 }
 
+bool isShowStatisticsSet() {
+    return storm::settings::hasModule<storm::settings::modules::CoreSettings>() &&
+           storm::settings::getModule<storm::settings::modules::CoreSettings>().isShowStatisticsSet();
+}
+
+bool isExportTraceSet() {
+    return storm::settings::hasModule<storm::settings::modules::IOSettings>() &&
+           storm::settings::getModule<storm::settings::modules::IOSettings>().isExportTraceSet();
+}
+
+void setInstrumentation() {
+    // Only record the instrumented regions if they are reported in some way.
+    storm::utility::instrumentation::setEnabled(isShowStatisticsSet() || isExportTraceSet());
+}
+
+void reportInstrumentation() {
+    if (isShowStatisticsSet()) {
+        STORM_PRINT("\n");
+        storm::utility::instrumentation::printSummary(std::cout);
+    }
+    if (isExportTraceSet()) {
+        storm::utility::instrumentation::exportChromeTrace(storm::settings::getModule<storm::settings::modules::IOSettings>().getExportTraceFilename());
+    }
+}
+
 void setLogLevel() {
     storm::settings::modules::GeneralSettings const& general = storm::settings::getModule<storm::settings::modules::GeneralSettings>();
     storm::settings::modules::DebugSettings const& debug = storm::settings::getModule<storm::settings::modules::DebugSettings>();
@@ -80,28 +117,40 @@ void setLogLevel() {
 
 int process(std::string const& name, std::string const& executableName, std::function<void(std::string const&, std::string const&)> initSettingsFunc,
             std::function<void(void)> processOptionsFunc, const int argc, const char** argv) {
+    storm::utility::Stopwatch startupTimer(true);
     storm::utility::setUp();
     storm::cli::printHeader(name, argc, argv);
 
     // Initialize settings
+    storm::utility::Stopwatch settingsTimer(true);
     initSettingsFunc(name, executableName);
+    settingsTimer.stop();
 
     storm::utility::Stopwatch totalTimer(true);
+    storm::utility::Stopwatch parsingTimer(true);
     if (!parseOptions(argc, argv)) {
         return -1;
     }
+    parsingTimer.stop();
 
     // Start by setting some urgent options (log levels, resources, etc.)
     setResourceLimits();
     setLogLevel();
     setFileLogging();
+    setInstrumentation();
     // Set output precision
     storm::utility::setOutputDigitsFromGeneralPrecision(storm::settings::getModule<storm::settings::modules::GeneralSettings>().getPrecision());
+    startupTimer.stop();
+    if (storm::settings::getModule<storm::settings::modules::ResourceSettings>().isStartupProfileSet()) {
+        STORM_PRINT_AND_LOG("Startup took " << startupTimer.getTimeInMilliseconds() << "ms (registering settings: " << settingsTimer.getTimeInMilliseconds()
+                                            << "ms, parsing settings: " << parsingTimer.getTimeInMilliseconds() << "ms).\n");
+    }
 
     // Process options and start computations
     processOptionsFunc();
 
     totalTimer.stop();
+    reportInstrumentation();
     if (storm::settings::getModule<storm::settings::modules::ResourceSettings>().isPrintTimeAndMemorySet()) {
         storm::cli::printTimeAndMemoryStatistics(totalTimer.getTimeInMilliseconds());
     }
@@ -2,6 +2,7 @@
 
 #include "storm/api/storm.h"
 
+#include "storm-cli-utilities/server.h"
 #include "storm-counterexamples/api/counterexamples.h"
 #include "storm-gamebased-ar/api/verification.h"
 #include "storm-parsers/api/storm-parsers.h"
@@ -10,6 +11,7 @@
 #include "storm/io/file.h"
 #include "storm/utility/AutomaticSettings.h"
 #include "storm/utility/Engine.h"
+#include "storm/utility/Instrumentation.h"
 #include "storm/utility/NumberTraits.h"
 #include "storm/utility/SignalHandler.h"
 #include "storm/utility/macros.h"
@@ -17,6 +19,8 @@
 #include "storm/utility/Stopwatch.h"
 #include "storm/utility/initialize.h"
 
+#include <mutex>
+#include <optional>
 #include <type_traits>
 
 #include "storm/storage/SymbolicModelDescription.h"
@@ -27,9 +31,14 @@
 #include "storm/models/ModelBase.h"
 
 #include "storm/environment/Environment.h"
+#include "storm/environment/modelchecker/ModelCheckerEnvironment.h"
 
+#include "storm/exceptions/AbortException.h"
+#include "storm/exceptions/InvalidArgumentException.h"
+#include "storm/exceptions/NotSupportedException.h"
 #include "storm/exceptions/OptionParserException.h"
 
+#include "storm/modelchecker/results/ExplicitQualitativeCheckResult.h"
 #include "storm/modelchecker/results/SymbolicQualitativeCheckResult.h"
 
 #include "storm/models/sparse/StandardRewardModel.h"
@@ -71,9 +80,11 @@ inline void parseSymbolicModelDescription(storm::settings::modules::IOSettings c
     auto buildSettings = storm::settings::getModule<storm::settings::modules::BuildSettings>();
     if (ioSettings.isPrismOrJaniInputSet()) {
         storm::utility::Stopwatch modelParsingWatch(true);
+        boost::optional<storm::api::PrismParsingTimes> prismParsingTimes;
         if (ioSettings.isPrismInputSet()) {
-            input.model =
-                storm::api::parseProgram(ioSettings.getPrismInputFilename(), buildSettings.isPrismCompatibilityEnabled(), !buildSettings.isNoSimplifySet());
+            prismParsingTimes.emplace();
+            input.model = storm::api::parseProgram(ioSettings.getPrismInputFilename(), buildSettings.isPrismCompatibilityEnabled(),
+                                                   !buildSettings.isNoSimplifySet(), prismParsingTimes.get());
         } else {
             boost::optional<std::vector<std::string>> propertyFilter;
             if (ioSettings.isJaniPropertiesSet()) {
@@ -92,7 +103,13 @@ inline void parseSymbolicModelDescription(storm::settings::modules::IOSettings c
             }
         }
         modelParsingWatch.stop();
-        STORM_PRINT("Time for model input parsing: " << modelParsingWatch << ".\n\n");
+        if (prismParsingTimes) {
+            STORM_PRINT("Time for model input parsing: " << modelParsingWatch << " (syntax: " << prismParsingTimes->parsing
+                                                         << ", simplification: " << prismParsingTimes->simplification
+                                                         << ", semantic checks: " << prismParsingTimes->semanticChecks << ").\n\n");
+        } else {
+            STORM_PRINT("Time for model input parsing: " << modelParsingWatch << ".\n\n");
+        }
     }
 }
 
@@ -367,8 +384,11 @@ inline std::pair<SymbolicInput, ModelProcessingInformation> preprocessSymbolicIn
     std::string constantDefinitionString = ioSettings.getConstantDefinitionString();
     std::map<storm::expressions::Variable, storm::expressions::Expression> constantDefinitions;
     if (output.model) {
+        storm::utility::Stopwatch constantSubstitutionWatch(true);
         constantDefinitions = output.model.get().parseConstantDefinitions(constantDefinitionString);
         output.model = output.model.get().preprocess(constantDefinitions);
+        constantSubstitutionWatch.stop();
+        STORM_PRINT("Time for constant substitution: " << constantSubstitutionWatch << ".\n\n");
     }
     if (!output.properties.empty()) {
         output.properties = storm::api::substituteConstantsInProperties(output.properties, constantDefinitions);
@@ -482,6 +502,14 @@ inline storm::builder::BuilderOptions createBuildOptionsSparseFromSettings(Symbo
         options.setAddOverlappingGuardsLabel(true);
     }
 
+    if (buildSettings.isSymmetryReductionSet()) {
+        options.setSymmetryReduction(true);
+    }
+
+    if (buildSettings.isPartialOrderReductionSet()) {
+        options.setPartialOrderReduction(true);
+    }
+
     auto ioSettings = storm::settings::getModule<storm::settings::modules::IOSettings>();
     if (ioSettings.isComputeExpectedVisitingTimesSet() || ioSettings.isComputeSteadyStateDistributionSet()) {
         options.clearTerminalStates();
@@ -507,6 +535,7 @@ std::shared_ptr<storm::models::ModelBase> buildModelExplicit(storm::settings::mo
     } else if (ioSettings.isExplicitDRNSet()) {
         storm::parser::DirectEncodingParserOptions options;
         options.buildChoiceLabeling = buildSettings.isBuildChoiceLabelsSet();
+        options.numberOfThreads = buildSettings.getNumberOfExplorationThreads();
         result = storm::api::buildExplicitDRNModel<ValueType>(ioSettings.getExplicitDRNFilename(), options);
     } else {
         STORM_LOG_THROW(ioSettings.isExplicitIMCASet(), storm::exceptions::InvalidSettingsException, "Unexpected explicit model input type.");
@@ -527,7 +556,11 @@ std::shared_ptr<storm::models::ModelBase> buildModel(SymbolicInput const& input,
             result = buildModelDd<DdType, ValueType>(input);
         } else if (builderType == storm::builder::BuilderType::Explicit) {
             auto options = createBuildOptionsSparseFromSettings(input);
-            result = buildModelSparse<ValueType>(input, options);
+            if (storm::settings::getModule<storm::settings::modules::BuildSettings>().isSymbolicReachabilitySet()) {
+                result = storm::api::buildSparseModelWithSymbolicReachability<DdType, ValueType>(input.model.get(), options);
+            } else {
+                result = buildModelSparse<ValueType>(input, options);
+            }
         }
     } else if (ioSettings.isExplicitSet() || ioSettings.isExplicitDRNSet() || ioSettings.isExplicitIMCASet()) {
         STORM_LOG_THROW(mpi.engine == storm::utility::Engine::Sparse, storm::exceptions::InvalidSettingsException,
@@ -617,6 +650,13 @@ std::pair<std::shared_ptr<storm::models::sparse::Model<ValueType>>, bool> prepro
         result.second = true;
     }
 
+    if (transformationSettings.isReorderStatesSet()) {
+        STORM_LOG_INFO("Reordering the states of the model...");
+        // Labels, rewards and state valuations are permuted along with the states, so the results refer to the same states as before.
+        result.first = storm::api::permuteModelStates(result.first, transformationSettings.getStateOrder());
+        result.second = true;
+    }
+
     return result;
 }
 
@@ -632,7 +672,11 @@ void exportSparseModel(std::shared_ptr<storm::models::sparse::Model<ValueType>>
             case storm::exporter::ModelExportFormat::Drn:
                 storm::api::exportSparseModelAsDrn(model, ioSettings.getExportBuildFilename(),
                                                    input.model ? input.model.get().getParameterNames() : std::vector<std::string>(),
-                                                   !ioSettings.isExplicitExportPlaceholdersDisabled());
+                                                   !ioSettings.isExplicitExportPlaceholdersDisabled(),
+                                                   storm::settings::getModule<storm::settings::modules::BuildSettings>().getNumberOfExplorationThreads());
+                break;
+            case storm::exporter::ModelExportFormat::Drnb:
+                storm::api::exportSparseModelAsDrnb(model, ioSettings.getExportBuildFilename());
                 break;
             case storm::exporter::ModelExportFormat::Json:
                 storm::api::exportSparseModelAsJson(model, ioSettings.getExportBuildFilename());
@@ -1191,18 +1235,49 @@ void verifyWithExplorationEngine(SymbolicInput const& input, ModelProcessingInfo
         });
 }
 
+template<typename ValueType>
+void verifyWithStatisticalEngine(SymbolicInput const& input, ModelProcessingInformation const& mpi) {
+    STORM_LOG_ASSERT(input.model, "Expected symbolic model description.");
+    STORM_LOG_THROW((std::is_same<ValueType, double>::value), storm::exceptions::NotSupportedException,
+                    "Statistical model checking does not support other data-types than floating points.");
+    verifyProperties<ValueType>(
+        input, [&input, &mpi](std::shared_ptr<storm::logic::Formula const> const& formula, std::shared_ptr<storm::logic::Formula const> const& states) {
+            STORM_LOG_THROW(states->isInitialFormula(), storm::exceptions::NotSupportedException, "Statistical model checking can only filter initial states.");
+            return storm::api::verifyWithStatisticalEngine<ValueType>(mpi.env, input.model.get(), storm::api::createTask<ValueType>(formula, true));
+        });
+}
+
 template<typename ValueType>
 void verifyWithSparseEngine(std::shared_ptr<storm::models::ModelBase> const& model, SymbolicInput const& input, ModelProcessingInformation const& mpi) {
     auto sparseModel = model->as<storm::models::sparse::Model<ValueType>>();
     auto const& ioSettings = storm::settings::getModule<storm::settings::modules::IOSettings>();
-    auto verificationCallback = [&sparseModel, &ioSettings, &mpi](std::shared_ptr<storm::logic::Formula const> const& formula,
-                                                                  std::shared_ptr<storm::logic::Formula const> const& states) {
+    uint64_t hintCount = 0;  // this number will be prepended to the file name of hints in case of multiple properties.
+    auto verificationCallback = [&sparseModel, &ioSettings, &mpi, &hintCount](std::shared_ptr<storm::logic::Formula const> const& formula,
+                                                                              std::shared_ptr<storm::logic::Formula const> const& states) {
         bool filterForInitialStates = states->isInitialFormula();
         auto task = storm::api::createTask<ValueType>(formula, filterForInitialStates);
-        if (ioSettings.isExportSchedulerSet()) {
+        if (ioSettings.isExportSchedulerSet() || (ioSettings.isExportHintSet() && sparseModel->isNondeterministicModel())) {
             task.setProduceSchedulers(true);
         }
+        std::string const hintFilePrefix = hintCount == 0 ? std::string("") : std::to_string(hintCount);
+        ++hintCount;
+        if (ioSettings.isImportHintSet()) {
+            std::string const hintFilename = hintFilePrefix + ioSettings.getImportHintFilename();
+            if (storm::utility::fileExistsAndIsReadable(hintFilename)) {
+                STORM_LOG_WARN_COND(sparseModel->hasStateValuations(), "No information of state valuations available. The hint is matched via state ids.");
+                task.setHint(storm::api::importHint(sparseModel, hintFilename));
+            } else {
+                STORM_LOG_WARN("Could not read hint file " << hintFilename << ". Checking the property without hint.");
+            }
+        }
         std::unique_ptr<storm::modelchecker::CheckResult> result = storm::api::verifyWithSparseEngine<ValueType>(mpi.env, sparseModel, task);
+        if (result && ioSettings.isExportHintSet()) {
+            if (result->isExplicitQuantitativeCheckResult()) {
+                storm::api::exportHint(sparseModel, *result, hintFilePrefix + ioSettings.getExportHintFilename());
+            } else {
+                STORM_LOG_WARN("Hints can only be exported for explicit quantitative results.");
+            }
+        }
 
         std::unique_ptr<storm::modelchecker::CheckResult> filter;
         if (filterForInitialStates) {
@@ -1343,6 +1418,12 @@ typename std::enable_if<DdType != storm::dd::DdType::CUDD || std::is_same<ValueT
     } else {
         verifyWithAbstractionRefinementEngine<DdType, ValueType>(model, input, mpi);
     }
+
+    if (storm::settings::getModule<storm::settings::modules::CoreSettings>().isShowStatisticsSet()) {
+        STORM_PRINT("\nDD statistics:\n");
+        model->as<storm::models::symbolic::Model<DdType, ValueType>>()->getManager().printStatisticsToStream(std::cout);
+        STORM_PRINT("\n");
+    }
 }
 
 template<storm::dd::DdType DdType, typename ValueType>
@@ -1353,6 +1434,7 @@ typename std::enable_if<DdType == storm::dd::DdType::CUDD && !std::is_same<Value
 
 template<storm::dd::DdType DdType, typename ValueType>
 void verifyModel(std::shared_ptr<storm::models::ModelBase> const& model, SymbolicInput const& input, ModelProcessingInformation const& mpi) {
+    storm::utility::instrumentation::ScopedRegion region("model checking");
     if (model->isSparseModel()) {
         verifyWithSparseEngine<ValueType>(model, input, mpi);
     } else {
@@ -1361,26 +1443,56 @@ void verifyModel(std::shared_ptr<storm::models::ModelBase> const& model, Symboli
     }
 }
 
+/*!
+ * Records the memory occupied by the given model (if it has the given value type) for the statistics.
+ *
+ * @param preprocessed Whether the model is the result of the preprocessing (as opposed to the model building).
+ */
+template<storm::dd::DdType DdType, typename ValueType>
+void recordModelMemory(std::shared_ptr<storm::models::ModelBase> const& model, bool preprocessed) {
+    if (!storm::utility::instrumentation::isEnabled()) {
+        return;
+    }
+    if (auto sparseModel = std::dynamic_pointer_cast<storm::models::sparse::Model<ValueType>>(model)) {
+        storm::utility::instrumentation::recordMemory(preprocessed ? "model preprocessing: transition matrix" : "model building: transition matrix",
+                                                      sparseModel->getTransitionMatrix().getSizeInMemory());
+        if (sparseModel->hasStateValuations()) {
+            storm::utility::instrumentation::recordMemory(preprocessed ? "model preprocessing: state valuations" : "model building: state valuations",
+                                                          sparseModel->getStateValuations().getSizeInMemory());
+        }
+    } else if (auto symbolicModel = std::dynamic_pointer_cast<storm::models::symbolic::Model<DdType, ValueType>>(model)) {
+        storm::utility::instrumentation::recordMemory(preprocessed ? "model preprocessing: DD manager" : "model building: DD manager",
+                                                      symbolicModel->getManager().getSizeInMemory());
+    }
+}
+
 template<storm::dd::DdType DdType, typename BuildValueType, typename VerificationValueType = BuildValueType>
 std::shared_ptr<storm::models::ModelBase> buildPreprocessModelWithValueTypeAndDdlib(SymbolicInput const& input, ModelProcessingInformation const& mpi) {
     auto ioSettings = storm::settings::getModule<storm::settings::modules::IOSettings>();
     auto buildSettings = storm::settings::getModule<storm::settings::modules::BuildSettings>();
     std::shared_ptr<storm::models::ModelBase> model;
     if (!buildSettings.isNoBuildModelSet()) {
+        storm::utility::instrumentation::ScopedRegion region("model building");
         model = buildModel<DdType, BuildValueType>(input, ioSettings, mpi);
     }
 
     if (model) {
         model->printModelInformationToStream(std::cout);
+        recordModelMemory<DdType, BuildValueType>(model, false);
     }
 
     STORM_LOG_THROW(model || input.properties.empty(), storm::exceptions::InvalidSettingsException, "No input model.");
 
     if (model) {
+        storm::utility::instrumentation::ScopedRegion region("model preprocessing");
         auto preprocessingResult = preprocessModel<DdType, BuildValueType, VerificationValueType>(model, input, mpi);
         if (preprocessingResult.second) {
             model = preprocessingResult.first;
             model->printModelInformationToStream(std::cout);
+            recordModelMemory<DdType, BuildValueType>(model, true);
+            if constexpr (!std::is_same_v<BuildValueType, VerificationValueType>) {
+                recordModelMemory<DdType, VerificationValueType>(model, true);
+            }
         }
     }
     return model;
@@ -1395,6 +1507,89 @@ std::shared_ptr<storm::models::ModelBase> buildPreprocessExportModelWithValueTyp
     return model;
 }
 
+/*!
+ * Keeps the given model resident and answers property queries via a JSON-RPC server until the server is shut down. Supported methods are
+ * - "info", which returns the type and the size of the model, and
+ * - "check" with parameters "property" (a string containing one or more properties) and optionally "timeout" (in seconds), which returns the
+ *   minimal and maximal values (resp. whether all or some states satisfy the property) over the initial states for each property.
+ * Queries that exceed their timeout are aborted without affecting concurrent queries. If an approximation is available at that point, it is
+ * returned (marked as approximate) instead of an error.
+ */
+template<typename ValueType>
+void serveSparseModel(std::shared_ptr<storm::models::sparse::Model<ValueType>> const& model, SymbolicInput const& input,
+                      ModelProcessingInformation const& mpi) {
+    typedef JsonRpcServer::Json Json;
+    JsonRpcServer server;
+    server.addMethod("info", [&model](Json const&) {
+        Json info;
+        std::stringstream modelType;
+        modelType << model->getType();
+        info["type"] = modelType.str();
+        info["states"] = model->getNumberOfStates();
+        info["transitions"] = model->getNumberOfTransitions();
+        info["choices"] = model->getNumberOfChoices();
+        return info;
+    });
+
+    // The properties are parsed using the expression manager of the model, which must not be modified concurrently.
+    std::mutex parsingMutex;
+    std::string const constantDefinitionString = storm::settings::getModule<storm::settings::modules::IOSettings>().getConstantDefinitionString();
+    server.addMethod("check", [&](Json const& params) {
+        STORM_LOG_THROW(params.is_object() && params.count("property") > 0 && params["property"].is_string(), storm::exceptions::InvalidArgumentException,
+                        "Expected a parameter 'property'.");
+        std::vector<storm::jani::Property> properties;
+        {
+            std::lock_guard<std::mutex> lock(parsingMutex);
+            if (input.model) {
+                properties = storm::api::parsePropertiesForSymbolicModelDescription(params["property"].template get<std::string>(), input.model.get());
+                properties = storm::api::substituteConstantsInProperties(properties, input.model->parseConstantDefinitions(constantDefinitionString));
+            } else {
+                properties = storm::api::parseProperties(params["property"].template get<std::string>());
+            }
+            ensureNoUndefinedPropertyConstants(properties);
+        }
+
+        storm::Environment env = mpi.env;
+        if (params.count("timeout") > 0) {
+            env.modelchecker().setDeadline(std::chrono::steady_clock::now() +
+                                           std::chrono::milliseconds(static_cast<uint64_t>(params["timeout"].template get<double>() * 1000)));
+        }
+        storm::modelchecker::ExplicitQualitativeCheckResult initialStatesFilter(model->getInitialStates());
+        Json results = Json::array();
+        for (auto const& property : properties) {
+            auto result = storm::api::verifyWithSparseEngine<ValueType>(env, model, storm::api::createTask<ValueType>(property.getRawFormula(), true));
+            STORM_LOG_THROW(result, storm::exceptions::NotSupportedException, "The property " << property.getName() << " is not supported.");
+            // Results of computations that were stopped at the deadline can only be reported if they are marked as approximate.
+            bool const approximate =
+                result->isExplicitQuantitativeCheckResult() && result->template asExplicitQuantitativeCheckResult<ValueType>().isApproximate();
+            STORM_LOG_THROW(approximate || !env.modelchecker().isDeadlineSet() || std::chrono::steady_clock::now() < env.modelchecker().getDeadline(),
+                            storm::exceptions::AbortException, "The timeout of the request was exceeded.");
+            result->filter(initialStatesFilter);
+            Json resultJson;
+            resultJson["property"] = property.getName();
+            if (result->isQuantitative()) {
+                auto const& quantitativeResult = result->template asQuantitativeCheckResult<ValueType>();
+                resultJson["min"] = storm::utility::convertNumber<double>(quantitativeResult.getMin());
+                resultJson["max"] = storm::utility::convertNumber<double>(quantitativeResult.getMax());
+                if (approximate) {
+                    auto const& explicitResult = result->template asExplicitQuantitativeCheckResult<ValueType>();
+                    resultJson["approximate"] = true;
+                    if (explicitResult.hasErrorBound()) {
+                        resultJson["error-bound"] = explicitResult.getErrorBound();
+                    }
+                }
+            } else {
+                STORM_LOG_ASSERT(result->isQualitative(), "Unexpected type of check result.");
+                resultJson["all"] = result->asQualitativeCheckResult().forallTrue();
+                resultJson["any"] = result->asQualitativeCheckResult().existsTrue();
+            }
+            results.push_back(resultJson);
+        }
+        return results;
+    });
+    server.run(storm::settings::getModule<storm::settings::modules::IOSettings>().getServerPort());
+}
+
 template<storm::dd::DdType DdType, typename BuildValueType, typename VerificationValueType = BuildValueType>
 void processInputWithValueTypeAndDdlib(SymbolicInput const& input, ModelProcessingInformation const& mpi) {
     auto abstractionSettings = storm::settings::getModule<storm::settings::modules::AbstractionSettings>();
@@ -1406,11 +1601,20 @@ void processInputWithValueTypeAndDdlib(SymbolicInput const& input, ModelProcessi
         verifyWithAbstractionRefinementEngine<DdType, VerificationValueType>(input, mpi);
     } else if (mpi.engine == storm::utility::Engine::Exploration) {
         verifyWithExplorationEngine<VerificationValueType>(input, mpi);
+    } else if (mpi.engine == storm::utility::Engine::Statistical) {
+        verifyWithStatisticalEngine<VerificationValueType>(input, mpi);
     } else {
         std::shared_ptr<storm::models::ModelBase> model =
             buildPreprocessExportModelWithValueTypeAndDdlib<DdType, BuildValueType, VerificationValueType>(input, mpi);
         if (model) {
-            if (counterexampleSettings.isCounterexampleSet()) {
+            if (storm::settings::getModule<storm::settings::modules::IOSettings>().isServerSet()) {
+                STORM_LOG_THROW(model->isSparseModel(), storm::exceptions::NotSupportedException, "The server requires a sparse model.");
+                if constexpr (std::is_same_v<VerificationValueType, storm::RationalFunction>) {
+                    STORM_LOG_THROW(false, storm::exceptions::NotSupportedException, "The server does not support parametric models.");
+                } else {
+                    serveSparseModel<VerificationValueType>(model->as<storm::models::sparse::Model<VerificationValueType>>(), input, mpi);
+                }
+            } else if (counterexampleSettings.isCounterexampleSet()) {
                 generateCounterexamples<VerificationValueType>(model, input);
             } else {
                 verifyModel<DdType, VerificationValueType>(model, input, mpi);
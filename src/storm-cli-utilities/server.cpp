@@ -0,0 +1,153 @@
+#include "storm-cli-utilities/server.h"
+
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <poll.h>
+#include <sys/socket.h>
+#include <unistd.h>
+#include <algorithm>
+#include <cstring>
+
+#include "storm/exceptions/AbortException.h"
+#include "storm/exceptions/BaseException.h"
+#include "storm/exceptions/InvalidArgumentException.h"
+#include "storm/exceptions/UnexpectedException.h"
+#include "storm/utility/SignalHandler.h"
+#include "storm/utility/macros.h"
+
+namespace storm {
+namespace cli {
+
+JsonRpcServer::JsonRpcServer() : shutdownRequested(false) {
+    addMethod("shutdown", [this](Json const&) {
+        shutdownRequested = true;
+        return Json(true);
+    });
+}
+
+void JsonRpcServer::addMethod(std::string const& name, Method const& method) {
+    methods[name] = method;
+}
+
+JsonRpcServer::Json JsonRpcServer::createError(Json const& id, int code, std::string const& message) {
+    Json response;
+    response["jsonrpc"] = "2.0";
+    response["id"] = id;
+    response["error"]["code"] = code;
+    response["error"]["message"] = message;
+    return response;
+}
+
+std::string JsonRpcServer::handleRequest(std::string const& request) const {
+    Json requestJson;
+    try {
+        requestJson = Json::parse(request);
+    } catch (Json::exception const& e) {
+        return storm::dumpJson(createError(nullptr, parseError, e.what()), true);
+    }
+    Json id = requestJson.is_object() && requestJson.count("id") > 0 ? requestJson["id"] : Json();
+    if (!requestJson.is_object() || requestJson.count("method") == 0 || !requestJson["method"].is_string()) {
+        return storm::dumpJson(createError(id, invalidRequest, "Expected an object with a method."), true);
+    }
+    auto methodIt = methods.find(requestJson["method"].get<std::string>());
+    if (methodIt == methods.end()) {
+        return storm::dumpJson(createError(id, methodNotFound, "Unknown method '" + requestJson["method"].get<std::string>() + "'."), true);
+    }
+
+    Json response;
+    try {
+        response["result"] = methodIt->second(requestJson.count("params") > 0 ? requestJson["params"] : Json());
+    } catch (storm::exceptions::AbortException const& e) {
+        return storm::dumpJson(createError(id, requestTimedOut, e.what()), true);
+    } catch (storm::exceptions::InvalidArgumentException const& e) {
+        return storm::dumpJson(createError(id, invalidParams, e.what()), true);
+    } catch (storm::exceptions::BaseException const& e) {
+        return storm::dumpJson(createError(id, requestFailed, e.what()), true);
+    } catch (Json::exception const& e) {
+        return storm::dumpJson(createError(id, invalidParams, e.what()), true);
+    }
+    response["jsonrpc"] = "2.0";
+    response["id"] = id;
+    return storm::dumpJson(response, true);
+}
+
+void JsonRpcServer::serveConnection(int socket) {
+    std::string buffer;
+    char chunk[4096];
+    ssize_t received;
+    while ((received = recv(socket, chunk, sizeof(chunk), 0)) > 0) {
+        buffer.append(chunk, received);
+        std::size_t lineEnd;
+        while ((lineEnd = buffer.find('\n')) != std::string::npos) {
+            std::string request = buffer.substr(0, lineEnd);
+            buffer.erase(0, lineEnd + 1);
+            if (request.find_first_not_of(" \t\r") == std::string::npos) {
+                continue;
+            }
+            std::string response = handleRequest(request) + "\n";
+            for (std::size_t sent = 0; sent < response.size();) {
+                ssize_t result = send(socket, response.data() + sent, response.size() - sent, MSG_NOSIGNAL);
+                if (result <= 0) {
+                    break;
+                }
+                sent += result;
+            }
+        }
+    }
+
+    std::lock_guard<std::mutex> lock(connectionsMutex);
+    openConnections.erase(std::find(openConnections.begin(), openConnections.end(), socket));
+    close(socket);
+}
+
+void JsonRpcServer::run(uint16_t port) {
+    int listeningSocket = ::socket(AF_INET, SOCK_STREAM, 0);
+    STORM_LOG_THROW(listeningSocket >= 0, storm::exceptions::UnexpectedException, "Unable to create a socket: " << std::strerror(errno) << ".");
+    int reuseAddress = 1;
+    setsockopt(listeningSocket, SOL_SOCKET, SO_REUSEADDR, &reuseAddress, sizeof(reuseAddress));
+
+    // Only accept connections from the local machine.
+    sockaddr_in address;
+    std::memset(&address, 0, sizeof(address));
+    address.sin_family = AF_INET;
+    address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+    address.sin_port = htons(port);
+    if (bind(listeningSocket, reinterpret_cast<sockaddr*>(&address), sizeof(address)) != 0 || listen(listeningSocket, 16) != 0) {
+        std::string error = std::strerror(errno);
+        close(listeningSocket);
+        STORM_LOG_THROW(false, storm::exceptions::UnexpectedException, "Unable to listen at port " << port << ": " << error << ".");
+    }
+    STORM_PRINT_AND_LOG("Listening at localhost:" << port << ".\n");
+
+    std::vector<std::thread> connectionThreads;
+    // Poll with a timeout, such that shutdown requests and abort signals are noticed.
+    pollfd listeningPollFd{listeningSocket, POLLIN, 0};
+    while (!shutdownRequested && !storm::utility::resources::SignalInformation::infos().isTerminate()) {
+        if (poll(&listeningPollFd, 1, 200) <= 0 || !(listeningPollFd.revents & POLLIN)) {
+            continue;
+        }
+        int connection = accept(listeningSocket, nullptr, nullptr);
+        if (connection < 0) {
+            continue;
+        }
+        std::lock_guard<std::mutex> lock(connectionsMutex);
+        openConnections.push_back(connection);
+        connectionThreads.emplace_back(&JsonRpcServer::serveConnection, this, connection);
+    }
+    close(listeningSocket);
+
+    // Stop receiving further requests. Requests that are currently processed are still answered.
+    {
+        std::lock_guard<std::mutex> lock(connectionsMutex);
+        for (int connection : openConnections) {
+            shutdown(connection, SHUT_RD);
+        }
+    }
+    for (auto& thread : connectionThreads) {
+        thread.join();
+    }
+    STORM_PRINT_AND_LOG("Server stopped.\n");
+}
+
+}  // namespace cli
+}  // namespace storm
@@ -0,0 +1,75 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <map>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "storm/adapters/JsonAdapter.h"
+
+namespace storm {
+namespace cli {
+
+/*!
+ * A minimal JSON-RPC 2.0 server that listens at a port of localhost. Each line that a client sends is one request, e.g.
+ *
+ *   {"jsonrpc":"2.0","id":1,"method":"check","params":{"property":"P=? [F \"goal\"]","timeout":10}}
+ *
+ * and each request is answered by one line containing the response. Every connection is served by its own thread, so requests of different
+ * connections are processed concurrently while the requests of one connection are processed in order.
+ * The method "shutdown" stops the server; the server also stops once the program receives an abort signal.
+ */
+class JsonRpcServer {
+   public:
+    typedef storm::json<double> Json;
+
+    /*!
+     * A method receives the parameters of the request (or null if there are none) and returns the result.
+     * Throwing a storm exception results in an error response that contains the message of the exception.
+     */
+    typedef std::function<Json(Json const& params)> Method;
+
+    // Error codes as defined by the JSON-RPC 2.0 specification (and a server-defined range for failed and timed out requests).
+    static const int parseError = -32700;
+    static const int invalidRequest = -32600;
+    static const int methodNotFound = -32601;
+    static const int invalidParams = -32602;
+    static const int requestFailed = -32000;
+    static const int requestTimedOut = -32001;
+
+    JsonRpcServer();
+
+    /*!
+     * Registers a method under the given name.
+     */
+    void addMethod(std::string const& name, Method const& method);
+
+    /*!
+     * Handles a single request, i.e., one line sent by a client, and returns the response.
+     */
+    std::string handleRequest(std::string const& request) const;
+
+    /*!
+     * Listens at the given port of localhost and serves all connections until the server is shut down.
+     */
+    void run(uint16_t port);
+
+   private:
+    void serveConnection(int socket);
+
+    static Json createError(Json const& id, int code, std::string const& message);
+
+    std::map<std::string, Method> methods;
+    std::atomic<bool> shutdownRequested;
+
+    // The sockets of all open connections, such that they can be closed at shutdown.
+    std::mutex connectionsMutex;
+    std::vector<int> openConnections;
+};
+
+}  // namespace cli
+}  // namespace storm
@@ -97,6 +97,16 @@ void processPrismInputJaniOutput(storm::prism::Program const& prismProg, std::ve
     }
     options.janiOptions.modelName = outputFilename.substr(startOfFilename, endOfFilename - startOfFilename);
 
+    if (jani.isStreamingSet()) {
+        // The model is written while it is converted.
+        if (outputFilename != "") {
+            storm::api::exportPrismToJaniStreaming(prismProg, properties, outputFilename, options, jani.isCompactJsonSet());
+            STORM_PRINT_AND_LOG("Stored to file '" << outputFilename << "'");
+        }
+        stopStopwatch(conversionTime);
+        return;
+    }
+
     auto janiModelProperties = storm::api::convertPrismToJani(prismProg, properties, options);
 
     stopStopwatch(conversionTime);
@@ -1,5 +1,7 @@
 #include "storm-conv/api/storm-conv.h"
 
+#include "storm-conv/converter/PrismToJaniStreamingConverter.h"
+
 #include "storm/api/properties.h"
 #include "storm/io/file.h"
 #include "storm/settings/SettingsManager.h"
@@ -132,6 +134,16 @@ std::pair<storm::jani::Model, std::vector<storm::jani::Property>> convertPrismTo
     return res;
 }
 
+void exportPrismToJaniStreaming(storm::prism::Program const& program, std::vector<storm::jani::Property> const& properties, std::string const& filename,
+                                storm::converter::PrismToJaniConverterOptions const& options, bool compact) {
+    storm::converter::PrismToJaniStreamingConverter converter(program, properties, options);
+    converter.setCompact(compact);
+    std::ofstream stream;
+    storm::utility::openFile(filename, stream, false, true);
+    converter.write(stream);
+    storm::utility::closeFile(stream);
+}
+
 void exportJaniToFile(storm::jani::Model const& model, std::vector<storm::jani::Property> const& properties, std::string const& filename, bool compact) {
     storm::jani::JsonExporter::toFile(model, properties, filename, true, compact);
 }
@@ -26,6 +26,13 @@ std::pair<storm::jani::Model, std::vector<storm::jani::Property>> convertPrismTo
 std::pair<storm::jani::Model, std::vector<storm::jani::Property>> convertPrismToJani(
     storm::prism::Program const& program, storm::converter::PrismToJaniConverterOptions options = storm::converter::PrismToJaniConverterOptions());
 
+/*!
+ * Converts the program to JANI and writes the result to the given file. In contrast to first converting and then exporting, the edges are written while the
+ * commands are translated, so the JANI model is never kept in memory as a whole.
+ */
+void exportPrismToJaniStreaming(storm::prism::Program const& program, std::vector<storm::jani::Property> const& properties, std::string const& filename,
+                                storm::converter::PrismToJaniConverterOptions const& options, bool compact = false);
+
 void exportJaniToFile(storm::jani::Model const& model, std::vector<storm::jani::Property> const& properties, std::string const& filename, bool compact = false);
 void printJaniToStream(storm::jani::Model const& model, std::vector<storm::jani::Property> const& properties, std::ostream& ostream, bool compact = false);
 void exportPrismToFile(storm::prism::Program const& program, std::vector<storm::jani::Property> const& properties, std::string const& filename);
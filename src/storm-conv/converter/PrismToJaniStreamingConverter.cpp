@@ -0,0 +1,263 @@
+#include "storm-conv/converter/PrismToJaniStreamingConverter.h"
+
+#include <map>
+#include <set>
+#include <string>
+#include <unordered_map>
+
+#include "storm/adapters/JsonAdapter.h"
+#include "storm/storage/expressions/ExpressionManager.h"
+#include "storm/storage/jani/Automaton.h"
+#include "storm/storage/jani/Constant.h"
+#include "storm/storage/jani/Edge.h"
+#include "storm/storage/jani/Model.h"
+#include "storm/storage/jani/Property.h"
+#include "storm/storage/jani/TemplateEdge.h"
+#include "storm/storage/jani/expressions/FunctionCallExpression.h"
+#include "storm/storage/jani/visitor/JSONExporter.h"
+#include "storm/storage/jani/visitor/JaniExpressionSubstitutionVisitor.h"
+#include "storm/storage/prism/Program.h"
+#include "storm/storage/prism/ToJaniConverter.h"
+#include "storm/utility/macros.h"
+
+namespace storm {
+namespace converter {
+
+PrismToJaniStreamingConverter::PrismToJaniStreamingConverter(storm::prism::Program const& program, std::vector<storm::jani::Property> const& properties,
+                                                             PrismToJaniConverterOptions const& options)
+    : program(program), properties(properties), options(options), compact(false) {
+    // Intentionally left empty
+}
+
+void PrismToJaniStreamingConverter::setCompact(bool value) {
+    compact = value;
+}
+
+void PrismToJaniStreamingConverter::write(std::ostream& stream) const {
+    auto const& janiOptions = options.janiOptions;
+    STORM_LOG_WARN_COND(!janiOptions.flatten && !janiOptions.localVars && janiOptions.locationVariables.empty() && !janiOptions.simplifyComposition &&
+                            !janiOptions.locationElimination && !janiOptions.replaceUnassignedVariablesWithConstants,
+                        "Transformations of the JANI model are ignored when streaming the conversion.");
+
+    // Translate everything but the commands with the regular converter. We keep the modules (and their renamings) such that the variables, formulas and
+    // automata are translated as usual. As the commands are not known to the converter, all variables need to be global.
+    std::vector<storm::prism::Module> modulesWithoutCommands;
+    modulesWithoutCommands.reserve(program.getNumberOfModules());
+    for (auto const& module : program.getModules()) {
+        if (module.isRenamedFromModule()) {
+            modulesWithoutCommands.emplace_back(module.getName(), module.getBooleanVariables(), module.getIntegerVariables(), module.getClockVariables(),
+                                                module.getInvariant(), std::vector<storm::prism::Command>(), module.getBaseModule(),
+                                                storm::prism::ModuleRenaming(module.getRenaming()), module.getFilename(), module.getLineNumber());
+        } else {
+            modulesWithoutCommands.emplace_back(module.getName(), module.getBooleanVariables(), module.getIntegerVariables(), module.getClockVariables(),
+                                                module.getInvariant(), std::vector<storm::prism::Command>(), module.getFilename(), module.getLineNumber());
+        }
+    }
+    storm::prism::Program programWithoutCommands(program.getManager().getSharedPointer(), program.getModelType(), program.getConstants(),
+                                                 program.getGlobalBooleanVariables(), program.getGlobalIntegerVariables(), program.getFormulas(),
+                                                 program.getPlayers(), modulesWithoutCommands, program.getActionNameToIndexMapping(),
+                                                 program.getRewardModels(), program.getLabels(), program.getObservationLabels(),
+                                                 program.getOptionalInitialConstruct(), program.getOptionalSystemCompositionConstruct(), false,
+                                                 program.getFilename(), program.getLineNumber(), false);
+    storm::prism::ToJaniConverter converter;
+    storm::jani::Model janiModel = converter.convert(programWithoutCommands, true, {}, options.suffix);
+    std::vector<storm::jani::Property> janiProperties = converter.applyRenaming(properties);
+    if (janiOptions.modelName) {
+        janiModel.setName(janiOptions.modelName.get());
+    }
+    if (janiOptions.addPropertyConstants) {
+        for (auto const& property : janiProperties) {
+            for (auto const& constant : property.getUndefinedConstants()) {
+                if (!janiModel.hasConstant(constant.getName())) {
+                    janiModel.addConstant(storm::jani::Constant(constant.getName(), constant));
+                }
+            }
+        }
+    }
+
+    storm::expressions::ExpressionManager const& manager = program.getManager();
+    auto const& formulaToFunctionCallMap = converter.getFormulaToFunctionCallMap();
+    auto substituteFormulas = [&formulaToFunctionCallMap](storm::expressions::Expression const& expression,
+                                                          std::map<storm::expressions::Variable, storm::expressions::Expression> const& substitution) {
+        return formulaToFunctionCallMap.empty() ? expression : storm::jani::substituteJaniExpression(expression, substitution);
+    };
+    std::vector<std::map<storm::expressions::Variable, storm::expressions::Expression>> moduleSubstitutions;
+    for (auto const& module : program.getModules()) {
+        if (!formulaToFunctionCallMap.empty() && module.isRenamedFromModule()) {
+            moduleSubstitutions.push_back(program.getSubstitutionForRenamedModule(module, formulaToFunctionCallMap));
+        } else {
+            moduleSubstitutions.push_back(formulaToFunctionCallMap);
+        }
+    }
+
+    // In compact mode, declare a function for each guard that occurs more than once.
+    std::unordered_map<std::string, storm::expressions::Expression> sharedGuards;
+    if (compact) {
+        std::unordered_map<std::string, std::pair<uint64_t, storm::expressions::Expression>> guardOccurrences;
+        std::vector<std::string> guardsInOrder;
+        for (uint64_t moduleIndex = 0; moduleIndex < program.getNumberOfModules(); ++moduleIndex) {
+            for (auto const& command : program.getModule(moduleIndex).getCommands()) {
+                auto guard = substituteFormulas(command.getGuardExpression(), moduleSubstitutions[moduleIndex]);
+                if (guard.isLiteral() || guard.isVariable()) {
+                    continue;
+                }
+                auto insertionResult = guardOccurrences.try_emplace(guard.toString(), 0, guard);
+                if (insertionResult.second) {
+                    guardsInOrder.push_back(insertionResult.first->first);
+                }
+                ++insertionResult.first->second.first;
+            }
+        }
+        uint64_t functionIndex = 0;
+        for (auto const& guardString : guardsInOrder) {
+            auto const& occurrence = guardOccurrences.at(guardString);
+            if (occurrence.first < 2) {
+                continue;
+            }
+            std::string functionName;
+            do {
+                functionName = "shared_guard_" + std::to_string(functionIndex++);
+            } while (janiModel.getGlobalFunctionDefinitions().count(functionName) > 0 || janiModel.hasGlobalVariable(functionName) ||
+                     janiModel.hasConstant(functionName));
+            janiModel.addFunctionDefinition(storm::jani::FunctionDefinition(functionName, manager.getBooleanType(), {}, occurrence.second));
+            sharedGuards.emplace(guardString, std::make_shared<storm::expressions::FunctionCallExpression>(
+                                                  manager, manager.getBooleanType(), functionName,
+                                                  std::vector<std::shared_ptr<storm::expressions::BaseExpression const>>())
+                                                  ->toExpression());
+        }
+        if (!sharedGuards.empty()) {
+            janiModel.getModelFeatures().add(storm::jani::ModelFeature::Functions);
+        }
+        STORM_LOG_INFO("Declared " << sharedGuards.size() << " functions for guards that occur more than once.");
+    }
+
+    // Collect the transient assignments for the action rewards. As in the regular conversion, they are only added to the edges of the first module that
+    // has the respective action.
+    std::map<uint64_t, std::vector<storm::jani::Assignment>> transientEdgeAssignments;
+    for (auto const& rewardModel : program.getRewardModels()) {
+        std::string rewardModelName = rewardModel.getName().empty() ? "default_reward_model" : rewardModel.getName();
+        auto renamingIt = converter.getRewardModelRenaming().find(rewardModel.getName());
+        if (renamingIt != converter.getRewardModelRenaming().end()) {
+            rewardModelName = renamingIt->second;
+        }
+        storm::jani::Variable const& rewardVariable = janiModel.getGlobalVariables().getVariable(rewardModelName);
+        std::map<uint64_t, storm::expressions::Expression> actionIndexToExpression;
+        for (auto const& actionReward : rewardModel.getStateActionRewards()) {
+            storm::expressions::Expression rewardTerm =
+                actionReward.getStatePredicateExpression().isTrue()
+                    ? actionReward.getRewardValueExpression()
+                    : storm::expressions::ite(actionReward.getStatePredicateExpression(), actionReward.getRewardValueExpression(), manager.rational(0));
+            rewardTerm = substituteFormulas(rewardTerm, formulaToFunctionCallMap);
+            auto it = actionIndexToExpression.find(janiModel.getActionIndex(actionReward.getActionName()));
+            if (it != actionIndexToExpression.end()) {
+                it->second = it->second + rewardTerm;
+            } else {
+                actionIndexToExpression.emplace(janiModel.getActionIndex(actionReward.getActionName()), rewardTerm);
+            }
+        }
+        for (auto const& entry : actionIndexToExpression) {
+            transientEdgeAssignments[entry.first].emplace_back(storm::jani::LValue(rewardVariable), entry.second);
+        }
+    }
+
+    // Write the model. The automata are taken from the translated model, only their edges are produced on the fly.
+    storm::jani::ExportJsonType modelJson = storm::jani::JsonExporter::toJson(janiModel, janiProperties, false, !compact);
+    auto const actionNames = janiModel.getActionIndexToNameMap();
+    bool isContinuousTime = program.getModelType() == storm::prism::Program::ModelType::CTMC ||
+                            program.getModelType() == storm::prism::Program::ModelType::CTMDP;
+    uint64_t numberOfEdges = 0;
+    storm::JsonStreamWriter<storm::RationalNumber> writer(stream, compact);
+    writer.beginObject();
+    for (auto const& entry : modelJson.items()) {
+        if (entry.key() != "automata") {
+            writer.key(entry.key());
+            writer.value(entry.value());
+            continue;
+        }
+        writer.key("automata");
+        writer.beginArray();
+        for (uint64_t moduleIndex = 0; moduleIndex < program.getNumberOfModules(); ++moduleIndex) {
+            auto const& module = program.getModule(moduleIndex);
+            auto const& automaton = janiModel.getAutomaton(moduleIndex);
+            STORM_LOG_ASSERT(automaton.getName() == module.getName(), "Unexpected order of automata.");
+            uint64_t locationIndex = *automaton.getInitialLocationIndices().begin();
+            auto const locationNames = automaton.buildIdToLocationNameMap();
+            auto const& substitution = moduleSubstitutions[moduleIndex];
+
+            writer.beginObject();
+            for (auto const& automatonEntry : entry.value()[moduleIndex].items()) {
+                if (automatonEntry.key() != "edges") {
+                    writer.key(automatonEntry.key());
+                    writer.value(automatonEntry.value());
+                    continue;
+                }
+                writer.key("edges");
+                writer.beginArray();
+                std::set<uint64_t> actionIndicesOfModule;
+                for (auto const& command : module.getCommands()) {
+                    uint64_t actionIndex = janiModel.getActionIndex(command.getActionName());
+                    actionIndicesOfModule.insert(actionIndex);
+                    storm::expressions::Expression guard = substituteFormulas(command.getGuardExpression(), substitution);
+                    if (guard.isFalse()) {
+                        continue;
+                    }
+                    if (!sharedGuards.empty()) {
+                        auto sharedGuardIt = sharedGuards.find(guard.toString());
+                        if (sharedGuardIt != sharedGuards.end()) {
+                            guard = sharedGuardIt->second;
+                        }
+                    }
+
+                    auto templateEdge = std::make_shared<storm::jani::TemplateEdge>(guard);
+                    boost::optional<storm::expressions::Expression> rateExpression;
+                    if (isContinuousTime || (program.getModelType() == storm::prism::Program::ModelType::MA && command.isMarkovian())) {
+                        for (auto const& update : command.getUpdates()) {
+                            auto likelihood = substituteFormulas(update.getLikelihoodExpression(), substitution);
+                            rateExpression = rateExpression ? rateExpression.get() + likelihood : likelihood;
+                        }
+                    }
+                    std::vector<std::pair<uint64_t, storm::expressions::Expression>> destinationLocationsAndProbabilities;
+                    for (auto const& update : command.getUpdates()) {
+                        std::vector<storm::jani::Assignment> assignments;
+                        for (auto const& assignment : update.getAssignments()) {
+                            assignments.emplace_back(storm::jani::LValue(janiModel.getGlobalVariables().getVariable(assignment.getVariable())),
+                                                     substituteFormulas(assignment.getExpression(), substitution));
+                        }
+                        auto likelihood = substituteFormulas(update.getLikelihoodExpression(), substitution);
+                        destinationLocationsAndProbabilities.emplace_back(locationIndex, rateExpression ? likelihood / rateExpression.get() : likelihood);
+                        templateEdge->addDestination(storm::jani::TemplateEdgeDestination(assignments));
+                    }
+                    auto transientAssignmentsIt = transientEdgeAssignments.find(actionIndex);
+                    if (transientAssignmentsIt != transientEdgeAssignments.end()) {
+                        for (auto const& assignment : transientAssignmentsIt->second) {
+                            templateEdge->addTransientAssignment(assignment);
+                        }
+                    }
+                    if (!janiOptions.edgeAssignments) {
+                        templateEdge->pushAssignmentsToDestinations();
+                    }
+
+                    storm::jani::Edge edge(locationIndex, actionIndex, rateExpression, templateEdge, destinationLocationsAndProbabilities);
+                    writer.value(storm::jani::JsonExporter::getEdgeAsJson(janiModel, moduleIndex, edge, actionNames, locationNames, !compact));
+                    ++numberOfEdges;
+                }
+                writer.endArray();
+
+                // Rewards of synchronizing actions must not be dealt out multiple times.
+                for (auto actionIndex : actionIndicesOfModule) {
+                    if (actionIndex != storm::jani::Model::SILENT_ACTION_INDEX) {
+                        transientEdgeAssignments.erase(actionIndex);
+                    }
+                }
+            }
+            writer.endObject();
+        }
+        writer.endArray();
+    }
+    writer.endObject();
+    stream << '\n';
+    STORM_LOG_INFO("Wrote " << numberOfEdges << " edges of JANI model " << janiModel.getName() << ".");
+}
+
+}  // namespace converter
+}  // namespace storm
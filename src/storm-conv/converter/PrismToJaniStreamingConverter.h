@@ -0,0 +1,54 @@
+#pragma once
+
+#include <ostream>
+#include <vector>
+
+#include "storm-conv/converter/options/PrismToJaniConverterOptions.h"
+
+namespace storm {
+
+namespace prism {
+class Program;
+}
+namespace jani {
+class Property;
+}
+
+namespace converter {
+
+/*!
+ * Converts a PRISM program to JANI and writes the result to a stream without keeping the edges of the JANI model in memory.
+ * Everything except the commands (variables, labels, reward models, formulas, ...) is translated by the regular converter. The commands are then
+ * translated one by one and the resulting edges are directly written to the output.
+ * In compact mode, guards that occur more than once are declared as (parameterless) functions so that each of them is only written once.
+ */
+class PrismToJaniStreamingConverter {
+   public:
+    /*!
+     * @param program The program to convert.
+     * @param properties Properties that are written to the output (after applying the renamings of the conversion).
+     * @param options The options of the conversion. As the model is not built as a whole, all variables are made global and the transformations of the JANI
+     * model (apart from setting the model name and adding property constants) are not supported. In particular, constants are not substituted.
+     */
+    PrismToJaniStreamingConverter(storm::prism::Program const& program, std::vector<storm::jani::Property> const& properties,
+                                  PrismToJaniConverterOptions const& options);
+
+    /*!
+     * Sets whether the output shall be compact, i.e., without pretty-printing and comments and with repeated guards shared via functions.
+     */
+    void setCompact(bool value);
+
+    /*!
+     * Converts the program and writes the resulting JANI model to the given stream.
+     */
+    void write(std::ostream& stream) const;
+
+   private:
+    storm::prism::Program const& program;
+    std::vector<storm::jani::Property> const& properties;
+    PrismToJaniConverterOptions options;
+    bool compact;
+};
+
+}  // namespace converter
+}  // namespace storm
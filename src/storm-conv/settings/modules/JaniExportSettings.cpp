@@ -20,6 +20,7 @@ const std::string JaniExportSettings::locationVariablesOptionName = "location-va
 const std::string JaniExportSettings::globalVariablesOptionName = "globalvars";
 const std::string JaniExportSettings::localVariablesOptionName = "localvars";
 const std::string JaniExportSettings::compactJsonOptionName = "compactjson";
+const std::string JaniExportSettings::streamingOptionName = "streaming";
 const std::string JaniExportSettings::eliminateArraysOptionName = "remove-arrays";
 const std::string JaniExportSettings::eliminateFunctionsOptionName = "remove-functions";
 const std::string JaniExportSettings::replaceUnassignedVariablesWithConstantsOptionName = "replace-unassigned-vars";
@@ -47,7 +48,14 @@ JaniExportSettings::JaniExportSettings() : ModuleSettings(moduleName) {
             .build());
     this->addOption(storm::settings::OptionBuilder(moduleName, localVariablesOptionName, false, "If set, variables will preferably be made local.").build());
     this->addOption(storm::settings::OptionBuilder(moduleName, compactJsonOptionName, false,
-                                                   "If set, the size of the resulting jani file will be reduced at the cost of (human-)readability.")
+                                                   "If set, the size of the resulting jani file will be reduced at the cost of (human-)readability. When "
+                                                   "streaming, guards that occur repeatedly are additionally shared via functions.")
+                        .build());
+    this->addOption(storm::settings::OptionBuilder(moduleName, streamingOptionName, false,
+                                                   "If set, PRISM commands are written as JANI edges while they are translated instead of building the "
+                                                   "whole JANI model first. All variables become global and transformations of the JANI model are not "
+                                                   "supported.")
+                        .setIsAdvanced()
                         .build());
     this->addOption(storm::settings::OptionBuilder(moduleName, eliminateArraysOptionName, false,
                                                    "If set, transforms the model such that array variables/expressions are eliminated.")
@@ -119,6 +127,10 @@ bool JaniExportSettings::isCompactJsonSet() const {
     return this->getOption(compactJsonOptionName).getHasOptionBeenSet();
 }
 
+bool JaniExportSettings::isStreamingSet() const {
+    return this->getOption(streamingOptionName).getHasOptionBeenSet();
+}
+
 bool JaniExportSettings::isEliminateArraysSet() const {
     return this->getOption(eliminateArraysOptionName).getHasOptionBeenSet();
 }
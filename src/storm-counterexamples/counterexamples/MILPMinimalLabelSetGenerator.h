@@ -20,6 +20,7 @@
 #include "storm/solver/LpSolver.h"
 #include "storm/solver/MinMaxLinearEquationSolver.h"
 #include "storm/storage/BoostTypes.h"
+#include "storm/storage/Scheduler.h"
 #include "storm/storage/prism/Program.h"
 #include "storm/storage/sparse/JaniChoiceOrigins.h"
 #include "storm/storage/sparse/PrismChoiceOrigins.h"
@@ -923,6 +924,44 @@ class MILPMinimalLabelSetGenerator {
         return result;
     }
 
+    /*!
+     * Provides the choices of the given scheduler and the labels they use as a (partial) start solution to the solver. If the scheduler attains
+     * the maximal reachability probability, this yields a solution satisfying the threshold, so the solver starts with a good upper bound.
+     *
+     * @param solver The MILP solver.
+     * @param mdp The MDP.
+     * @param labelSets The label sets of the choices.
+     * @param stateInformation The information about the states in the model.
+     * @param choiceInformation The information about the choices in the model.
+     * @param variableInformation A struct with information about the variables of the model.
+     * @param scheduler A deterministic scheduler.
+     */
+    static void setMipStartFromScheduler(storm::solver::LpSolver<double>& solver, storm::models::sparse::Mdp<T> const& mdp,
+                                         std::vector<storm::storage::FlatSet<uint_fast64_t>> const& labelSets, StateInformation const& stateInformation,
+                                         ChoiceInformation const& choiceInformation, VariableInformation const& variableInformation,
+                                         storm::storage::Scheduler<T> const& scheduler) {
+        storm::storage::FlatSet<uint_fast64_t> usedLabels = choiceInformation.knownLabels;
+        for (auto state : stateInformation.relevantStates) {
+            if (!scheduler.getChoice(state).isDefined()) {
+                continue;
+            }
+            uint_fast64_t selectedChoice = mdp.getNondeterministicChoiceIndices()[state] + scheduler.getChoice(state).getDeterministicChoice();
+            auto choiceVariableIterator = variableInformation.stateToChoiceVariablesMap.at(state).begin();
+            for (auto choice : choiceInformation.relevantChoicesForRelevantStates.at(state)) {
+                if (choice == selectedChoice) {
+                    solver.setMipStart(*choiceVariableIterator, 1);
+                    usedLabels.insert(labelSets[choice].begin(), labelSets[choice].end());
+                } else {
+                    solver.setMipStart(*choiceVariableIterator, 0);
+                }
+                ++choiceVariableIterator;
+            }
+        }
+        for (auto const& labelVariablePair : variableInformation.labelToVariableMap) {
+            solver.setMipStart(labelVariablePair.second, usedLabels.count(labelVariablePair.first) > 0 ? 1 : 0);
+        }
+    }
+
    public:
     static storm::storage::FlatSet<uint_fast64_t> getMinimalLabelSet(Environment const& env, storm::models::sparse::Mdp<T> const& mdp,
                                                                      std::vector<storm::storage::FlatSet<uint_fast64_t>> const& labelSets,
@@ -935,12 +974,13 @@ class MILPMinimalLabelSetGenerator {
 
         // (1) Check whether its possible to exceed the threshold if checkThresholdFeasible is set.
         double maximalReachabilityProbability = 0;
+        std::unique_ptr<storm::storage::Scheduler<T>> maximizingScheduler;
         if (checkThresholdFeasible) {
             storm::modelchecker::helper::SparseMdpPrctlHelper<T> modelcheckerHelper;
-            std::vector<T> result = std::move(
-                modelcheckerHelper
-                    .computeUntilProbabilities(env, false, mdp.getTransitionMatrix(), mdp.getBackwardTransitions(), phiStates, psiStates, false, false)
-                    .values);
+            auto modelCheckingResult = modelcheckerHelper.computeUntilProbabilities(env, false, mdp.getTransitionMatrix(), mdp.getBackwardTransitions(),
+                                                                                    phiStates, psiStates, false, true);
+            std::vector<T> result = std::move(modelCheckingResult.values);
+            maximizingScheduler = std::move(modelCheckingResult.scheduler);
             for (auto state : mdp.getInitialStates()) {
                 maximalReachabilityProbability = std::max(maximalReachabilityProbability, result[state]);
             }
@@ -968,10 +1008,15 @@ class MILPMinimalLabelSetGenerator {
         buildConstraintSystem(*solver, mdp, labelSets, psiStates, stateInformation, choiceInformation, variableInformation, probabilityThreshold, strictBound,
                               includeSchedulerCuts);
 
-        // (4.3) Optimize the model.
+        //  (4.3) Warm-start the solver with the choices of a maximizing scheduler (if we computed one).
+        if (maximizingScheduler) {
+            setMipStartFromScheduler(*solver, mdp, labelSets, stateInformation, choiceInformation, variableInformation, *maximizingScheduler);
+        }
+
+        // (4.4) Optimize the model.
         solver->optimize();
 
-        // (4.4) Read off result from variables.
+        // (4.5) Read off result from variables.
         storm::storage::FlatSet<uint_fast64_t> usedLabelSet = getUsedLabelsInSolution(*solver, variableInformation);
         usedLabelSet.insert(choiceInformation.knownLabels.begin(), choiceInformation.knownLabels.end());
 
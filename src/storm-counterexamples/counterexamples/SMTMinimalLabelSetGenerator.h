@@ -6,6 +6,7 @@
 #include "storm-counterexamples/counterexamples/GuaranteedLabelSet.h"
 #include "storm-counterexamples/counterexamples/HighLevelCounterexample.h"
 #include "storm-counterexamples/settings/modules/CounterexampleGeneratorSettings.h"
+#include "storm/adapters/IntelTbbAdapter.h"
 
 #include "storm/exceptions/NotSupportedException.h"
 #include "storm/modelchecker/prctl/helper/SparseDtmcPrctlHelper.h"
@@ -1274,6 +1275,88 @@ class SMTMinimalLabelSetGenerator {
         return getUsedLabelSet(*solver.getModel(), variableInformation);
     }
 
+    /*!
+     * Retrieves up to the given number of distinct label sets of the smallest size that satisfy all constraints. Additional candidates are obtained by
+     * temporarily ruling out the previously found ones, so the constraints of the solver are not changed apart from relaxing the bound.
+     *
+     * @return The label sets. If there is no label set satisfying the constraints, the result is empty.
+     */
+    static std::vector<storm::storage::FlatSet<uint_fast64_t>> findSmallestCommandSets(storm::solver::SmtSolver& solver, VariableInformation& variableInformation,
+                                                                                       RelevancyInformation const& relevancyInformation,
+                                                                                       uint_fast64_t& currentBound, uint64_t maximalNumberOfCommandSets) {
+        std::vector<storm::storage::FlatSet<uint_fast64_t>> result;
+        boost::optional<storm::storage::FlatSet<uint_fast64_t>> smallest = findSmallestCommandSet(solver, variableInformation, currentBound);
+        if (smallest == boost::none) {
+            return result;
+        }
+        result.push_back(std::move(smallest.get()));
+
+        if (maximalNumberOfCommandSets > 1) {
+            storm::expressions::Expression assumption = !variableInformation.auxiliaryVariables.back();
+            solver.push();
+            while (result.size() < maximalNumberOfCommandSets) {
+                ruleOutSingleSolution(solver, result.back(), variableInformation, relevancyInformation);
+                if (solver.checkWithAssumptions({assumption}) != storm::solver::SmtSolver::CheckResult::Sat) {
+                    break;
+                }
+                result.push_back(getUsedLabelSet(*solver.getModel(), variableInformation));
+            }
+            solver.pop();
+        }
+        return result;
+    }
+
+    struct CandidateCheckResult {
+        // The model restricted to the candidate label set and the label sets of its choices.
+        std::shared_ptr<storm::models::sparse::Model<T>> subModel;
+        std::vector<storm::storage::FlatSet<uint_fast64_t>> subLabelSets;
+        // The maximal property values in the restricted model.
+        std::vector<T> maximalPropertyValue;
+    };
+
+    /*!
+     * Restricts the model to each of the given candidate label sets and computes the maximal property values in the restricted models.
+     * If there are multiple candidates (and TBB is available), the candidates are checked concurrently.
+     * Candidates that contain all commands are skipped, as they do not need to be checked.
+     */
+    static std::vector<CandidateCheckResult> checkCandidates(Environment const& env, storm::models::sparse::Model<T> const& model,
+                                                             std::vector<storm::storage::FlatSet<uint_fast64_t>> const& candidates,
+                                                             storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates,
+                                                             boost::optional<std::vector<std::string>> const& rewardName,
+                                                             storm::storage::SymbolicModelDescription const& symbolicModel) {
+        std::vector<CandidateCheckResult> result(candidates.size());
+        uint64_t numberOfCommands = nrCommands(symbolicModel);
+        auto checkCandidate = [&](uint64_t candidateIndex) {
+            if (candidates[candidateIndex].size() == numberOfCommands) {
+                return;
+            }
+            auto subChoiceOrigins = restrictModelToLabelSet(model, candidates[candidateIndex],
+                                                            rewardName ? boost::make_optional(psiStates.getNextSetIndex(0)) : boost::none);
+            result[candidateIndex].subModel = std::move(subChoiceOrigins.first);
+            result[candidateIndex].subLabelSets = std::move(subChoiceOrigins.second);
+            result[candidateIndex].maximalPropertyValue =
+                computeMaximalReachabilityProbability(env, *result[candidateIndex].subModel, phiStates, psiStates, rewardName);
+        };
+
+#ifdef STORM_HAVE_INTELTBB
+        if (candidates.size() > 1) {
+            tbb::task_arena arena(static_cast<int>(candidates.size()));
+            arena.execute([&]() {
+                tbb::parallel_for(tbb::blocked_range<uint64_t>(0, candidates.size(), 1), [&](tbb::blocked_range<uint64_t> const& range) {
+                    for (uint64_t candidateIndex = range.begin(); candidateIndex < range.end(); ++candidateIndex) {
+                        checkCandidate(candidateIndex);
+                    }
+                });
+            });
+            return result;
+        }
+#endif
+        for (uint64_t candidateIndex = 0; candidateIndex < candidates.size(); ++candidateIndex) {
+            checkCandidate(candidateIndex);
+        }
+        return result;
+    }
+
     static void ruleOutSingleSolution(storm::solver::SmtSolver& solver, storm::storage::FlatSet<uint_fast64_t> const& labelSet,
                                       VariableInformation& variableInformation, RelevancyInformation const& relevancyInformation) {
         std::vector<storm::expressions::Expression> formulae;
@@ -1699,6 +1782,7 @@ class SMTMinimalLabelSetGenerator {
 
             encodeReachability = settings.isEncodeReachabilitySet();
             useDynamicConstraints = settings.isUseDynamicConstraintsSet();
+            numberOfConcurrentCandidates = settings.getNumberOfConcurrentCandidates();
         }
 
         bool checkThresholdFeasible;
@@ -1710,6 +1794,8 @@ class SMTMinimalLabelSetGenerator {
         uint64_t maximumCounterexamples = 1;
         uint64_t multipleCounterexampleSizeCap = 100000000;
         uint64_t maximumExtraIterations = 100000000;
+        // The number of candidate label sets that are model checked concurrently.
+        uint64_t numberOfConcurrentCandidates = 1;
     };
 
     struct GeneratorStats {
@@ -1853,9 +1939,7 @@ class SMTMinimalLabelSetGenerator {
         size_t smallestCounterexampleSize = model.getNumberOfChoices();  // Definitive upper bound
         uint64_t progressDelay = storm::settings::getModule<storm::settings::modules::GeneralSettings>().getShowProgressDelay();
         do {
-            ++iterations;
-
-            if (result.size() > 0 && iterations > firstCounterexampleFound + options.maximumExtraIterations) {
+            if (result.size() > 0 && iterations >= firstCounterexampleFound + options.maximumExtraIterations) {
                 break;
             }
             if (result.size() == 0) {
@@ -1864,95 +1948,111 @@ class SMTMinimalLabelSetGenerator {
             }
             STORM_LOG_DEBUG("Computing minimal command set.");
             solverClock = std::chrono::high_resolution_clock::now();
-            boost::optional<storm::storage::FlatSet<uint_fast64_t>> smallest = findSmallestCommandSet(*solver, variableInformation, currentBound);
+            std::vector<storm::storage::FlatSet<uint_fast64_t>> candidates =
+                findSmallestCommandSets(*solver, variableInformation, relevancyInformation, currentBound, options.numberOfConcurrentCandidates);
             totalSolverTime += std::chrono::high_resolution_clock::now() - solverClock;
-            if (smallest == boost::none) {
+            if (candidates.empty()) {
                 STORM_LOG_DEBUG("No further counterexamples.");
                 break;
-            } else {
-                commandSet = smallest.get();
             }
-            STORM_LOG_DEBUG("Computed minimal command with bound " << currentBound << " and set of size "
-                                                                   << commandSet.size() + relevancyInformation.knownLabels.size() << " (" << commandSet.size()
-                                                                   << " + " << relevancyInformation.knownLabels.size() << ") ");
+            STORM_LOG_DEBUG("Computed " << candidates.size() << " minimal command set(s) with bound " << currentBound << " and size "
+                                        << candidates.front().size() + relevancyInformation.knownLabels.size() << " (" << candidates.front().size() << " + "
+                                        << relevancyInformation.knownLabels.size() << ") ");
 
-            // Restrict the given model to the current set of labels and compute the reachability probability.
+            // Restrict the given model to the candidate sets of labels and compute the reachability probabilities.
             modelCheckingClock = std::chrono::high_resolution_clock::now();
-            commandSet.insert(relevancyInformation.knownLabels.begin(), relevancyInformation.knownLabels.end());
-            commandSet.insert(relevancyInformation.dontCareLabels.begin(), relevancyInformation.dontCareLabels.end());
-            if (commandSet.size() > smallestCounterexampleSize + options.continueAfterFirstCounterexampleUntil ||
-                (result.size() > 1 && commandSet.size() > options.multipleCounterexampleSizeCap)) {
-                STORM_LOG_DEBUG("No further counterexamples of similar size.");
-                break;
-            }
-
-            if (commandSet.size() == nrCommands(symbolicModel)) {
-                result.push_back(commandSet);
-                break;
+            for (auto& candidate : candidates) {
+                candidate.insert(relevancyInformation.knownLabels.begin(), relevancyInformation.knownLabels.end());
+                candidate.insert(relevancyInformation.dontCareLabels.begin(), relevancyInformation.dontCareLabels.end());
             }
-
-            auto subChoiceOrigins = restrictModelToLabelSet(model, commandSet, rewardName ? boost::make_optional(psiStates.getNextSetIndex(0)) : boost::none);
-            std::shared_ptr<storm::models::sparse::Model<T>> const& subModel = subChoiceOrigins.first;
-            std::vector<storm::storage::FlatSet<uint_fast64_t>> const& subLabelSets = subChoiceOrigins.second;
-
-            // Now determine the maximal reachability probability in the sub-model.
-            maximalPropertyValue = computeMaximalReachabilityProbability(env, *subModel, phiStates, psiStates, rewardName);
+            std::vector<CandidateCheckResult> checkResults = checkCandidates(env, model, candidates, phiStates, psiStates, rewardName, symbolicModel);
             totalModelCheckingTime += std::chrono::high_resolution_clock::now() - modelCheckingClock;
 
-            // Depending on whether the threshold was successfully achieved or not, we proceed by either analyzing the bad solution or stopping the iteration
-            // process.
-            analysisClock = std::chrono::high_resolution_clock::now();
-            bool violation = false;
-            for (uint64_t i = 0; i < maximalPropertyValue.size(); i++) {
-                violation |=
-                    (strictBound && maximalPropertyValue[i] < propertyThreshold[i]) || (!strictBound && maximalPropertyValue[i] <= propertyThreshold[i]);
-            }
+            // Process the results in the order in which the solver produced the candidates. The solver is only accessed from this thread.
+            bool stop = false;
+            for (uint64_t candidateIndex = 0; candidateIndex < candidates.size() && !done; ++candidateIndex) {
+                ++iterations;
+                commandSet = std::move(candidates[candidateIndex]);
+                if (result.size() > 0 && iterations > firstCounterexampleFound + options.maximumExtraIterations) {
+                    stop = true;
+                    break;
+                }
+                if (commandSet.size() > smallestCounterexampleSize + options.continueAfterFirstCounterexampleUntil ||
+                    (result.size() > 1 && commandSet.size() > options.multipleCounterexampleSizeCap)) {
+                    STORM_LOG_DEBUG("No further counterexamples of similar size.");
+                    stop = true;
+                    break;
+                }
 
-            if (violation) {
-                if (!rewardName && maximalPropertyValue.front() == storm::utility::zero<T>()) {
-                    ++zeroProbabilityCount;
+                if (commandSet.size() == nrCommands(symbolicModel)) {
+                    result.push_back(commandSet);
+                    stop = true;
+                    break;
                 }
 
-                if (options.useDynamicConstraints) {
-                    // Determine which of the two analysis techniques to call by performing a reachability analysis.
-                    storm::storage::BitVector reachableStates =
-                        storm::utility::graph::getReachableStates(subModel->getTransitionMatrix(), subModel->getInitialStates(), phiStates, psiStates);
+                CandidateCheckResult const& checkResult = checkResults[candidateIndex];
+                storm::models::sparse::Model<T> const& subModel = *checkResult.subModel;
+                std::vector<storm::storage::FlatSet<uint_fast64_t>> const& subLabelSets = checkResult.subLabelSets;
+                maximalPropertyValue = checkResult.maximalPropertyValue;
+
+                // Depending on whether the threshold was successfully achieved or not, we proceed by either analyzing the bad solution or stopping the
+                // iteration process.
+                analysisClock = std::chrono::high_resolution_clock::now();
+                bool violation = false;
+                for (uint64_t i = 0; i < maximalPropertyValue.size(); i++) {
+                    violation |=
+                        (strictBound && maximalPropertyValue[i] < propertyThreshold[i]) || (!strictBound && maximalPropertyValue[i] <= propertyThreshold[i]);
+                }
 
-                    if (reachableStates.isDisjointFrom(psiStates)) {
-                        // If there was no target state reachable, analyze the solution and guide the solver into the right direction.
-                        analyzeZeroProbabilitySolution(*solver, *subModel, subLabelSets, model, labelSets, phiStates, psiStates, commandSet,
-                                                       variableInformation, relevancyInformation);
-                    } else {
-                        // If the reachability probability was greater than zero (i.e. there is a reachable target state), but the probability was insufficient
-                        // to exceed the given threshold, we analyze the solution and try to guide the solver into the right direction.
-                        analyzeInsufficientProbabilitySolution(*solver, *subModel, subLabelSets, model, labelSets, phiStates, psiStates, commandSet,
-                                                               variableInformation, relevancyInformation);
+                if (violation) {
+                    if (!rewardName && maximalPropertyValue.front() == storm::utility::zero<T>()) {
+                        ++zeroProbabilityCount;
                     }
 
-                    if (relevancyInformation.dontCareLabels.size() > 0) {
+                    if (options.useDynamicConstraints) {
+                        // Determine which of the two analysis techniques to call by performing a reachability analysis.
+                        storm::storage::BitVector reachableStates =
+                            storm::utility::graph::getReachableStates(subModel.getTransitionMatrix(), subModel.getInitialStates(), phiStates, psiStates);
+
+                        if (reachableStates.isDisjointFrom(psiStates)) {
+                            // If there was no target state reachable, analyze the solution and guide the solver into the right direction.
+                            analyzeZeroProbabilitySolution(*solver, subModel, subLabelSets, model, labelSets, phiStates, psiStates, commandSet,
+                                                           variableInformation, relevancyInformation);
+                        } else {
+                            // If the reachability probability was greater than zero (i.e. there is a reachable target state), but the probability was
+                            // insufficient to exceed the given threshold, we analyze the solution and try to guide the solver into the right direction.
+                            analyzeInsufficientProbabilitySolution(*solver, subModel, subLabelSets, model, labelSets, phiStates, psiStates, commandSet,
+                                                                   variableInformation, relevancyInformation);
+                        }
+
+                        if (relevancyInformation.dontCareLabels.size() > 0) {
+                            ruleOutSingleSolution(*solver, commandSet, variableInformation, relevancyInformation);
+                        }
+                    } else {
+                        // Do not guide solver, just rule out current solution.
                         ruleOutSingleSolution(*solver, commandSet, variableInformation, relevancyInformation);
                     }
                 } else {
-                    // Do not guide solver, just rule out current solution.
-                    ruleOutSingleSolution(*solver, commandSet, variableInformation, relevancyInformation);
-                }
-            } else {
-                STORM_LOG_DEBUG("Found a counterexample.");
-                if (result.empty()) {
-                    // If this is the first counterexample we find, we store when we found it.
-                    firstCounterexampleFound = iterations;
-                }
-                result.push_back(commandSet);
-                if (options.maximumCounterexamples > result.size()) {
-                    STORM_LOG_DEBUG("Exclude counterexample for future.");
-                    ruleOutBiggerSolutions(*solver, commandSet, variableInformation, relevancyInformation);
-                } else {
-                    STORM_LOG_DEBUG("Stop searching for further counterexamples.");
-                    done = true;
+                    STORM_LOG_DEBUG("Found a counterexample.");
+                    if (result.empty()) {
+                        // If this is the first counterexample we find, we store when we found it.
+                        firstCounterexampleFound = iterations;
+                    }
+                    result.push_back(commandSet);
+                    if (options.maximumCounterexamples > result.size()) {
+                        STORM_LOG_DEBUG("Exclude counterexample for future.");
+                        ruleOutBiggerSolutions(*solver, commandSet, variableInformation, relevancyInformation);
+                    } else {
+                        STORM_LOG_DEBUG("Stop searching for further counterexamples.");
+                        done = true;
+                    }
+                    smallestCounterexampleSize = std::min(smallestCounterexampleSize, commandSet.size());
                 }
-                smallestCounterexampleSize = std::min(smallestCounterexampleSize, commandSet.size());
+                totalAnalysisTime += (std::chrono::high_resolution_clock::now() - analysisClock);
+            }
+            if (stop) {
+                break;
             }
-            totalAnalysisTime += (std::chrono::high_resolution_clock::now() - analysisClock);
 
             auto now = std::chrono::high_resolution_clock::now();
             auto durationSinceLastMessage = std::chrono::duration_cast<std::chrono::seconds>(now - timeOfLastMessage).count();
@@ -91,6 +91,13 @@ class CounterexampleGeneratorSettings : public ModuleSettings {
      */
     bool isUseDynamicConstraintsSet() const;
 
+    /*!
+     * Retrieves the number of candidate command sets that are checked concurrently in the MAXSAT-based technique.
+     *
+     * @return The number of candidates.
+     */
+    uint64_t getNumberOfConcurrentCandidates() const;
+
     bool check() const override;
 
     // The name of the module.
@@ -106,6 +113,7 @@ class CounterexampleGeneratorSettings : public ModuleSettings {
     static const std::string encodeReachabilityOptionName;
     static const std::string schedulerCutsOptionName;
     static const std::string noDynamicConstraintsOptionName;
+    static const std::string candidatesOptionName;
 };
 
 }  // namespace modules
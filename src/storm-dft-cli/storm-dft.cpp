@@ -143,7 +143,7 @@ void processOptions() {
         auto const additionalRelevantEventNames{faultTreeSettings.getRelevantEvents()};
         storm::dft::api::analyzeDFTBdd<ValueType>(dft, isExportToBddDot, filename, isMTTF, mttfPrecision, mttfStepsize, mttfAlgorithm, isMinimalCutSets,
                                                   probabilityAnalysis, isModularisation, importanceMeasureName, timepoints, manuallyInputtedProperties,
-                                                  additionalRelevantEventNames, chunksize);
+                                                  additionalRelevantEventNames, chunksize, faultTreeSettings.getNumberOfModuleThreads());
 
         // don't perform other analysis if analyzeWithBdds is set
         if (dftIOSettings.isAnalyzeWithBdds()) {
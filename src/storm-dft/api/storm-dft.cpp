@@ -4,6 +4,7 @@
 #include "storm-conv/settings/modules/JaniExportSettings.h"
 #include "storm-dft/settings/modules/DftGspnSettings.h"
 #include "storm-dft/settings/modules/FaultTreeSettings.h"
+#include "storm-gspn/settings/modules/GSPNExportSettings.h"
 
 #include <memory>
 #include <vector>
@@ -24,7 +25,8 @@ void analyzeDFTBdd(std::shared_ptr<storm::dft::storage::DFT<double>> const& dft,
                    double const mttfPrecision, double const mttfStepsize, std::string const mttfAlgorithmName, bool const calculateMCS,
                    bool const calculateProbability, bool const useModularisation, std::string const importanceMeasureName,
                    std::vector<double> const& timepoints, std::vector<std::shared_ptr<storm::logic::Formula const>> const& properties,
-                   std::vector<std::string> const& additionalRelevantEventNames, size_t const chunksize) {
+                   std::vector<std::string> const& additionalRelevantEventNames, size_t const chunksize,
+                   size_t const numberOfModuleThreads) {
     if (calculateMttf) {
         if (mttfAlgorithmName == "proceeding") {
             std::cout << "The numerically approximated MTTF is " << storm::dft::utility::MTTFHelperProceeding(dft, mttfStepsize, mttfPrecision) << '\n';
@@ -34,7 +36,7 @@ void analyzeDFTBdd(std::shared_ptr<storm::dft::storage::DFT<double>> const& dft,
     }
 
     if (useModularisation && calculateProbability) {
-        storm::dft::modelchecker::DftModularizationChecker checker{dft};
+        storm::dft::modelchecker::DftModularizationChecker checker{dft, numberOfModuleThreads};
         if (chunksize == 1) {
             for (auto const& timebound : timepoints) {
                 auto const probability{checker.getProbabilityAtTimebound(timebound)};
@@ -73,17 +75,18 @@ void analyzeDFTBdd(std::shared_ptr<storm::dft::storage::DFT<double>> const& dft,
         }
 
         if (calculateMCS) {
-            auto const minimalCutSets{checker->getMinimalCutSetsAsIndices()};
             auto const sylvanBddManager{checker->getSylvanBddManager()};
 
+            // Print the minimal cut sets while enumerating them to avoid storing all of them
             std::cout << "{\n";
-            for (auto const& minimalCutSet : minimalCutSets) {
+            checker->forEachMinimalCutSet([&sylvanBddManager](std::vector<uint32_t> const& minimalCutSet) {
                 std::cout << '{';
                 for (auto const& be : minimalCutSet) {
                     std::cout << sylvanBddManager->getName(be) << ' ';
                 }
                 std::cout << "},\n";
-            }
+                return true;
+            });
             std::cout << "}\n";
         }
 
@@ -166,7 +169,8 @@ void analyzeDFTBdd(std::shared_ptr<storm::dft::storage::DFT<storm::RationalFunct
                    bool const calculateMttf, double const mttfPrecision, double const mttfStepsize, std::string const mttfAlgorithmName,
                    bool const calculateMCS, bool const calculateProbability, bool const useModularisation, std::string const importanceMeasureName,
                    std::vector<double> const& timepoints, std::vector<std::shared_ptr<storm::logic::Formula const>> const& properties,
-                   std::vector<std::string> const& additionalRelevantEventNames, size_t const chunksize) {
+                   std::vector<std::string> const& additionalRelevantEventNames, size_t const chunksize,
+                   size_t const numberOfModuleThreads) {
     STORM_LOG_THROW(false, storm::exceptions::NotSupportedException, "BDD analysis is not supportet for this data type.");
 }
 
@@ -215,6 +219,7 @@ template<>
 std::pair<std::shared_ptr<storm::gspn::GSPN>, uint64_t> transformToGSPN(storm::dft::storage::DFT<double> const& dft) {
     storm::dft::settings::modules::FaultTreeSettings const& ftSettings = storm::settings::getModule<storm::dft::settings::modules::FaultTreeSettings>();
     storm::dft::settings::modules::DftGspnSettings const& dftGspnSettings = storm::settings::getModule<storm::dft::settings::modules::DftGspnSettings>();
+    storm::settings::modules::GSPNExportSettings const& exportSettings = storm::settings::getModule<storm::settings::modules::GSPNExportSettings>();
 
     // Set Don't Care elements
     std::set<uint64_t> dontCareElements;
@@ -225,11 +230,15 @@ std::pair<std::shared_ptr<storm::gspn::GSPN>, uint64_t> transformToGSPN(storm::d
         }
     }
 
+    // Layout is only needed for exporting the GSPN
+    bool storeLayout =
+        exportSettings.isWriteToDotSet() || exportSettings.isWriteToPnproSet() || exportSettings.isWriteToPnmlSet() || exportSettings.isWriteToJsonSet();
+
     // Transform to GSPN
     storm::dft::transformations::DftToGspnTransformator<double> gspnTransformator(dft);
     auto priorities = gspnTransformator.computePriorities(dftGspnSettings.isExtendPriorities());
     gspnTransformator.transform(priorities, dontCareElements, !dftGspnSettings.isDisableSmartTransformation(), dftGspnSettings.isMergeDCFailed(),
-                                dftGspnSettings.isExtendPriorities());
+                                dftGspnSettings.isExtendPriorities(), storeLayout);
     std::shared_ptr<storm::gspn::GSPN> gspn(gspnTransformator.obtainGSPN());
     return std::make_pair(gspn, gspnTransformator.toplevelFailedPlaceId());
 }
@@ -231,13 +231,16 @@ typename storm::dft::modelchecker::DFTModelChecker<ValueType>::dft_results analy
  * @param chunksize
  * The size of the chunks of doubles to work on at a time
  *
+ * @param numberOfModuleThreads
+ * The maximal number of dynamic modules which are analyzed concurrently when using modularisation
+ *
  */
 template<typename ValueType>
 void analyzeDFTBdd(std::shared_ptr<storm::dft::storage::DFT<ValueType>> const& dft, bool const exportToDot, std::string const& filename,
                    bool const calculateMttf, double const mttfPrecision, double const mttfStepsize, std::string const mttfAlgorithmName,
                    bool const calculateMCS, bool const calculateProbability, bool const useModularisation, std::string const importanceMeasureName,
                    std::vector<double> const& timepoints, std::vector<std::shared_ptr<storm::logic::Formula const>> const& properties,
-                   std::vector<std::string> const& additionalRelevantEventNames, size_t const chunksize);
+                   std::vector<std::string> const& additionalRelevantEventNames, size_t const chunksize, size_t const numberOfModuleThreads = 1);
 
 /*!
  * Analyze the DFT using the SMT encoding
@@ -275,7 +275,9 @@ void ExplicitDFTModelBuilder<ValueType, StateType>::initializeNextIteration() {
     std::vector<uint_fast64_t> copyRemapping = matrixBuilder.stateRemapping;
     matrixBuilder = MatrixBuilder(!generator.isDeterministicModel());
     matrixBuilder.stateRemapping = copyRemapping;
-    StateType nrStates = modelComponents.transitionMatrix.getRowGroupCount();
+    // The upper bound model might have taken over the transition matrix of the last iteration
+    storm::storage::SparseMatrix<ValueType> const& oldMatrix = upperBoundModel ? upperBoundModel->getTransitionMatrix() : modelComponents.transitionMatrix;
+    StateType nrStates = oldMatrix.getRowGroupCount();
     STORM_LOG_ASSERT(nrStates == matrixBuilder.stateRemapping.size(), "No. of states does not coincide with mapping size.");
 
     // Start by creating a remapping from the old indices to the new indices
@@ -335,14 +337,13 @@ void ExplicitDFTModelBuilder<ValueType, StateType>::initializeNextIteration() {
 
     // Build submatrix for expanded states
     // TODO: only use row groups when necessary
-    for (StateType oldRowGroup = 0; oldRowGroup < modelComponents.transitionMatrix.getRowGroupCount(); ++oldRowGroup) {
+    for (StateType oldRowGroup = 0; oldRowGroup < oldMatrix.getRowGroupCount(); ++oldRowGroup) {
         if (indexRemapping[oldRowGroup] < nrExpandedStates) {
             // State is expanded -> copy to new matrix
             matrixBuilder.newRowGroup();
-            for (StateType oldRow = modelComponents.transitionMatrix.getRowGroupIndices()[oldRowGroup];
-                 oldRow < modelComponents.transitionMatrix.getRowGroupIndices()[oldRowGroup + 1]; ++oldRow) {
-                for (typename storm::storage::SparseMatrix<ValueType>::const_iterator itEntry = modelComponents.transitionMatrix.begin(oldRow);
-                     itEntry != modelComponents.transitionMatrix.end(oldRow); ++itEntry) {
+            for (StateType oldRow = oldMatrix.getRowGroupIndices()[oldRowGroup]; oldRow < oldMatrix.getRowGroupIndices()[oldRowGroup + 1]; ++oldRow) {
+                for (typename storm::storage::SparseMatrix<ValueType>::const_iterator itEntry = oldMatrix.begin(oldRow); itEntry != oldMatrix.end(oldRow);
+                     ++itEntry) {
                     auto itFind = skippedStates.find(itEntry->getColumn());
                     if (itFind != skippedStates.end()) {
                         // Set id for skipped states as we remap it later
@@ -358,6 +359,7 @@ void ExplicitDFTModelBuilder<ValueType, StateType>::initializeNextIteration() {
     }
 
     skippedStates = skippedStatesNew;
+    upperBoundModel.reset();
 
     STORM_LOG_ASSERT(matrixBuilder.getCurrentRowGroup() == nrExpandedStates, "Row group size does not match.");
     skippedStates.clear();
@@ -518,6 +520,8 @@ void ExplicitDFTModelBuilder<ValueType, StateType>::exploreStateSpace(double app
 
     STORM_LOG_INFO("Expanded " << nrExpandedStates << " states");
     STORM_LOG_INFO("Skipped " << nrSkippedStates << " states");
+    STORM_LOG_INFO_COND(!stateGenerationInfo->hasSymmetries(), "Replaced " << nrSymmetricStates << " states by their representative w.r.t. "
+                                                                           << stateGenerationInfo->getSymmetrySize() << " symmetries");
     STORM_LOG_ASSERT(nrSkippedStates == skippedStates.size(), "Nr skipped states is wrong");
 }
 
@@ -606,6 +610,7 @@ void ExplicitDFTModelBuilder<ValueType, StateType>::buildLabeling() {
 
 template<typename ValueType, typename StateType>
 std::shared_ptr<storm::models::sparse::Model<ValueType>> ExplicitDFTModelBuilder<ValueType, StateType>::getModel() {
+    STORM_LOG_ASSERT(!upperBoundModel, "Model components were already moved into the approximation models.");
     if (storm::settings::getModule<storm::dft::settings::modules::FaultTreeSettings>().isMaxDepthSet() && skippedStates.size() > 0) {
         // Give skipped states separate label "skipped"
         modelComponents.stateLabeling.addLabel("skipped");
@@ -619,6 +624,11 @@ std::shared_ptr<storm::models::sparse::Model<ValueType>> ExplicitDFTModelBuilder
     return createModel(false);
 }
 
+template<typename ValueType, typename StateType>
+size_t ExplicitDFTModelBuilder<ValueType, StateType>::getNrSymmetricStates() const {
+    return nrSymmetricStates;
+}
+
 template<typename ValueType, typename StateType>
 std::shared_ptr<storm::models::sparse::Model<ValueType>> ExplicitDFTModelBuilder<ValueType, StateType>::getModelApproximation(bool lowerBound,
                                                                                                                               bool expectedTime) {
@@ -691,6 +701,111 @@ std::shared_ptr<storm::models::sparse::Model<ValueType>> ExplicitDFTModelBuilder
     }
 }
 
+template<typename ValueType, typename StateType>
+std::pair<std::shared_ptr<storm::models::sparse::Model<ValueType>>, std::shared_ptr<storm::models::sparse::Model<ValueType>>>
+ExplicitDFTModelBuilder<ValueType, StateType>::getModelApproximations(bool expectedTime) {
+    STORM_LOG_ASSERT(!upperBoundModel, "Approximation models were already created in this iteration.");
+    // Exit rates are shared by both models, only the exit rates of skipped states differ
+    std::vector<ValueType> exitRates;
+    if (!modelComponents.deterministicModel) {
+        exitRates = std::vector<ValueType>(modelComponents.markovianStates.size(), storm::utility::zero<ValueType>());
+        std::vector<typename storm::storage::SparseMatrix<ValueType>::index_type> const& indices = modelComponents.transitionMatrix.getRowGroupIndices();
+        for (auto stateIndex : modelComponents.markovianStates) {
+            exitRates[stateIndex] = modelComponents.transitionMatrix.getRowSum(indices[stateIndex]);
+        }
+    }
+
+    // Model for lower bound
+    storm::storage::SparseMatrix<ValueType> lowerMatrix = modelComponents.transitionMatrix;
+    if (expectedTime) {
+        changeMatrixBound(lowerMatrix, true);
+    } else {
+        // Set self loop for lower bound
+        for (auto it = skippedStates.begin(); it != skippedStates.end(); ++it) {
+            auto matrixEntry = lowerMatrix.getRow(it->first, 0).begin();
+            STORM_LOG_ASSERT(matrixEntry->getColumn() == 0, "Transition has wrong target state.");
+            STORM_LOG_ASSERT(!it->second.first->isPseudoState(), "State is still pseudo state.");
+            matrixEntry->setValue(storm::utility::one<ValueType>());
+            matrixEntry->setColumn(it->first);
+        }
+    }
+    std::vector<ValueType> lowerExitRates = exitRates;
+    if (!modelComponents.deterministicModel) {
+        for (auto it = skippedStates.begin(); it != skippedStates.end(); ++it) {
+            if (modelComponents.markovianStates[it->first]) {
+                lowerExitRates[it->first] = lowerMatrix.getRowSum(lowerMatrix.getRowGroupIndices()[it->first]);
+            }
+        }
+    }
+    auto lowerModel =
+        createApproximationModel(std::move(lowerMatrix), storm::models::sparse::StateLabeling(modelComponents.stateLabeling), std::move(lowerExitRates));
+
+    // Model for upper bound
+    // The transitions of expanded states are the same in both bound models. For CTMCs, the transition matrix is therefore not copied but moved into the
+    // upper bound model and the next iteration uses the matrix of this model.
+    storm::storage::SparseMatrix<ValueType> upperMatrix;
+    if (modelComponents.deterministicModel) {
+        upperMatrix = std::move(modelComponents.transitionMatrix);
+    } else {
+        // Markov automata normalize the matrix, thus it has to be copied
+        upperMatrix = modelComponents.transitionMatrix;
+    }
+    storm::models::sparse::StateLabeling upperLabeling = modelComponents.stateLabeling;
+    if (expectedTime) {
+        changeMatrixBound(upperMatrix, false);
+        if (!modelComponents.deterministicModel) {
+            for (auto it = skippedStates.begin(); it != skippedStates.end(); ++it) {
+                if (modelComponents.markovianStates[it->first]) {
+                    exitRates[it->first] = upperMatrix.getRowSum(upperMatrix.getRowGroupIndices()[it->first]);
+                }
+            }
+        }
+    } else {
+        // Make skipped states failed states for upper bound
+        storm::storage::BitVector failedStates = upperLabeling.getStates("failed");
+        for (auto it = skippedStates.begin(); it != skippedStates.end(); ++it) {
+            failedStates.set(it->first);
+        }
+        upperLabeling.setStates("failed", failedStates);
+    }
+    auto upperModel = createApproximationModel(std::move(upperMatrix), std::move(upperLabeling), std::move(exitRates));
+    if (modelComponents.deterministicModel) {
+        upperBoundModel = upperModel;
+    }
+    return std::make_pair(lowerModel, upperModel);
+}
+
+template<typename ValueType, typename StateType>
+std::shared_ptr<storm::models::sparse::Model<ValueType>> ExplicitDFTModelBuilder<ValueType, StateType>::createApproximationModel(
+    storm::storage::SparseMatrix<ValueType>&& matrix, storm::models::sparse::StateLabeling&& labeling, std::vector<ValueType>&& exitRates) const {
+    std::shared_ptr<storm::models::sparse::Model<ValueType>> model;
+    if (modelComponents.deterministicModel) {
+        model = std::make_shared<storm::models::sparse::Ctmc<ValueType>>(std::move(matrix), std::move(labeling));
+    } else {
+        // Build MA
+        storm::storage::sparse::ModelComponents<ValueType> maComponents(std::move(matrix), std::move(labeling));
+        maComponents.rateTransitions = true;
+        maComponents.markovianStates = modelComponents.markovianStates;
+        maComponents.exitRates = std::move(exitRates);
+        std::shared_ptr<storm::models::sparse::MarkovAutomaton<ValueType>> ma =
+            std::make_shared<storm::models::sparse::MarkovAutomaton<ValueType>>(std::move(maComponents));
+        if (ma->hasOnlyTrivialNondeterminism()) {
+            // Markov automaton can be converted into CTMC
+            model = storm::transformer::NonMarkovianChainTransformer<ValueType>::eliminateNonmarkovianStates(
+                ma, storm::transformer::EliminationLabelBehavior::ExtendLabels);
+        } else {
+            model = ma;
+        }
+    }
+
+    if (model->getNumberOfStates() <= 15) {
+        STORM_LOG_TRACE("Transition matrix: \n" << model->getTransitionMatrix());
+    } else {
+        STORM_LOG_TRACE("Transition matrix: too big to print");
+    }
+    return model;
+}
+
 template<typename ValueType, typename StateType>
 std::shared_ptr<storm::models::sparse::Model<ValueType>> ExplicitDFTModelBuilder<ValueType, StateType>::createModel(bool copy) {
     std::shared_ptr<storm::models::sparse::Model<ValueType>> model;
@@ -919,12 +1034,16 @@ StateType ExplicitDFTModelBuilder<ValueType, StateType>::getOrAddStateIndex(DFTS
         // Order state by symmetry
         STORM_LOG_TRACE("Check for symmetry: " << dft.getStateString(state));
         changed = state->orderBySymmetry();
+        if (changed) {
+            ++nrSymmetricStates;
+        }
         STORM_LOG_TRACE("State " << (changed ? "changed to " : "did not change") << (changed ? dft.getStateString(state) : ""));
     }
 
-    if (stateStorage.stateToId.contains(state->status())) {
+    // Look up the state and insert it with a fresh id if it does not exist yet. This hashes the state only once.
+    stateId = stateStorage.stateToId.findOrAdd(state->status(), newIndex);
+    if (stateId != newIndex) {
         // State already exists
-        stateId = stateStorage.stateToId.getValue(state->status());
         STORM_LOG_TRACE("State " << dft.getStateString(state) << " with id " << stateId << " already exists");
         if (!changed) {
             // Check if state is pseudo state
@@ -947,7 +1066,6 @@ StateType ExplicitDFTModelBuilder<ValueType, StateType>::getOrAddStateIndex(DFTS
         STORM_LOG_ASSERT(state->isPseudoState() == changed, "State type (pseudo/concrete) wrong.");
         // Create new state
         state->setId(newIndex++);
-        stateId = stateStorage.stateToId.findOrAdd(state->status(), state->getId());
         STORM_LOG_ASSERT(stateId == state->getId(), "Ids do not match.");
         // Insert state as not yet explored
         ExplorationHeuristicPointer nullHeuristic;
@@ -182,6 +182,28 @@ class ExplicitDFTModelBuilder {
      */
     std::shared_ptr<storm::models::sparse::Model<ValueType>> getModelApproximation(bool lowerBound, bool expectedTime);
 
+    /*!
+     * Get the built approximation models for both the lower and the upper bound.
+     * In contrast to calling getModelApproximation() twice, both models are created from the same model components: the exit rates are only
+     * computed once and only the transitions of skipped states are changed. For CTMCs, the transition matrix is moved into the upper bound model
+     * instead of being copied and the next iteration continues from the matrix of this model.
+     * Afterwards, only buildModel() for the next iteration may be called.
+     *
+     * @param expectedTime If true, the bounds for expected time are computed, else the bounds for probabilities.
+     *
+     * @return The models for the lower and the upper bound.
+     */
+    std::pair<std::shared_ptr<storm::models::sparse::Model<ValueType>>, std::shared_ptr<storm::models::sparse::Model<ValueType>>> getModelApproximations(
+        bool expectedTime);
+
+    /*!
+     * Get the number of successor states which were replaced by the canonical representative of their symmetry orbit during the exploration.
+     * Each of these states would otherwise have been an additional state in the model (unless it was reached before).
+     *
+     * @return Number of states reduced by symmetry.
+     */
+    size_t getNrSymmetricStates() const;
+
    private:
     /*!
      * Explore state space of DFT.
@@ -274,6 +296,19 @@ class ExplicitDFTModelBuilder {
      */
     std::shared_ptr<storm::models::sparse::Model<ValueType>> createModel(bool copy);
 
+    /*!
+     * Create the model for an approximation bound from the given components.
+     *
+     * @param matrix Transition matrix.
+     * @param labeling State labeling.
+     * @param exitRates Exit rates (only used for Markov automata).
+     *
+     * @return The model built from the components.
+     */
+    std::shared_ptr<storm::models::sparse::Model<ValueType>> createApproximationModel(storm::storage::SparseMatrix<ValueType>&& matrix,
+                                                                                       storm::models::sparse::StateLabeling&& labeling,
+                                                                                       std::vector<ValueType>&& exitRates) const;
+
     // Initial size of the bitvector.
     const size_t INITIAL_BITVECTOR_SIZE = 20000;
     // Offset used for pseudo states.
@@ -292,6 +327,9 @@ class ExplicitDFTModelBuilder {
     // Current id for new state
     size_t newIndex = 0;
 
+    // Number of successor states which were replaced by their symmetric representative
+    size_t nrSymmetricStates = 0;
+
     // Whether to use a unique state for all failed states
     // If used, the unique failed state has the id 0
     bool uniqueFailedState = false;
@@ -305,6 +343,9 @@ class ExplicitDFTModelBuilder {
     // Structure for the components of the model.
     ModelComponents modelComponents;
 
+    // Upper bound model which took over the transition matrix of the model components in the last iteration (if any).
+    std::shared_ptr<storm::models::sparse::Model<ValueType>> upperBoundModel;
+
     // Structure for the transition matrix builder.
     MatrixBuilder matrixBuilder;
 
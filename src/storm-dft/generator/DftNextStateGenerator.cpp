@@ -105,7 +105,8 @@ storm::generator::StateBehavior<ValueType, StateType> DftNextStateGenerator<Valu
             STORM_LOG_ASSERT(exploreDependencies, "Failure should be due to dependency.");
             std::shared_ptr<storm::dft::storage::elements::DFTDependency<ValueType> const> dependency = iterFailable.asDependency(mDft);
             // Obtain successor state by propagating dependency failure to dependent BE
-            newState = createSuccessorState(this->state, dependency, true);
+            newState = getSuccessorBuffer();
+            applyDependencyTrigger(newState, dependency, true);
 
             auto [newStateId, shouldStop] = getNewStateId(newState, stateToIdCallback);
             if (shouldStop) {
@@ -147,7 +148,8 @@ storm::generator::StateBehavior<ValueType, StateType> DftNextStateGenerator<Valu
             // Next failure due to BE failing on its own
             std::shared_ptr<storm::dft::storage::elements::DFTBE<ValueType> const> nextBE = iterFailable.asBE(mDft);
             // Obtain successor state by propagating failure of BE
-            newState = createSuccessorState(this->state, nextBE);
+            newState = getSuccessorBuffer();
+            applyFailure(newState, nextBE);
 
             auto [newStateId, shouldStop] = getNewStateId(newState, stateToIdCallback);
             if (shouldStop) {
@@ -187,6 +189,17 @@ storm::generator::StateBehavior<ValueType, StateType> DftNextStateGenerator<Valu
     return result;
 }
 
+template<typename ValueType, typename StateType>
+typename DftNextStateGenerator<ValueType, StateType>::DFTStatePointer const& DftNextStateGenerator<ValueType, StateType>::getSuccessorBuffer() {
+    if (successorBuffer && successorBuffer.use_count() == 1) {
+        // The previous successor was not stored (e.g., because it already existed) -> reuse its memory
+        successorBuffer->copyFrom(*this->state);
+    } else {
+        successorBuffer = this->state->copy();
+    }
+    return successorBuffer;
+}
+
 template<typename ValueType, typename StateType>
 std::pair<StateType, bool> DftNextStateGenerator<ValueType, StateType>::getNewStateId(DFTStatePointer newState,
                                                                                       StateToIdCallback const& stateToIdCallback) const {
@@ -210,65 +223,76 @@ typename DftNextStateGenerator<ValueType, StateType>::DFTStatePointer DftNextSta
     bool dependencySuccessful) const {
     // Construct new state as copy from original one
     DFTStatePointer newState = origState->copy();
+    applyDependencyTrigger(newState, dependency, dependencySuccessful);
+    return newState;
+}
+
+template<typename ValueType, typename StateType>
+typename DftNextStateGenerator<ValueType, StateType>::DFTStatePointer DftNextStateGenerator<ValueType, StateType>::createSuccessorState(
+    DFTStatePointer const origState, std::shared_ptr<storm::dft::storage::elements::DFTBE<ValueType> const> be) const {
+    // Construct new state as copy from original one
+    DFTStatePointer newState = origState->copy();
+    applyFailure(newState, be);
+    return newState;
+}
 
+template<typename ValueType, typename StateType>
+void DftNextStateGenerator<ValueType, StateType>::applyDependencyTrigger(DFTStatePointer state,
+                                                                         std::shared_ptr<storm::dft::storage::elements::DFTDependency<ValueType> const> dependency,
+                                                                         bool dependencySuccessful) const {
     if (dependencySuccessful) {
         // Dependency was successful -> dependent BE fails
         STORM_LOG_TRACE("With the successful triggering of PDEP " << dependency->name() << " [" << dependency->id() << "]"
-                                                                  << " in " << mDft.getStateString(origState));
-        newState->letDependencyTrigger(dependency, true);
+                                                                  << " in " << mDft.getStateString(state));
+        state->letDependencyTrigger(dependency, true);
         STORM_LOG_ASSERT(dependency->dependentEvents().size() == 1, "Dependency " << dependency->name() << " does not have unique dependent event.");
         STORM_LOG_ASSERT(dependency->dependentEvents().front()->isBasicElement(),
                          "Trigger event " << dependency->dependentEvents().front()->name() << " is not a BE.");
         auto trigger = std::static_pointer_cast<storm::dft::storage::elements::DFTBE<ValueType> const>(dependency->dependentEvents().front());
-        return createSuccessorState(newState, trigger);
+        applyFailure(state, trigger);
     } else {
         // Dependency was unsuccessful -> no BE fails
         STORM_LOG_TRACE("With the unsuccessful triggering of PDEP " << dependency->name() << " [" << dependency->id() << "]"
-                                                                    << " in " << mDft.getStateString(origState));
-        newState->letDependencyTrigger(dependency, false);
-        return newState;
+                                                                    << " in " << mDft.getStateString(state));
+        state->letDependencyTrigger(dependency, false);
     }
 }
 
 template<typename ValueType, typename StateType>
-typename DftNextStateGenerator<ValueType, StateType>::DFTStatePointer DftNextStateGenerator<ValueType, StateType>::createSuccessorState(
-    DFTStatePointer const origState, std::shared_ptr<storm::dft::storage::elements::DFTBE<ValueType> const> be) const {
-    // Construct new state as copy from original one
-    DFTStatePointer newState = origState->copy();
-
+void DftNextStateGenerator<ValueType, StateType>::applyFailure(DFTStatePointer state,
+                                                               std::shared_ptr<storm::dft::storage::elements::DFTBE<ValueType> const> be) const {
     STORM_LOG_TRACE("With the failure of " << be->name() << " [" << be->id() << "]"
-                                           << " in " << mDft.getStateString(origState));
-    newState->letBEFail(be);
+                                           << " in " << mDft.getStateString(state));
+    state->letBEFail(be);
 
     // Propagate
     storm::dft::storage::DFTStateSpaceGenerationQueues<ValueType> queues;
-    propagateFailure(newState, be, queues);
+    propagateFailure(state, be, queues);
 
     // Check whether transient failure lead to TLE failure
     // TODO handle for all types of BEs.
     if (be->beType() == storm::dft::storage::elements::BEType::EXPONENTIAL) {
         auto beExp = std::static_pointer_cast<storm::dft::storage::elements::BEExponential<ValueType> const>(be);
-        if (beExp->isTransient() && !newState->hasFailed(mDft.getTopLevelIndex())) {
-            newState->markAsTransient();
+        if (beExp->isTransient() && !state->hasFailed(mDft.getTopLevelIndex())) {
+            state->markAsTransient();
         }
     }
 
     // Check whether failsafe propagation can be discarded
     bool discardFailSafe = false;
-    discardFailSafe |= newState->isInvalid();
-    discardFailSafe |= newState->isTransient();
-    discardFailSafe |= (newState->hasFailed(mDft.getTopLevelIndex()) && uniqueFailedState);
+    discardFailSafe |= state->isInvalid();
+    discardFailSafe |= state->isTransient();
+    discardFailSafe |= (state->hasFailed(mDft.getTopLevelIndex()) && uniqueFailedState);
 
     // Propagate failsafe (if necessary)
     if (!discardFailSafe) {
-        propagateFailsafe(newState, be, queues);
+        propagateFailsafe(state, be, queues);
 
         // Update failable dependencies
-        newState->updateFailableDependencies(be->id());
-        newState->updateDontCareDependencies(be->id());
-        newState->updateFailableInRestrictions(be->id());
+        state->updateFailableDependencies(be->id());
+        state->updateDontCareDependencies(be->id());
+        state->updateFailableInRestrictions(be->id());
     }
-    return newState;
 }
 
 template<typename ValueType, typename StateType>
@@ -80,6 +80,26 @@ class DftNextStateGenerator {
                                          std::shared_ptr<storm::dft::storage::elements::DFTDependency<ValueType> const> dependency,
                                          bool dependencySuccessful = true) const;
 
+    /*!
+     * Let the given BE fail in the given state and propagate the failure.
+     * In contrast to createSuccessorState(), the given state is modified in place.
+     *
+     * @param state State which is modified.
+     * @param be BE which fails next.
+     */
+    void applyFailure(DFTStatePointer state, std::shared_ptr<storm::dft::storage::elements::DFTBE<ValueType> const> be) const;
+
+    /*!
+     * Trigger the given dependency in the given state (see createSuccessorState()).
+     * In contrast to createSuccessorState(), the given state is modified in place.
+     *
+     * @param state State which is modified.
+     * @param dependency Dependency which triggers.
+     * @param dependencySuccessful Whether triggering the dependency was successful.
+     */
+    void applyDependencyTrigger(DFTStatePointer state, std::shared_ptr<storm::dft::storage::elements::DFTDependency<ValueType> const> dependency,
+                                bool dependencySuccessful = true) const;
+
     /**
      * Propagate the failures in a given state if the given BE fails
      *
@@ -111,6 +131,15 @@ class DftNextStateGenerator {
     storm::generator::StateBehavior<ValueType, StateType> exploreState(StateToIdCallback const& stateToIdCallback, bool exploreDependencies,
                                                                        bool takeFirstDependency);
 
+    /*!
+     * Get a copy of the current state which can be modified into a successor state.
+     * Most successor states already exist and only need to be looked up. Therefore, the copy is made into a buffer which is reused
+     * as long as the previous successor state is not referenced anymore (i.e., it was not stored via the callback).
+     *
+     * @return Copy of the current state.
+     */
+    DFTStatePointer const& getSuccessorBuffer();
+
     /*!
      * Get Id for state and check whether state should be further explored.
      *
@@ -129,6 +158,9 @@ class DftNextStateGenerator {
     // Current state
     DFTStatePointer state;
 
+    // Buffer for successor states (see getSuccessorBuffer())
+    DFTStatePointer successorBuffer;
+
     // Flag indicating whether all failed states should be merged into one unique failed state.
     bool uniqueFailedState;
 
@@ -1,5 +1,8 @@
 #include "DFTModelChecker.h"
 
+#include <type_traits>
+
+#include "storm/adapters/IntelTbbAdapter.h"
 #include "storm/builder/ParallelCompositionBuilder.h"
 #include "storm/exceptions/InvalidModelException.h"
 #include "storm/io/DirectEncodingExporter.h"
@@ -305,7 +308,6 @@ typename DFTModelChecker<ValueType>::dft_results DFTModelChecker<ValueType>::che
         // Build approximate Markov Automata for lower and upper bound
         approximation_result approxResult = std::make_pair(storm::utility::zero<ValueType>(), storm::utility::zero<ValueType>());
         std::shared_ptr<storm::models::sparse::Model<ValueType>> model;
-        std::vector<ValueType> newResult;
         storm::dft::builder::ExplicitDFTModelBuilder<ValueType> builder(dft, symmetries);
 
         // TODO: compute approximation for all properties simultaneously?
@@ -331,41 +333,34 @@ typename DFTModelChecker<ValueType>::dft_results DFTModelChecker<ValueType>::che
 
             // TODO: possible to do bisimulation on approximated model and not on concrete one?
 
-            // Build model for lower bound
-            STORM_LOG_DEBUG("Getting model for lower bound...");
-            model = builder.getModelApproximation(true, !probabilityFormula);
+            // Build models for lower and upper bound
+            STORM_LOG_DEBUG("Getting models for lower and upper bound...");
+            auto [lowerModel, upperModel] = builder.getModelApproximations(!probabilityFormula);
             // We only output the info from the lower bound as the info for the upper bound is the same
             if (printInfo && dftIOSettings.isShowDftStatisticsSet()) {
                 std::cout << "Model in iteration " << (iteration + 1) << ":\n";
-                model->printModelInformationToStream(std::cout);
+                lowerModel->printModelInformationToStream(std::cout);
             }
             buildingTimer.stop();
 
             if (ioSettings.isExportExplicitSet()) {
                 std::vector<std::string> parameterNames;
                 // TODO fill parameter names
-                storm::api::exportSparseModelAsDrn(model, ioSettings.getExportExplicitFilename(), parameterNames,
+                storm::api::exportSparseModelAsDrn(lowerModel, ioSettings.getExportExplicitFilename(), parameterNames,
                                                    !ioSettings.isExplicitExportPlaceholdersDisabled());
             }
 
-            // Check lower bounds
-            newResult = checkModel(model, {property});
-            STORM_LOG_ASSERT(newResult.size() == 1, "Wrong size for result vector.");
-            STORM_LOG_ASSERT(iteration == 0 || !comparator.isLess(newResult[0], approxResult.first),
-                             "New under-approximation " << newResult[0] << " is smaller than old result " << approxResult.first);
-            approxResult.first = newResult[0];
-
-            // Build model for upper bound
-            STORM_LOG_DEBUG("Getting model for upper bound...");
-            buildingTimer.start();
-            model = builder.getModelApproximation(false, !probabilityFormula);
-            buildingTimer.stop();
-            // Check upper bound
-            newResult = checkModel(model, {property});
-            STORM_LOG_ASSERT(newResult.size() == 1, "Wrong size for result vector.");
-            STORM_LOG_ASSERT(iteration == 0 || !comparator.isLess(approxResult.second, newResult[0]),
-                             "New over-approximation " << newResult[0] << " is greater than old result " << approxResult.second);
-            approxResult.second = newResult[0];
+            // Check lower and upper bounds
+            auto [lowerResult, upperResult] = checkModelApproximations(lowerModel, upperModel, {property});
+            STORM_LOG_ASSERT(lowerResult.size() == 1, "Wrong size for result vector.");
+            STORM_LOG_ASSERT(upperResult.size() == 1, "Wrong size for result vector.");
+            STORM_LOG_ASSERT(iteration == 0 || !comparator.isLess(lowerResult[0], approxResult.first),
+                             "New under-approximation " << lowerResult[0] << " is smaller than old result " << approxResult.first);
+            STORM_LOG_ASSERT(iteration == 0 || !comparator.isLess(approxResult.second, upperResult[0]),
+                             "New over-approximation " << upperResult[0] << " is greater than old result " << approxResult.second);
+            approxResult.first = lowerResult[0];
+            approxResult.second = upperResult[0];
+            model = lowerModel;
 
             STORM_LOG_ASSERT(comparator.isLess(approxResult.first, approxResult.second) || comparator.isEqual(approxResult.first, approxResult.second),
                              "Under-approximation " << approxResult.first << " is greater than over-approximation " << approxResult.second);
@@ -437,28 +432,66 @@ template<typename ValueType>
 std::vector<ValueType> DFTModelChecker<ValueType>::checkModel(std::shared_ptr<storm::models::sparse::Model<ValueType>>& model,
                                                               property_vector const& properties) {
     // Bisimulation
+    bisimulationTimer.start();
+    minimizeModel(model, properties);
+    bisimulationTimer.stop();
+
+    // Check the model
+    modelCheckingTimer.start();
+    std::vector<ValueType> results = checkProperties(model, properties);
+    modelCheckingTimer.stop();
+    return results;
+}
+
+template<typename ValueType>
+std::pair<std::vector<ValueType>, std::vector<ValueType>> DFTModelChecker<ValueType>::checkModelApproximations(
+    std::shared_ptr<storm::models::sparse::Model<ValueType>>& lowerModel, std::shared_ptr<storm::models::sparse::Model<ValueType>>& upperModel,
+    property_vector const& properties) {
+#ifdef STORM_HAVE_INTELTBB
+    if constexpr (std::is_same_v<ValueType, double>) {
+        // The models are independent and can be checked concurrently
+        // The time for bisimulation is included in the model checking time
+        std::vector<ValueType> lowerResults;
+        std::vector<ValueType> upperResults;
+        modelCheckingTimer.start();
+        tbb::parallel_invoke(
+            [&]() {
+                minimizeModel(lowerModel, properties);
+                lowerResults = checkProperties(lowerModel, properties);
+            },
+            [&]() {
+                minimizeModel(upperModel, properties);
+                upperResults = checkProperties(upperModel, properties);
+            });
+        modelCheckingTimer.stop();
+        return std::make_pair(std::move(lowerResults), std::move(upperResults));
+    }
+#endif
+    std::vector<ValueType> lowerResults = checkModel(lowerModel, properties);
+    std::vector<ValueType> upperResults = checkModel(upperModel, properties);
+    return std::make_pair(std::move(lowerResults), std::move(upperResults));
+}
+
+template<typename ValueType>
+void DFTModelChecker<ValueType>::minimizeModel(std::shared_ptr<storm::models::sparse::Model<ValueType>>& model, property_vector const& properties) {
     if (model->isOfType(storm::models::ModelType::Ctmc) && storm::settings::getModule<storm::settings::modules::GeneralSettings>().isBisimulationSet()) {
-        bisimulationTimer.start();
         STORM_LOG_DEBUG("Bisimulation...");
         model = storm::api::performDeterministicSparseBisimulationMinimization<storm::models::sparse::Ctmc<ValueType>>(
                     model->template as<storm::models::sparse::Ctmc<ValueType>>(), properties, storm::storage::BisimulationType::Weak)
                     ->template as<storm::models::sparse::Ctmc<ValueType>>();
         STORM_LOG_DEBUG("No. states (Bisimulation): " << model->getNumberOfStates());
         STORM_LOG_DEBUG("No. transitions (Bisimulation): " << model->getNumberOfTransitions());
-        bisimulationTimer.stop();
     }
+}
 
-    // Check the model
+template<typename ValueType>
+std::vector<ValueType> DFTModelChecker<ValueType>::checkProperties(std::shared_ptr<storm::models::sparse::Model<ValueType>> const& model,
+                                                                   property_vector const& properties) {
     STORM_LOG_DEBUG("Model checking...");
-    modelCheckingTimer.start();
     std::vector<ValueType> results;
 
     // Check each property
-    storm::utility::Stopwatch singleModelCheckingTimer;
     for (auto property : properties) {
-        singleModelCheckingTimer.reset();
-        singleModelCheckingTimer.start();
-        // STORM_PRINT_AND_LOG("Model checking property " << *property << " ...\n");
         std::unique_ptr<storm::modelchecker::CheckResult> result(
             storm::api::verifyWithSparseEngine<ValueType>(model, storm::api::createTask<ValueType>(property, true)));
 
@@ -470,11 +503,7 @@ std::vector<ValueType> DFTModelChecker<ValueType>::checkModel(std::shared_ptr<st
             STORM_LOG_WARN("The property '" << *property << "' could not be checked with the current settings.");
             results.push_back(-storm::utility::one<ValueType>());
         }
-        // STORM_PRINT_AND_LOG("Result (initial states): " << resultValue << '\n');
-        singleModelCheckingTimer.stop();
-        // STORM_PRINT_AND_LOG("Time for model checking: " << singleModelCheckingTimer << ".\n");
     }
-    modelCheckingTimer.stop();
     STORM_LOG_DEBUG("Model checking done.");
     return results;
 }
@@ -152,6 +152,38 @@ class DFTModelChecker {
      */
     std::vector<ValueType> checkModel(std::shared_ptr<storm::models::sparse::Model<ValueType>>& model, property_vector const& properties);
 
+    /*!
+     * Check the models for the lower and upper bound of an approximation for the given properties.
+     * If Intel TBB is available, both models are checked concurrently (only for double values as carl is not thread-safe).
+     *
+     * @param lowerModel Model for the lower bound
+     * @param upperModel Model for the upper bound
+     * @param properties Properties to check for
+     *
+     * @return Model checking results for the lower and the upper bound
+     */
+    std::pair<std::vector<ValueType>, std::vector<ValueType>> checkModelApproximations(std::shared_ptr<storm::models::sparse::Model<ValueType>>& lowerModel,
+                                                                                       std::shared_ptr<storm::models::sparse::Model<ValueType>>& upperModel,
+                                                                                       property_vector const& properties);
+
+    /*!
+     * Apply bisimulation minimization to the given model if it is a CTMC and bisimulation is enabled. The timers are not affected.
+     *
+     * @param model      Model to minimize
+     * @param properties Properties which have to be preserved
+     */
+    static void minimizeModel(std::shared_ptr<storm::models::sparse::Model<ValueType>>& model, property_vector const& properties);
+
+    /*!
+     * Check the given model for the given properties. The timers are not affected.
+     *
+     * @param model      Model to check
+     * @param properties Properties to check for
+     *
+     * @return Model checking result
+     */
+    static std::vector<ValueType> checkProperties(std::shared_ptr<storm::models::sparse::Model<ValueType>> const& model, property_vector const& properties);
+
     /*!
      * Checks if the computed approximation is sufficient, i.e.
      * upperBound - lowerBound <= approximationError * mean(lowerBound, upperBound).
@@ -10,6 +10,7 @@
 #include "storm-dft/utility/DftModularizer.h"
 
 #include "storm-parsers/api/properties.h"
+#include "storm/adapters/IntelTbbAdapter.h"
 #include "storm/api/properties.h"
 #include "storm/exceptions/InvalidModelException.h"
 
@@ -17,8 +18,15 @@ namespace storm::dft {
 namespace modelchecker {
 
 template<typename ValueType>
-DftModularizationChecker<ValueType>::DftModularizationChecker(std::shared_ptr<storm::dft::storage::DFT<ValueType>> dft)
-    : dft{dft}, modelchecker(true), sylvanBddManager{std::make_shared<storm::dft::storage::SylvanBddManager>()} {
+DftModularizationChecker<ValueType>::DftModularizationChecker(std::shared_ptr<storm::dft::storage::DFT<ValueType>> dft, size_t numberOfThreads)
+    : dft{dft},
+      modelchecker(true),
+      sylvanBddManager{std::make_shared<storm::dft::storage::SylvanBddManager>()},
+      numberOfThreads{std::max<size_t>(numberOfThreads, 1)} {
+#ifndef STORM_HAVE_INTELTBB
+    STORM_LOG_WARN_COND(this->numberOfThreads == 1, "Parallel analysis of dynamic modules requires Intel TBB. Modules are analyzed sequentially.");
+    this->numberOfThreads = 1;
+#endif
     // Initialize modules
     storm::dft::utility::DftModularizer<ValueType> modularizer;
     auto topModule = modularizer.computeModules(*dft);
@@ -69,18 +77,45 @@ std::shared_ptr<storm::dft::storage::DFT<ValueType>> DftModularizationChecker<Va
     // Map from module representatives to their sample points
     std::map<size_t, std::map<ValueType, ValueType>> samplePoints;
 
+    // Create properties. Parsing is done once beforehand as it is not thread safe.
+    std::stringstream propertyStream{};
+    for (auto const timebound : timepoints) {
+        propertyStream << "Pmin=? [F<=" << timebound << "\"failed\"];";
+    }
+    auto const props{storm::api::extractFormulasFromProperties(storm::api::parseProperties(propertyStream.str()))};
+
     // First analyse all dynamic modules
-    for (auto const& mod : dynamicModules) {
-        STORM_LOG_DEBUG("Analyse dynamic module " << mod.toString(*dft));
-        auto result = analyseDynamicModule(mod, timepoints);
+    std::vector<typename storm::dft::modelchecker::DFTModelChecker<ValueType>::dft_results> results(dynamicModules.size());
+    if (numberOfThreads > 1 && dynamicModules.size() > 1) {
+#ifdef STORM_HAVE_INTELTBB
+        // The modules are independent by construction. The arena bounds the number of Markov models which are built at the same time.
+        STORM_LOG_INFO("Analysing " << dynamicModules.size() << " dynamic modules with " << numberOfThreads << " threads.");
+        tbb::task_arena arena(static_cast<int>(std::min(numberOfThreads, dynamicModules.size())));
+        arena.execute([&]() {
+            tbb::parallel_for(tbb::blocked_range<size_t>(0, dynamicModules.size(), 1), [&](tbb::blocked_range<size_t> const& range) {
+                // Each analysis uses its own model checker. Its output is suppressed as it would be interleaved.
+                storm::dft::modelchecker::DFTModelChecker<ValueType> checker(false);
+                for (size_t i = range.begin(); i < range.end(); ++i) {
+                    results[i] = analyseDynamicModule(checker, dynamicModules[i], props);
+                }
+            });
+        });
+#endif
+    } else {
+        for (size_t i = 0; i < dynamicModules.size(); ++i) {
+            results[i] = analyseDynamicModule(modelchecker, dynamicModules[i], props);
+        }
+    }
+
+    for (size_t moduleIndex = 0; moduleIndex < dynamicModules.size(); ++moduleIndex) {
         // Remember probabilities for module
         std::map<ValueType, ValueType> activeSamples{};
         for (size_t i{0}; i < timepoints.size(); ++i) {
-            auto const probability{boost::get<ValueType>(result[i])};
+            auto const probability{boost::get<ValueType>(results[moduleIndex][i])};
             auto const timebound{timepoints[i]};
             activeSamples[timebound] = probability;
         }
-        samplePoints.insert({mod.getRepresentative(), activeSamples});
+        samplePoints.insert({dynamicModules[moduleIndex].getRepresentative(), activeSamples});
     }
 
     // Gather all elements contained in dynamic modules
@@ -123,20 +158,14 @@ std::shared_ptr<storm::dft::storage::DFT<ValueType>> DftModularizationChecker<Va
 
 template<typename ValueType>
 typename storm::dft::modelchecker::DFTModelChecker<ValueType>::dft_results DftModularizationChecker<ValueType>::analyseDynamicModule(
-    storm::dft::storage::DftIndependentModule const& module, std::vector<ValueType> const& timepoints) {
+    storm::dft::modelchecker::DFTModelChecker<ValueType>& checker, storm::dft::storage::DftIndependentModule const& module,
+    FormulaVector const& properties) const {
     STORM_LOG_ASSERT(!module.isStatic() && !module.isFullyStatic(), "Module should be dynamic.");
     STORM_LOG_ASSERT(!dft->getElement(module.getRepresentative())->isBasicElement(), "Dynamic module should not be a single BE.");
+    STORM_LOG_DEBUG("Analyse dynamic module " << module.toString(*dft));
 
     auto subDft = module.getSubtree(*dft);
-
-    // Create properties
-    std::stringstream propertyStream{};
-    for (auto const timebound : timepoints) {
-        propertyStream << "Pmin=? [F<=" << timebound << "\"failed\"];";
-    }
-    auto const props{storm::api::extractFormulasFromProperties(storm::api::parseProperties(propertyStream.str()))};
-
-    return std::move(modelchecker.check(subDft, props, false, false, {}));
+    return checker.check(subDft, properties, false, false, {});
 }
 
 // Explicitly instantiate the class.
@@ -28,8 +28,10 @@ class DftModularizationChecker {
     /*!
      * Initializes and computes all modules.
      * @param dft DFT.
+     * @param numberOfThreads Maximal number of dynamic modules which are analyzed concurrently.
+     *                        As each analysis builds its own Markov model, this also bounds the memory consumption.
      */
-    DftModularizationChecker(std::shared_ptr<storm::dft::storage::DFT<ValueType>> dft);
+    DftModularizationChecker(std::shared_ptr<storm::dft::storage::DFT<ValueType>> dft, size_t numberOfThreads = 1);
 
     /*!
      * Calculate the properties specified by the formulas.
@@ -74,11 +76,13 @@ class DftModularizationChecker {
 
     /*!
      * Analyse the given dynamic module.
+     * @param checker Model checker used for the analysis.
      * @param module Module.
-     * @param timepoints Time points for which the failure probability of element should be computed.
+     * @param properties Properties for the time points for which the failure probability of element should be computed.
      */
-    typename storm::dft::modelchecker::DFTModelChecker<ValueType>::dft_results analyseDynamicModule(storm::dft::storage::DftIndependentModule const &module,
-                                                                                                    std::vector<ValueType> const &timepoints);
+    typename storm::dft::modelchecker::DFTModelChecker<ValueType>::dft_results analyseDynamicModule(
+        storm::dft::modelchecker::DFTModelChecker<ValueType> &checker, storm::dft::storage::DftIndependentModule const &module,
+        FormulaVector const &properties) const;
 
     // DFT.
     std::shared_ptr<storm::dft::storage::DFT<ValueType>> dft;
@@ -89,6 +93,8 @@ class DftModularizationChecker {
     std::shared_ptr<storm::dft::storage::SylvanBddManager> sylvanBddManager;
     // Independent modules with their top element
     std::vector<storm::dft::storage::DftIndependentModule> dynamicModules;
+    // Maximal number of dynamic modules analyzed concurrently
+    size_t numberOfThreads;
 };
 
 }  // namespace modelchecker
@@ -0,0 +1,90 @@
+#include "DftSkeletonChecker.h"
+
+#include <type_traits>
+
+#include "storm/api/properties.h"
+#include "storm/environment/Environment.h"
+#include "storm/exceptions/NotSupportedException.h"
+#include "storm/modelchecker/csl/SparseCtmcCslModelChecker.h"
+#include "storm/modelchecker/csl/SparseMarkovAutomatonCslModelChecker.h"
+#include "storm/modelchecker/results/ExplicitQualitativeCheckResult.h"
+#include "storm/modelchecker/results/ExplicitQuantitativeCheckResult.h"
+#include "storm/utility/constants.h"
+#include "storm/utility/macros.h"
+
+#include "storm-dft/builder/ExplicitDFTModelBuilder.h"
+#include "storm-dft/utility/SymmetryFinder.h"
+
+namespace storm::dft {
+namespace modelchecker {
+
+DftSkeletonChecker::DftSkeletonChecker(storm::dft::storage::DFT<storm::RationalFunction> const& dft, property_vector const& properties, bool symred,
+                                       storm::dft::utility::RelevantEvents const& relevantEvents, bool allowDCForRelevant)
+    : properties(properties) {
+    dft.setRelevantEvents(relevantEvents, allowDCForRelevant);
+
+    // Symmetric BEs have the same failure rate functions and therefore remain symmetric for all valuations
+    storm::dft::storage::DftSymmetries symmetries;
+    if (symred) {
+        symmetries = storm::dft::utility::SymmetryFinder<storm::RationalFunction>::findSymmetries(dft);
+        STORM_LOG_DEBUG("Found " << symmetries.nrSymmetries() << " symmetries.");
+    }
+
+    storm::dft::builder::ExplicitDFTModelBuilder<storm::RationalFunction> builder(dft, symmetries);
+    builder.buildModel(0, 0.0);
+    parametricModel = builder.getModel();
+    STORM_LOG_INFO("Built parametric skeleton with " << parametricModel->getNumberOfStates() << " states and " << parametricModel->getNumberOfTransitions()
+                                                     << " transitions.");
+
+    if (parametricModel->isOfType(storm::models::ModelType::Ctmc)) {
+        ctmcInstantiator = std::make_unique<storm::utility::ModelInstantiator<ParametricCtmc, storm::models::sparse::Ctmc<double>>>(
+            *parametricModel->as<ParametricCtmc>());
+    } else {
+        STORM_LOG_THROW(parametricModel->isOfType(storm::models::ModelType::MarkovAutomaton), storm::exceptions::NotSupportedException,
+                        "Model type " << parametricModel->getType() << " is not supported.");
+        auto ma = parametricModel->as<ParametricMa>();
+        if (!ma->isClosed()) {
+            ma->close();
+        }
+        maInstantiator = std::make_unique<storm::utility::ModelInstantiator<ParametricMa, storm::models::sparse::MarkovAutomaton<double>>>(*ma);
+    }
+}
+
+std::vector<double> DftSkeletonChecker::check(storm::utility::parametric::Valuation<storm::RationalFunction> const& valuation) {
+    if (ctmcInstantiator) {
+        return checkProperties(ctmcInstantiator->instantiate(valuation));
+    } else {
+        return checkProperties(maInstantiator->instantiate(valuation));
+    }
+}
+
+std::shared_ptr<storm::models::sparse::Model<storm::RationalFunction>> const& DftSkeletonChecker::getParametricModel() const {
+    return parametricModel;
+}
+
+template<typename ModelType>
+std::vector<double> DftSkeletonChecker::checkProperties(ModelType const& model) const {
+    using CheckerType = std::conditional_t<std::is_same_v<ModelType, storm::models::sparse::Ctmc<double>>,
+                                           storm::modelchecker::SparseCtmcCslModelChecker<ModelType>,
+                                           storm::modelchecker::SparseMarkovAutomatonCslModelChecker<ModelType>>;
+    CheckerType checker(model);
+    storm::Environment env;
+    std::vector<double> results;
+
+    // Check each property
+    for (auto const& property : properties) {
+        auto task = storm::api::createTask<double>(property, true);
+        if (checker.canHandle(task)) {
+            std::unique_ptr<storm::modelchecker::CheckResult> result = checker.check(env, task);
+            result->filter(storm::modelchecker::ExplicitQualitativeCheckResult(model.getInitialStates()));
+            results.push_back(result->asExplicitQuantitativeCheckResult<double>().getValueMap().begin()->second);
+        } else {
+            STORM_LOG_WARN("The property '" << *property << "' could not be checked with the current settings.");
+            results.push_back(-storm::utility::one<double>());
+        }
+    }
+    return results;
+}
+
+}  // namespace modelchecker
+}  // namespace storm::dft
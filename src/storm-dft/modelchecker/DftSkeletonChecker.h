@@ -0,0 +1,79 @@
+#pragma once
+
+#include <memory>
+#include <vector>
+
+#include "storm-dft/storage/DFT.h"
+#include "storm-dft/utility/RelevantEvents.h"
+#include "storm-pars/utility/ModelInstantiator.h"
+#include "storm-pars/utility/parametric.h"
+#include "storm/logic/Formula.h"
+#include "storm/models/sparse/Ctmc.h"
+#include "storm/models/sparse/MarkovAutomaton.h"
+
+namespace storm::dft {
+namespace modelchecker {
+
+/*!
+ * Analyser for checking a DFT repeatedly under changing failure rates ("what-if" analysis).
+ * The failure rates which change are given as parameters of a parametric DFT (see also DftInstantiator).
+ * The Markov model is built only once for the parametric DFT and serves as skeleton:
+ * for each valuation of the parameters, only the values of the transition matrix are re-instantiated in place before the properties are checked.
+ * Thus, the state space is only explored once.
+ *
+ * @note A valuation must not set a failure rate to zero as this changes the structure of the state space.
+ */
+class DftSkeletonChecker {
+   public:
+    typedef std::vector<std::shared_ptr<storm::logic::Formula const>> property_vector;
+    typedef storm::models::sparse::Ctmc<storm::RationalFunction> ParametricCtmc;
+    typedef storm::models::sparse::MarkovAutomaton<storm::RationalFunction> ParametricMa;
+
+    /*!
+     * Constructor. Builds the parametric Markov model.
+     *
+     * @param dft Parametric DFT (already prepared for the Markov analysis).
+     * @param properties Properties to check for.
+     * @param symred Flag whether symmetry reduction should be used.
+     * @param relevantEvents Relevant events which should be observed.
+     * @param allowDCForRelevant Whether to allow Don't Care propagation for relevant events.
+     */
+    DftSkeletonChecker(storm::dft::storage::DFT<storm::RationalFunction> const& dft, property_vector const& properties, bool symred = true,
+                       storm::dft::utility::RelevantEvents const& relevantEvents = {}, bool allowDCForRelevant = false);
+
+    /*!
+     * Instantiate the model with the given valuation and check the properties.
+     *
+     * @param valuation Value for each parameter of the DFT.
+     * @return Model checking results for the properties.
+     */
+    std::vector<double> check(storm::utility::parametric::Valuation<storm::RationalFunction> const& valuation);
+
+    /*!
+     * Get the parametric model which is instantiated.
+     *
+     * @return Parametric model.
+     */
+    std::shared_ptr<storm::models::sparse::Model<storm::RationalFunction>> const& getParametricModel() const;
+
+   private:
+    /*!
+     * Check the properties on the given instantiated model.
+     *
+     * @param model Instantiated model.
+     * @return Model checking results.
+     */
+    template<typename ModelType>
+    std::vector<double> checkProperties(ModelType const& model) const;
+
+    property_vector properties;
+
+    std::shared_ptr<storm::models::sparse::Model<storm::RationalFunction>> parametricModel;
+
+    // Only the instantiator matching the type of the parametric model is set
+    std::unique_ptr<storm::utility::ModelInstantiator<ParametricCtmc, storm::models::sparse::Ctmc<double>>> ctmcInstantiator;
+    std::unique_ptr<storm::utility::ModelInstantiator<ParametricMa, storm::models::sparse::MarkovAutomaton<double>>> maInstantiator;
+};
+
+}  // namespace modelchecker
+}  // namespace storm::dft
@@ -1,10 +1,15 @@
 #include <gmm/gmm_std.h>
 
+#include <algorithm>
+#include <limits>
 #include <memory>
+#include <numeric>
+#include <unordered_map>
 #include <vector>
 
 #include "storm-dft/modelchecker/SFTBDDChecker.h"
 #include "storm-dft/transformations/SftToBddTransformator.h"
+#include "storm/adapters/IntelTbbAdapter.h"
 #include "storm/adapters/eigen.h"
 
 namespace storm::dft {
@@ -113,128 +118,327 @@ ValueType recursiveBirnbaumFactor(uint32_t const variableIndex, Bdd const bdd, s
     return birnbaumFactor;
 }
 
+/**
+ * Flattened representation of a bdd that allows to evaluate the bdd bottom-up several times.
+ * The nodes are grouped into levels of nodes with the same variable.
+ * The levels are ordered by decreasing variable index,
+ * therefore the children of a node are always in an earlier level.
+ * The nodes within a level are independent and can be evaluated in parallel.
+ *
+ * \note
+ * The flattened bdd does not reference Sylvan anymore.
+ * Thus, evaluations do not need to run as Lace tasks.
+ */
+struct FlatBdd {
+    // Index of the terminal nodes
+    static constexpr size_t zeroNode{0};
+    static constexpr size_t oneNode{1};
+
+    // Variable, then child and else child for each node (unspecified for the terminal nodes)
+    std::vector<uint32_t> variables{};
+    std::vector<size_t> thenNodes{};
+    std::vector<size_t> elseNodes{};
+    // Each level is given by a range [begin, end) of nodes
+    std::vector<std::pair<size_t, size_t>> levels{};
+    // Index of the node representing the bdd
+    size_t root{zeroNode};
+
+    size_t size() const {
+        return variables.size();
+    }
+};
+
 /**
  * \returns
- * The probabilities that the bdd is true
+ * The flattened representation of the given bdd.
+ */
+FlatBdd flattenBdd(Bdd const &bdd) {
+    // Collect all inner nodes
+    std::unordered_map<uint64_t, size_t> bddToNode{};
+    std::vector<Bdd> innerNodes{};
+    std::vector<Bdd> stack{bdd};
+    while (!stack.empty()) {
+        auto const current{stack.back()};
+        stack.pop_back();
+        if (current.isTerminal() || !bddToNode.emplace(current.GetBDD(), innerNodes.size()).second) {
+            continue;
+        }
+        innerNodes.push_back(current);
+        stack.push_back(current.Then());
+        stack.push_back(current.Else());
+    }
+
+    // Order by decreasing variable index such that the children are before their parents
+    std::vector<size_t> order(innerNodes.size());
+    std::iota(order.begin(), order.end(), 0);
+    std::stable_sort(order.begin(), order.end(), [&innerNodes](size_t lhs, size_t rhs) { return innerNodes[lhs].TopVar() > innerNodes[rhs].TopVar(); });
+    for (size_t position{0}; position < order.size(); ++position) {
+        // The first two nodes are the terminals
+        bddToNode[innerNodes[order[position]].GetBDD()] = position + 2;
+    }
+    auto const getNode{[&bddToNode](Bdd const &node) {
+        if (node.isZero()) {
+            return FlatBdd::zeroNode;
+        } else if (node.isOne()) {
+            return FlatBdd::oneNode;
+        }
+        return bddToNode.at(node.GetBDD());
+    }};
+
+    FlatBdd result{};
+    result.variables.resize(innerNodes.size() + 2, 0);
+    result.thenNodes.resize(innerNodes.size() + 2, FlatBdd::zeroNode);
+    result.elseNodes.resize(innerNodes.size() + 2, FlatBdd::zeroNode);
+    for (size_t position{0}; position < order.size(); ++position) {
+        auto const &node{innerNodes[order[position]]};
+        auto const index{position + 2};
+        result.variables[index] = node.TopVar();
+        result.thenNodes[index] = getNode(node.Then());
+        result.elseNodes[index] = getNode(node.Else());
+        if (result.levels.empty() || result.variables[result.levels.back().first] != result.variables[index]) {
+            result.levels.emplace_back(index, index);
+        }
+        ++result.levels.back().second;
+    }
+    result.root = getNode(bdd);
+    return result;
+}
+
+/**
+ * Calls func(i) for all i in [begin, end).
+ * The calls are performed in parallel if possible.
+ */
+template<typename FuncType>
+void parallelForEach(size_t const begin, size_t const end, FuncType const &func) {
+#ifdef STORM_HAVE_INTELTBB
+    tbb::parallel_for(tbb::blocked_range<size_t>(begin, end), [&func](tbb::blocked_range<size_t> const &range) {
+        for (size_t i{range.begin()}; i < range.end(); ++i) {
+            func(i);
+        }
+    });
+#else
+    for (size_t i{begin}; i < end; ++i) {
+        func(i);
+    }
+#endif
+}
+
+/**
+ * Calculates the probabilities that the nodes of the bdd are true
  * given the probabilities that the variables are true.
+ * The nodes of each level are evaluated in parallel
+ * and each node is evaluated for all time points at once.
  *
  * \param chunksize
  * The width of the Eigen Arrays
  *
  * \param bdd
- * The bdd for which to calculate the probabilities
+ * The flattened bdd for which to calculate the probabilities
  *
  * \param indexToProbabilities
  * A reference to a mapping
  * that must map every variable in the bdd to probabilities
  *
- * \param bddToProbabilities
- * A cache for common sub Bdds.
- * Must be empty or from an earlier call with a bdd that is an
- * ancestor of the current one.
- *
- * \note
- * Great care was made that all pointers
- * are valid elements in bddToProbabilities.
- *
+ * \param nodeProbabilities
+ * Is set to the probabilities of each node
  */
-Eigen::ArrayXd const *recursiveProbabilities(size_t const chunksize, Bdd const bdd, std::map<uint32_t, Eigen::ArrayXd> const &indexToProbabilities,
-                                             std::unordered_map<uint64_t, std::pair<bool, Eigen::ArrayXd>> &bddToProbabilities) {
-    auto const bddId{bdd.GetBDD()};
-    auto const it{bddToProbabilities.find(bddId)};
-    if (it != bddToProbabilities.end() && it->second.first) {
-        return &it->second.second;
-    }
-
-    auto &bddToProbabilitiesElement{bddToProbabilities[bddId]};
-    if (bdd.isOne()) {
-        bddToProbabilitiesElement.first = true;
-        bddToProbabilitiesElement.second = Eigen::ArrayXd::Constant(chunksize, 1);
-        return &bddToProbabilitiesElement.second;
-    } else if (bdd.isZero()) {
-        bddToProbabilitiesElement.first = true;
-        bddToProbabilitiesElement.second = Eigen::ArrayXd::Constant(chunksize, 0);
-        return &bddToProbabilitiesElement.second;
+void calculateProbabilities(size_t const chunksize, FlatBdd const &bdd, std::map<uint32_t, Eigen::ArrayXd> const &indexToProbabilities,
+                            std::vector<Eigen::ArrayXd> &nodeProbabilities) {
+    nodeProbabilities.resize(bdd.size());
+    nodeProbabilities[FlatBdd::zeroNode] = Eigen::ArrayXd::Constant(chunksize, 0);
+    nodeProbabilities[FlatBdd::oneNode] = Eigen::ArrayXd::Constant(chunksize, 1);
+    for (auto const &level : bdd.levels) {
+        auto const &currentProbabilities{indexToProbabilities.at(bdd.variables[level.first])};
+        parallelForEach(level.first, level.second, [&](size_t const node) {
+            auto const &thenProbabilities{nodeProbabilities[bdd.thenNodes[node]]};
+            auto const &elseProbabilities{nodeProbabilities[bdd.elseNodes[node]]};
+            // P(Ite(x, f1, f2)) = P(x) * P(f1) + P(!x) * P(f2)
+            nodeProbabilities[node] = currentProbabilities * thenProbabilities + (1 - currentProbabilities) * elseProbabilities;
+        });
     }
-
-    auto const &thenProbabilities{*recursiveProbabilities(chunksize, bdd.Then(), indexToProbabilities, bddToProbabilities)};
-    auto const &elseProbabilities{*recursiveProbabilities(chunksize, bdd.Else(), indexToProbabilities, bddToProbabilities)};
-
-    auto const currentVar{bdd.TopVar()};
-    auto const &currentProbabilities{indexToProbabilities.at(currentVar)};
-
-    // P(Ite(x, f1, f2)) = P(x) * P(f1) + P(!x) * P(f2)
-    bddToProbabilitiesElement.first = true;
-    bddToProbabilitiesElement.second = currentProbabilities * thenProbabilities + (1 - currentProbabilities) * elseProbabilities;
-    return &bddToProbabilitiesElement.second;
 }
 
 /**
- * \returns
- * The birnbaum importance factors of the given variable
+ * Calculates the birnbaum importance factors of the given variable for the nodes of the bdd.
  *
  * \param chunksize
  * The width of the Eigen Arrays
  *
- * \param bdd
- * The bdd for which to calculate the factors
- *
  * \param variableIndex
  * The index of the variable the birnbaum factors should be calculated
  *
- * \param indexToProbability
+ * \param bdd
+ * The flattened bdd for which to calculate the factors
+ *
+ * \param indexToProbabilities
  * A reference to a mapping
- * that must map every variable in the bdd to a probabilities
+ * that must map every variable in the bdd to probabilities
  *
- * \param bddToProbability
- * A cache for common sub Bdds.
- * Must be empty or from an earlier call with a bdd that is an
- * ancestor of the current one.
+ * \param nodeProbabilities
+ * The probabilities of the nodes as computed by calculateProbabilities
  *
- * \param bddToBirnbaumFactor
- * A cache for common sub Bdds.
- * Must be empty or from an earlier call with a bdd that is an
- * ancestor of the current one.
+ * \param nodeBirnbaumFactors
+ * Is set to the birnbaum factors of each node
  */
-Eigen::ArrayXd const *recursiveBirnbaumFactors(size_t const chunksize, uint32_t const variableIndex, Bdd const bdd,
-                                               std::map<uint32_t, Eigen::ArrayXd> const &indexToProbabilities,
-                                               std::unordered_map<uint64_t, std::pair<bool, Eigen::ArrayXd>> &bddToProbabilities,
-                                               std::unordered_map<uint64_t, std::pair<bool, Eigen::ArrayXd>> &bddToBirnbaumFactors) {
-    auto const bddId{bdd.GetBDD()};
-    auto const it{bddToBirnbaumFactors.find(bddId)};
-    if (it != bddToBirnbaumFactors.end() && it->second.first) {
-        return &it->second.second;
+void calculateBirnbaumFactors(size_t const chunksize, uint32_t const variableIndex, FlatBdd const &bdd,
+                              std::map<uint32_t, Eigen::ArrayXd> const &indexToProbabilities, std::vector<Eigen::ArrayXd> const &nodeProbabilities,
+                              std::vector<Eigen::ArrayXd> &nodeBirnbaumFactors) {
+    nodeBirnbaumFactors.resize(bdd.size());
+    Eigen::ArrayXd const zero = Eigen::ArrayXd::Constant(chunksize, 0);
+    for (auto const &level : bdd.levels) {
+        auto const currentVar{bdd.variables[level.first]};
+        if (currentVar > variableIndex) {
+            // Terminals and nodes below the variable do not depend on it
+            continue;
+        }
+        auto const &currentProbabilities{indexToProbabilities.at(currentVar)};
+        parallelForEach(level.first, level.second, [&](size_t const node) {
+            auto const thenNode{bdd.thenNodes[node]};
+            auto const elseNode{bdd.elseNodes[node]};
+            if (currentVar == variableIndex) {
+                nodeBirnbaumFactors[node] = nodeProbabilities[thenNode] - nodeProbabilities[elseNode];
+            } else {
+                // currentVar < variableIndex
+                auto const dependsOnVariable{[&](size_t const child) { return child > FlatBdd::oneNode && bdd.variables[child] <= variableIndex; }};
+                auto const &thenBirnbaumFactors{dependsOnVariable(thenNode) ? nodeBirnbaumFactors[thenNode] : zero};
+                auto const &elseBirnbaumFactors{dependsOnVariable(elseNode) ? nodeBirnbaumFactors[elseNode] : zero};
+                nodeBirnbaumFactors[node] = currentProbabilities * thenBirnbaumFactors + (1 - currentProbabilities) * elseBirnbaumFactors;
+            }
+        });
     }
+    if (bdd.root <= FlatBdd::oneNode || bdd.variables[bdd.root] > variableIndex) {
+        nodeBirnbaumFactors[bdd.root] = zero;
+    }
+}
 
-    auto &bddToBirnbaumFactorsElement{bddToBirnbaumFactors[bddId]};
-    if (bdd.isTerminal() || bdd.TopVar() > variableIndex) {
-        // return vector 0;
-        bddToBirnbaumFactorsElement.second = Eigen::ArrayXd::Constant(chunksize, 0);
-        return &bddToBirnbaumFactorsElement.second;
+/**
+ * Calculates for each node of the bdd of the minimal solutions
+ * the minimal number of basic events in a cut set represented by the node.
+ * The zero terminal represents no cut set and gets the maximal value.
+ */
+std::vector<size_t> calculateMinimalOrders(FlatBdd const &bdd) {
+    std::vector<size_t> minOrders(bdd.size(), std::numeric_limits<size_t>::max());
+    minOrders[FlatBdd::oneNode] = 0;
+    // Children are always stored before their parents
+    for (size_t node{FlatBdd::oneNode + 1}; node < bdd.size(); ++node) {
+        auto const thenOrder{minOrders[bdd.thenNodes[node]]};
+        minOrders[node] = std::min(thenOrder == std::numeric_limits<size_t>::max() ? thenOrder : thenOrder + 1, minOrders[bdd.elseNodes[node]]);
     }
+    return minOrders;
+}
 
-    auto const currentVar{bdd.TopVar()};
-    auto const &currentProbabilities{indexToProbabilities.at(currentVar)};
+/**
+ * Calculates for each node of the bdd of the minimal solutions
+ * the maximal probability of a cut set represented by the node.
+ */
+std::vector<ValueType> calculateMaximalProbabilities(FlatBdd const &bdd, std::map<uint32_t, ValueType> const &indexToProbability) {
+    std::vector<ValueType> maxProbabilities(bdd.size(), 0);
+    maxProbabilities[FlatBdd::oneNode] = 1;
+    // Children are always stored before their parents
+    for (size_t node{FlatBdd::oneNode + 1}; node < bdd.size(); ++node) {
+        maxProbabilities[node] = std::max(indexToProbability.at(bdd.variables[node]) * maxProbabilities[bdd.thenNodes[node]],
+                                          maxProbabilities[bdd.elseNodes[node]]);
+    }
+    return maxProbabilities;
+}
+
+/**
+ * Enumerates the minimal cut sets,
+ * i.e., the positive variables on the paths to the one terminal
+ * in the bdd of the minimal solutions.
+ */
+struct CutSetEnumerator {
+    FlatBdd const &bdd;
+    std::function<bool(std::vector<uint32_t> const &)> const &func;
+    SFTBDDChecker::MinimalCutSetCutoff const &cutoff;
+    std::map<uint32_t, ValueType> const &indexToProbability;
+    std::vector<size_t> const &minOrders;
+    // Only set if there is a probability cutoff
+    std::vector<ValueType> const &maxProbabilities;
+    std::vector<uint32_t> buffer{};
+
+    /**
+     * \returns
+     * False iff the enumeration was aborted.
+     */
+    bool enumerate(size_t const node, ValueType const probability) {
+        if (node == FlatBdd::zeroNode) {
+            return true;
+        }
+        // Skip subtrees which only contain cut sets violating the cutoff
+        if (cutoff.maxOrder > 0 && buffer.size() + minOrders[node] > cutoff.maxOrder) {
+            return true;
+        }
+        if (cutoff.minProbability > 0 && probability * maxProbabilities[node] < cutoff.minProbability) {
+            return true;
+        }
+        if (node == FlatBdd::oneNode) {
+            return func(buffer);
+        }
+
+        auto const currentVar{bdd.variables[node]};
+        auto const thenProbability{cutoff.minProbability > 0 ? probability * indexToProbability.at(currentVar) : probability};
+        buffer.push_back(currentVar);
+        bool const proceed{enumerate(bdd.thenNodes[node], thenProbability)};
+        buffer.pop_back();
+        return proceed && enumerate(bdd.elseNodes[node], probability);
+    }
+};
 
-    if (currentVar == variableIndex) {
-        auto const &thenProbabilities{*recursiveProbabilities(chunksize, bdd.Then(), indexToProbabilities, bddToProbabilities)};
-        auto const &elseProbabilities{*recursiveProbabilities(chunksize, bdd.Else(), indexToProbabilities, bddToProbabilities)};
+/**
+ * Searches the k most probable minimal cut sets
+ * in the bdd of the minimal solutions by branch and bound.
+ */
+struct MostProbableCutSetSearch {
+    FlatBdd const &bdd;
+    size_t const k;
+    std::map<uint32_t, ValueType> const &indexToProbability;
+    std::vector<ValueType> const &maxProbabilities;
+    std::vector<uint32_t> buffer{};
+    // Min-heap of the best cut sets found so far
+    std::vector<std::pair<ValueType, std::vector<uint32_t>>> heap{};
 
-        bddToBirnbaumFactorsElement.first = true;
-        bddToBirnbaumFactorsElement.second = thenProbabilities - elseProbabilities;
-        return &bddToBirnbaumFactorsElement.second;
+    static bool compare(std::pair<ValueType, std::vector<uint32_t>> const &lhs, std::pair<ValueType, std::vector<uint32_t>> const &rhs) {
+        return lhs.first > rhs.first;
     }
 
-    // currentVar < variableIndex
-    auto const &thenBirnbaumFactors{
-        *recursiveBirnbaumFactors(chunksize, variableIndex, bdd.Then(), indexToProbabilities, bddToProbabilities, bddToBirnbaumFactors)};
-    auto const &elseBirnbaumFactors{
-        *recursiveBirnbaumFactors(chunksize, variableIndex, bdd.Else(), indexToProbabilities, bddToProbabilities, bddToBirnbaumFactors)};
+    void search(size_t const node, ValueType const probability) {
+        if (node == FlatBdd::zeroNode) {
+            return;
+        }
+        // Skip subtrees which cannot contain a better cut set
+        if (heap.size() == k && probability * maxProbabilities[node] <= heap.front().first) {
+            return;
+        }
+        if (node == FlatBdd::oneNode) {
+            heap.emplace_back(probability, buffer);
+            std::push_heap(heap.begin(), heap.end(), compare);
+            if (heap.size() > k) {
+                std::pop_heap(heap.begin(), heap.end(), compare);
+                heap.pop_back();
+            }
+            return;
+        }
 
-    bddToBirnbaumFactorsElement.first = true;
-    bddToBirnbaumFactorsElement.second = currentProbabilities * thenBirnbaumFactors + (1 - currentProbabilities) * elseBirnbaumFactors;
-    return &bddToBirnbaumFactorsElement.second;
-}
+        auto const currentVar{bdd.variables[node]};
+        auto const thenNode{bdd.thenNodes[node]};
+        auto const elseNode{bdd.elseNodes[node]};
+        auto const thenProbability{probability * indexToProbability.at(currentVar)};
+        auto const searchThen{[&]() {
+            buffer.push_back(currentVar);
+            search(thenNode, thenProbability);
+            buffer.pop_back();
+        }};
+        // Visit the more promising child first to tighten the bound early
+        if (thenProbability * maxProbabilities[thenNode] >= probability * maxProbabilities[elseNode]) {
+            searchThen();
+            search(elseNode, probability);
+        } else {
+            search(elseNode, probability);
+            searchThen();
+        }
+    }
+};
 }  // namespace
 
 SFTBDDChecker::SFTBDDChecker(std::shared_ptr<storm::dft::storage::DFT<ValueType>> dft, std::shared_ptr<storm::dft::storage::SylvanBddManager> sylvanBddManager)
@@ -276,15 +480,89 @@ std::vector<std::vector<std::string>> SFTBDDChecker::getMinimalCutSets() {
 }
 
 std::vector<std::vector<uint32_t>> SFTBDDChecker::getMinimalCutSetsAsIndices() {
-    auto const bdd{getTopLevelElementBdd().Minsol()};
-
     std::vector<std::vector<uint32_t>> mcs{};
-    std::vector<uint32_t> buffer{};
-    recursiveMCS(bdd, buffer, mcs);
-
+    forEachMinimalCutSet([&mcs](std::vector<uint32_t> const &cutSet) {
+        mcs.push_back(cutSet);
+        return true;
+    });
     return mcs;
 }
 
+void SFTBDDChecker::forEachMinimalCutSet(std::function<bool(std::vector<uint32_t> const &)> const &func, MinimalCutSetCutoff const &cutoff) {
+    auto const flatBdd{flattenBdd(getTopLevelElementBdd().Minsol())};
+    std::vector<size_t> minOrders{};
+    if (cutoff.maxOrder > 0) {
+        minOrders = calculateMinimalOrders(flatBdd);
+    }
+    std::map<uint32_t, ValueType> indexToProbability{};
+    std::vector<ValueType> maxProbabilities{};
+    if (cutoff.minProbability > 0) {
+        indexToProbability = getIndexToProbability(cutoff.timebound);
+        maxProbabilities = calculateMaximalProbabilities(flatBdd, indexToProbability);
+    }
+
+    CutSetEnumerator enumerator{flatBdd, func, cutoff, indexToProbability, minOrders, maxProbabilities};
+    enumerator.enumerate(flatBdd.root, 1);
+}
+
+uint64_t SFTBDDChecker::getNumberOfMinimalCutSets(size_t maxOrder) {
+    auto const flatBdd{flattenBdd(getTopLevelElementBdd().Minsol())};
+    if (maxOrder == 0) {
+        // Number of paths to the one terminal
+        std::vector<uint64_t> counts(flatBdd.size(), 0);
+        counts[FlatBdd::oneNode] = 1;
+        for (auto const &level : flatBdd.levels) {
+            parallelForEach(level.first, level.second,
+                            [&](size_t const node) { counts[node] = counts[flatBdd.thenNodes[node]] + counts[flatBdd.elseNodes[node]]; });
+        }
+        return counts[flatBdd.root];
+    }
+
+    // Number of paths to the one terminal for each number of positive variables on the path
+    std::vector<std::vector<uint64_t>> counts(flatBdd.size(), std::vector<uint64_t>(maxOrder + 1, 0));
+    counts[FlatBdd::oneNode][0] = 1;
+    for (auto const &level : flatBdd.levels) {
+        parallelForEach(level.first, level.second, [&](size_t const node) {
+            auto const &thenCounts{counts[flatBdd.thenNodes[node]]};
+            auto const &elseCounts{counts[flatBdd.elseNodes[node]]};
+            counts[node][0] = elseCounts[0];
+            for (size_t order{1}; order <= maxOrder; ++order) {
+                counts[node][order] = thenCounts[order - 1] + elseCounts[order];
+            }
+        });
+    }
+    return std::accumulate(counts[flatBdd.root].begin(), counts[flatBdd.root].end(), uint64_t{0});
+}
+
+std::vector<std::pair<std::vector<uint32_t>, ValueType>> SFTBDDChecker::getMostProbableMinimalCutSets(size_t k, ValueType timebound) {
+    std::vector<std::pair<std::vector<uint32_t>, ValueType>> result{};
+    if (k == 0) {
+        return result;
+    }
+    auto const flatBdd{flattenBdd(getTopLevelElementBdd().Minsol())};
+    auto const indexToProbability{getIndexToProbability(timebound)};
+    auto const maxProbabilities{calculateMaximalProbabilities(flatBdd, indexToProbability)};
+
+    MostProbableCutSetSearch search{flatBdd, k, indexToProbability, maxProbabilities};
+    search.search(flatBdd.root, 1);
+
+    std::sort_heap(search.heap.begin(), search.heap.end(), MostProbableCutSetSearch::compare);
+    result.reserve(search.heap.size());
+    for (auto &entry : search.heap) {
+        result.emplace_back(std::move(entry.second), entry.first);
+    }
+    return result;
+}
+
+std::map<uint32_t, ValueType> SFTBDDChecker::getIndexToProbability(ValueType timebound) const {
+    std::map<uint32_t, ValueType> indexToProbability{};
+    for (auto const &be : getDFT()->getBasicElements()) {
+        auto const currentIndex{getSylvanBddManager()->getIndex(be->name())};
+        indexToProbability[currentIndex] = be->getUnreliability(timebound);
+    }
+    return indexToProbability;
+}
+
 template<typename FuncType>
 void SFTBDDChecker::chunkCalculationTemplate(std::vector<ValueType> const &timepoints, size_t chunksize, FuncType func) const {
     if (chunksize == 0) {
@@ -335,11 +613,7 @@ void SFTBDDChecker::chunkCalculationTemplate(std::vector<ValueType> const &timep
 }
 
 ValueType SFTBDDChecker::getProbabilityAtTimebound(Bdd bdd, ValueType timebound) const {
-    std::map<uint32_t, ValueType> indexToProbability{};
-    for (auto const &be : getDFT()->getBasicElements()) {
-        auto const currentIndex{getSylvanBddManager()->getIndex(be->name())};
-        indexToProbability[currentIndex] = be->getUnreliability(timebound);
-    }
+    auto indexToProbability{getIndexToProbability(timebound)};
 
     std::map<uint64_t, ValueType> bddToProbability{};
     auto const probability{recursiveProbability(bdd, indexToProbability, bddToProbability)};
@@ -347,19 +621,14 @@ ValueType SFTBDDChecker::getProbabilityAtTimebound(Bdd bdd, ValueType timebound)
 }
 
 std::vector<ValueType> SFTBDDChecker::getProbabilitiesAtTimepoints(Bdd bdd, std::vector<ValueType> const &timepoints, size_t chunksize) const {
-    std::unordered_map<uint64_t, std::pair<bool, Eigen::ArrayXd>> bddToProbabilities{};
+    auto const flatBdd{flattenBdd(bdd)};
+    std::vector<Eigen::ArrayXd> nodeProbabilities{};
     std::vector<ValueType> resultProbabilities{};
     resultProbabilities.reserve(timepoints.size());
 
     chunkCalculationTemplate(timepoints, chunksize, [&](auto const currentChunksize, auto const &timepointsArray, auto const &indexToProbabilities) {
-        // Invalidate bdd cache
-        for (auto &i : bddToProbabilities) {
-            i.second.first = false;
-        }
-
-        // Great care was made so that the pointer returned is always valid
-        // and points to an element in bddToProbabilities
-        auto const &probabilitiesArray{*recursiveProbabilities(currentChunksize, bdd, indexToProbabilities, bddToProbabilities)};
+        calculateProbabilities(currentChunksize, flatBdd, indexToProbabilities, nodeProbabilities);
+        auto const &probabilitiesArray{nodeProbabilities[flatBdd.root]};
 
         // Update result Probabilities
         for (size_t i{0}; i < currentChunksize; ++i) {
@@ -372,11 +641,7 @@ std::vector<ValueType> SFTBDDChecker::getProbabilitiesAtTimepoints(Bdd bdd, std:
 
 template<typename FuncType>
 ValueType SFTBDDChecker::getImportanceMeasureAtTimebound(std::string const &beName, ValueType timebound, FuncType func) {
-    std::map<uint32_t, ValueType> indexToProbability{};
-    for (auto const &be : getDFT()->getBasicElements()) {
-        auto const currentIndex{getSylvanBddManager()->getIndex(be->name())};
-        indexToProbability[currentIndex] = be->getUnreliability(timebound);
-    }
+    auto indexToProbability{getIndexToProbability(timebound)};
 
     auto const bdd{getTopLevelElementBdd()};
     auto const index{getSylvanBddManager()->getIndex(beName)};
@@ -396,11 +661,7 @@ std::vector<ValueType> SFTBDDChecker::getAllImportanceMeasuresAtTimebound(ValueT
     std::vector<ValueType> resultVector{};
     resultVector.reserve(getDFT()->getBasicElements().size());
 
-    std::map<uint32_t, ValueType> indexToProbability{};
-    for (auto const &be : getDFT()->getBasicElements()) {
-        auto const currentIndex{getSylvanBddManager()->getIndex(be->name())};
-        indexToProbability[currentIndex] = be->getUnreliability(timebound);
-    }
+    auto indexToProbability{getIndexToProbability(timebound)};
     std::map<uint64_t, ValueType> bddToProbability{};
 
     auto const probability{recursiveProbability(bdd, indexToProbability, bddToProbability)};
@@ -418,27 +679,19 @@ std::vector<ValueType> SFTBDDChecker::getAllImportanceMeasuresAtTimebound(ValueT
 template<typename FuncType>
 std::vector<ValueType> SFTBDDChecker::getImportanceMeasuresAtTimepoints(std::string const &beName, std::vector<ValueType> const &timepoints, size_t chunksize,
                                                                         FuncType func) {
-    auto const bdd{getTopLevelElementBdd()};
-    std::unordered_map<uint64_t, std::pair<bool, Eigen::ArrayXd>> bddToProbabilities{};
-    std::unordered_map<uint64_t, std::pair<bool, Eigen::ArrayXd>> bddToBirnbaumFactors{};
+    auto const flatBdd{flattenBdd(getTopLevelElementBdd())};
+    auto const index{getSylvanBddManager()->getIndex(beName)};
+    std::vector<Eigen::ArrayXd> nodeProbabilities{};
+    std::vector<Eigen::ArrayXd> nodeBirnbaumFactors{};
     std::vector<ValueType> resultVector{};
     resultVector.reserve(timepoints.size());
 
     chunkCalculationTemplate(timepoints, chunksize, [&](auto const currentChunksize, auto const &timepointsArray, auto const &indexToProbabilities) {
-        // Invalidate bdd caches
-        for (auto &i : bddToProbabilities) {
-            i.second.first = false;
-        }
-        for (auto &i : bddToBirnbaumFactors) {
-            i.second.first = false;
-        }
-
-        // Great care was made so that the pointer returned is always valid
-        auto const index{getSylvanBddManager()->getIndex(beName)};
-        auto const &probabilitiesArray{*recursiveProbabilities(currentChunksize, bdd, indexToProbabilities, bddToProbabilities)};
-        auto const &birnbaumFactorsArray{
-            *recursiveBirnbaumFactors(currentChunksize, index, bdd, indexToProbabilities, bddToProbabilities, bddToBirnbaumFactors)};
+        calculateProbabilities(currentChunksize, flatBdd, indexToProbabilities, nodeProbabilities);
+        calculateBirnbaumFactors(currentChunksize, index, flatBdd, indexToProbabilities, nodeProbabilities, nodeBirnbaumFactors);
 
+        auto const &probabilitiesArray{nodeProbabilities[flatBdd.root]};
+        auto const &birnbaumFactorsArray{nodeBirnbaumFactors[flatBdd.root]};
         auto const &beProbabilitiesArray{indexToProbabilities.at(index)};
         auto const ImportanceMeasureArray{func(beProbabilitiesArray, probabilitiesArray, birnbaumFactorsArray)};
 
@@ -454,38 +707,30 @@ std::vector<ValueType> SFTBDDChecker::getImportanceMeasuresAtTimepoints(std::str
 template<typename FuncType>
 std::vector<std::vector<ValueType>> SFTBDDChecker::getAllImportanceMeasuresAtTimepoints(std::vector<ValueType> const &timepoints, size_t chunksize,
                                                                                         FuncType func) {
-    auto const bdd{getTopLevelElementBdd()};
+    auto const flatBdd{flattenBdd(getTopLevelElementBdd())};
     auto const basicElements{getDFT()->getBasicElements()};
+    std::vector<uint32_t> basicElementIndices{};
+    for (auto const &be : basicElements) {
+        basicElementIndices.push_back(getSylvanBddManager()->getIndex(be->name()));
+    }
 
-    std::unordered_map<uint64_t, std::pair<bool, Eigen::ArrayXd>> bddToProbabilities{};
-    std::unordered_map<uint64_t, std::pair<bool, Eigen::ArrayXd>> bddToBirnbaumFactors{};
+    std::vector<Eigen::ArrayXd> nodeProbabilities{};
     std::vector<std::vector<ValueType>> resultVector{};
-    resultVector.resize(getDFT()->getBasicElements().size());
+    resultVector.resize(basicElements.size());
     for (auto &i : resultVector) {
         i.reserve(timepoints.size());
     }
 
     chunkCalculationTemplate(timepoints, chunksize, [&](auto const currentChunksize, auto const &timepointsArray, auto const &indexToProbabilities) {
-        // Invalidate bdd cache
-        for (auto &i : bddToProbabilities) {
-            i.second.first = false;
-        }
-
-        auto const &probabilitiesArray{*recursiveProbabilities(currentChunksize, bdd, indexToProbabilities, bddToProbabilities)};
-
-        for (size_t basicElementIndex{0}; basicElementIndex < basicElements.size(); ++basicElementIndex) {
-            auto const &be{basicElements[basicElementIndex]};
-            // Invalidate bdd cache
-            for (auto &i : bddToBirnbaumFactors) {
-                i.second.first = false;
-            }
-
-            // Great care was made so that the pointer returned is always
-            // valid and points to an element in bddToProbabilities
-            auto const index{getSylvanBddManager()->getIndex(be->name())};
-            auto const &birnbaumFactorsArray{
-                *recursiveBirnbaumFactors(currentChunksize, index, bdd, indexToProbabilities, bddToProbabilities, bddToBirnbaumFactors)};
-
+        calculateProbabilities(currentChunksize, flatBdd, indexToProbabilities, nodeProbabilities);
+        auto const &probabilitiesArray{nodeProbabilities[flatBdd.root]};
+
+        // The birnbaum factors of the basic elements are independent of each other
+        parallelForEach(0, basicElements.size(), [&](size_t const basicElementIndex) {
+            auto const index{basicElementIndices[basicElementIndex]};
+            std::vector<Eigen::ArrayXd> nodeBirnbaumFactors{};
+            calculateBirnbaumFactors(currentChunksize, index, flatBdd, indexToProbabilities, nodeProbabilities, nodeBirnbaumFactors);
+            auto const &birnbaumFactorsArray{nodeBirnbaumFactors[flatBdd.root]};
             auto const &beProbabilitiesArray{indexToProbabilities.at(index)};
 
             auto const ImportanceMeasureArray{func(beProbabilitiesArray, probabilitiesArray, birnbaumFactorsArray)};
@@ -494,7 +739,7 @@ std::vector<std::vector<ValueType>> SFTBDDChecker::getAllImportanceMeasuresAtTim
             for (size_t i{0}; i < currentChunksize; ++i) {
                 resultVector[basicElementIndex].push_back(ImportanceMeasureArray(i));
             }
-        }
+        });
     });
 
     return resultVector;
@@ -619,19 +864,5 @@ std::vector<std::vector<ValueType>> SFTBDDChecker::getAllRRWsAtTimepoints(std::v
     return getAllImportanceMeasuresAtTimepoints(timepoints, chunksize, RRWFunctor{});
 }
 
-void SFTBDDChecker::recursiveMCS(Bdd const bdd, std::vector<uint32_t> &buffer, std::vector<std::vector<uint32_t>> &minimalCutSets) const {
-    if (bdd.isOne()) {
-        minimalCutSets.push_back(buffer);
-    } else if (!bdd.isZero()) {
-        auto const currentVar{bdd.TopVar()};
-
-        buffer.push_back(currentVar);
-        recursiveMCS(bdd.Then(), buffer, minimalCutSets);
-        buffer.pop_back();
-
-        recursiveMCS(bdd.Else(), buffer, minimalCutSets);
-    }
-}
-
 }  // namespace modelchecker
 }  // namespace storm::dft
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <functional>
 #include <map>
 #include <memory>
 #include <set>
@@ -70,6 +71,56 @@ class SFTBDDChecker {
      */
     std::vector<std::vector<uint32_t>> getMinimalCutSetsAsIndices();
 
+    /**
+     * Cutoffs for the enumeration of minimal cut sets.
+     */
+    struct MinimalCutSetCutoff {
+        // Only cut sets with at most this many basic events are considered.
+        // A value of 0 disables the cutoff.
+        size_t maxOrder{0};
+        // Only cut sets with at least this probability
+        // (product of the failure probabilities of its basic events at the timebound) are considered.
+        // A value of 0 disables the cutoff.
+        ValueType minProbability{0};
+        // The timebound for the probability cutoff
+        ValueType timebound{1};
+    };
+
+    /**
+     * Calls func for each minimal cut set that satisfies the cutoff.
+     * The cut sets are enumerated directly on the bdd of the minimal solutions
+     * which shares common subsets of cut sets.
+     * Thus, the cut sets are never stored all at once.
+     * Subtrees of the bdd which only contain cut sets violating the cutoff are not visited.
+     *
+     * \param func
+     * Is called with the indices of the basic events in the cut set.
+     * The enumeration stops if func returns false.
+     *
+     * \param cutoff
+     * The cutoffs for the order and the probability of the cut sets.
+     */
+    void forEachMinimalCutSet(std::function<bool(std::vector<uint32_t> const &)> const &func, MinimalCutSetCutoff const &cutoff = {});
+
+    /**
+     * \return
+     * The number of minimal cut sets.
+     * The cut sets are counted on the bdd without enumerating them.
+     *
+     * \param maxOrder
+     * Only cut sets with at most this many basic events are counted.
+     * A value of 0 disables the cutoff.
+     */
+    uint64_t getNumberOfMinimalCutSets(size_t maxOrder = 0);
+
+    /**
+     * \return
+     * The (at most) k minimal cut sets with the highest probability at the given timebound
+     * ordered by decreasing probability together with their probability.
+     * Subtrees of the bdd which cannot contain a better cut set are not visited.
+     */
+    std::vector<std::pair<std::vector<uint32_t>, ValueType>> getMostProbableMinimalCutSets(size_t k, ValueType timebound);
+
     /**
      * \return
      * The Probability that the top level event fails.
@@ -342,20 +393,10 @@ class SFTBDDChecker {
 
    private:
     /**
-     * Recursively traverses the given BDD and returns the minimalCutSets.
-     *
-     * \param bdd
-     * The current bdd
-     *
-     * \param buffer
-     * Reference to a vector that is used as a stack.
-     * Temporarily stores the positive variables encountered.
-     *
-     * \param minimalCutSets
-     * Reference to a set of minimal cut sets.
-     * Will be populated by the function.
+     * \return
+     * A mapping from the indices of all basic events to their failure probability at the given timebound.
      */
-    void recursiveMCS(Bdd const bdd, std::vector<uint32_t> &buffer, std::vector<std::vector<uint32_t>> &minimalCutSets) const;
+    std::map<uint32_t, ValueType> getIndexToProbability(ValueType timebound) const;
 
     template<typename FuncType>
     void chunkCalculationTemplate(std::vector<ValueType> const &timepoints, size_t chunksize, FuncType func) const;
@@ -32,6 +32,7 @@ const std::string FaultTreeSettings::uniqueFailedBEOptionName = "uniquefailedbe"
 const std::string FaultTreeSettings::solveWithSmtOptionName = "smt";
 #endif
 const std::string FaultTreeSettings::chunksizeOptionName = "chunksize";
+const std::string FaultTreeSettings::moduleThreadsOptionName = "modulethreads";
 const std::string FaultTreeSettings::mttfPrecisionName = "mttf-precision";
 const std::string FaultTreeSettings::mttfStepsizeName = "mttf-stepsize";
 const std::string FaultTreeSettings::mttfAlgorithmName = "mttf-algorithm";
@@ -82,6 +83,14 @@ FaultTreeSettings::FaultTreeSettings() : ModuleSettings(moduleName) {
                                          .setDefaultValueUnsignedInteger(1)
                                          .build())
                         .build());
+    this->addOption(storm::settings::OptionBuilder(moduleName, moduleThreadsOptionName, false,
+                                                   "Maximal number of dynamic modules which are analyzed concurrently when using modularisation.")
+                        .setIsAdvanced()
+                        .addArgument(storm::settings::ArgumentBuilder::createUnsignedIntegerArgument("count", "The number of threads.")
+                                         .setDefaultValueUnsignedInteger(1)
+                                         .addValidatorUnsignedInteger(storm::settings::ArgumentValidatorFactory::createUnsignedGreaterValidator(0))
+                                         .build())
+                        .build());
     this->addOption(storm::settings::OptionBuilder(moduleName, mttfPrecisionName, false,
                                                    "The precision used for detecting convergence of the iterative MTTF approximation method.")
                         .setIsAdvanced()
@@ -189,6 +198,10 @@ size_t FaultTreeSettings::getChunksize() const {
     return this->getOption(chunksizeOptionName).getArgumentByName("chunksize").getValueAsUnsignedInteger();
 }
 
+size_t FaultTreeSettings::getNumberOfModuleThreads() const {
+    return this->getOption(moduleThreadsOptionName).getArgumentByName("count").getValueAsUnsignedInteger();
+}
+
 double FaultTreeSettings::getMttfPrecision() const {
     return this->getOption(mttfPrecisionName).getArgumentByName("value").getValueAsDouble();
 }
@@ -142,6 +142,13 @@ class FaultTreeSettings : public storm::settings::modules::ModuleSettings {
      */
     size_t getChunksize() const;
 
+    /*!
+     * Retrieves the maximal number of dynamic modules which are analyzed concurrently.
+     *
+     * @return The number of threads.
+     */
+    size_t getNumberOfModuleThreads() const;
+
     /*!
      * Retrieves the Precision to
      * detect the convergence of the
@@ -193,6 +200,7 @@ class FaultTreeSettings : public storm::settings::modules::ModuleSettings {
     static const std::string solveWithSmtOptionName;
 #endif
     static const std::string chunksizeOptionName;
+    static const std::string moduleThreadsOptionName;
     static const std::string mttfPrecisionName;
     static const std::string mttfStepsizeName;
     static const std::string mttfAlgorithmName;
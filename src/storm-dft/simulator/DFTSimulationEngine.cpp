@@ -0,0 +1,136 @@
+#include "DFTSimulationEngine.h"
+
+#include <cmath>
+#include <random>
+
+#include <boost/math/distributions/normal.hpp>
+
+#include "storm/adapters/IntelTbbAdapter.h"
+#include "storm/exceptions/InvalidArgumentException.h"
+#include "storm/utility/macros.h"
+
+namespace storm::dft {
+namespace simulator {
+
+template<typename ValueType>
+DFTSimulationEngine<ValueType>::Worker::Worker(storm::dft::storage::DFT<ValueType> const& dft,
+                                               storm::dft::storage::DFTStateGenerationInfo const& stateGenerationInfo)
+    : randomGenerator(), simulator(dft, stateGenerationInfo, randomGenerator) {
+    // Intentionally left empty
+}
+
+template<typename ValueType>
+DFTSimulationEngine<ValueType>::DFTSimulationEngine(storm::dft::storage::DFT<ValueType> const& dft,
+                                                    storm::dft::storage::DFTStateGenerationInfo const& stateGenerationInfo, Options const& options)
+    : dft(dft), stateGenerationInfo(stateGenerationInfo), options(options) {
+    STORM_LOG_THROW(options.numberOfThreads > 0, storm::exceptions::InvalidArgumentException, "At least one thread is required for the simulation.");
+    STORM_LOG_THROW(options.batchSize > 0, storm::exceptions::InvalidArgumentException, "The batch size must be positive.");
+    STORM_LOG_THROW(options.confidenceLevel > 0 && options.confidenceLevel < 1, storm::exceptions::InvalidArgumentException,
+                    "The confidence level must be in (0,1).");
+#ifndef STORM_HAVE_INTELTBB
+    STORM_LOG_WARN_COND(options.numberOfThreads == 1, "Parallel simulation requires Intel TBB. The traces are simulated sequentially.");
+#endif
+    z = boost::math::quantile(boost::math::normal(), 1 - (1 - options.confidenceLevel) / 2);
+    for (uint64_t thread = 0; thread < options.numberOfThreads; ++thread) {
+        workers.push_back(std::make_unique<Worker>(dft, stateGenerationInfo));
+    }
+}
+
+template<typename ValueType>
+SimulationEstimate DFTSimulationEngine<ValueType>::simulateBatch(Worker& worker, uint64_t batchIndex, uint64_t numberOfTraces, double timebound) const {
+    // Each batch has its own random number stream which only depends on the seed and the batch index
+    std::seed_seq seedSequence{static_cast<uint32_t>(options.seed), static_cast<uint32_t>(options.seed >> 32), static_cast<uint32_t>(batchIndex),
+                               static_cast<uint32_t>(batchIndex >> 32)};
+    worker.randomGenerator.seed(seedSequence);
+
+    SimulationEstimate result;
+    for (uint64_t trace = 0; trace < numberOfTraces; ++trace) {
+        switch (worker.simulator.simulateCompleteTrace(timebound)) {
+            case SimulationResult::SUCCESSFUL:
+                ++result.successfulTraces;
+                break;
+            case SimulationResult::UNSUCCESSFUL:
+                ++result.unsuccessfulTraces;
+                break;
+            case SimulationResult::INVALID:
+                ++result.invalidTraces;
+                break;
+        }
+    }
+    return result;
+}
+
+template<typename ValueType>
+void DFTSimulationEngine<ValueType>::updateConfidenceInterval(SimulationEstimate& estimate) const {
+    // Invalid traces are discarded
+    double n = static_cast<double>(estimate.successfulTraces + estimate.unsuccessfulTraces);
+    if (n == 0) {
+        estimate.probability = 0;
+        estimate.halfWidth = 1;
+        return;
+    }
+    double p = estimate.successfulTraces / n;
+    estimate.probability = p;
+    // The Wilson score interval does not collapse for probabilities close to 0 or 1 (which is typical for reliability estimates)
+    double zSquared = z * z;
+    estimate.halfWidth = z / (1 + zSquared / n) * std::sqrt(p * (1 - p) / n + zSquared / (4 * n * n));
+}
+
+template<typename ValueType>
+SimulationEstimate DFTSimulationEngine<ValueType>::estimateUnreliability(double timebound) {
+    SimulationEstimate result;
+    std::vector<SimulationEstimate> batchResults(workers.size());
+    uint64_t nextBatch = 0;
+    uint64_t scheduledTraces = 0;
+#ifdef STORM_HAVE_INTELTBB
+    tbb::task_arena arena(static_cast<int>(workers.size()));
+#endif
+
+    while (scheduledTraces < options.maxTraces && !result.converged) {
+        // Simulate one batch per worker
+        uint64_t numberOfBatches = 0;
+        std::vector<uint64_t> batchSizes;
+        for (; numberOfBatches < workers.size() && scheduledTraces < options.maxTraces; ++numberOfBatches) {
+            batchSizes.push_back(std::min(options.batchSize, options.maxTraces - scheduledTraces));
+            scheduledTraces += batchSizes.back();
+        }
+#ifdef STORM_HAVE_INTELTBB
+        arena.execute([&]() {
+            tbb::parallel_for(tbb::blocked_range<uint64_t>(0, numberOfBatches, 1), [&](tbb::blocked_range<uint64_t> const& range) {
+                for (uint64_t index = range.begin(); index < range.end(); ++index) {
+                    batchResults[index] = simulateBatch(*workers[index], nextBatch + index, batchSizes[index], timebound);
+                }
+            });
+        });
+#else
+        for (uint64_t index = 0; index < numberOfBatches; ++index) {
+            batchResults[index] = simulateBatch(*workers[index], nextBatch + index, batchSizes[index], timebound);
+        }
+#endif
+        nextBatch += numberOfBatches;
+
+        // Combine the batches in a fixed order such that the result does not depend on the number of threads
+        for (uint64_t index = 0; index < numberOfBatches; ++index) {
+            result.successfulTraces += batchResults[index].successfulTraces;
+            result.unsuccessfulTraces += batchResults[index].unsuccessfulTraces;
+            result.invalidTraces += batchResults[index].invalidTraces;
+            updateConfidenceInterval(result);
+            if (options.maxHalfWidth > 0 && result.getNumberOfTraces() >= options.minTraces && result.halfWidth <= options.maxHalfWidth) {
+                // Results of the remaining batches are discarded
+                result.converged = true;
+                break;
+            }
+        }
+        STORM_LOG_DEBUG("Simulated " << result.getNumberOfTraces() << " traces. Current estimate: " << result.probability << " +- " << result.halfWidth);
+    }
+    STORM_LOG_WARN_COND(options.maxHalfWidth <= 0 || result.converged,
+                        "Simulation did not reach the desired precision within " << options.maxTraces << " traces.");
+    STORM_LOG_INFO("Simulated " << result.getNumberOfTraces() << " traces (" << result.invalidTraces << " invalid). Estimate: " << result.probability
+                                << " +- " << result.halfWidth << ".");
+    return result;
+}
+
+template class DFTSimulationEngine<double>;
+
+}  // namespace simulator
+}  // namespace storm::dft
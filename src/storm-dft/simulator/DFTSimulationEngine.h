@@ -0,0 +1,119 @@
+#pragma once
+
+#include <memory>
+#include <vector>
+
+#include "storm-dft/simulator/DFTTraceSimulator.h"
+#include "storm-dft/storage/DFT.h"
+
+namespace storm::dft {
+namespace simulator {
+
+/*!
+ * Estimate obtained by Monte-Carlo simulation.
+ */
+struct SimulationEstimate {
+    // Number of traces in which the DFT failed within the time bound
+    uint64_t successfulTraces = 0;
+    // Number of traces in which the DFT did not fail within the time bound
+    uint64_t unsuccessfulTraces = 0;
+    // Number of discarded traces which reached an invalid state
+    uint64_t invalidTraces = 0;
+    // Estimated probability that the DFT fails within the time bound
+    double probability = 0;
+    // Half-width of the confidence interval (Wilson score interval) for the probability
+    double halfWidth = 1;
+    // Whether the desired precision was reached
+    bool converged = false;
+
+    uint64_t getNumberOfTraces() const {
+        return successfulTraces + unsuccessfulTraces + invalidTraces;
+    }
+};
+
+/*!
+ * Driver for Monte-Carlo simulation of DFTs with multiple threads.
+ * The traces are simulated in batches. Each thread simulates the traces with its own DFTTraceSimulator (whose state buffers are reused between traces).
+ * The random number generator for each batch is seeded with the given seed and the index of the batch. The batches are combined in the order of their index
+ * and the stopping criterion is checked after each batch. Thus, the result is reproducible for a fixed seed, regardless of the scheduling and
+ * the number of threads.
+ */
+template<typename ValueType>
+class DFTSimulationEngine {
+   public:
+    struct Options {
+        // Number of threads used for the simulation
+        uint64_t numberOfThreads = 1;
+        // Seed for the random number generators
+        uint64_t seed = 5489u;
+        // Number of traces simulated in one batch
+        uint64_t batchSize = 10000;
+        // The simulation stops after this many traces
+        uint64_t maxTraces = 10000000;
+        // The stopping criterion is only considered after this many traces
+        uint64_t minTraces = 10000;
+        // Confidence level of the confidence interval
+        double confidenceLevel = 0.95;
+        // The simulation stops as soon as the half-width of the confidence interval is at most this value. A value of 0 disables this criterion.
+        double maxHalfWidth = 0;
+    };
+
+    /*!
+     * Constructor.
+     *
+     * @param dft DFT.
+     * @param stateGenerationInfo Info for state generation.
+     * @param options Options for the simulation.
+     */
+    DFTSimulationEngine(storm::dft::storage::DFT<ValueType> const& dft, storm::dft::storage::DFTStateGenerationInfo const& stateGenerationInfo,
+                        Options const& options);
+
+    /*!
+     * Estimate the probability that the top-level event fails within the given time bound.
+     *
+     * @param timebound Time bound.
+     * @return Estimate.
+     */
+    SimulationEstimate estimateUnreliability(double timebound);
+
+   private:
+    // Simulator for one thread. The simulator keeps a reference to the random number generator.
+    struct Worker {
+        Worker(storm::dft::storage::DFT<ValueType> const& dft, storm::dft::storage::DFTStateGenerationInfo const& stateGenerationInfo);
+
+        boost::mt19937 randomGenerator;
+        DFTTraceSimulator<ValueType> simulator;
+    };
+
+    /*!
+     * Simulate the traces of the given batch with the given worker.
+     *
+     * @param worker Worker.
+     * @param batchIndex Index of the batch which determines the seed.
+     * @param numberOfTraces Number of traces in the batch.
+     * @param timebound Time bound.
+     * @return Estimate for this batch (without confidence interval).
+     */
+    SimulationEstimate simulateBatch(Worker& worker, uint64_t batchIndex, uint64_t numberOfTraces, double timebound) const;
+
+    /*!
+     * Update the probability and the confidence interval of the given estimate according to the number of traces.
+     */
+    void updateConfidenceInterval(SimulationEstimate& estimate) const;
+
+    // The DFT to simulate.
+    storm::dft::storage::DFT<ValueType> const& dft;
+
+    // General information for the state generation.
+    storm::dft::storage::DFTStateGenerationInfo const& stateGenerationInfo;
+
+    Options options;
+
+    // Quantile of the standard normal distribution for the confidence level
+    double z;
+
+    std::vector<std::unique_ptr<Worker>> workers;
+};
+
+}  // namespace simulator
+}  // namespace storm::dft
@@ -8,7 +8,8 @@ DFTTraceSimulator<ValueType>::DFTTraceSimulator(storm::dft::storage::DFT<ValueTy
                                                 storm::dft::storage::DFTStateGenerationInfo const& stateGenerationInfo, boost::mt19937& randomGenerator)
     : dft(dft), stateGenerationInfo(stateGenerationInfo), generator(dft, stateGenerationInfo), randomGenerator(randomGenerator) {
     // Set initial state
-    state = generator.createInitialState();
+    initialState = generator.createInitialState();
+    state = initialState->copy();
 }
 
 template<typename ValueType>
@@ -18,7 +19,13 @@ void DFTTraceSimulator<ValueType>::setRandomNumberGenerator(boost::mt19937& rand
 
 template<typename ValueType>
 void DFTTraceSimulator<ValueType>::resetToInitial() {
-    state = generator.createInitialState();
+    if (state.use_count() == 1) {
+        // Reuse the memory of the current state
+        state->copyFrom(*initialState);
+    } else {
+        // The current state is still referenced from outside
+        state = initialState->copy();
+    }
 }
 
 template<typename ValueType>
@@ -102,19 +109,24 @@ SimulationResult DFTTraceSimulator<ValueType>::step(storm::dft::storage::Failabl
         return SimulationResult::UNSUCCESSFUL;
     }
 
-    DFTStatePointer newState;
+    // Compute the successor in the buffer of the previous state (if it is not referenced from outside anymore)
+    if (successorState && successorState.use_count() == 1) {
+        successorState->copyFrom(*state);
+    } else {
+        successorState = state->copy();
+    }
     if (nextFailElement.isFailureDueToDependency()) {
-        newState = generator.createSuccessorState(state, nextFailElement.asDependency(dft), dependencySuccessful);
+        generator.applyDependencyTrigger(successorState, nextFailElement.asDependency(dft), dependencySuccessful);
     } else {
-        newState = generator.createSuccessorState(state, nextFailElement.asBE(dft));
+        generator.applyFailure(successorState, nextFailElement.asBE(dft));
     }
 
-    if (newState->isInvalid() || newState->isTransient()) {
-        STORM_LOG_TRACE("Step is invalid because new state " << (newState->isInvalid() ? "is invalid." : "has transient fault."));
+    if (successorState->isInvalid() || successorState->isTransient()) {
+        STORM_LOG_TRACE("Step is invalid because new state " << (successorState->isInvalid() ? "is invalid." : "has transient fault."));
         return SimulationResult::INVALID;
     }
 
-    state = newState;
+    std::swap(state, successorState);
     return SimulationResult::SUCCESSFUL;
 }
 
@@ -105,9 +105,15 @@ class DFTTraceSimulator {
     // Generator for creating next state in DFT
     storm::dft::generator::DftNextStateGenerator<ValueType> generator;
 
+    // Initial state
+    DFTStatePointer initialState;
+
     // Current state
     DFTStatePointer state;
 
+    // Buffer for computing the successor state. Reusing the buffer avoids allocating a new state in each step.
+    DFTStatePointer successorState;
+
     // Random number generator
     boost::mt19937& randomGenerator;
 };
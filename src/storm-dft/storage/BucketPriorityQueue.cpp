@@ -30,7 +30,7 @@ bool BucketPriorityQueue<PriorityType>::empty() const {
 template<typename PriorityType>
 size_t BucketPriorityQueue<PriorityType>::size() const {
     size_t size = immediateBucket.size();
-    for (size_t i = currentBucket; currentBucket < nrBuckets; ++i) {
+    for (size_t i = currentBucket; i < nrBuckets; ++i) {
         size += buckets[i].size();
     }
     return size;
@@ -144,6 +144,24 @@ typename BucketPriorityQueue<PriorityType>::PriorityTypePointer BucketPriorityQu
     return item;
 }
 
+template<typename PriorityType>
+std::vector<typename BucketPriorityQueue<PriorityType>::PriorityTypePointer> BucketPriorityQueue<PriorityType>::popBatch(size_t maxItems) {
+    std::vector<PriorityTypePointer> items;
+    if (!immediateBucket.empty()) {
+        // Only take items which should be considered immediately
+        while (items.size() < maxItems && !immediateBucket.empty()) {
+            items.push_back(pop());
+        }
+        return items;
+    }
+    // Only take items from the current bucket
+    size_t bucket = currentBucket;
+    while (items.size() < maxItems && !empty() && currentBucket == bucket) {
+        items.push_back(pop());
+    }
+    return items;
+}
+
 template<typename PriorityType>
 size_t BucketPriorityQueue<PriorityType>::getBucket(double priority) const {
     STORM_LOG_ASSERT(priority >= lowerValue, "Priority " << priority << " is too low");
@@ -72,6 +72,15 @@ class BucketPriorityQueue {
      */
     PriorityTypePointer pop();
 
+    /*!
+     * Get up to the given number of elements with the highest priority and remove them from the queue.
+     * The elements are only taken from the immediate bucket or the first non-empty bucket.
+     * Thus, all returned elements have (up to the bucket granularity) a higher priority than the remaining elements and can be expanded independently.
+     * @param maxItems Maximal number of elements.
+     * @return Elements in the order in which pop() would return them.
+     */
+    std::vector<PriorityTypePointer> popBatch(size_t maxItems);
+
     /*!
      * Print info about priority queue.
      * @param out Output stream.
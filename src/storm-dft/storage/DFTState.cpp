@@ -105,6 +105,19 @@ std::shared_ptr<DFTState<ValueType>> DFTState<ValueType>::copy() const {
     return std::make_shared<storm::dft::storage::DFTState<ValueType>>(*this);
 }
 
+template<typename ValueType>
+void DFTState<ValueType>::copyFrom(DFTState<ValueType> const& other) {
+    STORM_LOG_ASSERT(&mDft == &other.mDft, "States belong to different DFTs.");
+    mStatus = other.mStatus;
+    mId = other.mId;
+    failableElements = other.failableElements;
+    mUsedRepresentants = other.mUsedRepresentants;
+    indexRelevant = other.indexRelevant;
+    mPseudoState = other.mPseudoState;
+    mValid = other.mValid;
+    mTransient = other.mTransient;
+}
+
 template<typename ValueType>
 DFTElementState DFTState<ValueType>::getElementState(size_t id) const {
     return static_cast<DFTElementState>(getElementStateInt(id));
@@ -71,6 +71,14 @@ class DFTState {
 
     std::shared_ptr<DFTState<ValueType>> copy() const;
 
+    /**
+     * Overwrite this state with the given state of the same DFT.
+     * In contrast to copy(), the memory of this state is reused.
+     *
+     * @param other State to copy.
+     */
+    void copyFrom(DFTState<ValueType> const& other);
+
     DFTElementState getElementState(size_t id) const;
 
     static DFTElementState getElementState(storm::storage::BitVector const& state, DFTStateGenerationInfo const& stateGenerationInfo, size_t id);
@@ -259,6 +267,7 @@ class DFTState {
 
     /**
      * Order the state in decreasing order using the symmetries.
+     * As inner symmetries are ordered before the enclosing ones, the result is the canonical representative of the symmetry orbit.
      * @return True, if elements were swapped, false if nothing changed.
      */
     bool orderBySymmetry();
@@ -1,5 +1,8 @@
 #pragma once
 
+#include <algorithm>
+#include <set>
+
 namespace storm::dft {
 namespace storage {
 
@@ -121,41 +124,58 @@ class DFTStateGenerationInfo {
     }
 
     /**
-     * Generate more symmetries by combining two symmetries
+     * Generate more symmetries by combining two symmetries.
+     * If a symmetry lies within one symmetric element of another (parent) symmetry, it is mirrored into all other symmetric elements of the parent.
+     * This is repeated until a fixpoint is reached, such that nested symmetries of arbitrary depth are covered.
+     * Afterwards, the symmetries are ordered by increasing length. Thus, inner symmetries are always ordered before the symmetries containing them
+     * and ordering the state by the symmetries in this order yields a canonical representative of the orbit.
      */
     void generateSymmetries() {
-        // Iterate over possible children
-        for (size_t i = 0; i < mSymmetries.size(); ++i) {
-            size_t childStart = mSymmetries[i].second[0];
-            size_t childLength = mSymmetries[i].first;
-            // Iterate over possible parents
-            for (size_t j = i + 1; j < mSymmetries.size(); ++j) {
-                size_t parentStart = mSymmetries[j].second[0];
-                size_t parentLength = mSymmetries[j].first;
-                // Check if child lies in parent
-                if (parentStart <= childStart && childStart + childLength < parentStart + parentLength) {
-                    // We add the symmetry of the child to all symmetric elements in the parent
-                    std::vector<std::vector<size_t>> newSymmetries;
-                    // Start iteration at 1, because symmetry for child at 0 is already included
-                    for (size_t index = 1; index < mSymmetries[j].second.size(); ++index) {
-                        std::vector<size_t> newStarts;
-                        // Apply child symmetry to all symmetric elements of parent
-                        for (size_t symmetryStarts : mSymmetries[i].second) {
-                            // Get symmetric element by applying the bijection
-                            size_t symmetryOffset = symmetryStarts - parentStart;
-                            newStarts.push_back(mSymmetries[j].second[index] + symmetryOffset);
-                        }
-                        newSymmetries.push_back(newStarts);
+        std::set<std::pair<size_t, std::vector<size_t>>> existingSymmetries(mSymmetries.begin(), mSymmetries.end());
+        bool changed;
+        do {
+            changed = false;
+            // Iterate over possible children
+            for (size_t i = 0; i < mSymmetries.size(); ++i) {
+                // Iterate over possible parents
+                for (size_t j = 0; j < mSymmetries.size(); ++j) {
+                    // Copy as new symmetries are inserted below
+                    auto const child = mSymmetries[i];
+                    auto const parent = mSymmetries[j];
+                    if (child.first >= parent.first) {
+                        continue;
                     }
-                    // Insert new symmetry after child
-                    for (size_t index = 0; index < newSymmetries.size(); ++index) {
-                        mSymmetries.insert(mSymmetries.begin() + i + 1 + index, std::make_pair(childLength, newSymmetries[index]));
+                    size_t childStart = child.second.front();
+                    size_t childEnd = child.second.back() + child.first;
+                    for (size_t index = 0; index < parent.second.size(); ++index) {
+                        // Check if child lies in the symmetric element of the parent
+                        if (parent.second[index] > childStart || childEnd > parent.second[index] + parent.first) {
+                            continue;
+                        }
+                        // Apply child symmetry to all other symmetric elements in the parent
+                        for (size_t otherIndex = 0; otherIndex < parent.second.size(); ++otherIndex) {
+                            if (otherIndex == index) {
+                                continue;
+                            }
+                            std::vector<size_t> newStarts;
+                            for (size_t symmetryStart : child.second) {
+                                // Get symmetric element by applying the bijection
+                                newStarts.push_back(symmetryStart - parent.second[index] + parent.second[otherIndex]);
+                            }
+                            auto newSymmetry = std::make_pair(child.first, newStarts);
+                            if (existingSymmetries.insert(newSymmetry).second) {
+                                mSymmetries.push_back(newSymmetry);
+                                changed = true;
+                            }
+                        }
+                        break;
                     }
-                    i += newSymmetries.size();
-                    break;
                 }
             }
-        }
+        } while (changed);
+
+        // Order inner symmetries before the enclosing symmetries
+        std::stable_sort(mSymmetries.begin(), mSymmetries.end(), [](auto const& left, auto const& right) { return left.first < right.first; });
     }
 
     void checkSymmetries() {
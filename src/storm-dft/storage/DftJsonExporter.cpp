@@ -21,26 +21,27 @@ void DftJsonExporter<ValueType>::toFile(storm::dft::storage::DFT<ValueType> cons
 
 template<typename ValueType>
 void DftJsonExporter<ValueType>::toStream(storm::dft::storage::DFT<ValueType> const& dft, std::ostream& os) {
-    os << storm::dumpJson(translate(dft)) << '\n';
-}
-
-template<typename ValueType>
-typename DftJsonExporter<ValueType>::Json DftJsonExporter<ValueType>::translate(storm::dft::storage::DFT<ValueType> const& dft) {
-    Json jsonDft;
-    // Top level element
-    jsonDft["toplevel"] = std::to_string(dft.getTopLevelIndex());
+    // The members are written in the (alphabetical) order of their keys as in the JSON library.
+    storm::JsonStreamWriter<double> writer(os);
+    writer.beginObject();
+    // Nodes
+    writer.key("nodes");
+    writer.beginArray();
+    for (size_t i = 0; i < dft.nrElements(); ++i) {
+        writer.value(translateElement(dft.getElement(i)));
+    }
+    writer.endArray();
     // Parameters
     Json jsonParameters = translateParameters(dft);
     if (!jsonParameters.empty()) {
-        jsonDft["parameters"] = jsonParameters;
+        writer.key("parameters");
+        writer.value(jsonParameters);
     }
-    // Nodes
-    Json jsonNodes;
-    for (size_t i = 0; i < dft.nrElements(); ++i) {
-        jsonNodes.push_back(translateElement(dft.getElement(i)));
-    }
-    jsonDft["nodes"] = jsonNodes;
-    return jsonDft;
+    // Top level element
+    writer.key("toplevel");
+    writer.value(std::to_string(dft.getTopLevelIndex()));
+    writer.endObject();
+    os << '\n';
 }
 
 template<>
@@ -26,19 +26,13 @@ class DftJsonExporter {
 
     /*!
      * Export DFT to given stream.
+     * The nodes are written one after another, so the JSON representation of the whole DFT is never kept in memory.
      * @param dft DFT.
      * @param os Output stream.
      */
     static void toStream(storm::dft::storage::DFT<ValueType> const& dft, std::ostream& os);
 
    private:
-    /*!
-     * Export DFT into JSON format.
-     * @param dft DFT.
-     * @return JSON representation of DFT.
-     */
-    static Json translate(storm::dft::storage::DFT<ValueType> const& dft);
-
     /*!
      * Export DFT element into JSON format.
      * @param element DFT element.
@@ -8,7 +8,7 @@
 namespace storm::dft {
 namespace storage {
 
-DftModule::DftModule(size_t representative, std::set<size_t> const& elements) : representative(representative), elements(elements) {
+DftModule::DftModule(size_t representative, std::set<size_t> elements) : representative(representative), elements(std::move(elements)) {
     // Assertion cannot be guaranteed as spare module currently only contain the corresponding BEs and SPAREs
     // STORM_LOG_ASSERT(std::find(this->elements.begin(), this->elements.end(), representative) != this->elements.end(),
     //                 "Representative " + std::to_string(representative) + " must be contained in module.");
@@ -31,12 +31,17 @@ std::string DftModule::toString(storm::dft::storage::DFT<ValueType> const& dft)
     stream << "}";
     return stream.str();
 }
-DftIndependentModule::DftIndependentModule(size_t representative, std::set<size_t> const& elements, std::set<DftIndependentModule> const& submodules,
-                                           bool staticElements, bool fullyStatic, bool singleBE)
-    : DftModule(representative, elements), staticElements(staticElements), fullyStatic(fullyStatic), singleBE(singleBE), submodules(submodules) {
+DftIndependentModule::DftIndependentModule(size_t representative, std::set<size_t> elements, std::set<DftIndependentModule> submodules, bool staticElements,
+                                           bool fullyStatic, bool singleBE)
+    : DftModule(representative, std::move(elements)),
+      staticElements(staticElements),
+      fullyStatic(fullyStatic),
+      singleBE(singleBE),
+      submodules(std::move(submodules)) {
     STORM_LOG_ASSERT(std::find(this->elements.begin(), this->elements.end(), representative) != this->elements.end(),
                      "Representative " + std::to_string(representative) + " must be contained in module.");
-    STORM_LOG_ASSERT(!singleBE || (submodules.empty() && elements.size() == 1), "Module " + std::to_string(representative) + " is not a single BE.");
+    STORM_LOG_ASSERT(!singleBE || (this->submodules.empty() && this->elements.size() == 1),
+                     "Module " + std::to_string(representative) + " is not a single BE.");
 }
 
 std::set<size_t> DftIndependentModule::getAllElements() const {
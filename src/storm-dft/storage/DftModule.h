@@ -22,7 +22,7 @@ class DftModule {
      * @param Id of representative, ie top element of the subtree.
      * @param elements Set of element ids forming the module.
      */
-    DftModule(size_t representative, std::set<size_t> const& elements);
+    DftModule(size_t representative, std::set<size_t> elements);
 
     /*!
      * Get representative (top element of subtree).
@@ -74,8 +74,8 @@ class DftIndependentModule : public DftModule {
      * @param fullyStatic Whether the independent module contains only static static elements and all sub-modules also contain only static elements.
      * @param singleBE Whether the independent module consists of a single BE.
      */
-    DftIndependentModule(size_t representative, std::set<size_t> const& elements, std::set<DftIndependentModule> const& submodules, bool staticElements,
-                         bool fullyStatic, bool singleBE);
+    DftIndependentModule(size_t representative, std::set<size_t> elements, std::set<DftIndependentModule> submodules, bool staticElements, bool fullyStatic,
+                         bool singleBE);
 
     /*!
      * Returns whether the module contains only static elements (except in sub-modules).
@@ -15,7 +15,7 @@ DftToGspnTransformator<ValueType>::DftToGspnTransformator(storm::dft::storage::D
 
 template<typename ValueType>
 void DftToGspnTransformator<ValueType>::transform(std::map<uint64_t, uint64_t> const &priorities, std::set<uint64_t> const &dontCareElements, bool smart,
-                                                  bool mergeDCFailed, bool extendPriorities) {
+                                                  bool mergeDCFailed, bool extendPriorities, bool storeLayout) {
     this->priorities = priorities;
     this->dontCareElements = dontCareElements;
     this->smart = smart;
@@ -23,6 +23,8 @@ void DftToGspnTransformator<ValueType>::transform(std::map<uint64_t, uint64_t> c
     this->dontCarePriority = 1;
     this->extendedPriorities = extendPriorities;
     builder.setGspnName("DftToGspnTransformation");
+    builder.setStoreLayout(storeLayout);
+    reserveGspnElements();
 
     // Translate all GSPN elements
     translateGSPNElements();
@@ -105,7 +107,22 @@ uint64_t DftToGspnTransformator<ValueType>::toplevelFailedPlaceId() {
 
 template<typename ValueType>
 gspn::GSPN *DftToGspnTransformator<ValueType>::obtainGSPN() {
-    return builder.buildGspn();
+    return builder.releaseGspn();
+}
+
+template<typename ValueType>
+void DftToGspnTransformator<ValueType>::reserveGspnElements() {
+    // Each element has a failed place and (possibly) unavailable, active, disabled and Don't Care places
+    uint64_t nrPlaces = 5 * mDft.nrElements();
+    // Gates need transitions for failing, failsafe, activation and Don't Care propagation which mostly scale with the number of children
+    uint64_t nrImmediateTransitions = 0;
+    for (std::size_t i = 0; i < mDft.nrElements(); ++i) {
+        nrImmediateTransitions += mDft.getElement(i)->nrChildren() + 3;
+    }
+    // Each exponential BE has one transition for active and passive failure
+    uint64_t nrTimedTransitions = 2 * mDft.nrBasicElements();
+    builder.reserve(nrPlaces, nrImmediateTransitions, nrTimedTransitions);
+    failedPlaces.reserve(mDft.nrElements());
 }
 
 template<typename ValueType>
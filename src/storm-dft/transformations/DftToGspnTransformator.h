@@ -29,9 +29,11 @@ class DftToGspnTransformator {
      *              Smart semantics will only generate necessary parts of the GSPNs.
      * @param mergeDCFailed Flag indicating if Don't Care places and Failed places should be merged.
      * @param extendPriorities Flag indicating if the extended priority calculation is used.
+     * @param storeLayout Flag indicating if layout information for the GSPN elements should be stored.
+     *                    The layout is only necessary if the GSPN is exported.
      */
     void transform(std::map<uint64_t, uint64_t> const &priorities, std::set<uint64_t> const &dontCareElements, bool smart = true, bool mergeDCFailed = true,
-                   bool extendPriorities = false);
+                   bool extendPriorities = false, bool storeLayout = true);
 
     /*!
      * Compute priorities used for GSPN transformation.
@@ -42,8 +44,8 @@ class DftToGspnTransformator {
     std::map<uint64_t, uint64_t> computePriorities(bool extendedPrio);
 
     /*!
-     * Extract Gspn by building
-     *
+     * Extract Gspn by building.
+     * The places and transitions are moved into the GSPN, thus this method can only be called once.
      */
     gspn::GSPN *obtainGSPN();
 
@@ -53,6 +55,11 @@ class DftToGspnTransformator {
     uint64_t toplevelFailedPlaceId();
 
    private:
+    /*!
+     * Reserve memory in the GSPN builder based on an estimate of the number of GSPN elements.
+     */
+    void reserveGspnElements();
+
     /*!
      * Translate all elements of the GSPN.
      */
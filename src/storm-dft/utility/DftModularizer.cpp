@@ -6,11 +6,10 @@ namespace utility {
 template<typename ValueType>
 storm::dft::storage::DftIndependentModule DftModularizer<ValueType>::computeModules(storm::dft::storage::DFT<ValueType> const &dft) {
     // Initialize data structures
-    // dfsCounters/elementInfos must not be cleared because they are either not initialized or were cleared in a previous call of computeModules()
-    for (auto const &id : dft.getAllIds()) {
-        dfsCounters[id] = DfsCounter{};
-        modInfos[id] = ModularizationInfo{};
-    }
+    // The data structures must not be cleared because they are either not initialized or were cleared in a previous call of computeModules()
+    dfsCounters.resize(dft.nrElements());
+    children.resize(dft.nrElements());
+    isModule.resize(dft.nrElements(), false);
     lastDate = 0;
 
     // First depth first search of the LTA/DR algorithm.
@@ -18,23 +17,30 @@ storm::dft::storage::DftIndependentModule DftModularizer<ValueType>::computeModu
 
     // Second depth first search of the LTA/DR algorithm.
     obtainModules(dft.getTopLevelElement());
-    auto &topModInfo{modInfos.at(dft.getTopLevelElement()->id())};
-    STORM_LOG_ASSERT(topModInfo.isModule, "Top element should form module.");
-    STORM_LOG_ASSERT(topModInfo.elements.empty(), "Top module does not exist.");
-    STORM_LOG_ASSERT(topModInfo.submodules.size() == 1, "Top element should form unique module.");
+    STORM_LOG_ASSERT(isModule[dft.getTopLevelElement()->id()], "Top element should form module.");
+    STORM_LOG_ASSERT(moduleRepresentatives.back() == dft.getTopLevelElement()->id(), "Top module should be found last.");
+
+    // Build modules bottom-up such that each element is only traversed once.
+    for (ElementId representative : moduleRepresentatives) {
+        builtModules.emplace(representative, buildModule(dft, representative));
+    }
+    STORM_LOG_ASSERT(builtModules.size() == 1, "Top element should form unique module.");
     // Get top module
-    storm::dft::storage::DftIndependentModule topModule = *topModInfo.submodules.begin();
+    storm::dft::storage::DftIndependentModule topModule = std::move(builtModules.begin()->second);
 
     // Free some space
     dfsCounters.clear();
-    modInfos.clear();
+    children.clear();
+    isModule.clear();
+    moduleRepresentatives.clear();
+    builtModules.clear();
 
     return topModule;
 }
 
 template<typename ValueType>
 void DftModularizer<ValueType>::populateDfsCounters(DFTElementCPointer const element) {
-    auto &counter{dfsCounters.at(element->id())};
+    auto &counter{dfsCounters[element->id()]};
 
     ++lastDate;
     if (counter.firstVisit == 0) {
@@ -43,7 +49,8 @@ void DftModularizer<ValueType>::populateDfsCounters(DFTElementCPointer const ele
         counter.firstVisit = lastDate;
 
         // Recursively visit children
-        for (auto const &child : getChildren(element)) {
+        children[element->id()] = getChildren(element);
+        for (auto const &child : children[element->id()]) {
             populateDfsCounters(child);
         }
         ++lastDate;
@@ -59,52 +66,62 @@ void DftModularizer<ValueType>::populateDfsCounters(DFTElementCPointer const ele
 
 template<typename ValueType>
 void DftModularizer<ValueType>::obtainModules(DFTElementCPointer const element) {
-    auto &counter{dfsCounters.at(element->id())};
-    auto &modInfo{modInfos.at(element->id())};
+    auto &counter{dfsCounters[element->id()]};
 
     if (counter.minFirstVisit == 0) {
         // element was never visited before as min can never be 0
-        // Add current element
-        modInfo.elements.insert(element->id());
-
         // minFirstVisit <= secondVisit
         counter.minFirstVisit = counter.secondVisit;
         // maxLastVisit >= firstVisit
         counter.maxLastVisit = counter.firstVisit;
-        for (auto const &child : getChildren(element)) {
+        for (auto const &child : children[element->id()]) {
             obtainModules(child);
 
             // Set min/max visit times
-            auto const &childCounter{dfsCounters.at(child->id())};
+            auto const &childCounter{dfsCounters[child->id()]};
             counter.minFirstVisit = std::min({counter.minFirstVisit, childCounter.firstVisit, childCounter.minFirstVisit});
             counter.maxLastVisit = std::max({counter.maxLastVisit, childCounter.lastVisit, childCounter.maxLastVisit});
-
-            // Fill information
-            auto const &childInfo{modInfos.at(child->id())};
-            // Only insert elements and submodules once
-            modInfo.elements.insert(childInfo.elements.begin(), childInfo.elements.end());
-            modInfo.submodules.insert(childInfo.submodules.begin(), childInfo.submodules.end());
-            modInfo.fullyStatic = modInfo.fullyStatic && childInfo.fullyStatic;
-            if (!childInfo.isStatic && !childInfo.isModule) {
-                modInfo.isStatic = false;
-            }
         }
 
-        if (!element->isStaticElement()) {
-            modInfo.isStatic = false;
-            modInfo.fullyStatic = false;
+        if (counter.firstVisit < counter.minFirstVisit && counter.maxLastVisit < counter.secondVisit) {
+            isModule[element->id()] = true;
+            moduleRepresentatives.push_back(element->id());
         }
+    }
+}
 
-        if (counter.firstVisit < counter.minFirstVisit && counter.maxLastVisit < counter.secondVisit) {
-            // Create new module
-            storm::dft::storage::DftIndependentModule module(element->id(), modInfo.elements, modInfo.submodules, modInfo.isStatic, modInfo.fullyStatic,
-                                                             element->isBasicElement());
-            // Update information
-            modInfo.elements = {};
-            modInfo.submodules = {module};
-            modInfo.isModule = true;
+template<typename ValueType>
+storm::dft::storage::DftIndependentModule DftModularizer<ValueType>::buildModule(storm::dft::storage::DFT<ValueType> const &dft, ElementId representative) {
+    std::set<ElementId> elements{representative};
+    std::set<storm::dft::storage::DftIndependentModule> submodules;
+    bool isStatic = true;
+    bool fullyStatic = true;
+
+    std::vector<ElementId> stack{representative};
+    while (!stack.empty()) {
+        ElementId current = stack.back();
+        stack.pop_back();
+        if (!dft.getElement(current)->isStaticElement()) {
+            isStatic = false;
+        }
+        for (auto const &child : children[current]) {
+            if (isModule[child->id()]) {
+                // Sub-modules are not traversed again but moved into this module
+                auto submoduleIt = builtModules.find(child->id());
+                if (submoduleIt != builtModules.end()) {
+                    fullyStatic = fullyStatic && submoduleIt->second.isFullyStatic();
+                    submodules.insert(std::move(submoduleIt->second));
+                    builtModules.erase(submoduleIt);
+                }
+            } else if (elements.insert(child->id()).second) {
+                stack.push_back(child->id());
+            }
         }
     }
+    fullyStatic = fullyStatic && isStatic;
+
+    return storm::dft::storage::DftIndependentModule(representative, std::move(elements), std::move(submodules), isStatic, fullyStatic,
+                                                     dft.getElement(representative)->isBasicElement());
 }
 
 template<typename ValueType>
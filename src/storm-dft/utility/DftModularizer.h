@@ -34,18 +34,28 @@ class DftModularizer {
    private:
     /*!
      * Recursive function to perform first depth first search of the LTA/DR algorithm.
-     * The function populates dfsCounter.
+     * The function populates dfsCounter and caches the children of each visited element.
      * @param element Current DFT element.
      */
     void populateDfsCounters(DFTElementCPointer const element);
 
     /*!
      * Recursive function to obtain modularization information.
-     * The function performs a second depth first search of the LTA/DR algorithm and populates modInfos.
+     * The function performs a second depth first search of the LTA/DR algorithm and determines the module representatives.
+     * Representatives are stored in post-order, i.e., each module is found after all of its sub-modules.
      * @param element Current DFT element.
      */
     void obtainModules(DFTElementCPointer const element);
 
+    /*!
+     * Create the independent module with the given representative.
+     * Only the elements not contained in sub-modules are traversed. The sub-modules must have been built before and are moved into the new module.
+     * @param dft DFT.
+     * @param representative Id of the module representative.
+     * @return Independent module.
+     */
+    storm::dft::storage::DftIndependentModule buildModule(storm::dft::storage::DFT<ValueType> const& dft, ElementId representative);
+
     /*!
      * Return all children for an element.
      * @param element DFT element.
@@ -80,16 +90,15 @@ class DftModularizer {
         uint64_t minFirstVisit{0};
         uint64_t maxLastVisit{0};
     };
-    struct ModularizationInfo {
-        bool isModule = false;
-        std::set<ElementId> elements;
-        std::set<storm::dft::storage::DftIndependentModule> submodules;
-        bool isStatic = true;
-        bool fullyStatic = true;
-    };
 
-    std::map<ElementId, DfsCounter> dfsCounters{};
-    std::map<ElementId, ModularizationInfo> modInfos{};
+    // All vectors are indexed by the element ids.
+    std::vector<DfsCounter> dfsCounters{};
+    std::vector<std::vector<DFTElementCPointer>> children{};
+    std::vector<bool> isModule{};
+    // Module representatives in post-order.
+    std::vector<ElementId> moduleRepresentatives{};
+    // Modules which were built but not yet added as sub-module.
+    std::map<ElementId, storm::dft::storage::DftIndependentModule> builtModules{};
     uint64_t lastDate{};
 };
 
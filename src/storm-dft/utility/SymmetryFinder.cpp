@@ -2,6 +2,7 @@
 
 #include "storm-dft/storage/DFTIsomorphism.h"
 
+#include "storm/adapters/IntelTbbAdapter.h"
 #include "storm/utility/iota_n.h"
 
 namespace storm::dft {
@@ -139,53 +140,63 @@ void SymmetryFinder<ValueType>::findSymmetriesHelper(storm::dft::storage::DFT<Va
         return;
     }
 
-    std::set<size_t> foundEqClassFor;
-    for (auto it1 = candidates.cbegin(); it1 != candidates.cend(); ++it1) {
-        std::vector<std::vector<size_t>> symClass;
-        if (foundEqClassFor.count(*it1) > 0) {
-            // This item is already in a class.
-            continue;
-        }
-        auto elem1 = dft.getElement(*it1);
-        if (!elem1->hasOnlyStaticParents()) {
-            continue;
-        }
-        if (hasSeqRestriction(elem1)) {
+    // Group the candidates by the elements influencing them. Only candidates within the same group can be symmetric.
+    // Elements with dynamic parents or sequence restrictions are not considered at all.
+    std::map<std::tuple<std::vector<size_t>, std::vector<size_t>, std::vector<size_t>, std::vector<size_t>>, std::vector<size_t>> candidateGroups;
+    for (size_t candidate : candidates) {
+        auto elem = dft.getElement(candidate);
+        if (!elem->hasOnlyStaticParents() || hasSeqRestriction(elem)) {
             continue;
         }
+        candidateGroups[getInfluencedIds(dft, candidate)].push_back(candidate);
+    }
 
-        std::tuple<std::vector<size_t>, std::vector<size_t>, std::vector<size_t>, std::vector<size_t>> influencedElem1Ids = getInfluencedIds(dft, *it1);
-        auto it2 = it1;
-        for (++it2; it2 != candidates.cend(); ++it2) {
-            auto elem2 = dft.getElement(*it2);
-            if (!elem2->hasOnlyStaticParents()) {
+    std::set<size_t> foundEqClassFor;
+    for (auto const& group : candidateGroups) {
+        std::vector<size_t> const& groupCandidates = group.second;
+        for (size_t i = 0; i + 1 < groupCandidates.size(); ++i) {
+            if (foundEqClassFor.count(groupCandidates[i]) > 0) {
+                // This item is already in a class.
                 continue;
             }
-            if (hasSeqRestriction(elem2)) {
-                continue;
+
+            // Search bijections to all later candidates of the group. The checks are independent of each other.
+            size_t const nrPartners = groupCandidates.size() - i - 1;
+            std::vector<std::map<size_t, size_t>> bijections(nrPartners);
+#ifdef STORM_HAVE_INTELTBB
+            tbb::parallel_for(tbb::blocked_range<size_t>(0, nrPartners), [&](tbb::blocked_range<size_t> const& range) {
+                for (size_t j = range.begin(); j < range.end(); ++j) {
+                    bijections[j] = findBijection(dft, groupCandidates[i], groupCandidates[i + 1 + j], colouring, true);
+                }
+            });
+#else
+            for (size_t j = 0; j < nrPartners; ++j) {
+                bijections[j] = findBijection(dft, groupCandidates[i], groupCandidates[i + 1 + j], colouring, true);
             }
+#endif
 
-            if (influencedElem1Ids == getInfluencedIds(dft, *it2)) {
-                std::map<size_t, size_t> bijection = findBijection(dft, *it1, *it2, colouring, true);
+            std::vector<std::vector<size_t>> symClass;
+            for (size_t j = 0; j < nrPartners; ++j) {
+                std::map<size_t, size_t> const& bijection = bijections[j];
                 if (!bijection.empty()) {
                     STORM_LOG_TRACE("Subdfts are symmetric");
-                    foundEqClassFor.insert(*it2);
+                    foundEqClassFor.insert(groupCandidates[i + 1 + j]);
                     if (symClass.empty()) {
-                        for (auto const& i : bijection) {
-                            symClass.push_back(std::vector<size_t>({i.first}));
+                        for (auto const& elem : bijection) {
+                            symClass.push_back(std::vector<size_t>({elem.first}));
                         }
                     }
                     auto symClassIt = symClass.begin();
-                    for (auto const& i : bijection) {
-                        symClassIt->emplace_back(i.second);
+                    for (auto const& elem : bijection) {
+                        symClassIt->emplace_back(elem.second);
                         ++symClassIt;
                     }
                 }
             }
-        }
 
-        if (!symClass.empty()) {
-            result.emplace(*it1, symClass);
+            if (!symClass.empty()) {
+                result.emplace(groupCandidates[i], symClass);
+            }
         }
     }
 }
@@ -81,6 +81,7 @@ void CommandAbstractor<DdType, ValueType>::refine(std::vector<uint_fast64_t> con
     bool relevantPredicatesChanged = this->relevantPredicatesChanged(newRelevantPredicates);
     if (relevantPredicatesChanged) {
         addMissingPredicates(newRelevantPredicates);
+        enumeratedSolutions.reset();
     }
     forceRecomputation |= relevantPredicatesChanged;
 
@@ -456,12 +457,22 @@ void CommandAbstractor<DdType, ValueType>::recomputeCachedBddWithoutDecompositio
     // Create a mapping from source state DDs to their distributions.
     std::unordered_map<storm::dd::Bdd<DdType>, std::vector<storm::dd::Bdd<DdType>>> sourceToDistributionsMap;
     uint64_t numberOfSolutions = 0;
-    smtSolver->allSat(decisionVariables, [&sourceToDistributionsMap, this, &numberOfSolutions](storm::solver::SmtSolver::ModelReference const& model) {
-        sourceToDistributionsMap[getSourceStateBdd(model, relevantPredicatesAndVariables.first)].push_back(
-            getDistributionBdd(model, relevantPredicatesAndVariables.second));
-        ++numberOfSolutions;
-        return true;
-    });
+    if (enumeratedSolutions) {
+        // The solutions were already enumerated (possibly concurrently to other commands), so we only need to translate them.
+        for (auto const& valuation : *enumeratedSolutions) {
+            sourceToDistributionsMap[getSourceStateBdd(valuation, relevantPredicatesAndVariables.first)].push_back(
+                getDistributionBdd(valuation, relevantPredicatesAndVariables.second));
+        }
+        numberOfSolutions = enumeratedSolutions->size();
+        enumeratedSolutions.reset();
+    } else {
+        smtSolver->allSat(decisionVariables, [&sourceToDistributionsMap, this, &numberOfSolutions](storm::solver::SmtSolver::ModelReference const& model) {
+            sourceToDistributionsMap[getSourceStateBdd(model, relevantPredicatesAndVariables.first)].push_back(
+                getDistributionBdd(model, relevantPredicatesAndVariables.second));
+            ++numberOfSolutions;
+            return true;
+        });
+    }
 
     // Now we search for the maximal number of choices of player 2 to determine how many DD variables we
     // need to encode the nondeterminism.
@@ -623,8 +634,9 @@ void CommandAbstractor<DdType, ValueType>::addMissingPredicates(
 }
 
 template<storm::dd::DdType DdType, typename ValueType>
+template<typename ModelType>
 storm::dd::Bdd<DdType> CommandAbstractor<DdType, ValueType>::getSourceStateBdd(
-    storm::solver::SmtSolver::ModelReference const& model,
+    ModelType const& model,
     std::vector<std::pair<storm::expressions::Variable, uint_fast64_t>> const& variablePredicates) const {
     storm::dd::Bdd<DdType> result = this->getAbstractionInformation().getDdManager().getBddOne();
     for (auto variableIndexPairIt = variablePredicates.rbegin(), variableIndexPairIte = variablePredicates.rend(); variableIndexPairIt != variableIndexPairIte;
@@ -642,8 +654,9 @@ storm::dd::Bdd<DdType> CommandAbstractor<DdType, ValueType>::getSourceStateBdd(
 }
 
 template<storm::dd::DdType DdType, typename ValueType>
+template<typename ModelType>
 storm::dd::Bdd<DdType> CommandAbstractor<DdType, ValueType>::getDistributionBdd(
-    storm::solver::SmtSolver::ModelReference const& model,
+    ModelType const& model,
     std::vector<std::vector<std::pair<storm::expressions::Variable, uint_fast64_t>>> const& variablePredicates) const {
     storm::dd::Bdd<DdType> result = this->getAbstractionInformation().getDdManager().getBddZero();
 
@@ -696,6 +709,14 @@ storm::dd::Bdd<DdType> CommandAbstractor<DdType, ValueType>::computeMissingUpdat
     return result;
 }
 
+template<storm::dd::DdType DdType, typename ValueType>
+void CommandAbstractor<DdType, ValueType>::enumerateSolutions() {
+    if (!forceRecomputation || useDecomposition || enumeratedSolutions) {
+        return;
+    }
+    enumeratedSolutions = smtSolver->allSat(decisionVariables);
+}
+
 template<storm::dd::DdType DdType, typename ValueType>
 GameBddResult<DdType> CommandAbstractor<DdType, ValueType>::abstract() {
     if (forceRecomputation) {
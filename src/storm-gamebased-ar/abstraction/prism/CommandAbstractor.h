@@ -2,6 +2,7 @@
 
 #include <map>
 #include <memory>
+#include <optional>
 #include <set>
 #include <vector>
 
@@ -13,6 +14,7 @@
 
 #include "storm/storage/dd/DdType.h"
 #include "storm/storage/expressions/Expression.h"
+#include "storm/storage/expressions/SimpleValuation.h"
 
 #include "storm/solver/SmtSolver.h"
 
@@ -98,6 +100,14 @@ class CommandAbstractor {
      */
     GameBddResult<DdType> abstract();
 
+    /*!
+     * If the abstraction of the command needs to be recomputed, this enumerates the abstract transitions with the SMT solver without
+     * translating them to DDs yet. The next call to abstract() then only needs to build the DD from the enumerated solutions. As this
+     * only involves the SMT solver owned by this command, it may be called concurrently for different commands, provided the expression
+     * manager does not use hash-consing. This has no effect if the decomposition is used.
+     */
+    void enumerateSolutions();
+
     /*!
      * Retrieves the transitions to bottom states of this command.
      *
@@ -163,7 +173,8 @@ class CommandAbstractor {
      * @param model The model to translate.
      * @return The source state encoded as a DD.
      */
-    storm::dd::Bdd<DdType> getSourceStateBdd(storm::solver::SmtSolver::ModelReference const& model,
+    template<typename ModelType>
+    storm::dd::Bdd<DdType> getSourceStateBdd(ModelType const& model,
                                              std::vector<std::pair<storm::expressions::Variable, uint_fast64_t>> const& variablePredicates) const;
 
     /*!
@@ -172,7 +183,8 @@ class CommandAbstractor {
      * @param model The model to translate.
      * @return The source state encoded as a DD.
      */
-    storm::dd::Bdd<DdType> getDistributionBdd(storm::solver::SmtSolver::ModelReference const& model,
+    template<typename ModelType>
+    storm::dd::Bdd<DdType> getDistributionBdd(ModelType const& model,
                                               std::vector<std::vector<std::pair<storm::expressions::Variable, uint_fast64_t>>> const& variablePredicates) const;
 
     /*!
@@ -265,6 +277,9 @@ class CommandAbstractor {
     // A flag remembering whether we need to force recomputation of the BDD.
     bool forceRecomputation;
 
+    // The solutions enumerated by enumerateSolutions() that are yet to be translated to a DD (if any).
+    std::optional<std::vector<storm::expressions::SimpleValuation>> enumeratedSolutions;
+
     // The abstract guard of the command. This is only used if the guard is not a predicate, because it can
     // then be used to constrain the bottom state abstractor.
     storm::dd::Bdd<DdType> abstractGuard;
@@ -12,6 +12,7 @@
 #include "storm/settings/SettingsManager.h"
 
 #include "storm-config.h"
+#include "storm/adapters/IntelTbbAdapter.h"
 #include "storm/adapters/RationalFunctionAdapter.h"
 
 #include "storm/utility/macros.h"
@@ -64,7 +65,21 @@ std::set<storm::expressions::Variable> const& ModuleAbstractor<DdType, ValueType
 
 template<storm::dd::DdType DdType, typename ValueType>
 GameBddResult<DdType> ModuleAbstractor<DdType, ValueType>::abstract() {
-    // First, we retrieve the abstractions of all commands.
+    // The expensive part of abstracting a command is the SMT-based enumeration. As every command owns its solver, the commands whose
+    // relevant predicates changed can be enumerated concurrently. This is not possible with hash-consing, as then creating expressions
+    // (which the solvers do when retrieving models) modifies the expression manager. The DD manager is not thread safe, so the DDs are
+    // built sequentially afterwards.
+#ifdef STORM_HAVE_INTELTBB
+    if (!this->getAbstractionInformation().getExpressionManager().isHashConsingEnabled()) {
+        tbb::parallel_for(tbb::blocked_range<uint_fast64_t>(0, commands.size()), [this](tbb::blocked_range<uint_fast64_t> const& range) {
+            for (uint_fast64_t index = range.begin(); index < range.end(); ++index) {
+                commands[index].enumerateSolutions();
+            }
+        });
+    }
+#endif
+
+    // Then, we retrieve the abstractions of all commands.
     std::vector<GameBddResult<DdType>> commandDdsAndUsedOptionVariableCounts;
     uint_fast64_t maximalNumberOfUsedOptionVariables = 0;
     for (auto& command : commands) {
@@ -73,7 +88,7 @@ GameBddResult<DdType> ModuleAbstractor<DdType, ValueType>::abstract() {
             std::max(maximalNumberOfUsedOptionVariables, commandDdsAndUsedOptionVariableCounts.back().numberOfPlayer2Variables);
     }
 
-    // Then, we build the module BDD by adding the single command DDs. We need to make sure that all command
+    // Finally, we build the module BDD by adding the single command DDs. We need to make sure that all command
     // DDs use the same amount DD variable encoding the choices of player 2.
     storm::dd::Bdd<DdType> result = this->getAbstractionInformation().getDdManager().getBddZero();
     for (auto const& commandDd : commandDdsAndUsedOptionVariableCounts) {
@@ -96,10 +96,12 @@ void processOptions() {
 
     storm::api::handleGSPNExportSettings(*gspn, [&](storm::builder::JaniGSPNBuilder const&) { return properties; });
 
-    //        // construct ma
-    //        auto builder = storm::builder::ExplicitGspnModelBuilder<>();
-    //        auto ma = builder.translateGspn(gspn, formula);
-    //
+    if (gspnSettings.isBuildExplicitSet()) {
+        storm::builder::ExplicitGspnModelBuilder<double>::Options options;
+        options.numberOfThreads = gspnSettings.getNumberOfExplorationThreads();
+        auto model = storm::api::buildExplicitModel(*gspn, options);
+        model->printModelInformationToStream(std::cout);
+    }
 
     delete gspn;
 }
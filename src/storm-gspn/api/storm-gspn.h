@@ -2,6 +2,7 @@
 
 #include <unordered_map>
 
+#include "storm-gspn/builder/ExplicitGspnModelBuilder.h"
 #include "storm-gspn/builder/JaniGSPNBuilder.h"
 #include "storm-gspn/storage/gspn/GSPN.h"
 #include "storm/storage/jani/Model.h"
@@ -14,6 +15,12 @@ namespace api {
  */
 storm::jani::Model* buildJani(storm::gspn::GSPN const& gspn);
 
+/**
+ *    Builds the explicit model (CTMC, MDP or MA) directly from the GSPN, i.e., without the translation to JANI.
+ */
+std::shared_ptr<storm::models::sparse::Model<double>> buildExplicitModel(storm::gspn::GSPN const& gspn,
+                                                                         storm::builder::ExplicitGspnModelBuilder<double>::Options const& options);
+
 void handleGSPNExportSettings(
     storm::gspn::GSPN const& gspn, std::function<std::vector<storm::jani::Property>(storm::builder::JaniGSPNBuilder const&)> const& janiProperyGetter =
                                        [](storm::builder::JaniGSPNBuilder const&) { return std::vector<storm::jani::Property>(); });
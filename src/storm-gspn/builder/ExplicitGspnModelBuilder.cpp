@@ -1,332 +1,377 @@
-// #include "storm/builder/ExplicitGspnModelBuilder.h"
-//
-// #include "storm/models/sparse/StandardRewardModel.h"
-//
-// #include "storm/utility/macros.h"
-// #include "storm/exceptions/NotImplementedException.h"
-// #include "storm/storage/expressions/ExpressionManager.h"
-// #include "storm-parsers/parser/FormulaParser.h"
-// #include "storm/storage/expressions/ExpressionEvaluator.h"
-//
-//  namespace storm {
-//     namespace builder {
-//
-//         template<typename ValueType>
-//         storm::models::sparse::MarkovAutomaton<ValueType> ExplicitGspnModelBuilder<ValueType>::translateGspn(storm::gspn::GSPN const& gspn, std::string
-//         const& formula) {
-//             // set the given gspn and compute the limits of the net
-//             this->gspn = gspn;
-//             computeCapacities(gspn);
-//
-//             // markings maps markings to their corresponding rowgroups (indices)
-//             markings = storm::storage::BitVectorHashMap<uint_fast64_t>(numberOfTotalBits, 100);
-//             builder = storm::storage::SparseMatrixBuilder<double>(0, 0, 0, false, true);
-//
-//             // add initial marking to todo list
-//             auto bitvector = gspn.getInitialMarking(numberOfBits, numberOfTotalBits)->getBitVector();
-//             findOrAddBitvectorToMarkings(*bitvector);
-//             currentRowIndex = 0;
-//
-//             // vector marking markovian states (vector contains an 1 if the state is markovian)
-//             storm::storage::BitVector markovianStates(0);
-//
-//             // vector containing the exit rates for the markovian states
-//             std::vector<ValueType> exitRates;
-//
-//
-//             while (!todo.empty()) {
-//                 // take next element from the todo list
-//                 auto currentBitvector = todo.front();
-//                 todo.pop_front();
-//                 auto currentMarking = storm::gspn::Marking(gspn.getNumberOfPlaces(), numberOfBits, *currentBitvector);
-//
-//                 // increment list of states by one
-//                 markovianStates.resize(markovianStates.size() + 1, 0);
-//
-//                 // create new row group for the current marking
-//                 builder.newRowGroup(markings.getValue(*currentBitvector));
-//
-//                 std::cout << "work on: " << *currentBitvector << '\n';
-//
-//                 auto enabledImmediateTransitions = getEnabledImmediateTransition(currentMarking);
-//                 if (!enabledImmediateTransitions.empty()) {
-//                     markovianStates.set(currentRowIndex, 0);
-//                     exitRates.push_back(0);
-//
-//                     auto partitions = partitonEnabledImmediateTransitions(currentMarking, enabledImmediateTransitions);
-//                     addRowForPartitions(partitions, currentMarking);
-//                 } else {
-//
-//                     auto enabledTimedTransitions = getEnabledTimedTransition(currentMarking);
-//                     if (!enabledTimedTransitions.empty()) {
-//                         markovianStates.set(currentRowIndex, 1);
-//
-//                         auto accRate = getAccumulatedRate(enabledTimedTransitions);
-//                         std::cout << "\t\tacc. rate: " << accRate << '\n';
-//                         exitRates.push_back(accRate);
-//
-//                         addRowForTimedTransitions(enabledTimedTransitions, currentMarking, accRate);
-//                     } else {
-//                         markovianStates.set(currentRowIndex, 1);
-//                     }
-//                 }
-//                 ++currentRowIndex;
-//             }
-//
-//             auto matrix = builder.build();
-//
-//             // create expression manager and add variables from the gspn
-//             auto expressionManager = std::make_shared<storm::expressions::ExpressionManager>();
-//             for (auto& place : gspn.getPlaces()) {
-//                 expressionManager->declareIntegerVariable(place.getName());
-//             }
-//
-//             // parse formula
-//             storm::parser::FormulaParser formulaParser(expressionManager);
-//             auto formulaPtr = formulaParser.parseSingleFormulaFromString(formula);
-//             auto atomicFormulas = formulaPtr->getAtomicExpressionFormulas();
-//
-//             // create empty state labeling
-//             storm::models::sparse::StateLabeling labeling(markings.size());
-//             storm::expressions::ExpressionEvaluator<double> expressionEvaluator(*expressionManager);
-//
-//             std::cout << '\n';
-//             std::cout << "build labeling:\n";
-//             for (auto& atomicFormula : atomicFormulas) {
-//                 std::cout << atomicFormula;
-//                 auto label = atomicFormula->toString();
-//                 labeling.addLabel(label);
-//
-//                 for (auto statePair : markings) {
-//                     auto marking = storm::gspn::Marking(gspn.getNumberOfPlaces(), numberOfBits, statePair.first);
-//                     for (auto& place : gspn.getPlaces()) {
-//                         auto variable = expressionManager->getVariable(place.getName());
-//                         expressionEvaluator.setIntegerValue(variable, marking.getNumberOfTokensAt(place.getID()));
-//                     }
-//                     bool hold = expressionEvaluator.asBool(atomicFormula->getExpression());
-//                     if (hold) {
-//                         labeling.addLabelToState(label, statePair.second);
-//                     }
-//                 }
-//
-//             }
-//
-//             //auto labeling = getStateLabeling();
-//
-//             return storm::models::sparse::MarkovAutomaton<double>(matrix, labeling, markovianStates, exitRates);
-//         }
-//
-//         template<typename ValueType>
-//         void ExplicitGspnModelBuilder<ValueType>::addRowForPartitions(std::vector<std::vector<std::shared_ptr<storm::gspn::ImmediateTransition<double>>>>
-//         const& partitions, storm::gspn::Marking const& currentMarking) {
-//             for (auto& partition : partitions) {
-//                 std::cout << "\tnew partition:\n";
-//                 auto accWeight = getAccumulatedWeight(partition);
-//                 std::cout << "\t\tacc. weight: " << accWeight << '\n';
-//
-//                 std::map<uint_fast64_t , double, storm::builder::ExplicitGspnModelBuilder<ValueType>::cmpByIndex> weights;
-//                 for (auto& trans : partition) {
-//                     std::cout << "\t\ttransname: " << trans.getName() << '\n';
-//                     auto newMarking = trans.fire(currentMarking);
-//                     std::cout << "\t\t\t target marking: " << *newMarking.getBitVector() << '\n';
-//
-//                     findOrAddBitvectorToMarkings(*newMarking.getBitVector());
-//
-//                     auto it = weights.find(markings.getValue(*newMarking.getBitVector()));
-//                     double currentWeight = 0;
-//                     if (it != weights.end()) {
-//                         currentWeight = weights.at(markings.getValue(*newMarking.getBitVector()));
-//                     }
-//                     currentWeight += trans.getWeight() / accWeight;
-//                     weights[markings.getValue(*newMarking.getBitVector())] = currentWeight;
-//                 }
-//
-//                 addValuesToBuilder(weights);
-//             }
-//         }
-//
-//         template<typename ValueType>
-//         void ExplicitGspnModelBuilder<ValueType>::addRowForTimedTransitions(std::vector<std::shared_ptr<storm::gspn::TimedTransition<double>>> const&
-//         enabledTimedTransitions, storm::gspn::Marking const& currentMarking, double const& accRate) {
-//             std::map<uint_fast64_t , double, storm::builder::ExplicitGspnModelBuilder<ValueType>::cmpByIndex> rates;
-//             for (auto& trans : enabledTimedTransitions) {
-//                 std::cout << "\t\ttransname: " << trans.getName() << '\n';
-//                 auto newMarking = trans.fire(currentMarking);
-//                 std::cout << "\t\t\t target marking: " << *newMarking.getBitVector() << '\n';
-//
-//                 findOrAddBitvectorToMarkings(*newMarking.getBitVector());
-//
-//                 auto it = rates.find(markings.getValue(*newMarking.getBitVector()));
-//                 double currentWeightRate = 0;
-//                 if (it != rates.end()) {
-//                     currentWeightRate = rates.at(markings.getValue(*newMarking.getBitVector()));
-//                 }
-//                 currentWeightRate += trans.getRate() / accRate;
-//                 rates[markings.getValue(*newMarking.getBitVector())] = currentWeightRate;
-//
-//             }
-//
-//             addValuesToBuilder(rates);
-//         }
-//
-//         template<typename ValueType>
-//         void ExplicitGspnModelBuilder<ValueType>::addValuesToBuilder(std::map<uint_fast64_t , double,
-//         storm::builder::ExplicitGspnModelBuilder<ValueType>::cmpByIndex> const& values) {
-//             for (auto& it : values) {
-//                 std::cout << "\t\tadd value \"" << it.second << "\" to " << getBitvector(it.first) << '\n';
-//                 builder.addNextValue(currentRowIndex, it.first, it.second);
-//             }
-//         }
-//
-//         template<typename ValueType>
-//         std::vector<std::vector<std::shared_ptr<storm::gspn::ImmediateTransition<double>>>>
-//         ExplicitGspnModelBuilder<ValueType>::partitonEnabledImmediateTransitions(
-//                 storm::gspn::Marking const& marking,
-//                 std::vector<std::shared_ptr<storm::gspn::ImmediateTransition<double>>> const& enabledImmediateTransitions) {
-//             decltype(partitonEnabledImmediateTransitions(marking, enabledImmediateTransitions)) result;
-//
-//             std::vector<std::shared_ptr<storm::gspn::ImmediateTransition<double>>> weightedTransitions;
-//
-//             for (auto& trans : enabledImmediateTransitions) {
-//                 if (trans.noWeightAttached()) {
-//                     decltype(weightedTransitions) singleton;
-//                     singleton.push_back(trans);
-//                     result.push_back(singleton);
-//                 } else {
-//                     weightedTransitions.push_back(trans);
-//                 }
-//             }
-//
-//             if (weightedTransitions.size() != 0) {
-//                 result.push_back(weightedTransitions);
-//             }
-//
-//             return result;
-//         }
-//
-//         template<typename ValueType>
-//         double ExplicitGspnModelBuilder<ValueType>::getAccumulatedWeight(std::vector<std::shared_ptr<storm::gspn::ImmediateTransition<double>>> const&
-//         vector) const {
-//             double result = 0;
-//
-//             for (auto &trans : vector) {
-//                 result += trans.getWeight();
-//             }
-//
-//             return result;
-//         }
-//
-//         template<typename ValueType>
-//         void ExplicitGspnModelBuilder<ValueType>::computeCapacities(storm::gspn::GSPN const& gspn) {
-//             uint_fast64_t sum = 0;
-//             for (auto& place : gspn.getPlaces()) {//TODO
-//                 numberOfBits[place.getID()] = 1;
-//                 sum += numberOfBits[place.getID()];
-//             }
-//
-//             // compute next multiple of 64
-//             uint_fast64_t rem = sum % 64;
-//             numberOfTotalBits = sum + 64 - rem;
-//         }
-//
-//         template<typename ValueType>
-//         std::vector<std::shared_ptr<storm::gspn::TimedTransition<double>>> ExplicitGspnModelBuilder<ValueType>::getEnabledTimedTransition(
-//                 storm::gspn::Marking const& marking) {
-//             std::vector<std::shared_ptr<storm::gspn::TimedTransition<double>>>result;
-//
-//             uint_fast64_t highestSeenPriority = 0;
-//
-//             for (auto& trans : gspn.getTimedTransitions()) {
-//                 if (trans.isEnabled(marking)) {
-//                     if (trans.getPriority() > highestSeenPriority) {
-//                         highestSeenPriority = trans.getPriority();
-//                         result.clear();
-//                     }
-//                     result.push_back(trans);
-//                 }
-//             }
-//
-//             return result;
-//         }
-//
-//         template<typename ValueType>
-//         std::vector<std::shared_ptr<storm::gspn::ImmediateTransition<double>>> ExplicitGspnModelBuilder<ValueType>::getEnabledImmediateTransition(
-//                 storm::gspn::Marking const& marking) {
-//             std::vector<std::shared_ptr<storm::gspn::ImmediateTransition<double>>>result;
-//
-//             uint_fast64_t highestSeenPriority = 0;
-//
-//             for (auto& trans : gspn.getImmediateTransitions()) {
-//                 if (trans.isEnabled(marking)) {
-//                     if (trans.getPriority() > highestSeenPriority) {
-//                         highestSeenPriority = trans.getPriority();
-//                         result.clear();
-//                     }
-//                     result.push_back(trans);
-//                 }
-//             }
-//
-//             return result;
-//         }
-//
-//         template<typename ValueType>
-//         double ExplicitGspnModelBuilder<ValueType>::getAccumulatedRate(std::vector<std::shared_ptr<storm::gspn::TimedTransition<double>>> const& vector) {
-//             double result = 0;
-//             for (auto trans : vector) {
-//                 result += trans.getRate();
-//             }
-//
-//             return result;
-//         }
-//
-//         template<typename ValueType>
-//         storm::storage::BitVector ExplicitGspnModelBuilder<ValueType>::getBitvector(uint_fast64_t const& index) {
-//             for (auto it = markings.begin(); it != markings.end(); ++it) {
-//                 if (std::get<1>(*it) == index) {
-//                     return std::get<0>(*it);
-//                 }
-//             }
-//             return storm::storage::BitVector();
-//         }
-//
-//         template<typename ValueType>
-//         uint_fast64_t ExplicitGspnModelBuilder<ValueType>::findOrAddBitvectorToMarkings(storm::storage::BitVector const &bitvector) {
-//             auto index = markings.findOrAdd(bitvector, nextRowGroupIndex);
-//
-//             if (index == nextRowGroupIndex) {
-//                 // bitvector was not already in the map
-//                 ++nextRowGroupIndex;
-//                 // bitvector was also never in the todo list
-//                 todo.push_back(std::make_shared<storm::storage::BitVector>(bitvector));
-//             }
-//             return index;
-//         }
-//
-//         template<typename ValueType>
-//         storm::models::sparse::StateLabeling ExplicitGspnModelBuilder<ValueType>::getStateLabeling() const {
-//             storm::models::sparse::StateLabeling labeling(markings.size());
-//
-//             std::map<uint_fast64_t , std::string> idToName;
-//             for (auto& place : gspn.getPlaces()) {
-//                 idToName[place.getID()] = place.getName();
-//                 labeling.addLabel(place.getName());
-//             }
-//
-//             auto it = markings.begin();
-//             for ( ; it != markings.end() ; ++it) {
-//                 auto bitvector = std::get<0>(*it);
-//                 storm::gspn::Marking marking(gspn.getNumberOfPlaces(), numberOfBits, bitvector);
-//                 for (auto i = 0; i < marking.getNumberOfPlaces(); i++) {
-//                     if (marking.getNumberOfTokensAt(i) > 0) {
-//                         std::cout << i << '\n';
-//                         labeling.addLabelToState(idToName.at(i), i);
-//                     }
-//                 }
-//             }
-//
-//             return labeling;
-//         }
-//
-//         template class ExplicitGspnModelBuilder<double>;
-//     }
-// }
+#include "storm-gspn/builder/ExplicitGspnModelBuilder.h"
+
+#include <algorithm>
+#include <deque>
+#include <limits>
+
+#include "storm/adapters/IntelTbbAdapter.h"
+#include "storm/exceptions/AbortException.h"
+#include "storm/exceptions/InvalidArgumentException.h"
+#include "storm/exceptions/InvalidModelException.h"
+#include "storm/storage/SparseMatrix.h"
+#include "storm/storage/expressions/ExpressionEvaluator.h"
+#include "storm/storage/expressions/ExpressionManager.h"
+#include "storm/storage/sparse/ModelComponents.h"
+#include "storm/utility/SignalHandler.h"
+#include "storm/utility/builder.h"
+#include "storm/utility/constants.h"
+#include "storm/utility/macros.h"
+
+namespace storm {
+namespace builder {
+
+template<typename ValueType>
+ExplicitGspnModelBuilder<ValueType>::ExplicitGspnModelBuilder(storm::gspn::GSPN const& gspn, Options const& options) : gspn(gspn), options(options) {
+    STORM_LOG_THROW(options.numberOfThreads > 0, storm::exceptions::InvalidArgumentException, "At least one thread is required for the exploration.");
+    STORM_LOG_THROW(options.bitsForUnboundedPlaces > 0 && options.bitsForUnboundedPlaces < 64, storm::exceptions::InvalidArgumentException,
+                    "The number of bits for unbounded places must be in [1,63].");
+#ifndef STORM_HAVE_INTELTBB
+    STORM_LOG_WARN_COND(options.numberOfThreads == 1, "Parallel exploration requires Intel TBB. The state space is explored sequentially.");
+#endif
+    if (gspn.getNumberOfTimedTransitions() == 0) {
+        modelType = storm::models::ModelType::Mdp;
+    } else if (gspn.getNumberOfImmediateTransitions() == 0) {
+        modelType = storm::models::ModelType::Ctmc;
+    } else {
+        modelType = storm::models::ModelType::MarkovAutomaton;
+    }
+    compile();
+}
+
+template<typename ValueType>
+void ExplicitGspnModelBuilder<ValueType>::compile() {
+    numberOfTotalBits = 0;
+    placeEncodings.resize(gspn.getNumberOfPlaces());
+    for (auto const& place : gspn.getPlaces()) {
+        auto& encoding = placeEncodings[place.getID()];
+        if (place.hasRestrictedCapacity()) {
+            encoding.bits = 1;
+            while (encoding.bits < 64 && (uint64_t(1) << encoding.bits) <= place.getCapacity()) {
+                ++encoding.bits;
+            }
+            encoding.maxTokens = place.getCapacity();
+        } else {
+            encoding.bits = options.bitsForUnboundedPlaces;
+            encoding.maxTokens = (uint64_t(1) << encoding.bits) - 1;
+        }
+        encoding.offset = numberOfTotalBits;
+        numberOfTotalBits += encoding.bits;
+    }
+    // The hash map requires a non-empty bucket
+    numberOfTotalBits = std::max<uint64_t>(numberOfTotalBits, 1);
+
+    // The partitions are sorted by decreasing priority
+    uint64_t lastPriority = 0;
+    for (auto const& partition : gspn.getPartitions()) {
+        if (immediateTransitionsByPriority.empty() || partition.priority != lastPriority) {
+            STORM_LOG_ASSERT(immediateTransitionsByPriority.empty() || partition.priority < lastPriority, "Partitions are not sorted by priority.");
+            immediateTransitionsByPriority.emplace_back();
+            lastPriority = partition.priority;
+        }
+        std::vector<CompiledTransition> compiledPartition;
+        for (auto const& transitionId : partition.transitions) {
+            auto const& transition = gspn.getImmediateTransitions()[transitionId];
+            if (transition.noWeightAttached()) {
+                STORM_LOG_WARN("Immediate transition " << transition.getName() << " has no weight attached. Skipping this transition.");
+                continue;
+            }
+            compiledPartition.push_back(compileTransition(transition, transition.getWeight()));
+        }
+        immediateTransitionsByPriority.back().push_back(std::move(compiledPartition));
+    }
+
+    for (auto const& transition : gspn.getTimedTransitions()) {
+        if (storm::utility::isZero(transition.getRate())) {
+            STORM_LOG_WARN("Timed transition " << transition.getName() << " has rate zero. Skipping this transition.");
+            continue;
+        }
+        auto compiledTransition = compileTransition(transition, transition.getRate());
+        if (transition.hasInfiniteServerSemantics()) {
+            STORM_LOG_THROW(!transition.getInputPlaces().empty(), storm::exceptions::InvalidModelException,
+                            "Unclear semantics: Found a transition with infinite-server semantics and without input place.");
+            compiledTransition.servers = 0;
+        } else {
+            compiledTransition.servers = transition.getNumberOfServers();
+        }
+        timedTransitions.push_back(std::move(compiledTransition));
+    }
+}
+
+template<typename ValueType>
+typename ExplicitGspnModelBuilder<ValueType>::CompiledTransition ExplicitGspnModelBuilder<ValueType>::compileTransition(
+    storm::gspn::Transition const& transition, ValueType value) const {
+    CompiledTransition result;
+    result.name = transition.getName();
+    result.value = value;
+    for (auto const& [place, multiplicity] : transition.getInputPlaces()) {
+        result.inputs.push_back({place, multiplicity});
+    }
+    for (auto const& [place, multiplicity] : transition.getInhibitionPlaces()) {
+        result.inhibitors.push_back({place, multiplicity});
+    }
+    // Merge input and output arcs into the effective change of tokens
+    for (auto const& [place, multiplicity] : transition.getInputPlaces()) {
+        auto const output = transition.getOutputPlaces().find(place);
+        int64_t delta = -static_cast<int64_t>(multiplicity);
+        if (output != transition.getOutputPlaces().end()) {
+            delta += static_cast<int64_t>(output->second);
+        }
+        if (delta != 0) {
+            result.changes.push_back({place, delta});
+        }
+    }
+    for (auto const& [place, multiplicity] : transition.getOutputPlaces()) {
+        if (transition.getInputPlaces().count(place) == 0) {
+            result.changes.push_back({place, static_cast<int64_t>(multiplicity)});
+        }
+    }
+    // Sort the arcs by place to access the packed marking in order
+    auto const comparePlaces = [](auto const& lhs, auto const& rhs) { return lhs.place < rhs.place; };
+    std::sort(result.inputs.begin(), result.inputs.end(), comparePlaces);
+    std::sort(result.inhibitors.begin(), result.inhibitors.end(), comparePlaces);
+    std::sort(result.changes.begin(), result.changes.end(), comparePlaces);
+    return result;
+}
+
+template<typename ValueType>
+uint64_t ExplicitGspnModelBuilder<ValueType>::getTokens(storm::storage::BitVector const& marking, uint64_t place) const {
+    auto const& encoding = placeEncodings[place];
+    return marking.getAsInt(encoding.offset, encoding.bits);
+}
+
+template<typename ValueType>
+bool ExplicitGspnModelBuilder<ValueType>::isEnabled(CompiledTransition const& transition, storm::storage::BitVector const& marking) const {
+    for (auto const& arc : transition.inputs) {
+        if (getTokens(marking, arc.place) < arc.multiplicity) {
+            return false;
+        }
+    }
+    for (auto const& arc : transition.inhibitors) {
+        if (getTokens(marking, arc.place) >= arc.multiplicity) {
+            return false;
+        }
+    }
+    return true;
+}
+
+template<typename ValueType>
+storm::storage::BitVector ExplicitGspnModelBuilder<ValueType>::fire(CompiledTransition const& transition, storm::storage::BitVector const& marking) const {
+    storm::storage::BitVector result(marking);
+    for (auto const& change : transition.changes) {
+        auto const& encoding = placeEncodings[change.place];
+        // The tokens cannot become negative as the transition is enabled
+        uint64_t const tokens = result.getAsInt(encoding.offset, encoding.bits) + change.delta;
+        STORM_LOG_THROW(tokens <= encoding.maxTokens, storm::exceptions::InvalidModelException,
+                        "Firing transition " << transition.name << " exceeds the capacity " << encoding.maxTokens << " of place "
+                                             << gspn.getPlace(change.place)->getName() << ". Consider setting a capacity for this place.");
+        result.setFromInt(encoding.offset, encoding.bits, tokens);
+    }
+    return result;
+}
+
+template<typename ValueType>
+uint64_t ExplicitGspnModelBuilder<ValueType>::getEnablingDegree(CompiledTransition const& transition, storm::storage::BitVector const& marking) const {
+    if (transition.servers == 1) {
+        return 1;
+    }
+    uint64_t degree = transition.servers == 0 ? std::numeric_limits<uint64_t>::max() : transition.servers;
+    for (auto const& arc : transition.inputs) {
+        degree = std::min(degree, getTokens(marking, arc.place) / arc.multiplicity);
+    }
+    return degree;
+}
+
+template<typename ValueType>
+void ExplicitGspnModelBuilder<ValueType>::expand(storm::storage::BitVector const& marking, ExpandedMarking& result) const {
+    result.clear();
+    // Only the immediate transitions of the highest priority with an enabled transition are considered
+    for (auto const& partitions : immediateTransitionsByPriority) {
+        for (auto const& partition : partitions) {
+            uint64_t const choiceStart = result.successors.size();
+            ValueType totalWeight = storm::utility::zero<ValueType>();
+            for (auto const& transition : partition) {
+                if (isEnabled(transition, marking)) {
+                    totalWeight += transition.value;
+                    result.successors.emplace_back(fire(transition, marking), transition.value);
+                }
+            }
+            if (result.successors.size() > choiceStart) {
+                result.choiceStarts.push_back(choiceStart);
+                for (uint64_t i = choiceStart; i < result.successors.size(); ++i) {
+                    result.successors[i].second /= totalWeight;
+                }
+            }
+        }
+        if (!result.choiceStarts.empty()) {
+            return;
+        }
+    }
+
+    // Timed transitions are only considered if no immediate transition is enabled
+    for (auto const& transition : timedTransitions) {
+        if (isEnabled(transition, marking)) {
+            ValueType rate = transition.value * storm::utility::convertNumber<ValueType>(getEnablingDegree(transition, marking));
+            result.successors.emplace_back(fire(transition, marking), rate);
+        }
+    }
+    if (!result.successors.empty()) {
+        result.choiceStarts.push_back(0);
+        result.markovian = true;
+    }
+}
+
+template<typename ValueType>
+std::shared_ptr<storm::models::sparse::Model<ValueType>> ExplicitGspnModelBuilder<ValueType>::build() {
+    bool const deterministic = modelType == storm::models::ModelType::Ctmc;
+    markingToId = storm::storage::BitVectorHashMap<uint64_t>(numberOfTotalBits, 100000);
+
+    storm::storage::BitVector initialMarking(numberOfTotalBits);
+    for (auto const& place : gspn.getPlaces()) {
+        auto const& encoding = placeEncodings[place.getID()];
+        STORM_LOG_THROW(place.getNumberOfInitialTokens() <= encoding.maxTokens, storm::exceptions::InvalidModelException,
+                        "The initial tokens of place " << place.getName() << " exceed its capacity.");
+        initialMarking.setFromInt(encoding.offset, encoding.bits, place.getNumberOfInitialTokens());
+    }
+    markingToId.findOrAdd(initialMarking, 0);
+    std::deque<storm::storage::BitVector> markingsToExplore{std::move(initialMarking)};
+
+    storm::storage::SparseMatrixBuilder<ValueType> matrixBuilder(0, 0, 0, false, !deterministic, 0);
+    std::vector<uint64_t> markovianStates;
+    std::vector<uint64_t> deadlockStates;
+    uint64_t currentState = 0;
+    uint64_t currentRow = 0;
+    std::vector<std::pair<uint64_t, ValueType>> rowEntries;
+
+    uint64_t const maxBatchSize = std::max<uint64_t>(1024, 256 * options.numberOfThreads);
+    std::vector<storm::storage::BitVector> batch;
+    std::vector<ExpandedMarking> expandedMarkings(maxBatchSize);
+#ifdef STORM_HAVE_INTELTBB
+    tbb::task_arena arena(static_cast<int>(options.numberOfThreads));
+#endif
+
+    while (!markingsToExplore.empty()) {
+        uint64_t const batchSize = std::min<uint64_t>(maxBatchSize, markingsToExplore.size());
+        batch.assign(std::make_move_iterator(markingsToExplore.begin()), std::make_move_iterator(markingsToExplore.begin() + batchSize));
+        markingsToExplore.erase(markingsToExplore.begin(), markingsToExplore.begin() + batchSize);
+
+#ifdef STORM_HAVE_INTELTBB
+        if (options.numberOfThreads > 1) {
+            arena.execute([&]() {
+                tbb::parallel_for(tbb::blocked_range<uint64_t>(0, batchSize), [&](tbb::blocked_range<uint64_t> const& range) {
+                    for (uint64_t i = range.begin(); i < range.end(); ++i) {
+                        expand(batch[i], expandedMarkings[i]);
+                    }
+                });
+            });
+        } else {
+            for (uint64_t i = 0; i < batchSize; ++i) {
+                expand(batch[i], expandedMarkings[i]);
+            }
+        }
+#else
+        for (uint64_t i = 0; i < batchSize; ++i) {
+            expand(batch[i], expandedMarkings[i]);
+        }
+#endif
+
+        // Assign the indices of the successors in the order of the batch
+        for (uint64_t i = 0; i < batchSize; ++i, ++currentState) {
+            auto& expandedMarking = expandedMarkings[i];
+            if (!deterministic) {
+                matrixBuilder.newRowGroup(currentRow);
+            }
+            if (expandedMarking.choiceStarts.empty()) {
+                // Deadlock states get a self-loop. For Markov automata, they are Markovian (to not introduce Zeno behavior).
+                deadlockStates.push_back(currentState);
+                markovianStates.push_back(currentState);
+                matrixBuilder.addNextValue(currentRow, currentState, storm::utility::one<ValueType>());
+                ++currentRow;
+                continue;
+            }
+            if (expandedMarking.markovian) {
+                markovianStates.push_back(currentState);
+            }
+            for (uint64_t choice = 0; choice < expandedMarking.choiceStarts.size(); ++choice) {
+                uint64_t const choiceEnd =
+                    choice + 1 < expandedMarking.choiceStarts.size() ? expandedMarking.choiceStarts[choice + 1] : expandedMarking.successors.size();
+                rowEntries.clear();
+                for (uint64_t successor = expandedMarking.choiceStarts[choice]; successor < choiceEnd; ++successor) {
+                    auto& [successorMarking, value] = expandedMarking.successors[successor];
+                    uint64_t const newIndex = markingToId.size();
+                    uint64_t const successorIndex = markingToId.findOrAdd(successorMarking, newIndex);
+                    if (successorIndex == newIndex) {
+                        markingsToExplore.push_back(std::move(successorMarking));
+                    }
+                    rowEntries.emplace_back(successorIndex, value);
+                }
+                // Different transitions can lead to the same marking
+                std::sort(rowEntries.begin(), rowEntries.end(), [](auto const& lhs, auto const& rhs) { return lhs.first < rhs.first; });
+                for (uint64_t entry = 0; entry < rowEntries.size(); ++entry) {
+                    ValueType value = rowEntries[entry].second;
+                    while (entry + 1 < rowEntries.size() && rowEntries[entry + 1].first == rowEntries[entry].first) {
+                        value += rowEntries[++entry].second;
+                    }
+                    matrixBuilder.addNextValue(currentRow, rowEntries[entry].first, value);
+                }
+                ++currentRow;
+            }
+            // Free the memory of the successors early
+            expandedMarking = ExpandedMarking();
+        }
+
+        if (storm::utility::resources::isTerminate()) {
+            STORM_LOG_THROW(false, storm::exceptions::AbortException, "Aborted in state space exploration after " << currentState << " states.");
+        }
+    }
+
+    uint64_t const numberOfStates = markingToId.size();
+    STORM_LOG_INFO("Explored " << numberOfStates << " markings with " << options.numberOfThreads << " threads.");
+    storm::storage::sparse::ModelComponents<ValueType> components(matrixBuilder.build(0, numberOfStates, deterministic ? 0 : numberOfStates),
+                                                                  buildStateLabeling(numberOfStates, deadlockStates));
+    if (modelType != storm::models::ModelType::Mdp) {
+        components.rateTransitions = true;
+    }
+    if (modelType == storm::models::ModelType::MarkovAutomaton) {
+        components.markovianStates = storm::storage::BitVector(numberOfStates, markovianStates.begin(), markovianStates.end());
+    }
+    return storm::utility::builder::buildModelFromComponents(modelType, std::move(components));
+}
+
+template<typename ValueType>
+storm::models::sparse::StateLabeling ExplicitGspnModelBuilder<ValueType>::buildStateLabeling(uint64_t numberOfStates,
+                                                                                             std::vector<uint64_t> const& deadlockStates) const {
+    storm::models::sparse::StateLabeling result(numberOfStates);
+    result.addLabel("init");
+    result.addLabelToState("init", 0);
+    result.addLabel("deadlock", storm::storage::BitVector(numberOfStates, deadlockStates.begin(), deadlockStates.end()));
+    if (options.labels.empty()) {
+        return result;
+    }
+
+    std::vector<storm::expressions::Expression> labelExpressions;
+    for (auto const& label : options.labels) {
+        result.addLabel(label.first);
+        labelExpressions.push_back(label.second.substitute(gspn.getConstantsSubstitution()));
+    }
+    std::vector<storm::expressions::Variable> placeVariables;
+    for (auto const& place : gspn.getPlaces()) {
+        placeVariables.push_back(gspn.getExpressionManager()->getVariable(place.getName()));
+    }
+    storm::expressions::ExpressionEvaluator<ValueType> evaluator(*gspn.getExpressionManager());
+    for (auto const& [marking, state] : markingToId) {
+        for (auto const& place : gspn.getPlaces()) {
+            evaluator.setIntegerValue(placeVariables[place.getID()], getTokens(marking, place.getID()));
+        }
+        for (uint64_t label = 0; label < labelExpressions.size(); ++label) {
+            if (evaluator.asBool(labelExpressions[label])) {
+                result.addLabelToState(options.labels[label].first, state);
+            }
+        }
+    }
+    return result;
+}
+
+template class ExplicitGspnModelBuilder<double>;
+
+}  // namespace builder
+}  // namespace storm
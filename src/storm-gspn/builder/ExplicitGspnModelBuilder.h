@@ -1,175 +1,164 @@
-// #ifndef STORM_BUILDER_EXPLICITGSPNMODELBUILDER_H_
-// #define STORM_BUILDER_EXPLICITGSPNMODELBUILDER_H_
-//
-// #include <string>
-//
-// #include "storm/models/sparse/MarkovAutomaton.h"
-// #include "storm/models/sparse/StandardRewardModel.h"
-// #include "storm/storage/BitVector.h"
-// #include "storm/storage/BitVectorHashMap.h"
-// #include "storm/storage/gspn/GSPN.h"
-// #include "storm/storage/gspn/ImmediateTransition.h"
-// #include "storm/storage/gspn/TimedTransition.h"
-//
-//  namespace storm {
-//     namespace builder {
-//
-//         /*!
-//          * This class provides the facilities for building an markov automaton.
-//          */
-//         template<typename ValueType=double>
-//         class ExplicitGspnModelBuilder {
-//         public:
-//
-//             /*!
-//              * Builds an MarkovAutomaton from the given GSPN.
-//              *
-//              * @param gspn The gspn whose semantic is covered by the MarkovAutomaton
-//              * @return The resulting MarkovAutomaton
-//              */
-//             storm::models::sparse::MarkovAutomaton<ValueType> translateGspn(storm::gspn::GSPN const& gspn, std::string const& formula);
-//         private:
-//
-//             /*!
-//              * Add for each partition a new row in the probability matrix.
-//              *
-//              * @param partitions The partitioned immediate transitions.
-//              * @param currentMarking The current marking which is considered at the moment.
-//              */
-//             void addRowForPartitions(std::vector<std::vector<std::shared_ptr<storm::gspn::ImmediateTransition<double>>>> const& partitions,
-//             storm::gspn::Marking const& currentMarking);
-//
-//
-//             /*!
-//              * Add row for a markovian state.
-//              *
-//              * @param enabledTimedTransitions List of enabled timed transitions.
-//              * @param currentMarking The current marking which is considered at the moment.
-//              * @param accRate The sum of all rates of the enabled timed transisitons
-//              */
-//             void addRowForTimedTransitions(std::vector<std::shared_ptr<storm::gspn::TimedTransition<double>>> const& enabledTimedTransitions,
-//             storm::gspn::Marking const& currentMarking, double const& accRate);
-//
-//             /*!
-//              * Struct for comparing unsigned integer for maps
-//              */
-//             struct cmpByIndex {
-//                 bool operator()(const uint_fast64_t &a, const uint_fast64_t &b) const {
-//                     return a < b;
-//                 }
-//             };
-//
-//             /*!
-//              * This method insert the values from a map into the matrix
-//              *
-//              * @param values The values which are inserted
-//              */
-//             void addValuesToBuilder(std::map<uint_fast64_t , double, storm::builder::ExplicitGspnModelBuilder<ValueType>::cmpByIndex> const& values);
-//
-//
-//             /*!
-//              * This method partitions all enabled immediate transitions w.r.t. a marking.
-//              * All enabled weighted immediate transitions are in one vector. Between these transitions
-//              * is chosen probabilistically by the weights.
-//              *
-//              * All other enabled non-weighted immediate transitions are in an singleton vector.
-//              * Between different vectors is chosen non-deterministically.
-//              *
-//              * @param marking The current marking which is considered.
-//              * @param enabledImmediateTransistions A vector of enabled immediate transitions.
-//              * @return The vector of vectors which is described above.
-//              */
-//             std::vector<std::vector<std::shared_ptr<storm::gspn::ImmediateTransition<double>>>> partitonEnabledImmediateTransitions(storm::gspn::Marking
-//             const& marking, std::vector<std::shared_ptr<storm::gspn::ImmediateTransition<double>>> const& enabledImmediateTransitions);
-//
-//             /*!
-//              * Computes the accumulated weight of immediate transisions which are stored in a list.
-//              *
-//              * @param vector List of immediate transisitions.
-//              */
-//             double getAccumulatedWeight(std::vector<std::shared_ptr<storm::gspn::ImmediateTransition<double>>> const& vector) const;
-//
-//             /*!
-//              * Compute the upper bound for the number of tokens in each place.
-//              * Also computes the number of bits which are used to store a marking.
-//              *
-//              * @param gspn The corresponding gspn.
-//              */
-//             void computeCapacities(storm::gspn::GSPN const& gspn);
-//
-//             /*!
-//              * Returns the vector of enabled timed transition with the highest priority.
-//              *
-//              *
-//              * @param marking The current marking which is considered.
-//              * @return The vector of enabled timed transitions.
-//              */
-//             std::vector<std::shared_ptr<storm::gspn::TimedTransition<double>>> getEnabledTimedTransition(
-//                     storm::gspn::Marking const& marking);
-//
-//             /*!
-//              * Returns the vector of active immediate transition with the highest priority.
-//              *
-//              * @param marking The current marking which is considered.
-//              * @return The vector of enabled immediate transitions.
-//              */
-//             std::vector<std::shared_ptr<storm::gspn::ImmediateTransition<double>>> getEnabledImmediateTransition(
-//                     storm::gspn::Marking const& marking);
-//
-//             /*!
-//              * Computes the accumulated rate of a vector of timed transitions.
-//              *
-//              * @param vector The vector of timed transitions.
-//              * @return The accumulated rate.
-//              */
-//             double getAccumulatedRate(std::vector<std::shared_ptr<storm::gspn::TimedTransition<double>>> const& vector);
-//
-//             // is only needed for debugging purposes
-//             // since markings is injective, we can determine the bitvector
-//             storm::storage::BitVector getBitvector(uint_fast64_t const& index);
-//
-//             /*!
-//              * Adds the bitvector to the marking-map.
-//              * If the bitvector corresponds to a new marking the bitvector is added to the todo list.
-//              *
-//              * @return The rowGroup index for the bitvector.
-//              */
-//             uint_fast64_t findOrAddBitvectorToMarkings(storm::storage::BitVector const& bitvector);
-//
-//             /*!
-//              * Computes the state labeling and returns it.
-//              * Every state is labeled with its name.
-//              *
-//              * @return The computed state labeling.
-//              */
-//             storm::models::sparse::StateLabeling getStateLabeling() const;
-//
-//
-//             // contains the number of bits which are used the store the number of tokens at each place
-//             std::map<uint_fast64_t, uint_fast64_t> numberOfBits;
-//
-//             // contains the number of bits used to create markings
-//             uint_fast64_t numberOfTotalBits;
-//
-//             // maps bitvectors (markings w.r.t. the capacity) to their rowgroup
-//             storm::storage::BitVectorHashMap<uint_fast64_t> markings = storm::storage::BitVectorHashMap<uint_fast64_t>(64, 1);
-//
-//             // a list of markings for which the outgoing edges need to be computed
-//             std::deque<std::shared_ptr<storm::storage::BitVector>> todo;
-//
-//             //the gspn which is transformed
-//             storm::gspn::GSPN gspn;
-//
-//             // the next index for a new rowgroup
-//             uint_fast64_t nextRowGroupIndex = 0;
-//
-//             // builder object which is used to create the probability matrix
-//             storm::storage::SparseMatrixBuilder<double> builder;
-//
-//             // contains the current row index during the computation
-//             uint_fast64_t currentRowIndex;
-//         };
-//     }
-// }
-//
-// #endif //STORM_BUILDER_EXPLICITGSPNMODELBUILDER_H_
+#pragma once
+
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "storm-gspn/storage/gspn/GSPN.h"
+#include "storm/models/ModelType.h"
+#include "storm/models/sparse/Model.h"
+#include "storm/models/sparse/StateLabeling.h"
+#include "storm/storage/BitVector.h"
+#include "storm/storage/BitVectorHashMap.h"
+#include "storm/storage/expressions/Expression.h"
+
+namespace storm {
+namespace builder {
+
+/*!
+ * This class builds the explicit model of a GSPN directly, i.e., without the translation to JANI.
+ * The resulting model is a CTMC (only timed transitions), an MDP (only immediate transitions) or a Markov automaton.
+ * The semantics coincides with the one of the JANI translation (see JaniGSPNBuilder):
+ * - Only the immediate transitions of the highest priority with an enabled immediate transition are considered.
+ *   Each partition of these transitions yields one choice whose probabilities are given by the weights of the enabled transitions.
+ * - Timed transitions are only considered if no immediate transition is enabled (maximal progress).
+ * - Deadlock states get a self-loop.
+ *
+ * Markings are packed into bit vectors where each place occupies a fixed number of bits which is determined by its capacity.
+ * The transitions are compiled into flat lists of arcs referring to the positions of their places within the packed marking.
+ * Thus, enabling and firing a transition does not require any lookups.
+ *
+ * The state space is explored in breadth-first order. Batches of markings are expanded in parallel. Afterwards, the successors are
+ * assigned their indices sequentially in the order of the batch. Thus, the resulting model does not depend on the number of threads.
+ */
+template<typename ValueType = double>
+class ExplicitGspnModelBuilder {
+   public:
+    struct Options {
+        // Number of threads used for the exploration
+        uint64_t numberOfThreads = 1;
+        // Number of bits used to store the tokens of places without capacity
+        uint64_t bitsForUnboundedPlaces = 16;
+        // Additional state labels given by boolean expressions over the places
+        std::vector<std::pair<std::string, storm::expressions::Expression>> labels;
+    };
+
+    /*!
+     * Constructor.
+     *
+     * @param gspn The GSPN whose semantics is built.
+     * @param options Options for the exploration.
+     */
+    ExplicitGspnModelBuilder(storm::gspn::GSPN const& gspn, Options const& options);
+
+    /*!
+     * Builds the explicit model of the GSPN.
+     * Each state is labeled with "init" (initial marking), "deadlock" (no transition is enabled) and the additional labels.
+     *
+     * @return The resulting model.
+     */
+    std::shared_ptr<storm::models::sparse::Model<ValueType>> build();
+
+   private:
+    // Position of the tokens of a place within a packed marking
+    struct PlaceEncoding {
+        uint64_t offset;
+        uint64_t bits;
+        // Maximal number of tokens which can be stored
+        uint64_t maxTokens;
+    };
+
+    // Arc between a place and a transition
+    struct Arc {
+        uint64_t place;
+        uint64_t multiplicity;
+    };
+
+    // Change of the tokens in a place when firing a transition
+    struct TokenChange {
+        uint64_t place;
+        int64_t delta;
+    };
+
+    struct CompiledTransition {
+        std::string name;
+        std::vector<Arc> inputs;
+        std::vector<Arc> inhibitors;
+        std::vector<TokenChange> changes;
+        // Weight for immediate transitions, rate for timed transitions
+        ValueType value;
+        // Number of servers for timed transitions (0 means infinite server semantics)
+        uint64_t servers = 1;
+    };
+
+    // The behavior of a marking
+    struct ExpandedMarking {
+        // Index of the first successor of each choice
+        std::vector<uint64_t> choiceStarts;
+        // Successor markings together with their probability or rate
+        std::vector<std::pair<storm::storage::BitVector, ValueType>> successors;
+        // Whether the marking only has timed transitions
+        bool markovian = false;
+
+        void clear() {
+            choiceStarts.clear();
+            successors.clear();
+            markovian = false;
+        }
+    };
+
+    /*!
+     * Compute the encoding of the places and compile the transitions.
+     */
+    void compile();
+
+    /*!
+     * Compile the given transition.
+     */
+    CompiledTransition compileTransition(storm::gspn::Transition const& transition, ValueType value) const;
+
+    uint64_t getTokens(storm::storage::BitVector const& marking, uint64_t place) const;
+
+    bool isEnabled(CompiledTransition const& transition, storm::storage::BitVector const& marking) const;
+
+    storm::storage::BitVector fire(CompiledTransition const& transition, storm::storage::BitVector const& marking) const;
+
+    /*!
+     * Returns the number of times the given timed transition is concurrently enabled (according to its server semantics).
+     */
+    uint64_t getEnablingDegree(CompiledTransition const& transition, storm::storage::BitVector const& marking) const;
+
+    /*!
+     * Compute all choices of the given marking.
+     * This method only reads shared data and can be called concurrently.
+     */
+    void expand(storm::storage::BitVector const& marking, ExpandedMarking& result) const;
+
+    /*!
+     * Computes the state labeling for the explored markings.
+     */
+    storm::models::sparse::StateLabeling buildStateLabeling(uint64_t numberOfStates, std::vector<uint64_t> const& deadlockStates) const;
+
+    // The GSPN which is translated
+    storm::gspn::GSPN const& gspn;
+
+    Options options;
+
+    storm::models::ModelType modelType;
+
+    std::vector<PlaceEncoding> placeEncodings;
+
+    uint64_t numberOfTotalBits;
+
+    // Immediate transitions grouped by decreasing priority and then by partition
+    std::vector<std::vector<std::vector<CompiledTransition>>> immediateTransitionsByPriority;
+
+    std::vector<CompiledTransition> timedTransitions;
+
+    // Maps the explored markings to their state index
+    storm::storage::BitVectorHashMap<uint64_t> markingToId;
+};
+
+}  // namespace builder
+}  // namespace storm
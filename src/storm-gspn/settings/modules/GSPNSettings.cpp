@@ -21,6 +21,7 @@ const std::string GSPNSettings::capacitiesFileOptionShortName = "capacities";
 const std::string GSPNSettings::capacityOptionName = "capacity";
 const std::string GSPNSettings::constantsOptionName = "constants";
 const std::string GSPNSettings::constantsOptionShortName = "const";
+const std::string GSPNSettings::buildExplicitOptionName = "build-explicit";
 
 GSPNSettings::GSPNSettings() : ModuleSettings(moduleName) {
     this->addOption(storm::settings::OptionBuilder(moduleName, gspnFileOptionName, false, "Parses the GSPN.")
@@ -47,6 +48,13 @@ GSPNSettings::GSPNSettings() : ModuleSettings(moduleName) {
                                          .setDefaultValueString("")
                                          .build())
                         .build());
+    this->addOption(storm::settings::OptionBuilder(moduleName, buildExplicitOptionName, false,
+                                                   "Builds the explicit model directly from the GSPN (without the translation to JANI).")
+                        .addArgument(storm::settings::ArgumentBuilder::createUnsignedIntegerArgument("threads", "The number of exploration threads.")
+                                         .setDefaultValueUnsignedInteger(1)
+                                         .addValidatorUnsignedInteger(ArgumentValidatorFactory::createUnsignedGreaterValidator(0))
+                                         .build())
+                        .build());
 }
 
 bool GSPNSettings::isGspnFileSet() const {
@@ -81,6 +89,14 @@ std::string GSPNSettings::getConstantDefinitionString() const {
     return this->getOption(constantsOptionName).getArgumentByName("values").getValueAsString();
 }
 
+bool GSPNSettings::isBuildExplicitSet() const {
+    return this->getOption(buildExplicitOptionName).getHasOptionBeenSet();
+}
+
+uint64_t GSPNSettings::getNumberOfExplorationThreads() const {
+    return this->getOption(buildExplicitOptionName).getArgumentByName("threads").getValueAsUnsignedInteger();
+}
+
 void GSPNSettings::finalize() {}
 
 bool GSPNSettings::check() const {
@@ -53,6 +53,16 @@ class GSPNSettings : public ModuleSettings {
      */
     std::string getConstantDefinitionString() const;
 
+    /*!
+     * Retrieves whether the explicit model should be built directly from the GSPN.
+     */
+    bool isBuildExplicitSet() const;
+
+    /*!
+     * Retrieves the number of threads used for building the explicit model.
+     */
+    uint64_t getNumberOfExplorationThreads() const;
+
     bool check() const override;
     void finalize() override;
 
@@ -66,6 +76,7 @@ class GSPNSettings : public ModuleSettings {
     static const std::string capacityOptionName;
     static const std::string constantsOptionName;
     static const std::string constantsOptionShortName;
+    static const std::string buildExplicitOptionName;
 };
 }  // namespace modules
 }  // namespace settings
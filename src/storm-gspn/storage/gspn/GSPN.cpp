@@ -26,15 +26,15 @@ uint64_t GSPN::transitionIdToImmediateTransitionId(uint64_t tId) {
     return tId;
 }
 
-GSPN::GSPN(std::string const& name, std::vector<Place> const& places, std::vector<ImmediateTransition<WeightType>> const& itransitions,
-           std::vector<TimedTransition<RateType>> const& ttransitions, std::vector<TransitionPartition> const& partitions,
+GSPN::GSPN(std::string const& name, std::vector<Place> places, std::vector<ImmediateTransition<WeightType>> itransitions,
+           std::vector<TimedTransition<RateType>> ttransitions, std::vector<TransitionPartition> partitions,
            std::shared_ptr<storm::expressions::ExpressionManager> const& exprManager,
            std::map<storm::expressions::Variable, storm::expressions::Expression> const& constantsSubstitution)
     : name(name),
-      places(places),
-      immediateTransitions(itransitions),
-      timedTransitions(ttransitions),
-      partitions(partitions),
+      places(std::move(places)),
+      immediateTransitions(std::move(itransitions)),
+      timedTransitions(std::move(ttransitions)),
+      partitions(std::move(partitions)),
       exprManager(exprManager),
       constantsSubstitution(constantsSubstitution) {}
 
@@ -402,11 +402,11 @@ void GSPN::setTransitionLayoutInfo(uint64_t transitionId, LayoutInfo const& layo
     transitionLayout[transitionId] = layout;
 }
 
-void GSPN::setPlaceLayoutInfo(std::map<uint64_t, LayoutInfo> const& placeLayout) const {
-    this->placeLayout = placeLayout;
+void GSPN::setPlaceLayoutInfo(std::map<uint64_t, LayoutInfo> placeLayout) const {
+    this->placeLayout = std::move(placeLayout);
 }
-void GSPN::setTransitionLayoutInfo(std::map<uint64_t, LayoutInfo> const& transitionLayout) const {
-    this->transitionLayout = transitionLayout;
+void GSPN::setTransitionLayoutInfo(std::map<uint64_t, LayoutInfo> transitionLayout) const {
+    this->transitionLayout = std::move(transitionLayout);
 }
 
 std::map<uint64_t, LayoutInfo> const& GSPN::getPlaceLayoutInfos() const {
@@ -29,8 +29,8 @@ class GSPN {
     typedef double RateType;
     typedef double WeightType;
 
-    GSPN(std::string const& name, std::vector<Place> const& places, std::vector<ImmediateTransition<WeightType>> const& itransitions,
-         std::vector<TimedTransition<RateType>> const& ttransitions, std::vector<TransitionPartition> const& partitions,
+    GSPN(std::string const& name, std::vector<Place> places, std::vector<ImmediateTransition<WeightType>> itransitions,
+         std::vector<TimedTransition<RateType>> ttransitions, std::vector<TransitionPartition> partitions,
          std::shared_ptr<storm::expressions::ExpressionManager> const& exprManager,
          std::map<storm::expressions::Variable, storm::expressions::Expression> const& constantsSubstitution =
              std::map<storm::expressions::Variable, storm::expressions::Expression>());
@@ -158,8 +158,8 @@ class GSPN {
 
     void setPlaceLayoutInfo(uint64_t placeId, LayoutInfo const& layout) const;
     void setTransitionLayoutInfo(uint64_t transitionId, LayoutInfo const& layout) const;
-    void setPlaceLayoutInfo(std::map<uint64_t, LayoutInfo> const& placeLayout) const;
-    void setTransitionLayoutInfo(std::map<uint64_t, LayoutInfo> const& transitionLayout) const;
+    void setPlaceLayoutInfo(std::map<uint64_t, LayoutInfo> placeLayout) const;
+    void setTransitionLayoutInfo(std::map<uint64_t, LayoutInfo> transitionLayout) const;
 
     std::map<uint64_t, LayoutInfo> const& getPlaceLayoutInfos() const;
 
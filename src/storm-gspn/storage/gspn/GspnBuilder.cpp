@@ -1,5 +1,7 @@
 #include "GspnBuilder.h"
 
+#include <algorithm>
+
 #include "storm/exceptions/IllegalFunctionCallException.h"
 
 #include "Place.h"
@@ -14,21 +16,36 @@ void GspnBuilder::setGspnName(std::string const& name) {
 
 uint_fast64_t GspnBuilder::addPlace(boost::optional<uint64_t> const& capacity, uint_fast64_t const& initialTokens, std::string const& name) {
     auto newId = places.size();
-    auto place = storm::gspn::Place(newId);
+    auto& place = places.emplace_back(newId);
     place.setCapacity(capacity);
     place.setNumberOfInitialTokens(initialTokens);
     place.setName(name);
-    places.push_back(place);
     placeNames.emplace(name, newId);
     return newId;
 }
 
+void GspnBuilder::reserve(uint64_t numberOfPlaces, uint64_t numberOfImmediateTransitions, uint64_t numberOfTimedTransitions) {
+    places.reserve(numberOfPlaces);
+    placeNames.reserve(numberOfPlaces);
+    immediateTransitions.reserve(numberOfImmediateTransitions);
+    timedTransitions.reserve(numberOfTimedTransitions);
+    transitionNames.reserve(numberOfImmediateTransitions + numberOfTimedTransitions);
+}
+
+void GspnBuilder::setStoreLayout(bool storeLayout) {
+    this->storeLayout = storeLayout;
+}
+
 void GspnBuilder::setPlaceLayoutInfo(uint64_t placeId, LayoutInfo const& layoutInfo) {
-    placeLayout[placeId] = layoutInfo;
+    if (storeLayout) {
+        placeLayout[placeId] = layoutInfo;
+    }
 }
 
 void GspnBuilder::setTransitionLayoutInfo(uint64_t transitionId, LayoutInfo const& layoutInfo) {
-    transitionLayout[transitionId] = layoutInfo;
+    if (storeLayout) {
+        transitionLayout[transitionId] = layoutInfo;
+    }
 }
 
 uint_fast64_t GspnBuilder::addImmediateTransition(uint_fast64_t const& priority, double const& weight, std::string const& name) {
@@ -86,7 +103,7 @@ uint_fast64_t GspnBuilder::addTimedTransition(uint_fast64_t const& priority, dou
 
 void GspnBuilder::addInputArc(uint_fast64_t const& from, uint_fast64_t const& to, uint_fast64_t const& multiplicity) {
     STORM_LOG_THROW(from < places.size(), storm::exceptions::InvalidArgumentException, "No place with id " << from << " known.");
-    auto place = places.at(from);
+    auto const& place = places.at(from);
     getTransition(to).setInputArcMultiplicity(place, multiplicity);
 }
 
@@ -98,7 +115,7 @@ void GspnBuilder::addInputArc(std::string const& from, std::string const& to, ui
 
 void GspnBuilder::addInhibitionArc(uint_fast64_t const& from, uint_fast64_t const& to, uint_fast64_t const& multiplicity) {
     STORM_LOG_THROW(from < places.size(), storm::exceptions::InvalidArgumentException, "No place with id " << from << " known.");
-    auto place = places.at(from);
+    auto const& place = places.at(from);
 
     getTransition(to).setInhibitionArcMultiplicity(place, multiplicity);
 }
@@ -111,7 +128,7 @@ void GspnBuilder::addInhibitionArc(std::string const& from, std::string const& t
 
 void GspnBuilder::addOutputArc(uint_fast64_t const& from, uint_fast64_t const& to, uint_fast64_t const& multiplicity) {
     STORM_LOG_THROW(to < places.size(), storm::exceptions::InvalidArgumentException, "No place with id " << to << " known.");
-    auto place = places.at(to);
+    auto const& place = places.at(to);
     getTransition(from).setOutputArcMultiplicity(place, multiplicity);
 }
 
@@ -165,15 +182,7 @@ bool GspnBuilder::isImmediateTransitionId(uint64_t tid) const {
     return GSPN::transitionIdToImmediateTransitionId(tid) < immediateTransitions.size();
 }
 
-storm::gspn::GSPN* GspnBuilder::buildGspn(std::shared_ptr<storm::expressions::ExpressionManager> const& exprManager,
-                                          std::map<storm::expressions::Variable, storm::expressions::Expression> const& constantsSubstitution) const {
-    std::shared_ptr<storm::expressions::ExpressionManager> actualExprManager;
-    if (exprManager) {
-        actualExprManager = exprManager;
-    } else {
-        actualExprManager = std::make_shared<storm::expressions::ExpressionManager>();
-    }
-
+std::vector<storm::gspn::TransitionPartition> GspnBuilder::getOrderedPartitions() const {
     std::vector<TransitionPartition> orderedPartitions;
     for (auto const& priorityPartitions : partitions) {
         for (auto const& partition : priorityPartitions.second) {
@@ -186,14 +195,48 @@ storm::gspn::GSPN* GspnBuilder::buildGspn(std::shared_ptr<storm::expressions::Ex
         }
     }
     std::reverse(orderedPartitions.begin(), orderedPartitions.end());
+    return orderedPartitions;
+}
+
+std::shared_ptr<storm::expressions::ExpressionManager> GspnBuilder::createExpressionManager(
+    std::shared_ptr<storm::expressions::ExpressionManager> const& exprManager) const {
+    std::shared_ptr<storm::expressions::ExpressionManager> actualExprManager;
+    if (exprManager) {
+        actualExprManager = exprManager;
+    } else {
+        actualExprManager = std::make_shared<storm::expressions::ExpressionManager>();
+    }
+
+    // Declare the variables in a fixed order
+    std::vector<std::string> sortedPlaceNames;
+    sortedPlaceNames.reserve(placeNames.size());
     for (auto const& placeEntry : placeNames) {
-        actualExprManager->declareIntegerVariable(placeEntry.first, false);
+        sortedPlaceNames.push_back(placeEntry.first);
+    }
+    std::sort(sortedPlaceNames.begin(), sortedPlaceNames.end());
+    for (auto const& placeName : sortedPlaceNames) {
+        actualExprManager->declareIntegerVariable(placeName, false);
     }
+    return actualExprManager;
+}
 
-    GSPN* result = new GSPN(gspnName, places, immediateTransitions, timedTransitions, orderedPartitions, actualExprManager, constantsSubstitution);
+storm::gspn::GSPN* GspnBuilder::buildGspn(std::shared_ptr<storm::expressions::ExpressionManager> const& exprManager,
+                                          std::map<storm::expressions::Variable, storm::expressions::Expression> const& constantsSubstitution) const {
+    GSPN* result = new GSPN(gspnName, places, immediateTransitions, timedTransitions, getOrderedPartitions(), createExpressionManager(exprManager),
+                            constantsSubstitution);
     result->setTransitionLayoutInfo(transitionLayout);
     result->setPlaceLayoutInfo(placeLayout);
     return result;
 }
+
+storm::gspn::GSPN* GspnBuilder::releaseGspn(std::shared_ptr<storm::expressions::ExpressionManager> const& exprManager,
+                                            std::map<storm::expressions::Variable, storm::expressions::Expression> const& constantsSubstitution) {
+    auto actualExprManager = createExpressionManager(exprManager);
+    GSPN* result = new GSPN(gspnName, std::move(places), std::move(immediateTransitions), std::move(timedTransitions), getOrderedPartitions(),
+                            actualExprManager, constantsSubstitution);
+    result->setTransitionLayoutInfo(std::move(transitionLayout));
+    result->setPlaceLayoutInfo(std::move(placeLayout));
+    return result;
+}
 }  // namespace gspn
 }  // namespace storm
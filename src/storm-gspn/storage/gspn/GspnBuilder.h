@@ -2,6 +2,7 @@
 
 #include <map>
 #include <string>
+#include <unordered_map>
 #include <vector>
 
 #include "GSPN.h"
@@ -18,6 +19,23 @@ class GspnBuilder {
      */
     void setGspnName(std::string const& name);
 
+    /**
+     * Reserve memory for the given number of elements.
+     * Should be called before adding elements if their number is (approximately) known in advance.
+     * @param numberOfPlaces Expected number of places.
+     * @param numberOfImmediateTransitions Expected number of immediate transitions.
+     * @param numberOfTimedTransitions Expected number of timed transitions.
+     */
+    void reserve(uint64_t numberOfPlaces, uint64_t numberOfImmediateTransitions, uint64_t numberOfTimedTransitions);
+
+    /**
+     * Set whether layout information should be stored.
+     * If disabled, all layout information given to the builder is ignored.
+     * Layout information is only required for exporting the GSPN.
+     * @param storeLayout Flag indicating whether layout information is stored.
+     */
+    void setStoreLayout(bool storeLayout);
+
     /**
      * Add a place to the gspn.
      * @param name The name must be unique for the gspn.
@@ -103,13 +121,34 @@ class GspnBuilder {
                                  std::map<storm::expressions::Variable, storm::expressions::Expression> const& constantsSubstitution =
                                      std::map<storm::expressions::Variable, storm::expressions::Expression>()) const;
 
+    /**
+     * Builds the GSPN by moving the places and transitions into it instead of copying them.
+     * The builder must not be used afterwards.
+     * @param exprManager The expression manager that will be associated with the new gspn. If this is nullptr, a new expressionmanager will be created.
+     * @return The gspn which is constructed by the builder.
+     */
+    storm::gspn::GSPN* releaseGspn(std::shared_ptr<storm::expressions::ExpressionManager> const& exprManager = nullptr,
+                                   std::map<storm::expressions::Variable, storm::expressions::Expression> const& constantsSubstitution =
+                                       std::map<storm::expressions::Variable, storm::expressions::Expression>());
+
    private:
+    /**
+     * Compute the partitions ordered by decreasing priority.
+     */
+    std::vector<storm::gspn::TransitionPartition> getOrderedPartitions() const;
+
+    /**
+     * Create the expression manager for the GSPN and declare the variables for all places.
+     */
+    std::shared_ptr<storm::expressions::ExpressionManager> createExpressionManager(
+        std::shared_ptr<storm::expressions::ExpressionManager> const& exprManager) const;
+
     bool isImmediateTransitionId(uint64_t) const;
     bool isTimedTransitionId(uint64_t) const;
     Transition& getTransition(uint64_t);
 
-    std::map<std::string, uint64_t> placeNames;
-    std::map<std::string, uint64_t> transitionNames;
+    std::unordered_map<std::string, uint64_t> placeNames;
+    std::unordered_map<std::string, uint64_t> transitionNames;
 
     std::string gspnName = "_gspn_";
 
@@ -126,6 +165,9 @@ class GspnBuilder {
 
     std::map<uint64_t, LayoutInfo> placeLayout;
     std::map<uint64_t, LayoutInfo> transitionLayout;
+
+    // Flag indicating whether layout information is stored
+    bool storeLayout = true;
 };
 }  // namespace gspn
 }  // namespace storm
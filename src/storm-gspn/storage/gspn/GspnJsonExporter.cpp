@@ -14,12 +14,20 @@ namespace gspn {
 static constexpr const uint64_t scaleFactor = 50;
 
 void GspnJsonExporter::toStream(storm::gspn::GSPN const& gspn, std::ostream& os) {
-    os << storm::dumpJson(translate(gspn)) << '\n';
+    storm::JsonStreamWriter<double> writer(os);
+    writer.beginArray();
+    translateElements(gspn, [&writer](Json&& jsonElement) { writer.value(jsonElement); });
+    writer.endArray();
+    os << '\n';
 }
 
 typename GspnJsonExporter::Json GspnJsonExporter::translate(storm::gspn::GSPN const& gspn) {
     Json jsonGspn;
+    translateElements(gspn, [&jsonGspn](Json&& jsonElement) { jsonGspn.push_back(std::move(jsonElement)); });
+    return jsonGspn;
+}
 
+void GspnJsonExporter::translateElements(storm::gspn::GSPN const& gspn, std::function<void(Json&&)> const& function) {
     // Layouts
     std::map<uint64_t, LayoutInfo> placeLayout = gspn.getPlaceLayoutInfos();
     std::map<uint64_t, LayoutInfo> transitionLayout = gspn.getTransitionLayoutInfos();
@@ -36,7 +44,7 @@ typename GspnJsonExporter::Json GspnJsonExporter::translate(storm::gspn::GSPN co
         }
         tmpX += 3;
         Json jsonPlace = translatePlace(place, x, y);
-        jsonGspn.push_back(jsonPlace);
+        function(std::move(jsonPlace));
     }
 
     // Export immediate transitions
@@ -49,7 +57,7 @@ typename GspnJsonExporter::Json GspnJsonExporter::translate(storm::gspn::GSPN co
         }
         tmpX += 3;
         Json jsonImmediateTransition = translateImmediateTransition(transition, x, y);
-        jsonGspn.push_back(jsonImmediateTransition);
+        function(std::move(jsonImmediateTransition));
     }
 
     // Export timed transitions
@@ -62,7 +70,7 @@ typename GspnJsonExporter::Json GspnJsonExporter::translate(storm::gspn::GSPN co
         }
         tmpX += 3;
         Json jsonTimedTransition = translateTimedTransition(transition, x, y);
-        jsonGspn.push_back(jsonTimedTransition);
+        function(std::move(jsonTimedTransition));
     }
 
     // Export arcs
@@ -73,21 +81,21 @@ typename GspnJsonExporter::Json GspnJsonExporter::translate(storm::gspn::GSPN co
         for (auto const& entry : transition.getInputPlaces()) {
             storm::gspn::Place place = places.at(entry.first);
             Json jsonInputArc = translateArc(transition, place, entry.second, true, ArcType::INPUT);
-            jsonGspn.push_back(jsonInputArc);
+            function(std::move(jsonInputArc));
         }
 
         // Export inhibitor arcs
         for (auto const& entry : transition.getInhibitionPlaces()) {
             storm::gspn::Place place = places.at(entry.first);
             Json jsonInputArc = translateArc(transition, place, entry.second, true, ArcType::INHIBITOR);
-            jsonGspn.push_back(jsonInputArc);
+            function(std::move(jsonInputArc));
         }
 
         // Export output arcs
         for (auto const& entry : transition.getOutputPlaces()) {
             storm::gspn::Place place = places.at(entry.first);
             Json jsonInputArc = translateArc(transition, place, entry.second, true, ArcType::OUTPUT);
-            jsonGspn.push_back(jsonInputArc);
+            function(std::move(jsonInputArc));
         }
     }
     // Export arcs for timed transitions
@@ -96,24 +104,23 @@ typename GspnJsonExporter::Json GspnJsonExporter::translate(storm::gspn::GSPN co
         for (auto const& entry : transition.getInputPlaces()) {
             storm::gspn::Place place = places.at(entry.first);
             Json jsonInputArc = translateArc(transition, place, entry.second, false, ArcType::INPUT);
-            jsonGspn.push_back(jsonInputArc);
+            function(std::move(jsonInputArc));
         }
 
         // Export inhibitor arcs
         for (auto const& entry : transition.getInhibitionPlaces()) {
             storm::gspn::Place place = places.at(entry.first);
             Json jsonInputArc = translateArc(transition, place, entry.second, false, ArcType::INHIBITOR);
-            jsonGspn.push_back(jsonInputArc);
+            function(std::move(jsonInputArc));
         }
 
         // Export output arcs
         for (auto const& entry : transition.getOutputPlaces()) {
             storm::gspn::Place place = places.at(entry.first);
             Json jsonInputArc = translateArc(transition, place, entry.second, false, ArcType::OUTPUT);
-            jsonGspn.push_back(jsonInputArc);
+            function(std::move(jsonInputArc));
         }
     }
-    return jsonGspn;
 }
 
 typename GspnJsonExporter::Json GspnJsonExporter::translatePlace(storm::gspn::Place const& place, double x, double y) {
@@ -1,5 +1,7 @@
 #pragma once
 
+#include <functional>
+
 #include "storm-gspn/storage/gspn/GSPN.h"
 #include "storm/adapters/JsonForward.h"
 #include "storm/utility/macros.h"
@@ -13,6 +15,9 @@ namespace gspn {
 class GspnJsonExporter {
    public:
     typedef typename storm::json<double> Json;
+    /*!
+     * Writes the elements of the GSPN one after another, so the JSON representation of the whole GSPN is never kept in memory.
+     */
     static void toStream(storm::gspn::GSPN const& gspn, std::ostream& os);
 
     static Json translate(storm::gspn::GSPN const& gspn);
@@ -20,6 +25,11 @@ class GspnJsonExporter {
    private:
     enum ArcType { INPUT, OUTPUT, INHIBITOR };
 
+    /*!
+     * Invokes the given function for the JSON representation of each element (place, transition or arc) of the GSPN in the order used by translate.
+     */
+    static void translateElements(storm::gspn::GSPN const& gspn, std::function<void(Json&&)> const& function);
+
     static Json translatePlace(storm::gspn::Place const& place, double x, double y);
 
     static Json translateImmediateTransition(storm::gspn::ImmediateTransition<double> const& transition, double x, double y);
@@ -25,11 +25,13 @@
 #include "storm-pars/transformer/SparseParametricDtmcSimplifier.h"
 #include "storm-pars/transformer/SparseParametricMdpSimplifier.h"
 
+#include "storm-pars/utility/ConstantSweep.h"
 #include "storm-pars/utility/parametric.h"
 
 #include "storm-parsers/parser/KeyValueParser.h"
 #include "storm/api/storm.h"
 
+#include "storm/environment/solver/SolverEnvironment.h"
 #include "storm/exceptions/BaseException.h"
 #include "storm/exceptions/InvalidSettingsException.h"
 #include "storm/exceptions/NotSupportedException.h"
@@ -230,6 +232,89 @@ SampleInformation<ValueType> parseSamples(std::shared_ptr<storm::models::ModelBa
     return sampleInfo;
 }
 
+/*!
+ * Parses the values of the constants to sweep, see SamplingSettings::getSweep.
+ */
+inline std::map<storm::expressions::Variable, std::vector<storm::RationalNumber>> parseSweep(storm::storage::SymbolicModelDescription const& model,
+                                                                                            std::string const& sweepString) {
+    std::map<storm::expressions::Variable, std::vector<storm::RationalNumber>> result;
+    std::vector<std::string> valuesForConstants;
+    boost::split(valuesForConstants, sweepString, boost::is_any_of(","));
+    for (auto& constantValues : valuesForConstants) {
+        boost::trim(constantValues);
+        auto equalsPosition = constantValues.find("=");
+        STORM_LOG_THROW(equalsPosition != constantValues.npos, storm::exceptions::WrongFormatException, "Incorrect format of swept constants.");
+        std::string constantName = constantValues.substr(0, equalsPosition);
+        boost::trim(constantName);
+        STORM_LOG_THROW(model.getManager().hasVariable(constantName), storm::exceptions::WrongFormatException, "Unknown constant '" << constantName << "'.");
+        auto& values = result[model.getManager().getVariable(constantName)];
+
+        std::vector<std::string> splitValues;
+        std::string valuesString = constantValues.substr(equalsPosition + 1);
+        boost::split(splitValues, valuesString, boost::is_any_of(":"));
+        for (auto& value : splitValues) {
+            boost::trim(value);
+            auto rangePosition = value.find("..");
+            if (rangePosition == value.npos) {
+                values.push_back(storm::utility::convertNumber<storm::RationalNumber>(value));
+                continue;
+            }
+            auto stepPosition = value.find("..", rangePosition + 2);
+            auto lower = storm::utility::convertNumber<storm::RationalNumber>(value.substr(0, rangePosition));
+            auto upper = storm::utility::convertNumber<storm::RationalNumber>(value.substr(rangePosition + 2, stepPosition - rangePosition - 2));
+            auto step = stepPosition == value.npos ? storm::utility::one<storm::RationalNumber>()
+                                                   : storm::utility::convertNumber<storm::RationalNumber>(value.substr(stepPosition + 2));
+            STORM_LOG_THROW(step > storm::utility::zero<storm::RationalNumber>(), storm::exceptions::WrongFormatException,
+                            "The step of range '" << value << "' is not positive.");
+            for (auto current = lower; current <= upper; current += step) {
+                values.push_back(current);
+            }
+        }
+    }
+    return result;
+}
+
+template<typename SolveValueType>
+void sweepConstants(cli::SymbolicInput const& input, std::string const& sweepString, bool graphPreserving) {
+    STORM_LOG_THROW(input.model.is_initialized(), storm::exceptions::InvalidSettingsException, "Sweeping constants requires a symbolic input model.");
+    storm::utility::ConstantSweep<SolveValueType> sweep(input.model.get(), input.properties, parseSweep(input.model.get(), sweepString));
+    sweep.setInstantiationsAreGraphPreserving(graphPreserving);
+    Environment env;
+    sweep.setParallel(env.solver().isUseIntelTbb());
+
+    std::stringstream structuralStream, instantiatedStream;
+    for (auto const& constant : sweep.getStructuralConstants()) {
+        structuralStream << " " << constant.getName();
+    }
+    for (auto const& constant : sweep.getInstantiatedConstants()) {
+        instantiatedStream << " " << constant.getName();
+    }
+    STORM_PRINT_AND_LOG("Sweeping " << sweep.getNumberOfPoints() << " points. Constants that require rebuilding the model:" << structuralStream.str()
+                                    << ". Constants that are instantiated:" << instantiatedStream.str() << ".\n");
+
+    storm::utility::Stopwatch watch(true);
+    sweep.check(env, [](auto const& point, storm::jani::Property const& property, std::unique_ptr<storm::modelchecker::CheckResult>&& result) {
+        std::stringstream pointStream;
+        bool first = true;
+        for (auto const& [constant, value] : point) {
+            if (!first) {
+                pointStream << ", ";
+            } else {
+                first = false;
+            }
+            pointStream << constant.getName() << "=" << value;
+        }
+        if (result) {
+            STORM_PRINT_AND_LOG("Result (initial states) for property " << property.getName() << " at instance [" << pointStream.str() << "]: " << *result
+                                                                        << '\n');
+        } else {
+            STORM_LOG_ERROR("Property " << property.getName() << " is unsupported by selected engine/settings.\n");
+        }
+    });
+    watch.stop();
+    STORM_PRINT_AND_LOG("Overall time for sweeping all instances: " << watch << "\n\n");
+}
+
 template<typename ValueType>
 void sampleDerivatives(std::shared_ptr<storm::models::sparse::Model<ValueType>> model, cli::SymbolicInput const& input,
                        std::string const& instantiationString) {
@@ -16,8 +16,6 @@
 #include "storm-pars/modelchecker/region/SparseDtmcParameterLiftingModelChecker.h"
 #include "storm-pars/modelchecker/region/SparseParameterLiftingModelChecker.h"
 
-#include "storm-pars/transformer/TimeTravelling.h"
-
 #include "storm-pars/settings/ParsSettings.h"
 #include "storm-pars/settings/modules/DerivativeSettings.h"
 #include "storm-pars/settings/modules/MonotonicitySettings.h"
@@ -27,7 +25,7 @@
 #include "storm-pars/settings/modules/RegionVerificationSettings.h"
 #include "storm-pars/settings/modules/SamplingSettings.h"
 
-#include "storm-pars/transformer/BinaryDtmcTransformer.h"
+#include "storm-pars/transformer/SparseParametricDtmcPreprocessor.h"
 #include "storm-pars/transformer/SparseParametricDtmcSimplifier.h"
 #include "storm-pars/transformer/SparseParametricMdpSimplifier.h"
 
@@ -223,20 +221,20 @@ PreprocessResult preprocessSparseModel(std::shared_ptr<storm::models::sparse::Mo
         result.changed = true;
     }
 
-    if (parametricSettings.isLinearToSimpleEnabled()) {
-        STORM_LOG_INFO("Transforming linear to simple...");
-        transformer::BinaryDtmcTransformer transformer;
-        result.model = transformer.transform(*result.model->template as<storm::models::sparse::Dtmc<RationalFunction>>(), true);
-        result.changed = true;
-    }
-
-    if (parametricSettings.isTimeTravellingEnabled()) {
-        transformer::TimeTravelling tt;
-        auto formulas = storm::api::extractFormulasFromProperties(input.properties);
-        modelchecker::CheckTask<storm::logic::Formula, storm::RationalFunction> checkTask(*formulas[0]);
-        result.model = std::make_shared<storm::models::sparse::Dtmc<RationalFunction>>(
-            tt.timeTravel(*result.model->template as<storm::models::sparse::Dtmc<RationalFunction>>(), checkTask));
+    if (parametricSettings.isLinearToSimpleEnabled() || parametricSettings.isTimeTravellingEnabled()) {
+        transformer::SparseParametricDtmcPreprocessor::Options preprocessorOptions;
+        preprocessorOptions.transformToSimple = parametricSettings.isLinearToSimpleEnabled();
+        preprocessorOptions.timeTravel = parametricSettings.isTimeTravellingEnabled();
+        std::shared_ptr<storm::logic::Formula const> formula;
+        if (preprocessorOptions.timeTravel) {
+            auto formulas = storm::api::extractFormulasFromProperties(input.properties);
+            STORM_LOG_THROW(!formulas.empty(), storm::exceptions::InvalidSettingsException, "Time-travelling requires a property to be specified.");
+            formula = formulas.front();
+        }
+        transformer::SparseParametricDtmcPreprocessor preprocessor(preprocessorOptions);
+        result.model = preprocessor.preprocess(result.model->template as<storm::models::sparse::Dtmc<RationalFunction>>(), formula);
         result.changed = true;
+        preprocessor.printStatisticsToStream(std::cout);
     }
 
     if (transformationSettings.isChainEliminationSet() && model->isOfType(storm::models::ModelType::MarkovAutomaton)) {
@@ -376,9 +374,30 @@ void parameterSpacePartitioningWithSparseEngine(std::shared_ptr<storm::models::s
 
     storm::cli::printModelCheckingProperty(property);
     storm::utility::Stopwatch watch(true);
-    std::unique_ptr<storm::modelchecker::CheckResult> result = storm::api::checkAndRefineRegionWithSparseEngine<ValueType>(
-        model, storm::api::createTask<ValueType>((property.getRawFormula()), true), regions.front(), engine, refinementThreshold, optionalDepthLimit,
-        storm::modelchecker::RegionResultHypothesis::Unknown, false, monotonicitySettings, monThresh);
+    std::unique_ptr<storm::modelchecker::CheckResult> result;
+    if (partitionSettings.isParallelRefinementSet() && !monotonicitySettings.useMonotonicity) {
+        STORM_LOG_WARN_COND(!partitionSettings.isCheckpointFileSet() && !partitionSettings.isResultCacheFileSet(),
+                            "Checkpoints and result caches are not supported for parallel refinement.");
+        result = storm::api::checkAndRefineRegionWithSparseEngineInParallel<ValueType>(
+            model, storm::api::createTask<ValueType>((property.getRawFormula()), true), regions.front(), engine, refinementThreshold, optionalDepthLimit,
+            storm::modelchecker::RegionResultHypothesis::Unknown, false, partitionSettings.getNumberOfRefinementWorkers());
+    } else {
+        STORM_LOG_WARN_COND(!partitionSettings.isParallelRefinementSet(), "Parallel refinement is not supported with monotonicity. Refining sequentially.");
+        storm::api::RefinementPersistenceSetting persistenceSettings;
+        if (partitionSettings.isCheckpointFileSet()) {
+            persistenceSettings.checkpointFile = partitionSettings.getCheckpointFile();
+            persistenceSettings.checkpointInterval = partitionSettings.getCheckpointInterval();
+            persistenceSettings.resumeFromCheckpoint = partitionSettings.isResumeFromCheckpointSet();
+        }
+        STORM_LOG_WARN_COND(partitionSettings.isCheckpointFileSet() || !partitionSettings.isResumeFromCheckpointSet(),
+                            "Resuming the refinement requires a checkpoint file. Starting from scratch.");
+        if (partitionSettings.isResultCacheFileSet()) {
+            persistenceSettings.resultCacheFile = partitionSettings.getResultCacheFile();
+        }
+        result = storm::api::checkAndRefineRegionWithSparseEngine<ValueType>(
+            model, storm::api::createTask<ValueType>((property.getRawFormula()), true), regions.front(), engine, refinementThreshold, optionalDepthLimit,
+            storm::modelchecker::RegionResultHypothesis::Unknown, false, monotonicitySettings, monThresh, persistenceSettings);
+    }
     watch.stop();
     printInitialStatesResult<ValueType>(result, &watch);
 
@@ -533,6 +552,17 @@ void processOptions() {
     auto symbolicInput = storm::cli::parseSymbolicInput();
     storm::cli::ModelProcessingInformation mpi;
     std::tie(symbolicInput, mpi) = storm::cli::preprocessSymbolicInput(symbolicInput);
+
+    auto sampleSettings = storm::settings::getModule<storm::settings::modules::SamplingSettings>();
+    if (sampleSettings.isSweepSet()) {
+        // The sweep builds its own models, one for each valuation of the constants that affect the structure.
+        if (sampleSettings.isSampleExactSet()) {
+            sweepConstants<storm::RationalNumber>(symbolicInput, sampleSettings.getSweep(), sampleSettings.isSamplesAreGraphPreservingSet());
+        } else {
+            sweepConstants<double>(symbolicInput, sampleSettings.getSweep(), sampleSettings.isSamplesAreGraphPreservingSet());
+        }
+        return;
+    }
     processInputWithValueTypeAndDdlib<storm::dd::DdType::Sylvan, storm::RationalFunction>(symbolicInput, mpi);
 }
 }  // namespace pars
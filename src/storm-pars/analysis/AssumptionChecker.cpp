@@ -2,6 +2,7 @@
 #include <storm/solver/Z3SmtSolver.h>
 
 #include "storm-pars/utility/ModelInstantiator.h"
+#include "storm/adapters/IntelTbbAdapter.h"
 #include "storm/exceptions/NotSupportedException.h"
 #include "storm/modelchecker/CheckTask.h"
 #include "storm/modelchecker/prctl/SparseDtmcPrctlModelChecker.h"
@@ -87,6 +88,77 @@ AssumptionStatus AssumptionChecker<ValueType, ConstantType>::validateAssumption(
     }
     assert(result != AssumptionStatus::VALID);
 
+    auto boundsResult = checkOnBounds(val1, val2, assumption, minValues, maxValues);
+    if (boundsResult != AssumptionStatus::UNKNOWN) {
+        return boundsResult;
+    }
+
+    if (result == AssumptionStatus::UNKNOWN) {
+        // If result from sample checking was unknown, the assumption might hold
+        std::set<expressions::Variable> vars = std::set<expressions::Variable>({});
+        assumption->gatherVariables(vars);
+
+        STORM_LOG_THROW(
+            assumption->getRelationType() == expressions::RelationType::Greater || assumption->getRelationType() == expressions::RelationType::Equal,
+            exceptions::NotSupportedException, "Only Greater Or Equal assumptions supported");
+        result = validateAssumptionSMTSolver(val1, val2, assumption, order, region, minValues, maxValues);
+    }
+    return result;
+}
+
+template<typename ValueType, typename ConstantType>
+std::vector<AssumptionStatus> AssumptionChecker<ValueType, ConstantType>::validateAssumptions(
+    std::vector<std::shared_ptr<expressions::BinaryRelationExpression>> const& assumptions, std::shared_ptr<Order> order,
+    storage::ParameterRegion<ValueType> region, std::vector<ConstantType> const minValues, std::vector<ConstantType> const maxValues) const {
+    std::vector<AssumptionStatus> result(assumptions.size(), AssumptionStatus::UNKNOWN);
+
+    // The cheap checks and the creation of the smt problems happen sequentially, as the latter might extend the order.
+    std::vector<uint_fast64_t> toSolve;
+    std::vector<SmtProblem> problems;
+    for (uint_fast64_t i = 0; i < assumptions.size(); ++i) {
+        auto const& assumption = assumptions[i];
+        STORM_LOG_THROW(
+            assumption->getRelationType() == expressions::RelationType::Greater || assumption->getRelationType() == expressions::RelationType::Equal,
+            exceptions::NotSupportedException, "Only Greater Or Equal assumptions supported");
+        uint_fast64_t val1 = std::stoull(assumption->getFirstOperand()->asVariableExpression().getVariableName());
+        uint_fast64_t val2 = std::stoull(assumption->getSecondOperand()->asVariableExpression().getVariableName());
+        AssumptionStatus sampleResult = AssumptionStatus::UNKNOWN;
+        if (useSamples) {
+            sampleResult = checkOnSamples(assumption);
+        }
+        result[i] = checkOnBounds(val1, val2, assumption, minValues, maxValues);
+        if (result[i] == AssumptionStatus::UNKNOWN) {
+            result[i] = sampleResult;
+            if (sampleResult == AssumptionStatus::UNKNOWN) {
+                auto problem = createSmtProblem(val1, val2, assumption, order, region, minValues, maxValues);
+                if (problem) {
+                    toSolve.push_back(i);
+                    problems.push_back(std::move(*problem));
+                }
+            }
+        }
+    }
+
+    // Every problem lives in its own expression manager and is solved by its own solver instance, so they can be solved concurrently.
+#ifdef STORM_HAVE_INTELTBB
+    tbb::parallel_for(tbb::blocked_range<uint_fast64_t>(0, problems.size()), [&](tbb::blocked_range<uint_fast64_t> const& range) {
+        for (uint_fast64_t j = range.begin(); j < range.end(); ++j) {
+            result[toSolve[j]] = solveSmtProblem(problems[j]);
+        }
+    });
+#else
+    for (uint_fast64_t j = 0; j < problems.size(); ++j) {
+        result[toSolve[j]] = solveSmtProblem(problems[j]);
+    }
+#endif
+    return result;
+}
+
+template<typename ValueType, typename ConstantType>
+AssumptionStatus AssumptionChecker<ValueType, ConstantType>::checkOnBounds(uint_fast64_t val1, uint_fast64_t val2,
+                                                                           std::shared_ptr<expressions::BinaryRelationExpression> assumption,
+                                                                           std::vector<ConstantType> const& minValues,
+                                                                           std::vector<ConstantType> const& maxValues) const {
     if (minValues.size() != 0) {
         if (assumption->getRelationType() == expressions::RelationType::Greater) {
             if (minValues[val1] > maxValues[val2]) {
@@ -106,18 +178,7 @@ AssumptionStatus AssumptionChecker<ValueType, ConstantType>::validateAssumption(
             }
         }
     }
-
-    if (result == AssumptionStatus::UNKNOWN) {
-        // If result from sample checking was unknown, the assumption might hold
-        std::set<expressions::Variable> vars = std::set<expressions::Variable>({});
-        assumption->gatherVariables(vars);
-
-        STORM_LOG_THROW(
-            assumption->getRelationType() == expressions::RelationType::Greater || assumption->getRelationType() == expressions::RelationType::Equal,
-            exceptions::NotSupportedException, "Only Greater Or Equal assumptions supported");
-        result = validateAssumptionSMTSolver(val1, val2, assumption, order, region, minValues, maxValues);
-    }
-    return result;
+    return AssumptionStatus::UNKNOWN;
 }
 
 template<typename ValueType, typename ConstantType>
@@ -145,9 +206,18 @@ template<typename ValueType, typename ConstantType>
 AssumptionStatus AssumptionChecker<ValueType, ConstantType>::validateAssumptionSMTSolver(
     uint_fast64_t val1, uint_fast64_t val2, std::shared_ptr<expressions::BinaryRelationExpression> assumption, std::shared_ptr<Order> order,
     storage::ParameterRegion<ValueType> region, std::vector<ConstantType> const minValues, std::vector<ConstantType> const maxValues) const {
-    std::shared_ptr<utility::solver::SmtSolverFactory> smtSolverFactory = std::make_shared<utility::solver::MathsatSmtSolverFactory>();
+    auto problem = createSmtProblem(val1, val2, assumption, order, region, minValues, maxValues);
+    if (!problem) {
+        return AssumptionStatus::UNKNOWN;
+    }
+    return solveSmtProblem(*problem);
+}
+
+template<typename ValueType, typename ConstantType>
+std::optional<typename AssumptionChecker<ValueType, ConstantType>::SmtProblem> AssumptionChecker<ValueType, ConstantType>::createSmtProblem(
+    uint_fast64_t val1, uint_fast64_t val2, std::shared_ptr<expressions::BinaryRelationExpression> assumption, std::shared_ptr<Order> order,
+    storage::ParameterRegion<ValueType> region, std::vector<ConstantType> const& minValues, std::vector<ConstantType> const& maxValues) const {
     std::shared_ptr<expressions::ExpressionManager> manager(new expressions::ExpressionManager());
-    AssumptionStatus result = AssumptionStatus::UNKNOWN;
     auto var1 = assumption->getFirstOperand()->asVariableExpression().getVariableName();
     auto var2 = assumption->getSecondOperand()->asVariableExpression().getVariableName();
     auto row1 = matrix.getRow(val1);
@@ -231,82 +301,90 @@ AssumptionStatus AssumptionChecker<ValueType, ConstantType>::validateAssumptionS
         }
     }
 
-    if (orderKnown) {
-        solver::Z3SmtSolver s(*manager);
-        auto valueTypeToExpression = expressions::RationalFunctionToExpression<ValueType>(manager);
-        expressions::Expression expr1 = manager->rational(0);
-        for (auto itr1 = row1.begin(); itr1 != row1.end(); ++itr1) {
-            expr1 = expr1 + (valueTypeToExpression.toExpression(itr1->getValue()) * manager->getVariable("s" + std::to_string(itr1->getColumn())));
-        }
+    if (!orderKnown) {
+        return std::nullopt;
+    }
 
-        expressions::Expression expr2 = manager->rational(0);
-        for (auto itr2 = row2.begin(); itr2 != row2.end(); ++itr2) {
-            expr2 = expr2 + (valueTypeToExpression.toExpression(itr2->getValue()) * manager->getVariable("s" + std::to_string(itr2->getColumn())));
-        }
+    auto valueTypeToExpression = expressions::RationalFunctionToExpression<ValueType>(manager);
+    expressions::Expression expr1 = manager->rational(0);
+    for (auto itr1 = row1.begin(); itr1 != row1.end(); ++itr1) {
+        expr1 = expr1 + (valueTypeToExpression.toExpression(itr1->getValue()) * manager->getVariable("s" + std::to_string(itr1->getColumn())));
+    }
 
-        // Create expression for the assumption based on the relation to successors
-        // It is the negation of actual assumption
+    expressions::Expression expr2 = manager->rational(0);
+    for (auto itr2 = row2.begin(); itr2 != row2.end(); ++itr2) {
+        expr2 = expr2 + (valueTypeToExpression.toExpression(itr2->getValue()) * manager->getVariable("s" + std::to_string(itr2->getColumn())));
+    }
 
-        expressions::Expression exprToCheck;
-        if (assumption->getRelationType() == expressions::RelationType::Greater) {
-            exprToCheck = expr1 <= expr2;
-        } else {
-            assert(assumption->getRelationType() == expressions::RelationType::Equal);
-            exprToCheck = expr1 != expr2;
-        }
+    // Create expression for the assumption based on the relation to successors
+    // It is the negation of actual assumption
 
-        auto variables = manager->getVariables();
-        // Bounds for the state probabilities and parameters
-        expressions::Expression exprBounds = manager->boolean(true);
-        if (addVar1) {
-            exprBounds = exprBounds && (manager->getVariable("s" + var1) == expr1);
-        }
-        if (addVar2) {
-            exprBounds = exprBounds && (manager->getVariable("s" + var2) == expr2);
-        }
-        for (auto var : variables) {
-            if (find(stateVariables.begin(), stateVariables.end(), var) != stateVariables.end()) {
-                // the var is a state
-                if (minValues.size() > 0) {
-                    std::string test = var.getName();
-                    auto val = std::stoi(test.substr(1, test.size() - 1));
-                    exprBounds = exprBounds && manager->rational(minValues[val]) <= var && var <= manager->rational(maxValues[val]);
-                } else {
-                    exprBounds = exprBounds && manager->rational(0) <= var && var <= manager->rational(1);
-                }
-            } else if (find(topVariables.begin(), topVariables.end(), var) != topVariables.end()) {
-                // the var is =)
-                exprBounds = exprBounds && var == manager->rational(1);
-            } else if (find(bottomVariables.begin(), bottomVariables.end(), var) != bottomVariables.end()) {
-                // the var is =(
-                exprBounds = exprBounds && var == manager->rational(0);
+    expressions::Expression exprToCheck;
+    if (assumption->getRelationType() == expressions::RelationType::Greater) {
+        exprToCheck = expr1 <= expr2;
+    } else {
+        assert(assumption->getRelationType() == expressions::RelationType::Equal);
+        exprToCheck = expr1 != expr2;
+    }
+
+    auto variables = manager->getVariables();
+    // Bounds for the state probabilities and parameters
+    expressions::Expression exprBounds = manager->boolean(true);
+    if (addVar1) {
+        exprBounds = exprBounds && (manager->getVariable("s" + var1) == expr1);
+    }
+    if (addVar2) {
+        exprBounds = exprBounds && (manager->getVariable("s" + var2) == expr2);
+    }
+    for (auto var : variables) {
+        if (find(stateVariables.begin(), stateVariables.end(), var) != stateVariables.end()) {
+            // the var is a state
+            if (minValues.size() > 0) {
+                std::string test = var.getName();
+                auto val = std::stoi(test.substr(1, test.size() - 1));
+                exprBounds = exprBounds && manager->rational(minValues[val]) <= var && var <= manager->rational(maxValues[val]);
             } else {
-                // the var is a parameter
-                auto lb = utility::convertNumber<RationalNumber>(region.getLowerBoundary(var.getName()));
-                auto ub = utility::convertNumber<RationalNumber>(region.getUpperBoundary(var.getName()));
-                exprBounds = exprBounds && manager->rational(lb) < var && var < manager->rational(ub);
+                exprBounds = exprBounds && manager->rational(0) <= var && var <= manager->rational(1);
             }
+        } else if (find(topVariables.begin(), topVariables.end(), var) != topVariables.end()) {
+            // the var is =)
+            exprBounds = exprBounds && var == manager->rational(1);
+        } else if (find(bottomVariables.begin(), bottomVariables.end(), var) != bottomVariables.end()) {
+            // the var is =(
+            exprBounds = exprBounds && var == manager->rational(0);
+        } else {
+            // the var is a parameter
+            auto lb = utility::convertNumber<RationalNumber>(region.getLowerBoundary(var.getName()));
+            auto ub = utility::convertNumber<RationalNumber>(region.getUpperBoundary(var.getName()));
+            exprBounds = exprBounds && manager->rational(lb) < var && var < manager->rational(ub);
         }
+    }
 
-        s.add(exprOrderSucc);
-        s.add(exprBounds);
-        s.setTimeout(100);
-        // assert that sorting of successors in the order and the bounds on the expression are at least satisfiable
-        // when this is not the case, the order is invalid
-        // however, it could be that the sat solver didn't finish in time, in that case we just continue.
-        if (s.check() == solver::SmtSolver::CheckResult::Unsat) {
-            return AssumptionStatus::INVALID;
-        }
-        assert(s.check() != solver::SmtSolver::CheckResult::Unsat);
+    return SmtProblem{manager, exprOrderSucc, exprBounds, exprToCheck};
+}
 
-        s.add(exprToCheck);
-        auto smtRes = s.check();
-        if (smtRes == solver::SmtSolver::CheckResult::Unsat) {
-            // If there is no thing satisfying the negation we are safe.
-            result = AssumptionStatus::VALID;
-        } else if (smtRes == solver::SmtSolver::CheckResult::Sat) {
-            result = AssumptionStatus::INVALID;
-        }
+template<typename ValueType, typename ConstantType>
+AssumptionStatus AssumptionChecker<ValueType, ConstantType>::solveSmtProblem(SmtProblem const& problem) const {
+    AssumptionStatus result = AssumptionStatus::UNKNOWN;
+    solver::Z3SmtSolver s(*problem.manager);
+    s.add(problem.exprOrderSucc);
+    s.add(problem.exprBounds);
+    s.setTimeout(100);
+    // assert that sorting of successors in the order and the bounds on the expression are at least satisfiable
+    // when this is not the case, the order is invalid
+    // however, it could be that the sat solver didn't finish in time, in that case we just continue.
+    if (s.check() == solver::SmtSolver::CheckResult::Unsat) {
+        return AssumptionStatus::INVALID;
+    }
+    assert(s.check() != solver::SmtSolver::CheckResult::Unsat);
+
+    s.add(problem.exprToCheck);
+    auto smtRes = s.check();
+    if (smtRes == solver::SmtSolver::CheckResult::Unsat) {
+        // If there is no thing satisfying the negation we are safe.
+        result = AssumptionStatus::VALID;
+    } else if (smtRes == solver::SmtSolver::CheckResult::Sat) {
+        result = AssumptionStatus::INVALID;
     }
     return result;
 }
@@ -1,6 +1,8 @@
 #ifndef STORM_ASSUMPTIONCHECKER_H
 #define STORM_ASSUMPTIONCHECKER_H
 
+#include <optional>
+
 #include "Order.h"
 #include "storm-pars/storage/ParameterRegion.h"
 #include "storm/environment/Environment.h"
@@ -9,6 +11,7 @@
 #include "storm/models/sparse/Mdp.h"
 #include "storm/storage/SparseMatrix.h"
 #include "storm/storage/expressions/BinaryRelationExpression.h"
+#include "storm/storage/expressions/Expression.h"
 
 namespace storm {
 namespace analysis {
@@ -76,7 +79,32 @@ class AssumptionChecker {
     AssumptionStatus validateAssumption(std::shared_ptr<expressions::BinaryRelationExpression> assumption, std::shared_ptr<Order> order,
                                         storage::ParameterRegion<ValueType> region) const;
 
+    /*!
+     * Validates several assumptions at once. The checks on samples and on the min/max values are done sequentially,
+     * the remaining assumptions are validated by independent smt solver calls, which run in parallel if TBB is available.
+     *
+     * @param assumptions The assumptions to validate.
+     * @param order The order.
+     * @param region The region of the considered model.
+     * @param minValues The minimal values of the states (or empty).
+     * @param maxValues The maximal values of the states (or empty).
+     * @return For each assumption AssumptionStatus::VALID, or AssumptionStatus::UNKNOWN, or AssumptionStatus::INVALID
+     */
+    std::vector<AssumptionStatus> validateAssumptions(std::vector<std::shared_ptr<expressions::BinaryRelationExpression>> const& assumptions,
+                                                      std::shared_ptr<Order> order, storage::ParameterRegion<ValueType> region,
+                                                      std::vector<ConstantType> const minValues, std::vector<ConstantType> const maxValues) const;
+
    private:
+    /*!
+     * The smt encoding of an assumption. Each problem has its own expression manager, such that problems can be solved independently.
+     */
+    struct SmtProblem {
+        std::shared_ptr<expressions::ExpressionManager> manager;
+        expressions::Expression exprOrderSucc;
+        expressions::Expression exprBounds;
+        expressions::Expression exprToCheck;
+    };
+
     bool useSamples;
 
     std::vector<std::vector<ConstantType>> samples;
@@ -87,6 +115,15 @@ class AssumptionChecker {
                                                  std::shared_ptr<Order> order, storage::ParameterRegion<ValueType> region,
                                                  std::vector<ConstantType> const minValues, std::vector<ConstantType> const maxValue) const;
 
+    std::optional<SmtProblem> createSmtProblem(uint_fast64_t val1, uint_fast64_t val2, std::shared_ptr<expressions::BinaryRelationExpression> assumption,
+                                               std::shared_ptr<Order> order, storage::ParameterRegion<ValueType> region,
+                                               std::vector<ConstantType> const& minValues, std::vector<ConstantType> const& maxValues) const;
+
+    AssumptionStatus solveSmtProblem(SmtProblem const& problem) const;
+
+    AssumptionStatus checkOnBounds(uint_fast64_t val1, uint_fast64_t val2, std::shared_ptr<expressions::BinaryRelationExpression> assumption,
+                                   std::vector<ConstantType> const& minValues, std::vector<ConstantType> const& maxValues) const;
+
     AssumptionStatus checkOnSamples(std::shared_ptr<expressions::BinaryRelationExpression> assumption) const;
 };
 }  // namespace analysis
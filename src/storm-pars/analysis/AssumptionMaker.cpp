@@ -26,41 +26,20 @@ std::map<std::shared_ptr<expressions::BinaryRelationExpression>, AssumptionStatu
     std::map<std::shared_ptr<expressions::BinaryRelationExpression>, AssumptionStatus> result;
     STORM_LOG_INFO("Creating assumptions for " << val1 << " and " << val2);
     assert(order->compare(val1, val2) == Order::UNKNOWN);
-    auto assumption = createAndCheckAssumption(val1, val2, expressions::RelationType::Greater, order, region, minValues, maxValues);
-    if (assumption.second != AssumptionStatus::INVALID) {
-        result.insert(assumption);
-        if (assumption.second == AssumptionStatus::VALID) {
-            assert(createAndCheckAssumption(val2, val1, expressions::RelationType::Greater, order, region, minValues, maxValues).second !=
-                       AssumptionStatus::VALID &&
-                   createAndCheckAssumption(val1, val2, expressions::RelationType::Equal, order, region, minValues, maxValues).second !=
-                       AssumptionStatus::VALID);
-            STORM_LOG_INFO("Assumption " << assumption.first << "is valid\n");
-            return result;
-        }
-    }
-    assert(order->compare(val1, val2) == Order::UNKNOWN);
-    assumption = createAndCheckAssumption(val2, val1, expressions::RelationType::Greater, order, region, minValues, maxValues);
-    if (assumption.second != AssumptionStatus::INVALID) {
-        if (assumption.second == AssumptionStatus::VALID) {
-            result.clear();
-            result.insert(assumption);
-            assert(createAndCheckAssumption(val1, val2, expressions::RelationType::Equal, order, region, minValues, maxValues).second !=
-                   AssumptionStatus::VALID);
-            STORM_LOG_INFO("Assumption " << assumption.first << "is valid\n");
-            return result;
-        }
-        result.insert(assumption);
-    }
-    assert(order->compare(val1, val2) == Order::UNKNOWN);
-    assumption = createAndCheckAssumption(val1, val2, expressions::RelationType::Equal, order, region, minValues, maxValues);
-    if (assumption.second != AssumptionStatus::INVALID) {
-        if (assumption.second == AssumptionStatus::VALID) {
+    std::vector<std::shared_ptr<expressions::BinaryRelationExpression>> assumptions = {createAssumption(val1, val2, expressions::RelationType::Greater),
+                                                                                         createAssumption(val2, val1, expressions::RelationType::Greater),
+                                                                                         createAssumption(val1, val2, expressions::RelationType::Equal)};
+    // The three candidates are validated together, such that the smt checks can be done in parallel
+    auto validationResults = assumptionChecker.validateAssumptions(assumptions, order, region, minValues, maxValues);
+    for (uint_fast64_t i = 0; i < assumptions.size(); ++i) {
+        if (validationResults[i] == AssumptionStatus::VALID) {
             result.clear();
-            result.insert(assumption);
-            STORM_LOG_INFO("Assumption " << assumption.first << "is valid\n");
+            result.insert({assumptions[i], validationResults[i]});
+            STORM_LOG_INFO("Assumption " << assumptions[i] << "is valid\n");
             return result;
+        } else if (validationResults[i] != AssumptionStatus::INVALID) {
+            result.insert({assumptions[i], validationResults[i]});
         }
-        result.insert(assumption);
     }
     assert(order->compare(val1, val2) == Order::UNKNOWN);
     STORM_LOG_INFO("None of the assumptions is valid, number of possible assumptions:  " << result.size() << '\n');
@@ -80,17 +59,14 @@ void AssumptionMaker<ValueType, ConstantType>::setSampleValues(std::vector<std::
 }
 
 template<typename ValueType, typename ConstantType>
-std::pair<std::shared_ptr<expressions::BinaryRelationExpression>, AssumptionStatus> AssumptionMaker<ValueType, ConstantType>::createAndCheckAssumption(
-    uint_fast64_t val1, uint_fast64_t val2, expressions::RelationType relationType, std::shared_ptr<Order> order, storage::ParameterRegion<ValueType> region,
-    std::vector<ConstantType> const minValues, std::vector<ConstantType> const maxValues) const {
+std::shared_ptr<expressions::BinaryRelationExpression> AssumptionMaker<ValueType, ConstantType>::createAssumption(
+    uint_fast64_t val1, uint_fast64_t val2, expressions::RelationType relationType) const {
     assert(val1 != val2);
     expressions::Variable var1 = expressionManager->getVariable(std::to_string(val1));
     expressions::Variable var2 = expressionManager->getVariable(std::to_string(val2));
-    auto assumption = std::make_shared<expressions::BinaryRelationExpression>(
+    return std::make_shared<expressions::BinaryRelationExpression>(
         expressions::BinaryRelationExpression(*expressionManager, expressionManager->getBooleanType(), var1.getExpression().getBaseExpressionPointer(),
                                               var2.getExpression().getBaseExpressionPointer(), relationType));
-    AssumptionStatus validationResult = assumptionChecker.validateAssumption(val1, val2, assumption, order, region, minValues, maxValues);
-    return std::pair<std::shared_ptr<expressions::BinaryRelationExpression>, AssumptionStatus>(assumption, validationResult);
 }
 
 template class AssumptionMaker<RationalFunction, double>;
@@ -59,9 +59,8 @@ class AssumptionMaker {
     void setSampleValues(std::vector<std::vector<ConstantType>> const& samples);
 
    private:
-    std::pair<std::shared_ptr<expressions::BinaryRelationExpression>, AssumptionStatus> createAndCheckAssumption(
-        uint_fast64_t val1, uint_fast64_t val2, expressions::RelationType relationType, std::shared_ptr<Order> order,
-        storage::ParameterRegion<ValueType> region, std::vector<ConstantType> const minValues, std::vector<ConstantType> const maxValue) const;
+    std::shared_ptr<expressions::BinaryRelationExpression> createAssumption(uint_fast64_t val1, uint_fast64_t val2,
+                                                                           expressions::RelationType relationType) const;
 
     AssumptionChecker<ValueType, ConstantType> assumptionChecker;
 
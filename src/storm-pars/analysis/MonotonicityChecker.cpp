@@ -165,16 +165,31 @@ std::pair<bool, bool> MonotonicityChecker<ValueType>::checkDerivative(ValueType
 template<typename ValueType>
 typename MonotonicityChecker<ValueType>::Monotonicity MonotonicityChecker<ValueType>::checkTransitionMonRes(
     ValueType function, typename MonotonicityChecker<ValueType>::VariableType param, typename MonotonicityChecker<ValueType>::Region region) {
+    auto& cachedResults = transitionMonotonicities[function][param];
+    for (auto const& cachedResult : cachedResults) {
+        // Monotonicity carries over to subregions. Non-monotonicity is only reused for the same region.
+        if (cachedResult.first.isSubRegion(region) && (cachedResult.second != Monotonicity::Not || region.isSubRegion(cachedResult.first))) {
+            return cachedResult.second;
+        }
+    }
+
+    Monotonicity result;
     std::pair<bool, bool> res = MonotonicityChecker<ValueType>::checkDerivative(getDerivative(function, param), region);
     if (res.first && !res.second) {
-        return Monotonicity::Incr;
+        result = Monotonicity::Incr;
     } else if (!res.first && res.second) {
-        return Monotonicity::Decr;
+        result = Monotonicity::Decr;
     } else if (res.first && res.second) {
-        return Monotonicity::Constant;
+        result = Monotonicity::Constant;
     } else {
-        return Monotonicity::Not;
+        result = Monotonicity::Not;
+    }
+
+    if (cachedResults.size() >= maximalNumberOfCachedRegions) {
+        cachedResults.erase(cachedResults.begin());
     }
+    cachedResults.emplace_back(std::move(region), result);
+    return result;
 }
 
 template<typename ValueType>
@@ -63,6 +63,13 @@ class MonotonicityChecker {
     storage::SparseMatrix<ValueType> matrix;
 
     boost::container::flat_map<ValueType, boost::container::flat_map<VariableType, ValueType>> derivatives;
+
+    // The monotonicity of transition functions together with the regions on which they were determined.
+    // Monotonicity on a region carries over to its subregions, so the (expensive) sign checks of the derivatives are only done once per refinement path.
+    boost::container::flat_map<ValueType, boost::container::flat_map<VariableType, std::vector<std::pair<Region, Monotonicity>>>> transitionMonotonicities;
+
+    // The maximal number of regions for which the monotonicity of a transition function is stored.
+    static const uint_fast64_t maximalNumberOfCachedRegions = 16;
 };
 }  // namespace analysis
 }  // namespace storm
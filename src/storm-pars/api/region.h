@@ -44,6 +44,21 @@ struct MonotonicitySetting {
     }
 };
 
+struct RefinementPersistenceSetting {
+    boost::optional<std::string> checkpointFile;   // If set, checkpoints of the refinement are written to this file
+    uint64_t checkpointInterval;                   // The number of analyzed regions between two checkpoints
+    bool resumeFromCheckpoint;                     // If set and the checkpoint file exists, the refinement is resumed from the checkpoint
+    boost::optional<std::string> resultCacheFile;  // If set, region results are taken from (and stored in) this file
+
+    explicit RefinementPersistenceSetting(boost::optional<std::string> const& checkpointFile = boost::none, uint64_t checkpointInterval = 1000,
+                                          bool resumeFromCheckpoint = false, boost::optional<std::string> const& resultCacheFile = boost::none) {
+        this->checkpointFile = checkpointFile;
+        this->checkpointInterval = checkpointInterval;
+        this->resumeFromCheckpoint = resumeFromCheckpoint;
+        this->resultCacheFile = resultCacheFile;
+    }
+};
+
 template<typename ValueType>
 std::vector<storm::storage::ParameterRegion<ValueType>> parseRegions(
     std::string const& inputString, std::set<typename storm::storage::ParameterRegion<ValueType>::VariableType> const& consideredVariables) {
@@ -134,7 +149,8 @@ std::shared_ptr<storm::modelchecker::RegionModelChecker<ParametricType>> initial
     bool allowModelSimplification = true, bool preconditionsValidatedManually = false, MonotonicitySetting monotonicitySetting = MonotonicitySetting(),
     boost::optional<std::pair<std::set<typename storm::storage::ParameterRegion<ParametricType>::VariableType>,
                               std::set<typename storm::storage::ParameterRegion<ParametricType>::VariableType>>>
-        monotoneParameters = boost::none) {
+        monotoneParameters = boost::none,
+    bool useIntervalModel = false) {
     STORM_LOG_WARN_COND(preconditionsValidatedManually || storm::utility::parameterlifting::validateParameterLiftingSound(*model, task.getFormula()),
                         "Could not validate whether parameter lifting is applicable. Please validate manually...");
     STORM_LOG_WARN_COND(
@@ -159,7 +175,10 @@ std::shared_ptr<storm::modelchecker::RegionModelChecker<ParametricType>> initial
     // Obtain the region model checker
     std::shared_ptr<storm::modelchecker::RegionModelChecker<ParametricType>> checker;
     if (consideredModel->isOfType(storm::models::ModelType::Dtmc)) {
-        checker = std::make_shared<storm::modelchecker::SparseDtmcParameterLiftingModelChecker<storm::models::sparse::Dtmc<ParametricType>, ConstantType>>();
+        auto dtmcChecker =
+            std::make_shared<storm::modelchecker::SparseDtmcParameterLiftingModelChecker<storm::models::sparse::Dtmc<ParametricType>, ConstantType>>();
+        dtmcChecker->setUseIntervalModel(useIntervalModel);
+        checker = dtmcChecker;
         checker->setUseMonotonicity(monotonicitySetting.useMonotonicity);
         checker->setUseOnlyGlobal(monotonicitySetting.useOnlyGlobalMonotonicity);
         checker->setUseBounds(monotonicitySetting.useBoundsFromPLA);
@@ -169,6 +188,7 @@ std::shared_ptr<storm::modelchecker::RegionModelChecker<ParametricType>> initial
     } else if (consideredModel->isOfType(storm::models::ModelType::Mdp)) {
         STORM_LOG_WARN_COND(!monotonicitySetting.useMonotonicity,
                             "Usage of monotonicity not supported for this type of model, continuing without montonicity checking");
+        STORM_LOG_WARN_COND(!useIntervalModel, "Interval models are not supported for this type of model, lifting to a game instead");
         checker = std::make_shared<storm::modelchecker::SparseMdpParameterLiftingModelChecker<storm::models::sparse::Mdp<ParametricType>, ConstantType>>();
     } else {
         STORM_LOG_THROW(false, storm::exceptions::InvalidOperationException, "Unable to perform parameterLifting on the provided model type.");
@@ -231,6 +251,9 @@ std::shared_ptr<storm::modelchecker::RegionModelChecker<ValueType>> initializeRe
         case storm::modelchecker::RegionCheckEngine::ExactParameterLifting:
             return initializeParameterLiftingRegionModelChecker<ValueType, storm::RationalNumber>(
                 env, model, task, generateSplitEstimates, allowModelSimplification, preconditionsValidated, monotonicitySetting, monotoneParameters);
+        case storm::modelchecker::RegionCheckEngine::RobustParameterLifting:
+            return initializeParameterLiftingRegionModelChecker<ValueType, double>(env, model, task, generateSplitEstimates, allowModelSimplification,
+                                                                                   preconditionsValidated, monotonicitySetting, monotoneParameters, true);
         case storm::modelchecker::RegionCheckEngine::ValidatingParameterLifting:
             // TODO should this also apply to monotonicity?
             STORM_LOG_WARN_COND(preconditionsValidated, "Preconditions are checked anyway by a valicating model checker...");
@@ -280,6 +303,7 @@ std::unique_ptr<storm::modelchecker::RegionCheckResult<ValueType>> checkRegionsW
  * @param allowModelSimplification
  * @param useMonotonicity
  * @param monThresh if given, determines at which depth to start using monotonicity
+ * @param persistenceSetting determines whether checkpoints of the refinement are written (or resumed) and whether region results are cached in a file
  */
 template<typename ValueType>
 std::unique_ptr<storm::modelchecker::RegionRefinementCheckResult<ValueType>> checkAndRefineRegionWithSparseEngine(
@@ -287,13 +311,59 @@ std::unique_ptr<storm::modelchecker::RegionRefinementCheckResult<ValueType>> che
     storm::storage::ParameterRegion<ValueType> const& region, storm::modelchecker::RegionCheckEngine engine,
     boost::optional<ValueType> const& coverageThreshold, boost::optional<uint64_t> const& refinementDepthThreshold = boost::none,
     storm::modelchecker::RegionResultHypothesis hypothesis = storm::modelchecker::RegionResultHypothesis::Unknown, bool allowModelSimplification = true,
-    MonotonicitySetting monotonicitySetting = MonotonicitySetting(), uint64_t monThresh = 0) {
+    MonotonicitySetting monotonicitySetting = MonotonicitySetting(), uint64_t monThresh = 0,
+    RefinementPersistenceSetting const& persistenceSetting = RefinementPersistenceSetting()) {
     Environment env;
     bool preconditionsValidated = false;
     auto regionChecker = initializeRegionModelChecker(env, model, task, engine, true, allowModelSimplification, preconditionsValidated, monotonicitySetting);
+    if (persistenceSetting.resultCacheFile) {
+        auto cache = std::make_shared<storm::modelchecker::RegionResultCache<ValueType>>(persistenceSetting.resultCacheFile.get());
+        regionChecker->setResultCache(cache, storm::modelchecker::RegionResultCache<ValueType>::getKey(*model, task.getFormula()));
+    }
+    if (persistenceSetting.checkpointFile) {
+        regionChecker->setCheckpointFile(persistenceSetting.checkpointFile.get(), persistenceSetting.checkpointInterval);
+        if (persistenceSetting.resumeFromCheckpoint && storm::utility::fileExistsAndIsReadable(persistenceSetting.checkpointFile.get())) {
+            auto checkpoint =
+                storm::modelchecker::RegionRefinementCheckpoint<ValueType>::readFromFile(persistenceSetting.checkpointFile.get(), region.getVariables());
+            STORM_LOG_THROW(checkpoint.getParameterSpace().toString() == region.toString() && checkpoint.getHypothesis() == hypothesis,
+                            storm::exceptions::InvalidOperationException,
+                            "The checkpoint in file " << persistenceSetting.checkpointFile.get() << " belongs to a different region or hypothesis.");
+            STORM_LOG_INFO("Resuming refinement from checkpoint with " << checkpoint.getUnprocessedRegions().size() << " unprocessed regions.");
+            return regionChecker->resumeRegionRefinement(env, std::move(checkpoint), coverageThreshold, refinementDepthThreshold, monThresh);
+        }
+    }
     return regionChecker->performRegionRefinement(env, region, coverageThreshold, refinementDepthThreshold, hypothesis, monThresh);
 }
 
+/*!
+ * Checks and iteratively refines the given region with the sparse engine, analyzing the subregions of one refinement depth concurrently.
+ * Each worker uses its own region model checker. Monotonicity is not considered.
+ * @param engine The considered region checking engine
+ * @param coverageThreshold if given, the refinement stops as soon as the fraction of the area of the subregions with inconclusive result is less then this
+ * threshold
+ * @param refinementDepthThreshold if given, the refinement stops at the given depth. depth=0 means no refinement.
+ * @param hypothesis if not 'unknown', it is only checked whether the hypothesis holds (and NOT the complementary result).
+ * @param allowModelSimplification
+ * @param numberOfWorkers the number of regions that are analyzed concurrently
+ */
+template<typename ValueType>
+std::unique_ptr<storm::modelchecker::RegionRefinementCheckResult<ValueType>> checkAndRefineRegionWithSparseEngineInParallel(
+    std::shared_ptr<storm::models::sparse::Model<ValueType>> const& model, storm::modelchecker::CheckTask<storm::logic::Formula, ValueType> const& task,
+    storm::storage::ParameterRegion<ValueType> const& region, storm::modelchecker::RegionCheckEngine engine,
+    boost::optional<ValueType> const& coverageThreshold, boost::optional<uint64_t> const& refinementDepthThreshold = boost::none,
+    storm::modelchecker::RegionResultHypothesis hypothesis = storm::modelchecker::RegionResultHypothesis::Unknown, bool allowModelSimplification = true,
+    uint64_t numberOfWorkers = 1) {
+    Environment env;
+    bool preconditionsValidated = false;
+    // The checkers are initialized sequentially as creating rational functions is not thread safe.
+    std::vector<std::shared_ptr<storm::modelchecker::RegionModelChecker<ValueType>>> regionCheckers;
+    for (uint64_t worker = 0; worker < std::max<uint64_t>(numberOfWorkers, 1); ++worker) {
+        regionCheckers.push_back(initializeRegionModelChecker(env, model, task, engine, true, allowModelSimplification, preconditionsValidated));
+    }
+    return storm::modelchecker::RegionModelChecker<ValueType>::performParallelRegionRefinement(env, regionCheckers, region, coverageThreshold,
+                                                                                               refinementDepthThreshold, hypothesis);
+}
+
 // TODO: update documentation
 /*!
  * Finds the extremal value in the given region
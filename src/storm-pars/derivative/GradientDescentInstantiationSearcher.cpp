@@ -320,9 +320,10 @@ ConstantType GradientDescentInstantiationSearcher<FunctionType, ConstantType>::s
                 break;
             }
 
+            // The derivatives of all parameters of the mini-batch are computed together.
+            auto checkResults = derivativeEvaluationHelper->checkMultipleParameters(env, nesterovPredictedPosition, miniBatch, valueVector);
             for (auto const& parameter : miniBatch) {
-                auto checkResult = derivativeEvaluationHelper->check(env, nesterovPredictedPosition, parameter, valueVector);
-                ConstantType delta = checkResult->getValueVector()[derivativeEvaluationHelper->getInitialState()];
+                ConstantType delta = checkResults.at(parameter)->getValueVector()[derivativeEvaluationHelper->getInitialState()];
                 if (synthesisTask->getBound().comparisonType == logic::ComparisonType::Less ||
                     synthesisTask->getBound().comparisonType == logic::ComparisonType::LessEqual) {
                     delta = -delta;
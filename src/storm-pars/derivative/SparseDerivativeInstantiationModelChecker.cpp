@@ -1,4 +1,5 @@
 #include "SparseDerivativeInstantiationModelChecker.h"
+#include "adapters/IntelTbbAdapter.h"
 #include "analysis/GraphConditions.h"
 #include "environment/Environment.h"
 #include "environment/solver/GmmxxSolverEnvironment.h"
@@ -21,6 +22,7 @@
 #include "storm/solver/LinearEquationSolver.h"
 #include "storm/utility/vector.h"
 #include "utility/constants.h"
+#include "utility/NumberTraits.h"
 #include "utility/graph.h"
 #include "utility/logging.h"
 
@@ -36,6 +38,92 @@ template<typename FunctionType, typename ConstantType>
 std::unique_ptr<modelchecker::ExplicitQuantitativeCheckResult<ConstantType>> SparseDerivativeInstantiationModelChecker<FunctionType, ConstantType>::check(
     Environment const& env, storm::utility::parametric::Valuation<FunctionType> const& valuation, VariableType<FunctionType> const& parameter,
     boost::optional<std::vector<ConstantType>> const& valueVector) {
+    std::vector<ConstantType> interestingReachabilityProbabilities = computeInterestingReachabilityProbabilities(env, valuation, valueVector);
+
+    // Instantiate the matrices with the given instantiation
+    instantiationWatch.start();
+    instantiateConstrainedMatrix(valuation);
+    std::vector<ConstantType> resultVec = computeRightHandSide(valuation, parameter, interestingReachabilityProbabilities);
+    instantiationWatch.stop();
+
+    approximationWatch.start();
+
+    // Here's where the real magic happens - the solver call!
+    storm::solver::GeneralLinearEquationSolverFactory<ConstantType> factory;
+    auto solver = factory.create(env);
+
+    // Calculate (1-M)^-1 * resultVec
+    solver->setMatrix(constrainedMatrixInstantiated);
+    std::vector<ConstantType> finalResult(resultVec.size());
+    solver->solveEquations(env, finalResult, resultVec);
+
+    approximationWatch.stop();
+
+    return std::make_unique<modelchecker::ExplicitQuantitativeCheckResult<ConstantType>>(finalResult);
+}
+
+template<typename FunctionType, typename ConstantType>
+std::map<VariableType<FunctionType>, std::unique_ptr<modelchecker::ExplicitQuantitativeCheckResult<ConstantType>>>
+SparseDerivativeInstantiationModelChecker<FunctionType, ConstantType>::checkMultipleParameters(
+    Environment const& env, storm::utility::parametric::Valuation<FunctionType> const& valuation, std::vector<VariableType<FunctionType>> const& parameters,
+    boost::optional<std::vector<ConstantType>> const& valueVector) {
+    std::vector<ConstantType> interestingReachabilityProbabilities = computeInterestingReachabilityProbabilities(env, valuation, valueVector);
+
+    // All equation systems share the matrix and only differ in their right-hand sides.
+    // The instantiation is done sequentially as evaluating the functions is not necessarily thread safe.
+    instantiationWatch.start();
+    instantiateConstrainedMatrix(valuation);
+    std::vector<std::vector<ConstantType>> rightHandSides;
+    rightHandSides.reserve(parameters.size());
+    for (auto const& parameter : parameters) {
+        rightHandSides.push_back(computeRightHandSide(valuation, parameter, interestingReachabilityProbabilities));
+    }
+    instantiationWatch.stop();
+
+    approximationWatch.start();
+    storm::solver::GeneralLinearEquationSolverFactory<ConstantType> factory;
+    auto createSolver = [&]() {
+        auto solver = factory.create(env);
+        // Keep preconditioners, factorizations and auxiliary data between the right-hand sides.
+        solver->setCachingEnabled(true);
+        solver->setMatrix(constrainedMatrixInstantiated);
+        return solver;
+    };
+    std::vector<std::vector<ConstantType>> solutions(parameters.size(), std::vector<ConstantType>(constrainedMatrixInstantiated.getRowCount()));
+#ifdef STORM_HAVE_INTELTBB
+    // Exact numbers might share reference counted data, so they are not solved concurrently.
+    if (!storm::NumberTraits<ConstantType>::IsExact && parameters.size() > 1) {
+        // Each thread uses its own solver
+        tbb::enumerable_thread_specific<std::unique_ptr<storm::solver::LinearEquationSolver<ConstantType>>> threadSolvers;
+        tbb::parallel_for(tbb::blocked_range<uint64_t>(0, parameters.size(), 1), [&](tbb::blocked_range<uint64_t> const& range) {
+            auto& solver = threadSolvers.local();
+            if (!solver) {
+                solver = createSolver();
+            }
+            for (uint64_t i = range.begin(); i < range.end(); ++i) {
+                solver->solveEquations(env, solutions[i], rightHandSides[i]);
+            }
+        });
+    } else
+#endif
+    {
+        auto solver = createSolver();
+        for (uint64_t i = 0; i < parameters.size(); ++i) {
+            solver->solveEquations(env, solutions[i], rightHandSides[i]);
+        }
+    }
+    approximationWatch.stop();
+
+    std::map<VariableType<FunctionType>, std::unique_ptr<modelchecker::ExplicitQuantitativeCheckResult<ConstantType>>> result;
+    for (uint64_t i = 0; i < parameters.size(); ++i) {
+        result[parameters[i]] = std::make_unique<modelchecker::ExplicitQuantitativeCheckResult<ConstantType>>(std::move(solutions[i]));
+    }
+    return result;
+}
+
+template<typename FunctionType, typename ConstantType>
+std::vector<ConstantType> SparseDerivativeInstantiationModelChecker<FunctionType, ConstantType>::computeInterestingReachabilityProbabilities(
+    Environment const& env, storm::utility::parametric::Valuation<FunctionType> const& valuation, boost::optional<std::vector<ConstantType>> const& valueVector) {
     std::vector<ConstantType> reachabilityProbabilities;
     if (!valueVector.is_initialized()) {
         storm::modelchecker::SparseDtmcInstantiationModelChecker<storm::models::sparse::Dtmc<FunctionType>, ConstantType> instantiationModelChecker(model);
@@ -50,64 +138,45 @@ std::unique_ptr<modelchecker::ExplicitQuantitativeCheckResult<ConstantType>> Spa
     // Convert reachabilityProbabilities into our format - we only care for the states of which the
     // bits are 1 in the next vector. The order is kept, so doing this is fine:
     std::vector<ConstantType> interestingReachabilityProbabilities;
-    for (uint64_t i = 0; i < reachabilityProbabilities.size(); i++) {
-        if (next.get(i)) {
-            interestingReachabilityProbabilities.push_back(reachabilityProbabilities[i]);
-        }
+    interestingReachabilityProbabilities.reserve(next.getNumberOfSetBits());
+    for (auto const& state : next) {
+        interestingReachabilityProbabilities.push_back(reachabilityProbabilities[state]);
     }
-    // Instantiate the matrices with the given instantiation
-
-    instantiationWatch.start();
-
-    // STORM_PRINT_AND_LOG(valuation << "\n");
+    return interestingReachabilityProbabilities;
+}
 
+template<typename FunctionType, typename ConstantType>
+void SparseDerivativeInstantiationModelChecker<FunctionType, ConstantType>::instantiateConstrainedMatrix(
+    storm::utility::parametric::Valuation<FunctionType> const& valuation) {
     // Write results into the placeholders
     for (auto& functionResult : this->functionsUnderived) {
         functionResult.second = storm::utility::convertNumber<ConstantType>(storm::utility::parametric::evaluate(functionResult.first, valuation));
     }
-    for (auto& functionResult : this->functionsDerived.at(parameter)) {
-        functionResult.second = storm::utility::convertNumber<ConstantType>(storm::utility::parametric::evaluate(functionResult.first, valuation));
-    }
-
-    auto deltaConstrainedMatrixInstantiated = deltaConstrainedMatricesInstantiated->at(parameter);
-
-    // Write the instantiated values to the matrices and vectors according to the stored mappings
+    // Write the instantiated values to the matrix according to the stored mapping
     for (auto& entryValuePair : this->matrixMappingUnderived) {
         entryValuePair.first->setValue(*(entryValuePair.second));
     }
+}
+
+template<typename FunctionType, typename ConstantType>
+std::vector<ConstantType> SparseDerivativeInstantiationModelChecker<FunctionType, ConstantType>::computeRightHandSide(
+    storm::utility::parametric::Valuation<FunctionType> const& valuation, VariableType<FunctionType> const& parameter,
+    std::vector<ConstantType> const& interestingReachabilityProbabilities) {
+    for (auto& functionResult : this->functionsDerived.at(parameter)) {
+        functionResult.second = storm::utility::convertNumber<ConstantType>(storm::utility::parametric::evaluate(functionResult.first, valuation));
+    }
     for (auto& entryValuePair : this->matrixMappingsDerived.at(parameter)) {
         entryValuePair.first->setValue(*(entryValuePair.second));
     }
+    auto const& deltaConstrainedMatrixInstantiated = deltaConstrainedMatricesInstantiated->at(parameter);
 
-    std::vector<ConstantType> instantiatedDerivedOutputVec(derivedOutputVecs->at(parameter).size());
-    for (uint_fast64_t i = 0; i < derivedOutputVecs->at(parameter).size(); i++) {
-        instantiatedDerivedOutputVec[i] = utility::convertNumber<ConstantType>(derivedOutputVecs->at(parameter)[i].evaluate(valuation));
-    }
-
-    instantiationWatch.stop();
-
-    approximationWatch.start();
-
+    auto const& derivedOutputVec = derivedOutputVecs->at(parameter);
     std::vector<ConstantType> resultVec(interestingReachabilityProbabilities.size());
     deltaConstrainedMatrixInstantiated.multiplyWithVector(interestingReachabilityProbabilities, resultVec);
-    for (uint_fast64_t i = 0; i < instantiatedDerivedOutputVec.size(); ++i) {
-        resultVec[i] += instantiatedDerivedOutputVec[i];
+    for (uint_fast64_t i = 0; i < derivedOutputVec.size(); ++i) {
+        resultVec[i] += utility::convertNumber<ConstantType>(derivedOutputVec[i].evaluate(valuation));
     }
-
-    // Here's where the real magic happens - the solver call!
-    storm::solver::GeneralLinearEquationSolverFactory<ConstantType> factory;
-    auto solver = factory.create(env);
-
-    // Calculate (1-M)^-1 * resultVec
-    // STORM_PRINT_AND_LOG(constrainedMatrixInstantiated << "\n");
-    // STORM_PRINT_AND_LOG("calling solver\n");
-    solver->setMatrix(constrainedMatrixInstantiated);
-    std::vector<ConstantType> finalResult(resultVec.size());
-    solver->solveEquations(env, finalResult, resultVec);
-
-    approximationWatch.stop();
-
-    return std::make_unique<modelchecker::ExplicitQuantitativeCheckResult<ConstantType>>(finalResult);
+    return resultVec;
 }
 
 template<typename FunctionType, typename ConstantType>
@@ -47,6 +47,20 @@ class SparseDerivativeInstantiationModelChecker {
         typename utility::parametric::VariableType<FunctionType>::type const& parameter,
         boost::optional<std::vector<ConstantType>> const& valueVector = boost::none);
 
+    /**
+     * checkMultipleParameters calculates the derivatives of the model w.r.t. several parameters at an instantiation.
+     * The reachability probabilities and the equation system are only instantiated once. The equation systems of the parameters
+     * only differ in their right-hand sides, so solvers (and their preconditioners or factorizations) are reused for all of them.
+     * If Intel TBB is available and ConstantType is not exact, the systems are solved in parallel.
+     * Call specifyFormula first!
+     * @param env The environment.
+     * @return The derivatives, mapped by their parameters.
+     */
+    std::map<typename utility::parametric::VariableType<FunctionType>::type, std::unique_ptr<modelchecker::ExplicitQuantitativeCheckResult<ConstantType>>>
+    checkMultipleParameters(Environment const& env, storm::utility::parametric::Valuation<FunctionType> const& valuation,
+                            std::vector<typename utility::parametric::VariableType<FunctionType>::type> const& parameters,
+                            boost::optional<std::vector<ConstantType>> const& valueVector = boost::none);
+
     uint64_t getInitialState() {
         return initialStateEqSystem;
     }
@@ -84,6 +98,14 @@ class SparseDerivativeInstantiationModelChecker {
                                       std::unordered_map<FunctionType, ConstantType>& functions);
     void setup(Environment const& env, modelchecker::CheckTask<storm::logic::Formula, FunctionType> const& checkTask);
 
+    std::vector<ConstantType> computeInterestingReachabilityProbabilities(Environment const& env,
+                                                                          storm::utility::parametric::Valuation<FunctionType> const& valuation,
+                                                                          boost::optional<std::vector<ConstantType>> const& valueVector);
+    void instantiateConstrainedMatrix(storm::utility::parametric::Valuation<FunctionType> const& valuation);
+    std::vector<ConstantType> computeRightHandSide(storm::utility::parametric::Valuation<FunctionType> const& valuation,
+                                                   typename utility::parametric::VariableType<FunctionType>::type const& parameter,
+                                                   std::vector<ConstantType> const& interestingReachabilityProbabilities);
+
     utility::Stopwatch instantiationWatch;
     utility::Stopwatch approximationWatch;
     utility::Stopwatch generalSetupWatch;
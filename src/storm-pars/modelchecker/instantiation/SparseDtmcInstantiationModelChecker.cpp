@@ -1,12 +1,16 @@
 #include "storm-pars/modelchecker/instantiation/SparseDtmcInstantiationModelChecker.h"
 
 #include "storm/adapters/RationalFunctionAdapter.h"
+#include "storm/environment/solver/NativeSolverEnvironment.h"
+#include "storm/environment/solver/SolverEnvironment.h"
 #include "storm/exceptions/InvalidArgumentException.h"
 #include "storm/exceptions/InvalidStateException.h"
 #include "storm/logic/FragmentSpecification.h"
 #include "storm/modelchecker/hints/ExplicitModelCheckerHint.h"
 #include "storm/modelchecker/results/ExplicitQualitativeCheckResult.h"
 #include "storm/modelchecker/results/ExplicitQuantitativeCheckResult.h"
+#include "storm/utility/NumberTraits.h"
+#include "storm/utility/graph.h"
 #include "storm/utility/vector.h"
 
 namespace storm {
@@ -194,6 +198,143 @@ std::unique_ptr<CheckResult> SparseDtmcInstantiationModelChecker<SparseModelType
     return result;
 }
 
+template<typename SparseModelType, typename ConstantType>
+std::vector<std::unique_ptr<CheckResult>> SparseDtmcInstantiationModelChecker<SparseModelType, ConstantType>::checkBatch(
+    Environment const& env, std::vector<storm::utility::parametric::Valuation<typename SparseModelType::ValueType>> const& valuations) {
+    STORM_LOG_THROW(this->currentCheckTask, storm::exceptions::InvalidStateException, "Checking has been invoked but no property has been specified before.");
+    if (valuations.size() > 1 && canCheckReachabilityProbabilityFormulaBatch()) {
+        return checkReachabilityProbabilityFormulaBatch(env, valuations);
+    }
+    return SparseInstantiationModelChecker<SparseModelType, ConstantType>::checkBatch(env, valuations);
+}
+
+template<typename SparseModelType, typename ConstantType>
+bool SparseDtmcInstantiationModelChecker<SparseModelType, ConstantType>::canCheckReachabilityProbabilityFormulaBatch() const {
+    if (storm::NumberTraits<ConstantType>::IsExact || !this->getInstantiationsAreGraphPreserving()) {
+        return false;
+    }
+    auto const& formula = this->currentCheckTask->getFormula();
+    if (!formula.isProbabilityOperatorFormula()) {
+        return false;
+    }
+    auto const& pathFormula = formula.asProbabilityOperatorFormula().getSubformula();
+    auto propositional = storm::logic::propositional();
+    if (pathFormula.isReachabilityProbabilityFormula()) {
+        return pathFormula.asEventuallyFormula().getSubformula().isInFragment(propositional);
+    } else if (pathFormula.isUntilFormula()) {
+        return pathFormula.asUntilFormula().getLeftSubformula().isInFragment(propositional) &&
+               pathFormula.asUntilFormula().getRightSubformula().isInFragment(propositional);
+    }
+    return false;
+}
+
+template<typename SparseModelType, typename ConstantType>
+std::vector<std::unique_ptr<CheckResult>> SparseDtmcInstantiationModelChecker<SparseModelType, ConstantType>::checkReachabilityProbabilityFormulaBatch(
+    Environment const& env, std::vector<storm::utility::parametric::Valuation<typename SparseModelType::ValueType>> const& valuations) {
+    uint64_t const batchSize = valuations.size();
+    auto const& operatorFormula = this->currentCheckTask->getFormula().asProbabilityOperatorFormula();
+    auto const& pathFormula = operatorFormula.getSubformula();
+
+    // As the instantiations are graph preserving, the qualitative analysis is performed on the first instantiation.
+    auto const& firstModel = modelInstantiator.instantiate(valuations.front());
+    uint64_t const numberOfStates = firstModel.getNumberOfStates();
+    storm::storage::BitVector phiStates, psiStates;
+    {
+        storm::modelchecker::SparseDtmcPrctlModelChecker<storm::models::sparse::Dtmc<ConstantType>> modelChecker(firstModel);
+        if (pathFormula.isUntilFormula()) {
+            phiStates = modelChecker.check(env, pathFormula.asUntilFormula().getLeftSubformula())->asExplicitQualitativeCheckResult().getTruthValuesVector();
+            psiStates = modelChecker.check(env, pathFormula.asUntilFormula().getRightSubformula())->asExplicitQualitativeCheckResult().getTruthValuesVector();
+        } else {
+            phiStates = storm::storage::BitVector(numberOfStates, true);
+            psiStates =
+                modelChecker.check(env, pathFormula.asEventuallyFormula().getSubformula())->asExplicitQualitativeCheckResult().getTruthValuesVector();
+        }
+    }
+    auto statesWithProbability01 = storm::utility::graph::performProb01(firstModel, phiStates, psiStates);
+    storm::storage::BitVector maybeStates = ~(statesWithProbability01.first | statesWithProbability01.second);
+
+    // The structure of the transitions of the maybe states is shared by all instantiations.
+    // The value of the i-th entry for the j-th valuation is stored at position i * batchSize + j.
+    std::vector<uint64_t> rowStarts = {0};
+    std::vector<uint64_t> columns;
+    for (auto state : maybeStates) {
+        for (auto const& entry : firstModel.getTransitionMatrix().getRow(state)) {
+            columns.push_back(entry.getColumn());
+        }
+        rowStarts.push_back(columns.size());
+    }
+    std::vector<ConstantType> transitionValues(columns.size() * batchSize);
+    for (uint64_t sample = 0; sample < batchSize; ++sample) {
+        auto const& instantiatedModel = sample == 0 ? firstModel : modelInstantiator.instantiate(valuations[sample]);
+        STORM_LOG_THROW(instantiatedModel.getTransitionMatrix().isProbabilistic(), storm::exceptions::InvalidArgumentException,
+                        "Instantiation point is invalid as the transition matrix becomes non-stochastic.");
+        uint64_t entryIndex = 0;
+        for (auto state : maybeStates) {
+            for (auto const& entry : instantiatedModel.getTransitionMatrix().getRow(state)) {
+                transitionValues[entryIndex * batchSize + sample] = entry.getValue();
+                ++entryIndex;
+            }
+        }
+    }
+
+    // Gauss-Seidel value iteration on the values of all valuations, stored like the transition values.
+    auto precisionInfo = env.solver().getPrecisionOfLinearEquationSolver(env.solver().getLinearEquationSolverType());
+    ConstantType const precision =
+        precisionInfo.first ? storm::utility::convertNumber<ConstantType>(precisionInfo.first.get()) : storm::utility::convertNumber<ConstantType>(1e-6);
+    bool const relative = precisionInfo.second ? precisionInfo.second.get() : false;
+    uint64_t const maxIterations = env.solver().native().getMaximalNumberOfIterations();
+    std::vector<ConstantType> values(numberOfStates * batchSize, storm::utility::zero<ConstantType>());
+    for (auto state : statesWithProbability01.second) {
+        std::fill_n(values.begin() + state * batchSize, batchSize, storm::utility::one<ConstantType>());
+    }
+    std::vector<ConstantType> newValues(batchSize);
+    bool converged = maybeStates.empty();
+    uint64_t iterations = 0;
+    while (!converged && iterations < maxIterations) {
+        converged = true;
+        uint64_t row = 0;
+        for (auto state : maybeStates) {
+            std::fill(newValues.begin(), newValues.end(), storm::utility::zero<ConstantType>());
+            for (uint64_t entryIndex = rowStarts[row]; entryIndex < rowStarts[row + 1]; ++entryIndex) {
+                auto transitionIt = transitionValues.begin() + entryIndex * batchSize;
+                auto successorIt = values.begin() + columns[entryIndex] * batchSize;
+                for (uint64_t sample = 0; sample < batchSize; ++sample) {
+                    newValues[sample] += transitionIt[sample] * successorIt[sample];
+                }
+            }
+            auto valueIt = values.begin() + state * batchSize;
+            for (uint64_t sample = 0; sample < batchSize; ++sample) {
+                ConstantType difference = storm::utility::abs<ConstantType>(newValues[sample] - valueIt[sample]);
+                if (difference > (relative ? precision * newValues[sample] : precision)) {
+                    converged = false;
+                }
+                valueIt[sample] = newValues[sample];
+            }
+            ++row;
+        }
+        ++iterations;
+    }
+    STORM_LOG_WARN_COND(converged, "Batched value iteration did not converge within " << iterations << " iterations.");
+    STORM_LOG_INFO("Batched value iteration for " << batchSize << " valuations terminated after " << iterations << " iterations.");
+
+    std::vector<std::unique_ptr<CheckResult>> results;
+    results.reserve(batchSize);
+    for (uint64_t sample = 0; sample < batchSize; ++sample) {
+        std::vector<ConstantType> sampleValues(numberOfStates);
+        for (uint64_t state = 0; state < numberOfStates; ++state) {
+            sampleValues[state] = values[state * batchSize + sample];
+        }
+        auto quantitativeResult = std::make_unique<ExplicitQuantitativeCheckResult<ConstantType>>(std::move(sampleValues));
+        if (operatorFormula.hasQuantitativeResult()) {
+            results.push_back(std::move(quantitativeResult));
+        } else {
+            results.push_back(
+                quantitativeResult->compareAgainstBound(operatorFormula.getComparisonType(), operatorFormula.template getThresholdAs<ConstantType>()));
+        }
+    }
+    return results;
+}
+
 template class SparseDtmcInstantiationModelChecker<storm::models::sparse::Dtmc<storm::RationalFunction>, double>;
 template class SparseDtmcInstantiationModelChecker<storm::models::sparse::Dtmc<storm::RationalFunction>, storm::RationalNumber>;
 
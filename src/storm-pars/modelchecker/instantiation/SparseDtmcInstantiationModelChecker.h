@@ -2,6 +2,7 @@
 
 #include <boost/optional.hpp>
 #include <memory>
+#include <vector>
 
 #include "storm-pars/modelchecker/instantiation/SparseInstantiationModelChecker.h"
 #include "storm-pars/utility/ModelInstantiator.h"
@@ -23,6 +24,16 @@ class SparseDtmcInstantiationModelChecker : public SparseInstantiationModelCheck
     virtual std::unique_ptr<CheckResult> check(Environment const& env,
                                                storm::utility::parametric::Valuation<typename SparseModelType::ValueType> const& valuation) override;
 
+    /*!
+     * Checks the specified formula for each of the given valuations.
+     * If the instantiations are graph preserving, unbounded reachability probabilities are computed for all valuations at once:
+     * the transition probabilities of all instantiations are stored in one block that shares the structure of the transition matrix and
+     * a single value iteration updates the values of all valuations. This requires a non-exact ConstantType.
+     * Other formulas are checked one valuation after another.
+     */
+    virtual std::vector<std::unique_ptr<CheckResult>> checkBatch(
+        Environment const& env, std::vector<storm::utility::parametric::Valuation<typename SparseModelType::ValueType>> const& valuations) override;
+
    protected:
     // Optimizations for the different formula types
     std::unique_ptr<CheckResult> checkReachabilityProbabilityFormula(
@@ -32,6 +43,10 @@ class SparseDtmcInstantiationModelChecker : public SparseInstantiationModelCheck
     std::unique_ptr<CheckResult> checkBoundedUntilFormula(
         Environment const& env, storm::modelchecker::SparseDtmcPrctlModelChecker<storm::models::sparse::Dtmc<ConstantType>>& modelChecker);
 
+    bool canCheckReachabilityProbabilityFormulaBatch() const;
+    std::vector<std::unique_ptr<CheckResult>> checkReachabilityProbabilityFormulaBatch(
+        Environment const& env, std::vector<storm::utility::parametric::Valuation<typename SparseModelType::ValueType>> const& valuations);
+
     storm::utility::ModelInstantiator<SparseModelType, storm::models::sparse::Dtmc<ConstantType>> modelInstantiator;
 };
 }  // namespace modelchecker
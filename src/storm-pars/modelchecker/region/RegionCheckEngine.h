@@ -12,6 +12,7 @@ enum class RegionCheckEngine {
     ExactParameterLifting,      /*!< Parameter lifting approach with exact arithmethics*/
     ValidatingParameterLifting, /*!< Parameter lifting approach with a) inexact (and fast) computation first and b) exact validation of obtained results second
                                  */
+    RobustParameterLifting,     /*!< Parameter lifting approach where the lifted model is an interval model that is analyzed with robust value iteration */
 };
 
 std::ostream& operator<<(std::ostream& os, RegionCheckEngine const& regionCheckResult);
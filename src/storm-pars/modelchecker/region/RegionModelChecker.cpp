@@ -1,3 +1,7 @@
+#include <algorithm>
+#include <atomic>
+#include <iterator>
+#include <mutex>
 #include <queue>
 #include <sstream>
 #include <vector>
@@ -5,6 +9,7 @@
 #include "storm-pars/analysis/OrderExtender.cpp"
 #include "storm-pars/modelchecker/region/RegionModelChecker.h"
 
+#include "storm/adapters/IntelTbbAdapter.h"
 #include "storm/adapters/RationalFunctionAdapter.h"
 
 #include "storm/models/sparse/Dtmc.h"
@@ -37,7 +42,7 @@ std::unique_ptr<storm::modelchecker::RegionCheckResult<ParametricType>> RegionMo
     auto hypothesisIt = hypotheses.begin();
     for (auto const& region : regions) {
         storm::modelchecker::RegionResult regionRes =
-            analyzeRegion(env, region, *hypothesisIt, storm::modelchecker::RegionResult::Unknown, sampleVerticesOfRegion);
+            analyzeRegionWithCache(env, region, *hypothesisIt, storm::modelchecker::RegionResult::Unknown, sampleVerticesOfRegion);
         result.emplace_back(region, regionRes);
         ++hypothesisIt;
     }
@@ -57,6 +62,15 @@ std::unique_ptr<storm::modelchecker::RegionRefinementCheckResult<ParametricType>
     Environment const& env, storm::storage::ParameterRegion<ParametricType> const& region, boost::optional<ParametricType> const& coverageThreshold,
     boost::optional<uint64_t> depthThreshold, RegionResultHypothesis const& hypothesis, uint64_t monThresh) {
     STORM_LOG_INFO("Applying refinement on region: " << region.toString(true) << " .");
+    return resumeRegionRefinement(env, RegionRefinementCheckpoint<ParametricType>(region, hypothesis), coverageThreshold, depthThreshold, monThresh);
+}
+
+template<typename ParametricType>
+std::unique_ptr<storm::modelchecker::RegionRefinementCheckResult<ParametricType>> RegionModelChecker<ParametricType>::resumeRegionRefinement(
+    Environment const& env, RegionRefinementCheckpoint<ParametricType> checkpoint, boost::optional<ParametricType> const& coverageThreshold,
+    boost::optional<uint64_t> depthThreshold, uint64_t monThresh) {
+    auto const& region = checkpoint.getParameterSpace();
+    auto const& hypothesis = checkpoint.getHypothesis();
 
     auto thresholdAsCoefficient =
         coverageThreshold ? storm::utility::convertNumber<CoefficientType>(coverageThreshold.get()) : storm::utility::zero<CoefficientType>();
@@ -67,16 +81,27 @@ std::unique_ptr<storm::modelchecker::RegionRefinementCheckResult<ParametricType>
     numberOfRegionsKnownThroughMonotonicity = 0;
 
     // The resulting (sub-)regions
-    std::vector<std::pair<storm::storage::ParameterRegion<ParametricType>, RegionResult>> result;
+    std::vector<std::pair<storm::storage::ParameterRegion<ParametricType>, RegionResult>> result = std::move(checkpoint.getProcessedRegions());
+    for (auto const& processedRegion : result) {
+        if (processedRegion.second == RegionResult::AllSat) {
+            fractionOfUndiscoveredArea -= processedRegion.first.area() / areaOfParameterSpace;
+            fractionOfAllSatArea += processedRegion.first.area() / areaOfParameterSpace;
+        } else if (processedRegion.second == RegionResult::AllViolated) {
+            fractionOfUndiscoveredArea -= processedRegion.first.area() / areaOfParameterSpace;
+            fractionOfAllViolatedArea += processedRegion.first.area() / areaOfParameterSpace;
+        }
+    }
 
     // FIFO queues storing the data for the regions that we still need to process.
     std::queue<std::pair<storm::storage::ParameterRegion<ParametricType>, RegionResult>> unprocessedRegions;
 
     std::queue<uint64_t> refinementDepths;
-    unprocessedRegions.emplace(region, RegionResult::Unknown);
-    refinementDepths.push(0);
+    for (auto& unprocessedRegion : checkpoint.getUnprocessedRegions()) {
+        unprocessedRegions.emplace(std::move(unprocessedRegion.region), unprocessedRegion.result);
+        refinementDepths.push(unprocessedRegion.depth);
+    }
 
-    uint_fast64_t numOfAnalyzedRegions = 0;
+    uint_fast64_t numOfAnalyzedRegions = checkpoint.getNumberOfAnalyzedRegions();
     CoefficientType displayedProgress = storm::utility::zero<CoefficientType>();
     if (storm::settings::getModule<storm::settings::modules::CoreSettings>().isShowStatisticsSet()) {
         STORM_PRINT_AND_LOG("Progress (solved fraction) :\n"
@@ -95,7 +120,7 @@ std::unique_ptr<storm::modelchecker::RegionRefinementCheckResult<ParametricType>
     }
 
     // NORMAL WHILE LOOP
-    uint64_t currentDepth = refinementDepths.front();
+    uint64_t currentDepth = refinementDepths.empty() ? 0 : refinementDepths.front();
     while ((!useMonotonicity || currentDepth < monThresh) && fractionOfUndiscoveredArea > thresholdAsCoefficient && !unprocessedRegions.empty()) {
         assert(unprocessedRegions.size() == refinementDepths.size());
         STORM_LOG_INFO("Analyzing region #" << numOfAnalyzedRegions << " (Refinement depth " << currentDepth << "; "
@@ -104,7 +129,7 @@ std::unique_ptr<storm::modelchecker::RegionRefinementCheckResult<ParametricType>
         auto& res = unprocessedRegions.front().second;
         std::shared_ptr<storm::analysis::Order> order;
         std::shared_ptr<storm::analysis::LocalMonotonicityResult<VariableType>> localMonotonicityResult;
-        res = analyzeRegion(env, currentRegion, hypothesis, res, false);
+        res = analyzeRegionWithCache(env, currentRegion, hypothesis, res, false);
 
         switch (res) {
             case RegionResult::AllSat:
@@ -140,13 +165,16 @@ std::unique_ptr<storm::modelchecker::RegionRefinementCheckResult<ParametricType>
         ++numOfAnalyzedRegions;
         unprocessedRegions.pop();
         refinementDepths.pop();
+        if (checkpointFile && numOfAnalyzedRegions % checkpointInterval == 0) {
+            writeCheckpoint(region, hypothesis, result, unprocessedRegions, refinementDepths, numOfAnalyzedRegions);
+        }
         if (storm::settings::getModule<storm::settings::modules::CoreSettings>().isShowStatisticsSet()) {
             while (displayedProgress < storm::utility::one<CoefficientType>() - fractionOfUndiscoveredArea) {
                 STORM_PRINT_AND_LOG("#");
                 displayedProgress += storm::utility::convertNumber<CoefficientType>(0.01);
             }
         }
-        currentDepth = refinementDepths.front();
+        currentDepth = refinementDepths.empty() ? 0 : refinementDepths.front();
     }
 
     // FIFO queues for the order and local monotonicity results
@@ -188,7 +216,7 @@ std::unique_ptr<storm::modelchecker::RegionRefinementCheckResult<ParametricType>
         monWatch.stop();
         STORM_PRINT("\nTime for orderBuilding and monRes initialization: " << monWatch << ".\n\n");
     }
-    bool useSameOrder = useMonotonicity && order->getDoneBuilding();
+    bool useSameOrder = useMonotonicity && order && order->getDoneBuilding();
     bool useSameLocalMonotonicityResult = useSameOrder && localMonotonicityResult->isDone();
 
     // USEMON WHILE LOOP
@@ -216,7 +244,7 @@ std::unique_ptr<storm::modelchecker::RegionRefinementCheckResult<ParametricType>
             }
         }
 
-        res = analyzeRegion(env, currentRegion, hypothesis, res, false, localMonotonicityResult);
+        res = analyzeRegionWithCache(env, currentRegion, hypothesis, res, false, localMonotonicityResult);
 
         switch (res) {
             case RegionResult::AllSat:
@@ -301,6 +329,9 @@ std::unique_ptr<storm::modelchecker::RegionRefinementCheckResult<ParametricType>
         if (!useSameLocalMonotonicityResult) {
             localMonotonicityResults.pop();
         }
+        if (checkpointFile && numOfAnalyzedRegions % checkpointInterval == 0) {
+            writeCheckpoint(region, hypothesis, result, unprocessedRegions, refinementDepths, numOfAnalyzedRegions);
+        }
 
         if (storm::settings::getModule<storm::settings::modules::CoreSettings>().isShowStatisticsSet()) {
             while (displayedProgress < storm::utility::one<CoefficientType>() - fractionOfUndiscoveredArea) {
@@ -310,6 +341,10 @@ std::unique_ptr<storm::modelchecker::RegionRefinementCheckResult<ParametricType>
         }
     }
 
+    if (checkpointFile) {
+        writeCheckpoint(region, hypothesis, result, unprocessedRegions, refinementDepths, numOfAnalyzedRegions);
+    }
+
     // Add the still unprocessed regions to the result
     while (!unprocessedRegions.empty()) {
         result.push_back(std::move(unprocessedRegions.front()));
@@ -335,6 +370,152 @@ std::unique_ptr<storm::modelchecker::RegionRefinementCheckResult<ParametricType>
     return std::make_unique<storm::modelchecker::RegionRefinementCheckResult<ParametricType>>(std::move(result), std::move(regionCopyForResult));
 }
 
+template<typename ParametricType>
+RegionResult RegionModelChecker<ParametricType>::analyzeRegionWithCache(
+    Environment const& env, storm::storage::ParameterRegion<ParametricType> const& region, RegionResultHypothesis const& hypothesis,
+    RegionResult const& initialResult, bool sampleVerticesOfRegion,
+    std::shared_ptr<storm::analysis::LocalMonotonicityResult<VariableType>> localMonotonicityResult) {
+    if (resultCache) {
+        auto cachedResult = resultCache->getResult(resultCacheKey.get(), region);
+        if (cachedResult) {
+            return cachedResult.value();
+        }
+    }
+    RegionResult res = analyzeRegion(env, region, hypothesis, initialResult, sampleVerticesOfRegion, localMonotonicityResult);
+    if (resultCache) {
+        resultCache->storeResult(resultCacheKey.get(), region, res);
+    }
+    return res;
+}
+
+template<typename ParametricType>
+void RegionModelChecker<ParametricType>::writeCheckpoint(
+    storm::storage::ParameterRegion<ParametricType> const& parameterSpace, RegionResultHypothesis const& hypothesis,
+    std::vector<std::pair<storm::storage::ParameterRegion<ParametricType>, RegionResult>> const& processedRegions,
+    std::queue<std::pair<storm::storage::ParameterRegion<ParametricType>, RegionResult>> unprocessedRegions, std::queue<uint64_t> refinementDepths,
+    uint64_t numberOfAnalyzedRegions) const {
+    RegionRefinementCheckpoint<ParametricType> checkpoint(parameterSpace, hypothesis);
+    checkpoint.getProcessedRegions() = processedRegions;
+    checkpoint.getUnprocessedRegions().clear();
+    while (!unprocessedRegions.empty()) {
+        checkpoint.getUnprocessedRegions().push_back(
+            {std::move(unprocessedRegions.front().first), unprocessedRegions.front().second, refinementDepths.front()});
+        unprocessedRegions.pop();
+        refinementDepths.pop();
+    }
+    checkpoint.setNumberOfAnalyzedRegions(numberOfAnalyzedRegions);
+    checkpoint.writeToFile(checkpointFile.get());
+}
+
+template<typename ParametricType>
+std::unique_ptr<storm::modelchecker::RegionRefinementCheckResult<ParametricType>> RegionModelChecker<ParametricType>::performParallelRegionRefinement(
+    Environment const& env, std::vector<std::shared_ptr<RegionModelChecker<ParametricType>>> const& checkers,
+    storm::storage::ParameterRegion<ParametricType> const& region, boost::optional<ParametricType> const& coverageThreshold,
+    boost::optional<uint64_t> depthThreshold, RegionResultHypothesis const& hypothesis) {
+    STORM_LOG_THROW(!checkers.empty(), storm::exceptions::InvalidArgumentException, "Parallel region refinement requires at least one region model checker.");
+#ifdef STORM_HAVE_INTELTBB
+    STORM_LOG_INFO("Applying parallel refinement with " << checkers.size() << " workers on region: " << region.toString(true) << " .");
+    STORM_LOG_WARN_COND(std::none_of(checkers.begin(), checkers.end(), [](auto const& checker) { return checker->isUseMonotonicitySet(); }),
+                        "Monotonicity is not considered in parallel region refinement.");
+
+    auto thresholdAsCoefficient =
+        coverageThreshold ? storm::utility::convertNumber<CoefficientType>(coverageThreshold.get()) : storm::utility::zero<CoefficientType>();
+    auto areaOfParameterSpace = region.area();
+    auto fractionOfUndiscoveredArea = storm::utility::one<CoefficientType>();
+    uint_fast64_t numOfAnalyzedRegions = 0;
+
+    // The resulting (sub-)regions
+    std::vector<std::pair<storm::storage::ParameterRegion<ParametricType>, RegionResult>> result;
+    // The regions of the current refinement depth and the regions of the next depth.
+    std::vector<std::pair<storm::storage::ParameterRegion<ParametricType>, RegionResult>> currentRegions, nextRegions;
+    currentRegions.emplace_back(region, RegionResult::Unknown);
+
+    // Checkers that are currently not used by any worker. As the arena limits the concurrency to the number of checkers, a free checker always exists.
+    std::vector<RegionModelChecker<ParametricType>*> freeCheckers;
+    for (auto const& checker : checkers) {
+        freeCheckers.push_back(checker.get());
+    }
+    std::mutex mutex;
+    // Set as soon as the coverage threshold is reached. Regions that are not analyzed yet are then added to the result as they are.
+    std::atomic<bool> thresholdReached(fractionOfUndiscoveredArea <= thresholdAsCoefficient);
+
+    tbb::task_arena arena(static_cast<int>(checkers.size()));
+    for (uint64_t currentDepth = 0; !currentRegions.empty(); ++currentDepth) {
+        STORM_LOG_INFO("Analyzing " << currentRegions.size() << " regions (Refinement depth " << currentDepth << "; "
+                                    << storm::utility::convertNumber<double>(fractionOfUndiscoveredArea) * 100 << "% still unknown)");
+        bool refine = !depthThreshold || currentDepth < depthThreshold.get();
+        arena.execute([&]() {
+            // A grain size of one lets idle workers steal single regions whose analysis takes long.
+            tbb::parallel_for(tbb::blocked_range<uint64_t>(0, currentRegions.size(), 1), [&](tbb::blocked_range<uint64_t> const& range) {
+                RegionModelChecker<ParametricType>* checker;
+                {
+                    std::lock_guard<std::mutex> lock(mutex);
+                    STORM_LOG_ASSERT(!freeCheckers.empty(), "No free region model checker.");
+                    checker = freeCheckers.back();
+                    freeCheckers.pop_back();
+                }
+                for (uint64_t index = range.begin(); index < range.end(); ++index) {
+                    auto& currentRegion = currentRegions[index].first;
+                    auto& res = currentRegions[index].second;
+                    if (thresholdReached.load()) {
+                        std::lock_guard<std::mutex> lock(mutex);
+                        result.push_back(std::move(currentRegions[index]));
+                        continue;
+                    }
+                    res = checker->analyzeRegion(env, currentRegion, hypothesis, res, false);
+
+                    // Operations on the coefficients of the regions are not necessarily thread safe, so they are done while holding the lock.
+                    std::lock_guard<std::mutex> lock(mutex);
+                    ++numOfAnalyzedRegions;
+                    if (res != RegionResult::AllSat && res != RegionResult::AllViolated && refine) {
+                        std::vector<storm::storage::ParameterRegion<ParametricType>> newRegions;
+                        currentRegion.split(currentRegion.getCenterPoint(), newRegions);
+                        RegionResult initResForNewRegions = RegionResult::Unknown;
+                        if (res == RegionResult::CenterSat) {
+                            initResForNewRegions = RegionResult::ExistsSat;
+                        } else if (res == RegionResult::CenterViolated) {
+                            initResForNewRegions = RegionResult::ExistsViolated;
+                        }
+                        for (auto& newRegion : newRegions) {
+                            nextRegions.emplace_back(std::move(newRegion), initResForNewRegions);
+                        }
+                    } else {
+                        if (res == RegionResult::AllSat || res == RegionResult::AllViolated) {
+                            fractionOfUndiscoveredArea -= currentRegion.area() / areaOfParameterSpace;
+                            if (fractionOfUndiscoveredArea <= thresholdAsCoefficient) {
+                                thresholdReached.store(true);
+                            }
+                        }
+                        // If the region is not further refined, it is still added to the result
+                        result.push_back(std::move(currentRegions[index]));
+                    }
+                }
+                std::lock_guard<std::mutex> lock(mutex);
+                freeCheckers.push_back(checker);
+            });
+        });
+        currentRegions.clear();
+        std::swap(currentRegions, nextRegions);
+        if (thresholdReached.load()) {
+            // Add the still unprocessed regions to the result
+            std::move(currentRegions.begin(), currentRegions.end(), std::back_inserter(result));
+            currentRegions.clear();
+        }
+    }
+
+    if (storm::settings::getModule<storm::settings::modules::CoreSettings>().isShowStatisticsSet()) {
+        STORM_PRINT_AND_LOG("Region Refinement Statistics:\n");
+        STORM_PRINT_AND_LOG("    Analyzed a total of " << numOfAnalyzedRegions << " regions with " << checkers.size() << " workers.\n");
+    }
+
+    auto regionCopyForResult = region;
+    return std::make_unique<storm::modelchecker::RegionRefinementCheckResult<ParametricType>>(std::move(result), std::move(regionCopyForResult));
+#else
+    STORM_LOG_WARN("Parallel region refinement requires Intel TBB. Refining sequentially.");
+    return checkers.front()->performRegionRefinement(env, region, coverageThreshold, depthThreshold, hypothesis);
+#endif
+}
+
 template<typename ParametricType>
 void RegionModelChecker<ParametricType>::extendLocalMonotonicityResult(
     storm::storage::ParameterRegion<ParametricType> const& region, std::shared_ptr<storm::analysis::Order> order,
@@ -423,6 +604,20 @@ void RegionModelChecker<ParametricType>::setUseOnlyGlobal(bool global) {
     this->useOnlyGlobal = global;
 }
 
+template<typename ParametricType>
+void RegionModelChecker<ParametricType>::setResultCache(std::shared_ptr<RegionResultCache<ParametricType>> const& cache,
+                                                        typename RegionResultCache<ParametricType>::Key const& key) {
+    this->resultCache = cache;
+    this->resultCacheKey = key;
+}
+
+template<typename ParametricType>
+void RegionModelChecker<ParametricType>::setCheckpointFile(std::string const& filename, uint64_t checkpointInterval) {
+    STORM_LOG_THROW(checkpointInterval > 0, storm::exceptions::InvalidArgumentException, "The checkpoint interval has to be positive.");
+    this->checkpointFile = filename;
+    this->checkpointInterval = checkpointInterval;
+}
+
 template<typename ParametricType>
 void RegionModelChecker<ParametricType>::splitSmart(storm::storage::ParameterRegion<ParametricType>& currentRegion,
                                                     std::vector<storm::storage::ParameterRegion<ParametricType>>& regionVector,
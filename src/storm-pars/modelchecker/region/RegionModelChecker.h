@@ -1,11 +1,15 @@
 #pragma once
 
 #include <memory>
+#include <queue>
+#include <string>
 
 #include "storm-pars/analysis/LocalMonotonicityResult.h"
 #include "storm-pars/analysis/Order.h"
 #include "storm-pars/analysis/OrderExtender.h"
+#include "storm-pars/modelchecker/region/RegionRefinementCheckpoint.h"
 #include "storm-pars/modelchecker/region/RegionResult.h"
+#include "storm-pars/modelchecker/region/RegionResultCache.h"
 #include "storm-pars/modelchecker/region/RegionResultHypothesis.h"
 #include "storm-pars/modelchecker/results/RegionCheckResult.h"
 #include "storm-pars/modelchecker/results/RegionRefinementCheckResult.h"
@@ -74,6 +78,33 @@ class RegionModelChecker {
         boost::optional<uint64_t> depthThreshold = boost::none, RegionResultHypothesis const& hypothesis = RegionResultHypothesis::Unknown,
         uint64_t monThresh = 0);
 
+    /*!
+     * Resumes an iterative region refinement from the given checkpoint (see performRegionRefinement).
+     * The coverage threshold and the depth threshold do not need to coincide with the ones of the run that created the checkpoint. However, regions that
+     * have not been refined due to the depth threshold of that run are not refined any further.
+     * If monotonicity is used, the monotonicity information is recomputed from scratch.
+     */
+    std::unique_ptr<storm::modelchecker::RegionRefinementCheckResult<ParametricType>> resumeRegionRefinement(
+        Environment const& env, RegionRefinementCheckpoint<ParametricType> checkpoint, boost::optional<ParametricType> const& coverageThreshold,
+        boost::optional<uint64_t> depthThreshold = boost::none, uint64_t monThresh = 0);
+
+    /*!
+     * Iteratively refines the region like performRegionRefinement, but the (sub-)regions of one refinement depth are analyzed concurrently.
+     * Each worker analyzes regions with its own region model checker. All checkers have to be specified for the same model and check task and must not
+     * share any data. As rational functions can not be created safely from multiple threads, the checkers should be specified sequentially.
+     * Monotonicity is not considered. If Intel TBB is not available, the refinement is performed sequentially with the first checker.
+     * @param checkers the region model checkers of the workers. The number of concurrently analyzed regions is at most the number of checkers.
+     * @param region the considered region
+     * @param coverageThreshold if given, the refinement stops as soon as the fraction of the area of the subregions with inconclusive result is less then this
+     * threshold
+     * @param depthThreshold if given, the refinement stops at the given depth. depth=0 means no refinement.
+     * @param hypothesis if not 'unknown', it is only checked whether the hypothesis holds within the given region.
+     */
+    static std::unique_ptr<storm::modelchecker::RegionRefinementCheckResult<ParametricType>> performParallelRegionRefinement(
+        Environment const& env, std::vector<std::shared_ptr<RegionModelChecker<ParametricType>>> const& checkers,
+        storm::storage::ParameterRegion<ParametricType> const& region, boost::optional<ParametricType> const& coverageThreshold,
+        boost::optional<uint64_t> depthThreshold = boost::none, RegionResultHypothesis const& hypothesis = RegionResultHypothesis::Unknown);
+
     // TODO return type is not quite nice
     // TODO consider returning v' as well
     /*!
@@ -133,6 +164,19 @@ class RegionModelChecker {
      */
     virtual void resetMaxSplitDimensions();
 
+    /*!
+     * When analyzing multiple regions and during region refinement, the results of region checks are looked up in (and stored in) the given cache
+     * using the given key.
+     * The key should identify the model and the formula this checker has been specified for.
+     */
+    void setResultCache(std::shared_ptr<RegionResultCache<ParametricType>> const& cache, typename RegionResultCache<ParametricType>::Key const& key);
+
+    /*!
+     * During region refinement, a checkpoint is written to the given file whenever the given number of regions has been analyzed and when the
+     * refinement terminates. The refinement can then be resumed with resumeRegionRefinement.
+     */
+    void setCheckpointFile(std::string const& filename, uint64_t checkpointInterval = 1000);
+
     void setMonotoneParameters(std::pair<std::set<typename storm::storage::ParameterRegion<ParametricType>::VariableType>,
                                          std::set<typename storm::storage::ParameterRegion<ParametricType>::VariableType>>
                                    monotoneParameters);
@@ -142,6 +186,21 @@ class RegionModelChecker {
     bool useOnlyGlobal = false;
     bool useBounds = false;
 
+    std::shared_ptr<RegionResultCache<ParametricType>> resultCache;
+    boost::optional<typename RegionResultCache<ParametricType>::Key> resultCacheKey;
+    boost::optional<std::string> checkpointFile;
+    uint64_t checkpointInterval = 1000;
+
+    // Analyzes the given region, considering the result cache (if set)
+    RegionResult analyzeRegionWithCache(Environment const& env, storm::storage::ParameterRegion<ParametricType> const& region,
+                                        RegionResultHypothesis const& hypothesis, RegionResult const& initialResult, bool sampleVerticesOfRegion,
+                                        std::shared_ptr<storm::analysis::LocalMonotonicityResult<VariableType>> localMonotonicityResult = nullptr);
+
+    void writeCheckpoint(storm::storage::ParameterRegion<ParametricType> const& parameterSpace, RegionResultHypothesis const& hypothesis,
+                         std::vector<std::pair<storm::storage::ParameterRegion<ParametricType>, RegionResult>> const& processedRegions,
+                         std::queue<std::pair<storm::storage::ParameterRegion<ParametricType>, RegionResult>> unprocessedRegions,
+                         std::queue<uint64_t> refinementDepths, uint64_t numberOfAnalyzedRegions) const;
+
    protected:
     uint_fast64_t numberOfRegionsKnownThroughMonotonicity;
     boost::optional<std::set<typename storm::storage::ParameterRegion<ParametricType>::VariableType>> monotoneIncrParameters;
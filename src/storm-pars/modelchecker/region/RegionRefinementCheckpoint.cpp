@@ -0,0 +1,170 @@
+#include "storm-pars/modelchecker/region/RegionRefinementCheckpoint.h"
+
+#include <cstdio>
+#include <fstream>
+
+#include <boost/algorithm/string.hpp>
+#include <boost/optional.hpp>
+
+#include "storm-pars/parser/ParameterRegionParser.h"
+
+#include "storm/adapters/RationalFunctionAdapter.h"
+#include "storm/io/file.h"
+#include "storm/utility/macros.h"
+
+#include "storm/exceptions/FileIoException.h"
+#include "storm/exceptions/WrongFormatException.h"
+
+namespace storm {
+namespace modelchecker {
+
+namespace detail {
+std::string const checkpointFileHeader = "storm-pars-refinement-checkpoint-v1";
+
+// Each line consists of a keyword and some fields that are separated by tabs. Regions are given as in ParameterRegion::toString
+std::vector<std::string> splitCheckpointLine(std::string const& line) {
+    std::vector<std::string> fields;
+    boost::split(fields, line, boost::is_any_of("\t"));
+    return fields;
+}
+
+template<typename ParametricType>
+storm::storage::ParameterRegion<ParametricType> parseCheckpointRegion(
+    std::string regionString, std::set<typename storm::storage::ParameterRegion<ParametricType>::VariableType> const& consideredVariables) {
+    // Remove the trailing semicolon
+    boost::trim_right_if(regionString, boost::is_any_of(";"));
+    return storm::parser::ParameterRegionParser<ParametricType>::parseRegion(regionString, consideredVariables);
+}
+
+RegionResult parseCheckpointRegionResult(std::string const& resultString) {
+    auto result = regionResultFromString(resultString);
+    STORM_LOG_THROW(result.has_value(), storm::exceptions::WrongFormatException, "Unknown region result '" << resultString << "' in checkpoint.");
+    return result.value();
+}
+}  // namespace detail
+
+template<typename ParametricType>
+RegionRefinementCheckpoint<ParametricType>::RegionRefinementCheckpoint(storm::storage::ParameterRegion<ParametricType> const& parameterSpace,
+                                                                       RegionResultHypothesis const& hypothesis)
+    : parameterSpace(parameterSpace), hypothesis(hypothesis), numberOfAnalyzedRegions(0) {
+    unprocessedRegions.push_back({parameterSpace, RegionResult::Unknown, 0});
+}
+
+template<typename ParametricType>
+storm::storage::ParameterRegion<ParametricType> const& RegionRefinementCheckpoint<ParametricType>::getParameterSpace() const {
+    return parameterSpace;
+}
+
+template<typename ParametricType>
+RegionResultHypothesis const& RegionRefinementCheckpoint<ParametricType>::getHypothesis() const {
+    return hypothesis;
+}
+
+template<typename ParametricType>
+std::vector<std::pair<storm::storage::ParameterRegion<ParametricType>, RegionResult>>& RegionRefinementCheckpoint<ParametricType>::getProcessedRegions() {
+    return processedRegions;
+}
+
+template<typename ParametricType>
+std::vector<std::pair<storm::storage::ParameterRegion<ParametricType>, RegionResult>> const& RegionRefinementCheckpoint<ParametricType>::getProcessedRegions()
+    const {
+    return processedRegions;
+}
+
+template<typename ParametricType>
+std::vector<typename RegionRefinementCheckpoint<ParametricType>::UnprocessedRegion>& RegionRefinementCheckpoint<ParametricType>::getUnprocessedRegions() {
+    return unprocessedRegions;
+}
+
+template<typename ParametricType>
+std::vector<typename RegionRefinementCheckpoint<ParametricType>::UnprocessedRegion> const& RegionRefinementCheckpoint<ParametricType>::getUnprocessedRegions()
+    const {
+    return unprocessedRegions;
+}
+
+template<typename ParametricType>
+uint64_t RegionRefinementCheckpoint<ParametricType>::getNumberOfAnalyzedRegions() const {
+    return numberOfAnalyzedRegions;
+}
+
+template<typename ParametricType>
+void RegionRefinementCheckpoint<ParametricType>::setNumberOfAnalyzedRegions(uint64_t numberOfAnalyzedRegions) {
+    this->numberOfAnalyzedRegions = numberOfAnalyzedRegions;
+}
+
+template<typename ParametricType>
+void RegionRefinementCheckpoint<ParametricType>::writeToFile(std::string const& filename) const {
+    std::string temporaryFilename = filename + ".tmp";
+    std::ofstream out;
+    storm::utility::openFile(temporaryFilename, out, false, true);
+    out << detail::checkpointFileHeader << '\n';
+    out << "parameterspace\t" << parameterSpace.toString() << '\n';
+    out << "hypothesis\t" << hypothesis << '\n';
+    out << "analyzed\t" << numberOfAnalyzedRegions << '\n';
+    for (auto const& processed : processedRegions) {
+        out << "processed\t" << processed.second << '\t' << processed.first.toString() << '\n';
+    }
+    for (auto const& unprocessed : unprocessedRegions) {
+        out << "unprocessed\t" << unprocessed.result << '\t' << unprocessed.depth << '\t' << unprocessed.region.toString() << '\n';
+    }
+    bool success = out.good();
+    storm::utility::closeFile(out);
+    STORM_LOG_THROW(success && std::rename(temporaryFilename.c_str(), filename.c_str()) == 0, storm::exceptions::FileIoException,
+                    "Could not write checkpoint to file " << filename << ".");
+    STORM_LOG_INFO("Wrote checkpoint with " << processedRegions.size() << " processed and " << unprocessedRegions.size() << " unprocessed regions to file "
+                                            << filename << ".");
+}
+
+template<typename ParametricType>
+RegionRefinementCheckpoint<ParametricType> RegionRefinementCheckpoint<ParametricType>::readFromFile(std::string const& filename,
+                                                                                                    std::set<VariableType> const& consideredVariables) {
+    std::ifstream in;
+    storm::utility::openFile(filename, in);
+    std::string line;
+    storm::utility::getline(in, line);
+    STORM_LOG_THROW(line == detail::checkpointFileHeader, storm::exceptions::WrongFormatException, "File " << filename << " is not a refinement checkpoint.");
+
+    boost::optional<storm::storage::ParameterRegion<ParametricType>> parameterSpace;
+    boost::optional<RegionResultHypothesis> hypothesis;
+    uint64_t numberOfAnalyzedRegions = 0;
+    std::vector<std::pair<storm::storage::ParameterRegion<ParametricType>, RegionResult>> processedRegions;
+    std::vector<UnprocessedRegion> unprocessedRegions;
+    while (storm::utility::getline(in, line)) {
+        if (line.empty()) {
+            continue;
+        }
+        auto fields = detail::splitCheckpointLine(line);
+        if (fields[0] == "parameterspace" && fields.size() == 2) {
+            parameterSpace = detail::parseCheckpointRegion<ParametricType>(fields[1], consideredVariables);
+        } else if (fields[0] == "hypothesis" && fields.size() == 2) {
+            auto parsedHypothesis = regionResultHypothesisFromString(fields[1]);
+            STORM_LOG_THROW(parsedHypothesis.has_value(), storm::exceptions::WrongFormatException, "Unknown hypothesis '" << fields[1] << "' in checkpoint.");
+            hypothesis = parsedHypothesis.value();
+        } else if (fields[0] == "analyzed" && fields.size() == 2) {
+            numberOfAnalyzedRegions = std::stoull(fields[1]);
+        } else if (fields[0] == "processed" && fields.size() == 3) {
+            processedRegions.emplace_back(detail::parseCheckpointRegion<ParametricType>(fields[2], consideredVariables),
+                                          detail::parseCheckpointRegionResult(fields[1]));
+        } else if (fields[0] == "unprocessed" && fields.size() == 4) {
+            unprocessedRegions.push_back({detail::parseCheckpointRegion<ParametricType>(fields[3], consideredVariables),
+                                          detail::parseCheckpointRegionResult(fields[1]), std::stoull(fields[2])});
+        } else {
+            STORM_LOG_THROW(false, storm::exceptions::WrongFormatException, "Unexpected line '" << line << "' in checkpoint file " << filename << ".");
+        }
+    }
+    storm::utility::closeFile(in);
+    STORM_LOG_THROW(parameterSpace && hypothesis, storm::exceptions::WrongFormatException,
+                    "Checkpoint file " << filename << " does not specify the parameter space and the hypothesis.");
+
+    RegionRefinementCheckpoint<ParametricType> checkpoint(parameterSpace.get(), hypothesis.get());
+    checkpoint.processedRegions = std::move(processedRegions);
+    checkpoint.unprocessedRegions = std::move(unprocessedRegions);
+    checkpoint.numberOfAnalyzedRegions = numberOfAnalyzedRegions;
+    return checkpoint;
+}
+
+#ifdef STORM_HAVE_CARL
+template class RegionRefinementCheckpoint<storm::RationalFunction>;
+#endif
+}  // namespace modelchecker
+}  // namespace storm
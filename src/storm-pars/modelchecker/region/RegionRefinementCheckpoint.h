@@ -0,0 +1,70 @@
+#pragma once
+
+#include <set>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "storm-pars/modelchecker/region/RegionResult.h"
+#include "storm-pars/modelchecker/region/RegionResultHypothesis.h"
+#include "storm-pars/storage/ParameterRegion.h"
+
+namespace storm {
+namespace modelchecker {
+
+/*!
+ * The state of an iterative region refinement, i.e., the regions that have already been processed (together with their result) and the queue of regions
+ * that still need to be analyzed. A refinement can be resumed from such a checkpoint, e.g., after a crash or with a tighter coverage threshold.
+ * Checkpoints can be written to and read from a (human readable) file. Boundaries of the regions are stored exactly.
+ */
+template<typename ParametricType>
+class RegionRefinementCheckpoint {
+   public:
+    typedef typename storm::storage::ParameterRegion<ParametricType>::VariableType VariableType;
+
+    struct UnprocessedRegion {
+        storm::storage::ParameterRegion<ParametricType> region;
+        RegionResult result;  // What is already known about this region
+        uint64_t depth;       // The refinement depth of this region
+    };
+
+    /*!
+     * Creates the checkpoint of a refinement that has not been started yet, i.e., the parameter space is the only unprocessed region.
+     */
+    RegionRefinementCheckpoint(storm::storage::ParameterRegion<ParametricType> const& parameterSpace, RegionResultHypothesis const& hypothesis);
+
+    storm::storage::ParameterRegion<ParametricType> const& getParameterSpace() const;
+    RegionResultHypothesis const& getHypothesis() const;
+
+    std::vector<std::pair<storm::storage::ParameterRegion<ParametricType>, RegionResult>>& getProcessedRegions();
+    std::vector<std::pair<storm::storage::ParameterRegion<ParametricType>, RegionResult>> const& getProcessedRegions() const;
+
+    // The unprocessed regions in the order in which they are analyzed
+    std::vector<UnprocessedRegion>& getUnprocessedRegions();
+    std::vector<UnprocessedRegion> const& getUnprocessedRegions() const;
+
+    uint64_t getNumberOfAnalyzedRegions() const;
+    void setNumberOfAnalyzedRegions(uint64_t numberOfAnalyzedRegions);
+
+    /*!
+     * Writes the checkpoint to the given file. The file is first written under a temporary name and then renamed,
+     * so that an interrupted write does not destroy a previously written checkpoint.
+     */
+    void writeToFile(std::string const& filename) const;
+
+    /*!
+     * Reads a checkpoint from the given file.
+     * @param consideredVariables the parameters of the model, needed to parse the regions.
+     */
+    static RegionRefinementCheckpoint<ParametricType> readFromFile(std::string const& filename, std::set<VariableType> const& consideredVariables);
+
+   private:
+    storm::storage::ParameterRegion<ParametricType> parameterSpace;
+    RegionResultHypothesis hypothesis;
+    std::vector<std::pair<storm::storage::ParameterRegion<ParametricType>, RegionResult>> processedRegions;
+    std::vector<UnprocessedRegion> unprocessedRegions;
+    uint64_t numberOfAnalyzedRegions;
+};
+
+}  // namespace modelchecker
+}  // namespace storm
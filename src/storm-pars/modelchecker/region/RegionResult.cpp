@@ -1,5 +1,7 @@
 #include "storm-pars/modelchecker/region/RegionResult.h"
 
+#include <sstream>
+
 #include "storm/exceptions/NotImplementedException.h"
 #include "storm/utility/macros.h"
 
@@ -37,5 +39,17 @@ std::ostream& operator<<(std::ostream& os, RegionResult const& regionResult) {
     }
     return os;
 }
+
+std::optional<RegionResult> regionResultFromString(std::string const& regionResultString) {
+    for (auto const& res : {RegionResult::Unknown, RegionResult::ExistsSat, RegionResult::ExistsViolated, RegionResult::CenterSat, RegionResult::CenterViolated,
+                            RegionResult::ExistsBoth, RegionResult::AllSat, RegionResult::AllViolated}) {
+        std::stringstream stream;
+        stream << res;
+        if (stream.str() == regionResultString) {
+            return res;
+        }
+    }
+    return {};
+}
 }  // namespace modelchecker
 }  // namespace storm
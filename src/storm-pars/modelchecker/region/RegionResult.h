@@ -1,6 +1,8 @@
 #pragma once
 
+#include <optional>
 #include <ostream>
+#include <string>
 
 namespace storm {
 namespace modelchecker {
@@ -19,5 +21,10 @@ enum class RegionResult {
 };
 
 std::ostream& operator<<(std::ostream& os, RegionResult const& regionCheckResult);
+
+/*!
+ * Retrieves the region result whose string representation (as given by operator<<) is the given string.
+ */
+std::optional<RegionResult> regionResultFromString(std::string const& regionResultString);
 }  // namespace modelchecker
 }  // namespace storm
@@ -0,0 +1,102 @@
+#include "storm-pars/modelchecker/region/RegionResultCache.h"
+
+#include <fstream>
+
+#include <boost/algorithm/string.hpp>
+
+#include "storm/adapters/RationalFunctionAdapter.h"
+#include "storm/io/file.h"
+#include "storm/logic/Formula.h"
+#include "storm/utility/macros.h"
+
+namespace storm {
+namespace modelchecker {
+
+namespace detail {
+std::string const resultCacheFileHeader = "storm-pars-region-results-v1";
+}
+
+template<typename ParametricType>
+RegionResultCache<ParametricType>::RegionResultCache(std::string const& filename) : filename(filename), numberOfHits(0) {
+    if (filename.empty() || !storm::utility::fileExistsAndIsReadable(filename)) {
+        return;
+    }
+    std::ifstream in;
+    storm::utility::openFile(filename, in);
+    std::string line;
+    storm::utility::getline(in, line);
+    if (line != detail::resultCacheFileHeader) {
+        STORM_LOG_WARN("Ignoring region results in file " << filename << " as the file has an unexpected format.");
+        storm::utility::closeFile(in);
+        this->filename.clear();
+        return;
+    }
+    // Each entry consists of the model hash, the formula, the region and the result, separated by tabs.
+    while (storm::utility::getline(in, line)) {
+        std::vector<std::string> fields;
+        boost::split(fields, line, boost::is_any_of("\t"));
+        std::optional<RegionResult> result;
+        if (fields.size() == 4) {
+            result = regionResultFromString(fields[3]);
+        }
+        if (!result) {
+            // Most likely, the last run has been interrupted while writing this entry.
+            STORM_LOG_WARN_COND(line.empty(), "Ignoring invalid line '" << line << "' in region result file " << filename << ".");
+            continue;
+        }
+        results[std::make_pair(Key(std::stoull(fields[0]), fields[1]), fields[2])] = result.value();
+    }
+    storm::utility::closeFile(in);
+    STORM_LOG_INFO("Loaded " << results.size() << " region results from file " << filename << ".");
+}
+
+template<typename ParametricType>
+typename RegionResultCache<ParametricType>::Key RegionResultCache<ParametricType>::getKey(storm::models::sparse::Model<ParametricType> const& model,
+                                                                                          storm::logic::Formula const& formula) {
+    return Key(model.hash(), formula.toString());
+}
+
+template<typename ParametricType>
+std::optional<RegionResult> RegionResultCache<ParametricType>::getResult(Key const& key, storm::storage::ParameterRegion<ParametricType> const& region) {
+    auto findRes = results.find(std::make_pair(key, region.toString()));
+    if (findRes == results.end()) {
+        return std::nullopt;
+    }
+    ++numberOfHits;
+    return findRes->second;
+}
+
+template<typename ParametricType>
+void RegionResultCache<ParametricType>::storeResult(Key const& key, storm::storage::ParameterRegion<ParametricType> const& region, RegionResult const& result) {
+    if (result != RegionResult::AllSat && result != RegionResult::AllViolated) {
+        return;
+    }
+    auto insertRes = results.emplace(std::make_pair(key, region.toString()), result);
+    if (!insertRes.second || filename.empty()) {
+        return;
+    }
+    std::ofstream out;
+    bool writeHeader = !storm::utility::fileExistsAndIsReadable(filename);
+    storm::utility::openFile(filename, out, true, true);
+    if (writeHeader) {
+        out << detail::resultCacheFileHeader << '\n';
+    }
+    out << key.first << '\t' << key.second << '\t' << insertRes.first->first.second << '\t' << result << '\n';
+    storm::utility::closeFile(out);
+}
+
+template<typename ParametricType>
+uint64_t RegionResultCache<ParametricType>::getNumberOfEntries() const {
+    return results.size();
+}
+
+template<typename ParametricType>
+uint64_t RegionResultCache<ParametricType>::getNumberOfHits() const {
+    return numberOfHits;
+}
+
+#ifdef STORM_HAVE_CARL
+template class RegionResultCache<storm::RationalFunction>;
+#endif
+}  // namespace modelchecker
+}  // namespace storm
@@ -0,0 +1,49 @@
+#pragma once
+
+#include <map>
+#include <optional>
+#include <string>
+#include <utility>
+
+#include "storm-pars/modelchecker/region/RegionResult.h"
+#include "storm-pars/storage/ParameterRegion.h"
+#include "storm/models/sparse/Model.h"
+
+namespace storm {
+namespace logic {
+class Formula;
+}
+namespace modelchecker {
+
+/*!
+ * Cache for the results of region checks.
+ * Entries are identified by the hash of the model, the formula (as a string) and the region (with exact boundaries). Identical queries thus yield the cached
+ * result without invoking a region model checker. If a file is given, the entries of that file are loaded and new entries are appended to it immediately,
+ * so they are available to subsequent runs (even if a run does not terminate regularly).
+ * Only conclusive results (AllSat and AllViolated) are stored, as they hold independently of the hypothesis and the region checking engine.
+ */
+template<typename ParametricType>
+class RegionResultCache {
+   public:
+    typedef std::pair<std::size_t, std::string> Key;
+
+    /*!
+     * @param filename the file in which the entries are stored. If empty, entries are only kept in memory.
+     */
+    RegionResultCache(std::string const& filename = "");
+
+    static Key getKey(storm::models::sparse::Model<ParametricType> const& model, storm::logic::Formula const& formula);
+
+    std::optional<RegionResult> getResult(Key const& key, storm::storage::ParameterRegion<ParametricType> const& region);
+    void storeResult(Key const& key, storm::storage::ParameterRegion<ParametricType> const& region, RegionResult const& result);
+
+    uint64_t getNumberOfEntries() const;
+    uint64_t getNumberOfHits() const;
+
+   private:
+    std::string filename;
+    std::map<std::pair<Key, std::string>, RegionResult> results;
+    uint64_t numberOfHits;
+};
+}  // namespace modelchecker
+}  // namespace storm
@@ -1,5 +1,7 @@
 #include "storm-pars/modelchecker/region/RegionResultHypothesis.h"
 
+#include <sstream>
+
 #include "storm/exceptions/NotImplementedException.h"
 #include "storm/utility/macros.h"
 
@@ -22,5 +24,16 @@ std::ostream& operator<<(std::ostream& os, RegionResultHypothesis const& regionR
     }
     return os;
 }
+
+std::optional<RegionResultHypothesis> regionResultHypothesisFromString(std::string const& hypothesisString) {
+    for (auto const& hypothesis : {RegionResultHypothesis::Unknown, RegionResultHypothesis::AllSat, RegionResultHypothesis::AllViolated}) {
+        std::stringstream stream;
+        stream << hypothesis;
+        if (stream.str() == hypothesisString) {
+            return hypothesis;
+        }
+    }
+    return {};
+}
 }  // namespace modelchecker
 }  // namespace storm
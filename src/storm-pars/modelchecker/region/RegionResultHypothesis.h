@@ -1,6 +1,8 @@
 #pragma once
 
+#include <optional>
 #include <ostream>
+#include <string>
 
 namespace storm {
 namespace modelchecker {
@@ -10,5 +12,10 @@ namespace modelchecker {
 enum class RegionResultHypothesis { Unknown, AllSat, AllViolated };
 
 std::ostream& operator<<(std::ostream& os, RegionResultHypothesis const& regionResultHypothesis);
+
+/*!
+ * Retrieves the hypothesis whose string representation (as given by operator<<) is the given string.
+ */
+std::optional<RegionResultHypothesis> regionResultHypothesisFromString(std::string const& hypothesisString);
 }  // namespace modelchecker
 }  // namespace storm
@@ -3,6 +3,8 @@
 #include "storm-pars/transformer/SparseParametricDtmcSimplifier.h"
 
 #include "storm/adapters/RationalFunctionAdapter.h"
+#include "storm/environment/solver/MinMaxSolverEnvironment.h"
+#include "storm/environment/solver/SolverEnvironment.h"
 #include "storm/modelchecker/prctl/helper/BaierUpperRewardBoundsComputer.h"
 #include "storm/modelchecker/prctl/helper/DsMpiUpperRewardBoundsComputer.h"
 #include "storm/modelchecker/propositional/SparsePropositionalModelChecker.h"
@@ -36,7 +38,7 @@ SparseDtmcParameterLiftingModelChecker<SparseModelType, ConstantType>::SparseDtm
 template<typename SparseModelType, typename ConstantType>
 SparseDtmcParameterLiftingModelChecker<SparseModelType, ConstantType>::SparseDtmcParameterLiftingModelChecker(
     std::unique_ptr<storm::solver::MinMaxLinearEquationSolverFactory<ConstantType>>&& solverFactory)
-    : solverFactory(std::move(solverFactory)), solvingRequiresUpperRewardBounds(false), regionSplitEstimationsEnabled(false) {
+    : useIntervalModel(false), solverFactory(std::move(solverFactory)), solvingRequiresUpperRewardBounds(false), regionSplitEstimationsEnabled(false) {
     // Intentionally left empty
 }
 
@@ -180,9 +182,17 @@ void SparseDtmcParameterLiftingModelChecker<SparseModelType, ConstantType>::spec
         // Create the vector of one-step probabilities to go to target states.
         std::vector<ValueType> b = this->parametricModel->getTransitionMatrix().getConstrainedRowSumVector(
             storm::storage::BitVector(this->parametricModel->getTransitionMatrix().getRowCount(), true), statesWithProbability01.second);
-        parameterLifter = std::make_unique<storm::transformer::ParameterLifter<ValueType, ConstantType>>(
-            this->parametricModel->getTransitionMatrix(), b, maybeStates, maybeStates, regionSplitEstimationsEnabled,
-            RegionModelChecker<ValueType>::isUseMonotonicitySet());
+        bool const intervalModelApplicable = std::is_same_v<ConstantType, double> && !RegionModelChecker<ValueType>::isUseMonotonicitySet();
+        STORM_LOG_WARN_COND(!useIntervalModel || intervalModelApplicable,
+                            "Interval models are not supported with exact arithmetic or monotonicity. Lifting to an MDP instead.");
+        if (useIntervalModel && intervalModelApplicable) {
+            intervalParameterLifter = std::make_unique<storm::transformer::IntervalParameterLifter<ValueType>>(this->parametricModel->getTransitionMatrix(),
+                                                                                                                 b, maybeStates, maybeStates);
+        } else {
+            parameterLifter = std::make_unique<storm::transformer::ParameterLifter<ValueType, ConstantType>>(
+                this->parametricModel->getTransitionMatrix(), b, maybeStates, maybeStates, regionSplitEstimationsEnabled,
+                RegionModelChecker<ValueType>::isUseMonotonicitySet());
+        }
     }
 
     // We know some bounds for the results so set them
@@ -329,6 +339,9 @@ std::unique_ptr<CheckResult> SparseDtmcParameterLiftingModelChecker<SparseModelT
     if (maybeStates.empty()) {
         return std::make_unique<storm::modelchecker::ExplicitQuantitativeCheckResult<ConstantType>>(resultsForNonMaybeStates);
     }
+    if (intervalParameterLifter) {
+        return computeQuantitativeValuesOnIntervalModel(env, region, dirForParameters);
+    }
     parameterLifter->specifyRegion(region, dirForParameters);
 
     if (stepBound) {
@@ -362,6 +375,7 @@ std::unique_ptr<CheckResult> SparseDtmcParameterLiftingModelChecker<SparseModelT
             }
         }
         solver->setTrackScheduler(true);
+        warmStartFromSuperRegion(region, dirForParameters);
 
         if (localMonotonicityResult != nullptr && !this->isOnlyGlobalSet()) {
             storm::storage::BitVector choiceFixedForStates(parameterLifter->getRowGroupCount(), false);
@@ -449,6 +463,7 @@ std::unique_ptr<CheckResult> SparseDtmcParameterLiftingModelChecker<SparseModelT
         } else {
             maxSchedChoices = solver->getSchedulerChoices();
         }
+        storeWarmStartEntry(region, dirForParameters, solver->getSchedulerChoices());
         if (isRegionSplitEstimateSupported()) {
             computeRegionSplitEstimates(x, solver->getSchedulerChoices(), region, dirForParameters);
         }
@@ -464,6 +479,82 @@ std::unique_ptr<CheckResult> SparseDtmcParameterLiftingModelChecker<SparseModelT
     return std::make_unique<storm::modelchecker::ExplicitQuantitativeCheckResult<ConstantType>>(std::move(result));
 }
 
+template<typename SparseModelType, typename ConstantType>
+std::unique_ptr<CheckResult> SparseDtmcParameterLiftingModelChecker<SparseModelType, ConstantType>::computeQuantitativeValuesOnIntervalModel(
+    Environment const& env, storm::storage::ParameterRegion<ValueType> const& region, storm::solver::OptimizationDirection const& dirForParameters) {
+    if constexpr (std::is_same_v<ConstantType, double>) {
+        intervalParameterLifter->specifyRegion(region);
+
+        // Value iteration is the only method that supports interval models
+        storm::Environment intervalEnv = env;
+        intervalEnv.solver().minMax().setMethod(storm::solver::MinMaxMethod::ValueIteration);
+        storm::solver::GeneralMinMaxLinearEquationSolverFactory<storm::Interval, double> intervalSolverFactory;
+        auto solver = intervalSolverFactory.create(intervalEnv, intervalParameterLifter->getMatrix());
+        solver->setRequirementsChecked();
+        // The uncertainty is resolved in the same direction as the parameters are optimized, i.e., it is not adversarial
+        solver->setUncertaintyIsRobust(false);
+        solver->setHasUniqueSolution();
+        solver->setHasNoEndComponents();
+
+        // Start from the results of the most recent solver call (if there are any)
+        std::vector<double> xInterval = intervalParameterLifter->getInitialSolution();
+        if (x.size() == intervalParameterLifter->getNumberOfSelectedStates()) {
+            std::copy(x.begin(), x.end(), xInterval.begin());
+        }
+        solver->solveEquations(intervalEnv, dirForParameters, xInterval, intervalParameterLifter->getVector());
+        x.assign(xInterval.begin(), xInterval.begin() + intervalParameterLifter->getNumberOfSelectedStates());
+
+        // Get the result for the complete model (including maybestates)
+        std::vector<ConstantType> result = resultsForNonMaybeStates;
+        auto maybeStateResIt = x.begin();
+        for (auto const& maybeState : maybeStates) {
+            result[maybeState] = *maybeStateResIt;
+            ++maybeStateResIt;
+        }
+        return std::make_unique<storm::modelchecker::ExplicitQuantitativeCheckResult<ConstantType>>(std::move(result));
+    } else {
+        STORM_LOG_THROW(false, storm::exceptions::NotSupportedException, "Interval models are only supported for ConstantType double.");
+        return nullptr;
+    }
+}
+
+template<typename SparseModelType, typename ConstantType>
+void SparseDtmcParameterLiftingModelChecker<SparseModelType, ConstantType>::warmStartFromSuperRegion(
+    storm::storage::ParameterRegion<ValueType> const& region, storm::solver::OptimizationDirection const& dirForParameters) {
+    // The most recently stored entry whose region contains the given region is the closest one (usually the region that has been split).
+    // Its values and scheduler are a good initial guess as the region (and thus the set of lifted choices) only shrinks.
+    // If no such entry exists, the results of the most recent solver call are used.
+    for (auto entryIt = warmStartEntries.rbegin(); entryIt != warmStartEntries.rend(); ++entryIt) {
+        if (entryIt->dirForParameters == dirForParameters && entryIt->region.isSubRegion(region)) {
+            x = entryIt->x;
+            if (storm::solver::minimize(dirForParameters)) {
+                minSchedChoices = entryIt->schedulerChoices;
+            } else {
+                maxSchedChoices = entryIt->schedulerChoices;
+            }
+            if (--entryIt->remainingUses == 0) {
+                warmStartEntries.erase(std::next(entryIt).base());
+            }
+            return;
+        }
+    }
+}
+
+template<typename SparseModelType, typename ConstantType>
+void SparseDtmcParameterLiftingModelChecker<SparseModelType, ConstantType>::storeWarmStartEntry(
+    storm::storage::ParameterRegion<ValueType> const& region, storm::solver::OptimizationDirection const& dirForParameters,
+    std::vector<uint_fast64_t> const& schedulerChoices) {
+    // Bound the memory consumption by the number of stored values
+    uint64_t const maxNumberOfStoredValues = 10000000;
+    uint64_t const maxNumberOfEntries = std::max<uint64_t>(1, maxNumberOfStoredValues / std::max<uint64_t>(1, x.size() + schedulerChoices.size()));
+    while (warmStartEntries.size() >= maxNumberOfEntries) {
+        warmStartEntries.pop_front();
+    }
+    // Splitting a region yields at most 2^n subregions, where n is the number of parameters.
+    uint64_t const numberOfSubregions = 1ull << std::min<uint64_t>(region.getVariables().size(), 63);
+    warmStartEntries.push_back({region, dirForParameters, x, schedulerChoices, numberOfSubregions});
+}
+
 template<typename SparseModelType, typename ConstantType>
 void SparseDtmcParameterLiftingModelChecker<SparseModelType, ConstantType>::computeRegionSplitEstimates(
     std::vector<ConstantType> const& quantitativeResult, std::vector<uint_fast64_t> const& schedulerChoices,
@@ -547,9 +638,11 @@ void SparseDtmcParameterLiftingModelChecker<SparseModelType, ConstantType>::rese
     stepBound = boost::none;
     instantiationChecker = nullptr;
     parameterLifter = nullptr;
+    intervalParameterLifter = nullptr;
     minSchedChoices = boost::none;
     maxSchedChoices = boost::none;
     x.clear();
+    warmStartEntries.clear();
     lowerResultBound = boost::none;
     upperResultBound = boost::none;
     regionSplitEstimationsEnabled = false;
@@ -589,7 +682,8 @@ boost::optional<storm::storage::Scheduler<ConstantType>> SparseDtmcParameterLift
 
 template<typename SparseModelType, typename ConstantType>
 bool SparseDtmcParameterLiftingModelChecker<SparseModelType, ConstantType>::isRegionSplitEstimateSupported() const {
-    return regionSplitEstimationsEnabled && !stepBound;
+    // The interval model does not provide the scheduler choices that are needed for the estimates
+    return regionSplitEstimationsEnabled && !stepBound && !intervalParameterLifter;
 }
 
 template<typename SparseModelType, typename ConstantType>
@@ -755,6 +849,16 @@ void SparseDtmcParameterLiftingModelChecker<SparseModelType, ConstantType>::rese
     maxSplitDimensions = std::numeric_limits<uint64_t>::max();
 }
 
+template<typename SparseModelType, typename ConstantType>
+void SparseDtmcParameterLiftingModelChecker<SparseModelType, ConstantType>::setUseIntervalModel(bool value) {
+    useIntervalModel = value;
+}
+
+template<typename SparseModelType, typename ConstantType>
+bool SparseDtmcParameterLiftingModelChecker<SparseModelType, ConstantType>::isUseIntervalModelSet() const {
+    return useIntervalModel;
+}
+
 template class SparseDtmcParameterLiftingModelChecker<storm::models::sparse::Dtmc<storm::RationalFunction>, double>;
 template class SparseDtmcParameterLiftingModelChecker<storm::models::sparse::Dtmc<storm::RationalFunction>, storm::RationalNumber>;
 }  // namespace modelchecker
@@ -1,11 +1,13 @@
 #pragma once
 
 #include <boost/optional.hpp>
+#include <deque>
 #include <memory>
 #include <vector>
 
 #include "storm-pars/modelchecker/instantiation/SparseDtmcInstantiationModelChecker.h"
 #include "storm-pars/modelchecker/region/SparseParameterLiftingModelChecker.h"
+#include "storm-pars/transformer/IntervalParameterLifter.h"
 #include "storm-pars/transformer/ParameterLifter.h"
 #include "storm/logic/FragmentSpecification.h"
 #include "storm/solver/MinMaxLinearEquationSolver.h"
@@ -52,6 +54,14 @@ class SparseDtmcParameterLiftingModelChecker : public SparseParameterLiftingMode
     void setMaxSplitDimensions(uint64_t) override;
     void resetMaxSplitDimensions() override;
 
+    /*!
+     * Sets whether the lifted model is expressed as an interval model (one row per state) that is analyzed with robust value iteration,
+     * instead of an MDP with one row per vertex of the region. This is only considered for unbounded reachability probabilities,
+     * without monotonicity and with ConstantType double. Has to be set before specifying the model.
+     */
+    void setUseIntervalModel(bool value);
+    bool isUseIntervalModelSet() const;
+
    protected:
     virtual void specifyBoundedUntilFormula(const CheckTask<storm::logic::BoundedUntilFormula, ConstantType>& checkTask) override;
     virtual void specifyUntilFormula(Environment const& env, CheckTask<storm::logic::UntilFormula, ConstantType> const& checkTask) override;
@@ -66,6 +76,9 @@ class SparseDtmcParameterLiftingModelChecker : public SparseParameterLiftingMode
         Environment const& env, storm::storage::ParameterRegion<ValueType> const& region, storm::solver::OptimizationDirection const& dirForParameters,
         std::shared_ptr<storm::analysis::LocalMonotonicityResult<VariableType>> localMonotonicityResult = nullptr) override;
 
+    std::unique_ptr<CheckResult> computeQuantitativeValuesOnIntervalModel(Environment const& env, storm::storage::ParameterRegion<ValueType> const& region,
+                                                                          storm::solver::OptimizationDirection const& dirForParameters);
+
     void computeRegionSplitEstimates(std::vector<ConstantType> const& quantitativeResult, std::vector<uint_fast64_t> const& schedulerChoices,
                                      storm::storage::ParameterRegion<ValueType> const& region, storm::solver::OptimizationDirection const& dirForParameters);
 
@@ -84,6 +97,8 @@ class SparseDtmcParameterLiftingModelChecker : public SparseParameterLiftingMode
     std::unique_ptr<storm::modelchecker::SparseDtmcInstantiationModelChecker<SparseModelType, ConstantType>> instantiationCheckerVIO;
 
     std::unique_ptr<storm::transformer::ParameterLifter<ValueType, ConstantType>> parameterLifter;
+    bool useIntervalModel;
+    std::unique_ptr<storm::transformer::IntervalParameterLifter<ValueType>> intervalParameterLifter;
     std::unique_ptr<storm::solver::MinMaxLinearEquationSolverFactory<ConstantType>> solverFactory;
     bool solvingRequiresUpperRewardBounds;
 
@@ -92,6 +107,20 @@ class SparseDtmcParameterLiftingModelChecker : public SparseParameterLiftingMode
     std::vector<ConstantType> x;
     boost::optional<ConstantType> lowerResultBound, upperResultBound;
 
+    // Results of previous solver calls. They are used to warm-start the solver when analyzing a subregion, e.g., after a region has been split.
+    struct WarmStartEntry {
+        storm::storage::ParameterRegion<ValueType> region;
+        storm::solver::OptimizationDirection dirForParameters;
+        std::vector<ConstantType> x;
+        std::vector<uint_fast64_t> schedulerChoices;
+        // The number of subregions that can still use this entry
+        uint64_t remainingUses;
+    };
+    void warmStartFromSuperRegion(storm::storage::ParameterRegion<ValueType> const& region, storm::solver::OptimizationDirection const& dirForParameters);
+    void storeWarmStartEntry(storm::storage::ParameterRegion<ValueType> const& region, storm::solver::OptimizationDirection const& dirForParameters,
+                             std::vector<uint_fast64_t> const& schedulerChoices);
+    std::deque<WarmStartEntry> warmStartEntries;
+
     bool regionSplitEstimationsEnabled;
     std::map<VariableType, double> regionSplitEstimates;
     uint64_t maxSplitDimensions;
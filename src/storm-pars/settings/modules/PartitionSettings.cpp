@@ -13,6 +13,10 @@ const std::string PartitionSettings::moduleName = "partitioning";
 const std::string requestedCoverageOptionName = "terminationCondition";
 const std::string printNoIllustrationOptionName = "noillustration";
 const std::string printFullResultOptionName = "printfullresult";
+const std::string parallelRefinementOptionName = "parallel-refinement";
+const std::string checkpointOptionName = "checkpoint";
+const std::string resumeOptionName = "resume";
+const std::string resultCacheOptionName = "resultcache";
 
 PartitionSettings::PartitionSettings() : ModuleSettings(moduleName) {
     this->addOption(storm::settings::OptionBuilder(moduleName, requestedCoverageOptionName, false, "The requested coverage")
@@ -31,6 +35,32 @@ PartitionSettings::PartitionSettings() : ModuleSettings(moduleName) {
         storm::settings::OptionBuilder(moduleName, printNoIllustrationOptionName, false, "If set, no illustration of the result is printed.").build());
     this->addOption(
         storm::settings::OptionBuilder(moduleName, printFullResultOptionName, false, "If set, the full result for every region is printed.").build());
+    this->addOption(storm::settings::OptionBuilder(moduleName, parallelRefinementOptionName, false,
+                                                   "If set, the regions of one refinement depth are analyzed concurrently. Monotonicity is not considered.")
+                        .addArgument(storm::settings::ArgumentBuilder::createUnsignedIntegerArgument("workers", "The number of workers.")
+                                         .setDefaultValueUnsignedInteger(4)
+                                         .addValidatorUnsignedInteger(storm::settings::ArgumentValidatorFactory::createUnsignedGreaterValidator(0))
+                                         .build())
+                        .build());
+    this->addOption(
+        storm::settings::OptionBuilder(moduleName, checkpointOptionName, false,
+                                       "If set, the state of the refinement is periodically written to the given file. Not supported for parallel refinement.")
+            .addArgument(storm::settings::ArgumentBuilder::createStringArgument("filename", "The name of the checkpoint file.").build())
+            .addArgument(storm::settings::ArgumentBuilder::createUnsignedIntegerArgument("interval", "The number of analyzed regions between two checkpoints.")
+                             .setDefaultValueUnsignedInteger(1000)
+                             .makeOptional()
+                             .addValidatorUnsignedInteger(storm::settings::ArgumentValidatorFactory::createUnsignedGreaterValidator(0))
+                             .build())
+            .build());
+    this->addOption(storm::settings::OptionBuilder(moduleName, resumeOptionName, false,
+                                                   "If set, the refinement is resumed from the checkpoint file (if it exists). The coverage threshold may "
+                                                   "differ from the one of the previous run.")
+                        .build());
+    this->addOption(storm::settings::OptionBuilder(moduleName, resultCacheOptionName, false,
+                                                   "If set, conclusive region results are taken from (and stored in) the given file. Not supported for "
+                                                   "parallel refinement.")
+                        .addArgument(storm::settings::ArgumentBuilder::createStringArgument("filename", "The name of the file.").build())
+                        .build());
 }
 
 double PartitionSettings::getCoverageThreshold() const {
@@ -50,6 +80,38 @@ bool PartitionSettings::isPrintFullResultSet() const {
     return this->getOption(printFullResultOptionName).getHasOptionBeenSet();
 }
 
+bool PartitionSettings::isParallelRefinementSet() const {
+    return this->getOption(parallelRefinementOptionName).getHasOptionBeenSet();
+}
+
+uint64_t PartitionSettings::getNumberOfRefinementWorkers() const {
+    return this->getOption(parallelRefinementOptionName).getArgumentByName("workers").getValueAsUnsignedInteger();
+}
+
+bool PartitionSettings::isCheckpointFileSet() const {
+    return this->getOption(checkpointOptionName).getHasOptionBeenSet();
+}
+
+std::string PartitionSettings::getCheckpointFile() const {
+    return this->getOption(checkpointOptionName).getArgumentByName("filename").getValueAsString();
+}
+
+uint64_t PartitionSettings::getCheckpointInterval() const {
+    return this->getOption(checkpointOptionName).getArgumentByName("interval").getValueAsUnsignedInteger();
+}
+
+bool PartitionSettings::isResumeFromCheckpointSet() const {
+    return this->getOption(resumeOptionName).getHasOptionBeenSet();
+}
+
+bool PartitionSettings::isResultCacheFileSet() const {
+    return this->getOption(resultCacheOptionName).getHasOptionBeenSet();
+}
+
+std::string PartitionSettings::getResultCacheFile() const {
+    return this->getOption(resultCacheOptionName).getArgumentByName("filename").getValueAsString();
+}
+
 uint64_t PartitionSettings::getDepthLimit() const {
     int64_t depth = this->getOption(requestedCoverageOptionName).getArgumentByName("depth-limit").getValueAsInteger();
     STORM_LOG_THROW(depth >= 0, storm::exceptions::InvalidOperationException, "Tried to retrieve the depth limit but it was not set.");
@@ -36,6 +36,46 @@ class PartitionSettings : public ModuleSettings {
      */
     bool isPrintFullResultSet() const;
 
+    /*!
+     * Retrieves whether the regions of one refinement depth should be analyzed concurrently.
+     */
+    bool isParallelRefinementSet() const;
+
+    /*!
+     * Retrieves the number of workers for the parallel refinement.
+     */
+    uint64_t getNumberOfRefinementWorkers() const;
+
+    /*!
+     * Retrieves whether checkpoints of the refinement should be written.
+     */
+    bool isCheckpointFileSet() const;
+
+    /*!
+     * Retrieves the file to which checkpoints of the refinement are written.
+     */
+    std::string getCheckpointFile() const;
+
+    /*!
+     * Retrieves the number of analyzed regions between two checkpoints.
+     */
+    uint64_t getCheckpointInterval() const;
+
+    /*!
+     * Retrieves whether the refinement should be resumed from the checkpoint file (if it exists).
+     */
+    bool isResumeFromCheckpointSet() const;
+
+    /*!
+     * Retrieves whether region results should be cached in a file.
+     */
+    bool isResultCacheFileSet() const;
+
+    /*!
+     * Retrieves the file in which region results are cached.
+     */
+    std::string getResultCacheFile() const;
+
     const static std::string moduleName;
 };
 }  // namespace storm::settings::modules
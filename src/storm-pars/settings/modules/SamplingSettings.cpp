@@ -11,6 +11,7 @@ const std::string SamplingSettings::moduleName = "sampling";
 const std::string samplesOptionName = "samples";
 const std::string samplesGraphPreservingOptionName = "samples-graph-preserving";
 const std::string sampleExactOptionName = "sample-exact";
+const std::string sweepOptionName = "sweep";
 
 SamplingSettings::SamplingSettings() : ModuleSettings(moduleName) {
     this->addOption(
@@ -25,6 +26,15 @@ SamplingSettings::SamplingSettings() : ModuleSettings(moduleName) {
                                                    "Sets whether it can be assumed that the samples are graph-preserving.")
                         .build());
     this->addOption(storm::settings::OptionBuilder(moduleName, sampleExactOptionName, false, "Sets whether to sample using exact arithmetic.").build());
+    this->addOption(
+        storm::settings::OptionBuilder(moduleName, sweepOptionName, false,
+                                       "Checks the properties for all combinations of values of the given undefined constants. Constants that only "
+                                       "affect probabilities and rewards are instantiated without rebuilding the model.")
+            .addArgument(storm::settings::ArgumentBuilder::createStringArgument(
+                             "values", "Comma-separated entries of the form 'Const=Val1:Val2:...:Valk', where a value may also be a range 'Lower..Upper' "
+                                       "or 'Lower..Upper..Step'.")
+                             .build())
+            .build());
 }
 
 std::string SamplingSettings::getSamples() const {
@@ -38,4 +48,12 @@ bool SamplingSettings::isSamplesAreGraphPreservingSet() const {
 bool SamplingSettings::isSampleExactSet() const {
     return this->getOption(sampleExactOptionName).getHasOptionBeenSet();
 }
+
+bool SamplingSettings::isSweepSet() const {
+    return this->getOption(sweepOptionName).getHasOptionBeenSet();
+}
+
+std::string SamplingSettings::getSweep() const {
+    return this->getOption(sweepOptionName).getArgumentByName("values").getValueAsString();
+}
 }  // namespace storm::settings::modules
\ No newline at end of file
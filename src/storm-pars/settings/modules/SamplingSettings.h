@@ -23,6 +23,18 @@ class SamplingSettings : public ModuleSettings {
      */
     bool isSampleExactSet() const;
 
+    /*!
+     * Retrieves whether constants of the model are to be swept.
+     */
+    bool isSweepSet() const;
+
+    /*!
+     * Retrieves the constants to sweep as a comma-separated list of entries of the form 'Const=Values', where the values are colon-separated
+     * and each value is either a number or a range 'Lower..Upper' or 'Lower..Upper..Step' (the default step is one). For example,
+     * 'N=1..50,p=0.1..0.9..0.1' means that N takes the values 1 to 50 and p the values 0.1, 0.2, ..., 0.9.
+     */
+    std::string getSweep() const;
+
     static const std::string moduleName;
 };
 
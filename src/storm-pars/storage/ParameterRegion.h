@@ -77,7 +77,8 @@ class ParameterRegion {
     // returns the region as string in the format 0.3<=p<=0.4,0.2<=q<=0.5;
     std::string toString(bool boundariesAsDouble = false) const;
 
-    bool isSubRegion(ParameterRegion<ParametricType> region);
+    // returns true iff the given region is contained in this region
+    bool isSubRegion(ParameterRegion<ParametricType> const& region) const;
 
     CoefficientType getBoundParent();
     void setBoundParent(CoefficientType bound);
@@ -0,0 +1,166 @@
+#include "storm-pars/transformer/IntervalParameterLifter.h"
+
+#include <algorithm>
+#include <unordered_map>
+
+#include "storm/adapters/RationalFunctionAdapter.h"
+#include "storm/exceptions/InvalidArgumentException.h"
+#include "storm/utility/constants.h"
+#include "storm/utility/macros.h"
+
+namespace storm {
+namespace transformer {
+
+template<typename ParametricType>
+IntervalParameterLifter<ParametricType>::IntervalParameterLifter(storm::storage::SparseMatrix<ParametricType> const& pMatrix,
+                                                                 std::vector<ParametricType> const& pVector, storm::storage::BitVector const& selectedRows,
+                                                                 storm::storage::BitVector const& selectedColumns) {
+    numberOfSelectedStates = selectedRows.getNumberOfSetBits();
+    STORM_LOG_THROW(numberOfSelectedStates == selectedColumns.getNumberOfSetBits(), storm::exceptions::InvalidArgumentException,
+                    "The number of selected rows and columns does not coincide.");
+    uint64_t const oneState = numberOfSelectedStates;
+    uint64_t const zeroState = numberOfSelectedStates + 1;
+
+    // get a mapping from old column indices to new ones
+    std::vector<uint64_t> oldToNewColumnIndexMapping(selectedColumns.size(), selectedColumns.size());
+    uint64_t newIndex = 0;
+    for (auto const& oldColumn : selectedColumns) {
+        oldToNewColumnIndexMapping[oldColumn] = newIndex++;
+    }
+
+    // Each distinct non-constant function is only lifted once
+    std::vector<ParametricType> functions;
+    std::unordered_map<ParametricType, uint64_t> functionIndices;
+    std::vector<std::pair<uint64_t, uint64_t>> entryToFunction;
+    uint64_t entryIndex = 0;
+    storm::storage::SparseMatrixBuilder<storm::Interval> builder(numberOfSelectedStates + 2, numberOfSelectedStates + 2, 0, true, false);
+    auto addEntry = [&](uint64_t row, uint64_t column, ParametricType function) {
+        storm::utility::simplify(function);
+        if (storm::utility::isConstant(function)) {
+            double value = storm::utility::convertNumber<double>(function);
+            builder.addNextValue(row, column, storm::Interval(value, value));
+        } else {
+            builder.addNextValue(row, column, storm::Interval(1.0, 1.0));
+            auto functionIndexIt = functionIndices.find(function);
+            if (functionIndexIt == functionIndices.end()) {
+                functionIndexIt = functionIndices.emplace(function, functions.size()).first;
+                functions.push_back(function);
+            }
+            entryToFunction.emplace_back(entryIndex, functionIndexIt->second);
+        }
+        ++entryIndex;
+    };
+
+    uint64_t newRowIndex = 0;
+    for (auto const& rowIndex : selectedRows) {
+        // The mass that does not lead to selected columns or to states with value one leads to states with value zero
+        ParametricType zeroMass = storm::utility::one<ParametricType>() - pVector[rowIndex];
+        for (auto const& entry : pMatrix.getRow(rowIndex)) {
+            if (selectedColumns.get(entry.getColumn())) {
+                zeroMass -= entry.getValue();
+                addEntry(newRowIndex, oldToNewColumnIndexMapping[entry.getColumn()], entry.getValue());
+            }
+        }
+        if (!storm::utility::isZero(pVector[rowIndex])) {
+            addEntry(newRowIndex, oneState, pVector[rowIndex]);
+        }
+        storm::utility::simplify(zeroMass);
+        if (!storm::utility::isZero(zeroMass)) {
+            addEntry(newRowIndex, zeroState, zeroMass);
+        }
+        ++newRowIndex;
+    }
+    // The rows of the additional states remain empty, their value is given by the vector.
+    matrix = builder.build();
+
+    vector = std::vector<storm::Interval>(numberOfSelectedStates + 2, storm::Interval(0.0, 0.0));
+    vector[oneState] = storm::Interval(1.0, 1.0);
+
+    matrixAssignment.reserve(entryToFunction.size());
+    for (auto const& entryFunction : entryToFunction) {
+        matrixAssignment.emplace_back(matrix.begin() + entryFunction.first, entryFunction.second);
+    }
+
+    // Compile the collected functions
+    std::set<VariableType> variables;
+    for (auto const& function : functions) {
+        storm::utility::parametric::gatherOccurringVariables(function, variables);
+    }
+    compiledFunctions = std::make_unique<storm::utility::CompiledRationalFunctions<double>>(std::vector<VariableType>(variables.begin(), variables.end()));
+    liftedFunctions.reserve(functions.size());
+    for (auto const& function : functions) {
+        LiftedFunction lifted;
+        lifted.function = compiledFunctions->addFunction(function);
+        std::set<VariableType> variablesInFunction;
+        storm::utility::parametric::gatherOccurringVariables(function, variablesInFunction);
+        for (auto const& var : variablesInFunction) {
+            lifted.parameters.push_back(compiledFunctions->getVariableIndex(var));
+        }
+        liftedFunctions.push_back(std::move(lifted));
+    }
+}
+
+template<typename ParametricType>
+void IntervalParameterLifter<ParametricType>::specifyRegion(storm::storage::ParameterRegion<ParametricType> const& region) {
+    auto const& variables = compiledFunctions->getVariables();
+    std::vector<double> lowerBoundaries, upperBoundaries;
+    lowerBoundaries.reserve(variables.size());
+    upperBoundaries.reserve(variables.size());
+    for (auto const& var : variables) {
+        lowerBoundaries.push_back(storm::utility::convertNumber<double>(region.getLowerBoundary(var)));
+        upperBoundaries.push_back(storm::utility::convertNumber<double>(region.getUpperBoundary(var)));
+    }
+
+    // Evaluate each function on the vertices of the region (w.r.t. the occurring parameters) and take the hull of the results.
+    std::vector<storm::Interval> ranges;
+    ranges.reserve(liftedFunctions.size());
+    for (auto const& lifted : liftedFunctions) {
+        uint64_t const batchSize = 1ull << lifted.parameters.size();
+        valuations.resize(variables.size() * batchSize);
+        for (uint64_t parameterIndex = 0; parameterIndex < lifted.parameters.size(); ++parameterIndex) {
+            uint64_t const varIndex = lifted.parameters[parameterIndex];
+            for (uint64_t vertex = 0; vertex < batchSize; ++vertex) {
+                valuations[varIndex * batchSize + vertex] = ((vertex >> parameterIndex) & 1) ? upperBoundaries[varIndex] : lowerBoundaries[varIndex];
+            }
+        }
+        compiledFunctions->evaluate(lifted.function, valuations, batchSize, results);
+        auto minMax = std::minmax_element(results.begin(), results.begin() + batchSize);
+        ranges.emplace_back(*minMax.first, *minMax.second);
+    }
+
+    for (auto& assignment : matrixAssignment) {
+        storm::Interval const& range = ranges[assignment.second];
+        STORM_LOG_WARN_COND(
+            range.lower() > 0.0,
+            "Parameter lifting on region "
+                << region.toString()
+                << " affects the underlying graph structure (the region is not strictly well defined). The result for this region might be incorrect.");
+        assignment.first->setValue(range);
+    }
+}
+
+template<typename ParametricType>
+storm::storage::SparseMatrix<storm::Interval> const& IntervalParameterLifter<ParametricType>::getMatrix() const {
+    return matrix;
+}
+
+template<typename ParametricType>
+std::vector<storm::Interval> const& IntervalParameterLifter<ParametricType>::getVector() const {
+    return vector;
+}
+
+template<typename ParametricType>
+std::vector<double> IntervalParameterLifter<ParametricType>::getInitialSolution() const {
+    std::vector<double> result(numberOfSelectedStates + 2, storm::utility::zero<double>());
+    result[numberOfSelectedStates] = storm::utility::one<double>();
+    return result;
+}
+
+template<typename ParametricType>
+uint64_t IntervalParameterLifter<ParametricType>::getNumberOfSelectedStates() const {
+    return numberOfSelectedStates;
+}
+
+template class IntervalParameterLifter<storm::RationalFunction>;
+}  // namespace transformer
+}  // namespace storm
@@ -0,0 +1,81 @@
+#pragma once
+
+#include <memory>
+#include <set>
+#include <vector>
+
+#include "storm-pars/storage/ParameterRegion.h"
+#include "storm-pars/utility/CompiledRationalFunctions.h"
+#include "storm-pars/utility/parametric.h"
+#include "storm/adapters/RationalNumberAdapter.h"
+#include "storm/storage/BitVector.h"
+#include "storm/storage/SparseMatrix.h"
+
+namespace storm {
+namespace transformer {
+
+/*!
+ * This class lifts parameter choices to uncertainty (similar to storm::transformer::AddUncertainty):
+ * Each transition function of the given matrix is replaced by the interval of values it takes on the vertices of the specified region.
+ * In contrast to the ParameterLifter, each row of the given matrix yields exactly one row of the resulting interval matrix.
+ * The result can be analyzed with the robust value iteration for interval models, where the optimization direction for the parameters
+ * is the direction in which the uncertainty is resolved.
+ *
+ * The given vector contains for each row the one-step probability to reach a state with value one.
+ * To keep rows stochastic (as required by the robust value iteration), the resulting matrix has two additional states:
+ * One state with value one that collects the probability mass of the given vector and one state with value zero that collects the remaining mass.
+ *
+ * Compared to the lifted MDP, the interval model might be less precise as the dependencies between the functions of a row are not considered.
+ * However, it has one row per state (instead of one row per vertex of the region).
+ */
+template<typename ParametricType>
+class IntervalParameterLifter {
+   public:
+    typedef typename storm::utility::parametric::VariableType<ParametricType>::type VariableType;
+
+    /*!
+     * Lifts the parameter choices to uncertainty. The computation is performed on the submatrix specified by the selected rows and columns
+     * @param pMatrix the parametric matrix
+     * @param pVector the parametric one-step probabilities to reach a state with value one (the vector size should equal the row count of the matrix)
+     * @param selectedRows a Bitvector that specifies which rows of the matrix and the vector are considered.
+     * @param selectedColumns a Bitvector that specifies which columns of the matrix are considered. Should have as many set bits as selectedRows.
+     */
+    IntervalParameterLifter(storm::storage::SparseMatrix<ParametricType> const& pMatrix, std::vector<ParametricType> const& pVector,
+                            storm::storage::BitVector const& selectedRows, storm::storage::BitVector const& selectedColumns);
+
+    void specifyRegion(storm::storage::ParameterRegion<ParametricType> const& region);
+
+    // Returns the resulting matrix. Should only be called AFTER specifying a region
+    storm::storage::SparseMatrix<storm::Interval> const& getMatrix() const;
+
+    // Returns the resulting vector.
+    std::vector<storm::Interval> const& getVector() const;
+
+    // Returns a vector that can be used as the initial solution (and has the correct values for the two additional states).
+    std::vector<double> getInitialSolution() const;
+
+    // Returns the number of states of the resulting model that correspond to selected rows. The additional states have the subsequent indices.
+    uint64_t getNumberOfSelectedStates() const;
+
+   private:
+    // Stores for each distinct transition function its compiled form and the occurring variables
+    struct LiftedFunction {
+        uint64_t function;
+        std::vector<uint64_t> parameters;
+    };
+
+    std::unique_ptr<storm::utility::CompiledRationalFunctions<double>> compiledFunctions;
+    std::vector<LiftedFunction> liftedFunctions;
+    // Buffers for the evaluation
+    std::vector<double> valuations, results;
+
+    storm::storage::SparseMatrix<storm::Interval> matrix;  // The resulting matrix;
+    std::vector<std::pair<typename storm::storage::SparseMatrix<storm::Interval>::iterator, uint64_t>>
+        matrixAssignment;  // Connection of matrix entries with the index of the corresponding lifted function
+
+    std::vector<storm::Interval> vector;  // The resulting vector
+    uint64_t numberOfSelectedStates;
+};
+
+}  // namespace transformer
+}  // namespace storm
@@ -1,5 +1,7 @@
 #include "storm-pars/transformer/ParameterLifter.h"
 
+#include <algorithm>
+
 #include "storm/adapters/RationalFunctionAdapter.h"
 #include "storm/exceptions/NotSupportedException.h"
 #include "storm/exceptions/UnexpectedException.h"
@@ -346,22 +348,98 @@ ConstantType& ParameterLifter<ParametricType, ConstantType>::FunctionValuationCo
     return insertionRes.first->second;
 }
 
+template<typename ParametricType, typename ConstantType>
+void ParameterLifter<ParametricType, ConstantType>::FunctionValuationCollector::compileCollectedFunctions() {
+    std::set<VariableType> variables;
+    for (auto const& functionValuation : collectedFunctions) {
+        storm::utility::parametric::gatherOccurringVariables(functionValuation.first.first, variables);
+    }
+    compiledFunctions =
+        std::make_unique<storm::utility::CompiledRationalFunctions<ConstantType>>(std::vector<VariableType>(variables.begin(), variables.end()));
+
+    // Each distinct function is compiled only once, even if it occurs with different valuations.
+    std::unordered_map<ParametricType, uint64_t> functionIndices;
+    compiledFunctionValuations.clear();
+    compiledFunctionValuations.reserve(collectedFunctions.size());
+    for (auto& functionValuationPlaceholder : collectedFunctions) {
+        ParametricType const& function = functionValuationPlaceholder.first.first;
+        AbstractValuation const& abstrValuation = functionValuationPlaceholder.first.second;
+        auto functionIndexIt = functionIndices.find(function);
+        if (functionIndexIt == functionIndices.end()) {
+            functionIndexIt = functionIndices.emplace(function, compiledFunctions->addFunction(function)).first;
+        }
+        CompiledFunctionValuation compiled;
+        compiled.function = functionIndexIt->second;
+        compiled.placeholder = &functionValuationPlaceholder.second;
+        for (auto const& par : abstrValuation.getLowerParameters()) {
+            compiled.lowerParameters.push_back(compiledFunctions->getVariableIndex(par));
+        }
+        for (auto const& par : abstrValuation.getUpperParameters()) {
+            compiled.upperParameters.push_back(compiledFunctions->getVariableIndex(par));
+        }
+        for (auto const& par : abstrValuation.getUnspecifiedParameters()) {
+            compiled.unspecifiedParameters.push_back(compiledFunctions->getVariableIndex(par));
+        }
+        compiledFunctionValuations.push_back(std::move(compiled));
+    }
+}
+
 template<typename ParametricType, typename ConstantType>
 void ParameterLifter<ParametricType, ConstantType>::FunctionValuationCollector::evaluateCollectedFunctions(
     storm::storage::ParameterRegion<ParametricType> const& region, storm::solver::OptimizationDirection const& dirForUnspecifiedParameters) {
-    for (auto& collectedFunctionValuationPlaceholder : collectedFunctions) {
-        ParametricType const& function = collectedFunctionValuationPlaceholder.first.first;
-        AbstractValuation const& abstrValuation = collectedFunctionValuationPlaceholder.first.second;
-        ConstantType& placeholder = collectedFunctionValuationPlaceholder.second;
-        auto concreteValuations = abstrValuation.getConcreteValuations(region);
-        auto concreteValuationIt = concreteValuations.begin();
-        placeholder = storm::utility::convertNumber<ConstantType>(storm::utility::parametric::evaluate(function, *concreteValuationIt));
-        for (++concreteValuationIt; concreteValuationIt != concreteValuations.end(); ++concreteValuationIt) {
-            ConstantType currentResult = storm::utility::convertNumber<ConstantType>(storm::utility::parametric::evaluate(function, *concreteValuationIt));
+    if (!compiledFunctions) {
+        compileCollectedFunctions();
+    }
+    auto const& variables = compiledFunctions->getVariables();
+    // Only the functions whose parameters have different boundaries than in the previous call need to be re-evaluated.
+    // This is typically the case for a few parameters only, e.g., when both directions are considered for the same region or for neighboring regions.
+    bool const firstEvaluation = !lastDirForUnspecifiedParameters.is_initialized();
+    bool const directionChanged = firstEvaluation || lastDirForUnspecifiedParameters.get() != dirForUnspecifiedParameters;
+    lowerBoundaries.resize(variables.size());
+    upperBoundaries.resize(variables.size());
+    changedVariables.resize(variables.size());
+    for (uint64_t varIndex = 0; varIndex < variables.size(); ++varIndex) {
+        ConstantType lowerBoundary = storm::utility::convertNumber<ConstantType>(region.getLowerBoundary(variables[varIndex]));
+        ConstantType upperBoundary = storm::utility::convertNumber<ConstantType>(region.getUpperBoundary(variables[varIndex]));
+        changedVariables.set(varIndex, firstEvaluation || lowerBoundary != lowerBoundaries[varIndex] || upperBoundary != upperBoundaries[varIndex]);
+        lowerBoundaries[varIndex] = std::move(lowerBoundary);
+        upperBoundaries[varIndex] = std::move(upperBoundary);
+    }
+    lastDirForUnspecifiedParameters = dirForUnspecifiedParameters;
+
+    auto isChanged = [this](uint64_t const& varIndex) { return changedVariables.get(varIndex); };
+    for (auto const& compiled : compiledFunctionValuations) {
+        bool needsEvaluation = directionChanged && !compiled.unspecifiedParameters.empty();
+        needsEvaluation |= std::any_of(compiled.lowerParameters.begin(), compiled.lowerParameters.end(), isChanged);
+        needsEvaluation |= std::any_of(compiled.upperParameters.begin(), compiled.upperParameters.end(), isChanged);
+        needsEvaluation |= std::any_of(compiled.unspecifiedParameters.begin(), compiled.unspecifiedParameters.end(), isChanged);
+        if (!needsEvaluation) {
+            continue;
+        }
+        // The concrete valuations are the vertices of the region w.r.t. the unspecified parameters. They are evaluated as one batch.
+        uint64_t const batchSize = 1ull << compiled.unspecifiedParameters.size();
+        valuations.resize(variables.size() * batchSize);
+        for (auto const& varIndex : compiled.lowerParameters) {
+            std::fill_n(valuations.begin() + varIndex * batchSize, batchSize, lowerBoundaries[varIndex]);
+        }
+        for (auto const& varIndex : compiled.upperParameters) {
+            std::fill_n(valuations.begin() + varIndex * batchSize, batchSize, upperBoundaries[varIndex]);
+        }
+        for (uint64_t unspecifiedIndex = 0; unspecifiedIndex < compiled.unspecifiedParameters.size(); ++unspecifiedIndex) {
+            uint64_t const varIndex = compiled.unspecifiedParameters[unspecifiedIndex];
+            for (uint64_t vertex = 0; vertex < batchSize; ++vertex) {
+                valuations[varIndex * batchSize + vertex] = ((vertex >> unspecifiedIndex) & 1) ? upperBoundaries[varIndex] : lowerBoundaries[varIndex];
+            }
+        }
+        compiledFunctions->evaluate(compiled.function, valuations, batchSize, results);
+
+        ConstantType& placeholder = *compiled.placeholder;
+        placeholder = results.front();
+        for (uint64_t vertex = 1; vertex < batchSize; ++vertex) {
             if (storm::solver::minimize(dirForUnspecifiedParameters)) {
-                placeholder = std::min(placeholder, currentResult);
+                placeholder = std::min(placeholder, results[vertex]);
             } else {
-                placeholder = std::max(placeholder, currentResult);
+                placeholder = std::max(placeholder, results[vertex]);
             }
         }
     }
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <boost/optional.hpp>
 #include <memory>
 #include <set>
 #include <unordered_map>
@@ -7,6 +8,7 @@
 
 #include "storm-pars/analysis/Order.h"
 #include "storm-pars/storage/ParameterRegion.h"
+#include "storm-pars/utility/CompiledRationalFunctions.h"
 #include "storm-pars/utility/parametric.h"
 #include "storm/solver/OptimizationDirection.h"
 #include "storm/storage/BitVector.h"
@@ -145,6 +147,16 @@ class ParameterLifter {
         // Stores a function and a valuation. The valuation is stored as an index of the collectedValuations-vector.
         typedef std::pair<ParametricType, AbstractValuation> FunctionValuation;
 
+        // A collected function and valuation where the function is compiled and the parameters are replaced by their indices in the compiled functions.
+        struct CompiledFunctionValuation {
+            uint64_t function;
+            ConstantType* placeholder;
+            std::vector<uint64_t> lowerParameters, upperParameters, unspecifiedParameters;
+        };
+
+        // Compiles the collected functions. This is done when evaluating the functions for the first time.
+        void compileCollectedFunctions();
+
         class FuncValHash {
            public:
             std::size_t operator()(FunctionValuation const& fv) const {
@@ -157,6 +169,15 @@ class ParameterLifter {
 
         // Stores the collected functions with the valuations together with a placeholder for the result.
         std::unordered_map<FunctionValuation, ConstantType, FuncValHash> collectedFunctions;
+
+        std::unique_ptr<storm::utility::CompiledRationalFunctions<ConstantType>> compiledFunctions;
+        std::vector<CompiledFunctionValuation> compiledFunctionValuations;
+        // The boundaries and the direction of the most recent evaluation. Used to only re-evaluate the functions that are affected by a change.
+        std::vector<ConstantType> lowerBoundaries, upperBoundaries;
+        boost::optional<storm::solver::OptimizationDirection> lastDirForUnspecifiedParameters;
+        storm::storage::BitVector changedVariables;
+        // Buffers for the evaluation
+        std::vector<ConstantType> valuations, results;
     };
 
     FunctionValuationCollector functionValuationCollector;
@@ -0,0 +1,86 @@
+#include "storm-pars/transformer/SparseParametricDtmcPreprocessor.h"
+
+#include "storm-pars/transformer/BinaryDtmcTransformer.h"
+#include "storm-pars/transformer/SparseParametricDtmcSimplifier.h"
+#include "storm-pars/transformer/TimeTravelling.h"
+
+#include "storm/modelchecker/CheckTask.h"
+#include "storm/utility/macros.h"
+
+#include "storm/exceptions/InvalidArgumentException.h"
+#include "storm/exceptions/UnexpectedException.h"
+
+namespace storm {
+namespace transformer {
+
+SparseParametricDtmcPreprocessor::SparseParametricDtmcPreprocessor(Options const& options) : options(options) {
+    // Intentionally left empty
+}
+
+std::shared_ptr<storm::models::sparse::Dtmc<storm::RationalFunction>> SparseParametricDtmcPreprocessor::preprocess(
+    std::shared_ptr<storm::models::sparse::Dtmc<storm::RationalFunction>> const& model, std::shared_ptr<storm::logic::Formula const> const& formula) {
+    STORM_LOG_THROW(formula || (!options.simplify && !options.timeTravel), storm::exceptions::InvalidArgumentException,
+                    "Simplification and time-travelling require a formula.");
+    this->formula = formula;
+    stageStatistics.clear();
+    auto result = model;
+
+    if (options.simplify) {
+        auto& watch = startStage("simplification");
+        SparseParametricDtmcSimplifier<storm::models::sparse::Dtmc<storm::RationalFunction>> simplifier(*result);
+        STORM_LOG_THROW(simplifier.simplify(*this->formula), storm::exceptions::UnexpectedException, "Simplifying the model was not successful.");
+        result = simplifier.getSimplifiedModel();
+        this->formula = simplifier.getSimplifiedFormula();
+        watch.stop();
+        finishStage(*result);
+    }
+
+    if (options.transformToSimple) {
+        auto& watch = startStage("transformation to simple pDTMC");
+        BinaryDtmcTransformer transformer;
+        result = transformer.transform(*result, options.keepStateValuations);
+        watch.stop();
+        finishStage(*result);
+    }
+
+    if (options.timeTravel) {
+        auto& watch = startStage("time-travelling");
+        TimeTravelling timeTravelling;
+        storm::modelchecker::CheckTask<storm::logic::Formula, storm::RationalFunction> checkTask(*this->formula);
+        result = std::make_shared<storm::models::sparse::Dtmc<storm::RationalFunction>>(timeTravelling.timeTravel(*result, checkTask));
+        watch.stop();
+        finishStage(*result);
+    }
+
+    return result;
+}
+
+std::shared_ptr<storm::logic::Formula const> const& SparseParametricDtmcPreprocessor::getFormula() const {
+    return formula;
+}
+
+std::vector<SparseParametricDtmcPreprocessor::StageStatistics> const& SparseParametricDtmcPreprocessor::getStageStatistics() const {
+    return stageStatistics;
+}
+
+void SparseParametricDtmcPreprocessor::printStatisticsToStream(std::ostream& out) const {
+    out << "Preprocessing statistics:\n";
+    for (auto const& stage : stageStatistics) {
+        out << "    Time for " << stage.name << ": " << stage.watch << " (resulting model has " << stage.numberOfStates << " states and "
+            << stage.numberOfTransitions << " transitions).\n";
+    }
+}
+
+storm::utility::Stopwatch& SparseParametricDtmcPreprocessor::startStage(std::string const& name) {
+    STORM_LOG_INFO("Preprocessing stage: " << name << ".");
+    stageStatistics.push_back({name, storm::utility::Stopwatch(true), 0, 0});
+    return stageStatistics.back().watch;
+}
+
+void SparseParametricDtmcPreprocessor::finishStage(storm::models::sparse::Dtmc<storm::RationalFunction> const& result) {
+    stageStatistics.back().numberOfStates = result.getNumberOfStates();
+    stageStatistics.back().numberOfTransitions = result.getNumberOfTransitions();
+}
+
+}  // namespace transformer
+}  // namespace storm
@@ -0,0 +1,71 @@
+#pragma once
+
+#include <memory>
+#include <ostream>
+#include <string>
+#include <vector>
+
+#include "storm/adapters/RationalFunctionAdapter.h"
+#include "storm/logic/Formula.h"
+#include "storm/models/sparse/Dtmc.h"
+#include "storm/utility/Stopwatch.h"
+
+namespace storm {
+namespace transformer {
+
+/*!
+ * Runs the preprocessing steps for parametric DTMCs as one pipeline. The stages are (in this order)
+ * 1. the simplification of the model w.r.t. the formula (see SparseParametricDtmcSimplifier),
+ * 2. the transformation into a simple pDTMC (see BinaryDtmcTransformer), and
+ * 3. time-travelling (see TimeTravelling), which requires a simple pDTMC.
+ * Each enabled stage works on the result of the previous stage. For each executed stage, the time and the size of the resulting model are recorded.
+ */
+class SparseParametricDtmcPreprocessor {
+   public:
+    struct Options {
+        bool simplify = false;
+        bool transformToSimple = false;
+        bool timeTravel = false;
+        // Blow up the state valuations of the DTMC when transforming it into a simple pDTMC
+        bool keepStateValuations = true;
+    };
+
+    struct StageStatistics {
+        std::string name;
+        storm::utility::Stopwatch watch;
+        uint64_t numberOfStates;
+        uint64_t numberOfTransitions;
+    };
+
+    SparseParametricDtmcPreprocessor(Options const& options);
+
+    /*!
+     * Preprocesses the given model.
+     * @param formula the considered formula. May only be null if neither simplification nor time-travelling is enabled.
+     * @return the preprocessed model. The formula to check on this model is given by getFormula().
+     */
+    std::shared_ptr<storm::models::sparse::Dtmc<storm::RationalFunction>> preprocess(
+        std::shared_ptr<storm::models::sparse::Dtmc<storm::RationalFunction>> const& model, std::shared_ptr<storm::logic::Formula const> const& formula);
+
+    /*!
+     * Retrieves the formula that has to be considered on the preprocessed model.
+     */
+    std::shared_ptr<storm::logic::Formula const> const& getFormula() const;
+
+    std::vector<StageStatistics> const& getStageStatistics() const;
+
+    void printStatisticsToStream(std::ostream& out) const;
+
+   private:
+    // Starts recording the statistics for a new stage
+    storm::utility::Stopwatch& startStage(std::string const& name);
+    // Finishes the statistics of the current stage
+    void finishStage(storm::models::sparse::Dtmc<storm::RationalFunction> const& result);
+
+    Options options;
+    std::shared_ptr<storm::logic::Formula const> formula;
+    std::vector<StageStatistics> stageStatistics;
+};
+
+}  // namespace transformer
+}  // namespace storm
@@ -77,7 +77,6 @@ models::sparse::Dtmc<RationalFunction> TimeTravelling::timeTravel(models::sparse
     std::map<RationalFunctionVariable, std::map<uint64_t, std::set<uint64_t>>> treeStates;
     std::map<RationalFunctionVariable, std::set<uint64_t>> workingSets;
 
-    auto backwardsTransitions = flexibleMatrix.createSparseMatrix().transpose(true);
     // Count number of parameter occurences per state
     for (uint64_t row = 0; row < flexibleMatrix.getRowCount(); row++) {
         for (auto const& entry : flexibleMatrix.getRow(row)) {
@@ -214,38 +213,35 @@ models::sparse::Dtmc<RationalFunction> TimeTravelling::timeTravel(models::sparse
                 directProbs[entry.getColumn()] = entry.getValue();
             }
 
-            // TODO slow could be done better if flexible matrix had ability to add states
-            uint64_t newMatrixSize = flexibleMatrix.getRowCount() + 3 * parameterBuckets.size();
+            // The new states are added to the flexible matrix in place
+            uint64_t const oldMatrixSize = flexibleMatrix.getRowCount();
+            uint64_t newMatrixSize = oldMatrixSize + 3 * parameterBuckets.size();
             if (parameterBuckets.count(constantVariable)) {
                 newMatrixSize -= 2;
             }
-            storage::SparseMatrixBuilder<RationalFunction> builder;
-            storage::FlexibleSparseMatrix<RationalFunction> matrixWithAdditionalStates(builder.build(newMatrixSize, newMatrixSize, 0));
-            for (uint64_t row = 0; row < flexibleMatrix.getRowCount(); row++) {
-                matrixWithAdditionalStates.getRow(row) = flexibleMatrix.getRow(row);
-            }
+            flexibleMatrix.resize(newMatrixSize, newMatrixSize);
 
             workingSets.clear();
 
-            uint64_t newStateIndex = flexibleMatrix.getRowCount();
-            matrixWithAdditionalStates.getRow(state).clear();
+            uint64_t newStateIndex = oldMatrixSize;
+            flexibleMatrix.getRow(state).clear();
             for (auto const& entry : parameterBuckets) {
-                matrixWithAdditionalStates.getRow(state).push_back(
+                flexibleMatrix.getRow(state).push_back(
                     storage::MatrixEntry<uint64_t, RationalFunction>(newStateIndex, cumulativeProbabilities.at(entry.first)));
                 STORM_LOG_INFO("Reorder: " << state << " -> " << newStateIndex);
 
                 if (entry.first == constantVariable) {
                     for (auto const& successor : entry.second) {
-                        matrixWithAdditionalStates.getRow(newStateIndex)
+                        flexibleMatrix.getRow(newStateIndex)
                             .push_back(storage::MatrixEntry<uint64_t, RationalFunction>(successor,
                                                                                         directProbs.at(successor) / cumulativeProbabilities.at(entry.first)));
                     }
                     // Issue: multiple transitions can go to a single state, not allowed
                     // Solution: Join them
-                    matrixWithAdditionalStates.getRow(newStateIndex) = joinDuplicateTransitions(matrixWithAdditionalStates.getRow(newStateIndex));
+                    flexibleMatrix.getRow(newStateIndex) = joinDuplicateTransitions(flexibleMatrix.getRow(newStateIndex));
 
                     workingSets[entry.first].emplace(newStateIndex);
-                    for (auto const& entry : matrixWithAdditionalStates.getRow(newStateIndex)) {
+                    for (auto const& entry : flexibleMatrix.getRow(newStateIndex)) {
                         for (auto const& parameter : allParameters) {
                             workingSets[parameter].emplace(entry.getColumn());
                         }
@@ -253,9 +249,9 @@ models::sparse::Dtmc<RationalFunction> TimeTravelling::timeTravel(models::sparse
 
                     newStateIndex += 1;
                 } else {
-                    matrixWithAdditionalStates.getRow(newStateIndex)
+                    flexibleMatrix.getRow(newStateIndex)
                         .push_back(storage::MatrixEntry<uint64_t, RationalFunction>(newStateIndex + 1, pRationalFunctions.at(entry.first)));
-                    matrixWithAdditionalStates.getRow(newStateIndex)
+                    flexibleMatrix.getRow(newStateIndex)
                         .push_back(storage::MatrixEntry<uint64_t, RationalFunction>(newStateIndex + 2, oneMinusPRationalFunctions.at(entry.first)));
 
                     for (auto const& successor : entry.second) {
@@ -268,29 +264,29 @@ models::sparse::Dtmc<RationalFunction> TimeTravelling::timeTravel(models::sparse
                         // If it's still needed, re-count it
                         workingSets[entry.first].emplace(successor);
 
-                        matrixWithAdditionalStates.getRow(newStateIndex + 1)
+                        flexibleMatrix.getRow(newStateIndex + 1)
                             .push_back(storage::MatrixEntry<uint64_t, RationalFunction>(pTransitions.at(successor),
                                                                                         directProbs.at(successor) / cumulativeProbabilities.at(entry.first)));
-                        matrixWithAdditionalStates.getRow(newStateIndex + 2)
+                        flexibleMatrix.getRow(newStateIndex + 2)
                             .push_back(storage::MatrixEntry<uint64_t, RationalFunction>(oneMinusPTransitions.at(successor),
                                                                                         directProbs.at(successor) / cumulativeProbabilities.at(entry.first)));
                     }
                     // Issue: multiple transitions can go to a single state, not allowed
                     // Solution: Join them
-                    matrixWithAdditionalStates.getRow(newStateIndex + 1) = joinDuplicateTransitions(matrixWithAdditionalStates.getRow(newStateIndex + 1));
-                    matrixWithAdditionalStates.getRow(newStateIndex + 2) = joinDuplicateTransitions(matrixWithAdditionalStates.getRow(newStateIndex + 2));
+                    flexibleMatrix.getRow(newStateIndex + 1) = joinDuplicateTransitions(flexibleMatrix.getRow(newStateIndex + 1));
+                    flexibleMatrix.getRow(newStateIndex + 2) = joinDuplicateTransitions(flexibleMatrix.getRow(newStateIndex + 2));
 
                     treeStates[entry.first][newStateIndex].emplace(newStateIndex);
                     workingSets[entry.first].emplace(newStateIndex);
                     workingSets[entry.first].emplace(newStateIndex + 1);
                     workingSets[entry.first].emplace(newStateIndex + 2);
 
-                    for (auto const& entry : matrixWithAdditionalStates.getRow(newStateIndex + 1)) {
+                    for (auto const& entry : flexibleMatrix.getRow(newStateIndex + 1)) {
                         for (auto const& parameter : allParameters) {
                             workingSets[parameter].emplace(entry.getColumn());
                         }
                     }
-                    for (auto const& entry : matrixWithAdditionalStates.getRow(newStateIndex + 2)) {
+                    for (auto const& entry : flexibleMatrix.getRow(newStateIndex + 2)) {
                         for (auto const& parameter : allParameters) {
                             workingSets[parameter].emplace(entry.getColumn());
                         }
@@ -301,10 +297,9 @@ models::sparse::Dtmc<RationalFunction> TimeTravelling::timeTravel(models::sparse
             }
 
             // Extend labeling to more states
-            models::sparse::StateLabeling nextNewLabels =
-                extendStateLabeling(runningLabeling, flexibleMatrix.getRowCount(), newMatrixSize, state, labelsInFormula);
+            models::sparse::StateLabeling nextNewLabels = extendStateLabeling(runningLabeling, oldMatrixSize, newMatrixSize, state, labelsInFormula);
 
-            for (uint64_t i = flexibleMatrix.getRowCount(); i < newMatrixSize; i++) {
+            for (uint64_t i = oldMatrixSize; i < newMatrixSize; i++) {
                 // Next consider the new states
                 topologicalOrderingStack.push(i);
                 // New states have zero reward
@@ -312,12 +307,9 @@ models::sparse::Dtmc<RationalFunction> TimeTravelling::timeTravel(models::sparse
                     stateRewardVector->push_back(storm::utility::zero<RationalFunction>());
                 }
             }
-            runningLabeling = nextNewLabels;
+            runningLabeling = std::move(nextNewLabels);
 
-            updateTreeStates(treeStates, workingSets, matrixWithAdditionalStates, allParameters, stateRewardVector, runningLabeling, labelsInFormula);
-
-            flexibleMatrix = matrixWithAdditionalStates;
-            backwardsTransitions = flexibleMatrix.createSparseMatrix().transpose(true);
+            updateTreeStates(treeStates, workingSets, flexibleMatrix, allParameters, stateRewardVector, runningLabeling, labelsInFormula);
         }
     }
 
@@ -400,22 +392,15 @@ std::vector<storm::storage::MatrixEntry<uint64_t, RationalFunction>> TimeTravell
 
 models::sparse::StateLabeling TimeTravelling::extendStateLabeling(models::sparse::StateLabeling const& oldLabeling, uint64_t oldSize, uint64_t newSize,
                                                                   uint64_t stateWithLabels, const std::set<std::string> labelsInFormula) {
+    STORM_LOG_ASSERT(oldLabeling.getNumberOfItems() == oldSize, "Unexpected size of the labeling.");
     models::sparse::StateLabeling newLabels(newSize);
+    // Copy the labelings as a whole instead of iterating over the states
     for (auto const& label : oldLabeling.getLabels()) {
-        newLabels.addLabel(label);
-    }
-    for (uint64_t state = 0; state < oldSize; state++) {
-        for (auto const& label : oldLabeling.getLabelsOfState(state)) {
-            newLabels.addLabelToState(label, state);
-        }
-    }
-    for (uint64_t i = oldSize; i < newSize; i++) {
+        storage::BitVector states = oldLabeling.getStates(label);
         // We assume that everything that we time-travel has the same labels for now.
-        for (auto const& label : oldLabeling.getLabelsOfState(stateWithLabels)) {
-            if (labelsInFormula.count(label)) {
-                newLabels.addLabelToState(label, i);
-            }
-        }
+        bool labelNewStates = labelsInFormula.count(label) > 0 && states.get(stateWithLabels);
+        states.resize(newSize, labelNewStates);
+        newLabels.addLabel(label, std::move(states));
     }
     return newLabels;
 }
@@ -0,0 +1,144 @@
+#include "storm-pars/utility/CompiledRationalFunctions.h"
+
+#include <algorithm>
+#include <set>
+
+#include "storm/adapters/RationalFunctionAdapter.h"
+#include "storm/exceptions/InvalidArgumentException.h"
+#include "storm/utility/constants.h"
+#include "storm/utility/macros.h"
+
+namespace storm {
+namespace utility {
+
+template<typename ConstantType>
+CompiledRationalFunctions<ConstantType>::CompiledRationalFunctions(std::vector<VariableType> const& variables) : variables(variables) {
+    for (uint64_t index = 0; index < variables.size(); ++index) {
+        variableIndices.emplace(variables[index], index);
+    }
+}
+
+template<typename ConstantType>
+uint64_t CompiledRationalFunctions<ConstantType>::addFunction(storm::RationalFunction const& function) {
+    Function compiled;
+    compiled.firstPower = powers.size();
+    compiled.firstNumeratorTerm = terms.size();
+    std::map<std::pair<uint64_t, uint64_t>, uint64_t> powerIndices;
+    if (function.denominator().isConstant()) {
+        addTerms(function.nominator().polynomialWithCoefficient(), function.denominator().constantPart(), powerIndices, compiled.firstPower);
+        compiled.firstDenominatorTerm = terms.size();
+    } else {
+        auto const one = storm::utility::one<storm::RationalFunctionCoefficient>();
+        addTerms(function.nominator().polynomialWithCoefficient(), one, powerIndices, compiled.firstPower);
+        compiled.firstDenominatorTerm = terms.size();
+        addTerms(function.denominator().polynomialWithCoefficient(), one, powerIndices, compiled.firstPower);
+    }
+    compiled.endDenominatorTerm = terms.size();
+    compiled.endPower = powers.size();
+    functions.push_back(compiled);
+    return functions.size() - 1;
+}
+
+template<typename ConstantType>
+void CompiledRationalFunctions<ConstantType>::addTerms(storm::RawPolynomial const& polynomial, storm::RationalFunctionCoefficient const& divisor,
+                                                       std::map<std::pair<uint64_t, uint64_t>, uint64_t>& powerIndices, uint64_t firstPower) {
+    std::set<VariableType> termVariables;
+    for (auto const& term : polynomial) {
+        Term compiledTerm;
+        compiledTerm.coefficient = storm::utility::convertNumber<ConstantType>(storm::RationalFunctionCoefficient(term.coeff() / divisor));
+        compiledTerm.firstFactor = factors.size();
+        termVariables.clear();
+        term.gatherVariables(termVariables);
+        for (auto const& variable : termVariables) {
+            std::pair<uint64_t, uint64_t> power(getVariableIndex(variable), term.monomial()->exponentOfVariable(variable));
+            auto insertionRes = powerIndices.emplace(power, powers.size() - firstPower);
+            if (insertionRes.second) {
+                powers.push_back({power.first, power.second});
+            }
+            factors.push_back(insertionRes.first->second);
+        }
+        compiledTerm.endFactor = factors.size();
+        terms.push_back(std::move(compiledTerm));
+    }
+}
+
+template<typename ConstantType>
+uint64_t CompiledRationalFunctions<ConstantType>::getNumberOfFunctions() const {
+    return functions.size();
+}
+
+template<typename ConstantType>
+std::vector<typename CompiledRationalFunctions<ConstantType>::VariableType> const& CompiledRationalFunctions<ConstantType>::getVariables() const {
+    return variables;
+}
+
+template<typename ConstantType>
+uint64_t CompiledRationalFunctions<ConstantType>::getVariableIndex(VariableType const& variable) const {
+    auto findRes = variableIndices.find(variable);
+    STORM_LOG_THROW(findRes != variableIndices.end(), storm::exceptions::InvalidArgumentException,
+                    "The variable " << variable << " has not been declared for the compiled functions.");
+    return findRes->second;
+}
+
+template<typename ConstantType>
+ConstantType CompiledRationalFunctions<ConstantType>::evaluate(uint64_t function, std::vector<ConstantType> const& valuation) {
+    std::vector<ConstantType> result;
+    evaluate(function, valuation, 1, result);
+    return result.front();
+}
+
+template<typename ConstantType>
+void CompiledRationalFunctions<ConstantType>::evaluate(uint64_t function, std::vector<ConstantType> const& valuations, uint64_t batchSize,
+                                                       std::vector<ConstantType>& result) {
+    STORM_LOG_ASSERT(function < functions.size(), "Invalid function index " << function << ".");
+    STORM_LOG_ASSERT(valuations.size() == variables.size() * batchSize, "Unexpected size of the valuations.");
+    Function const& compiled = functions[function];
+
+    // Compute the occurring powers of the variables
+    uint64_t const numberOfPowers = compiled.endPower - compiled.firstPower;
+    powerValues.resize(numberOfPowers * batchSize);
+    for (uint64_t powerIndex = 0; powerIndex < numberOfPowers; ++powerIndex) {
+        Power const& power = powers[compiled.firstPower + powerIndex];
+        auto powerIt = powerValues.begin() + powerIndex * batchSize;
+        auto valueIt = valuations.begin() + power.variable * batchSize;
+        std::copy(valueIt, valueIt + batchSize, powerIt);
+        for (uint64_t exponent = 1; exponent < power.exponent; ++exponent) {
+            for (uint64_t sample = 0; sample < batchSize; ++sample) {
+                powerIt[sample] *= valueIt[sample];
+            }
+        }
+    }
+
+    evaluateTerms(compiled.firstNumeratorTerm, compiled.firstDenominatorTerm, batchSize, result);
+    if (compiled.firstDenominatorTerm != compiled.endDenominatorTerm) {
+        evaluateTerms(compiled.firstDenominatorTerm, compiled.endDenominatorTerm, batchSize, denominatorValues);
+        for (uint64_t sample = 0; sample < batchSize; ++sample) {
+            result[sample] /= denominatorValues[sample];
+        }
+    }
+}
+
+template<typename ConstantType>
+void CompiledRationalFunctions<ConstantType>::evaluateTerms(uint64_t firstTerm, uint64_t endTerm, uint64_t batchSize, std::vector<ConstantType>& result) {
+    result.assign(batchSize, storm::utility::zero<ConstantType>());
+    for (uint64_t termIndex = firstTerm; termIndex < endTerm; ++termIndex) {
+        Term const& term = terms[termIndex];
+        termValues.assign(batchSize, term.coefficient);
+        for (uint64_t factorIndex = term.firstFactor; factorIndex < term.endFactor; ++factorIndex) {
+            auto powerIt = powerValues.begin() + factors[factorIndex] * batchSize;
+            for (uint64_t sample = 0; sample < batchSize; ++sample) {
+                termValues[sample] *= powerIt[sample];
+            }
+        }
+        for (uint64_t sample = 0; sample < batchSize; ++sample) {
+            result[sample] += termValues[sample];
+        }
+    }
+}
+
+#ifdef STORM_HAVE_CARL
+template class CompiledRationalFunctions<double>;
+template class CompiledRationalFunctions<storm::RationalNumber>;
+#endif
+}  // namespace utility
+}  // namespace storm
@@ -0,0 +1,95 @@
+#pragma once
+
+#include <map>
+#include <vector>
+
+#include "storm/adapters/RationalFunctionForward.h"
+
+namespace storm {
+namespace utility {
+
+/*!
+ * Stores rational functions in a compiled form that can be evaluated without the overhead of (carl) valuation maps.
+ * Each function is stored as the list of terms of its numerator and denominator. A term consists of a coefficient and references to powers of variables.
+ * Upon evaluation, the powers occurring in the function are computed once and each term only requires a few multiplications.
+ * Valuations are vectors of values, where the i-th entry is the value of the i-th variable given upon construction.
+ * Functions can be evaluated for a batch of valuations at once such that the loops over the batch can be vectorized.
+ *
+ * @note Evaluation is not thread safe as internal buffers are reused.
+ */
+template<typename ConstantType>
+class CompiledRationalFunctions {
+   public:
+    typedef storm::RationalFunctionVariable VariableType;
+
+    /*!
+     * @param variables the variables that may occur in the functions. The order determines the positions of the values in the valuations.
+     */
+    CompiledRationalFunctions(std::vector<VariableType> const& variables);
+
+    /*!
+     * Compiles the given function and returns its index.
+     */
+    uint64_t addFunction(storm::RationalFunction const& function);
+
+    uint64_t getNumberOfFunctions() const;
+    std::vector<VariableType> const& getVariables() const;
+
+    /*!
+     * Returns the position of the given variable within valuations.
+     */
+    uint64_t getVariableIndex(VariableType const& variable) const;
+
+    /*!
+     * Evaluates the function with the given index w.r.t. the given valuation.
+     */
+    ConstantType evaluate(uint64_t function, std::vector<ConstantType> const& valuation);
+
+    /*!
+     * Evaluates the function with the given index w.r.t. a batch of valuations.
+     * @param valuations the values of the variables. The value of the i-th variable in the j-th valuation is at position i * batchSize + j.
+     * @param batchSize the number of valuations
+     * @param result the j-th entry is set to the value of the function for the j-th valuation.
+     */
+    void evaluate(uint64_t function, std::vector<ConstantType> const& valuations, uint64_t batchSize, std::vector<ConstantType>& result);
+
+   private:
+    struct Power {
+        uint64_t variable;
+        uint64_t exponent;
+    };
+
+    struct Term {
+        ConstantType coefficient;
+        // The range of factors of this term. Each factor is the index of a power relative to the first power of the function.
+        uint64_t firstFactor;
+        uint64_t endFactor;
+    };
+
+    struct Function {
+        uint64_t firstPower;
+        uint64_t endPower;
+        uint64_t firstNumeratorTerm;
+        // The denominator terms start where the numerator terms end. A constant denominator is folded into the numerator coefficients.
+        uint64_t firstDenominatorTerm;
+        uint64_t endDenominatorTerm;
+    };
+
+    void addTerms(storm::RawPolynomial const& polynomial, storm::RationalFunctionCoefficient const& divisor,
+                  std::map<std::pair<uint64_t, uint64_t>, uint64_t>& powerIndices, uint64_t firstPower);
+    void evaluateTerms(uint64_t firstTerm, uint64_t endTerm, uint64_t batchSize, std::vector<ConstantType>& result);
+
+    std::vector<VariableType> variables;
+    std::map<VariableType, uint64_t> variableIndices;
+
+    std::vector<Function> functions;
+    std::vector<Power> powers;
+    std::vector<Term> terms;
+    std::vector<uint64_t> factors;
+
+    // Buffers used during evaluation
+    std::vector<ConstantType> powerValues, termValues, denominatorValues;
+};
+
+}  // namespace utility
+}  // namespace storm
@@ -0,0 +1,249 @@
+#include "storm-pars/utility/ConstantSweep.h"
+
+#include <set>
+#include <sstream>
+#include <type_traits>
+
+#include "storm-pars/modelchecker/instantiation/SparseCtmcInstantiationModelChecker.h"
+#include "storm-pars/modelchecker/instantiation/SparseDtmcInstantiationModelChecker.h"
+#include "storm-pars/modelchecker/instantiation/SparseMdpInstantiationModelChecker.h"
+#include "storm-pars/utility/parametric.h"
+
+#include "storm/adapters/IntelTbbAdapter.h"
+#include "storm/adapters/RationalFunctionAdapter.h"
+#include "storm/api/builder.h"
+#include "storm/api/properties.h"
+#include "storm/api/verification.h"
+#include "storm/exceptions/InvalidArgumentException.h"
+#include "storm/exceptions/NotSupportedException.h"
+#include "storm/modelchecker/results/ExplicitQualitativeCheckResult.h"
+#include "storm/models/sparse/Ctmc.h"
+#include "storm/models/sparse/Dtmc.h"
+#include "storm/models/sparse/Mdp.h"
+#include "storm/utility/constants.h"
+#include "storm/utility/macros.h"
+
+namespace storm {
+namespace utility {
+
+namespace detail {
+
+typedef std::map<storm::expressions::Variable, storm::RationalNumber> SweepPoint;
+
+// Enumerates the cartesian product of the values of the given constants, where the last constant changes the fastest.
+std::vector<SweepPoint> getSweepPoints(std::vector<storm::expressions::Variable> const& constants,
+                                       std::map<storm::expressions::Variable, std::vector<storm::RationalNumber>> const& values) {
+    std::vector<SweepPoint> result(1);
+    for (auto const& constant : constants) {
+        std::vector<SweepPoint> extended;
+        for (auto const& point : result) {
+            for (auto const& value : values.at(constant)) {
+                extended.push_back(point);
+                extended.back().emplace(constant, value);
+            }
+        }
+        result = std::move(extended);
+    }
+    return result;
+}
+
+std::map<storm::expressions::Variable, storm::expressions::Expression> getConstantDefinitions(SweepPoint const& point) {
+    std::map<storm::expressions::Variable, storm::expressions::Expression> result;
+    for (auto const& [constant, value] : point) {
+        if (constant.hasIntegerType()) {
+            result.emplace(constant, constant.getManager().integer(storm::utility::convertNumber<int_fast64_t>(value)));
+        } else {
+            result.emplace(constant, constant.getManager().rational(value));
+        }
+    }
+    return result;
+}
+
+/*!
+ * Checks the given formulas on instantiations of the given parametric model.
+ * The valuations come in chunks, each of which is checked with its own instantiation model checker. All carl objects are created and destroyed outside of
+ * the parallel section, which only evaluates the compiled functions of the instantiators.
+ * @return for each formula and each valuation (in the order of the chunks) the result for the initial states.
+ */
+template<template<typename, typename> class ModelCheckerType, typename ModelType, typename ConstantType>
+std::vector<std::vector<std::unique_ptr<storm::modelchecker::CheckResult>>> checkInstantiations(
+    Environment const& env, ModelType const& model, std::vector<std::shared_ptr<storm::logic::Formula const>> const& formulas,
+    std::vector<std::vector<storm::utility::parametric::Valuation<storm::RationalFunction>>> const& chunks, bool graphPreserving) {
+    std::vector<std::unique_ptr<ModelCheckerType<ModelType, ConstantType>>> modelCheckers;
+    std::vector<uint64_t> chunkOffsets(1, 0);
+    for (auto const& chunk : chunks) {
+        modelCheckers.push_back(std::make_unique<ModelCheckerType<ModelType, ConstantType>>(model));
+        modelCheckers.back()->setInstantiationsAreGraphPreserving(graphPreserving);
+        chunkOffsets.push_back(chunkOffsets.back() + chunk.size());
+    }
+
+    std::vector<std::vector<std::unique_ptr<storm::modelchecker::CheckResult>>> result;
+    storm::modelchecker::ExplicitQualitativeCheckResult initialStatesFilter(model.getInitialStates());
+    for (auto const& formula : formulas) {
+        for (auto& modelChecker : modelCheckers) {
+            modelChecker->specifyFormula(storm::api::createTask<storm::RationalFunction>(formula, true));
+        }
+        std::vector<std::unique_ptr<storm::modelchecker::CheckResult>> formulaResult(chunkOffsets.back());
+        auto checkChunk = [&](uint64_t chunkIndex) {
+            auto chunkResult = modelCheckers[chunkIndex]->checkBatch(env, chunks[chunkIndex]);
+            std::move(chunkResult.begin(), chunkResult.end(), formulaResult.begin() + chunkOffsets[chunkIndex]);
+        };
+#ifdef STORM_HAVE_INTELTBB
+        if (chunks.size() > 1) {
+            tbb::parallel_for(tbb::blocked_range<uint64_t>(0, chunks.size(), 1), [&](tbb::blocked_range<uint64_t> const& range) {
+                for (uint64_t chunkIndex = range.begin(); chunkIndex < range.end(); ++chunkIndex) {
+                    checkChunk(chunkIndex);
+                }
+            });
+        } else {
+            checkChunk(0);
+        }
+#else
+        checkChunk(0);
+#endif
+        for (auto& checkResult : formulaResult) {
+            if (checkResult) {
+                checkResult->filter(initialStatesFilter);
+            }
+        }
+        result.push_back(std::move(formulaResult));
+    }
+    return result;
+}
+
+}  // namespace detail
+
+template<typename ConstantType>
+ConstantSweep<ConstantType>::ConstantSweep(storm::storage::SymbolicModelDescription const& model, std::vector<storm::jani::Property> const& properties,
+                                           std::map<storm::expressions::Variable, std::vector<storm::RationalNumber>> const& values)
+    : model(model), properties(properties), values(values) {
+    std::set<storm::expressions::Variable> undefinedConstants;
+    for (auto const& constant : model.getUndefinedConstants()) {
+        STORM_LOG_THROW(values.count(constant) > 0, storm::exceptions::InvalidArgumentException,
+                        "The undefined constant '" << constant.getName() << "' is not swept.");
+        undefinedConstants.insert(constant);
+    }
+
+    std::set<storm::expressions::Variable> constantsInProperties;
+    for (auto const& property : properties) {
+        auto usedConstants = property.getUsedVariablesAndConstants();
+        constantsInProperties.insert(usedConstants.begin(), usedConstants.end());
+    }
+    for (auto const& [constant, constantValues] : values) {
+        STORM_LOG_THROW(undefinedConstants.count(constant) > 0, storm::exceptions::InvalidArgumentException,
+                        "Cannot sweep constant '" << constant.getName() << "' as it is not an undefined constant of the model.");
+        STORM_LOG_THROW(!constantValues.empty(), storm::exceptions::InvalidArgumentException, "No values given for constant '" << constant.getName() << "'.");
+        STORM_LOG_THROW(constant.hasIntegerType() || constant.hasRationalType(), storm::exceptions::NotSupportedException,
+                        "Cannot sweep constant '" << constant.getName() << "' as only integer and real constants are supported.");
+        if (constant.hasIntegerType()) {
+            for (auto const& value : constantValues) {
+                STORM_LOG_THROW(storm::utility::isInteger(value), storm::exceptions::InvalidArgumentException,
+                                "Value " << value << " of integer constant '" << constant.getName() << "' is not an integer.");
+            }
+        }
+        if (constantsInProperties.count(constant) == 0 && model.constantsAreGraphPreserving({constant})) {
+            instantiatedConstants.push_back(constant);
+        } else {
+            structuralConstants.push_back(constant);
+        }
+    }
+}
+
+template<typename ConstantType>
+void ConstantSweep<ConstantType>::setParallel(bool value) {
+    parallel = value;
+}
+
+template<typename ConstantType>
+void ConstantSweep<ConstantType>::setInstantiationsAreGraphPreserving(bool value) {
+    graphPreserving = value;
+}
+
+template<typename ConstantType>
+std::vector<storm::expressions::Variable> const& ConstantSweep<ConstantType>::getStructuralConstants() const {
+    return structuralConstants;
+}
+
+template<typename ConstantType>
+std::vector<storm::expressions::Variable> const& ConstantSweep<ConstantType>::getInstantiatedConstants() const {
+    return instantiatedConstants;
+}
+
+template<typename ConstantType>
+uint64_t ConstantSweep<ConstantType>::getNumberOfPoints() const {
+    uint64_t result = 1;
+    for (auto const& constantValues : values) {
+        result *= constantValues.second.size();
+    }
+    return result;
+}
+
+template<typename ConstantType>
+void ConstantSweep<ConstantType>::check(Environment const& env, ResultCallback const& callback) const {
+    auto const instantiatedPoints = detail::getSweepPoints(instantiatedConstants, values);
+
+    // Exact numbers share reference-counted representations, so we only parallelize non-exact sweeps.
+    uint64_t numberOfChunks = 1;
+#ifdef STORM_HAVE_INTELTBB
+    if (parallel && !std::is_same<ConstantType, storm::RationalNumber>::value) {
+        numberOfChunks = std::max<uint64_t>(1, std::min<uint64_t>(tbb::this_task_arena::max_concurrency(), instantiatedPoints.size()));
+    }
+#endif
+
+    for (auto const& structuralPoint : detail::getSweepPoints(structuralConstants, values)) {
+        auto const constantDefinitions = detail::getConstantDefinitions(structuralPoint);
+        auto const preparedModel = model.preprocess(constantDefinitions);
+        auto const preparedProperties = storm::api::substituteConstantsInProperties(properties, constantDefinitions);
+        auto const formulas = storm::api::extractFormulasFromProperties(preparedProperties);
+        auto const parametricModel = storm::api::buildSparseModel<storm::RationalFunction>(preparedModel, formulas);
+
+        // The parameters of the model are identified by the names of the corresponding constants.
+        std::map<std::string, storm::RationalFunctionVariable> parameters;
+        for (auto const& parameter : storm::models::sparse::getAllParameters(*parametricModel)) {
+            std::stringstream parameterStream;
+            parameterStream << parameter;
+            parameters.emplace(parameterStream.str(), parameter);
+        }
+        std::vector<std::vector<storm::utility::parametric::Valuation<storm::RationalFunction>>> chunks(numberOfChunks);
+        for (uint64_t pointIndex = 0; pointIndex < instantiatedPoints.size(); ++pointIndex) {
+            auto& valuation = chunks[pointIndex * numberOfChunks / instantiatedPoints.size()].emplace_back();
+            for (auto const& [constant, value] : instantiatedPoints[pointIndex]) {
+                auto parameterIt = parameters.find(constant.getName());
+                if (parameterIt != parameters.end()) {
+                    valuation.emplace(parameterIt->second, storm::utility::convertNumber<storm::RationalFunctionCoefficient>(value));
+                }
+            }
+        }
+
+        typedef storm::models::sparse::Dtmc<storm::RationalFunction> ParametricDtmc;
+        typedef storm::models::sparse::Ctmc<storm::RationalFunction> ParametricCtmc;
+        typedef storm::models::sparse::Mdp<storm::RationalFunction> ParametricMdp;
+        std::vector<std::vector<std::unique_ptr<storm::modelchecker::CheckResult>>> results;
+        if (parametricModel->isOfType(storm::models::ModelType::Dtmc)) {
+            results = detail::checkInstantiations<storm::modelchecker::SparseDtmcInstantiationModelChecker, ParametricDtmc, ConstantType>(
+                env, *parametricModel->template as<ParametricDtmc>(), formulas, chunks, graphPreserving);
+        } else if (parametricModel->isOfType(storm::models::ModelType::Ctmc)) {
+            results = detail::checkInstantiations<storm::modelchecker::SparseCtmcInstantiationModelChecker, ParametricCtmc, ConstantType>(
+                env, *parametricModel->template as<ParametricCtmc>(), formulas, chunks, graphPreserving);
+        } else if (parametricModel->isOfType(storm::models::ModelType::Mdp)) {
+            results = detail::checkInstantiations<storm::modelchecker::SparseMdpInstantiationModelChecker, ParametricMdp, ConstantType>(
+                env, *parametricModel->template as<ParametricMdp>(), formulas, chunks, graphPreserving);
+        } else {
+            STORM_LOG_THROW(false, storm::exceptions::NotSupportedException, "Sweeping constants is only supported for DTMCs, CTMCs and MDPs.");
+        }
+
+        for (uint64_t pointIndex = 0; pointIndex < instantiatedPoints.size(); ++pointIndex) {
+            Point point = structuralPoint;
+            point.insert(instantiatedPoints[pointIndex].begin(), instantiatedPoints[pointIndex].end());
+            for (uint64_t propertyIndex = 0; propertyIndex < properties.size(); ++propertyIndex) {
+                callback(point, properties[propertyIndex], std::move(results[propertyIndex][pointIndex]));
+            }
+        }
+    }
+}
+
+template class ConstantSweep<double>;
+template class ConstantSweep<storm::RationalNumber>;
+
+}  // namespace utility
+}  // namespace storm
@@ -0,0 +1,82 @@
+#pragma once
+
+#include <functional>
+#include <map>
+#include <memory>
+#include <vector>
+
+#include "storm/adapters/RationalNumberAdapter.h"
+#include "storm/modelchecker/results/CheckResult.h"
+#include "storm/storage/SymbolicModelDescription.h"
+#include "storm/storage/expressions/Variable.h"
+#include "storm/storage/jani/Property.h"
+
+namespace storm {
+
+class Environment;
+
+namespace utility {
+
+/*!
+ * Checks properties of a model for all combinations of values of some of its undefined constants, i.e., at all points of the cartesian product of the
+ * given value lists.
+ * Constants that are graph-preserving (they only occur in probabilities and rewards) become parameters of a parametric model. This model is only built
+ * once for each valuation of the remaining (structural) constants. All points that share these structural values are obtained by instantiating the
+ * parametric model, which can be done in parallel.
+ */
+template<typename ConstantType>
+class ConstantSweep {
+   public:
+    typedef std::map<storm::expressions::Variable, storm::RationalNumber> Point;
+    typedef std::function<void(Point const&, storm::jani::Property const&, std::unique_ptr<storm::modelchecker::CheckResult>&&)> ResultCallback;
+
+    /*!
+     * @param model The model description. Each of its undefined constants needs to be swept.
+     * @param properties The properties to check. Swept constants that occur in a property are considered structural.
+     * @param values For each swept constant, the values it takes.
+     */
+    ConstantSweep(storm::storage::SymbolicModelDescription const& model, std::vector<storm::jani::Property> const& properties,
+                  std::map<storm::expressions::Variable, std::vector<storm::RationalNumber>> const& values);
+
+    /*!
+     * Sets whether the instantiations for the same structural values shall be checked in parallel (if Storm is built with Intel TBB).
+     * This is only done for non-exact sweeps. Each thread keeps its own instantiation of the parametric model.
+     */
+    void setParallel(bool value);
+
+    /*!
+     * Sets whether it can be assumed that no instantiation changes the graph of the parametric model, which skips the graph analyses.
+     */
+    void setInstantiationsAreGraphPreserving(bool value);
+
+    /*!
+     * Retrieves the swept constants that require rebuilding the model.
+     */
+    std::vector<storm::expressions::Variable> const& getStructuralConstants() const;
+
+    /*!
+     * Retrieves the swept constants that are handled by instantiating the parametric model.
+     */
+    std::vector<storm::expressions::Variable> const& getInstantiatedConstants() const;
+
+    uint64_t getNumberOfPoints() const;
+
+    /*!
+     * Checks all properties at all points.
+     * @param callback Invoked for each point and each property with the result restricted to the initial states. Points are enumerated such that the
+     * structural constants change the slowest.
+     */
+    void check(Environment const& env, ResultCallback const& callback) const;
+
+   private:
+    storm::storage::SymbolicModelDescription model;
+    std::vector<storm::jani::Property> properties;
+    std::map<storm::expressions::Variable, std::vector<storm::RationalNumber>> values;
+    std::vector<storm::expressions::Variable> structuralConstants;
+    std::vector<storm::expressions::Variable> instantiatedConstants;
+    bool parallel{false};
+    bool graphPreserving{false};
+};
+
+}  // namespace utility
+}  // namespace storm
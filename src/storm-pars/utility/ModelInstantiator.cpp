@@ -1,4 +1,7 @@
 #include "storm-pars/utility/ModelInstantiator.h"
+
+#include <set>
+
 #include "storm/models/sparse/StandardRewardModel.h"
 
 #include "storm/adapters/RationalFunctionAdapter.h"
@@ -26,6 +29,24 @@ ModelInstantiator<ParametricSparseModelType, ConstantSparseModelType>::ModelInst
                                     parametricModel.getRewardModel(rewModel.first).getTransitionRewardMatrix());
         }
     }
+    compileFunctions();
+}
+
+template<typename ParametricSparseModelType, typename ConstantSparseModelType>
+void ModelInstantiator<ParametricSparseModelType, ConstantSparseModelType>::compileFunctions() {
+    // Parametric instantiations substitute the functions instead of evaluating them.
+    if constexpr (!std::is_same<ParametricSparseModelType, ConstantSparseModelType>::value) {
+        std::set<VariableType> variables;
+        for (auto const& functionResult : this->functions) {
+            storm::utility::parametric::gatherOccurringVariables(functionResult.first, variables);
+        }
+        this->compiledFunctions =
+            std::make_unique<storm::utility::CompiledRationalFunctions<ConstantType>>(std::vector<VariableType>(variables.begin(), variables.end()));
+        for (auto& functionResult : this->functions) {
+            this->compiledFunctions->addFunction(functionResult.first);
+            this->compiledFunctionPlaceholders.push_back(&functionResult.second);
+        }
+    }
 }
 
 template<typename ParametricSparseModelType, typename ConstantType>
@@ -5,13 +5,16 @@
 #include <type_traits>
 #include <unordered_map>
 
+#include "storm-pars/utility/CompiledRationalFunctions.h"
 #include "storm-pars/utility/parametric.h"
 #include "storm/models/sparse/Ctmc.h"
 #include "storm/models/sparse/Dtmc.h"
 #include "storm/models/sparse/MarkovAutomaton.h"
 #include "storm/models/sparse/Mdp.h"
 #include "storm/models/sparse/StochasticTwoPlayerGame.h"
+#include "storm/exceptions/InvalidArgumentException.h"
 #include "storm/utility/constants.h"
+#include "storm/utility/macros.h"
 
 namespace storm {
 namespace utility {
@@ -124,11 +127,24 @@ class ModelInstantiator {
     template<typename PMT = ParametricSparseModelType>
     typename std::enable_if<!std::is_same<PMT, ConstantSparseModelType>::value>::type instantiate_helper(
         storm::utility::parametric::Valuation<ParametricType> const& valuation) {
-        for (auto& functionResult : this->functions) {
-            functionResult.second = storm::utility::convertNumber<ConstantType>(storm::utility::parametric::evaluate(functionResult.first, valuation));
+        auto const& variables = this->compiledFunctions->getVariables();
+        this->compiledValuation.resize(variables.size());
+        for (uint64_t varIndex = 0; varIndex < variables.size(); ++varIndex) {
+            auto valuationIt = valuation.find(variables[varIndex]);
+            STORM_LOG_THROW(valuationIt != valuation.end(), storm::exceptions::InvalidArgumentException,
+                            "No value given for the parameter " << variables[varIndex] << ".");
+            this->compiledValuation[varIndex] = storm::utility::convertNumber<ConstantType>(valuationIt->second);
+        }
+        for (uint64_t function = 0; function < this->compiledFunctionPlaceholders.size(); ++function) {
+            *this->compiledFunctionPlaceholders[function] = this->compiledFunctions->evaluate(function, this->compiledValuation);
         }
     }
 
+    /*!
+     * Compiles the occurring functions such that they can be evaluated efficiently.
+     */
+    void compileFunctions();
+
     /*!
      * Creates a matrix that has entries at the same position as the given matrix.
      * The returned matrix is a stochastic matrix, i.e., the rows sum up to one.
@@ -178,6 +194,12 @@ class ModelInstantiator {
     std::vector<std::pair<typename storm::storage::SparseMatrix<ConstantType>::iterator, ConstantType*>> matrixMapping;
     /// Connection of Vector entries with placeholders
     std::vector<std::pair<typename std::vector<ConstantType>::iterator, ConstantType*>> vectorMapping;
+    /// The occurring functions in compiled form (only if the instantiated model is not parametric)
+    std::unique_ptr<storm::utility::CompiledRationalFunctions<ConstantType>> compiledFunctions;
+    /// The placeholder for the result of each compiled function
+    std::vector<ConstantType*> compiledFunctionPlaceholders;
+    /// The valuation for the compiled functions
+    std::vector<ConstantType> compiledValuation;
 };
 }  // Namespace utility
 }  // namespace storm
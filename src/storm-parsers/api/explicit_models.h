@@ -6,6 +6,7 @@
 #include <type_traits>
 
 #include "storm-parsers/parser/AutoParser.h"
+#include "storm-parsers/parser/BinaryEncodingParser.h"
 #include "storm-parsers/parser/DirectEncodingParser.h"
 #include "storm-parsers/parser/ImcaMarkovAutomatonParser.h"
 #include "storm/exceptions/NotSupportedException.h"
@@ -29,6 +30,12 @@ inline std::shared_ptr<storm::models::sparse::Model<ValueType>> buildExplicitMod
 template<typename ValueType>
 std::shared_ptr<storm::models::sparse::Model<ValueType>> buildExplicitDRNModel(
     std::string const& drnFile, storm::parser::DirectEncodingParserOptions const& options = storm::parser::DirectEncodingParserOptions()) {
+    if (storm::parser::BinaryEncodingParser::isBinaryEncoding(drnFile)) {
+        if constexpr (std::is_same_v<ValueType, double>) {
+            return storm::parser::BinaryEncodingParser::parseModel(drnFile);
+        }
+        STORM_LOG_THROW(false, storm::exceptions::NotSupportedException, "Models in binary encoding can only be loaded with double values.");
+    }
     return storm::parser::DirectEncodingParser<ValueType>::parseModel(drnFile, options);
 }
 
@@ -15,11 +15,22 @@ namespace storm {
 namespace api {
 
 storm::prism::Program parseProgram(std::string const& filename, bool prismCompatibility, bool simplify) {
+    PrismParsingTimes times;
+    return parseProgram(filename, prismCompatibility, simplify, times);
+}
+
+storm::prism::Program parseProgram(std::string const& filename, bool prismCompatibility, bool simplify, PrismParsingTimes& times) {
+    times.parsing.start();
     storm::prism::Program program = storm::parser::PrismParser::parse(filename, prismCompatibility);
+    times.parsing.stop();
     if (simplify) {
+        times.simplification.start();
         program = program.simplify().simplify();
+        times.simplification.stop();
     }
+    times.semanticChecks.start();
     program.checkValidity();
+    times.semanticChecks.stop();
     return program;
 }
 
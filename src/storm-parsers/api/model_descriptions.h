@@ -5,6 +5,8 @@
 #include <string>
 #include <vector>
 
+#include "storm/utility/Stopwatch.h"
+
 namespace storm {
 namespace prism {
 class Program;
@@ -17,7 +19,20 @@ class Property;
 
 namespace api {
 
+/*!
+ * The time spent in the individual phases of parsing a PRISM program.
+ */
+struct PrismParsingTimes {
+    // Reading the file and parsing its syntax.
+    storm::utility::Stopwatch parsing;
+    // Simplifying the program.
+    storm::utility::Stopwatch simplification;
+    // Checking the validity of the program.
+    storm::utility::Stopwatch semanticChecks;
+};
+
 storm::prism::Program parseProgram(std::string const& filename, bool prismCompatibility = false, bool simplify = true);
+storm::prism::Program parseProgram(std::string const& filename, bool prismCompatibility, bool simplify, PrismParsingTimes& times);
 
 std::pair<storm::jani::Model, std::vector<storm::jani::Property>> parseJaniModel(std::string const& filename,
                                                                                  boost::optional<std::vector<std::string>> const& propertyFilter = boost::none);
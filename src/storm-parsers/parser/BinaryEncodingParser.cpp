@@ -0,0 +1,387 @@
+#include "storm-parsers/parser/BinaryEncodingParser.h"
+
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+
+#include "storm-parsers/parser/MappedFile.h"
+#include "storm/exceptions/IllegalArgumentException.h"
+#include "storm/exceptions/NotSupportedException.h"
+#include "storm/exceptions/WrongFormatException.h"
+#include "storm/io/BinaryEncodingFormat.h"
+#include "storm/models/sparse/StandardRewardModel.h"
+#include "storm/storage/expressions/ExpressionManager.h"
+#include "storm/storage/sparse/ModelComponents.h"
+#include "storm/storage/sparse/StateValuations.h"
+#include "storm/utility/builder.h"
+#include "storm/utility/macros.h"
+
+namespace storm {
+namespace parser {
+
+namespace {
+// Sequential reader over the mapped file
+class BinaryReader {
+   public:
+    BinaryReader(char const* data, char const* dataEnd) : current(data), end(dataEnd) {
+        // Intentionally left empty.
+    }
+
+    // Skip the given number of bytes and the padding to the next multiple of 8 bytes. Returns the position of the skipped bytes.
+    char const* skipBytes(uint64_t size) {
+        uint64_t paddedSize = (size + 7) / 8 * 8;
+        STORM_LOG_THROW(static_cast<uint64_t>(end - current) >= paddedSize, storm::exceptions::WrongFormatException, "Unexpected end of binary file.");
+        char const* position = current;
+        current += paddedSize;
+        return position;
+    }
+
+    // Copy the given number of bytes
+    void readBytes(void* target, uint64_t size) {
+        char const* position = skipBytes(size);
+        if (size > 0) {
+            std::memcpy(target, position, size);
+        }
+    }
+
+    uint64_t readWord() {
+        uint64_t word;
+        readBytes(&word, sizeof(word));
+        return word;
+    }
+
+    template<typename T>
+    std::vector<T> readVector(uint64_t size) {
+        std::vector<T> result(size);
+        readBytes(result.data(), size * sizeof(T));
+        return result;
+    }
+
+    std::string readString() {
+        std::string result(readWord(), '\0');
+        readBytes(result.data(), result.size());
+        return result;
+    }
+
+    storm::storage::BitVector readBitVector(uint64_t size) {
+        storm::storage::BitVector result(size);
+        for (uint64_t index = 0; index < size; index += 64) {
+            result.setFromInt(index, std::min<uint64_t>(64, size - index), readWord());
+        }
+        return result;
+    }
+
+    bool isAtEnd() const {
+        return current == end;
+    }
+
+   private:
+    char const* current;
+    char const* end;
+};
+
+namespace binary = storm::exporter::binaryencoding;
+
+binary::Header readHeader(BinaryReader& reader) {
+    binary::Header header;
+    reader.readBytes(&header, sizeof(header));
+    STORM_LOG_THROW(std::equal(header.magic, header.magic + 8, binary::magic), storm::exceptions::WrongFormatException,
+                    "Data is not in the binary encoding.");
+    STORM_LOG_THROW(header.byteOrderMark == binary::byteOrderMark, storm::exceptions::NotSupportedException,
+                    "Data was written with a different byte order.");
+    STORM_LOG_THROW(header.version >= 1 && header.version <= binary::version, storm::exceptions::NotSupportedException,
+                    "Version " << header.version << " of the binary encoding is not supported.");
+    return header;
+}
+
+// Reads the word with the given index from an array of words (without alignment requirements)
+uint64_t readWordAt(char const* data, uint64_t index) {
+    uint64_t result;
+    std::memcpy(&result, data + index * sizeof(uint64_t), sizeof(uint64_t));
+    return result;
+}
+
+// Reads the range [first, last) of a bit vector of the given size
+storm::storage::BitVector readBitVectorRange(BinaryReader& reader, uint64_t size, uint64_t first, uint64_t last) {
+    char const* data = reader.skipBytes((size + 63) / 64 * sizeof(uint64_t));
+    storm::storage::BitVector result(last - first);
+    for (uint64_t index = first; index < last;) {
+        uint64_t const wordEnd = std::min(last, index / 64 * 64 + 64);
+        uint64_t const numberOfBits = wordEnd - index;
+        // The first bit of a word is its most significant bit (see BitVector::setFromInt)
+        uint64_t const bits = (readWordAt(data, index / 64) << (index % 64)) >> (64 - numberOfBits);
+        result.setFromInt(index - first, numberOfBits, bits);
+        index = wordEnd;
+    }
+    return result;
+}
+
+// Reads the range [first, last) of a vector of doubles of the given size
+std::vector<double> readVectorRange(BinaryReader& reader, uint64_t size, uint64_t first, uint64_t last) {
+    char const* data = reader.skipBytes(size * sizeof(double));
+    std::vector<double> result(last - first);
+    if (!result.empty()) {
+        std::memcpy(result.data(), data + first * sizeof(double), result.size() * sizeof(double));
+    }
+    return result;
+}
+}  // namespace
+
+bool BinaryEncodingParser::isBinaryEncoding(std::string const& filename) {
+    std::ifstream file(filename, std::ios::binary);
+    char magic[8];
+    if (!file.read(magic, sizeof(magic))) {
+        return false;
+    }
+    return std::equal(magic, magic + 8, storm::exporter::binaryencoding::magic);
+}
+
+std::shared_ptr<storm::models::sparse::Model<double>> BinaryEncodingParser::parseModel(
+    std::string const& filename, std::shared_ptr<storm::expressions::ExpressionManager> const& manager) {
+    STORM_LOG_INFO("Reading from file " << filename);
+    MappedFile mappedFile(filename.c_str());
+    return parseModel(mappedFile.getData(), mappedFile.getDataEnd(), manager);
+}
+
+std::shared_ptr<storm::models::sparse::Model<double>> BinaryEncodingParser::parseModel(
+    char const* data, char const* dataEnd, std::shared_ptr<storm::expressions::ExpressionManager> const& manager) {
+    BinaryReader reader(data, dataEnd);
+
+    // Parse header
+    binary::Header header = readHeader(reader);
+    storm::models::ModelType type = storm::models::getModelType(reader.readString());
+    uint64_t nrStates = header.numberOfStates;
+    uint64_t nrChoices = header.numberOfChoices;
+    bool hasRowGroups = header.flags & binary::HasRowGroups;
+    STORM_LOG_THROW(hasRowGroups || nrStates == nrChoices, storm::exceptions::WrongFormatException, "Number of choices does not match number of states.");
+
+    // Parse transition matrix
+    // The index vectors are copied as a whole, the entries are assembled from the column and value arrays in a single pass
+    using index_type = storm::storage::SparseMatrix<double>::index_type;
+    static_assert(sizeof(index_type) == sizeof(uint64_t), "Matrix indices are expected to have 64 bits.");
+    std::vector<index_type> rowIndications = reader.readVector<index_type>(nrChoices + 1);
+    STORM_LOG_THROW(rowIndications.back() == header.numberOfEntries, storm::exceptions::WrongFormatException, "Row indications do not match number of entries.");
+    boost::optional<std::vector<index_type>> rowGroupIndices;
+    if (hasRowGroups) {
+        rowGroupIndices = reader.readVector<index_type>(nrStates + 1);
+        STORM_LOG_THROW(rowGroupIndices->back() == nrChoices, storm::exceptions::WrongFormatException, "Row groups do not match number of choices.");
+    }
+    char const* columns = reader.skipBytes(header.numberOfEntries * sizeof(uint64_t));
+    char const* values = reader.skipBytes(header.numberOfEntries * sizeof(double));
+    std::vector<storm::storage::MatrixEntry<index_type, double>> entries;
+    entries.reserve(header.numberOfEntries);
+    for (uint64_t i = 0; i < header.numberOfEntries; ++i) {
+        uint64_t column;
+        double value;
+        std::memcpy(&column, columns + i * sizeof(uint64_t), sizeof(uint64_t));
+        std::memcpy(&value, values + i * sizeof(double), sizeof(double));
+        STORM_LOG_THROW(column < nrStates, storm::exceptions::WrongFormatException, "Target state " << column << " is out of range.");
+        entries.emplace_back(column, value);
+    }
+    storm::storage::sparse::ModelComponents<double> components(
+        storm::storage::SparseMatrix<double>(nrStates, std::move(rowIndications), std::move(entries), std::move(rowGroupIndices)));
+
+    // Parse model specific components
+    if (header.flags & binary::HasExitRates) {
+        components.exitRates = reader.readVector<double>(nrStates);
+    }
+    if (header.flags & binary::HasMarkovianStates) {
+        components.markovianStates = reader.readBitVector(nrStates);
+    }
+    if (header.flags & binary::HasObservations) {
+        components.observabilityClasses = reader.readVector<uint32_t>(nrStates);
+    }
+    // As for the DRN format, the matrix of a CTMC contains rates
+    components.rateTransitions = (type == storm::models::ModelType::Ctmc);
+
+    // Parse labels
+    components.stateLabeling = storm::models::sparse::StateLabeling(nrStates);
+    for (uint64_t i = 0; i < header.numberOfStateLabels; ++i) {
+        std::string label = reader.readString();
+        components.stateLabeling.addLabel(label, reader.readBitVector(nrStates));
+    }
+    if (header.numberOfChoiceLabels > 0) {
+        components.choiceLabeling = storm::models::sparse::ChoiceLabeling(nrChoices);
+        for (uint64_t i = 0; i < header.numberOfChoiceLabels; ++i) {
+            std::string label = reader.readString();
+            components.choiceLabeling->addLabel(label, reader.readBitVector(nrChoices));
+        }
+    }
+
+    // Parse reward models
+    for (uint64_t i = 0; i < header.numberOfRewardModels; ++i) {
+        std::string name = reader.readString();
+        uint64_t flags = reader.readWord();
+        std::optional<std::vector<double>> stateRewards, stateActionRewards;
+        if (flags & binary::HasStateRewards) {
+            stateRewards = reader.readVector<double>(nrStates);
+        }
+        if (flags & binary::HasStateActionRewards) {
+            stateActionRewards = reader.readVector<double>(nrChoices);
+        }
+        components.rewardModels.emplace(name, storm::models::sparse::StandardRewardModel<double>(std::move(stateRewards), std::move(stateActionRewards)));
+    }
+
+    // Parse state valuations
+    if (header.flags & binary::HasStateValuations) {
+        std::vector<std::pair<std::string, uint64_t>> variables;
+        uint64_t numberOfVariables = reader.readWord();
+        for (uint64_t i = 0; i < numberOfVariables; ++i) {
+            std::string name = reader.readString();
+            variables.emplace_back(std::move(name), reader.readWord());
+        }
+        uint64_t valuationsSize = reader.readWord();
+        char const* valuations = reader.skipBytes(valuationsSize);
+        if (manager) {
+            // Variables are identified by their names, missing ones are declared
+            for (auto const& [name, variableType] : variables) {
+                if (!manager->hasVariable(name)) {
+                    if (variableType == binary::Boolean) {
+                        manager->declareBooleanVariable(name);
+                    } else if (variableType == binary::Integer) {
+                        manager->declareIntegerVariable(name);
+                    } else {
+                        STORM_LOG_THROW(variableType == binary::Rational, storm::exceptions::WrongFormatException,
+                                        "Unknown type of variable " << name << ".");
+                        manager->declareRationalVariable(name);
+                    }
+                }
+                storm::expressions::Variable variable = manager->getVariable(name);
+                bool typeMatches = (variableType == binary::Boolean && variable.hasBooleanType()) ||
+                                   (variableType == binary::Integer && variable.hasIntegerType()) ||
+                                   (variableType == binary::Rational && variable.hasRationalType());
+                STORM_LOG_THROW(typeMatches, storm::exceptions::WrongFormatException,
+                                "Variable " << name << " has a different type in the expression manager.");
+            }
+            components.stateValuations = storm::storage::sparse::StateValuations::readBinary(valuations, valuations + valuationsSize, *manager);
+        } else {
+            STORM_LOG_INFO("Skipping the state valuations as no expression manager was given.");
+        }
+    }
+    STORM_LOG_THROW(reader.isAtEnd(), storm::exceptions::WrongFormatException, "Unexpected data at the end of the binary encoding.");
+
+    return storm::utility::builder::buildModelFromComponents(type, std::move(components));
+}
+
+std::vector<uint64_t> BinaryEncodingParser::computeStatePartition(std::string const& filename, uint64_t numberOfParts) {
+    STORM_LOG_THROW(numberOfParts > 0, storm::exceptions::IllegalArgumentException, "The number of parts must be positive.");
+    MappedFile mappedFile(filename.c_str());
+    BinaryReader reader(mappedFile.getData(), mappedFile.getDataEnd());
+    binary::Header header = readHeader(reader);
+    reader.readString();
+    char const* rowIndications = reader.skipBytes((header.numberOfChoices + 1) * sizeof(uint64_t));
+    char const* rowGroupIndices = (header.flags & binary::HasRowGroups) ? reader.skipBytes((header.numberOfStates + 1) * sizeof(uint64_t)) : nullptr;
+    auto entriesBefore = [&](uint64_t state) { return readWordAt(rowIndications, rowGroupIndices ? readWordAt(rowGroupIndices, state) : state); };
+
+    // Find the bounds by binary search over the number of entries before each state
+    std::vector<uint64_t> result(numberOfParts + 1, header.numberOfStates);
+    result.front() = 0;
+    for (uint64_t part = 1; part < numberOfParts; ++part) {
+        uint64_t const targetEntries = header.numberOfEntries / numberOfParts * part + header.numberOfEntries % numberOfParts * part / numberOfParts;
+        uint64_t low = result[part - 1];
+        uint64_t high = header.numberOfStates;
+        while (low < high) {
+            uint64_t const middle = low + (high - low) / 2;
+            if (entriesBefore(middle) < targetEntries) {
+                low = middle + 1;
+            } else {
+                high = middle;
+            }
+        }
+        result[part] = low;
+    }
+    return result;
+}
+
+BinaryEncodingParser::ModelPart BinaryEncodingParser::parseModelPart(std::string const& filename, uint64_t firstState, uint64_t lastState) {
+    STORM_LOG_INFO("Reading states " << firstState << " to " << lastState << " from file " << filename);
+    MappedFile mappedFile(filename.c_str());
+    BinaryReader reader(mappedFile.getData(), mappedFile.getDataEnd());
+    binary::Header header = readHeader(reader);
+    ModelPart part;
+    part.modelType = storm::models::getModelType(reader.readString());
+    part.numberOfStates = header.numberOfStates;
+    part.firstState = firstState;
+    part.lastState = lastState;
+    STORM_LOG_THROW(firstState <= lastState && lastState <= header.numberOfStates, storm::exceptions::IllegalArgumentException,
+                    "Invalid range of states [" << firstState << ", " << lastState << ").");
+    uint64_t const nrStates = header.numberOfStates;
+    uint64_t const nrChoices = header.numberOfChoices;
+    bool const hasRowGroups = header.flags & binary::HasRowGroups;
+
+    // Parse the rows of the transition matrix that belong to the states of the part
+    using index_type = storm::storage::SparseMatrix<double>::index_type;
+    char const* rowIndicationsData = reader.skipBytes((nrChoices + 1) * sizeof(uint64_t));
+    char const* rowGroupIndicesData = hasRowGroups ? reader.skipBytes((nrStates + 1) * sizeof(uint64_t)) : nullptr;
+    part.firstChoice = hasRowGroups ? readWordAt(rowGroupIndicesData, firstState) : firstState;
+    uint64_t const lastChoice = hasRowGroups ? readWordAt(rowGroupIndicesData, lastState) : lastState;
+    STORM_LOG_THROW(part.firstChoice <= lastChoice && lastChoice <= nrChoices, storm::exceptions::WrongFormatException, "Invalid row group indices.");
+    uint64_t const firstEntry = readWordAt(rowIndicationsData, part.firstChoice);
+    uint64_t const lastEntry = readWordAt(rowIndicationsData, lastChoice);
+    STORM_LOG_THROW(firstEntry <= lastEntry && lastEntry <= header.numberOfEntries, storm::exceptions::WrongFormatException, "Invalid row indications.");
+    std::vector<index_type> rowIndications;
+    rowIndications.reserve(lastChoice - part.firstChoice + 1);
+    for (uint64_t choice = part.firstChoice; choice <= lastChoice; ++choice) {
+        rowIndications.push_back(readWordAt(rowIndicationsData, choice) - firstEntry);
+    }
+    boost::optional<std::vector<index_type>> rowGroupIndices;
+    if (hasRowGroups) {
+        rowGroupIndices = std::vector<index_type>();
+        rowGroupIndices->reserve(lastState - firstState + 1);
+        for (uint64_t state = firstState; state <= lastState; ++state) {
+            rowGroupIndices->push_back(readWordAt(rowGroupIndicesData, state) - part.firstChoice);
+        }
+    }
+    char const* columns = reader.skipBytes(header.numberOfEntries * sizeof(uint64_t));
+    char const* values = reader.skipBytes(header.numberOfEntries * sizeof(double));
+    std::vector<storm::storage::MatrixEntry<index_type, double>> entries;
+    entries.reserve(lastEntry - firstEntry);
+    for (uint64_t i = firstEntry; i < lastEntry; ++i) {
+        uint64_t const column = readWordAt(columns, i);
+        double value;
+        std::memcpy(&value, values + i * sizeof(double), sizeof(double));
+        STORM_LOG_THROW(column < nrStates, storm::exceptions::WrongFormatException, "Target state " << column << " is out of range.");
+        entries.emplace_back(column, value);
+    }
+    part.transitionMatrix = storm::storage::SparseMatrix<double>(nrStates, std::move(rowIndications), std::move(entries), std::move(rowGroupIndices));
+
+    // Parse model specific components
+    if (header.flags & binary::HasExitRates) {
+        part.exitRates = readVectorRange(reader, nrStates, firstState, lastState);
+    }
+    if (header.flags & binary::HasMarkovianStates) {
+        reader.skipBytes((nrStates + 63) / 64 * sizeof(uint64_t));
+    }
+    if (header.flags & binary::HasObservations) {
+        reader.skipBytes(nrStates * sizeof(uint32_t));
+    }
+
+    // Parse labels
+    part.stateLabeling = storm::models::sparse::StateLabeling(lastState - firstState);
+    for (uint64_t i = 0; i < header.numberOfStateLabels; ++i) {
+        std::string label = reader.readString();
+        part.stateLabeling.addLabel(label, readBitVectorRange(reader, nrStates, firstState, lastState));
+    }
+    for (uint64_t i = 0; i < header.numberOfChoiceLabels; ++i) {
+        reader.readString();
+        reader.skipBytes((nrChoices + 63) / 64 * sizeof(uint64_t));
+    }
+
+    // Parse reward models
+    for (uint64_t i = 0; i < header.numberOfRewardModels; ++i) {
+        std::string name = reader.readString();
+        uint64_t flags = reader.readWord();
+        std::optional<std::vector<double>> stateRewards, stateActionRewards;
+        if (flags & binary::HasStateRewards) {
+            stateRewards = readVectorRange(reader, nrStates, firstState, lastState);
+        }
+        if (flags & binary::HasStateActionRewards) {
+            stateActionRewards = readVectorRange(reader, nrChoices, part.firstChoice, lastChoice);
+        }
+        part.rewardModels.emplace(name, storm::models::sparse::StandardRewardModel<double>(std::move(stateRewards), std::move(stateActionRewards)));
+    }
+    return part;
+}
+
+}  // namespace parser
+}  // namespace storm
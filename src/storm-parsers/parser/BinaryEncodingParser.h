@@ -0,0 +1,100 @@
+#pragma once
+
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "storm/models/sparse/Model.h"
+#include "storm/models/sparse/StandardRewardModel.h"
+
+namespace storm {
+namespace expressions {
+class ExpressionManager;
+}
+
+namespace parser {
+
+/*!
+ *	Parser for models in the binary direct encoding (drnb), see storm/io/BinaryEncodingFormat.h.
+ *	The file is mapped into memory and the arrays of the model are copied as a whole without any tokenization.
+ */
+class BinaryEncodingParser {
+   public:
+    /*!
+     * Check whether the given file contains a model in the binary encoding.
+     *
+     * @param filename File.
+     * @return True iff the file starts with the magic bytes of the binary encoding.
+     */
+    static bool isBinaryEncoding(std::string const& filename);
+
+    /*!
+     * Load a model in binary encoding from a file and create the model.
+     *
+     * @param filename The file to be loaded.
+     * @param manager If given, the state valuations are loaded and refer to the variables of this manager (identified by name). Missing variables are
+     * declared. Otherwise, state valuations are skipped.
+     *
+     * @return A sparse model
+     */
+    static std::shared_ptr<storm::models::sparse::Model<double>> parseModel(std::string const& filename,
+                                                                            std::shared_ptr<storm::expressions::ExpressionManager> const& manager = nullptr);
+
+    /*!
+     * Create a model from its binary encoding in memory, e.g., a file or shared memory segment that was mapped by the caller.
+     * The data is only read, so several processes may load models from the same segment.
+     *
+     * @param data The beginning of the binary encoding.
+     * @param dataEnd The end of the binary encoding.
+     * @param manager If given, the state valuations are loaded (see above).
+     *
+     * @return A sparse model
+     */
+    static std::shared_ptr<storm::models::sparse::Model<double>> parseModel(char const* data, char const* dataEnd,
+                                                                            std::shared_ptr<storm::expressions::ExpressionManager> const& manager = nullptr);
+
+    /*!
+     * The part of a model that belongs to a range of states, see parseModelPart.
+     */
+    struct ModelPart {
+        storm::models::ModelType modelType;
+        // The number of states of the whole model.
+        uint64_t numberOfStates;
+        // The states of this part are firstState, ..., lastState - 1.
+        uint64_t firstState;
+        uint64_t lastState;
+        // The index of the first choice of this part in the whole model.
+        uint64_t firstChoice;
+        // The rows (and row groups) of the states of this part. The columns refer to the states of the whole model.
+        storm::storage::SparseMatrix<double> transitionMatrix;
+        // The labels and the reward vectors restricted to the states (and choices) of this part.
+        storm::models::sparse::StateLabeling stateLabeling;
+        std::unordered_map<std::string, storm::models::sparse::StandardRewardModel<double>> rewardModels;
+        boost::optional<std::vector<double>> exitRates;
+    };
+
+    /*!
+     * Partitions the states of the model in the given file into consecutive ranges with roughly the same number of transitions.
+     * Only the header and the index vectors of the transition matrix are read.
+     *
+     * @param filename The file in binary encoding.
+     * @param numberOfParts The number of parts.
+     * @return The bounds of the ranges, i.e., part i consists of the states result[i], ..., result[i+1] - 1.
+     */
+    static std::vector<uint64_t> computeStatePartition(std::string const& filename, uint64_t numberOfParts);
+
+    /*!
+     * Loads the part of the model in the given file that belongs to the given range of states. Only the data of this range is read from the
+     * (mapped) file, so a model can be loaded by several processes such that no process holds the whole model.
+     * Markovian states, observations, choice labels and state valuations are not loaded.
+     *
+     * @param filename The file in binary encoding.
+     * @param firstState The first state of the part.
+     * @param lastState The state after the last state of the part.
+     */
+    static ModelPart parseModelPart(std::string const& filename, uint64_t firstState, uint64_t lastState);
+};
+
+}  // namespace parser
+}  // namespace storm
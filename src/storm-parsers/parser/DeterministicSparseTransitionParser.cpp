@@ -1,5 +1,6 @@
 #include "storm-parsers/parser/DeterministicSparseTransitionParser.h"
 
+#include <algorithm>
 #include <clocale>
 #include <cstdint>
 #include <cstdio>
@@ -8,7 +9,7 @@
 #include <string>
 
 #include "storm-parsers/parser/MappedFile.h"
-#include "storm-parsers/util/cstring.h"
+#include "storm-parsers/parser/SparseTransitionReader.h"
 #include "storm/exceptions/FileIoException.h"
 #include "storm/exceptions/InvalidArgumentException.h"
 #include "storm/exceptions/WrongFormatException.h"
@@ -21,8 +22,6 @@
 namespace storm {
 namespace parser {
 
-using namespace storm::utility::cstring;
-
 template<typename ValueType>
 storm::storage::SparseMatrix<ValueType> DeterministicSparseTransitionParser<ValueType>::parseDeterministicTransitions(std::string const& filename) {
     storm::storage::SparseMatrix<ValueType> emptyMatrix;
@@ -45,110 +44,78 @@ storm::storage::SparseMatrix<ValueType> DeterministicSparseTransitionParser<Valu
 
     // Open file.
     MappedFile file(filename.c_str());
-    char const* buf = file.getData();
-
-    // Perform first pass, i.e. count entries that are not zero.
-    DeterministicSparseTransitionParser<ValueType>::FirstPassResult firstPass =
-        DeterministicSparseTransitionParser<ValueType>::firstPass(file.getData(), !isRewardFile);
-
-    STORM_LOG_TRACE("First pass on " << filename << " shows " << firstPass.numberOfNonzeroEntries << " non-zeros.");
-
-    // If first pass returned zero, the file format was wrong.
-    if (firstPass.numberOfNonzeroEntries == 0) {
-        STORM_LOG_ERROR("Error while parsing " << filename << ": empty or erroneous file format.");
-        throw storm::exceptions::WrongFormatException();
-    }
-
-    // Perform second pass.
-
-    // Skip the format hint if it is there.
-    buf = trimWhitespaces(buf);
-    if (buf[0] < '0' || buf[0] > '9') {
-        buf = forwardToLineEnd(buf);
-        buf = trimWhitespaces(buf);
-    }
-
-    if (isRewardFile) {
-        // The reward matrix should match the size of the transition matrix.
-        if (firstPass.highestStateIndex + 1 > transitionMatrix.getRowCount() || firstPass.highestStateIndex + 1 > transitionMatrix.getColumnCount()) {
-            STORM_LOG_ERROR("Reward matrix has more rows or columns than transition matrix.");
-            throw storm::exceptions::WrongFormatException() << "Reward matrix has more rows or columns than transition matrix.";
-        } else {
-            // If we found the right number of states or less, we set it to the number of states represented by the transition matrix.
-            firstPass.highestStateIndex = transitionMatrix.getRowCount() - 1;
-        }
-    }
+    auto const& buildSettings = storm::settings::getModule<storm::settings::modules::BuildSettings>();
+    SparseTransitionReader reader(file, false, buildSettings.getNumberOfExplorationThreads());
 
     // Creating matrix builder here.
+    // The file is only read once, so the number of entries is estimated from the file size.
     // The actual matrix will be build once all contents are inserted.
-    storm::storage::SparseMatrixBuilder<ValueType> resultMatrix(firstPass.highestStateIndex + 1, firstPass.highestStateIndex + 1,
-                                                                firstPass.numberOfNonzeroEntries);
+    storm::storage::SparseMatrixBuilder<ValueType> resultMatrix(0, 0, reader.estimateNumberOfLines(), false);
 
-    uint_fast64_t row, col, lastRow = 0;
-    double val;
-    bool dontFixDeadlocks = storm::settings::getModule<storm::settings::modules::BuildSettings>().isDontFixDeadlocksSet();
+    uint_fast64_t lastRow = 0, lastCol = 0, highestStateIndex = 0, numberOfEntries = 0;
+    bool dontFixDeadlocks = buildSettings.isDontFixDeadlocksSet();
     bool hadDeadlocks = false;
 
+    // Handle the rows in [firstRow, endRow) which have no outgoing transitions.
+    auto handleDeadlocks = [&](uint_fast64_t firstRow, uint_fast64_t endRow) {
+        for (uint_fast64_t skippedRow = firstRow; skippedRow < endRow; ++skippedRow) {
+            hadDeadlocks = true;
+            if (!dontFixDeadlocks) {
+                resultMatrix.addNextValue(skippedRow, skippedRow, storm::utility::one<ValueType>());
+                STORM_LOG_INFO("Warning while parsing " << filename << ": state " << skippedRow << " has no outgoing transitions. A self-loop was inserted.");
+            } else {
+                STORM_LOG_ERROR("Error while parsing " << filename << ": state " << skippedRow << " has no outgoing transitions.");
+                // Before throwing the appropriate exception we will give notice of all deadlock states.
+            }
+        }
+    };
+
     // Read all transitions from file. Note that we assume that the
     // transitions are listed in canonical order, otherwise this will not
     // work, i.e. the values in the matrix will be at wrong places.
+    reader.forEachLine([&](TransitionLine const& line) {
+        uint_fast64_t row = line.source;
+        uint_fast64_t col = line.target;
 
-    // Different parsing routines for transition systems and transition rewards.
-    if (isRewardFile) {
-        while (buf[0] != '\0') {
-            // Read next transition.
-            row = checked_strtol(buf, &buf);
-            col = checked_strtol(buf, &buf);
-            val = checked_strtod(buf, &buf);
-
-            resultMatrix.addNextValue(row, col, val);
-            buf = trimWhitespaces(buf);
+        // Have we already seen this transition?
+        if (numberOfEntries > 0 && row == lastRow && col == lastCol) {
+            STORM_LOG_ERROR("The same transition (" << row << ", " << col << ") is given twice.");
+            throw storm::exceptions::InvalidArgumentException() << "The same transition (" << row << ", " << col << ") is given twice.";
         }
-    } else {
-        // Read first row and add self-loops if necessary.
-        char const* tmp;
-        row = checked_strtol(buf, &tmp);
-
-        if (row > 0) {
-            for (uint_fast64_t skippedRow = 0; skippedRow < row; ++skippedRow) {
-                hadDeadlocks = true;
-                if (!dontFixDeadlocks) {
-                    resultMatrix.addNextValue(skippedRow, skippedRow, storm::utility::one<ValueType>());
-                    STORM_LOG_WARN("Warning while parsing " << filename << ": state " << skippedRow
-                                                            << " has no outgoing transitions. A self-loop was inserted.");
-                } else {
-                    STORM_LOG_ERROR("Error while parsing " << filename << ": state " << skippedRow << " has no outgoing transitions.");
-                    // Before throwing the appropriate exception we will give notice of all deadlock states.
-                }
-            }
+
+        // Test if we moved to a new row.
+        // Handle all incomplete or skipped rows for transition systems.
+        if (!isRewardFile && (numberOfEntries == 0 || lastRow != row)) {
+            handleDeadlocks(numberOfEntries == 0 ? 0 : lastRow + 1, row);
         }
 
-        while (buf[0] != '\0') {
-            // Read next transition.
-            row = checked_strtol(buf, &buf);
-            col = checked_strtol(buf, &buf);
-            val = checked_strtod(buf, &buf);
-
-            // Test if we moved to a new row.
-            // Handle all incomplete or skipped rows.
-            if (lastRow != row) {
-                for (uint_fast64_t skippedRow = lastRow + 1; skippedRow < row; ++skippedRow) {
-                    hadDeadlocks = true;
-                    if (!dontFixDeadlocks) {
-                        resultMatrix.addNextValue(skippedRow, skippedRow, storm::utility::one<ValueType>());
-                        STORM_LOG_INFO("Warning while parsing " << filename << ": state " << skippedRow
-                                                                << " has no outgoing transitions. A self-loop was inserted.");
-                    } else {
-                        STORM_LOG_ERROR("Error while parsing " << filename << ": state " << skippedRow << " has no outgoing transitions.");
-                        // Before throwing the appropriate exception we will give notice of all deadlock states.
-                    }
-                }
-                lastRow = row;
-            }
+        resultMatrix.addNextValue(row, col, line.value);
+        highestStateIndex = std::max({highestStateIndex, row, col});
+        ++numberOfEntries;
+        lastRow = row;
+        lastCol = col;
+    });
+
+    STORM_LOG_TRACE("Parsing " << filename << " shows " << numberOfEntries << " non-zeros.");
+
+    // If no transition was found, the file format was wrong.
+    if (numberOfEntries == 0) {
+        STORM_LOG_ERROR("Error while parsing " << filename << ": empty or erroneous file format.");
+        throw storm::exceptions::WrongFormatException();
+    }
 
-            resultMatrix.addNextValue(row, col, val);
-            buf = trimWhitespaces(buf);
+    if (isRewardFile) {
+        // The reward matrix should match the size of the transition matrix.
+        if (highestStateIndex + 1 > transitionMatrix.getRowCount() || highestStateIndex + 1 > transitionMatrix.getColumnCount()) {
+            STORM_LOG_ERROR("Reward matrix has more rows or columns than transition matrix.");
+            throw storm::exceptions::WrongFormatException() << "Reward matrix has more rows or columns than transition matrix.";
+        } else {
+            // If we found the right number of states or less, we set it to the number of states represented by the transition matrix.
+            highestStateIndex = transitionMatrix.getRowCount() - 1;
         }
+    } else {
+        // Handle the states after the last source state.
+        handleDeadlocks(lastRow + 1, highestStateIndex + 1);
 
         // If we encountered deadlock and did not fix them, now is the time to throw the exception.
         if (dontFixDeadlocks && hadDeadlocks)
@@ -156,7 +123,7 @@ storm::storage::SparseMatrix<ValueType> DeterministicSparseTransitionParser<Valu
     }
 
     // Finally, build the actual matrix, test and return it.
-    storm::storage::SparseMatrix<ValueType> result = resultMatrix.build();
+    storm::storage::SparseMatrix<ValueType> result = resultMatrix.build(highestStateIndex + 1, highestStateIndex + 1);
 
     // Since we cannot check if each transition for which there is a reward in the reward file also exists in the transition matrix during parsing, we have to
     // do it afterwards.
@@ -168,73 +135,6 @@ storm::storage::SparseMatrix<ValueType> DeterministicSparseTransitionParser<Valu
     return result;
 }
 
-template<typename ValueType>
-typename DeterministicSparseTransitionParser<ValueType>::FirstPassResult DeterministicSparseTransitionParser<ValueType>::firstPass(
-    char const* buf, bool reserveDiagonalElements) {
-    DeterministicSparseTransitionParser<ValueType>::FirstPassResult result;
-
-    // Skip the format hint if it is there.
-    buf = trimWhitespaces(buf);
-    if (buf[0] < '0' || buf[0] > '9') {
-        buf = forwardToLineEnd(buf);
-        buf = trimWhitespaces(buf);
-    }
-
-    // Check all transitions for non-zero diagonal entries and deadlock states.
-    uint_fast64_t row, col, lastRow = 0, lastCol = -1;
-
-    // Read first row and reserve space for self-loops if necessary.
-    char const* tmp;
-    row = checked_strtol(buf, &tmp);
-    if (row > 0 && reserveDiagonalElements) {
-        for (uint_fast64_t skippedRow = 0; skippedRow < row; ++skippedRow) {
-            ++result.numberOfNonzeroEntries;
-        }
-    }
-
-    while (buf[0] != '\0') {
-        // Read the transition.
-        row = checked_strtol(buf, &buf);
-        col = checked_strtol(buf, &buf);
-        // The actual read value is not needed here.
-        checked_strtod(buf, &buf);
-
-        if (lastRow != row && reserveDiagonalElements) {
-            // Compensate for missing rows.
-            for (uint_fast64_t skippedRow = lastRow + 1; skippedRow < row; ++skippedRow) {
-                ++result.numberOfNonzeroEntries;
-            }
-        }
-
-        // Check if a higher state id was found.
-        if (row > result.highestStateIndex)
-            result.highestStateIndex = row;
-        if (col > result.highestStateIndex)
-            result.highestStateIndex = col;
-
-        ++result.numberOfNonzeroEntries;
-
-        // Have we already seen this transition?
-        if (row == lastRow && col == lastCol) {
-            STORM_LOG_ERROR("The same transition (" << row << ", " << col << ") is given twice.");
-            throw storm::exceptions::InvalidArgumentException() << "The same transition (" << row << ", " << col << ") is given twice.";
-        }
-
-        lastRow = row;
-        lastCol = col;
-
-        buf = trimWhitespaces(buf);
-    }
-
-    if (reserveDiagonalElements) {
-        for (uint_fast64_t skippedRow = (uint_fast64_t)(lastRow + 1); skippedRow <= result.highestStateIndex; ++skippedRow) {
-            ++result.numberOfNonzeroEntries;
-        }
-    }
-
-    return result;
-}
-
 template class DeterministicSparseTransitionParser<double>;
 template storm::storage::SparseMatrix<double> DeterministicSparseTransitionParser<double>::parseDeterministicTransitionRewards(
     std::string const& filename, storm::storage::SparseMatrix<double> const& transitionMatrix);
@@ -9,33 +9,11 @@ namespace parser {
 /*!
  *	This class can be used to parse a file containing either transitions or transition rewards of a deterministic model.
  *
- *	The file is parsed in two passes.
- *	The first pass tests the file format and collects statistical data needed for the second pass.
- *	The second pass then parses the file data and constructs a SparseMatrix representing it.
+ *	The file is read in a single pass (see SparseTransitionReader) while the SparseMatrix representing it is constructed.
  */
 template<typename ValueType = double>
 class DeterministicSparseTransitionParser {
    public:
-    /*!
-     * A structure representing the result of the first pass of this parser. It contains the number of non-zero entries in the model and the highest state
-     * index.
-     */
-    struct FirstPassResult {
-        /*!
-         * The default constructor.
-         * Constructs an empty FirstPassResult.
-         */
-        FirstPassResult() : numberOfNonzeroEntries(0), highestStateIndex(0) {
-            // Intentionally left empty.
-        }
-
-        //! The total number of non-zero entries of the model.
-        uint_fast64_t numberOfNonzeroEntries;
-
-        //! The highest state index that appears in the model.
-        uint_fast64_t highestStateIndex;
-    };
-
     /*!
      * Load a deterministic transition system from file and create a
      * sparse adjacency matrix whose entries represent the weights of the edges.
@@ -60,20 +38,9 @@ class DeterministicSparseTransitionParser {
                                                                                        storm::storage::SparseMatrix<MatrixValueType> const& transitionMatrix);
 
    private:
-    /*
-     * Performs the first pass on the input pointed to by the given buffer to obtain the number of
-     * transitions and the maximum node id.
-     *
-     * @param buffer The buffer that contains the input.
-     * @param reserveDiagonalElements A flag indicating whether the diagonal elements should be counted as if they
-     * were present to enable fixes later.
-     * @return A structure representing the result of the first pass.
-     */
-    static FirstPassResult firstPass(char const* buffer, bool reserveDiagonalElements);
-
     /*
      * The main parsing routine.
-     * Opens the given file, calls the first pass and performs the second pass, parsing the content of the file into a SparseMatrix.
+     * Opens the given file and parses its content into a SparseMatrix.
      *
      * @param filename The path and name of the file to be parsed.
      * @param rewardFile A flag set iff the file to be parsed contains transition rewards.
@@ -2,13 +2,22 @@
 
 #include <boost/algorithm/string.hpp>
 #include <boost/algorithm/string/predicate.hpp>
+#include <algorithm>
+#include <cstdlib>
 #include <iostream>
+#include <map>
+#include <optional>
 #include <regex>
+#include <set>
+#include <streambuf>
 #include <string>
+#include <type_traits>
 
 #include "storm/adapters/RationalFunctionAdapter.h"
 
+#include "storm-parsers/parser/MappedFile.h"
 #include "storm-parsers/parser/ValueParser.h"
+#include "storm/adapters/IntelTbbAdapter.h"
 
 #include "storm/exceptions/AbortException.h"
 #include "storm/exceptions/FileIoException.h"
@@ -30,6 +39,17 @@
 namespace storm {
 namespace parser {
 
+namespace {
+// Read-only stream buffer over a range of memory (e.g. a part of a memory-mapped file)
+class MemoryStreamBuffer : public std::streambuf {
+   public:
+    MemoryStreamBuffer(char const* begin, char const* end) {
+        char* data = const_cast<char*>(begin);
+        this->setg(data, data, data + (end - begin));
+    }
+};
+}  // namespace
+
 template<typename ValueType, typename RewardModelType>
 std::shared_ptr<storm::models::sparse::Model<ValueType, RewardModelType>> DirectEncodingParser<ValueType, RewardModelType>::parseModel(
     std::string const& filename, DirectEncodingParserOptions const& options) {
@@ -49,6 +69,8 @@ std::shared_ptr<storm::models::sparse::Model<ValueType, RewardModelType>> Direct
     storm::models::ModelType type;
     std::vector<std::string> rewardModelNames;
     std::shared_ptr<storm::storage::sparse::ModelComponents<ValueType, RewardModelType>> modelComponents;
+    // Offset of the states in the file if they are parsed in parallel
+    std::optional<uint64_t> modelOffset;
 
     // Parse header
     while (storm::utility::getline(file, line)) {
@@ -118,14 +140,28 @@ std::shared_ptr<storm::models::sparse::Model<ValueType, RewardModelType>> Direct
                             "No. of actions (@nr_choices) has to be declared before model.");
             STORM_LOG_WARN_COND(nrChoices != 0, "No. of actions has to be declared. We may continue now, but future versions might not support this.");
             // Construct model components
-            modelComponents = parseStates(file, type, nrStates, nrChoices, placeholders, valueParser, rewardModelNames, options);
+            // Only values of type double can be parsed concurrently
+            bool parseInParallel = std::is_same_v<ValueType, double> && options.numberOfThreads > 1 && !options.buildChoiceLabeling;
+#ifndef STORM_HAVE_INTELTBB
+            STORM_LOG_WARN_COND(options.numberOfThreads <= 1, "Parsing in parallel requires TBB. Parsing sequentially instead.");
+            parseInParallel = false;
+#endif
+            if (parseInParallel) {
+                // The states are parsed from the memory-mapped file
+                modelOffset = file.tellg();
+            } else {
+                modelComponents = parseStates(file, type, 0, nrStates, nrStates, nrChoices, placeholders, valueParser, rewardModelNames, options);
+            }
             break;
         } else {
             STORM_LOG_THROW(false, storm::exceptions::WrongFormatException, "Could not parse line '" << line << "'.");
         }
     }
-    // Done parsing
     storm::utility::closeFile(file);
+    if (modelOffset) {
+        modelComponents = parseStatesParallel(filename, modelOffset.value(), type, nrStates, nrChoices, placeholders, valueParser, rewardModelNames, options);
+    }
+    // Done parsing
 
     // Build model
     return storm::utility::builder::buildModelFromComponents(type, std::move(*modelComponents));
@@ -133,8 +169,9 @@ std::shared_ptr<storm::models::sparse::Model<ValueType, RewardModelType>> Direct
 
 template<typename ValueType, typename RewardModelType>
 std::shared_ptr<storm::storage::sparse::ModelComponents<ValueType, RewardModelType>> DirectEncodingParser<ValueType, RewardModelType>::parseStates(
-    std::istream& file, storm::models::ModelType type, size_t stateSize, size_t nrChoices, std::unordered_map<std::string, ValueType> const& placeholders,
-    ValueParser<ValueType> const& valueParser, std::vector<std::string> const& rewardModelNames, DirectEncodingParserOptions const& options) {
+    std::istream& file, storm::models::ModelType type, size_t stateOffset, size_t stateSize, size_t totalStateSize, size_t nrChoices,
+    std::unordered_map<std::string, ValueType> const& placeholders, ValueParser<ValueType> const& valueParser,
+    std::vector<std::string> const& rewardModelNames, DirectEncodingParserOptions const& options) {
     // Initialize
     auto modelComponents = std::make_shared<storm::storage::sparse::ModelComponents<ValueType, RewardModelType>>();
     bool nonDeterministic =
@@ -200,8 +237,9 @@ std::shared_ptr<storm::storage::sparse::ModelComponents<ValueType, RewardModelTy
                 line = "";
             }
             size_t parsedId = parseNumber<size_t>(curString);
-            STORM_LOG_THROW(state == parsedId, storm::exceptions::WrongFormatException,
-                            "In line " << lineNumber << " state ids are not ordered and without gaps. Expected " << state << " but got " << parsedId << ".");
+            STORM_LOG_THROW(stateOffset + state == parsedId, storm::exceptions::WrongFormatException,
+                            "In line " << lineNumber << " state ids are not ordered and without gaps. Expected " << stateOffset + state << " but got " << parsedId
+                                       << ".");
             if (nonDeterministic) {
                 STORM_LOG_TRACE("new Row Group starts at " << row << ".");
                 builder.newRowGroup(row);
@@ -363,8 +401,8 @@ std::shared_ptr<storm::storage::sparse::ModelComponents<ValueType, RewardModelTy
             std::string valueStr = line.substr(posColon + 2);
             ValueType value = parseValue(valueStr, placeholders, valueParser);
             STORM_LOG_TRACE("Transition " << row << " -> " << target << ": " << value);
-            STORM_LOG_THROW(target < stateSize, storm::exceptions::WrongFormatException,
-                            "In line " << lineNumber << " target state " << target << " is greater than state size " << stateSize);
+            STORM_LOG_THROW(target < totalStateSize, storm::exceptions::WrongFormatException,
+                            "In line " << lineNumber << " target state " << target << " is greater than state size " << totalStateSize);
             builder.addNextValue(row, target, value);
         }
 
@@ -384,7 +422,7 @@ std::shared_ptr<storm::storage::sparse::ModelComponents<ValueType, RewardModelTy
     }
 
     // Build transition matrix
-    modelComponents->transitionMatrix = builder.build(row + 1, stateSize, nonDeterministic ? stateSize : 0);
+    modelComponents->transitionMatrix = builder.build(row + 1, totalStateSize, nonDeterministic ? stateSize : 0);
     STORM_LOG_TRACE("Built matrix");
 
     // Build reward models
@@ -411,6 +449,169 @@ std::shared_ptr<storm::storage::sparse::ModelComponents<ValueType, RewardModelTy
     return modelComponents;
 }
 
+template<typename ValueType, typename RewardModelType>
+std::shared_ptr<storm::storage::sparse::ModelComponents<ValueType, RewardModelType>> DirectEncodingParser<ValueType, RewardModelType>::parseStatesParallel(
+    std::string const& filename, uint64_t modelOffset, storm::models::ModelType type, size_t stateSize, size_t nrChoices,
+    std::unordered_map<std::string, ValueType> const& placeholders, ValueParser<ValueType> const& valueParser,
+    std::vector<std::string> const& rewardModelNames, DirectEncodingParserOptions const& options) {
+    MappedFile mappedFile(filename.c_str());
+    char const* begin = mappedFile.getData() + modelOffset;
+    char const* end = mappedFile.getDataEnd();
+
+    // Split input into chunks of roughly equal size. Each chunk starts with a state declaration.
+    // Using more chunks than threads balances the load if some parts of the model are more dense.
+    uint64_t const nrDesiredChunks = options.numberOfThreads * 4;
+    uint64_t const desiredChunkSize = (end - begin) / nrDesiredChunks + 1;
+    std::vector<char const*> chunkBegins = {begin};
+    std::vector<size_t> chunkFirstStates = {0};
+    std::string const stateDeclaration = "\nstate ";
+    for (uint64_t i = 1; i < nrDesiredChunks && begin + i * desiredChunkSize < end; ++i) {
+        // Search for the next state declaration starting at the new line before the desired split point
+        char const* position = std::search(std::max(begin + i * desiredChunkSize - 1, chunkBegins.back()), end, stateDeclaration.begin(), stateDeclaration.end());
+        if (position == end) {
+            break;
+        }
+        ++position;  // Skip new line
+        size_t firstState = std::strtoull(position + stateDeclaration.size() - 1, nullptr, 10);
+        STORM_LOG_THROW(firstState > chunkFirstStates.back() && firstState < stateSize, storm::exceptions::WrongFormatException,
+                        "State ids are not ordered and without gaps around state " << firstState << ".");
+        chunkBegins.push_back(position);
+        chunkFirstStates.push_back(firstState);
+    }
+    uint64_t nrChunks = chunkBegins.size();
+    chunkBegins.push_back(end);
+    chunkFirstStates.push_back(stateSize);
+    STORM_LOG_DEBUG("Parsing " << nrChunks << " chunks with " << options.numberOfThreads << " threads.");
+
+    // Parse chunks concurrently
+    std::vector<std::shared_ptr<storm::storage::sparse::ModelComponents<ValueType, RewardModelType>>> chunkComponents(nrChunks);
+    auto parseChunk = [&](uint64_t chunk) {
+        MemoryStreamBuffer buffer(chunkBegins[chunk], chunkBegins[chunk + 1]);
+        std::istream stream(&buffer);
+        chunkComponents[chunk] = parseStates(stream, type, chunkFirstStates[chunk], chunkFirstStates[chunk + 1] - chunkFirstStates[chunk], stateSize, 0,
+                                             placeholders, valueParser, rewardModelNames, options);
+    };
+#ifdef STORM_HAVE_INTELTBB
+    tbb::task_arena arena(options.numberOfThreads);
+    arena.execute([&]() {
+        tbb::parallel_for(tbb::blocked_range<uint64_t>(0, nrChunks, 1), [&](tbb::blocked_range<uint64_t> const& range) {
+            for (uint64_t chunk = range.begin(); chunk < range.end(); ++chunk) {
+                parseChunk(chunk);
+            }
+        });
+    });
+#else
+    for (uint64_t chunk = 0; chunk < nrChunks; ++chunk) {
+        parseChunk(chunk);
+    }
+#endif
+
+    // Stitch chunks together
+    bool nonDeterministic =
+        (type == storm::models::ModelType::Mdp || type == storm::models::ModelType::MarkovAutomaton || type == storm::models::ModelType::Pomdp);
+    uint64_t nrRows = 0;
+    uint64_t nrEntries = 0;
+    for (auto const& components : chunkComponents) {
+        nrRows += components->transitionMatrix.getRowCount();
+        nrEntries += components->transitionMatrix.getEntryCount();
+    }
+    if (nonDeterministic) {
+        STORM_LOG_THROW(nrChoices == 0 || nrRows == nrChoices, storm::exceptions::WrongFormatException,
+                        "Number of actions detected (" << nrRows << ") does not match number of actions declared (" << nrChoices << ", in @nr_choices).");
+    }
+
+    auto modelComponents = std::make_shared<storm::storage::sparse::ModelComponents<ValueType, RewardModelType>>();
+    storm::storage::SparseMatrixBuilder<ValueType> builder(nrRows, stateSize, nrEntries, false, nonDeterministic, nonDeterministic ? stateSize : 0);
+    modelComponents->stateLabeling = storm::models::sparse::StateLabeling(stateSize);
+    modelComponents->observabilityClasses = std::vector<uint32_t>();
+    modelComponents->observabilityClasses->reserve(stateSize);
+    modelComponents->rateTransitions = chunkComponents.front()->rateTransitions;
+    if (chunkComponents.front()->exitRates) {
+        modelComponents->exitRates = std::vector<ValueType>();
+        modelComponents->exitRates->reserve(stateSize);
+    }
+    if (chunkComponents.front()->markovianStates) {
+        modelComponents->markovianStates = storm::storage::BitVector(stateSize);
+    }
+    std::map<std::string, std::vector<ValueType>> stateRewards;
+    std::map<std::string, std::vector<ValueType>> actionRewards;
+    std::set<std::string> rewardModels;
+
+    uint64_t rowOffset = 0;
+    for (uint64_t chunk = 0; chunk < nrChunks; ++chunk) {
+        auto& components = *chunkComponents[chunk];
+        size_t stateOffset = chunkFirstStates[chunk];
+        size_t chunkStates = chunkFirstStates[chunk + 1] - stateOffset;
+        auto const& matrix = components.transitionMatrix;
+
+        // Append transitions
+        for (uint64_t group = 0; group < matrix.getRowGroupCount(); ++group) {
+            if (nonDeterministic) {
+                builder.newRowGroup(rowOffset + matrix.getRowGroupIndices()[group]);
+            }
+            for (auto row : matrix.getRowGroupIndices(group)) {
+                for (auto const& entry : matrix.getRow(row)) {
+                    builder.addNextValue(rowOffset + row, entry.getColumn(), entry.getValue());
+                }
+            }
+        }
+
+        // Append labels
+        for (auto const& label : components.stateLabeling.getLabels()) {
+            if (!modelComponents->stateLabeling.containsLabel(label)) {
+                modelComponents->stateLabeling.addLabel(label);
+            }
+            for (auto state : components.stateLabeling.getStates(label)) {
+                modelComponents->stateLabeling.addLabelToState(label, stateOffset + state);
+            }
+        }
+
+        // Append state information
+        modelComponents->observabilityClasses->insert(modelComponents->observabilityClasses->end(), components.observabilityClasses->begin(),
+                                                      components.observabilityClasses->begin() + chunkStates);
+        if (modelComponents->exitRates) {
+            modelComponents->exitRates->insert(modelComponents->exitRates->end(), components.exitRates->begin(), components.exitRates->begin() + chunkStates);
+        }
+        if (modelComponents->markovianStates) {
+            for (auto state : components.markovianStates.get()) {
+                modelComponents->markovianStates->set(stateOffset + state);
+            }
+        }
+
+        // Append rewards. Vectors are only created if a chunk contains non-zero rewards.
+        for (auto const& [name, rewardModel] : components.rewardModels) {
+            rewardModels.insert(name);
+            if (rewardModel.hasStateRewards()) {
+                auto& rewards = stateRewards[name];
+                rewards.resize(stateSize, storm::utility::zero<ValueType>());
+                std::copy_n(rewardModel.getStateRewardVector().begin(), chunkStates, rewards.begin() + stateOffset);
+            }
+            if (rewardModel.hasStateActionRewards()) {
+                auto& rewards = actionRewards[name];
+                rewards.resize(nrRows, storm::utility::zero<ValueType>());
+                std::copy_n(rewardModel.getStateActionRewardVector().begin(), matrix.getRowCount(), rewards.begin() + rowOffset);
+            }
+        }
+
+        rowOffset += matrix.getRowCount();
+        // Free memory of chunk
+        chunkComponents[chunk] = nullptr;
+    }
+
+    modelComponents->transitionMatrix = builder.build(nrRows, stateSize, nonDeterministic ? stateSize : 0);
+    for (auto const& name : rewardModels) {
+        std::optional<std::vector<ValueType>> stateRewardVector, actionRewardVector;
+        if (stateRewards.count(name) > 0) {
+            stateRewardVector = std::move(stateRewards.at(name));
+        }
+        if (actionRewards.count(name) > 0) {
+            actionRewardVector = std::move(actionRewards.at(name));
+        }
+        modelComponents->rewardModels.emplace(name, RewardModelType(std::move(stateRewardVector), std::move(actionRewardVector)));
+    }
+    return modelComponents;
+}
+
 template<typename ValueType, typename RewardModelType>
 ValueType DirectEncodingParser<ValueType, RewardModelType>::parseValue(std::string const& valueStr,
                                                                        std::unordered_map<std::string, ValueType> const& placeholders,
@@ -13,6 +13,8 @@ class ValueParser;
 
 struct DirectEncodingParserOptions {
     bool buildChoiceLabeling = false;
+    // Number of threads used for parsing the states (only for models with double values and without choice labeling)
+    uint64_t numberOfThreads = 1;
 };
 /*!
  *	Parser for models in the DRN format with explicit encoding.
@@ -33,10 +35,15 @@ class DirectEncodingParser {
    private:
     /*!
      * Parse states and return transition matrix.
+     * The input can also contain only a consecutive range of the states. Then, all components refer to the states and choices within this range,
+     * i.e., the first given state has index 0. Only the columns of the transition matrix refer to the global state indices.
      *
      * @param file Input file stream.
      * @param type Model type.
-     * @param stateSize No. of states
+     * @param stateOffset Index of the first state in the input.
+     * @param stateSize No. of states in the input.
+     * @param totalStateSize No. of states of the model.
+     * @param nrChoices No. of choices in the input (0 if unknown).
      * @param placeholders Placeholders for values.
      * @param valueParser Value parser.
      * @param rewardModelNames Names of reward models.
@@ -44,8 +51,29 @@ class DirectEncodingParser {
      * @return Transition matrix.
      */
     static std::shared_ptr<storm::storage::sparse::ModelComponents<ValueType, RewardModelType>> parseStates(
-        std::istream& file, storm::models::ModelType type, size_t stateSize, size_t nrChoices, std::unordered_map<std::string, ValueType> const& placeholders,
-        ValueParser<ValueType> const& valueParser, std::vector<std::string> const& rewardModelNames, DirectEncodingParserOptions const& options);
+        std::istream& file, storm::models::ModelType type, size_t stateOffset, size_t stateSize, size_t totalStateSize, size_t nrChoices,
+        std::unordered_map<std::string, ValueType> const& placeholders, ValueParser<ValueType> const& valueParser,
+        std::vector<std::string> const& rewardModelNames, DirectEncodingParserOptions const& options);
+
+    /*!
+     * Parse states in parallel.
+     * The memory-mapped file is split into chunks at state declarations. The chunks are parsed concurrently and afterwards stitched together.
+     *
+     * @param filename Input file.
+     * @param modelOffset Position of the first state declaration (after @model) in the file.
+     * @param type Model type.
+     * @param stateSize No. of states
+     * @param nrChoices No. of choices (0 if unknown).
+     * @param placeholders Placeholders for values.
+     * @param valueParser Value parser.
+     * @param rewardModelNames Names of reward models.
+     *
+     * @return Transition matrix.
+     */
+    static std::shared_ptr<storm::storage::sparse::ModelComponents<ValueType, RewardModelType>> parseStatesParallel(
+        std::string const& filename, uint64_t modelOffset, storm::models::ModelType type, size_t stateSize, size_t nrChoices,
+        std::unordered_map<std::string, ValueType> const& placeholders, ValueParser<ValueType> const& valueParser,
+        std::vector<std::string> const& rewardModelNames, DirectEncodingParserOptions const& options);
 
     /*!
      * Parse value from string while using placeholders.
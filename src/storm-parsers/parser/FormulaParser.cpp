@@ -19,39 +19,59 @@
 namespace storm {
 namespace parser {
 
-FormulaParser::FormulaParser() : manager(new storm::expressions::ExpressionManager()), grammar(new FormulaParserGrammar(manager)) {
+FormulaParser::FormulaParser() : manager(new storm::expressions::ExpressionManager()) {
     // Intentionally left empty.
 }
 
-FormulaParser::FormulaParser(std::shared_ptr<storm::expressions::ExpressionManager const> const& manager)
-    : manager(manager), grammar(new FormulaParserGrammar(manager)) {
+FormulaParser::FormulaParser(std::shared_ptr<storm::expressions::ExpressionManager const> const& manager) : manager(manager) {
     // Intentionally left empty.
 }
 
-FormulaParser::FormulaParser(std::shared_ptr<storm::expressions::ExpressionManager> const& manager)
-    : manager(manager), grammar(new FormulaParserGrammar(manager)) {
+FormulaParser::FormulaParser(std::shared_ptr<storm::expressions::ExpressionManager> const& manager) : manager(manager), nonConstManager(manager) {
     // Intentionally left empty.
 }
 
-FormulaParser::FormulaParser(storm::prism::Program const& program)
-    : manager(program.getManager().getSharedPointer()), grammar(new FormulaParserGrammar(program.getManager().getSharedPointer())) {}
+FormulaParser::FormulaParser(storm::prism::Program const& program) : manager(program.getManager().getSharedPointer()) {}
 
 FormulaParser::FormulaParser(storm::prism::Program& program)
-    : manager(program.getManager().getSharedPointer()), grammar(new FormulaParserGrammar(program.getManager().getSharedPointer())) {}
+    : manager(program.getManager().getSharedPointer()), nonConstManager(program.getManager().getSharedPointer()) {}
 
 FormulaParser::FormulaParser(FormulaParser const& other) : FormulaParser(other.manager) {
-    other.grammar->getIdentifiers().for_each(
-        [this](std::string const& name, storm::expressions::Expression const& expression) { this->addIdentifierExpression(name, expression); });
+    *this = other;
 }
 
 FormulaParser& FormulaParser::operator=(FormulaParser const& other) {
+    if (this == &other) {
+        return *this;
+    }
     this->manager = other.manager;
-    this->grammar = std::shared_ptr<FormulaParserGrammar>(new FormulaParserGrammar(this->manager));
-    other.grammar->getIdentifiers().for_each(
-        [=](std::string const& name, storm::expressions::Expression const& expression) { this->addIdentifierExpression(name, expression); });
+    this->nonConstManager = nullptr;
+    this->grammar.reset();
+    this->identifierExpressions.clear();
+    if (other.grammar) {
+        // The grammar might know further identifiers, e.g., constants defined in a parsed property file.
+        other.grammar->getIdentifiers().for_each(
+            [this](std::string const& name, storm::expressions::Expression const& expression) { this->addIdentifierExpression(name, expression); });
+    } else {
+        this->identifierExpressions = other.identifierExpressions;
+    }
     return *this;
 }
 
+FormulaParserGrammar& FormulaParser::getGrammar() const {
+    if (!grammar) {
+        if (nonConstManager) {
+            grammar = std::make_shared<FormulaParserGrammar>(nonConstManager);
+        } else {
+            grammar = std::make_shared<FormulaParserGrammar>(manager);
+        }
+        for (auto const& [identifier, expression] : identifierExpressions) {
+            grammar->addIdentifierExpression(identifier, expression);
+        }
+    }
+    return *grammar;
+}
+
 std::shared_ptr<storm::logic::Formula const> FormulaParser::parseSingleFormulaFromString(std::string const& formulaString) const {
     std::vector<storm::jani::Property> property = parseFromString(formulaString);
     STORM_LOG_THROW(property.size() == 1, storm::exceptions::WrongFormatException,
@@ -92,8 +112,9 @@ std::vector<storm::jani::Property> FormulaParser::parseFromString(std::string co
     // Create grammar.
     try {
         // Start parsing.
-        bool succeeded = qi::phrase_parse(
-            iter, last, *grammar, storm::spirit_encoding::space_type() | qi::lit("//") >> *(qi::char_ - (qi::eol | qi::eoi)) >> (qi::eol | qi::eoi), result);
+        bool succeeded = qi::phrase_parse(iter, last, getGrammar(),
+                                          storm::spirit_encoding::space_type() | qi::lit("//") >> *(qi::char_ - (qi::eol | qi::eoi)) >> (qi::eol | qi::eoi),
+                                          result);
         STORM_LOG_THROW(succeeded, storm::exceptions::WrongFormatException, "Could not parse formula: " << formulaString);
         STORM_LOG_DEBUG("Parsed formula successfully.");
     } catch (qi::expectation_failure<PositionIteratorType> const& e) {
@@ -104,8 +125,11 @@ std::vector<storm::jani::Property> FormulaParser::parseFromString(std::string co
 }
 
 void FormulaParser::addIdentifierExpression(std::string const& identifier, storm::expressions::Expression const& expression) {
-    // Record the mapping and hand it over to the grammar.
-    grammar->addIdentifierExpression(identifier, expression);
+    // Record the mapping and hand it over to the grammar (if already constructed).
+    identifierExpressions.emplace_back(identifier, expression);
+    if (grammar) {
+        grammar->addIdentifierExpression(identifier, expression);
+    }
 }
 
 }  // namespace parser
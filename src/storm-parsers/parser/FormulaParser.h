@@ -65,11 +65,22 @@ class FormulaParser {
    private:
     void addFormulasAsIdentifiers(storm::prism::Program const& program);
 
+    /*!
+     * Retrieves the grammar. As constructing the grammar is expensive, this is only done upon the first use.
+     */
+    FormulaParserGrammar& getGrammar() const;
+
     // The manager used to parse expressions.
     std::shared_ptr<storm::expressions::ExpressionManager const> manager;
 
-    // The grammar used to parse the input.
-    std::shared_ptr<FormulaParserGrammar> grammar;
+    // If given, the grammar may declare new variables (e.g., for undefined constants) in this manager.
+    std::shared_ptr<storm::expressions::ExpressionManager> nonConstManager;
+
+    // The identifiers that were added before the grammar was constructed.
+    std::vector<std::pair<std::string, storm::expressions::Expression>> identifierExpressions;
+
+    // The grammar used to parse the input (if already constructed).
+    mutable std::shared_ptr<FormulaParserGrammar> grammar;
 };
 
 }  // namespace parser
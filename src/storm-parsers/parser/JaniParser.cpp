@@ -34,12 +34,60 @@
 #include <iostream>
 #include <sstream>
 
+#include "storm-parsers/parser/MappedFile.h"
+#include "storm/io/JsonBinaryEncoding.h"
 #include "storm/io/file.h"
 #include "storm/utility/macros.h"
 
 namespace storm {
 namespace parser {
 
+JaniScopeDescription::JaniScopeDescription(std::string const& description) : node(std::make_shared<Node const>(Node{description, nullptr})) {
+    // Intentionally left empty.
+}
+
+JaniScopeDescription JaniScopeDescription::refine(std::string const& prependedDescription) const {
+    JaniScopeDescription result(*this);
+    result.node = std::make_shared<Node const>(Node{prependedDescription, node});
+    return result;
+}
+
+std::string JaniScopeDescription::toString() const {
+    std::stringstream stream;
+    for (Node const* current = node.get(); current != nullptr; current = current->parent.get()) {
+        if (current->parent) {
+            stream << "'" << current->text << "' at ";
+        } else {
+            stream << current->text;
+        }
+    }
+    return stream.str();
+}
+
+JaniScopeDescription::operator std::string() const {
+    return toString();
+}
+
+std::ostream& operator<<(std::ostream& out, JaniScopeDescription const& description) {
+    return out << description.toString();
+}
+
+std::string operator+(std::string const& lhs, JaniScopeDescription const& rhs) {
+    return lhs + rhs.toString();
+}
+
+std::string operator+(JaniScopeDescription const& lhs, std::string const& rhs) {
+    return lhs.toString() + rhs;
+}
+
+std::string operator+(char const* lhs, JaniScopeDescription const& rhs) {
+    return lhs + rhs.toString();
+}
+
+std::string operator+(JaniScopeDescription const& lhs, char const* rhs) {
+    return lhs.toString() + rhs;
+}
+
 ////////////
 // Defaults
 ////////////
@@ -51,22 +99,22 @@ const std::set<std::string> JaniParser<ValueType>::unsupportedOpstrings({"sin",
                                                                          "atan", "acot", "asec",  "acsc",  "sinh",  "cosh",  "tanh", "coth",
                                                                          "sech", "csch", "asinh", "acosh", "atanh", "asinh", "acosh"});
 
-template<typename ValueType>
-std::string getString(typename JaniParser<ValueType>::Json const& structure, std::string const& errorInfo) {
+template<typename ValueType, typename ErrorInfo>
+std::string getString(typename JaniParser<ValueType>::Json const& structure, ErrorInfo const& errorInfo) {
     STORM_LOG_THROW(structure.is_string(), storm::exceptions::InvalidJaniException,
                     "Expected a string in " << errorInfo << ", got '" << structure.dump() << "'");
     return structure.front();
 }
 
-template<typename ValueType>
-bool getBoolean(typename JaniParser<ValueType>::Json const& structure, std::string const& errorInfo) {
+template<typename ValueType, typename ErrorInfo>
+bool getBoolean(typename JaniParser<ValueType>::Json const& structure, ErrorInfo const& errorInfo) {
     STORM_LOG_THROW(structure.is_boolean(), storm::exceptions::InvalidJaniException,
                     "Expected a Boolean in " << errorInfo << ", got " << structure.dump() << "'");
     return structure.front();
 }
 
-template<typename ValueType>
-uint64_t getUnsignedInt(typename JaniParser<ValueType>::Json const& structure, std::string const& errorInfo) {
+template<typename ValueType, typename ErrorInfo>
+uint64_t getUnsignedInt(typename JaniParser<ValueType>::Json const& structure, ErrorInfo const& errorInfo) {
     STORM_LOG_THROW(structure.is_number(), storm::exceptions::InvalidJaniException,
                     "Expected a number in " << errorInfo << ", got '" << structure.dump() << "'");
     int64_t num = structure.front();
@@ -74,8 +122,8 @@ uint64_t getUnsignedInt(typename JaniParser<ValueType>::Json const& structure, s
     return static_cast<uint64_t>(num);
 }
 
-template<typename ValueType>
-int64_t getSignedInt(typename JaniParser<ValueType>::Json const& structure, std::string const& errorInfo) {
+template<typename ValueType, typename ErrorInfo>
+int64_t getSignedInt(typename JaniParser<ValueType>::Json const& structure, ErrorInfo const& errorInfo) {
     STORM_LOG_THROW(structure.is_number(), storm::exceptions::InvalidJaniException,
                     "Expected a number in " << errorInfo << ", got '" << structure.dump() << "'");
     return structure.front();
@@ -101,10 +149,14 @@ JaniParser<ValueType>::JaniParser(std::string const& jsonstring) : expressionMan
 
 template<typename ValueType>
 void JaniParser<ValueType>::readFile(std::string const& path) {
-    std::ifstream file;
-    storm::utility::openFile(path, file);
-    file >> parsedStructure;
-    storm::utility::closeFile(file);
+    // Parsing from the mapped file avoids reading the document character-wise through a stream.
+    MappedFile file(path.c_str());
+    if (storm::exporter::isJsonBinary(file.getData(), file.getDataEnd())) {
+        // The model was stored in the binary encoding (see storm::api::exportJaniModelAsBinary).
+        parsedStructure = storm::exporter::decodeJsonBinary<ValueType>(file.getData(), file.getDataEnd());
+    } else {
+        parsedStructure = Json::parse(file.getData(), file.getDataEnd());
+    }
 }
 
 template<typename ValueType>
@@ -976,7 +1028,8 @@ std::shared_ptr<storm::jani::Variable> JaniParser<ValueType>::parseVariable(Json
 /**
  * Helper for parse expression.
  */
-void ensureNumberOfArguments(uint64_t expected, uint64_t actual, std::string const& opstring, std::string const& errorInfo) {
+template<typename ErrorInfo>
+void ensureNumberOfArguments(uint64_t expected, uint64_t actual, std::string const& opstring, ErrorInfo const& errorInfo) {
     STORM_LOG_THROW(expected == actual, storm::exceptions::InvalidJaniException,
                     "Operator " << opstring << " expects " << expected << " arguments, but got " << actual << " in " << errorInfo << ".");
 }
@@ -1003,7 +1056,8 @@ std::vector<storm::expressions::Expression> JaniParser<ValueType>::parseBinaryEx
 /**
  * Helper for parse expression.
  */
-void ensureBooleanType(storm::expressions::Expression const& expr, std::string const& opstring, unsigned argNr, std::string const& errorInfo) {
+template<typename ErrorInfo>
+void ensureBooleanType(storm::expressions::Expression const& expr, std::string const& opstring, unsigned argNr, ErrorInfo const& errorInfo) {
     STORM_LOG_THROW(expr.hasBooleanType(), storm::exceptions::InvalidJaniException,
                     "Operator " << opstring << " expects argument[" << argNr << "]: '" << expr << "' to be Boolean in " << errorInfo << ".");
 }
@@ -1011,7 +1065,8 @@ void ensureBooleanType(storm::expressions::Expression const& expr, std::string c
 /**
  * Helper for parse expression.
  */
-void ensureNumericalType(storm::expressions::Expression const& expr, std::string const& opstring, unsigned argNr, std::string const& errorInfo) {
+template<typename ErrorInfo>
+void ensureNumericalType(storm::expressions::Expression const& expr, std::string const& opstring, unsigned argNr, ErrorInfo const& errorInfo) {
     STORM_LOG_THROW(expr.hasNumericalType(), storm::exceptions::InvalidJaniException,
                     "Operator " << opstring << " expects argument " + std::to_string(argNr) + " to be numerical in " << errorInfo << ".");
 }
@@ -1019,7 +1074,8 @@ void ensureNumericalType(storm::expressions::Expression const& expr, std::string
 /**
  * Helper for parse expression.
  */
-void ensureIntegerType(storm::expressions::Expression const& expr, std::string const& opstring, unsigned argNr, std::string const& errorInfo) {
+template<typename ErrorInfo>
+void ensureIntegerType(storm::expressions::Expression const& expr, std::string const& opstring, unsigned argNr, ErrorInfo const& errorInfo) {
     STORM_LOG_THROW(expr.hasIntegerType(), storm::exceptions::InvalidJaniException,
                     "Operator " << opstring << " expects argument " + std::to_string(argNr) + " to be numerical in " << errorInfo << ".");
 }
@@ -1027,7 +1083,8 @@ void ensureIntegerType(storm::expressions::Expression const& expr, std::string c
 /**
  * Helper for parse expression.
  */
-void ensureArrayType(storm::expressions::Expression const& expr, std::string const& opstring, unsigned argNr, std::string const& errorInfo) {
+template<typename ErrorInfo>
+void ensureArrayType(storm::expressions::Expression const& expr, std::string const& opstring, unsigned argNr, ErrorInfo const& errorInfo) {
     STORM_LOG_THROW(expr.getType().isArrayType(), storm::exceptions::InvalidJaniException,
                     "Operator " << opstring << " expects argument " + std::to_string(argNr) + " to be of type 'array' in " << errorInfo << ".");
 }
@@ -1,4 +1,8 @@
 #pragma once
+#include <memory>
+#include <ostream>
+#include <string>
+
 #include "storm/adapters/JsonAdapter.h"
 #include "storm/exceptions/FileIoException.h"
 #include "storm/logic/Bound.h"
@@ -25,6 +29,36 @@ enum class FormulaContext;
 }
 
 namespace parser {
+/*
+ * Description of the position within a JANI structure, used in error messages.
+ * Refining a description is cheap, the (possibly long) text is only assembled when it is printed.
+ */
+class JaniScopeDescription {
+   public:
+    JaniScopeDescription(std::string const& description = "global");
+
+    /*!
+     * Returns a description of the form "'prependedDescription' at <this description>".
+     */
+    JaniScopeDescription refine(std::string const& prependedDescription) const;
+
+    std::string toString() const;
+    operator std::string() const;
+
+   private:
+    struct Node {
+        std::string text;
+        std::shared_ptr<Node const> parent;
+    };
+    std::shared_ptr<Node const> node;
+};
+
+std::ostream& operator<<(std::ostream& out, JaniScopeDescription const& description);
+std::string operator+(std::string const& lhs, JaniScopeDescription const& rhs);
+std::string operator+(JaniScopeDescription const& lhs, std::string const& rhs);
+std::string operator+(char const* lhs, JaniScopeDescription const& rhs);
+std::string operator+(JaniScopeDescription const& lhs, char const* rhs);
+
 /*
  * The JANI format parser.
  * Parses Models and Properties
@@ -57,7 +91,7 @@ class JaniParser {
               localFunctions(localFunctions){};
 
         Scope(Scope const& other) = default;
-        std::string description;
+        JaniScopeDescription description;
         ConstantsMap const* constants;
         VariablesMap const* globalVars;
         FunctionsMap const* globalFunctions;
@@ -66,7 +100,7 @@ class JaniParser {
         Scope refine(std::string const& prependedDescription = "") const {
             Scope res(*this);
             if (prependedDescription != "") {
-                res.description = "'" + prependedDescription + "' at " + res.description;
+                res.description = res.description.refine(prependedDescription);
             }
             return res;
         }
@@ -7,7 +7,6 @@
 #include "storm/exceptions/InvalidTypeException.h"
 #include "storm/exceptions/UnexpectedException.h"
 #include "storm/exceptions/WrongFormatException.h"
-#include "storm/io/file.h"
 #include "storm/utility/macros.h"
 
 #include "storm/storage/BitVector.h"
@@ -15,32 +14,14 @@
 #include "storm/storage/expressions/VariableExpression.h"
 
 #include "storm-parsers/parser/ExpressionParser.h"
+#include "storm-parsers/parser/MappedFile.h"
 
 namespace storm {
 namespace parser {
 storm::prism::Program PrismParserGrammar::parse(std::string const& filename, bool prismCompatibility) {
-    // Open file and initialize result.
-    std::ifstream inputFileStream;
-    storm::utility::openFile(filename, inputFileStream);
-    storm::prism::Program result;
-
-    // Now try to parse the contents of the file.
-    try {
-        std::string fileContent((std::istreambuf_iterator<char>(inputFileStream)), (std::istreambuf_iterator<char>()));
-        result = parseFromString(fileContent, filename, prismCompatibility);
-    } catch (storm::exceptions::WrongFormatException& e) {
-        // In case of an exception properly close the file before passing exception.
-        storm::utility::closeFile(inputFileStream);
-        throw e;
-    } catch (std::exception& e) {
-        // In case of an exception properly close the file before passing exception.
-        storm::utility::closeFile(inputFileStream);
-        throw e;
-    }
-
-    // Close the stream in case everything went smoothly and return result.
-    storm::utility::closeFile(inputFileStream);
-    return result;
+    // Reading the mapped file as a whole is much faster than reading the stream character-wise, which matters for large (generated) programs.
+    MappedFile file(filename.c_str());
+    return parseFromString(std::string(file.getData(), file.getDataSize()), filename, prismCompatibility);
 }
 
 storm::prism::Program PrismParserGrammar::parseFromString(std::string const& input, std::string const& filename, bool prismCompatibility) {
@@ -0,0 +1,97 @@
+#include "storm-parsers/parser/SparseTransitionReader.h"
+
+#include <algorithm>
+#include <vector>
+
+#include "storm-parsers/util/cstring.h"
+#include "storm/adapters/IntelTbbAdapter.h"
+
+namespace storm {
+namespace parser {
+
+using namespace storm::utility::cstring;
+
+SparseTransitionReader::SparseTransitionReader(MappedFile const& file, bool nondeterministic, uint64_t numberOfThreads, uint64_t bytesPerChunk)
+    : begin(file.getData()),
+      end(file.getDataEnd()),
+      nondeterministic(nondeterministic),
+      numberOfThreads(std::max<uint64_t>(numberOfThreads, 1)),
+      bytesPerChunk(std::max<uint64_t>(bytesPerChunk, 1)) {
+    // Skip the format hint if it is there.
+    begin = trimWhitespaces(begin);
+    if (begin < end && (begin[0] < '0' || begin[0] > '9')) {
+        begin = forwardToLineEnd(begin);
+        begin = trimWhitespaces(begin);
+    }
+}
+
+void SparseTransitionReader::forEachLine(std::function<void(TransitionLine const&)> const& callback) const {
+#ifdef STORM_HAVE_INTELTBB
+    if (numberOfThreads > 1) {
+        // Parse rounds of chunks concurrently. The lines of a round are passed on before the next round is parsed, which bounds the memory consumption.
+        uint64_t const chunksPerRound = numberOfThreads * 4;
+        std::vector<std::vector<TransitionLine>> chunkLines(chunksPerRound);
+        std::vector<char const*> chunkBegins;
+        tbb::task_arena arena(numberOfThreads);
+        char const* roundBegin = begin;
+        while (roundBegin < end) {
+            // Split the next part of the file at line ends.
+            chunkBegins = {roundBegin};
+            while (chunkBegins.size() <= chunksPerRound && chunkBegins.back() < end) {
+                char const* chunkEnd = chunkBegins.back() + std::min<uint64_t>(bytesPerChunk, end - chunkBegins.back());
+                chunkEnd = std::find(chunkEnd, end, '\n');
+                chunkBegins.push_back(chunkEnd == end ? end : chunkEnd + 1);
+            }
+            uint64_t nrChunks = chunkBegins.size() - 1;
+
+            arena.execute([&]() {
+                tbb::parallel_for(tbb::blocked_range<uint64_t>(0, nrChunks, 1), [&](tbb::blocked_range<uint64_t> const& range) {
+                    for (uint64_t chunk = range.begin(); chunk < range.end(); ++chunk) {
+                        std::vector<TransitionLine>& lines = chunkLines[chunk];
+                        lines.clear();
+                        parseChunk(chunkBegins[chunk], chunkBegins[chunk + 1], [&lines](TransitionLine const& line) { lines.push_back(line); });
+                    }
+                });
+            });
+
+            for (uint64_t chunk = 0; chunk < nrChunks; ++chunk) {
+                for (auto const& line : chunkLines[chunk]) {
+                    callback(line);
+                }
+            }
+            roundBegin = chunkBegins.back();
+        }
+        return;
+    }
+#endif
+    parseChunk(begin, end, callback);
+}
+
+uint64_t SparseTransitionReader::estimateNumberOfLines() const {
+    // Lines typically have about 16 (deterministic) or 20 (nondeterministic) characters.
+    return (end - begin) / (nondeterministic ? 20 : 16) + 1;
+}
+
+void SparseTransitionReader::parseChunk(char const* chunkBegin, char const* chunkEnd, std::function<void(TransitionLine const&)> const& callback) const {
+    char const* buf = trimWhitespaces(chunkBegin);
+    TransitionLine line;
+    while (buf < chunkEnd && buf[0] != '\0') {
+        line.source = checked_strtol(buf, &buf);
+        if (nondeterministic) {
+            line.choice = checked_strtol(buf, &buf);
+        }
+        line.target = checked_strtol(buf, &buf);
+        line.value = checked_strtod(buf, &buf);
+        callback(line);
+
+        if (nondeterministic) {
+            // The PRISM output format lists the name of the transition in the fourth column,
+            // but omits the fourth column if it is an internal action. In either case we can skip to the end of the line.
+            buf = forwardToLineEnd(buf);
+        }
+        buf = trimWhitespaces(buf);
+    }
+}
+
+}  // namespace parser
+}  // namespace storm
@@ -0,0 +1,70 @@
+#pragma once
+
+#include <cstdint>
+#include <functional>
+
+#include "storm-parsers/parser/MappedFile.h"
+
+namespace storm {
+namespace parser {
+
+/*!
+ * A single line of an explicit transition (reward) file.
+ */
+struct TransitionLine {
+    uint_fast64_t source = 0;
+    //! The choice of the source state (only given for nondeterministic models).
+    uint_fast64_t choice = 0;
+    uint_fast64_t target = 0;
+    double value = 0.0;
+};
+
+/*!
+ *	Reads the lines of an explicit transition (.tra) or transition reward (.trans.rew) file in a single pass over the mapped file.
+ *	Lines have the form "source target value" for deterministic models and "source choice target value [label]" for nondeterministic models.
+ *	A format hint in the first line is skipped.
+ *
+ *	If more than one thread is used, the file is split at line ends into chunks which are parsed concurrently.
+ *	The parsed lines are nevertheless handed over in the order of the file and only a bounded number of chunks is kept in memory.
+ */
+class SparseTransitionReader {
+   public:
+    /*!
+     * Creates a reader for the given file.
+     *
+     * @param file The mapped file.
+     * @param nondeterministic Flag indicating whether the lines contain a choice.
+     * @param numberOfThreads The number of threads used for parsing.
+     * @param bytesPerChunk The (approximate) size of the chunks parsed by one thread.
+     */
+    SparseTransitionReader(MappedFile const& file, bool nondeterministic, uint64_t numberOfThreads = 1, uint64_t bytesPerChunk = 1ull << 22);
+
+    /*!
+     * Parses all lines and calls the given function for each line in the order of the file.
+     *
+     * @param callback The function called for each line.
+     */
+    void forEachLine(std::function<void(TransitionLine const&)> const& callback) const;
+
+    /*!
+     * Returns an estimate of the number of lines based on the file size. The estimate can be used to reserve memory.
+     */
+    uint64_t estimateNumberOfLines() const;
+
+   private:
+    /*!
+     * Parses all lines starting in [chunkBegin, chunkEnd).
+     */
+    void parseChunk(char const* chunkBegin, char const* chunkEnd, std::function<void(TransitionLine const&)> const& callback) const;
+
+    // The beginning of the first line (after the format hint).
+    char const* begin;
+    // The end of the data.
+    char const* end;
+    bool nondeterministic;
+    uint64_t numberOfThreads;
+    uint64_t bytesPerChunk;
+};
+
+}  // namespace parser
+}  // namespace storm
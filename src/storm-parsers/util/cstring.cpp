@@ -1,5 +1,6 @@
 #include "storm-parsers/util/cstring.h"
 
+#include <charconv>
 #include <cstring>
 
 #include "storm/exceptions/WrongFormatException.h"
@@ -11,7 +12,7 @@ namespace utility {
 namespace cstring {
 
 /*!
- *	Calls strtol() internally and checks if the new pointer is different
+ *	Uses std::from_chars() for plain numbers and calls strtol() otherwise. Checks if the new pointer is different
  *	from the original one, i.e. if str != *end. If they are the same, a
  *	storm::exceptions::WrongFormatException will be thrown.
  *	@param str String to parse
@@ -19,7 +20,17 @@ namespace cstring {
  *	@return Result of strtol()
  */
 uint_fast64_t checked_strtol(char const* str, char const** end) {
-    uint_fast64_t res = strtol(str, const_cast<char**>(end), 10);
+    // Fast path for plain numbers. Everything else (e.g. signs) is handled by strtol().
+    char const* token = trimWhitespaces(str);
+    char const* tokenEnd = skipWord(token);
+    uint_fast64_t res;
+    auto [ptr, ec] = std::from_chars(token, tokenEnd, res);
+    if (ec == std::errc() && ptr == tokenEnd) {
+        *end = tokenEnd;
+        return res;
+    }
+
+    res = strtol(str, const_cast<char**>(end), 10);
     if (str == *end) {
         STORM_LOG_ERROR("Error while parsing integer. Next input token is not a number.");
         STORM_LOG_ERROR("\tUpcoming input is: \"" << std::string(str, 0, 16) << "\"");
@@ -29,7 +40,7 @@ uint_fast64_t checked_strtol(char const* str, char const** end) {
 }
 
 /*!
- *	Calls strtod() internally and checks if the new pointer is different
+ *	Uses std::from_chars() for plain numbers (if available) and calls strtod() otherwise. Checks if the new pointer is different
  *	from the original one, i.e. if str != *end. If they are the same, a
  *	storm::exceptions::WrongFormatException will be thrown.
  *	@param str String to parse
@@ -37,6 +48,18 @@ uint_fast64_t checked_strtol(char const* str, char const** end) {
  *	@return Result of strtod()
  */
 double checked_strtod(char const* str, char const** end) {
+#ifdef __cpp_lib_to_chars
+    // Fast path for plain numbers if the standard library supports parsing floating points. Everything else (e.g. signs) is handled by strtod().
+    char const* token = trimWhitespaces(str);
+    char const* tokenEnd = skipWord(token);
+    double fastRes;
+    auto [ptr, ec] = std::from_chars(token, tokenEnd, fastRes);
+    if (ec == std::errc() && ptr == tokenEnd) {
+        *end = tokenEnd;
+        return fastRes;
+    }
+#endif
+
     double res = strtod(str, const_cast<char**>(end));
     if (str == *end) {
         STORM_LOG_ERROR("Error while parsing floating point. Next input token is not a number.");
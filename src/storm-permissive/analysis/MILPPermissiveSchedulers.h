@@ -26,6 +26,11 @@ class MilpPermissiveSchedulerComputation : public PermissiveSchedulerComputation
     std::unordered_map<uint_fast64_t, storm::expressions::Variable> mAlphaVariables;
     std::unordered_map<storm::storage::StateActionTarget, storm::expressions::Variable> mBetaVariables;
     std::unordered_map<uint_fast64_t, storm::expressions::Variable> mGammaVariables;
+    // Whether the variables and the constraints that do not depend on the bound have been created (and the penalties they were created for).
+    bool mMilpCreated = false;
+    PermissiveSchedulerPenalties mMilpPenalties;
+    // The multistrategy found in the last successful call, which serves as a start solution for the next call.
+    std::unordered_map<storm::storage::StateActionPair, bool> mPreviousMultistrategy;
 
    public:
     MilpPermissiveSchedulerComputation(storm::solver::LpSolver<double>& milpsolver, storm::models::sparse::Mdp<double, RM> const& mdp,
@@ -34,10 +39,19 @@ class MilpPermissiveSchedulerComputation : public PermissiveSchedulerComputation
 
     void calculatePermissiveScheduler(bool lowerBound, double boundary) override {
         createMILP(lowerBound, boundary, this->mPenalties);
+        // Warm-start the solver with the multistrategy of the previous call (which remains feasible if the bound got weaker).
+        for (auto const& entry : mPreviousMultistrategy) {
+            solver.setMipStart(multistrategyVariables.at(entry.first), entry.second ? 1.0 : 0.0);
+        }
         // STORM_LOG_DEBUG("Calling optimizer");
         solver.optimize();
         // STORM_LOG_DEBUG("Done optimizing.")
         mCalledOptimizer = true;
+        if (foundSolution()) {
+            for (auto const& entry : multistrategyVariables) {
+                mPreviousMultistrategy[entry.first] = solver.getBinaryValue(entry.second);
+            }
+        }
     }
 
     bool foundSolution() const override {
@@ -131,11 +145,9 @@ class MilpPermissiveSchedulerComputation : public PermissiveSchedulerComputation
     }
 
     /**
-     * Create constraints
+     * Create constraints that depend on the bound
      */
-    void createConstraints(bool lowerBound, double boundary, storm::storage::BitVector const& relevantStates) {
-        // (5) and (7) are omitted on purpose (-- we currenty do not support controllability of actions -- )
-
+    void createBoundConstraints(bool lowerBound, double boundary, storm::storage::BitVector const& relevantStates) {
         // (1)
         STORM_LOG_ASSERT(this->mdp.getInitialStates().getNumberOfSetBits() == 1, "No unique initial state.");
         uint_fast64_t initialStateIndex = this->mdp.getInitialStates().getNextSetIndex(0);
@@ -147,15 +159,7 @@ class MilpPermissiveSchedulerComputation : public PermissiveSchedulerComputation
         }
         for (uint_fast64_t s : relevantStates) {
             std::string stateString = std::to_string(s);
-            storm::expressions::Expression expr = solver.getConstant(0.0);
-            // (2)
-            for (uint_fast64_t a = 0; a < this->mdp.getNumberOfChoices(s); ++a) {
-                expr = expr + multistrategyVariables[storage::StateActionPair(s, a)];
-            }
-            solver.addConstraint("c2-" + stateString, solver.getConstant(1) <= expr);
-            // (5)
-            solver.addConstraint("c5-" + std::to_string(s), mProbVariables[s] <= mAlphaVariables[s]);
-
+            storm::expressions::Expression expr;
             // (3) For the relevant states.
             for (uint_fast64_t a = 0; a < this->mdp.getNumberOfChoices(s); ++a) {
                 std::string sastring(stateString + "_" + std::to_string(a));
@@ -175,6 +179,24 @@ class MilpPermissiveSchedulerComputation : public PermissiveSchedulerComputation
                                          mProbVariables[s] >= (solver.getConstant(1) - multistrategyVariables[storage::StateActionPair(s, a)]) + expr);
                 }
             }
+        }
+    }
+
+    /**
+     * Create constraints that do not depend on the bound
+     */
+    void createConstraints(storm::storage::BitVector const& relevantStates) {
+        // (5) and (7) are omitted on purpose (-- we currenty do not support controllability of actions -- )
+        for (uint_fast64_t s : relevantStates) {
+            std::string stateString = std::to_string(s);
+            storm::expressions::Expression expr = solver.getConstant(0.0);
+            // (2)
+            for (uint_fast64_t a = 0; a < this->mdp.getNumberOfChoices(s); ++a) {
+                expr = expr + multistrategyVariables[storage::StateActionPair(s, a)];
+            }
+            solver.addConstraint("c2-" + stateString, solver.getConstant(1) <= expr);
+            // (5)
+            solver.addConstraint("c5-" + std::to_string(s), mProbVariables[s] <= mAlphaVariables[s]);
 
             for (uint_fast64_t a = 0; a < this->mdp.getNumberOfChoices(s); ++a) {
                 // (6)
@@ -208,16 +230,40 @@ class MilpPermissiveSchedulerComputation : public PermissiveSchedulerComputation
     }
 
     /**
-     *
+     * Creates the MILP for the given bound. The variables and the constraints that do not depend on the bound are only created once (per penalties)
+     * and kept in the solver, such that subsequent calls only replace the constraints that depend on the bound.
      */
     void createMILP(bool lowerBound, double boundary, PermissiveSchedulerPenalties const& penalties) {
         storm::storage::BitVector irrelevant = this->mGoals | this->mSinks;
         storm::storage::BitVector relevantStates = ~irrelevant;
-        // Notice that the separated construction of variables and
-        // constraints slows down the construction of the MILP.
-        // In the future, we might want to merge this.
-        createVariables(penalties, relevantStates);
-        createConstraints(lowerBound, boundary, relevantStates);
+        if (mMilpCreated) {
+            // Remove the constraints for the previous bound.
+            solver.pop();
+            if (!(mMilpPenalties == penalties)) {
+                // The penalties appear in the objective, so everything needs to be rebuilt.
+                solver.pop();
+                multistrategyVariables.clear();
+                mProbVariables.clear();
+                mAlphaVariables.clear();
+                mBetaVariables.clear();
+                mGammaVariables.clear();
+                mPreviousMultistrategy.clear();
+                mMilpCreated = false;
+            }
+        }
+        if (!mMilpCreated) {
+            solver.push();
+            // Notice that the separated construction of variables and
+            // constraints slows down the construction of the MILP.
+            // In the future, we might want to merge this.
+            createVariables(penalties, relevantStates);
+            createConstraints(relevantStates);
+            mMilpPenalties = penalties;
+            mMilpCreated = true;
+        }
+        solver.push();
+        createBoundConstraints(lowerBound, boundary, relevantStates);
+        solver.update();
 
         solver.setOptimizationDirection(storm::OptimizationDirection::Minimize);
     }
@@ -39,6 +39,10 @@ class PermissiveSchedulerPenalties {
     void clear() {
         mPenalties.clear();
     }
+
+    bool operator==(PermissiveSchedulerPenalties const& other) const {
+        return mPenalties == other.mPenalties;
+    }
 };
 }  // namespace ps
 }  // namespace storm
@@ -5,6 +5,7 @@
 #include "storm/settings/SettingMemento.h"
 
 #include "storm-pomdp/modelchecker/BeliefExplorationPomdpModelCheckerOptions.h"
+#include "storm-pomdp/storage/PreprocessingPomdpValueBoundsCache.h"
 #include "storm/adapters/RationalNumberAdapter.h"
 #include "storm/utility/NumberTraits.h"
 
@@ -27,6 +28,9 @@ const std::string triangulationModeOption = "triangulationmode";
 const std::string clippingOption = "use-clipping";
 const std::string cutZeroGapOption = "cut-zero-gap";
 const std::string stateEliminationCutoffOption = "state-elimination-cutoff";
+const std::string evictBeliefsOption = "evict-beliefs";
+const std::string denseValueIterationOption = "dense-vi";
+const std::string valueBoundsCacheOption = "bounds-cache";
 
 BeliefExplorationSettings::BeliefExplorationSettings() : ModuleSettings(moduleName) {
     this->addOption(
@@ -159,6 +163,21 @@ BeliefExplorationSettings::BeliefExplorationSettings() : ModuleSettings(moduleNa
     this->addOption(storm::settings::OptionBuilder(moduleName, stateEliminationCutoffOption, false,
                                                    "If this is set, an additional unfolding step for cut-off beliefs is performed.")
                         .build());
+    this->addOption(storm::settings::OptionBuilder(moduleName, evictBeliefsOption, false,
+                                                   "If this is set, the contents of explored beliefs are dropped and recomputed when needed again. "
+                                                   "This reduces memory consumption at the cost of additional computations.")
+                        .build());
+    this->addOption(storm::settings::OptionBuilder(moduleName, denseValueIterationOption, false,
+                                                   "If this is set, reachability probabilities of the explored belief MDPs are computed with a vectorized "
+                                                   "value iteration that stores the MDP in a dense block layout. Requires non-exact, non-sound computations.")
+                        .build());
+    this->addOption(storm::settings::OptionBuilder(moduleName, valueBoundsCacheOption, false,
+                                                   "If this is set, the value bounds computed in the preprocessing are cached in the given directory and "
+                                                   "reused for the same POMDP and property.")
+                        .setIsAdvanced()
+                        .addArgument(
+                            storm::settings::ArgumentBuilder::createStringArgument("dir", "The directory in which the value bounds are stored.").build())
+                        .build());
 }
 
 bool BeliefExplorationSettings::isRefineSet() const {
@@ -249,6 +268,22 @@ bool BeliefExplorationSettings::isCutZeroGapSet() const {
     return this->getOption(cutZeroGapOption).getHasOptionBeenSet();
 }
 
+bool BeliefExplorationSettings::isEvictExploredBeliefsSet() const {
+    return this->getOption(evictBeliefsOption).getHasOptionBeenSet();
+}
+
+bool BeliefExplorationSettings::isUseDenseValueIterationSet() const {
+    return this->getOption(denseValueIterationOption).getHasOptionBeenSet();
+}
+
+bool BeliefExplorationSettings::isValueBoundsCacheSet() const {
+    return this->getOption(valueBoundsCacheOption).getHasOptionBeenSet();
+}
+
+std::string BeliefExplorationSettings::getValueBoundsCacheDirectory() const {
+    return this->getOption(valueBoundsCacheOption).getArgumentByName("dir").getValueAsString();
+}
+
 template<typename ValueType>
 void BeliefExplorationSettings::setValuesInOptionsStruct(storm::pomdp::modelchecker::BeliefExplorationPomdpModelCheckerOptions<ValueType>& options) const {
     options.refine = isRefineSet();
@@ -282,6 +317,13 @@ void BeliefExplorationSettings::setValuesInOptionsStruct(storm::pomdp::modelchec
     }
     options.dynamicTriangulation = isDynamicTriangulationModeSet();
     options.cutZeroGap = isCutZeroGapSet();
+    options.evictExploredBeliefs = isEvictExploredBeliefsSet();
+    options.useDenseValueIteration = isUseDenseValueIterationSet();
+    if (isValueBoundsCacheSet()) {
+        // The cache is shared by all model checker invocations of this run
+        static auto valueBoundsCache = std::make_shared<storm::pomdp::storage::PreprocessingPomdpValueBoundsCache<ValueType>>(getValueBoundsCacheDirectory());
+        options.valueBoundsCache = valueBoundsCache;
+    }
 }
 
 template void BeliefExplorationSettings::setValuesInOptionsStruct<double>(
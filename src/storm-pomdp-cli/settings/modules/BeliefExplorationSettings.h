@@ -74,6 +74,16 @@ class BeliefExplorationSettings : public ModuleSettings {
 
     bool isStateEliminationCutoffSet() const;
 
+    /// Controls whether the contents of explored beliefs are dropped (and recomputed on demand) to save memory
+    bool isEvictExploredBeliefsSet() const;
+
+    /// Controls whether the explored belief MDPs are solved with the dense block value iteration
+    bool isUseDenseValueIterationSet() const;
+
+    /// Controls whether the value bounds of the preprocessing are cached (and in which directory)
+    bool isValueBoundsCacheSet() const;
+    std::string getValueBoundsCacheDirectory() const;
+
     template<typename ValueType>
     void setValuesInOptionsStruct(storm::pomdp::modelchecker::BeliefExplorationPomdpModelCheckerOptions<ValueType>& options) const;
 
@@ -15,9 +15,10 @@
 
 #include "storm-pomdp/analysis/FormulaInformation.h"
 #include "storm-pomdp/analysis/IterativePolicySearch.h"
-#include "storm-pomdp/analysis/JaniBeliefSupportMdpGenerator.h"
 #include "storm-pomdp/analysis/OneShotPolicySearch.h"
+#include "storm-pomdp/analysis/PolicySearchPortfolio.h"
 #include "storm-pomdp/analysis/QualitativeAnalysisOnGraphs.h"
+#include "storm-pomdp/analysis/SymbolicBeliefSupportMdpGenerator.h"
 #include "storm-pomdp/analysis/UniqueObservationStates.h"
 #include "storm-pomdp/modelchecker/BeliefExplorationPomdpModelChecker.h"
 #include "storm-pomdp/transformer/ApplyFiniteSchedulerToPomdp.h"
@@ -231,17 +232,45 @@ void performQualitativeAnalysis(std::shared_ptr<storm::models::sparse::Pomdp<Val
                 search.getStatistics().print();
             }
 
+        } else if (qualSettings.getMemlessSearchMethod() == "portfolio") {
+            auto configurations =
+                storm::pomdp::PolicySearchPortfolio<ValueType>::createDefaultConfigurations(fillMemlessSearchOptionsFromSettings(), lookahead);
+            storm::pomdp::PolicySearchPortfolio<ValueType> portfolio(pomdp, targetStates, surelyNotAlmostSurelyReachTarget, smtSolverFactory,
+                                                                     configurations);
+            if (qualSettings.isWinningRegionSet()) {
+                portfolio.computeWinningRegion();
+            } else if (portfolio.analyzeForInitialStates()) {
+                STORM_PRINT_AND_LOG("From initial state, one can almost-surely reach the target.\n");
+            } else {
+                STORM_PRINT_AND_LOG("From initial state, one may not almost-surely reach the target.\n");
+            }
+
+            if (qualSettings.isPrintWinningRegionSet()) {
+                portfolio.getLastWinningRegion().print();
+                std::cout << '\n';
+            }
+            if (qualSettings.isExportWinningRegionSet()) {
+                std::size_t hash = pomdp.hash();
+                portfolio.getLastWinningRegion().storeToFile(qualSettings.exportWinningRegionPath(), "model hash: " + std::to_string(hash));
+            }
+            if (coreSettings.isShowStatisticsSet()) {
+                STORM_PRINT_AND_LOG("#STATS Number of belief support states: " << portfolio.getLastWinningRegion().beliefSupportStates() << '\n');
+                if (portfolio.getConclusiveConfiguration()) {
+                    STORM_PRINT_AND_LOG("#STATS Conclusive configuration: " << portfolio.getConclusiveConfiguration().value() << '\n');
+                    portfolio.getStatistics(portfolio.getConclusiveConfiguration().value()).print();
+                }
+            }
         } else {
             STORM_LOG_ERROR("This method is not implemented.");
         }
     }
     if (qualSettings.isComputeOnBeliefSupportSet()) {
         computedSomething = true;
-        storm::pomdp::qualitative::JaniBeliefSupportMdpGenerator<ValueType> janicreator(pomdp);
-        janicreator.generate(targetStates, surelyNotAlmostSurelyReachTarget);
+        storm::pomdp::qualitative::SymbolicBeliefSupportMdpGenerator<ValueType> beliefSupportGenerator(pomdp);
+        beliefSupportGenerator.generate(targetStates, surelyNotAlmostSurelyReachTarget);
         bool initialOnly = !qualSettings.isWinningRegionSet();
-        janicreator.verifySymbolic(initialOnly);
-        STORM_PRINT_AND_LOG("Initial state is safe: " << janicreator.isInitialWinning() << "\n");
+        beliefSupportGenerator.verifySymbolic(initialOnly);
+        STORM_PRINT_AND_LOG("Initial state is safe: " << beliefSupportGenerator.isInitialWinning() << "\n");
     }
     STORM_LOG_THROW(computedSomething, storm::exceptions::InvalidSettingsException, "Nothing to be done, did you forget to set a method?");
 }
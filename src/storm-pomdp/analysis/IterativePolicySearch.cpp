@@ -376,6 +376,16 @@ bool IterativePolicySearch<ValueType>::analyze(uint64_t k, storm::storage::BitVe
     }
 
     stats.winningRegionUpdatesTimer.start();
+    if (sharedWinningRegion && sharedWinningRegion->mergeInto(winningRegion)) {
+        // Observations that other searches have found to be winning are treated as targets.
+        for (uint64_t observation = 0; observation < pomdp.getNrObservations(); ++observation) {
+            if (winningRegion.observationIsWinning(observation)) {
+                for (uint64_t state : statesPerObservation[observation]) {
+                    targetStates.set(state);
+                }
+            }
+        }
+    }
     storm::storage::BitVector updated(pomdp.getNrObservations());
     storm::storage::BitVector potentialWinner(pomdp.getNrObservations());
     storm::storage::BitVector observationsWithPartialWinners(pomdp.getNrObservations());
@@ -505,6 +515,9 @@ bool IterativePolicySearch<ValueType>::analyze(uint64_t k, storm::storage::BitVe
 
     bool foundWhatWeLookFor = false;
     while (true) {
+        if (isAborted()) {
+            return false;
+        }
         stats.incrementOuterIterations();
         // TODO consider what we really want to store about the schedulers.
         scheduler.reset(pomdp.getNrObservations(), maximalNrActions);
@@ -524,6 +537,9 @@ bool IterativePolicySearch<ValueType>::analyze(uint64_t k, storm::storage::BitVe
         }
         uint64_t localIterations = 0;
         while (true) {
+            if (isAborted()) {
+                return false;
+            }
             ++iterations;
             ++localIterations;
 
@@ -698,6 +714,9 @@ bool IterativePolicySearch<ValueType>::analyze(uint64_t k, storm::storage::BitVe
                 }
             }
         }
+        if (sharedWinningRegion) {
+            sharedWinningRegion->publish(winningRegion);
+        }
         stats.winningRegionUpdatesTimer.stop();
         if (foundWhatWeLookFor) {
             return true;
@@ -822,6 +841,9 @@ bool IterativePolicySearch<ValueType>::analyze(uint64_t k, storm::storage::BitVe
 
         STORM_LOG_INFO("... after iteration " << stats.getIterations() << " so far " << stats.getChecks() << " checks.");
     }
+    if (sharedWinningRegion) {
+        sharedWinningRegion->publish(winningRegion);
+    }
     if (options.validateResult) {
         STORM_LOG_WARN("Validating result is a winning region, only for debugging purposes.");
         validator->validate(surelyReachSinkStates);
@@ -877,6 +899,21 @@ typename IterativePolicySearch<ValueType>::Statistics const& IterativePolicySear
     return stats;
 }
 
+template<typename ValueType>
+void IterativePolicySearch<ValueType>::setSharedWinningRegion(std::shared_ptr<SharedWinningRegion> const& region) {
+    sharedWinningRegion = region;
+}
+
+template<typename ValueType>
+void IterativePolicySearch<ValueType>::setAbortFlag(std::shared_ptr<std::atomic<bool>> const& flag) {
+    abortFlag = flag;
+}
+
+template<typename ValueType>
+bool IterativePolicySearch<ValueType>::isAborted() const {
+    return abortFlag && abortFlag->load();
+}
+
 template<typename ValueType>
 bool IterativePolicySearch<ValueType>::smtCheck(uint64_t iteration, std::set<storm::expressions::Expression> const& assumptions) {
     if (options.isExportSATSet()) {
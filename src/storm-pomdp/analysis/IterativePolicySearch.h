@@ -1,3 +1,7 @@
+#pragma once
+
+#include <atomic>
+#include <memory>
 #include <sstream>
 #include <vector>
 #include "storm/exceptions/UnexpectedException.h"
@@ -14,7 +18,7 @@ namespace storm {
 namespace pomdp {
 
 enum class MemlessSearchPathVariables { BooleanRanking, IntegerRanking, RealRanking };
-MemlessSearchPathVariables pathVariableTypeFromString(std::string const& in) {
+inline MemlessSearchPathVariables pathVariableTypeFromString(std::string const& in) {
     if (in == "int") {
         return MemlessSearchPathVariables::IntegerRanking;
     } else if (in == "real") {
@@ -190,6 +194,23 @@ class IterativePolicySearch {
     Statistics const& getStatistics() const;
     void finalizeStatistics();
 
+    /*!
+     * Shares the winning region of this search with other searches on the same POMDP.
+     * The learned winning region is published to the shared region after each iteration and whenever the search is (re-)started, the shared region
+     * is added to the winning region of this search.
+     */
+    void setSharedWinningRegion(std::shared_ptr<SharedWinningRegion> const& region);
+
+    /*!
+     * Sets a flag that indicates that the search shall be aborted. The flag is checked between two SMT calls.
+     */
+    void setAbortFlag(std::shared_ptr<std::atomic<bool>> const& flag);
+
+    /*!
+     * @return true iff the search was aborted via the abort flag. The result of an aborted search is inconclusive.
+     */
+    bool isAborted() const;
+
    private:
     storm::expressions::Expression const& getDoneActionExpression(uint64_t obs) const;
 
@@ -245,6 +266,8 @@ class IterativePolicySearch {
 
     std::shared_ptr<storm::utility::solver::SmtSolverFactory>& smtSolverFactory;
     std::shared_ptr<WinningRegionQueryInterface<ValueType>> validator;
+    std::shared_ptr<SharedWinningRegion> sharedWinningRegion;
+    std::shared_ptr<std::atomic<bool>> abortFlag;
 
     mutable bool useFindOffset = false;
 };
@@ -0,0 +1,125 @@
+#include "storm-pomdp/analysis/PolicySearchPortfolio.h"
+
+#include <mutex>
+
+#include "storm/adapters/IntelTbbAdapter.h"
+#include "storm/adapters/RationalNumberAdapter.h"
+#include "storm/utility/macros.h"
+
+namespace storm {
+namespace pomdp {
+
+template<typename ValueType>
+PolicySearchPortfolio<ValueType>::PolicySearchPortfolio(storm::models::sparse::Pomdp<ValueType> const& pomdp, storm::storage::BitVector const& targetStates,
+                                                        storm::storage::BitVector const& surelyReachSinkStates,
+                                                        std::shared_ptr<storm::utility::solver::SmtSolverFactory>& smtSolverFactory,
+                                                        std::vector<Configuration> const& configurations)
+    : configurations(configurations), abortFlag(std::make_shared<std::atomic<bool>>(false)) {
+    STORM_LOG_THROW(!configurations.empty(), storm::exceptions::UnexpectedException, "A policy search portfolio needs at least one configuration.");
+    std::vector<uint64_t> observationSizes(pomdp.getNrObservations(), 0);
+    for (auto observation : pomdp.getObservations()) {
+        ++observationSizes[observation];
+    }
+    sharedWinningRegion = std::make_shared<SharedWinningRegion>(observationSizes);
+    winningRegion = WinningRegion(observationSizes);
+    for (auto const& configuration : configurations) {
+        // Each search creates its own expression manager and SMT solver, so that the searches can run concurrently.
+        searches.push_back(
+            std::make_unique<IterativePolicySearch<ValueType>>(pomdp, targetStates, surelyReachSinkStates, smtSolverFactory, configuration.options));
+        searches.back()->setSharedWinningRegion(sharedWinningRegion);
+        searches.back()->setAbortFlag(abortFlag);
+    }
+}
+
+template<typename ValueType>
+std::vector<typename PolicySearchPortfolio<ValueType>::Configuration> PolicySearchPortfolio<ValueType>::createDefaultConfigurations(
+    MemlessSearchOptions const& options, uint64_t lookahead) {
+    std::vector<Configuration> result;
+    // The given path variable type comes first so that it is preferred if the searches are executed sequentially.
+    result.push_back({lookahead, options});
+    for (auto pathVariableType :
+         {MemlessSearchPathVariables::RealRanking, MemlessSearchPathVariables::IntegerRanking, MemlessSearchPathVariables::BooleanRanking}) {
+        if (pathVariableType != options.pathVariableType) {
+            result.push_back({lookahead, options});
+            result.back().options.pathVariableType = pathVariableType;
+        }
+    }
+    // A shallow lookahead yields smaller encodings that are often sufficient to find a winning policy.
+    uint64_t const shallowLookahead = 10;
+    if (lookahead > shallowLookahead) {
+        result.push_back({shallowLookahead, options});
+        result.back().options.pathVariableType = MemlessSearchPathVariables::IntegerRanking;
+    }
+    return result;
+}
+
+template<typename ValueType>
+void PolicySearchPortfolio<ValueType>::run(bool onlyInitialStates) {
+    abortFlag->store(false);
+    conclusiveConfiguration = std::nullopt;
+    std::mutex resultMutex;
+
+    auto runSearch = [&](uint64_t index) {
+        if (abortFlag->load()) {
+            return;
+        }
+        bool conclusive = true;
+        if (onlyInitialStates) {
+            conclusive = searches[index]->analyzeForInitialStates(configurations[index].lookahead);
+        } else {
+            searches[index]->computeWinningRegion(configurations[index].lookahead);
+        }
+        std::lock_guard<std::mutex> lock(resultMutex);
+        if (conclusive && !searches[index]->isAborted() && !conclusiveConfiguration) {
+            STORM_LOG_INFO("Policy search with configuration " << index << " (lookahead " << configurations[index].lookahead << ") is conclusive.");
+            conclusiveConfiguration = index;
+            abortFlag->store(true);
+        }
+    };
+
+#ifdef STORM_HAVE_INTELTBB
+    tbb::parallel_for(tbb::blocked_range<uint64_t>(0, searches.size(), 1), [&](tbb::blocked_range<uint64_t> const& range) {
+        for (uint64_t index = range.begin(); index < range.end(); ++index) {
+            runSearch(index);
+        }
+    });
+#else
+    for (uint64_t index = 0; index < searches.size(); ++index) {
+        runSearch(index);
+    }
+#endif
+    winningRegion = sharedWinningRegion->getWinningRegion();
+}
+
+template<typename ValueType>
+bool PolicySearchPortfolio<ValueType>::analyzeForInitialStates() {
+    run(true);
+    return conclusiveConfiguration.has_value();
+}
+
+template<typename ValueType>
+void PolicySearchPortfolio<ValueType>::computeWinningRegion() {
+    run(false);
+}
+
+template<typename ValueType>
+WinningRegion const& PolicySearchPortfolio<ValueType>::getLastWinningRegion() const {
+    return winningRegion;
+}
+
+template<typename ValueType>
+std::optional<uint64_t> PolicySearchPortfolio<ValueType>::getConclusiveConfiguration() const {
+    return conclusiveConfiguration;
+}
+
+template<typename ValueType>
+typename IterativePolicySearch<ValueType>::Statistics const& PolicySearchPortfolio<ValueType>::getStatistics(uint64_t configuration) const {
+    STORM_LOG_ASSERT(configuration < searches.size(), "Invalid configuration index " << configuration << ".");
+    return searches[configuration]->getStatistics();
+}
+
+template class PolicySearchPortfolio<double>;
+template class PolicySearchPortfolio<storm::RationalNumber>;
+
+}  // namespace pomdp
+}  // namespace storm
@@ -0,0 +1,71 @@
+#pragma once
+
+#include <atomic>
+#include <memory>
+#include <optional>
+#include <vector>
+
+#include "storm-pomdp/analysis/IterativePolicySearch.h"
+#include "storm-pomdp/analysis/WinningRegion.h"
+
+namespace storm {
+namespace pomdp {
+
+/*!
+ * Runs several iterative policy searches with different lookahead depths and encodings concurrently (each with its own SMT solver).
+ * The searches share their learned winning regions and the portfolio stops as soon as one of the searches yields a conclusive answer.
+ * Without Intel TBB, the searches are executed one after another.
+ */
+template<typename ValueType>
+class PolicySearchPortfolio {
+   public:
+    struct Configuration {
+        uint64_t lookahead;
+        MemlessSearchOptions options;
+    };
+
+    PolicySearchPortfolio(storm::models::sparse::Pomdp<ValueType> const& pomdp, storm::storage::BitVector const& targetStates,
+                          storm::storage::BitVector const& surelyReachSinkStates, std::shared_ptr<storm::utility::solver::SmtSolverFactory>& smtSolverFactory,
+                          std::vector<Configuration> const& configurations);
+
+    /*!
+     * Creates configurations that use each of the path variable types with the given lookahead as well as a shallow lookahead with discrete rankings.
+     */
+    static std::vector<Configuration> createDefaultConfigurations(MemlessSearchOptions const& options, uint64_t lookahead);
+
+    /*!
+     * Checks whether the target can be reached almost-surely from the initial states.
+     * The answer is conclusive as soon as one search succeeds. Negative answers are only returned once all searches failed.
+     */
+    bool analyzeForInitialStates();
+
+    /*!
+     * Computes the winning region with all searches until the first one finishes. The result combines the winning regions of all searches.
+     */
+    void computeWinningRegion();
+
+    WinningRegion const& getLastWinningRegion() const;
+
+    /*!
+     * @return the index of the configuration whose search gave the conclusive answer (if any).
+     */
+    std::optional<uint64_t> getConclusiveConfiguration() const;
+
+    /*!
+     * @return the statistics of the search with the given configuration index.
+     */
+    typename IterativePolicySearch<ValueType>::Statistics const& getStatistics(uint64_t configuration) const;
+
+   private:
+    void run(bool onlyInitialStates);
+
+    std::vector<Configuration> configurations;
+    std::vector<std::unique_ptr<IterativePolicySearch<ValueType>>> searches;
+    std::shared_ptr<SharedWinningRegion> sharedWinningRegion;
+    std::shared_ptr<std::atomic<bool>> abortFlag;
+    std::optional<uint64_t> conclusiveConfiguration;
+    WinningRegion winningRegion;
+};
+
+}  // namespace pomdp
+}  // namespace storm
@@ -0,0 +1,200 @@
+#include "storm-pomdp/analysis/SymbolicBeliefSupportMdpGenerator.h"
+
+#include <algorithm>
+#include <map>
+
+#include "storm/storage/dd/Bdd.h"
+#include "storm/storage/dd/DdManager.h"
+#include "storm/utility/dd.h"
+#include "storm/utility/macros.h"
+
+namespace storm {
+namespace pomdp {
+namespace qualitative {
+
+template<typename ValueType>
+SymbolicBeliefSupportMdpGenerator<ValueType>::SymbolicBeliefSupportMdpGenerator(storm::models::sparse::Pomdp<ValueType> const& pomdp)
+    : pomdp(pomdp), manager(std::make_shared<storm::dd::DdManager<storm::dd::DdType::Sylvan>>()) {
+    // Intentionally left empty.
+}
+
+template<typename ValueType>
+void SymbolicBeliefSupportMdpGenerator<ValueType>::generate(storm::storage::BitVector const& targetStates, storm::storage::BitVector const& badStates) {
+    uint64_t const numberOfStates = pomdp.getNumberOfStates();
+    uint64_t const numberOfObservations = pomdp.getNrObservations();
+
+    // Gather the predecessors of every state and observation for each pair of (current) observation and action in a single pass.
+    typedef std::pair<uint64_t, uint64_t> ObsActPair;
+    std::map<ObsActPair, std::map<uint64_t, std::set<uint64_t>>> predecessorInfo;
+    std::map<ObsActPair, std::map<uint64_t, std::set<uint64_t>>> obsPredInfo;
+    std::vector<std::vector<uint64_t>> statesWithObservation(numberOfObservations);
+    uint64_t maxNumberOfChoices = 1;
+    for (uint64_t state = 0; state < numberOfStates; ++state) {
+        uint64_t curObs = pomdp.getObservation(state);
+        statesWithObservation[curObs].push_back(state);
+        maxNumberOfChoices = std::max<uint64_t>(maxNumberOfChoices, pomdp.getNumberOfChoices(state));
+        for (uint64_t act = 0; act < pomdp.getNumberOfChoices(state); ++act) {
+            ObsActPair oap(curObs, act);
+            auto& predecessors = predecessorInfo[oap];
+            auto& obsPredecessors = obsPredInfo[oap];
+            for (auto const& entry : pomdp.getTransitionMatrix().getRow(state, act)) {
+                predecessors[entry.getColumn()].insert(state);
+                obsPredecessors[pomdp.getObservation(entry.getColumn())].insert(state);
+            }
+        }
+    }
+
+    // Create one boolean variable per state whose value indicates whether the state is contained in the support.
+    std::vector<storm::dd::Bdd<storm::dd::DdType::Sylvan>> inSupportRow;
+    std::vector<storm::dd::Bdd<storm::dd::DdType::Sylvan>> inSupportColumn;
+    for (uint64_t state = 0; state < numberOfStates; ++state) {
+        auto variablePair = manager->addMetaVariable("s" + std::to_string(state));
+        rowVariables.insert(variablePair.first);
+        columnVariables.insert(variablePair.second);
+        rowColumnPairs.push_back(variablePair);
+        inSupportRow.push_back(manager->getEncoding(variablePair.first, 1));
+        inSupportColumn.push_back(manager->getEncoding(variablePair.second, 1));
+    }
+    actionVariable = manager->addMetaVariable("act", 0, std::max<uint64_t>(maxNumberOfChoices, 2) - 1).first;
+
+    // For each observation, the supports (on the row and column variables, respectively) that only contain states with this observation.
+    storm::dd::Bdd<storm::dd::DdType::Sylvan> emptyRow = manager->getBddOne();
+    storm::dd::Bdd<storm::dd::DdType::Sylvan> emptyColumn = manager->getBddOne();
+    for (uint64_t state = 0; state < numberOfStates; ++state) {
+        emptyRow &= !inSupportRow[state];
+        emptyColumn &= !inSupportColumn[state];
+    }
+    std::vector<storm::dd::Bdd<storm::dd::DdType::Sylvan>> onlyObservationRow;
+    std::vector<storm::dd::Bdd<storm::dd::DdType::Sylvan>> onlyObservationColumn;
+    for (uint64_t obs = 0; obs < numberOfObservations; ++obs) {
+        std::set<storm::expressions::Variable> observationRowVariables;
+        std::set<storm::expressions::Variable> observationColumnVariables;
+        for (auto const& state : statesWithObservation[obs]) {
+            observationRowVariables.insert(rowColumnPairs[state].first);
+            observationColumnVariables.insert(rowColumnPairs[state].second);
+        }
+        onlyObservationRow.push_back(emptyRow.existsAbstract(observationRowVariables));
+        onlyObservationColumn.push_back(emptyColumn.existsAbstract(observationColumnVariables));
+    }
+
+    transitionPartitions.assign(numberOfObservations, manager->getBddZero());
+    for (auto const& oapAndObsPredecessors : obsPredInfo) {
+        ObsActPair const& oap = oapAndObsPredecessors.first;
+        auto const& predecessors = predecessorInfo[oap];
+        storm::dd::Bdd<storm::dd::DdType::Sylvan> actionTransitions = manager->getBddZero();
+        for (auto const& obsAndPredStates : oapAndObsPredecessors.second) {
+            // The new observation is possible if the support contains one of the states that can reach it.
+            storm::dd::Bdd<storm::dd::DdType::Sylvan> guard = manager->getBddZero();
+            for (auto const& predState : obsAndPredStates.second) {
+                guard |= inSupportRow[predState];
+            }
+            // The new support contains exactly the states with the new observation that have a predecessor in the support.
+            storm::dd::Bdd<storm::dd::DdType::Sylvan> update = onlyObservationColumn[obsAndPredStates.first];
+            for (auto const& state : statesWithObservation[obsAndPredStates.first]) {
+                auto predecessorIt = predecessors.find(state);
+                if (predecessorIt == predecessors.end()) {
+                    update &= !inSupportColumn[state];
+                } else {
+                    storm::dd::Bdd<storm::dd::DdType::Sylvan> hasPredecessor = manager->getBddZero();
+                    for (auto const& predState : predecessorIt->second) {
+                        hasPredecessor |= inSupportRow[predState];
+                    }
+                    update &= inSupportColumn[state].iff(hasPredecessor);
+                }
+            }
+            actionTransitions |= guard && update;
+        }
+        transitionPartitions[oap.first] |= actionTransitions && manager->getEncoding(actionVariable, oap.second);
+    }
+    for (uint64_t obs = 0; obs < numberOfObservations; ++obs) {
+        transitionPartitions[obs] &= onlyObservationRow[obs];
+    }
+    // Observations without outgoing transitions do not need a part.
+    transitionPartitions.erase(std::remove_if(transitionPartitions.begin(), transitionPartitions.end(),
+                                              [](storm::dd::Bdd<storm::dd::DdType::Sylvan> const& part) { return part.isZero(); }),
+                               transitionPartitions.end());
+
+    initialSupport = manager->getBddOne();
+    for (uint64_t state = 0; state < numberOfStates; ++state) {
+        initialSupport &= pomdp.getInitialStates().get(state) ? inSupportRow[state] : !inSupportRow[state];
+    }
+    targetSupports = manager->getBddOne();
+    for (auto const& state : ~targetStates) {
+        targetSupports &= !inSupportRow[state];
+    }
+    badSupports = manager->getBddZero();
+    for (auto const& state : badStates) {
+        badSupports |= inSupportRow[state];
+    }
+    STORM_LOG_DEBUG("Built belief-support transition relation with " << transitionPartitions.size() << " observation parts.");
+}
+
+template<typename ValueType>
+storm::dd::Bdd<storm::dd::DdType::Sylvan> SymbolicBeliefSupportMdpGenerator<ValueType>::computeReachableSupports() const {
+    // The reachability analysis expects the parts to range over the row and column variables only.
+    std::vector<storm::dd::Bdd<storm::dd::DdType::Sylvan>> parts;
+    for (auto const& part : transitionPartitions) {
+        parts.push_back(part.existsAbstract({actionVariable}));
+    }
+    auto reachableAndIterations =
+        storm::utility::dd::computeReachableStates(initialSupport, parts, rowVariables, columnVariables, storm::builder::DdReachabilityStrategy::Chaining);
+    STORM_LOG_DEBUG("Reachability analysis of belief supports took " << reachableAndIterations.second << " iterations.");
+    return reachableAndIterations.first;
+}
+
+template<typename ValueType>
+storm::dd::Bdd<storm::dd::DdType::Sylvan> SymbolicBeliefSupportMdpGenerator<ValueType>::computeProb1E(
+    storm::dd::Bdd<storm::dd::DdType::Sylvan> const& phiSupports, storm::dd::Bdd<storm::dd::DdType::Sylvan> const& psiSupports) const {
+    std::set<storm::expressions::Variable> actionVariables = {actionVariable};
+    storm::dd::Bdd<storm::dd::DdType::Sylvan> candidates = phiSupports || psiSupports;
+    storm::dd::Bdd<storm::dd::DdType::Sylvan> previousCandidates = manager->getBddZero();
+    while (candidates != previousCandidates) {
+        // Only keep the choices that surely stay within the current candidates.
+        storm::dd::Bdd<storm::dd::DdType::Sylvan> candidatesColumn = candidates.swapVariables(rowColumnPairs);
+        std::vector<storm::dd::Bdd<storm::dd::DdType::Sylvan>> safeChoices;
+        for (auto const& part : transitionPartitions) {
+            safeChoices.push_back(part.existsAbstract(columnVariables) && !part.andExists(!candidatesColumn, columnVariables));
+        }
+
+        // Then compute the supports that can reach psi supports with positive probability using only these choices.
+        storm::dd::Bdd<storm::dd::DdType::Sylvan> winning = psiSupports;
+        storm::dd::Bdd<storm::dd::DdType::Sylvan> previousWinning = manager->getBddZero();
+        while (winning != previousWinning) {
+            previousWinning = winning;
+            storm::dd::Bdd<storm::dd::DdType::Sylvan> winningColumn = winning.swapVariables(rowColumnPairs);
+            for (uint64_t partIndex = 0; partIndex < transitionPartitions.size(); ++partIndex) {
+                storm::dd::Bdd<storm::dd::DdType::Sylvan> reachingChoices = transitionPartitions[partIndex].andExists(winningColumn, columnVariables);
+                winning |= phiSupports && safeChoices[partIndex].andExists(reachingChoices, actionVariables);
+            }
+        }
+        previousCandidates = candidates;
+        candidates = winning;
+    }
+    return candidates;
+}
+
+template<typename ValueType>
+void SymbolicBeliefSupportMdpGenerator<ValueType>::verifySymbolic(bool onlyInitial) {
+    storm::dd::Bdd<storm::dd::DdType::Sylvan> reachableSupports = computeReachableSupports();
+    STORM_LOG_INFO("Found " << reachableSupports.getNonZeroCount() << " reachable belief supports.");
+    storm::dd::Bdd<storm::dd::DdType::Sylvan> winningSupports =
+        computeProb1E(reachableSupports && !badSupports && !targetSupports, reachableSupports && targetSupports);
+    if (!onlyInitial) {
+        // TODO Export these results.
+        STORM_LOG_INFO("Found " << winningSupports.getNonZeroCount() << " winning belief supports.");
+    }
+    initialIsWinning = (initialSupport && !winningSupports).isZero();
+}
+
+template<typename ValueType>
+bool SymbolicBeliefSupportMdpGenerator<ValueType>::isInitialWinning() const {
+    return initialIsWinning;
+}
+
+template class SymbolicBeliefSupportMdpGenerator<double>;
+template class SymbolicBeliefSupportMdpGenerator<storm::RationalNumber>;
+template class SymbolicBeliefSupportMdpGenerator<storm::RationalFunction>;
+
+}  // namespace qualitative
+}  // namespace pomdp
+}  // namespace storm
@@ -0,0 +1,50 @@
+#pragma once
+#include <memory>
+#include <set>
+#include <vector>
+
+#include "storm/models/sparse/Pomdp.h"
+#include "storm/storage/dd/Bdd.h"
+#include "storm/storage/dd/DdManager.h"
+
+namespace storm {
+
+namespace pomdp {
+
+namespace qualitative {
+/*!
+ * Builds the belief-support MDP of a POMDP directly as a BDD over support bitvectors (one boolean variable per POMDP state) and checks
+ * whether the initial support almost-surely reaches a support within the target states while avoiding supports that contain bad states.
+ * The transition relation is partitioned according to the observation of the current support. Contrary to the JaniBeliefSupportMdpGenerator,
+ * no intermediate JANI model is created.
+ */
+template<typename ValueType>
+class SymbolicBeliefSupportMdpGenerator {
+   public:
+    SymbolicBeliefSupportMdpGenerator(storm::models::sparse::Pomdp<ValueType> const& pomdp);
+    void generate(storm::storage::BitVector const& targetStates, storm::storage::BitVector const& badStates);
+    void verifySymbolic(bool onlyInitial = true);
+    bool isInitialWinning() const;
+
+   private:
+    storm::dd::Bdd<storm::dd::DdType::Sylvan> computeReachableSupports() const;
+    storm::dd::Bdd<storm::dd::DdType::Sylvan> computeProb1E(storm::dd::Bdd<storm::dd::DdType::Sylvan> const& phiSupports,
+                                                            storm::dd::Bdd<storm::dd::DdType::Sylvan> const& psiSupports) const;
+
+    storm::models::sparse::Pomdp<ValueType> const& pomdp;
+    std::shared_ptr<storm::dd::DdManager<storm::dd::DdType::Sylvan>> manager;
+    std::set<storm::expressions::Variable> rowVariables;
+    std::set<storm::expressions::Variable> columnVariables;
+    std::vector<std::pair<storm::expressions::Variable, storm::expressions::Variable>> rowColumnPairs;
+    storm::expressions::Variable actionVariable;
+    // The transition relation (over row, column and action variables), one part per observation of the current support.
+    std::vector<storm::dd::Bdd<storm::dd::DdType::Sylvan>> transitionPartitions;
+    storm::dd::Bdd<storm::dd::DdType::Sylvan> initialSupport;
+    storm::dd::Bdd<storm::dd::DdType::Sylvan> targetSupports;
+    storm::dd::Bdd<storm::dd::DdType::Sylvan> badSupports;
+    bool initialIsWinning = false;
+};
+
+}  // namespace qualitative
+}  // namespace pomdp
+}  // namespace storm
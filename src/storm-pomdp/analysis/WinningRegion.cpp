@@ -66,6 +66,17 @@ bool WinningRegion::update(uint64_t observation, storm::storage::BitVector const
     return true;
 }
 
+bool WinningRegion::merge(WinningRegion const& other) {
+    assert(other.getNumberOfObservations() == getNumberOfObservations());
+    bool changed = false;
+    for (uint64_t observation = 0; observation < other.getNumberOfObservations(); ++observation) {
+        for (auto const& winning : other.getWinningSetsPerObservation(observation)) {
+            changed |= update(observation, winning);
+        }
+    }
+    return changed;
+}
+
 bool WinningRegion::query(uint64_t observation, storm::storage::BitVector const& currently) const {
     for (storm::storage::BitVector winning : winningRegion[observation]) {
         if (currently.isSubsetOf(winning)) {
@@ -379,5 +390,24 @@ std::pair<WinningRegion, std::string> WinningRegion::loadFromFile(std::string co
     return {wr, preamblestream.str()};
 }
 
+SharedWinningRegion::SharedWinningRegion(std::vector<uint64_t> const& observationSizes) : region(observationSizes) {
+    // Intentionally left empty.
+}
+
+void SharedWinningRegion::publish(WinningRegion const& other) {
+    std::lock_guard<std::mutex> lock(mutex);
+    region.merge(other);
+}
+
+bool SharedWinningRegion::mergeInto(WinningRegion& other) const {
+    std::lock_guard<std::mutex> lock(mutex);
+    return other.merge(region);
+}
+
+WinningRegion SharedWinningRegion::getWinningRegion() const {
+    std::lock_guard<std::mutex> lock(mutex);
+    return region;
+}
+
 }  // namespace pomdp
 }  // namespace storm
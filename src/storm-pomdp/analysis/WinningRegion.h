@@ -1,6 +1,7 @@
 #pragma once
 
 #include <cassert>
+#include <mutex>
 #include <vector>
 #include "storm/adapters/RationalNumberForward.h"
 #include "storm/storage/BitVector.h"
@@ -15,6 +16,8 @@ class WinningRegion {
     WinningRegion(std::vector<uint64_t> const& observationSizes = {});
 
     bool update(uint64_t observation, storm::storage::BitVector const& winning);
+    /// Adds all winning sets of the given region (over the same observations). Returns true iff this region changed.
+    bool merge(WinningRegion const& other);
     bool query(uint64_t observation, storm::storage::BitVector const& currently) const;
     bool isWinning(uint64_t observation, uint64_t offset) const {
         assert(observation < observationSizes.size());
@@ -47,5 +50,24 @@ class WinningRegion {
     std::vector<std::vector<storm::storage::BitVector>> winningRegion;
     std::vector<uint64_t> observationSizes;
 };
+
+/*!
+ * A winning region that can be accessed concurrently, e.g., to share the winning regions learned by several policy searches on the same POMDP.
+ */
+class SharedWinningRegion {
+   public:
+    SharedWinningRegion(std::vector<uint64_t> const& observationSizes);
+
+    /// Adds the given region to the shared region.
+    void publish(WinningRegion const& region);
+    /// Adds the shared region to the given region. Returns true iff the given region changed.
+    bool mergeInto(WinningRegion& region) const;
+    /// Returns a copy of the shared region.
+    WinningRegion getWinningRegion() const;
+
+   private:
+    mutable std::mutex mutex;
+    WinningRegion region;
+};
 }  // namespace pomdp
 }  // namespace storm
\ No newline at end of file
@@ -1,14 +1,20 @@
 #include "storm-pomdp/builder/BeliefMdpExplorer.h"
 
 #include "storm-parsers/api/properties.h"
+#include "storm-pomdp/solver/BeliefMdpValueIteration.h"
 #include "storm/api/properties.h"
 #include "storm/api/verification.h"
 
+#include "storm/environment/Environment.h"
+#include "storm/environment/solver/MinMaxSolverEnvironment.h"
+#include "storm/environment/solver/SolverEnvironment.h"
+
 #include "storm/modelchecker/hints/ExplicitModelCheckerHint.h"
 #include "storm/modelchecker/results/CheckResult.h"
 #include "storm/modelchecker/results/ExplicitQualitativeCheckResult.h"
 #include "storm/modelchecker/results/ExplicitQuantitativeCheckResult.h"
 #include "storm/models/sparse/Pomdp.h"
+#include "storm/storage/Scheduler.h"
 #include "storm/storage/SparseMatrix.h"
 #include "storm/utility/SignalHandler.h"
 #include "storm/utility/constants.h"
@@ -37,7 +43,11 @@ template<typename PomdpType, typename BeliefValueType>
 BeliefMdpExplorer<PomdpType, BeliefValueType>::BeliefMdpExplorer(std::shared_ptr<BeliefManagerType> beliefManager,
                                                                  storm::pomdp::storage::PreprocessingPomdpValueBounds<ValueType> const &pomdpValueBounds,
                                                                  ExplorationHeuristic explorationHeuristic)
-    : beliefManager(beliefManager), pomdpValueBounds(pomdpValueBounds), explHeuristic(explorationHeuristic), status(Status::Uninitialized) {
+    : beliefManager(beliefManager),
+      pomdpValueBounds(pomdpValueBounds),
+      useDenseValueIteration(false),
+      explHeuristic(explorationHeuristic),
+      status(Status::Uninitialized) {
     // Intentionally left empty
 }
 
@@ -63,6 +73,7 @@ void BeliefMdpExplorer<PomdpType, BeliefValueType>::startNewExploration(std::opt
     lowerValueBounds.clear();
     upperValueBounds.clear();
     values.clear();
+    choiceHints.clear();
     exploredMdpTransitions.clear();
     exploredChoiceIndices.clear();
     previousChoiceIndices.clear();
@@ -181,6 +192,7 @@ void BeliefMdpExplorer<PomdpType, BeliefValueType>::storeExplorationState() {
     explorationStorage.storedLowerValueBounds = std::vector<ValueType>(lowerValueBounds);
     explorationStorage.storedUpperValueBounds = std::vector<ValueType>(upperValueBounds);
     explorationStorage.storedValues = std::vector<ValueType>(values);
+    explorationStorage.storedChoiceHints = std::vector<uint64_t>(choiceHints);
 
     explorationStorage.storedTargetStates = storm::storage::BitVector(targetStates);
 }
@@ -205,6 +217,7 @@ void BeliefMdpExplorer<PomdpType, BeliefValueType>::restoreExplorationState() {
     lowerValueBounds = explorationStorage.storedLowerValueBounds;
     upperValueBounds = explorationStorage.storedUpperValueBounds;
     values = explorationStorage.storedValues;
+    choiceHints = explorationStorage.storedChoiceHints;
     status = Status::Exploring;
     targetStates = explorationStorage.storedTargetStates;
 
@@ -234,6 +247,19 @@ std::vector<uint64_t> BeliefMdpExplorer<PomdpType, BeliefValueType>::getUnexplor
     return res;
 }
 
+template<typename PomdpType, typename BeliefValueType>
+std::vector<typename BeliefMdpExplorer<PomdpType, BeliefValueType>::BeliefId> BeliefMdpExplorer<PomdpType, BeliefValueType>::getNextUnexploredBeliefs(
+    uint64_t maxNumberOfBeliefs) const {
+    STORM_LOG_ASSERT(status == Status::Exploring, "Method call is invalid in current status.");
+    std::vector<BeliefId> res;
+    res.reserve(std::min<uint64_t>(maxNumberOfBeliefs, mdpStatesToExplorePrioState.size()));
+    // exploreNextState always picks the last entry of the queue
+    for (auto stateIt = mdpStatesToExplorePrioState.rbegin(); stateIt != mdpStatesToExplorePrioState.rend() && res.size() < maxNumberOfBeliefs; ++stateIt) {
+        res.push_back(mdpStateToBeliefIdMap[stateIt->second]);
+    }
+    return res;
+}
+
 template<typename PomdpType, typename BeliefValueType>
 typename BeliefMdpExplorer<PomdpType, BeliefValueType>::BeliefId BeliefMdpExplorer<PomdpType, BeliefValueType>::exploreNextState() {
     STORM_LOG_ASSERT(status == Status::Exploring, "Method call is invalid in current status.");
@@ -241,6 +267,10 @@ typename BeliefMdpExplorer<PomdpType, BeliefValueType>::BeliefId BeliefMdpExplor
     if (currentMdpState != noState() && mdpStatesToExplorePrioState.rbegin()->second == exploredChoiceIndices.size()) {
         internalAddRowGroupIndex();
     }
+    // The content of the previously explored belief is only needed again if the belief is revisited.
+    if (currentMdpState != noState() && beliefManager->isBeliefEvictionEnabled()) {
+        beliefManager->evictBelief(getCurrentBeliefId());
+    }
 
     // Pop from the queue.
     currentMdpState = mdpStatesToExplorePrioState.rbegin()->second;
@@ -529,6 +559,10 @@ void BeliefMdpExplorer<PomdpType, BeliefValueType>::finishExploration() {
         mdpActionRewards.resize(getCurrentNumberOfMdpChoices(), storm::utility::zero<ValueType>());
     }
 
+    if (currentMdpState != noState() && beliefManager->isBeliefEvictionEnabled()) {
+        beliefManager->evictBelief(getCurrentBeliefId());
+    }
+
     // We are not exploring anymore
     currentMdpState = noState();
 
@@ -781,6 +815,7 @@ void BeliefMdpExplorer<PomdpType, BeliefValueType>::dropUnexploredStates() {
     storm::utility::vector::filterVectorInPlace(lowerValueBounds, relevantMdpStates);
     storm::utility::vector::filterVectorInPlace(upperValueBounds, relevantMdpStates);
     storm::utility::vector::filterVectorInPlace(values, relevantMdpStates);
+    storm::utility::vector::filterVectorInPlace(choiceHints, relevantMdpStates);
 
     {  // mdpStateToChoiceLabelsMap
         if (!mdpStateToChoiceLabelsMap.empty()) {
@@ -914,6 +949,23 @@ template<typename PomdpType, typename BeliefValueType>
 void BeliefMdpExplorer<PomdpType, BeliefValueType>::computeValuesOfExploredMdp(storm::Environment const &env, storm::solver::OptimizationDirection const &dir) {
     STORM_LOG_ASSERT(status == Status::ModelFinished, "Method call is invalid in current status.");
     STORM_LOG_ASSERT(exploredMdp, "Tried to compute values but the MDP is not explored");
+    if constexpr (std::is_same_v<ValueType, double>) {
+        if (useDenseValueIteration && !exploredMdp->hasRewardModel() && !env.solver().isForceSoundness() && !env.solver().isForceExact()) {
+            double const precision = storm::utility::convertNumber<double>(env.solver().minMax().getPrecision());
+            storm::pomdp::solver::BeliefMdpValueIteration solver(exploredMdp->getTransitionMatrix(), exploredMdp->getStates("target"));
+            values.assign(exploredMdp->getNumberOfStates(), storm::utility::zero<ValueType>());
+            solver.solve(dir, values, precision, env.solver().minMax().getRelativeTerminationCriterion(),
+                         env.solver().minMax().getMaximalNumberOfIterations());
+            choiceHints = solver.computeChoices(dir, values, precision);
+            scheduler = std::make_shared<storm::storage::Scheduler<ValueType>>(exploredMdp->getNumberOfStates());
+            for (uint64_t state = 0; state < choiceHints.size(); ++state) {
+                scheduler->setChoice(choiceHints[state], state);
+            }
+            status = Status::ModelChecked;
+            return;
+        }
+    }
+
     auto property = createStandardProperty(dir, exploredMdp->hasRewardModel());
     auto task = createStandardCheckTask(property);
 
@@ -921,6 +973,12 @@ void BeliefMdpExplorer<PomdpType, BeliefValueType>::computeValuesOfExploredMdp(s
     if (res) {
         values = std::move(res->asExplicitQuantitativeCheckResult<ValueType>().getValueVector());
         scheduler = std::make_shared<storm::storage::Scheduler<ValueType>>(res->asExplicitQuantitativeCheckResult<ValueType>().getScheduler());
+        choiceHints.assign(values.size(), 0);
+        for (uint64_t state = 0; state < values.size(); ++state) {
+            if (scheduler->getChoice(state).isDefined()) {
+                choiceHints[state] = scheduler->getChoice(state).getDeterministicChoice();
+            }
+        }
         STORM_LOG_WARN_COND_DEBUG(storm::utility::vector::compareElementWise(lowerValueBounds, values, std::less_equal<ValueType>()),
                                   "Computed values are smaller than the lower bound.");
         STORM_LOG_WARN_COND_DEBUG(storm::utility::vector::compareElementWise(upperValueBounds, values, std::greater_equal<ValueType>()),
@@ -932,6 +990,11 @@ void BeliefMdpExplorer<PomdpType, BeliefValueType>::computeValuesOfExploredMdp(s
     status = Status::ModelChecked;
 }
 
+template<typename PomdpType, typename BeliefValueType>
+void BeliefMdpExplorer<PomdpType, BeliefValueType>::setUseDenseValueIteration(bool value) {
+    useDenseValueIteration = value;
+}
+
 template<typename PomdpType, typename BeliefValueType>
 bool BeliefMdpExplorer<PomdpType, BeliefValueType>::hasComputedValues() const {
     return status == Status::ModelChecked;
@@ -1084,6 +1147,17 @@ BeliefMdpExplorer<PomdpType, BeliefValueType>::createStandardCheckTask(std::shar
     auto task = storm::api::createTask<ValueType>(property, false);
     auto hint = storm::modelchecker::ExplicitModelCheckerHint<ValueType>();
     hint.setResultHint(values);
+    if (!choiceHints.empty()) {
+        // Warm-start with the scheduler of the previous check. The states are only partly the same, so we make sure that the choices are valid.
+        // Without a scheduler hint, the value hint would also be ignored whenever the MDP has end components.
+        STORM_LOG_ASSERT(exploredMdp, "Expected an explored MDP.");
+        storm::storage::Scheduler<ValueType> schedulerHint(exploredMdp->getNumberOfStates());
+        for (uint64_t state = 0; state < exploredMdp->getNumberOfStates(); ++state) {
+            uint64_t choice = state < choiceHints.size() ? choiceHints[state] : 0;
+            schedulerHint.setChoice(choice < exploredMdp->getTransitionMatrix().getRowGroupSize(state) ? choice : 0, state);
+        }
+        hint.setSchedulerHint(std::move(schedulerHint));
+    }
     auto hintPtr = std::make_shared<storm::modelchecker::ExplicitModelCheckerHint<ValueType>>(hint);
     task.setHint(hintPtr);
     task.setProduceSchedulers();
@@ -1147,6 +1221,9 @@ void BeliefMdpExplorer<PomdpType, BeliefValueType>::insertValueHints(ValueType c
     upperValueBounds.push_back(upperBound);
     // Take the middle value as a hint
     values.push_back((lowerBound + upperBound) / storm::utility::convertNumber<ValueType, uint64_t>(2));
+    if (!choiceHints.empty()) {
+        choiceHints.push_back(0);
+    }
     STORM_LOG_ASSERT(lowerValueBounds.size() == getCurrentNumberOfMdpStates(), "Value vectors have different size then number of available states.");
     STORM_LOG_ASSERT(lowerValueBounds.size() == upperValueBounds.size() && values.size() == upperValueBounds.size(), "Value vectors have inconsistent size.");
 }
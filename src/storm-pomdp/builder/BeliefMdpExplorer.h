@@ -63,6 +63,12 @@ class BeliefMdpExplorer {
 
     std::vector<uint64_t> getUnexploredStates();
 
+    /*!
+     * Retrieves the beliefs of (at most) the given number of unexplored states in the order in which they are explored next,
+     * assuming that no further states are added to the exploration queue in the meantime.
+     */
+    std::vector<BeliefId> getNextUnexploredBeliefs(uint64_t maxNumberOfBeliefs) const;
+
     BeliefId exploreNextState();
 
     void addChoiceLabelToCurrentState(uint64_t const &localActionIndex, std::string const &label);
@@ -182,6 +188,12 @@ class BeliefMdpExplorer {
 
     void computeValuesOfExploredMdp(storm::Environment const &env, storm::solver::OptimizationDirection const &dir);
 
+    /*!
+     * Sets whether reachability probabilities of the explored MDP are computed with the dense block value iteration of BeliefMdpValueIteration
+     * instead of the generic MDP model checker. This is only done for non-exact value types and if the environment does not require sound results.
+     */
+    void setUseDenseValueIteration(bool value);
+
     bool hasComputedValues() const;
 
     bool hasFMSchedulerValues() const;
@@ -318,6 +330,10 @@ class BeliefMdpExplorer {
     std::optional<storm::storage::BitVector> optimalChoices;
     std::optional<storm::storage::BitVector> optimalChoicesReachableMdpStates;
     std::shared_ptr<storm::storage::Scheduler<ValueType>> scheduler;
+    // For each MDP state, the choice selected by the scheduler of the last check (or 0 for states that were added afterwards).
+    // These choices warm-start the solver when the MDP is checked again after a refinement step.
+    std::vector<uint64_t> choiceHints;
+    bool useDenseValueIteration;
 
     // The current status of this explorer
     ExplorationHeuristic explHeuristic;
@@ -342,6 +358,7 @@ class BeliefMdpExplorer {
         std::vector<ValueType> storedLowerValueBounds;
         std::vector<ValueType> storedUpperValueBounds;
         std::vector<ValueType> storedValues;
+        std::vector<uint64_t> storedChoiceHints;
         storm::storage::BitVector storedTargetStates;
     };
 
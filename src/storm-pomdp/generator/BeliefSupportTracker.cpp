@@ -4,7 +4,7 @@ namespace storm {
 namespace generator {
 template<typename ValueType>
 BeliefSupportTracker<ValueType>::BeliefSupportTracker(storm::models::sparse::Pomdp<ValueType> const& pomdp)
-    : pomdp(pomdp), currentBeliefSupport(pomdp.getInitialStates()) {}
+    : pomdp(pomdp), currentBeliefSupport(pomdp.getInitialStates()), nextBeliefSupport(pomdp.getNumberOfStates()) {}
 
 template<typename ValueType>
 storm::storage::BitVector const& BeliefSupportTracker<ValueType>::getCurrentBeliefSupport() const {
@@ -13,17 +13,18 @@ storm::storage::BitVector const& BeliefSupportTracker<ValueType>::getCurrentBeli
 
 template<typename ValueType>
 void BeliefSupportTracker<ValueType>::track(uint64_t action, uint64_t observation) {
-    storm::storage::BitVector newBeliefSupport(pomdp.getNumberOfStates());
+    nextBeliefSupport.clear();
     for (uint64_t oldState : currentBeliefSupport) {
         uint64_t row = pomdp.getTransitionMatrix().getRowGroupIndices()[oldState] + action;
         for (auto const& successor : pomdp.getTransitionMatrix().getRow(row)) {
             assert(!storm::utility::isZero(successor.getValue()));
             if (pomdp.getObservation(successor.getColumn()) == observation) {
-                newBeliefSupport.set(successor.getColumn(), true);
+                nextBeliefSupport.set(successor.getColumn(), true);
             }
         }
     }
-    currentBeliefSupport = newBeliefSupport;
+    // The buffers are swapped so that tracking does not allocate.
+    std::swap(currentBeliefSupport, nextBeliefSupport);
 }
 
 template<typename ValueType>
@@ -1,5 +1,8 @@
 
 #include "storm-pomdp/generator/NondeterministicBeliefTracker.h"
+
+#include <algorithm>
+
 #include "storm/storage/geometry/ReduceVertexCloud.h"
 #include "storm/storage/geometry/nativepolytopeconversion/QuickHull.h"
 #include "storm/utility/ConstantsComparator.h"
@@ -18,6 +21,8 @@ BeliefStateManager<ValueType>::BeliefStateManager(storm::models::sparse::Pomdp<V
         statePerObservationAndOffset[pomdp.getObservation(state)].push_back(state);
         observationOffsetId.push_back(statePerObservationAndOffset[pomdp.getObservation(state)].size() - 1);
     }
+    updateBuffer = std::vector<ValueType>(pomdp.getNumberOfStates(), storm::utility::zero<ValueType>());
+    updateBufferSupport = storm::storage::BitVector(pomdp.getNumberOfStates(), false);
 }
 
 template<typename ValueType>
@@ -75,6 +80,16 @@ uint64_t BeliefStateManager<ValueType>::getState(uint32_t obs, uint64_t offset)
     return statePerObservationAndOffset[obs][offset];
 }
 
+template<typename ValueType>
+std::vector<ValueType>& BeliefStateManager<ValueType>::getUpdateBuffer() {
+    return updateBuffer;
+}
+
+template<typename ValueType>
+storm::storage::BitVector& BeliefStateManager<ValueType>::getUpdateBufferSupport() {
+    return updateBufferSupport;
+}
+
 template<typename ValueType>
 SparseBeliefState<ValueType>::SparseBeliefState(std::shared_ptr<BeliefStateManager<ValueType>> const& manager, uint64_t state)
     : manager(manager), belief(), id(0), prevId(0) {
@@ -151,7 +166,67 @@ bool operator==(SparseBeliefState<ValueType> const& lhs, SparseBeliefState<Value
 
 template<typename ValueType>
 void SparseBeliefState<ValueType>::update(uint32_t newObservation, std::unordered_set<SparseBeliefState<ValueType>>& previousBeliefs) const {
-    updateHelper({{}}, {storm::utility::zero<ValueType>()}, belief.begin(), newObservation, previousBeliefs);
+    auto const& choiceIndices = manager->getPomdp().getNondeterministicChoiceIndices();
+    auto const& transitionMatrix = manager->getPomdp().getTransitionMatrix();
+
+    // Every state of the belief may choose any of its actions, so we enumerate all combinations of choices like a counter,
+    // where the digit of each state is its current choice. The successor belief of each combination is accumulated in the update buffer.
+    std::vector<uint64_t> beliefStates;
+    std::vector<ValueType> beliefValues;
+    beliefStates.reserve(belief.size());
+    beliefValues.reserve(belief.size());
+    for (auto const& entry : belief) {
+        beliefStates.push_back(entry.first);
+        beliefValues.push_back(entry.second);
+    }
+    std::vector<uint64_t> currentChoices(beliefStates.size(), 0);
+    std::vector<ValueType>& buffer = manager->getUpdateBuffer();
+    storm::storage::BitVector& bufferSupport = manager->getUpdateBufferSupport();
+    bool hasNextCombination = !beliefStates.empty();
+    while (hasNextCombination) {
+        ValueType sum = storm::utility::zero<ValueType>();
+        for (uint64_t i = 0; i < beliefStates.size(); ++i) {
+            for (auto const& transition : transitionMatrix.getRow(choiceIndices[beliefStates[i]] + currentChoices[i])) {
+                if (newObservation != manager->getPomdp().getObservation(transition.getColumn())) {
+                    continue;
+                }
+                ValueType probability = transition.getValue() * beliefValues[i];
+                buffer[transition.getColumn()] += probability;
+                bufferSupport.set(transition.getColumn(), true);
+                sum += probability;
+            }
+        }
+
+        if (!bufferSupport.empty()) {
+            std::size_t newHash = 0;
+            ValueType risk = storm::utility::zero<ValueType>();
+            std::map<uint64_t, ValueType> finalBelief;
+            for (auto state : bufferSupport) {
+                if (!storm::utility::isZero(sum)) {
+                    ValueType value = buffer[state] / sum;
+                    boost::hash_combine(newHash, state);
+                    risk += value * manager->getRisk(state);
+                    finalBelief.emplace_hint(finalBelief.end(), state, std::move(value));
+                }
+                buffer[state] = storm::utility::zero<ValueType>();
+            }
+            bufferSupport.clear();
+            if (!finalBelief.empty()) {
+                previousBeliefs.insert(SparseBeliefState<ValueType>(manager, finalBelief, newHash, risk, id));
+            }
+        }
+
+        // Move to the next combination of choices.
+        hasNextCombination = false;
+        for (uint64_t i = 0; i < beliefStates.size(); ++i) {
+            if (choiceIndices[beliefStates[i]] + currentChoices[i] + 1 < choiceIndices[beliefStates[i] + 1]) {
+                ++currentChoices[i];
+                hasNextCombination = true;
+                break;
+            }
+            currentChoices[i] = 0;
+        }
+    }
 }
 
 template<typename ValueType>
@@ -164,6 +239,27 @@ std::map<uint64_t, ValueType> const& SparseBeliefState<ValueType>::getBeliefMap(
     return belief;
 }
 
+template<typename ValueType>
+ValueType SparseBeliefState<ValueType>::distance(SparseBeliefState<ValueType> const& other) const {
+    ValueType result = storm::utility::zero<ValueType>();
+    auto lhsIt = belief.begin();
+    auto rhsIt = other.belief.begin();
+    while (lhsIt != belief.end() || rhsIt != other.belief.end()) {
+        if (rhsIt == other.belief.end() || (lhsIt != belief.end() && lhsIt->first < rhsIt->first)) {
+            result += storm::utility::abs<ValueType>(lhsIt->second);
+            ++lhsIt;
+        } else if (lhsIt == belief.end() || rhsIt->first < lhsIt->first) {
+            result += storm::utility::abs<ValueType>(rhsIt->second);
+            ++rhsIt;
+        } else {
+            result += storm::utility::abs<ValueType>(lhsIt->second - rhsIt->second);
+            ++lhsIt;
+            ++rhsIt;
+        }
+    }
+    return result;
+}
+
 template<typename ValueType>
 void SparseBeliefState<ValueType>::setSupport(storm::storage::BitVector& support) const {
     for (auto const& entry : belief) {
@@ -390,6 +486,7 @@ bool NondeterministicBeliefTracker<ValueType, BeliefState>::reset(uint32_t obser
         }
     }
     lastObservation = observation;
+    numberOfPrunedBeliefs = 0;
     return hit;
 }
 
@@ -404,11 +501,53 @@ bool NondeterministicBeliefTracker<ValueType, BeliefState>::track(uint64_t newOb
             return false;
         }
     }
-    beliefs = newBeliefs;
+    beliefs = std::move(newBeliefs);
     lastObservation = newObservation;
+    prune();
     return !beliefs.empty();
 }
 
+template<typename ValueType, typename BeliefState>
+void NondeterministicBeliefTracker<ValueType, BeliefState>::prune() {
+    bool const pruneSimilar = !storm::utility::isZero(options.pruningThreshold);
+    bool const pruneExcess = options.maxNumberOfBeliefs > 0 && beliefs.size() > options.maxNumberOfBeliefs;
+    if (!pruneSimilar && !pruneExcess) {
+        return;
+    }
+    // Consider the beliefs by descending risk such that a belief can only be pruned due to a kept belief with at least the same risk.
+    std::vector<typename std::unordered_set<BeliefState>::const_iterator> candidates;
+    candidates.reserve(beliefs.size());
+    for (auto it = beliefs.cbegin(); it != beliefs.cend(); ++it) {
+        candidates.push_back(it);
+    }
+    std::sort(candidates.begin(), candidates.end(), [](auto const& lhs, auto const& rhs) { return lhs->getRisk() > rhs->getRisk(); });
+
+    std::unordered_set<BeliefState> keptBeliefs;
+    std::vector<typename std::unordered_set<BeliefState>::const_iterator> keptCandidates;
+    for (auto const& candidate : candidates) {
+        if (options.maxNumberOfBeliefs > 0 && keptCandidates.size() == options.maxNumberOfBeliefs) {
+            break;
+        }
+        bool dominated = false;
+        if (pruneSimilar) {
+            for (auto const& kept : keptCandidates) {
+                if (candidate->distance(*kept) <= options.pruningThreshold) {
+                    dominated = true;
+                    break;
+                }
+            }
+        }
+        if (!dominated) {
+            keptCandidates.push_back(candidate);
+        }
+    }
+    for (auto const& kept : keptCandidates) {
+        keptBeliefs.insert(*kept);
+    }
+    numberOfPrunedBeliefs += beliefs.size() - keptBeliefs.size();
+    beliefs = std::move(keptBeliefs);
+}
+
 template<typename ValueType, typename BeliefState>
 ValueType NondeterministicBeliefTracker<ValueType, BeliefState>::getCurrentRisk(bool max) {
     STORM_LOG_THROW(!beliefs.empty(), storm::exceptions::InvalidOperationException, "Risk is only defined for beliefs (run reset() first).");
@@ -489,6 +628,11 @@ bool NondeterministicBeliefTracker<ValueType, BeliefState>::hasTimedOut() const
     return reductionTimedOut;
 }
 
+template<typename ValueType, typename BeliefState>
+uint64_t NondeterministicBeliefTracker<ValueType, BeliefState>::getNumberOfPrunedBeliefs() const {
+    return numberOfPrunedBeliefs;
+}
+
 template class SparseBeliefState<double>;
 template bool operator==(SparseBeliefState<double> const&, SparseBeliefState<double> const&);
 template class NondeterministicBeliefTracker<double, SparseBeliefState<double>>;
@@ -1,5 +1,6 @@
 #pragma once
 #include "storm/models/sparse/Pomdp.h"
+#include "storm/utility/constants.h"
 
 namespace storm {
 namespace generator {
@@ -21,6 +22,12 @@ class BeliefStateManager {
     uint64_t getState(uint32_t obs, uint64_t offset) const;
     uint64_t getNumberOfStates() const;
     uint64_t numberOfStatesPerObservation(uint32_t observation) const;
+    /**
+     * Provides a buffer with one entry per state that is reused by all belief updates to avoid allocations.
+     * Entries of states that are not in the support are zero. The buffer must be cleared after use.
+     */
+    std::vector<ValueType>& getUpdateBuffer();
+    storm::storage::BitVector& getUpdateBufferSupport();
 
    private:
     storm::models::sparse::Pomdp<ValueType> const& pomdp;
@@ -29,6 +36,8 @@ class BeliefStateManager {
     uint64_t beliefIdCounter = 0;
     std::vector<uint64_t> observationOffsetId;
     std::vector<std::vector<uint64_t>> statePerObservationAndOffset;
+    std::vector<ValueType> updateBuffer;
+    storm::storage::BitVector updateBufferSupport;
 };
 
 template<typename ValueType>
@@ -68,13 +77,14 @@ class SparseBeliefState {
     uint64_t getSupportSize() const;
     void setSupport(storm::storage::BitVector&) const;
     std::map<uint64_t, ValueType> const& getBeliefMap() const;
+    /**
+     * Get the L1-distance to the other belief
+     */
+    ValueType distance(SparseBeliefState<ValueType> const& other) const;
 
     friend bool operator== <>(SparseBeliefState<ValueType> const& lhs, SparseBeliefState<ValueType> const& rhs);
 
    private:
-    void updateHelper(std::vector<std::map<uint64_t, ValueType>> const& partialBeliefs, std::vector<ValueType> const& sums,
-                      typename std::map<uint64_t, ValueType>::const_iterator nextStateIt, uint32_t newObservation,
-                      std::unordered_set<SparseBeliefState<ValueType>>& previousBeliefs) const;
     SparseBeliefState(std::shared_ptr<BeliefStateManager<ValueType>> const& manager, std::map<uint64_t, ValueType> const& belief, std::size_t newHash,
                       ValueType const& risk, uint64_t prevId);
     std::shared_ptr<BeliefStateManager<ValueType>> manager;
@@ -136,6 +146,11 @@ class NondeterministicBeliefTracker {
         uint64_t trackTimeOut = 0;
         uint64_t timeOut = 0;  // for reduction, in milliseconds, 0 is no timeout
         ValueType wiggle;      // tolerance, anything above 0 means that we are incomplete.
+        // Beliefs whose (L1-)distance to a belief with at least the same risk is at most this threshold are pruned after each step.
+        // Anything above 0 means that we are incomplete.
+        ValueType pruningThreshold = storm::utility::zero<ValueType>();
+        // Bound on the number of beliefs that are kept after each step (the ones with the highest risk are kept), 0 is no bound.
+        uint64_t maxNumberOfBeliefs = 0;
     };
     NondeterministicBeliefTracker(storm::models::sparse::Pomdp<ValueType> const& pomdp,
                                   typename NondeterministicBeliefTracker<ValueType, BeliefState>::Options options = Options());
@@ -193,12 +208,24 @@ class NondeterministicBeliefTracker {
      * @return
      */
     bool hasTimedOut() const;
+    /**
+     * How many beliefs have been pruned (after the steps) since the last reset?
+     * If this is positive, the tracked beliefs may be incomplete.
+     * @return
+     */
+    uint64_t getNumberOfPrunedBeliefs() const;
 
    private:
+    /**
+     * Prunes the current beliefs according to the pruning threshold and the bound on the number of beliefs.
+     */
+    void prune();
+
     storm::models::sparse::Pomdp<ValueType> const& pomdp;
     std::shared_ptr<BeliefStateManager<ValueType>> manager;
     std::unordered_set<BeliefState> beliefs;
     bool reductionTimedOut = false;
+    uint64_t numberOfPrunedBeliefs = 0;
     Options options;
     uint32_t lastObservation;
 };
@@ -12,10 +12,12 @@
 
 #include "storm-pomdp/builder/BeliefMdpExplorer.h"
 #include "storm-pomdp/modelchecker/PreprocessingPomdpValueBoundsModelChecker.h"
+#include "storm-pomdp/storage/PreprocessingPomdpValueBoundsCache.h"
 #include "storm/models/sparse/Dtmc.h"
 #include "storm/utility/vector.h"
 
 #include "storm/environment/Environment.h"
+#include "storm/environment/solver/SolverEnvironment.h"
 #include "storm/exceptions/NotSupportedException.h"
 #include "storm/storage/Scheduler.h"
 #include "storm/utility/SignalHandler.h"
@@ -100,12 +102,34 @@ void BeliefExplorationPomdpModelChecker<PomdpModelType, BeliefValueType, BeliefM
     // Compute some initial bounds on the values for each state of the pomdp
     // We work with the Belief MDP value type, so if the POMDP is exact, but the belief MDP is not, we need to convert
     auto preProcessingMC = PreprocessingPomdpValueBoundsModelChecker<ValueType>(pomdp());
-    auto initialPomdpValueBounds = preProcessingMC.getValueBounds(preProcEnv, formula);
-    pomdpValueBounds.trivialPomdpValueBounds = initialPomdpValueBounds;
+    std::optional<typename PreprocessingPomdpValueBoundsModelChecker<ValueType>::ValueBounds> cachedValueBounds;
+    if (options.valueBoundsCache) {
+        cachedValueBounds = options.valueBoundsCache->getValueBounds(pomdp(), formula);
+    }
+    if (cachedValueBounds) {
+        STORM_LOG_INFO("Using cached value bounds for formula " << formula << ".");
+        pomdpValueBounds.trivialPomdpValueBounds = std::move(cachedValueBounds.value());
+    } else {
+        pomdpValueBounds.trivialPomdpValueBounds = preProcessingMC.getValueBounds(preProcEnv, formula);
+        if (options.valueBoundsCache) {
+            options.valueBoundsCache->storeValueBounds(pomdp(), formula, pomdpValueBounds.trivialPomdpValueBounds);
+        }
+    }
 
     // If we clip and compute rewards, compute the values necessary for the correction terms
     if (options.useClipping && formula.isRewardOperatorFormula()) {
-        pomdpValueBounds.extremePomdpValueBound = preProcessingMC.getExtremeValueBound(preProcEnv, formula);
+        std::optional<typename PreprocessingPomdpValueBoundsModelChecker<ValueType>::ExtremeValueBound> cachedExtremeValueBound;
+        if (options.valueBoundsCache) {
+            cachedExtremeValueBound = options.valueBoundsCache->getExtremeValueBound(pomdp(), formula);
+        }
+        if (cachedExtremeValueBound) {
+            pomdpValueBounds.extremePomdpValueBound = std::move(cachedExtremeValueBound.value());
+        } else {
+            pomdpValueBounds.extremePomdpValueBound = preProcessingMC.getExtremeValueBound(preProcEnv, formula);
+            if (options.valueBoundsCache) {
+                options.valueBoundsCache->storeExtremeValueBound(pomdp(), formula, pomdpValueBounds.extremePomdpValueBound);
+            }
+        }
     }
 }
 
@@ -323,10 +347,12 @@ void BeliefExplorationPomdpModelChecker<PomdpModelType, BeliefValueType, BeliefM
         overApproxBeliefManager = std::make_shared<BeliefManagerType>(
             pomdp(), storm::utility::convertNumber<BeliefValueType>(options.numericPrecision),
             options.dynamicTriangulation ? BeliefManagerType::TriangulationMode::Dynamic : BeliefManagerType::TriangulationMode::Static);
+        overApproxBeliefManager->setBeliefEviction(options.evictExploredBeliefs);
         if (rewardModelName) {
             overApproxBeliefManager->setRewardModel(rewardModelName);
         }
         overApproximation = std::make_shared<ExplorerType>(overApproxBeliefManager, trivialPOMDPBounds, storm::builder::ExplorationHeuristic::BreadthFirst);
+        overApproximation->setUseDenseValueIteration(options.useDenseValueIteration);
         overApproxHeuristicPar.gapThreshold = options.gapThresholdInit;
         overApproxHeuristicPar.observationThreshold = options.obsThresholdInit;
         overApproxHeuristicPar.sizeThreshold = options.sizeThresholdInit == 0 ? std::numeric_limits<uint64_t>::max() : options.sizeThresholdInit;
@@ -351,10 +377,12 @@ void BeliefExplorationPomdpModelChecker<PomdpModelType, BeliefValueType, BeliefM
         underApproxBeliefManager = std::make_shared<BeliefManagerType>(
             pomdp(), storm::utility::convertNumber<BeliefValueType>(options.numericPrecision),
             options.dynamicTriangulation ? BeliefManagerType::TriangulationMode::Dynamic : BeliefManagerType::TriangulationMode::Static);
+        underApproxBeliefManager->setBeliefEviction(options.evictExploredBeliefs);
         if (rewardModelName) {
             underApproxBeliefManager->setRewardModel(rewardModelName);
         }
         underApproximation = std::make_shared<ExplorerType>(underApproxBeliefManager, trivialPOMDPBounds, options.explorationHeuristic);
+        underApproximation->setUseDenseValueIteration(options.useDenseValueIteration);
         underApproxHeuristicPar.gapThreshold = options.gapThresholdInit;
         underApproxHeuristicPar.optimalChoiceValueEpsilon = options.optimalChoiceValueThresholdInit;
         underApproxHeuristicPar.sizeThreshold = options.sizeThresholdInit;
@@ -589,12 +617,14 @@ void BeliefExplorationPomdpModelChecker<PomdpModelType, BeliefValueType, BeliefM
     underApproxBeliefManager = std::make_shared<BeliefManagerType>(
         pomdp(), storm::utility::convertNumber<BeliefValueType>(options.numericPrecision),
         options.dynamicTriangulation ? BeliefManagerType::TriangulationMode::Dynamic : BeliefManagerType::TriangulationMode::Static);
+    underApproxBeliefManager->setBeliefEviction(options.evictExploredBeliefs);
     if (rewardModelName) {
         underApproxBeliefManager->setRewardModel(rewardModelName);
     }
 
     // set up belief MDP explorer
     interactiveUnderApproximationExplorer = std::make_shared<ExplorerType>(underApproxBeliefManager, trivialPOMDPBounds, options.explorationHeuristic);
+    interactiveUnderApproximationExplorer->setUseDenseValueIteration(options.useDenseValueIteration);
     underApproxHeuristicPar.gapThreshold = options.gapThresholdInit;
     underApproxHeuristicPar.optimalChoiceValueEpsilon = options.optimalChoiceValueThresholdInit;
     underApproxHeuristicPar.sizeThreshold = std::numeric_limits<uint64_t>::max() - 1;  // we don't set a size threshold
@@ -837,6 +867,9 @@ bool BeliefExplorationPomdpModelChecker<PomdpModelType, BeliefValueType, BeliefM
     bool timeLimitExceeded = false;
     std::map<uint32_t, typename ExplorerType::SuccessorObservationInformation> gatheredSuccessorObservations;  // Declare here to avoid reallocations
     uint64_t numRewiredOrExploredStates = 0;
+    // In batched mode, the successors of the next unexplored beliefs are triangulated concurrently. The resulting MDP does not depend on this.
+    bool const precomputeExpansions = env.solver().isUseIntelTbb() && options.parallelExpansionBatchSize > 1;
+    uint64_t numRemainingPrecomputedStates = 0;
     while (overApproximation->hasUnexploredState()) {
         if (!timeLimitExceeded && options.explorationTimeLimit != 0 &&
             static_cast<uint64_t>(explorationTime.getTimeInSeconds()) > options.explorationTimeLimit) {
@@ -846,6 +879,14 @@ bool BeliefExplorationPomdpModelChecker<PomdpModelType, BeliefValueType, BeliefM
             fixPoint = false;
         }
 
+        if (precomputeExpansions) {
+            if (numRemainingPrecomputedStates == 0) {
+                beliefManager->precomputeExpandAndTriangulate(overApproximation->getNextUnexploredBeliefs(options.parallelExpansionBatchSize),
+                                                              observationResolutionVector);
+                numRemainingPrecomputedStates = options.parallelExpansionBatchSize;
+            }
+            --numRemainingPrecomputedStates;
+        }
         uint64_t currId = overApproximation->exploreNextState();
         bool hasOldBehavior = refine && overApproximation->currentStateHasOldBehavior();
         if (!hasOldBehavior) {
@@ -1015,6 +1056,9 @@ bool BeliefExplorationPomdpModelChecker<PomdpModelType, BeliefValueType, BeliefM
             break;
         }
     }
+    if (precomputeExpansions) {
+        beliefManager->clearPrecomputedExpansions();
+    }
 
     if (storm::utility::resources::isTerminate()) {
         // don't overwrite statistics of a previous, successful computation
@@ -10,6 +10,10 @@ template<typename PomdpType, typename BeliefValueType>
 class BeliefMdpExplorer;
 }
 namespace pomdp {
+namespace storage {
+template<typename ValueType>
+class PreprocessingPomdpValueBoundsCache;
+}
 namespace modelchecker {
 template<typename ValueType>
 struct BeliefExplorationPomdpModelCheckerOptions {
@@ -55,6 +59,14 @@ struct BeliefExplorationPomdpModelCheckerOptions {
                                      ? storm::utility::zero<ValueType>()
                                      : storm::utility::convertNumber<ValueType>(1e-9);  /// Used to decide whether two beliefs are equal
     bool dynamicTriangulation = true;  // Sets whether the triangulation is done in a dynamic way (yielding more precise triangulations)
+    // If set, the contents of explored beliefs are dropped and recomputed on demand, which reduces memory consumption of large explorations
+    bool evictExploredBeliefs = false;
+    // If Intel TBB is enabled, the successors of this many unexplored beliefs are computed and triangulated concurrently during over-approximation
+    uint64_t parallelExpansionBatchSize = 256;
+    // If set, reachability probabilities of the explored MDPs are computed with a vectorized value iteration on a dense block layout (non-exact only)
+    bool useDenseValueIteration = false;
+    // If set, the value bounds of the preprocessing are taken from (and stored in) this cache, which can be shared by multiple model checker invocations
+    std::shared_ptr<storm::pomdp::storage::PreprocessingPomdpValueBoundsCache<ValueType>> valueBoundsCache;
 
     storm::builder::ExplorationHeuristic explorationHeuristic = storm::builder::ExplorationHeuristic::BreadthFirst;
 };
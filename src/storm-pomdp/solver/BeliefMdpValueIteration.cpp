@@ -0,0 +1,146 @@
+#include "storm-pomdp/solver/BeliefMdpValueIteration.h"
+
+#include <algorithm>
+#include <cmath>
+
+#include "storm/solver/helper/ValueIterationOperatorKernels.h"
+#include "storm/storage/SparseMatrix.h"
+#include "storm/utility/SignalHandler.h"
+#include "storm/utility/macros.h"
+
+namespace storm {
+namespace pomdp {
+namespace solver {
+
+using storm::solver::helper::kernels::BlockRowCount;
+
+BeliefMdpValueIteration::BeliefMdpValueIteration(storm::storage::SparseMatrix<double> const& transitions, storm::storage::BitVector const& targetStates)
+    : transitions(transitions), targetStates(targetStates) {
+    STORM_LOG_ASSERT(targetStates.size() == transitions.getRowGroupCount(), "Unexpected number of target states.");
+    uint64_t const numberOfRows = transitions.getRowCount();
+    uint64_t const numberOfBlocks = (numberOfRows + BlockRowCount - 1) / BlockRowCount;
+    auto const& rowGroupIndices = transitions.getRowGroupIndices();
+
+    // The rows of target states are treated as empty rows with offset one.
+    storm::storage::BitVector targetRows(numberOfRows, false);
+    for (auto state : targetStates) {
+        targetRows.setMultiple(rowGroupIndices[state], rowGroupIndices[state + 1] - rowGroupIndices[state]);
+    }
+    rowOffsets.assign(numberOfBlocks * BlockRowCount, 0.0);
+    for (auto row : targetRows) {
+        rowOffsets[row] = 1.0;
+    }
+
+    blockStarts.reserve(numberOfBlocks + 1);
+    blockStarts.push_back(0);
+    for (uint64_t blockStartRow = 0; blockStartRow < numberOfRows; blockStartRow += BlockRowCount) {
+        uint64_t const blockEndRow = std::min(blockStartRow + BlockRowCount, numberOfRows);
+        uint64_t blockLength = 0;
+        for (uint64_t row = blockStartRow; row < blockEndRow; ++row) {
+            if (!targetRows.get(row)) {
+                blockLength = std::max<uint64_t>(blockLength, transitions.getRow(row).getNumberOfEntries());
+            }
+        }
+        // Padding entries refer to the first column with value zero.
+        uint64_t const blockOffset = blockStarts.back() * BlockRowCount;
+        blockColumns.resize(blockOffset + blockLength * BlockRowCount, 0);
+        blockValues.resize(blockOffset + blockLength * BlockRowCount, 0.0);
+        for (uint64_t row = blockStartRow; row < blockEndRow; ++row) {
+            if (targetRows.get(row)) {
+                continue;
+            }
+            uint64_t position = blockOffset + (row - blockStartRow);
+            for (auto const& entry : transitions.getRow(row)) {
+                blockColumns[position] = entry.getColumn();
+                blockValues[position] = entry.getValue();
+                position += BlockRowCount;
+            }
+        }
+        blockStarts.push_back(blockStarts.back() + blockLength);
+    }
+}
+
+void BeliefMdpValueIteration::computeRowResults(std::vector<double> const& operand, std::vector<double>& rowResults) const {
+    rowResults = rowOffsets;
+    for (uint64_t block = 0; block + 1 < blockStarts.size(); ++block) {
+        uint64_t const blockOffset = blockStarts[block] * BlockRowCount;
+        storm::solver::helper::kernels::blockRowSums(blockColumns.data() + blockOffset, blockValues.data() + blockOffset,
+                                                     blockStarts[block + 1] - blockStarts[block], operand.data(), rowResults.data() + block * BlockRowCount);
+    }
+}
+
+bool BeliefMdpValueIteration::solve(storm::solver::OptimizationDirection dir, std::vector<double>& values, double precision, bool relative,
+                                    uint64_t maximalNumberOfIterations) const {
+    STORM_LOG_ASSERT(values.size() == transitions.getRowGroupCount(), "Unexpected number of initial values.");
+    auto const& rowGroupIndices = transitions.getRowGroupIndices();
+    bool const maximize = storm::solver::maximize(dir);
+    for (auto state : targetStates) {
+        values[state] = 1.0;
+    }
+
+    std::vector<double> rowResults;
+    std::vector<double> newValues(values.size());
+    uint64_t iterations = 0;
+    bool converged = false;
+    while (!converged && iterations < maximalNumberOfIterations && !storm::utility::resources::isTerminate()) {
+        computeRowResults(values, rowResults);
+        converged = true;
+        for (uint64_t state = 0; state < values.size(); ++state) {
+            double const* groupResults = rowResults.data() + rowGroupIndices[state];
+            uint64_t const groupSize = rowGroupIndices[state + 1] - rowGroupIndices[state];
+            newValues[state] =
+                maximize ? storm::solver::helper::kernels::maximum(groupResults, groupSize) : storm::solver::helper::kernels::minimum(groupResults, groupSize);
+            double const difference = std::abs(newValues[state] - values[state]);
+            converged &= relative ? difference <= precision * std::abs(newValues[state]) : difference <= precision;
+        }
+        values.swap(newValues);
+        ++iterations;
+    }
+    STORM_LOG_INFO("Dense belief MDP value iteration " << (converged ? "converged" : "did not converge") << " after " << iterations << " iterations.");
+    return converged;
+}
+
+std::vector<uint64_t> BeliefMdpValueIteration::computeChoices(storm::solver::OptimizationDirection dir, std::vector<double> const& values,
+                                                              double precision) const {
+    auto const& rowGroupIndices = transitions.getRowGroupIndices();
+    bool const maximize = storm::solver::maximize(dir);
+    std::vector<double> rowResults;
+    computeRowResults(values, rowResults);
+
+    std::vector<uint64_t> choices(values.size(), 0);
+    for (uint64_t state = 0; state < values.size(); ++state) {
+        auto groupBegin = rowResults.begin() + rowGroupIndices[state];
+        auto groupEnd = rowResults.begin() + rowGroupIndices[state + 1];
+        choices[state] = (maximize ? std::max_element(groupBegin, groupEnd) : std::min_element(groupBegin, groupEnd)) - groupBegin;
+    }
+    if (!maximize) {
+        return choices;
+    }
+
+    // Select optimal choices on paths towards the target states in a backwards search.
+    auto const backwardTransitions = transitions.transpose();
+    std::vector<uint64_t> rowGroupOfRow(transitions.getRowCount());
+    for (uint64_t state = 0; state < values.size(); ++state) {
+        std::fill(rowGroupOfRow.begin() + rowGroupIndices[state], rowGroupOfRow.begin() + rowGroupIndices[state + 1], state);
+    }
+    storm::storage::BitVector assignedStates = targetStates;
+    std::vector<uint64_t> stack(targetStates.begin(), targetStates.end());
+    while (!stack.empty()) {
+        uint64_t const state = stack.back();
+        stack.pop_back();
+        for (auto const& entry : backwardTransitions.getRow(state)) {
+            uint64_t const row = entry.getColumn();
+            uint64_t const predecessor = rowGroupOfRow[row];
+            if (!assignedStates.get(predecessor) && rowResults[row] >= values[predecessor] - precision) {
+                assignedStates.set(predecessor, true);
+                choices[predecessor] = row - rowGroupIndices[predecessor];
+                stack.push_back(predecessor);
+            }
+        }
+    }
+    return choices;
+}
+
+}  // namespace solver
+}  // namespace pomdp
+}  // namespace storm
@@ -0,0 +1,78 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include "storm/solver/OptimizationDirection.h"
+#include "storm/storage/BitVector.h"
+
+namespace storm {
+namespace storage {
+template<typename ValueType>
+class SparseMatrix;
+}  // namespace storage
+
+namespace pomdp {
+namespace solver {
+
+/*!
+ * Value iteration for reachability probabilities on the MDPs that are obtained by exploring the beliefs of a POMDP.
+ * The structure of such an MDP does not change while it is solved, so the matrix is brought into a dense block layout once: Consecutive rows are
+ * grouped into blocks of kernels::BlockRowCount rows that are stored interleaved and padded to the longest row of the block. Each iteration then computes
+ * the results of all rows of a block with a single vector kernel and obtains the value of each row group by a vectorized maximum (or minimum).
+ * The values of the target states are fixed to one. Starting from values below the optimal values, the iteration converges to the optimal values.
+ */
+class BeliefMdpValueIteration {
+   public:
+    /*!
+     * Prepares the value iteration for the given MDP.
+     * @param transitions The transition matrix of the MDP.
+     * @param targetStates The states whose value is one.
+     */
+    BeliefMdpValueIteration(storm::storage::SparseMatrix<double> const& transitions, storm::storage::BitVector const& targetStates);
+
+    /*!
+     * Performs value iteration until two subsequent iterations differ by at most the given precision.
+     * @param dir Whether the probabilities are maximized or minimized.
+     * @param values Initial values (one for each state) that need to be lower bounds for the optimal values. Is replaced by the result.
+     * @param precision The precision used to detect convergence.
+     * @param relative If true, the difference between two iterations is considered relative to the new value.
+     * @param maximalNumberOfIterations The iteration is stopped after this many iterations.
+     * @return true iff the iteration converged.
+     */
+    bool solve(storm::solver::OptimizationDirection dir, std::vector<double>& values, double precision, bool relative,
+               uint64_t maximalNumberOfIterations) const;
+
+    /*!
+     * Computes a scheduler that is optimal for the given values.
+     * When maximizing, the selected choices make progress towards the target states whenever the value is positive. Otherwise, states could select
+     * choices that stay forever in an end component without reaching a target state.
+     * @param dir Whether the probabilities are maximized or minimized.
+     * @param values The values obtained from solve.
+     * @param precision Choices whose value is at most the given precision away from the value of the state are considered optimal.
+     * @return for each state the local index of the selected choice.
+     */
+    std::vector<uint64_t> computeChoices(storm::solver::OptimizationDirection dir, std::vector<double> const& values, double precision) const;
+
+   private:
+    /*!
+     * Computes the results of all rows with respect to the given operand.
+     */
+    void computeRowResults(std::vector<double> const& operand, std::vector<double>& rowResults) const;
+
+    storm::storage::SparseMatrix<double> const& transitions;
+    storm::storage::BitVector targetStates;
+
+    // The interleaved columns and values of the blocks. The entries of the i-th block start at position kernels::BlockRowCount * blockStarts[i].
+    std::vector<uint64_t> blockColumns;
+    std::vector<double> blockValues;
+    std::vector<uint64_t> blockStarts;
+
+    // The results of the rows before multiplying with the operand, i.e., one for the rows of target states and zero otherwise.
+    // Has one entry for each row of each block (including the padding rows of the last block).
+    std::vector<double> rowOffsets;
+};
+
+}  // namespace solver
+}  // namespace pomdp
+}  // namespace storm
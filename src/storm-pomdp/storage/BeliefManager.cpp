@@ -1,14 +1,25 @@
 #include "storm-pomdp/storage/BeliefManager.h"
 
+#include <algorithm>
+
 #include "solver/GlpkLpSolver.h"
+#include "storm/adapters/IntelTbbAdapter.h"
 #include "storm/models/sparse/Pomdp.h"
 #include "storm/storage/expressions/Expression.h"
 #include "storm/storage/expressions/ExpressionManager.h"
+#include "storm/utility/NumberTraits.h"
 #include "storm/utility/macros.h"
 
 namespace storm {
 namespace storage {
 
+template<typename PomdpType, typename BeliefValueType, typename StateType>
+const uint64_t BeliefManager<PomdpType, BeliefValueType, StateType>::NO_INDEX = std::numeric_limits<uint64_t>::max();
+
+template<typename PomdpType, typename BeliefValueType, typename StateType>
+const typename BeliefManager<PomdpType, BeliefValueType, StateType>::BeliefId BeliefManager<PomdpType, BeliefValueType, StateType>::NO_ID =
+    std::numeric_limits<BeliefId>::max();
+
 template<typename PomdpType, typename BeliefValueType, typename StateType>
 uint64_t BeliefManager<PomdpType, BeliefValueType, StateType>::Triangulation::size() const {
     return weights.size();
@@ -77,15 +88,92 @@ std::size_t BeliefManager<storm::models::sparse::Pomdp<double>, double, uint64_t
     return seed;
 }
 
+template<typename PomdpType, typename BeliefValueType, typename StateType>
+std::size_t BeliefManager<PomdpType, BeliefValueType, StateType>::BeliefIdHash::operator()(BeliefId const &id) const {
+    return manager->beliefHashes[id];
+}
+
+template<typename PomdpType, typename BeliefValueType, typename StateType>
+bool BeliefManager<PomdpType, BeliefValueType, StateType>::BeliefIdEqualTo::operator()(BeliefId const &lhId, BeliefId const &rhId) const {
+    if (lhId == rhId) {
+        return true;
+    }
+    if (manager->beliefHashes[lhId] != manager->beliefHashes[rhId]) {
+        return false;
+    }
+    // Hash values match, so the contents are compared. Evicted beliefs are recomputed for this (but not restored).
+    if (manager->isEvicted(lhId) || manager->isEvicted(rhId)) {
+        return Belief_equal_to()(manager->recomputeBelief(lhId), manager->recomputeBelief(rhId));
+    }
+    return Belief_equal_to()(manager->beliefs[lhId], manager->beliefs[rhId]);
+}
+
 template<typename PomdpType, typename BeliefValueType, typename StateType>
 BeliefManager<PomdpType, BeliefValueType, StateType>::BeliefManager(PomdpType const &pomdp, BeliefValueType const &precision,
                                                                     TriangulationMode const &triangulationMode)
-    : pomdp(pomdp), triangulationMode(triangulationMode) {
+    : pomdp(pomdp), beliefEvictionEnabled(false), triangulationMode(triangulationMode) {
     cc = storm::utility::ConstantsComparator<BeliefValueType>(precision, false);
-    beliefToIdMap.resize(pomdp.getNrObservations());
+    beliefIdSets.reserve(pomdp.getNrObservations());
+    for (uint64_t observation = 0; observation < pomdp.getNrObservations(); ++observation) {
+        beliefIdSets.emplace_back(0, BeliefIdHash{this}, BeliefIdEqualTo{this});
+    }
+    prepareObservationActionTransitions();
     initialBeliefId = computeInitialBelief();
 }
 
+template<typename PomdpType, typename BeliefValueType, typename StateType>
+void BeliefManager<PomdpType, BeliefValueType, StateType>::prepareObservationActionTransitions() {
+    std::vector<std::vector<StateType>> observationStates(pomdp.getNrObservations());
+    localStateIndices.resize(pomdp.getNumberOfStates());
+    for (StateType state = 0; state < pomdp.getNumberOfStates(); ++state) {
+        auto &statesWithObservation = observationStates[pomdp.getObservation(state)];
+        localStateIndices[state] = statesWithObservation.size();
+        statesWithObservation.push_back(state);
+    }
+
+    auto const &transitionMatrix = pomdp.getTransitionMatrix();
+    auto successorLess = [this](StateType const &lhs, StateType const &rhs) {
+        return std::make_pair(pomdp.getObservation(lhs), lhs) < std::make_pair(pomdp.getObservation(rhs), rhs);
+    };
+    observationActionTransitions.resize(pomdp.getNrObservations());
+    for (uint32_t observation = 0; observation < pomdp.getNrObservations(); ++observation) {
+        auto const &states = observationStates[observation];
+        if (states.empty()) {
+            continue;
+        }
+        // All states with the same observation have the same number of choices.
+        uint64_t numActions = pomdp.getNumberOfChoices(states.front());
+        observationActionTransitions[observation].resize(numActions);
+        for (uint64_t action = 0; action < numActions; ++action) {
+            auto &transitions = observationActionTransitions[observation][action];
+            for (auto const &state : states) {
+                for (auto const &entry : transitionMatrix.getRow(state, action)) {
+                    transitions.columnStates.push_back(entry.getColumn());
+                }
+            }
+            std::sort(transitions.columnStates.begin(), transitions.columnStates.end(), successorLess);
+            transitions.columnStates.erase(std::unique(transitions.columnStates.begin(), transitions.columnStates.end()), transitions.columnStates.end());
+            transitions.columnObservations.reserve(transitions.columnStates.size());
+            for (auto const &successorState : transitions.columnStates) {
+                transitions.columnObservations.push_back(pomdp.getObservation(successorState));
+            }
+
+            transitions.rowIndications.reserve(states.size() + 1);
+            transitions.rowIndications.push_back(0);
+            for (auto const &state : states) {
+                for (auto const &entry : transitionMatrix.getRow(state, action)) {
+                    if (!storm::utility::isZero(entry.getValue())) {
+                        auto columnIt = std::lower_bound(transitions.columnStates.begin(), transitions.columnStates.end(), entry.getColumn(), successorLess);
+                        transitions.localColumns.push_back(std::distance(transitions.columnStates.begin(), columnIt));
+                        transitions.values.push_back(storm::utility::convertNumber<BeliefValueType>(entry.getValue()));
+                    }
+                }
+                transitions.rowIndications.push_back(transitions.localColumns.size());
+            }
+        }
+    }
+}
+
 template<typename PomdpType, typename BeliefValueType, typename StateType>
 void BeliefManager<PomdpType, BeliefValueType, StateType>::setRewardModel(std::optional<std::string> rewardModelName) {
     if (rewardModelName) {
@@ -177,24 +265,30 @@ typename BeliefManager<PomdpType, BeliefValueType, StateType>::ValueType BeliefM
 
 template<typename PomdpType, typename BeliefValueType, typename StateType>
 uint32_t BeliefManager<PomdpType, BeliefValueType, StateType>::getBeliefObservation(BeliefId beliefId) {
+    if (isEvicted(beliefId)) {
+        return beliefOrigins[beliefId].observation;
+    }
     return getBeliefObservation(getBelief(beliefId));
 }
 
 template<typename PomdpType, typename BeliefValueType, typename StateType>
 uint64_t BeliefManager<PomdpType, BeliefValueType, StateType>::getBeliefNumberOfChoices(BeliefId beliefId) {
-    auto const &belief = getBelief(beliefId);
-    return pomdp.getNumberOfChoices(belief.begin()->first);
+    // All states with the same observation have the same number of choices.
+    return observationActionTransitions[getBeliefObservation(beliefId)].size();
 }
 
 template<typename PomdpType, typename BeliefValueType, typename StateType>
 typename BeliefManager<PomdpType, BeliefValueType, StateType>::Triangulation BeliefManager<PomdpType, BeliefValueType, StateType>::triangulateBelief(
     BeliefId beliefId, BeliefValueType resolution) {
-    return triangulateBelief(getBelief(beliefId), resolution);
+    // Copy the belief as adding the grid points might invalidate references to the stored beliefs
+    BeliefType belief = getBelief(beliefId);
+    return triangulateBelief(belief, resolution, {beliefId, NO_INDEX, 0, NO_INDEX, resolution});
 }
 
 template<typename PomdpType, typename BeliefValueType, typename StateType>
 template<typename DistributionType>
-void BeliefManager<PomdpType, BeliefValueType, StateType>::addToDistribution(DistributionType &distr, StateType const &state, BeliefValueType const &value) {
+void BeliefManager<PomdpType, BeliefValueType, StateType>::addToDistribution(DistributionType &distr, StateType const &state,
+                                                                             BeliefValueType const &value) const {
     auto insertionRes = distr.emplace(state, value);
     if (!insertionRes.second) {
         insertionRes.first->second += value;
@@ -203,7 +297,7 @@ void BeliefManager<PomdpType, BeliefValueType, StateType>::addToDistribution(Dis
 
 template<typename PomdpType, typename BeliefValueType, typename StateType>
 template<typename DistributionType>
-void BeliefManager<PomdpType, BeliefValueType, StateType>::adjustDistribution(DistributionType &distr) {
+void BeliefManager<PomdpType, BeliefValueType, StateType>::adjustDistribution(DistributionType &distr) const {
     if (distr.size() == 1 && cc.isEqual(distr.begin()->second, storm::utility::one<BeliefValueType>())) {
         // If the distribution consists of only one entry and its value is sufficiently close to 1, make it exactly 1 to avoid numerical problems
         distr.begin()->second = storm::utility::one<BeliefValueType>();
@@ -231,6 +325,137 @@ BeliefManager<PomdpType, BeliefValueType, StateType>::expandAndTriangulate(Belie
     return expandInternal(beliefId, actionIndex, observationResolutions);
 }
 
+template<typename PomdpType, typename BeliefValueType, typename StateType>
+void BeliefManager<PomdpType, BeliefValueType, StateType>::precomputeExpandAndTriangulate(std::vector<BeliefId> const &beliefIds,
+                                                                                          std::vector<BeliefValueType> const &observationResolutions) {
+    precomputedExpansions.clear();
+    std::vector<std::pair<BeliefId, uint64_t>> beliefActionPairs;
+    for (auto const &beliefId : beliefIds) {
+        // Restore evicted beliefs now, as this modifies the stored beliefs.
+        getBelief(beliefId);
+        for (uint64_t action = 0, numActions = getBeliefNumberOfChoices(beliefId); action < numActions; ++action) {
+            beliefActionPairs.emplace_back(beliefId, action);
+        }
+    }
+
+    // (belief, action) pairs with the same observation and action are processed together in blocks of bounded size.
+    uint64_t const maxBlockSize = 64;
+    std::map<std::pair<uint32_t, uint64_t>, std::vector<uint64_t>> observationActionGroups;
+    for (uint64_t i = 0; i < beliefActionPairs.size(); ++i) {
+        observationActionGroups[std::make_pair(getBeliefObservation(beliefActionPairs[i].first), beliefActionPairs[i].second)].push_back(i);
+    }
+    std::vector<std::vector<uint64_t>> blocks;
+    for (auto const &group : observationActionGroups) {
+        for (auto blockStart = group.second.begin(); blockStart != group.second.end();) {
+            auto blockEnd = blockStart + std::min<uint64_t>(maxBlockSize, std::distance(blockStart, group.second.end()));
+            blocks.emplace_back(blockStart, blockEnd);
+            blockStart = blockEnd;
+        }
+    }
+
+    // Only read access to the stored beliefs is needed here, so the blocks can be processed concurrently.
+    std::vector<std::vector<PrecomputedSuccessor>> precomputedSuccessors(beliefActionPairs.size());
+    auto precompute = [&](uint64_t blockIndex) {
+        auto const &block = blocks[blockIndex];
+        std::vector<BeliefType const *> blockBeliefs;
+        blockBeliefs.reserve(block.size());
+        for (auto const &i : block) {
+            blockBeliefs.push_back(&getBelief(beliefActionPairs[i].first));
+        }
+        auto successors = computeSuccessorBeliefs(blockBeliefs, getBeliefObservation(*blockBeliefs.front()), beliefActionPairs[block.front()].second);
+        for (uint64_t j = 0; j < block.size(); ++j) {
+            for (auto &successor : successors[j]) {
+                uint32_t observation = getBeliefObservation(successor.first);
+                BeliefValueType const &resolution = observationResolutions[observation];
+                precomputedSuccessors[block[j]].push_back(
+                    {observation, std::move(successor.second), resolution, computeTriangulation(successor.first, resolution)});
+            }
+        }
+    };
+#ifdef STORM_HAVE_INTELTBB
+    tbb::parallel_for(tbb::blocked_range<uint64_t>(0, blocks.size()), [&](tbb::blocked_range<uint64_t> const &range) {
+        for (uint64_t blockIndex = range.begin(); blockIndex < range.end(); ++blockIndex) {
+            precompute(blockIndex);
+        }
+    });
+#else
+    for (uint64_t blockIndex = 0; blockIndex < blocks.size(); ++blockIndex) {
+        precompute(blockIndex);
+    }
+#endif
+
+    for (uint64_t i = 0; i < beliefActionPairs.size(); ++i) {
+        precomputedExpansions.emplace(beliefActionPairs[i], std::move(precomputedSuccessors[i]));
+    }
+}
+
+template<typename PomdpType, typename BeliefValueType, typename StateType>
+void BeliefManager<PomdpType, BeliefValueType, StateType>::clearPrecomputedExpansions() {
+    precomputedExpansions.clear();
+}
+
+template<typename PomdpType, typename BeliefValueType, typename StateType>
+void BeliefManager<PomdpType, BeliefValueType, StateType>::setBeliefEviction(bool enabled) {
+    beliefEvictionEnabled = enabled;
+    if (enabled) {
+        // Previously added beliefs can not be recomputed
+        beliefOrigins.reserve(beliefs.size());
+        for (BeliefId beliefId = beliefOrigins.size(); beliefId < beliefs.size(); ++beliefId) {
+            beliefOrigins.push_back({NO_ID, NO_INDEX, getBeliefObservation(beliefs[beliefId]), NO_INDEX, storm::utility::zero<BeliefValueType>()});
+        }
+    }
+}
+
+template<typename PomdpType, typename BeliefValueType, typename StateType>
+bool BeliefManager<PomdpType, BeliefValueType, StateType>::isBeliefEvictionEnabled() const {
+    return beliefEvictionEnabled;
+}
+
+template<typename PomdpType, typename BeliefValueType, typename StateType>
+void BeliefManager<PomdpType, BeliefValueType, StateType>::evictBelief(BeliefId const &beliefId) {
+    STORM_LOG_ASSERT(beliefId < getNumberOfBeliefIds(), "Belief index " << beliefId << " is out of range.");
+    if (beliefId >= beliefOrigins.size() || beliefOrigins[beliefId].source == NO_ID || isEvicted(beliefId)) {
+        return;
+    }
+    beliefs[beliefId] = BeliefType();
+    evictedBeliefs.grow(beliefId + 1, false);
+    evictedBeliefs.set(beliefId, true);
+}
+
+template<typename PomdpType, typename BeliefValueType, typename StateType>
+bool BeliefManager<PomdpType, BeliefValueType, StateType>::isEvicted(BeliefId const &beliefId) const {
+    return beliefId < evictedBeliefs.size() && evictedBeliefs.get(beliefId);
+}
+
+template<typename PomdpType, typename BeliefValueType, typename StateType>
+typename BeliefManager<PomdpType, BeliefValueType, StateType>::BeliefType BeliefManager<PomdpType, BeliefValueType, StateType>::recomputeBelief(
+    BeliefId const &beliefId) const {
+    // Walk back to the first belief whose content is available. Sources are always added before the beliefs obtained from them.
+    std::vector<BeliefId> evictedChain;
+    BeliefId currentId = beliefId;
+    while (isEvicted(currentId)) {
+        evictedChain.push_back(currentId);
+        currentId = beliefOrigins[currentId].source;
+    }
+    BeliefType belief = beliefs[currentId];
+
+    // Redo the computations along the chain. These are deterministic, so we obtain the same beliefs as before.
+    for (auto chainIt = evictedChain.rbegin(); chainIt != evictedChain.rend(); ++chainIt) {
+        auto const &origin = beliefOrigins[*chainIt];
+        if (origin.action != NO_INDEX) {
+            auto successors = computeSuccessorBeliefs(belief, origin.action);
+            auto successorIt = std::find_if(successors.begin(), successors.end(),
+                                            [this, &origin](auto const &successor) { return getBeliefObservation(successor.first) == origin.observation; });
+            STORM_LOG_ASSERT(successorIt != successors.end(), "Unable to recompute evicted belief " << *chainIt << ".");
+            belief = std::move(successorIt->first);
+        }
+        if (origin.gridPointIndex != NO_INDEX) {
+            belief = std::move(computeTriangulation(belief, origin.resolution).gridPoints[origin.gridPointIndex]);
+        }
+    }
+    return belief;
+}
+
 template<typename PomdpType, typename BeliefValueType, typename StateType>
 std::vector<std::pair<typename BeliefManager<PomdpType, BeliefValueType, StateType>::BeliefId,
                       typename BeliefManager<PomdpType, BeliefValueType, StateType>::ValueType>>
@@ -251,19 +476,13 @@ typename BeliefManager<PomdpType, BeliefValueType, StateType>::BeliefType const
     BeliefId const &id) const {
     STORM_LOG_ASSERT(id != noId(), "Tried to get a non-existent belief.");
     STORM_LOG_ASSERT(id < getNumberOfBeliefIds(), "Belief index " << id << " is out of range.");
+    if (isEvicted(id)) {
+        beliefs[id] = recomputeBelief(id);
+        evictedBeliefs.set(id, false);
+    }
     return beliefs[id];
 }
 
-template<typename PomdpType, typename BeliefValueType, typename StateType>
-typename BeliefManager<PomdpType, BeliefValueType, StateType>::BeliefId BeliefManager<PomdpType, BeliefValueType, StateType>::getId(
-    BeliefType const &belief) const {
-    uint32_t obs = getBeliefObservation(belief);
-    STORM_LOG_ASSERT(obs < beliefToIdMap.size(), "Belief has unknown observation.");
-    auto idIt = beliefToIdMap[obs].find(belief);
-    STORM_LOG_ASSERT(idIt != beliefToIdMap[obs].end(), "Unknown Belief.");
-    return idIt->second;
-}
-
 template<typename PomdpType, typename BeliefValueType, typename StateType>
 std::string BeliefManager<PomdpType, BeliefValueType, StateType>::toString(BeliefType const &belief) const {
     std::stringstream str;
@@ -386,14 +605,14 @@ bool BeliefManager<PomdpType, BeliefValueType, StateType>::assertTriangulation(B
 }
 
 template<typename PomdpType, typename BeliefValueType, typename StateType>
-uint32_t BeliefManager<PomdpType, BeliefValueType, StateType>::getBeliefObservation(BeliefType belief) const {
+uint32_t BeliefManager<PomdpType, BeliefValueType, StateType>::getBeliefObservation(BeliefType const &belief) const {
     STORM_LOG_ASSERT(assertBelief(belief), "Invalid belief.");
     return pomdp.getObservation(belief.begin()->first);
 }
 
 template<typename PomdpType, typename BeliefValueType, typename StateType>
 void BeliefManager<PomdpType, BeliefValueType, StateType>::triangulateBeliefFreudenthal(BeliefType const &belief, BeliefValueType const &resolution,
-                                                                                        Triangulation &result) {
+                                                                                        UnregisteredTriangulation &result) const {
     STORM_LOG_ASSERT(resolution != 0, "Invalid resolution: 0");
     STORM_LOG_ASSERT(storm::utility::isInteger(resolution), "Expected an integer resolution");
     StateType numEntries = belief.size();
@@ -442,7 +661,7 @@ void BeliefManager<PomdpType, BeliefValueType, StateType>::triangulateBeliefFreu
                     gridPoint[toOriginalIndicesMap[j]] = gridPointEntry / resolution;
                 }
             }
-            result.gridPoints.push_back(getOrAddBeliefId(gridPoint));
+            result.gridPoints.push_back(std::move(gridPoint));
         }
         previousSortedDiff = currentSortedDiff++;
     }
@@ -450,7 +669,7 @@ void BeliefManager<PomdpType, BeliefValueType, StateType>::triangulateBeliefFreu
 
 template<typename PomdpType, typename BeliefValueType, typename StateType>
 void BeliefManager<PomdpType, BeliefValueType, StateType>::triangulateBeliefDynamic(BeliefType const &belief, BeliefValueType const &resolution,
-                                                                                    Triangulation &result) {
+                                                                                    UnregisteredTriangulation &result) const {
     // Find the best resolution for this belief, i.e., N such that the largest distance between one of the belief values to a value in {i/N | 0 ≤ i ≤ N} is
     // minimal
     STORM_LOG_ASSERT(storm::utility::isInteger(resolution), "Expected an integer resolution");
@@ -488,14 +707,14 @@ void BeliefManager<PomdpType, BeliefValueType, StateType>::triangulateBeliefDyna
 }
 
 template<typename PomdpType, typename BeliefValueType, typename StateType>
-typename BeliefManager<PomdpType, BeliefValueType, StateType>::Triangulation BeliefManager<PomdpType, BeliefValueType, StateType>::triangulateBelief(
-    BeliefType const &belief, BeliefValueType const &resolution) {
+typename BeliefManager<PomdpType, BeliefValueType, StateType>::UnregisteredTriangulation
+BeliefManager<PomdpType, BeliefValueType, StateType>::computeTriangulation(BeliefType const &belief, BeliefValueType const &resolution) const {
     STORM_LOG_ASSERT(assertBelief(belief), "Input belief for triangulation is not valid.");
-    Triangulation result;
+    UnregisteredTriangulation result;
     // Quickly triangulate Dirac beliefs
     if (belief.size() == 1u) {
         result.weights.push_back(storm::utility::one<BeliefValueType>());
-        result.gridPoints.push_back(getOrAddBeliefId(belief));
+        result.gridPoints.push_back(belief);
     } else {
         auto ceiledResolution = storm::utility::ceil<BeliefValueType>(resolution);
         switch (triangulationMode) {
@@ -509,10 +728,118 @@ typename BeliefManager<PomdpType, BeliefValueType, StateType>::Triangulation Bel
                 STORM_LOG_ASSERT(false, "Invalid triangulation mode.");
         }
     }
+    return result;
+}
+
+template<typename PomdpType, typename BeliefValueType, typename StateType>
+typename BeliefManager<PomdpType, BeliefValueType, StateType>::Triangulation BeliefManager<PomdpType, BeliefValueType, StateType>::registerTriangulation(
+    UnregisteredTriangulation const &triangulation, BeliefOrigin origin) {
+    Triangulation result;
+    result.weights = triangulation.weights;
+    result.gridPoints.reserve(triangulation.gridPoints.size());
+    for (origin.gridPointIndex = 0; origin.gridPointIndex < triangulation.gridPoints.size(); ++origin.gridPointIndex) {
+        result.gridPoints.push_back(getOrAddBeliefId(triangulation.gridPoints[origin.gridPointIndex], origin));
+    }
+    return result;
+}
+
+template<typename PomdpType, typename BeliefValueType, typename StateType>
+typename BeliefManager<PomdpType, BeliefValueType, StateType>::Triangulation BeliefManager<PomdpType, BeliefValueType, StateType>::triangulateBelief(
+    BeliefType const &belief, BeliefValueType const &resolution, BeliefOrigin const &origin) {
+    Triangulation result = registerTriangulation(computeTriangulation(belief, resolution), origin);
     STORM_LOG_ASSERT(assertTriangulation(belief, result), "Incorrect triangulation: " << toString(result));
     return result;
 }
 
+template<typename PomdpType, typename BeliefValueType, typename StateType>
+std::vector<std::pair<typename BeliefManager<PomdpType, BeliefValueType, StateType>::BeliefType, BeliefValueType>>
+BeliefManager<PomdpType, BeliefValueType, StateType>::computeSuccessorBeliefs(BeliefType const &belief, uint64_t actionIndex) const {
+    return std::move(computeSuccessorBeliefs(std::vector<BeliefType const *>({&belief}), getBeliefObservation(belief), actionIndex).front());
+}
+
+template<typename PomdpType, typename BeliefValueType, typename StateType>
+std::vector<std::vector<std::pair<typename BeliefManager<PomdpType, BeliefValueType, StateType>::BeliefType, BeliefValueType>>>
+BeliefManager<PomdpType, BeliefValueType, StateType>::computeSuccessorBeliefs(std::vector<BeliefType const *> const &beliefs, uint32_t observation,
+                                                                              uint64_t actionIndex) const {
+    auto const &transitions = observationActionTransitions[observation][actionIndex];
+    uint64_t const numBeliefs = beliefs.size();
+    uint64_t const numLocalStates = transitions.rowIndications.size() - 1;
+    uint64_t const numColumns = transitions.columnStates.size();
+
+    // Set up a dense block of the beliefs in which the values of all beliefs at the same state are stored contiguously
+    std::vector<BeliefValueType> beliefBlock(numLocalStates * numBeliefs, storm::utility::zero<BeliefValueType>());
+    storm::storage::BitVector supportStates(numLocalStates, false);
+    for (uint64_t beliefIndex = 0; beliefIndex < numBeliefs; ++beliefIndex) {
+        for (auto const &pointEntry : *beliefs[beliefIndex]) {
+            STORM_LOG_ASSERT(pomdp.getObservation(pointEntry.first) == observation, "Belief does not have the expected observation.");
+            uint64_t localState = localStateIndices[pointEntry.first];
+            beliefBlock[localState * numBeliefs + beliefIndex] = pointEntry.second;
+            supportStates.set(localState, true);
+        }
+    }
+
+    // Multiply the transitions with the block. The innermost loop runs over the beliefs
+    std::vector<BeliefValueType> successorBlock(numColumns * numBeliefs, storm::utility::zero<BeliefValueType>());
+    for (auto localState : supportStates) {
+        BeliefValueType const *beliefValues = beliefBlock.data() + localState * numBeliefs;
+        for (uint64_t entry = transitions.rowIndications[localState], entryEnd = transitions.rowIndications[localState + 1]; entry < entryEnd; ++entry) {
+            BeliefValueType const &transitionValue = transitions.values[entry];
+            BeliefValueType *successorValues = successorBlock.data() + transitions.localColumns[entry] * numBeliefs;
+            for (uint64_t beliefIndex = 0; beliefIndex < numBeliefs; ++beliefIndex) {
+                if constexpr (storm::NumberTraits<BeliefValueType>::IsExact) {
+                    // Avoid expensive operations on exact zeros
+                    if (storm::utility::isZero(beliefValues[beliefIndex])) {
+                        continue;
+                    }
+                }
+                successorValues[beliefIndex] += beliefValues[beliefIndex] * transitionValue;
+            }
+        }
+    }
+
+    // Split the results by the successor observations
+    std::vector<std::vector<std::pair<BeliefType, BeliefValueType>>> result(numBeliefs);
+    std::vector<std::pair<uint64_t, uint64_t>> observationColumnRanges;
+    BeliefType successorObs;  // This is actually not a belief but has the same type
+    for (uint64_t beliefIndex = 0; beliefIndex < numBeliefs; ++beliefIndex) {
+        // Find the probability we go to each observation
+        for (uint64_t column = 0; column < numColumns;) {
+            uint64_t columnEnd = column;
+            BeliefValueType observationProbability = storm::utility::zero<BeliefValueType>();
+            for (; columnEnd < numColumns && transitions.columnObservations[columnEnd] == transitions.columnObservations[column]; ++columnEnd) {
+                observationProbability += successorBlock[columnEnd * numBeliefs + beliefIndex];
+            }
+            if (!storm::utility::isZero(observationProbability)) {
+                successorObs.emplace_hint(successorObs.end(), transitions.columnObservations[column], std::move(observationProbability));
+                observationColumnRanges.emplace_back(column, columnEnd);
+            }
+            column = columnEnd;
+        }
+        adjustDistribution(successorObs);
+
+        // Now for each successor observation we find the successor belief
+        result[beliefIndex].reserve(successorObs.size());
+        auto columnRangeIt = observationColumnRanges.begin();
+        for (auto const &successor : successorObs) {
+            BeliefType successorBelief;
+            successorBelief.reserve(columnRangeIt->second - columnRangeIt->first);
+            for (uint64_t column = columnRangeIt->first; column < columnRangeIt->second; ++column) {
+                BeliefValueType const &value = successorBlock[column * numBeliefs + beliefIndex];
+                if (!storm::utility::isZero(value)) {
+                    successorBelief.emplace_hint(successorBelief.end(), transitions.columnStates[column], value / successor.second);
+                }
+            }
+            adjustDistribution(successorBelief);
+            STORM_LOG_ASSERT(assertBelief(successorBelief), "Invalid successor belief.");
+            result[beliefIndex].emplace_back(std::move(successorBelief), successor.second);
+            ++columnRangeIt;
+        }
+        successorObs.clear();
+        observationColumnRanges.clear();
+    }
+    return result;
+}
+
 template<typename PomdpType, typename BeliefValueType, typename StateType>
 std::vector<std::pair<typename BeliefManager<PomdpType, BeliefValueType, StateType>::BeliefId,
                       typename BeliefManager<PomdpType, BeliefValueType, StateType>::ValueType>>
@@ -521,56 +848,60 @@ BeliefManager<PomdpType, BeliefValueType, StateType>::expandInternal(BeliefId co
                                                                      std::optional<std::vector<uint64_t>> const &observationGridClippingResolutions) {
     std::vector<std::pair<BeliefId, ValueType>> destinations;
 
-    BeliefType belief = getBelief(beliefId);
-
-    // Find the probability we go to each observation
-    BeliefType successorObs;  // This is actually not a belief but has the same type
-    for (auto const &pointEntry : belief) {
-        uint64_t state = pointEntry.first;
-        for (auto const &pomdpTransition : pomdp.getTransitionMatrix().getRow(state, actionIndex)) {
-            if (!storm::utility::isZero(pomdpTransition.getValue())) {
-                auto obs = pomdp.getObservation(pomdpTransition.getColumn());
-                addToDistribution(successorObs, obs, pointEntry.second * storm::utility::convertNumber<BeliefValueType>(pomdpTransition.getValue()));
+    if (observationTriangulationResolutions) {
+        auto precomputedIt = precomputedExpansions.find(std::make_pair(beliefId, actionIndex));
+        if (precomputedIt != precomputedExpansions.end()) {
+            std::vector<PrecomputedSuccessor> precomputedSuccessors = std::move(precomputedIt->second);
+            precomputedExpansions.erase(precomputedIt);
+            // The precomputed triangulations can only be used if the resolutions did not change in the meantime.
+            if (std::all_of(precomputedSuccessors.begin(), precomputedSuccessors.end(), [&observationTriangulationResolutions](auto const &successor) {
+                    return successor.resolution == observationTriangulationResolutions.value()[successor.observation];
+                })) {
+                // Insert the grid points in the same order as without precomputation
+                for (auto const &successor : precomputedSuccessors) {
+                    Triangulation triangulation =
+                        registerTriangulation(successor.triangulation, {beliefId, actionIndex, successor.observation, NO_INDEX, successor.resolution});
+                    for (size_t j = 0; j < triangulation.size(); ++j) {
+                        BeliefValueType a = triangulation.weights[j] * successor.observationProbability;
+                        destinations.emplace_back(triangulation.gridPoints[j], storm::utility::convertNumber<ValueType>(a));
+                    }
+                }
+                return destinations;
             }
         }
     }
-    adjustDistribution(successorObs);
 
-    // Now for each successor observation we find and potentially triangulate the successor belief
-    for (auto const &successor : successorObs) {
-        BeliefType successorBelief;
-        for (auto const &pointEntry : belief) {
-            uint64_t state = pointEntry.first;
-            for (auto const &pomdpTransition : pomdp.getTransitionMatrix().getRow(state, actionIndex)) {
-                if (pomdp.getObservation(pomdpTransition.getColumn()) == successor.first) {
-                    BeliefValueType prob = pointEntry.second * storm::utility::convertNumber<BeliefValueType>(pomdpTransition.getValue()) / successor.second;
-                    addToDistribution(successorBelief, pomdpTransition.getColumn(), prob);
-                }
-            }
-        }
-        adjustDistribution(successorBelief);
-        STORM_LOG_ASSERT(assertBelief(successorBelief), "Invalid successor belief.");
+    // Compute all successor beliefs first as inserting new beliefs might invalidate references to the stored beliefs
+    auto successors = computeSuccessorBeliefs(getBelief(beliefId), actionIndex);
+
+    // Now for each successor observation we potentially triangulate the successor belief
+    for (auto const &successor : successors) {
+        BeliefType const &successorBelief = successor.first;
+        uint32_t successorObservation = getBeliefObservation(successorBelief);
 
         // Insert the destination. We know that destinations have to be disjoint since they have different observations
         if (observationTriangulationResolutions) {
-            Triangulation triangulation = triangulateBelief(successorBelief, observationTriangulationResolutions.value()[successor.first]);
+            BeliefValueType const &resolution = observationTriangulationResolutions.value()[successorObservation];
+            Triangulation triangulation = triangulateBelief(successorBelief, resolution, {beliefId, actionIndex, successorObservation, NO_INDEX, resolution});
             for (size_t j = 0; j < triangulation.size(); ++j) {
                 // Here we additionally assume that triangulation.gridPoints does not contain the same point multiple times
                 BeliefValueType a = triangulation.weights[j] * successor.second;
                 destinations.emplace_back(triangulation.gridPoints[j], storm::utility::convertNumber<ValueType>(a));
             }
         } else if (observationGridClippingResolutions) {
-            BeliefClipping clipping = clipBeliefToGrid(successorBelief, observationGridClippingResolutions.value()[successor.first],
+            BeliefClipping clipping = clipBeliefToGrid(successorBelief, observationGridClippingResolutions.value()[successorObservation],
                                                        storm::storage::BitVector(pomdp.getNumberOfStates()));
             if (clipping.isClippable) {
                 BeliefValueType a = (storm::utility::one<BeliefValueType>() - clipping.delta) * successor.second;
                 destinations.emplace_back(clipping.targetBelief, storm::utility::convertNumber<ValueType>(a));
             } else {
                 // Belief on Grid
-                destinations.emplace_back(getOrAddBeliefId(successorBelief), storm::utility::convertNumber<ValueType>(successor.second));
+                destinations.emplace_back(getOrAddBeliefId(successorBelief, {beliefId, actionIndex, successorObservation, NO_INDEX, BeliefValueType()}),
+                                          storm::utility::convertNumber<ValueType>(successor.second));
             }
         } else {
-            destinations.emplace_back(getOrAddBeliefId(successorBelief), storm::utility::convertNumber<ValueType>(successor.second));
+            destinations.emplace_back(getOrAddBeliefId(successorBelief, {beliefId, actionIndex, successorObservation, NO_INDEX, BeliefValueType()}),
+                                      storm::utility::convertNumber<ValueType>(successor.second));
         }
     }
 
@@ -589,7 +920,7 @@ template<typename PomdpType, typename BeliefValueType, typename StateType>
 typename BeliefManager<PomdpType, BeliefValueType, StateType>::BeliefClipping BeliefManager<PomdpType, BeliefValueType, StateType>::clipBeliefToGrid(
     BeliefType const &belief, uint64_t resolution, const storm::storage::BitVector &isInfinite) {
     uint32_t obs = getBeliefObservation(belief);
-    STORM_LOG_ASSERT(obs < beliefToIdMap.size(), "Belief has unknown observation.");
+    STORM_LOG_ASSERT(obs < beliefIdSets.size(), "Belief has unknown observation.");
     if (!lpSolver) {
         lpSolver = storm::utility::solver::getLpSolver<BeliefValueType>("POMDP LP Solver");
     } else {
@@ -768,16 +1099,34 @@ typename BeliefManager<PomdpType, BeliefValueType, StateType>::BeliefId BeliefMa
 template<typename PomdpType, typename BeliefValueType, typename StateType>
 typename BeliefManager<PomdpType, BeliefValueType, StateType>::BeliefId BeliefManager<PomdpType, BeliefValueType, StateType>::getOrAddBeliefId(
     BeliefType const &belief) {
+    return getOrAddBeliefId(belief, {NO_ID, NO_INDEX, 0, NO_INDEX, storm::utility::zero<BeliefValueType>()});
+}
+
+template<typename PomdpType, typename BeliefValueType, typename StateType>
+typename BeliefManager<PomdpType, BeliefValueType, StateType>::BeliefId BeliefManager<PomdpType, BeliefValueType, StateType>::getOrAddBeliefId(
+    BeliefType const &belief, BeliefOrigin const &origin) {
     uint32_t obs = getBeliefObservation(belief);
-    STORM_LOG_ASSERT(obs < beliefToIdMap.size(), "Belief has unknown observation.");
-    auto insertioRes = beliefToIdMap[obs].emplace(belief, beliefs.size());
-    if (insertioRes.second) {
-        // There actually was an insertion, so add the new belief
-        STORM_LOG_TRACE("Add Belief " << beliefs.size() << " " << toString(belief));
-        beliefs.push_back(belief);
+    STORM_LOG_ASSERT(obs < beliefIdSets.size(), "Belief has unknown observation.");
+    // Tentatively store the belief with the next free id so that it can be looked up by that id.
+    BeliefId candidateId = beliefs.size();
+    // Note that the given belief might refer to a stored belief, which is invalidated when the belief vector grows.
+    beliefs.push_back(belief);
+    beliefHashes.push_back(BeliefHash()(beliefs.back()));
+    auto insertionRes = beliefIdSets[obs].insert(candidateId);
+    if (insertionRes.second) {
+        // There actually was an insertion, so keep the new belief
+        STORM_LOG_TRACE("Add Belief " << candidateId << " " << toString(beliefs.back()));
+        beliefs.back().shrink_to_fit();
+        if (beliefEvictionEnabled || !beliefOrigins.empty()) {
+            beliefOrigins.push_back(origin);
+            beliefOrigins.back().observation = obs;
+        }
+    } else {
+        beliefs.pop_back();
+        beliefHashes.pop_back();
     }
     // Return the id
-    return insertioRes.first->second;
+    return *insertionRes.first;
 }
 template<typename PomdpType, typename BeliefValueType, typename StateType>
 uint64_t BeliefManager<PomdpType, BeliefValueType, StateType>::getRepresentativeState(BeliefId const &beliefId) {
@@ -2,8 +2,10 @@
 
 #include <boost/container/flat_map.hpp>
 #include <boost/container/flat_set.hpp>
+#include <map>
 #include <optional>
 #include <unordered_map>
+#include <unordered_set>
 #include <vector>
 
 #include "storm/solver/LpSolver.h"
@@ -30,6 +32,10 @@ class BeliefManager {
 
     BeliefManager(PomdpType const &pomdp, BeliefValueType const &precision, TriangulationMode const &triangulationMode);
 
+    // The lookup structures refer to the manager itself, so it must not be copied.
+    BeliefManager(BeliefManager const &other) = delete;
+    BeliefManager &operator=(BeliefManager const &other) = delete;
+
     void setRewardModel(std::optional<std::string> rewardModelName = std::nullopt);
 
     void unsetRewardModel();
@@ -79,7 +85,7 @@ class BeliefManager {
     Triangulation triangulateBelief(BeliefId beliefId, BeliefValueType resolution);
 
     template<typename DistributionType>
-    void addToDistribution(DistributionType &distr, StateType const &state, BeliefValueType const &value);
+    void addToDistribution(DistributionType &distr, StateType const &state, BeliefValueType const &value) const;
 
     void joinSupport(BeliefId const &beliefId, BeliefSupportType &support);
 
@@ -88,6 +94,33 @@ class BeliefManager {
     std::vector<std::pair<BeliefId, ValueType>> expandAndTriangulate(BeliefId const &beliefId, uint64_t actionIndex,
                                                                      std::vector<BeliefValueType> const &observationResolutions);
 
+    /*!
+     * Computes the successor beliefs and their triangulations for all actions of the given beliefs without inserting any new beliefs.
+     * If Intel TBB is available, the beliefs are processed in parallel.
+     * A subsequent call of expandAndTriangulate for one of these beliefs (with the same resolutions) then only inserts the grid points. The obtained
+     * belief ids are the same as without precomputation, independent of the number of threads. Previously precomputed results are dropped.
+     */
+    void precomputeExpandAndTriangulate(std::vector<BeliefId> const &beliefIds, std::vector<BeliefValueType> const &observationResolutions);
+
+    /*!
+     * Drops the results of previous calls of precomputeExpandAndTriangulate.
+     */
+    void clearPrecomputedExpansions();
+
+    /*!
+     * Enables or disables the eviction of belief contents. If enabled, the manager records for each new belief how it can be recomputed.
+     * Beliefs that were added while eviction was disabled can not be evicted.
+     */
+    void setBeliefEviction(bool enabled);
+
+    bool isBeliefEvictionEnabled() const;
+
+    /*!
+     * Frees the content of the given belief while keeping its id, observation and hash value. This is a no-op if the belief can not be recomputed.
+     * Lookups of equal beliefs verify hash matches by recomputing the evicted belief. All other accesses recompute and restore the content.
+     */
+    void evictBelief(BeliefId const &beliefId);
+
     std::vector<std::pair<BeliefId, ValueType>> expandAndClip(BeliefId const &beliefId, uint64_t actionIndex,
                                                               std::vector<uint64_t> const &observationResolutions);
 
@@ -107,7 +140,7 @@ class BeliefManager {
     BeliefClipping clipBeliefToGrid(BeliefType const &belief, uint64_t resolution, const storm::storage::BitVector &isInfinite);
 
     template<typename DistributionType>
-    void adjustDistribution(DistributionType &distr);
+    void adjustDistribution(DistributionType &distr) const;
 
     struct BeliefHash {
         std::size_t operator()(const BeliefType &belief) const;
@@ -117,6 +150,54 @@ class BeliefManager {
         bool operator()(const BeliefType &lhBelief, const BeliefType &rhBelief) const;
     };
 
+    // Hash and comparison of beliefs given by their ids. The beliefs and their hash values are looked up in the manager.
+    struct BeliefIdHash {
+        BeliefManager const *manager;
+        std::size_t operator()(BeliefId const &id) const;
+    };
+
+    struct BeliefIdEqualTo {
+        BeliefManager const *manager;
+        bool operator()(BeliefId const &lhId, BeliefId const &rhId) const;
+    };
+
+    // A triangulation whose grid points have not (yet) been inserted.
+    struct UnregisteredTriangulation {
+        std::vector<BeliefType> gridPoints;
+        std::vector<BeliefValueType> weights;
+    };
+
+    // The transitions of the POMDP for a fixed observation and action, prepared once for the computation of successor beliefs.
+    // Row i corresponds to the i-th state with that observation. The successor states are referred to by local column indices. These are ordered by
+    // the observation and then by the index of the successor state, so that all successors with the same observation are adjacent.
+    struct ObservationActionTransitions {
+        std::vector<uint64_t> rowIndications;
+        std::vector<uint64_t> localColumns;
+        std::vector<BeliefValueType> values;
+        std::vector<StateType> columnStates;
+        std::vector<uint32_t> columnObservations;
+    };
+
+    // Describes how a belief is obtained from a previously added source belief: optionally the successor for the given action and observation is taken,
+    // and optionally the grid point with the given index of the triangulation with the given resolution.
+    struct BeliefOrigin {
+        BeliefId source;  // noId() if the belief can not be recomputed
+        uint64_t action;  // NO_INDEX if the source is triangulated directly
+        uint32_t observation;
+        uint64_t gridPointIndex;  // NO_INDEX if the belief is not a grid point
+        BeliefValueType resolution;
+    };
+
+    static const uint64_t NO_INDEX;
+
+    // A successor of a (belief, action) pair whose triangulation has been precomputed with the given resolution.
+    struct PrecomputedSuccessor {
+        uint32_t observation;
+        BeliefValueType observationProbability;
+        BeliefValueType resolution;
+        UnregisteredTriangulation triangulation;
+    };
+
     struct FreudenthalDiff {
         FreudenthalDiff(StateType const &dimension, BeliefValueType diff);
 
@@ -127,8 +208,6 @@ class BeliefManager {
 
     BeliefType const &getBelief(BeliefId const &id) const;
 
-    BeliefId getId(BeliefType const &belief) const;
-
     std::string toString(BeliefType const &belief) const;
 
     bool isEqual(BeliefType const &first, BeliefType const &second) const;
@@ -137,13 +216,32 @@ class BeliefManager {
 
     bool assertTriangulation(BeliefType const &belief, Triangulation const &triangulation) const;
 
-    uint32_t getBeliefObservation(BeliefType belief) const;
+    uint32_t getBeliefObservation(BeliefType const &belief) const;
+
+    void triangulateBeliefFreudenthal(BeliefType const &belief, BeliefValueType const &resolution, UnregisteredTriangulation &result) const;
+
+    void triangulateBeliefDynamic(BeliefType const &belief, BeliefValueType const &resolution, UnregisteredTriangulation &result) const;
+
+    UnregisteredTriangulation computeTriangulation(BeliefType const &belief, BeliefValueType const &resolution) const;
+
+    Triangulation registerTriangulation(UnregisteredTriangulation const &triangulation, BeliefOrigin origin);
+
+    Triangulation triangulateBelief(BeliefType const &belief, BeliefValueType const &resolution, BeliefOrigin const &origin);
 
-    void triangulateBeliefFreudenthal(BeliefType const &belief, BeliefValueType const &resolution, Triangulation &result);
+    /*!
+     * Computes the successor beliefs of the given belief under the given action together with the probability to reach each of them.
+     * The successors are ordered by their observation.
+     */
+    std::vector<std::pair<BeliefType, BeliefValueType>> computeSuccessorBeliefs(BeliefType const &belief, uint64_t actionIndex) const;
 
-    void triangulateBeliefDynamic(BeliefType const &belief, BeliefValueType const &resolution, Triangulation &result);
+    /*!
+     * Computes the successor beliefs for several beliefs with the given observation under the same action at once.
+     * This multiplies the prepared transitions of the observation and action with a dense block that holds all these beliefs.
+     */
+    std::vector<std::vector<std::pair<BeliefType, BeliefValueType>>> computeSuccessorBeliefs(std::vector<BeliefType const *> const &beliefs,
+                                                                                           uint32_t observation, uint64_t actionIndex) const;
 
-    Triangulation triangulateBelief(BeliefType const &belief, BeliefValueType const &resolution);
+    void prepareObservationActionTransitions();
 
     std::vector<std::pair<BeliefId, ValueType>> expandInternal(
         BeliefId const &beliefId, uint64_t actionIndex, std::optional<std::vector<BeliefValueType>> const &observationTriangulationResolutions = std::nullopt,
@@ -153,13 +251,41 @@ class BeliefManager {
 
     BeliefId getOrAddBeliefId(BeliefType const &belief);
 
+    BeliefId getOrAddBeliefId(BeliefType const &belief, BeliefOrigin const &origin);
+
+    bool isEvicted(BeliefId const &beliefId) const;
+
+    /*!
+     * Recomputes the content of a (possibly evicted) belief from its origin without restoring it.
+     */
+    BeliefType recomputeBelief(BeliefId const &beliefId) const;
+
+    static const BeliefId NO_ID;
+
     PomdpType const &pomdp;
     std::vector<ValueType> pomdpActionRewardVector;
 
-    std::vector<BeliefType> beliefs;
-    std::vector<std::unordered_map<BeliefType, BeliefId, BeliefHash, Belief_equal_to>> beliefToIdMap;
+    // Evicted beliefs are restored upon access, which is why the belief contents are mutable.
+    mutable std::vector<BeliefType> beliefs;
+    // The hash value of each belief, which is computed only once.
+    std::vector<std::size_t> beliefHashes;
+    // For each observation, the ids of the beliefs with that observation. Each belief is thus only stored once (in the beliefs vector).
+    std::vector<std::unordered_set<BeliefId, BeliefIdHash, BeliefIdEqualTo>> beliefIdSets;
     BeliefId initialBeliefId;
 
+    // The origin of each belief. Only recorded if belief eviction is enabled.
+    bool beliefEvictionEnabled;
+    std::vector<BeliefOrigin> beliefOrigins;
+    mutable storm::storage::BitVector evictedBeliefs;
+
+    // For each state, its index among the states with the same observation.
+    std::vector<uint64_t> localStateIndices;
+    // For each observation and action, the corresponding transitions of the POMDP.
+    std::vector<std::vector<ObservationActionTransitions>> observationActionTransitions;
+
+    // The results of precomputeExpandAndTriangulate for each (belief, action) pair that has not been expanded since.
+    std::map<std::pair<BeliefId, uint64_t>, std::vector<PrecomputedSuccessor>> precomputedExpansions;
+
     storm::utility::ConstantsComparator<BeliefValueType> cc;
 
     std::shared_ptr<storm::solver::LpSolver<BeliefValueType>> lpSolver;
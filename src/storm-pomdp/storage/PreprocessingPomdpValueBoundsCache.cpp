@@ -0,0 +1,279 @@
+#include "storm-pomdp/storage/PreprocessingPomdpValueBoundsCache.h"
+
+#include <fstream>
+#include <limits>
+#include <type_traits>
+
+#include "storm/adapters/RationalNumberAdapter.h"
+#include "storm/io/file.h"
+#include "storm/logic/Formula.h"
+#include "storm/utility/constants.h"
+#include "storm/utility/macros.h"
+
+namespace storm {
+namespace pomdp {
+namespace storage {
+
+namespace detail {
+std::string const fileHeader = "storm-pomdp-value-bounds-v1";
+
+template<typename ValueType>
+void writeValue(std::ostream& out, ValueType const& value) {
+    out << ' ' << value;
+}
+
+template<typename ValueType>
+bool readValue(std::istream& in, ValueType& value) {
+    std::string token;
+    if (!(in >> token)) {
+        return false;
+    }
+    if constexpr (std::is_same<ValueType, double>::value) {
+        // Infinite values are written as inf or -inf
+        if (token == "inf") {
+            value = storm::utility::infinity<ValueType>();
+        } else if (token == "-inf") {
+            value = -storm::utility::infinity<ValueType>();
+        } else {
+            value = std::stod(token);
+        }
+    } else {
+        value = storm::utility::convertNumber<ValueType>(token);
+    }
+    return true;
+}
+
+template<typename ValueType>
+void writeVectors(std::ostream& out, std::vector<std::vector<ValueType>> const& vectors) {
+    out << vectors.size() << '\n';
+    for (auto const& vector : vectors) {
+        out << vector.size();
+        for (auto const& value : vector) {
+            writeValue(out, value);
+        }
+        out << '\n';
+    }
+}
+
+template<typename ValueType>
+bool readVectors(std::istream& in, std::vector<std::vector<ValueType>>& vectors) {
+    uint64_t numberOfVectors;
+    if (!(in >> numberOfVectors)) {
+        return false;
+    }
+    vectors.resize(numberOfVectors);
+    for (auto& vector : vectors) {
+        uint64_t size;
+        if (!(in >> size)) {
+            return false;
+        }
+        vector.resize(size);
+        for (auto& value : vector) {
+            if (!readValue(in, value)) {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+// Schedulers are memoryless. For each state, the number of choices in the support is followed by pairs of local choice index and probability.
+template<typename ValueType>
+void writeSchedulers(std::ostream& out, std::vector<storm::storage::Scheduler<ValueType>> const& schedulers, uint64_t numberOfStates) {
+    out << schedulers.size() << '\n';
+    for (auto const& scheduler : schedulers) {
+        STORM_LOG_ASSERT(scheduler.isMemorylessScheduler(), "Expected a memoryless scheduler.");
+        for (uint64_t state = 0; state < numberOfStates; ++state) {
+            auto const& choice = scheduler.getChoice(state);
+            if (!choice.isDefined()) {
+                out << 0;
+            } else {
+                auto const& distribution = choice.getChoiceAsDistribution();
+                out << distribution.size();
+                for (auto const& entry : distribution) {
+                    out << ' ' << entry.first;
+                    writeValue(out, entry.second);
+                }
+            }
+            out << '\n';
+        }
+    }
+}
+
+template<typename ValueType>
+bool readSchedulers(std::istream& in, std::vector<storm::storage::Scheduler<ValueType>>& schedulers, uint64_t numberOfStates) {
+    uint64_t numberOfSchedulers;
+    if (!(in >> numberOfSchedulers)) {
+        return false;
+    }
+    schedulers.clear();
+    for (uint64_t i = 0; i < numberOfSchedulers; ++i) {
+        storm::storage::Scheduler<ValueType> scheduler(numberOfStates);
+        for (uint64_t state = 0; state < numberOfStates; ++state) {
+            uint64_t supportSize;
+            if (!(in >> supportSize)) {
+                return false;
+            }
+            if (supportSize == 0) {
+                continue;
+            }
+            storm::storage::Distribution<ValueType, uint_fast64_t> distribution;
+            for (uint64_t j = 0; j < supportSize; ++j) {
+                uint64_t localChoice;
+                ValueType probability;
+                if (!(in >> localChoice) || !readValue(in, probability)) {
+                    return false;
+                }
+                distribution.addProbability(localChoice, probability);
+            }
+            scheduler.setChoice(distribution, state);
+        }
+        schedulers.push_back(std::move(scheduler));
+    }
+    return true;
+}
+
+/*!
+ * Opens the file of an entry and checks that it belongs to the given formula and model. Returns false if this is not the case.
+ */
+inline bool openEntryFile(std::string const& filename, std::ifstream& in, std::string const& formula, uint64_t numberOfStates) {
+    if (!storm::utility::fileExistsAndIsReadable(filename)) {
+        return false;
+    }
+    storm::utility::openFile(filename, in);
+    std::string header, formulaLine;
+    uint64_t storedNumberOfStates;
+    storm::utility::getline(in, header);
+    storm::utility::getline(in, formulaLine);
+    if (header != fileHeader || formulaLine != formula || !(in >> storedNumberOfStates) || storedNumberOfStates != numberOfStates) {
+        STORM_LOG_WARN("Ignoring value bounds in file " << filename << " as they do not belong to the current POMDP and formula.");
+        return false;
+    }
+    return true;
+}
+
+inline void openEntryFile(std::string const& filename, std::ofstream& out, std::string const& formula, uint64_t numberOfStates) {
+    storm::utility::openFile(filename, out, false, true);
+    // Floating point values are written such that they are read back exactly.
+    out.precision(std::numeric_limits<double>::max_digits10);
+    out << fileHeader << '\n' << formula << '\n' << numberOfStates << '\n';
+}
+}  // namespace detail
+
+template<typename ValueType>
+PreprocessingPomdpValueBoundsCache<ValueType>::PreprocessingPomdpValueBoundsCache(std::string const& directory) : directory(directory) {
+    // Intentionally left empty.
+}
+
+template<typename ValueType>
+typename PreprocessingPomdpValueBoundsCache<ValueType>::Key PreprocessingPomdpValueBoundsCache<ValueType>::getKey(
+    storm::models::sparse::Pomdp<ValueType> const& pomdp, storm::logic::Formula const& formula) const {
+    return Key(pomdp.hash(), formula.toString());
+}
+
+template<typename ValueType>
+std::string PreprocessingPomdpValueBoundsCache<ValueType>::getFilename(Key const& key, std::string const& kind) const {
+    return directory + "/" + kind + "_" + std::to_string(key.first) + "_" + std::to_string(std::hash<std::string>()(key.second)) + ".txt";
+}
+
+template<typename ValueType>
+std::optional<PreprocessingPomdpValueBounds<ValueType>> PreprocessingPomdpValueBoundsCache<ValueType>::getValueBounds(
+    storm::models::sparse::Pomdp<ValueType> const& pomdp, storm::logic::Formula const& formula) {
+    Key key = getKey(pomdp, formula);
+    auto findRes = valueBounds.find(key);
+    if (findRes != valueBounds.end()) {
+        return findRes->second;
+    }
+    if (directory.empty()) {
+        return std::nullopt;
+    }
+    std::string filename = getFilename(key, "bounds");
+    std::ifstream in;
+    if (!detail::openEntryFile(filename, in, key.second, pomdp.getNumberOfStates())) {
+        return std::nullopt;
+    }
+    PreprocessingPomdpValueBounds<ValueType> bounds;
+    bool success = detail::readVectors(in, bounds.lower) && detail::readVectors(in, bounds.upper) &&
+                   detail::readSchedulers(in, bounds.lowerSchedulers, pomdp.getNumberOfStates()) &&
+                   detail::readSchedulers(in, bounds.upperSchedulers, pomdp.getNumberOfStates());
+    storm::utility::closeFile(in);
+    if (!success) {
+        STORM_LOG_WARN("Ignoring value bounds in file " << filename << " as the file could not be read.");
+        return std::nullopt;
+    }
+    STORM_LOG_INFO("Loaded value bounds from file " << filename << ".");
+    valueBounds.emplace(key, bounds);
+    return bounds;
+}
+
+template<typename ValueType>
+void PreprocessingPomdpValueBoundsCache<ValueType>::storeValueBounds(storm::models::sparse::Pomdp<ValueType> const& pomdp,
+                                                                     storm::logic::Formula const& formula,
+                                                                     PreprocessingPomdpValueBounds<ValueType> const& bounds) {
+    Key key = getKey(pomdp, formula);
+    if (!directory.empty()) {
+        std::ofstream out;
+        detail::openEntryFile(getFilename(key, "bounds"), out, key.second, pomdp.getNumberOfStates());
+        detail::writeVectors(out, bounds.lower);
+        detail::writeVectors(out, bounds.upper);
+        detail::writeSchedulers(out, bounds.lowerSchedulers, pomdp.getNumberOfStates());
+        detail::writeSchedulers(out, bounds.upperSchedulers, pomdp.getNumberOfStates());
+        storm::utility::closeFile(out);
+    }
+    valueBounds[key] = bounds;
+}
+
+template<typename ValueType>
+std::optional<ExtremePOMDPValueBound<ValueType>> PreprocessingPomdpValueBoundsCache<ValueType>::getExtremeValueBound(
+    storm::models::sparse::Pomdp<ValueType> const& pomdp, storm::logic::Formula const& formula) {
+    Key key = getKey(pomdp, formula);
+    auto findRes = extremeValueBounds.find(key);
+    if (findRes != extremeValueBounds.end()) {
+        return findRes->second;
+    }
+    if (directory.empty()) {
+        return std::nullopt;
+    }
+    std::string filename = getFilename(key, "extreme");
+    std::ifstream in;
+    if (!detail::openEntryFile(filename, in, key.second, pomdp.getNumberOfStates())) {
+        return std::nullopt;
+    }
+    ExtremePOMDPValueBound<ValueType> bound;
+    std::vector<std::vector<ValueType>> values;
+    bool success = static_cast<bool>(in >> bound.min) && detail::readVectors(in, values) && values.size() == 1;
+    storm::utility::closeFile(in);
+    if (!success) {
+        STORM_LOG_WARN("Ignoring value bounds in file " << filename << " as the file could not be read.");
+        return std::nullopt;
+    }
+    STORM_LOG_INFO("Loaded value bounds from file " << filename << ".");
+    bound.values = std::move(values.front());
+    bound.isInfinite = storm::storage::BitVector(bound.values.size(), false);
+    for (uint64_t state = 0; state < bound.values.size(); ++state) {
+        bound.isInfinite.set(state, storm::utility::isInfinity(bound.values[state]));
+    }
+    extremeValueBounds.emplace(key, bound);
+    return bound;
+}
+
+template<typename ValueType>
+void PreprocessingPomdpValueBoundsCache<ValueType>::storeExtremeValueBound(storm::models::sparse::Pomdp<ValueType> const& pomdp,
+                                                                           storm::logic::Formula const& formula,
+                                                                           ExtremePOMDPValueBound<ValueType> const& bound) {
+    Key key = getKey(pomdp, formula);
+    if (!directory.empty()) {
+        std::ofstream out;
+        detail::openEntryFile(getFilename(key, "extreme"), out, key.second, pomdp.getNumberOfStates());
+        out << bound.min << '\n';
+        detail::writeVectors(out, std::vector<std::vector<ValueType>>({bound.values}));
+        storm::utility::closeFile(out);
+    }
+    extremeValueBounds[key] = bound;
+}
+
+template class PreprocessingPomdpValueBoundsCache<double>;
+template class PreprocessingPomdpValueBoundsCache<storm::RationalNumber>;
+}  // namespace storage
+}  // namespace pomdp
+}  // namespace storm
@@ -0,0 +1,53 @@
+#pragma once
+
+#include <map>
+#include <optional>
+#include <string>
+
+#include "storm-pomdp/storage/BeliefExplorationBounds.h"
+#include "storm/models/sparse/Pomdp.h"
+
+namespace storm {
+namespace logic {
+class Formula;
+}
+namespace pomdp {
+namespace storage {
+
+/**
+ * Cache for the value bounds that are computed in the preprocessing of the belief exploration.
+ * Entries are identified by the hash of the POMDP and the formula (as a string). If a directory is given, entries are also stored in files of that
+ * directory and can thus be reused by subsequent runs on the same POMDP.
+ * The cache does not consider the environment, i.e., the bounds are reused even if they have been computed with a different precision.
+ */
+template<typename ValueType>
+class PreprocessingPomdpValueBoundsCache {
+   public:
+    /**
+     * @param directory the directory in which the entries are stored. If empty, entries are only kept in memory.
+     */
+    PreprocessingPomdpValueBoundsCache(std::string const& directory = "");
+
+    std::optional<PreprocessingPomdpValueBounds<ValueType>> getValueBounds(storm::models::sparse::Pomdp<ValueType> const& pomdp,
+                                                                           storm::logic::Formula const& formula);
+    void storeValueBounds(storm::models::sparse::Pomdp<ValueType> const& pomdp, storm::logic::Formula const& formula,
+                          PreprocessingPomdpValueBounds<ValueType> const& bounds);
+
+    std::optional<ExtremePOMDPValueBound<ValueType>> getExtremeValueBound(storm::models::sparse::Pomdp<ValueType> const& pomdp,
+                                                                          storm::logic::Formula const& formula);
+    void storeExtremeValueBound(storm::models::sparse::Pomdp<ValueType> const& pomdp, storm::logic::Formula const& formula,
+                                ExtremePOMDPValueBound<ValueType> const& bound);
+
+   private:
+    typedef std::pair<std::size_t, std::string> Key;
+
+    Key getKey(storm::models::sparse::Pomdp<ValueType> const& pomdp, storm::logic::Formula const& formula) const;
+    std::string getFilename(Key const& key, std::string const& kind) const;
+
+    std::string directory;
+    std::map<Key, PreprocessingPomdpValueBounds<ValueType>> valueBounds;
+    std::map<Key, ExtremePOMDPValueBound<ValueType>> extremeValueBounds;
+};
+}  // namespace storage
+}  // namespace pomdp
+}  // namespace storm
@@ -1,18 +1,20 @@
 #include "storm-pomdp/transformer/ObservationTraceUnfolder.h"
+
+#include <algorithm>
+#include <unordered_map>
+
 #include "storm/exceptions/InvalidArgumentException.h"
 #include "storm/storage/expressions/ExpressionManager.h"
 #include "storm/utility/ConstantsComparator.h"
 
 #include "storm/adapters/RationalFunctionAdapter.h"
 
-#undef _VERBOSE_OBSERVATION_UNFOLDING
-
 namespace storm {
 namespace pomdp {
 template<typename ValueType>
 ObservationTraceUnfolder<ValueType>::ObservationTraceUnfolder(storm::models::sparse::Pomdp<ValueType> const& model, std::vector<ValueType> const& risk,
                                                               std::shared_ptr<storm::expressions::ExpressionManager>& exprManager)
-    : model(model), risk(risk), exprManager(exprManager) {
+    : model(model), risk(risk), exprManager(exprManager), lastStepStart(0) {
     statesPerObservation = std::vector<storm::storage::BitVector>(model.getNrObservations() + 1, storm::storage::BitVector(model.getNumberOfStates()));
     for (uint64_t state = 0; state < model.getNumberOfStates(); ++state) {
         statesPerObservation[model.getObservation(state)].set(state, true);
@@ -22,152 +24,128 @@ ObservationTraceUnfolder<ValueType>::ObservationTraceUnfolder(storm::models::spa
 
 template<typename ValueType>
 std::shared_ptr<storm::models::sparse::Mdp<ValueType>> ObservationTraceUnfolder<ValueType>::transform(const std::vector<uint32_t>& observations) {
-    std::vector<uint32_t> modifiedObservations = observations;
-    // First observation should be special.
-    // This just makes the algorithm simpler because we do not treat the first step as a special case later.
-    modifiedObservations[0] = model.getNrObservations();
+    STORM_LOG_THROW(!observations.empty(), storm::exceptions::InvalidArgumentException, "Must have at least one observation");
+    // The unfolding of the previous call can be reused if it covers a prefix of the given observations.
+    bool reuseUnfolding = !unfoldedTrace.empty() && unfoldedTrace.size() <= observations.size() &&
+                          std::equal(unfoldedTrace.begin(), unfoldedTrace.end(), observations.begin());
+    if (!reuseUnfolding) {
+        initializeUnfolding(observations[0]);
+    }
+    for (uint64_t step = unfoldedTrace.size(); step < observations.size(); ++step) {
+        unfoldLastStep(observations[step]);
+        unfoldedTrace.push_back(observations[step]);
+    }
+    return buildModel();
+}
 
+template<typename ValueType>
+void ObservationTraceUnfolder<ValueType>::initializeUnfolding(uint32_t initialObservation) {
     storm::storage::BitVector initialStates = model.getInitialStates();
     storm::storage::BitVector actualInitialStates = initialStates;
     for (uint64_t state : initialStates) {
-        if (model.getObservation(state) != observations[0]) {
+        if (model.getObservation(state) != initialObservation) {
             actualInitialStates.set(state, false);
         }
     }
     STORM_LOG_THROW(actualInitialStates.getNumberOfSetBits() == 1, storm::exceptions::InvalidArgumentException,
                     "Must have unique initial state matching the observation");
-    //
     statesPerObservation[model.getNrObservations()] = actualInitialStates;
 
-#ifdef _VERBOSE_OBSERVATION_UNFOLDING
-    std::cout << "build valution builder..\n";
-#endif
-    storm::storage::sparse::StateValuationsBuilder svbuilder;
-    svbuilder.addVariable(svvar);
+    // The initial state has index 0, which is also the target of the resets.
+    unfoldedTrace = {initialObservation};
+    unfoldedRowIndications = {0};
+    unfoldedEntries.clear();
+    unfoldedRowGroupIndices.clear();
+    unfoldedToOld = {actualInitialStates.getNextSetIndex(0)};
+    lastStepStart = 0;
+}
 
-    std::map<uint64_t, uint64_t> unfoldedToOld;
-    std::map<uint64_t, uint64_t> unfoldedToOldNextStep;
-    std::map<uint64_t, uint64_t> oldToUnfolded;
-
-#ifdef _VERBOSE_OBSERVATION_UNFOLDING
-    std::cout << "start buildiing matrix...\n";
-#endif
-
-    // Add this initial state state:
-    unfoldedToOldNextStep[0] = actualInitialStates.getNextSetIndex(0);
-
-    storm::storage::SparseMatrixBuilder<ValueType> transitionMatrixBuilder(0, 0, 0, true, true);
-    uint64_t newStateIndex = 1;
-    uint64_t newRowGroupStart = 0;
-    uint64_t newRowCount = 0;
-    // Notice that we are going to use a special last step
-
-    for (uint64_t step = 0; step < observations.size() - 1; ++step) {
-        oldToUnfolded.clear();
-        unfoldedToOld = unfoldedToOldNextStep;
-        unfoldedToOldNextStep.clear();
-
-        for (auto const& unfoldedToOldEntry : unfoldedToOld) {
-            transitionMatrixBuilder.newRowGroup(newRowGroupStart);
-#ifdef _VERBOSE_OBSERVATION_UNFOLDING
-            std::cout << "\tconsider new state " << unfoldedToOldEntry.first << '\n';
-#endif
-            assert(step == 0 || newRowCount == transitionMatrixBuilder.getLastRow() + 1);
-            svbuilder.addState(unfoldedToOldEntry.first, {}, {static_cast<int64_t>(unfoldedToOldEntry.second)});
-            uint64_t oldRowIndexStart = model.getNondeterministicChoiceIndices()[unfoldedToOldEntry.second];
-            uint64_t oldRowIndexEnd = model.getNondeterministicChoiceIndices()[unfoldedToOldEntry.second + 1];
-
-            for (uint64_t oldRowIndex = oldRowIndexStart; oldRowIndex != oldRowIndexEnd; oldRowIndex++) {
-#ifdef _VERBOSE_OBSERVATION_UNFOLDING
-                std::cout << "\t\tconsider old action " << oldRowIndex << '\n';
-                std::cout << "\t\tconsider new row nr " << newRowCount << '\n';
-#endif
-
-                ValueType resetProb = storm::utility::zero<ValueType>();
-                // We first find the reset probability
-                for (auto const& oldRowEntry : model.getTransitionMatrix().getRow(oldRowIndex)) {
-                    if (model.getObservation(oldRowEntry.getColumn()) != observations[step + 1]) {
-                        resetProb += oldRowEntry.getValue();
-                    }
+template<typename ValueType>
+void ObservationTraceUnfolder<ValueType>::unfoldLastStep(uint32_t nextObservation) {
+    uint64_t const lastStepEnd = unfoldedToOld.size();
+    std::unordered_map<uint64_t, uint64_t> oldToUnfolded;
+    for (uint64_t unfoldedState = lastStepStart; unfoldedState < lastStepEnd; ++unfoldedState) {
+        unfoldedRowGroupIndices.push_back(unfoldedRowIndications.size() - 1);
+        uint64_t oldRowIndexStart = model.getNondeterministicChoiceIndices()[unfoldedToOld[unfoldedState]];
+        uint64_t oldRowIndexEnd = model.getNondeterministicChoiceIndices()[unfoldedToOld[unfoldedState] + 1];
+
+        for (uint64_t oldRowIndex = oldRowIndexStart; oldRowIndex != oldRowIndexEnd; oldRowIndex++) {
+            uint64_t const rowStart = unfoldedEntries.size();
+            ValueType resetProb = storm::utility::zero<ValueType>();
+            // The transitions to states with a different observation are redirected to the initial state.
+            for (auto const& oldRowEntry : model.getTransitionMatrix().getRow(oldRowIndex)) {
+                if (model.getObservation(oldRowEntry.getColumn()) != nextObservation) {
+                    resetProb += oldRowEntry.getValue();
                 }
-#ifdef _VERBOSE_OBSERVATION_UNFOLDING
-                std::cout << "\t\t\t add reset with probability " << resetProb << '\n';
-#endif
+            }
+            if (resetProb != storm::utility::zero<ValueType>()) {
+                unfoldedEntries.emplace_back(0, resetProb);
+            }
 
-                // Add the resets
-                if (resetProb != storm::utility::zero<ValueType>()) {
-                    transitionMatrixBuilder.addNextValue(newRowCount, 0, resetProb);
+            // Now, we build the outgoing transitions.
+            for (auto const& oldRowEntry : model.getTransitionMatrix().getRow(oldRowIndex)) {
+                if (model.getObservation(oldRowEntry.getColumn()) != nextObservation) {
+                    continue;  // already handled.
                 }
-#ifdef _VERBOSE_OBSERVATION_UNFOLDING
-                std::cout << "\t\t\t add other transitions...\n";
-#endif
-
-                // Now, we build the outgoing transitions.
-                for (auto const& oldRowEntry : model.getTransitionMatrix().getRow(oldRowIndex)) {
-                    if (model.getObservation(oldRowEntry.getColumn()) != observations[step + 1]) {
-                        continue;  // already handled.
-                    }
-                    uint64_t column = 0;
-
-                    auto entryIt = oldToUnfolded.find(oldRowEntry.getColumn());
-                    if (entryIt == oldToUnfolded.end()) {
-                        column = newStateIndex;
-                        oldToUnfolded[oldRowEntry.getColumn()] = column;
-                        unfoldedToOldNextStep[column] = oldRowEntry.getColumn();
-                        newStateIndex++;
-                    } else {
-                        column = entryIt->second;
-                    }
-#ifdef _VERBOSE_OBSERVATION_UNFOLDING
-                    std::cout << "\t\t\t\t transition to " << column << "with probability " << oldRowEntry.getValue() << '\n';
-#endif
-                    transitionMatrixBuilder.addNextValue(newRowCount, column, oldRowEntry.getValue());
+                auto insertionRes = oldToUnfolded.emplace(oldRowEntry.getColumn(), unfoldedToOld.size());
+                if (insertionRes.second) {
+                    unfoldedToOld.push_back(oldRowEntry.getColumn());
                 }
-                newRowCount++;
+                unfoldedEntries.emplace_back(insertionRes.first->second, oldRowEntry.getValue());
             }
-
-            newRowGroupStart = transitionMatrixBuilder.getLastRow() + 1;
+            // Successors are numbered in the order of discovery, so the columns of a row are not necessarily sorted.
+            std::sort(unfoldedEntries.begin() + rowStart, unfoldedEntries.end(),
+                      [](auto const& lhs, auto const& rhs) { return lhs.getColumn() < rhs.getColumn(); });
+            unfoldedRowIndications.push_back(unfoldedEntries.size());
         }
     }
-    // Now, take care of the last step.
-    uint64_t sinkState = newStateIndex;
-    uint64_t targetState = newStateIndex + 1;
+    lastStepStart = lastStepEnd;
+}
+
+template<typename ValueType>
+std::shared_ptr<storm::models::sparse::Mdp<ValueType>> ObservationTraceUnfolder<ValueType>::buildModel() const {
+    // The states of the last step move to the target state with their risk and to the sink state otherwise.
+    uint64_t const sinkState = unfoldedToOld.size();
+    uint64_t const targetState = sinkState + 1;
+    uint64_t const numberOfStates = targetState + 1;
+    uint64_t const numberOfLastStepStates = unfoldedToOld.size() - lastStepStart;
+
+    std::vector<uint64_t> rowIndications;
+    rowIndications.reserve(unfoldedRowIndications.size() + numberOfLastStepStates + 2);
+    rowIndications = unfoldedRowIndications;
+    std::vector<storm::storage::MatrixEntry<uint64_t, ValueType>> entries;
+    entries.reserve(unfoldedEntries.size() + 2 * numberOfLastStepStates + 2);
+    entries = unfoldedEntries;
+    std::vector<uint64_t> rowGroupIndices;
+    rowGroupIndices.reserve(numberOfStates + 1);
+    rowGroupIndices = unfoldedRowGroupIndices;
+
     auto cc = storm::utility::ConstantsComparator<ValueType>();
-    for (auto const& unfoldedToOldEntry : unfoldedToOldNextStep) {
-        svbuilder.addState(unfoldedToOldEntry.first, {}, {static_cast<int64_t>(unfoldedToOldEntry.second)});
-
-        transitionMatrixBuilder.newRowGroup(newRowGroupStart);
-        STORM_LOG_ASSERT(risk.size() > unfoldedToOldEntry.second, "Must be a state");
-        STORM_LOG_ASSERT(!cc.isLess(storm::utility::one<ValueType>(), risk[unfoldedToOldEntry.second]), "Risk must be a probability");
-        STORM_LOG_ASSERT(!cc.isLess(risk[unfoldedToOldEntry.second], storm::utility::zero<ValueType>()), "Risk must be a probability");
-        // std::cout << "risk is" <<  risk[unfoldedToOldEntry.second] << '\n';
-        if (!storm::utility::isOne(risk[unfoldedToOldEntry.second])) {
-            transitionMatrixBuilder.addNextValue(newRowGroupStart, sinkState, storm::utility::one<ValueType>() - risk[unfoldedToOldEntry.second]);
+    for (uint64_t unfoldedState = lastStepStart; unfoldedState < unfoldedToOld.size(); ++unfoldedState) {
+        uint64_t const oldState = unfoldedToOld[unfoldedState];
+        STORM_LOG_ASSERT(risk.size() > oldState, "Must be a state");
+        STORM_LOG_ASSERT(!cc.isLess(storm::utility::one<ValueType>(), risk[oldState]), "Risk must be a probability");
+        STORM_LOG_ASSERT(!cc.isLess(risk[oldState], storm::utility::zero<ValueType>()), "Risk must be a probability");
+        rowGroupIndices.push_back(rowIndications.size() - 1);
+        if (!storm::utility::isOne(risk[oldState])) {
+            entries.emplace_back(sinkState, storm::utility::one<ValueType>() - risk[oldState]);
         }
-        if (!storm::utility::isZero(risk[unfoldedToOldEntry.second])) {
-            transitionMatrixBuilder.addNextValue(newRowGroupStart, targetState, risk[unfoldedToOldEntry.second]);
+        if (!storm::utility::isZero(risk[oldState])) {
+            entries.emplace_back(targetState, risk[oldState]);
         }
-        newRowGroupStart++;
+        rowIndications.push_back(entries.size());
     }
-    // sink state
-    transitionMatrixBuilder.newRowGroup(newRowGroupStart);
-    transitionMatrixBuilder.addNextValue(newRowGroupStart, sinkState, storm::utility::one<ValueType>());
-    svbuilder.addState(sinkState, {}, {-1});
-
-    newRowGroupStart++;
-    transitionMatrixBuilder.newRowGroup(newRowGroupStart);
-    // target state
-    transitionMatrixBuilder.addNextValue(newRowGroupStart, targetState, storm::utility::one<ValueType>());
-    svbuilder.addState(targetState, {}, {-1});
-#ifdef _VERBOSE_OBSERVATION_UNFOLDING
-    std::cout << "build matrix...\n";
-#endif
+    // sink state and target state
+    for (uint64_t absorbingState : {sinkState, targetState}) {
+        rowGroupIndices.push_back(rowIndications.size() - 1);
+        entries.emplace_back(absorbingState, storm::utility::one<ValueType>());
+        rowIndications.push_back(entries.size());
+    }
+    rowGroupIndices.push_back(rowIndications.size() - 1);
 
     storm::storage::sparse::ModelComponents<ValueType> components;
-    components.transitionMatrix = transitionMatrixBuilder.build();
-#ifdef _VERBOSE_OBSERVATION_UNFOLDING
-    std::cout << components.transitionMatrix << '\n';
-#endif
+    components.transitionMatrix =
+        storm::storage::SparseMatrix<ValueType>(numberOfStates, std::move(rowIndications), std::move(entries), std::move(rowGroupIndices));
     STORM_LOG_ASSERT(components.transitionMatrix.getRowGroupCount() == targetState + 1,
                      "Expect row group count (" << components.transitionMatrix.getRowGroupCount() << ") one more as target state index " << targetState << ")");
 
@@ -177,6 +155,14 @@ std::shared_ptr<storm::models::sparse::Mdp<ValueType>> ObservationTraceUnfolder<
     labeling.addLabel("init");
     labeling.addLabelToState("init", 0);
     components.stateLabeling = labeling;
+
+    storm::storage::sparse::StateValuationsBuilder svbuilder;
+    svbuilder.addVariable(svvar);
+    for (uint64_t unfoldedState = 0; unfoldedState < unfoldedToOld.size(); ++unfoldedState) {
+        svbuilder.addState(unfoldedState, {}, {static_cast<int64_t>(unfoldedToOld[unfoldedState])});
+    }
+    svbuilder.addState(sinkState, {}, {-1});
+    svbuilder.addState(targetState, {}, {-1});
     components.stateValuations = svbuilder.build();
     return std::make_shared<storm::models::sparse::Mdp<ValueType>>(std::move(components));
 }
@@ -19,7 +19,8 @@ class ObservationTraceUnfolder {
     ObservationTraceUnfolder(storm::models::sparse::Pomdp<ValueType> const& model, std::vector<ValueType> const& risk,
                              std::shared_ptr<storm::expressions::ExpressionManager>& exprManager);
     /**
-     * Transform in one shot
+     * Transform in one shot.
+     * The unfolding is built incrementally: If the given observations extend the observations of the previous call, only the new steps are unfolded.
      * @param observations
      * @return
      */
@@ -37,12 +38,38 @@ class ObservationTraceUnfolder {
     void reset(uint32_t observation);
 
    private:
+    /**
+     * Starts a new unfolding that only consists of the initial state.
+     */
+    void initializeUnfolding(uint32_t initialObservation);
+
+    /**
+     * Unfolds the states of the last step, i.e., adds their transitions to the successor states with the given observation and resets otherwise.
+     */
+    void unfoldLastStep(uint32_t nextObservation);
+
+    /**
+     * Builds the model from the current unfolding, where the states of the last step move to a target state with their risk.
+     */
+    std::shared_ptr<storm::models::sparse::Mdp<ValueType>> buildModel() const;
+
     storm::models::sparse::Pomdp<ValueType> const& model;
     std::vector<ValueType> risk;  // TODO reconsider holding this as a reference, but there were some strange bugs
     std::shared_ptr<storm::expressions::ExpressionManager>& exprManager;
     std::vector<storm::storage::BitVector> statesPerObservation;
     std::vector<uint32_t> traceSoFar;
     storm::expressions::Variable svvar;
+
+    // The observations that are covered by the current unfolding
+    std::vector<uint32_t> unfoldedTrace;
+    // The rows (in CSR format) of all unfolded states that are not in the last step. These do not change if the trace is extended.
+    std::vector<uint64_t> unfoldedRowIndications;
+    std::vector<storm::storage::MatrixEntry<uint64_t, ValueType>> unfoldedEntries;
+    std::vector<uint64_t> unfoldedRowGroupIndices;
+    // For each unfolded state, the corresponding state of the model
+    std::vector<uint64_t> unfoldedToOld;
+    // The first unfolded state of the last step. The states of the last step are the unfolded states from this index on.
+    uint64_t lastStepStart;
 };
 
 }  // namespace pomdp
@@ -4,7 +4,7 @@
 
 #include "storm/adapters/RationalFunctionAdapter.h"
 #include "storm/storage/sparse/ModelComponents.h"
-#include "storm/utility/graph.h"
+#include "storm/utility/constants.h"
 
 #include "storm/exceptions/NotSupportedException.h"
 
@@ -20,27 +20,24 @@ PomdpMemoryUnfolder<ValueType>::PomdpMemoryUnfolder(storm::models::sparse::Pomdp
 
 template<typename ValueType>
 std::shared_ptr<storm::models::sparse::Pomdp<ValueType>> PomdpMemoryUnfolder<ValueType>::transform(bool dropUnreachableStates) const {
-    // For simplicity we first build the 'full' product of pomdp and memory (with pomdp.numStates * memory.numStates states).
     STORM_LOG_THROW(pomdp.isCanonic(), storm::exceptions::InvalidArgumentException, "POMDP must be canonical to unfold memory into it");
+    // Only the states of the product that are reachable from the initial states are built, so we never construct the 'full' product of pomdp and memory
+    // (with pomdp.numStates * memory.numStates states) if unreachable states are dropped.
+    storm::storage::BitVector reachableStates = dropUnreachableStates
+                                                    ? computeReachableStates()
+                                                    : storm::storage::BitVector(pomdp.getNumberOfStates() * memory.getNumberOfStates(), true);
     storm::storage::sparse::ModelComponents<ValueType> components;
-    components.transitionMatrix = transformTransitions();
+    components.transitionMatrix = transformTransitions(reachableStates);
     components.stateLabeling = transformStateLabeling();
-
-    // Now delete unreachable states.
-    storm::storage::BitVector allStates(components.transitionMatrix.getRowGroupCount(), true);
-
-    storm::storage::BitVector reachableStates = allStates;
     if (dropUnreachableStates) {
-        reachableStates =
-            storm::utility::graph::getReachableStates(components.transitionMatrix, components.stateLabeling.getStates("init"), allStates, ~allStates);
-        components.transitionMatrix = components.transitionMatrix.getSubmatrix(true, reachableStates, reachableStates);
         components.stateLabeling = components.stateLabeling.getSubLabeling(reachableStates);
         if (keepStateValuations && pomdp.hasStateValuations()) {
-            std::vector<uint64_t> newToOldStates(pomdp.getNumberOfStates() * memory.getNumberOfStates(), 0);
-            for (uint64_t newState = 0; newState < newToOldStates.size(); newState++) {
-                newToOldStates[newState] = getModelState(newState);
+            std::vector<uint64_t> newToOldStates;
+            newToOldStates.reserve(reachableStates.getNumberOfSetBits());
+            for (auto unfoldingState : reachableStates) {
+                newToOldStates.push_back(getModelState(unfoldingState));
             }
-            components.stateValuations = pomdp.getStateValuations().blowup(newToOldStates).selectStates(reachableStates);
+            components.stateValuations = pomdp.getStateValuations().blowup(newToOldStates);
         }
     }
 
@@ -54,35 +51,76 @@ std::shared_ptr<storm::models::sparse::Pomdp<ValueType>> PomdpMemoryUnfolder<Val
 }
 
 template<typename ValueType>
-storm::storage::SparseMatrix<ValueType> PomdpMemoryUnfolder<ValueType>::transformTransitions() const {
+storm::storage::BitVector PomdpMemoryUnfolder<ValueType>::computeReachableStates() const {
+    storm::storage::SparseMatrix<ValueType> const& origTransitions = pomdp.getTransitionMatrix();
+    storm::storage::BitVector reachableStates(pomdp.getNumberOfStates() * memory.getNumberOfStates(), false);
+    std::vector<uint64_t> stack;
+    for (auto const& modelState : pomdp.getInitialStates()) {
+        uint64_t const unfoldingState = getUnfoldingState(modelState, memory.getInitialState());
+        reachableStates.set(unfoldingState, true);
+        stack.push_back(unfoldingState);
+    }
+    while (!stack.empty()) {
+        uint64_t const unfoldingState = stack.back();
+        stack.pop_back();
+        uint64_t const modelState = getModelState(unfoldingState);
+        for (auto const& memStatePrime : memory.getTransitions(getMemoryState(unfoldingState))) {
+            for (auto const& entry : origTransitions.getRowGroup(modelState)) {
+                if (storm::utility::isZero(entry.getValue())) {
+                    continue;
+                }
+                uint64_t const successor = getUnfoldingState(entry.getColumn(), memStatePrime);
+                if (!reachableStates.get(successor)) {
+                    reachableStates.set(successor, true);
+                    stack.push_back(successor);
+                }
+            }
+        }
+    }
+    return reachableStates;
+}
+
+template<typename ValueType>
+storm::storage::SparseMatrix<ValueType> PomdpMemoryUnfolder<ValueType>::transformTransitions(storm::storage::BitVector const& reachableStates) const {
     storm::storage::SparseMatrix<ValueType> const& origTransitions = pomdp.getTransitionMatrix();
     uint64_t numRows = 0;
     uint64_t numEntries = 0;
-    for (uint64_t modelState = 0; modelState < pomdp.getNumberOfStates(); ++modelState) {
-        for (uint64_t memState = 0; memState < memory.getNumberOfStates(); ++memState) {
-            numRows += origTransitions.getRowGroupSize(modelState) * memory.getNumberOfOutgoingTransitions(memState);
-            numEntries += origTransitions.getRowGroup(modelState).getNumberOfEntries() * memory.getNumberOfOutgoingTransitions(memState);
-        }
+    for (auto const& unfoldingState : reachableStates) {
+        uint64_t const modelState = getModelState(unfoldingState);
+        uint64_t const numMemSuccessors = memory.getNumberOfOutgoingTransitions(getMemoryState(unfoldingState));
+        numRows += origTransitions.getRowGroupSize(modelState) * numMemSuccessors;
+        numEntries += origTransitions.getRowGroup(modelState).getNumberOfEntries() * numMemSuccessors;
     }
-    storm::storage::SparseMatrixBuilder<ValueType> builder(numRows, pomdp.getNumberOfStates() * memory.getNumberOfStates(), numEntries, true, true,
-                                                           pomdp.getNumberOfStates() * memory.getNumberOfStates());
 
-    uint64_t row = 0;
-    for (uint64_t modelState = 0; modelState < pomdp.getNumberOfStates(); ++modelState) {
-        for (uint64_t memState = 0; memState < memory.getNumberOfStates(); ++memState) {
-            builder.newRowGroup(row);
-            for (uint64_t origRow = origTransitions.getRowGroupIndices()[modelState]; origRow < origTransitions.getRowGroupIndices()[modelState + 1];
-                 ++origRow) {
-                for (auto const& memStatePrime : memory.getTransitions(memState)) {
-                    for (auto const& entry : origTransitions.getRow(origRow)) {
-                        builder.addNextValue(row, getUnfoldingState(entry.getColumn(), memStatePrime), entry.getValue());
+    // The matrix is written directly in compressed row format.
+    // Entries of each row are sorted by column as the unfolding states (and their new indices) are ordered by their model state first.
+    std::vector<uint64_t> newStateIndices = reachableStates.getNumberOfSetBitsBeforeIndices();
+    std::vector<uint64_t> rowIndications;
+    rowIndications.reserve(numRows + 1);
+    rowIndications.push_back(0);
+    std::vector<storm::storage::MatrixEntry<uint64_t, ValueType>> columnsAndValues;
+    columnsAndValues.reserve(numEntries);
+    std::vector<uint64_t> rowGroupIndices;
+    rowGroupIndices.reserve(reachableStates.getNumberOfSetBits() + 1);
+    for (auto const& unfoldingState : reachableStates) {
+        uint64_t const modelState = getModelState(unfoldingState);
+        rowGroupIndices.push_back(rowIndications.size() - 1);
+        for (uint64_t origRow = origTransitions.getRowGroupIndices()[modelState]; origRow < origTransitions.getRowGroupIndices()[modelState + 1]; ++origRow) {
+            for (auto const& memStatePrime : memory.getTransitions(getMemoryState(unfoldingState))) {
+                for (auto const& entry : origTransitions.getRow(origRow)) {
+                    uint64_t const successor = getUnfoldingState(entry.getColumn(), memStatePrime);
+                    // Only entries with value zero can lead to unreachable states.
+                    if (reachableStates.get(successor)) {
+                        columnsAndValues.emplace_back(newStateIndices[successor], entry.getValue());
                     }
-                    ++row;
                 }
+                rowIndications.push_back(columnsAndValues.size());
             }
         }
     }
-    return builder.build();
+    rowGroupIndices.push_back(rowIndications.size() - 1);
+    uint64_t const numColumns = rowGroupIndices.size() - 1;
+    return storm::storage::SparseMatrix<ValueType>(numColumns, std::move(rowIndications), std::move(columnsAndValues), std::move(rowGroupIndices));
 }
 
 template<typename ValueType>
@@ -16,7 +16,8 @@ class PomdpMemoryUnfolder {
     std::shared_ptr<storm::models::sparse::Pomdp<ValueType>> transform(bool dropUnreachableStates = true) const;
 
    private:
-    storm::storage::SparseMatrix<ValueType> transformTransitions() const;
+    storm::storage::BitVector computeReachableStates() const;
+    storm::storage::SparseMatrix<ValueType> transformTransitions(storm::storage::BitVector const& reachableStates) const;
     storm::models::sparse::StateLabeling transformStateLabeling() const;
     std::vector<uint32_t> transformObservabilityClasses(storm::storage::BitVector const& reachableStates) const;
     storm::models::sparse::StandardRewardModel<ValueType> transformRewardModel(storm::models::sparse::StandardRewardModel<ValueType> const& rewardModel,
@@ -19,7 +19,14 @@
 
 #ifdef STORM_HAVE_INTELTBB
 #include "tbb/blocked_range.h"
+#include "tbb/enumerable_thread_specific.h"
+#include "tbb/global_control.h"
 #include "tbb/parallel_for.h"
+#include "tbb/parallel_invoke.h"
+#include "tbb/parallel_reduce.h"
+#include "tbb/parallel_sort.h"
+#include "tbb/task_arena.h"
+#include "tbb/task_scheduler_observer.h"
 #include "tbb/tbb_stddef.h"
 #endif
 
@@ -71,4 +71,118 @@ std::string dumpJson(storm::json<ValueType> const& j, bool compact) {
 template std::string dumpJson(storm::json<double> const& j, bool compact = false);
 template std::string dumpJson(storm::json<storm::RationalNumber> const& j, bool compact = false);
 
+template<typename ValueType>
+JsonStreamWriter<ValueType>::JsonStreamWriter(std::ostream& stream, bool compact) : stream(stream), compact(compact) {
+    // Intentionally left empty.
+}
+
+template<typename ValueType>
+void JsonStreamWriter<ValueType>::beginObject() {
+    open('{');
+}
+
+template<typename ValueType>
+void JsonStreamWriter<ValueType>::endObject() {
+    close('}');
+}
+
+template<typename ValueType>
+void JsonStreamWriter<ValueType>::beginArray() {
+    open('[');
+}
+
+template<typename ValueType>
+void JsonStreamWriter<ValueType>::endArray() {
+    close(']');
+}
+
+template<typename ValueType>
+void JsonStreamWriter<ValueType>::key(std::string const& name) {
+    STORM_LOG_ASSERT(!scopeIsEmpty.empty() && !valuePending, "Unexpected key '" << name << "'.");
+    separate();
+    stream << storm::json<ValueType>(name).dump() << (compact ? ":" : ": ");
+    valuePending = true;
+}
+
+template<typename ValueType>
+void JsonStreamWriter<ValueType>::value(storm::json<ValueType> const& json) {
+    if (!valuePending) {
+        separate();
+    }
+    valuePending = false;
+    if constexpr (storm::NumberTraits<ValueType>::IsExact) {
+        json_for_each_number_float(json, [this](auto const& v_json) {
+            ++numberOfNumbers;
+            if (!isJsonNumberExportAccurate(v_json) && numberOfInaccurateNumbers++ == 0) {
+                std::stringstream message;
+                message << "Inaccurate JSON export: The number " << v_json.template get_ref<ValueType const&>() << " will be exported as " << v_json.dump()
+                        << ". ";
+                inaccuracyMessage = message.str();
+            }
+        });
+    }
+    if (compact) {
+        stream << json.dump();
+    } else {
+        // Subsequent lines of the dumped json have to be indented according to the current depth.
+        std::string const dumped = json.dump(4);
+        std::string const indentation(4 * scopeIsEmpty.size(), ' ');
+        std::size_t lineStart = 0;
+        for (std::size_t lineEnd = dumped.find('\n'); lineEnd != std::string::npos; lineEnd = dumped.find('\n', lineStart)) {
+            stream.write(dumped.data() + lineStart, lineEnd + 1 - lineStart);
+            stream << indentation;
+            lineStart = lineEnd + 1;
+        }
+        stream.write(dumped.data() + lineStart, dumped.size() - lineStart);
+    }
+    finishIfComplete();
+}
+
+template<typename ValueType>
+void JsonStreamWriter<ValueType>::open(char bracket) {
+    if (!valuePending) {
+        separate();
+    }
+    valuePending = false;
+    stream << bracket;
+    scopeIsEmpty.push_back(true);
+}
+
+template<typename ValueType>
+void JsonStreamWriter<ValueType>::close(char bracket) {
+    STORM_LOG_ASSERT(!scopeIsEmpty.empty() && !valuePending, "Unexpected end of json scope.");
+    bool isEmpty = scopeIsEmpty.back();
+    scopeIsEmpty.pop_back();
+    if (!compact && !isEmpty) {
+        stream << '\n' << std::string(4 * scopeIsEmpty.size(), ' ');
+    }
+    stream << bracket;
+    finishIfComplete();
+}
+
+template<typename ValueType>
+void JsonStreamWriter<ValueType>::separate() {
+    if (scopeIsEmpty.empty()) {
+        return;
+    }
+    if (!scopeIsEmpty.back()) {
+        stream << ',';
+    }
+    scopeIsEmpty.back() = false;
+    if (!compact) {
+        stream << '\n' << std::string(4 * scopeIsEmpty.size(), ' ');
+    }
+}
+
+template<typename ValueType>
+void JsonStreamWriter<ValueType>::finishIfComplete() {
+    if (scopeIsEmpty.empty()) {
+        STORM_LOG_WARN_COND(numberOfInaccurateNumbers == 0,
+                            inaccuracyMessage << "In total, " << numberOfInaccurateNumbers << " of " << numberOfNumbers << " numbers are inaccurate.");
+    }
+}
+
+template class JsonStreamWriter<double>;
+template class JsonStreamWriter<storm::RationalNumber>;
+
 }  // namespace storm
\ No newline at end of file
@@ -1,5 +1,60 @@
 #pragma once
 
+#include <ostream>
+#include <string>
+#include <vector>
+
 // Modernjson JSON parser
 #include "nlohmann/json.hpp"
 #include "storm/adapters/JsonForward.h"
+
+namespace storm {
+
+/*!
+ * Writes json incrementally such that large arrays and objects do not need to be kept in memory. Arrays and objects are opened and closed explicitly,
+ * (small) parts of the document can be given as json objects. If the members of objects are written in the order of their keys, the formatting
+ * matches the one of storm::dumpJson.
+ * If the ValueType is exact, a warning is printed once the document is complete if one or more numbers can not be exported with full accuracy.
+ */
+template<typename ValueType>
+class JsonStreamWriter {
+   public:
+    /*!
+     * @param stream The stream to which the document is written.
+     * @param compact indicates whether the export should be done in compact mode (no unnecessary whitespace)
+     */
+    JsonStreamWriter(std::ostream& stream, bool compact = false);
+
+    void beginObject();
+    void endObject();
+    void beginArray();
+    void endArray();
+
+    /*!
+     * Writes the key of the next member of the currently open object. The value of the member has to be written next.
+     */
+    void key(std::string const& name);
+
+    /*!
+     * Writes the given json as the next element of the currently open array, as the value of the previously written key or as the whole document.
+     */
+    void value(storm::json<ValueType> const& json);
+
+   private:
+    void open(char bracket);
+    void close(char bracket);
+    void separate();
+    void finishIfComplete();
+
+    std::ostream& stream;
+    bool compact;
+    bool valuePending{false};
+    // Whether the currently open arrays and objects are still empty.
+    std::vector<bool> scopeIsEmpty;
+
+    uint64_t numberOfNumbers{0};
+    uint64_t numberOfInaccurateNumbers{0};
+    std::string inaccuracyMessage;
+};
+
+}  // namespace storm
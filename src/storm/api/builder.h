@@ -108,6 +108,44 @@ std::shared_ptr<storm::models::sparse::Model<ValueType>> buildSparseModel(storm:
     return builder.build();
 }
 
+/**
+ * Builds a sparse model for the given PRISM program, whose reachable states are computed symbolically (using decision diagrams). Only the
+ * transitions of these states are then built explicitly, which is done in parallel if multiple exploration threads are set in the settings.
+ * In contrast to building a symbolic model and translating it, this neither builds rewards and labels symbolically nor translates the
+ * symbolic transition matrix.
+ * @param model The model description, which needs to be a PRISM program
+ * @param options Builder options
+ * @return The sparse model
+ */
+template<storm::dd::DdType LibraryType, typename ValueType>
+std::shared_ptr<storm::models::sparse::Model<ValueType>> buildSparseModelWithSymbolicReachability(storm::storage::SymbolicModelDescription const& model,
+                                                                                                  storm::builder::BuilderOptions const& options) {
+    STORM_LOG_THROW(model.isPrismProgram(), storm::exceptions::NotSupportedException, "Symbolic reachability is only supported for PRISM programs.");
+    storm::prism::Program const& program = model.asPrismProgram();
+    storm::builder::ExplicitModelBuilder<ValueType> builder(program, options);
+    if (!storm::builder::DdPrismModelBuilder<LibraryType, ValueType>::canHandle(program) ||
+        (program.getModelType() != storm::prism::Program::ModelType::DTMC && program.getModelType() != storm::prism::Program::ModelType::CTMC &&
+         program.getModelType() != storm::prism::Program::ModelType::MDP)) {
+        STORM_LOG_WARN("The reachable states of this program can not be computed symbolically. Searching for them explicitly instead.");
+        return builder.build();
+    }
+
+    // The terminal states need to be the same as for the explicit exploration, as otherwise states beyond them would be part of the model.
+    typename storm::builder::DdPrismModelBuilder<LibraryType, ValueType>::Options ddOptions;
+    for (auto const& terminalState : options.getTerminalStates()) {
+        if (terminalState.first.isExpression()) {
+            (terminalState.second ? ddOptions.terminalStates.terminalExpressions : ddOptions.terminalStates.negatedTerminalExpressions)
+                .push_back(terminalState.first.getExpression());
+        } else {
+            (terminalState.second ? ddOptions.terminalStates.terminalLabels : ddOptions.terminalStates.negatedTerminalLabels)
+                .push_back(terminalState.first.getLabel());
+        }
+    }
+    builder.setReachableStates(
+        storm::builder::DdPrismModelBuilder<LibraryType, ValueType>().buildReachableStates(program, builder.getVariableInformation(), ddOptions));
+    return builder.build();
+}
+
 template<typename ValueType>
 std::shared_ptr<storm::models::sparse::Model<ValueType>> buildSparseModel(storm::storage::SymbolicModelDescription const& model,
                                                                           std::vector<std::shared_ptr<storm::logic::Formula const>> const& formulas) {
@@ -1,5 +1,7 @@
 #include "storm/api/export.h"
+#include "storm/io/JsonBinaryEncoding.h"
 #include "storm/storage/jani/JaniLocationExpander.h"
+#include "storm/storage/jani/visitor/JSONExporter.h"
 
 namespace storm {
 namespace api {
@@ -11,5 +13,9 @@ void exportJaniModelAsDot(storm::jani::Model const& model, std::string const& fi
     storm::utility::closeFile(out);
 }
 
+void exportJaniModelAsBinary(storm::jani::Model const& model, std::vector<storm::jani::Property> const& properties, std::string const& filename) {
+    storm::exporter::exportJsonBinary(storm::jani::JsonExporter::toJson(model, properties, true, false), filename);
+}
+
 }  // namespace api
 }  // namespace storm
@@ -1,5 +1,7 @@
 #pragma once
 
+#include <type_traits>
+
 #include "storm/adapters/JsonForward.h"
 #include "storm/exceptions/NotSupportedException.h"
 #include "storm/io/DDEncodingExporter.h"
@@ -15,23 +17,43 @@ namespace storm {
 
 namespace jani {
 class Model;
-}
+class Property;
+}  // namespace jani
 
 namespace api {
 
 void exportJaniModelAsDot(storm::jani::Model const& model, std::string const& filename);
 
+/*!
+ * Stores the given JANI model and properties in a compact binary encoding of the JANI json structure.
+ * The file can be loaded with the JANI parser (e.g. storm::api::parseJaniModel), which avoids repeating expensive preprocessing steps.
+ */
+void exportJaniModelAsBinary(storm::jani::Model const& model, std::vector<storm::jani::Property> const& properties, std::string const& filename);
+
 template<typename ValueType>
 void exportSparseModelAsDrn(std::shared_ptr<storm::models::sparse::Model<ValueType>> const& model, std::string const& filename,
-                            std::vector<std::string> const& parameterNames = {}, bool allowPlaceholders = true) {
+                            std::vector<std::string> const& parameterNames = {}, bool allowPlaceholders = true, uint64_t numberOfThreads = 1) {
     std::ofstream stream;
     storm::utility::openFile(filename, stream);
     storm::exporter::DirectEncodingOptions options;
     options.allowPlaceholders = allowPlaceholders;
+    options.numberOfThreads = numberOfThreads;
     storm::exporter::explicitExportSparseModel(stream, model, parameterNames, options);
     storm::utility::closeFile(stream);
 }
 
+template<typename ValueType>
+void exportSparseModelAsDrnb(std::shared_ptr<storm::models::sparse::Model<ValueType>> const& model, std::string const& filename) {
+    if constexpr (std::is_same_v<ValueType, double>) {
+        std::ofstream stream;
+        storm::utility::openFile(filename, stream);
+        storm::exporter::binaryExportSparseModel(stream, model);
+        storm::utility::closeFile(stream);
+    } else {
+        STORM_LOG_THROW(false, storm::exceptions::NotSupportedException, "The binary encoding only supports models with double values.");
+    }
+}
+
 template<storm::dd::DdType Type, typename ValueType>
 void exportSymbolicModelAsDrdd(std::shared_ptr<storm::models::symbolic::Model<Type, ValueType>> const& model, std::string const& filename) {
     storm::exporter::explicitExportSymbolicModel(filename, model);
@@ -64,8 +86,11 @@ void exportScheduler(std::shared_ptr<storm::models::sparse::Model<ValueType>> co
     std::ofstream stream;
     storm::utility::openFile(filename, stream);
     std::string jsonFileExtension = ".json";
+    std::string csvFileExtension = ".csv";
     if (filename.size() > 4 && std::equal(jsonFileExtension.rbegin(), jsonFileExtension.rend(), filename.rbegin())) {
         scheduler.printJsonToStream(stream, model, false, true);
+    } else if (filename.size() > 3 && std::equal(csvFileExtension.rbegin(), csvFileExtension.rend(), filename.rbegin())) {
+        scheduler.printCsvToStream(stream, model, false, true);
     } else {
         scheduler.printToStream(stream, model, false, true);
     }
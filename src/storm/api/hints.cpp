@@ -0,0 +1,182 @@
+#include "storm/api/hints.h"
+
+#include <fstream>
+#include <map>
+#include <set>
+
+#include "storm/adapters/JsonAdapter.h"
+#include "storm/adapters/RationalNumberAdapter.h"
+#include "storm/exceptions/NotSupportedException.h"
+#include "storm/exceptions/WrongFormatException.h"
+#include "storm/io/file.h"
+#include "storm/modelchecker/results/ExplicitQuantitativeCheckResult.h"
+#include "storm/storage/Scheduler.h"
+#include "storm/storage/sparse/ChoiceOrigins.h"
+#include "storm/utility/constants.h"
+#include "storm/utility/macros.h"
+
+namespace storm {
+namespace api {
+
+typedef storm::json<storm::RationalNumber> HintJson;
+
+template<typename ValueType>
+void exportHint(std::shared_ptr<storm::models::sparse::Model<ValueType>> const& model, storm::modelchecker::CheckResult const& result,
+                std::string const& filename) {
+    STORM_LOG_THROW(result.isExplicitQuantitativeCheckResult(), storm::exceptions::NotSupportedException,
+                    "Export of hints is only supported for explicit quantitative check results.");
+    auto const& quantitativeResult = result.template asExplicitQuantitativeCheckResult<ValueType>();
+    STORM_LOG_THROW(quantitativeResult.isResultForAllStates(), storm::exceptions::NotSupportedException,
+                    "Export of hints is only supported for results for all states.");
+    std::ofstream stream;
+    storm::utility::openFile(filename, stream);
+    stream << "{\"values\": " << storm::dumpJson(quantitativeResult.toJson(model->getOptionalStateValuations()));
+    if (quantitativeResult.hasScheduler()) {
+        stream << ", \"scheduler\": " << storm::dumpJson(quantitativeResult.getScheduler().toJson(model, false, true));
+    }
+    stream << "}\n";
+    storm::utility::closeFile(stream);
+}
+
+namespace detail {
+
+/*!
+ * Finds the states of the given model that are referred to in a hint.
+ */
+template<typename ValueType>
+class HintStateIdentifier {
+   public:
+    HintStateIdentifier(storm::models::sparse::Model<ValueType> const& model) : numberOfStates(model.getNumberOfStates()) {
+        if (model.hasStateValuations()) {
+            for (uint64_t state = 0; state < numberOfStates; ++state) {
+                valuationToState.emplace(storm::dumpJson(model.getStateValuations().template toJson<storm::RationalNumber>(state), true), state);
+            }
+        }
+    }
+
+    // Returns the state referred to by the given json or numberOfStates if there is no such state.
+    uint64_t getState(HintJson const& stateJson) const {
+        if (stateJson.is_number_integer()) {
+            uint64_t state = stateJson.template get<uint64_t>();
+            return state < numberOfStates ? state : numberOfStates;
+        }
+        auto findRes = valuationToState.find(storm::dumpJson(stateJson, true));
+        return findRes == valuationToState.end() ? numberOfStates : findRes->second;
+    }
+
+   private:
+    uint64_t numberOfStates;
+    std::map<std::string, uint64_t> valuationToState;
+};
+
+template<typename ValueType>
+ValueType parseHintValue(HintJson const& valueJson) {
+    if (valueJson.is_number_float()) {
+        return storm::utility::convertNumber<ValueType>(valueJson.template get<storm::RationalNumber>());
+    }
+    STORM_LOG_THROW(valueJson.is_number_integer(), storm::exceptions::WrongFormatException, "Unexpected value '" << valueJson << "' in hint.");
+    return storm::utility::convertNumber<ValueType>(storm::utility::convertNumber<storm::RationalNumber, int64_t>(valueJson.template get<int64_t>()));
+}
+
+// Returns the local index of the choice of the given state that corresponds to the given json or the number of choices if there is no such choice.
+template<typename ValueType>
+uint64_t getHintChoice(storm::models::sparse::Model<ValueType> const& model, uint64_t state, HintJson const& choiceJson) {
+    auto const& rowGroupIndices = model.getTransitionMatrix().getRowGroupIndices();
+    uint64_t const numberOfChoices = rowGroupIndices[state + 1] - rowGroupIndices[state];
+    if (choiceJson.count("origin") > 0 && model.hasChoiceOrigins()) {
+        for (uint64_t localChoice = 0; localChoice < numberOfChoices; ++localChoice) {
+            if (model.getChoiceOrigins()->getChoiceAsJson(rowGroupIndices[state] + localChoice) == choiceJson["origin"]) {
+                return localChoice;
+            }
+        }
+    } else if (choiceJson.count("labels") > 0 && model.hasChoiceLabeling()) {
+        auto const labelVector = choiceJson["labels"].template get<std::vector<std::string>>();
+        std::set<std::string> labels(labelVector.begin(), labelVector.end());
+        for (uint64_t localChoice = 0; localChoice < numberOfChoices; ++localChoice) {
+            if (model.getChoiceLabeling().getLabelsOfChoice(rowGroupIndices[state] + localChoice) == labels) {
+                return localChoice;
+            }
+        }
+    }
+    return numberOfChoices;
+}
+
+}  // namespace detail
+
+template<typename ValueType>
+std::shared_ptr<storm::modelchecker::ExplicitModelCheckerHint<ValueType>> importHint(std::shared_ptr<storm::models::sparse::Model<ValueType>> const& model,
+                                                                                     std::string const& filename) {
+    std::ifstream stream;
+    storm::utility::openFile(filename, stream);
+    HintJson hintJson = HintJson::parse(stream);
+    storm::utility::closeFile(stream);
+    STORM_LOG_THROW(hintJson.count("values") > 0, storm::exceptions::WrongFormatException, "The hint in file " << filename << " does not contain values.");
+
+    detail::HintStateIdentifier<ValueType> stateIdentifier(*model);
+    uint64_t const numberOfStates = model->getNumberOfStates();
+    auto result = std::make_shared<storm::modelchecker::ExplicitModelCheckerHint<ValueType>>();
+
+    std::vector<ValueType> values(numberOfStates, storm::utility::zero<ValueType>());
+    uint64_t numberOfUnknownStates = 0;
+    for (auto const& entry : hintJson["values"]) {
+        uint64_t state = stateIdentifier.getState(entry.at("s"));
+        if (state < numberOfStates) {
+            values[state] = detail::parseHintValue<ValueType>(entry.at("v"));
+        } else {
+            ++numberOfUnknownStates;
+        }
+    }
+    STORM_LOG_WARN_COND(numberOfUnknownStates == 0, "Ignoring the values of " << numberOfUnknownStates << " states of the hint that are not in the model.");
+    result->setResultHint(std::move(values));
+
+    if (hintJson.count("scheduler") > 0 && model->isNondeterministicModel()) {
+        storm::storage::Scheduler<ValueType> scheduler(numberOfStates);
+        for (uint64_t state = 0; state < numberOfStates; ++state) {
+            scheduler.setChoice(0, state);
+        }
+        uint64_t numberOfUnmatchedChoices = 0;
+        for (auto const& entry : hintJson["scheduler"]) {
+            STORM_LOG_THROW(entry.count("m") == 0, storm::exceptions::NotSupportedException, "Scheduler hints with memory are not supported.");
+            uint64_t state = stateIdentifier.getState(entry.at("s"));
+            if (state >= numberOfStates || !entry.at("c").is_array()) {
+                continue;
+            }
+            // Take the choice with the highest probability.
+            HintJson const* bestChoice = nullptr;
+            for (auto const& choiceJson : entry["c"]) {
+                if (!bestChoice || detail::parseHintValue<storm::RationalNumber>(choiceJson.at("prob")) >
+                                       detail::parseHintValue<storm::RationalNumber>(bestChoice->at("prob"))) {
+                    bestChoice = &choiceJson;
+                }
+            }
+            if (bestChoice) {
+                uint64_t localChoice = detail::getHintChoice(*model, state, *bestChoice);
+                if (localChoice < model->getTransitionMatrix().getRowGroupSize(state)) {
+                    scheduler.setChoice(localChoice, state);
+                } else {
+                    ++numberOfUnmatchedChoices;
+                }
+            }
+        }
+        STORM_LOG_WARN_COND(numberOfUnmatchedChoices == 0, "Could not identify " << numberOfUnmatchedChoices
+                                                                                 << " choices of the scheduler hint. Building the model with choice origins "
+                                                                                    "or choice labels might help.");
+        result->setSchedulerHint(std::move(scheduler));
+    }
+    return result;
+}
+
+template void exportHint<double>(std::shared_ptr<storm::models::sparse::Model<double>> const&, storm::modelchecker::CheckResult const&, std::string const&);
+template void exportHint<storm::RationalNumber>(std::shared_ptr<storm::models::sparse::Model<storm::RationalNumber>> const&,
+                                                storm::modelchecker::CheckResult const&, std::string const&);
+template std::shared_ptr<storm::modelchecker::ExplicitModelCheckerHint<double>> importHint<double>(
+    std::shared_ptr<storm::models::sparse::Model<double>> const&, std::string const&);
+template std::shared_ptr<storm::modelchecker::ExplicitModelCheckerHint<storm::RationalNumber>> importHint<storm::RationalNumber>(
+    std::shared_ptr<storm::models::sparse::Model<storm::RationalNumber>> const&, std::string const&);
+template void exportHint<storm::RationalFunction>(std::shared_ptr<storm::models::sparse::Model<storm::RationalFunction>> const&,
+                                                  storm::modelchecker::CheckResult const&, std::string const&);
+template std::shared_ptr<storm::modelchecker::ExplicitModelCheckerHint<storm::RationalFunction>> importHint<storm::RationalFunction>(
+    std::shared_ptr<storm::models::sparse::Model<storm::RationalFunction>> const&, std::string const&);
+
+}  // namespace api
+}  // namespace storm
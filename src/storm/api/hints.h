@@ -0,0 +1,38 @@
+#pragma once
+
+#include <memory>
+#include <string>
+
+#include "storm/modelchecker/hints/ExplicitModelCheckerHint.h"
+#include "storm/modelchecker/results/CheckResult.h"
+#include "storm/models/sparse/Model.h"
+
+namespace storm {
+namespace api {
+
+/*!
+ * Exports the given (unfiltered) result and, if present, its scheduler such that they can serve as hints when checking the same property on a (possibly
+ * slightly modified) model later on. States are identified by their valuations if the model has state valuations and by their index otherwise.
+ *
+ * @param model The model that was checked.
+ * @param result The result, which needs to be an explicit quantitative check result for all states.
+ * @param filename The output file. The export will be in json.
+ */
+template<typename ValueType>
+void exportHint(std::shared_ptr<storm::models::sparse::Model<ValueType>> const& model, storm::modelchecker::CheckResult const& result,
+                std::string const& filename);
+
+/*!
+ * Imports a hint that was exported with exportHint. As states are identified by their valuations, the hint survives a renumbering of the states.
+ * States that do not occur in the hint get the value zero and the first choice. Choices are identified by their origins or labels, if available.
+ *
+ * @param model The model that is to be checked.
+ * @param filename The file that contains the hint.
+ * @return The hint, containing a result hint and, if present in the file, a scheduler hint.
+ */
+template<typename ValueType>
+std::shared_ptr<storm::modelchecker::ExplicitModelCheckerHint<ValueType>> importHint(std::shared_ptr<storm::models::sparse::Model<ValueType>> const& model,
+                                                                                     std::string const& filename);
+
+}  // namespace api
+}  // namespace storm
@@ -3,6 +3,7 @@
 #include "storm/api/bisimulation.h"
 #include "storm/api/builder.h"
 #include "storm/api/export.h"
+#include "storm/api/hints.h"
 #include "storm/api/properties.h"
 #include "storm/api/transformation.h"
 #include "storm/api/verification.h"
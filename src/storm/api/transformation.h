@@ -2,6 +2,7 @@
 
 #include "storm/transformer/ContinuousToDiscreteTimeModelTransformer.h"
 #include "storm/transformer/NonMarkovianChainTransformer.h"
+#include "storm/transformer/StatePermuter.h"
 #include "storm/transformer/SymbolicToSparseTransformer.h"
 
 #include "storm/exceptions/InvalidOperationException.h"
@@ -146,5 +147,16 @@ std::shared_ptr<storm::models::sparse::Model<ValueType>> transformToNondetermini
     }
 }
 
+/*!
+ * Reorders the states of the given model according to the given order. Can be used to improve the memory locality of the solvers.
+ * @param inverseStatePermutation if given, the i'th entry of this vector is set to the state of the given model that corresponds to state i of the result.
+ */
+template<typename ValueType>
+std::shared_ptr<storm::models::sparse::Model<ValueType>> permuteModelStates(std::shared_ptr<storm::models::sparse::Model<ValueType>> const& model,
+                                                                            storm::utility::permutation::OrderKind order,
+                                                                            std::vector<uint64_t>* inverseStatePermutation = nullptr) {
+    return storm::transformer::permuteStates(*model, order, inverseStatePermutation);
+}
+
 }  // namespace api
 }  // namespace storm
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <mutex>
 #include <type_traits>
 
 #include "storm/environment/Environment.h"
@@ -17,19 +18,27 @@
 #include "storm/modelchecker/prctl/SymbolicMdpPrctlModelChecker.h"
 #include "storm/modelchecker/reachability/SparseDtmcEliminationModelChecker.h"
 #include "storm/modelchecker/rpatl/SparseSmgRpatlModelChecker.h"
+#include "storm/modelchecker/smc/StatisticalModelChecker.h"
 
 #include "storm/models/symbolic/Dtmc.h"
 #include "storm/models/symbolic/MarkovAutomaton.h"
 #include "storm/models/symbolic/Mdp.h"
 
 #include "storm/models/sparse/Dtmc.h"
+#include "storm/models/sparse/MarkovAutomaton.h"
 #include "storm/models/sparse/Mdp.h"
 #include "storm/models/sparse/Smg.h"
 
+#include "storm/environment/solver/MinMaxSolverEnvironment.h"
+#include "storm/environment/solver/SolverEnvironment.h"
+#include "storm/solver/AutomaticMinMaxMethodSelection.h"
+#include "storm/utility/Stopwatch.h"
+
 #include "storm/settings/SettingsManager.h"
 #include "storm/settings/modules/AbstractionSettings.h"
 #include "storm/settings/modules/CoreSettings.h"
 #include "storm/settings/modules/EliminationSettings.h"
+#include "storm/settings/modules/StatisticalModelCheckingSettings.h"
 
 #include "storm/exceptions/NotImplementedException.h"
 #include "storm/exceptions/NotSupportedException.h"
@@ -54,23 +63,27 @@ template<typename ValueType>
 typename std::enable_if<std::is_same<ValueType, double>::value, std::unique_ptr<storm::modelchecker::CheckResult>>::type verifyWithExplorationEngine(
     storm::Environment const& env, storm::storage::SymbolicModelDescription const& model,
     storm::modelchecker::CheckTask<storm::logic::Formula, ValueType> const& task) {
-    STORM_LOG_THROW(model.isPrismProgram(), storm::exceptions::NotSupportedException, "Exploration engine is currently only applicable to PRISM models.");
-    storm::prism::Program const& program = model.asPrismProgram();
+    STORM_LOG_THROW(model.isPrismProgram() || model.isJaniModel(), storm::exceptions::NotSupportedException,
+                    "Exploration engine is only applicable to PRISM and JANI models.");
 
     std::unique_ptr<storm::modelchecker::CheckResult> result;
-    if (program.getModelType() == storm::prism::Program::ModelType::DTMC) {
-        storm::modelchecker::SparseExplorationModelChecker<storm::models::sparse::Dtmc<ValueType>> checker(program);
-        if (checker.canHandle(task)) {
-            result = checker.check(env, task);
+    if (model.getModelType() == storm::storage::SymbolicModelDescription::ModelType::DTMC) {
+        typedef storm::modelchecker::SparseExplorationModelChecker<storm::models::sparse::Dtmc<ValueType>> CheckerType;
+        std::unique_ptr<CheckerType> checker =
+            model.isPrismProgram() ? std::make_unique<CheckerType>(model.asPrismProgram()) : std::make_unique<CheckerType>(model.asJaniModel());
+        if (checker->canHandle(task)) {
+            result = checker->check(env, task);
         }
-    } else if (program.getModelType() == storm::prism::Program::ModelType::MDP) {
-        storm::modelchecker::SparseExplorationModelChecker<storm::models::sparse::Mdp<ValueType>> checker(program);
-        if (checker.canHandle(task)) {
-            result = checker.check(env, task);
+    } else if (model.getModelType() == storm::storage::SymbolicModelDescription::ModelType::MDP) {
+        typedef storm::modelchecker::SparseExplorationModelChecker<storm::models::sparse::Mdp<ValueType>> CheckerType;
+        std::unique_ptr<CheckerType> checker =
+            model.isPrismProgram() ? std::make_unique<CheckerType>(model.asPrismProgram()) : std::make_unique<CheckerType>(model.asJaniModel());
+        if (checker->canHandle(task)) {
+            result = checker->check(env, task);
         }
     } else {
         STORM_LOG_THROW(false, storm::exceptions::NotSupportedException,
-                        "The model type " << program.getModelType() << " is not supported by the exploration engine.");
+                        "The model type " << model.getModelType() << " is not supported by the exploration engine.");
     }
 
     return result;
@@ -89,6 +102,50 @@ std::unique_ptr<storm::modelchecker::CheckResult> verifyWithExplorationEngine(st
     return verifyWithExplorationEngine(env, model, task);
 }
 
+//
+// Verifying with Statistical engine
+//
+template<typename ValueType>
+typename std::enable_if<std::is_same<ValueType, double>::value, std::unique_ptr<storm::modelchecker::CheckResult>>::type verifyWithStatisticalEngine(
+    storm::Environment const& env, storm::storage::SymbolicModelDescription const& model,
+    storm::modelchecker::CheckTask<storm::logic::Formula, ValueType> const& task) {
+    STORM_LOG_THROW(model.isPrismProgram(), storm::exceptions::NotSupportedException,
+                    "Statistical model checking is currently only applicable to PRISM models.");
+    storm::prism::Program const& program = model.asPrismProgram();
+    STORM_LOG_THROW(program.getModelType() == storm::prism::Program::ModelType::DTMC, storm::exceptions::NotSupportedException,
+                    "The model type " << program.getModelType() << " is not supported by the statistical model checking engine.");
+
+    auto const& smcSettings = storm::settings::getModule<storm::settings::modules::StatisticalModelCheckingSettings>();
+    typename storm::modelchecker::StatisticalModelChecker<storm::models::sparse::Dtmc<ValueType>>::Options options;
+    options.numberOfThreads = smcSettings.getNumberOfThreads();
+    options.seed = smcSettings.getSeed();
+    options.batchSize = smcSettings.getBatchSize();
+    options.maxPaths = smcSettings.getMaximalNumberOfPaths();
+    options.confidence = smcSettings.getConfidence();
+    options.precision = smcSettings.getPrecision();
+    options.indifference = smcSettings.getIndifference();
+
+    std::unique_ptr<storm::modelchecker::CheckResult> result;
+    storm::modelchecker::StatisticalModelChecker<storm::models::sparse::Dtmc<ValueType>> checker(program, options);
+    if (checker.canHandle(task)) {
+        result = checker.check(env, task);
+    }
+    return result;
+}
+
+template<typename ValueType>
+typename std::enable_if<!std::is_same<ValueType, double>::value, std::unique_ptr<storm::modelchecker::CheckResult>>::type verifyWithStatisticalEngine(
+    storm::Environment const&, storm::storage::SymbolicModelDescription const&, storm::modelchecker::CheckTask<storm::logic::Formula, ValueType> const&) {
+    STORM_LOG_THROW(false, storm::exceptions::NotSupportedException, "Statistical model checking does not support data type.");
+}
+
+template<typename ValueType>
+std::unique_ptr<storm::modelchecker::CheckResult> verifyWithStatisticalEngine(storm::storage::SymbolicModelDescription const& model,
+                                                                              storm::modelchecker::CheckTask<storm::logic::Formula, ValueType> const& task) {
+    Environment env;
+    return verifyWithStatisticalEngine(env, model, task);
+}
+
 //
 // Verifying with Sparse engine
 //
@@ -142,6 +199,21 @@ template<typename ValueType>
 typename std::enable_if<!std::is_same<ValueType, storm::RationalFunction>::value, std::unique_ptr<storm::modelchecker::CheckResult>>::type
 verifyWithSparseEngine(storm::Environment const& env, std::shared_ptr<storm::models::sparse::Mdp<ValueType>> const& mdp,
                        storm::modelchecker::CheckTask<storm::logic::Formula, ValueType> const& task) {
+    if constexpr (std::is_same_v<ValueType, double> || std::is_same_v<ValueType, storm::RationalNumber>) {
+        if (env.solver().minMax().isMethodAutomatic()) {
+            // Select the min/max method based on the transition matrix and record how long checking took.
+            storm::Environment selectedEnv = env;
+            auto const signature = storm::solver::selectMinMaxMethodAutomatically(selectedEnv, mdp->getTransitionMatrix());
+            storm::utility::Stopwatch watch(true);
+            auto result = verifyWithSparseEngine(selectedEnv, mdp, task);
+            watch.stop();
+            if (auto const& historyFile = selectedEnv.solver().minMax().getAutomaticMethodHistoryFile()) {
+                storm::solver::MinMaxMethodHistory(historyFile.get())
+                    .recordTime(signature, selectedEnv.solver().minMax().getMethod(), watch.getTimeInMilliseconds() / 1000.0);
+            }
+            return result;
+        }
+    }
     std::unique_ptr<storm::modelchecker::CheckResult> result;
     storm::modelchecker::SparseMdpPrctlModelChecker<storm::models::sparse::Mdp<ValueType>> modelchecker(*mdp);
     if (modelchecker.canHandle(task)) {
@@ -264,6 +336,86 @@ std::unique_ptr<storm::modelchecker::CheckResult> verifyWithSparseEngine(std::sh
     return verifyWithSparseEngine(env, model, task);
 }
 
+/*!
+ * Checks properties on a fixed sparse model with the sparse engine.
+ * In contrast to calling verifyWithSparseEngine for each property, a session is created once per model. Analyses that do not depend on the property
+ * (backward transitions, qualitative state sets and end components, see storm::models::sparse::AnalysisCache) as well as the automatic selection
+ * of the min-max method are then shared between all properties checked in the session.
+ * Properties may be checked concurrently from several threads, as long as the model is not modified while the session is in use.
+ */
+template<typename ValueType>
+class SparseVerificationSession {
+   public:
+    /*!
+     * Creates a session for the given model and performs the property-independent precomputations.
+     * @param env The environment that is used for all checks.
+     */
+    SparseVerificationSession(std::shared_ptr<storm::models::sparse::Model<ValueType>> const& model, storm::Environment const& env = storm::Environment())
+        : model(model), env(env) {
+        // Binds the analysis cache of the model, such that all subsequent checks share it.
+        this->model->getCachedBackwardTransitions();
+        if (this->model->isOfType(storm::models::ModelType::MarkovAutomaton)) {
+            // Zenoness is determined lazily, which must not happen concurrently.
+            auto ma = this->model->template as<storm::models::sparse::MarkovAutomaton<ValueType>>();
+            if (ma->isClosed()) {
+                ma->containsZenoCycle();
+            }
+        }
+        if constexpr (std::is_same_v<ValueType, double> || std::is_same_v<ValueType, storm::RationalNumber>) {
+            if (this->model->isOfType(storm::models::ModelType::Mdp) && this->env.solver().minMax().isMethodAutomatic()) {
+                minMaxSignature = storm::solver::selectMinMaxMethodAutomatically(this->env, this->model->getTransitionMatrix());
+            }
+        }
+    }
+
+    /*!
+     * Checks the given task on the model of this session.
+     * @return the result of the check or nullptr if the task can not be handled by the sparse engine.
+     */
+    std::unique_ptr<storm::modelchecker::CheckResult> check(storm::modelchecker::CheckTask<storm::logic::Formula, ValueType> const& task) const {
+        if (!minMaxSignature) {
+            return verifyWithSparseEngine(env, model, task);
+        }
+        storm::utility::Stopwatch watch(true);
+        auto result = verifyWithSparseEngine(env, model, task);
+        watch.stop();
+        if (auto const& historyFile = env.solver().minMax().getAutomaticMethodHistoryFile()) {
+            std::lock_guard<std::mutex> lock(historyMutex);
+            storm::solver::MinMaxMethodHistory(historyFile.get())
+                .recordTime(minMaxSignature.get(), env.solver().minMax().getMethod(), watch.getTimeInMilliseconds() / 1000.0);
+        }
+        return result;
+    }
+
+    /*!
+     * Checks the given formula on the model of this session.
+     * @return the result of the check or nullptr if the formula can not be handled by the sparse engine.
+     */
+    std::unique_ptr<storm::modelchecker::CheckResult> check(std::shared_ptr<storm::logic::Formula const> const& formula,
+                                                            bool onlyInitialStatesRelevant = false) const {
+        return check(createTask<ValueType>(formula, onlyInitialStatesRelevant));
+    }
+
+    std::shared_ptr<storm::models::sparse::Model<ValueType>> const& getModel() const {
+        return model;
+    }
+
+    /*!
+     * @return the environment used for all checks. If the min-max method was selected automatically, the selected method is set.
+     */
+    storm::Environment const& getEnvironment() const {
+        return env;
+    }
+
+   private:
+    std::shared_ptr<storm::models::sparse::Model<ValueType>> model;
+    storm::Environment env;
+    // The signature of the min-max problem (if the min-max method was selected automatically).
+    boost::optional<std::string> minMaxSignature;
+    // Serializes the appending of solving times to the history file.
+    mutable std::mutex historyMutex;
+};
+
 template<typename ValueType>
 std::unique_ptr<storm::modelchecker::CheckResult> computeSteadyStateDistributionWithSparseEngine(
     storm::Environment const& env, std::shared_ptr<storm::models::sparse::Dtmc<ValueType>> const& dtmc) {
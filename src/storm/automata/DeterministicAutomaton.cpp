@@ -9,9 +9,126 @@
 #include "storm/utility/macros.h"
 
 #include "storm/exceptions/FileIoException.h"
+#include "storm/exceptions/WrongFormatException.h"
+
+#include <algorithm>
+#include <cstring>
 
 namespace storm {
 namespace automata {
+namespace {
+// Magic bytes at the beginning of binary automata
+constexpr char binaryMagic[8] = {'S', 'T', 'O', 'R', 'M', 'D', 'A', 'B'};
+
+// Tags for the nodes of the acceptance expression, which is written in prefix order
+enum class AcceptanceNodeTag : uint8_t { And, Or, Not, True, False, Atom };
+
+template<typename T>
+void writeBinaryValue(std::ostream& out, T const& value) {
+    out.write(reinterpret_cast<char const*>(&value), sizeof(T));
+}
+
+void writeBinaryString(std::ostream& out, std::string const& str) {
+    writeBinaryValue<uint64_t>(out, str.size());
+    out.write(str.data(), str.size());
+}
+
+void writeBinaryAcceptance(std::ostream& out, AcceptanceCondition::acceptance_expr::ptr const& expr) {
+    switch (expr->getType()) {
+        case AcceptanceCondition::acceptance_expr::EXP_AND:
+        case AcceptanceCondition::acceptance_expr::EXP_OR:
+            writeBinaryValue(out, expr->isAND() ? AcceptanceNodeTag::And : AcceptanceNodeTag::Or);
+            writeBinaryAcceptance(out, expr->getLeft());
+            writeBinaryAcceptance(out, expr->getRight());
+            break;
+        case AcceptanceCondition::acceptance_expr::EXP_NOT:
+            writeBinaryValue(out, AcceptanceNodeTag::Not);
+            writeBinaryAcceptance(out, expr->getLeft());
+            break;
+        case AcceptanceCondition::acceptance_expr::EXP_TRUE:
+            writeBinaryValue(out, AcceptanceNodeTag::True);
+            break;
+        case AcceptanceCondition::acceptance_expr::EXP_FALSE:
+            writeBinaryValue(out, AcceptanceNodeTag::False);
+            break;
+        case AcceptanceCondition::acceptance_expr::EXP_ATOM:
+            writeBinaryValue(out, AcceptanceNodeTag::Atom);
+            writeBinaryValue<uint8_t>(out, expr->getAtom().getType() == cpphoafparser::AtomAcceptance::TEMPORAL_FIN ? 0 : 1);
+            writeBinaryValue<uint32_t>(out, expr->getAtom().getAcceptanceSet());
+            writeBinaryValue<uint8_t>(out, expr->getAtom().isNegated() ? 1 : 0);
+            break;
+    }
+}
+
+class BinaryAutomatonReader {
+   public:
+    BinaryAutomatonReader(char const* data, char const* dataEnd) : current(data), end(dataEnd) {
+        // Intentionally left empty.
+    }
+
+    template<typename T>
+    T read() {
+        STORM_LOG_THROW(static_cast<uint64_t>(end - current) >= sizeof(T), storm::exceptions::WrongFormatException, "Unexpected end of automaton.");
+        T value;
+        std::memcpy(&value, current, sizeof(T));
+        current += sizeof(T);
+        return value;
+    }
+
+    std::string readString() {
+        uint64_t size = read<uint64_t>();
+        STORM_LOG_THROW(static_cast<uint64_t>(end - current) >= size, storm::exceptions::WrongFormatException, "Unexpected end of automaton.");
+        std::string result(current, size);
+        current += size;
+        return result;
+    }
+
+    AcceptanceCondition::acceptance_expr::ptr readAcceptance(unsigned int numberOfAcceptanceSets) {
+        typedef AcceptanceCondition::acceptance_expr acceptance_expr;
+        switch (read<AcceptanceNodeTag>()) {
+            case AcceptanceNodeTag::And: {
+                auto left = readAcceptance(numberOfAcceptanceSets);
+                return acceptance_expr::ptr(new acceptance_expr(acceptance_expr::EXP_AND, left, readAcceptance(numberOfAcceptanceSets)));
+            }
+            case AcceptanceNodeTag::Or: {
+                auto left = readAcceptance(numberOfAcceptanceSets);
+                return acceptance_expr::ptr(new acceptance_expr(acceptance_expr::EXP_OR, left, readAcceptance(numberOfAcceptanceSets)));
+            }
+            case AcceptanceNodeTag::Not:
+                return acceptance_expr::ptr(new acceptance_expr(acceptance_expr::EXP_NOT, readAcceptance(numberOfAcceptanceSets), nullptr));
+            case AcceptanceNodeTag::True:
+                return acceptance_expr::True();
+            case AcceptanceNodeTag::False:
+                return acceptance_expr::False();
+            case AcceptanceNodeTag::Atom: {
+                auto type = read<uint8_t>() == 0 ? cpphoafparser::AtomAcceptance::TEMPORAL_FIN : cpphoafparser::AtomAcceptance::TEMPORAL_INF;
+                uint32_t accSet = read<uint32_t>();
+                STORM_LOG_THROW(accSet < numberOfAcceptanceSets, storm::exceptions::WrongFormatException, "Invalid acceptance set in automaton.");
+                bool negated = read<uint8_t>() != 0;
+                return acceptance_expr::Atom(cpphoafparser::AtomAcceptance::ptr(new cpphoafparser::AtomAcceptance(type, accSet, negated)));
+            }
+        }
+        STORM_LOG_THROW(false, storm::exceptions::WrongFormatException, "Invalid acceptance condition in automaton.");
+    }
+
+    bool isAtEnd() const {
+        return current == end;
+    }
+
+   private:
+    char const* current;
+    char const* end;
+};
+
+uint64_t getSuccessorBitWidth(std::size_t numberOfStates) {
+    uint64_t width = 1;
+    while (width < 64 && (1ull << width) < numberOfStates) {
+        ++width;
+    }
+    return width;
+}
+}  // namespace
+
 DeterministicAutomaton::DeterministicAutomaton(APSet apSet, std::size_t numberOfStates, std::size_t initialState, AcceptanceCondition::ptr acceptance)
     : apSet(apSet), numberOfStates(numberOfStates), initialState(initialState), acceptance(acceptance) {
     // TODO: this could overflow, add check?
@@ -87,6 +204,77 @@ void DeterministicAutomaton::printHOA(std::ostream& out) const {
     }
 }
 
+void DeterministicAutomaton::writeBinary(std::ostream& out) const {
+    out.write(binaryMagic, sizeof(binaryMagic));
+    writeBinaryValue<uint64_t>(out, numberOfStates);
+    writeBinaryValue<uint64_t>(out, initialState);
+    writeBinaryValue<uint64_t>(out, apSet.size());
+    for (auto const& ap : apSet.getAPs()) {
+        writeBinaryString(out, ap);
+    }
+    writeBinaryValue<uint32_t>(out, acceptance->getNumberOfAcceptanceSets());
+    for (unsigned int i = 0; i < acceptance->getNumberOfAcceptanceSets(); ++i) {
+        storm::storage::BitVector const& acceptanceSet = acceptance->getAcceptanceSet(i);
+        for (uint64_t bit = 0; bit < acceptanceSet.size(); bit += 64) {
+            writeBinaryValue<uint64_t>(out, acceptanceSet.getAsInt(bit, std::min<uint64_t>(64, acceptanceSet.size() - bit)));
+        }
+    }
+    writeBinaryAcceptance(out, acceptance->getAcceptanceExpression());
+
+    uint64_t const bitWidth = getSuccessorBitWidth(numberOfStates);
+    storm::storage::BitVector packedSuccessors(numberOfEdges * bitWidth);
+    for (uint64_t edge = 0; edge < numberOfEdges; ++edge) {
+        packedSuccessors.setFromInt(edge * bitWidth, bitWidth, successors[edge]);
+    }
+    for (uint64_t bit = 0; bit < packedSuccessors.size(); bit += 64) {
+        writeBinaryValue<uint64_t>(out, packedSuccessors.getAsInt(bit, std::min<uint64_t>(64, packedSuccessors.size() - bit)));
+    }
+}
+
+DeterministicAutomaton::ptr DeterministicAutomaton::readBinary(char const* data, char const* dataEnd) {
+    STORM_LOG_THROW(dataEnd - data >= 8 && std::equal(data, data + 8, binaryMagic), storm::exceptions::WrongFormatException,
+                    "Data does not contain a binary automaton.");
+    BinaryAutomatonReader reader(data + 8, dataEnd);
+    uint64_t numberOfStates = reader.read<uint64_t>();
+    uint64_t initialState = reader.read<uint64_t>();
+    STORM_LOG_THROW(initialState < numberOfStates, storm::exceptions::WrongFormatException, "Invalid initial state in automaton.");
+    APSet apSet;
+    uint64_t numberOfAPs = reader.read<uint64_t>();
+    STORM_LOG_THROW(numberOfAPs <= apSet.MAX_APS, storm::exceptions::WrongFormatException, "Too many atomic propositions in automaton.");
+    for (uint64_t i = 0; i < numberOfAPs; ++i) {
+        apSet.add(reader.readString());
+    }
+    uint32_t numberOfAcceptanceSets = reader.read<uint32_t>();
+    std::vector<storm::storage::BitVector> acceptanceSets(numberOfAcceptanceSets, storm::storage::BitVector(numberOfStates));
+    for (auto& acceptanceSet : acceptanceSets) {
+        for (uint64_t bit = 0; bit < acceptanceSet.size(); bit += 64) {
+            uint64_t width = std::min<uint64_t>(64, acceptanceSet.size() - bit);
+            uint64_t word = reader.read<uint64_t>();
+            STORM_LOG_THROW(width == 64 || (word >> width) == 0, storm::exceptions::WrongFormatException, "Invalid acceptance set in automaton.");
+            acceptanceSet.setFromInt(bit, width, word);
+        }
+    }
+    auto acceptance = std::make_shared<AcceptanceCondition>(numberOfStates, numberOfAcceptanceSets, reader.readAcceptance(numberOfAcceptanceSets));
+    for (unsigned int i = 0; i < numberOfAcceptanceSets; ++i) {
+        acceptance->getAcceptanceSet(i) = std::move(acceptanceSets[i]);
+    }
+
+    auto result = std::make_shared<DeterministicAutomaton>(apSet, numberOfStates, initialState, acceptance);
+    uint64_t const bitWidth = getSuccessorBitWidth(numberOfStates);
+    storm::storage::BitVector packedSuccessors(result->numberOfEdges * bitWidth);
+    for (uint64_t bit = 0; bit < packedSuccessors.size(); bit += 64) {
+        uint64_t width = std::min<uint64_t>(64, packedSuccessors.size() - bit);
+        packedSuccessors.setFromInt(bit, width, reader.read<uint64_t>());
+    }
+    for (uint64_t edge = 0; edge < result->numberOfEdges; ++edge) {
+        uint64_t successor = packedSuccessors.getAsInt(edge * bitWidth, bitWidth);
+        STORM_LOG_THROW(successor < numberOfStates, storm::exceptions::WrongFormatException, "Invalid successor in automaton.");
+        result->successors[edge] = successor;
+    }
+    STORM_LOG_THROW(reader.isAtEnd(), storm::exceptions::WrongFormatException, "Unexpected data after binary automaton.");
+    return result;
+}
+
 DeterministicAutomaton::ptr DeterministicAutomaton::parse(std::istream& in) {
     HOAConsumerDA::ptr consumer(new HOAConsumerDA());
     cpphoafparser::HOAIntermediateCheckValidity::ptr validator(new cpphoafparser::HOAIntermediateCheckValidity(consumer));
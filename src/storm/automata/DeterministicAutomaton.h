@@ -32,6 +32,20 @@ class DeterministicAutomaton {
     static DeterministicAutomaton::ptr parse(std::istream& in);
     static DeterministicAutomaton::ptr parseFromFile(const std::string& filename);
 
+    /*!
+     * Writes the automaton in a compact binary format to the given stream.
+     * Successors are bit-packed with the minimal width for the number of states. Numbers are stored in the byte order of the exporting machine.
+     */
+    void writeBinary(std::ostream& out) const;
+
+    /*!
+     * Loads an automaton that was written with writeBinary.
+     *
+     * @param data The beginning of the binary data.
+     * @param dataEnd The end of the binary data.
+     */
+    static DeterministicAutomaton::ptr readBinary(char const* data, char const* dataEnd);
+
    private:
     APSet apSet;
     std::size_t numberOfStates;
@@ -1,13 +1,23 @@
 #include "storm/automata/LTL2DeterministicAutomaton.h"
+#include "storm/automata/AcceptanceCondition.h"
 #include "storm/automata/DeterministicAutomaton.h"
 
 #include "storm/exceptions/ExpressionEvaluationException.h"
 #include "storm/exceptions/FileIoException.h"
 #include "storm/exceptions/NotSupportedException.h"
+#include "storm/logic/AtomicLabelFormula.h"
 #include "storm/logic/Formula.h"
 #include "storm/utility/macros.h"
 
 #include <sys/wait.h>
+#include <unistd.h>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <mutex>
+#include <sstream>
+#include <unordered_map>
 
 #ifdef STORM_HAVE_SPOT
 #include "spot/tl/formula.hh"
@@ -102,6 +112,132 @@ std::shared_ptr<DeterministicAutomaton> LTL2DeterministicAutomaton::ltl2daExtern
     }
 }
 
+namespace {
+// Automata for normalized formulas, serialized in binary format and identified by the normalized formula and the translator
+std::mutex automatonCacheMutex;
+std::unordered_map<std::string, std::string> automatonCache;
+
+std::string getCacheFileName(std::string const& cacheDirectory, std::string const& key) {
+    std::ostringstream fileName;
+    fileName << cacheDirectory << "/" << std::hex << std::hash<std::string>()(key) << ".da";
+    return fileName.str();
+}
+
+// Cache files start with the key to detect collisions of the hashed file names
+bool readCacheFile(std::string const& fileName, std::string const& key, std::string& automaton) {
+    std::ifstream in(fileName, std::ios::binary);
+    if (!in.good()) {
+        return false;
+    }
+    std::string content((std::istreambuf_iterator<char>(in)), std::istreambuf_iterator<char>());
+    uint64_t keySize;
+    if (content.size() < sizeof(keySize)) {
+        return false;
+    }
+    std::memcpy(&keySize, content.data(), sizeof(keySize));
+    if (content.size() - sizeof(keySize) < keySize || content.compare(sizeof(keySize), keySize, key) != 0) {
+        STORM_LOG_INFO("Cached automaton in '" << fileName << "' belongs to another formula.");
+        return false;
+    }
+    automaton = content.substr(sizeof(keySize) + keySize);
+    return true;
+}
+
+void writeCacheFile(std::string const& fileName, std::string const& key, std::string const& automaton) {
+    // Write to a temporary file first so that concurrent invocations never read partially written automata
+    std::string temporaryFileName = fileName + "." + std::to_string(getpid()) + ".tmp";
+    {
+        std::ofstream out(temporaryFileName, std::ios::binary);
+        if (!out.good()) {
+            STORM_LOG_WARN("Could not store automaton in '" << fileName << "'.");
+            return;
+        }
+        uint64_t keySize = key.size();
+        out.write(reinterpret_cast<char const*>(&keySize), sizeof(keySize));
+        out << key << automaton;
+    }
+    if (std::rename(temporaryFileName.c_str(), fileName.c_str()) != 0) {
+        STORM_LOG_WARN("Could not store automaton in '" << fileName << "'.");
+        std::remove(temporaryFileName.c_str());
+    }
+}
+
+// Copies the given automaton, renaming its atomic propositions
+std::shared_ptr<DeterministicAutomaton> renameAPs(DeterministicAutomaton const& da, std::map<std::string, std::string> const& renaming) {
+    APSet apSet;
+    for (auto const& ap : da.getAPSet().getAPs()) {
+        auto renamedAp = renaming.find(ap);
+        STORM_LOG_ASSERT(renamedAp != renaming.end(), "Unknown atomic proposition " << ap << " in cached automaton.");
+        apSet.add(renamedAp->second);
+    }
+    AcceptanceCondition const& acceptance = *da.getAcceptance();
+    auto renamedAcceptance =
+        std::make_shared<AcceptanceCondition>(da.getNumberOfStates(), acceptance.getNumberOfAcceptanceSets(), acceptance.getAcceptanceExpression());
+    for (unsigned int i = 0; i < acceptance.getNumberOfAcceptanceSets(); ++i) {
+        renamedAcceptance->getAcceptanceSet(i) = acceptance.getAcceptanceSet(i);
+    }
+    auto result = std::make_shared<DeterministicAutomaton>(apSet, da.getNumberOfStates(), da.getInitialState(), renamedAcceptance);
+    for (std::size_t state = 0; state < da.getNumberOfStates(); ++state) {
+        for (APSet::alphabet_element label = 0; label < da.getNumberOfEdgesPerState(); ++label) {
+            result->setSuccessor(state, label, da.getSuccessor(state, label));
+        }
+    }
+    return result;
+}
+}  // namespace
+
+std::shared_ptr<DeterministicAutomaton> LTL2DeterministicAutomaton::ltl2da(storm::logic::Formula const& f, bool dnf,
+                                                                           boost::optional<std::string> const& ltl2daTool,
+                                                                           boost::optional<std::string> const& cacheDirectory) {
+    // Normalize the formula by naming the atomic propositions in the order of their first occurrence
+    std::map<std::string, std::string> normalization, denormalization;
+    for (auto const& atomicLabelFormula : f.getAtomicLabelFormulas()) {
+        std::string const& label = atomicLabelFormula->getLabel();
+        if (normalization.count(label) == 0) {
+            std::string normalizedLabel = "ap" + std::to_string(normalization.size());
+            normalization.emplace(label, normalizedLabel);
+            denormalization.emplace(normalizedLabel, label);
+        }
+    }
+    std::shared_ptr<storm::logic::Formula> normalizedFormula = f.substitute(normalization);
+    std::string key = (ltl2daTool ? "tool " + ltl2daTool.get() : std::string(dnf ? "spot dnf" : "spot")) + "\n" + normalizedFormula->toPrefixString();
+
+    std::string automaton;
+    bool cached = false;
+    {
+        std::lock_guard<std::mutex> lock(automatonCacheMutex);
+        auto cacheIt = automatonCache.find(key);
+        if (cacheIt != automatonCache.end()) {
+            automaton = cacheIt->second;
+            cached = true;
+        }
+    }
+    if (!cached && cacheDirectory) {
+        cached = readCacheFile(getCacheFileName(cacheDirectory.get(), key), key, automaton);
+        if (cached) {
+            std::lock_guard<std::mutex> lock(automatonCacheMutex);
+            automatonCache.emplace(key, automaton);
+        }
+    }
+
+    std::shared_ptr<DeterministicAutomaton> da;
+    if (cached) {
+        STORM_LOG_INFO("Reusing cached automaton for " << normalizedFormula->toPrefixString());
+        da = DeterministicAutomaton::readBinary(automaton.data(), automaton.data() + automaton.size());
+    } else {
+        da = ltl2daTool ? ltl2daExternalTool(*normalizedFormula, ltl2daTool.get()) : ltl2daSpot(*normalizedFormula, dnf);
+        std::ostringstream out;
+        da->writeBinary(out);
+        automaton = out.str();
+        if (cacheDirectory) {
+            writeCacheFile(getCacheFileName(cacheDirectory.get(), key), key, automaton);
+        }
+        std::lock_guard<std::mutex> lock(automatonCacheMutex);
+        automatonCache.emplace(key, automaton);
+    }
+    return renameAPs(*da, denormalization);
+}
+
 }  // namespace automata
 
 }  // namespace storm
@@ -1,6 +1,9 @@
 #pragma once
 
 #include <memory>
+#include <string>
+
+#include <boost/optional.hpp>
 
 namespace storm {
 
@@ -35,6 +38,20 @@ class LTL2DeterministicAutomaton {
      * @return An automaton equivalent to the formula.
      */
     static std::shared_ptr<DeterministicAutomaton> ltl2daExternalTool(storm::logic::Formula const& f, std::string ltl2daTool);
+
+    /*!
+     * Converts an LTL formula into a deterministic omega-automaton, reusing automata of earlier translations.
+     * Formulas are identified up to the names of their atomic propositions, so e.g. the automaton for "F a" is reused for "F b". The automata are
+     * cached in memory and, if a cache directory is given, additionally stored there in binary format so that they are reused across invocations.
+     *
+     * @param f The LTL formula.
+     * @param dnf A Flag indicating whether the acceptance condition is transformed into DNF (only relevant for Spot).
+     * @param ltl2daTool If given, the external tool that is used instead of Spot.
+     * @param cacheDirectory If given, an existing directory in which translated automata are stored.
+     * @return An automaton equivalent to the formula.
+     */
+    static std::shared_ptr<DeterministicAutomaton> ltl2da(storm::logic::Formula const& f, bool dnf, boost::optional<std::string> const& ltl2daTool,
+                                                          boost::optional<std::string> const& cacheDirectory);
 };
 
 }  // namespace automata
@@ -1,5 +1,7 @@
 #include "storm/builder/BuilderOptions.h"
 
+#include <algorithm>
+
 #include "storm/builder/TerminalStatesGetter.h"
 
 #include "storm/logic/Formulas.h"
@@ -51,6 +53,8 @@ BuilderOptions::BuilderOptions(bool buildAllRewardModels, bool buildAllLabels)
       inferObservationsFromActions(false),
       addOverlappingGuardsLabel(false),
       addOutOfBoundsState(false),
+      symmetryReduction(false),
+      partialOrderReduction(false),
       reservedBitsForUnboundedVariables(32),
       showProgress(false),
       showProgressDelay(0) {
@@ -69,9 +73,7 @@ BuilderOptions::BuilderOptions(std::vector<std::shared_ptr<storm::logic::Formula
         for (auto const& formula : formulas) {
             this->preserveFormula(*formula, modelDescription);
         }
-        if (formulas.size() == 1) {
-            this->setTerminalStatesFromFormula(*formulas.front());
-        }
+        this->setTerminalStatesFromFormulas(formulas);
     }
 
     auto const& generalSettings = storm::settings::getModule<storm::settings::modules::GeneralSettings>();
@@ -118,6 +120,42 @@ void BuilderOptions::setTerminalStatesFromFormula(storm::logic::Formula const& f
         [this](std::string const& label, bool inverted) { this->addTerminalLabel(label, inverted); });
 }
 
+void BuilderOptions::setTerminalStatesFromFormulas(std::vector<std::shared_ptr<storm::logic::Formula const>> const& formulas) {
+    auto isSameTerminalState = [](std::pair<LabelOrExpression, bool> const& first, std::pair<LabelOrExpression, bool> const& second) {
+        if (first.second != second.second || first.first.isLabel() != second.first.isLabel()) {
+            return false;
+        }
+        return first.first.isLabel() ? first.first.getLabel() == second.first.getLabel()
+                                     : first.first.getExpression().isSyntacticallyEqual(second.first.getExpression());
+    };
+
+    // Only keep the terminal states that are common to all formulas.
+    std::vector<std::pair<LabelOrExpression, bool>> commonTerminalStates;
+    for (auto formulaIt = formulas.begin(); formulaIt != formulas.end(); ++formulaIt) {
+        std::vector<std::pair<LabelOrExpression, bool>> terminalStatesOfFormula;
+        getTerminalStatesFromFormula(
+            **formulaIt,
+            [&terminalStatesOfFormula](storm::expressions::Expression const& expr, bool inverted) {
+                terminalStatesOfFormula.emplace_back(LabelOrExpression(expr), inverted);
+            },
+            [&terminalStatesOfFormula](std::string const& label, bool inverted) { terminalStatesOfFormula.emplace_back(LabelOrExpression(label), inverted); });
+        if (formulaIt == formulas.begin()) {
+            commonTerminalStates = std::move(terminalStatesOfFormula);
+        } else {
+            auto isCommon = [&](std::pair<LabelOrExpression, bool> const& terminalState) {
+                return std::any_of(terminalStatesOfFormula.begin(), terminalStatesOfFormula.end(),
+                                   [&](std::pair<LabelOrExpression, bool> const& other) { return isSameTerminalState(terminalState, other); });
+            };
+            auto newEnd = std::remove_if(commonTerminalStates.begin(), commonTerminalStates.end(),
+                                         [&](std::pair<LabelOrExpression, bool> const& terminalState) { return !isCommon(terminalState); });
+            commonTerminalStates.erase(newEnd, commonTerminalStates.end());
+        }
+    }
+    STORM_LOG_INFO_COND(formulas.size() <= 1 || commonTerminalStates.empty(),
+                        "Derived " << commonTerminalStates.size() << " terminal state condition(s) that are common to all " << formulas.size() << " formulas.");
+    terminalStates.insert(terminalStates.end(), commonTerminalStates.begin(), commonTerminalStates.end());
+}
+
 std::set<std::string> const& BuilderOptions::getRewardModelNames() const {
     return rewardModelNames;
 }
@@ -190,6 +228,14 @@ bool BuilderOptions::isAddOverlappingGuardLabelSet() const {
     return addOverlappingGuardsLabel;
 }
 
+bool BuilderOptions::isSymmetryReductionSet() const {
+    return symmetryReduction;
+}
+
+bool BuilderOptions::isPartialOrderReductionSet() const {
+    return partialOrderReduction;
+}
+
 BuilderOptions& BuilderOptions::setBuildAllRewardModels(bool newValue) {
     buildAllRewardModels = newValue;
     return *this;
@@ -291,6 +337,16 @@ BuilderOptions& BuilderOptions::setAddOverlappingGuardsLabel(bool newValue) {
     return *this;
 }
 
+BuilderOptions& BuilderOptions::setSymmetryReduction(bool newValue) {
+    symmetryReduction = newValue;
+    return *this;
+}
+
+BuilderOptions& BuilderOptions::setPartialOrderReduction(bool newValue) {
+    partialOrderReduction = newValue;
+    return *this;
+}
+
 BuilderOptions& BuilderOptions::substituteExpressions(
     std::function<storm::expressions::Expression(storm::expressions::Expression const&)> const& substitutionFunction) {
     for (auto& e : expressionLabels) {
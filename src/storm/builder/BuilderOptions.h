@@ -86,6 +86,14 @@ class BuilderOptions {
      */
     void setTerminalStatesFromFormula(storm::logic::Formula const& formula);
 
+    /*!
+     * Analyzes the given formulas and sets the states of the model that can be treated as terminal states for
+     * all of them, i.e., a terminal state condition is only added if it can be derived from every formula.
+     *
+     * @param formulas The formulas used to (possibly) derive expressions for the terminal states of the model.
+     */
+    void setTerminalStatesFromFormulas(std::vector<std::shared_ptr<storm::logic::Formula const>> const& formulas);
+
     /*!
      * Which reward models are built
      * @return
@@ -120,6 +128,8 @@ class BuilderOptions {
     bool isAddOutOfBoundsStateSet() const;
     uint64_t getReservedBitsForUnboundedVariables() const;
     bool isAddOverlappingGuardLabelSet() const;
+    bool isSymmetryReductionSet() const;
+    bool isPartialOrderReductionSet() const;
     uint64_t getShowProgressDelay() const;
 
     /**
@@ -206,6 +216,20 @@ class BuilderOptions {
      */
     BuilderOptions& setAddOverlappingGuardsLabel(bool newValue = true);
 
+    /**
+     * Should only one representative of states that are equal up to symmetries of the model be explored
+     * @param newValue the new value (default true)
+     * @return this
+     */
+    BuilderOptions& setSymmetryReduction(bool newValue = true);
+
+    /**
+     * Should independent commands only be interleaved once (for nondeterministic models)
+     * @param newValue the new value (default true)
+     * @return this
+     */
+    BuilderOptions& setPartialOrderReduction(bool newValue = true);
+
     /**
      * Sets the number of bits that will be reserved for unbounded integer variables.
      */
@@ -268,6 +292,12 @@ class BuilderOptions {
     /// A flag indicating that the an additional state for out of bounds should be created.
     bool addOutOfBoundsState;
 
+    /// A flag indicating whether states are to be reduced with respect to symmetries of the model.
+    bool symmetryReduction;
+
+    /// A flag indicating whether partial order reduction is to be applied.
+    bool partialOrderReduction;
+
     /// Indicates the number of bits that are reserved for the storage of unbounded integer variables.
     uint64_t reservedBitsForUnboundedVariables;
 
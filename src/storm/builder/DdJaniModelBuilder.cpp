@@ -23,6 +23,7 @@
 #include "storm/storage/jani/visitor/CompositionInformationVisitor.h"
 
 #include "storm/adapters/AddExpressionAdapter.h"
+#include "storm/builder/DdVariableOrdering.h"
 #include "storm/storage/dd/Add.h"
 #include "storm/storage/dd/Bdd.h"
 
@@ -401,15 +402,56 @@ class CompositionVariableCreator : public storm::jani::CompositionVisitor {
             result.variableToRangeMap.emplace(variablePair.second, result.manager->getRange(variablePair.second));
         }
 
-        // Create global variables.
+        // Collect the non-transient variables in the order of their declaration, starting with the global ones.
+        std::vector<storm::expressions::Variable> modelVariables;
+        std::map<storm::expressions::Variable, storm::jani::Variable const*> variableToDeclaration;
+        auto addVariable = [&](storm::jani::Variable const& variable) {
+            if (!variable.isTransient()) {
+                modelVariables.push_back(variable.getExpressionVariable());
+                variableToDeclaration.emplace(variable.getExpressionVariable(), &variable);
+            }
+        };
+        for (auto const& variable : this->model.getGlobalVariables()) {
+            addVariable(variable);
+        }
+        for (auto const& automaton : this->model.getAutomata()) {
+            for (auto const& variable : automaton.getVariables()) {
+                addVariable(variable);
+            }
+        }
+
+        if (storm::settings::getModule<storm::settings::modules::BuildSettings>().isDdStaticVariableOrderSet()) {
+            // Variables that are tested or updated by the same edge are placed close to each other.
+            std::vector<std::set<storm::expressions::Variable>> clusters;
+            for (auto const& automaton : this->model.getAutomata()) {
+                for (auto const& edge : automaton.getEdges()) {
+                    std::set<storm::expressions::Variable> cluster = edge.getGuard().getVariables();
+                    for (auto const& destination : edge.getDestinations()) {
+                        std::set<storm::expressions::Variable> probabilityVariables = destination.getProbability().getVariables();
+                        cluster.insert(probabilityVariables.begin(), probabilityVariables.end());
+                        for (auto const& assignment : destination.getOrderedAssignments()) {
+                            cluster.insert(assignment.getExpressionVariable());
+                            std::set<storm::expressions::Variable> expressionVariables = assignment.getAssignedExpression().getVariables();
+                            cluster.insert(expressionVariables.begin(), expressionVariables.end());
+                        }
+                    }
+                    clusters.push_back(std::move(cluster));
+                }
+            }
+            modelVariables = computeForceVariableOrder(modelVariables, clusters);
+        }
+
+        // Create the variables in the chosen order.
+        for (auto const& variable : modelVariables) {
+            createVariable(*variableToDeclaration.at(variable), result);
+        }
+
+        // Compute the ranges of the global variables.
         storm::dd::Bdd<Type> globalVariableRanges = result.manager->getBddOne();
         for (auto const& variable : this->model.getGlobalVariables()) {
-            // Only create the variable if it's non-transient.
             if (variable.isTransient()) {
                 continue;
             }
-
-            createVariable(variable, result);
             globalVariableRanges &= result.manager->getRange(result.variableToRowMetaVariableMap->at(variable.getExpressionVariable()));
         }
         result.globalVariableRanges = globalVariableRanges.template toAdd<ValueType>();
@@ -426,14 +468,12 @@ class CompositionVariableCreator : public storm::jani::CompositionVisitor {
             identity &= variableIdentity;
             range &= result.manager->getRange(locationVariables.first);
 
-            // Then create variables for the variables of the automaton.
+            // Then add the identities and ranges of the variables of the automaton.
             for (auto const& variable : automaton.getVariables()) {
-                // Only create the variable if it's non-transient.
                 if (variable.isTransient()) {
                     continue;
                 }
 
-                createVariable(variable, result);
                 identity &= result.variableToIdentityMap.at(variable.getExpressionVariable()).toBdd();
                 range &= result.manager->getRange(result.variableToRowMetaVariableMap->at(variable.getExpressionVariable()));
             }
@@ -2379,9 +2419,43 @@ std::shared_ptr<storm::models::symbolic::Model<Type, ValueType>> buildInternal(s
         model.getModelType() == storm::jani::ModelType::MA) {
         transitionMatrixBdd = transitionMatrixBdd.existsAbstract(variables.allNondeterminismVariables);
     }
-    modelComponents.reachableStates = storm::utility::dd::computeReachableStates(modelComponents.initialStates, transitionMatrixBdd, variables.rowMetaVariables,
-                                                                                 variables.columnMetaVariables)
-                                          .first;
+    storm::settings::modules::BuildSettings const& buildSettings = storm::settings::getModule<storm::settings::modules::BuildSettings>();
+    storm::builder::DdReachabilityStrategy reachabilityStrategy = buildSettings.getDdReachabilityStrategy();
+
+    // Group the variables by the automaton they belong to (global variables form groups of their own). These groups are used to split the transition
+    // relation by the automaton whose variables are changed.
+    std::vector<std::vector<std::pair<storm::expressions::Variable, storm::expressions::Variable>>> variableGroups;
+    if (reachabilityStrategy != storm::builder::DdReachabilityStrategy::Bfs || buildSettings.isDdPartitionedTransitionRelationSet()) {
+        auto getVariablePair = [&variables](storm::expressions::Variable const& variable) {
+            return std::make_pair(variables.variableToRowMetaVariableMap->at(variable), variables.variableToColumnMetaVariableMap->at(variable));
+        };
+        for (auto const& variable : model.getGlobalVariables()) {
+            if (!variable.isTransient()) {
+                variableGroups.push_back({getVariablePair(variable.getExpressionVariable())});
+            }
+        }
+        for (auto const& automatonLocationVariables : variables.automatonToLocationDdVariableMap) {
+            std::vector<std::pair<storm::expressions::Variable, storm::expressions::Variable>> group = {automatonLocationVariables.second};
+            for (auto const& variable : model.getAutomaton(automatonLocationVariables.first).getVariables()) {
+                if (!variable.isTransient()) {
+                    group.push_back(getVariablePair(variable.getExpressionVariable()));
+                }
+            }
+            variableGroups.push_back(std::move(group));
+        }
+    }
+
+    if (reachabilityStrategy == storm::builder::DdReachabilityStrategy::Bfs) {
+        modelComponents.reachableStates = storm::utility::dd::computeReachableStates(modelComponents.initialStates, transitionMatrixBdd,
+                                                                                     variables.rowMetaVariables, variables.columnMetaVariables)
+                                              .first;
+    } else {
+        modelComponents.reachableStates =
+            storm::utility::dd::computeReachableStates(modelComponents.initialStates,
+                                                       storm::utility::dd::partitionTransitionRelation(transitionMatrixBdd, variableGroups),
+                                                       variables.rowMetaVariables, variables.columnMetaVariables, reachabilityStrategy)
+                .first;
+    }
 
     // Check that the reachable fragment does not overlap with the illegal fragment.
     storm::dd::Bdd<Type> reachableIllegalFragment = modelComponents.reachableStates && system.illegalFragment;
@@ -2403,8 +2477,16 @@ std::shared_ptr<storm::models::symbolic::Model<Type, ValueType>> buildInternal(s
     modelComponents.rewardModels =
         buildRewardModels(reachableStatesAdd, modelComponents.transitionMatrix, model.getModelType(), variables, system, rewardVariables);
 
+    STORM_LOG_INFO("Built transition matrix with " << modelComponents.transitionMatrix.getNodeCount() << " nodes and reachable states with "
+                                                   << modelComponents.reachableStates.getNodeCount() << " nodes.");
+
     // Finally, create the model.
-    return createModel(model.getModelType(), variables, modelComponents);
+    std::shared_ptr<storm::models::symbolic::Model<Type, ValueType>> result = createModel(model.getModelType(), variables, modelComponents);
+    if (buildSettings.isDdPartitionedTransitionRelationSet()) {
+        result->setPartitionedTransitionRelation(storm::utility::dd::createPartitionedTransitionRelation(
+            result->getQualitativeTransitionMatrix(false), variableGroups, variables.rowColumnMetaVariablePairs));
+    }
+    return result;
 }
 
 template<storm::dd::DdType Type, typename ValueType>
@@ -13,11 +13,14 @@
 #include "storm/exceptions/InvalidStateException.h"
 #include "storm/exceptions/NotSupportedException.h"
 
+#include "storm/generator/VariableInformation.h"
+
 #include "storm/utility/dd.h"
 #include "storm/utility/math.h"
 #include "storm/utility/prism.h"
 
 #include "storm/adapters/AddExpressionAdapter.h"
+#include "storm/builder/DdVariableOrdering.h"
 
 #include "storm/storage/dd/Add.h"
 #include "storm/storage/dd/Bdd.h"
@@ -95,7 +98,7 @@ class ParameterCreator<Type, storm::RationalFunction> {
 template<storm::dd::DdType Type, typename ValueType>
 class DdPrismModelBuilder<Type, ValueType>::GenerationInformation {
    public:
-    GenerationInformation(storm::prism::Program const& program, std::shared_ptr<storm::dd::DdManager<Type>> const& manager)
+    GenerationInformation(storm::prism::Program const& program, std::shared_ptr<storm::dd::DdManager<Type>> const& manager, bool staticVariableOrder)
         : program(program),
           manager(manager),
           rowMetaVariables(),
@@ -110,7 +113,7 @@ class DdPrismModelBuilder<Type, ValueType>::GenerationInformation {
           moduleToIdentityMap(),
           parameters() {
         // Initializes variables and identity DDs.
-        createMetaVariablesAndIdentities();
+        createMetaVariablesAndIdentities(staticVariableOrder);
 
         // Initialize the parameters (if any).
         ParameterCreator<Type, ValueType> parameterCreator;
@@ -169,8 +172,11 @@ class DdPrismModelBuilder<Type, ValueType>::GenerationInformation {
    private:
     /*!
      * Creates the required meta variables and variable/module identities.
+     *
+     * @param staticVariableOrder If set, the meta variables of the program variables are created in an order that places variables that are
+     * used together close to each other. Otherwise, they are created in the order of their declaration.
      */
-    void createMetaVariablesAndIdentities() {
+    void createMetaVariablesAndIdentities(bool staticVariableOrder) {
         // Add synchronization variables.
         for (auto const& actionIndex : program.getSynchronizingActionIndices()) {
             std::pair<storm::expressions::Variable, storm::expressions::Variable> variablePair = manager->addMetaVariable(program.getActionName(actionIndex));
@@ -190,96 +196,93 @@ class DdPrismModelBuilder<Type, ValueType>::GenerationInformation {
             allNondeterminismVariables.insert(variablePair.first);
         }
 
-        // Create meta variables for global program variables.
+        // Collect the program variables in the order of their declaration together with the module they belong to (if any).
+        std::vector<storm::expressions::Variable> programVariables;
+        std::map<storm::expressions::Variable, storm::prism::Variable const*> variableToDeclaration;
+        std::map<storm::expressions::Variable, std::string> variableToModule;
+        auto addVariable = [&](storm::prism::Variable const& variable, storm::prism::Module const* module) {
+            programVariables.push_back(variable.getExpressionVariable());
+            variableToDeclaration.emplace(variable.getExpressionVariable(), &variable);
+            if (module != nullptr) {
+                variableToModule.emplace(variable.getExpressionVariable(), module->getName());
+            }
+        };
         for (storm::prism::IntegerVariable const& integerVariable : program.getGlobalIntegerVariables()) {
-            int_fast64_t low = integerVariable.getLowerBoundExpression().evaluateAsInt();
-            int_fast64_t high = integerVariable.getUpperBoundExpression().evaluateAsInt();
-            std::pair<storm::expressions::Variable, storm::expressions::Variable> variablePair = manager->addMetaVariable(integerVariable.getName(), low, high);
-
-            STORM_LOG_TRACE("Created meta variables for global integer variable: " << variablePair.first.getName() << "[" << variablePair.first.getIndex()
-                                                                                   << "] and " << variablePair.second.getName() << "["
-                                                                                   << variablePair.second.getIndex() << "]");
-
-            rowMetaVariables.insert(variablePair.first);
-            variableToRowMetaVariableMap->emplace(integerVariable.getExpressionVariable(), variablePair.first);
-
-            columnMetaVariables.insert(variablePair.second);
-            variableToColumnMetaVariableMap->emplace(integerVariable.getExpressionVariable(), variablePair.second);
-
-            storm::dd::Bdd<Type> variableIdentity = manager->getIdentity(variablePair.first, variablePair.second);
-            variableToIdentityMap.emplace(integerVariable.getExpressionVariable(), variableIdentity.template toAdd<ValueType>());
-            rowColumnMetaVariablePairs.push_back(variablePair);
-
-            allGlobalVariables.insert(integerVariable.getExpressionVariable());
+            addVariable(integerVariable, nullptr);
         }
         for (storm::prism::BooleanVariable const& booleanVariable : program.getGlobalBooleanVariables()) {
-            std::pair<storm::expressions::Variable, storm::expressions::Variable> variablePair = manager->addMetaVariable(booleanVariable.getName());
-
-            STORM_LOG_TRACE("Created meta variables for global boolean variable: " << variablePair.first.getName() << "[" << variablePair.first.getIndex()
-                                                                                   << "] and " << variablePair.second.getName() << "["
-                                                                                   << variablePair.second.getIndex() << "]");
-
-            rowMetaVariables.insert(variablePair.first);
-            variableToRowMetaVariableMap->emplace(booleanVariable.getExpressionVariable(), variablePair.first);
-
-            columnMetaVariables.insert(variablePair.second);
-            variableToColumnMetaVariableMap->emplace(booleanVariable.getExpressionVariable(), variablePair.second);
-
-            storm::dd::Bdd<Type> variableIdentity = manager->getIdentity(variablePair.first, variablePair.second);
-            variableToIdentityMap.emplace(booleanVariable.getExpressionVariable(), variableIdentity.template toAdd<ValueType>());
+            addVariable(booleanVariable, nullptr);
+        }
+        for (storm::prism::Module const& module : program.getModules()) {
+            for (storm::prism::IntegerVariable const& integerVariable : module.getIntegerVariables()) {
+                addVariable(integerVariable, &module);
+            }
+            for (storm::prism::BooleanVariable const& booleanVariable : module.getBooleanVariables()) {
+                addVariable(booleanVariable, &module);
+            }
+        }
 
-            rowColumnMetaVariablePairs.push_back(variablePair);
-            allGlobalVariables.insert(booleanVariable.getExpressionVariable());
+        if (staticVariableOrder) {
+            // Variables that are tested or updated by the same command are placed close to each other.
+            std::vector<std::set<storm::expressions::Variable>> clusters;
+            for (storm::prism::Module const& module : program.getModules()) {
+                for (storm::prism::Command const& command : module.getCommands()) {
+                    std::set<storm::expressions::Variable> cluster = command.getGuardExpression().getVariables();
+                    for (storm::prism::Update const& update : command.getUpdates()) {
+                        for (storm::prism::Assignment const& assignment : update.getAssignments()) {
+                            cluster.insert(assignment.getVariable());
+                            std::set<storm::expressions::Variable> expressionVariables = assignment.getExpression().getVariables();
+                            cluster.insert(expressionVariables.begin(), expressionVariables.end());
+                        }
+                    }
+                    clusters.push_back(std::move(cluster));
+                }
+            }
+            programVariables = computeForceVariableOrder(programVariables, clusters);
         }
 
-        // Create meta variables for each of the modules' variables.
+        // Create meta variables for the program variables in the chosen order.
+        std::map<std::string, storm::dd::Bdd<Type>> moduleIdentities;
+        std::map<std::string, storm::dd::Bdd<Type>> moduleRanges;
         for (storm::prism::Module const& module : program.getModules()) {
-            storm::dd::Bdd<Type> moduleIdentity = manager->getBddOne();
-            storm::dd::Bdd<Type> moduleRange = manager->getBddOne();
-
-            for (storm::prism::IntegerVariable const& integerVariable : module.getIntegerVariables()) {
+            moduleIdentities.emplace(module.getName(), manager->getBddOne());
+            moduleRanges.emplace(module.getName(), manager->getBddOne());
+        }
+        for (storm::expressions::Variable const& variable : programVariables) {
+            storm::prism::Variable const& declaration = *variableToDeclaration.at(variable);
+            std::pair<storm::expressions::Variable, storm::expressions::Variable> variablePair;
+            if (variable.hasIntegerType()) {
+                storm::prism::IntegerVariable const& integerVariable = static_cast<storm::prism::IntegerVariable const&>(declaration);
                 int_fast64_t low = integerVariable.getLowerBoundExpression().evaluateAsInt();
                 int_fast64_t high = integerVariable.getUpperBoundExpression().evaluateAsInt();
-                std::pair<storm::expressions::Variable, storm::expressions::Variable> variablePair =
-                    manager->addMetaVariable(integerVariable.getName(), low, high);
-                STORM_LOG_TRACE("Created meta variables for integer variable: " << variablePair.first.getName() << "[" << variablePair.first.getIndex()
-                                                                                << "] and " << variablePair.second.getName() << "["
-                                                                                << variablePair.second.getIndex() << "]");
-
-                rowMetaVariables.insert(variablePair.first);
-                variableToRowMetaVariableMap->emplace(integerVariable.getExpressionVariable(), variablePair.first);
-
-                columnMetaVariables.insert(variablePair.second);
-                variableToColumnMetaVariableMap->emplace(integerVariable.getExpressionVariable(), variablePair.second);
-
-                storm::dd::Bdd<Type> variableIdentity = manager->getIdentity(variablePair.first, variablePair.second);
-                variableToIdentityMap.emplace(integerVariable.getExpressionVariable(), variableIdentity.template toAdd<ValueType>());
-                moduleIdentity &= variableIdentity;
-                moduleRange &= manager->getRange(variablePair.first);
-
-                rowColumnMetaVariablePairs.push_back(variablePair);
+                variablePair = manager->addMetaVariable(declaration.getName(), low, high);
+            } else {
+                variablePair = manager->addMetaVariable(declaration.getName());
             }
-            for (storm::prism::BooleanVariable const& booleanVariable : module.getBooleanVariables()) {
-                std::pair<storm::expressions::Variable, storm::expressions::Variable> variablePair = manager->addMetaVariable(booleanVariable.getName());
-                STORM_LOG_TRACE("Created meta variables for boolean variable: " << variablePair.first.getName() << "[" << variablePair.first.getIndex()
-                                                                                << "] and " << variablePair.second.getName() << "["
-                                                                                << variablePair.second.getIndex() << "]");
+            STORM_LOG_TRACE("Created meta variables for variable: " << variablePair.first.getName() << "[" << variablePair.first.getIndex() << "] and "
+                                                                    << variablePair.second.getName() << "[" << variablePair.second.getIndex() << "]");
 
-                rowMetaVariables.insert(variablePair.first);
-                variableToRowMetaVariableMap->emplace(booleanVariable.getExpressionVariable(), variablePair.first);
+            rowMetaVariables.insert(variablePair.first);
+            variableToRowMetaVariableMap->emplace(variable, variablePair.first);
 
-                columnMetaVariables.insert(variablePair.second);
-                variableToColumnMetaVariableMap->emplace(booleanVariable.getExpressionVariable(), variablePair.second);
+            columnMetaVariables.insert(variablePair.second);
+            variableToColumnMetaVariableMap->emplace(variable, variablePair.second);
 
-                storm::dd::Bdd<Type> variableIdentity = manager->getIdentity(variablePair.first, variablePair.second);
-                variableToIdentityMap.emplace(booleanVariable.getExpressionVariable(), variableIdentity.template toAdd<ValueType>());
-                moduleIdentity &= variableIdentity;
-                moduleRange &= manager->getRange(variablePair.first);
+            storm::dd::Bdd<Type> variableIdentity = manager->getIdentity(variablePair.first, variablePair.second);
+            variableToIdentityMap.emplace(variable, variableIdentity.template toAdd<ValueType>());
+            rowColumnMetaVariablePairs.push_back(variablePair);
 
-                rowColumnMetaVariablePairs.push_back(variablePair);
+            auto moduleIt = variableToModule.find(variable);
+            if (moduleIt == variableToModule.end()) {
+                allGlobalVariables.insert(variable);
+            } else {
+                moduleIdentities.at(moduleIt->second) &= variableIdentity;
+                moduleRanges.at(moduleIt->second) &= manager->getRange(variablePair.first);
             }
-            moduleToIdentityMap[module.getName()] = moduleIdentity.template toAdd<ValueType>();
-            moduleToRangeMap[module.getName()] = moduleRange.template toAdd<ValueType>();
+        }
+        for (storm::prism::Module const& module : program.getModules()) {
+            moduleToIdentityMap[module.getName()] = moduleIdentities.at(module.getName()).template toAdd<ValueType>();
+            moduleToRangeMap[module.getName()] = moduleRanges.at(module.getName()).template toAdd<ValueType>();
         }
     }
 };
@@ -1424,7 +1427,7 @@ std::shared_ptr<storm::models::symbolic::Model<Type, ValueType>> DdPrismModelBui
     storm::prism::Program const& program, Options const& options, std::shared_ptr<storm::dd::DdManager<Type>> const& manager) {
     // Start by initializing the structure used for storing all information needed during the model generation.
     // In particular, this creates the meta variables used to encode the model.
-    GenerationInformation generationInfo(program, manager);
+    GenerationInformation generationInfo(program, manager, storm::settings::getModule<storm::settings::modules::BuildSettings>().isDdStaticVariableOrderSet());
 
     SystemResult system = createSystemDecisionDiagram(generationInfo);
     storm::dd::Add<Type, ValueType> transitionMatrix = system.allTransitionsDd;
@@ -1432,20 +1435,8 @@ std::shared_ptr<storm::models::symbolic::Model<Type, ValueType>> DdPrismModelBui
     ModuleDecisionDiagram const& globalModule = system.globalModule;
 
     // If we were asked to treat some states as terminal states, we cut away their transitions now.
-    storm::dd::Bdd<Type> terminalStatesBdd = generationInfo.manager->getBddZero();
+    storm::dd::Bdd<Type> terminalStatesBdd = createTerminalStatesDecisionDiagram(generationInfo, options);
     if (!options.terminalStates.empty()) {
-        storm::expressions::Expression terminalExpression = options.terminalStates.asExpression([&program](std::string const& labelName) {
-            if (program.hasLabel(labelName)) {
-                return program.getLabelExpression(labelName);
-            } else {
-                STORM_LOG_THROW(labelName == "init" || labelName == "deadlock", storm::exceptions::InvalidArgumentException,
-                                "Terminal states refer to illegal label '" << labelName << "'.");
-                // If the label name is "init" we can abort 'exploration' directly at the initial state. If it is deadlock, we do not have to abort.
-                return program.getManager().boolean(labelName == "init");
-            }
-        });
-        terminalExpression = terminalExpression.substitute(program.getConstantsSubstitution());
-        terminalStatesBdd = generationInfo.rowExpressionAdapter->translateExpression(terminalExpression).toBdd();
         transitionMatrix *= (!terminalStatesBdd).template toAdd<ValueType>();
     }
 
@@ -1457,9 +1448,9 @@ std::shared_ptr<storm::models::symbolic::Model<Type, ValueType>> DdPrismModelBui
         transitionMatrixBdd = transitionMatrixBdd.existsAbstract(generationInfo.allNondeterminismVariables);
     }
 
-    storm::dd::Bdd<Type> reachableStates = storm::utility::dd::computeReachableStates<Type>(initialStates, transitionMatrixBdd, generationInfo.rowMetaVariables,
-                                                                                            generationInfo.columnMetaVariables)
-                                               .first;
+    storm::settings::modules::BuildSettings const& buildSettings = storm::settings::getModule<storm::settings::modules::BuildSettings>();
+    std::vector<std::vector<std::pair<storm::expressions::Variable, storm::expressions::Variable>>> variableGroups = createVariableGroups(generationInfo);
+    storm::dd::Bdd<Type> reachableStates = computeReachableStates(generationInfo, initialStates, transitionMatrixBdd, variableGroups);
     storm::dd::Add<Type, ValueType> reachableStatesAdd = reachableStates.template toAdd<ValueType>();
     transitionMatrix *= reachableStatesAdd;
     if (system.stateActionDd) {
@@ -1569,12 +1560,77 @@ std::shared_ptr<storm::models::symbolic::Model<Type, ValueType>> DdPrismModelBui
         result->addParameters(generationInfo.parameters);
     }
 
+    if (buildSettings.isDdPartitionedTransitionRelationSet()) {
+        result->setPartitionedTransitionRelation(storm::utility::dd::createPartitionedTransitionRelation(
+            result->getQualitativeTransitionMatrix(false), variableGroups, generationInfo.rowColumnMetaVariablePairs));
+    }
+
+    STORM_LOG_INFO("Built transition matrix with " << transitionMatrix.getNodeCount() << " nodes and reachable states with " << reachableStates.getNodeCount()
+                                                   << " nodes.");
     return result;
 }
 
 template<storm::dd::DdType Type, typename ValueType>
 std::shared_ptr<storm::models::symbolic::Model<Type, ValueType>> DdPrismModelBuilder<Type, ValueType>::build(storm::prism::Program const& program,
                                                                                                              Options const& options) {
+    checkProgram(program);
+
+    STORM_LOG_TRACE("Building representation of program:\n" << program << '\n');
+
+    auto manager = std::make_shared<storm::dd::DdManager<Type>>();
+    std::shared_ptr<storm::models::symbolic::Model<Type, ValueType>> result;
+    manager->execute([&program, &options, &manager, &result, this]() { result = this->buildInternal(program, options, manager); });
+    return result;
+}
+
+template<storm::dd::DdType Type, typename ValueType>
+std::vector<storm::generator::CompressedState> DdPrismModelBuilder<Type, ValueType>::buildReachableStates(
+    storm::prism::Program const& program, storm::generator::VariableInformation const& variableInformation, Options const& options) {
+    checkProgram(program);
+    STORM_LOG_THROW(program.getModelType() == storm::prism::Program::ModelType::DTMC || program.getModelType() == storm::prism::Program::ModelType::CTMC ||
+                        program.getModelType() == storm::prism::Program::ModelType::MDP,
+                    storm::exceptions::InvalidArgumentException, "Invalid model type.");
+
+    auto manager = std::make_shared<storm::dd::DdManager<Type>>();
+    std::vector<storm::generator::CompressedState> result;
+    manager->execute([&program, &variableInformation, &options, &manager, &result]() {
+        GenerationInformation generationInfo(program, manager,
+                                             storm::settings::getModule<storm::settings::modules::BuildSettings>().isDdStaticVariableOrderSet());
+
+        // Only the qualitative transition relation is kept, i.e., the (numeric) decision diagrams of the system are released right away.
+        storm::dd::Bdd<Type> transitionMatrixBdd = createSystemDecisionDiagram(generationInfo).allTransitionsDd.notZero();
+        if (!options.terminalStates.empty()) {
+            transitionMatrixBdd &= !createTerminalStatesDecisionDiagram(generationInfo, options);
+        }
+        if (program.getModelType() == storm::prism::Program::ModelType::MDP) {
+            transitionMatrixBdd = transitionMatrixBdd.existsAbstract(generationInfo.allNondeterminismVariables);
+        }
+        storm::dd::Bdd<Type> reachableStates = computeReachableStates(generationInfo, createInitialStatesDecisionDiagram(generationInfo),
+                                                                      transitionMatrixBdd, createVariableGroups(generationInfo));
+        transitionMatrixBdd = storm::dd::Bdd<Type>();
+        STORM_LOG_INFO("Computed " << reachableStates.getNonZeroCount() << " reachable states symbolically.");
+
+        // Pack the valuations of the reachable states into the given layout.
+        result.reserve(reachableStates.getNonZeroCount());
+        storm::dd::Add<Type, double> reachableStatesAdd = reachableStates.template toAdd<double>();
+        for (auto it = reachableStatesAdd.begin(), ite = reachableStatesAdd.end(); it != ite; ++it) {
+            storm::expressions::SimpleValuation const& valuation = (*it).first;
+            storm::generator::CompressedState state(variableInformation.getTotalBitOffset(true));
+            for (auto const& booleanVariable : variableInformation.booleanVariables) {
+                state.set(booleanVariable.bitOffset, valuation.getBooleanValue(generationInfo.variableToRowMetaVariableMap->at(booleanVariable.variable)));
+            }
+            for (auto const& integerVariable : variableInformation.integerVariables) {
+                int_fast64_t value = valuation.getIntegerValue(generationInfo.variableToRowMetaVariableMap->at(integerVariable.variable));
+                state.setFromInt(integerVariable.bitOffset, integerVariable.bitWidth, static_cast<uint64_t>(value - integerVariable.lowerBound));
+            }
+            result.push_back(std::move(state));
+        }
+    });
+    return result;
+}
+
+template<storm::dd::DdType Type, typename ValueType>
+void DdPrismModelBuilder<Type, ValueType>::checkProgram(storm::prism::Program const& program) {
     if (!std::is_same<ValueType, storm::RationalFunction>::value && program.hasUndefinedConstants()) {
         std::vector<std::reference_wrapper<storm::prism::Constant const>> undefinedConstants = program.getUndefinedConstants();
         std::stringstream stream;
@@ -1592,13 +1648,73 @@ std::shared_ptr<storm::models::symbolic::Model<Type, ValueType>> DdPrismModelBui
     }
     STORM_LOG_THROW(!program.hasUnboundedVariables(), storm::exceptions::InvalidArgumentException,
                     "Program contains unbounded variables which is not supported by the DD engine.");
+}
 
-    STORM_LOG_TRACE("Building representation of program:\n" << program << '\n');
+template<storm::dd::DdType Type, typename ValueType>
+storm::dd::Bdd<Type> DdPrismModelBuilder<Type, ValueType>::createTerminalStatesDecisionDiagram(GenerationInformation& generationInfo,
+                                                                                              Options const& options) {
+    if (options.terminalStates.empty()) {
+        return generationInfo.manager->getBddZero();
+    }
+    storm::prism::Program const& program = generationInfo.program;
+    storm::expressions::Expression terminalExpression = options.terminalStates.asExpression([&program](std::string const& labelName) {
+        if (program.hasLabel(labelName)) {
+            return program.getLabelExpression(labelName);
+        } else {
+            STORM_LOG_THROW(labelName == "init" || labelName == "deadlock", storm::exceptions::InvalidArgumentException,
+                            "Terminal states refer to illegal label '" << labelName << "'.");
+            // If the label name is "init" we can abort 'exploration' directly at the initial state. If it is deadlock, we do not have to abort.
+            return program.getManager().boolean(labelName == "init");
+        }
+    });
+    terminalExpression = terminalExpression.substitute(program.getConstantsSubstitution());
+    return generationInfo.rowExpressionAdapter->translateExpression(terminalExpression).toBdd();
+}
 
-    auto manager = std::make_shared<storm::dd::DdManager<Type>>();
-    std::shared_ptr<storm::models::symbolic::Model<Type, ValueType>> result;
-    manager->execute([&program, &options, &manager, &result, this]() { result = this->buildInternal(program, options, manager); });
-    return result;
+template<storm::dd::DdType Type, typename ValueType>
+std::vector<std::vector<std::pair<storm::expressions::Variable, storm::expressions::Variable>>> DdPrismModelBuilder<Type, ValueType>::createVariableGroups(
+    GenerationInformation& generationInfo) {
+    // These groups are used to split the transition relation by the module whose variables are changed. They are only needed if the
+    // relation is actually split.
+    std::vector<std::vector<std::pair<storm::expressions::Variable, storm::expressions::Variable>>> variableGroups;
+    storm::settings::modules::BuildSettings const& buildSettings = storm::settings::getModule<storm::settings::modules::BuildSettings>();
+    if (buildSettings.getDdReachabilityStrategy() != storm::builder::DdReachabilityStrategy::Bfs || buildSettings.isDdPartitionedTransitionRelationSet()) {
+        auto getVariablePair = [&generationInfo](storm::expressions::Variable const& variable) {
+            return std::make_pair(generationInfo.variableToRowMetaVariableMap->at(variable), generationInfo.variableToColumnMetaVariableMap->at(variable));
+        };
+        for (auto const& variable : generationInfo.allGlobalVariables) {
+            variableGroups.push_back({getVariablePair(variable)});
+        }
+        for (auto const& module : generationInfo.program.getModules()) {
+            std::vector<std::pair<storm::expressions::Variable, storm::expressions::Variable>> group;
+            for (auto const& variable : module.getIntegerVariables()) {
+                group.push_back(getVariablePair(variable.getExpressionVariable()));
+            }
+            for (auto const& variable : module.getBooleanVariables()) {
+                group.push_back(getVariablePair(variable.getExpressionVariable()));
+            }
+            variableGroups.push_back(std::move(group));
+        }
+    }
+    return variableGroups;
+}
+
+template<storm::dd::DdType Type, typename ValueType>
+storm::dd::Bdd<Type> DdPrismModelBuilder<Type, ValueType>::computeReachableStates(
+    GenerationInformation& generationInfo, storm::dd::Bdd<Type> const& initialStates, storm::dd::Bdd<Type> const& transitionMatrixBdd,
+    std::vector<std::vector<std::pair<storm::expressions::Variable, storm::expressions::Variable>>> const& variableGroups) {
+    storm::builder::DdReachabilityStrategy reachabilityStrategy =
+        storm::settings::getModule<storm::settings::modules::BuildSettings>().getDdReachabilityStrategy();
+    if (reachabilityStrategy == storm::builder::DdReachabilityStrategy::Bfs) {
+        return storm::utility::dd::computeReachableStates<Type>(initialStates, transitionMatrixBdd, generationInfo.rowMetaVariables,
+                                                                generationInfo.columnMetaVariables)
+            .first;
+    } else {
+        return storm::utility::dd::computeReachableStates<Type>(initialStates,
+                                                                storm::utility::dd::partitionTransitionRelation(transitionMatrixBdd, variableGroups),
+                                                                generationInfo.rowMetaVariables, generationInfo.columnMetaVariables, reachabilityStrategy)
+            .first;
+    }
 }
 
 template<storm::dd::DdType Type, typename ValueType>
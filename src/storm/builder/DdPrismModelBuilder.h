@@ -8,6 +8,7 @@
 #include "storm/storage/prism/Program.h"
 
 #include "storm/builder/TerminalStatesGetter.h"
+#include "storm/generator/CompressedState.h"
 
 #include "storm/logic/Formulas.h"
 #include "storm/utility/macros.h"
@@ -110,6 +111,20 @@ class DdPrismModelBuilder {
      */
     std::shared_ptr<storm::models::symbolic::Model<Type, ValueType>> build(storm::prism::Program const& program, Options const& options = Options());
 
+    /*!
+     * Computes the reachable states of the given program symbolically. In contrast to build, the transitions are only kept until the reachable
+     * states are known and neither rewards, labels nor a symbolic model are created. This allows to build a sparse model for the reachable
+     * states without translating a symbolic transition matrix (see storm::builder::ExplicitModelBuilder::setReachableStates).
+     *
+     * @param program The program whose reachable states to compute.
+     * @param variableInformation The layout in which the states are returned. It needs to contain all variables of the program.
+     * @param options The options to use. Only the terminal states are considered.
+     * @return The reachable states.
+     */
+    std::vector<storm::generator::CompressedState> buildReachableStates(storm::prism::Program const& program,
+                                                                        storm::generator::VariableInformation const& variableInformation,
+                                                                        Options const& options = Options());
+
    private:
     // This structure can store the decision diagrams representing a particular action.
     struct UpdateDecisionDiagram {
@@ -244,6 +259,31 @@ class DdPrismModelBuilder {
     std::shared_ptr<storm::models::symbolic::Model<Type, ValueType>> buildInternal(storm::prism::Program const& program, Options const& options,
                                                                                    std::shared_ptr<storm::dd::DdManager<Type>> const& manager);
 
+    /*!
+     * Checks whether the given program can be translated, i.e., it does not contain undefined constants (unless the model is parametric)
+     * or unbounded variables.
+     */
+    static void checkProgram(storm::prism::Program const& program);
+
+    /*!
+     * Translates the terminal states given in the options to a BDD over the row meta variables.
+     */
+    static storm::dd::Bdd<Type> createTerminalStatesDecisionDiagram(GenerationInformation& generationInfo, Options const& options);
+
+    /*!
+     * Groups the row and column meta variables by the module they belong to (global variables form groups of their own).
+     */
+    static std::vector<std::vector<std::pair<storm::expressions::Variable, storm::expressions::Variable>>> createVariableGroups(
+        GenerationInformation& generationInfo);
+
+    /*!
+     * Computes the states that are reachable from the initial states via the given transition relation (over row and column meta variables)
+     * using the reachability strategy given in the settings.
+     */
+    static storm::dd::Bdd<Type> computeReachableStates(
+        GenerationInformation& generationInfo, storm::dd::Bdd<Type> const& initialStates, storm::dd::Bdd<Type> const& transitionMatrixBdd,
+        std::vector<std::vector<std::pair<storm::expressions::Variable, storm::expressions::Variable>>> const& variableGroups);
+
     template<storm::dd::DdType TypePrime, typename ValueTypePrime>
     friend class ModuleComposer;
 
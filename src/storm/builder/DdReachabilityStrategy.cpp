@@ -0,0 +1,25 @@
+#include "storm/builder/DdReachabilityStrategy.h"
+
+namespace storm {
+namespace builder {
+
+std::ostream& operator<<(std::ostream& out, DdReachabilityStrategy const& strategy) {
+    switch (strategy) {
+        case DdReachabilityStrategy::Bfs:
+            out << "breadth-first";
+            break;
+        case DdReachabilityStrategy::Chaining:
+            out << "chaining";
+            break;
+        case DdReachabilityStrategy::Saturation:
+            out << "saturation";
+            break;
+        default:
+            out << "undefined";
+            break;
+    }
+    return out;
+}
+
+}  // namespace builder
+}  // namespace storm
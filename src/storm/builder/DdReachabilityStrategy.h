@@ -0,0 +1,17 @@
+#pragma once
+
+#include <ostream>
+
+namespace storm {
+namespace builder {
+
+// The strategies to compute the reachable states of a symbolic model. Breadth-first search applies the full transition
+// relation in every iteration. Chaining applies the parts of a partitioned transition relation one after another, each
+// to the states found so far. Saturation applies the parts that are located lowest in the variable order until a local
+// fixpoint is reached before moving on to the parts higher up, and revisits the lower parts whenever new states are found.
+enum class DdReachabilityStrategy { Bfs, Chaining, Saturation };
+
+std::ostream& operator<<(std::ostream& out, DdReachabilityStrategy const& strategy);
+
+}  // namespace builder
+}  // namespace storm
@@ -0,0 +1,121 @@
+#include "storm/builder/DdVariableOrdering.h"
+
+#include <algorithm>
+#include <numeric>
+#include <unordered_map>
+
+#include "storm/utility/macros.h"
+
+namespace storm {
+namespace builder {
+
+namespace detail {
+/*!
+ * Translates the clusters to lists of indices of the given variables, dropping variables that are not in the given list.
+ */
+std::vector<std::vector<uint64_t>> getIndexClusters(std::vector<storm::expressions::Variable> const& variables,
+                                                    std::vector<std::set<storm::expressions::Variable>> const& clusters) {
+    std::unordered_map<storm::expressions::Variable, uint64_t> variableToIndex;
+    for (uint64_t index = 0; index < variables.size(); ++index) {
+        variableToIndex.emplace(variables[index], index);
+    }
+    std::vector<std::vector<uint64_t>> result;
+    for (auto const& cluster : clusters) {
+        std::vector<uint64_t> indexCluster;
+        for (auto const& variable : cluster) {
+            auto it = variableToIndex.find(variable);
+            if (it != variableToIndex.end()) {
+                indexCluster.push_back(it->second);
+            }
+        }
+        // Clusters with a single variable do not influence the order.
+        if (indexCluster.size() > 1) {
+            result.push_back(std::move(indexCluster));
+        }
+    }
+    return result;
+}
+
+uint64_t computeTotalSpan(std::vector<uint64_t> const& positions, std::vector<std::vector<uint64_t>> const& clusters) {
+    uint64_t result = 0;
+    for (auto const& cluster : clusters) {
+        auto minMax = std::minmax_element(cluster.begin(), cluster.end(), [&positions](uint64_t a, uint64_t b) { return positions[a] < positions[b]; });
+        result += positions[*minMax.second] - positions[*minMax.first];
+    }
+    return result;
+}
+}  // namespace detail
+
+std::vector<storm::expressions::Variable> computeForceVariableOrder(std::vector<storm::expressions::Variable> const& variables,
+                                                                   std::vector<std::set<storm::expressions::Variable>> const& clusters,
+                                                                   uint64_t maximalNumberOfIterations) {
+    std::vector<std::vector<uint64_t>> indexClusters = detail::getIndexClusters(variables, clusters);
+    std::vector<std::vector<uint64_t>> variableToClusters(variables.size());
+    for (uint64_t cluster = 0; cluster < indexClusters.size(); ++cluster) {
+        for (auto const& variable : indexClusters[cluster]) {
+            variableToClusters[variable].push_back(cluster);
+        }
+    }
+
+    // The position of each variable in the current and in the best order found so far.
+    std::vector<uint64_t> positions(variables.size());
+    std::iota(positions.begin(), positions.end(), 0);
+    std::vector<uint64_t> bestPositions = positions;
+    uint64_t bestSpan = detail::computeTotalSpan(positions, indexClusters);
+
+    std::vector<double> centersOfGravity(indexClusters.size());
+    std::vector<double> tentativePositions(variables.size());
+    std::vector<uint64_t> order(variables.size());
+    for (uint64_t iteration = 0; iteration < maximalNumberOfIterations && bestSpan > 0; ++iteration) {
+        for (uint64_t cluster = 0; cluster < indexClusters.size(); ++cluster) {
+            double sum = 0.0;
+            for (auto const& variable : indexClusters[cluster]) {
+                sum += positions[variable];
+            }
+            centersOfGravity[cluster] = sum / indexClusters[cluster].size();
+        }
+        for (uint64_t variable = 0; variable < variables.size(); ++variable) {
+            if (variableToClusters[variable].empty()) {
+                tentativePositions[variable] = positions[variable];
+            } else {
+                double sum = 0.0;
+                for (auto const& cluster : variableToClusters[variable]) {
+                    sum += centersOfGravity[cluster];
+                }
+                tentativePositions[variable] = sum / variableToClusters[variable].size();
+            }
+        }
+
+        // Ties are broken by the current position, which keeps the heuristic deterministic.
+        std::iota(order.begin(), order.end(), 0);
+        std::sort(order.begin(), order.end(), [&](uint64_t a, uint64_t b) {
+            return tentativePositions[a] < tentativePositions[b] || (tentativePositions[a] == tentativePositions[b] && positions[a] < positions[b]);
+        });
+        for (uint64_t position = 0; position < order.size(); ++position) {
+            positions[order[position]] = position;
+        }
+
+        uint64_t span = detail::computeTotalSpan(positions, indexClusters);
+        if (span >= bestSpan) {
+            break;
+        }
+        bestSpan = span;
+        bestPositions = positions;
+    }
+
+    std::vector<storm::expressions::Variable> result(variables.size());
+    for (uint64_t variable = 0; variable < variables.size(); ++variable) {
+        result[bestPositions[variable]] = variables[variable];
+    }
+    STORM_LOG_DEBUG("Reduced the total span of the variable clusters from " << computeTotalSpan(variables, clusters) << " to " << bestSpan << ".");
+    return result;
+}
+
+uint64_t computeTotalSpan(std::vector<storm::expressions::Variable> const& variables, std::vector<std::set<storm::expressions::Variable>> const& clusters) {
+    std::vector<uint64_t> positions(variables.size());
+    std::iota(positions.begin(), positions.end(), 0);
+    return detail::computeTotalSpan(positions, detail::getIndexClusters(variables, clusters));
+}
+
+}  // namespace builder
+}  // namespace storm
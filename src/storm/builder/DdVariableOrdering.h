@@ -0,0 +1,33 @@
+#pragma once
+
+#include <set>
+#include <vector>
+
+#include "storm/storage/expressions/Variable.h"
+
+namespace storm {
+namespace builder {
+
+/*!
+ * Computes a static order of the given variables using the FORCE heuristic (Aloul et al., 2003). Each cluster is a set of variables that are
+ * used together, e.g., because they are tested by the same guard or appear in the same update. Starting from the given order, the variables
+ * are repeatedly placed at the average center of gravity of the clusters they appear in, until the total span of the clusters no longer decreases.
+ * Placing variables that are used together close to each other typically yields considerably smaller decision diagrams.
+ *
+ * @param variables The variables in their initial (e.g. declaration) order.
+ * @param clusters The sets of variables that are used together. Variables that do not appear in the given list are ignored.
+ * @param maximalNumberOfIterations The maximal number of iterations of the heuristic.
+ * @return The variables in the computed order.
+ */
+std::vector<storm::expressions::Variable> computeForceVariableOrder(std::vector<storm::expressions::Variable> const& variables,
+                                                                   std::vector<std::set<storm::expressions::Variable>> const& clusters,
+                                                                   uint64_t maximalNumberOfIterations = 100);
+
+/*!
+ * Computes the total span of the given clusters with respect to the given variable order, i.e., the sum of the distances between the first and
+ * the last variable of each cluster.
+ */
+uint64_t computeTotalSpan(std::vector<storm::expressions::Variable> const& variables, std::vector<std::set<storm::expressions::Variable>> const& clusters);
+
+}  // namespace builder
+}  // namespace storm
@@ -1,7 +1,10 @@
 #include "storm/builder/ExplicitModelBuilder.h"
 
+#include <algorithm>
 #include <map>
+#include <unordered_map>
 
+#include "storm/adapters/IntelTbbAdapter.h"
 #include "storm/adapters/RationalFunctionAdapter.h"
 
 #include "storm/builder/RewardModelBuilder.h"
@@ -30,6 +33,7 @@
 #include "storm/storage/jani/ParallelComposition.h"
 
 #include "storm/utility/ConstantsComparator.h"
+#include "storm/utility/Instrumentation.h"
 #include "storm/utility/SignalHandler.h"
 #include "storm/utility/builder.h"
 #include "storm/utility/constants.h"
@@ -54,16 +58,67 @@ uint64_t ExplicitStateLookup<StateType>::size() const {
     return this->stateToId.size();
 }
 
+template<typename StateType>
+VariableInformation const& ExplicitStateLookup<StateType>::getVariableInformation() const {
+    return this->varInfo;
+}
+
+template<typename StateType>
+storm::storage::BitVectorHashMap<StateType> const& ExplicitStateLookup<StateType>::getStateToIdMap() const {
+    return this->stateToId;
+}
+
+/*!
+ * Retrieves whether states are stored in the same way for both variable informations.
+ */
+bool haveSameStateLayout(VariableInformation const& first, VariableInformation const& second) {
+    if (first.getTotalBitOffset() != second.getTotalBitOffset() || first.locationVariables.size() != second.locationVariables.size() ||
+        first.booleanVariables.size() != second.booleanVariables.size() || first.integerVariables.size() != second.integerVariables.size() ||
+        first.hasOutOfBoundsBit() != second.hasOutOfBoundsBit()) {
+        return false;
+    }
+    for (uint64_t i = 0; i < first.locationVariables.size(); ++i) {
+        auto const& firstVariable = first.locationVariables[i];
+        auto const& secondVariable = second.locationVariables[i];
+        if (firstVariable.variable.getName() != secondVariable.variable.getName() || firstVariable.bitOffset != secondVariable.bitOffset ||
+            firstVariable.bitWidth != secondVariable.bitWidth) {
+            return false;
+        }
+    }
+    for (uint64_t i = 0; i < first.booleanVariables.size(); ++i) {
+        if (first.booleanVariables[i].getName() != second.booleanVariables[i].getName() ||
+            first.booleanVariables[i].bitOffset != second.booleanVariables[i].bitOffset) {
+            return false;
+        }
+    }
+    for (uint64_t i = 0; i < first.integerVariables.size(); ++i) {
+        auto const& firstVariable = first.integerVariables[i];
+        auto const& secondVariable = second.integerVariables[i];
+        if (firstVariable.getName() != secondVariable.getName() || firstVariable.bitOffset != secondVariable.bitOffset ||
+            firstVariable.bitWidth != secondVariable.bitWidth || firstVariable.lowerBound != secondVariable.lowerBound) {
+            return false;
+        }
+    }
+    return true;
+}
+
 template<typename ValueType, typename RewardModelType, typename StateType>
 ExplicitModelBuilder<ValueType, RewardModelType, StateType>::Options::Options()
-    : explorationOrder(storm::settings::getModule<storm::settings::modules::BuildSettings>().getExplorationOrder()) {
-    // Intentionally left empty.
+    : explorationOrder(storm::settings::getModule<storm::settings::modules::BuildSettings>().getExplorationOrder()),
+      numberOfThreads(storm::settings::getModule<storm::settings::modules::BuildSettings>().getNumberOfExplorationThreads()) {
+    auto const& buildSettings = storm::settings::getModule<storm::settings::modules::BuildSettings>();
+    if (buildSettings.isStateStorageDirectorySet()) {
+        stateStorageDirectory = buildSettings.getStateStorageDirectory();
+    }
+    if (buildSettings.isExplorationLimitSet()) {
+        explorationLimit = buildSettings.getExplorationLimit();
+    }
 }
 
 template<typename ValueType, typename RewardModelType, typename StateType>
 ExplicitModelBuilder<ValueType, RewardModelType, StateType>::ExplicitModelBuilder(
     std::shared_ptr<storm::generator::NextStateGenerator<ValueType, StateType>> const& generator, Options const& options)
-    : generator(generator), options(options), stateStorage(generator->getStateSize()) {
+    : generator(generator), options(options), stateStorage(generator->getStateSize(), options.stateStorageDirectory) {
     // Intentionally left empty.
 }
 
@@ -72,7 +127,11 @@ ExplicitModelBuilder<ValueType, RewardModelType, StateType>::ExplicitModelBuilde
                                                                                   storm::generator::NextStateGeneratorOptions const& generatorOptions,
                                                                                   Options const& builderOptions)
     : ExplicitModelBuilder(std::make_shared<storm::generator::PrismNextStateGenerator<ValueType, StateType>>(program, generatorOptions), builderOptions) {
-    // Intentionally left empty.
+    if (this->options.numberOfThreads > 1) {
+        generatorFactory = [program, generatorOptions]() {
+            return std::make_shared<storm::generator::PrismNextStateGenerator<ValueType, StateType>>(program, generatorOptions);
+        };
+    }
 }
 
 template<typename ValueType, typename RewardModelType, typename StateType>
@@ -80,7 +139,11 @@ ExplicitModelBuilder<ValueType, RewardModelType, StateType>::ExplicitModelBuilde
                                                                                   storm::generator::NextStateGeneratorOptions const& generatorOptions,
                                                                                   Options const& builderOptions)
     : ExplicitModelBuilder(std::make_shared<storm::generator::JaniNextStateGenerator<ValueType, StateType>>(model, generatorOptions), builderOptions) {
-    // Intentionally left empty.
+    if (this->options.numberOfThreads > 1) {
+        generatorFactory = [model, generatorOptions]() {
+            return std::make_shared<storm::generator::JaniNextStateGenerator<ValueType, StateType>>(model, generatorOptions);
+        };
+    }
 }
 
 template<typename ValueType, typename RewardModelType, typename StateType>
@@ -109,6 +172,14 @@ std::shared_ptr<storm::models::sparse::Model<ValueType, RewardModelType>> Explic
 
 template<typename ValueType, typename RewardModelType, typename StateType>
 StateType ExplicitModelBuilder<ValueType, RewardModelType, StateType>::getOrAddStateIndex(CompressedState const& state) {
+    if (generator->hasStateCanonicalizer()) {
+        // Only the representatives of the orbits of the symmetries of the model are stored (and explored).
+        CompressedState representative(state);
+        if (generator->canonicalizeState(representative)) {
+            return getOrAddStateIndex(representative);
+        }
+    }
+
     StateType newIndex = static_cast<StateType>(stateStorage.getNumberOfStates());
 
     // Check, if the state was already registered.
@@ -124,6 +195,12 @@ StateType ExplicitModelBuilder<ValueType, RewardModelType, StateType>::getOrAddS
             stateRemapping.get().push_back(storm::utility::zero<StateType>());
         } else if (options.explorationOrder == ExplorationOrder::Bfs) {
             statesToExplore.emplace_back(state, actualIndex);
+        } else if (options.explorationOrder == ExplorationOrder::BestFirst) {
+            // The priority of the new state is set once the transitions leading to it are known.
+            prioritizedStatesToExplore.emplace(actualIndex, state);
+            explorationPriorities.push_back(0.0);
+            explorationQueue.emplace(0.0, actualIndex);
+            stateRemapping.get().push_back(storm::utility::zero<StateType>());
         } else {
             STORM_LOG_ASSERT(false, "Invalid exploration order.");
         }
@@ -138,161 +215,379 @@ ExplicitStateLookup<StateType> ExplicitModelBuilder<ValueType, RewardModelType,
 }
 
 template<typename ValueType, typename RewardModelType, typename StateType>
-void ExplicitModelBuilder<ValueType, RewardModelType, StateType>::buildMatrices(
-    storm::storage::SparseMatrixBuilder<ValueType>& transitionMatrixBuilder,
-    std::vector<RewardModelBuilder<typename RewardModelType::ValueType>>& rewardModelBuilders,
-    StateAndChoiceInformationBuilder& stateAndChoiceInformationBuilder) {
-    // Initialize building state valuations (if necessary)
-    if (stateAndChoiceInformationBuilder.isBuildStateValuations()) {
-        stateAndChoiceInformationBuilder.stateValuationsBuilder() = generator->initializeStateValuationsBuilder();
-    }
+void ExplicitModelBuilder<ValueType, RewardModelType, StateType>::setPreviousBuild(
+    std::shared_ptr<storm::models::sparse::Model<ValueType, RewardModelType>> const& previousModel, ExplicitStateLookup<StateType> const& previousStateLookup,
+    storm::expressions::Expression const& changedBehaviorExpression) {
+    STORM_LOG_THROW(previousModel->getNumberOfStates() == previousStateLookup.size(), storm::exceptions::IllegalArgumentException,
+                    "The state lookup does not belong to the previous model.");
+    previousBuild = PreviousBuild{previousModel, previousStateLookup, changedBehaviorExpression, {}, {}, {}};
+}
 
-    // Create a callback for the next-state generator to enable it to request the index of states.
-    std::function<StateType(CompressedState const&)> stateToIdCallback =
-        std::bind(&ExplicitModelBuilder<ValueType, RewardModelType, StateType>::getOrAddStateIndex, this, std::placeholders::_1);
+template<typename ValueType, typename RewardModelType, typename StateType>
+void ExplicitModelBuilder<ValueType, RewardModelType, StateType>::preparePreviousBuild(
+    std::vector<RewardModelBuilder<typename RewardModelType::ValueType>> const& rewardModelBuilders,
+    StateAndChoiceInformationBuilder const& stateAndChoiceInformationBuilder) {
+    if (!previousBuild) {
+        return;
+    }
+    auto& previous = previousBuild.get();
+    auto dropPreviousBuild = [this](std::string const& reason) {
+        STORM_LOG_WARN("The previous build can not be reused, because " << reason << ". Expanding all states.");
+        previousBuild = boost::none;
+    };
+
+    auto modelType = generator->getModelType();
+    if (modelType != storm::generator::ModelType::DTMC && modelType != storm::generator::ModelType::MDP &&
+        modelType != storm::generator::ModelType::POMDP) {
+        dropPreviousBuild("this is only supported for DTMCs, MDPs and POMDPs");
+        return;
+    }
+    if (!std::is_same<ValueType, typename RewardModelType::ValueType>::value) {
+        dropPreviousBuild("the rewards are of a different type than the transitions");
+        return;
+    }
+    if (generator->hasStateCanonicalizer() || generator->getOptions().isPartialOrderReductionSet()) {
+        dropPreviousBuild("states are reduced during the exploration");
+        return;
+    }
+    if (stateAndChoiceInformationBuilder.isBuildChoiceOrigins()) {
+        dropPreviousBuild("choice origins are requested");
+        return;
+    }
+    if (stateAndChoiceInformationBuilder.isBuildChoiceLabels() && !previous.model->hasChoiceLabeling()) {
+        dropPreviousBuild("it has no choice labels");
+        return;
+    }
+    if (!haveSameStateLayout(previous.stateLookup.getVariableInformation(), generator->getVariableInformation())) {
+        dropPreviousBuild("the variables differ");
+        return;
+    }
+    previous.rewardModels.clear();
+    for (auto const& rewardModelBuilder : rewardModelBuilders) {
+        if (!previous.model->hasRewardModel(rewardModelBuilder.getName())) {
+            dropPreviousBuild("it has no reward model '" + rewardModelBuilder.getName() + "'");
+            return;
+        }
+        RewardModelType const& previousRewardModel = previous.model->getRewardModel(rewardModelBuilder.getName());
+        if ((rewardModelBuilder.hasStateRewards() && !previousRewardModel.hasStateRewards()) ||
+            (rewardModelBuilder.hasStateActionRewards() && !previousRewardModel.hasStateActionRewards())) {
+            dropPreviousBuild("its reward model '" + rewardModelBuilder.getName() + "' is of a different kind");
+            return;
+        }
+        previous.rewardModels.push_back(&previousRewardModel);
+    }
 
-    // If the exploration order is something different from breadth-first, we need to keep track of the remapping
-    // from state ids to row groups. For this, we actually store the reversed mapping of row groups to state-ids
-    // and later reverse it.
-    if (options.explorationOrder != ExplorationOrder::Bfs) {
-        stateRemapping = std::vector<uint_fast64_t>();
+    previous.states.resize(previous.stateLookup.size());
+    for (auto const& stateIndexPair : previous.stateLookup.getStateToIdMap()) {
+        previous.states[stateIndexPair.second] = stateIndexPair.first;
+    }
+    previous.statesToExpand = storm::storage::BitVector(previous.states.size());
+    for (auto const& label : {"deadlock", "unexplored"}) {
+        if (previous.model->getStateLabeling().containsLabel(label)) {
+            previous.statesToExpand |= previous.model->getStates(label);
+        }
     }
+}
 
-    // Let the generator create all initial states.
-    this->stateStorage.initialStateIndices = generator->getInitialStates(stateToIdCallback);
-    STORM_LOG_THROW(!this->stateStorage.initialStateIndices.empty(), storm::exceptions::WrongFormatException,
-                    "The model does not have a single initial state.");
+template<typename ValueType, typename RewardModelType, typename StateType>
+bool ExplicitModelBuilder<ValueType, RewardModelType, StateType>::reusePreviousBehavior(CompressedState const& currentState,
+                                                                                        storm::generator::StateBehavior<ValueType, StateType>& behavior) {
+    auto const& previous = previousBuild.get();
+    auto const& previousStateToId = previous.stateLookup.getStateToIdMap();
+    if (!previousStateToId.contains(currentState) || generator->satisfies(previous.changedBehaviorExpression)) {
+        return false;
+    }
+    StateType previousIndex = previousStateToId.getValue(currentState);
+    if (previous.statesToExpand.get(previousIndex)) {
+        return false;
+    }
 
-    // Now explore the current state until there is no more reachable state.
-    uint_fast64_t currentRowGroup = 0;
-    uint_fast64_t currentRow = 0;
+    if constexpr (std::is_same<ValueType, typename RewardModelType::ValueType>::value) {
+        behavior.clear();
+        behavior.setExpanded();
+        for (auto const& rewardModel : previous.rewardModels) {
+            behavior.addStateReward(rewardModel->hasStateRewards() ? rewardModel->getStateReward(previousIndex) : storm::utility::zero<ValueType>());
+        }
+        auto const& previousMatrix = previous.model->getTransitionMatrix();
+        for (auto row : previousMatrix.getRowGroupIndices(previousIndex)) {
+            storm::generator::Choice<ValueType, StateType> choice;
+            for (auto const& entry : previousMatrix.getRow(row)) {
+                choice.addProbability(getOrAddStateIndex(previous.states[entry.getColumn()]), entry.getValue());
+            }
+            for (auto const& rewardModel : previous.rewardModels) {
+                choice.addReward(rewardModel->hasStateActionRewards() ? rewardModel->getStateActionReward(row) : storm::utility::zero<ValueType>());
+            }
+            if (previous.model->hasChoiceLabeling()) {
+                choice.addLabels(previous.model->getChoiceLabeling().getLabelsOfChoice(row));
+            }
+            behavior.addChoice(std::move(choice));
+        }
+        return true;
+    } else {
+        return false;
+    }
+}
 
-    auto timeOfStart = std::chrono::high_resolution_clock::now();
-    auto timeOfLastMessage = std::chrono::high_resolution_clock::now();
-    uint64_t numberOfExploredStates = 0;
-    uint64_t numberOfExploredStatesSinceLastMessage = 0;
+template<typename ValueType, typename RewardModelType, typename StateType>
+VariableInformation const& ExplicitModelBuilder<ValueType, RewardModelType, StateType>::getVariableInformation() const {
+    return generator->getVariableInformation();
+}
 
-    // Perform a search through the model.
-    while (!statesToExplore.empty()) {
-        // Get the first state in the queue.
-        CompressedState currentState = statesToExplore.front().first;
-        StateType currentIndex = statesToExplore.front().second;
-        statesToExplore.pop_front();
+template<typename ValueType, typename RewardModelType, typename StateType>
+void ExplicitModelBuilder<ValueType, RewardModelType, StateType>::setReachableStates(std::vector<CompressedState>&& states) {
+    STORM_LOG_THROW(std::all_of(states.begin(), states.end(), [this](CompressedState const& state) { return state.size() == generator->getStateSize(); }),
+                    storm::exceptions::IllegalArgumentException, "The given states do not match the layout of the states of the model.");
+    reachableStates = std::move(states);
+}
 
-        // If the exploration order differs from breadth-first, we remember that this row group was actually
-        // filled with the transitions of a different state.
-        if (options.explorationOrder != ExplorationOrder::Bfs) {
-            stateRemapping.get()[currentIndex] = currentRowGroup;
-        }
+template<typename ValueType, typename RewardModelType, typename StateType>
+bool ExplicitModelBuilder<ValueType, RewardModelType, StateType>::prepareReachableStates() {
+    if (!reachableStates) {
+        return false;
+    }
+    if (generator->hasStateCanonicalizer() || generator->getOptions().isPartialOrderReductionSet()) {
+        STORM_LOG_WARN("The given reachable states can not be used for reduced state spaces. Searching for the reachable states instead.");
+        reachableStates = boost::none;
+        return false;
+    }
+    if (previousBuild) {
+        STORM_LOG_WARN("The previous build is not reused as the reachable states are given.");
+        previousBuild = boost::none;
+    }
+    STORM_LOG_WARN_COND(!options.explorationLimit, "The exploration limit is ignored as the reachable states are given.");
 
-        if (currentIndex % 100000 == 0) {
-            STORM_LOG_TRACE("Exploring state with id " << currentIndex << ".");
-        }
+    auto const& states = reachableStates.get();
+    for (uint64_t stateIndex = 0; stateIndex < states.size(); ++stateIndex) {
+        STORM_LOG_THROW(stateStorage.stateToId.findOrAdd(states[stateIndex], static_cast<StateType>(stateIndex)) == stateIndex,
+                        storm::exceptions::IllegalArgumentException, "The given reachable states contain duplicates.");
+    }
+    return true;
+}
 
-        generator->load(currentState);
-        if (stateAndChoiceInformationBuilder.isBuildStateValuations()) {
-            generator->addStateValuation(currentIndex, stateAndChoiceInformationBuilder.stateValuationsBuilder());
-        }
-        storm::generator::StateBehavior<ValueType, StateType> behavior = generator->expand(stateToIdCallback);
+template<typename ValueType, typename RewardModelType, typename StateType>
+StateType ExplicitModelBuilder<ValueType, RewardModelType, StateType>::getReachableStateIndex(CompressedState const& state) const {
+    STORM_LOG_THROW(stateStorage.stateToId.contains(state), storm::exceptions::IllegalArgumentException,
+                    "The state " << generator->stateToString(state) << " is reachable, but not among the given reachable states.");
+    return stateStorage.stateToId.getValue(state);
+}
 
-        // If there is no behavior, we might have to introduce a self-loop.
-        if (behavior.empty()) {
-            if (!storm::settings::getModule<storm::settings::modules::BuildSettings>().isDontFixDeadlocksSet() || !behavior.wasExpanded()) {
-                // If the behavior was actually expanded and yet there are no transitions, then we have a deadlock state.
-                if (behavior.wasExpanded()) {
-                    this->stateStorage.deadlockStateIndices.push_back(currentIndex);
-                }
+template<typename ValueType, typename RewardModelType, typename StateType>
+bool ExplicitModelBuilder<ValueType, RewardModelType, StateType>::useParallelExploration() const {
+    if (options.numberOfThreads <= 1) {
+        return false;
+    }
+#ifdef STORM_HAVE_INTELTBB
+    if (!generatorFactory) {
+        STORM_LOG_WARN("Parallel state space exploration is only supported when building from a PRISM program or a JANI model. Exploring sequentially.");
+        return false;
+    }
+    if (options.explorationOrder != ExplorationOrder::Bfs && !reachableStates) {
+        STORM_LOG_WARN("Parallel state space exploration is only supported for breadth-first exploration. Exploring sequentially.");
+        return false;
+    }
+    if (generator->getOptions().isAddOverlappingGuardLabelSet()) {
+        STORM_LOG_WARN("Parallel state space exploration is not supported when labeling states with overlapping guards. Exploring sequentially.");
+        return false;
+    }
+    if (std::is_same<ValueType, storm::RationalFunction>::value) {
+        STORM_LOG_WARN("Parallel state space exploration is not supported for parametric models. Exploring sequentially.");
+        return false;
+    }
+    if (generator->getOptions().isPartialOrderReductionSet()) {
+        STORM_LOG_WARN("Parallel state space exploration is not supported for partial order reduction. Exploring sequentially.");
+        return false;
+    }
+    if (options.explorationLimit && !reachableStates) {
+        STORM_LOG_WARN("Parallel state space exploration is not supported when limiting the number of expanded states. Exploring sequentially.");
+        return false;
+    }
+    if (previousBuild) {
+        STORM_LOG_WARN("Parallel state space exploration is not supported when reusing a previous build. Exploring sequentially.");
+        return false;
+    }
+    return true;
+#else
+    STORM_LOG_WARN("Storm was built without support for Intel TBB, defaulting to sequential version.");
+    return false;
+#endif
+}
 
-                if (!generator->isDeterministicModel()) {
-                    transitionMatrixBuilder.newRowGroup(currentRow);
-                }
+template<typename ValueType, typename RewardModelType, typename StateType>
+void ExplicitModelBuilder<ValueType, RewardModelType, StateType>::addStateBehavior(
+    CompressedState const& currentState, StateType stateIndex, storm::generator::StateBehavior<ValueType, StateType> const& behavior,
+    std::vector<StateType> const* localToGlobalStateIndices, uint_fast64_t& currentRow, uint_fast64_t& currentRowGroup,
+    storm::storage::SparseMatrixBuilder<ValueType>& transitionMatrixBuilder,
+    std::vector<RewardModelBuilder<typename RewardModelType::ValueType>>& rewardModelBuilders,
+    StateAndChoiceInformationBuilder& stateAndChoiceInformationBuilder) {
+    // If there is no behavior, we might have to introduce a self-loop.
+    if (behavior.empty()) {
+        if (!storm::settings::getModule<storm::settings::modules::BuildSettings>().isDontFixDeadlocksSet() || !behavior.wasExpanded()) {
+            // If the behavior was actually expanded and yet there are no transitions, then we have a deadlock state.
+            if (behavior.wasExpanded()) {
+                this->stateStorage.deadlockStateIndices.push_back(stateIndex);
+            }
 
-                transitionMatrixBuilder.addNextValue(currentRow, currentIndex, storm::utility::one<ValueType>());
+            if (!generator->isDeterministicModel()) {
+                transitionMatrixBuilder.newRowGroup(currentRow);
+            }
 
-                for (auto& rewardModelBuilder : rewardModelBuilders) {
-                    if (rewardModelBuilder.hasStateRewards()) {
-                        rewardModelBuilder.addStateReward(storm::utility::zero<ValueType>());
-                    }
+            transitionMatrixBuilder.addNextValue(currentRow, stateIndex, storm::utility::one<ValueType>());
 
-                    if (rewardModelBuilder.hasStateActionRewards()) {
-                        rewardModelBuilder.addStateActionReward(storm::utility::zero<ValueType>());
-                    }
+            for (auto& rewardModelBuilder : rewardModelBuilders) {
+                if (rewardModelBuilder.hasStateRewards()) {
+                    rewardModelBuilder.addStateReward(storm::utility::zero<ValueType>());
                 }
 
-                // This state shall be Markovian (to not introduce Zeno behavior)
-                if (stateAndChoiceInformationBuilder.isBuildMarkovianStates()) {
-                    stateAndChoiceInformationBuilder.addMarkovianState(currentRowGroup);
+                if (rewardModelBuilder.hasStateActionRewards()) {
+                    rewardModelBuilder.addStateActionReward(storm::utility::zero<ValueType>());
                 }
-                // Other state-based information does not need to be treated, in particular:
-                // * StateValuations have already been set above
-                // * The associated player shall be the "default" player, i.e. INVALID_PLAYER_INDEX
+            }
 
-                ++currentRow;
-                ++currentRowGroup;
-            } else {
-                STORM_LOG_THROW(false, storm::exceptions::WrongFormatException,
-                                "Error while creating sparse matrix from probabilistic program: found deadlock state ("
-                                    << generator->stateToString(currentState) << "). For fixing these, please provide the appropriate option.");
+            // This state shall be Markovian (to not introduce Zeno behavior)
+            if (stateAndChoiceInformationBuilder.isBuildMarkovianStates()) {
+                stateAndChoiceInformationBuilder.addMarkovianState(currentRowGroup);
             }
+            // Other state-based information does not need to be treated, in particular:
+            // * StateValuations have already been set by the caller
+            // * The associated player shall be the "default" player, i.e. INVALID_PLAYER_INDEX
+
+            ++currentRow;
+            ++currentRowGroup;
         } else {
-            // Add the state rewards to the corresponding reward models.
-            auto stateRewardIt = behavior.getStateRewards().begin();
-            for (auto& rewardModelBuilder : rewardModelBuilders) {
-                if (rewardModelBuilder.hasStateRewards()) {
-                    rewardModelBuilder.addStateReward(*stateRewardIt);
-                }
-                ++stateRewardIt;
+            STORM_LOG_THROW(false, storm::exceptions::WrongFormatException,
+                            "Error while creating sparse matrix from probabilistic program: found deadlock state ("
+                                << generator->stateToString(currentState) << "). For fixing these, please provide the appropriate option.");
+        }
+    } else {
+        // Add the state rewards to the corresponding reward models.
+        auto stateRewardIt = behavior.getStateRewards().begin();
+        for (auto& rewardModelBuilder : rewardModelBuilders) {
+            if (rewardModelBuilder.hasStateRewards()) {
+                rewardModelBuilder.addStateReward(*stateRewardIt);
             }
+            ++stateRewardIt;
+        }
 
-            // If the model is nondeterministic, we need to open a row group.
-            if (!generator->isDeterministicModel()) {
-                transitionMatrixBuilder.newRowGroup(currentRow);
-            }
+        // If the model is nondeterministic, we need to open a row group.
+        if (!generator->isDeterministicModel()) {
+            transitionMatrixBuilder.newRowGroup(currentRow);
+        }
 
-            // Now add all choices.
-            bool firstChoiceOfState = true;
-            for (auto const& choice : behavior) {
-                // add the generated choice information
-                if (stateAndChoiceInformationBuilder.isBuildChoiceLabels() && choice.hasLabels()) {
-                    for (auto const& label : choice.getLabels()) {
-                        stateAndChoiceInformationBuilder.addChoiceLabel(label, currentRow);
-                    }
-                }
-                if (stateAndChoiceInformationBuilder.isBuildChoiceOrigins() && choice.hasOriginData()) {
-                    stateAndChoiceInformationBuilder.addChoiceOriginData(choice.getOriginData(), currentRow);
+        // Now add all choices.
+        bool firstChoiceOfState = true;
+        for (auto const& choice : behavior) {
+            // add the generated choice information
+            if (stateAndChoiceInformationBuilder.isBuildChoiceLabels() && choice.hasLabels()) {
+                for (auto const& label : choice.getLabels()) {
+                    stateAndChoiceInformationBuilder.addChoiceLabel(label, currentRow);
                 }
-                if (stateAndChoiceInformationBuilder.isBuildStatePlayerIndications() && choice.hasPlayerIndex()) {
-                    STORM_LOG_ASSERT(
-                        firstChoiceOfState || stateAndChoiceInformationBuilder.hasStatePlayerIndicationBeenSet(choice.getPlayerIndex(), currentRowGroup),
-                        "There is a state where different players have an enabled choice.");  // Should have been detected in generator, already
-                    if (firstChoiceOfState) {
-                        stateAndChoiceInformationBuilder.addStatePlayerIndication(choice.getPlayerIndex(), currentRowGroup);
-                    }
-                }
-                if (stateAndChoiceInformationBuilder.isBuildMarkovianStates() && choice.isMarkovian()) {
-                    stateAndChoiceInformationBuilder.addMarkovianState(currentRowGroup);
+            }
+            if (stateAndChoiceInformationBuilder.isBuildChoiceOrigins() && choice.hasOriginData()) {
+                stateAndChoiceInformationBuilder.addChoiceOriginData(choice.getOriginData(), currentRow);
+            }
+            if (stateAndChoiceInformationBuilder.isBuildStatePlayerIndications() && choice.hasPlayerIndex()) {
+                STORM_LOG_ASSERT(
+                    firstChoiceOfState || stateAndChoiceInformationBuilder.hasStatePlayerIndicationBeenSet(choice.getPlayerIndex(), currentRowGroup),
+                    "There is a state where different players have an enabled choice.");  // Should have been detected in generator, already
+                if (firstChoiceOfState) {
+                    stateAndChoiceInformationBuilder.addStatePlayerIndication(choice.getPlayerIndex(), currentRowGroup);
                 }
+            }
+            if (stateAndChoiceInformationBuilder.isBuildMarkovianStates() && choice.isMarkovian()) {
+                stateAndChoiceInformationBuilder.addMarkovianState(currentRowGroup);
+            }
 
-                // Add the probabilistic behavior to the matrix.
-                for (auto const& stateProbabilityPair : choice) {
-                    transitionMatrixBuilder.addNextValue(currentRow, stateProbabilityPair.first, stateProbabilityPair.second);
-                }
+            // Add the probabilistic behavior to the matrix.
+            for (auto const& stateProbabilityPair : choice) {
+                StateType column = localToGlobalStateIndices ? (*localToGlobalStateIndices)[stateProbabilityPair.first] : stateProbabilityPair.first;
+                transitionMatrixBuilder.addNextValue(currentRow, column, stateProbabilityPair.second);
+            }
 
-                // Add the rewards to the reward models.
-                auto choiceRewardIt = choice.getRewards().begin();
-                for (auto& rewardModelBuilder : rewardModelBuilders) {
-                    if (rewardModelBuilder.hasStateActionRewards()) {
-                        rewardModelBuilder.addStateActionReward(*choiceRewardIt);
-                    }
-                    ++choiceRewardIt;
+            // Add the rewards to the reward models.
+            auto choiceRewardIt = choice.getRewards().begin();
+            for (auto& rewardModelBuilder : rewardModelBuilders) {
+                if (rewardModelBuilder.hasStateActionRewards()) {
+                    rewardModelBuilder.addStateActionReward(*choiceRewardIt);
                 }
-                ++currentRow;
-                firstChoiceOfState = false;
+                ++choiceRewardIt;
             }
+            ++currentRow;
+            firstChoiceOfState = false;
+        }
 
-            ++currentRowGroup;
+        ++currentRowGroup;
+    }
+}
+
+template<typename ValueType, typename RewardModelType, typename StateType>
+void ExplicitModelBuilder<ValueType, RewardModelType, StateType>::buildMatrices(
+    storm::storage::SparseMatrixBuilder<ValueType>& transitionMatrixBuilder,
+    std::vector<RewardModelBuilder<typename RewardModelType::ValueType>>& rewardModelBuilders,
+    StateAndChoiceInformationBuilder& stateAndChoiceInformationBuilder) {
+    // Initialize building state valuations (if necessary)
+    if (stateAndChoiceInformationBuilder.isBuildStateValuations()) {
+        stateAndChoiceInformationBuilder.stateValuationsBuilder() = generator->initializeStateValuationsBuilder();
+    }
+
+    preparePreviousBuild(rewardModelBuilders, stateAndChoiceInformationBuilder);
+    bool const useReachableStates = prepareReachableStates();
+
+    // The labels are evaluated while the states are explored.
+    labelNames.clear();
+    labelExpressions.clear();
+    for (auto& labelAndExpression : generator->getStateLabelExpressions()) {
+        labelNames.push_back(std::move(labelAndExpression.first));
+        labelExpressions.push_back(std::move(labelAndExpression.second));
+    }
+    labelStates.assign(labelNames.size(), storm::storage::BitVector());
+
+    // Create a callback for the next-state generator to enable it to request the index of states. If the states are given, they are only
+    // looked up, which can be done by multiple threads at once.
+    std::function<StateType(CompressedState const&)> stateToIdCallback;
+    if (useReachableStates) {
+        stateToIdCallback = [this](CompressedState const& state) { return getReachableStateIndex(state); };
+    } else {
+        stateToIdCallback = std::bind(&ExplicitModelBuilder<ValueType, RewardModelType, StateType>::getOrAddStateIndex, this, std::placeholders::_1);
+    }
+
+    // The partial order reduction needs to know which states were already found.
+    if (generator->getOptions().isPartialOrderReductionSet()) {
+        generator->setStateIsKnownCallback([this](CompressedState const& state) {
+            CompressedState representative(state);
+            generator->canonicalizeState(representative);
+            return stateStorage.stateToId.contains(representative);
+        });
+    }
+
+    // If the exploration order is something different from breadth-first, we need to keep track of the remapping
+    // from state ids to row groups. For this, we actually store the reversed mapping of row groups to state-ids
+    // and later reverse it.
+    if (options.explorationOrder != ExplorationOrder::Bfs && !useReachableStates) {
+        stateRemapping = std::vector<uint_fast64_t>();
+    }
+
+    // Let the generator create all initial states.
+    this->stateStorage.initialStateIndices = generator->getInitialStates(stateToIdCallback);
+    STORM_LOG_THROW(!this->stateStorage.initialStateIndices.empty(), storm::exceptions::WrongFormatException,
+                    "The model does not have a single initial state.");
+    if (options.explorationOrder == ExplorationOrder::BestFirst && !useReachableStates) {
+        for (auto const& initialStateIndex : this->stateStorage.initialStateIndices) {
+            explorationPriorities[initialStateIndex] = 1.0;
+            explorationQueue.emplace(1.0, initialStateIndex);
         }
+    }
+
+    // Now explore the current state until there is no more reachable state.
+    uint_fast64_t currentRowGroup = 0;
+    uint_fast64_t currentRow = 0;
 
+    auto timeOfStart = std::chrono::high_resolution_clock::now();
+    auto timeOfLastMessage = std::chrono::high_resolution_clock::now();
+    uint64_t numberOfExploredStates = 0;
+    uint64_t numberOfExploredStatesSinceLastMessage = 0;
+
+    // Reports the progress (if requested) and checks for abortion after a state has been explored.
+    auto finishExploredState = [&]() {
         ++numberOfExploredStates;
         if (generator->getOptions().isShowProgressSet()) {
             ++numberOfExploredStatesSinceLastMessage;
@@ -313,13 +608,223 @@ void ExplicitModelBuilder<ValueType, RewardModelType, StateType>::buildMatrices(
             auto durationSinceStart = std::chrono::duration_cast<std::chrono::seconds>(std::chrono::high_resolution_clock::now() - timeOfStart).count();
             std::cout << "Explored " << numberOfExploredStates << " states in " << durationSinceStart << " seconds before abort.\n";
             STORM_LOG_THROW(false, storm::exceptions::AbortException, "Aborted in state space exploration.");
-            break;
+        }
+    };
+
+    // Stores the labels that hold in the given state.
+    auto addStateLabels = [this](StateType stateIndex, storm::storage::BitVector const& labels) {
+        for (auto labelIndex : labels) {
+            storm::storage::BitVector& states = labelStates[labelIndex];
+            if (stateIndex >= states.size()) {
+                states.resize(std::max<uint64_t>(2 * states.size(), stateIndex + 1));
+            }
+            states.set(stateIndex);
+        }
+    };
+
+    if (useReachableStates) {
+        // As all states are known, the states are expanded independently of each other. The states are processed in batches: the states of a
+        // batch are expanded (in parallel, if requested) and their behavior is then directly added to the matrix before the next batch is
+        // expanded, so only the behavior of one batch is kept in memory at a time.
+        std::vector<CompressedState> const& states = reachableStates.get();
+        bool const parallel = useParallelExploration();
+        if (parallel) {
+            STORM_LOG_INFO("Expanding the given " << states.size() << " states with " << options.numberOfThreads << " threads.");
+        }
+        std::vector<std::shared_ptr<storm::generator::NextStateGenerator<ValueType, StateType>>> workerGenerators;
+        if (parallel) {
+            for (uint64_t thread = 0; thread < options.numberOfThreads; ++thread) {
+                workerGenerators.push_back(generatorFactory());
+            }
+        }
+
+        struct ExpandedState {
+            storm::generator::StateBehavior<ValueType, StateType> behavior;
+            // The labels that hold in the state.
+            storm::storage::BitVector labels;
+        };
+        auto expandState = [this, &states, &stateToIdCallback](storm::generator::NextStateGenerator<ValueType, StateType>& stateGenerator,
+                                                               uint64_t stateIndex, ExpandedState& expandedState) {
+            stateGenerator.load(states[stateIndex]);
+            expandedState.labels = stateGenerator.evaluateLabels(labelExpressions);
+            expandedState.behavior = stateGenerator.expand(stateToIdCallback);
+        };
+        uint64_t const batchSize = parallel ? std::max<uint64_t>(1024, 256 * options.numberOfThreads) : 1;
+        std::vector<ExpandedState> expandedStates;
+#ifdef STORM_HAVE_INTELTBB
+        tbb::task_arena arena(parallel ? options.numberOfThreads : 1);
+#endif
+
+        for (uint64_t batchStart = 0; batchStart < states.size(); batchStart += batchSize) {
+            uint64_t const batchEnd = std::min<uint64_t>(batchStart + batchSize, states.size());
+            expandedStates.clear();
+            expandedStates.resize(batchEnd - batchStart);
+            if (parallel) {
+#ifdef STORM_HAVE_INTELTBB
+                arena.execute([&]() {
+                    tbb::parallel_for(tbb::blocked_range<uint64_t>(batchStart, batchEnd), [&](tbb::blocked_range<uint64_t> const& range) {
+                        auto& workerGenerator = *workerGenerators[tbb::this_task_arena::current_thread_index()];
+                        for (uint64_t stateIndex = range.begin(); stateIndex < range.end(); ++stateIndex) {
+                            expandState(workerGenerator, stateIndex, expandedStates[stateIndex - batchStart]);
+                        }
+                    });
+                });
+#endif
+            } else {
+                for (uint64_t stateIndex = batchStart; stateIndex < batchEnd; ++stateIndex) {
+                    expandState(*generator, stateIndex, expandedStates[stateIndex - batchStart]);
+                }
+            }
+
+            for (uint64_t stateIndex = batchStart; stateIndex < batchEnd; ++stateIndex) {
+                StateType const currentIndex = static_cast<StateType>(stateIndex);
+                auto& expandedState = expandedStates[stateIndex - batchStart];
+                if (stateAndChoiceInformationBuilder.isBuildStateValuations()) {
+                    generator->load(states[stateIndex]);
+                    generator->addStateValuation(currentIndex, stateAndChoiceInformationBuilder.stateValuationsBuilder());
+                }
+                addStateLabels(currentIndex, expandedState.labels);
+                addStateBehavior(states[stateIndex], currentIndex, expandedState.behavior, nullptr, currentRow, currentRowGroup, transitionMatrixBuilder,
+                                 rewardModelBuilders, stateAndChoiceInformationBuilder);
+                // Free the memory of the behavior early.
+                expandedState = ExpandedState();
+                finishExploredState();
+            }
+        }
+        // The states are now kept by the state storage.
+        reachableStates = boost::none;
+    } else if (useParallelExploration()) {
+#ifdef STORM_HAVE_INTELTBB
+        STORM_LOG_INFO("Exploring the state space with " << options.numberOfThreads << " threads.");
+        // Each thread expands states with its own generator. Successor states are only given thread-local indices during the expansion.
+        // Afterwards, the expanded states are processed sequentially in the order of the queue, where the successors are assigned their actual
+        // indices. This yields exactly the same model as the sequential breadth-first exploration.
+        std::vector<std::shared_ptr<storm::generator::NextStateGenerator<ValueType, StateType>>> workerGenerators;
+        for (uint64_t thread = 0; thread < options.numberOfThreads; ++thread) {
+            workerGenerators.push_back(generatorFactory());
+        }
+        std::vector<std::unordered_map<CompressedState, StateType>> workerStateToLocalId(options.numberOfThreads);
+        tbb::task_arena arena(options.numberOfThreads);
+
+        struct ExpandedState {
+            storm::generator::StateBehavior<ValueType, StateType> behavior;
+            // The successor states in the order in which they were requested, i.e., the successor with local index i is at position i.
+            std::vector<CompressedState> successors;
+            // The labels that hold in the state.
+            storm::storage::BitVector labels;
+        };
+        uint64_t const maxBatchSize = std::max<uint64_t>(1024, 256 * options.numberOfThreads);
+        std::vector<std::pair<CompressedState, StateType>> batch;
+        std::vector<ExpandedState> expandedStates;
+        std::vector<StateType> localToGlobalStateIndices;
+
+        while (!statesToExplore.empty()) {
+            uint64_t const batchSize = std::min<uint64_t>(maxBatchSize, statesToExplore.size());
+            batch.assign(std::make_move_iterator(statesToExplore.begin()), std::make_move_iterator(statesToExplore.begin() + batchSize));
+            statesToExplore.erase(statesToExplore.begin(), statesToExplore.begin() + batchSize);
+            expandedStates.clear();
+            expandedStates.resize(batchSize);
+
+            arena.execute([&]() {
+                tbb::parallel_for(tbb::blocked_range<uint64_t>(0, batchSize), [&](tbb::blocked_range<uint64_t> const& range) {
+                    auto const thread = tbb::this_task_arena::current_thread_index();
+                    auto& workerGenerator = *workerGenerators[thread];
+                    auto& stateToLocalId = workerStateToLocalId[thread];
+                    for (uint64_t i = range.begin(); i < range.end(); ++i) {
+                        auto& expandedState = expandedStates[i];
+                        stateToLocalId.clear();
+                        std::function<StateType(CompressedState const&)> localStateToIdCallback = [&stateToLocalId,
+                                                                                                    &expandedState](CompressedState const& state) {
+                            auto insertionRes = stateToLocalId.emplace(state, static_cast<StateType>(expandedState.successors.size()));
+                            if (insertionRes.second) {
+                                expandedState.successors.push_back(state);
+                            }
+                            return insertionRes.first->second;
+                        };
+                        workerGenerator.load(batch[i].first);
+                        expandedState.labels = workerGenerator.evaluateLabels(labelExpressions);
+                        expandedState.behavior = workerGenerator.expand(localStateToIdCallback);
+                    }
+                });
+            });
+
+            for (uint64_t i = 0; i < batchSize; ++i) {
+                CompressedState const& currentState = batch[i].first;
+                StateType currentIndex = batch[i].second;
+                auto& expandedState = expandedStates[i];
+
+                // Register the successors in the same order as the sequential exploration would.
+                localToGlobalStateIndices.clear();
+                for (auto const& successor : expandedState.successors) {
+                    localToGlobalStateIndices.push_back(getOrAddStateIndex(successor));
+                }
+
+                if (stateAndChoiceInformationBuilder.isBuildStateValuations()) {
+                    generator->load(currentState);
+                    generator->addStateValuation(currentIndex, stateAndChoiceInformationBuilder.stateValuationsBuilder());
+                }
+                addStateLabels(currentIndex, expandedState.labels);
+                addStateBehavior(currentState, currentIndex, expandedState.behavior, &localToGlobalStateIndices, currentRow, currentRowGroup,
+                                 transitionMatrixBuilder, rewardModelBuilders, stateAndChoiceInformationBuilder);
+                // Free the memory of the behavior early.
+                expandedState = ExpandedState();
+                finishExploredState();
+            }
+        }
+#endif
+    } else {
+        uint64_t numberOfExpandedStates = 0;
+        uint64_t numberOfReusedStates = 0;
+
+        // Perform a search through the model.
+        while (hasStatesToExplore()) {
+            // Get the next state according to the exploration order.
+            auto [currentState, currentIndex] = takeNextStateToExplore();
+
+            // If the exploration order differs from breadth-first, we remember that this row group was actually
+            // filled with the transitions of a different state.
+            if (options.explorationOrder != ExplorationOrder::Bfs) {
+                stateRemapping.get()[currentIndex] = currentRowGroup;
+            }
+
+            if (currentIndex % 100000 == 0) {
+                STORM_LOG_TRACE("Exploring state with id " << currentIndex << ".");
+            }
+
+            generator->load(currentState);
+            generator->evaluateLabels(labelExpressions, currentIndex, labelStates);
+            if (stateAndChoiceInformationBuilder.isBuildStateValuations()) {
+                generator->addStateValuation(currentIndex, stateAndChoiceInformationBuilder.stateValuationsBuilder());
+            }
+            // Once the exploration limit is reached, the remaining states are kept, but not expanded.
+            storm::generator::StateBehavior<ValueType, StateType> behavior;
+            if (!options.explorationLimit || numberOfExpandedStates < options.explorationLimit.get()) {
+                if (previousBuild && reusePreviousBehavior(currentState, behavior)) {
+                    ++numberOfReusedStates;
+                } else {
+                    behavior = generator->expand(stateToIdCallback);
+                }
+                ++numberOfExpandedStates;
+            } else {
+                unexploredStateIndices.push_back(static_cast<StateType>(currentRowGroup));
+            }
+            if (options.explorationOrder == ExplorationOrder::BestFirst) {
+                updateExplorationPriorities(currentIndex, behavior);
+            }
+            addStateBehavior(currentState, currentIndex, behavior, nullptr, currentRow, currentRowGroup, transitionMatrixBuilder, rewardModelBuilders,
+                             stateAndChoiceInformationBuilder);
+            // The memory of the behavior is reused for the next state.
+            generator->recycle(std::move(behavior));
+            finishExploredState();
+        }
+        if (previousBuild) {
+            STORM_LOG_INFO("Reused the behavior of " << numberOfReusedStates << " of " << numberOfExploredStates << " states from the previous build.");
         }
     }
 
     // If the exploration order was not breadth-first, we need to fix the entries in the matrix according to
     // (reversed) mapping of row groups to indices.
-    if (options.explorationOrder != ExplorationOrder::Bfs) {
+    if (options.explorationOrder != ExplorationOrder::Bfs && !useReachableStates) {
         STORM_LOG_ASSERT(stateRemapping, "Unable to fix columns without mapping.");
         std::vector<uint_fast64_t> const& remapping = stateRemapping.get();
 
@@ -328,6 +833,7 @@ void ExplicitModelBuilder<ValueType, RewardModelType, StateType>::buildMatrices(
         // (b) the initial states
         // (c) the hash map storing the mapping states -> ids
         // (d) fix remapping for state-generation labels
+        // (e) the states satisfying the labels
 
         // Fix (a).
         transitionMatrixBuilder.replaceColumns(remapping, 0);
@@ -343,11 +849,22 @@ void ExplicitModelBuilder<ValueType, RewardModelType, StateType>::buildMatrices(
         this->stateStorage.stateToId.remap([&remapping](StateType const& state) { return remapping[state]; });
 
         this->generator->remapStateIds([&remapping](StateType const& state) { return remapping[state]; });
+
+        // Fix (e).
+        for (auto& states : labelStates) {
+            storm::storage::BitVector remappedStates(remapping.size());
+            for (auto state : states) {
+                remappedStates.set(remapping[state]);
+            }
+            states = std::move(remappedStates);
+        }
     }
 }
 
 template<typename ValueType, typename RewardModelType, typename StateType>
 storm::storage::sparse::ModelComponents<ValueType, RewardModelType> ExplicitModelBuilder<ValueType, RewardModelType, StateType>::buildModelComponents() {
+    storm::utility::instrumentation::ScopedRegion region("explicit model building");
+
     // Determine whether we have to combine different choices to one or whether this model can have more than
     // one choice per state.
     bool deterministicModel = generator->isDeterministicModel();
@@ -365,7 +882,10 @@ storm::storage::sparse::ModelComponents<ValueType, RewardModelType> ExplicitMode
     stateAndChoiceInformationBuilder.setBuildMarkovianStates(generator->getModelType() == storm::generator::ModelType::MA);
     stateAndChoiceInformationBuilder.setBuildStateValuations(generator->getOptions().isBuildStateValuationsSet());
 
-    buildMatrices(transitionMatrixBuilder, rewardModelBuilders, stateAndChoiceInformationBuilder);
+    {
+        storm::utility::instrumentation::ScopedRegion explorationRegion("state space exploration");
+        buildMatrices(transitionMatrixBuilder, rewardModelBuilders, stateAndChoiceInformationBuilder);
+    }
 
     // Initialize the model components with the obtained information.
     storm::storage::sparse::ModelComponents<ValueType, RewardModelType> modelComponents(
@@ -374,6 +894,10 @@ storm::storage::sparse::ModelComponents<ValueType, RewardModelType> ExplicitMode
 
     uint_fast64_t numStates = modelComponents.transitionMatrix.getColumnCount();
     uint_fast64_t numChoices = modelComponents.transitionMatrix.getRowCount();
+    storm::utility::instrumentation::addToCounter("explicit model building: states", numStates);
+    storm::utility::instrumentation::addToCounter("explicit model building: transitions", modelComponents.transitionMatrix.getEntryCount());
+    storm::utility::instrumentation::recordMemory("explicit model building: transition matrix", modelComponents.transitionMatrix.getSizeInMemory());
+    storm::utility::instrumentation::recordMemory("explicit model building: state storage", stateStorage.getSizeInMemory());
 
     // Now finalize all reward models.
     for (auto& rewardModelBuilder : rewardModelBuilders) {
@@ -396,6 +920,7 @@ storm::storage::sparse::ModelComponents<ValueType, RewardModelType> ExplicitMode
     // If requested, build the state valuations and choice origins
     if (stateAndChoiceInformationBuilder.isBuildStateValuations()) {
         modelComponents.stateValuations = stateAndChoiceInformationBuilder.stateValuationsBuilder().build();
+        storm::utility::instrumentation::recordMemory("explicit model building: state valuations", modelComponents.stateValuations->getSizeInMemory());
     }
     if (stateAndChoiceInformationBuilder.isBuildChoiceOrigins()) {
         auto originData = stateAndChoiceInformationBuilder.buildDataOfChoiceOrigins(numChoices);
@@ -419,7 +944,79 @@ storm::storage::sparse::ModelComponents<ValueType, RewardModelType> ExplicitMode
 
 template<typename ValueType, typename RewardModelType, typename StateType>
 storm::models::sparse::StateLabeling ExplicitModelBuilder<ValueType, RewardModelType, StateType>::buildStateLabeling() {
-    return generator->label(stateStorage, stateStorage.initialStateIndices, stateStorage.deadlockStateIndices);
+    std::vector<std::pair<std::string, storm::storage::BitVector>> evaluatedLabels;
+    for (uint64_t labelIndex = 0; labelIndex < labelNames.size(); ++labelIndex) {
+        evaluatedLabels.emplace_back(labelNames[labelIndex], std::move(labelStates[labelIndex]));
+    }
+    storm::models::sparse::StateLabeling result =
+        generator->createLabeling(stateStorage, std::move(evaluatedLabels), stateStorage.initialStateIndices, stateStorage.deadlockStateIndices);
+    if (!unexploredStateIndices.empty()) {
+        STORM_LOG_INFO(unexploredStateIndices.size() << " states were not expanded, because the exploration limit was reached.");
+        if (result.containsLabel("unexplored")) {
+            STORM_LOG_WARN("The model already has a label 'unexplored'. The states that were not expanded are not labeled.");
+        } else {
+            storm::storage::BitVector unexploredStates(stateStorage.getNumberOfStates());
+            for (auto const& stateIndex : unexploredStateIndices) {
+                unexploredStates.set(stateIndex);
+            }
+            result.addLabel("unexplored", std::move(unexploredStates));
+        }
+    }
+    return result;
+}
+
+template<typename ValueType, typename RewardModelType, typename StateType>
+bool ExplicitModelBuilder<ValueType, RewardModelType, StateType>::hasStatesToExplore() const {
+    if (options.explorationOrder == ExplorationOrder::BestFirst) {
+        return !prioritizedStatesToExplore.empty();
+    }
+    return !statesToExplore.empty();
+}
+
+template<typename ValueType, typename RewardModelType, typename StateType>
+std::pair<CompressedState, StateType> ExplicitModelBuilder<ValueType, RewardModelType, StateType>::takeNextStateToExplore() {
+    std::pair<CompressedState, StateType> result;
+    if (options.explorationOrder == ExplorationOrder::BestFirst) {
+        while (true) {
+            auto [priority, stateIndex] = explorationQueue.top();
+            explorationQueue.pop();
+            auto stateIt = prioritizedStatesToExplore.find(stateIndex);
+            // Skip entries of states that were already explored or whose priority has increased in the meantime.
+            if (stateIt != prioritizedStatesToExplore.end() && priority == explorationPriorities[stateIndex]) {
+                result = std::make_pair(std::move(stateIt->second), stateIndex);
+                prioritizedStatesToExplore.erase(stateIt);
+                return result;
+            }
+        }
+    }
+    result = std::move(statesToExplore.front());
+    statesToExplore.pop_front();
+    return result;
+}
+
+template<typename ValueType, typename RewardModelType, typename StateType>
+void ExplicitModelBuilder<ValueType, RewardModelType, StateType>::updateExplorationPriorities(
+    StateType stateIndex, storm::generator::StateBehavior<ValueType, StateType> const& behavior) {
+    double const priority = explorationPriorities[stateIndex];
+    for (auto const& choice : behavior) {
+        // For parametric models, the probabilities can not be evaluated, so all successors inherit the priority of the state.
+        double totalMass = 1.0;
+        if constexpr (!std::is_same<ValueType, storm::RationalFunction>::value) {
+            // Rates are normalized to probabilities.
+            totalMass = storm::utility::convertNumber<double>(choice.getTotalMass());
+        }
+        for (auto const& stateProbabilityPair : choice) {
+            double successorPriority = priority;
+            if constexpr (!std::is_same<ValueType, storm::RationalFunction>::value) {
+                successorPriority *= storm::utility::convertNumber<double>(stateProbabilityPair.second) / totalMass;
+            }
+            StateType const successorIndex = stateProbabilityPair.first;
+            if (successorPriority > explorationPriorities[successorIndex] && prioritizedStatesToExplore.count(successorIndex) > 0) {
+                explorationPriorities[successorIndex] = successorPriority;
+                explorationQueue.emplace(successorPriority, successorIndex);
+            }
+        }
+    }
 }
 
 // Explicitly instantiate the class.
@@ -6,7 +6,10 @@
 #include <boost/variant.hpp>
 #include <cstdint>
 #include <deque>
+#include <functional>
 #include <memory>
+#include <queue>
+#include <unordered_map>
 #include <utility>
 #include <vector>
 #include "storm/models/sparse/StandardRewardModel.h"
@@ -17,6 +20,7 @@
 #include "storm/models/sparse/StateLabeling.h"
 #include "storm/storage/BitVectorHashMap.h"
 #include "storm/storage/SparseMatrix.h"
+#include "storm/storage/expressions/Expression.h"
 #include "storm/storage/prism/Program.h"
 #include "storm/storage/sparse/ModelComponents.h"
 #include "storm/storage/sparse/StateStorage.h"
@@ -60,6 +64,16 @@ class ExplicitStateLookup {
      */
     uint64_t size() const;
 
+    /**
+     * Retrieves the information about the variables, i.e., the layout of the stored states.
+     */
+    VariableInformation const& getVariableInformation() const;
+
+    /**
+     * Retrieves the mapping of stored states to their ids.
+     */
+    storm::storage::BitVectorHashMap<StateType> const& getStateToIdMap() const;
+
    private:
     VariableInformation varInfo;
     storm::storage::BitVectorHashMap<StateType> stateToId;
@@ -76,6 +90,15 @@ class ExplicitModelBuilder {
 
         // The order in which to explore the model.
         ExplorationOrder explorationOrder;
+
+        // The number of threads used to explore the model. Values larger than one enable parallel exploration.
+        uint64_t numberOfThreads;
+
+        // If set, the explored states are stored in memory-mapped files within this directory instead of main memory.
+        boost::optional<std::string> stateStorageDirectory;
+
+        // If set, at most this number of states is expanded. The remaining states are not expanded and labeled with 'unexplored'.
+        boost::optional<uint64_t> explorationLimit;
     };
 
     /*!
@@ -119,6 +142,37 @@ class ExplicitModelBuilder {
      */
     ExplicitStateLookup<StateType> exportExplicitStateLookup() const;
 
+    /*!
+     * Lets the next build reuse a previous build of a model that only differs in some of its commands, e.g., after a single module was edited.
+     * States that were already part of the previous model and in which the given expression does not hold are not expanded. Instead, their
+     * choices and rewards are copied from the previous model. The expression therefore has to hold in all states in which a changed, added or
+     * removed command is enabled (see storm::utility::prism::getChangedModuleGuard). All other parts of the model (variables, initial states,
+     * reward models and formulas) need to be unchanged.
+     * The resulting model is equivalent to the one obtained by a full build, but its states may be numbered differently. If the previous build
+     * can not be reused (e.g. because the variables differ or choice origins are requested), all states are expanded.
+     *
+     * @param previousModel The previously built model.
+     * @param previousStateLookup The state lookup exported by the builder of the previous model.
+     * @param changedBehaviorExpression An expression over the variables of the current model.
+     */
+    void setPreviousBuild(std::shared_ptr<storm::models::sparse::Model<ValueType, RewardModelType>> const& previousModel,
+                          ExplicitStateLookup<StateType> const& previousStateLookup, storm::expressions::Expression const& changedBehaviorExpression);
+
+    /*!
+     * Retrieves the information about the variables, i.e., the layout of the states that are built.
+     */
+    VariableInformation const& getVariableInformation() const;
+
+    /*!
+     * Lets the next build use the given states instead of searching for the reachable states, e.g., because they were already computed
+     * symbolically (see storm::builder::DdPrismModelBuilder::buildReachableStates). The states are numbered in the given order, so the
+     * exploration order is irrelevant. As no new states can be found, the states are expanded independently of each other, which is done in
+     * parallel if multiple exploration threads are requested. All successors of the given states need to be among the given states.
+     *
+     * @param states The states of the model, stored in the layout given by getVariableInformation.
+     */
+    void setReachableStates(std::vector<CompressedState>&& states);
+
    private:
     /*!
      * Retrieves the state id of the given state. If the state has not been encountered yet, it will be added to
@@ -131,6 +185,58 @@ class ExplicitModelBuilder {
      */
     StateType getOrAddStateIndex(CompressedState const& state);
 
+    /*!
+     * Retrieves whether the state space can be explored with multiple threads. If parallel exploration was requested but is not possible,
+     * a warning is issued.
+     */
+    bool useParallelExploration() const;
+
+    /*!
+     * Adds the given behavior of a state to the matrix, the reward models, and the state and choice information.
+     *
+     * @param currentState The state whose behavior is added.
+     * @param stateIndex The index of the state.
+     * @param behavior The behavior of the state.
+     * @param localToGlobalStateIndices If given, the behavior refers to successor states by indices into this vector, which holds the actual
+     * state indices.
+     * @param currentRow The first row of the state. Is increased by the number of added rows.
+     * @param currentRowGroup The row group of the state. Is increased by one.
+     */
+    void addStateBehavior(CompressedState const& currentState, StateType stateIndex, storm::generator::StateBehavior<ValueType, StateType> const& behavior,
+                          std::vector<StateType> const* localToGlobalStateIndices, uint_fast64_t& currentRow, uint_fast64_t& currentRowGroup,
+                          storm::storage::SparseMatrixBuilder<ValueType>& transitionMatrixBuilder,
+                          std::vector<RewardModelBuilder<typename RewardModelType::ValueType>>& rewardModelBuilders,
+                          StateAndChoiceInformationBuilder& stateAndChoiceInformationBuilder);
+
+    /*!
+     * Checks whether the previous build (if any) can be reused for the current build and prepares its reuse. If it can not be reused, it is
+     * dropped.
+     */
+    void preparePreviousBuild(std::vector<RewardModelBuilder<typename RewardModelType::ValueType>> const& rewardModelBuilders,
+                              StateAndChoiceInformationBuilder const& stateAndChoiceInformationBuilder);
+
+    /*!
+     * Copies the behavior of the currently loaded state from the previous build, if this is possible.
+     *
+     * @param currentState The currently loaded state.
+     * @param behavior The behavior to fill.
+     * @return True iff the behavior was copied.
+     */
+    bool reusePreviousBehavior(CompressedState const& currentState, storm::generator::StateBehavior<ValueType, StateType>& behavior);
+
+    /*!
+     * Checks whether the given reachable states (if any) can be used for the current build and registers them. If they can not be used,
+     * they are dropped.
+     *
+     * @return True iff the given reachable states are used.
+     */
+    bool prepareReachableStates();
+
+    /*!
+     * Retrieves the index of the given state, which needs to be one of the given reachable states.
+     */
+    StateType getReachableStateIndex(CompressedState const& state) const;
+
     /*!
      * Builds the transition matrix and the transition reward matrix based for the given program.
      *
@@ -156,9 +262,30 @@ class ExplicitModelBuilder {
      */
     storm::models::sparse::StateLabeling buildStateLabeling();
 
+    /*!
+     * Retrieves whether there are states left to explore.
+     */
+    bool hasStatesToExplore() const;
+
+    /*!
+     * Removes the next state to explore (according to the exploration order) from the set of states to explore.
+     *
+     * @return The state and its index.
+     */
+    std::pair<CompressedState, StateType> takeNextStateToExplore();
+
+    /*!
+     * Updates the priorities of the successors of the given state for the best-first exploration order.
+     */
+    void updateExplorationPriorities(StateType stateIndex, storm::generator::StateBehavior<ValueType, StateType> const& behavior);
+
     /// The generator to use for the building process.
     std::shared_ptr<storm::generator::NextStateGenerator<ValueType, StateType>> generator;
 
+    /// Creates additional generators (equivalent to the one above) for the threads of a parallel exploration. Only set if parallel exploration
+    /// was requested and the builder was created from a PRISM program or a JANI model.
+    std::function<std::shared_ptr<storm::generator::NextStateGenerator<ValueType, StateType>>()> generatorFactory;
+
     /// The options to be used for the building process.
     Options options;
 
@@ -168,6 +295,39 @@ class ExplicitModelBuilder {
     /// A set of states that still need to be explored.
     std::deque<std::pair<CompressedState, StateType>> statesToExplore;
 
+    /// For the best-first exploration order: the states that still need to be explored, the priorities of all found states (i.e., the maximal
+    /// probability with which they are reached along a single path) and a queue of the states ordered by their priorities. As priorities only
+    /// increase, the queue may hold outdated entries that are skipped.
+    std::unordered_map<StateType, CompressedState> prioritizedStatesToExplore;
+    std::vector<double> explorationPriorities;
+    std::priority_queue<std::pair<double, StateType>> explorationQueue;
+
+    /// Information about a previous build whose behavior is reused.
+    struct PreviousBuild {
+        std::shared_ptr<storm::models::sparse::Model<ValueType, RewardModelType>> model;
+        ExplicitStateLookup<StateType> stateLookup;
+        storm::expressions::Expression changedBehaviorExpression;
+        /// The states of the previous model, indexed by their ids.
+        std::vector<CompressedState> states;
+        /// The states of the previous model that need to be expanded nonetheless (deadlock states and unexplored states).
+        storm::storage::BitVector statesToExpand;
+        /// For each reward model that is built, the corresponding reward model of the previous model.
+        std::vector<RewardModelType const*> rewardModels;
+    };
+    boost::optional<PreviousBuild> previousBuild;
+
+    /// The states of the model if they are given in advance instead of being searched for.
+    boost::optional<std::vector<CompressedState>> reachableStates;
+
+    /// The labels that depend on the valuations of the states. They are evaluated during the exploration, while the states are loaded anyway.
+    std::vector<std::string> labelNames;
+    std::vector<storm::expressions::Expression> labelExpressions;
+    /// For each label, the (indices of the) states satisfying it.
+    std::vector<storm::storage::BitVector> labelStates;
+
+    /// The (final) indices of the states that were not expanded because the exploration limit was reached.
+    std::vector<StateType> unexploredStateIndices;
+
     /// An optional mapping from state indices to the row groups in which they actually reside. This needs to be
     /// built in case the exploration order is not BFS.
     boost::optional<std::vector<uint_fast64_t>> stateRemapping;
@@ -6,8 +6,9 @@
 namespace storm {
 namespace builder {
 
-// An enum that contains all currently supported exploration orders.
-enum class ExplorationOrder { Dfs, Bfs };
+// An enum that contains all currently supported exploration orders. The best-first order explores the states that are reached with the
+// highest probability first.
+enum class ExplorationOrder { Dfs, Bfs, BestFirst };
 
 std::ostream& operator<<(std::ostream& out, ExplorationOrder const& order);
 
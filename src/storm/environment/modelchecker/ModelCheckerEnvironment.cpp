@@ -17,6 +17,11 @@ ModelCheckerEnvironment::ModelCheckerEnvironment() {
     if (mcSettings.isLtl2daToolSet()) {
         ltl2daTool = mcSettings.getLtl2daTool();
     }
+    if (mcSettings.isLtl2daCacheSet()) {
+        ltl2daCacheDirectory = mcSettings.getLtl2daCacheDirectory();
+    }
+    hybridSccSolving = mcSettings.isHybridSccSolvingSet();
+    chainElimination = mcSettings.isChainEliminationSet();
     auto const& ioSettings = storm::settings::getModule<storm::settings::modules::IOSettings>();
     steadyStateDistributionAlgorithm = ioSettings.getSteadyStateDistributionAlgorithm();
 }
@@ -57,4 +62,52 @@ void ModelCheckerEnvironment::unsetLtl2daTool() {
     ltl2daTool = boost::none;
 }
 
+bool ModelCheckerEnvironment::isLtl2daCacheDirectorySet() const {
+    return ltl2daCacheDirectory.is_initialized();
+}
+
+std::string const& ModelCheckerEnvironment::getLtl2daCacheDirectory() const {
+    return ltl2daCacheDirectory.get();
+}
+
+void ModelCheckerEnvironment::setLtl2daCacheDirectory(std::string const& value) {
+    ltl2daCacheDirectory = value;
+}
+
+void ModelCheckerEnvironment::unsetLtl2daCacheDirectory() {
+    ltl2daCacheDirectory = boost::none;
+}
+
+bool ModelCheckerEnvironment::isHybridSccSolvingSet() const {
+    return hybridSccSolving;
+}
+
+void ModelCheckerEnvironment::setHybridSccSolving(bool value) {
+    hybridSccSolving = value;
+}
+
+bool ModelCheckerEnvironment::isChainEliminationSet() const {
+    return chainElimination;
+}
+
+void ModelCheckerEnvironment::setChainElimination(bool value) {
+    chainElimination = value;
+}
+
+bool ModelCheckerEnvironment::isDeadlineSet() const {
+    return deadline.has_value();
+}
+
+std::chrono::steady_clock::time_point const& ModelCheckerEnvironment::getDeadline() const {
+    return deadline.value();
+}
+
+void ModelCheckerEnvironment::setDeadline(std::chrono::steady_clock::time_point const& value) {
+    deadline = value;
+}
+
+void ModelCheckerEnvironment::unsetDeadline() {
+    deadline.reset();
+}
+
 }  // namespace storm
@@ -1,7 +1,9 @@
 #pragma once
 
 #include <boost/optional.hpp>
+#include <chrono>
 #include <memory>
+#include <optional>
 #include <string>
 
 #include "storm/environment/Environment.h"
@@ -29,9 +31,33 @@ class ModelCheckerEnvironment {
     void setLtl2daTool(std::string const& value);
     void unsetLtl2daTool();
 
+    bool isLtl2daCacheDirectorySet() const;
+    std::string const& getLtl2daCacheDirectory() const;
+    void setLtl2daCacheDirectory(std::string const& value);
+    void unsetLtl2daCacheDirectory();
+
+    bool isHybridSccSolvingSet() const;
+    void setHybridSccSolving(bool value);
+
+    bool isChainEliminationSet() const;
+    void setChainElimination(bool value);
+
+    /*!
+     * A deadline for model checking: once it has passed, computations are stopped and the best approximation that is available at this point
+     * is returned (and marked as approximate). Nested formulas share the deadline of the enclosing formula.
+     */
+    bool isDeadlineSet() const;
+    std::chrono::steady_clock::time_point const& getDeadline() const;
+    void setDeadline(std::chrono::steady_clock::time_point const& value);
+    void unsetDeadline();
+
    private:
     SubEnvironment<MultiObjectiveModelCheckerEnvironment> multiObjectiveModelCheckerEnvironment;
     boost::optional<std::string> ltl2daTool;
+    boost::optional<std::string> ltl2daCacheDirectory;
     SteadyStateDistributionAlgorithm steadyStateDistributionAlgorithm;
+    bool hybridSccSolving;
+    bool chainElimination;
+    std::optional<std::chrono::steady_clock::time_point> deadline;
 };
 }  // namespace storm
@@ -13,6 +13,7 @@ EigenSolverEnvironment::EigenSolverEnvironment() {
     method = eigenSettings.getLinearEquationSystemMethod();
     methodSetFromDefault = eigenSettings.isLinearEquationSystemMethodSetFromDefault();
     preconditioner = eigenSettings.getPreconditioningMethod();
+    ordering = eigenSettings.getOrdering();
     restartThreshold = eigenSettings.getRestartIterationCount();
     if (eigenSettings.isMaximalIterationCountSet()) {
         maxIterationCount = eigenSettings.getMaximalIterationCount();
@@ -47,6 +48,14 @@ void EigenSolverEnvironment::setPreconditioner(storm::solver::EigenLinearEquatio
     preconditioner = value;
 }
 
+storm::solver::EigenLinearEquationSolverOrdering const& EigenSolverEnvironment::getOrdering() const {
+    return ordering;
+}
+
+void EigenSolverEnvironment::setOrdering(storm::solver::EigenLinearEquationSolverOrdering value) {
+    ordering = value;
+}
+
 uint64_t const& EigenSolverEnvironment::getRestartThreshold() const {
     return restartThreshold;
 }
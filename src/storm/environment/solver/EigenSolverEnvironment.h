@@ -18,6 +18,8 @@ class EigenSolverEnvironment {
     bool isMethodSetFromDefault() const;
     storm::solver::EigenLinearEquationSolverPreconditioner const& getPreconditioner() const;
     void setPreconditioner(storm::solver::EigenLinearEquationSolverPreconditioner value);
+    storm::solver::EigenLinearEquationSolverOrdering const& getOrdering() const;
+    void setOrdering(storm::solver::EigenLinearEquationSolverOrdering value);
     uint64_t const& getRestartThreshold() const;
     void setRestartThreshold(uint64_t value);
     uint64_t const& getMaximalNumberOfIterations() const;
@@ -29,6 +31,7 @@ class EigenSolverEnvironment {
     storm::solver::EigenLinearEquationSolverMethod method;
     bool methodSetFromDefault;
     storm::solver::EigenLinearEquationSolverPreconditioner preconditioner;
+    storm::solver::EigenLinearEquationSolverOrdering ordering;
     uint64_t restartThreshold;
     uint64_t maxIterationCount;
     storm::RationalNumber precision;
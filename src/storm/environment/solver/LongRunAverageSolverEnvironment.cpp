@@ -19,6 +19,7 @@ LongRunAverageSolverEnvironment::LongRunAverageSolverEnvironment() {
         maxIters = lraSettings.getMaximalIterationCount();
     }
     aperiodicFactor = storm::utility::convertNumber<storm::RationalNumber>(lraSettings.getAperiodicFactor());
+    denseBsccSizeThreshold = lraSettings.getDenseBsccSizeThreshold();
 }
 
 LongRunAverageSolverEnvironment::~LongRunAverageSolverEnvironment() {
@@ -91,4 +92,12 @@ void LongRunAverageSolverEnvironment::setAperiodicFactor(storm::RationalNumber v
     aperiodicFactor = value;
 }
 
+uint64_t LongRunAverageSolverEnvironment::getDenseBsccSizeThreshold() const {
+    return denseBsccSizeThreshold;
+}
+
+void LongRunAverageSolverEnvironment::setDenseBsccSizeThreshold(uint64_t value) {
+    denseBsccSizeThreshold = value;
+}
+
 }  // namespace storm
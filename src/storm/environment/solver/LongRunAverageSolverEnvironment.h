@@ -32,6 +32,12 @@ class LongRunAverageSolverEnvironment {
     storm::RationalNumber const& getAperiodicFactor() const;
     void setAperiodicFactor(storm::RationalNumber value);
 
+    /*!
+     * BSCCs with at most this many states are solved using a dense direct solver. Zero disables the dense solver.
+     */
+    uint64_t getDenseBsccSizeThreshold() const;
+    void setDenseBsccSizeThreshold(uint64_t value);
+
    private:
     storm::solver::LraMethod detMethod;
     bool detMethodSetFromDefault;
@@ -44,5 +50,6 @@ class LongRunAverageSolverEnvironment {
     boost::optional<uint64_t> maxIters;
 
     storm::RationalNumber aperiodicFactor;
+    uint64_t denseBsccSizeThreshold;
 };
 }  // namespace storm
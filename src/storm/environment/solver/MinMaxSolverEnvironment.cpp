@@ -25,6 +25,13 @@ MinMaxSolverEnvironment::MinMaxSolverEnvironment() {
                      "Unknown convergence criterion");
     multiplicationStyle = minMaxSettings.getValueIterationMultiplicationStyle();
     forceRequireUnique = minMaxSettings.isForceUniqueSolutionRequirementSet();
+    mixedPrecision = minMaxSettings.isMixedPrecisionSet();
+    prioritized = minMaxSettings.isPrioritizedSet();
+    policyEvaluationSweeps = minMaxSettings.isPolicyEvaluationSweepsSet() ? minMaxSettings.getPolicyEvaluationSweeps() : 0;
+    methodAutomatic = minMaxSettings.isMinMaxEquationSolvingMethodAutomatic();
+    if (minMaxSettings.isAutomaticMethodSelectionHistorySet()) {
+        automaticMethodHistoryFile = minMaxSettings.getAutomaticMethodSelectionHistoryFilename();
+    }
 }
 
 MinMaxSolverEnvironment::~MinMaxSolverEnvironment() {
@@ -42,6 +49,7 @@ bool const& MinMaxSolverEnvironment::isMethodSetFromDefault() const {
 void MinMaxSolverEnvironment::setMethod(storm::solver::MinMaxMethod value, bool isSetFromDefault) {
     methodSetFromDefault = isSetFromDefault;
     minMaxMethod = value;
+    methodAutomatic = false;
 }
 
 uint64_t const& MinMaxSolverEnvironment::getMaximalNumberOfIterations() const {
@@ -84,4 +92,44 @@ void MinMaxSolverEnvironment::setForceRequireUnique(bool value) {
     forceRequireUnique = value;
 }
 
+bool MinMaxSolverEnvironment::isMixedPrecision() const {
+    return mixedPrecision;
+}
+
+void MinMaxSolverEnvironment::setMixedPrecision(bool value) {
+    mixedPrecision = value;
+}
+
+bool MinMaxSolverEnvironment::isPrioritized() const {
+    return prioritized;
+}
+
+void MinMaxSolverEnvironment::setPrioritized(bool value) {
+    prioritized = value;
+}
+
+uint64_t const& MinMaxSolverEnvironment::getPolicyEvaluationSweeps() const {
+    return policyEvaluationSweeps;
+}
+
+void MinMaxSolverEnvironment::setPolicyEvaluationSweeps(uint64_t value) {
+    policyEvaluationSweeps = value;
+}
+
+bool MinMaxSolverEnvironment::isMethodAutomatic() const {
+    return methodAutomatic;
+}
+
+void MinMaxSolverEnvironment::setMethodAutomatic(bool value) {
+    methodAutomatic = value;
+}
+
+boost::optional<std::string> const& MinMaxSolverEnvironment::getAutomaticMethodHistoryFile() const {
+    return automaticMethodHistoryFile;
+}
+
+void MinMaxSolverEnvironment::setAutomaticMethodHistoryFile(boost::optional<std::string> const& value) {
+    automaticMethodHistoryFile = value;
+}
+
 }  // namespace storm
@@ -1,5 +1,9 @@
 #pragma once
 
+#include <string>
+
+#include <boost/optional.hpp>
+
 #include "storm/environment/solver/SolverEnvironment.h"
 
 #include "storm/adapters/RationalNumberAdapter.h"
@@ -26,6 +30,16 @@ class MinMaxSolverEnvironment {
     void setMultiplicationStyle(storm::solver::MultiplicationStyle value);
     bool isForceRequireUnique() const;
     void setForceRequireUnique(bool value);
+    bool isMixedPrecision() const;
+    void setMixedPrecision(bool value);
+    bool isPrioritized() const;
+    void setPrioritized(bool value);
+    uint64_t const& getPolicyEvaluationSweeps() const;
+    void setPolicyEvaluationSweeps(uint64_t value);
+    bool isMethodAutomatic() const;
+    void setMethodAutomatic(bool value);
+    boost::optional<std::string> const& getAutomaticMethodHistoryFile() const;
+    void setAutomaticMethodHistoryFile(boost::optional<std::string> const& value);
 
    private:
     storm::solver::MinMaxMethod minMaxMethod;
@@ -35,5 +49,10 @@ class MinMaxSolverEnvironment {
     bool considerRelativeTerminationCriterion;
     storm::solver::MultiplicationStyle multiplicationStyle;
     bool forceRequireUnique;
+    bool mixedPrecision;
+    bool prioritized;
+    uint64_t policyEvaluationSweeps;
+    bool methodAutomatic;
+    boost::optional<std::string> automaticMethodHistoryFile;
 };
 }  // namespace storm
@@ -11,6 +11,7 @@ MultiplierEnvironment::MultiplierEnvironment() {
     auto const& multiplierSettings = storm::settings::getModule<storm::settings::modules::MultiplierSettings>();
     type = multiplierSettings.getMultiplierType();
     typeSetFromDefault = multiplierSettings.isMultiplierTypeSetFromDefaultValue();
+    useCompactMatrix = multiplierSettings.isCompactMatrixSet();
 }
 
 MultiplierEnvironment::~MultiplierEnvironment() {
@@ -30,4 +31,12 @@ void MultiplierEnvironment::setType(storm::solver::MultiplierType value, bool is
     typeSetFromDefault = isSetFromDefault;
 }
 
+bool MultiplierEnvironment::isUseCompactMatrix() const {
+    return useCompactMatrix;
+}
+
+void MultiplierEnvironment::setUseCompactMatrix(bool value) {
+    useCompactMatrix = value;
+}
+
 }  // namespace storm
@@ -14,8 +14,12 @@ class MultiplierEnvironment {
     bool const& isTypeSetFromDefault() const;
     void setType(storm::solver::MultiplierType value, bool isSetFromDefault = false);
 
+    bool isUseCompactMatrix() const;
+    void setUseCompactMatrix(bool value);
+
    private:
     storm::solver::MultiplierType type;
     bool typeSetFromDefault;
+    bool useCompactMatrix;
 };
 }  // namespace storm
@@ -26,6 +26,7 @@ NativeSolverEnvironment::NativeSolverEnvironment() {
     powerMethodMultiplicationStyle = nativeSettings.getPowerMethodMultiplicationStyle();
     sorOmega = storm::utility::convertNumber<storm::RationalNumber>(nativeSettings.getOmega());
     symmetricUpdates = nativeSettings.isForceIntervalIterationSymmetricUpdatesSet();
+    mixedPrecision = nativeSettings.isMixedPrecisionSet();
 }
 
 NativeSolverEnvironment::~NativeSolverEnvironment() {
@@ -93,4 +94,12 @@ void NativeSolverEnvironment::setSymmetricUpdates(bool value) {
     symmetricUpdates = value;
 }
 
+bool NativeSolverEnvironment::isMixedPrecision() const {
+    return mixedPrecision;
+}
+
+void NativeSolverEnvironment::setMixedPrecision(bool value) {
+    mixedPrecision = value;
+}
+
 }  // namespace storm
@@ -28,6 +28,8 @@ class NativeSolverEnvironment {
     void setSorOmega(storm::RationalNumber const& value);
     bool isSymmetricUpdatesSet() const;
     void setSymmetricUpdates(bool value);
+    bool isMixedPrecision() const;
+    void setMixedPrecision(bool value);
 
    private:
     storm::solver::NativeLinearEquationSolverMethod method;
@@ -38,5 +40,6 @@ class NativeSolverEnvironment {
     storm::solver::MultiplicationStyle powerMethodMultiplicationStyle;
     storm::RationalNumber sorOmega;
     bool symmetricUpdates;
+    bool mixedPrecision;
 };
 }  // namespace storm
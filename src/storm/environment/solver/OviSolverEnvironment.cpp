@@ -11,10 +11,19 @@ OviSolverEnvironment::OviSolverEnvironment() {
     if (oviSettings.hasUpperBoundGuessingFactorBeenSet()) {
         upperBoundGuessingFactor = storm::utility::convertNumber<storm::RationalNumber>(oviSettings.getUpperBoundGuessingFactor());
     }
+    pipelined = oviSettings.isPipelinedSet();
 }
 
 std::optional<storm::RationalNumber> const& OviSolverEnvironment::getUpperBoundGuessingFactor() const {
     return upperBoundGuessingFactor;
 }
 
+bool OviSolverEnvironment::isPipelined() const {
+    return pipelined;
+}
+
+void OviSolverEnvironment::setPipelined(bool value) {
+    pipelined = value;
+}
+
 }  // namespace storm
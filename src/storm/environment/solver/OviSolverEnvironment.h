@@ -13,8 +13,11 @@ class OviSolverEnvironment {
     ~OviSolverEnvironment() = default;
 
     std::optional<storm::RationalNumber> const& getUpperBoundGuessingFactor() const;
+    bool isPipelined() const;
+    void setPipelined(bool value);
 
    private:
     std::optional<storm::RationalNumber> upperBoundGuessingFactor;
+    bool pipelined;
 };
 }  // namespace storm
@@ -5,6 +5,8 @@
 #include "storm/settings/SettingsManager.h"
 #include "storm/settings/modules/CoreSettings.h"
 #include "storm/settings/modules/GeneralSettings.h"
+#include "storm/settings/modules/IOSettings.h"
+#include "storm/solver/SolverTelemetry.h"
 #include "storm/utility/macros.h"
 
 #include "storm/exceptions/InvalidEnvironmentException.h"
@@ -18,6 +20,13 @@ SolverEnvironment::SolverEnvironment() {
     forceExact = generalSettings.isExactSet() || generalSettings.isExactFinitePrecisionSet();
     linearEquationSolverType = storm::settings::getModule<storm::settings::modules::CoreSettings>().getEquationSolver();
     linearEquationSolverTypeSetFromDefault = storm::settings::getModule<storm::settings::modules::CoreSettings>().isEquationSolverSetFromDefaultValue();
+    useIntelTbb = storm::settings::getModule<storm::settings::modules::CoreSettings>().isUseIntelTbbSet();
+    if (storm::settings::hasModule<storm::settings::modules::IOSettings>()) {
+        auto const& ioSettings = storm::settings::getModule<storm::settings::modules::IOSettings>();
+        if (ioSettings.isExportSolverTelemetrySet()) {
+            telemetry = storm::solver::FileSolverTelemetry::getForFile(ioSettings.getExportSolverTelemetryFilename());
+        }
+    }
 }
 
 SolverEnvironment::~SolverEnvironment() {
@@ -120,6 +129,22 @@ void SolverEnvironment::setForceExact(bool value) {
     SolverEnvironment::forceExact = value;
 }
 
+bool SolverEnvironment::isUseIntelTbb() const {
+    return useIntelTbb;
+}
+
+void SolverEnvironment::setUseIntelTbb(bool value) {
+    SolverEnvironment::useIntelTbb = value;
+}
+
+std::shared_ptr<storm::solver::SolverTelemetry> const& SolverEnvironment::getTelemetry() const {
+    return telemetry;
+}
+
+void SolverEnvironment::setTelemetry(std::shared_ptr<storm::solver::SolverTelemetry> const& value) {
+    telemetry = value;
+}
+
 storm::solver::EquationSolverType const& SolverEnvironment::getLinearEquationSolverType() const {
     return linearEquationSolverType;
 }
@@ -22,6 +22,10 @@ class GameSolverEnvironment;
 class TopologicalSolverEnvironment;
 class OviSolverEnvironment;
 
+namespace solver {
+class SolverTelemetry;
+}
+
 class SolverEnvironment {
    public:
     SolverEnvironment();
@@ -52,6 +56,14 @@ class SolverEnvironment {
     void setForceSoundness(bool value);
     bool isForceExact() const;
     void setForceExact(bool value);
+    bool isUseIntelTbb() const;
+    void setUseIntelTbb(bool value);
+
+    /*!
+     * The telemetry (if any) receives iteration-level diagnostics (residuals, times per iteration, iterations per SCC) from iterative solvers.
+     */
+    std::shared_ptr<storm::solver::SolverTelemetry> const& getTelemetry() const;
+    void setTelemetry(std::shared_ptr<storm::solver::SolverTelemetry> const& value);
 
     storm::solver::EquationSolverType const& getLinearEquationSolverType() const;
     void setLinearEquationSolverType(storm::solver::EquationSolverType const& value, bool isSetFromDefault = false);
@@ -78,5 +90,7 @@ class SolverEnvironment {
     bool linearEquationSolverTypeSetFromDefault;
     bool forceSoundness;
     bool forceExact;
+    bool useIntelTbb;
+    std::shared_ptr<storm::solver::SolverTelemetry> telemetry;
 };
 }  // namespace storm
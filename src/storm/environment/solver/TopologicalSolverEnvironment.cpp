@@ -15,6 +15,11 @@ TopologicalSolverEnvironment::TopologicalSolverEnvironment() {
 
     underlyingMinMaxMethod = topologicalSettings.getUnderlyingMinMaxMethod();
     underlyingMinMaxMethodSetFromDefault = topologicalSettings.isUnderlyingMinMaxMethodSetFromDefaultValue();
+
+    if (topologicalSettings.isDirectSolveSccSizeRangeSet()) {
+        directSolveSccSizeRange = topologicalSettings.getDirectSolveSccSizeRange();
+    }
+    denseSolveMaxSccSize = topologicalSettings.getDenseSolveMaxSccSize();
 }
 
 TopologicalSolverEnvironment::~TopologicalSolverEnvironment() {
@@ -51,4 +56,23 @@ void TopologicalSolverEnvironment::setUnderlyingMinMaxMethod(storm::solver::MinM
     underlyingMinMaxMethod = value;
 }
 
+std::optional<std::pair<uint64_t, uint64_t>> const& TopologicalSolverEnvironment::getDirectSolveSccSizeRange() const {
+    return directSolveSccSizeRange;
+}
+
+void TopologicalSolverEnvironment::setDirectSolveSccSizeRange(std::optional<std::pair<uint64_t, uint64_t>> const& value) {
+    STORM_LOG_THROW(!value || value->first <= value->second, storm::exceptions::InvalidArgumentException, "Invalid range of SCC sizes.");
+    directSolveSccSizeRange = value;
+}
+
+uint64_t const& TopologicalSolverEnvironment::getDenseSolveMaxSccSize() const {
+    return denseSolveMaxSccSize;
+}
+
+void TopologicalSolverEnvironment::setDenseSolveMaxSccSize(uint64_t value) {
+    STORM_LOG_THROW(value <= DenseSolveSccSizeLimit, storm::exceptions::InvalidArgumentException,
+                    "SCCs with more than " << DenseSolveSccSizeLimit << " states can not be solved with dense Gaussian elimination.");
+    denseSolveMaxSccSize = value;
+}
+
 }  // namespace storm
@@ -1,5 +1,8 @@
 #pragma once
 
+#include <optional>
+#include <utility>
+
 #include "storm/environment/solver/SolverEnvironment.h"
 
 #include "storm/solver/SolverSelectionOptions.h"
@@ -19,11 +22,29 @@ class TopologicalSolverEnvironment {
     bool const& isUnderlyingMinMaxMethodSetFromDefault() const;
     void setUnderlyingMinMaxMethod(storm::solver::MinMaxMethod value);
 
+    /*!
+     * The (inclusive) range of sizes of SCCs whose linear equation systems are solved with a sparse LU factorization instead of the underlying solver.
+     */
+    std::optional<std::pair<uint64_t, uint64_t>> const& getDirectSolveSccSizeRange() const;
+    void setDirectSolveSccSizeRange(std::optional<std::pair<uint64_t, uint64_t>> const& value);
+
+    /*!
+     * The maximal size of SCCs whose linear equation systems are solved with dense Gaussian elimination. Zero disables dense Gaussian elimination.
+     */
+    uint64_t const& getDenseSolveMaxSccSize() const;
+    void setDenseSolveMaxSccSize(uint64_t value);
+
+    // The largest value that is supported for the maximal size of densely solved SCCs.
+    static constexpr uint64_t DenseSolveSccSizeLimit = 64;
+
    private:
     storm::solver::EquationSolverType underlyingEquationSolverType;
     bool underlyingEquationSolverTypeSetFromDefault;
 
     storm::solver::MinMaxMethod underlyingMinMaxMethod;
     bool underlyingMinMaxMethodSetFromDefault;
+
+    std::optional<std::pair<uint64_t, uint64_t>> directSolveSccSizeRange;
+    uint64_t denseSolveMaxSccSize;
 };
 }  // namespace storm
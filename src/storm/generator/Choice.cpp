@@ -190,6 +190,18 @@ void Choice<ValueType, StateType>::reserve(std::size_t const& size) {
     distribution.reserve(size);
 }
 
+template<typename ValueType, typename StateType>
+void Choice<ValueType, StateType>::reset(uint_fast64_t actionIndex, bool markovian) {
+    this->markovian = markovian;
+    this->actionIndex = actionIndex;
+    distribution.clear();
+    totalMass = storm::utility::zero<ValueType>();
+    rewards.clear();
+    originData = boost::none;
+    labels = boost::none;
+    playerIndex = boost::none;
+}
+
 template<typename ValueType, typename StateType>
 std::ostream& operator<<(std::ostream& out, Choice<ValueType, StateType> const& choice) {
     out << "<";
@@ -186,6 +186,12 @@ struct Choice {
      */
     void reserve(std::size_t const& size);
 
+    /*!
+     * Turns this choice into an empty choice with the given action index. The memory allocated for the distribution and the rewards
+     * is kept, such that the choice can be reused without allocating.
+     */
+    void reset(uint_fast64_t actionIndex, bool markovian = false);
+
    private:
     // A flag indicating whether this choice is Markovian or not.
     bool markovian;
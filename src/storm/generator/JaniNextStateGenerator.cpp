@@ -555,6 +555,12 @@ void JaniNextStateGenerator<ValueType, StateType>::unpackTransientVariableValues
     transientVariableValuation.setInEvaluator(evaluator, this->getOptions().isExplorationChecksSet());
 }
 
+template<typename ValueType, typename StateType>
+void JaniNextStateGenerator<ValueType, StateType>::resetTransientVariableValuesInEvaluator(
+    storm::expressions::ExpressionEvaluator<ValueType>& evaluator) const {
+    transientVariableInformation.setDefaultValuesInEvaluator(evaluator);
+}
+
 template<typename ValueType, typename StateType>
 storm::storage::sparse::StateValuationsBuilder JaniNextStateGenerator<ValueType, StateType>::initializeStateValuationsBuilder() const {
     auto result = NextStateGenerator<ValueType, StateType>::initializeStateValuationsBuilder();
@@ -632,7 +638,7 @@ StateBehavior<ValueType, StateType> JaniNextStateGenerator<ValueType, StateType>
     // The evaluator should have the default values of the transient variables right now.
 
     // Prepare the result, in case we return early.
-    StateBehavior<ValueType, StateType> result;
+    StateBehavior<ValueType, StateType> result = this->createBehavior();
 
     // Retrieve the locations from the state.
     std::vector<uint64_t> locations = getLocations(*this->state);
@@ -681,7 +687,7 @@ StateBehavior<ValueType, StateType> JaniNextStateGenerator<ValueType, StateType>
 
     // If the model is a deterministic model, we need to fuse the choices into one.
     if (this->isDeterministicModel() && totalNumberOfChoices > 1) {
-        Choice<ValueType> globalChoice;
+        Choice<ValueType> globalChoice = this->createChoice(0);
 
         if (this->options.isAddOverlappingGuardLabelSet()) {
             this->overlappingGuardStates->push_back(stateToIdCallback(*this->state));
@@ -721,7 +727,7 @@ StateBehavior<ValueType, StateType> JaniNextStateGenerator<ValueType, StateType>
         globalChoice.addRewards(std::move(stateActionRewards));
 
         // Move the newly fused choice in place.
-        allChoices.clear();
+        this->recycleChoices(allChoices);
         allChoices.push_back(std::move(globalChoice));
     }
 
@@ -745,7 +751,7 @@ Choice<ValueType> JaniNextStateGenerator<ValueType, StateType>::expandNonSynchro
         exitRate = this->evaluator->asRational(edge.getRate());
     }
 
-    Choice<ValueType> choice(edge.getActionIndex(), static_cast<bool>(exitRate));
+    Choice<ValueType> choice = this->createChoice(edge.getActionIndex(), static_cast<bool>(exitRate));
     std::vector<ValueType> stateActionRewards;
 
     // Perform the transient edge assignments and create the state action rewards
@@ -988,7 +994,7 @@ void JaniNextStateGenerator<ValueType, StateType>::expandSynchronizingEdgeCombin
         // At this point, we applied all commands of the current command combination and newTargetStates
         // contains all target states and their respective probabilities. That means we are now ready to
         // add the choice to the list of transitions.
-        newChoices.emplace_back(outputActionIndex);
+        newChoices.push_back(this->createChoice(outputActionIndex));
 
         // Now create the actual distribution.
         Choice<ValueType>& choice = newChoices.back();
@@ -1211,9 +1217,7 @@ storm::builder::RewardModelInformation JaniNextStateGenerator<ValueType, StateTy
 }
 
 template<typename ValueType, typename StateType>
-storm::models::sparse::StateLabeling JaniNextStateGenerator<ValueType, StateType>::label(storm::storage::sparse::StateStorage<StateType> const& stateStorage,
-                                                                                         std::vector<StateType> const& initialStateIndices,
-                                                                                         std::vector<StateType> const& deadlockStateIndices) {
+std::vector<std::pair<std::string, storm::expressions::Expression>> JaniNextStateGenerator<ValueType, StateType>::getLabelExpressions() const {
     // As in JANI we can use transient boolean variable assignments in locations to identify states, we need to
     // create a list of boolean transient variables and the expressions that define them.
     std::vector<std::pair<std::string, storm::expressions::Expression>> transientVariableExpressions;
@@ -1224,7 +1228,7 @@ storm::models::sparse::StateLabeling JaniNextStateGenerator<ValueType, StateType
             }
         }
     }
-    return NextStateGenerator<ValueType, StateType>::label(stateStorage, initialStateIndices, deadlockStateIndices, transientVariableExpressions);
+    return transientVariableExpressions;
 }
 
 template<typename ValueType, typename StateType>
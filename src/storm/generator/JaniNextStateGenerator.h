@@ -57,9 +57,7 @@ class JaniNextStateGenerator : public NextStateGenerator<ValueType, StateType> {
     virtual std::size_t getNumberOfRewardModels() const override;
     virtual storm::builder::RewardModelInformation getRewardModelInformation(uint64_t const& index) const override;
 
-    virtual storm::models::sparse::StateLabeling label(storm::storage::sparse::StateStorage<StateType> const& stateStorage,
-                                                       std::vector<StateType> const& initialStateIndices = {},
-                                                       std::vector<StateType> const& deadlockStateIndices = {}) override;
+    virtual std::vector<std::pair<std::string, storm::expressions::Expression>> getLabelExpressions() const override;
 
     virtual std::shared_ptr<storm::storage::sparse::ChoiceOrigins> generateChoiceOrigins(std::vector<boost::any>& dataForChoiceOrigins) const override;
 
@@ -74,6 +72,8 @@ class JaniNextStateGenerator : public NextStateGenerator<ValueType, StateType> {
     virtual void unpackTransientVariableValuesIntoEvaluator(CompressedState const& state,
                                                             storm::expressions::ExpressionEvaluator<ValueType>& evaluator) const override;
 
+    virtual void resetTransientVariableValuesInEvaluator(storm::expressions::ExpressionEvaluator<ValueType>& evaluator) const override;
+
    private:
     /*!
      * Retrieves the location index from the given state.
@@ -2,6 +2,8 @@
 #include <storm/exceptions/NotImplementedException.h>
 #include <storm/exceptions/WrongFormatException.h>
 
+#include <iterator>
+
 #include "storm/adapters/JsonAdapter.h"
 #include "storm/adapters/RationalFunctionAdapter.h"
 
@@ -117,6 +119,52 @@ void NextStateGenerator<ValueType, StateType>::load(CompressedState const& state
     this->state = &state;
 }
 
+template<typename ValueType, typename StateType>
+bool NextStateGenerator<ValueType, StateType>::hasStateCanonicalizer() const {
+    return stateCanonicalizer.is_initialized();
+}
+
+template<typename ValueType, typename StateType>
+bool NextStateGenerator<ValueType, StateType>::canonicalizeState(CompressedState& state) const {
+    return stateCanonicalizer && stateCanonicalizer->canonicalize(state);
+}
+
+template<typename ValueType, typename StateType>
+void NextStateGenerator<ValueType, StateType>::setStateIsKnownCallback(StateIsKnownCallback const& callback) {
+    stateIsKnownCallback = callback;
+}
+
+template<typename ValueType, typename StateType>
+void NextStateGenerator<ValueType, StateType>::recycle(StateBehavior<ValueType, StateType>&& behavior) {
+    recycleChoices(behavior.getChoices());
+    behavior.clear();
+    recycledBehavior = std::move(behavior);
+}
+
+template<typename ValueType, typename StateType>
+Choice<ValueType, StateType> NextStateGenerator<ValueType, StateType>::createChoice(uint_fast64_t actionIndex, bool markovian) {
+    if (recycledChoices.empty()) {
+        return Choice<ValueType, StateType>(actionIndex, markovian);
+    }
+    Choice<ValueType, StateType> result = std::move(recycledChoices.back());
+    recycledChoices.pop_back();
+    result.reset(actionIndex, markovian);
+    return result;
+}
+
+template<typename ValueType, typename StateType>
+void NextStateGenerator<ValueType, StateType>::recycleChoices(std::vector<Choice<ValueType, StateType>>& choices) {
+    std::move(choices.begin(), choices.end(), std::back_inserter(recycledChoices));
+    choices.clear();
+}
+
+template<typename ValueType, typename StateType>
+StateBehavior<ValueType, StateType> NextStateGenerator<ValueType, StateType>::createBehavior() {
+    StateBehavior<ValueType, StateType> result = std::move(recycledBehavior);
+    result.clear();
+    return result;
+}
+
 template<typename ValueType, typename StateType>
 bool NextStateGenerator<ValueType, StateType>::satisfies(storm::expressions::Expression const& expression) const {
     if (expression.isTrue()) {
@@ -172,9 +220,8 @@ storm::storage::sparse::StateValuations NextStateGenerator<ValueType, StateType>
 }
 
 template<typename ValueType, typename StateType>
-storm::models::sparse::StateLabeling NextStateGenerator<ValueType, StateType>::label(
-    storm::storage::sparse::StateStorage<StateType> const& stateStorage, std::vector<StateType> const& initialStateIndices,
-    std::vector<StateType> const& deadlockStateIndices, std::vector<std::pair<std::string, storm::expressions::Expression>> labelsAndExpressions) {
+std::vector<std::pair<std::string, storm::expressions::Expression>> NextStateGenerator<ValueType, StateType>::getStateLabelExpressions() const {
+    std::vector<std::pair<std::string, storm::expressions::Expression>> labelsAndExpressions = getLabelExpressions();
     labelsAndExpressions.insert(labelsAndExpressions.end(), this->options.getExpressionLabels().begin(), this->options.getExpressionLabels().end());
 
     // Make the labels unique.
@@ -187,13 +234,54 @@ storm::models::sparse::StateLabeling NextStateGenerator<ValueType, StateType>::l
                               return a.first == b.first;
                           });
     labelsAndExpressions.resize(std::distance(labelsAndExpressions.begin(), it));
+    return labelsAndExpressions;
+}
 
-    // Prepare result.
-    storm::models::sparse::StateLabeling result(stateStorage.getNumberOfStates());
+template<typename ValueType, typename StateType>
+void NextStateGenerator<ValueType, StateType>::evaluateLabels(std::vector<storm::expressions::Expression> const& expressions, StateType stateIndex,
+                                                              std::vector<storm::storage::BitVector>& labelStates) {
+    STORM_LOG_ASSERT(expressions.size() == labelStates.size(), "Expected one bit vector per label.");
+    if (expressions.empty()) {
+        return;
+    }
+    unpackTransientVariableValuesIntoEvaluator(*this->state, *this->evaluator);
+    for (uint64_t labelIndex = 0; labelIndex < expressions.size(); ++labelIndex) {
+        if (evaluator->asBool(expressions[labelIndex])) {
+            storm::storage::BitVector& states = labelStates[labelIndex];
+            if (stateIndex >= states.size()) {
+                states.resize(std::max<uint64_t>(2 * states.size(), stateIndex + 1));
+            }
+            states.set(stateIndex);
+        }
+    }
+    // The expansion expects the transient variables to have their default values.
+    resetTransientVariableValuesInEvaluator(*this->evaluator);
+}
 
-    // Initialize labeling.
+template<typename ValueType, typename StateType>
+storm::storage::BitVector NextStateGenerator<ValueType, StateType>::evaluateLabels(std::vector<storm::expressions::Expression> const& expressions) {
+    storm::storage::BitVector result(expressions.size());
+    if (expressions.empty()) {
+        return result;
+    }
+    unpackTransientVariableValuesIntoEvaluator(*this->state, *this->evaluator);
+    for (uint64_t labelIndex = 0; labelIndex < expressions.size(); ++labelIndex) {
+        if (evaluator->asBool(expressions[labelIndex])) {
+            result.set(labelIndex);
+        }
+    }
+    resetTransientVariableValuesInEvaluator(*this->evaluator);
+    return result;
+}
+
+template<typename ValueType, typename StateType>
+storm::models::sparse::StateLabeling NextStateGenerator<ValueType, StateType>::label(storm::storage::sparse::StateStorage<StateType> const& stateStorage,
+                                                                                     std::vector<StateType> const& initialStateIndices,
+                                                                                     std::vector<StateType> const& deadlockStateIndices) {
+    std::vector<std::pair<std::string, storm::expressions::Expression>> labelsAndExpressions = getStateLabelExpressions();
+    std::vector<std::pair<std::string, storm::storage::BitVector>> evaluatedLabels;
     for (auto const& label : labelsAndExpressions) {
-        result.addLabel(label.first);
+        evaluatedLabels.emplace_back(label.first, storm::storage::BitVector(stateStorage.getNumberOfStates()));
     }
 
     auto const& states = stateStorage.stateToId;
@@ -201,13 +289,31 @@ storm::models::sparse::StateLabeling NextStateGenerator<ValueType, StateType>::l
         unpackStateIntoEvaluator(stateIndexPair.first, variableInformation, *this->evaluator);
         unpackTransientVariableValuesIntoEvaluator(stateIndexPair.first, *this->evaluator);
 
-        for (auto const& label : labelsAndExpressions) {
+        for (uint64_t labelIndex = 0; labelIndex < labelsAndExpressions.size(); ++labelIndex) {
             // Add label to state, if the corresponding expression is true.
-            if (evaluator->asBool(label.second)) {
-                result.addLabelToState(label.first, stateIndexPair.second);
+            if (evaluator->asBool(labelsAndExpressions[labelIndex].second)) {
+                evaluatedLabels[labelIndex].second.set(stateIndexPair.second);
             }
         }
     }
+    resetTransientVariableValuesInEvaluator(*this->evaluator);
+
+    return createLabeling(stateStorage, std::move(evaluatedLabels), initialStateIndices, deadlockStateIndices);
+}
+
+template<typename ValueType, typename StateType>
+storm::models::sparse::StateLabeling NextStateGenerator<ValueType, StateType>::createLabeling(
+    storm::storage::sparse::StateStorage<StateType> const& stateStorage, std::vector<std::pair<std::string, storm::storage::BitVector>>&& evaluatedLabels,
+    std::vector<StateType> const& initialStateIndices, std::vector<StateType> const& deadlockStateIndices) {
+    // Prepare result.
+    storm::models::sparse::StateLabeling result(stateStorage.getNumberOfStates());
+
+    // Initialize labeling.
+    for (auto& label : evaluatedLabels) {
+        // The bit vectors may have been grown beyond the number of states (or not up to it).
+        label.second.resize(stateStorage.getNumberOfStates());
+        result.addLabel(label.first, std::move(label.second));
+    }
 
     if (!result.containsLabel("init")) {
         // Also label the initial state with the special label "init".
@@ -249,6 +355,12 @@ void NextStateGenerator<ValueType, StateType>::unpackTransientVariableValuesInto
     // This method should be overwritten in case there are transient variables (e.g. JANI).
 }
 
+template<typename ValueType, typename StateType>
+void NextStateGenerator<ValueType, StateType>::resetTransientVariableValuesInEvaluator(storm::expressions::ExpressionEvaluator<ValueType>&) const {
+    // Intentionally left empty.
+    // This method should be overwritten in case there are transient variables (e.g. JANI).
+}
+
 template<typename ValueType, typename StateType>
 void NextStateGenerator<ValueType, StateType>::postprocess(StateBehavior<ValueType, StateType>& result) {
     // If the model we build is a Markov Automaton, we postprocess the choices to sum all Markovian choices
@@ -4,6 +4,7 @@
 #include <cstdint>
 #include <vector>
 
+#include <boost/optional.hpp>
 #include <boost/variant.hpp>
 
 #include "storm/storage/PlayerIndex.h"
@@ -16,6 +17,7 @@
 #include "storm/builder/RewardModelInformation.h"
 
 #include "storm/generator/CompressedState.h"
+#include "storm/generator/StateCanonicalizer.h"
 #include "storm/generator/StateBehavior.h"
 #include "storm/generator/VariableInformation.h"
 
@@ -73,6 +75,7 @@ template<typename ValueType, typename StateType>
 class NextStateGenerator {
    public:
     typedef std::function<StateType(CompressedState const&)> StateToIdCallback;
+    typedef std::function<bool(CompressedState const&)> StateIsKnownCallback;
 
     NextStateGenerator(storm::expressions::ExpressionManager const& expressionManager, VariableInformation const& variableInformation,
                        NextStateGeneratorOptions const& options, std::shared_ptr<ActionMask<ValueType, StateType>> const& = nullptr);
@@ -100,7 +103,32 @@ class NextStateGenerator {
     virtual storm::storage::sparse::StateValuationsBuilder initializeStateValuationsBuilder() const;
 
     void load(CompressedState const& state);
+
+    /*!
+     * Retrieves whether states are to be replaced by representatives with respect to symmetries of the model before they are stored.
+     */
+    bool hasStateCanonicalizer() const;
+
+    /*!
+     * Replaces the given state by the representative of its orbit under the symmetries of the model.
+     *
+     * @return True iff the state was changed.
+     */
+    bool canonicalizeState(CompressedState& state) const;
+
+    /*!
+     * Sets a callback that determines whether the given state was already found during the exploration. Reductions like the partial order
+     * reduction require this information to ensure that no behavior is ignored along cycles of the reduced state space.
+     */
+    void setStateIsKnownCallback(StateIsKnownCallback const& callback);
+
     virtual StateBehavior<ValueType, StateType> expand(StateToIdCallback const& stateToIdCallback) = 0;
+
+    /*!
+     * Hands a behavior that was obtained by expand and is no longer needed back to the generator. The memory of the behavior and its
+     * choices is then reused by subsequent expansions, which avoids allocating memory for every expanded state.
+     */
+    void recycle(StateBehavior<ValueType, StateType>&& behavior);
     bool satisfies(storm::expressions::Expression const& expression) const;
 
     /// Adds the valuation for the currently loaded state to the given builder
@@ -121,9 +149,40 @@ class NextStateGenerator {
 
     virtual std::map<std::string, storm::storage::PlayerIndex> getPlayerNameToIndexMap() const;
 
-    virtual storm::models::sparse::StateLabeling label(storm::storage::sparse::StateStorage<StateType> const& stateStorage,
-                                                       std::vector<StateType> const& initialStateIndices = {},
-                                                       std::vector<StateType> const& deadlockStateIndices = {}) = 0;
+    /*!
+     * Creates the state labeling for the given states. The labels that depend on the valuations of the states are evaluated in a pass over all states.
+     */
+    storm::models::sparse::StateLabeling label(storm::storage::sparse::StateStorage<StateType> const& stateStorage,
+                                               std::vector<StateType> const& initialStateIndices = {}, std::vector<StateType> const& deadlockStateIndices = {});
+
+    /*!
+     * Retrieves the labels that depend on the valuations of the states together with their defining expressions. This includes the expression
+     * labels of the options. The names of the labels are unique.
+     */
+    std::vector<std::pair<std::string, storm::expressions::Expression>> getStateLabelExpressions() const;
+
+    /*!
+     * Evaluates the given expressions (e.g., the ones of getStateLabelExpressions) in the currently loaded state and sets the bit of the given
+     * state in the bit vectors of the expressions that hold. The bit vectors grow as needed. This allows to label the states during the
+     * exploration, while they are loaded anyway.
+     */
+    void evaluateLabels(std::vector<storm::expressions::Expression> const& expressions, StateType stateIndex,
+                        std::vector<storm::storage::BitVector>& labelStates);
+
+    /*!
+     * Evaluates the given expressions in the currently loaded state.
+     *
+     * @return A bit vector whose i-th bit is set iff the i-th expression holds.
+     */
+    storm::storage::BitVector evaluateLabels(std::vector<storm::expressions::Expression> const& expressions);
+
+    /*!
+     * Creates the state labeling from labels that were already evaluated for all states (see evaluateLabels) and adds the special labels,
+     * e.g., for the initial and the deadlock states.
+     */
+    storm::models::sparse::StateLabeling createLabeling(storm::storage::sparse::StateStorage<StateType> const& stateStorage,
+                                                        std::vector<std::pair<std::string, storm::storage::BitVector>>&& evaluatedLabels,
+                                                        std::vector<StateType> const& initialStateIndices, std::vector<StateType> const& deadlockStateIndices);
 
     NextStateGeneratorOptions const& getOptions() const;
 
@@ -140,11 +199,9 @@ class NextStateGenerator {
 
    protected:
     /*!
-     * Creates the state labeling for the given states using the provided labels and expressions.
+     * Retrieves the labels of the model (that are requested by the options) together with their defining expressions.
      */
-    storm::models::sparse::StateLabeling label(storm::storage::sparse::StateStorage<StateType> const& stateStorage,
-                                               std::vector<StateType> const& initialStateIndices, std::vector<StateType> const& deadlockStateIndices,
-                                               std::vector<std::pair<std::string, storm::expressions::Expression>> labelsAndExpressions);
+    virtual std::vector<std::pair<std::string, storm::expressions::Expression>> getLabelExpressions() const = 0;
 
     /*!
      * Sets the values of all transient variables in the current state to the given evaluator.
@@ -156,6 +213,11 @@ class NextStateGenerator {
      */
     virtual void unpackTransientVariableValuesIntoEvaluator(CompressedState const& state, storm::expressions::ExpressionEvaluator<ValueType>& evaluator) const;
 
+    /*!
+     * Sets the values of all transient variables in the given evaluator back to their defaults.
+     */
+    virtual void resetTransientVariableValuesInEvaluator(storm::expressions::ExpressionEvaluator<ValueType>& evaluator) const;
+
     virtual storm::storage::BitVector evaluateObservationLabels(CompressedState const& state) const = 0;
 
     virtual void extendStateInformation(storm::json<ValueType>& stateInfo) const;
@@ -164,6 +226,21 @@ class NextStateGenerator {
 
     void postprocess(StateBehavior<ValueType, StateType>& result);
 
+    /*!
+     * Creates an empty choice with the given action index. If possible, a recycled choice is reused.
+     */
+    Choice<ValueType, StateType> createChoice(uint_fast64_t actionIndex, bool markovian = false);
+
+    /*!
+     * Keeps the given choices for later reuse and clears the vector.
+     */
+    void recycleChoices(std::vector<Choice<ValueType, StateType>>& choices);
+
+    /*!
+     * Retrieves an empty behavior, possibly reusing the memory of a recycled one.
+     */
+    StateBehavior<ValueType, StateType> createBehavior();
+
     /// The options to be used for next-state generation.
     NextStateGeneratorOptions options;
 
@@ -197,6 +274,16 @@ class NextStateGenerator {
     /// A map that stores the indices of states with overlapping guards.
     boost::optional<std::vector<uint64_t>> overlappingGuardStates;
 
+    /// If set, states are replaced by the representative of their orbit under the symmetries of the model.
+    boost::optional<StateCanonicalizer> stateCanonicalizer;
+
+    /// A callback that determines whether a state was already found during the exploration (if set).
+    StateIsKnownCallback stateIsKnownCallback;
+
+    /// Choices and a behavior that are no longer needed and whose memory can be reused.
+    std::vector<Choice<ValueType, StateType>> recycledChoices;
+    StateBehavior<ValueType, StateType> recycledBehavior;
+
     std::shared_ptr<ActionMask<ValueType, StateType>> actionMask;
 };
 }  // namespace generator
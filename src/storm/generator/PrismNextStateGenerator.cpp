@@ -8,6 +8,7 @@
 #include "storm/models/sparse/StateLabeling.h"
 
 #include "storm/storage/expressions/SimpleValuation.h"
+#include "storm/storage/prism/ModuleSymmetryAnalyser.h"
 #include "storm/storage/sparse/PrismChoiceOrigins.h"
 
 #include "storm/generator/Distribution.h"
@@ -18,6 +19,7 @@
 #include "storm/exceptions/UnexpectedException.h"
 #include "storm/exceptions/WrongFormatException.h"
 #include "storm/storage/expressions/ExpressionEvaluator.h"
+#include "storm/storage/expressions/Expressions.h"
 #include "storm/utility/combinatorics.h"
 #include "storm/utility/constants.h"
 #include "storm/utility/macros.h"
@@ -37,7 +39,11 @@ PrismNextStateGenerator<ValueType, StateType>::PrismNextStateGenerator(storm::pr
 template<typename ValueType, typename StateType>
 PrismNextStateGenerator<ValueType, StateType>::PrismNextStateGenerator(storm::prism::Program const& program, NextStateGeneratorOptions const& options,
                                                                        std::shared_ptr<ActionMask<ValueType, StateType>> const& mask, bool)
-    : NextStateGenerator<ValueType, StateType>(program.getManager(), options, mask), program(program), rewardModels(), hasStateActionRewards(false) {
+    : NextStateGenerator<ValueType, StateType>(program.getManager(), options, mask),
+      program(program),
+      rewardModels(),
+      hasStateActionRewards(false),
+      partialOrderReduction(false) {
     STORM_LOG_TRACE("Creating next-state generator for PRISM program: " << program);
     STORM_LOG_THROW(!this->program.specifiesSystemComposition(), storm::exceptions::WrongFormatException,
                     "The explicit next-state generator currently does not support custom system compositions.");
@@ -46,6 +52,8 @@ PrismNextStateGenerator<ValueType, StateType>::PrismNextStateGenerator(storm::pr
     this->checkValid();
     this->variableInformation = VariableInformation(program, options.getReservedBitsForUnboundedVariables(), options.isAddOutOfBoundsStateSet());
     this->initializeSpecialStates();
+    compileUpdates();
+    buildGuardIndices();
 
     // Create a proper evaluator.
     this->evaluator = std::make_unique<storm::expressions::ExpressionEvaluator<ValueType>>(program.getManager());
@@ -102,6 +110,13 @@ PrismNextStateGenerator<ValueType, StateType>::PrismNextStateGenerator(storm::pr
         moduleIndexToPlayerIndexMap = program.buildModuleIndexToPlayerIndexMap();
         actionIndexToPlayerIndexMap = program.buildActionIndexToPlayerIndexMap();
     }
+
+    if (this->options.isSymmetryReductionSet()) {
+        initializeSymmetryReduction();
+    }
+    if (this->options.isPartialOrderReductionSet()) {
+        initializePartialOrderReduction();
+    }
 }
 
 template<typename ValueType, typename StateType>
@@ -282,7 +297,7 @@ std::vector<StateType> PrismNextStateGenerator<ValueType, StateType>::getInitial
 template<typename ValueType, typename StateType>
 StateBehavior<ValueType, StateType> PrismNextStateGenerator<ValueType, StateType>::expand(StateToIdCallback const& stateToIdCallback) {
     // Prepare the result, in case we return early.
-    StateBehavior<ValueType, StateType> result;
+    StateBehavior<ValueType, StateType> result = this->createBehavior();
 
     // First, construct the state rewards, as we may return early if there are no choices later and we already
     // need the state rewards then.
@@ -310,18 +325,21 @@ StateBehavior<ValueType, StateType> PrismNextStateGenerator<ValueType, StateType
     // Get all choices for the state.
     result.setExpanded();
 
-    std::vector<Choice<ValueType>> allChoices;
-    if (this->getOptions().isApplyMaximalProgressAssumptionSet()) {
+    // The choices are directly constructed in the result.
+    std::vector<Choice<ValueType>>& allChoices = result.getChoices();
+    if (storm::prism::Command const* ampleCommand = getAmpleCommand()) {
+        addAsynchronousChoices(allChoices, *this->state, stateToIdCallback, CommandFilter::All, ampleCommand);
+    } else if (this->getOptions().isApplyMaximalProgressAssumptionSet()) {
         // First explore only edges without a rate
-        allChoices = getAsynchronousChoices(*this->state, stateToIdCallback, CommandFilter::Probabilistic);
+        addAsynchronousChoices(allChoices, *this->state, stateToIdCallback, CommandFilter::Probabilistic);
         addSynchronousChoices(allChoices, *this->state, stateToIdCallback, CommandFilter::Probabilistic);
         if (allChoices.empty()) {
             // Expand the Markovian edges if there are no probabilistic ones.
-            allChoices = getAsynchronousChoices(*this->state, stateToIdCallback, CommandFilter::Markovian);
+            addAsynchronousChoices(allChoices, *this->state, stateToIdCallback, CommandFilter::Markovian);
             addSynchronousChoices(allChoices, *this->state, stateToIdCallback, CommandFilter::Markovian);
         }
     } else {
-        allChoices = getAsynchronousChoices(*this->state, stateToIdCallback);
+        addAsynchronousChoices(allChoices, *this->state, stateToIdCallback);
         addSynchronousChoices(allChoices, *this->state, stateToIdCallback);
     }
 
@@ -335,7 +353,7 @@ StateBehavior<ValueType, StateType> PrismNextStateGenerator<ValueType, StateType
 
     // If the model is a deterministic model, we need to fuse the choices into one.
     if (this->isDeterministicModel() && totalNumberOfChoices > 1) {
-        Choice<ValueType> globalChoice;
+        Choice<ValueType> globalChoice = this->createChoice(0);
 
         if (this->options.isAddOverlappingGuardLabelSet()) {
             this->overlappingGuardStates->push_back(stateToIdCallback(*this->state));
@@ -388,7 +406,7 @@ StateBehavior<ValueType, StateType> PrismNextStateGenerator<ValueType, StateType
         }
 
         // Move the newly fused choice in place.
-        allChoices.clear();
+        this->recycleChoices(allChoices);
         allChoices.push_back(std::move(globalChoice));
     }
 
@@ -415,11 +433,6 @@ StateBehavior<ValueType, StateType> PrismNextStateGenerator<ValueType, StateType
         }
     }
 
-    // Move all remaining choices in place.
-    for (auto& choice : allChoices) {
-        result.addChoice(std::move(choice));
-    }
-
     this->postprocess(result);
 
     return result;
@@ -431,66 +444,500 @@ bool PrismNextStateGenerator<ValueType, StateType>::evaluateBooleanExpressionInC
 }
 
 template<typename ValueType, typename StateType>
-CompressedState PrismNextStateGenerator<ValueType, StateType>::applyUpdate(CompressedState const& state, storm::prism::Update const& update) {
-    CompressedState newState(state);
-
-    // NOTE: the following process assumes that the assignments of the update are ordered in such a way that the
-    // assignments to boolean variables precede the assignments to all integer variables and that within the
-    // types, the assignments to variables are ordered (in ascending order) by the expression variables.
-    // This is guaranteed for PRISM models, by sorting the assignments as soon as an update is created.
-
-    auto assignmentIt = update.getAssignments().begin();
-    auto assignmentIte = update.getAssignments().end();
+void PrismNextStateGenerator<ValueType, StateType>::compileUpdates() {
+    for (auto const& module : this->program.getModules()) {
+        for (auto const& command : module.getCommands()) {
+            for (auto const& update : command.getUpdates()) {
+                if (update.getGlobalIndex() >= compiledUpdates.size()) {
+                    compiledUpdates.resize(update.getGlobalIndex() + 1);
+                }
+                auto& compiledAssignments = compiledUpdates[update.getGlobalIndex()];
+                compiledAssignments.reserve(update.getNumberOfAssignments());
+                for (auto const& assignment : update.getAssignments()) {
+                    compiledAssignments.push_back(compileAssignment(assignment));
+                }
+            }
+        }
+    }
+}
 
-    // Iterate over all boolean assignments and carry them out.
-    auto boolIt = this->variableInformation.booleanVariables.begin();
-    for (; assignmentIt != assignmentIte && assignmentIt->getExpression().hasBooleanType(); ++assignmentIt) {
-        while (assignmentIt->getVariable() != boolIt->variable) {
-            ++boolIt;
+template<typename ValueType, typename StateType>
+typename PrismNextStateGenerator<ValueType, StateType>::CompiledAssignment PrismNextStateGenerator<ValueType, StateType>::compileAssignment(
+    storm::prism::Assignment const& assignment) const {
+    CompiledAssignment result;
+    result.kind = CompiledAssignmentKind::Generic;
+    result.assignment = &assignment;
+    result.targetBitOffset = 0;
+    result.targetBitWidth = 0;
+    result.targetLowerBound = 0;
+    result.targetUpperBound = 0;
+    result.forceOutOfBoundsCheck = false;
+    result.sourceBitOffset = 0;
+    result.sourceBitWidth = 0;
+    result.sourceLowerBound = 0;
+    result.constant = 0;
+
+    storm::expressions::Expression const& expression = assignment.getExpression();
+
+    // Retrieves the information of the variable that is given by the expression, provided that it is part of the state.
+    auto findBooleanVariable = [this](storm::expressions::BaseExpression const& baseExpression) -> BooleanVariableInformation const* {
+        if (baseExpression.isVariableExpression()) {
+            auto const& variable = baseExpression.asVariableExpression().getVariable();
+            for (auto const& booleanVariable : this->variableInformation.booleanVariables) {
+                if (booleanVariable.variable == variable) {
+                    return &booleanVariable;
+                }
+            }
+        }
+        return nullptr;
+    };
+    auto findIntegerVariable = [this](storm::expressions::BaseExpression const& baseExpression) -> IntegerVariableInformation const* {
+        if (baseExpression.isVariableExpression()) {
+            auto const& variable = baseExpression.asVariableExpression().getVariable();
+            for (auto const& integerVariable : this->variableInformation.integerVariables) {
+                if (integerVariable.variable == variable) {
+                    return &integerVariable;
+                }
+            }
+        }
+        return nullptr;
+    };
+
+    // Only literals are treated as constants, as evaluating other expressions beforehand might raise errors for updates that are never executed.
+    if (expression.hasBooleanType()) {
+        auto const& target = findBooleanVariable(assignment.getVariable().getExpression().getBaseExpression());
+        STORM_LOG_ASSERT(target != nullptr, "Unknown boolean variable '" << assignment.getVariableName() << "'.");
+        result.targetBitOffset = target->bitOffset;
+        result.targetBitWidth = 1;
+
+        storm::expressions::BaseExpression const& baseExpression = expression.getBaseExpression();
+        if (baseExpression.isBooleanLiteralExpression()) {
+            result.kind = CompiledAssignmentKind::BooleanConstant;
+            result.constant = baseExpression.asBooleanLiteralExpression().getValue() ? 1 : 0;
+        } else if (auto const& source = findBooleanVariable(baseExpression)) {
+            result.kind = CompiledAssignmentKind::BooleanCopy;
+            result.sourceBitOffset = source->bitOffset;
+        } else if (baseExpression.isUnaryBooleanFunctionExpression()) {
+            if (auto const& source = findBooleanVariable(*baseExpression.asUnaryBooleanFunctionExpression().getOperand())) {
+                result.kind = CompiledAssignmentKind::BooleanNegation;
+                result.sourceBitOffset = source->bitOffset;
+            }
+        }
+    } else if (expression.hasIntegerType()) {
+        auto const& target = findIntegerVariable(assignment.getVariable().getExpression().getBaseExpression());
+        STORM_LOG_ASSERT(target != nullptr, "Unknown integer variable '" << assignment.getVariableName() << "'.");
+        result.targetBitOffset = target->bitOffset;
+        result.targetBitWidth = target->bitWidth;
+        result.targetLowerBound = target->lowerBound;
+        result.targetUpperBound = target->upperBound;
+        result.forceOutOfBoundsCheck = target->forceOutOfBoundsCheck;
+
+        storm::expressions::BaseExpression const& baseExpression = expression.getBaseExpression();
+        IntegerVariableInformation const* source = nullptr;
+        if (baseExpression.isIntegerLiteralExpression()) {
+            result.kind = CompiledAssignmentKind::IntegerConstant;
+            result.constant = baseExpression.asIntegerLiteralExpression().getValue();
+        } else if ((source = findIntegerVariable(baseExpression))) {
+            result.kind = CompiledAssignmentKind::IntegerOffset;
+        } else if (baseExpression.isBinaryNumericalFunctionExpression()) {
+            auto const& function = baseExpression.asBinaryNumericalFunctionExpression();
+            auto const& firstOperand = *function.getFirstOperand();
+            auto const& secondOperand = *function.getSecondOperand();
+            bool isPlus = function.getOperatorType() == storm::expressions::BinaryNumericalFunctionExpression::OperatorType::Plus;
+            bool isMinus = function.getOperatorType() == storm::expressions::BinaryNumericalFunctionExpression::OperatorType::Minus;
+            if ((isPlus || isMinus) && secondOperand.isIntegerLiteralExpression() && (source = findIntegerVariable(firstOperand))) {
+                // x' = y + k or x' = y - k
+                int_fast64_t offset = secondOperand.asIntegerLiteralExpression().getValue();
+                result.kind = CompiledAssignmentKind::IntegerOffset;
+                result.constant = isPlus ? offset : -offset;
+            } else if (isPlus && firstOperand.isIntegerLiteralExpression() && (source = findIntegerVariable(secondOperand))) {
+                // x' = k + y
+                result.kind = CompiledAssignmentKind::IntegerOffset;
+                result.constant = firstOperand.asIntegerLiteralExpression().getValue();
+            }
+        }
+        if (result.kind == CompiledAssignmentKind::IntegerOffset) {
+            result.sourceBitOffset = source->bitOffset;
+            result.sourceBitWidth = source->bitWidth;
+            result.sourceLowerBound = source->lowerBound;
         }
-        newState.set(boolIt->bitOffset, this->evaluator->asBool(assignmentIt->getExpression()));
     }
+    return result;
+}
 
-    // Iterate over all integer assignments and carry them out.
-    auto integerIt = this->variableInformation.integerVariables.begin();
-    for (; assignmentIt != assignmentIte && assignmentIt->getExpression().hasIntegerType(); ++assignmentIt) {
-        while (assignmentIt->getVariable() != integerIt->variable) {
-            ++integerIt;
+template<typename ValueType, typename StateType>
+CompressedState PrismNextStateGenerator<ValueType, StateType>::applyUpdate(CompressedState const& state, storm::prism::Update const& update) {
+    CompressedState newState;
+    return applyUpdate(state, update, newState);
+}
+
+template<typename ValueType, typename StateType>
+CompressedState const& PrismNextStateGenerator<ValueType, StateType>::applyUpdate(CompressedState const& state, storm::prism::Update const& update,
+                                                                                   CompressedState& newState) {
+    newState = state;
+
+    // The values of the variables are read from the state that is currently loaded into the evaluator. In particular, this is *not*
+    // the given state if several updates are applied successively to obtain the successor of synchronizing commands.
+    CompressedState const& currentState = *this->state;
+
+    STORM_LOG_ASSERT(update.getGlobalIndex() < compiledUpdates.size(), "No compiled assignments for update " << update << ".");
+    for (auto const& compiledAssignment : compiledUpdates[update.getGlobalIndex()]) {
+        int_fast64_t assignedValue;
+        switch (compiledAssignment.kind) {
+            case CompiledAssignmentKind::BooleanConstant:
+                newState.set(compiledAssignment.targetBitOffset, compiledAssignment.constant != 0);
+                continue;
+            case CompiledAssignmentKind::BooleanCopy:
+                newState.set(compiledAssignment.targetBitOffset, currentState.get(compiledAssignment.sourceBitOffset));
+                continue;
+            case CompiledAssignmentKind::BooleanNegation:
+                newState.set(compiledAssignment.targetBitOffset, !currentState.get(compiledAssignment.sourceBitOffset));
+                continue;
+            case CompiledAssignmentKind::IntegerConstant:
+                assignedValue = compiledAssignment.constant;
+                break;
+            case CompiledAssignmentKind::IntegerOffset:
+                assignedValue = static_cast<int_fast64_t>(currentState.getAsInt(compiledAssignment.sourceBitOffset, compiledAssignment.sourceBitWidth)) +
+                                compiledAssignment.sourceLowerBound + compiledAssignment.constant;
+                break;
+            case CompiledAssignmentKind::Generic:
+                if (compiledAssignment.assignment->getExpression().hasBooleanType()) {
+                    newState.set(compiledAssignment.targetBitOffset, this->evaluator->asBool(compiledAssignment.assignment->getExpression()));
+                    continue;
+                }
+                assignedValue = this->evaluator->asInt(compiledAssignment.assignment->getExpression());
+                break;
         }
-        int_fast64_t assignedValue = this->evaluator->asInt(assignmentIt->getExpression());
+
         if (this->options.isAddOutOfBoundsStateSet()) {
-            if (assignedValue < integerIt->lowerBound || assignedValue > integerIt->upperBound) {
+            if (assignedValue < compiledAssignment.targetLowerBound || assignedValue > compiledAssignment.targetUpperBound) {
                 return this->outOfBoundsState;
             }
-        } else if (integerIt->forceOutOfBoundsCheck || this->options.isExplorationChecksSet()) {
-            STORM_LOG_THROW(assignedValue >= integerIt->lowerBound, storm::exceptions::WrongFormatException,
+        } else if (compiledAssignment.forceOutOfBoundsCheck || this->options.isExplorationChecksSet()) {
+            STORM_LOG_THROW(assignedValue >= compiledAssignment.targetLowerBound, storm::exceptions::WrongFormatException,
                             "The update " << update << " leads to an out-of-bounds value (" << assignedValue << ") for the variable '"
-                                          << assignmentIt->getVariableName() << "'.");
-            STORM_LOG_THROW(assignedValue <= integerIt->upperBound, storm::exceptions::WrongFormatException,
+                                          << compiledAssignment.assignment->getVariableName() << "'.");
+            STORM_LOG_THROW(assignedValue <= compiledAssignment.targetUpperBound, storm::exceptions::WrongFormatException,
                             "The update " << update << " leads to an out-of-bounds value (" << assignedValue << ") for the variable '"
-                                          << assignmentIt->getVariableName() << "'.");
+                                          << compiledAssignment.assignment->getVariableName() << "'.");
         }
-        newState.setFromInt(integerIt->bitOffset, integerIt->bitWidth, assignedValue - integerIt->lowerBound);
-        STORM_LOG_ASSERT(static_cast<int_fast64_t>(newState.getAsInt(integerIt->bitOffset, integerIt->bitWidth)) + integerIt->lowerBound == assignedValue,
-                         "Writing to the bit vector bucket failed (read " << newState.getAsInt(integerIt->bitOffset, integerIt->bitWidth) << " but wrote "
-                                                                          << assignedValue << ").");
+        uint_fast64_t const writtenValue = assignedValue - compiledAssignment.targetLowerBound;
+        newState.setFromInt(compiledAssignment.targetBitOffset, compiledAssignment.targetBitWidth, writtenValue);
+        STORM_LOG_ASSERT(newState.getAsInt(compiledAssignment.targetBitOffset, compiledAssignment.targetBitWidth) == writtenValue,
+                         "Writing to the bit vector bucket failed (read "
+                             << newState.getAsInt(compiledAssignment.targetBitOffset, compiledAssignment.targetBitWidth) << " but wrote " << writtenValue
+                             << ").");
     }
 
-    // Check that we processed all assignments.
-    STORM_LOG_ASSERT(assignmentIt == assignmentIte, "Not all assignments were consumed.");
-
     return newState;
 }
 
+template<typename ValueType, typename StateType>
+std::vector<std::pair<std::string, storm::expressions::Expression>> PrismNextStateGenerator<ValueType, StateType>::getRelevantExpressions() const {
+    std::vector<std::pair<std::string, storm::expressions::Expression>> relevantExpressions;
+    for (auto const& label : program.getLabels()) {
+        if (this->options.isBuildAllLabelsSet() || this->options.getLabelNames().count(label.getName()) > 0) {
+            relevantExpressions.emplace_back("label '" + label.getName() + "'", label.getStatePredicateExpression());
+        }
+    }
+    for (auto const& expressionLabel : this->options.getExpressionLabels()) {
+        relevantExpressions.emplace_back("expression '" + expressionLabel.first + "'", expressionLabel.second);
+    }
+    for (auto const& terminalState : this->terminalStates) {
+        relevantExpressions.emplace_back("terminal state expression '" + terminalState.first.toString() + "'", terminalState.first);
+    }
+    for (auto const& rewardModel : rewardModels) {
+        std::string description = "reward model '" + rewardModel.get().getName() + "'";
+        for (auto const& stateReward : rewardModel.get().getStateRewards()) {
+            relevantExpressions.emplace_back(description, stateReward.getStatePredicateExpression());
+            relevantExpressions.emplace_back(description, stateReward.getRewardValueExpression());
+        }
+        for (auto const& stateActionReward : rewardModel.get().getStateActionRewards()) {
+            relevantExpressions.emplace_back(description, stateActionReward.getStatePredicateExpression());
+            relevantExpressions.emplace_back(description, stateActionReward.getRewardValueExpression());
+        }
+        for (auto const& transitionReward : rewardModel.get().getTransitionRewards()) {
+            relevantExpressions.emplace_back(description, transitionReward.getSourceStatePredicateExpression());
+            relevantExpressions.emplace_back(description, transitionReward.getTargetStatePredicateExpression());
+            relevantExpressions.emplace_back(description, transitionReward.getRewardValueExpression());
+        }
+    }
+    return relevantExpressions;
+}
+
+template<typename ValueType, typename StateType>
+void PrismNextStateGenerator<ValueType, StateType>::initializeSymmetryReduction() {
+    if (program.getModelType() == storm::prism::Program::ModelType::SMG || program.getModelType() == storm::prism::Program::ModelType::POMDP) {
+        STORM_LOG_WARN("Symmetry reduction is not supported for " << program.getModelType() << " models and is therefore disabled.");
+        return;
+    }
+    storm::prism::ModuleSymmetryAnalyser analyser(this->program);
+    if (analyser.getSymmetricModuleGroups().empty()) {
+        STORM_LOG_WARN("Symmetry reduction is disabled, because no symmetric modules were found.");
+        return;
+    }
+
+    // All expressions that are relevant for the model to build need to be invariant under the symmetries.
+    for (auto const& descriptionExpressionPair : getRelevantExpressions()) {
+        if (!analyser.isSymmetric(descriptionExpressionPair.second)) {
+            STORM_LOG_WARN("Symmetry reduction is disabled, because the " << descriptionExpressionPair.first << " is not symmetric.");
+            return;
+        }
+    }
+
+    StateCanonicalizer canonicalizer;
+    for (auto const& group : analyser.getSymmetricModuleGroups()) {
+        std::vector<StateCanonicalizer::Block> blocks;
+        for (auto const& moduleIndex : group) {
+            StateCanonicalizer::Block block;
+            for (auto const& variable : analyser.getLocalVariables(moduleIndex)) {
+                for (auto const& booleanVariable : this->variableInformation.booleanVariables) {
+                    if (booleanVariable.variable == variable) {
+                        block.emplace_back(booleanVariable.bitOffset, 1);
+                    }
+                }
+                for (auto const& integerVariable : this->variableInformation.integerVariables) {
+                    if (integerVariable.variable == variable) {
+                        block.emplace_back(integerVariable.bitOffset, integerVariable.bitWidth);
+                    }
+                }
+            }
+            blocks.push_back(std::move(block));
+        }
+        canonicalizer.addSymmetricBlocks(blocks);
+        STORM_LOG_INFO("Applying symmetry reduction for " << group.size() << " copies of module " << program.getModule(group.front()).getName() << ".");
+    }
+    this->stateCanonicalizer = std::move(canonicalizer);
+}
+
+template<typename ValueType, typename StateType>
+void PrismNextStateGenerator<ValueType, StateType>::initializePartialOrderReduction() {
+    if (program.getModelType() != storm::prism::Program::ModelType::MDP) {
+        STORM_LOG_WARN("Partial order reduction is only supported for MDPs and is therefore disabled.");
+        return;
+    }
+    if (!rewardModels.empty()) {
+        STORM_LOG_WARN("Partial order reduction does not preserve rewards and is therefore disabled.");
+        return;
+    }
+
+    // Gather the variables that are read or written by the commands of each module.
+    std::vector<std::set<storm::expressions::Variable>> occurringVariables;
+    for (auto const& module : program.getModules()) {
+        std::set<storm::expressions::Variable> variables;
+        for (auto const& command : module.getCommands()) {
+            command.getGuardExpression().gatherVariables(variables);
+            for (auto const& update : command.getUpdates()) {
+                update.getLikelihoodExpression().gatherVariables(variables);
+                for (auto const& assignment : update.getAssignments()) {
+                    variables.insert(assignment.getVariable());
+                    assignment.getExpression().gatherVariables(variables);
+                }
+            }
+        }
+        occurringVariables.push_back(std::move(variables));
+    }
+
+    // A module is independent if it only accesses its own variables and no other module accesses them.
+    independentModules = storm::storage::BitVector(program.getNumberOfModules());
+    for (uint_fast64_t moduleIndex = 0; moduleIndex < program.getNumberOfModules(); ++moduleIndex) {
+        storm::prism::Module const& module = program.getModule(moduleIndex);
+        bool isIndependent = true;
+        for (auto const& command : module.getCommands()) {
+            isIndependent &= !isCommandPotentiallySynchronizing(command);
+        }
+        std::set<storm::expressions::Variable> localVariables = module.getAllExpressionVariables();
+        for (auto const& variable : occurringVariables[moduleIndex]) {
+            isIndependent &= localVariables.count(variable) > 0;
+        }
+        for (uint_fast64_t otherModuleIndex = 0; otherModuleIndex < program.getNumberOfModules(); ++otherModuleIndex) {
+            if (otherModuleIndex != moduleIndex) {
+                for (auto const& variable : localVariables) {
+                    isIndependent &= occurringVariables[otherModuleIndex].count(variable) == 0;
+                }
+            }
+        }
+        independentModules.set(moduleIndex, isIndependent);
+    }
+    if (independentModules.empty()) {
+        STORM_LOG_WARN("Partial order reduction is disabled, because no independent modules were found.");
+        return;
+    }
+
+    // A command is invisible if it does not change a variable occurring in one of the relevant expressions.
+    std::set<storm::expressions::Variable> visibleVariables;
+    for (auto const& descriptionExpressionPair : getRelevantExpressions()) {
+        descriptionExpressionPair.second.gatherVariables(visibleVariables);
+    }
+    ampleCandidateCommands = storm::storage::BitVector(program.getNumberOfCommands());
+    for (auto const& moduleIndex : independentModules) {
+        for (auto const& command : program.getModule(moduleIndex).getCommands()) {
+            // Only deterministic commands are considered, as this is required to preserve the (branching-time) probabilistic behavior.
+            bool isCandidate = command.getNumberOfUpdates() == 1;
+            for (auto const& update : command.getUpdates()) {
+                for (auto const& assignment : update.getAssignments()) {
+                    isCandidate &= visibleVariables.count(assignment.getVariable()) == 0;
+                }
+            }
+            ampleCandidateCommands.set(command.getGlobalIndex(), isCandidate);
+        }
+    }
+    partialOrderReduction = true;
+    STORM_LOG_INFO("Applying partial order reduction for " << independentModules.getNumberOfSetBits() << " independent modules.");
+}
+
+template<typename ValueType, typename StateType>
+storm::prism::Command const* PrismNextStateGenerator<ValueType, StateType>::getAmpleCommand() {
+    if (!partialOrderReduction || !this->stateIsKnownCallback || this->actionMask != nullptr) {
+        return nullptr;
+    }
+    for (auto const& moduleIndex : independentModules) {
+        storm::prism::Module const& module = program.getModule(moduleIndex);
+        storm::storage::BitVector const* candidateCommands = getCandidateCommands(moduleIndex);
+
+        // The ample command has to be the only enabled command of its module. As the module is independent, it then remains enabled
+        // until it is taken and it commutes with all commands of the other modules.
+        storm::prism::Command const* enabledCommand = nullptr;
+        bool hasSingleEnabledCommand = true;
+        for (uint_fast64_t j = 0; j < module.getNumberOfCommands(); ++j) {
+            if (candidateCommands != nullptr && !candidateCommands->get(j)) {
+                continue;
+            }
+            storm::prism::Command const& command = module.getCommand(j);
+            if (this->evaluator->asBool(command.getGuardExpression())) {
+                if (enabledCommand != nullptr) {
+                    hasSingleEnabledCommand = false;
+                    break;
+                }
+                enabledCommand = &command;
+            }
+        }
+        if (!hasSingleEnabledCommand || enabledCommand == nullptr || !ampleCandidateCommands.get(enabledCommand->getGlobalIndex())) {
+            continue;
+        }
+
+        // To not postpone other commands forever along a cycle, we require the successor to be new. As every cycle of the reduced state
+        // space is closed by a transition to a state that was found before, each such cycle then contains a fully expanded state.
+        if (!this->stateIsKnownCallback(applyUpdate(*this->state, enabledCommand->getUpdate(0), successorBuffer))) {
+            return enabledCommand;
+        }
+    }
+    return nullptr;
+}
+
+// The maximal number of bits that the candidate sets of the guard index of a single module may occupy.
+static uint_fast64_t const MaximalGuardIndexSize = 1ull << 24;
+
+/*!
+ * Collects the values that the top-level conjuncts of the given expression require for variables, i.e., conjuncts of the form 'x=k' or 'k=x'
+ * where k is an integer literal. If there are several such conjuncts for the same variable, only the first one is considered.
+ */
+static void collectRequiredIntegerValues(storm::expressions::BaseExpression const& expression,
+                                         std::map<storm::expressions::Variable, int_fast64_t>& requiredValues) {
+    if (expression.isBinaryBooleanFunctionExpression()) {
+        auto const& function = expression.asBinaryBooleanFunctionExpression();
+        if (function.getOperatorType() == storm::expressions::BinaryBooleanFunctionExpression::OperatorType::And) {
+            collectRequiredIntegerValues(*function.getFirstOperand(), requiredValues);
+            collectRequiredIntegerValues(*function.getSecondOperand(), requiredValues);
+        }
+    } else if (expression.isBinaryRelationExpression()) {
+        auto const& relation = expression.asBinaryRelationExpression();
+        if (relation.getRelationType() == storm::expressions::RelationType::Equal) {
+            auto const& firstOperand = *relation.getFirstOperand();
+            auto const& secondOperand = *relation.getSecondOperand();
+            if (firstOperand.isVariableExpression() && secondOperand.isIntegerLiteralExpression()) {
+                requiredValues.emplace(firstOperand.asVariableExpression().getVariable(), secondOperand.asIntegerLiteralExpression().getValue());
+            } else if (secondOperand.isVariableExpression() && firstOperand.isIntegerLiteralExpression()) {
+                requiredValues.emplace(secondOperand.asVariableExpression().getVariable(), firstOperand.asIntegerLiteralExpression().getValue());
+            }
+        }
+    }
+}
+
+template<typename ValueType, typename StateType>
+void PrismNextStateGenerator<ValueType, StateType>::buildGuardIndices() {
+    guardIndices.resize(this->program.getNumberOfModules());
+    for (uint_fast64_t moduleIndex = 0; moduleIndex < this->program.getNumberOfModules(); ++moduleIndex) {
+        storm::prism::Module const& module = this->program.getModule(moduleIndex);
+        uint_fast64_t const numberOfCommands = module.getNumberOfCommands();
+
+        std::vector<std::map<storm::expressions::Variable, int_fast64_t>> requiredValues(numberOfCommands);
+        std::map<storm::expressions::Variable, uint_fast64_t> numberOfConstrainedCommands;
+        for (uint_fast64_t commandIndex = 0; commandIndex < numberOfCommands; ++commandIndex) {
+            collectRequiredIntegerValues(module.getCommand(commandIndex).getGuardExpression().getBaseExpression(), requiredValues[commandIndex]);
+            for (auto const& variableValuePair : requiredValues[commandIndex]) {
+                ++numberOfConstrainedCommands[variableValuePair.first];
+            }
+        }
+
+        // Select the variable of the state that constrains the most commands. Indexing pays off only if it constrains at least two commands.
+        IntegerVariableInformation const* selector = nullptr;
+        uint_fast64_t selectorNumberOfValues = 0;
+        uint_fast64_t selectorNumberOfConstrainedCommands = 1;
+        for (auto const& integerVariable : this->variableInformation.integerVariables) {
+            auto constrainedIt = numberOfConstrainedCommands.find(integerVariable.variable);
+            if (constrainedIt == numberOfConstrainedCommands.end() || constrainedIt->second <= selectorNumberOfConstrainedCommands ||
+                integerVariable.bitWidth >= 32) {
+                continue;
+            }
+            uint_fast64_t numberOfValues = static_cast<uint_fast64_t>(integerVariable.upperBound - integerVariable.lowerBound) + 1;
+            if (numberOfValues * numberOfCommands > MaximalGuardIndexSize) {
+                continue;
+            }
+            selector = &integerVariable;
+            selectorNumberOfValues = numberOfValues;
+            selectorNumberOfConstrainedCommands = constrainedIt->second;
+        }
+        if (selector == nullptr) {
+            continue;
+        }
+
+        STORM_LOG_TRACE("Indexing the commands of module " << module.getName() << " by the value of variable " << selector->getName() << ".");
+        GuardIndex& guardIndex = guardIndices[moduleIndex];
+        guardIndex.isIndexed = true;
+        guardIndex.bitOffset = selector->bitOffset;
+        guardIndex.bitWidth = selector->bitWidth;
+        guardIndex.lowerBound = selector->lowerBound;
+        guardIndex.candidateCommands.assign(selectorNumberOfValues, storm::storage::BitVector(numberOfCommands));
+        for (uint_fast64_t commandIndex = 0; commandIndex < numberOfCommands; ++commandIndex) {
+            auto requiredValueIt = requiredValues[commandIndex].find(selector->variable);
+            if (requiredValueIt == requiredValues[commandIndex].end()) {
+                // The guard does not constrain the selector, so the command is a candidate for all of its values.
+                for (auto& candidates : guardIndex.candidateCommands) {
+                    candidates.set(commandIndex);
+                }
+            } else if (requiredValueIt->second >= selector->lowerBound && requiredValueIt->second <= selector->upperBound) {
+                guardIndex.candidateCommands[requiredValueIt->second - selector->lowerBound].set(commandIndex);
+            }
+            // Otherwise, the guard can never be satisfied.
+        }
+    }
+}
+
+template<typename ValueType, typename StateType>
+storm::storage::BitVector const* PrismNextStateGenerator<ValueType, StateType>::getCandidateCommands(uint_fast64_t moduleIndex) const {
+    GuardIndex const& guardIndex = guardIndices[moduleIndex];
+    if (!guardIndex.isIndexed) {
+        return nullptr;
+    }
+    uint_fast64_t value = this->state->getAsInt(guardIndex.bitOffset, guardIndex.bitWidth);
+    if (value >= guardIndex.candidateCommands.size()) {
+        // This can only happen for values that are out of bounds. We do not make any assumptions then.
+        return nullptr;
+    }
+    return &guardIndex.candidateCommands[value];
+}
+
 struct ActiveCommandData {
     ActiveCommandData(storm::prism::Module const* modulePtr, std::set<uint_fast64_t> const* commandIndicesPtr,
-                      typename std::set<uint_fast64_t>::const_iterator currentCommandIndexIt)
-        : modulePtr(modulePtr), commandIndicesPtr(commandIndicesPtr), currentCommandIndexIt(currentCommandIndexIt) {
+                      typename std::set<uint_fast64_t>::const_iterator currentCommandIndexIt, storm::storage::BitVector const* candidateCommands)
+        : modulePtr(modulePtr), commandIndicesPtr(commandIndicesPtr), currentCommandIndexIt(currentCommandIndexIt), candidateCommands(candidateCommands) {
         // Intentionally left empty
     }
     storm::prism::Module const* modulePtr;
     std::set<uint_fast64_t> const* commandIndicesPtr;
     typename std::set<uint_fast64_t>::const_iterator currentCommandIndexIt;
+    storm::storage::BitVector const* candidateCommands;
 };
 
 template<typename ValueType, typename StateType>
@@ -520,8 +967,12 @@ PrismNextStateGenerator<ValueType, StateType>::getActiveCommandsByActionIndex(ui
         }
 
         // Look up commands by their indices and check if the guard evaluates to true in the given state.
+        storm::storage::BitVector const* candidateCommands = getCandidateCommands(i);
         bool hasOneEnabledCommand = false;
         for (auto commandIndexIt = commandIndices.begin(), commandIndexIte = commandIndices.end(); commandIndexIt != commandIndexIte; ++commandIndexIt) {
+            if (candidateCommands != nullptr && !candidateCommands->get(*commandIndexIt)) {
+                continue;
+            }
             storm::prism::Command const& command = module.getCommand(*commandIndexIt);
             if (!isCommandPotentiallySynchronizing(command)) {
                 continue;
@@ -535,7 +986,7 @@ PrismNextStateGenerator<ValueType, StateType>::getActiveCommandsByActionIndex(ui
             if (this->evaluator->asBool(command.getGuardExpression())) {
                 // Found the first enabled command for this module.
                 hasOneEnabledCommand = true;
-                activeCommands.emplace_back(&module, &commandIndices, commandIndexIt);
+                activeCommands.emplace_back(&module, &commandIndices, commandIndexIt, candidateCommands);
                 break;
             }
         }
@@ -559,6 +1010,9 @@ PrismNextStateGenerator<ValueType, StateType>::getActiveCommandsByActionIndex(ui
         // Look up commands by their indices and add them if the guard evaluates to true in the given state.
         auto commandIndexIte = activeCommand.commandIndicesPtr->end();
         for (++commandIndexIt; commandIndexIt != commandIndexIte; ++commandIndexIt) {
+            if (activeCommand.candidateCommands != nullptr && !activeCommand.candidateCommands->get(*commandIndexIt)) {
+                continue;
+            }
             storm::prism::Command const& command = activeCommand.modulePtr->getCommand(*commandIndexIt);
             if (commandFilter != CommandFilter::All) {
                 STORM_LOG_ASSERT(commandFilter == CommandFilter::Markovian || commandFilter == CommandFilter::Probabilistic, "Unexpected command filter.");
@@ -579,18 +1033,24 @@ PrismNextStateGenerator<ValueType, StateType>::getActiveCommandsByActionIndex(ui
 }
 
 template<typename ValueType, typename StateType>
-std::vector<Choice<ValueType>> PrismNextStateGenerator<ValueType, StateType>::getAsynchronousChoices(CompressedState const& state,
-                                                                                                     StateToIdCallback stateToIdCallback,
-                                                                                                     CommandFilter const& commandFilter) {
-    std::vector<Choice<ValueType>> result;
-
+void PrismNextStateGenerator<ValueType, StateType>::addAsynchronousChoices(std::vector<Choice<ValueType>>& choices, CompressedState const& state,
+                                                                           StateToIdCallback stateToIdCallback, CommandFilter const& commandFilter,
+                                                                           storm::prism::Command const* onlyCommand) {
     // Iterate over all modules.
     for (uint_fast64_t i = 0; i < program.getNumberOfModules(); ++i) {
         storm::prism::Module const& module = program.getModule(i);
+        storm::storage::BitVector const* candidateCommands = getCandidateCommands(i);
 
         // Iterate over all commands.
         for (uint_fast64_t j = 0; j < module.getNumberOfCommands(); ++j) {
+            // Skip the command, if the guard index tells us that it can not be enabled.
+            if (candidateCommands != nullptr && !candidateCommands->get(j)) {
+                continue;
+            }
             storm::prism::Command const& command = module.getCommand(j);
+            if (onlyCommand != nullptr && &command != onlyCommand) {
+                continue;
+            }
 
             // Only consider commands that are not possibly synchronizing.
             if (isCommandPotentiallySynchronizing(command))
@@ -613,8 +1073,8 @@ std::vector<Choice<ValueType>> PrismNextStateGenerator<ValueType, StateType>::ge
                 continue;
             }
 
-            result.push_back(Choice<ValueType>(command.getActionIndex(), command.isMarkovian()));
-            Choice<ValueType>& choice = result.back();
+            choices.push_back(this->createChoice(command.getActionIndex(), command.isMarkovian()));
+            Choice<ValueType>& choice = choices.back();
 
             // Remember the choice origin only if we were asked to.
             if (this->options.isBuildChoiceOriginsSet()) {
@@ -631,7 +1091,7 @@ std::vector<Choice<ValueType>> PrismNextStateGenerator<ValueType, StateType>::ge
                 if (probability != storm::utility::zero<ValueType>()) {
                     // Obtain target state index and add it to the list of known states. If it has not yet been
                     // seen, we also add it to the set of states that have yet to be explored.
-                    StateType stateIndex = stateToIdCallback(applyUpdate(state, update));
+                    StateType stateIndex = stateToIdCallback(applyUpdate(state, update, successorBuffer));
 
                     // Update the choice by adding the probability/target state to it.
                     choice.addProbability(stateIndex, probability);
@@ -673,8 +1133,6 @@ std::vector<Choice<ValueType>> PrismNextStateGenerator<ValueType, StateType>::ge
             }
         }
     }
-
-    return result;
 }
 
 template<typename ValueType, typename StateType>
@@ -733,7 +1191,7 @@ void PrismNextStateGenerator<ValueType, StateType>::addSynchronousChoices(std::v
                 // At this point, we applied all commands of the current command combination and newTargetStates
                 // contains all target states and their respective probabilities. That means we are now ready to
                 // add the choice to the list of transitions.
-                choices.push_back(Choice<ValueType>(actionIndex));
+                choices.push_back(this->createChoice(actionIndex));
 
                 // Now create the actual distribution.
                 Choice<ValueType>& choice = choices.back();
@@ -813,9 +1271,7 @@ std::map<std::string, storm::storage::PlayerIndex> PrismNextStateGenerator<Value
 }
 
 template<typename ValueType, typename StateType>
-storm::models::sparse::StateLabeling PrismNextStateGenerator<ValueType, StateType>::label(storm::storage::sparse::StateStorage<StateType> const& stateStorage,
-                                                                                          std::vector<StateType> const& initialStateIndices,
-                                                                                          std::vector<StateType> const& deadlockStateIndices) {
+std::vector<std::pair<std::string, storm::expressions::Expression>> PrismNextStateGenerator<ValueType, StateType>::getLabelExpressions() const {
     // Gather a vector of labels and their expressions.
     std::vector<std::pair<std::string, storm::expressions::Expression>> labels;
     if (this->options.isBuildAllLabelsSet()) {
@@ -832,8 +1288,7 @@ storm::models::sparse::StateLabeling PrismNextStateGenerator<ValueType, StateTyp
             }
         }
     }
-
-    return NextStateGenerator<ValueType, StateType>::label(stateStorage, initialStateIndices, deadlockStateIndices, labels);
+    return labels;
 }
 
 template<typename ValueType, typename StateType>
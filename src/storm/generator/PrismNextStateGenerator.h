@@ -41,9 +41,7 @@ class PrismNextStateGenerator : public NextStateGenerator<ValueType, StateType>
     virtual storm::builder::RewardModelInformation getRewardModelInformation(uint64_t const& index) const override;
     virtual std::map<std::string, storm::storage::PlayerIndex> getPlayerNameToIndexMap() const override;
 
-    virtual storm::models::sparse::StateLabeling label(storm::storage::sparse::StateStorage<StateType> const& stateStorage,
-                                                       std::vector<StateType> const& initialStateIndices = {},
-                                                       std::vector<StateType> const& deadlockStateIndices = {}) override;
+    virtual std::vector<std::pair<std::string, storm::expressions::Expression>> getLabelExpressions() const override;
 
     virtual std::shared_ptr<storm::storage::sparse::ChoiceOrigins> generateChoiceOrigins(std::vector<boost::any>& dataForChoiceOrigins) const override;
 
@@ -58,6 +56,110 @@ class PrismNextStateGenerator : public NextStateGenerator<ValueType, StateType>
     PrismNextStateGenerator(storm::prism::Program const& program, NextStateGeneratorOptions const& options,
                             std::shared_ptr<ActionMask<ValueType, StateType>> const&, bool flag);
 
+    /*!
+     * The kinds of assignments that have a precompiled implementation.
+     */
+    enum class CompiledAssignmentKind {
+        BooleanConstant,   // b' = true/false
+        BooleanCopy,       // b' = c
+        BooleanNegation,   // b' = !c
+        IntegerConstant,   // x' = k
+        IntegerOffset,     // x' = y + k (including the cases k = 0 and k < 0)
+        Generic            // any other expression, which is evaluated using the expression evaluator
+    };
+
+    /*!
+     * An assignment whose source and target locations in the compressed state have been determined beforehand.
+     * This allows to carry out the most common assignments directly on the bits of the compressed state without
+     * going through the expression evaluator.
+     */
+    struct CompiledAssignment {
+        CompiledAssignmentKind kind;
+        storm::prism::Assignment const* assignment;
+
+        // The location of the assigned variable.
+        uint_fast64_t targetBitOffset;
+        uint_fast64_t targetBitWidth;
+        int_fast64_t targetLowerBound;
+        int_fast64_t targetUpperBound;
+        bool forceOutOfBoundsCheck;
+
+        // The location of the variable that is read (if any).
+        uint_fast64_t sourceBitOffset;
+        uint_fast64_t sourceBitWidth;
+        int_fast64_t sourceLowerBound;
+
+        // The constant (or offset) of the assignment.
+        int_fast64_t constant;
+    };
+
+    /*!
+     * Precompiles the assignments of all updates of the program.
+     */
+    void compileUpdates();
+
+    /*!
+     * Precompiles the given assignment.
+     */
+    CompiledAssignment compileAssignment(storm::prism::Assignment const& assignment) const;
+
+    /*!
+     * An index over the guards of the commands of one module. If many guards of the module require a certain variable to have
+     * a specific value (e.g., a location-like variable as in 's=3 & ...'), the commands are indexed by the value of this
+     * selector variable such that only the guards of commands that can possibly be enabled need to be evaluated.
+     */
+    struct GuardIndex {
+        // Whether the commands of the module are indexed at all.
+        bool isIndexed = false;
+
+        // The location of the selector variable.
+        uint_fast64_t bitOffset = 0;
+        uint_fast64_t bitWidth = 0;
+        int_fast64_t lowerBound = 0;
+
+        // For each value of the selector variable (shifted by the lower bound), the commands whose guard might be satisfied.
+        std::vector<storm::storage::BitVector> candidateCommands;
+    };
+
+    /*!
+     * Detects symmetric (renamed) modules and sets up the canonicalization of states accordingly. If the labels, reward models or
+     * terminal states that are relevant for the model to build are not symmetric, no reduction is performed.
+     */
+    void initializeSymmetryReduction();
+
+    /*!
+     * Retrieves the expressions that are relevant for the model to build (labels, reward models and terminal states), each
+     * together with a description for the user.
+     */
+    std::vector<std::pair<std::string, storm::expressions::Expression>> getRelevantExpressions() const;
+
+    /*!
+     * Statically determines the modules and commands for which the partial order reduction may restrict the exploration. A module is
+     * independent if it does not synchronize and neither reads nor writes variables that are shared with other modules. A command is
+     * a candidate for an ample set if it is deterministic and does not change any variable that is relevant for the model to build.
+     */
+    void initializePartialOrderReduction();
+
+    /*!
+     * Searches for a command of the state that is currently loaded such that exploring only this command yields a reduced model that
+     * is equivalent to the full one with respect to the relevant expressions.
+     *
+     * @return The command or nullptr if the state needs to be fully expanded.
+     */
+    storm::prism::Command const* getAmpleCommand();
+
+    /*!
+     * Builds the guard indices of all modules.
+     */
+    void buildGuardIndices();
+
+    /*!
+     * Retrieves the commands of the given module whose guards might be satisfied in the state that is currently loaded.
+     *
+     * @return The candidate commands or nullptr if the commands of the module are not indexed (i.e., all commands are candidates).
+     */
+    storm::storage::BitVector const* getCandidateCommands(uint_fast64_t moduleIndex) const;
+
     /*!
      * Applies an update to the state currently loaded into the evaluator and applies the resulting values to
      * the given compressed state.
@@ -67,6 +169,14 @@ class PrismNextStateGenerator : public NextStateGenerator<ValueType, StateType>
      */
     CompressedState applyUpdate(CompressedState const& state, storm::prism::Update const& update);
 
+    /*!
+     * Applies an update as above, but writes the resulting values to the given target state, which avoids allocating a new state if
+     * the target is reused.
+     *
+     * @return The target state or the out-of-bounds state, if the update leads to an out-of-bounds value.
+     */
+    CompressedState const& applyUpdate(CompressedState const& state, storm::prism::Update const& update, CompressedState& newState);
+
     /*!
      * Retrieves all commands that are labeled with the given label and enabled in the given state, grouped by
      * modules.
@@ -89,11 +199,12 @@ class PrismNextStateGenerator : public NextStateGenerator<ValueType, StateType>
     /*!
      * Retrieves all choices that are definitively asynchronous, possible from the given state.
      *
+     * @param choices The new choices are inserted in this vector
      * @param state The state for which to retrieve the unlabeled choices.
-     * @return The asynchronous choices of the state.
+     * @param onlyCommand If given, all other commands are ignored.
      */
-    std::vector<Choice<ValueType>> getAsynchronousChoices(CompressedState const& state, StateToIdCallback stateToIdCallback,
-                                                          CommandFilter const& commandFilter = CommandFilter::All);
+    void addAsynchronousChoices(std::vector<Choice<ValueType>>& choices, CompressedState const& state, StateToIdCallback stateToIdCallback,
+                                CommandFilter const& commandFilter = CommandFilter::All, storm::prism::Command const* onlyCommand = nullptr);
 
     /*!
      * Retrieves all (potentially) synchronous choices possible from the given state.
@@ -134,6 +245,20 @@ class PrismNextStateGenerator : public NextStateGenerator<ValueType, StateType>
     // A flag that stores whether at least one of the selected reward models has state-action rewards.
     bool hasStateActionRewards;
 
+    // The precompiled assignments of the updates, indexed by the global index of the update.
+    std::vector<std::vector<CompiledAssignment>> compiledUpdates;
+
+    // The guard indices, indexed by the module index.
+    std::vector<GuardIndex> guardIndices;
+
+    // A buffer for the successor states of asynchronous commands.
+    CompressedState successorBuffer;
+
+    // Whether the partial order reduction is applied. If so, the independent modules and the commands that may form an ample set.
+    bool partialOrderReduction;
+    storm::storage::BitVector independentModules;
+    storm::storage::BitVector ampleCandidateCommands;
+
     // Mappings from module/action indices to the programs players
     std::vector<storm::storage::PlayerIndex> moduleIndexToPlayerIndexMap;
     std::map<uint_fast64_t, storm::storage::PlayerIndex> actionIndexToPlayerIndexMap;
@@ -76,6 +76,11 @@ class StateBehavior {
      */
     std::size_t getNumberOfChoices() const;
 
+    /*!
+     * Turns this behavior into the behavior of a state that was not yet expanded. The allocated memory is kept.
+     */
+    void clear();
+
    private:
     // The choices available in the state.
     std::vector<Choice<ValueType, StateType>> choices;
@@ -0,0 +1,67 @@
+#include "storm/generator/StateCanonicalizer.h"
+
+#include <algorithm>
+#include <numeric>
+
+#include "storm/utility/macros.h"
+
+namespace storm {
+namespace generator {
+
+void StateCanonicalizer::addSymmetricBlocks(std::vector<Block> const& blocks) {
+    STORM_LOG_ASSERT(std::all_of(blocks.begin(), blocks.end(), [&blocks](Block const& block) { return block.size() == blocks.front().size(); }),
+                     "Symmetric blocks need to have the same number of variables.");
+    if (blocks.size() > 1) {
+        groups.push_back(blocks);
+    }
+}
+
+bool StateCanonicalizer::empty() const {
+    return groups.empty();
+}
+
+bool StateCanonicalizer::canonicalize(CompressedState& state) const {
+    auto blockIsLess = [&state](Block const& first, Block const& second) {
+        for (uint_fast64_t variable = 0; variable < first.size(); ++variable) {
+            uint_fast64_t firstValue = state.getAsInt(first[variable].first, first[variable].second);
+            uint_fast64_t secondValue = state.getAsInt(second[variable].first, second[variable].second);
+            if (firstValue != secondValue) {
+                return firstValue < secondValue;
+            }
+        }
+        return false;
+    };
+
+    bool changed = false;
+    for (auto const& blocks : groups) {
+        if (std::is_sorted(blocks.begin(), blocks.end(), blockIsLess)) {
+            continue;
+        }
+
+        std::vector<uint_fast64_t> order(blocks.size());
+        std::iota(order.begin(), order.end(), 0);
+        std::stable_sort(order.begin(), order.end(),
+                         [&blocks, &blockIsLess](uint_fast64_t first, uint_fast64_t second) { return blockIsLess(blocks[first], blocks[second]); });
+
+        // Read all values before writing them, as the blocks are permuted.
+        std::vector<uint_fast64_t> values;
+        values.reserve(blocks.size() * blocks.front().size());
+        for (auto blockIndex : order) {
+            for (auto const& variable : blocks[blockIndex]) {
+                values.push_back(state.getAsInt(variable.first, variable.second));
+            }
+        }
+        auto valueIt = values.begin();
+        for (auto const& block : blocks) {
+            for (auto const& variable : block) {
+                state.setFromInt(variable.first, variable.second, *valueIt);
+                ++valueIt;
+            }
+        }
+        changed = true;
+    }
+    return changed;
+}
+
+}  // namespace generator
+}  // namespace storm
@@ -0,0 +1,45 @@
+#pragma once
+
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+#include "storm/generator/CompressedState.h"
+
+namespace storm {
+namespace generator {
+
+/*!
+ * Maps states to a canonical representative of their orbit under permutations of symmetric blocks of variables. Typically, a block comprises
+ * the local variables of one copy of a replicated module. Within each group of symmetric blocks, the representative is obtained by sorting
+ * the blocks lexicographically with respect to the values of their variables.
+ */
+class StateCanonicalizer {
+   public:
+    // The locations (bit offset and bit width) of the variables of one block.
+    typedef std::vector<std::pair<uint_fast64_t, uint_fast64_t>> Block;
+
+    /*!
+     * Adds a group of blocks that may be permuted arbitrarily. All blocks need to have the same layout, i.e., their i-th variables need to have
+     * the same bit width and the same encoding.
+     */
+    void addSymmetricBlocks(std::vector<Block> const& blocks);
+
+    /*!
+     * Retrieves whether there are any symmetric blocks.
+     */
+    bool empty() const;
+
+    /*!
+     * Replaces the given state by the representative of its orbit.
+     *
+     * @return True iff the state was changed.
+     */
+    bool canonicalize(CompressedState& state) const;
+
+   private:
+    std::vector<std::vector<Block>> groups;
+};
+
+}  // namespace generator
+}  // namespace storm
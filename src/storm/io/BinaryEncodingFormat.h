@@ -0,0 +1,69 @@
+#pragma once
+
+#include <cstdint>
+
+namespace storm {
+namespace exporter {
+namespace binaryencoding {
+
+/*
+ * Layout of the binary direct encoding (drnb) of explicit models.
+ * All numbers are stored in the byte order of the exporting machine. Every section starts at a multiple of 8 bytes.
+ *
+ * Header                   (see struct Header)
+ * Model type               (string)
+ * Row indications          (numberOfChoices + 1 uint64)
+ * Row group indices        (numberOfStates + 1 uint64, only if HasRowGroups)
+ * Columns                  (numberOfEntries uint64)
+ * Values                   (numberOfEntries double)
+ * Exit rates               (numberOfStates double, only if HasExitRates)
+ * Markovian states         (bit vector of size numberOfStates, only if HasMarkovianStates)
+ * Observations             (numberOfStates uint32, only if HasObservations)
+ * State labels             (numberOfStateLabels times: name as string, bit vector of size numberOfStates)
+ * Choice labels            (numberOfChoiceLabels times: name as string, bit vector of size numberOfChoices)
+ * Reward models            (numberOfRewardModels times: name as string, uint64 flags, state rewards (numberOfStates double, only if HasStateRewards),
+ *                           state-action rewards (numberOfChoices double, only if HasStateActionRewards))
+ * State valuations         (only if HasStateValuations: number of variables (uint64), for each variable its name as string and its VariableType
+ *                           (uint64), followed by the valuations as written by StateValuations::writeBinary, given as string)
+ *
+ * A string is given by its length (uint64) followed by its characters.
+ * A bit vector is given by blocks of 64 bits (uint64).
+ * The file contains no absolute positions, so it can also be placed in a shared memory segment that is mapped at different addresses.
+ */
+
+// Magic bytes at the beginning of each file
+constexpr char magic[8] = {'S', 'T', 'O', 'R', 'M', 'D', 'R', 'B'};
+
+// Current version of the format. Version 2 added the state valuations, files of version 1 can still be read.
+constexpr uint64_t version = 2;
+
+// Known value to detect files with a different byte order
+constexpr uint64_t byteOrderMark = 0x0102030405060708ull;
+
+// Flags for the model components contained in the file
+enum ModelFlags : uint64_t { HasRowGroups = 1, HasExitRates = 2, HasMarkovianStates = 4, HasObservations = 8, HasStateValuations = 16 };
+
+// Flags for the vectors contained in a reward model
+enum RewardFlags : uint64_t { HasStateRewards = 1, HasStateActionRewards = 2 };
+
+// Types of the variables of the state valuations
+enum VariableType : uint64_t { Boolean = 0, Integer = 1, Rational = 2 };
+
+struct Header {
+    char magic[8];
+    uint64_t byteOrderMark;
+    uint64_t version;
+    uint64_t flags;
+    uint64_t numberOfStates;
+    uint64_t numberOfChoices;
+    uint64_t numberOfEntries;
+    uint64_t numberOfStateLabels;
+    uint64_t numberOfChoiceLabels;
+    uint64_t numberOfRewardModels;
+};
+
+static_assert(sizeof(Header) % 8 == 0, "Header must be aligned to 8 bytes.");
+
+}  // namespace binaryencoding
+}  // namespace exporter
+}  // namespace storm
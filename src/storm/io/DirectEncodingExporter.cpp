@@ -1,13 +1,20 @@
 #include "storm/io/DirectEncodingExporter.h"
 #include <storm/exceptions/NotSupportedException.h>
 
+#include <algorithm>
+#include <sstream>
+#include <type_traits>
+
+#include "storm/adapters/IntelTbbAdapter.h"
 #include "storm/adapters/RationalFunctionAdapter.h"
 #include "storm/exceptions/NotImplementedException.h"
+#include "storm/io/BinaryEncodingFormat.h"
 #include "storm/models/sparse/Ctmc.h"
 #include "storm/models/sparse/Dtmc.h"
 #include "storm/models/sparse/MarkovAutomaton.h"
 #include "storm/models/sparse/Mdp.h"
 #include "storm/models/sparse/Pomdp.h"
+#include "storm/storage/sparse/StateValuations.h"
 #include "storm/utility/constants.h"
 #include "storm/utility/macros.h"
 
@@ -16,62 +23,17 @@
 namespace storm {
 namespace exporter {
 
+namespace {
+/*!
+ * Write the states in the range [firstState, lastState) with their outgoing transitions.
+ */
 template<typename ValueType>
-void explicitExportSparseModel(std::ostream& os, std::shared_ptr<storm::models::sparse::Model<ValueType>> sparseModel,
-                               std::vector<std::string> const& parameters, DirectEncodingOptions const& options) {
-    // Notice that for CTMCs we write the rate matrix instead of probabilities
-
-    // Initialize
-    std::vector<ValueType> exitRates;  // Only for CTMCs and MAs.
-    if (sparseModel->getType() == storm::models::ModelType::Ctmc) {
-        exitRates = sparseModel->template as<storm::models::sparse::Ctmc<ValueType>>()->getExitRateVector();
-    } else if (sparseModel->getType() == storm::models::ModelType::MarkovAutomaton) {
-        exitRates = sparseModel->template as<storm::models::sparse::MarkovAutomaton<ValueType>>()->getExitRates();
-    }
-
-    // Write header
-    os << "// Exported by storm\n";
-    os << "// Original model type: " << sparseModel->getType() << '\n';
-    os << "@type: " << sparseModel->getType() << '\n';
-    os << "@parameters\n";
-    if (parameters.empty()) {
-        for (std::string const& parameter : getParameters(sparseModel)) {
-            os << parameter << " ";
-        }
-    } else {
-        for (std::string const& parameter : parameters) {
-            os << parameter << " ";
-        }
-    }
-    os << '\n';
-
-    // Optionally write placeholders which only need to be parsed once
-    // This is used to reduce the parsing effort for rational functions
-    // Placeholders begin with the dollar symbol $
-    std::unordered_map<ValueType, std::string> placeholders;
-    if (options.allowPlaceholders) {
-        placeholders = generatePlaceholders(sparseModel, exitRates);
-    }
-    if (!placeholders.empty()) {
-        os << "@placeholders\n";
-        for (auto const& entry : placeholders) {
-            os << "$" << entry.second << " : " << entry.first << '\n';
-        }
-    }
-
-    os << "@reward_models\n";
-    for (auto const& rewardModel : sparseModel->getRewardModels()) {
-        os << rewardModel.first << " ";
-    }
-    os << '\n';
-    os << "@nr_states\n" << sparseModel->getNumberOfStates() << '\n';
-    os << "@nr_choices\n" << sparseModel->getNumberOfChoices() << '\n';
-    os << "@model\n";
-
-    storm::storage::SparseMatrix<ValueType> const& matrix = sparseModel->getTransitionMatrix();
+void writeStates(std::ostream& os, storm::models::sparse::Model<ValueType> const& model, std::vector<ValueType> const& exitRates,
+                 std::unordered_map<ValueType, std::string> const& placeholders, uint64_t firstState, uint64_t lastState) {
+    storm::storage::SparseMatrix<ValueType> const& matrix = model.getTransitionMatrix();
 
     // Iterate over states and export state information and outgoing transitions
-    for (typename storm::storage::SparseMatrix<ValueType>::index_type group = 0; group < matrix.getRowGroupCount(); ++group) {
+    for (typename storm::storage::SparseMatrix<ValueType>::index_type group = firstState; group < lastState; ++group) {
         os << "state " << group;
 
         // Write exit rates for CTMCs and MAs
@@ -80,13 +42,13 @@ void explicitExportSparseModel(std::ostream& os, std::shared_ptr<storm::models::
             writeValue(os, exitRates.at(group), placeholders);
         }
 
-        if (sparseModel->getType() == storm::models::ModelType::Pomdp) {
-            os << " {" << sparseModel->template as<storm::models::sparse::Pomdp<ValueType>>()->getObservation(group) << "}";
+        if (model.getType() == storm::models::ModelType::Pomdp) {
+            os << " {" << model.template as<storm::models::sparse::Pomdp<ValueType>>()->getObservation(group) << "}";
         }
 
         // Write state rewards
         bool first = true;
-        for (auto const& rewardModelEntry : sparseModel->getRewardModels()) {
+        for (auto const& rewardModelEntry : model.getRewardModels()) {
             if (first) {
                 os << " [";
                 first = false;
@@ -106,7 +68,7 @@ void explicitExportSparseModel(std::ostream& os, std::shared_ptr<storm::models::
         }
 
         // Write labels. Only labels with a whitespace are put in (double) quotation marks.
-        for (auto const& label : sparseModel->getStateLabeling().getLabelsOfState(group)) {
+        for (auto const& label : model.getStateLabeling().getLabelsOfState(group)) {
             STORM_LOG_THROW(std::count(label.begin(), label.end(), '\"') == 0, storm::exceptions::NotSupportedException,
                             "Labels with quotation marks are not supported in the DRN format and therefore may not be exported.");
             // TODO consider escaping the quotation marks. Not sure whether that is a good idea.
@@ -118,8 +80,8 @@ void explicitExportSparseModel(std::ostream& os, std::shared_ptr<storm::models::
         }
         os << '\n';
         // Write state valuations as comments
-        if (sparseModel->hasStateValuations()) {
-            os << "//" << sparseModel->getStateValuations().getStateInfo(group) << '\n';
+        if (model.hasStateValuations()) {
+            os << "//" << model.getStateValuations().getStateInfo(group) << '\n';
         }
 
         // Write probabilities
@@ -129,13 +91,13 @@ void explicitExportSparseModel(std::ostream& os, std::shared_ptr<storm::models::
         // Iterate over all actions
         for (typename storm::storage::SparseMatrix<ValueType>::index_type row = start; row < end; ++row) {
             // Write choice
-            if (sparseModel->hasChoiceLabeling()) {
+            if (model.hasChoiceLabeling()) {
                 os << "\taction ";
                 bool lfirst = true;
-                if (sparseModel->getChoiceLabeling().getLabelsOfChoice(row).empty()) {
+                if (model.getChoiceLabeling().getLabelsOfChoice(row).empty()) {
                     os << "__NOLABEL__";
                 }
-                for (auto const& label : sparseModel->getChoiceLabeling().getLabelsOfChoice(row)) {
+                for (auto const& label : model.getChoiceLabeling().getLabelsOfChoice(row)) {
                     if (!lfirst) {
                         os << "_";
                         lfirst = false;
@@ -148,7 +110,7 @@ void explicitExportSparseModel(std::ostream& os, std::shared_ptr<storm::models::
 
             // Write action rewards
             bool first = true;
-            for (auto const& rewardModelEntry : sparseModel->getRewardModels()) {
+            for (auto const& rewardModelEntry : model.getRewardModels()) {
                 if (first) {
                     os << " [";
                     first = false;
@@ -177,6 +139,92 @@ void explicitExportSparseModel(std::ostream& os, std::shared_ptr<storm::models::
         }
     }  // end state iteration
 }
+}  // namespace
+
+template<typename ValueType>
+void explicitExportSparseModel(std::ostream& os, std::shared_ptr<storm::models::sparse::Model<ValueType>> sparseModel,
+                               std::vector<std::string> const& parameters, DirectEncodingOptions const& options) {
+    // Notice that for CTMCs we write the rate matrix instead of probabilities
+
+    // Initialize
+    std::vector<ValueType> exitRates;  // Only for CTMCs and MAs.
+    if (sparseModel->getType() == storm::models::ModelType::Ctmc) {
+        exitRates = sparseModel->template as<storm::models::sparse::Ctmc<ValueType>>()->getExitRateVector();
+    } else if (sparseModel->getType() == storm::models::ModelType::MarkovAutomaton) {
+        exitRates = sparseModel->template as<storm::models::sparse::MarkovAutomaton<ValueType>>()->getExitRates();
+    }
+
+    // Write header
+    os << "// Exported by storm\n";
+    os << "// Original model type: " << sparseModel->getType() << '\n';
+    os << "@type: " << sparseModel->getType() << '\n';
+    os << "@parameters\n";
+    if (parameters.empty()) {
+        for (std::string const& parameter : getParameters(sparseModel)) {
+            os << parameter << " ";
+        }
+    } else {
+        for (std::string const& parameter : parameters) {
+            os << parameter << " ";
+        }
+    }
+    os << '\n';
+
+    // Optionally write placeholders which only need to be parsed once
+    // This is used to reduce the parsing effort for rational functions
+    // Placeholders begin with the dollar symbol $
+    std::unordered_map<ValueType, std::string> placeholders;
+    if (options.allowPlaceholders) {
+        placeholders = generatePlaceholders(sparseModel, exitRates);
+    }
+    if (!placeholders.empty()) {
+        os << "@placeholders\n";
+        for (auto const& entry : placeholders) {
+            os << "$" << entry.second << " : " << entry.first << '\n';
+        }
+    }
+
+    os << "@reward_models\n";
+    for (auto const& rewardModel : sparseModel->getRewardModels()) {
+        os << rewardModel.first << " ";
+    }
+    os << '\n';
+    os << "@nr_states\n" << sparseModel->getNumberOfStates() << '\n';
+    os << "@nr_choices\n" << sparseModel->getNumberOfChoices() << '\n';
+    os << "@model\n";
+
+    uint64_t const nrStates = sparseModel->getNumberOfStates();
+#ifdef STORM_HAVE_INTELTBB
+    // Format chunks of states concurrently and write them in order.
+    // Only a bounded number of chunks is kept in memory at the same time.
+    // Rational numbers and functions are not thread safe and are therefore always written sequentially.
+    if (std::is_same_v<ValueType, double> && options.numberOfThreads > 1 && options.statesPerChunk > 0) {
+        uint64_t const nrChunksPerRound = options.numberOfThreads * 4;
+        std::vector<std::string> buffers(nrChunksPerRound);
+        tbb::task_arena arena(options.numberOfThreads);
+        for (uint64_t roundStart = 0; roundStart < nrStates; roundStart += nrChunksPerRound * options.statesPerChunk) {
+            uint64_t nrChunks = std::min(nrChunksPerRound, (nrStates - roundStart + options.statesPerChunk - 1) / options.statesPerChunk);
+            arena.execute([&]() {
+                tbb::parallel_for(tbb::blocked_range<uint64_t>(0, nrChunks, 1), [&](tbb::blocked_range<uint64_t> const& range) {
+                    for (uint64_t chunk = range.begin(); chunk < range.end(); ++chunk) {
+                        uint64_t firstState = roundStart + chunk * options.statesPerChunk;
+                        std::ostringstream stream;
+                        stream.copyfmt(os);
+                        writeStates(stream, *sparseModel, exitRates, placeholders, firstState, std::min(firstState + options.statesPerChunk, nrStates));
+                        buffers[chunk] = stream.str();
+                    }
+                });
+            });
+            for (uint64_t chunk = 0; chunk < nrChunks; ++chunk) {
+                os << buffers[chunk];
+                buffers[chunk].clear();
+            }
+        }
+        return;
+    }
+#endif
+    writeStates(os, *sparseModel, exitRates, placeholders, 0, nrStates);
+}
 
 template<typename ValueType>
 std::vector<std::string> getParameters(std::shared_ptr<storm::models::sparse::Model<ValueType>>) {
@@ -270,6 +318,190 @@ void writeValue(std::ostream& os, ValueType value, std::unordered_map<ValueType,
     }
 }
 
+namespace {
+// Write the given bytes and pad them to a multiple of 8 bytes
+void writeBytes(std::ostream& os, void const* data, uint64_t size) {
+    static char const padding[8] = {};
+    os.write(static_cast<char const*>(data), size);
+    if (size % 8 != 0) {
+        os.write(padding, 8 - size % 8);
+    }
+}
+
+void writeWord(std::ostream& os, uint64_t word) {
+    writeBytes(os, &word, sizeof(word));
+}
+
+template<typename T>
+void writeVector(std::ostream& os, std::vector<T> const& vector) {
+    writeBytes(os, vector.data(), vector.size() * sizeof(T));
+}
+
+void writeString(std::ostream& os, std::string const& str) {
+    writeWord(os, str.size());
+    writeBytes(os, str.data(), str.size());
+}
+
+void writeBitVector(std::ostream& os, storm::storage::BitVector const& bitVector) {
+    for (uint64_t index = 0; index < bitVector.size(); index += 64) {
+        writeWord(os, bitVector.getAsInt(index, std::min<uint64_t>(64, bitVector.size() - index)));
+    }
+}
+}  // namespace
+
+void binaryExportSparseModel(std::ostream& os, std::shared_ptr<storm::models::sparse::Model<double>> const& sparseModel) {
+    namespace binary = storm::exporter::binaryencoding;
+    storm::models::ModelType type = sparseModel->getType();
+    STORM_LOG_THROW(type == storm::models::ModelType::Dtmc || type == storm::models::ModelType::Ctmc || type == storm::models::ModelType::Mdp ||
+                        type == storm::models::ModelType::Pomdp || type == storm::models::ModelType::MarkovAutomaton,
+                    storm::exceptions::NotSupportedException, "Model type " << type << " is not supported by the binary encoding.");
+    storm::storage::SparseMatrix<double> const& matrix = sparseModel->getTransitionMatrix();
+
+    // Collect the components to export in a fixed order
+    std::vector<std::string> stateLabels;
+    for (auto const& label : sparseModel->getStateLabeling().getLabels()) {
+        stateLabels.push_back(label);
+    }
+    std::vector<std::string> choiceLabels;
+    if (sparseModel->hasChoiceLabeling()) {
+        for (auto const& label : sparseModel->getChoiceLabeling().getLabels()) {
+            choiceLabels.push_back(label);
+        }
+    }
+    std::vector<std::string> rewardModelNames;
+    for (auto const& rewardModel : sparseModel->getRewardModels()) {
+        STORM_LOG_THROW(!rewardModel.second.hasTransitionRewards(), storm::exceptions::NotSupportedException,
+                        "Transition rewards of reward model '" << rewardModel.first << "' are not supported by the binary encoding.");
+        rewardModelNames.push_back(rewardModel.first);
+    }
+    std::sort(rewardModelNames.begin(), rewardModelNames.end());
+
+    // Write header
+    binary::Header header{};
+    std::copy_n(binary::magic, 8, header.magic);
+    header.byteOrderMark = binary::byteOrderMark;
+    header.version = binary::version;
+    header.flags = 0;
+    if (!matrix.hasTrivialRowGrouping()) {
+        header.flags |= binary::HasRowGroups;
+    }
+    if (type == storm::models::ModelType::Ctmc || type == storm::models::ModelType::MarkovAutomaton) {
+        header.flags |= binary::HasExitRates;
+    }
+    if (type == storm::models::ModelType::MarkovAutomaton) {
+        header.flags |= binary::HasMarkovianStates;
+    }
+    if (type == storm::models::ModelType::Pomdp) {
+        header.flags |= binary::HasObservations;
+    }
+    if (sparseModel->hasStateValuations() && sparseModel->getNumberOfStates() > 0) {
+        header.flags |= binary::HasStateValuations;
+    }
+    header.numberOfStates = sparseModel->getNumberOfStates();
+    header.numberOfChoices = matrix.getRowCount();
+    header.numberOfEntries = matrix.getEntryCount();
+    header.numberOfStateLabels = stateLabels.size();
+    header.numberOfChoiceLabels = choiceLabels.size();
+    header.numberOfRewardModels = rewardModelNames.size();
+    writeBytes(os, &header, sizeof(header));
+    std::stringstream typeStream;
+    typeStream << type;
+    writeString(os, typeStream.str());
+
+    // Write matrix in CSR format
+    uint64_t rowStart = 0;
+    writeWord(os, rowStart);
+    for (uint64_t row = 0; row < matrix.getRowCount(); ++row) {
+        rowStart += matrix.getRow(row).getNumberOfEntries();
+        writeWord(os, rowStart);
+    }
+    if (header.flags & binary::HasRowGroups) {
+        std::vector<uint64_t> rowGroupIndices(matrix.getRowGroupIndices().begin(), matrix.getRowGroupIndices().end());
+        writeVector(os, rowGroupIndices);
+    }
+    for (uint64_t row = 0; row < matrix.getRowCount(); ++row) {
+        for (auto const& entry : matrix.getRow(row)) {
+            writeWord(os, entry.getColumn());
+        }
+    }
+    for (uint64_t row = 0; row < matrix.getRowCount(); ++row) {
+        for (auto const& entry : matrix.getRow(row)) {
+            double value = entry.getValue();
+            writeBytes(os, &value, sizeof(value));
+        }
+    }
+
+    // Write model specific components
+    if (type == storm::models::ModelType::Ctmc) {
+        writeVector(os, sparseModel->as<storm::models::sparse::Ctmc<double>>()->getExitRateVector());
+    } else if (type == storm::models::ModelType::MarkovAutomaton) {
+        auto ma = sparseModel->as<storm::models::sparse::MarkovAutomaton<double>>();
+        writeVector(os, ma->getExitRates());
+        writeBitVector(os, ma->getMarkovianStates());
+    } else if (type == storm::models::ModelType::Pomdp) {
+        writeVector(os, sparseModel->as<storm::models::sparse::Pomdp<double>>()->getObservations());
+    }
+
+    // Write labels
+    for (auto const& label : stateLabels) {
+        writeString(os, label);
+        writeBitVector(os, sparseModel->getStateLabeling().getStates(label));
+    }
+    for (auto const& label : choiceLabels) {
+        writeString(os, label);
+        writeBitVector(os, sparseModel->getChoiceLabeling().getChoices(label));
+    }
+
+    // Write reward models
+    for (auto const& name : rewardModelNames) {
+        auto const& rewardModel = sparseModel->getRewardModel(name);
+        writeString(os, name);
+        uint64_t flags = 0;
+        if (rewardModel.hasStateRewards()) {
+            flags |= binary::HasStateRewards;
+        }
+        if (rewardModel.hasStateActionRewards()) {
+            flags |= binary::HasStateActionRewards;
+        }
+        writeWord(os, flags);
+        if (rewardModel.hasStateRewards()) {
+            writeVector(os, rewardModel.getStateRewardVector());
+        }
+        if (rewardModel.hasStateActionRewards()) {
+            writeVector(os, rewardModel.getStateActionRewardVector());
+        }
+    }
+
+    // Write state valuations
+    // The variables are declared explicitly, such that they can be recreated when loading the model.
+    if (header.flags & binary::HasStateValuations) {
+        auto const& valuations = sparseModel->getStateValuations();
+        std::vector<storm::expressions::Variable> variables;
+        auto const values = valuations.at(0);
+        for (auto valueIt = values.begin(), valueIte = values.end(); valueIt != valueIte; ++valueIt) {
+            if (valueIt.isVariableAssignment()) {
+                variables.push_back(valueIt.getVariable());
+            }
+        }
+        writeWord(os, variables.size());
+        for (auto const& variable : variables) {
+            writeString(os, variable.getName());
+            if (variable.hasBooleanType()) {
+                writeWord(os, binary::Boolean);
+            } else if (variable.hasIntegerType()) {
+                writeWord(os, binary::Integer);
+            } else {
+                STORM_LOG_THROW(variable.hasRationalType(), storm::exceptions::NotSupportedException,
+                                "Type of variable " << variable.getName() << " is not supported by the binary encoding.");
+                writeWord(os, binary::Rational);
+            }
+        }
+        std::stringstream valuationsStream;
+        valuations.writeBinary(valuationsStream);
+        writeString(os, valuationsStream.str());
+    }
+}
+
 // Template instantiations
 template void explicitExportSparseModel<double>(std::ostream& os, std::shared_ptr<storm::models::sparse::Model<double>> sparseModel,
                                                 std::vector<std::string> const& parameters, DirectEncodingOptions const& options);
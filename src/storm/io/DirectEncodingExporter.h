@@ -10,6 +10,10 @@ namespace exporter {
 
 struct DirectEncodingOptions {
     bool allowPlaceholders = true;
+    // Number of threads used for formatting the states (only for models with double values)
+    uint64_t numberOfThreads = 1;
+    // Number of states formatted together by one thread. Bounds the memory needed for buffering the output.
+    uint64_t statesPerChunk = 10000;
 };
 /*!
  * Exports a sparse model into the explicit DRN format.
@@ -22,6 +26,16 @@ template<typename ValueType>
 void explicitExportSparseModel(std::ostream& os, std::shared_ptr<storm::models::sparse::Model<ValueType>> sparseModel,
                                std::vector<std::string> const& parameters, DirectEncodingOptions const& options = DirectEncodingOptions());
 
+/*!
+ * Exports a sparse model into the binary direct encoding (drnb), see BinaryEncodingFormat.h for the layout.
+ * In contrast to the DRN format, a model in binary encoding can be loaded without any parsing.
+ * Choice labels and state valuations are exported, transition rewards are not supported.
+ *
+ * @param os           Stream to export to (should be opened in binary mode)
+ * @param sparseModel  Model to export
+ */
+void binaryExportSparseModel(std::ostream& os, std::shared_ptr<storm::models::sparse::Model<double>> const& sparseModel);
+
 /*!
  * Accumulate parameters in the model.
  *
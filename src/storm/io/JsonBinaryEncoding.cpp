@@ -0,0 +1,281 @@
+#include "storm/io/JsonBinaryEncoding.h"
+
+#include <algorithm>
+#include <cstring>
+#include <type_traits>
+#include <unordered_map>
+#include <vector>
+
+#include "storm/adapters/JsonAdapter.h"
+#include "storm/adapters/RationalNumberAdapter.h"
+#include "storm/exceptions/NotSupportedException.h"
+#include "storm/exceptions/WrongFormatException.h"
+#include "storm/io/file.h"
+#include "storm/utility/constants.h"
+#include "storm/utility/macros.h"
+
+namespace storm {
+namespace exporter {
+
+namespace {
+namespace binary = jsonbinaryencoding;
+
+template<typename ValueType>
+class JsonBinaryWriter {
+   public:
+    std::string encode(storm::json<ValueType> const& j) {
+        writeValue(j);
+        // The string table is only complete after the document has been written, so it is placed in front afterwards.
+        std::string result(binary::magic, binary::magic + 8);
+        appendRaw(result, binary::byteOrderMark);
+        appendRaw(result, binary::version);
+        appendVarint(result, strings.size());
+        for (auto const& str : strings) {
+            appendVarint(result, str.size());
+            result.append(str);
+        }
+        result.append(body);
+        return result;
+    }
+
+   private:
+    template<typename T>
+    static void appendRaw(std::string& target, T const& value) {
+        char bytes[sizeof(T)];
+        std::memcpy(bytes, &value, sizeof(T));
+        target.append(bytes, sizeof(T));
+    }
+
+    static void appendVarint(std::string& target, uint64_t value) {
+        while (value >= 0x80) {
+            target.push_back(static_cast<char>((value & 0x7f) | 0x80));
+            value >>= 7;
+        }
+        target.push_back(static_cast<char>(value));
+    }
+
+    void writeTag(binary::Tag tag) {
+        body.push_back(static_cast<char>(tag));
+    }
+
+    void writeString(std::string const& str) {
+        auto insertionResult = stringIndices.emplace(str, strings.size());
+        if (insertionResult.second) {
+            strings.push_back(str);
+        }
+        appendVarint(body, insertionResult.first->second);
+    }
+
+    void writeValue(storm::json<ValueType> const& j) {
+        switch (j.type()) {
+            case nlohmann::json::value_t::null:
+            case nlohmann::json::value_t::discarded:
+                writeTag(binary::Null);
+                break;
+            case nlohmann::json::value_t::boolean:
+                writeTag(j.template get<bool>() ? binary::True : binary::False);
+                break;
+            case nlohmann::json::value_t::number_unsigned:
+                writeTag(binary::Unsigned);
+                appendVarint(body, j.template get<uint64_t>());
+                break;
+            case nlohmann::json::value_t::number_integer: {
+                writeTag(binary::Integer);
+                int64_t value = j.template get<int64_t>();
+                appendVarint(body, (static_cast<uint64_t>(value) << 1) ^ static_cast<uint64_t>(value >> 63));
+                break;
+            }
+            case nlohmann::json::value_t::number_float:
+                if constexpr (std::is_same_v<ValueType, double>) {
+                    writeTag(binary::Double);
+                    appendRaw(body, j.template get<double>());
+                } else {
+                    // Store the exact value
+                    writeTag(binary::Rational);
+                    writeString(storm::utility::to_string(j.template get_ref<ValueType const&>()));
+                }
+                break;
+            case nlohmann::json::value_t::string:
+                writeTag(binary::String);
+                writeString(j.template get_ref<std::string const&>());
+                break;
+            case nlohmann::json::value_t::array:
+                writeTag(binary::Array);
+                appendVarint(body, j.size());
+                for (auto const& element : j) {
+                    writeValue(element);
+                }
+                break;
+            case nlohmann::json::value_t::object:
+                writeTag(binary::Object);
+                appendVarint(body, j.size());
+                for (auto const& item : j.items()) {
+                    writeString(item.key());
+                    writeValue(item.value());
+                }
+                break;
+            default:
+                STORM_LOG_THROW(false, storm::exceptions::NotSupportedException, "Json value of type " << j.type_name() << " can not be encoded.");
+        }
+    }
+
+    std::string body;
+    std::vector<std::string> strings;
+    std::unordered_map<std::string, uint64_t> stringIndices;
+};
+
+template<typename ValueType>
+class JsonBinaryReader {
+   public:
+    JsonBinaryReader(char const* data, char const* dataEnd) : current(data), end(dataEnd) {
+        // Intentionally left empty.
+    }
+
+    storm::json<ValueType> decode() {
+        STORM_LOG_THROW(isJsonBinary(current, end), storm::exceptions::WrongFormatException, "Data is not in the binary json encoding.");
+        current += 8;
+        STORM_LOG_THROW(readRaw<uint64_t>() == binary::byteOrderMark, storm::exceptions::NotSupportedException,
+                        "Binary json data was written with a different byte order.");
+        uint64_t fileVersion = readRaw<uint64_t>();
+        STORM_LOG_THROW(fileVersion == binary::version, storm::exceptions::NotSupportedException,
+                        "Version " << fileVersion << " of the binary json encoding is not supported.");
+        uint64_t numberOfStrings = readVarint();
+        strings.reserve(numberOfStrings);
+        for (uint64_t i = 0; i < numberOfStrings; ++i) {
+            uint64_t size = readVarint();
+            ensureAvailable(size);
+            strings.emplace_back(current, size);
+            current += size;
+        }
+        storm::json<ValueType> result = readValue();
+        STORM_LOG_THROW(current == end, storm::exceptions::WrongFormatException, "Unexpected data at the end of binary json data.");
+        return result;
+    }
+
+   private:
+    void ensureAvailable(uint64_t size) const {
+        STORM_LOG_THROW(static_cast<uint64_t>(end - current) >= size, storm::exceptions::WrongFormatException, "Unexpected end of binary json data.");
+    }
+
+    template<typename T>
+    T readRaw() {
+        ensureAvailable(sizeof(T));
+        T value;
+        std::memcpy(&value, current, sizeof(T));
+        current += sizeof(T);
+        return value;
+    }
+
+    uint64_t readVarint() {
+        uint64_t result = 0;
+        for (uint64_t shift = 0; shift < 64; shift += 7) {
+            ensureAvailable(1);
+            uint8_t byte = static_cast<uint8_t>(*current++);
+            result |= static_cast<uint64_t>(byte & 0x7f) << shift;
+            if ((byte & 0x80) == 0) {
+                return result;
+            }
+        }
+        STORM_LOG_THROW(false, storm::exceptions::WrongFormatException, "Invalid number in binary json data.");
+    }
+
+    std::string const& readString() {
+        uint64_t index = readVarint();
+        STORM_LOG_THROW(index < strings.size(), storm::exceptions::WrongFormatException, "Invalid string index in binary json data.");
+        return strings[index];
+    }
+
+    storm::json<ValueType> readValue() {
+        switch (readRaw<uint8_t>()) {
+            case binary::Null:
+                return storm::json<ValueType>();
+            case binary::False:
+                return storm::json<ValueType>(false);
+            case binary::True:
+                return storm::json<ValueType>(true);
+            case binary::Unsigned:
+                return storm::json<ValueType>(readVarint());
+            case binary::Integer: {
+                uint64_t zigZag = readVarint();
+                return storm::json<ValueType>(static_cast<int64_t>((zigZag >> 1) ^ (~(zigZag & 1) + 1)));
+            }
+            case binary::Double:
+                if constexpr (std::is_same_v<ValueType, double>) {
+                    return storm::json<ValueType>(readRaw<double>());
+                } else {
+                    return storm::json<ValueType>(storm::utility::convertNumber<ValueType>(readRaw<double>()));
+                }
+            case binary::Rational: {
+                storm::RationalNumber value = storm::utility::convertNumber<storm::RationalNumber>(readString());
+                if constexpr (std::is_same_v<ValueType, storm::RationalNumber>) {
+                    return storm::json<ValueType>(std::move(value));
+                } else {
+                    return storm::json<ValueType>(storm::utility::convertNumber<ValueType>(value));
+                }
+            }
+            case binary::String:
+                return storm::json<ValueType>(readString());
+            case binary::Array: {
+                uint64_t size = readVarint();
+                storm::json<ValueType> result = storm::json<ValueType>::array();
+                auto& elements = result.template get_ref<typename storm::json<ValueType>::array_t&>();
+                elements.reserve(size);
+                for (uint64_t i = 0; i < size; ++i) {
+                    elements.push_back(readValue());
+                }
+                return result;
+            }
+            case binary::Object: {
+                uint64_t size = readVarint();
+                storm::json<ValueType> result = storm::json<ValueType>::object();
+                auto& items = result.template get_ref<typename storm::json<ValueType>::object_t&>();
+                for (uint64_t i = 0; i < size; ++i) {
+                    std::string const& key = readString();
+                    // Keys were written in sorted order, so inserting at the end is amortized constant.
+                    items.emplace_hint(items.end(), key, readValue());
+                }
+                return result;
+            }
+            default:
+                STORM_LOG_THROW(false, storm::exceptions::WrongFormatException, "Invalid tag in binary json data.");
+        }
+    }
+
+    char const* current;
+    char const* end;
+    std::vector<std::string> strings;
+};
+}  // namespace
+
+template<typename ValueType>
+std::string encodeJsonBinary(storm::json<ValueType> const& j) {
+    return JsonBinaryWriter<ValueType>().encode(j);
+}
+
+template<typename ValueType>
+void exportJsonBinary(storm::json<ValueType> const& j, std::string const& filename) {
+    std::string encoded = encodeJsonBinary(j);
+    std::ofstream stream;
+    storm::utility::openFile(filename, stream);
+    stream.write(encoded.data(), encoded.size());
+    storm::utility::closeFile(stream);
+}
+
+template<typename ValueType>
+storm::json<ValueType> decodeJsonBinary(char const* data, char const* dataEnd) {
+    return JsonBinaryReader<ValueType>(data, dataEnd).decode();
+}
+
+bool isJsonBinary(char const* data, char const* dataEnd) {
+    return dataEnd - data >= 8 && std::equal(data, data + 8, jsonbinaryencoding::magic);
+}
+
+template std::string encodeJsonBinary(storm::json<double> const& j);
+template std::string encodeJsonBinary(storm::json<storm::RationalNumber> const& j);
+template void exportJsonBinary(storm::json<double> const& j, std::string const& filename);
+template void exportJsonBinary(storm::json<storm::RationalNumber> const& j, std::string const& filename);
+template storm::json<double> decodeJsonBinary(char const* data, char const* dataEnd);
+template storm::json<storm::RationalNumber> decodeJsonBinary(char const* data, char const* dataEnd);
+
+}  // namespace exporter
+}  // namespace storm
@@ -0,0 +1,77 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+
+#include "storm/adapters/JsonForward.h"
+
+namespace storm {
+namespace exporter {
+namespace jsonbinaryencoding {
+
+/*
+ * Layout of the binary encoding of json documents (used e.g. to store preprocessed JANI models).
+ * All numbers are stored in the byte order of the exporting machine.
+ *
+ * Header                   (magic bytes, uint64 byte order mark, uint64 version)
+ * String table             (number of strings as varint, then for each string: length as varint followed by its characters)
+ * Root value
+ *
+ * A value starts with a single byte tag (see enum Tag) followed by
+ * - nothing                for Null, False and True,
+ * - a varint               for Unsigned, Integer (zig-zag encoded) and String (index in the string table),
+ * - 8 bytes                for Double,
+ * - a string table index   for Rational (the exact representation of the number),
+ * - a varint size          followed by the elements for Array and by pairs of key (string table index) and value for Object.
+ *
+ * Every string (keys as well as values) is stored only once, which makes documents with recurring keys (like "op", "left", "right") compact.
+ */
+
+// Magic bytes at the beginning of each file
+constexpr char magic[8] = {'S', 'T', 'O', 'R', 'M', 'J', 'S', 'B'};
+
+// Current version of the format
+constexpr uint64_t version = 1;
+
+// Known value to detect files with a different byte order
+constexpr uint64_t byteOrderMark = 0x0102030405060708ull;
+
+enum Tag : uint8_t { Null = 0, False = 1, True = 2, Unsigned = 3, Integer = 4, Double = 5, Rational = 6, String = 7, Array = 8, Object = 9 };
+
+}  // namespace jsonbinaryencoding
+
+/*!
+ * Encodes the given json document in the binary encoding.
+ *
+ * @param j The json document.
+ * @return The encoded document.
+ */
+template<typename ValueType>
+std::string encodeJsonBinary(storm::json<ValueType> const& j);
+
+/*!
+ * Writes the given json document in the binary encoding to the given file.
+ *
+ * @param j The json document.
+ * @param filename The file.
+ */
+template<typename ValueType>
+void exportJsonBinary(storm::json<ValueType> const& j, std::string const& filename);
+
+/*!
+ * Decodes a json document in the binary encoding. Numbers are converted to the given ValueType.
+ *
+ * @param data The beginning of the encoded document.
+ * @param dataEnd The end of the encoded document.
+ * @return The json document.
+ */
+template<typename ValueType>
+storm::json<ValueType> decodeJsonBinary(char const* data, char const* dataEnd);
+
+/*!
+ * Checks whether the given data starts with the magic bytes of the binary json encoding.
+ */
+bool isJsonBinary(char const* data, char const* dataEnd);
+
+}  // namespace exporter
+}  // namespace storm
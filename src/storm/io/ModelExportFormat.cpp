@@ -13,6 +13,8 @@ ModelExportFormat getModelExportFormatFromString(std::string const& input) {
         return ModelExportFormat::Drdd;
     } else if (input == "drn") {
         return ModelExportFormat::Drn;
+    } else if (input == "drnb") {
+        return ModelExportFormat::Drnb;
     } else if (input == "json") {
         return ModelExportFormat::Json;
     }
@@ -27,6 +29,8 @@ std::string toString(ModelExportFormat const& input) {
             return "drdd";
         case ModelExportFormat::Drn:
             return "drn";
+        case ModelExportFormat::Drnb:
+            return "drnb";
         case ModelExportFormat::Json:
             return "json";
     }
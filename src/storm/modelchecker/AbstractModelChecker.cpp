@@ -9,10 +9,12 @@
 #include "storm/exceptions/InvalidArgumentException.h"
 #include "storm/exceptions/InvalidOperationException.h"
 #include "storm/exceptions/NotImplementedException.h"
+#include "storm/utility/SignalHandler.h"
 #include "storm/utility/constants.h"
 #include "storm/utility/macros.h"
 
 #include "storm/environment/Environment.h"
+#include "storm/environment/modelchecker/ModelCheckerEnvironment.h"
 #include "storm/environment/modelchecker/MultiObjectiveModelCheckerEnvironment.h"
 
 #include "storm/logic/FormulaInformation.h"
@@ -56,7 +58,21 @@ std::unique_ptr<CheckResult> AbstractModelChecker<ModelType>::check(Environment
     STORM_LOG_THROW(this->canHandle(checkTask), storm::exceptions::InvalidArgumentException,
                     "The model checker (" << getClassName() << ") is not able to check the formula '" << formula << "'.");
     if (formula.isStateFormula()) {
-        return this->checkStateFormula(env, checkTask.substituteFormula(formula.asStateFormula()));
+        std::optional<storm::utility::resources::ThreadTimeLimit> timeLimit;
+        if (env.modelchecker().isDeadlineSet()) {
+            timeLimit.emplace(env.modelchecker().getDeadline());
+        }
+        storm::utility::resources::ApproximationTracker approximationTracker;
+        std::unique_ptr<CheckResult> result = this->checkStateFormula(env, checkTask.substituteFormula(formula.asStateFormula()));
+        if (approximationTracker.isApproximate()) {
+            // Some computation was stopped early, so we can only provide an approximation.
+            if (result->isExplicitQuantitativeCheckResult()) {
+                result->template asExplicitQuantitativeCheckResult<SolutionType>().setApproximate(approximationTracker.getErrorBound());
+            } else {
+                STORM_LOG_WARN("The computation for formula '" << formula << "' was aborted. The result may be incorrect.");
+            }
+        }
+        return result;
     }
     STORM_LOG_THROW(false, storm::exceptions::InvalidArgumentException, "The given formula '" << formula << "' is invalid.");
 }
@@ -1,6 +1,7 @@
 #include "storm/modelchecker/csl/helper/HybridCtmcCslHelper.h"
 
 #include "storm/modelchecker/csl/helper/SparseCtmcCslHelper.h"
+#include "storm/modelchecker/csl/helper/SymbolicCtmcCslHelper.h"
 #include "storm/modelchecker/prctl/helper/HybridDtmcPrctlHelper.h"
 
 #include "storm/environment/solver/TimeBoundedSolverEnvironment.h"
@@ -91,6 +92,14 @@ std::unique_ptr<CheckResult> HybridCtmcCslHelper::computeBoundedUntilProbabiliti
             std::move(odd), std::move(result)));
     }
 
+    if (env.solver().timeBounded().getCtmcMethod() == storm::solver::CtmcTransientMethod::SymbolicUniformization &&
+        upperBound != storm::utility::infinity<ValueType>()) {
+        // Keep the uniformized matrix and the transient probabilities symbolic.
+        return std::unique_ptr<CheckResult>(new SymbolicQuantitativeCheckResult<DdType, ValueType>(
+            model.getReachableStates(),
+            SymbolicCtmcCslHelper::computeBoundedUntilProbabilities(env, model, rateMatrix, exitRateVector, phiStates, psiStates, lowerBound, upperBound)));
+    }
+
     // Set the possible (absolute) error allowed for truncation (epsilon for fox-glynn)
     ValueType epsilon = storm::utility::convertNumber<ValueType>(env.solver().timeBounded().getPrecision()) / 8.0;
 
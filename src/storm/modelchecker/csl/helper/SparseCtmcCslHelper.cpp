@@ -22,6 +22,7 @@
 #include "storm/utility/vector.h"
 
 #include "storm/exceptions/FormatUnsupportedBySolverException.h"
+#include "storm/exceptions/InvalidArgumentException.h"
 #include "storm/exceptions/InvalidOperationException.h"
 #include "storm/exceptions/InvalidPropertyException.h"
 #include "storm/exceptions/InvalidStateException.h"
@@ -98,6 +99,7 @@ std::vector<ValueType> SparseCtmcCslHelper::computeBoundedUntilProbabilities(
     STORM_LOG_INFO("Found " << statesWithProbabilityGreater0NonPsi.getNumberOfSetBits() << " 'maybe' states.");
 
     // the positions within the result for which the precision needs to be checked
+    bool onlyRelevantValuesNeeded = goal.hasRelevantValues();
     storm::storage::BitVector relevantValues;
     if (goal.hasRelevantValues()) {
         relevantValues = std::move(goal.relevantValues());
@@ -106,6 +108,12 @@ std::vector<ValueType> SparseCtmcCslHelper::computeBoundedUntilProbabilities(
         relevantValues = statesWithProbabilityGreater0;
     }
 
+    // Adaptive uniformization proceeds forward in time, so it requires one computation per relevant state.
+    bool useAdaptiveUniformization = env.solver().timeBounded().getCtmcMethod() == storm::solver::CtmcTransientMethod::AdaptiveUniformization;
+    STORM_LOG_INFO_COND(!useAdaptiveUniformization || onlyRelevantValuesNeeded,
+                        "Adaptive uniformization requires the relevant states to be known. Falling back to standard uniformization.");
+    useAdaptiveUniformization &= onlyRelevantValuesNeeded;
+
     do {  // Iterate until the desired precision is reached (only relevant for relative precision criterion)
         if (!statesWithProbabilityGreater0.empty()) {
             if (storm::utility::isZero(upperBound)) {
@@ -119,7 +127,33 @@ std::vector<ValueType> SparseCtmcCslHelper::computeBoundedUntilProbabilities(
 
                     result = std::vector<ValueType>(numberOfStates, storm::utility::zero<ValueType>());
                     storm::utility::vector::setVectorValues<ValueType>(result, psiStates, storm::utility::one<ValueType>());
-                    if (!statesWithProbabilityGreater0NonPsi.empty()) {
+                    if (!statesWithProbabilityGreater0NonPsi.empty() && useAdaptiveUniformization) {
+                        // Restrict the model to the 'maybe' and psi states and make the psi states absorbing. The probability mass
+                        // leaving to other states is lost, as these states cannot reach psi states.
+                        storm::storage::BitVector consideredStates = statesWithProbabilityGreater0NonPsi | psiStates;
+                        storm::storage::SparseMatrix<ValueType> submatrix = rateMatrix.getSubmatrix(false, consideredStates, consideredStates);
+                        std::vector<ValueType> subExitRates(consideredStates.getNumberOfSetBits());
+                        storm::utility::vector::selectVectorValues(subExitRates, consideredStates, exitRates);
+                        storm::storage::BitVector subPsiStates = psiStates % consideredStates;
+                        for (auto state : subPsiStates) {
+                            for (auto& entry : submatrix.getRow(state)) {
+                                entry.setValue(storm::utility::zero<ValueType>());
+                            }
+                            subExitRates[state] = storm::utility::zero<ValueType>();
+                        }
+
+                        for (auto state : relevantValues & statesWithProbabilityGreater0NonPsi) {
+                            std::vector<ValueType> initialDistribution(subExitRates.size(), storm::utility::zero<ValueType>());
+                            initialDistribution[consideredStates.getNumberOfSetBitsBeforeIndex(state)] = storm::utility::one<ValueType>();
+                            std::vector<ValueType> distribution =
+                                computeTransientDistributionAdaptively(env, submatrix, subExitRates, storm::utility::convertNumber<ValueType>(upperBound),
+                                                                       initialDistribution, epsilon);
+                            result[state] = storm::utility::zero<ValueType>();
+                            for (auto psiState : subPsiStates) {
+                                result[state] += distribution[psiState];
+                            }
+                        }
+                    } else if (!statesWithProbabilityGreater0NonPsi.empty()) {
                         // Find the maximal rate of all 'maybe' states to take it as the uniformization rate.
                         ValueType uniformizationRate = 0;
                         for (auto state : statesWithProbabilityGreater0NonPsi) {
@@ -274,6 +308,88 @@ std::vector<ValueType> SparseCtmcCslHelper::computeBoundedUntilProbabilities(Env
     STORM_LOG_THROW(false, storm::exceptions::InvalidOperationException, "Computing bounded until probabilities is unsupported for this value type.");
 }
 
+template<typename ValueType, typename std::enable_if<storm::NumberTraits<ValueType>::SupportsExponential, int>::type>
+std::vector<std::vector<ValueType>> SparseCtmcCslHelper::computeBoundedUntilProbabilities(
+    Environment const& env, storm::solver::SolveGoal<ValueType>&& goal, storm::storage::SparseMatrix<ValueType> const& rateMatrix,
+    storm::storage::SparseMatrix<ValueType> const& backwardTransitions, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates,
+    std::vector<ValueType> const& exitRates, bool, std::vector<double> const& upperBounds) {
+    STORM_LOG_THROW(!env.solver().isForceExact(), storm::exceptions::InvalidOperationException,
+                    "Exact computations not possible for bounded until probabilities.");
+    STORM_LOG_THROW(std::is_sorted(upperBounds.begin(), upperBounds.end()), storm::exceptions::InvalidArgumentException,
+                    "The time bounds must be given in ascending order.");
+    STORM_LOG_THROW(upperBounds.empty() || (upperBounds.front() >= 0.0 && upperBounds.back() < storm::utility::infinity<double>()),
+                    storm::exceptions::InvalidArgumentException, "The time bounds must be non-negative and finite.");
+
+    uint_fast64_t numberOfStates = rateMatrix.getRowCount();
+
+    // Initially, every result assigns one to the psi states and zero to all other states.
+    std::vector<ValueType> psiIndicator(numberOfStates, storm::utility::zero<ValueType>());
+    storm::utility::vector::setVectorValues<ValueType>(psiIndicator, psiStates, storm::utility::one<ValueType>());
+    std::vector<std::vector<ValueType>> result(upperBounds.size(), psiIndicator);
+
+    // Set the possible (absolute) error allowed for truncation (epsilon for fox-glynn)
+    ValueType epsilon = storm::utility::convertNumber<ValueType>(env.solver().timeBounded().getPrecision()) / 8.0;
+
+    // If we identify the states that have probability 0 of reaching the target states, we can exclude them from the
+    // further computations.
+    storm::storage::BitVector statesWithProbabilityGreater0 = storm::utility::graph::performProbGreater0(backwardTransitions, phiStates, psiStates);
+    storm::storage::BitVector statesWithProbabilityGreater0NonPsi = statesWithProbabilityGreater0 & ~psiStates;
+    STORM_LOG_INFO("Found " << statesWithProbabilityGreater0NonPsi.getNumberOfSetBits() << " 'maybe' states.");
+    if (upperBounds.empty() || statesWithProbabilityGreater0NonPsi.empty()) {
+        return result;
+    }
+
+    // the positions within the result for which the precision needs to be checked
+    storm::storage::BitVector relevantValues;
+    if (goal.hasRelevantValues()) {
+        relevantValues = std::move(goal.relevantValues());
+        relevantValues &= statesWithProbabilityGreater0;
+    } else {
+        relevantValues = statesWithProbabilityGreater0;
+    }
+
+    // Find the maximal rate of all 'maybe' states to take it as the uniformization rate.
+    ValueType uniformizationRate = 0;
+    for (auto state : statesWithProbabilityGreater0NonPsi) {
+        uniformizationRate = std::max(uniformizationRate, exitRates[state]);
+    }
+    uniformizationRate *= 1.02;
+    STORM_LOG_THROW(uniformizationRate > 0, storm::exceptions::InvalidStateException, "The uniformization rate must be positive.");
+
+    // Compute the uniformized matrix.
+    storm::storage::SparseMatrix<ValueType> uniformizedMatrix =
+        computeUniformizedMatrix(rateMatrix, statesWithProbabilityGreater0NonPsi, uniformizationRate, exitRates);
+
+    // Compute the vector that is to be added as a compensation for removing the absorbing states.
+    std::vector<ValueType> b = rateMatrix.getConstrainedRowSumVector(statesWithProbabilityGreater0NonPsi, psiStates);
+    for (auto& element : b) {
+        element /= uniformizationRate;
+    }
+
+    std::vector<ValueType> timeBounds;
+    timeBounds.reserve(upperBounds.size());
+    for (auto const& bound : upperBounds) {
+        timeBounds.push_back(storm::utility::convertNumber<ValueType>(bound));
+    }
+    std::vector<ValueType> values(statesWithProbabilityGreater0NonPsi.getNumberOfSetBits(), storm::utility::zero<ValueType>());
+
+    bool repeat;
+    do {  // Iterate until the desired precision is reached (only relevant for relative precision criterion)
+        std::vector<std::vector<ValueType>> subresults =
+            computeTransientProbabilities(env, uniformizedMatrix, &b, timeBounds, uniformizationRate, values, epsilon);
+        for (uint64_t boundIndex = 0; boundIndex < upperBounds.size(); ++boundIndex) {
+            storm::utility::vector::setVectorValues(result[boundIndex], statesWithProbabilityGreater0NonPsi, subresults[boundIndex]);
+        }
+
+        // The epsilon has to be sufficient for all time bounds, so we check all results with the same (possibly decreasing) epsilon.
+        repeat = false;
+        for (auto const& resultForBound : result) {
+            repeat |= checkAndUpdateTransientProbabilityEpsilon(env, epsilon, resultForBound, relevantValues);
+        }
+    } while (repeat);
+    return result;
+}
+
 template<typename ValueType>
 std::vector<ValueType> SparseCtmcCslHelper::computeUntilProbabilities(Environment const& env, storm::solver::SolveGoal<ValueType>&& goal,
                                                                       storm::storage::SparseMatrix<ValueType> const& rateMatrix,
@@ -605,8 +721,20 @@ std::vector<ValueType> SparseCtmcCslHelper::computeAllTransientProbabilities(Env
             ++i;
         }
         // Finally compute the transient probabilities.
-        std::vector<ValueType> subresult =
-            computeTransientProbabilities<ValueType>(env, uniformizedMatrix, nullptr, timeBound, uniformizationRate, values, epsilon);
+        std::vector<ValueType> subresult;
+        if (env.solver().timeBounded().getCtmcMethod() == storm::solver::CtmcTransientMethod::AdaptiveUniformization) {
+            storm::storage::SparseMatrix<ValueType> absorbingMatrix(rateMatrix);
+            for (auto state : psiStates) {
+                for (auto& entry : absorbingMatrix.getRow(state)) {
+                    entry.setValue(storm::utility::zero<ValueType>());
+                }
+                newRates[state] = storm::utility::zero<ValueType>();
+            }
+            subresult = computeTransientDistributionAdaptively(env, absorbingMatrix, newRates, storm::utility::convertNumber<ValueType>(timeBound), values,
+                                                               epsilon);
+        } else {
+            subresult = computeTransientProbabilities<ValueType>(env, uniformizedMatrix, nullptr, timeBound, uniformizationRate, values, epsilon);
+        }
 
         storm::utility::vector::setVectorValues(result, relevantStates, subresult);
     }
@@ -736,6 +864,197 @@ std::vector<ValueType> SparseCtmcCslHelper::computeTransientProbabilities(Enviro
     return result;
 }
 
+template<typename ValueType, typename std::enable_if<storm::NumberTraits<ValueType>::SupportsExponential, int>::type>
+std::vector<std::vector<ValueType>> SparseCtmcCslHelper::computeTransientProbabilities(Environment const& env,
+                                                                                       storm::storage::SparseMatrix<ValueType> const& uniformizedMatrix,
+                                                                                       std::vector<ValueType> const* addVector,
+                                                                                       std::vector<ValueType> const& timeBounds, ValueType uniformizationRate,
+                                                                                       std::vector<ValueType> values, ValueType epsilon) {
+    STORM_LOG_WARN_COND(epsilon > storm::utility::convertNumber<ValueType>(1e-20),
+                        "Very low truncation error " << epsilon << " requested. Numerical inaccuracies are possible.");
+    STORM_LOG_THROW(std::is_sorted(timeBounds.begin(), timeBounds.end()), storm::exceptions::InvalidArgumentException,
+                    "The time bounds must be given in ascending order.");
+
+    // Use Fox-Glynn to get the truncation points and the weights of each time bound. If no time can pass for some
+    // bound, the initial values are the result for it, which we express with a single weight at step zero.
+    std::vector<storm::utility::numerical::FoxGlynnResult<ValueType>> foxGlynnResults;
+    foxGlynnResults.reserve(timeBounds.size());
+    uint64_t maximalRight = 0;
+    for (auto const& timeBound : timeBounds) {
+        ValueType lambda = timeBound * uniformizationRate;
+        if (storm::utility::isZero(lambda)) {
+            storm::utility::numerical::FoxGlynnResult<ValueType> trivialResult;
+            trivialResult.left = 0;
+            trivialResult.right = 0;
+            trivialResult.weights = {storm::utility::one<ValueType>()};
+            trivialResult.totalWeight = storm::utility::one<ValueType>();
+            foxGlynnResults.push_back(std::move(trivialResult));
+        } else {
+            foxGlynnResults.push_back(storm::utility::numerical::foxGlynn(lambda, epsilon));
+            STORM_LOG_DEBUG("Fox-Glynn cutoff points for time bound " << timeBound << ": left=" << foxGlynnResults.back().left
+                                                                        << ", right=" << foxGlynnResults.back().right);
+        }
+        maximalRight = std::max<uint64_t>(maximalRight, foxGlynnResults.back().right);
+    }
+
+    STORM_LOG_DEBUG("Starting " << maximalRight << " iterations for " << timeBounds.size() << " time bounds with " << uniformizedMatrix.getRowCount() << " x "
+                                << uniformizedMatrix.getColumnCount() << " matrix.");
+
+    // Initialize the results and take care of (the weights of) step zero.
+    std::vector<std::vector<ValueType>> result(timeBounds.size(), std::vector<ValueType>(values.size(), storm::utility::zero<ValueType>()));
+    ValueType weight = 0;
+    std::function<ValueType(ValueType const&, ValueType const&)> addAndScale = [&weight](ValueType const& a, ValueType const& b) { return a + weight * b; };
+    for (uint64_t boundIndex = 0; boundIndex < timeBounds.size(); ++boundIndex) {
+        if (foxGlynnResults[boundIndex].left == 0) {
+            weight = foxGlynnResults[boundIndex].weights.front();
+            storm::utility::vector::applyPointwise(result[boundIndex], values, result[boundIndex], addAndScale);
+        }
+    }
+
+    // Perform the matrix-vector multiplications once and add the scaled vector to every result whose truncation
+    // window contains the current step.
+    auto multiplier = storm::solver::MultiplierFactory<ValueType>().create(env, uniformizedMatrix);
+    for (uint64_t index = 1; index <= maximalRight; ++index) {
+        multiplier->multiply(env, values, addVector, values);
+
+        for (uint64_t boundIndex = 0; boundIndex < timeBounds.size(); ++boundIndex) {
+            auto const& foxGlynnResult = foxGlynnResults[boundIndex];
+            if (foxGlynnResult.left <= index && index <= foxGlynnResult.right) {
+                weight = foxGlynnResult.weights[index - foxGlynnResult.left];
+                storm::utility::vector::applyPointwise(result[boundIndex], values, result[boundIndex], addAndScale);
+            }
+        }
+    }
+
+    // Finally, divide the results by their total weights.
+    for (uint64_t boundIndex = 0; boundIndex < timeBounds.size(); ++boundIndex) {
+        storm::utility::vector::scaleVectorInPlace<ValueType, ValueType>(result[boundIndex],
+                                                                         storm::utility::one<ValueType>() / foxGlynnResults[boundIndex].totalWeight);
+    }
+    return result;
+}
+
+template<typename ValueType>
+std::vector<ValueType> SparseCtmcCslHelper::computeBirthProcessDistribution(std::vector<ValueType> const& rates, ValueType timeBound, ValueType epsilon) {
+    uint64_t numberOfRates = rates.size();
+    std::vector<ValueType> result(numberOfRates + 1, storm::utility::zero<ValueType>());
+    ValueType uniformizationRate = storm::utility::zero<ValueType>();
+    for (auto const& rate : rates) {
+        uniformizationRate = std::max(uniformizationRate, rate);
+    }
+    ValueType lambda = timeBound * uniformizationRate;
+    if (storm::utility::isZero(lambda)) {
+        result.front() = storm::utility::one<ValueType>();
+        return result;
+    }
+
+    // Uniformize the birth process. As the process is a chain, the k-th step can only reach the first k+1 states.
+    storm::utility::numerical::FoxGlynnResult<ValueType> foxGlynnResult = storm::utility::numerical::foxGlynn(lambda, epsilon);
+    std::vector<ValueType> values(numberOfRates + 1, storm::utility::zero<ValueType>());
+    values.front() = storm::utility::one<ValueType>();
+    if (foxGlynnResult.left == 0) {
+        result.front() = foxGlynnResult.weights.front();
+    }
+    for (uint64_t step = 1; step <= foxGlynnResult.right; ++step) {
+        for (uint64_t state = std::min(step, numberOfRates); state > 0; --state) {
+            ValueType incoming = values[state - 1] * rates[state - 1] / uniformizationRate;
+            if (state == numberOfRates) {
+                values[state] += incoming;
+            } else {
+                values[state] = values[state] * (storm::utility::one<ValueType>() - rates[state] / uniformizationRate) + incoming;
+            }
+        }
+        values.front() *= storm::utility::one<ValueType>() - rates.front() / uniformizationRate;
+
+        if (step >= foxGlynnResult.left) {
+            ValueType const& weight = foxGlynnResult.weights[step - foxGlynnResult.left];
+            for (uint64_t state = 0, end = std::min(step, numberOfRates); state <= end; ++state) {
+                result[state] += weight * values[state];
+            }
+        }
+    }
+    storm::utility::vector::scaleVectorInPlace<ValueType, ValueType>(result, storm::utility::one<ValueType>() / foxGlynnResult.totalWeight);
+    return result;
+}
+
+template<typename ValueType, typename std::enable_if<storm::NumberTraits<ValueType>::SupportsExponential, int>::type>
+std::vector<ValueType> SparseCtmcCslHelper::computeTransientDistributionAdaptively(Environment const& env,
+                                                                                   storm::storage::SparseMatrix<ValueType> const& rateMatrix,
+                                                                                   std::vector<ValueType> const& exitRates, ValueType timeBound,
+                                                                                   std::vector<ValueType> const& initialDistribution, ValueType epsilon) {
+    ValueType maximalExitRate = storm::utility::zero<ValueType>();
+    for (auto const& rate : exitRates) {
+        maximalExitRate = std::max(maximalExitRate, rate);
+    }
+    if (storm::utility::isZero(timeBound * maximalExitRate)) {
+        return initialDistribution;
+    }
+
+    // The number of steps standard uniformization would need. If the adaptive scheme exceeds this number, we fall back to the former.
+    uint64_t uniformizationSteps = storm::utility::numerical::foxGlynn(timeBound * maximalExitRate * 1.02, epsilon).right;
+
+    // We multiply with the transposed matrix, as we compute the distribution forward in time.
+    storm::storage::SparseMatrix<ValueType> transposedMatrix = rateMatrix.transpose();
+    std::vector<ValueType> current = initialDistribution;
+    std::vector<ValueType> successor(current.size());
+    auto performStep = [&](ValueType const& rate) {
+        transposedMatrix.multiplyWithVector(current, successor);
+        for (uint64_t state = 0; state < current.size(); ++state) {
+            current[state] += (successor[state] - exitRates[state] * current[state]) / rate;
+        }
+    };
+
+    // The error is composed of the truncation error of the birth process (at most twice its Fox-Glynn error) and the
+    // probability of taking more jumps than we consider.
+    ValueType birthProcessEpsilon = epsilon / 4;
+    ValueType jumpTruncationBound = epsilon / 2;
+
+    // In a first pass, determine the adaptive rates until the probability of taking more jumps becomes negligible.
+    std::vector<ValueType> rates;
+    std::vector<ValueType> jumpDistribution;
+    uint64_t nextCheck = 16;
+    while (true) {
+        ValueType rate = storm::utility::zero<ValueType>();
+        for (uint64_t state = 0; state < current.size(); ++state) {
+            if (!storm::utility::isZero(current[state])) {
+                rate = std::max(rate, exitRates[state]);
+            }
+        }
+        rates.push_back(rate);
+
+        if (storm::utility::isZero(rate) || rates.size() == nextCheck) {
+            jumpDistribution = computeBirthProcessDistribution(rates, timeBound, birthProcessEpsilon);
+            if (storm::utility::isZero(rate) || jumpDistribution.back() <= jumpTruncationBound) {
+                break;
+            }
+            nextCheck *= 2;
+        }
+        if (rates.size() > uniformizationSteps) {
+            STORM_LOG_INFO("Adaptive uniformization needs more steps than standard uniformization. Falling back to the latter.");
+            ValueType uniformizationRate = maximalExitRate * 1.02;
+            storm::storage::SparseMatrix<ValueType> uniformizedMatrix =
+                computeUniformizedMatrix(transposedMatrix, storm::storage::BitVector(exitRates.size(), true), uniformizationRate, exitRates);
+            return computeTransientProbabilities<ValueType>(env, uniformizedMatrix, nullptr, timeBound, uniformizationRate, initialDistribution, epsilon);
+        }
+        performStep(rate);
+    }
+    STORM_LOG_DEBUG("Adaptive uniformization uses " << rates.size() << " jumps (standard uniformization: " << uniformizationSteps << ").");
+
+    // In a second pass, combine the distributions after each number of jumps with the probabilities of taking that many jumps.
+    current = initialDistribution;
+    std::vector<ValueType> result(current.size(), storm::utility::zero<ValueType>());
+    for (uint64_t jumps = 0; jumps < rates.size(); ++jumps) {
+        if (jumps > 0) {
+            performStep(rates[jumps - 1]);
+        }
+        ValueType const& weight = jumpDistribution[jumps];
+        for (uint64_t state = 0; state < current.size(); ++state) {
+            result[state] += weight * current[state];
+        }
+    }
+    return result;
+}
+
 template<typename ValueType>
 storm::storage::SparseMatrix<ValueType> SparseCtmcCslHelper::computeProbabilityMatrix(storm::storage::SparseMatrix<ValueType> const& rateMatrix,
                                                                                       std::vector<ValueType> const& exitRates) {
@@ -833,6 +1152,22 @@ template std::vector<double> SparseCtmcCslHelper::computeTransientProbabilities(
                                                                                 std::vector<double> const* addVector, double timeBound,
                                                                                 double uniformizationRate, std::vector<double> values, double epsilon);
 
+template std::vector<std::vector<double>> SparseCtmcCslHelper::computeBoundedUntilProbabilities(
+    Environment const& env, storm::solver::SolveGoal<double>&& goal, storm::storage::SparseMatrix<double> const& rateMatrix,
+    storm::storage::SparseMatrix<double> const& backwardTransitions, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates,
+    std::vector<double> const& exitRates, bool qualitative, std::vector<double> const& upperBounds);
+
+template std::vector<std::vector<double>> SparseCtmcCslHelper::computeTransientProbabilities(Environment const& env,
+                                                                                             storm::storage::SparseMatrix<double> const& uniformizedMatrix,
+                                                                                             std::vector<double> const* addVector,
+                                                                                             std::vector<double> const& timeBounds, double uniformizationRate,
+                                                                                             std::vector<double> values, double epsilon);
+
+template std::vector<double> SparseCtmcCslHelper::computeTransientDistributionAdaptively(Environment const& env,
+                                                                                         storm::storage::SparseMatrix<double> const& rateMatrix,
+                                                                                         std::vector<double> const& exitRates, double timeBound,
+                                                                                         std::vector<double> const& initialDistribution, double epsilon);
+
 #ifdef STORM_HAVE_CARL
 template std::vector<storm::RationalNumber> SparseCtmcCslHelper::computeBoundedUntilProbabilities(
     Environment const& env, storm::solver::SolveGoal<storm::RationalNumber>&& goal, storm::storage::SparseMatrix<storm::RationalNumber> const& rateMatrix,
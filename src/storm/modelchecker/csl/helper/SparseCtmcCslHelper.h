@@ -38,6 +38,21 @@ class SparseCtmcCslHelper {
                                                                    std::vector<ValueType> const& exitRates, bool qualitative, double lowerBound,
                                                                    double upperBound);
 
+    /*!
+     * Computes the probabilities of satisfying phi U[0,t] psi for each of the given (sorted) upper time bounds t. All
+     * time bounds share a single sequence of matrix-vector multiplications, so the cost is roughly that of the largest one.
+     *
+     * @return For each time bound, the vector of probabilities.
+     */
+    template<typename ValueType, typename std::enable_if<storm::NumberTraits<ValueType>::SupportsExponential, int>::type = 0>
+    static std::vector<std::vector<ValueType>> computeBoundedUntilProbabilities(Environment const& env, storm::solver::SolveGoal<ValueType>&& goal,
+                                                                                storm::storage::SparseMatrix<ValueType> const& rateMatrix,
+                                                                                storm::storage::SparseMatrix<ValueType> const& backwardTransitions,
+                                                                                storm::storage::BitVector const& phiStates,
+                                                                                storm::storage::BitVector const& psiStates,
+                                                                                std::vector<ValueType> const& exitRates, bool qualitative,
+                                                                                std::vector<double> const& upperBounds);
+
     template<typename ValueType>
     static std::vector<ValueType> computeUntilProbabilities(Environment const& env, storm::solver::SolveGoal<ValueType>&& goal,
                                                             storm::storage::SparseMatrix<ValueType> const& rateMatrix,
@@ -142,6 +157,46 @@ class SparseCtmcCslHelper {
                                                                 std::vector<ValueType> const* addVector, ValueType timeBound, ValueType uniformizationRate,
                                                                 std::vector<ValueType> values, ValueType epsilon);
 
+    /*!
+     * Computes the transient probabilities for several time bounds at once. The matrix-vector multiplications are
+     * performed only once (up to the right truncation point of the largest time bound) and the resulting vectors are
+     * accumulated with the Fox-Glynn weights of every time bound whose truncation window contains the current step.
+     *
+     * @param uniformizedMatrix The uniformized transition matrix.
+     * @param addVector A vector that is added in each step as a possible compensation for removing absorbing states
+     * with a non-zero initial value. If this is not supposed to be used, it can be set to nullptr.
+     * @param timeBounds The time bounds to use (in ascending order).
+     * @param uniformizationRate The used uniformization rate.
+     * @param values A vector mapping each state to an initial probability.
+     * @param epsilon The precision used for computing the truncation points (for each time bound).
+     * @return For each time bound, the vector of transient probabilities.
+     */
+    template<typename ValueType, typename std::enable_if<storm::NumberTraits<ValueType>::SupportsExponential, int>::type = 0>
+    static std::vector<std::vector<ValueType>> computeTransientProbabilities(Environment const& env,
+                                                                             storm::storage::SparseMatrix<ValueType> const& uniformizedMatrix,
+                                                                             std::vector<ValueType> const* addVector, std::vector<ValueType> const& timeBounds,
+                                                                             ValueType uniformizationRate, std::vector<ValueType> values, ValueType epsilon);
+
+    /*!
+     * Computes the transient distribution of the given CTMC at the given time bound using adaptive uniformization.
+     * Instead of a single uniformization rate for all states, the rate used for the k-th jump is the maximal exit rate
+     * of the states that can be occupied after k jumps. The number of jumps then follows a pure birth process, whose
+     * distribution is computed numerically. Hence, stiff chains whose fast states are only reached later (or rarely)
+     * need far fewer iterations than with standard uniformization. If the adaptive scheme needs more steps than
+     * standard uniformization, the latter is used instead.
+     *
+     * @param rateMatrix The rate matrix. Rows of absorbing states may be empty.
+     * @param exitRates The exit rates of all states. Absorbing states need to have exit rate zero.
+     * @param timeBound The time bound to use.
+     * @param initialDistribution A vector mapping each state to an initial probability.
+     * @param epsilon An upper bound on the total (L1) error of the resulting distribution.
+     * @return The transient distribution at the given time bound.
+     */
+    template<typename ValueType, typename std::enable_if<storm::NumberTraits<ValueType>::SupportsExponential, int>::type = 0>
+    static std::vector<ValueType> computeTransientDistributionAdaptively(Environment const& env, storm::storage::SparseMatrix<ValueType> const& rateMatrix,
+                                                                         std::vector<ValueType> const& exitRates, ValueType timeBound,
+                                                                         std::vector<ValueType> const& initialDistribution, ValueType epsilon);
+
     /*!
      * Converts the given rate-matrix into a time-abstract probability matrix.
      *
@@ -174,6 +229,17 @@ class SparseCtmcCslHelper {
     template<typename ValueType>
     static bool checkAndUpdateTransientProbabilityEpsilon(storm::Environment const& env, ValueType& epsilon, std::vector<ValueType> const& resultVector,
                                                           storm::storage::BitVector const& relevantPositions);
+
+   private:
+    /*!
+     * Computes the distribution of a pure birth process at the given time bound, where the process starts in state 0 and
+     * leaves state k with the given k-th rate. The last entry of the result is the probability of having left the last
+     * state, i.e., of having taken more jumps than there are rates.
+     *
+     * @param epsilon The precision used for computing the truncation points.
+     */
+    template<typename ValueType>
+    static std::vector<ValueType> computeBirthProcessDistribution(std::vector<ValueType> const& rates, ValueType timeBound, ValueType epsilon);
 };
 }  // namespace helper
 }  // namespace modelchecker
@@ -1,5 +1,6 @@
 #include "storm/modelchecker/csl/helper/SparseMarkovAutomatonCslHelper.h"
 
+#include "storm/adapters/IntelTbbAdapter.h"
 #include "storm/environment/Environment.h"
 #include "storm/environment/solver/EigenSolverEnvironment.h"
 #include "storm/environment/solver/LongRunAverageSolverEnvironment.h"
@@ -129,19 +130,36 @@ class UnifPlusHelper {
         // The probabilities to go from a probabilistic state to a psi state in one step
         std::vector<std::pair<uint64_t, ValueType>> probabilisticToPsiProbabilities = getSparseOneStepProbabilities(probabilisticMaybeStates, psiStates);
 
-        // Set up a solver for the transitions between probabilistic states (if there are some)
+        // Set up the multipliers and a solver for the transitions between probabilistic states (if there are some).
+        // The upper and lower bounds are computed with separate workspaces, so that they can be computed in parallel. If this
+        // is not the case, the lower bound reuses the workspace of the upper bound.
         Environment solverEnv = env;
         solverEnv.solver().setForceExact(true);  // Errors within the inner iterations can propagate significantly
-        auto solver = setUpProbabilisticStatesSolver(solverEnv, dir, probabilisticToProbabilisticTransitions);
+        bool computeBoundsInParallel = false;
+#ifdef STORM_HAVE_INTELTBB
+        computeBoundsInParallel = env.solver().isUseIntelTbb();
+#endif
+        std::vector<ValueType> nextMarkovianStateValues = std::move(
+            markovianExitRates);  // At this point, the markovianExitRates are no longer needed, so we 'move' them away instead of allocating new memory
+        std::vector<InnerIterationWorkspace> workspaces;
+        workspaces.reserve(computeBoundsInParallel ? 2 : 1);
+        for (uint64_t workspaceIndex = 0; workspaceIndex < (computeBoundsInParallel ? 2ull : 1ull); ++workspaceIndex) {
+            workspaces.emplace_back();
+            auto& workspace = workspaces.back();
+            workspace.markovianToMaybeMultiplier = storm::solver::MultiplierFactory<ValueType>().create(env, markovianToMaybeTransitions);
+            workspace.probabilisticToMarkovianMultiplier = storm::solver::MultiplierFactory<ValueType>().create(env, probabilisticToMarkovianTransitions);
+            workspace.solver = setUpProbabilisticStatesSolver(solverEnv, dir, probabilisticToProbabilisticTransitions);
+            workspace.nextMarkovianStateValues = workspaceIndex == 0 ? std::move(nextMarkovianStateValues) : workspaces.front().nextMarkovianStateValues;
+            workspace.nextProbabilisticStateValues.resize(probabilisticToProbabilisticTransitions.getRowGroupCount());
+            workspace.eqSysRhs.resize(probabilisticToProbabilisticTransitions.getRowCount());
+        }
+        InnerIterationWorkspace& upperBoundWorkspace = workspaces.front();
+        InnerIterationWorkspace& lowerBoundWorkspace = workspaces.back();
 
         // Allocate auxiliary memory that can be used during the iterations
         std::vector<ValueType> maybeStatesValuesLower(maybeStates.getNumberOfSetBits(), storm::utility::zero<ValueType>());          // should be zero initially
         std::vector<ValueType> maybeStatesValuesWeightedUpper(maybeStates.getNumberOfSetBits(), storm::utility::zero<ValueType>());  // should be zero initially
         std::vector<ValueType> maybeStatesValuesUpper(maybeStates.getNumberOfSetBits(), storm::utility::zero<ValueType>());          // should be zero initially
-        std::vector<ValueType> nextMarkovianStateValues = std::move(
-            markovianExitRates);  // At this point, the markovianExitRates are no longer needed, so we 'move' them away instead of allocating new memory
-        std::vector<ValueType> nextProbabilisticStateValues(probabilisticToProbabilisticTransitions.getRowGroupCount());
-        std::vector<ValueType> eqSysRhs(probabilisticToProbabilisticTransitions.getRowCount());
 
         // Start the outer iterations which increase the uniformization rate until lower and upper bound on the result vector is sufficiently small
         storm::utility::ProgressMeasurement progressIterations("iterations");
@@ -158,19 +176,15 @@ class UnifPlusHelper {
             // Scale the weights so they sum to one.
             // storm::utility::vector::scaleVectorInPlace(foxGlynnResult.weights, storm::utility::one<ValueType>() / foxGlynnResult.totalWeight);
 
-            // Set up multiplier
-            auto markovianToMaybeMultiplier = storm::solver::MultiplierFactory<ValueType>().create(env, markovianToMaybeTransitions);
-            auto probabilisticToMarkovianMultiplier = storm::solver::MultiplierFactory<ValueType>().create(env, probabilisticToMarkovianTransitions);
-
-            // Perform inner iterations first for upper, then for lower bound
-            STORM_LOG_ASSERT(!storm::utility::vector::hasNonZeroEntry(maybeStatesValuesUpper), "Current values need to be initialized with zero.");
-            for (bool computeLowerBound : {false, true}) {
+            // Performs the inner iterations for the upper or the lower bound and returns true iff they were aborted.
+            auto performInnerIterations = [&](bool computeLowerBound, InnerIterationWorkspace& workspace) -> bool {
                 auto& maybeStatesValues = computeLowerBound ? maybeStatesValuesLower : maybeStatesValuesWeightedUpper;
                 ValueType targetValue = computeLowerBound ? storm::utility::zero<ValueType>() : storm::utility::one<ValueType>();
                 storm::utility::ProgressMeasurement progressSteps("steps in iteration " + std::to_string(iteration) + " for " +
                                                                   std::string(computeLowerBound ? "lower" : "upper") + " bounds.");
                 progressSteps.setMaxCount(N);
                 progressSteps.startNewMeasurement(0);
+                bool aborted = false;
                 bool firstIteration = true;  // The first iterations can be irrelevant, because they will only produce zeroes anyway.
                 int64_t k = N;
                 // Iteration k = N is always non-relevant
@@ -197,12 +211,12 @@ class UnifPlusHelper {
                         // Reaching this point means that this is the very first relevant iteration.
                         // If we are in the very first relevant iteration, we know that all states from the previous iteration have value zero.
                         // It is therefore valid (and necessary) to just set the values of Markovian states to zero.
-                        std::fill(nextMarkovianStateValues.begin(), nextMarkovianStateValues.end(), storm::utility::zero<ValueType>());
+                        std::fill(workspace.nextMarkovianStateValues.begin(), workspace.nextMarkovianStateValues.end(), storm::utility::zero<ValueType>());
                     } else {
                         // Compute the values at Markovian maybe states.
-                        markovianToMaybeMultiplier->multiply(env, maybeStatesValues, nullptr, nextMarkovianStateValues);
+                        workspace.markovianToMaybeMultiplier->multiply(env, maybeStatesValues, nullptr, workspace.nextMarkovianStateValues);
                         for (auto const& oneStepProb : markovianToPsiProbabilities) {
-                            nextMarkovianStateValues[oneStepProb.first] += oneStepProb.second * targetValue;
+                            workspace.nextMarkovianStateValues[oneStepProb.first] += oneStepProb.second * targetValue;
                         }
                     }
 
@@ -214,21 +228,21 @@ class UnifPlusHelper {
                     }
 
                     // Compute the values at probabilistic states.
-                    probabilisticToMarkovianMultiplier->multiply(env, nextMarkovianStateValues, nullptr, eqSysRhs);
+                    workspace.probabilisticToMarkovianMultiplier->multiply(env, workspace.nextMarkovianStateValues, nullptr, workspace.eqSysRhs);
                     for (auto const& oneStepProb : probabilisticToPsiProbabilities) {
-                        eqSysRhs[oneStepProb.first] += oneStepProb.second * targetValue;
+                        workspace.eqSysRhs[oneStepProb.first] += oneStepProb.second * targetValue;
                     }
-                    if (solver) {
-                        solver->solveEquations(solverEnv, dir, nextProbabilisticStateValues, eqSysRhs);
+                    if (workspace.solver) {
+                        workspace.solver->solveEquations(solverEnv, dir, workspace.nextProbabilisticStateValues, workspace.eqSysRhs);
                     } else {
-                        storm::utility::vector::reduceVectorMinOrMax(dir, eqSysRhs, nextProbabilisticStateValues,
+                        storm::utility::vector::reduceVectorMinOrMax(dir, workspace.eqSysRhs, workspace.nextProbabilisticStateValues,
                                                                      probabilisticToProbabilisticTransitions.getRowGroupIndices());
                     }
 
                     // Create the new values for the maybestates
                     // Fuse the results together
-                    storm::utility::vector::setVectorValues(maybeStatesValues, markovianStatesModMaybeStates, nextMarkovianStateValues);
-                    storm::utility::vector::setVectorValues(maybeStatesValues, probabilisticStatesModMaybeStates, nextProbabilisticStateValues);
+                    storm::utility::vector::setVectorValues(maybeStatesValues, markovianStatesModMaybeStates, workspace.nextMarkovianStateValues);
+                    storm::utility::vector::setVectorValues(maybeStatesValues, probabilisticStatesModMaybeStates, workspace.nextProbabilisticStateValues);
                     if (!computeLowerBound) {
                         // Add the scaled values to the actual result vector
                         uint64_t i = N - 1 - k;
@@ -241,7 +255,8 @@ class UnifPlusHelper {
 
                     progressSteps.updateProgress(N - k);
                     if (storm::utility::resources::isTerminate()) {
-                        abortedInnerIterations = true;
+                        storm::utility::resources::reportAbortedComputation();
+                        aborted = true;
                         break;
                     }
                 }
@@ -251,18 +266,11 @@ class UnifPlusHelper {
                 } else {
                     storm::utility::vector::scaleVectorInPlace(maybeStatesValuesUpper, storm::utility::one<ValueType>() / foxGlynnResult.totalWeight);
                 }
+                return aborted;
+            };
 
-                if (abortedInnerIterations || storm::utility::resources::isTerminate()) {
-                    break;
-                }
-
-                // Check if the lower and upper bound are sufficiently close to each other
-                converged = checkConvergence(maybeStatesValuesLower, maybeStatesValuesUpper, relevantMaybeStates, epsilon, relativePrecision, kappa);
-                if (converged) {
-                    break;
-                }
-
-                // Store the best solution we have found so far.
+            // Store the best solution we have found so far.
+            auto storeBestKnownSolution = [&]() {
                 if (relevantMaybeStates) {
                     auto currentSolIt = bestKnownSolution.begin();
                     for (auto state : relevantMaybeStates.get()) {
@@ -271,6 +279,39 @@ class UnifPlusHelper {
                         ++currentSolIt;
                     }
                 }
+            };
+
+            // Perform inner iterations first for upper, then for lower bound
+            STORM_LOG_ASSERT(!storm::utility::vector::hasNonZeroEntry(maybeStatesValuesUpper), "Current values need to be initialized with zero.");
+            if (computeBoundsInParallel) {
+#ifdef STORM_HAVE_INTELTBB
+                // The two bounds only share read-only data, so both sequences of layers can be processed concurrently.
+                bool abortedUpper = false;
+                bool abortedLower = false;
+                tbb::parallel_invoke([&]() { abortedUpper = performInnerIterations(false, upperBoundWorkspace); },
+                                     [&]() { abortedLower = performInnerIterations(true, lowerBoundWorkspace); });
+                abortedInnerIterations = abortedUpper || abortedLower;
+                if (!abortedInnerIterations && !storm::utility::resources::isTerminate()) {
+                    converged = checkConvergence(maybeStatesValuesLower, maybeStatesValuesUpper, relevantMaybeStates, epsilon, relativePrecision, kappa);
+                    if (!converged) {
+                        storeBestKnownSolution();
+                    }
+                }
+#endif
+            } else {
+                for (bool computeLowerBound : {false, true}) {
+                    abortedInnerIterations = performInnerIterations(computeLowerBound, computeLowerBound ? lowerBoundWorkspace : upperBoundWorkspace);
+                    if (abortedInnerIterations || storm::utility::resources::isTerminate()) {
+                        break;
+                    }
+
+                    // Check if the lower and upper bound are sufficiently close to each other
+                    converged = checkConvergence(maybeStatesValuesLower, maybeStatesValuesUpper, relevantMaybeStates, epsilon, relativePrecision, kappa);
+                    if (converged) {
+                        break;
+                    }
+                    storeBestKnownSolution();
+                }
             }
 
             if (!converged) {
@@ -296,12 +337,17 @@ class UnifPlusHelper {
 
                 // Apply uniformization with new rate
                 uniformize(markovianToMaybeTransitions, markovianToPsiProbabilities, oldLambda, lambda, markovianStatesModMaybeStates);
+                for (auto& workspace : workspaces) {
+                    // The multipliers are reused, but they might have cached the old matrix entries.
+                    workspace.markovianToMaybeMultiplier->clearCache();
+                }
 
                 // Reset the values of the maybe states to zero.
                 std::fill(maybeStatesValuesUpper.begin(), maybeStatesValuesUpper.end(), storm::utility::zero<ValueType>());
             }
             progressIterations.updateProgress(++iteration);
             if (storm::utility::resources::isTerminate()) {
+                storm::utility::resources::reportAbortedComputation();
                 STORM_LOG_WARN("Aborted unif+ in iteration " << iteration << ".");
                 break;
             }
@@ -326,6 +372,16 @@ class UnifPlusHelper {
     }
 
    private:
+    // Data that is modified during the inner iterations for one of the bounds.
+    struct InnerIterationWorkspace {
+        std::unique_ptr<storm::solver::Multiplier<ValueType>> markovianToMaybeMultiplier;
+        std::unique_ptr<storm::solver::Multiplier<ValueType>> probabilisticToMarkovianMultiplier;
+        std::unique_ptr<storm::solver::MinMaxLinearEquationSolver<ValueType>> solver;
+        std::vector<ValueType> nextMarkovianStateValues;
+        std::vector<ValueType> nextProbabilisticStateValues;
+        std::vector<ValueType> eqSysRhs;
+    };
+
     bool checkConvergence(std::vector<ValueType> const& lower, std::vector<ValueType> const& upper,
                           boost::optional<storm::storage::BitVector> const& relevantValues, ValueType const& epsilon, bool relative, ValueType& kappa) {
         STORM_LOG_ASSERT(!relevantValues.is_initialized() || relevantValues->size() == lower.size(), "Relevant values size mismatch.");
@@ -592,6 +648,7 @@ void computeBoundedReachabilityProbabilitiesImca(Environment const& env, Optimiz
             storm::utility::vector::addVectors(markovianNonGoalValues, bMarkovianFixed, markovianNonGoalValues);
         }
         if (storm::utility::resources::isTerminate()) {
+            storm::utility::resources::reportAbortedComputation();
             break;
         }
     }
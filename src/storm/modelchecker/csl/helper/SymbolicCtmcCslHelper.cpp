@@ -0,0 +1,159 @@
+#include "storm/modelchecker/csl/helper/SymbolicCtmcCslHelper.h"
+
+#include "storm/modelchecker/csl/helper/HybridCtmcCslHelper.h"
+
+#include "storm/environment/solver/SolverEnvironment.h"
+#include "storm/environment/solver/TimeBoundedSolverEnvironment.h"
+
+#include "storm/storage/dd/DdManager.h"
+
+#include "storm/utility/constants.h"
+#include "storm/utility/graph.h"
+#include "storm/utility/macros.h"
+#include "storm/utility/numerical.h"
+
+#include "storm/exceptions/InvalidOperationException.h"
+#include "storm/exceptions/InvalidStateException.h"
+
+namespace storm {
+namespace modelchecker {
+namespace helper {
+
+template<storm::dd::DdType DdType, typename ValueType>
+storm::dd::Add<DdType, ValueType> SymbolicCtmcCslHelper::computeBoundedUntilProbabilities(
+    Environment const& env, storm::models::symbolic::Ctmc<DdType, ValueType> const& model, storm::dd::Add<DdType, ValueType> const& rateMatrix,
+    storm::dd::Add<DdType, ValueType> const& exitRateVector, storm::dd::Bdd<DdType> const& phiStates, storm::dd::Bdd<DdType> const& psiStates,
+    double lowerBound, double upperBound) {
+    STORM_LOG_THROW(upperBound != storm::utility::infinity<double>(), storm::exceptions::InvalidOperationException,
+                    "Symbolic uniformization does not support time intervals without upper bound.");
+
+    // Set the possible (absolute) error allowed for truncation (epsilon for fox-glynn)
+    ValueType epsilon = storm::utility::convertNumber<ValueType>(env.solver().timeBounded().getPrecision()) / 8.0;
+
+    // If we identify the states that have probability 0 of reaching the target states, we can exclude them from the
+    // further computations.
+    storm::dd::Bdd<DdType> statesWithProbabilityGreater0 = storm::utility::graph::performProbGreater0(model, rateMatrix.notZero(), phiStates, psiStates);
+    STORM_LOG_INFO("Found " << statesWithProbabilityGreater0.getNonZeroCount() << " states with probability greater 0.");
+    storm::dd::Bdd<DdType> statesWithProbabilityGreater0NonPsi = statesWithProbabilityGreater0 && !psiStates;
+    STORM_LOG_INFO("Found " << statesWithProbabilityGreater0NonPsi.getNonZeroCount() << " 'maybe' states.");
+
+    if (statesWithProbabilityGreater0NonPsi.isZero() || storm::utility::isZero(upperBound)) {
+        return psiStates.template toAdd<ValueType>();
+    }
+
+    storm::dd::Add<DdType, ValueType> values;
+    if (lowerBound != upperBound) {
+        // Compute the probabilities of reaching psi states within t' - t time units while staying in phi states.
+        ValueType uniformizationRate = 1.02 * (statesWithProbabilityGreater0NonPsi.template toAdd<ValueType>() * exitRateVector).getMax();
+        STORM_LOG_THROW(uniformizationRate > 0, storm::exceptions::InvalidStateException, "The uniformization rate must be positive.");
+
+        storm::dd::Add<DdType, ValueType> uniformizedMatrix =
+            HybridCtmcCslHelper::computeUniformizedMatrix(model, rateMatrix, exitRateVector, statesWithProbabilityGreater0NonPsi, uniformizationRate);
+
+        // Compute the vector that is to be added as a compensation for removing the absorbing states.
+        storm::dd::Add<DdType, ValueType> b = (statesWithProbabilityGreater0NonPsi.template toAdd<ValueType>() * rateMatrix *
+                                               psiStates.swapVariables(model.getRowColumnMetaVariablePairs()).template toAdd<ValueType>())
+                                                  .sumAbstract(model.getColumnVariables()) /
+                                              model.getManager().getConstant(uniformizationRate);
+
+        values = psiStates.template toAdd<ValueType>() +
+                 computeTransientProbabilities(model, uniformizedMatrix, boost::make_optional(b),
+                                               storm::utility::convertNumber<ValueType>(upperBound - lowerBound), uniformizationRate,
+                                               model.getManager().template getAddZero<ValueType>(), epsilon);
+        if (storm::utility::isZero(lowerBound)) {
+            // In this case, the interval is of the form [0, t] and we are done.
+            return values;
+        }
+    } else {
+        // In this case, the interval is of the form [t, t] with t != 0 and the starting values are given by the psi states.
+        values = psiStates.template toAdd<ValueType>();
+    }
+
+    // Then compute the transient probabilities of being in such a state after t time units. For this,
+    // we must re-uniformize the CTMC on the relevant states.
+    storm::dd::Bdd<DdType> relevantStates = lowerBound != upperBound ? statesWithProbabilityGreater0 && phiStates : statesWithProbabilityGreater0;
+    values *= relevantStates.template toAdd<ValueType>();
+    ValueType uniformizationRate = 1.02 * (relevantStates.template toAdd<ValueType>() * exitRateVector).getMax();
+    STORM_LOG_THROW(uniformizationRate > 0, storm::exceptions::InvalidStateException, "The uniformization rate must be positive.");
+
+    storm::dd::Add<DdType, ValueType> uniformizedMatrix =
+        HybridCtmcCslHelper::computeUniformizedMatrix(model, rateMatrix, exitRateVector, relevantStates, uniformizationRate);
+    return computeTransientProbabilities(model, uniformizedMatrix, boost::optional<storm::dd::Add<DdType, ValueType>>(),
+                                         storm::utility::convertNumber<ValueType>(lowerBound), uniformizationRate, values, epsilon);
+}
+
+template<storm::dd::DdType DdType, typename ValueType>
+storm::dd::Add<DdType, ValueType> SymbolicCtmcCslHelper::computeTransientProbabilities(storm::models::symbolic::Ctmc<DdType, ValueType> const& model,
+                                                                                       storm::dd::Add<DdType, ValueType> const& uniformizedMatrix,
+                                                                                       boost::optional<storm::dd::Add<DdType, ValueType>> const& addVector,
+                                                                                       ValueType timeBound, ValueType uniformizationRate,
+                                                                                       storm::dd::Add<DdType, ValueType> values, ValueType epsilon) {
+    STORM_LOG_WARN_COND(epsilon > storm::utility::convertNumber<ValueType>(1e-20),
+                        "Very low truncation error " << epsilon << " requested. Numerical inaccuracies are possible.");
+    ValueType lambda = timeBound * uniformizationRate;
+
+    // If no time can pass, the current values are the result.
+    if (storm::utility::isZero(lambda)) {
+        return values;
+    }
+
+    // Use Fox-Glynn to get the truncation points and the weights.
+    storm::utility::numerical::FoxGlynnResult<ValueType> foxGlynnResult = storm::utility::numerical::foxGlynn(lambda, epsilon);
+    STORM_LOG_DEBUG("Fox-Glynn cutoff points: left=" << foxGlynnResult.left << ", right=" << foxGlynnResult.right);
+    STORM_LOG_DEBUG("Starting symbolic iterations with matrix of " << uniformizedMatrix.getNodeCount() << " nodes.");
+
+    auto multiply = [&](storm::dd::Add<DdType, ValueType> const& vector) {
+        storm::dd::Add<DdType, ValueType> product =
+            (uniformizedMatrix * vector.swapVariables(model.getRowColumnMetaVariablePairs())).sumAbstract(model.getColumnVariables());
+        if (addVector) {
+            product += addVector.get();
+        }
+        return product;
+    };
+
+    // Initialize result.
+    storm::dd::Add<DdType, ValueType> result;
+    uint_fast64_t startingIteration = foxGlynnResult.left;
+    if (startingIteration == 0) {
+        result = values * model.getManager().getConstant(foxGlynnResult.weights.front());
+        ++startingIteration;
+    } else {
+        result = model.getManager().template getAddZero<ValueType>();
+        // Perform the matrix-vector multiplications (without adding).
+        for (uint_fast64_t index = 1; index < startingIteration; ++index) {
+            values = multiply(values);
+        }
+    }
+
+    // For the indices that fall in between the truncation points, we need to perform the matrix-vector
+    // multiplication, scale and add the result.
+    for (uint_fast64_t index = startingIteration; index <= foxGlynnResult.right; ++index) {
+        values = multiply(values);
+        result += values * model.getManager().getConstant(foxGlynnResult.weights[index - foxGlynnResult.left]);
+    }
+
+    return result / model.getManager().getConstant(foxGlynnResult.totalWeight);
+}
+
+template storm::dd::Add<storm::dd::DdType::CUDD, double> SymbolicCtmcCslHelper::computeBoundedUntilProbabilities(
+    Environment const& env, storm::models::symbolic::Ctmc<storm::dd::DdType::CUDD, double> const& model,
+    storm::dd::Add<storm::dd::DdType::CUDD, double> const& rateMatrix, storm::dd::Add<storm::dd::DdType::CUDD, double> const& exitRateVector,
+    storm::dd::Bdd<storm::dd::DdType::CUDD> const& phiStates, storm::dd::Bdd<storm::dd::DdType::CUDD> const& psiStates, double lowerBound, double upperBound);
+template storm::dd::Add<storm::dd::DdType::CUDD, double> SymbolicCtmcCslHelper::computeTransientProbabilities(
+    storm::models::symbolic::Ctmc<storm::dd::DdType::CUDD, double> const& model, storm::dd::Add<storm::dd::DdType::CUDD, double> const& uniformizedMatrix,
+    boost::optional<storm::dd::Add<storm::dd::DdType::CUDD, double>> const& addVector, double timeBound, double uniformizationRate,
+    storm::dd::Add<storm::dd::DdType::CUDD, double> values, double epsilon);
+
+template storm::dd::Add<storm::dd::DdType::Sylvan, double> SymbolicCtmcCslHelper::computeBoundedUntilProbabilities(
+    Environment const& env, storm::models::symbolic::Ctmc<storm::dd::DdType::Sylvan, double> const& model,
+    storm::dd::Add<storm::dd::DdType::Sylvan, double> const& rateMatrix, storm::dd::Add<storm::dd::DdType::Sylvan, double> const& exitRateVector,
+    storm::dd::Bdd<storm::dd::DdType::Sylvan> const& phiStates, storm::dd::Bdd<storm::dd::DdType::Sylvan> const& psiStates, double lowerBound,
+    double upperBound);
+template storm::dd::Add<storm::dd::DdType::Sylvan, double> SymbolicCtmcCslHelper::computeTransientProbabilities(
+    storm::models::symbolic::Ctmc<storm::dd::DdType::Sylvan, double> const& model, storm::dd::Add<storm::dd::DdType::Sylvan, double> const& uniformizedMatrix,
+    boost::optional<storm::dd::Add<storm::dd::DdType::Sylvan, double>> const& addVector, double timeBound, double uniformizationRate,
+    storm::dd::Add<storm::dd::DdType::Sylvan, double> values, double epsilon);
+
+}  // namespace helper
+}  // namespace modelchecker
+}  // namespace storm
@@ -0,0 +1,61 @@
+#pragma once
+
+#include <boost/optional.hpp>
+
+#include "storm/models/symbolic/Ctmc.h"
+
+#include "storm/storage/dd/Add.h"
+#include "storm/storage/dd/Bdd.h"
+
+namespace storm {
+
+class Environment;
+
+namespace modelchecker {
+namespace helper {
+
+/*!
+ * Performs the transient analysis of CTMCs purely on decision diagrams, i.e., without translating the uniformized matrix to an explicit representation.
+ * This avoids the (possibly huge) explicit matrix for models whose structure is captured well by decision diagrams, at the cost of slower
+ * matrix-vector multiplications.
+ */
+class SymbolicCtmcCslHelper {
+   public:
+    /*!
+     * Computes the probabilities of reaching psi states within the given time interval while only visiting phi states.
+     * Intervals of the form [t, inf] with t != 0 are not supported as they require an unbounded reachability analysis.
+     *
+     * @return The probabilities for all reachable states.
+     */
+    template<storm::dd::DdType DdType, typename ValueType>
+    static storm::dd::Add<DdType, ValueType> computeBoundedUntilProbabilities(Environment const& env,
+                                                                              storm::models::symbolic::Ctmc<DdType, ValueType> const& model,
+                                                                              storm::dd::Add<DdType, ValueType> const& rateMatrix,
+                                                                              storm::dd::Add<DdType, ValueType> const& exitRateVector,
+                                                                              storm::dd::Bdd<DdType> const& phiStates, storm::dd::Bdd<DdType> const& psiStates,
+                                                                              double lowerBound, double upperBound);
+
+    /*!
+     * Computes the transient probabilities for the given time bound via uniformization. All weighted powers of the uniformized matrix are
+     * accumulated in an ADD.
+     *
+     * @param model The symbolic model.
+     * @param uniformizedMatrix The uniformized matrix (see HybridCtmcCslHelper::computeUniformizedMatrix).
+     * @param addVector If given, this vector is added after each multiplication.
+     * @param timeBound The time bound to use.
+     * @param uniformizationRate The rate used for the uniformization.
+     * @param values The starting values.
+     * @param epsilon The (absolute) error allowed for the truncation of the Poisson distribution.
+     * @return The transient probabilities.
+     */
+    template<storm::dd::DdType DdType, typename ValueType>
+    static storm::dd::Add<DdType, ValueType> computeTransientProbabilities(storm::models::symbolic::Ctmc<DdType, ValueType> const& model,
+                                                                           storm::dd::Add<DdType, ValueType> const& uniformizedMatrix,
+                                                                           boost::optional<storm::dd::Add<DdType, ValueType>> const& addVector,
+                                                                           ValueType timeBound, ValueType uniformizationRate,
+                                                                           storm::dd::Add<DdType, ValueType> values, ValueType epsilon);
+};
+
+}  // namespace helper
+}  // namespace modelchecker
+}  // namespace storm
@@ -12,6 +12,8 @@
 #include "storm/storage/MaximalEndComponentDecomposition.h"
 #include "storm/storage/SparseMatrix.h"
 
+#include "storm/storage/jani/Model.h"
+#include "storm/storage/jani/types/AllJaniTypes.h"
 #include "storm/storage/prism/Program.h"
 
 #include "storm/logic/FragmentSpecification.h"
@@ -31,6 +33,10 @@
 #include "storm/utility/macros.h"
 #include "storm/utility/prism.h"
 
+#ifdef STORM_HAVE_INTELTBB
+#include "storm/adapters/IntelTbbAdapter.h"
+#endif
+
 #include "storm/exceptions/InvalidOperationException.h"
 #include "storm/exceptions/InvalidPropertyException.h"
 #include "storm/exceptions/NotSupportedException.h"
@@ -40,12 +46,35 @@ namespace modelchecker {
 
 template<typename ModelType, typename StateType>
 SparseExplorationModelChecker<ModelType, StateType>::SparseExplorationModelChecker(storm::prism::Program const& program)
-    : program(program.substituteConstantsFormulas()),
+    : model(program.substituteConstantsFormulas()),
+      randomGenerator(std::chrono::system_clock::now().time_since_epoch().count()),
+      numberOfThreads(storm::settings::getModule<storm::settings::modules::ExplorationSettings>().getNumberOfThreads()),
+      comparator(storm::settings::getModule<storm::settings::modules::ExplorationSettings>().getPrecision()) {
+    // Intentionally left empty.
+}
+
+template<typename ModelType, typename StateType>
+SparseExplorationModelChecker<ModelType, StateType>::SparseExplorationModelChecker(storm::jani::Model const& model)
+    : model(model.substituteConstantsFunctions()),
       randomGenerator(std::chrono::system_clock::now().time_since_epoch().count()),
+      numberOfThreads(storm::settings::getModule<storm::settings::modules::ExplorationSettings>().getNumberOfThreads()),
       comparator(storm::settings::getModule<storm::settings::modules::ExplorationSettings>().getPrecision()) {
     // Intentionally left empty.
 }
 
+template<typename ModelType, typename StateType>
+SparseExplorationModelChecker<ModelType, StateType>::Worker::Worker(std::unique_ptr<StateGeneration<StateType, ValueType>>&& stateGeneration, uint64_t seed)
+    : stateGeneration(std::move(stateGeneration)), randomGenerator(seed) {
+    // Intentionally left empty.
+}
+
+template<typename ModelType, typename StateType>
+SparseExplorationModelChecker<ModelType, StateType>::SharedExplorationData::SharedExplorationData(
+    ExplorationInformation<StateType, ValueType>& explorationInformation, StateType initialStateIndex)
+    : explorationInformation(explorationInformation), initialStateIndex(initialStateIndex), numberOfPrecomputations(0), convergenceCriterionMet(false) {
+    // Intentionally left empty.
+}
+
 template<typename ModelType, typename StateType>
 bool SparseExplorationModelChecker<ModelType, StateType>::canHandleStatic(CheckTask<storm::logic::Formula, ValueType> const& checkTask) {
     storm::logic::Formula const& formula = checkTask.getFormula();
@@ -64,7 +93,8 @@ std::unique_ptr<CheckResult> SparseExplorationModelChecker<ModelType, StateType>
     storm::logic::UntilFormula const& untilFormula = checkTask.getFormula();
     storm::logic::Formula const& conditionFormula = untilFormula.getLeftSubformula();
     storm::logic::Formula const& targetFormula = untilFormula.getRightSubformula();
-    STORM_LOG_THROW(program.isDeterministicModel() || checkTask.isOptimizationDirectionSet(), storm::exceptions::InvalidPropertyException,
+    bool isDeterministicModel = model.isPrismProgram() ? model.asPrismProgram().isDeterministicModel() : model.asJaniModel().isDeterministicModel();
+    STORM_LOG_THROW(isDeterministicModel || checkTask.isOptimizationDirectionSet(), storm::exceptions::InvalidPropertyException,
                     "For nondeterministic systems, an optimization direction (min/max) must be given in the property.");
 
     ExplorationInformation<StateType, ValueType> explorationInformation(checkTask.isOptimizationDirectionSet() ? checkTask.getOptimizationDirection()
@@ -73,49 +103,114 @@ std::unique_ptr<CheckResult> SparseExplorationModelChecker<ModelType, StateType>
     // The first row group starts at action 0.
     explorationInformation.newRowGroup(0);
 
-    std::map<std::string, storm::expressions::Expression> labelToExpressionMapping = program.getLabelToExpressionMapping();
-    StateGeneration<StateType, ValueType> stateGeneration(program, explorationInformation,
-                                                          conditionFormula.toExpression(program.getManager(), labelToExpressionMapping),
-                                                          targetFormula.toExpression(program.getManager(), labelToExpressionMapping));
+    std::map<std::string, storm::expressions::Expression> labelToExpressionMapping;
+    if (model.isPrismProgram()) {
+        labelToExpressionMapping = model.asPrismProgram().getLabelToExpressionMapping();
+    } else {
+        // Labels of JANI models are given by transient boolean variables.
+        storm::jani::Model const& janiModel = model.asJaniModel();
+        for (auto const& variable : janiModel.getGlobalVariables().getTransientVariables()) {
+            if (variable.getType().isBasicType() && variable.getType().asBasicType().isBooleanType()) {
+                labelToExpressionMapping[variable.getName()] = janiModel.getLabelExpression(variable);
+            }
+        }
+    }
 
     // Compute and return result.
-    std::tuple<StateType, ValueType, ValueType> boundsForInitialState = performExploration(stateGeneration, explorationInformation);
+    std::tuple<StateType, ValueType, ValueType> boundsForInitialState =
+        performExploration(explorationInformation, conditionFormula.toExpression(model.getManager(), labelToExpressionMapping),
+                           targetFormula.toExpression(model.getManager(), labelToExpressionMapping));
     return std::make_unique<ExplicitQuantitativeCheckResult<ValueType>>(std::get<0>(boundsForInitialState), std::get<1>(boundsForInitialState));
 }
 
 template<typename ModelType, typename StateType>
 std::tuple<StateType, typename ModelType::ValueType, typename ModelType::ValueType> SparseExplorationModelChecker<ModelType, StateType>::performExploration(
-    StateGeneration<StateType, ValueType>& stateGeneration, ExplorationInformation<StateType, typename ModelType::ValueType>& explorationInformation) const {
+    ExplorationInformation<StateType, ValueType>& explorationInformation, storm::expressions::Expression const& conditionStateExpression,
+    storm::expressions::Expression const& targetStateExpression) const {
+    // Create the workers. Each worker has its own generator, but all of them share the storage of the states.
+    std::vector<std::unique_ptr<Worker>> workers;
+    std::shared_ptr<storm::storage::sparse::StateStorage<StateType>> stateStorage;
+    for (uint64_t thread = 0; thread < numberOfThreads; ++thread) {
+        auto stateGeneration = std::make_unique<StateGeneration<StateType, ValueType>>(model, explorationInformation, conditionStateExpression,
+                                                                                      targetStateExpression, stateStorage);
+        stateStorage = stateGeneration->getStateStorage();
+        workers.push_back(std::make_unique<Worker>(std::move(stateGeneration), randomGenerator()));
+    }
+
     // Generate the initial state so we know where to start the simulation.
+    StateGeneration<StateType, ValueType>& stateGeneration = *workers.front()->stateGeneration;
     stateGeneration.computeInitialStates();
     STORM_LOG_THROW(stateGeneration.getNumberOfInitialStates() == 1, storm::exceptions::NotSupportedException,
                     "Currently only models with one initial state are supported by the exploration engine.");
     StateType initialStateIndex = stateGeneration.getFirstInitialState();
 
-    // Create a structure that holds the bounds for the states and actions.
-    Bounds<StateType, ValueType> bounds;
-
-    // Create a stack that is used to track the path we sampled.
-    StateActionStack stack;
+    // Create a structure that holds the bounds for the states and actions (shared by all workers).
+    SharedExplorationData sharedData(explorationInformation, initialStateIndex);
 
     // Now perform the actual sampling.
-    Statistics<StateType, ValueType> stats;
-    bool convergenceCriterionMet = false;
-    while (!convergenceCriterionMet) {
-        bool result = samplePathFromInitialState(stateGeneration, explorationInformation, stack, bounds, stats);
+#ifdef STORM_HAVE_INTELTBB
+    if (workers.size() > 1) {
+        // The workers only synchronize via the shared data, so they also terminate if the scheduler does not run them concurrently.
+        tbb::task_arena arena(static_cast<int>(workers.size()));
+        arena.execute([&]() {
+            tbb::parallel_for(tbb::blocked_range<uint64_t>(0, workers.size(), 1), [&](tbb::blocked_range<uint64_t> const& range) {
+                for (uint64_t index = range.begin(); index < range.end(); ++index) {
+                    samplePathsUntilConvergence(*workers[index], sharedData);
+                }
+            });
+        });
+    } else {
+        samplePathsUntilConvergence(*workers.front(), sharedData);
+    }
+#else
+    STORM_LOG_WARN_COND(workers.size() == 1, "Storm was built without support for Intel TBB, so paths are sampled by a single thread.");
+    samplePathsUntilConvergence(*workers.front(), sharedData);
+#endif
+
+    // Show statistics if required.
+    if (storm::settings::getModule<storm::settings::modules::CoreSettings>().isShowStatisticsSet()) {
+        Statistics<StateType, ValueType> stats;
+        for (auto const& worker : workers) {
+            stats.add(worker->stats);
+        }
+        stats.printToStream(std::cout, explorationInformation);
+    }
+
+    return std::make_tuple(initialStateIndex, sharedData.bounds.getLowerBoundForState(initialStateIndex, explorationInformation),
+                           sharedData.bounds.getUpperBoundForState(initialStateIndex, explorationInformation));
+}
+
+template<typename ModelType, typename StateType>
+void SparseExplorationModelChecker<ModelType, StateType>::samplePathsUntilConvergence(Worker& worker, SharedExplorationData& sharedData) const {
+    ExplorationInformation<StateType, ValueType>& explorationInformation = sharedData.explorationInformation;
+    Bounds<StateType, ValueType>& bounds = sharedData.bounds;
+    StateType const& initialStateIndex = sharedData.initialStateIndex;
+    StateActionStack& stack = worker.stack;
+    Statistics<StateType, ValueType>& stats = worker.stats;
+
+    while (!sharedData.convergenceCriterionMet) {
+        uint64_t numberOfPrecomputationsBeforePath;
+        {
+            std::shared_lock<std::shared_mutex> lock(sharedData.mutex);
+            numberOfPrecomputationsBeforePath = sharedData.numberOfPrecomputations;
+        }
+        bool result = samplePathFromInitialState(worker, sharedData);
 
         stats.sampledPath();
         stats.updateMaxPathLength(stack.size());
 
-        // If a terminal state was found, we update the probabilities along the path contained in the stack.
-        if (result) {
+        std::unique_lock<std::shared_mutex> lock(sharedData.mutex);
+        // If a terminal state was found, we update the probabilities along the path contained in the stack. This is not possible if the matrix
+        // was restructured by a precomputation of another worker in the meantime.
+        if (result && numberOfPrecomputationsBeforePath == sharedData.numberOfPrecomputations) {
             // Update the bounds along the path to the terminal state.
             STORM_LOG_TRACE("Found terminal state, updating probabilities along path.");
             updateProbabilityBoundsAlongSampledPath(stack, explorationInformation, bounds);
         } else {
             // If not terminal state was found, the search aborted, possibly because of an EC-detection. In this
             // case, we cannot update the probabilities.
-            STORM_LOG_TRACE("Did not find terminal state.");
+            STORM_LOG_TRACE("Did not find terminal state or the sampled path is outdated.");
+            stack.clear();
         }
 
         STORM_LOG_DEBUG("Discovered states: " << explorationInformation.getNumberOfDiscoveredStates() << " (" << stats.numberOfExploredStates << " explored, "
@@ -124,30 +219,28 @@ std::tuple<StateType, typename ModelType::ValueType, typename ModelType::ValueTy
                                                          << bounds.getUpperBoundForState(initialStateIndex, explorationInformation) << "].");
         ValueType difference = bounds.getDifferenceOfStateBounds(initialStateIndex, explorationInformation);
         STORM_LOG_DEBUG("Difference after iteration " << stats.pathsSampled << " is " << difference << ".");
-        convergenceCriterionMet = comparator.isZero(difference);
+        if (comparator.isZero(difference)) {
+            sharedData.convergenceCriterionMet = true;
+        }
 
         // If the number of sampled paths exceeds a certain threshold, do a precomputation.
-        if (!convergenceCriterionMet && explorationInformation.performPrecomputationExcessiveSampledPaths(stats.pathsSampledSinceLastPrecomputation)) {
+        if (!sharedData.convergenceCriterionMet &&
+            explorationInformation.performPrecomputationExcessiveSampledPaths(stats.pathsSampledSinceLastPrecomputation)) {
+            ++sharedData.numberOfPrecomputations;
             performPrecomputation(stack, explorationInformation, bounds, stats);
         }
     }
-
-    // Show statistics if required.
-    if (storm::settings::getModule<storm::settings::modules::CoreSettings>().isShowStatisticsSet()) {
-        stats.printToStream(std::cout, explorationInformation);
-    }
-
-    return std::make_tuple(initialStateIndex, bounds.getLowerBoundForState(initialStateIndex, explorationInformation),
-                           bounds.getUpperBoundForState(initialStateIndex, explorationInformation));
 }
 
 template<typename ModelType, typename StateType>
-bool SparseExplorationModelChecker<ModelType, StateType>::samplePathFromInitialState(StateGeneration<StateType, ValueType>& stateGeneration,
-                                                                                     ExplorationInformation<StateType, ValueType>& explorationInformation,
-                                                                                     StateActionStack& stack, Bounds<StateType, ValueType>& bounds,
-                                                                                     Statistics<StateType, ValueType>& stats) const {
+bool SparseExplorationModelChecker<ModelType, StateType>::samplePathFromInitialState(Worker& worker, SharedExplorationData& sharedData) const {
+    ExplorationInformation<StateType, ValueType>& explorationInformation = sharedData.explorationInformation;
+    Bounds<StateType, ValueType>& bounds = sharedData.bounds;
+    StateActionStack& stack = worker.stack;
+    Statistics<StateType, ValueType>& stats = worker.stats;
+
     // Start the search from the initial state.
-    stack.push_back(std::make_pair(stateGeneration.getFirstInitialState(), 0));
+    stack.push_back(std::make_pair(sharedData.initialStateIndex, 0));
 
     // As long as we didn't find a terminal (accepting or rejecting) state in the search, sample a new successor.
     bool foundTerminalState = false;
@@ -155,14 +248,22 @@ bool SparseExplorationModelChecker<ModelType, StateType>::samplePathFromInitialS
         StateType const& currentStateId = stack.back().first;
         STORM_LOG_TRACE("State on top of stack is: " << currentStateId << ".");
 
-        // If the state is not yet explored, we need to retrieve its behaviors.
+        // Explored states can be sampled from concurrently, so exclusive access is only required if the state is not yet explored.
+        std::shared_lock<std::shared_mutex> sharedLock(sharedData.mutex);
+        std::unique_lock<std::shared_mutex> exclusiveLock(sharedData.mutex, std::defer_lock);
+        if (explorationInformation.findUnexploredState(currentStateId) != explorationInformation.unexploredStatesEnd()) {
+            sharedLock.unlock();
+            exclusiveLock.lock();
+        }
+
+        // If the state is not yet explored, we need to retrieve its behaviors. Note that another worker may have explored the state in the meantime.
         auto unexploredIt = explorationInformation.findUnexploredState(currentStateId);
         if (unexploredIt != explorationInformation.unexploredStatesEnd()) {
             STORM_LOG_TRACE("State was not yet explored.");
 
             // Explore the previously unexplored state.
             storm::generator::CompressedState const& compressedState = unexploredIt->second;
-            foundTerminalState = exploreState(stateGeneration, currentStateId, compressedState, explorationInformation, bounds, stats);
+            foundTerminalState = exploreState(*worker.stateGeneration, currentStateId, compressedState, explorationInformation, bounds, stats);
             if (foundTerminalState) {
                 STORM_LOG_TRACE("Aborting sampling of path, because a terminal state was reached.");
             }
@@ -182,11 +283,11 @@ bool SparseExplorationModelChecker<ModelType, StateType>::samplePathFromInitialS
         if (!foundTerminalState) {
             // At this point, we can be sure that the state was expanded and that we can sample according to the
             // probabilities in the matrix.
-            uint32_t chosenAction = sampleActionOfState(currentStateId, explorationInformation, bounds);
+            uint32_t chosenAction = sampleActionOfState(currentStateId, explorationInformation, bounds, worker.randomGenerator);
             stack.back().second = chosenAction;
             STORM_LOG_TRACE("Sampled action " << chosenAction << " in state " << currentStateId << ".");
 
-            StateType successor = sampleSuccessorFromAction(chosenAction, explorationInformation, bounds);
+            StateType successor = sampleSuccessorFromAction(chosenAction, explorationInformation, bounds, worker.randomGenerator);
             STORM_LOG_TRACE("Sampled successor " << successor << " according to action " << chosenAction << " of state " << currentStateId << ".");
 
             // Put the successor state and a dummy action on top of the stack.
@@ -194,12 +295,22 @@ bool SparseExplorationModelChecker<ModelType, StateType>::samplePathFromInitialS
 
             // If the number of exploration steps exceeds a certain threshold, do a precomputation.
             if (explorationInformation.performPrecomputationExcessiveExplorationSteps(stats.explorationStepsSinceLastPrecomputation)) {
+                if (!exclusiveLock.owns_lock()) {
+                    sharedLock.unlock();
+                    exclusiveLock.lock();
+                }
+                ++sharedData.numberOfPrecomputations;
                 performPrecomputation(stack, explorationInformation, bounds, stats);
 
                 STORM_LOG_TRACE("Aborting the search after precomputation.");
                 stack.clear();
                 break;
             }
+
+            // Stop sampling if another worker detected convergence.
+            if (sharedData.convergenceCriterionMet) {
+                break;
+            }
         }
     }
 
@@ -319,7 +430,8 @@ bool SparseExplorationModelChecker<ModelType, StateType>::exploreState(StateGene
 
 template<typename ModelType, typename StateType>
 typename SparseExplorationModelChecker<ModelType, StateType>::ActionType SparseExplorationModelChecker<ModelType, StateType>::sampleActionOfState(
-    StateType const& currentStateId, ExplorationInformation<StateType, ValueType> const& explorationInformation, Bounds<StateType, ValueType>& bounds) const {
+    StateType const& currentStateId, ExplorationInformation<StateType, ValueType> const& explorationInformation, Bounds<StateType, ValueType> const& bounds,
+    std::default_random_engine& randomGenerator) const {
     // Determine the values of all available actions.
     std::vector<std::pair<ActionType, ValueType>> actionValues;
     StateType rowGroup = explorationInformation.getRowGroup(currentStateId);
@@ -360,8 +472,8 @@ typename SparseExplorationModelChecker<ModelType, StateType>::ActionType SparseE
 
 template<typename ModelType, typename StateType>
 StateType SparseExplorationModelChecker<ModelType, StateType>::sampleSuccessorFromAction(
-    ActionType const& chosenAction, ExplorationInformation<StateType, ValueType> const& explorationInformation,
-    Bounds<StateType, ValueType> const& bounds) const {
+    ActionType const& chosenAction, ExplorationInformation<StateType, ValueType> const& explorationInformation, Bounds<StateType, ValueType> const& bounds,
+    std::default_random_engine& randomGenerator) const {
     std::vector<storm::storage::MatrixEntry<StateType, ValueType>> const& row = explorationInformation.getRowOfMatrix(chosenAction);
     if (row.size() == 1) {
         return row.front().getColumn();
@@ -1,10 +1,13 @@
 #ifndef STORM_MODELCHECKER_EXPLORATION_SPARSEEXPLORATIONMODELCHECKER_H_
 #define STORM_MODELCHECKER_EXPLORATION_SPARSEEXPLORATIONMODELCHECKER_H_
 
+#include <atomic>
 #include <random>
+#include <shared_mutex>
 
 #include "storm/modelchecker/AbstractModelChecker.h"
 
+#include "storm/storage/SymbolicModelDescription.h"
 #include "storm/storage/prism/Program.h"
 
 #include "storm/generator/CompressedState.h"
@@ -24,6 +27,9 @@ class SparseMatrix;
 namespace prism {
 class Program;
 }
+namespace jani {
+class Model;
+}
 
 namespace modelchecker {
 namespace exploration_detail {
@@ -48,6 +54,8 @@ class SparseExplorationModelChecker : public AbstractModelChecker<ModelType> {
 
     SparseExplorationModelChecker(storm::prism::Program const& program);
 
+    SparseExplorationModelChecker(storm::jani::Model const& model);
+
     static bool canHandleStatic(CheckTask<storm::logic::Formula, ValueType> const& checkTask);
 
     virtual bool canHandle(CheckTask<storm::logic::Formula, ValueType> const& checkTask) const override;
@@ -56,22 +64,54 @@ class SparseExplorationModelChecker : public AbstractModelChecker<ModelType> {
                                                                    CheckTask<storm::logic::UntilFormula, ValueType> const& checkTask) override;
 
    private:
-    std::tuple<StateType, ValueType, ValueType> performExploration(StateGeneration<StateType, ValueType>& stateGeneration,
-                                                                   ExplorationInformation<StateType, ValueType>& explorationInformation) const;
-
-    bool samplePathFromInitialState(StateGeneration<StateType, ValueType>& stateGeneration,
-                                    ExplorationInformation<StateType, ValueType>& explorationInformation, StateActionStack& stack,
-                                    Bounds<StateType, ValueType>& bounds, Statistics<StateType, ValueType>& stats) const;
+    // The data of one thread that samples paths.
+    struct Worker {
+        Worker(std::unique_ptr<StateGeneration<StateType, ValueType>>&& stateGeneration, uint64_t seed);
+
+        // The state generation of the worker, which shares the state storage with the other workers.
+        std::unique_ptr<StateGeneration<StateType, ValueType>> stateGeneration;
+        // The random number generator of the worker.
+        std::default_random_engine randomGenerator;
+        // The stack used to track the path that is currently sampled.
+        StateActionStack stack;
+        // The statistics of the worker, which also decide when the worker triggers a precomputation.
+        Statistics<StateType, ValueType> stats;
+    };
+
+    // The exploration data shared by all workers.
+    struct SharedExplorationData {
+        SharedExplorationData(ExplorationInformation<StateType, ValueType>& explorationInformation, StateType initialStateIndex);
+
+        ExplorationInformation<StateType, ValueType>& explorationInformation;
+        Bounds<StateType, ValueType> bounds;
+        StateType initialStateIndex;
+
+        // Guards the exploration information and the bounds. Sampling along explored states only needs shared access, whereas exploring
+        // states, updating bounds and precomputations need exclusive access.
+        std::shared_mutex mutex;
+        // Counts the performed precomputations. As they may restructure the matrix, bounds along paths that were sampled concurrently to a
+        // precomputation are not updated.
+        uint64_t numberOfPrecomputations;
+        std::atomic<bool> convergenceCriterionMet;
+    };
+
+    std::tuple<StateType, ValueType, ValueType> performExploration(ExplorationInformation<StateType, ValueType>& explorationInformation,
+                                                                   storm::expressions::Expression const& conditionStateExpression,
+                                                                   storm::expressions::Expression const& targetStateExpression) const;
+
+    void samplePathsUntilConvergence(Worker& worker, SharedExplorationData& sharedData) const;
+
+    bool samplePathFromInitialState(Worker& worker, SharedExplorationData& sharedData) const;
 
     bool exploreState(StateGeneration<StateType, ValueType>& stateGeneration, StateType const& currentStateId,
                       storm::generator::CompressedState const& currentState, ExplorationInformation<StateType, ValueType>& explorationInformation,
                       Bounds<StateType, ValueType>& bounds, Statistics<StateType, ValueType>& stats) const;
 
     ActionType sampleActionOfState(StateType const& currentStateId, ExplorationInformation<StateType, ValueType> const& explorationInformation,
-                                   Bounds<StateType, ValueType>& bounds) const;
+                                   Bounds<StateType, ValueType> const& bounds, std::default_random_engine& randomGenerator) const;
 
     StateType sampleSuccessorFromAction(ActionType const& chosenAction, ExplorationInformation<StateType, ValueType> const& explorationInformation,
-                                        Bounds<StateType, ValueType> const& bounds) const;
+                                        Bounds<StateType, ValueType> const& bounds, std::default_random_engine& randomGenerator) const;
 
     bool performPrecomputation(StateActionStack const& stack, ExplorationInformation<StateType, ValueType>& explorationInformation,
                                Bounds<StateType, ValueType>& bounds, Statistics<StateType, ValueType>& stats) const;
@@ -104,12 +144,15 @@ class SparseExplorationModelChecker : public AbstractModelChecker<ModelType> {
     std::pair<ValueType, ValueType> combineBounds(storm::OptimizationDirection const& direction, std::pair<ValueType, ValueType> const& bounds1,
                                                   std::pair<ValueType, ValueType> const& bounds2) const;
 
-    // The program that defines the model to check.
-    storm::prism::Program program;
+    // The PRISM program or JANI model that defines the model to check.
+    storm::storage::SymbolicModelDescription model;
 
-    // The random number generator.
+    // The random number generator that seeds the generators of the workers.
     mutable std::default_random_engine randomGenerator;
 
+    // The number of threads that sample paths concurrently.
+    uint64_t numberOfThreads;
+
     // A comparator used to determine whether values are equal.
     storm::utility::ConstantsComparator<ValueType> comparator;
 };
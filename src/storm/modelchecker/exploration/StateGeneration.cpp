@@ -1,22 +1,36 @@
 #include "storm/modelchecker/exploration/StateGeneration.h"
 #include "storm/storage/expressions/ExpressionEvaluator.h"
 
+#include "storm/generator/JaniNextStateGenerator.h"
+#include "storm/generator/PrismNextStateGenerator.h"
 #include "storm/modelchecker/exploration/ExplorationInformation.h"
 
+#include "storm/exceptions/NotSupportedException.h"
+#include "storm/utility/macros.h"
+
 namespace storm {
 namespace modelchecker {
 namespace exploration_detail {
 
 template<typename StateType, typename ValueType>
-StateGeneration<StateType, ValueType>::StateGeneration(storm::prism::Program const& program,
+StateGeneration<StateType, ValueType>::StateGeneration(storm::storage::SymbolicModelDescription const& model,
                                                        ExplorationInformation<StateType, ValueType>& explorationInformation,
                                                        storm::expressions::Expression const& conditionStateExpression,
-                                                       storm::expressions::Expression const& targetStateExpression)
-    : generator(program),
-      stateStorage(generator.getStateSize()),
-      conditionStateExpression(conditionStateExpression),
-      targetStateExpression(targetStateExpression) {
+                                                       storm::expressions::Expression const& targetStateExpression,
+                                                       std::shared_ptr<storm::storage::sparse::StateStorage<StateType>> const& stateStorage)
+    : stateStorage(stateStorage), conditionStateExpression(conditionStateExpression), targetStateExpression(targetStateExpression) {
+    if (model.isPrismProgram()) {
+        generator = std::make_shared<storm::generator::PrismNextStateGenerator<ValueType, StateType>>(model.asPrismProgram());
+    } else {
+        STORM_LOG_THROW(model.isJaniModel(), storm::exceptions::NotSupportedException, "Cannot explore this symbolic model description.");
+        generator = std::make_shared<storm::generator::JaniNextStateGenerator<ValueType, StateType>>(model.asJaniModel());
+    }
+    if (!this->stateStorage) {
+        this->stateStorage = std::make_shared<storm::storage::sparse::StateStorage<StateType>>(generator->getStateSize());
+    }
+
     stateToIdCallback = [&explorationInformation, this](storm::generator::CompressedState const& state) -> StateType {
+        storm::storage::sparse::StateStorage<StateType>& stateStorage = *this->stateStorage;
         StateType newIndex = stateStorage.getNumberOfStates();
 
         // Check, if the state was already registered.
@@ -30,44 +44,49 @@ StateGeneration<StateType, ValueType>::StateGeneration(storm::prism::Program con
     };
 }
 
+template<typename StateType, typename ValueType>
+std::shared_ptr<storm::storage::sparse::StateStorage<StateType>> const& StateGeneration<StateType, ValueType>::getStateStorage() const {
+    return stateStorage;
+}
+
 template<typename StateType, typename ValueType>
 void StateGeneration<StateType, ValueType>::load(storm::generator::CompressedState const& state) {
-    generator.load(state);
+    generator->load(state);
 }
 
 template<typename StateType, typename ValueType>
 std::vector<StateType> StateGeneration<StateType, ValueType>::getInitialStates() {
-    return stateStorage.initialStateIndices;
+    return stateStorage->initialStateIndices;
 }
 
 template<typename StateType, typename ValueType>
 storm::generator::StateBehavior<ValueType, StateType> StateGeneration<StateType, ValueType>::expand() {
-    return generator.expand(stateToIdCallback);
+    return generator->expand(stateToIdCallback);
 }
 
 template<typename StateType, typename ValueType>
 bool StateGeneration<StateType, ValueType>::isConditionState() const {
-    return generator.satisfies(conditionStateExpression);
+    return generator->satisfies(conditionStateExpression);
 }
 
 template<typename StateType, typename ValueType>
 bool StateGeneration<StateType, ValueType>::isTargetState() const {
-    return generator.satisfies(targetStateExpression);
+    return generator->satisfies(targetStateExpression);
 }
 
 template<typename StateType, typename ValueType>
 void StateGeneration<StateType, ValueType>::computeInitialStates() {
-    stateStorage.initialStateIndices = generator.getInitialStates(stateToIdCallback);
+    stateStorage->initialStateIndices = generator->getInitialStates(stateToIdCallback);
 }
 
 template<typename StateType, typename ValueType>
 StateType StateGeneration<StateType, ValueType>::getFirstInitialState() const {
-    return stateStorage.initialStateIndices.front();
+    return stateStorage->initialStateIndices.front();
 }
 
 template<typename StateType, typename ValueType>
 std::size_t StateGeneration<StateType, ValueType>::getNumberOfInitialStates() const {
-    return stateStorage.initialStateIndices.size();
+    return stateStorage->initialStateIndices.size();
 }
 
 template class StateGeneration<uint32_t, double>;
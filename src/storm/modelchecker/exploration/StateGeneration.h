@@ -1,16 +1,15 @@
 #ifndef STORM_MODELCHECKER_EXPLORATION_EXPLORATION_DETAIL_STATEGENERATION_H_
 #define STORM_MODELCHECKER_EXPLORATION_EXPLORATION_DETAIL_STATEGENERATION_H_
 
+#include <memory>
+
 #include "storm/generator/CompressedState.h"
-#include "storm/generator/PrismNextStateGenerator.h"
+#include "storm/generator/NextStateGenerator.h"
 
+#include "storm/storage/SymbolicModelDescription.h"
 #include "storm/storage/sparse/StateStorage.h"
 
 namespace storm {
-namespace generator {
-template<typename ValueType, typename StateType>
-class PrismNextStateGenerator;
-}
 
 namespace modelchecker {
 namespace exploration_detail {
@@ -21,8 +20,17 @@ class ExplorationInformation;
 template<typename StateType, typename ValueType>
 class StateGeneration {
    public:
-    StateGeneration(storm::prism::Program const& program, ExplorationInformation<StateType, ValueType>& explorationInformation,
-                    storm::expressions::Expression const& conditionStateExpression, storm::expressions::Expression const& targetStateExpression);
+    /*!
+     * Creates a state generation for the given PRISM program or JANI model.
+     *
+     * @param stateStorage If given, the storage of the state indices is shared with other state generations (for the same model and exploration
+     * information), which allows to explore states with multiple generators. Expanding states then needs to be synchronized externally.
+     */
+    StateGeneration(storm::storage::SymbolicModelDescription const& model, ExplorationInformation<StateType, ValueType>& explorationInformation,
+                    storm::expressions::Expression const& conditionStateExpression, storm::expressions::Expression const& targetStateExpression,
+                    std::shared_ptr<storm::storage::sparse::StateStorage<StateType>> const& stateStorage = nullptr);
+
+    std::shared_ptr<storm::storage::sparse::StateStorage<StateType>> const& getStateStorage() const;
 
     void load(storm::generator::CompressedState const& state);
 
@@ -41,10 +49,10 @@ class StateGeneration {
     bool isTargetState() const;
 
    private:
-    storm::generator::PrismNextStateGenerator<ValueType, StateType> generator;
+    std::shared_ptr<storm::generator::NextStateGenerator<ValueType, StateType>> generator;
     std::function<StateType(storm::generator::CompressedState const&)> stateToIdCallback;
 
-    storm::storage::sparse::StateStorage<StateType> stateStorage;
+    std::shared_ptr<storm::storage::sparse::StateStorage<StateType>> stateStorage;
 
     storm::expressions::Expression conditionStateExpression;
     storm::expressions::Expression targetStateExpression;
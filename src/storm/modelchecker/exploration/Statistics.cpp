@@ -39,6 +39,21 @@ void Statistics<StateType, ValueType>::updateMaxPathLength(std::size_t const& cu
     maxPathLength = std::max(maxPathLength, currentPathLength);
 }
 
+template<typename StateType, typename ValueType>
+void Statistics<StateType, ValueType>::add(Statistics<StateType, ValueType> const& other) {
+    pathsSampled += other.pathsSampled;
+    pathsSampledSinceLastPrecomputation += other.pathsSampledSinceLastPrecomputation;
+    explorationSteps += other.explorationSteps;
+    explorationStepsSinceLastPrecomputation += other.explorationStepsSinceLastPrecomputation;
+    maxPathLength = std::max(maxPathLength, other.maxPathLength);
+    numberOfTargetStates += other.numberOfTargetStates;
+    numberOfExploredStates += other.numberOfExploredStates;
+    numberOfPrecomputations += other.numberOfPrecomputations;
+    ecDetections += other.ecDetections;
+    failedEcDetections += other.failedEcDetections;
+    totalNumberOfEcDetected += other.totalNumberOfEcDetected;
+}
+
 template<typename StateType, typename ValueType>
 void Statistics<StateType, ValueType>::printToStream(std::ostream& out, ExplorationInformation<StateType, ValueType> const& explorationInformation) const {
     out << "\nExploration statistics:\n";
@@ -82,6 +82,50 @@ std::vector<ValueType> SparseNondeterministicStepBoundedHorizonHelper<ValueType>
     return result;
 }
 
+template<typename ValueType>
+StepBoundedHorizonResults<ValueType> SparseNondeterministicStepBoundedHorizonHelper<ValueType>::computeForAllStepBounds(
+    Environment const& env, storm::solver::SolveGoal<ValueType>&& goal, storm::storage::SparseMatrix<ValueType> const& transitionMatrix,
+    storm::storage::SparseMatrix<ValueType> const& backwardTransitions, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates,
+    uint64_t maximalStepBound) {
+    // Determine the states that have a positive probability of reaching the target states within the largest step bound.
+    storm::storage::BitVector maybeStates;
+    if (goal.minimize()) {
+        maybeStates = storm::utility::graph::performProbGreater0A(transitionMatrix, transitionMatrix.getRowGroupIndices(), backwardTransitions, phiStates,
+                                                                  psiStates, true, maximalStepBound);
+    } else {
+        maybeStates = storm::utility::graph::performProbGreater0E(backwardTransitions, phiStates, psiStates, true, maximalStepBound);
+    }
+    maybeStates &= ~psiStates;
+    STORM_LOG_INFO("Preprocessing: " << maybeStates.getNumberOfSetBits() << " non-target states with probability greater 0.");
+
+    // We only keep the values that we are interested in.
+    storm::storage::BitVector storedStates = goal.hasRelevantValues() ? (goal.relevantValues() & maybeStates) : maybeStates;
+    StepBoundedHorizonResults<ValueType> result(psiStates, maybeStates, storedStates);
+
+    // The values for step bound k are obtained by k multiplications with the submatrix of the maybe states.
+    std::vector<ValueType> subresult(maybeStates.getNumberOfSetBits(), storm::utility::zero<ValueType>());
+    result.addResult(subresult);
+    if (!maybeStates.empty()) {
+        storm::storage::SparseMatrix<ValueType> submatrix = transitionMatrix.getSubmatrix(true, maybeStates, maybeStates, false);
+        std::vector<ValueType> b = transitionMatrix.getConstrainedRowGroupSumVector(maybeStates, psiStates);
+        auto multiplier = storm::solver::MultiplierFactory<ValueType>().create(env, submatrix);
+        for (uint64_t stepBound = 1; stepBound <= maximalStepBound; ++stepBound) {
+            multiplier->multiplyAndReduce(env, goal.direction(), subresult, &b, subresult);
+            result.addResult(subresult);
+            if (storm::utility::resources::isTerminate()) {
+                storm::utility::resources::reportAbortedComputation();
+                STORM_LOG_WARN("Step bounded reachability analysis aborted after " << stepBound << " of " << maximalStepBound << " steps.");
+                break;
+            }
+        }
+    } else {
+        for (uint64_t stepBound = 1; stepBound <= maximalStepBound; ++stepBound) {
+            result.addResult(subresult);
+        }
+    }
+    return result;
+}
+
 template class SparseNondeterministicStepBoundedHorizonHelper<double>;
 template class SparseNondeterministicStepBoundedHorizonHelper<storm::RationalNumber>;
 }  // namespace helper
@@ -1,5 +1,6 @@
 #pragma once
 
+#include "storm/modelchecker/helper/finitehorizon/StepBoundedHorizonResults.h"
 #include "storm/modelchecker/hints/ModelCheckerHint.h"
 #include "storm/modelchecker/prctl/helper/SemanticSolutionType.h"
 #include "storm/solver/SolveGoal.h"
@@ -20,6 +21,16 @@ class SparseNondeterministicStepBoundedHorizonHelper {
                                    storm::storage::BitVector const& psiStates, uint64_t lowerBound, uint64_t upperBound,
                                    ModelCheckerHint const& hint = ModelCheckerHint());
 
+    /*!
+     * Computes the probabilities of Pmin/max=? [phi U<=k psi] for all step bounds k = 0, ..., maximalStepBound in a single pass.
+     * If the goal has relevant values, only the values of the relevant states are stored for every step bound.
+     */
+    StepBoundedHorizonResults<ValueType> computeForAllStepBounds(Environment const& env, storm::solver::SolveGoal<ValueType>&& goal,
+                                                                 storm::storage::SparseMatrix<ValueType> const& transitionMatrix,
+                                                                 storm::storage::SparseMatrix<ValueType> const& backwardTransitions,
+                                                                 storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates,
+                                                                 uint64_t maximalStepBound);
+
    private:
 };
 
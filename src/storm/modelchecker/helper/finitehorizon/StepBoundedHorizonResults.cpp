@@ -0,0 +1,82 @@
+#include "storm/modelchecker/helper/finitehorizon/StepBoundedHorizonResults.h"
+
+#include "storm/adapters/RationalFunctionAdapter.h"
+
+#include "storm/exceptions/InvalidArgumentException.h"
+#include "storm/utility/constants.h"
+#include "storm/utility/macros.h"
+#include "storm/utility/vector.h"
+
+namespace storm {
+namespace modelchecker {
+namespace helper {
+
+template<typename ValueType>
+StepBoundedHorizonResults<ValueType>::StepBoundedHorizonResults(storm::storage::BitVector const& psiStates, storm::storage::BitVector const& maybeStates,
+                                                                storm::storage::BitVector const& storedStates)
+    : psiStates(psiStates), maybeStates(maybeStates), storedStates(storedStates), numberOfStepBounds(0) {
+    STORM_LOG_ASSERT(storedStates.isSubsetOf(maybeStates), "Stored states must be maybe states.");
+    storedStatesInMaybeStates.reserve(storedStates.getNumberOfSetBits());
+    uint64_t maybeStateIndex = 0;
+    for (auto state : maybeStates) {
+        if (storedStates.get(state)) {
+            storedStatesInMaybeStates.push_back(maybeStateIndex);
+        }
+        ++maybeStateIndex;
+    }
+}
+
+template<typename ValueType>
+void StepBoundedHorizonResults<ValueType>::addResult(std::vector<ValueType> const& maybeStateValues) {
+    STORM_LOG_ASSERT(maybeStateValues.size() == maybeStates.getNumberOfSetBits(), "Unexpected size of result vector.");
+    for (auto const& maybeStateIndex : storedStatesInMaybeStates) {
+        values.push_back(maybeStateValues[maybeStateIndex]);
+    }
+    ++numberOfStepBounds;
+}
+
+template<typename ValueType>
+uint64_t StepBoundedHorizonResults<ValueType>::getNumberOfStepBounds() const {
+    return numberOfStepBounds;
+}
+
+template<typename ValueType>
+uint64_t StepBoundedHorizonResults<ValueType>::getMaximalStepBound() const {
+    STORM_LOG_ASSERT(numberOfStepBounds > 0, "No results available.");
+    return numberOfStepBounds - 1;
+}
+
+template<typename ValueType>
+ValueType StepBoundedHorizonResults<ValueType>::getValue(uint64_t stepBound, uint64_t state) const {
+    STORM_LOG_THROW(stepBound < numberOfStepBounds, storm::exceptions::InvalidArgumentException,
+                    "No result available for step bound " << stepBound << " (maximal step bound is " << getMaximalStepBound() << ").");
+    if (psiStates.get(state)) {
+        return storm::utility::one<ValueType>();
+    } else if (!maybeStates.get(state)) {
+        return storm::utility::zero<ValueType>();
+    }
+    STORM_LOG_THROW(storedStates.get(state), storm::exceptions::InvalidArgumentException, "The value of state " << state << " has not been stored.");
+    return values[stepBound * storedStatesInMaybeStates.size() + storedStates.getNumberOfSetBitsBeforeIndex(state)];
+}
+
+template<typename ValueType>
+std::vector<ValueType> StepBoundedHorizonResults<ValueType>::getValues(uint64_t stepBound) const {
+    STORM_LOG_THROW(stepBound < numberOfStepBounds, storm::exceptions::InvalidArgumentException,
+                    "No result available for step bound " << stepBound << " (maximal step bound is " << getMaximalStepBound() << ").");
+    std::vector<ValueType> result(psiStates.size(), storm::utility::zero<ValueType>());
+    storm::utility::vector::setVectorValues(result, psiStates, storm::utility::one<ValueType>());
+    auto valueIt = values.begin() + stepBound * storedStatesInMaybeStates.size();
+    for (auto state : storedStates) {
+        result[state] = *valueIt;
+        ++valueIt;
+    }
+    return result;
+}
+
+template class StepBoundedHorizonResults<double>;
+template class StepBoundedHorizonResults<storm::RationalNumber>;
+template class StepBoundedHorizonResults<storm::RationalFunction>;
+
+}  // namespace helper
+}  // namespace modelchecker
+}  // namespace storm
@@ -0,0 +1,74 @@
+#pragma once
+
+#include <vector>
+
+#include "storm/storage/BitVector.h"
+
+namespace storm {
+namespace modelchecker {
+namespace helper {
+
+/*!
+ * Stores the results of a step bounded reachability query P=? [F<=k psi] for all step bounds k = 0, ..., n that are obtained within a single pass of
+ * value iteration. For each step bound, only the values of the stored states are kept (compactly) and full result vectors are only created on demand.
+ * The values of all other states are fixed, i.e., they are one for psi states and zero otherwise.
+ */
+template<typename ValueType>
+class StepBoundedHorizonResults {
+   public:
+    /*!
+     * Creates an empty result.
+     *
+     * @param psiStates The states whose value is one for every step bound.
+     * @param maybeStates The (non-psi) states whose values depend on the step bound. All other states have value zero for every step bound.
+     * @param storedStates The subset of the maybe states whose values are stored.
+     */
+    StepBoundedHorizonResults(storm::storage::BitVector const& psiStates, storm::storage::BitVector const& maybeStates,
+                              storm::storage::BitVector const& storedStates);
+
+    /*!
+     * Adds the result for the next step bound, i.e., for step bound getMaximalStepBound() + 1 (or 0 if there are no results yet).
+     *
+     * @param maybeStateValues The values of all maybe states (in the order of the maybe state indices).
+     */
+    void addResult(std::vector<ValueType> const& maybeStateValues);
+
+    /*!
+     * @return the number of step bounds for which results are available.
+     */
+    uint64_t getNumberOfStepBounds() const;
+
+    /*!
+     * @return the largest step bound for which a result is available.
+     */
+    uint64_t getMaximalStepBound() const;
+
+    /*!
+     * Retrieves the value of the given state for the given step bound.
+     * @pre the state is a psi state, a stored state, or not a maybe state.
+     */
+    ValueType getValue(uint64_t stepBound, uint64_t state) const;
+
+    /*!
+     * Materializes the full result vector for the given step bound.
+     * @note The values of maybe states that are not stored are set to zero.
+     */
+    std::vector<ValueType> getValues(uint64_t stepBound) const;
+
+   private:
+    storm::storage::BitVector psiStates;
+    storm::storage::BitVector maybeStates;
+    storm::storage::BitVector storedStates;
+
+    // For each stored state, the index of the state within the maybe states.
+    std::vector<uint64_t> storedStatesInMaybeStates;
+
+    // The values of the stored states for all step bounds, where the values for step bound k are stored at
+    // positions k * |storedStates|, ..., (k+1) * |storedStates| - 1.
+    std::vector<ValueType> values;
+    uint64_t numberOfStepBounds;
+};
+
+}  // namespace helper
+}  // namespace modelchecker
+}  // namespace storm
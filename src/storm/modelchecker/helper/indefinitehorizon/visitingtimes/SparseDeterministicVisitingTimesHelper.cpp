@@ -1,6 +1,7 @@
 #include "SparseDeterministicVisitingTimesHelper.h"
 
 #include <algorithm>
+#include "storm/adapters/IntelTbbAdapter.h"
 #include "storm/adapters/RationalFunctionAdapter.h"
 
 #include "storm/environment/solver/SolverEnvironment.h"
@@ -92,25 +93,25 @@ std::vector<ValueType> SparseDeterministicVisitingTimesHelper<ValueType>::comput
 
 template<typename ValueType>
 void SparseDeterministicVisitingTimesHelper<ValueType>::computeExpectedVisitingTimes(Environment const& env, std::vector<ValueType>& stateValues) {
-    STORM_LOG_ASSERT(stateValues.size() == transitionMatrix.getRowCount(), "Dimension missmatch.");
+    std::vector<std::vector<ValueType>> stateValuesPerDistribution;
+    stateValuesPerDistribution.push_back(std::move(stateValues));
+    computeExpectedVisitingTimes(env, stateValuesPerDistribution);
+    stateValues = std::move(stateValuesPerDistribution.front());
+}
+
+template<typename ValueType>
+void SparseDeterministicVisitingTimesHelper<ValueType>::computeExpectedVisitingTimes(Environment const& env,
+                                                                                     std::vector<std::vector<ValueType>>& stateValues) {
+    STORM_LOG_ASSERT(std::all_of(stateValues.begin(), stateValues.end(),
+                                 [this](auto const& values) { return values.size() == transitionMatrix.getRowCount(); }),
+                     "Dimension missmatch.");
+    if (stateValues.empty()) {
+        return;
+    }
     createBackwardTransitions();
     createDecomposition(env);
     createNonBsccStateVector();
 
-    // Create auxiliary data and lambdas
-    storm::storage::BitVector sccAsBitVector(stateValues.size(), false);
-    auto isLeavingTransition = [&sccAsBitVector](auto const& e) { return !sccAsBitVector.get(e.getColumn()); };
-    auto isLeavingTransitionWithNonZeroValue = [&isLeavingTransition, &stateValues](auto const& e) {
-        return isLeavingTransition(e) && !storm::utility::isZero(stateValues[e.getColumn()]);
-    };
-    auto isReachableInState = [this, &isLeavingTransitionWithNonZeroValue, &stateValues](uint64_t state) {
-        if (!storm::utility::isZero(stateValues[state])) {
-            return true;
-        }
-        auto row = this->backwardTransitions->getRow(state);
-        return std::any_of(row.begin(), row.end(), isLeavingTransitionWithNonZeroValue);
-    };
-
     if (env.solver().getLinearEquationSolverType() == storm::solver::EquationSolverType::Topological) {
         // Compute EVTs SCC wise in topological order
         // We need to adapt precision if we solve each SCC separately (in topological order) and/or consider CTMCs
@@ -121,32 +122,38 @@ void SparseDeterministicVisitingTimesHelper<ValueType>::computeExpectedVisitingT
         progress.setMaxCount(sccDecomposition->size());
         progress.startNewMeasurement(0);
         uint64_t sccIndex = 0;
-        auto sccItEnd = std::make_reverse_iterator(sccDecomposition->begin());
-        for (auto sccIt = std::make_reverse_iterator(sccDecomposition->end()); sccIt != sccItEnd; ++sccIt) {
-            auto const& scc = *sccIt;
-            if (scc.size() == 1) {
-                processSingletonScc(*scc.begin(), stateValues);
-            } else {
-                sccAsBitVector.set(scc.begin(), scc.end(), true);
-                if (sccAsBitVector.isSubsetOf(nonBsccStates)) {
-                    // This is not a BSCC
-                    auto sccResult = computeValueForStateSet(sccEnv, sccAsBitVector, stateValues);
-                    storm::utility::vector::setVectorValues(stateValues, sccAsBitVector, sccResult);
-                } else {
-                    // This is a BSCC
-                    if (std::any_of(sccAsBitVector.begin(), sccAsBitVector.end(), isReachableInState)) {
-                        storm::utility::vector::setVectorValues(stateValues, sccAsBitVector, storm::utility::infinity<ValueType>());
-                    } else {
-                        storm::utility::vector::setVectorValues(stateValues, sccAsBitVector, storm::utility::zero<ValueType>());
+#ifdef STORM_HAVE_INTELTBB
+        if (env.solver().isUseIntelTbb()) {
+            // SCCs of the same level only depend on SCCs of lower levels, so they can be processed in parallel.
+            for (auto const& level : computeSccLevels()) {
+                tbb::parallel_for(tbb::blocked_range<uint64_t>(0, level.size()), [&](tbb::blocked_range<uint64_t> const& range) {
+                    storm::storage::BitVector sccAsBitVector(transitionMatrix.getRowCount(), false);
+                    for (uint64_t levelIndex = range.begin(); levelIndex < range.end(); ++levelIndex) {
+                        processScc(sccEnv, (*sccDecomposition)[level[levelIndex]], sccAsBitVector, stateValues);
                     }
+                });
+                sccIndex += level.size();
+                progress.updateProgress(sccIndex);
+                if (storm::utility::resources::isTerminate()) {
+                    storm::utility::resources::reportAbortedComputation();
+                    STORM_LOG_WARN("Visiting times computation aborted after analyzing " << sccIndex << "/" << sccDecomposition->size() << " SCCs.");
+                    break;
                 }
-                sccAsBitVector.clear();
             }
-            ++sccIndex;
-            progress.updateProgress(sccIndex);
-            if (storm::utility::resources::isTerminate()) {
-                STORM_LOG_WARN("Visiting times computation aborted after analyzing " << sccIndex << "/" << this->computedSccDecomposition->size() << " SCCs.");
-                break;
+        } else
+#endif
+        {
+            storm::storage::BitVector sccAsBitVector(transitionMatrix.getRowCount(), false);
+            auto sccItEnd = std::make_reverse_iterator(sccDecomposition->begin());
+            for (auto sccIt = std::make_reverse_iterator(sccDecomposition->end()); sccIt != sccItEnd; ++sccIt) {
+                processScc(sccEnv, *sccIt, sccAsBitVector, stateValues);
+                ++sccIndex;
+                progress.updateProgress(sccIndex);
+                if (storm::utility::resources::isTerminate()) {
+                    storm::utility::resources::reportAbortedComputation();
+                    STORM_LOG_WARN("Visiting times computation aborted after analyzing " << sccIndex << "/" << sccDecomposition->size() << " SCCs.");
+                    break;
+                }
             }
         }
     } else {
@@ -154,23 +161,19 @@ void SparseDeterministicVisitingTimesHelper<ValueType>::computeExpectedVisitingT
         if (!nonBsccStates.empty()) {
             // We need to adapt precision if we consider CTMCs.
             Environment adjustedEnv = getEnvironmentForSolver(env, false);
-            auto result = computeValueForStateSet(adjustedEnv, nonBsccStates, stateValues);
-            storm::utility::vector::setVectorValues(stateValues, nonBsccStates, result);
+            computeValueForStateSet(adjustedEnv, nonBsccStates, stateValues);
         }
 
         // After computing the state values for the  non-BSCCs, we can set the values of the BSCC states.
+        storm::storage::BitVector sccAsBitVector(transitionMatrix.getRowCount(), false);
         auto sccItEnd = std::make_reverse_iterator(sccDecomposition->begin());
         for (auto sccIt = std::make_reverse_iterator(sccDecomposition->end()); sccIt != sccItEnd; ++sccIt) {
             auto const& scc = *sccIt;
             sccAsBitVector.set(scc.begin(), scc.end(), true);
             if (sccAsBitVector.isSubsetOf(~nonBsccStates)) {
                 // This is a BSCC, we set the values of the states to infinity or 0.
-                if (std::any_of(sccAsBitVector.begin(), sccAsBitVector.end(), isReachableInState)) {
-                    // The BSCC is reachable: The EVT is infinity
-                    storm::utility::vector::setVectorValues(stateValues, sccAsBitVector, storm::utility::infinity<ValueType>());
-                } else {
-                    // The BSCC is not reachable: The EVT is zero
-                    storm::utility::vector::setVectorValues(stateValues, sccAsBitVector, storm::utility::zero<ValueType>());
+                for (auto& values : stateValues) {
+                    processBscc(sccAsBitVector, values);
                 }
             }
             sccAsBitVector.clear();
@@ -180,9 +183,11 @@ void SparseDeterministicVisitingTimesHelper<ValueType>::computeExpectedVisitingT
     if (isContinuousTime()) {
         // Divide with the exit rates
         // Since storm::utility::infinity<storm::RationalNumber>() is just set to some big number, we have to treat the infinity-case explicitly.
-        storm::utility::vector::applyPointwise(stateValues, *exitRates, stateValues, [](ValueType const& xi, ValueType const& yi) -> ValueType {
-            return storm::utility::isInfinity(xi) ? xi : xi / yi;
-        });
+        for (auto& values : stateValues) {
+            storm::utility::vector::applyPointwise(values, *exitRates, values, [](ValueType const& xi, ValueType const& yi) -> ValueType {
+                return storm::utility::isInfinity(xi) ? xi : xi / yi;
+            });
+        }
     }
 }
 
@@ -404,6 +409,60 @@ storm::Environment SparseDeterministicVisitingTimesHelper<ValueType>::getEnviron
     return subEnv;
 }
 
+template<typename ValueType>
+std::vector<std::vector<uint64_t>> SparseDeterministicVisitingTimesHelper<ValueType>::computeSccLevels() const {
+    std::vector<uint64_t> stateToSccIndex(transitionMatrix.getRowCount());
+    for (uint64_t sccIndex = 0; sccIndex < sccDecomposition->size(); ++sccIndex) {
+        for (auto state : (*sccDecomposition)[sccIndex]) {
+            stateToSccIndex[state] = sccIndex;
+        }
+    }
+
+    // The level of an SCC is one plus the maximal level of its predecessor SCCs. Predecessors are processed first in *forward* topological order.
+    std::vector<uint64_t> sccLevels(sccDecomposition->size(), 0);
+    std::vector<std::vector<uint64_t>> result;
+    for (uint64_t sccIndex = sccDecomposition->size(); sccIndex > 0;) {
+        --sccIndex;
+        uint64_t& level = sccLevels[sccIndex];
+        for (auto state : (*sccDecomposition)[sccIndex]) {
+            for (auto const& entry : backwardTransitions->getRow(state)) {
+                uint64_t predecessorSccIndex = stateToSccIndex[entry.getColumn()];
+                if (predecessorSccIndex != sccIndex) {
+                    level = std::max(level, sccLevels[predecessorSccIndex] + 1);
+                }
+            }
+        }
+        if (level >= result.size()) {
+            result.resize(level + 1);
+        }
+        result[level].push_back(sccIndex);
+    }
+    return result;
+}
+
+template<typename ValueType>
+void SparseDeterministicVisitingTimesHelper<ValueType>::processScc(storm::Environment const& env, storm::storage::StronglyConnectedComponent const& scc,
+                                                                   storm::storage::BitVector& sccAsBitVector,
+                                                                   std::vector<std::vector<ValueType>>& stateValues) const {
+    if (scc.size() == 1) {
+        for (auto& values : stateValues) {
+            processSingletonScc(*scc.begin(), values);
+        }
+        return;
+    }
+    sccAsBitVector.set(scc.begin(), scc.end(), true);
+    if (sccAsBitVector.isSubsetOf(nonBsccStates)) {
+        // This is not a BSCC
+        computeValueForStateSet(env, sccAsBitVector, stateValues);
+    } else {
+        // This is a BSCC
+        for (auto& values : stateValues) {
+            processBscc(sccAsBitVector, values);
+        }
+    }
+    sccAsBitVector.clear();
+}
+
 template<typename ValueType>
 void SparseDeterministicVisitingTimesHelper<ValueType>::processSingletonScc(uint64_t sccState, std::vector<ValueType>& stateValues) const {
     auto& stateVal = stateValues[sccState];
@@ -431,21 +490,51 @@ void SparseDeterministicVisitingTimesHelper<ValueType>::processSingletonScc(uint
 }
 
 template<typename ValueType>
-std::vector<ValueType> SparseDeterministicVisitingTimesHelper<ValueType>::computeValueForStateSet(storm::Environment const& env,
-                                                                                                  storm::storage::BitVector const& stateSetAsBitvector,
-                                                                                                  std::vector<ValueType> const& stateValues) const {
-    // Get the vector for the equation system
-    auto sccVector = storm::utility::vector::filterVector(stateValues, stateSetAsBitvector);
-    auto valIt = sccVector.begin();
-    for (auto sccState : stateSetAsBitvector) {
-        for (auto const& entry : backwardTransitions->getRow(sccState)) {
-            if (!stateSetAsBitvector.get(entry.getColumn())) {
-                (*valIt) += entry.getValue() * stateValues[entry.getColumn()];
+void SparseDeterministicVisitingTimesHelper<ValueType>::processBscc(storm::storage::BitVector const& bsccAsBitVector,
+                                                                    std::vector<ValueType>& stateValues) const {
+    auto isLeavingTransitionWithNonZeroValue = [&bsccAsBitVector, &stateValues](auto const& e) {
+        return !bsccAsBitVector.get(e.getColumn()) && !storm::utility::isZero(stateValues[e.getColumn()]);
+    };
+    auto isReachableInState = [this, &isLeavingTransitionWithNonZeroValue, &stateValues](uint64_t state) {
+        if (!storm::utility::isZero(stateValues[state])) {
+            return true;
+        }
+        auto row = this->backwardTransitions->getRow(state);
+        return std::any_of(row.begin(), row.end(), isLeavingTransitionWithNonZeroValue);
+    };
+    if (std::any_of(bsccAsBitVector.begin(), bsccAsBitVector.end(), isReachableInState)) {
+        // The BSCC is reachable: The EVT is infinity
+        storm::utility::vector::setVectorValues(stateValues, bsccAsBitVector, storm::utility::infinity<ValueType>());
+    } else {
+        // The BSCC is not reachable: The EVT is zero
+        storm::utility::vector::setVectorValues(stateValues, bsccAsBitVector, storm::utility::zero<ValueType>());
+    }
+}
+
+template<typename ValueType>
+void SparseDeterministicVisitingTimesHelper<ValueType>::computeValueForStateSet(storm::Environment const& env,
+                                                                                storm::storage::BitVector const& stateSetAsBitvector,
+                                                                                std::vector<std::vector<ValueType>>& stateValues) const {
+    // Get the vectors for the equation system
+    std::vector<std::vector<ValueType>> sccVectors;
+    sccVectors.reserve(stateValues.size());
+    for (auto const& values : stateValues) {
+        auto sccVector = storm::utility::vector::filterVector(values, stateSetAsBitvector);
+        auto valIt = sccVector.begin();
+        for (auto sccState : stateSetAsBitvector) {
+            for (auto const& entry : backwardTransitions->getRow(sccState)) {
+                if (!stateSetAsBitvector.get(entry.getColumn())) {
+                    (*valIt) += entry.getValue() * values[entry.getColumn()];
+                }
             }
+            ++valIt;
         }
-        ++valIt;
+        sccVectors.push_back(std::move(sccVector));
+    }
+    auto sccResults = computeExpectedVisitingTimes(env, stateSetAsBitvector, sccVectors);
+    for (uint64_t i = 0; i < stateValues.size(); ++i) {
+        storm::utility::vector::setVectorValues(stateValues[i], stateSetAsBitvector, sccResults[i]);
     }
-    return computeExpectedVisitingTimes(env, stateSetAsBitvector, sccVector);
 }
 
 template<typename ValueType>
@@ -453,9 +542,18 @@ std::vector<ValueType> SparseDeterministicVisitingTimesHelper<ValueType>::comput
                                                                                                        storm::storage::BitVector const& subsystem,
                                                                                                        std::vector<ValueType> const& initialValues) const {
     STORM_LOG_ASSERT(subsystem.getNumberOfSetBits() == initialValues.size(), "Inconsistent size of subsystem.");
+    return std::move(computeExpectedVisitingTimes(env, subsystem, std::vector<std::vector<ValueType>>{initialValues}).front());
+}
 
-    if (initialValues.empty()) {  // Catch the case where the subsystem is empty.
-        return {};
+template<typename ValueType>
+std::vector<std::vector<ValueType>> SparseDeterministicVisitingTimesHelper<ValueType>::computeExpectedVisitingTimes(
+    Environment const& env, storm::storage::BitVector const& subsystem, std::vector<std::vector<ValueType>> const& initialValues) const {
+    STORM_LOG_ASSERT(std::all_of(initialValues.begin(), initialValues.end(),
+                                 [&subsystem](auto const& values) { return subsystem.getNumberOfSetBits() == values.size(); }),
+                     "Inconsistent size of subsystem.");
+
+    if (subsystem.empty()) {  // Catch the case where the subsystem is empty.
+        return std::vector<std::vector<ValueType>>(initialValues.size());
     }
 
     // Here we assume that the subsystem does not contain a BSCC
@@ -494,8 +592,12 @@ std::vector<ValueType> SparseDeterministicVisitingTimesHelper<ValueType>::comput
 
     STORM_LOG_THROW(!req.hasEnabledCriticalRequirement(), storm::exceptions::UnmetRequirementException,
                     "Solver requirements " + req.getEnabledRequirementsAsString() + " not checked.");
-    std::vector<ValueType> eqSysValues(initialValues.size());
-    solver->solveEquations(env, eqSysValues, initialValues);
+    std::vector<std::vector<ValueType>> eqSysValues;
+    eqSysValues.reserve(initialValues.size());
+    for (auto const& values : initialValues) {
+        eqSysValues.emplace_back(values.size());
+    }
+    solver->solveEquationsBatch(env, eqSysValues, initialValues);
     return eqSysValues;
 }
 
@@ -85,6 +85,14 @@ class SparseDeterministicVisitingTimesHelper : public SingleValueModelCheckerHel
      */
     void computeExpectedVisitingTimes(Environment const& env, std::vector<ValueType>& stateValues);
 
+    /*!
+     * Computes for each state the expected number of times we are visiting that state for each of the given initial distributions.
+     * The equation system of each SCC is set up only once and then solved for all distributions simultaneously.
+     * @pre each vector in parameter stateValues contains for each state the initial value (probability) for that state.
+     * @post each vector in parameter stateValues contains the desired values for the corresponding initial distribution
+     */
+    void computeExpectedVisitingTimes(Environment const& env, std::vector<std::vector<ValueType>>& stateValues);
+
     /*!
      * Computes for each selected state the expected number of times we are visiting that state assuming the given initial state probabilities
      * The interpretation of the subsystem is that once a path has exited the subsystem, all subsequent visits will be ignored.
@@ -101,6 +109,17 @@ class SparseDeterministicVisitingTimesHelper : public SingleValueModelCheckerHel
     std::vector<ValueType> computeExpectedVisitingTimes(Environment const& env, storm::storage::BitVector const& subsystem,
                                                         std::vector<ValueType> const& initialValues) const;
 
+    /*!
+     * Computes for each selected state the expected number of times we are visiting that state for each of the given initial distributions.
+     * The same assumptions on the subsystem as for the single distribution case apply.
+     *
+     * @param subsystem the set of states for which visiting times are computed.
+     * @param initialValues contains one vector for each initial distribution with the initial value of each subsystem state.
+     * @return the expected visiting times for the states in the subsystem, one vector for each initial distribution.
+     */
+    std::vector<std::vector<ValueType>> computeExpectedVisitingTimes(Environment const& env, storm::storage::BitVector const& subsystem,
+                                                                     std::vector<std::vector<ValueType>> const& initialValues) const;
+
    private:
     /*!
      * @return true iff this is a computation on a continuous time model (i.e. CTMC, MA)
@@ -143,17 +162,36 @@ class SparseDeterministicVisitingTimesHelper : public SingleValueModelCheckerHel
      */
     storm::Environment getEnvironmentForTopologicalSolver(storm::Environment const& env) const;
 
+    /*!
+     * Groups the SCCs into levels such that each SCC only depends on SCCs of lower levels.
+     * SCCs of the same level can thus be processed independently of each other.
+     * @return for each level the indices of the SCCs (w.r.t. the SCC decomposition) of that level
+     */
+    std::vector<std::vector<uint64_t>> computeSccLevels() const;
+
+    /*!
+     * Processes the given SCC for all initial distributions. The resulting values are directly inserted into stateValues.
+     * @param sccAsBitVector auxiliary bit vector of size #states with no set bits (also after processing)
+     */
+    void processScc(storm::Environment const& env, storm::storage::StronglyConnectedComponent const& scc, storm::storage::BitVector& sccAsBitVector,
+                    std::vector<std::vector<ValueType>>& stateValues) const;
+
     /*!
      * Processes (bottom or non-bottom SCCs consisting of a single state). The resulting value is directly inserted into stateValues
      */
     void processSingletonScc(uint64_t sccState, std::vector<ValueType>& stateValues) const;
 
     /*!
-     * Solves the equation system for non-singleton (subs)sets of the chain's non-bottom states.
-     * @return for each state of the given set the expected number of times that state is visited.
+     * Sets the values of the states of the given BSCC to infinity (if the BSCC is reachable) or zero (otherwise).
+     */
+    void processBscc(storm::storage::BitVector const& bsccAsBitVector, std::vector<ValueType>& stateValues) const;
+
+    /*!
+     * Solves the equation system for non-singleton (subs)sets of the chain's non-bottom states for all initial distributions.
+     * The resulting values are directly inserted into stateValues.
      */
-    std::vector<ValueType> computeValueForStateSet(storm::Environment const& env, storm::storage::BitVector const& stateSetAsBitVector,
-                                                   std::vector<ValueType> const& stateValues) const;
+    void computeValueForStateSet(storm::Environment const& env, storm::storage::BitVector const& stateSetAsBitVector,
+                                 std::vector<std::vector<ValueType>>& stateValues) const;
 
     storm::storage::SparseMatrix<ValueType> const& transitionMatrix;
     storm::OptionalRef<std::vector<ValueType> const> exitRates;
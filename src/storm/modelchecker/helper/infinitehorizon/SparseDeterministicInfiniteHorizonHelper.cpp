@@ -1,7 +1,9 @@
 #include "SparseDeterministicInfiniteHorizonHelper.h"
 
+#include <algorithm>
 #include <numeric>
 
+#include "storm/adapters/IntelTbbAdapter.h"
 #include "storm/adapters/RationalFunctionAdapter.h"
 #include "storm/modelchecker/helper/indefinitehorizon/visitingtimes/SparseDeterministicVisitingTimesHelper.h"
 #include "storm/modelchecker/helper/infinitehorizon/internal/ComponentUtility.h"
@@ -23,6 +25,7 @@
 #include "storm/environment/solver/TopologicalSolverEnvironment.h"
 
 #include "storm/exceptions/NotSupportedException.h"
+#include "storm/exceptions/UnexpectedException.h"
 #include "storm/exceptions/UnmetRequirementException.h"
 
 namespace storm {
@@ -53,6 +56,12 @@ void SparseDeterministicInfiniteHorizonHelper<ValueType>::createDecomposition()
     }
 }
 
+template<typename ValueType>
+bool SparseDeterministicInfiniteHorizonHelper<ValueType>::isParallelComponentAnalysisSupported(Environment const&) const {
+    // All methods for BSCCs only read the shared model data.
+    return true;
+}
+
 template<typename ValueType>
 ValueType SparseDeterministicInfiniteHorizonHelper<ValueType>::computeLraForComponent(Environment const& env, ValueGetter const& stateValueGetter,
                                                                                       ValueGetter const& actionValueGetter,
@@ -66,6 +75,12 @@ ValueType SparseDeterministicInfiniteHorizonHelper<ValueType>::computeLraForComp
         return trivialResult.second;
     }
 
+    // Small BSCCs are solved directly via their steady state distribution unless a method has been set explicitly.
+    if (env.solver().lra().isDetLraMethodSetFromDefault() && useDenseSteadyStateDistrForBscc(env, component)) {
+        STORM_LOG_TRACE("Computing LRA for BSCC of size " << component.size() << " using a dense steady state distribution.");
+        return computeLraForBsccSteadyStateDistr(env, stateValueGetter, actionValueGetter, component).first;
+    }
+
     // Solve nontrivial BSCC with the method specified  in the settings
     storm::solver::LraMethod method = env.solver().lra().getDetLraMethod();
     if ((storm::NumberTraits<ValueType>::IsExact || env.solver().isForceExact()) && env.solver().lra().isDetLraMethodSetFromDefault() &&
@@ -251,6 +266,9 @@ std::vector<ValueType> SparseDeterministicInfiniteHorizonHelper<ValueType>::comp
     if (bscc.size() == 1) {
         return {storm::utility::one<ValueType>()};
     }
+    if (useDenseSteadyStateDistrForBscc(env, bscc)) {
+        return computeSteadyStateDistrForBsccDense(env, bscc);
+    }
     // Prepare an environment for the underlying linear equation solver
     auto subEnv = env;
     if (subEnv.solver().getLinearEquationSolverType() == storm::solver::EquationSolverType::Topological) {
@@ -346,6 +364,95 @@ std::vector<ValueType> SparseDeterministicInfiniteHorizonHelper<ValueType>::comp
     return visitingTimes;
 }
 
+template<typename ValueType>
+bool SparseDeterministicInfiniteHorizonHelper<ValueType>::useDenseSteadyStateDistrForBscc(Environment const& env,
+                                                                                          storm::storage::StronglyConnectedComponent const& bscc) const {
+    // The dense solver does not provide any guarantees for inexact value types, which is why we do not use it for sound computations.
+    uint64_t const threshold = env.solver().lra().getDenseBsccSizeThreshold();
+    return bscc.size() > 1 && bscc.size() <= threshold && !env.solver().isForceSoundness();
+}
+
+template<typename ValueType>
+std::vector<ValueType> SparseDeterministicInfiniteHorizonHelper<ValueType>::computeSteadyStateDistrForBsccDense(
+    Environment const& env, storm::storage::StronglyConnectedComponent const& bscc) {
+    STORM_LOG_ASSERT(std::is_sorted(bscc.begin(), bscc.end()), "Expected that bsccs are sorted.");
+
+    // We solve the same equation system as computeSteadyStateDistrForBsccEqSys, i.e., A^t*x=0 where the last equation is replaced by x_0+...+x_n=1.
+    // However, we store the (small) matrix densely in row-major order and solve the system by Gaussian elimination with partial pivoting.
+    uint64_t const size = bscc.size();
+    std::unordered_map<uint64_t, uint64_t> toLocalIndexMap;
+    uint64_t localIndex = 0;
+    for (auto const& globalIndex : bscc) {
+        toLocalIndexMap[globalIndex] = localIndex;
+        ++localIndex;
+    }
+    std::vector<ValueType> denseMatrix(size * size, storm::utility::zero<ValueType>());
+    localIndex = 0;
+    for (auto const& globalIndex : bscc) {
+        ValueType rateAtState = this->isContinuousTime() ? (*this->_exitRates)[globalIndex] : storm::utility::one<ValueType>();
+        // Entry A[s,s'] is stored at position [s',s] of the transposed matrix.
+        denseMatrix[localIndex * size + localIndex] -= rateAtState;
+        for (auto const& entry : this->_transitionMatrix.getRow(globalIndex)) {
+            denseMatrix[toLocalIndexMap[entry.getColumn()] * size + localIndex] += rateAtState * entry.getValue();
+        }
+        ++localIndex;
+    }
+    std::fill(denseMatrix.begin() + (size - 1) * size, denseMatrix.end(), storm::utility::one<ValueType>());
+    std::vector<ValueType> steadyStateDistr(size, storm::utility::zero<ValueType>());
+    steadyStateDistr.back() = storm::utility::one<ValueType>();
+
+    // Forward elimination.
+    for (uint64_t pivotColumn = 0; pivotColumn < size; ++pivotColumn) {
+        uint64_t pivotRow = pivotColumn;
+        if constexpr (storm::NumberTraits<ValueType>::IsExact) {
+            // There are no numerical issues, so any non-zero pivot is fine.
+            while (pivotRow < size && storm::utility::isZero(denseMatrix[pivotRow * size + pivotColumn])) {
+                ++pivotRow;
+            }
+        } else {
+            for (uint64_t row = pivotColumn + 1; row < size; ++row) {
+                if (storm::utility::abs(denseMatrix[row * size + pivotColumn]) > storm::utility::abs(denseMatrix[pivotRow * size + pivotColumn])) {
+                    pivotRow = row;
+                }
+            }
+        }
+        STORM_LOG_THROW(pivotRow < size && !storm::utility::isZero(denseMatrix[pivotRow * size + pivotColumn]), storm::exceptions::UnexpectedException,
+                        "Steady state equation system of BSCC is singular.");
+        if (pivotRow != pivotColumn) {
+            std::swap_ranges(denseMatrix.begin() + pivotRow * size, denseMatrix.begin() + (pivotRow + 1) * size, denseMatrix.begin() + pivotColumn * size);
+            std::swap(steadyStateDistr[pivotRow], steadyStateDistr[pivotColumn]);
+        }
+        ValueType const& pivot = denseMatrix[pivotColumn * size + pivotColumn];
+        for (uint64_t row = pivotColumn + 1; row < size; ++row) {
+            if (storm::utility::isZero(denseMatrix[row * size + pivotColumn])) {
+                continue;
+            }
+            ValueType factor = denseMatrix[row * size + pivotColumn] / pivot;
+            denseMatrix[row * size + pivotColumn] = storm::utility::zero<ValueType>();
+            for (uint64_t column = pivotColumn + 1; column < size; ++column) {
+                denseMatrix[row * size + column] -= factor * denseMatrix[pivotColumn * size + column];
+            }
+            steadyStateDistr[row] -= factor * steadyStateDistr[pivotColumn];
+        }
+    }
+
+    // Back substitution.
+    for (uint64_t row = size; row > 0;) {
+        --row;
+        for (uint64_t column = row + 1; column < size; ++column) {
+            steadyStateDistr[row] -= denseMatrix[row * size + column] * steadyStateDistr[column];
+        }
+        steadyStateDistr[row] /= denseMatrix[row * size + row];
+    }
+
+    // As for the equation system approach, we normalize the values to counter numerical inaccuracies.
+    if (!storm::NumberTraits<ValueType>::IsExact && !env.solver().isForceExact()) {
+        ValueType sum = std::accumulate(steadyStateDistr.begin(), steadyStateDistr.end(), storm::utility::zero<ValueType>());
+        storm::utility::vector::scaleVectorInPlace<ValueType, ValueType>(steadyStateDistr, storm::utility::one<ValueType>() / sum);
+    }
+    return steadyStateDistr;
+}
+
 template<typename ValueType>
 std::vector<ValueType> SparseDeterministicInfiniteHorizonHelper<ValueType>::computeSteadyStateDistrForBsccEqSys(
     Environment const& env, storm::storage::StronglyConnectedComponent const& bscc) {
@@ -617,7 +724,7 @@ std::vector<ValueType> SparseDeterministicInfiniteHorizonHelper<ValueType>::comp
     auto bsccReachProbs = computeBsccReachabilityProbabilities(subEnv, initialDistributionGetter);
     // We are now ready to compute the resulting lra distribution
     std::vector<ValueType> steadyStateDistr(this->_transitionMatrix.getRowGroupCount(), storm::utility::zero<ValueType>());
-    for (uint64_t currentComponentIndex = 0; currentComponentIndex < this->_longRunComponentDecomposition->size(); ++currentComponentIndex) {
+    auto processComponent = [&](uint64_t currentComponentIndex) {
         auto const& component = (*this->_longRunComponentDecomposition)[currentComponentIndex];
         // Compute distribution for current bscc
         auto bsccDistr = this->computeSteadyStateDistrForBscc(subEnv, component);
@@ -634,6 +741,22 @@ std::vector<ValueType> SparseDeterministicInfiniteHorizonHelper<ValueType>::comp
             ++bsccDistrIt;
         }
         STORM_LOG_ASSERT(bsccDistrIt == bsccDistr.end(), "Unexpected number of entries in bscc distribution");
+    };
+#ifdef STORM_HAVE_INTELTBB
+    if (env.solver().isUseIntelTbb()) {
+        // The BSCCs write to disjoint parts of the result, so we can process them in parallel.
+        // Computations for single BSCCs might require the backward transitions, which we therefore build upfront.
+        this->createBackwardTransitions();
+        tbb::parallel_for(tbb::blocked_range<uint64_t>(0, this->_longRunComponentDecomposition->size()), [&](tbb::blocked_range<uint64_t> const& range) {
+            for (uint64_t currentComponentIndex = range.begin(); currentComponentIndex < range.end(); ++currentComponentIndex) {
+                processComponent(currentComponentIndex);
+            }
+        });
+        return steadyStateDistr;
+    }
+#endif
+    for (uint64_t currentComponentIndex = 0; currentComponentIndex < this->_longRunComponentDecomposition->size(); ++currentComponentIndex) {
+        processComponent(currentComponentIndex);
     }
     return steadyStateDistr;
 }
@@ -55,6 +55,8 @@ class SparseDeterministicInfiniteHorizonHelper : public SparseInfiniteHorizonHel
    protected:
     virtual void createDecomposition() override;
 
+    virtual bool isParallelComponentAnalysisSupported(Environment const& env) const override;
+
     /*!
      * Computes for each BSCC the probability to reach that SCC assuming the given distribution over initial states.
      */
@@ -69,6 +71,16 @@ class SparseDeterministicInfiniteHorizonHelper : public SparseInfiniteHorizonHel
     std::vector<ValueType> computeSteadyStateDistrForBsccEqSys(Environment const& env, storm::storage::StronglyConnectedComponent const& bscc);
     std::vector<ValueType> computeSteadyStateDistrForBsccEVTs(Environment const& env, storm::storage::StronglyConnectedComponent const& bscc);
 
+    /*!
+     * Computes the steady state distribution for the given (small) BSCC by solving the equation system densely using Gaussian elimination.
+     */
+    std::vector<ValueType> computeSteadyStateDistrForBsccDense(Environment const& env, storm::storage::StronglyConnectedComponent const& bscc);
+
+    /*!
+     * @return true if the given BSCC is small enough (w.r.t. the threshold in env) to be handled by computeSteadyStateDistrForBsccDense.
+     */
+    bool useDenseSteadyStateDistrForBscc(Environment const& env, storm::storage::StronglyConnectedComponent const& bscc) const;
+
     std::pair<bool, ValueType> computeLraForTrivialBscc(Environment const& env, ValueGetter const& stateValuesGetter, ValueGetter const& actionValuesGetter,
                                                         storm::storage::StronglyConnectedComponent const& bscc);
 
@@ -1,8 +1,12 @@
 #include "SparseInfiniteHorizonHelper.h"
 
+#include <algorithm>
+#include <numeric>
+
 #include "storm/modelchecker/helper/infinitehorizon/internal/ComponentUtility.h"
 #include "storm/modelchecker/helper/infinitehorizon/internal/LraViHelper.h"
 
+#include "storm/adapters/IntelTbbAdapter.h"
 #include "storm/adapters/RationalFunctionAdapter.h"
 #include "storm/models/sparse/StandardRewardModel.h"
 
@@ -169,11 +173,45 @@ std::vector<ValueType> SparseInfiniteHorizonHelper<ValueType, Nondeterministic>:
     progress.setMaxCount(_longRunComponentDecomposition->size());
     progress.startNewMeasurement(0);
     STORM_LOG_INFO("Computing long run average values for " << _longRunComponentDecomposition->size() << " " << componentString << " individually...");
-    std::vector<ValueType> componentLraValues;
-    componentLraValues.reserve(_longRunComponentDecomposition->size());
-    for (auto const& c : *_longRunComponentDecomposition) {
-        componentLraValues.push_back(computeLraForComponent(underlyingSolverEnvironment, stateRewardsGetter, actionRewardsGetter, c));
+    std::vector<ValueType> componentLraValues(_longRunComponentDecomposition->size());
+    // Keep track of the time spent for the individual components.
+    std::vector<uint64_t> componentTimesInMilliseconds(_longRunComponentDecomposition->size());
+    storm::utility::Stopwatch componentsWatch(true);
+    auto analyzeComponent = [&](uint64_t componentIndex) {
+        storm::utility::Stopwatch componentWatch(true);
+        componentLraValues[componentIndex] =
+            computeLraForComponent(underlyingSolverEnvironment, stateRewardsGetter, actionRewardsGetter, (*_longRunComponentDecomposition)[componentIndex]);
+        componentWatch.stop();
+        componentTimesInMilliseconds[componentIndex] = componentWatch.getTimeInMilliseconds();
+    };
+#ifdef STORM_HAVE_INTELTBB
+    if (env.solver().isUseIntelTbb() && isParallelComponentAnalysisSupported(underlyingSolverEnvironment)) {
+        // The components are independent of each other, so we can analyze them in parallel.
+        // Computations for single components might require the backward transitions, which we therefore build upfront.
+        createBackwardTransitions();
+        tbb::parallel_for(tbb::blocked_range<uint64_t>(0, _longRunComponentDecomposition->size()), [&](tbb::blocked_range<uint64_t> const& range) {
+            for (uint64_t componentIndex = range.begin(); componentIndex < range.end(); ++componentIndex) {
+                analyzeComponent(componentIndex);
+            }
+        });
         progress.updateProgress(componentLraValues.size());
+    } else
+#endif
+    {
+        for (uint64_t componentIndex = 0; componentIndex < _longRunComponentDecomposition->size(); ++componentIndex) {
+            analyzeComponent(componentIndex);
+            progress.updateProgress(componentIndex + 1);
+        }
+    }
+    componentsWatch.stop();
+    if (!componentTimesInMilliseconds.empty()) {
+        uint64_t slowestComponentIndex =
+            std::distance(componentTimesInMilliseconds.begin(), std::max_element(componentTimesInMilliseconds.begin(), componentTimesInMilliseconds.end()));
+        uint64_t summedComponentTimes = std::accumulate(componentTimesInMilliseconds.begin(), componentTimesInMilliseconds.end(), uint64_t(0));
+        STORM_LOG_INFO("Analyzing " << componentString << " took " << componentsWatch << " (" << summedComponentTimes
+                                    << "ms summed over all components). Slowest component has "
+                                    << (*_longRunComponentDecomposition)[slowestComponentIndex].size() << " states and took "
+                                    << componentTimesInMilliseconds[slowestComponentIndex] << "ms.");
     }
 
     // Solve the resulting SSP where end components are collapsed into single auxiliary states
@@ -123,6 +123,12 @@ class SparseInfiniteHorizonHelper : public SingleValueModelCheckerHelper<ValueTy
      */
     virtual void createDecomposition() = 0;
 
+    /*!
+     * @return true iff the components can be analyzed in parallel, i.e., concurrent calls of computeLraForComponent (for different components) are safe
+     * with the solution methods selected in the given environment.
+     */
+    virtual bool isParallelComponentAnalysisSupported(Environment const& env) const = 0;
+
     /*!
      * @pre if scheduler production is enabled and Nondeterministic is true, a choice for each state within a component must be set such that the choices yield
      * optimal values w.r.t. the individual components.
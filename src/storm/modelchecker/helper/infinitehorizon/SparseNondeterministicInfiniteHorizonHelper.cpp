@@ -75,6 +75,25 @@ void SparseNondeterministicInfiniteHorizonHelper<ValueType>::createDecomposition
     }
 }
 
+template<typename ValueType>
+storm::solver::LraMethod SparseNondeterministicInfiniteHorizonHelper<ValueType>::getMecLraMethod(Environment const& env) const {
+    storm::solver::LraMethod method = env.solver().lra().getNondetLraMethod();
+    if ((storm::NumberTraits<ValueType>::IsExact || env.solver().isForceExact()) && env.solver().lra().isNondetLraMethodSetFromDefault() &&
+        method != storm::solver::LraMethod::LinearProgramming) {
+        method = storm::solver::LraMethod::LinearProgramming;
+    } else if (env.solver().isForceSoundness() && env.solver().lra().isNondetLraMethodSetFromDefault() && method != storm::solver::LraMethod::ValueIteration) {
+        method = storm::solver::LraMethod::ValueIteration;
+    }
+    return method;
+}
+
+template<typename ValueType>
+bool SparseNondeterministicInfiniteHorizonHelper<ValueType>::isParallelComponentAnalysisSupported(Environment const& env) const {
+    // Value iteration only reads the shared model data and writes choices of states within the given MEC.
+    // LP solvers are not necessarily thread-safe, so we only analyze MECs in parallel with value iteration.
+    return getMecLraMethod(env) == storm::solver::LraMethod::ValueIteration;
+}
+
 template<typename ValueType>
 ValueType SparseNondeterministicInfiniteHorizonHelper<ValueType>::computeLraForComponent(Environment const& env, ValueGetter const& stateRewardsGetter,
                                                                                          ValueGetter const& actionRewardsGetter,
@@ -95,19 +114,11 @@ ValueType SparseNondeterministicInfiniteHorizonHelper<ValueType>::computeLraForC
     }
 
     // Solve nontrivial MEC with the method specified in the settings
-    storm::solver::LraMethod method = env.solver().lra().getNondetLraMethod();
-    if ((storm::NumberTraits<ValueType>::IsExact || env.solver().isForceExact()) && env.solver().lra().isNondetLraMethodSetFromDefault() &&
-        method != storm::solver::LraMethod::LinearProgramming) {
-        STORM_LOG_INFO(
-            "Selecting 'LP' as the solution technique for long-run properties to guarantee exact results. If you want to override this, please explicitly "
-            "specify a different LRA method.");
-        method = storm::solver::LraMethod::LinearProgramming;
-    } else if (env.solver().isForceSoundness() && env.solver().lra().isNondetLraMethodSetFromDefault() && method != storm::solver::LraMethod::ValueIteration) {
-        STORM_LOG_INFO(
-            "Selecting 'VI' as the solution technique for long-run properties to guarantee sound results. If you want to override this, please explicitly "
-            "specify a different LRA method.");
-        method = storm::solver::LraMethod::ValueIteration;
-    }
+    storm::solver::LraMethod method = getMecLraMethod(env);
+    STORM_LOG_INFO_COND(method == env.solver().lra().getNondetLraMethod(),
+                        "Selecting '" << storm::solver::toString(method) << "' as the solution technique for long-run properties to guarantee "
+                                      << (method == storm::solver::LraMethod::LinearProgramming ? "exact" : "sound")
+                                      << " results. If you want to override this, please explicitly specify a different LRA method.");
     STORM_LOG_ERROR_COND(!this->isProduceSchedulerSet() || method == storm::solver::LraMethod::ValueIteration,
                          "Scheduler generation not supported for the chosen LRA method. Try value-iteration.");
     if (method == storm::solver::LraMethod::LinearProgramming) {
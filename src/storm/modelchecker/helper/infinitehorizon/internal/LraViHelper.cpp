@@ -195,6 +195,7 @@ ValueType LraViHelper<ValueType, ComponentType, TransitionsType>::performValueIt
             break;
         }
         if (storm::utility::resources::isTerminate()) {
+            storm::utility::resources::reportAbortedComputation();
             break;
         }
         // If there will be a next iteration, we have to prepare it.
@@ -17,15 +17,16 @@ class ProductModel {
 
     typedef storm::storage::sparse::state_type state_type;
     typedef std::pair<state_type, state_type> product_state_type;
-    typedef std::map<product_state_type, state_type> product_state_to_product_index_map;
-    typedef std::vector<product_state_type> product_index_to_product_state_vector;
+    typedef typename storm::transformer::Product<Model>::compact_product_state_type compact_product_state_type;
+    typedef typename storm::transformer::Product<Model>::product_state_to_product_index_map product_state_to_product_index_map;
+    typedef typename storm::transformer::Product<Model>::product_index_to_product_state_vector product_index_to_product_state_vector;
 
     ProductModel(Model&& productModel, product_state_to_product_index_map&& productStateToProductIndex,
                  product_index_to_product_state_vector&& productIndexToProductState, storm::storage::BitVector&& acceptingStates)
-        : productModel(productModel),
-          productStateToProductIndex(productStateToProductIndex),
-          productIndexToProductState(productIndexToProductState),
-          acceptingStates(acceptingStates) {}
+        : productModel(std::move(productModel)),
+          productStateToProductIndex(std::move(productStateToProductIndex)),
+          productIndexToProductState(std::move(productIndexToProductState)),
+          acceptingStates(std::move(acceptingStates)) {}
 
     ProductModel(ProductModel<Model>&& product) = default;
     ProductModel& operator=(ProductModel<Model>&& product) = default;
@@ -55,11 +56,15 @@ class ProductModel {
     }
 
     state_type getProductStateIndex(state_type modelState, state_type automatonState) const {
-        return productStateToProductIndex.at(product_state_type(modelState, automatonState));
+        return productStateToProductIndex.at(compact_product_state_type(modelState, automatonState));
     }
 
     bool isValidProductState(state_type modelState, state_type automatonState) const {
-        return (productStateToProductIndex.count(product_state_type(modelState, automatonState)) > 0);
+        if (modelState > storm::transformer::Product<Model>::maximalNumberOfCompactStates ||
+            automatonState > storm::transformer::Product<Model>::maximalNumberOfCompactStates) {
+            return false;
+        }
+        return (productStateToProductIndex.count(compact_product_state_type(modelState, automatonState)) > 0);
     }
 
     storm::storage::BitVector liftFromAutomaton(const storm::storage::BitVector& vector) const {
@@ -22,6 +22,23 @@ namespace storm {
 namespace modelchecker {
 namespace helper {
 
+namespace {
+std::shared_ptr<storm::automata::DeterministicAutomaton> translateToDeterministicAutomaton(Environment const& env, storm::logic::Formula const& formula,
+                                                                                           bool dnf) {
+    boost::optional<std::string> ltl2daTool, cacheDirectory;
+    if (env.modelchecker().isLtl2daToolSet()) {
+        STORM_LOG_INFO("Using the external provided tool");
+        ltl2daTool = env.modelchecker().getLtl2daTool();
+    } else {
+        STORM_LOG_INFO("Using the internal version of SPOT");
+    }
+    if (env.modelchecker().isLtl2daCacheDirectorySet()) {
+        cacheDirectory = env.modelchecker().getLtl2daCacheDirectory();
+    }
+    return storm::automata::LTL2DeterministicAutomaton::ltl2da(formula, dnf, ltl2daTool, cacheDirectory);
+}
+}  // namespace
+
 template<typename ValueType, bool Nondeterministic>
 SparseLTLHelper<ValueType, Nondeterministic>::SparseLTLHelper(storm::storage::SparseMatrix<ValueType> const& transitionMatrix)
     : _transitionMatrix(transitionMatrix) {
@@ -118,39 +135,37 @@ storm::storage::BitVector SparseLTLHelper<ValueType, Nondeterministic>::computeA
             continue;
         }
 
+        // Determine the sets of states that an accepting MEC has to visit (once per conjunction rather than once per MEC, as each set is as large as
+        // the product). If one of them contains no allowed state, no MEC can be accepting and the decomposition can be skipped altogether.
+        std::vector<storm::storage::BitVector> infSets;
+        for (auto const& literal : conjunction) {
+            if (literal->isAtom()) {
+                const cpphoafparser::AtomAcceptance& atom = literal->getAtom();
+                if (atom.getType() == cpphoafparser::AtomAcceptance::TEMPORAL_INF) {
+                    const storm::storage::BitVector& accSet = acceptance.getAcceptanceSet(atom.getAcceptanceSet());
+                    infSets.push_back(atom.isNegated() ? ~accSet : accSet);
+                    infSets.back() &= allowed;
+                    if (infSets.back().empty()) {
+                        allowed.clear();
+                        break;
+                    }
+                }
+            }
+        }
+        if (allowed.empty()) {
+            continue;
+        }
+
         // Compute MECs in the allowed fragment
         storm::storage::MaximalEndComponentDecomposition<ValueType> mecs(transitionMatrix, backwardTransitions, allowed);
         allMECs += mecs.size();
         for (const auto& mec : mecs) {
+            // Fin-states have been removed and FALSE literals lead to an empty fragment, so only the Inf-sets remain to be checked.
             bool accepting = true;
-            for (auto const& literal : conjunction) {
-                if (literal->isTRUE()) {
-                    // skip
-
-                } else if (literal->isFALSE()) {
+            for (auto const& infSet : infSets) {
+                if (!mec.containsAnyState(infSet)) {
                     accepting = false;
                     break;
-                } else if (literal->isAtom()) {
-                    const cpphoafparser::AtomAcceptance& atom = literal->getAtom();
-                    const storm::storage::BitVector& accSet = acceptance.getAcceptanceSet(atom.getAcceptanceSet());
-                    if (atom.getType() == cpphoafparser::AtomAcceptance::TEMPORAL_INF) {
-                        if (atom.isNegated()) {
-                            if (!mec.containsAnyState(~accSet)) {
-                                accepting = false;
-                                break;
-                            }
-                        } else {
-                            if (!mec.containsAnyState(accSet)) {
-                                accepting = false;
-                                break;
-                            }
-                        }
-
-                    } else if (atom.getType() == cpphoafparser::AtomAcceptance::TEMPORAL_FIN) {
-                        // Do only sanity checks here.
-                        STORM_LOG_ASSERT(atom.isNegated() ? !mec.containsAnyState(~accSet) : !mec.containsAnyState(accSet),
-                                         "MEC contains Fin-states, which should have been removed");
-                    }
                 }
             }
 
@@ -235,12 +250,15 @@ std::vector<ValueType> SparseLTLHelper<ValueType, Nondeterministic>::computeDAPr
         this->_schedulerHelper.emplace(product->getProductModel().getNumberOfStates());
     }
 
+    // The backward transitions are needed for both the acceptance analysis and the probability computation, so they are only built once.
+    storm::storage::SparseMatrix<ValueType> productBackwardTransitions = product->getProductModel().getBackwardTransitions();
+
     // Compute accepting states
     storm::storage::BitVector acceptingStates;
     if (Nondeterministic) {
         STORM_LOG_INFO("Computing MECs and checking for acceptance...");
-        acceptingStates = computeAcceptingECs(*product->getAcceptance(), product->getProductModel().getTransitionMatrix(),
-                                              product->getProductModel().getBackwardTransitions(), product);
+        acceptingStates =
+            computeAcceptingECs(*product->getAcceptance(), product->getProductModel().getTransitionMatrix(), productBackwardTransitions, product);
 
     } else {
         STORM_LOG_INFO("Computing BSCCs and checking for acceptance...");
@@ -276,7 +294,7 @@ std::vector<ValueType> SparseLTLHelper<ValueType, Nondeterministic>::computeDAPr
     if (Nondeterministic) {
         MDPSparseModelCheckingHelperReturnType<ValueType> prodCheckResult =
             storm::modelchecker::helper::SparseMdpPrctlHelper<ValueType>::computeUntilProbabilities(
-                env, std::move(solveGoalProduct), product->getProductModel().getTransitionMatrix(), product->getProductModel().getBackwardTransitions(), bvTrue,
+                env, std::move(solveGoalProduct), product->getProductModel().getTransitionMatrix(), productBackwardTransitions, bvTrue,
                 acceptingStates, this->isQualitativeSet(),
                 this->isProduceSchedulerSet()  // Whether to create memoryless scheduler for the Model-DA Product.
             );
@@ -289,7 +307,7 @@ std::vector<ValueType> SparseLTLHelper<ValueType, Nondeterministic>::computeDAPr
 
     } else {
         prodNumericResult = storm::modelchecker::helper::SparseDtmcPrctlHelper<ValueType>::computeUntilProbabilities(
-            env, std::move(solveGoalProduct), product->getProductModel().getTransitionMatrix(), product->getProductModel().getBackwardTransitions(), bvTrue,
+            env, std::move(solveGoalProduct), product->getProductModel().getTransitionMatrix(), productBackwardTransitions, bvTrue,
             acceptingStates, this->isQualitativeSet());
     }
 
@@ -316,17 +334,8 @@ std::vector<ValueType> SparseLTLHelper<ValueType, Nondeterministic>::computeLTLP
     STORM_LOG_INFO(" in prefix format: " << ltlFormula->toPrefixString());
 
     // Convert LTL formula to a deterministic automaton
-    std::shared_ptr<storm::automata::DeterministicAutomaton> da;
-    if (env.modelchecker().isLtl2daToolSet()) {
-        // Use the external tool given via ltl2da
-        STORM_LOG_INFO("Using the external version of SPOT" );
-        da = storm::automata::LTL2DeterministicAutomaton::ltl2daExternalTool(*ltlFormula, env.modelchecker().getLtl2daTool());
-    } else {
-        // Use the internal tool (Spot)
-        // For nondeterministic models the acceptance condition is transformed into DNF
-        STORM_LOG_INFO("Using the internal version of SPOT" );
-        da = storm::automata::LTL2DeterministicAutomaton::ltl2daSpot(*ltlFormula, Nondeterministic);
-    }
+    // Use the external tool given via ltl2da or the internal tool (Spot). For nondeterministic models the acceptance condition is transformed into DNF
+    std::shared_ptr<storm::automata::DeterministicAutomaton> da = translateToDeterministicAutomaton(env, *ltlFormula, Nondeterministic);
 
     STORM_LOG_INFO("Deterministic automaton for LTL formula has " << da->getNumberOfStates() << " states, " << da->getAPSet().size()
                                                                   << " atomic propositions and " << *da->getAcceptance()->getAcceptanceExpression()
@@ -370,18 +379,7 @@ auto SparseLTLHelper<ValueType, Nondeterministic>::buildProductModel(Environment
         STORM_LOG_INFO(" in prefix format: " << ltlFormula1->toPrefixString());
 
         // Convert LTL formula to a deterministic automaton
-        std::shared_ptr<storm::automata::DeterministicAutomaton> da;
-        if (env.modelchecker().isLtl2daToolSet()) {
-            // Use the external tool given via ltl2da
-            STORM_LOG_INFO("Using the external provided tool" );
-            da = storm::automata::LTL2DeterministicAutomaton::ltl2daExternalTool(*ltlFormula1,
-                                                                                 env.modelchecker().getLtl2daTool());
-        } else {
-            // Use the internal tool (Spot)
-            // For nondeterministic models the acceptance condition is transformed into DNF
-            STORM_LOG_INFO("Using the internal version of SPOT" );
-            da = storm::automata::LTL2DeterministicAutomaton::ltl2daSpot(*ltlFormula1, Nondeterministic);
-        }
+        std::shared_ptr<storm::automata::DeterministicAutomaton> da = translateToDeterministicAutomaton(env, *ltlFormula1, Nondeterministic);
 
         STORM_LOG_INFO("Deterministic automaton for LTL formula has " << da->getNumberOfStates() << " states, "
                                                                       << da->getAPSet().size()
@@ -1,17 +1,16 @@
 #include "storm/modelchecker/lexicographic/lexicographicModelCheckerHelper.h"
-#include "storm//modelchecker/prctl/helper/SparseMdpPrctlHelper.h"
 #include "storm/automata/APSet.h"
 #include "storm/automata/DeterministicAutomaton.h"
 #include "storm/environment/SubEnvironment.h"
+#include "storm/environment/solver/MinMaxSolverEnvironment.h"
 #include "storm/exceptions/NotImplementedException.h"
 #include "storm/logic/ExtractMaximalStateFormulasVisitor.h"
 #include "storm/logic/Formula.h"
-#include "storm/modelchecker/hints/ExplicitModelCheckerHint.h"
 #include "storm/modelchecker/lexicographic/spotHelper/spotProduct.h"
 #include "storm/models/sparse/Mdp.h"
-#include "storm/storage/SchedulerChoice.h"
+#include "storm/solver/helper/ValueIterationHelper.h"
 #include "storm/transformer/EndComponentEliminator.h"
-#include "storm/transformer/SubsystemBuilder.h"
+#include "storm/utility/vector.h"
 
 namespace storm {
 namespace modelchecker {
@@ -121,43 +120,41 @@ MDPSparseModelCheckingHelperReturnType<ValueType> lexicographicModelCheckerHelpe
         eliminator.transform(newMatrixWithNewStates, mecs, eliminationStates, storm::storage::BitVector(eliminationStates.size(), false), true);
 
     STORM_LOG_ASSERT(!mecLexArray.empty(), "No MECs in the model!");
-    std::vector<std::vector<bool>> bccLexArrayCurrent(mecLexArray);
     // prepare the result (one reachability probability for each objective)
     MDPSparseModelCheckingHelperReturnType<ValueType> retResult(std::vector<ValueType>(mecLexArray[0].size()));
-    std::vector<uint_fast64_t> compressedToReducedMapping(compressionResult.matrix.getColumnCount());
-    std::iota(std::begin(compressedToReducedMapping), std::end(compressedToReducedMapping), 0);
-    storm::storage::SparseMatrix<ValueType> transitionMatrix = compressionResult.matrix;
+    storm::storage::SparseMatrix<ValueType> const& transitionMatrix = compressionResult.matrix;
+
+    // Get the initial states in the compressed model
+    std::vector<uint_fast64_t> initialStates;
+    for (auto const& state : originalMdp.getInitialStates()) {
+        initialStates.push_back(compressionResult.oldToNewStateMapping[state]);
+    }
+
+    // All objectives are solved on the same matrix with the same value iteration operator.
+    // Instead of building a subsystem after each objective, the choices that are not optimal are masked out.
+    Environment env;
+    auto viOperator = std::make_shared<storm::solver::helper::ValueIterationOperator<ValueType, false>>();
+    viOperator->setMatrixBackwards(transitionMatrix);
+    storm::storage::BitVector allowedChoices(transitionMatrix.getRowCount(), true);
+    std::vector<ValueType> values(transitionMatrix.getRowGroupCount());
 
     // check reachability for each condition and restrict the model to optimal choices
     for (uint condition = 0; condition < mecLexArray[0].size(); condition++) {
         // get the goal-states for this objective (i.e. the st-states of the MECs where the objective can be fulfilled
-        storm::storage::BitVector psiStates = getGoodStates(mecs, bccLexArrayCurrent, compressionResult.oldToNewStateMapping, condition,
-                                                            transitionMatrix.getColumnCount(), compressedToReducedMapping, bccToStStateMapping);
-        if (psiStates.getNumberOfSetBits() == 0) {
+        storm::storage::BitVector psiStates =
+            getGoodStates(mecs, mecLexArray, compressionResult.oldToNewStateMapping, condition, transitionMatrix.getColumnCount(), bccToStStateMapping);
+        if (psiStates.getNumberOfSetBits() == 0 || initialStates.empty()) {
             retResult.values[condition] = 0;
             continue;
         }
 
         // solve the reachability query for this set of goal states
-        std::vector<uint_fast64_t> newInitalStates;
-        auto res =
-            solveOneReachability(newInitalStates, psiStates, transitionMatrix, originalMdp, compressedToReducedMapping, compressionResult.oldToNewStateMapping);
-        if (newInitalStates.empty()) {
-            retResult.values[condition] = 0;
-            continue;
-        }
-        retResult.values[condition] = res.values[newInitalStates[0]];
-
-        // create a reduced subsystem that only contains the optimal actions for this objective
-        auto subsystem = getReducedSubsystem(transitionMatrix, res, newInitalStates, psiStates);
-        std::vector<uint_fast64_t> compressedToReducedMappingTemp;
-        compressedToReducedMappingTemp.reserve(compressedToReducedMapping.size());
-        // create a new mapping for the states
-        for (uint_fast64_t newState : subsystem.newToOldStateIndexMapping) {
-            compressedToReducedMappingTemp.push_back(compressedToReducedMapping[newState]);
-        }
-        compressedToReducedMapping = compressedToReducedMappingTemp;
-        transitionMatrix = subsystem.model->getTransitionMatrix();
+        solveOneReachability(env, viOperator, psiStates, values);
+        retResult.values[condition] = values[initialStates[0]];
+
+        // only keep the actions that are optimal for this objective
+        restrictToOptimalChoices(transitionMatrix, values, allowedChoices);
+        viOperator->setIgnoredRows(false, [&allowedChoices](uint64_t, uint64_t row) { return !allowedChoices.get(row); });
     }
     return retResult;
 }
@@ -257,7 +254,7 @@ template<typename SparseModelType, typename ValueType, bool Nondeterministic>
 storm::storage::BitVector lexicographicModelCheckerHelper<SparseModelType, ValueType, Nondeterministic>::getGoodStates(
     storm::storage::MaximalEndComponentDecomposition<ValueType> const& bcc, std::vector<std::vector<bool>> const& bccLexArray,
     std::vector<uint_fast64_t> const& oldToNewStateMapping, uint const& condition, uint const numStates,
-    std::vector<uint_fast64_t> const& compressedToReducedMapping, std::map<uint, uint_fast64_t> const& bccToStStateMapping) {
+    std::map<uint, uint_fast64_t> const& bccToStStateMapping) {
     STORM_LOG_ASSERT(!bccLexArray.empty(), "Lex-Array is empty!");
     STORM_LOG_ASSERT(condition < bccLexArray[0].size(), "Condition is not in Lex-Array!");
     std::vector<uint_fast64_t> goodStates;
@@ -265,92 +262,56 @@ storm::storage::BitVector lexicographicModelCheckerHelper<SparseModelType, Value
         std::vector<bool> const& bccLex = bccLexArray[i];
         if (bccLex[condition]) {
             uint_fast64_t bccStateOld = bccToStStateMapping.at(i);
-            uint_fast64_t bccState = oldToNewStateMapping[bccStateOld];
-            auto pointer = std::find(compressedToReducedMapping.begin(), compressedToReducedMapping.end(), bccState);
-            if (pointer != compressedToReducedMapping.end()) {
-                // We have to check whether the state has already been removed
-                uint_fast64_t bccStateReduced = pointer - compressedToReducedMapping.begin();
-                goodStates.push_back(bccStateReduced);
-            }
+            goodStates.push_back(oldToNewStateMapping[bccStateOld]);
         }
     }
     return {numStates, goodStates};
 }
 
 template<typename SparseModelType, typename ValueType, bool Nondeterministic>
-MDPSparseModelCheckingHelperReturnType<ValueType> lexicographicModelCheckerHelper<SparseModelType, ValueType, Nondeterministic>::solveOneReachability(
-    std::vector<uint_fast64_t>& newInitalStates, storm::storage::BitVector const& psiStates, storm::storage::SparseMatrix<ValueType> const& transitionMatrix,
-    SparseModelType const& originalMdp, std::vector<uint_fast64_t> const& compressedToReducedMapping, std::vector<uint_fast64_t> const& oldToNewStateMapping) {
-    Environment env;
-    // A reachability condition "F x" is transformed to "true U x"
-    // phi states are all states
-    // psi states are the ones from the "good bccs"
-    storm::storage::BitVector phiStates(transitionMatrix.getColumnCount(), true);
-
-    // Get initial states in the compressed model
-    storm::storage::BitVector const& originalInitialStates = originalMdp.getInitialStates();
-
-    uint pos = 0;
-    while (originalInitialStates.getNextSetIndex(pos) != originalInitialStates.size()) {
-        pos = originalInitialStates.getNextSetIndex(pos) + 1;
-        auto pointer = std::find(compressedToReducedMapping.begin(), compressedToReducedMapping.end(), oldToNewStateMapping[pos - 1]);
-        if (pointer != compressedToReducedMapping.end()) {
-            newInitalStates.push_back(pointer - compressedToReducedMapping.begin());
-        }
-    }
-    storm::storage::BitVector i(transitionMatrix.getColumnCount(), newInitalStates);
-
-    ModelCheckerHint hint;
-    MDPSparseModelCheckingHelperReturnType<ValueType> ret = storm::modelchecker::helper::SparseMdpPrctlHelper<ValueType>::computeUntilProbabilities(
-        env, storm::solver::SolveGoal<ValueType>(storm::solver::OptimizationDirection::Maximize, i), transitionMatrix, transitionMatrix.transpose(true),
-        phiStates, psiStates, false, true, hint);
-    return ret;
+void lexicographicModelCheckerHelper<SparseModelType, ValueType, Nondeterministic>::solveOneReachability(
+    Environment const& env, std::shared_ptr<storm::solver::helper::ValueIterationOperator<ValueType, false>> const& viOperator,
+    storm::storage::BitVector const& psiStates, std::vector<ValueType>& values) {
+    // A reachability condition "F x" is solved by iterating from below, where the psi states are the ones from the "good bccs".
+    // The psi states are sink states, so their value remains one.
+    storm::utility::vector::setVectorValues(values, psiStates, storm::utility::one<ValueType>());
+    storm::utility::vector::setVectorValues(values, ~psiStates, storm::utility::zero<ValueType>());
+    std::vector<ValueType> offsets(viOperator->getRowGroupIndices().back(), storm::utility::zero<ValueType>());
+
+    storm::solver::helper::ValueIterationHelper<ValueType, false> viHelper(viOperator);
+    uint64_t numIterations = 0;
+    auto status = viHelper.VI(values, offsets, numIterations, env.solver().minMax().getRelativeTerminationCriterion(),
+                              storm::utility::convertNumber<ValueType>(env.solver().minMax().getPrecision()), storm::solver::OptimizationDirection::Maximize,
+                              {}, env.solver().minMax().getMultiplicationStyle());
+    STORM_LOG_WARN_COND(status == storm::solver::SolverStatus::Converged, "Value iteration for a lexicographic objective did not converge.");
+    STORM_LOG_INFO("Solved reachability for a lexicographic objective after " << numIterations << " iterations.");
 }
 
 template<typename SparseModelType, typename ValueType, bool Nondeterministic>
-typename lexicographicModelCheckerHelper<SparseModelType, ValueType, Nondeterministic>::SubsystemReturnType
-lexicographicModelCheckerHelper<SparseModelType, ValueType, Nondeterministic>::getReducedSubsystem(
-    storm::storage::SparseMatrix<ValueType> const& transitionMatrix, MDPSparseModelCheckingHelperReturnType<ValueType> const& reachabilityResult,
-    std::vector<uint_fast64_t> const& newInitalStates, storm::storage::BitVector const& goodStates) {
-    std::vector<std::vector<uint>> optimalActions;
-    std::vector<uint_fast64_t> keptActions;
+void lexicographicModelCheckerHelper<SparseModelType, ValueType, Nondeterministic>::restrictToOptimalChoices(
+    storm::storage::SparseMatrix<ValueType> const& transitionMatrix, std::vector<ValueType> const& values, storm::storage::BitVector& allowedChoices) {
     std::vector<uint_fast64_t> const& rowGroupIndices = transitionMatrix.getRowGroupIndices();
+    std::vector<ValueType> actionValues;
 
     // iterate over the states
-    for (uint currentState = 0; currentState < reachabilityResult.values.size(); currentState++) {
-        std::vector<uint> goodActionsForState;
-        uint_fast64_t bestAction = reachabilityResult.scheduler->getChoice(currentState).getDeterministicChoice();
-        // determine the value of the best action
-        ValueType bestActionValue(0);
-        for (const storm::storage::MatrixEntry<uint_fast64_t, ValueType>& rowEntry : transitionMatrix.getRow(rowGroupIndices[currentState] + bestAction)) {
-            bestActionValue += rowEntry.getValue() * reachabilityResult.values[rowEntry.getColumn()];
-        }
-        uint lastAction = rowGroupIndices[currentState] + transitionMatrix.getRowGroupSize(currentState);
-        // iterate over all actions in this state to find those that are also optimal
-        for (uint action = rowGroupIndices[currentState]; action < lastAction; action++) {
-            ValueType actionValue(0);
-            for (const auto& rowEntry : transitionMatrix.getRow(action)) {
-                actionValue += rowEntry.getValue() * reachabilityResult.values[rowEntry.getColumn()];
+    for (uint_fast64_t currentState = 0; currentState < transitionMatrix.getRowGroupCount(); currentState++) {
+        // determine the value of the best action that is still available
+        actionValues.clear();
+        ValueType bestActionValue = storm::utility::zero<ValueType>();
+        for (uint_fast64_t action = rowGroupIndices[currentState]; action < rowGroupIndices[currentState + 1]; action++) {
+            ValueType actionValue = transitionMatrix.multiplyRowWithVector(action, values);
+            if (allowedChoices.get(action)) {
+                bestActionValue = std::max(bestActionValue, actionValue);
             }
-            if (actionValue == bestActionValue) {
-                goodActionsForState.push_back(action);
-                keptActions.push_back(action);
+            actionValues.push_back(std::move(actionValue));
+        }
+        // only keep the actions that are also optimal
+        for (uint_fast64_t action = rowGroupIndices[currentState]; action < rowGroupIndices[currentState + 1]; action++) {
+            if (actionValues[action - rowGroupIndices[currentState]] != bestActionValue) {
+                allowedChoices.set(action, false);
             }
         }
-        optimalActions.push_back(goodActionsForState);
-    }
-    storm::storage::BitVector subSystemActions(transitionMatrix.getRowCount(), keptActions);
-    storm::storage::BitVector subSystemStates(transitionMatrix.getRowGroupCount(), true);
-    transformer::SubsystemBuilderOptions sbo;
-    sbo.fixDeadlocks = true;
-    storm::models::sparse::StateLabeling stateLabelling(transitionMatrix.getColumnCount());
-    stateLabelling.addLabel("init");
-    for (auto const& state : newInitalStates) {
-        stateLabelling.addLabelToState("init", state);
     }
-    storm::models::sparse::Mdp<ValueType> newModel(transitionMatrix, stateLabelling);
-    SubsystemReturnType subsystemReturn = transformer::buildSubsystem(newModel, subSystemStates, subSystemActions, false, sbo);
-    return subsystemReturn;
 }
 
 template<typename SparseModelType, typename ValueType, bool Nondeterministic>
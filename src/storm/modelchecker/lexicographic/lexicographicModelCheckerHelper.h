@@ -8,6 +8,7 @@
 #include "storm/models/ModelRepresentation.h"
 #include "storm/models/sparse/Dtmc.h"
 #include "storm/models/sparse/Mdp.h"
+#include "storm/solver/helper/ValueIterationOperator.h"
 #include "storm/storage/BitVector.h"
 #include "storm/storage/MaximalEndComponentDecomposition.h"
 #include "storm/storage/SparseMatrix.h"
@@ -104,33 +105,29 @@ class lexicographicModelCheckerHelper : public helper::SingleValueModelCheckerHe
      * @param condition the condition to be checked
      * @param numStatesTotal the number of states in total in the compressed model
      * @param mecToStateMapping mapping of the MECs to their corresponding sink state
-     * @param compressedToReducedMapping mapping of the compressed model to the reduced to optimal
      * @return set of "good" states for the given condition
      */
     storm::storage::BitVector getGoodStates(storm::storage::MaximalEndComponentDecomposition<ValueType> const& bcc,
                                             std::vector<std::vector<bool>> const& bccLexArray, std::vector<uint_fast64_t> const& oldToNewStateMapping,
-                                            uint const& condition, uint const numStates, std::vector<uint_fast64_t> const& compressedToReducedMapping,
-                                            std::map<uint, uint_fast64_t> const& bccToStStateMapping);
+                                            uint const& condition, uint const numStates, std::map<uint, uint_fast64_t> const& bccToStStateMapping);
 
     /*!
-     * Solves the reachability-query for a given set of goal-states and initial-states
+     * Solves the reachability-query for a given set of goal-states, considering only the rows of the matrix that are not ignored by the operator
+     * @param viOperator value iteration operator for the (compressed) transition matrix
+     * @param psiStates the goal-states, which need to be sink states
+     * @param values vector that holds the reachability value for each state afterwards
      */
-    MDPSparseModelCheckingHelperReturnType<ValueType> solveOneReachability(std::vector<uint_fast64_t>& newInitalStates,
-                                                                           storm::storage::BitVector const& psiStates,
-                                                                           storm::storage::SparseMatrix<ValueType> const& transitionMatrix,
-                                                                           SparseModelType const& originalMdp,
-                                                                           std::vector<uint_fast64_t> const& compressedToReducedMapping,
-                                                                           std::vector<uint_fast64_t> const& oldToNewStateMapping);
+    void solveOneReachability(Environment const& env, std::shared_ptr<storm::solver::helper::ValueIterationOperator<ValueType, false>> const& viOperator,
+                              storm::storage::BitVector const& psiStates, std::vector<ValueType>& values);
 
     /*!
-     * Reduces the model to actions that are optimal for the given strategy.
-     * @param transitionMatrix current transition matrix
-     * @param reachabilityResult result of the reachability query, that contains (i) the reachability value for each state, and (ii) the optimal scheduler
-     * @return
+     * Restricts the allowed actions to those that are optimal w.r.t. the given values.
+     * @param transitionMatrix the (compressed) transition matrix
+     * @param values result of the reachability query
+     * @param allowedChoices the actions that are still allowed, will be restricted in place
      */
-    SubsystemReturnType getReducedSubsystem(storm::storage::SparseMatrix<ValueType> const& transitionMatrix,
-                                            MDPSparseModelCheckingHelperReturnType<ValueType> const& reachabilityResult,
-                                            std::vector<uint_fast64_t> const& newInitalStates, storm::storage::BitVector const& goodStates);
+    void restrictToOptimalChoices(storm::storage::SparseMatrix<ValueType> const& transitionMatrix, std::vector<ValueType> const& values,
+                                  storm::storage::BitVector& allowedChoices);
 
     /*!
      * add a new sink-state for each MEC
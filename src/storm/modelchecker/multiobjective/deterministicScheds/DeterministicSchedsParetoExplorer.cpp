@@ -1,4 +1,5 @@
 #include <algorithm>
+#include <iterator>
 #include <sstream>
 
 #include "storm/environment/modelchecker/MultiObjectiveModelCheckerEnvironment.h"
@@ -307,6 +308,7 @@ DeterministicSchedsParetoExplorer<SparseModelType, GeometryValueType>::Determini
     lpChecker = std::make_shared<DeterministicSchedsLpChecker<SparseModelType, GeometryValueType>>(*model, objectiveHelper);
     if (preprocessorResult.containsOnlyTotalRewardFormulas()) {
         wvChecker = storm::modelchecker::multiobjective::WeightVectorCheckerFactory<SparseModelType>::create(preprocessorResult);
+        wvBatchChecker = std::make_unique<PcaaWeightVectorBatchChecker<SparseModelType>>(preprocessorResult);
     } else {
         wvChecker = nullptr;
     }
@@ -356,9 +358,17 @@ std::unique_ptr<CheckResult> DeterministicSchedsParetoExplorer<SparseModelType,
         eps = std::vector<GeometryValueType>(objectives.size(), ei);
     }
     while (!unprocessedFacets.empty()) {
-        Facet f = std::move(unprocessedFacets.front());
-        unprocessedFacets.pop();
-        processFacet(env, f);
+        // Take a batch of facets whose normal vectors can be checked concurrently. The facets are still processed in the order of the queue.
+        std::vector<Facet> facets;
+        uint64_t batchSize = wvChecker ? env.modelchecker().multi().getWeightVectorBatchSize() : 1;
+        while (!unprocessedFacets.empty() && facets.size() < batchSize) {
+            facets.push_back(std::move(unprocessedFacets.front()));
+            unprocessedFacets.pop();
+        }
+        auto wvResults = checkWeightVectors(env, facets);
+        for (uint64_t facetIndex = 0; facetIndex < facets.size(); ++facetIndex) {
+            processFacet(env, facets[facetIndex], wvChecker ? &wvResults[facetIndex] : nullptr);
+        }
     }
 
     std::vector<std::vector<ModelValueType>> paretoPoints;
@@ -462,16 +472,29 @@ void DeterministicSchedsParetoExplorer<SparseModelType, GeometryValueType>::nega
 
 template<class SparseModelType, typename GeometryValueType>
 void DeterministicSchedsParetoExplorer<SparseModelType, GeometryValueType>::initializeFacets(Environment const& env) {
+    // The weight vectors for the individual objectives are independent, so we check them in batches.
+    std::vector<typename PcaaWeightVectorBatchChecker<SparseModelType>::Result> wvResults;
+    if (wvChecker) {
+        uint64_t batchSize = env.modelchecker().multi().getWeightVectorBatchSize();
+        for (uint64_t firstObjIndex = 0; firstObjIndex < objectives.size(); firstObjIndex += batchSize) {
+            std::vector<std::vector<ModelValueType>> weightVectors;
+            for (uint64_t objIndex = firstObjIndex; objIndex < std::min<uint64_t>(firstObjIndex + batchSize, objectives.size()); ++objIndex) {
+                weightVectors.emplace_back(objectives.size(), storm::utility::zero<ModelValueType>());
+                weightVectors.back()[objIndex] = storm::utility::one<ModelValueType>();
+            }
+            auto batchResults = wvBatchChecker->check(env, *wvChecker, weightVectors);
+            std::move(batchResults.begin(), batchResults.end(), std::back_inserter(wvResults));
+        }
+    }
     for (uint64_t objIndex = 0; objIndex < objectives.size(); ++objIndex) {
         std::vector<GeometryValueType> weightVector(objectives.size(), storm::utility::zero<GeometryValueType>());
         weightVector[objIndex] = storm::utility::one<GeometryValueType>();
         std::vector<GeometryValueType> pointCoord;
         GeometryValueType offset;
         if (wvChecker) {
-            wvChecker->check(env, storm::utility::vector::convertNumericVector<ModelValueType>(weightVector));
-            pointCoord = storm::utility::vector::convertNumericVector<GeometryValueType>(wvChecker->getUnderApproximationOfInitialStateResults());
+            pointCoord = storm::utility::vector::convertNumericVector<GeometryValueType>(wvResults[objIndex].underApproximation);
             negateMinObjectives(pointCoord);
-            auto upperBoundPoint = storm::utility::vector::convertNumericVector<GeometryValueType>(wvChecker->getOverApproximationOfInitialStateResults());
+            auto upperBoundPoint = storm::utility::vector::convertNumericVector<GeometryValueType>(wvResults[objIndex].overApproximation);
             negateMinObjectives(upperBoundPoint);
             offset = storm::utility::vector::dotProduct(weightVector, upperBoundPoint);
         } else {
@@ -516,12 +539,27 @@ std::vector<GeometryValueType> DeterministicSchedsParetoExplorer<SparseModelType
 }
 
 template<class SparseModelType, typename GeometryValueType>
-void DeterministicSchedsParetoExplorer<SparseModelType, GeometryValueType>::processFacet(Environment const& env, Facet& f) {
+std::vector<typename PcaaWeightVectorBatchChecker<SparseModelType>::Result>
+DeterministicSchedsParetoExplorer<SparseModelType, GeometryValueType>::checkWeightVectors(Environment const& env, std::vector<Facet> const& facets) {
+    if (!wvChecker) {
+        return {};
+    }
+    std::vector<std::vector<ModelValueType>> weightVectors;
+    weightVectors.reserve(facets.size());
+    for (auto const& f : facets) {
+        weightVectors.push_back(storm::utility::vector::convertNumericVector<ModelValueType>(f.getHalfspace().normalVector()));
+    }
+    return wvBatchChecker->check(env, *wvChecker, weightVectors);
+}
+
+template<class SparseModelType, typename GeometryValueType>
+void DeterministicSchedsParetoExplorer<SparseModelType, GeometryValueType>::processFacet(
+    Environment const& env, Facet& f, typename PcaaWeightVectorBatchChecker<SparseModelType>::Result const* wvResult) {
     if (!wvChecker) {
         lpChecker->setCurrentWeightVector(env, f.getHalfspace().normalVector());
     }
 
-    if (optimizeAndSplitFacet(env, f)) {
+    if (optimizeAndSplitFacet(env, f, wvResult)) {
         return;
     }
 
@@ -557,16 +595,17 @@ bool closePoints(std::vector<GeometryValueType> const& first, std::vector<Geomet
 }
 
 template<class SparseModelType, typename GeometryValueType>
-bool DeterministicSchedsParetoExplorer<SparseModelType, GeometryValueType>::optimizeAndSplitFacet(Environment const& env, Facet& f) {
+bool DeterministicSchedsParetoExplorer<SparseModelType, GeometryValueType>::optimizeAndSplitFacet(
+    Environment const& env, Facet& f, typename PcaaWeightVectorBatchChecker<SparseModelType>::Result const* wvResult) {
     // Invoke optimization and insert the explored points
     boost::optional<PointId> optPointId;
     std::vector<GeometryValueType> pointCoord;
     GeometryValueType offset;
     if (wvChecker) {
-        wvChecker->check(env, storm::utility::vector::convertNumericVector<ModelValueType>(f.getHalfspace().normalVector()));
-        pointCoord = storm::utility::vector::convertNumericVector<GeometryValueType>(wvChecker->getUnderApproximationOfInitialStateResults());
+        STORM_LOG_ASSERT(wvResult != nullptr, "Expected a result of the weight vector checker.");
+        pointCoord = storm::utility::vector::convertNumericVector<GeometryValueType>(wvResult->underApproximation);
         negateMinObjectives(pointCoord);
-        auto upperBoundPoint = storm::utility::vector::convertNumericVector<GeometryValueType>(wvChecker->getOverApproximationOfInitialStateResults());
+        auto upperBoundPoint = storm::utility::vector::convertNumericVector<GeometryValueType>(wvResult->overApproximation);
         negateMinObjectives(upperBoundPoint);
         offset = storm::utility::vector::dotProduct(f.getHalfspace().normalVector(), upperBoundPoint);
     } else {
@@ -5,6 +5,7 @@
 
 #include "storm/modelchecker/multiobjective/deterministicScheds/DeterministicSchedsLpChecker.h"
 #include "storm/modelchecker/multiobjective/deterministicScheds/DeterministicSchedsObjectiveHelper.h"
+#include "storm/modelchecker/multiobjective/pcaa/PcaaWeightVectorBatchChecker.h"
 #include "storm/modelchecker/multiobjective/pcaa/PcaaWeightVectorChecker.h"
 #include "storm/modelchecker/multiobjective/preprocessing/SparseMultiObjectivePreprocessorResult.h"
 
@@ -152,18 +153,26 @@ class DeterministicSchedsParetoExplorer {
      */
     std::vector<GeometryValueType> getReferenceCoordinates(Environment const& env) const;
 
+    /*!
+     * Checks the normal vectors of the given facets with the weight vector checker (if available). The facets are checked concurrently.
+     */
+    std::vector<typename PcaaWeightVectorBatchChecker<SparseModelType>::Result> checkWeightVectors(Environment const& env,
+                                                                                                  std::vector<Facet> const& facets);
+
     /*!
      * Processes the given facet
+     * @param wvResult the result of the weight vector checker for the normal vector of the facet (only needed if a weight vector checker is used)
      */
-    void processFacet(Environment const& env, Facet& f);
+    void processFacet(Environment const& env, Facet& f, typename PcaaWeightVectorBatchChecker<SparseModelType>::Result const* wvResult);
 
     /*!
      * Optimizes in the facet direction. If this results in a point that does not lie on the facet,
      * 1. The new Pareto optimal point is added
      * 2. New facets are generated and (if not already precise enough) added to unprocessedFacets
      * 3. true is returned
+     * @param wvResult the result of the weight vector checker for the normal vector of the facet (only needed if a weight vector checker is used)
      */
-    bool optimizeAndSplitFacet(Environment const& env, Facet& f);
+    bool optimizeAndSplitFacet(Environment const& env, Facet& f, typename PcaaWeightVectorBatchChecker<SparseModelType>::Result const* wvResult);
 
     Polytope negateMinObjectives(Polytope const& polytope) const;
     void negateMinObjectives(std::vector<GeometryValueType>& vector) const;
@@ -175,6 +184,7 @@ class DeterministicSchedsParetoExplorer {
     std::vector<GeometryValueType> eps;
     std::shared_ptr<DeterministicSchedsLpChecker<SparseModelType, GeometryValueType>> lpChecker;
     std::unique_ptr<PcaaWeightVectorChecker<SparseModelType>> wvChecker;
+    std::unique_ptr<PcaaWeightVectorBatchChecker<SparseModelType>> wvBatchChecker;
     std::vector<DeterministicSchedsObjectiveHelper<SparseModelType>> objectiveHelper;
 
     std::shared_ptr<SparseModelType> const& model;
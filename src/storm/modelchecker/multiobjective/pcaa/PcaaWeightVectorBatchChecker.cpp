@@ -0,0 +1,66 @@
+#include "storm/modelchecker/multiobjective/pcaa/PcaaWeightVectorBatchChecker.h"
+
+#include "storm/adapters/IntelTbbAdapter.h"
+#include "storm/adapters/RationalNumberAdapter.h"
+#include "storm/models/sparse/StandardRewardModel.h"
+#include "storm/utility/macros.h"
+
+namespace storm {
+namespace modelchecker {
+namespace multiobjective {
+
+template<typename ModelType>
+PcaaWeightVectorBatchChecker<ModelType>::PcaaWeightVectorBatchChecker(
+    preprocessing::SparseMultiObjectivePreprocessorResult<ModelType> const& preprocessorResult)
+    : preprocessorResult(preprocessorResult) {
+    // Intentionally left empty
+}
+
+template<typename ModelType>
+std::vector<typename PcaaWeightVectorBatchChecker<ModelType>::Result> PcaaWeightVectorBatchChecker<ModelType>::check(
+    Environment const& env, PcaaWeightVectorChecker<ModelType>& primaryChecker, std::vector<std::vector<ValueType>> const& weightVectors) {
+    std::vector<Result> results(weightVectors.size());
+    if (weightVectors.empty()) {
+        return results;
+    }
+
+    // Gather one checker per weight vector.
+    while (additionalCheckers.size() + 1 < weightVectors.size()) {
+        additionalCheckers.push_back(WeightVectorCheckerFactory<ModelType>::create(preprocessorResult));
+    }
+    std::vector<PcaaWeightVectorChecker<ModelType>*> checkers = {&primaryChecker};
+    for (uint64_t index = 1; index < weightVectors.size(); ++index) {
+        checkers.push_back(additionalCheckers[index - 1].get());
+        checkers.back()->setWeightedPrecision(primaryChecker.getWeightedPrecision());
+    }
+
+    auto checkWeightVector = [&](uint64_t index) {
+        checkers[index]->check(env, weightVectors[index]);
+        results[index].underApproximation = checkers[index]->getUnderApproximationOfInitialStateResults();
+        results[index].overApproximation = checkers[index]->getOverApproximationOfInitialStateResults();
+    };
+
+#ifdef STORM_HAVE_INTELTBB
+    // The checkers only share the (read-only) preprocessed model, so they can run concurrently.
+    tbb::parallel_for(tbb::blocked_range<uint64_t>(0, weightVectors.size()), [&](tbb::blocked_range<uint64_t> const& range) {
+        for (uint64_t index = range.begin(); index < range.end(); ++index) {
+            checkWeightVector(index);
+        }
+    });
+#else
+    STORM_LOG_WARN_COND(weightVectors.size() == 1, "Storm was built without support for Intel TBB, checking weight vectors sequentially.");
+    for (uint64_t index = 0; index < weightVectors.size(); ++index) {
+        checkWeightVector(index);
+    }
+#endif
+    return results;
+}
+
+template class PcaaWeightVectorBatchChecker<storm::models::sparse::Mdp<double>>;
+template class PcaaWeightVectorBatchChecker<storm::models::sparse::Mdp<storm::RationalNumber>>;
+template class PcaaWeightVectorBatchChecker<storm::models::sparse::MarkovAutomaton<double>>;
+template class PcaaWeightVectorBatchChecker<storm::models::sparse::MarkovAutomaton<storm::RationalNumber>>;
+
+}  // namespace multiobjective
+}  // namespace modelchecker
+}  // namespace storm
@@ -0,0 +1,59 @@
+#pragma once
+
+#include <memory>
+#include <vector>
+
+#include "storm/modelchecker/multiobjective/pcaa/PcaaWeightVectorChecker.h"
+
+namespace storm {
+
+class Environment;
+
+namespace modelchecker {
+namespace multiobjective {
+
+/*!
+ * Helper class that checks a batch of weight vectors concurrently. Each weight vector of a batch is checked by its own weight vector checker.
+ * The first weight vector is always checked by the given primary checker, further checkers are created on demand for the same preprocessed model.
+ * As the weight vectors are independent, the results are the same as when checking them one after another with the primary checker.
+ */
+template<typename ModelType>
+class PcaaWeightVectorBatchChecker {
+   public:
+    typedef typename ModelType::ValueType ValueType;
+
+    /*!
+     * The results of checking a single weight vector.
+     */
+    struct Result {
+        std::vector<ValueType> underApproximation;
+        std::vector<ValueType> overApproximation;
+    };
+
+    /*!
+     * Creates a batch checker.
+     *
+     * @param preprocessorResult The result of the preprocessing. It needs to stay alive as long as this batch checker is used.
+     */
+    PcaaWeightVectorBatchChecker(preprocessing::SparseMultiObjectivePreprocessorResult<ModelType> const& preprocessorResult);
+
+    /*!
+     * Checks the given weight vectors concurrently (if storm was built with Intel TBB). All checkers use the weighted precision of the primary checker.
+     *
+     * @param primaryChecker The checker used for the first weight vector.
+     * @param weightVectors The weight vectors to check.
+     * @return The under- and overapproximations of the initial state results for each weight vector.
+     */
+    std::vector<Result> check(Environment const& env, PcaaWeightVectorChecker<ModelType>& primaryChecker,
+                              std::vector<std::vector<ValueType>> const& weightVectors);
+
+   private:
+    preprocessing::SparseMultiObjectivePreprocessorResult<ModelType> const& preprocessorResult;
+
+    // The checkers for the weight vectors other than the first one of a batch.
+    std::vector<std::unique_ptr<PcaaWeightVectorChecker<ModelType>>> additionalCheckers;
+};
+
+}  // namespace multiobjective
+}  // namespace modelchecker
+}  // namespace storm
@@ -29,7 +29,10 @@ SparsePcaaQuery<SparseModelType, GeometryValueType>::~SparsePcaaQuery() {
 
 template<class SparseModelType, typename GeometryValueType>
 SparsePcaaQuery<SparseModelType, GeometryValueType>::SparsePcaaQuery(preprocessing::SparseMultiObjectivePreprocessorResult<SparseModelType>& preprocessorResult)
-    : originalModel(preprocessorResult.originalModel), originalFormula(preprocessorResult.originalFormula), objectives(preprocessorResult.objectives) {
+    : originalModel(preprocessorResult.originalModel),
+      originalFormula(preprocessorResult.originalFormula),
+      objectives(preprocessorResult.objectives),
+      batchChecker(preprocessorResult) {
     this->weightVectorChecker = WeightVectorCheckerFactory<SparseModelType>::create(preprocessorResult);
 
     this->diracWeightVectorsToBeChecked = storm::storage::BitVector(this->objectives.size(), true);
@@ -89,26 +92,41 @@ typename SparsePcaaQuery<SparseModelType, GeometryValueType>::WeightVector Spars
 
 template<class SparseModelType, typename GeometryValueType>
 void SparsePcaaQuery<SparseModelType, GeometryValueType>::performRefinementStep(Environment const& env, WeightVector&& direction) {
-    // Normalize the direction vector so that the entries sum up to one
-    storm::utility::vector::scaleVectorInPlace(
-        direction, storm::utility::one<GeometryValueType>() / std::accumulate(direction.begin(), direction.end(), storm::utility::zero<GeometryValueType>()));
-    weightVectorChecker->check(env, storm::utility::vector::convertNumericVector<typename SparseModelType::ValueType>(direction));
-    STORM_LOG_DEBUG("weighted objectives checker result (under approximation) is " << storm::utility::vector::toString(
-                        storm::utility::vector::convertNumericVector<double>(weightVectorChecker->getUnderApproximationOfInitialStateResults())));
-    RefinementStep step;
-    step.weightVector = direction;
-    step.lowerBoundPoint = storm::utility::vector::convertNumericVector<GeometryValueType>(weightVectorChecker->getUnderApproximationOfInitialStateResults());
-    step.upperBoundPoint = storm::utility::vector::convertNumericVector<GeometryValueType>(weightVectorChecker->getOverApproximationOfInitialStateResults());
-    // For the minimizing objectives, we need to scale the corresponding entries with -1 as we want to consider the downward closure
-    for (uint_fast64_t objIndex = 0; objIndex < this->objectives.size(); ++objIndex) {
-        if (storm::solver::minimize(this->objectives[objIndex].formula->getOptimalityType())) {
-            step.lowerBoundPoint[objIndex] *= -storm::utility::one<GeometryValueType>();
-            step.upperBoundPoint[objIndex] *= -storm::utility::one<GeometryValueType>();
+    std::vector<WeightVector> directions;
+    directions.push_back(std::move(direction));
+    performRefinementSteps(env, std::move(directions));
+}
+
+template<class SparseModelType, typename GeometryValueType>
+void SparsePcaaQuery<SparseModelType, GeometryValueType>::performRefinementSteps(Environment const& env, std::vector<WeightVector>&& directions) {
+    std::vector<std::vector<typename SparseModelType::ValueType>> weightVectors;
+    weightVectors.reserve(directions.size());
+    for (auto& direction : directions) {
+        // Normalize the direction vector so that the entries sum up to one
+        GeometryValueType directionSum = std::accumulate(direction.begin(), direction.end(), storm::utility::zero<GeometryValueType>());
+        storm::utility::vector::scaleVectorInPlace(direction, storm::utility::one<GeometryValueType>() / directionSum);
+        weightVectors.push_back(storm::utility::vector::convertNumericVector<typename SparseModelType::ValueType>(direction));
+    }
+    auto results = batchChecker.check(env, *weightVectorChecker, weightVectors);
+
+    for (uint64_t directionIndex = 0; directionIndex < directions.size(); ++directionIndex) {
+        auto const& result = results[directionIndex];
+        STORM_LOG_DEBUG("weighted objectives checker result (under approximation) is "
+                        << storm::utility::vector::toString(storm::utility::vector::convertNumericVector<double>(result.underApproximation)));
+        RefinementStep step;
+        step.weightVector = std::move(directions[directionIndex]);
+        step.lowerBoundPoint = storm::utility::vector::convertNumericVector<GeometryValueType>(result.underApproximation);
+        step.upperBoundPoint = storm::utility::vector::convertNumericVector<GeometryValueType>(result.overApproximation);
+        // For the minimizing objectives, we need to scale the corresponding entries with -1 as we want to consider the downward closure
+        for (uint_fast64_t objIndex = 0; objIndex < this->objectives.size(); ++objIndex) {
+            if (storm::solver::minimize(this->objectives[objIndex].formula->getOptimalityType())) {
+                step.lowerBoundPoint[objIndex] *= -storm::utility::one<GeometryValueType>();
+                step.upperBoundPoint[objIndex] *= -storm::utility::one<GeometryValueType>();
+            }
         }
+        refinementSteps.push_back(std::move(step));
+        updateOverApproximation();
     }
-    refinementSteps.push_back(std::move(step));
-
-    updateOverApproximation();
     updateUnderApproximation();
 }
 
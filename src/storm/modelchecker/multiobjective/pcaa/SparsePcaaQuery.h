@@ -1,6 +1,7 @@
 #ifndef STORM_MODELCHECKER_MULTIOBJECTIVE_PCAA_SPARSEPCAAQUERY_H_
 #define STORM_MODELCHECKER_MULTIOBJECTIVE_PCAA_SPARSEPCAAQUERY_H_
 
+#include "storm/modelchecker/multiobjective/pcaa/PcaaWeightVectorBatchChecker.h"
 #include "storm/modelchecker/multiobjective/pcaa/PcaaWeightVectorChecker.h"
 #include "storm/modelchecker/multiobjective/preprocessing/SparseMultiObjectivePreprocessorResult.h"
 #include "storm/modelchecker/results/CheckResult.h"
@@ -68,6 +69,11 @@ class SparsePcaaQuery {
      */
     void performRefinementStep(Environment const& env, WeightVector&& direction);
 
+    /*
+     * Refines the current result w.r.t. the given direction vectors. The directions are checked concurrently (see PcaaWeightVectorBatchChecker).
+     */
+    void performRefinementSteps(Environment const& env, std::vector<WeightVector>&& directions);
+
     /*
      * Updates the overapproximation after a refinement step has been performed
      *
@@ -94,6 +100,8 @@ class SparsePcaaQuery {
 
     // The corresponding weight vector checker
     std::unique_ptr<PcaaWeightVectorChecker<SparseModelType>> weightVectorChecker;
+    // Used to check multiple weight vectors at once
+    PcaaWeightVectorBatchChecker<SparseModelType> batchChecker;
 
     // The results in each iteration of the algorithm
     std::vector<RefinementStep> refinementSteps;
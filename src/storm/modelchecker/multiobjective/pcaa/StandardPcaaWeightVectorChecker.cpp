@@ -478,8 +478,6 @@ void StandardPcaaWeightVectorChecker<SparseModelType>::unboundedIndividualPhase(
     } else {
         storm::storage::SparseMatrix<ValueType> deterministicMatrix = transitionMatrix.selectRowsFromRowGroups(this->optimalChoices, false);
         storm::storage::SparseMatrix<ValueType> deterministicBackwardTransitions = deterministicMatrix.transpose();
-        std::vector<ValueType> deterministicStateRewards(deterministicMatrix.getRowCount());  // allocate here
-        storm::solver::GeneralLinearEquationSolverFactory<ValueType> linearEquationSolverFactory;
 
         auto infiniteHorizonHelper = createDetInfiniteHorizonHelper(deterministicMatrix);
         infiniteHorizonHelper.provideBackwardTransitions(deterministicBackwardTransitions);
@@ -489,8 +487,9 @@ void StandardPcaaWeightVectorChecker<SparseModelType>::unboundedIndividualPhase(
         std::vector<ValueType> weightedSumOfUncheckedObjectives = weightedResult;
         ValueType sumOfWeightsOfUncheckedObjectives = storm::utility::vector::sum_if(weightVector, objectivesWithNoUpperTimeBound);
 
+        // The total reward objectives are collected and then solved simultaneously.
+        std::vector<uint64_t> totalRewardObjectives;
         for (uint_fast64_t const& objIndex : storm::utility::vector::getSortedIndices(weightVector)) {
-            auto const& obj = this->objectives[objIndex];
             if (objectivesWithNoUpperTimeBound.get(objIndex)) {
                 offsetsToUnderApproximation[objIndex] = storm::utility::zero<ValueType>();
                 offsetsToOverApproximation[objIndex] = storm::utility::zero<ValueType>();
@@ -505,72 +504,117 @@ void StandardPcaaWeightVectorChecker<SparseModelType>::unboundedIndividualPhase(
                         stateValueGetter = [&](uint64_t const& s) { return stateRewards[objIndex][s]; };
                     }
                     objectiveResults[objIndex] = infiniteHorizonHelper.computeLongRunAverageValues(env, stateValueGetter, actionValueGetter);
-                } else {  // i.e. a total reward objective
-                    storm::utility::vector::selectVectorValues(deterministicStateRewards, this->optimalChoices, transitionMatrix.getRowGroupIndices(),
-                                                               actionRewards[objIndex]);
-                    storm::storage::BitVector statesWithRewards = ~storm::utility::vector::filterZero(deterministicStateRewards);
-                    // As maybestates we pick the states from which a state with reward is reachable
-                    storm::storage::BitVector maybeStates = storm::utility::graph::performProbGreater0(
-                        deterministicBackwardTransitions, storm::storage::BitVector(deterministicMatrix.getRowCount(), true), statesWithRewards);
-
-                    // Compute the estimate for this objective
+                    // Update the estimate for the remaining objectives.
                     if (!storm::utility::isZero(weightVector[objIndex])) {
-                        objectiveResults[objIndex] = weightedSumOfUncheckedObjectives;
-                        ValueType scalingFactor = storm::utility::one<ValueType>() / sumOfWeightsOfUncheckedObjectives;
-                        if (storm::solver::minimize(obj.formula->getOptimalityType())) {
-                            scalingFactor *= -storm::utility::one<ValueType>();
-                        }
-                        storm::utility::vector::scaleVectorInPlace(objectiveResults[objIndex], scalingFactor);
-                        storm::utility::vector::clip(objectiveResults[objIndex], obj.lowerResultBound, obj.upperResultBound);
-                    }
-                    // Make sure that the objectiveResult is initialized correctly
-                    objectiveResults[objIndex].resize(transitionMatrix.getRowGroupCount(), storm::utility::zero<ValueType>());
-
-                    if (!maybeStates.empty()) {
-                        bool needEquationSystem =
-                            linearEquationSolverFactory.getEquationProblemFormat(env) == storm::solver::LinearEquationSolverProblemFormat::EquationSystem;
-                        storm::storage::SparseMatrix<ValueType> submatrix =
-                            deterministicMatrix.getSubmatrix(true, maybeStates, maybeStates, needEquationSystem);
-                        if (needEquationSystem) {
-                            // Converting the matrix from the fixpoint notation to the form needed for the equation
-                            // system. That is, we go from x = A*x + b to (I-A)x = b.
-                            submatrix.convertToEquationSystem();
-                        }
-
-                        // Prepare solution vector and rhs of the equation system.
-                        std::vector<ValueType> x = storm::utility::vector::filterVector(objectiveResults[objIndex], maybeStates);
-                        std::vector<ValueType> b = storm::utility::vector::filterVector(deterministicStateRewards, maybeStates);
-
-                        // Now solve the resulting equation system.
-                        std::unique_ptr<storm::solver::LinearEquationSolver<ValueType>> solver = linearEquationSolverFactory.create(env, submatrix);
-                        auto req = solver->getRequirements(env);
-                        solver->clearBounds();
-                        storm::storage::BitVector submatrixRowsWithSumLessOne = deterministicMatrix.getRowFilter(maybeStates, maybeStates) % maybeStates;
-                        submatrixRowsWithSumLessOne.complement();
-                        this->setBoundsToSolver(*solver, req.lowerBounds(), req.upperBounds(), objIndex, submatrix, submatrixRowsWithSumLessOne, b);
-                        if (solver->hasLowerBound()) {
-                            req.clearLowerBounds();
-                        }
-                        if (solver->hasUpperBound()) {
-                            req.clearUpperBounds();
-                        }
-                        STORM_LOG_THROW(!req.hasEnabledCriticalRequirement(), storm::exceptions::UncheckedRequirementException,
-                                        "Solver requirements " + req.getEnabledRequirementsAsString() + " not checked.");
-                        solver->solveEquations(env, x, b);
-                        // Set the result for this objective accordingly
-                        storm::utility::vector::setVectorValues<ValueType>(objectiveResults[objIndex], maybeStates, x);
+                        storm::utility::vector::addScaledVector(weightedSumOfUncheckedObjectives, objectiveResults[objIndex], -weightVector[objIndex]);
+                        sumOfWeightsOfUncheckedObjectives -= weightVector[objIndex];
                     }
-                    storm::utility::vector::setVectorValues<ValueType>(objectiveResults[objIndex], ~maybeStates, storm::utility::zero<ValueType>());
-                }
-                // Update the estimate for the next objectives.
-                if (!storm::utility::isZero(weightVector[objIndex])) {
-                    storm::utility::vector::addScaledVector(weightedSumOfUncheckedObjectives, objectiveResults[objIndex], -weightVector[objIndex]);
-                    sumOfWeightsOfUncheckedObjectives -= weightVector[objIndex];
+                } else {  // i.e. a total reward objective
+                    totalRewardObjectives.push_back(objIndex);
                 }
             } else {
                 objectiveResults[objIndex] = std::vector<ValueType>(transitionMatrix.getRowGroupCount(), storm::utility::zero<ValueType>());
             }
         }
+        if (!totalRewardObjectives.empty()) {
+            unboundedIndividualTotalRewardPhase(env, weightVector, totalRewardObjectives, deterministicMatrix, deterministicBackwardTransitions,
+                                                weightedSumOfUncheckedObjectives, sumOfWeightsOfUncheckedObjectives);
+        }
+    }
+}
+
+template<class SparseModelType>
+void StandardPcaaWeightVectorChecker<SparseModelType>::unboundedIndividualTotalRewardPhase(
+    Environment const& env, std::vector<ValueType> const& weightVector, std::vector<uint64_t> const& totalRewardObjectives,
+    storm::storage::SparseMatrix<ValueType> const& deterministicMatrix, storm::storage::SparseMatrix<ValueType> const& deterministicBackwardTransitions,
+    std::vector<ValueType> const& weightedSumOfUncheckedObjectives, ValueType const& sumOfWeightsOfUncheckedObjectives) {
+    // For each objective, the maybestates are the states from which a state with reward is reachable.
+    // The objectives are solved on the union of these states. The remaining states of an objective get value zero, also in the solution of the equation
+    // system since these states can not reach a reward of that objective.
+    storm::storage::BitVector maybeStates(deterministicMatrix.getRowCount(), false);
+    std::vector<storm::storage::BitVector> objectiveMaybeStates;
+    std::vector<std::vector<ValueType>> deterministicStateRewards;
+    objectiveMaybeStates.reserve(totalRewardObjectives.size());
+    deterministicStateRewards.reserve(totalRewardObjectives.size());
+    for (auto const& objIndex : totalRewardObjectives) {
+        auto const& obj = this->objectives[objIndex];
+        deterministicStateRewards.emplace_back(deterministicMatrix.getRowCount());
+        storm::utility::vector::selectVectorValues(deterministicStateRewards.back(), this->optimalChoices, transitionMatrix.getRowGroupIndices(),
+                                                   actionRewards[objIndex]);
+        storm::storage::BitVector statesWithRewards = ~storm::utility::vector::filterZero(deterministicStateRewards.back());
+        objectiveMaybeStates.push_back(storm::utility::graph::performProbGreater0(
+            deterministicBackwardTransitions, storm::storage::BitVector(deterministicMatrix.getRowCount(), true), statesWithRewards));
+        maybeStates |= objectiveMaybeStates.back();
+
+        // Compute the estimate for this objective
+        if (!storm::utility::isZero(weightVector[objIndex])) {
+            objectiveResults[objIndex] = weightedSumOfUncheckedObjectives;
+            ValueType scalingFactor = storm::utility::one<ValueType>() / sumOfWeightsOfUncheckedObjectives;
+            if (storm::solver::minimize(obj.formula->getOptimalityType())) {
+                scalingFactor *= -storm::utility::one<ValueType>();
+            }
+            storm::utility::vector::scaleVectorInPlace(objectiveResults[objIndex], scalingFactor);
+            storm::utility::vector::clip(objectiveResults[objIndex], obj.lowerResultBound, obj.upperResultBound);
+        }
+        // Make sure that the objectiveResult is initialized correctly
+        objectiveResults[objIndex].resize(transitionMatrix.getRowGroupCount(), storm::utility::zero<ValueType>());
+        storm::utility::vector::setVectorValues<ValueType>(objectiveResults[objIndex], ~objectiveMaybeStates.back(), storm::utility::zero<ValueType>());
+    }
+
+    if (maybeStates.empty()) {
+        return;
+    }
+
+    storm::solver::GeneralLinearEquationSolverFactory<ValueType> linearEquationSolverFactory;
+    bool needEquationSystem = linearEquationSolverFactory.getEquationProblemFormat(env) == storm::solver::LinearEquationSolverProblemFormat::EquationSystem;
+    storm::storage::SparseMatrix<ValueType> submatrix = deterministicMatrix.getSubmatrix(true, maybeStates, maybeStates, needEquationSystem);
+    if (needEquationSystem) {
+        // Converting the matrix from the fixpoint notation to the form needed for the equation
+        // system. That is, we go from x = A*x + b to (I-A)x = b.
+        submatrix.convertToEquationSystem();
+    }
+
+    // Prepare solution vectors and right-hand sides of the equation systems.
+    std::vector<std::vector<ValueType>> x, b;
+    x.reserve(totalRewardObjectives.size());
+    b.reserve(totalRewardObjectives.size());
+    for (uint64_t i = 0; i < totalRewardObjectives.size(); ++i) {
+        x.push_back(storm::utility::vector::filterVector(objectiveResults[totalRewardObjectives[i]], maybeStates));
+        b.push_back(storm::utility::vector::filterVector(deterministicStateRewards[i], maybeStates));
+    }
+
+    // Now solve the resulting equation systems.
+    std::unique_ptr<storm::solver::LinearEquationSolver<ValueType>> solver = linearEquationSolverFactory.create(env, submatrix);
+    auto req = solver->getRequirements(env);
+    if (!req.hasEnabledRequirement()) {
+        // All objectives share the same matrix, so the solver can consider them in a single pass over the matrix per iteration.
+        solver->solveEquationsBatch(env, x, b);
+    } else {
+        // The solver requires objective specific information (e.g. bounds), so we solve the equation systems one after another.
+        storm::storage::BitVector submatrixRowsWithSumLessOne = deterministicMatrix.getRowFilter(maybeStates, maybeStates) % maybeStates;
+        submatrixRowsWithSumLessOne.complement();
+        for (uint64_t i = 0; i < totalRewardObjectives.size(); ++i) {
+            auto objReq = req;
+            solver->clearBounds();
+            this->setBoundsToSolver(*solver, objReq.lowerBounds(), objReq.upperBounds(), totalRewardObjectives[i], submatrix, submatrixRowsWithSumLessOne,
+                                    b[i]);
+            if (solver->hasLowerBound()) {
+                objReq.clearLowerBounds();
+            }
+            if (solver->hasUpperBound()) {
+                objReq.clearUpperBounds();
+            }
+            STORM_LOG_THROW(!objReq.hasEnabledCriticalRequirement(), storm::exceptions::UncheckedRequirementException,
+                            "Solver requirements " + objReq.getEnabledRequirementsAsString() + " not checked.");
+            solver->solveEquations(env, x[i], b[i]);
+        }
+    }
+
+    // Set the results for the objectives accordingly
+    for (uint64_t i = 0; i < totalRewardObjectives.size(); ++i) {
+        auto& result = objectiveResults[totalRewardObjectives[i]];
+        storm::utility::vector::setVectorValues<ValueType>(result, maybeStates, x[i]);
+        storm::utility::vector::setVectorValues<ValueType>(result, ~objectiveMaybeStates[i], storm::utility::zero<ValueType>());
     }
 }
 
@@ -90,6 +90,17 @@ class StandardPcaaWeightVectorChecker : public PcaaWeightVectorChecker<SparseMod
      */
     void unboundedIndividualPhase(Environment const& env, std::vector<ValueType> const& weightVector);
 
+    /*!
+     * Computes the values of the given total reward objectives w.r.t. the scheduler computed in the unboundedWeightedPhase.
+     * If possible, the equation systems of all objectives are solved simultaneously with a single pass over the matrix per iteration.
+     */
+    void unboundedIndividualTotalRewardPhase(Environment const& env, std::vector<ValueType> const& weightVector,
+                                             std::vector<uint64_t> const& totalRewardObjectives,
+                                             storm::storage::SparseMatrix<ValueType> const& deterministicMatrix,
+                                             storm::storage::SparseMatrix<ValueType> const& deterministicBackwardTransitions,
+                                             std::vector<ValueType> const& weightedSumOfUncheckedObjectives,
+                                             ValueType const& sumOfWeightsOfUncheckedObjectives);
+
     /*!
      * For each time epoch (starting with the maximal stepBound occurring in the objectives), this method
      * - determines the objectives that are relevant in the current time epoch
@@ -3,6 +3,7 @@
 #include <algorithm>
 #include <set>
 
+#include "storm/adapters/IntelTbbAdapter.h"
 #include "storm/environment/modelchecker/MultiObjectiveModelCheckerEnvironment.h"
 #include "storm/modelchecker/prctl/helper/BaierUpperRewardBoundsComputer.h"
 #include "storm/modelchecker/propositional/SparsePropositionalModelChecker.h"
@@ -93,124 +94,142 @@ storm::storage::BitVector getOnlyReachableViaPhi(SparseModelType const& model, s
 }
 
 template<typename SparseModelType>
-void SparseMultiObjectivePreprocessor<SparseModelType>::removeIrrelevantStates(std::shared_ptr<SparseModelType>& model,
-                                                                               boost::optional<std::string>& deadlockLabel,
-                                                                               storm::logic::MultiObjectiveFormula const& originalFormula) {
-    storm::storage::BitVector absorbingStates(model->getNumberOfStates(), true);
-
-    storm::modelchecker::SparsePropositionalModelChecker<SparseModelType> mc(*model);
-    storm::storage::SparseMatrix<ValueType> backwardTransitions = model->getBackwardTransitions();
-
-    for (auto const& opFormula : originalFormula.getSubformulas()) {
-        // Compute a set of states from which we can make any subset absorbing without affecting this subformula
-        storm::storage::BitVector absorbingStatesForSubformula;
-        STORM_LOG_THROW(opFormula->isOperatorFormula(), storm::exceptions::InvalidPropertyException,
-                        "Could not preprocess the subformula " << *opFormula << " of " << originalFormula << " because it is not supported");
-        auto const& pathFormula = opFormula->asOperatorFormula().getSubformula();
-        if (opFormula->isProbabilityOperatorFormula()) {
-            if (pathFormula.isUntilFormula()) {
-                auto lhs = mc.check(pathFormula.asUntilFormula().getLeftSubformula())->asExplicitQualitativeCheckResult().getTruthValuesVector();
-                auto rhs = mc.check(pathFormula.asUntilFormula().getRightSubformula())->asExplicitQualitativeCheckResult().getTruthValuesVector();
-                absorbingStatesForSubformula = storm::utility::graph::performProb0A(backwardTransitions, lhs, rhs);
-                absorbingStatesForSubformula |= getOnlyReachableViaPhi(*model, ~lhs | rhs);
-            } else if (pathFormula.isBoundedUntilFormula()) {
-                if (pathFormula.asBoundedUntilFormula().hasMultiDimensionalSubformulas()) {
-                    absorbingStatesForSubformula = storm::storage::BitVector(model->getNumberOfStates(), true);
-                    storm::storage::BitVector absorbingStatesForSubSubformula;
-                    for (uint64_t i = 0; i < pathFormula.asBoundedUntilFormula().getDimension(); ++i) {
-                        auto subPathFormula = pathFormula.asBoundedUntilFormula().restrictToDimension(i);
-                        auto lhs =
-                            mc.check(pathFormula.asBoundedUntilFormula().getLeftSubformula(i))->asExplicitQualitativeCheckResult().getTruthValuesVector();
-                        auto rhs =
-                            mc.check(pathFormula.asBoundedUntilFormula().getRightSubformula(i))->asExplicitQualitativeCheckResult().getTruthValuesVector();
-                        absorbingStatesForSubSubformula = storm::utility::graph::performProb0A(backwardTransitions, lhs, rhs);
-                        if (pathFormula.asBoundedUntilFormula().hasLowerBound(i)) {
-                            absorbingStatesForSubSubformula |= getOnlyReachableViaPhi(*model, ~lhs);
-                        } else {
-                            absorbingStatesForSubSubformula |= getOnlyReachableViaPhi(*model, ~lhs | rhs);
-                        }
-                        absorbingStatesForSubformula &= absorbingStatesForSubSubformula;
-                    }
-                } else {
-                    auto lhs = mc.check(pathFormula.asBoundedUntilFormula().getLeftSubformula())->asExplicitQualitativeCheckResult().getTruthValuesVector();
-                    auto rhs = mc.check(pathFormula.asBoundedUntilFormula().getRightSubformula())->asExplicitQualitativeCheckResult().getTruthValuesVector();
-                    absorbingStatesForSubformula = storm::utility::graph::performProb0A(backwardTransitions, lhs, rhs);
-                    if (pathFormula.asBoundedUntilFormula().hasLowerBound()) {
-                        absorbingStatesForSubformula |= getOnlyReachableViaPhi(*model, ~lhs);
+storm::storage::BitVector SparseMultiObjectivePreprocessor<SparseModelType>::computeAbsorbingStatesForSubformula(
+    SparseModelType const& model, storm::storage::SparseMatrix<ValueType> const& backwardTransitions, storm::logic::Formula const& opFormula,
+    storm::logic::MultiObjectiveFormula const& originalFormula) {
+    // Each invocation uses its own checker as this might run concurrently for different subformulas
+    storm::modelchecker::SparsePropositionalModelChecker<SparseModelType> mc(model);
+    storm::storage::BitVector absorbingStatesForSubformula;
+    STORM_LOG_THROW(opFormula.isOperatorFormula(), storm::exceptions::InvalidPropertyException,
+                    "Could not preprocess the subformula " << opFormula << " of " << originalFormula << " because it is not supported");
+    auto const& pathFormula = opFormula.asOperatorFormula().getSubformula();
+    if (opFormula.isProbabilityOperatorFormula()) {
+        if (pathFormula.isUntilFormula()) {
+            auto lhs = mc.check(pathFormula.asUntilFormula().getLeftSubformula())->asExplicitQualitativeCheckResult().getTruthValuesVector();
+            auto rhs = mc.check(pathFormula.asUntilFormula().getRightSubformula())->asExplicitQualitativeCheckResult().getTruthValuesVector();
+            absorbingStatesForSubformula = storm::utility::graph::performProb0A(backwardTransitions, lhs, rhs);
+            absorbingStatesForSubformula |= getOnlyReachableViaPhi(model, ~lhs | rhs);
+        } else if (pathFormula.isBoundedUntilFormula()) {
+            if (pathFormula.asBoundedUntilFormula().hasMultiDimensionalSubformulas()) {
+                absorbingStatesForSubformula = storm::storage::BitVector(model.getNumberOfStates(), true);
+                storm::storage::BitVector absorbingStatesForSubSubformula;
+                for (uint64_t i = 0; i < pathFormula.asBoundedUntilFormula().getDimension(); ++i) {
+                    auto subPathFormula = pathFormula.asBoundedUntilFormula().restrictToDimension(i);
+                    auto lhs = mc.check(pathFormula.asBoundedUntilFormula().getLeftSubformula(i))->asExplicitQualitativeCheckResult().getTruthValuesVector();
+                    auto rhs = mc.check(pathFormula.asBoundedUntilFormula().getRightSubformula(i))->asExplicitQualitativeCheckResult().getTruthValuesVector();
+                    absorbingStatesForSubSubformula = storm::utility::graph::performProb0A(backwardTransitions, lhs, rhs);
+                    if (pathFormula.asBoundedUntilFormula().hasLowerBound(i)) {
+                        absorbingStatesForSubSubformula |= getOnlyReachableViaPhi(model, ~lhs);
                     } else {
-                        absorbingStatesForSubformula |= getOnlyReachableViaPhi(*model, ~lhs | rhs);
+                        absorbingStatesForSubSubformula |= getOnlyReachableViaPhi(model, ~lhs | rhs);
                     }
+                    absorbingStatesForSubformula &= absorbingStatesForSubSubformula;
                 }
-            } else if (pathFormula.isGloballyFormula()) {
-                auto phi = mc.check(pathFormula.asGloballyFormula().getSubformula())->asExplicitQualitativeCheckResult().getTruthValuesVector();
-                auto notPhi = ~phi;
-                absorbingStatesForSubformula = storm::utility::graph::performProb0A(backwardTransitions, phi, notPhi);
-                absorbingStatesForSubformula |= getOnlyReachableViaPhi(*model, notPhi);
-            } else if (pathFormula.isEventuallyFormula()) {
-                auto phi = mc.check(pathFormula.asEventuallyFormula().getSubformula())->asExplicitQualitativeCheckResult().getTruthValuesVector();
-                absorbingStatesForSubformula = storm::utility::graph::performProb0A(backwardTransitions, ~phi, phi);
-                absorbingStatesForSubformula |= getOnlyReachableViaPhi(*model, phi);
-            } else {
-                STORM_LOG_THROW(false, storm::exceptions::InvalidPropertyException, "The subformula of " << pathFormula << " is not supported.");
-            }
-        } else if (opFormula->isRewardOperatorFormula()) {
-            auto const& baseRewardModel = opFormula->asRewardOperatorFormula().hasRewardModelName()
-                                              ? model->getRewardModel(opFormula->asRewardOperatorFormula().getRewardModelName())
-                                              : model->getUniqueRewardModel();
-            if (pathFormula.isEventuallyFormula()) {
-                auto rewardModel = storm::utility::createFilteredRewardModel(baseRewardModel, model->isDiscreteTimeModel(), pathFormula.asEventuallyFormula());
-                storm::storage::BitVector statesWithoutReward = rewardModel.get().getStatesWithZeroReward(model->getTransitionMatrix());
-                // Make states that can not reach a state with non-zero reward absorbing
-                absorbingStatesForSubformula = storm::utility::graph::performProb0A(backwardTransitions, statesWithoutReward, ~statesWithoutReward);
-                auto phi = mc.check(pathFormula.asEventuallyFormula().getSubformula())->asExplicitQualitativeCheckResult().getTruthValuesVector();
-                // Make states that reach phi with prob 1 while only visiting states with reward 0 absorbing
-                absorbingStatesForSubformula |= storm::utility::graph::performProb1A(
-                    model->getTransitionMatrix(), model->getTransitionMatrix().getRowGroupIndices(), backwardTransitions, statesWithoutReward, phi);
-                // Make states that are only reachable via phi absorbing
-                absorbingStatesForSubformula |= getOnlyReachableViaPhi(*model, phi);
-            } else if (pathFormula.isCumulativeRewardFormula()) {
-                auto rewardModel =
-                    storm::utility::createFilteredRewardModel(baseRewardModel, model->isDiscreteTimeModel(), pathFormula.asCumulativeRewardFormula());
-                storm::storage::BitVector statesWithoutReward = rewardModel.get().getStatesWithZeroReward(model->getTransitionMatrix());
-                absorbingStatesForSubformula = storm::utility::graph::performProb0A(backwardTransitions, statesWithoutReward, ~statesWithoutReward);
-            } else if (pathFormula.isTotalRewardFormula()) {
-                auto rewardModel = storm::utility::createFilteredRewardModel(baseRewardModel, model->isDiscreteTimeModel(), pathFormula.asTotalRewardFormula());
-                storm::storage::BitVector statesWithoutReward = rewardModel.get().getStatesWithZeroReward(model->getTransitionMatrix());
-                absorbingStatesForSubformula = storm::utility::graph::performProb0A(backwardTransitions, statesWithoutReward, ~statesWithoutReward);
-            } else if (pathFormula.isLongRunAverageRewardFormula()) {
-                auto rewardModel =
-                    storm::utility::createFilteredRewardModel(baseRewardModel, model->isDiscreteTimeModel(), pathFormula.asLongRunAverageRewardFormula());
-                storm::storage::BitVector statesWithoutReward = rewardModel.get().getStatesWithZeroReward(model->getTransitionMatrix());
-                // Compute Sat(Forall F (Forall G "statesWithoutReward"))
-                auto forallGloballyStatesWithoutReward = storm::utility::graph::performProb0A(backwardTransitions, statesWithoutReward, ~statesWithoutReward);
-                absorbingStatesForSubformula =
-                    storm::utility::graph::performProb1A(model->getTransitionMatrix(), model->getNondeterministicChoiceIndices(), backwardTransitions,
-                                                         storm::storage::BitVector(model->getNumberOfStates(), true), forallGloballyStatesWithoutReward);
-            } else {
-                STORM_LOG_THROW(false, storm::exceptions::InvalidPropertyException, "The subformula of " << pathFormula << " is not supported.");
-            }
-        } else if (opFormula->isTimeOperatorFormula()) {
-            if (pathFormula.isEventuallyFormula()) {
-                auto phi = mc.check(pathFormula.asEventuallyFormula().getSubformula())->asExplicitQualitativeCheckResult().getTruthValuesVector();
-                absorbingStatesForSubformula = getOnlyReachableViaPhi(*model, phi);
             } else {
-                STORM_LOG_THROW(false, storm::exceptions::InvalidPropertyException, "The subformula of " << pathFormula << " is not supported.");
+                auto lhs = mc.check(pathFormula.asBoundedUntilFormula().getLeftSubformula())->asExplicitQualitativeCheckResult().getTruthValuesVector();
+                auto rhs = mc.check(pathFormula.asBoundedUntilFormula().getRightSubformula())->asExplicitQualitativeCheckResult().getTruthValuesVector();
+                absorbingStatesForSubformula = storm::utility::graph::performProb0A(backwardTransitions, lhs, rhs);
+                if (pathFormula.asBoundedUntilFormula().hasLowerBound()) {
+                    absorbingStatesForSubformula |= getOnlyReachableViaPhi(model, ~lhs);
+                } else {
+                    absorbingStatesForSubformula |= getOnlyReachableViaPhi(model, ~lhs | rhs);
+                }
             }
-        } else if (opFormula->isLongRunAverageOperatorFormula()) {
-            auto lraStates = mc.check(pathFormula)->asExplicitQualitativeCheckResult().getTruthValuesVector();
-            // Compute Sat(Forall F (Forall G not "lraStates"))
-            auto forallGloballyNotLraStates = storm::utility::graph::performProb0A(backwardTransitions, ~lraStates, lraStates);
-            absorbingStatesForSubformula = storm::utility::graph::performProb1A(model->getTransitionMatrix(), model->getNondeterministicChoiceIndices(),
-                                                                                backwardTransitions, ~lraStates, forallGloballyNotLraStates);
+        } else if (pathFormula.isGloballyFormula()) {
+            auto phi = mc.check(pathFormula.asGloballyFormula().getSubformula())->asExplicitQualitativeCheckResult().getTruthValuesVector();
+            auto notPhi = ~phi;
+            absorbingStatesForSubformula = storm::utility::graph::performProb0A(backwardTransitions, phi, notPhi);
+            absorbingStatesForSubformula |= getOnlyReachableViaPhi(model, notPhi);
+        } else if (pathFormula.isEventuallyFormula()) {
+            auto phi = mc.check(pathFormula.asEventuallyFormula().getSubformula())->asExplicitQualitativeCheckResult().getTruthValuesVector();
+            absorbingStatesForSubformula = storm::utility::graph::performProb0A(backwardTransitions, ~phi, phi);
+            absorbingStatesForSubformula |= getOnlyReachableViaPhi(model, phi);
         } else {
-            STORM_LOG_THROW(false, storm::exceptions::InvalidPropertyException,
-                            "Could not preprocess the subformula " << *opFormula << " of " << originalFormula << " because it is not supported");
+            STORM_LOG_THROW(false, storm::exceptions::InvalidPropertyException, "The subformula of " << pathFormula << " is not supported.");
         }
+    } else if (opFormula.isRewardOperatorFormula()) {
+        auto const& baseRewardModel = opFormula.asRewardOperatorFormula().hasRewardModelName()
+                                          ? model.getRewardModel(opFormula.asRewardOperatorFormula().getRewardModelName())
+                                          : model.getUniqueRewardModel();
+        if (pathFormula.isEventuallyFormula()) {
+            auto rewardModel = storm::utility::createFilteredRewardModel(baseRewardModel, model.isDiscreteTimeModel(), pathFormula.asEventuallyFormula());
+            storm::storage::BitVector statesWithoutReward = rewardModel.get().getStatesWithZeroReward(model.getTransitionMatrix());
+            // Make states that can not reach a state with non-zero reward absorbing
+            absorbingStatesForSubformula = storm::utility::graph::performProb0A(backwardTransitions, statesWithoutReward, ~statesWithoutReward);
+            auto phi = mc.check(pathFormula.asEventuallyFormula().getSubformula())->asExplicitQualitativeCheckResult().getTruthValuesVector();
+            // Make states that reach phi with prob 1 while only visiting states with reward 0 absorbing
+            absorbingStatesForSubformula |= storm::utility::graph::performProb1A(
+                model.getTransitionMatrix(), model.getTransitionMatrix().getRowGroupIndices(), backwardTransitions, statesWithoutReward, phi);
+            // Make states that are only reachable via phi absorbing
+            absorbingStatesForSubformula |= getOnlyReachableViaPhi(model, phi);
+        } else if (pathFormula.isCumulativeRewardFormula()) {
+            auto rewardModel = storm::utility::createFilteredRewardModel(baseRewardModel, model.isDiscreteTimeModel(), pathFormula.asCumulativeRewardFormula());
+            storm::storage::BitVector statesWithoutReward = rewardModel.get().getStatesWithZeroReward(model.getTransitionMatrix());
+            absorbingStatesForSubformula = storm::utility::graph::performProb0A(backwardTransitions, statesWithoutReward, ~statesWithoutReward);
+        } else if (pathFormula.isTotalRewardFormula()) {
+            auto rewardModel = storm::utility::createFilteredRewardModel(baseRewardModel, model.isDiscreteTimeModel(), pathFormula.asTotalRewardFormula());
+            storm::storage::BitVector statesWithoutReward = rewardModel.get().getStatesWithZeroReward(model.getTransitionMatrix());
+            absorbingStatesForSubformula = storm::utility::graph::performProb0A(backwardTransitions, statesWithoutReward, ~statesWithoutReward);
+        } else if (pathFormula.isLongRunAverageRewardFormula()) {
+            auto rewardModel =
+                storm::utility::createFilteredRewardModel(baseRewardModel, model.isDiscreteTimeModel(), pathFormula.asLongRunAverageRewardFormula());
+            storm::storage::BitVector statesWithoutReward = rewardModel.get().getStatesWithZeroReward(model.getTransitionMatrix());
+            // Compute Sat(Forall F (Forall G "statesWithoutReward"))
+            auto forallGloballyStatesWithoutReward = storm::utility::graph::performProb0A(backwardTransitions, statesWithoutReward, ~statesWithoutReward);
+            absorbingStatesForSubformula =
+                storm::utility::graph::performProb1A(model.getTransitionMatrix(), model.getNondeterministicChoiceIndices(), backwardTransitions,
+                                                     storm::storage::BitVector(model.getNumberOfStates(), true), forallGloballyStatesWithoutReward);
+        } else {
+            STORM_LOG_THROW(false, storm::exceptions::InvalidPropertyException, "The subformula of " << pathFormula << " is not supported.");
+        }
+    } else if (opFormula.isTimeOperatorFormula()) {
+        if (pathFormula.isEventuallyFormula()) {
+            auto phi = mc.check(pathFormula.asEventuallyFormula().getSubformula())->asExplicitQualitativeCheckResult().getTruthValuesVector();
+            absorbingStatesForSubformula = getOnlyReachableViaPhi(model, phi);
+        } else {
+            STORM_LOG_THROW(false, storm::exceptions::InvalidPropertyException, "The subformula of " << pathFormula << " is not supported.");
+        }
+    } else if (opFormula.isLongRunAverageOperatorFormula()) {
+        auto lraStates = mc.check(pathFormula)->asExplicitQualitativeCheckResult().getTruthValuesVector();
+        // Compute Sat(Forall F (Forall G not "lraStates"))
+        auto forallGloballyNotLraStates = storm::utility::graph::performProb0A(backwardTransitions, ~lraStates, lraStates);
+        absorbingStatesForSubformula = storm::utility::graph::performProb1A(model.getTransitionMatrix(), model.getNondeterministicChoiceIndices(),
+                                                                            backwardTransitions, ~lraStates, forallGloballyNotLraStates);
+    } else {
+        STORM_LOG_THROW(false, storm::exceptions::InvalidPropertyException,
+                        "Could not preprocess the subformula " << opFormula << " of " << originalFormula << " because it is not supported");
+    }
+    return absorbingStatesForSubformula;
+}
+
+template<typename SparseModelType>
+void SparseMultiObjectivePreprocessor<SparseModelType>::removeIrrelevantStates(std::shared_ptr<SparseModelType>& model,
+                                                                               boost::optional<std::string>& deadlockLabel,
+                                                                               storm::logic::MultiObjectiveFormula const& originalFormula) {
+    storm::storage::BitVector absorbingStates(model->getNumberOfStates(), true);
+    storm::storage::SparseMatrix<ValueType> backwardTransitions = model->getBackwardTransitions();
+
+    // Compute for each subformula a set of states from which we can make any subset absorbing without affecting this subformula.
+    // The analyses only read the model, so they are independent of each other.
+    auto const& subformulas = originalFormula.getSubformulas();
+#ifdef STORM_HAVE_INTELTBB
+    std::vector<storm::storage::BitVector> absorbingStatesForSubformulas(subformulas.size());
+    tbb::parallel_for(tbb::blocked_range<uint64_t>(0, subformulas.size()), [&](tbb::blocked_range<uint64_t> const& range) {
+        for (uint64_t index = range.begin(); index < range.end(); ++index) {
+            absorbingStatesForSubformulas[index] = computeAbsorbingStatesForSubformula(*model, backwardTransitions, *subformulas[index], originalFormula);
+        }
+    });
+    for (auto const& absorbingStatesForSubformula : absorbingStatesForSubformulas) {
         absorbingStates &= absorbingStatesForSubformula;
+    }
+#else
+    for (auto const& opFormula : subformulas) {
+        absorbingStates &= computeAbsorbingStatesForSubformula(*model, backwardTransitions, *opFormula, originalFormula);
         if (absorbingStates.empty()) {
             break;
         }
     }
+#endif
 
     if (!absorbingStates.empty()) {
         // We can make the states absorbing and delete unreachable states.
@@ -223,10 +242,11 @@ void SparseMultiObjectivePreprocessor<SparseModelType>::removeIrrelevantStates(s
         }
         storm::transformer::SubsystemBuilderOptions options;
         options.fixDeadlocks = true;
-        auto const& submodel =
-            storm::transformer::buildSubsystem(*model, storm::storage::BitVector(model->getNumberOfStates(), true), subsystemActions, false, options);
-        STORM_LOG_INFO("Making states absorbing reduced the state space from " << model->getNumberOfStates() << " to " << submodel.model->getNumberOfStates()
-                                                                               << ".");
+        // The model was created during preprocessing, so it can usually be compacted in place.
+        uint64_t numberOfStates = model->getNumberOfStates();
+        auto const& submodel = storm::transformer::buildSubsystemInPlace<typename SparseModelType::ValueType, typename SparseModelType::RewardModelType>(
+            std::move(model), storm::storage::BitVector(numberOfStates, true), subsystemActions, false, options);
+        STORM_LOG_INFO("Making states absorbing reduced the state space from " << numberOfStates << " to " << submodel.model->getNumberOfStates() << ".");
         model = submodel.model->template as<SparseModelType>();
         deadlockLabel = submodel.deadlockLabel;
     }
@@ -722,7 +742,6 @@ template<typename SparseModelType>
 typename SparseMultiObjectivePreprocessor<SparseModelType>::ReturnType SparseMultiObjectivePreprocessor<SparseModelType>::buildResult(
     SparseModelType const& originalModel, storm::logic::MultiObjectiveFormula const& originalFormula, PreprocessorData& data) {
     ReturnType result(originalFormula, originalModel);
-    auto backwardTransitions = data.model->getBackwardTransitions();
     result.preprocessedModel = data.model;
 
     for (auto& obj : data.objectives) {
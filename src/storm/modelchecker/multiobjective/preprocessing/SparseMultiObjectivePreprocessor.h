@@ -6,6 +6,7 @@
 #include "storm/logic/Formulas.h"
 #include "storm/modelchecker/multiobjective/preprocessing/SparseMultiObjectivePreprocessorResult.h"
 #include "storm/storage/BitVector.h"
+#include "storm/storage/SparseMatrix.h"
 #include "storm/storage/memorystructure/MemoryStructure.h"
 
 namespace storm {
@@ -58,6 +59,15 @@ class SparseMultiObjectivePreprocessor {
     static void removeIrrelevantStates(std::shared_ptr<SparseModelType>& model, boost::optional<std::string>& deadlockLabel,
                                        storm::logic::MultiObjectiveFormula const& originalFormula);
 
+    /*!
+     * Computes a set of states from which any subset can be made absorbing without affecting the given subformula.
+     * Only reads the model, so it can be invoked concurrently for different subformulas.
+     */
+    static storm::storage::BitVector computeAbsorbingStatesForSubformula(SparseModelType const& model,
+                                                                         storm::storage::SparseMatrix<ValueType> const& backwardTransitions,
+                                                                         storm::logic::Formula const& opFormula,
+                                                                         storm::logic::MultiObjectiveFormula const& originalFormula);
+
     /*!
      * Apply the neccessary preprocessing for the given formula.
      * @param formula the current (sub)formula
@@ -1,5 +1,8 @@
 #include "storm/modelchecker/prctl/helper/BaierUpperRewardBoundsComputer.h"
 
+#include <unordered_map>
+
+#include "storm/adapters/IntelTbbAdapter.h"
 #include "storm/adapters/RationalNumberAdapter.h"
 #include "storm/storage/BitVector.h"
 #include "storm/storage/SparseMatrix.h"
@@ -181,6 +184,172 @@ std::vector<ValueType> BaierUpperRewardBoundsComputer<ValueType>::computeUpperBo
     return result;
 }
 
+namespace detail {
+
+/*!
+ * Computes for each state of a single SCC an upper bound for the maximal expected times the state is visited.
+ * This is the same procedure as in computeUpperBoundOnExpectedVisitingTimes, restricted to the states of the given SCC.
+ * @param sccStates the states of the SCC in ascending order
+ * @param stateToScc the SCC index of each state
+ * @param localIndices for each state of the SCC, its position in sccStates
+ * @param result the entries of the states of the SCC are set to the computed bounds
+ * @note this only reads and writes data associated with the given SCC, so different SCCs can be processed concurrently
+ */
+template<typename ValueType>
+void computeUpperBoundOnExpectedVisitingTimesForScc(storm::storage::SparseMatrix<ValueType> const& transitionMatrix,
+                                                    storm::storage::SparseMatrix<ValueType> const& backwardTransitions,
+                                                    std::vector<ValueType> const& oneStepTargetProbabilities, std::vector<uint64_t> const& rowGroupIndices,
+                                                    std::vector<uint64_t> const& sccStates, std::vector<uint64_t> const& stateToScc,
+                                                    std::vector<uint64_t> const& localIndices, std::vector<ValueType>& result) {
+    uint64_t const numLocalStates = sccStates.size();
+    uint64_t const scc = stateToScc[sccStates.front()];
+
+    // The choices of the i'th state of the SCC get the local indices choiceOffsets[i], ..., choiceOffsets[i+1]-1.
+    std::vector<uint64_t> choiceOffsets;
+    choiceOffsets.reserve(numLocalStates + 1);
+    choiceOffsets.push_back(0);
+    for (auto const state : sccStates) {
+        choiceOffsets.push_back(choiceOffsets.back() + rowGroupIndices[state + 1] - rowGroupIndices[state]);
+    }
+
+    // Initially, the valid choices are the ones with non-zero probability to go to the target states *or* to a different SCC.
+    storm::storage::BitVector validChoices(choiceOffsets.back(), false);
+    for (uint64_t localState = 0; localState < numLocalStates; ++localState) {
+        for (auto rowIndex = rowGroupIndices[sccStates[localState]], rowEnd = rowGroupIndices[sccStates[localState] + 1]; rowIndex < rowEnd; ++rowIndex) {
+            auto const row = transitionMatrix.getRow(rowIndex);
+            if (!storm::utility::isZero(oneStepTargetProbabilities[rowIndex]) ||
+                std::any_of(row.begin(), row.end(), [&stateToScc, &scc](auto const& entry) { return scc != stateToScc[entry.getColumn()]; })) {
+                validChoices.set(choiceOffsets[localState] + rowIndex - rowGroupIndices[sccStates[localState]], true);
+            }
+        }
+    }
+
+    storm::storage::BitVector processedStates(numLocalStates, false);
+    auto isValidChoice = [&](uint64_t localState, uint64_t const& choice) {
+        uint64_t const localChoice = choiceOffsets[localState] + choice - rowGroupIndices[sccStates[localState]];
+        if (validChoices.get(localChoice)) {
+            return true;
+        }
+        // choices that lead to different SCCs already have been marked as valid above.
+        auto row = transitionMatrix.getRow(choice);
+        if (std::any_of(row.begin(), row.end(), [&](auto const& entry) { return processedStates.get(localIndices[entry.getColumn()]); })) {
+            validChoices.set(localChoice, true);
+            return true;
+        }
+        return false;
+    };
+    auto getChoiceValue = [&](uint64_t const& rowIndex) {
+        ValueType rowValue = oneStepTargetProbabilities[rowIndex];
+        for (auto const& entry : transitionMatrix.getRow(rowIndex)) {
+            if (auto successorState = entry.getColumn(); scc != stateToScc[successorState]) {
+                rowValue += entry.getValue();  // * 1
+            } else if (processedStates.get(localIndices[successorState])) {
+                rowValue += entry.getValue() * result[successorState];
+            }
+        }
+        return rowValue;
+    };
+
+    storm::storage::BitVector candidateStates(numLocalStates, true);
+    uint64_t unprocessedEnd = numLocalStates;
+    auto candidateStateIt = candidateStates.rbegin();
+    auto const candidateStateItEnd = candidateStates.rend();
+    while (true) {
+        uint64_t const localState = *candidateStateIt;
+        uint64_t const state = sccStates[localState];
+        auto const group = transitionMatrix.getRowGroupIndices(state);
+        if (std::all_of(group.begin(), group.end(), [&isValidChoice, &localState](auto const& choice) { return isValidChoice(localState, choice); })) {
+            storm::utility::Minimum<ValueType> minimalStateValue;
+            for (auto choice : group) {
+                minimalStateValue &= getChoiceValue(choice);
+            }
+            result[state] = *minimalStateValue;
+            processedStates.set(localState);
+            if (localState == unprocessedEnd - 1) {
+                unprocessedEnd = processedStates.getStartOfOneSequenceBefore(unprocessedEnd - 1);
+                if (unprocessedEnd == 0) {
+                    break;
+                }
+            }
+            for (auto const& predEntry : backwardTransitions.getRow(state)) {
+                if (auto const pred = predEntry.getColumn(); stateToScc[pred] == scc && !processedStates.get(localIndices[pred])) {
+                    candidateStates.set(localIndices[pred]);
+                }
+            }
+        }
+        candidateStates.set(localState, false);
+        ++candidateStateIt;
+        if (candidateStateIt == candidateStateItEnd) {
+            candidateStateIt = candidateStates.rbegin(unprocessedEnd);
+            STORM_LOG_THROW(candidateStateIt != candidateStateItEnd, storm::exceptions::InvalidOperationException,
+                            "Unable to compute finite upper bounds for visiting times: No more candidates.");
+        }
+    }
+
+    for (auto const state : sccStates) {
+        result[state] = storm::utility::one<ValueType>() / result[state];
+    }
+}
+
+}  // namespace detail
+
+template<typename ValueType>
+std::vector<ValueType> BaierUpperRewardBoundsComputer<ValueType>::computeUpperBoundOnExpectedVisitingTimesParallel(
+    storm::storage::SparseMatrix<ValueType> const& transitionMatrix, storm::storage::SparseMatrix<ValueType> const& backwardTransitions,
+    std::vector<ValueType> const& oneStepTargetProbabilities, std::function<uint64_t(uint64_t)> const& stateToScc) {
+    auto const numStates = transitionMatrix.getRowGroupCount();
+    assert(transitionMatrix.getRowCount() == oneStepTargetProbabilities.size());
+    assert(backwardTransitions.getRowCount() == numStates);
+    // Retrieve the row group indices before going parallel as they might be created on the fly.
+    auto const& rowGroupIndices = transitionMatrix.getRowGroupIndices();
+
+    std::vector<uint64_t> stateToSccVector;
+    if (stateToScc) {
+        stateToSccVector.reserve(numStates);
+        for (uint64_t state = 0; state < numStates; ++state) {
+            stateToSccVector.push_back(stateToScc(state));
+        }
+    } else {
+        stateToSccVector = storm::storage::StronglyConnectedComponentDecomposition<ValueType>(transitionMatrix).computeStateToSccIndexMap(numStates);
+    }
+
+    // Group the states by their SCC. As states are inserted in ascending order, the states of each SCC are sorted.
+    std::vector<std::vector<uint64_t>> sccStates;
+    std::vector<uint64_t> localIndices(numStates);
+    std::unordered_map<uint64_t, uint64_t> sccToGroup;
+    for (uint64_t state = 0; state < numStates; ++state) {
+        auto groupIt = sccToGroup.emplace(stateToSccVector[state], sccStates.size()).first;
+        if (groupIt->second == sccStates.size()) {
+            sccStates.emplace_back();
+        }
+        localIndices[state] = sccStates[groupIt->second].size();
+        sccStates[groupIt->second].push_back(state);
+    }
+
+    std::vector<ValueType> result(numStates);
+    auto processScc = [&](uint64_t group) {
+        detail::computeUpperBoundOnExpectedVisitingTimesForScc(transitionMatrix, backwardTransitions, oneStepTargetProbabilities, rowGroupIndices,
+                                                               sccStates[group], stateToSccVector, localIndices, result);
+    };
+#ifdef STORM_HAVE_INTELTBB
+    tbb::parallel_for(tbb::blocked_range<uint64_t>(0, sccStates.size()), [&processScc](tbb::blocked_range<uint64_t> const& range) {
+        for (auto group = range.begin(); group < range.end(); ++group) {
+            processScc(group);
+        }
+    });
+#else
+    for (uint64_t group = 0; group < sccStates.size(); ++group) {
+        processScc(group);
+    }
+#endif
+    return result;
+}
+
+template<typename ValueType>
+void BaierUpperRewardBoundsComputer<ValueType>::setParallel(bool value) {
+    parallel = value;
+}
+
 template<typename ValueType>
 ValueType BaierUpperRewardBoundsComputer<ValueType>::computeUpperBound() {
     STORM_LOG_TRACE("Computing upper reward bounds using variant-2 of Baier et al.");
@@ -191,8 +360,14 @@ ValueType BaierUpperRewardBoundsComputer<ValueType>::computeUpperBound() {
     }
     auto const& backwardTransRef = backwardTransitions ? *backwardTransitions : computedBackwardTransitions;
 
-    auto expVisits = stateToScc ? computeUpperBoundOnExpectedVisitingTimes(transitionMatrix, backwardTransRef, oneStepTargetProbabilities, stateToScc)
-                                : computeUpperBoundOnExpectedVisitingTimes(transitionMatrix, backwardTransRef, oneStepTargetProbabilities);
+    std::vector<ValueType> expVisits;
+    if (parallel) {
+        expVisits = computeUpperBoundOnExpectedVisitingTimesParallel(transitionMatrix, backwardTransRef, oneStepTargetProbabilities, stateToScc);
+    } else if (stateToScc) {
+        expVisits = computeUpperBoundOnExpectedVisitingTimes(transitionMatrix, backwardTransRef, oneStepTargetProbabilities, stateToScc);
+    } else {
+        expVisits = computeUpperBoundOnExpectedVisitingTimes(transitionMatrix, backwardTransRef, oneStepTargetProbabilities);
+    }
 
     ValueType upperBound = storm::utility::zero<ValueType>();
     for (uint64_t state = 0; state < expVisits.size(); ++state) {
@@ -53,6 +53,11 @@ class BaierUpperRewardBoundsComputer {
      */
     ValueType computeUpperBound();
 
+    /*!
+     * Sets whether the SCCs of the given matrix shall be processed in parallel (if Storm is built with Intel TBB).
+     */
+    void setParallel(bool value);
+
     /*!
      * Computes for each state an upper bound for the maximal expected times each state is visited.
      * The given matrix must not contain end components, i.e., under all strategies a target is reached almost surely.
@@ -91,12 +96,27 @@ class BaierUpperRewardBoundsComputer {
                                                                            std::vector<ValueType> const& oneStepTargetProbabilities,
                                                                            std::function<uint64_t(uint64_t)> const& stateToScc);
 
+    /*!
+     * Same as computeUpperBoundOnExpectedVisitingTimes but the SCCs are processed in parallel (if Storm is built with Intel TBB).
+     * This is possible because the bounds for the states of an SCC only depend on states of the same SCC.
+     * @param transitionMatrix The matrix defining the transitions of the system without the transitions
+     * that lead directly to the goal state.
+     * @param backwardTransitions backward transitions
+     * @param oneStepTargetProbabilities For each choice the probability to go to a goal state in one step.
+     * @param stateToScc if given, the function has to assign to each state the index of its SCC. Otherwise, the SCC decomposition is computed.
+     */
+    static std::vector<ValueType> computeUpperBoundOnExpectedVisitingTimesParallel(storm::storage::SparseMatrix<ValueType> const& transitionMatrix,
+                                                                                   storm::storage::SparseMatrix<ValueType> const& backwardTransitions,
+                                                                                   std::vector<ValueType> const& oneStepTargetProbabilities,
+                                                                                   std::function<uint64_t(uint64_t)> const& stateToScc = {});
+
    private:
     storm::storage::SparseMatrix<ValueType> const& transitionMatrix;
     storm::storage::SparseMatrix<ValueType> const* backwardTransitions;
     std::function<uint64_t(uint64_t)> stateToScc;
     std::vector<ValueType> const& rewards;
     std::vector<ValueType> const& oneStepTargetProbabilities;
+    bool parallel{false};
 };
 }  // namespace helper
 }  // namespace modelchecker
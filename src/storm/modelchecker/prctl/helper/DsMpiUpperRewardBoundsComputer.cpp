@@ -2,11 +2,13 @@
 
 #include "storm-config.h"
 
+#include "storm/adapters/IntelTbbAdapter.h"
 #include "storm/adapters/RationalNumberAdapter.h"
 
 #include "storm/storage/BitVector.h"
 #include "storm/storage/ConsecutiveUint64DynamicPriorityQueue.h"
 #include "storm/storage/SparseMatrix.h"
+#include "storm/storage/StronglyConnectedComponentDecomposition.h"
 
 #include "storm/storage/sparse/StateType.h"
 
@@ -37,7 +39,11 @@ template<typename ValueType>
 std::vector<ValueType> DsMpiDtmcUpperRewardBoundsComputer<ValueType>::computeUpperBounds() {
     STORM_LOG_TRACE("Computing upper reward bounds using DS-MPI.");
     std::chrono::high_resolution_clock::time_point start = std::chrono::high_resolution_clock::now();
-    sweep();
+    if (parallel) {
+        sccSweep();
+    } else {
+        sweep();
+    }
     ValueType lambda = computeLambda();
     STORM_LOG_TRACE("DS-MPI computed lambda as " << lambda << ".");
 
@@ -64,11 +70,29 @@ std::vector<ValueType> DsMpiDtmcUpperRewardBoundsComputer<ValueType>::computeUpp
     return result;
 }
 
+template<typename ValueType>
+void DsMpiDtmcUpperRewardBoundsComputer<ValueType>::setParallel(bool value) {
+    parallel = value;
+}
+
 template<typename ValueType>
 ValueType DsMpiDtmcUpperRewardBoundsComputer<ValueType>::computeLambda() const {
+#ifdef STORM_HAVE_INTELTBB
+    if (parallel) {
+        return tbb::parallel_reduce(
+            tbb::blocked_range<uint64_t>(0, transitionMatrix.getRowGroupCount()), storm::utility::zero<ValueType>(),
+            [this](tbb::blocked_range<uint64_t> const& range, ValueType lambda) {
+                for (auto state = range.begin(); state < range.end(); ++state) {
+                    lambda = std::max(lambda, computeLambdaForChoice(getChoiceInState(state)));
+                }
+                return lambda;
+            },
+            [](ValueType const& a, ValueType const& b) { return std::max(a, b); });
+    }
+#endif
     ValueType lambda = storm::utility::zero<ValueType>();
     for (storm::storage::sparse::state_type state = 0; state < transitionMatrix.getRowGroupCount(); ++state) {
-        lambda = std::max(lambda, computeLambdaForChoice(state));
+        lambda = std::max(lambda, computeLambdaForChoice(getChoiceInState(state)));
     }
     return lambda;
 }
@@ -120,6 +144,16 @@ uint64_t DsMpiDtmcUpperRewardBoundsComputer<ValueType>::getStateForChoice(uint64
     return choice;
 }
 
+template<typename ValueType>
+uint64_t DsMpiDtmcUpperRewardBoundsComputer<ValueType>::getChoiceInState(uint64_t state) const {
+    return state;
+}
+
+template<typename ValueType>
+void DsMpiDtmcUpperRewardBoundsComputer<ValueType>::considerChoiceInState(uint64_t, uint64_t) {
+    // Intentionally left empty: There is only one choice per state.
+}
+
 template<typename ValueType>
 class DsMpiDtmcPriorityLess {
    public:
@@ -177,6 +211,116 @@ void DsMpiDtmcUpperRewardBoundsComputer<ValueType>::sweep() {
     }
 }
 
+template<typename ValueType>
+class DsMpiSccPriorityLess {
+   public:
+    DsMpiSccPriorityLess(DsMpiDtmcUpperRewardBoundsComputer<ValueType> const& dsmpi, std::vector<uint64_t> const& sccStates)
+        : dsmpi(dsmpi), sccStates(sccStates) {
+        // Intentionally left empty.
+    }
+
+    bool operator()(uint64_t const& a, uint64_t const& b) {
+        uint64_t choiceA = dsmpi.getChoiceInState(sccStates[a]);
+        uint64_t choiceB = dsmpi.getChoiceInState(sccStates[b]);
+
+        ValueType const& pa = dsmpi.targetProbabilities[choiceA];
+        ValueType const& pb = dsmpi.targetProbabilities[choiceB];
+        if (pa < pb) {
+            return true;
+        } else if (pa == pb) {
+            return dsmpi.rewards[choiceA] > dsmpi.rewards[choiceB];
+        }
+        return false;
+    }
+
+   private:
+    DsMpiDtmcUpperRewardBoundsComputer<ValueType> const& dsmpi;
+    std::vector<uint64_t> const& sccStates;
+};
+
+template<typename ValueType>
+void DsMpiDtmcUpperRewardBoundsComputer<ValueType>::sccSweep() {
+    auto const numStates = transitionMatrix.getRowGroupCount();
+    storm::storage::StronglyConnectedComponentDecomposition<ValueType> sccDecomposition(
+        transitionMatrix, storm::storage::StronglyConnectedComponentDecompositionOptions().computeSccDepths());
+    auto const stateToScc = sccDecomposition.computeStateToSccIndexMap(numStates);
+
+    // SCCs of the same depth can not reach each other and only depend on SCCs of smaller depth.
+    std::vector<std::vector<uint64_t>> sccsPerDepth(sccDecomposition.getMaxSccDepth() + 1);
+    std::vector<std::vector<uint64_t>> sccStates(sccDecomposition.size());
+    std::vector<uint64_t> localIndices(numStates);
+    for (uint64_t sccIndex = 0; sccIndex < sccDecomposition.size(); ++sccIndex) {
+        sccsPerDepth[sccDecomposition.getSccDepth(sccIndex)].push_back(sccIndex);
+        auto const& scc = sccDecomposition.getBlock(sccIndex);
+        sccStates[sccIndex].assign(scc.begin(), scc.end());
+        for (uint64_t localIndex = 0; localIndex < sccStates[sccIndex].size(); ++localIndex) {
+            localIndices[sccStates[sccIndex][localIndex]] = localIndex;
+        }
+    }
+
+    for (auto const& sccs : sccsPerDepth) {
+#ifdef STORM_HAVE_INTELTBB
+        tbb::parallel_for(tbb::blocked_range<uint64_t>(0, sccs.size()), [&](tbb::blocked_range<uint64_t> const& range) {
+            for (auto i = range.begin(); i < range.end(); ++i) {
+                sweepScc(sccStates[sccs[i]], stateToScc, localIndices);
+            }
+        });
+#else
+        for (auto const sccIndex : sccs) {
+            sweepScc(sccStates[sccIndex], stateToScc, localIndices);
+        }
+#endif
+    }
+}
+
+template<typename ValueType>
+void DsMpiDtmcUpperRewardBoundsComputer<ValueType>::sweepScc(std::vector<uint64_t> const& sccStates, std::vector<uint64_t> const& stateToScc,
+                                                             std::vector<uint64_t> const& localIndices) {
+    uint64_t const sccIndex = stateToScc[sccStates.front()];
+
+    // Account for the (final) values of the successors outside of this SCC. Writing only to choices of this SCC allows processing SCCs concurrently.
+    for (auto const state : sccStates) {
+        for (auto const choice : transitionMatrix.getRowGroupIndices(state)) {
+            bool choiceChanged = false;
+            for (auto const& e : transitionMatrix.getRow(choice)) {
+                if (stateToScc[e.getColumn()] != sccIndex) {
+                    rewards[choice] += e.getValue() * w[e.getColumn()];
+                    targetProbabilities[choice] += e.getValue() * p[e.getColumn()];
+                    choiceChanged = true;
+                }
+            }
+            if (choiceChanged) {
+                considerChoiceInState(state, choice);
+            }
+        }
+    }
+
+    // Perform the sweep within the SCC.
+    storm::storage::ConsecutiveUint64DynamicPriorityQueue<DsMpiSccPriorityLess<ValueType>> queue(sccStates.size(),
+                                                                                                 DsMpiSccPriorityLess<ValueType>(*this, sccStates));
+    storm::storage::BitVector visited(sccStates.size());
+    while (!queue.empty()) {
+        uint64_t const localState = queue.popTop();
+        uint64_t const currentState = sccStates[localState];
+        visited.set(localState);
+
+        uint64_t const choiceInCurrentState = getChoiceInState(currentState);
+        w[currentState] = rewards[choiceInCurrentState];
+        p[currentState] = targetProbabilities[choiceInCurrentState];
+
+        for (auto const& choiceEntry : backwardTransitions.getRow(currentState)) {
+            uint64_t const predecessor = getStateForChoice(choiceEntry.getColumn());
+            if (stateToScc[predecessor] != sccIndex || visited.get(localIndices[predecessor])) {
+                continue;
+            }
+            rewards[choiceEntry.getColumn()] += choiceEntry.getValue() * w[currentState];
+            targetProbabilities[choiceEntry.getColumn()] += choiceEntry.getValue() * p[currentState];
+            considerChoiceInState(predecessor, choiceEntry.getColumn());
+            queue.increase(localIndices[predecessor]);
+        }
+    }
+}
+
 template<typename ValueType>
 DsMpiMdpUpperRewardBoundsComputer<ValueType>::DsMpiMdpUpperRewardBoundsComputer(storm::storage::SparseMatrix<ValueType> const& transitionMatrix,
                                                                                 std::vector<ValueType> const& rewards,
@@ -208,15 +352,6 @@ DsMpiMdpUpperRewardBoundsComputer<ValueType>::DsMpiMdpUpperRewardBoundsComputer(
     }
 }
 
-template<typename ValueType>
-ValueType DsMpiMdpUpperRewardBoundsComputer<ValueType>::computeLambda() const {
-    ValueType lambda = storm::utility::zero<ValueType>();
-    for (storm::storage::sparse::state_type state = 0; state < this->transitionMatrix.getRowGroupCount(); ++state) {
-        lambda = std::max(lambda, this->computeLambdaForChoice(this->getChoiceInState(state)));
-    }
-    return lambda;
-}
-
 template<typename ValueType>
 uint64_t DsMpiMdpUpperRewardBoundsComputer<ValueType>::getStateForChoice(uint64_t choice) const {
     return choiceToState[choice];
@@ -280,18 +415,7 @@ void DsMpiMdpUpperRewardBoundsComputer<ValueType>::sweep() {
 
             // If the choice is not the one that is currently taken in the predecessor state, we might need
             // to update it.
-            uint64_t currentChoiceInPredecessor = this->getChoiceInState(predecessor);
-            if (currentChoiceInPredecessor != choiceEntry.getColumn()) {
-                // Check whether the updates choice now becomes a better choice in the predecessor state.
-                ValueType const& newTargetProbability = this->targetProbabilities[choiceEntry.getColumn()];
-                ValueType const& newReward = this->rewards[choiceEntry.getColumn()];
-                ValueType const& currentTargetProbability = this->targetProbabilities[this->getChoiceInState(predecessor)];
-                ValueType const& currentReward = this->rewards[this->getChoiceInState(predecessor)];
-
-                if (newTargetProbability > currentTargetProbability || (newTargetProbability == currentTargetProbability && newReward < currentReward)) {
-                    setChoiceInState(predecessor, choiceEntry.getColumn());
-                }
-            }
+            considerChoiceInState(predecessor, choiceEntry.getColumn());
 
             // Notify the priority of a potential increase of the priority of the element.
             queue.increase(predecessor);
@@ -304,6 +428,22 @@ uint64_t DsMpiMdpUpperRewardBoundsComputer<ValueType>::getChoiceInState(uint64_t
     return policy[state];
 }
 
+template<typename ValueType>
+void DsMpiMdpUpperRewardBoundsComputer<ValueType>::considerChoiceInState(uint64_t state, uint64_t choice) {
+    uint64_t currentChoice = this->getChoiceInState(state);
+    if (currentChoice != choice) {
+        // Check whether the updated choice now becomes a better choice in the state.
+        ValueType const& newTargetProbability = this->targetProbabilities[choice];
+        ValueType const& newReward = this->rewards[choice];
+        ValueType const& currentTargetProbability = this->targetProbabilities[currentChoice];
+        ValueType const& currentReward = this->rewards[currentChoice];
+
+        if (newTargetProbability > currentTargetProbability || (newTargetProbability == currentTargetProbability && newReward < currentReward)) {
+            setChoiceInState(state, choice);
+        }
+    }
+}
+
 template<typename ValueType>
 void DsMpiMdpUpperRewardBoundsComputer<ValueType>::setChoiceInState(uint64_t state, uint64_t choice) {
     policy[state] = choice;
@@ -15,6 +15,9 @@ namespace helper {
 template<typename ValueType>
 class DsMpiDtmcPriorityLess;
 
+template<typename ValueType>
+class DsMpiSccPriorityLess;
+
 template<typename ValueType>
 class DsMpiDtmcUpperRewardBoundsComputer {
    public:
@@ -36,12 +39,31 @@ class DsMpiDtmcUpperRewardBoundsComputer {
      */
     std::vector<ValueType> computeUpperBounds();
 
+    /*!
+     * Sets whether the sweep shall be performed per SCC, processing SCCs in reverse topological order and SCCs that do not depend on each other in
+     * parallel (if Storm is built with Intel TBB).
+     */
+    void setParallel(bool value);
+
    protected:
     /*!
      * Performs a Dijkstra sweep.
      */
     virtual void sweep();
 
+    /*!
+     * Performs a Dijkstra sweep within each SCC, where an SCC is only processed once all SCCs reachable from it have been processed.
+     */
+    void sccSweep();
+
+    /*!
+     * Performs a Dijkstra sweep within the given SCC. The values of all states in other SCCs reachable from this SCC need to be final.
+     * @param sccStates the states of the SCC
+     * @param stateToScc the SCC index of each state
+     * @param localIndices for each state of the SCC, its position in sccStates
+     */
+    void sweepScc(std::vector<uint64_t> const& sccStates, std::vector<uint64_t> const& stateToScc, std::vector<uint64_t> const& localIndices);
+
     /*!
      * Computes the lambda used for the estimation.
      */
@@ -57,6 +79,16 @@ class DsMpiDtmcUpperRewardBoundsComputer {
      */
     virtual uint64_t getStateForChoice(uint64_t choice) const;
 
+    /*!
+     * Retrieves the choice that is currently selected in the given state.
+     */
+    virtual uint64_t getChoiceInState(uint64_t state) const;
+
+    /*!
+     * Is invoked whenever the values of the given choice have changed, potentially making it a better choice for the given state.
+     */
+    virtual void considerChoiceInState(uint64_t state, uint64_t choice);
+
     // References to input data.
     storm::storage::SparseMatrix<ValueType> const& transitionMatrix;
     std::vector<ValueType> const& originalRewards;
@@ -71,7 +103,10 @@ class DsMpiDtmcUpperRewardBoundsComputer {
     std::vector<ValueType> rewards;
     std::vector<ValueType> targetProbabilities;
 
+    bool parallel{false};
+
     friend class DsMpiDtmcPriorityLess<ValueType>;
+    friend class DsMpiSccPriorityLess<ValueType>;
 };
 
 template<typename ValueType>
@@ -93,9 +128,9 @@ class DsMpiMdpUpperRewardBoundsComputer : public DsMpiDtmcUpperRewardBoundsCompu
 
    private:
     virtual void sweep() override;
-    virtual ValueType computeLambda() const override;
     virtual uint64_t getStateForChoice(uint64_t choice) const override;
-    uint64_t getChoiceInState(uint64_t state) const;
+    virtual uint64_t getChoiceInState(uint64_t state) const override;
+    virtual void considerChoiceInState(uint64_t state, uint64_t choice) override;
     void setChoiceInState(uint64_t state, uint64_t choice);
 
     std::vector<uint64_t> choiceToState;
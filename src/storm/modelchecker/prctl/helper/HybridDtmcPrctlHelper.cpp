@@ -2,6 +2,8 @@
 
 #include "storm/modelchecker/prctl/helper/SparseDtmcPrctlHelper.h"
 
+#include "storm/environment/modelchecker/ModelCheckerEnvironment.h"
+
 #include "storm/solver/LinearEquationSolver.h"
 #include "storm/solver/multiplier/Multiplier.h"
 
@@ -11,6 +13,7 @@
 #include "storm/storage/dd/Odd.h"
 
 #include "storm/utility/constants.h"
+#include "storm/utility/dd.h"
 #include "storm/utility/graph.h"
 
 #include "storm/models/symbolic/StandardRewardModel.h"
@@ -30,6 +33,104 @@ namespace storm {
 namespace modelchecker {
 namespace helper {
 
+template<typename ValueType>
+inline std::vector<ValueType> computeUpperRewardBounds(storm::storage::SparseMatrix<ValueType> const& transitionMatrix, std::vector<ValueType> const& rewards,
+                                                       std::vector<ValueType> const& oneStepTargetProbabilities) {
+    DsMpiDtmcUpperRewardBoundsComputer<ValueType> dsmpi(transitionMatrix, rewards, oneStepTargetProbabilities);
+    std::vector<ValueType> bounds = dsmpi.computeUpperBounds();
+    return bounds;
+}
+
+template<>
+inline std::vector<storm::RationalFunction> computeUpperRewardBounds(storm::storage::SparseMatrix<storm::RationalFunction> const& transitionMatrix,
+                                                                     std::vector<storm::RationalFunction> const& rewards,
+                                                                     std::vector<storm::RationalFunction> const& oneStepTargetProbabilities) {
+    STORM_LOG_THROW(false, storm::exceptions::NotSupportedException, "Computing upper reward bounds is not supported for rational functions.");
+}
+
+template<storm::dd::DdType DdType, typename ValueType>
+storm::dd::Add<DdType, ValueType> solveEquationSystemSccWise(Environment const& env, storm::models::symbolic::Model<DdType, ValueType> const& model,
+                                                             storm::dd::Add<DdType, ValueType> const& transitionMatrix,
+                                                             storm::dd::Bdd<DdType> const& maybeStates, storm::dd::Add<DdType, ValueType> const& vector,
+                                                             boost::optional<ValueType> const& upperBound, bool computeUpperRewardBoundsPerChunk) {
+    // Instead of converting the full equation system, we split the maybe states symbolically into chunks that can be
+    // solved one after another in reverse topological order. Only one chunk is present in explicit form at any time
+    // and the values of the chunks that were already solved are folded into the right-hand side of the later ones.
+    storm::solver::GeneralLinearEquationSolverFactory<ValueType> linearEquationSolverFactory;
+    bool convertToEquationSystem =
+        linearEquationSolverFactory.getEquationProblemFormat(env) == storm::solver::LinearEquationSolverProblemFormat::EquationSystem;
+
+    storm::dd::Bdd<DdType> maybeTransitions =
+        transitionMatrix.notZero() && maybeStates && maybeStates.swapVariables(model.getRowColumnMetaVariablePairs());
+    storm::dd::Add<DdType, ValueType> result = model.getManager().template getAddZero<ValueType>();
+    storm::dd::Bdd<DdType> remainingStates = maybeStates;
+
+    storm::utility::Stopwatch conversionWatch;
+    storm::utility::Stopwatch solvingWatch;
+    uint64_t numberOfChunks = 0;
+    uint64_t largestChunkSize = 0;
+    while (!remainingStates.isZero()) {
+        conversionWatch.start();
+        storm::dd::Bdd<DdType> chunk =
+            storm::utility::dd::computeBottomChunk(remainingStates, maybeTransitions, model.getRowVariables(), model.getColumnVariables());
+        remainingStates &= !chunk;
+        ++numberOfChunks;
+
+        storm::dd::Odd odd = chunk.createOdd();
+        storm::dd::Add<DdType, ValueType> chunkAdd = chunk.template toAdd<ValueType>();
+        storm::dd::Add<DdType, ValueType> submatrix = transitionMatrix * chunkAdd;
+
+        // The right-hand side consists of the given vector and the one-step contribution of the solved states.
+        storm::dd::Add<DdType, ValueType> subvector =
+            vector * chunkAdd + (submatrix * result.swapVariables(model.getRowColumnMetaVariablePairs())).sumAbstract(model.getColumnVariables());
+
+        // If needed, compute the probabilities to leave the chunk, which play the role of target probabilities.
+        boost::optional<storm::dd::Add<DdType, ValueType>> exitProbabilities;
+        if (computeUpperRewardBoundsPerChunk) {
+            exitProbabilities =
+                (submatrix * (!chunk).template toAdd<ValueType>().swapVariables(model.getRowColumnMetaVariablePairs())).sumAbstract(model.getColumnVariables());
+        }
+
+        submatrix *= chunkAdd.swapVariables(model.getRowColumnMetaVariablePairs());
+        if (convertToEquationSystem) {
+            submatrix = (model.getRowColumnIdentity() * chunkAdd) - submatrix;
+        }
+
+        storm::storage::SparseMatrix<ValueType> explicitSubmatrix = submatrix.toMatrix(odd, odd);
+        std::vector<ValueType> b = subvector.toVector(odd);
+        conversionWatch.stop();
+        largestChunkSize = std::max<uint64_t>(largestChunkSize, b.size());
+
+        boost::optional<std::vector<ValueType>> upperBounds;
+        if (exitProbabilities) {
+            STORM_LOG_ASSERT(!convertToEquationSystem, "Upper reward bounds required, but the matrix is in the wrong format for the computation.");
+            upperBounds = computeUpperRewardBounds(explicitSubmatrix, b, exitProbabilities->toVector(odd));
+        }
+
+        solvingWatch.start();
+        std::vector<ValueType> x(b.size(), storm::utility::convertNumber<ValueType>(0.5));
+        std::unique_ptr<storm::solver::LinearEquationSolver<ValueType>> solver = linearEquationSolverFactory.create(env, std::move(explicitSubmatrix));
+        solver->setLowerBound(storm::utility::zero<ValueType>());
+        if (upperBound) {
+            solver->setUpperBound(upperBound.get());
+        }
+        if (upperBounds) {
+            solver->setUpperBounds(std::move(upperBounds.get()));
+        }
+        solver->solveEquations(env, x, b);
+        solvingWatch.stop();
+
+        conversionWatch.start();
+        result += storm::dd::Add<DdType, ValueType>::fromVector(model.getManager(), x, odd, model.getRowVariables());
+        conversionWatch.stop();
+    }
+
+    STORM_LOG_INFO("Solved equation system in " << numberOfChunks << " chunk(s) with at most " << largestChunkSize << " states each (conversion "
+                                                 << conversionWatch.getTimeInMilliseconds() << "ms, solving " << solvingWatch.getTimeInMilliseconds()
+                                                 << "ms).");
+    return result;
+}
+
 template<storm::dd::DdType DdType, typename ValueType>
 std::unique_ptr<CheckResult> HybridDtmcPrctlHelper<DdType, ValueType>::computeUntilProbabilities(Environment const& env,
                                                                                                  storm::models::symbolic::Model<DdType, ValueType> const& model,
@@ -85,6 +186,13 @@ std::unique_ptr<CheckResult> HybridDtmcPrctlHelper<DdType, ValueType>::computeUn
             STORM_LOG_THROW(!req.hasEnabledCriticalRequirement(), storm::exceptions::UncheckedRequirementException,
                             "Solver requirements " + req.getEnabledRequirementsAsString() + " not checked.");
 
+            if (env.modelchecker().isHybridSccSolvingSet()) {
+                storm::dd::Add<DdType, ValueType> values = solveEquationSystemSccWise(env, model, transitionMatrix, maybeStates, subvector,
+                                                                                      boost::make_optional(storm::utility::one<ValueType>()), false);
+                return std::unique_ptr<CheckResult>(new storm::modelchecker::SymbolicQuantitativeCheckResult<DdType, ValueType>(
+                    model.getReachableStates(), statesWithProbability01.second.template toAdd<ValueType>() + values));
+            }
+
             // Check whether we need to create an equation system.
             bool convertToEquationSystem =
                 linearEquationSolverFactory.getEquationProblemFormat(env) == storm::solver::LinearEquationSolverProblemFormat::EquationSystem;
@@ -264,21 +372,6 @@ std::unique_ptr<CheckResult> HybridDtmcPrctlHelper<DdType, ValueType>::computeCu
 }
 
 // This function computes an upper bound on the reachability rewards (see Baier et al, CAV'17).
-template<typename ValueType>
-inline std::vector<ValueType> computeUpperRewardBounds(storm::storage::SparseMatrix<ValueType> const& transitionMatrix, std::vector<ValueType> const& rewards,
-                                                       std::vector<ValueType> const& oneStepTargetProbabilities) {
-    DsMpiDtmcUpperRewardBoundsComputer<ValueType> dsmpi(transitionMatrix, rewards, oneStepTargetProbabilities);
-    std::vector<ValueType> bounds = dsmpi.computeUpperBounds();
-    return bounds;
-}
-
-template<>
-inline std::vector<storm::RationalFunction> computeUpperRewardBounds(storm::storage::SparseMatrix<storm::RationalFunction> const& transitionMatrix,
-                                                                     std::vector<storm::RationalFunction> const& rewards,
-                                                                     std::vector<storm::RationalFunction> const& oneStepTargetProbabilities) {
-    STORM_LOG_THROW(false, storm::exceptions::NotSupportedException, "Computing upper reward bounds is not supported for rational functions.");
-}
-
 template<storm::dd::DdType DdType, typename ValueType>
 std::unique_ptr<CheckResult> HybridDtmcPrctlHelper<DdType, ValueType>::computeReachabilityRewards(
     Environment const& env, storm::models::symbolic::Model<DdType, ValueType> const& model, storm::dd::Add<DdType, ValueType> const& transitionMatrix,
@@ -338,6 +431,15 @@ std::unique_ptr<CheckResult> HybridDtmcPrctlHelper<DdType, ValueType>::computeRe
             STORM_LOG_THROW(!req.hasEnabledCriticalRequirement(), storm::exceptions::UncheckedRequirementException,
                             "Solver requirements " + req.getEnabledRequirementsAsString() + " not checked.");
 
+            if (env.modelchecker().isHybridSccSolvingSet()) {
+                storm::dd::Add<DdType, ValueType> values =
+                    solveEquationSystemSccWise(env, model, transitionMatrix, maybeStates, subvector, boost::none, oneStepTargetProbs.is_initialized());
+                return std::unique_ptr<CheckResult>(new storm::modelchecker::SymbolicQuantitativeCheckResult<DdType, ValueType>(
+                    model.getReachableStates(), infinityStates.ite(model.getManager().getConstant(storm::utility::infinity<ValueType>()),
+                                                                   model.getManager().template getAddZero<ValueType>()) +
+                                                    values));
+            }
+
             // Check whether we need to create an equation system.
             bool convertToEquationSystem =
                 linearEquationSolverFactory.getEquationProblemFormat(env) == storm::solver::LinearEquationSolverProblemFormat::EquationSystem;
@@ -2,6 +2,8 @@
 
 #include "storm/modelchecker/prctl/helper/SymbolicMdpPrctlHelper.h"
 
+#include "storm/environment/modelchecker/ModelCheckerEnvironment.h"
+
 #include "storm/storage/MaximalEndComponentDecomposition.h"
 #include "storm/storage/dd/Add.h"
 #include "storm/storage/dd/Bdd.h"
@@ -9,6 +11,7 @@
 #include "storm/storage/dd/Odd.h"
 
 #include "storm/utility/constants.h"
+#include "storm/utility/dd.h"
 #include "storm/utility/graph.h"
 
 #include "storm/models/symbolic/StandardRewardModel.h"
@@ -133,6 +136,69 @@ void eliminateEndComponentsAndExtendedStatesUntilProbabilities(
     }
 }
 
+template<storm::dd::DdType DdType, typename ValueType>
+storm::dd::Add<DdType, ValueType> solveMinMaxEquationSystemSccWise(Environment const& env, OptimizationDirection dir,
+                                                                   storm::models::symbolic::NondeterministicModel<DdType, ValueType> const& model,
+                                                                   storm::dd::Add<DdType, ValueType> const& transitionMatrix,
+                                                                   storm::dd::Bdd<DdType> const& maybeStates, storm::dd::Add<DdType, ValueType> const& vector,
+                                                                   bool hasNoEndComponents) {
+    // Instead of converting the full equation system, we split the maybe states symbolically into chunks that can be
+    // solved one after another in reverse topological order. Only one chunk is present in explicit form at any time
+    // and the values of the chunks that were already solved are folded into the right-hand side of the later ones.
+    storm::solver::GeneralMinMaxLinearEquationSolverFactory<ValueType> linearEquationSolverFactory;
+
+    storm::dd::Bdd<DdType> maybeTransitions = transitionMatrix.notZero().existsAbstract(model.getNondeterminismVariables()) && maybeStates &&
+                                              maybeStates.swapVariables(model.getRowColumnMetaVariablePairs());
+    storm::dd::Add<DdType, ValueType> result = model.getManager().template getAddZero<ValueType>();
+    storm::dd::Bdd<DdType> remainingStates = maybeStates;
+
+    storm::utility::Stopwatch conversionWatch;
+    storm::utility::Stopwatch solvingWatch;
+    uint64_t numberOfChunks = 0;
+    uint64_t largestChunkSize = 0;
+    while (!remainingStates.isZero()) {
+        conversionWatch.start();
+        storm::dd::Bdd<DdType> chunk =
+            storm::utility::dd::computeBottomChunk(remainingStates, maybeTransitions, model.getRowVariables(), model.getColumnVariables());
+        remainingStates &= !chunk;
+        ++numberOfChunks;
+
+        storm::dd::Odd odd = chunk.createOdd();
+        storm::dd::Add<DdType, ValueType> chunkAdd = chunk.template toAdd<ValueType>();
+        storm::dd::Add<DdType, ValueType> submatrix = transitionMatrix * chunkAdd;
+
+        // The right-hand side consists of the given vector and the one-step contribution of the solved states.
+        storm::dd::Add<DdType, ValueType> subvector =
+            vector * chunkAdd + (submatrix * result.swapVariables(model.getRowColumnMetaVariablePairs())).sumAbstract(model.getColumnVariables());
+        submatrix *= chunkAdd.swapVariables(model.getRowColumnMetaVariablePairs());
+
+        std::pair<storm::storage::SparseMatrix<ValueType>, std::vector<ValueType>> explicitRepresentation =
+            submatrix.toMatrixVector(subvector, model.getNondeterminismVariables(), odd, odd);
+        conversionWatch.stop();
+        largestChunkSize = std::max<uint64_t>(largestChunkSize, explicitRepresentation.first.getRowGroupCount());
+
+        solvingWatch.start();
+        std::vector<ValueType> x(explicitRepresentation.first.getRowGroupCount(), storm::utility::zero<ValueType>());
+        std::unique_ptr<storm::solver::MinMaxLinearEquationSolver<ValueType>> solver =
+            linearEquationSolverFactory.create(env, std::move(explicitRepresentation.first));
+        solver->setHasUniqueSolution(hasNoEndComponents);
+        solver->setHasNoEndComponents(hasNoEndComponents);
+        solver->setBounds(storm::utility::zero<ValueType>(), storm::utility::one<ValueType>());
+        solver->setRequirementsChecked();
+        solver->solveEquations(env, dir, x, explicitRepresentation.second);
+        solvingWatch.stop();
+
+        conversionWatch.start();
+        result += storm::dd::Add<DdType, ValueType>::fromVector(model.getManager(), x, odd, model.getRowVariables());
+        conversionWatch.stop();
+    }
+
+    STORM_LOG_INFO("Solved equation system in " << numberOfChunks << " chunk(s) with at most " << largestChunkSize << " states each (conversion "
+                                                 << conversionWatch.getTimeInMilliseconds() << "ms, solving " << solvingWatch.getTimeInMilliseconds()
+                                                 << "ms).");
+    return result;
+}
+
 template<storm::dd::DdType DdType, typename ValueType>
 std::unique_ptr<CheckResult> HybridMdpPrctlHelper<DdType, ValueType>::computeUntilProbabilities(
     Environment const& env, OptimizationDirection dir, storm::models::symbolic::NondeterministicModel<DdType, ValueType> const& model,
@@ -189,6 +255,24 @@ std::unique_ptr<CheckResult> HybridMdpPrctlHelper<DdType, ValueType>::computeUnt
                                 "Solver requirements " + clearedRequirements.getEnabledRequirementsAsString() + " not checked.");
             }
 
+            // The SCC-wise solving is only possible if the solver does not require additional preprocessing of the full system.
+            bool sccWise = env.modelchecker().isHybridSccSolvingSet();
+            if (sccWise && (extendMaybeStates || requirements.validInitialScheduler())) {
+                STORM_LOG_WARN("Solving the equation system SCC-wise is not supported for the selected solver requirements. Falling back to a single "
+                               "conversion.");
+                sccWise = false;
+            }
+            if (sccWise) {
+                storm::dd::Add<DdType, ValueType> prob1StatesAsColumn =
+                    statesWithProbability01.second.template toAdd<ValueType>().swapVariables(model.getRowColumnMetaVariablePairs());
+                storm::dd::Add<DdType, ValueType> subvector =
+                    (transitionMatrix * maybeStates.template toAdd<ValueType>() * prob1StatesAsColumn).sumAbstract(model.getColumnVariables());
+                storm::dd::Add<DdType, ValueType> values =
+                    solveMinMaxEquationSystemSccWise(env, dir, model, transitionMatrix, maybeStates, subvector, hasNoEndComponents);
+                return std::unique_ptr<CheckResult>(new storm::modelchecker::SymbolicQuantitativeCheckResult<DdType, ValueType>(
+                    model.getReachableStates(), statesWithProbability01.second.template toAdd<ValueType>() + values));
+            }
+
             storm::dd::Bdd<DdType> extendedMaybeStates = maybeStates;
             if (extendMaybeStates) {
                 // Extend the maybe states by all non-maybe states that can be reached from a maybe state within one step (they
@@ -1,5 +1,6 @@
 #include "storm/modelchecker/prctl/helper/SparseDtmcPrctlHelper.h"
 
+#include "storm/adapters/IntelTbbAdapter.h"
 #include "storm/adapters/RationalFunctionAdapter.h"
 #include "storm/modelchecker/csl/helper/SparseCtmcCslHelper.h"
 
@@ -84,17 +85,19 @@ std::map<storm::storage::sparse::state_type, ValueType> SparseDtmcPrctlHelper<Va
     storm::solver::GeneralLinearEquationSolverFactory<ValueType> linearEquationSolverFactory;
     rewardUnfolding.setEquationSystemFormatForEpochModel(linearEquationSolverFactory.getEquationProblemFormat(preciseEnv));
 
+    // If enabled, independent epochs are analyzed in parallel.
+    uint64_t maxBatchSize = 1;
+#ifdef STORM_HAVE_INTELTBB
+    if (env.solver().isUseIntelTbb()) {
+        maxBatchSize = std::max<uint64_t>(1, tbb::this_task_arena::max_concurrency());
+    }
+#endif
+
     storm::utility::ProgressMeasurement progress("epochs");
     progress.setMaxCount(epochOrder.size());
     progress.startNewMeasurement(0);
     uint64_t numCheckedEpochs = 0;
-    for (auto const& epoch : epochOrder) {
-        swBuild.start();
-        auto& epochModel = rewardUnfolding.setCurrentEpoch(epoch);
-        swBuild.stop();
-        swCheck.start();
-        rewardUnfolding.setSolutionForCurrentEpoch(epochModel.analyzeSingleObjective(preciseEnv, x, b, linEqSolver, lowerBound, upperBound));
-        swCheck.stop();
+    auto processCheckedEpoch = [&](auto const& epoch) {
         if (storm::settings::getModule<storm::settings::modules::IOSettings>().isExportCdfSet() &&
             !rewardUnfolding.getEpochManager().hasBottomDimension(epoch)) {
             std::vector<ValueType> cdfEntry;
@@ -108,8 +111,50 @@ std::map<storm::storage::sparse::state_type, ValueType> SparseDtmcPrctlHelper<Va
         }
         ++numCheckedEpochs;
         progress.updateProgress(numCheckedEpochs);
-        if (storm::utility::resources::isTerminate()) {
-            break;
+    };
+    if (maxBatchSize > 1) {
+#ifdef STORM_HAVE_INTELTBB
+        // Analyze independent epochs concurrently. Each epoch model of a batch gets its own solver and workspace.
+        std::vector<std::vector<ValueType>> xs, bs;
+        std::vector<std::unique_ptr<storm::solver::LinearEquationSolver<ValueType>>> linEqSolvers;
+        for (auto const& batch : rewardUnfolding.getEpochComputationBatches(epochOrder, maxBatchSize)) {
+            swBuild.start();
+            auto& epochModels = rewardUnfolding.setCurrentEpochBatch(batch);
+            swBuild.stop();
+            swCheck.start();
+            xs.resize(epochModels.size());
+            bs.resize(epochModels.size());
+            linEqSolvers.resize(epochModels.size());
+            std::vector<std::vector<ValueType>> solutions(batch.size());
+            tbb::parallel_for(tbb::blocked_range<uint64_t>(0, batch.size()), [&](tbb::blocked_range<uint64_t> const& range) {
+                for (uint64_t i = range.begin(); i < range.end(); ++i) {
+                    solutions[i] = epochModels[i].analyzeSingleObjective(preciseEnv, xs[i], bs[i], linEqSolvers[i], lowerBound, upperBound);
+                }
+            });
+            rewardUnfolding.setSolutionsForCurrentEpochBatch(std::move(solutions));
+            swCheck.stop();
+            for (auto const& epoch : batch) {
+                processCheckedEpoch(epoch);
+            }
+            if (storm::utility::resources::isTerminate()) {
+                storm::utility::resources::reportAbortedComputation();
+                break;
+            }
+        }
+#endif
+    } else {
+        for (auto const& epoch : epochOrder) {
+            swBuild.start();
+            auto& epochModel = rewardUnfolding.setCurrentEpoch(epoch);
+            swBuild.stop();
+            swCheck.start();
+            rewardUnfolding.setSolutionForCurrentEpoch(epochModel.analyzeSingleObjective(preciseEnv, x, b, linEqSolver, lowerBound, upperBound));
+            swCheck.stop();
+            processCheckedEpoch(epoch);
+            if (storm::utility::resources::isTerminate()) {
+                storm::utility::resources::reportAbortedComputation();
+                break;
+            }
         }
     }
 
@@ -177,7 +222,8 @@ std::vector<ValueType> SparseDtmcPrctlHelper<ValueType, RewardModelType>::comput
     } else {
         // Get all states that have probability 0 and 1 of satisfying the until-formula.
         std::pair<storm::storage::BitVector, storm::storage::BitVector> statesWithProbability01 =
-            storm::utility::graph::performProb01(backwardTransitions, phiStates, psiStates);
+            goal.getAnalysisCache() ? goal.getAnalysisCache()->performProb01(transitionMatrix, backwardTransitions, phiStates, psiStates)
+                                    : storm::utility::graph::performProb01(backwardTransitions, phiStates, psiStates);
         storm::storage::BitVector statesWithProbability0 = std::move(statesWithProbability01.first);
         statesWithProbability1 = std::move(statesWithProbability01.second);
         maybeStates = ~(statesWithProbability0 | statesWithProbability1);
@@ -422,15 +468,16 @@ std::vector<ValueType> SparseDtmcPrctlHelper<ValueType, RewardModelType>::comput
 
 // This function computes an upper bound on the reachability rewards (see Baier et al, CAV'17).
 template<typename ValueType>
-std::vector<ValueType> computeUpperRewardBounds(storm::storage::SparseMatrix<ValueType> const& transitionMatrix, std::vector<ValueType> const& rewards,
-                                                std::vector<ValueType> const& oneStepTargetProbabilities) {
+std::vector<ValueType> computeUpperRewardBounds(Environment const& env, storm::storage::SparseMatrix<ValueType> const& transitionMatrix,
+                                                std::vector<ValueType> const& rewards, std::vector<ValueType> const& oneStepTargetProbabilities) {
     DsMpiDtmcUpperRewardBoundsComputer<ValueType> dsmpi(transitionMatrix, rewards, oneStepTargetProbabilities);
+    dsmpi.setParallel(env.solver().isUseIntelTbb());
     std::vector<ValueType> bounds = dsmpi.computeUpperBounds();
     return bounds;
 }
 
 template<>
-std::vector<storm::RationalFunction> computeUpperRewardBounds(storm::storage::SparseMatrix<storm::RationalFunction> const& transitionMatrix,
+std::vector<storm::RationalFunction> computeUpperRewardBounds(Environment const&, storm::storage::SparseMatrix<storm::RationalFunction> const& transitionMatrix,
                                                               std::vector<storm::RationalFunction> const& rewards,
                                                               std::vector<storm::RationalFunction> const& oneStepTargetProbabilities) {
     STORM_LOG_THROW(false, storm::exceptions::NotSupportedException, "Computing upper reward bounds is not supported for rational functions.");
@@ -509,7 +556,7 @@ std::vector<ValueType> SparseDtmcPrctlHelper<ValueType, RewardModelType>::comput
             boost::optional<std::vector<ValueType>> upperRewardBounds;
             requirements.clearLowerBounds();
             if (requirements.upperBounds()) {
-                upperRewardBounds = computeUpperRewardBounds(submatrix, b, transitionMatrix.getConstrainedRowSumVector(maybeStates, rew0States));
+                upperRewardBounds = computeUpperRewardBounds(env, submatrix, b, transitionMatrix.getConstrainedRowSumVector(maybeStates, rew0States));
                 requirements.clearUpperBounds();
             }
             STORM_LOG_THROW(!requirements.hasEnabledCriticalRequirement(), storm::exceptions::UncheckedRequirementException,
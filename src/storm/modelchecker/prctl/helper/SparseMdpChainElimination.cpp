@@ -0,0 +1,198 @@
+#include "storm/modelchecker/prctl/helper/SparseMdpChainElimination.h"
+
+#include <algorithm>
+#include <limits>
+
+#include "storm/storage/SparseMatrix.h"
+#include "storm/utility/constants.h"
+#include "storm/utility/macros.h"
+#include "storm/utility/vector.h"
+
+#include "storm/adapters/RationalNumberAdapter.h"
+
+namespace storm {
+namespace modelchecker {
+namespace helper {
+
+template<typename ValueType>
+const uint64_t SparseMdpChainElimination<ValueType>::NO_TARGET = std::numeric_limits<uint64_t>::max();
+
+template<typename ValueType>
+SparseMdpChainElimination<ValueType>::SparseMdpChainElimination(uint64_t numberOfStates)
+    : remainingStates(numberOfStates, true),
+      targets(numberOfStates, NO_TARGET),
+      factors(numberOfStates, storm::utility::zero<ValueType>()),
+      offsets(numberOfStates, storm::utility::zero<ValueType>()) {
+    // Intentionally left empty.
+}
+
+template<typename ValueType>
+SparseMdpChainElimination<ValueType> SparseMdpChainElimination<ValueType>::eliminateChains(storm::storage::SparseMatrix<ValueType>& submatrix,
+                                                                                           std::vector<ValueType>& b,
+                                                                                           storm::storage::BitVector const& protectedStates,
+                                                                                           std::vector<ValueType>* oneStepTargetProbabilities) {
+    uint64_t const numberOfStates = submatrix.getRowGroupCount();
+    auto const& rowGroupIndices = submatrix.getRowGroupIndices();
+    SparseMdpChainElimination<ValueType> result(numberOfStates);
+
+    // Determine the states that can be eliminated, i.e., unprotected states with a single choice that has at most one successor (apart from itself).
+    storm::storage::BitVector eliminatedStates(numberOfStates, false);
+    for (uint64_t state = 0; state < numberOfStates; ++state) {
+        if (!protectedStates.get(state) && rowGroupIndices[state + 1] - rowGroupIndices[state] == 1) {
+            auto row = submatrix.getRow(rowGroupIndices[state]);
+            if (row.getNumberOfEntries() == 0 || (row.getNumberOfEntries() == 1 && row.begin()->getColumn() != state)) {
+                eliminatedStates.set(state, true);
+            }
+        }
+    }
+    if (eliminatedStates.empty()) {
+        return result;
+    }
+
+    // Follow the chains of eliminated states until a remaining state is reached and compute the value of each eliminated state as an affine function
+    // of the value of that remaining state. Chains that form a cycle are broken up by keeping one state of the cycle.
+    storm::storage::BitVector resolvedStates(numberOfStates, false);
+    storm::storage::BitVector statesOnPath(numberOfStates, false);
+    std::vector<uint64_t> path;
+    for (uint64_t state = 0; state < numberOfStates; ++state) {
+        uint64_t currentState = state;
+        while (eliminatedStates.get(currentState) && !resolvedStates.get(currentState)) {
+            if (statesOnPath.get(currentState)) {
+                eliminatedStates.set(currentState, false);
+                break;
+            }
+            statesOnPath.set(currentState, true);
+            path.push_back(currentState);
+            auto row = submatrix.getRow(rowGroupIndices[currentState]);
+            if (row.getNumberOfEntries() == 0) {
+                break;
+            }
+            currentState = row.begin()->getColumn();
+        }
+
+        for (auto pathIt = path.rbegin(); pathIt != path.rend(); ++pathIt) {
+            uint64_t const pathState = *pathIt;
+            statesOnPath.set(pathState, false);
+            if (!eliminatedStates.get(pathState)) {
+                continue;
+            }
+            result.offsets[pathState] = b[rowGroupIndices[pathState]];
+            auto row = submatrix.getRow(rowGroupIndices[pathState]);
+            if (row.getNumberOfEntries() != 0) {
+                auto const& entry = *row.begin();
+                if (eliminatedStates.get(entry.getColumn())) {
+                    STORM_LOG_ASSERT(resolvedStates.get(entry.getColumn()), "Expected the successor on the chain to be resolved.");
+                    result.targets[pathState] = result.targets[entry.getColumn()];
+                    result.factors[pathState] = entry.getValue() * result.factors[entry.getColumn()];
+                    result.offsets[pathState] += entry.getValue() * result.offsets[entry.getColumn()];
+                } else {
+                    result.targets[pathState] = entry.getColumn();
+                    result.factors[pathState] = entry.getValue();
+                }
+            }
+            resolvedStates.set(pathState, true);
+        }
+        path.clear();
+    }
+
+    result.remainingStates = ~eliminatedStates;
+    uint64_t const numberOfRemainingStates = result.remainingStates.getNumberOfSetBits();
+    std::vector<uint64_t> newStateIndices(numberOfStates, NO_TARGET);
+    uint64_t newStateIndex = 0;
+    for (auto state : result.remainingStates) {
+        newStateIndices[state] = newStateIndex;
+        ++newStateIndex;
+    }
+    for (auto state : eliminatedStates) {
+        if (result.targets[state] != NO_TARGET) {
+            result.targets[state] = newStateIndices[result.targets[state]];
+        }
+    }
+
+    // Substitute the eliminated states in the rows of the remaining states.
+    storm::storage::SparseMatrixBuilder<ValueType> builder(0, numberOfRemainingStates, 0, false, true, numberOfRemainingStates);
+    std::vector<ValueType> newB;
+    std::vector<ValueType> newOneStepTargetProbabilities;
+    std::vector<std::pair<uint64_t, ValueType>> rowEntries;
+    uint64_t newRow = 0;
+    for (auto state : result.remainingStates) {
+        builder.newRowGroup(newRow);
+        for (uint64_t row = rowGroupIndices[state]; row < rowGroupIndices[state + 1]; ++row) {
+            ValueType rowOffset = b[row];
+            ValueType oneStepTargetProbability = oneStepTargetProbabilities ? (*oneStepTargetProbabilities)[row] : storm::utility::zero<ValueType>();
+            for (auto const& entry : submatrix.getRow(row)) {
+                uint64_t const column = entry.getColumn();
+                if (result.remainingStates.get(column)) {
+                    rowEntries.emplace_back(newStateIndices[column], entry.getValue());
+                } else {
+                    rowOffset += entry.getValue() * result.offsets[column];
+                    if (result.targets[column] == NO_TARGET) {
+                        oneStepTargetProbability += entry.getValue();
+                    } else {
+                        rowEntries.emplace_back(result.targets[column], entry.getValue() * result.factors[column]);
+                        oneStepTargetProbability += entry.getValue() * (storm::utility::one<ValueType>() - result.factors[column]);
+                    }
+                }
+            }
+
+            // Entries for the same column are merged.
+            std::sort(rowEntries.begin(), rowEntries.end(), [](auto const& lhs, auto const& rhs) { return lhs.first < rhs.first; });
+            for (auto entryIt = rowEntries.begin(); entryIt != rowEntries.end();) {
+                ValueType value = entryIt->second;
+                auto nextEntryIt = entryIt + 1;
+                for (; nextEntryIt != rowEntries.end() && nextEntryIt->first == entryIt->first; ++nextEntryIt) {
+                    value += nextEntryIt->second;
+                }
+                builder.addNextValue(newRow, entryIt->first, value);
+                entryIt = nextEntryIt;
+            }
+            rowEntries.clear();
+
+            newB.push_back(std::move(rowOffset));
+            if (oneStepTargetProbabilities) {
+                newOneStepTargetProbabilities.push_back(std::move(oneStepTargetProbability));
+            }
+            ++newRow;
+        }
+    }
+    submatrix = builder.build(newRow, numberOfRemainingStates, numberOfRemainingStates);
+    b = std::move(newB);
+    if (oneStepTargetProbabilities) {
+        *oneStepTargetProbabilities = std::move(newOneStepTargetProbabilities);
+    }
+
+    STORM_LOG_INFO("Eliminated " << (numberOfStates - numberOfRemainingStates) << " of " << numberOfStates
+                                 << " states with a single choice and at most one successor (" << numberOfRemainingStates << " states remaining).");
+    return result;
+}
+
+template<typename ValueType>
+bool SparseMdpChainElimination<ValueType>::hasEliminatedStates() const {
+    return !remainingStates.full();
+}
+
+template<typename ValueType>
+storm::storage::BitVector const& SparseMdpChainElimination<ValueType>::getRemainingStates() const {
+    return remainingStates;
+}
+
+template<typename ValueType>
+std::vector<ValueType> SparseMdpChainElimination<ValueType>::expandValues(std::vector<ValueType> const& valuesOfRemainingStates) const {
+    STORM_LOG_ASSERT(valuesOfRemainingStates.size() == remainingStates.getNumberOfSetBits(), "Unexpected number of values.");
+    std::vector<ValueType> result(remainingStates.size());
+    storm::utility::vector::setVectorValues(result, remainingStates, valuesOfRemainingStates);
+    for (auto state : ~remainingStates) {
+        result[state] = offsets[state];
+        if (targets[state] != NO_TARGET) {
+            result[state] += factors[state] * valuesOfRemainingStates[targets[state]];
+        }
+    }
+    return result;
+}
+
+template class SparseMdpChainElimination<double>;
+template class SparseMdpChainElimination<storm::RationalNumber>;
+
+}  // namespace helper
+}  // namespace modelchecker
+}  // namespace storm
@@ -0,0 +1,71 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include "storm/storage/BitVector.h"
+
+namespace storm {
+namespace storage {
+template<typename ValueType>
+class SparseMatrix;
+}  // namespace storage
+
+namespace modelchecker {
+namespace helper {
+
+/*!
+ * Shrinks an equation system of the form x = min/max (A * x + b) by eliminating the states that have a single choice with at most one successor.
+ * For such a state s we have x_s = a * x_t + b_s, which is substituted into all predecessors of s. Chains of such states are thereby collapsed into
+ * single transitions without introducing new nonzero entries. A typical example are chains of states without reward and without nondeterminism.
+ */
+template<typename ValueType>
+class SparseMdpChainElimination {
+   public:
+    /*!
+     * Eliminates the states of the given equation system that have a single choice with at most one successor.
+     *
+     * @param submatrix The matrix A of the equation system. It is replaced by the matrix of the reduced system.
+     * @param b The vector of the equation system. It is replaced by the vector of the reduced system.
+     * @param protectedStates States (i.e., row groups of the given matrix) that must not be eliminated.
+     * @param oneStepTargetProbabilities If given, the probabilities to leave the system within one step (one entry for each row). These are adapted to
+     * the reduced system.
+     * @return Information that is necessary to obtain the values of the eliminated states from the solution of the reduced system.
+     */
+    static SparseMdpChainElimination<ValueType> eliminateChains(storm::storage::SparseMatrix<ValueType>& submatrix, std::vector<ValueType>& b,
+                                                                storm::storage::BitVector const& protectedStates,
+                                                                std::vector<ValueType>* oneStepTargetProbabilities = nullptr);
+
+    /*!
+     * Retrieves whether at least one state has been eliminated.
+     */
+    bool hasEliminatedStates() const;
+
+    /*!
+     * Retrieves the states of the original system that are contained in the reduced system.
+     */
+    storm::storage::BitVector const& getRemainingStates() const;
+
+    /*!
+     * Computes the values of all states of the original system from the solution of the reduced system.
+     */
+    std::vector<ValueType> expandValues(std::vector<ValueType> const& valuesOfRemainingStates) const;
+
+   private:
+    SparseMdpChainElimination(uint64_t numberOfStates);
+
+    // The states that have not been eliminated.
+    storm::storage::BitVector remainingStates;
+
+    // For each eliminated state s, its value is given by factors[s] * x_{targets[s]} + offsets[s], where x is the solution of the reduced system and
+    // targets[s] refers to the row group in the reduced system. If the value of s does not depend on any remaining state, the target is NO_TARGET.
+    std::vector<uint64_t> targets;
+    std::vector<ValueType> factors;
+    std::vector<ValueType> offsets;
+
+    static const uint64_t NO_TARGET;
+};
+
+}  // namespace helper
+}  // namespace modelchecker
+}  // namespace storm
@@ -1,5 +1,8 @@
 #include "storm/modelchecker/prctl/helper/SparseMdpPrctlHelper.h"
 
+#include <optional>
+#include <utility>
+
 #include <boost/container/flat_map.hpp>
 
 #include "storm/modelchecker/prctl/helper/SemanticSolutionType.h"
@@ -7,13 +10,16 @@
 #include "storm/modelchecker/hints/ExplicitModelCheckerHint.h"
 #include "storm/modelchecker/prctl/helper/BaierUpperRewardBoundsComputer.h"
 #include "storm/modelchecker/prctl/helper/DsMpiUpperRewardBoundsComputer.h"
+#include "storm/modelchecker/prctl/helper/SparseMdpChainElimination.h"
 #include "storm/modelchecker/prctl/helper/SparseMdpEndComponentInformation.h"
 #include "storm/modelchecker/results/ExplicitQuantitativeCheckResult.h"
 
 #include "storm/models/sparse/StandardRewardModel.h"
 
 #include "storm/storage/MaximalEndComponentDecomposition.h"
+#include "storm/storage/SparseMatrixView.h"
 
+#include "storm/utility/Instrumentation.h"
 #include "storm/utility/graph.h"
 #include "storm/utility/macros.h"
 #include "storm/utility/vector.h"
@@ -27,7 +33,6 @@
 #include "storm/solver/multiplier/Multiplier.h"
 
 #include "storm/settings/SettingsManager.h"
-#include "storm/settings/modules/CoreSettings.h"
 #include "storm/settings/modules/GeneralSettings.h"
 #include "storm/settings/modules/IOSettings.h"
 #include "storm/settings/modules/ModelCheckerSettings.h"
@@ -36,10 +41,10 @@
 #include "storm/utility/NumberTraits.h"
 #include "storm/utility/ProgressMeasurement.h"
 #include "storm/utility/SignalHandler.h"
-#include "storm/utility/Stopwatch.h"
 
 #include "storm/transformer/EndComponentEliminator.h"
 
+#include "storm/environment/modelchecker/ModelCheckerEnvironment.h"
 #include "storm/environment/solver/MinMaxSolverEnvironment.h"
 
 #include "storm/exceptions/IllegalArgumentException.h"
@@ -61,7 +66,7 @@ std::map<storm::storage::sparse::state_type, SolutionType> SparseMdpPrctlHelper<
     if constexpr (std::is_same_v<ValueType, storm::Interval>) {
         STORM_LOG_THROW(false, storm::exceptions::NotImplementedException, "We do not support computing reward bounded values with interval models.");
     } else {
-        storm::utility::Stopwatch swAll(true), swBuild, swCheck;
+        storm::utility::instrumentation::ScopedRegion region("reward bounded value computation");
 
         // Get lower and upper bounds for the solution.
         auto lowerBound = rewardUnfolding.getLowerObjectiveBound();
@@ -83,17 +88,19 @@ std::map<storm::storage::sparse::state_type, SolutionType> SparseMdpPrctlHelper<
         // In case of cdf export we store the necessary data.
         std::vector<std::vector<ValueType>> cdfData;
 
+        // If enabled, independent epochs are analyzed in parallel.
+        uint64_t maxBatchSize = 1;
+#ifdef STORM_HAVE_INTELTBB
+        if (env.solver().isUseIntelTbb()) {
+            maxBatchSize = std::max<uint64_t>(1, tbb::this_task_arena::max_concurrency());
+        }
+#endif
+
         storm::utility::ProgressMeasurement progress("epochs");
         progress.setMaxCount(epochOrder.size());
         progress.startNewMeasurement(0);
         uint64_t numCheckedEpochs = 0;
-        for (auto const& epoch : epochOrder) {
-            swBuild.start();
-            auto& epochModel = rewardUnfolding.setCurrentEpoch(epoch);
-            swBuild.stop();
-            swCheck.start();
-            rewardUnfolding.setSolutionForCurrentEpoch(epochModel.analyzeSingleObjective(preciseEnv, dir, x, b, minMaxSolver, lowerBound, upperBound));
-            swCheck.stop();
+        auto processCheckedEpoch = [&](auto const& epoch) {
             if (storm::settings::getModule<storm::settings::modules::IOSettings>().isExportCdfSet() &&
                 !rewardUnfolding.getEpochManager().hasBottomDimension(epoch)) {
                 std::vector<ValueType> cdfEntry;
@@ -107,8 +114,58 @@ std::map<storm::storage::sparse::state_type, SolutionType> SparseMdpPrctlHelper<
             }
             ++numCheckedEpochs;
             progress.updateProgress(numCheckedEpochs);
-            if (storm::utility::resources::isTerminate()) {
-                break;
+        };
+        if (maxBatchSize > 1) {
+#ifdef STORM_HAVE_INTELTBB
+            // Analyze independent epochs concurrently. Each epoch model of a batch gets its own solver and workspace.
+            std::vector<std::vector<ValueType>> xs, bs;
+            std::vector<std::unique_ptr<storm::solver::MinMaxLinearEquationSolver<ValueType>>> minMaxSolvers;
+            for (auto const& batch : rewardUnfolding.getEpochComputationBatches(epochOrder, maxBatchSize)) {
+                std::vector<rewardbounded::EpochModel<ValueType, true>>* epochModels;
+                {
+                    storm::utility::instrumentation::ScopedRegion buildRegion("epoch model building");
+                    epochModels = &rewardUnfolding.setCurrentEpochBatch(batch);
+                }
+                {
+                    storm::utility::instrumentation::ScopedRegion checkRegion("epoch model checking");
+                    xs.resize(epochModels->size());
+                    bs.resize(epochModels->size());
+                    minMaxSolvers.resize(epochModels->size());
+                    std::vector<std::vector<ValueType>> solutions(batch.size());
+                    tbb::parallel_for(tbb::blocked_range<uint64_t>(0, batch.size()), [&](tbb::blocked_range<uint64_t> const& range) {
+                        for (uint64_t i = range.begin(); i < range.end(); ++i) {
+                            solutions[i] =
+                                (*epochModels)[i].analyzeSingleObjective(preciseEnv, dir, xs[i], bs[i], minMaxSolvers[i], lowerBound, upperBound);
+                        }
+                    });
+                    rewardUnfolding.setSolutionsForCurrentEpochBatch(std::move(solutions));
+                }
+                for (auto const& epoch : batch) {
+                    processCheckedEpoch(epoch);
+                }
+                if (storm::utility::resources::isTerminate()) {
+                    storm::utility::resources::reportAbortedComputation();
+                    break;
+                }
+            }
+#endif
+        } else {
+            for (auto const& epoch : epochOrder) {
+                rewardbounded::EpochModel<ValueType, true>* epochModel;
+                {
+                    storm::utility::instrumentation::ScopedRegion buildRegion("epoch model building");
+                    epochModel = &rewardUnfolding.setCurrentEpoch(epoch);
+                }
+                {
+                    storm::utility::instrumentation::ScopedRegion checkRegion("epoch model checking");
+                    rewardUnfolding.setSolutionForCurrentEpoch(
+                        epochModel->analyzeSingleObjective(preciseEnv, dir, x, b, minMaxSolver, lowerBound, upperBound));
+                }
+                processCheckedEpoch(epoch);
+                if (storm::utility::resources::isTerminate()) {
+                    storm::utility::resources::reportAbortedComputation();
+                    break;
+                }
             }
         }
 
@@ -117,8 +174,6 @@ std::map<storm::storage::sparse::state_type, SolutionType> SparseMdpPrctlHelper<
             result[initState] = rewardUnfolding.getInitialStateResult(initEpoch, initState);
         }
 
-        swAll.stop();
-
         if (storm::settings::getModule<storm::settings::modules::IOSettings>().isExportCdfSet()) {
             std::vector<std::string> headers;
             for (uint64_t i = 0; i < rewardUnfolding.getEpochManager().getDimensionCount(); ++i) {
@@ -129,16 +184,7 @@ std::map<storm::storage::sparse::state_type, SolutionType> SparseMdpPrctlHelper<
                 storm::settings::getModule<storm::settings::modules::IOSettings>().getExportCdfDirectory() + "cdf.csv", cdfData, headers);
         }
 
-        if (storm::settings::getModule<storm::settings::modules::CoreSettings>().isShowStatisticsSet()) {
-            STORM_PRINT_AND_LOG("---------------------------------\n");
-            STORM_PRINT_AND_LOG("Statistics:\n");
-            STORM_PRINT_AND_LOG("---------------------------------\n");
-            STORM_PRINT_AND_LOG("          #checked epochs: " << epochOrder.size() << ".\n");
-            STORM_PRINT_AND_LOG("             overall Time: " << swAll << ".\n");
-            STORM_PRINT_AND_LOG("Epoch Model building Time: " << swBuild << ".\n");
-            STORM_PRINT_AND_LOG("Epoch Model checking Time: " << swCheck << ".\n");
-            STORM_PRINT_AND_LOG("---------------------------------\n");
-        }
+        storm::utility::instrumentation::addToCounter("reward bounded value computation: checked epochs", numCheckedEpochs);
 
         return result;
     }
@@ -433,10 +479,10 @@ struct MaybeStateResult {
     boost::optional<std::vector<uint64_t>> scheduler;
 };
 
-template<typename ValueType, typename SolutionType>
+template<typename ValueType, typename SolutionType, typename MatrixType>
 MaybeStateResult<SolutionType> computeValuesForMaybeStates(Environment const& env, storm::solver::SolveGoal<ValueType, SolutionType>&& goal,
-                                                           storm::storage::SparseMatrix<ValueType>&& submatrix, std::vector<ValueType> const& b,
-                                                           bool produceScheduler, SparseMdpHintType<SolutionType>& hint) {
+                                                           MatrixType&& submatrix, std::vector<ValueType> const& b, bool produceScheduler,
+                                                           SparseMdpHintType<SolutionType>& hint) {
     // Initialize the solution vector.
     std::vector<SolutionType> x =
         hint.hasValueHint() ? std::move(hint.getValueHint())
@@ -446,7 +492,7 @@ MaybeStateResult<SolutionType> computeValuesForMaybeStates(Environment const& en
     // Set up the solver.
     storm::solver::GeneralMinMaxLinearEquationSolverFactory<ValueType, SolutionType> minMaxLinearEquationSolverFactory;
     std::unique_ptr<storm::solver::MinMaxLinearEquationSolver<ValueType, SolutionType>> solver =
-        storm::solver::configureMinMaxLinearEquationSolver(env, std::move(goal), minMaxLinearEquationSolverFactory, std::move(submatrix));
+        storm::solver::configureMinMaxLinearEquationSolver(env, std::move(goal), minMaxLinearEquationSolverFactory, std::forward<MatrixType>(submatrix));
     solver->setRequirementsChecked();
     solver->setUncertaintyIsRobust(goal.isRobust());
     solver->setHasUniqueSolution(hint.hasUniqueSolution());
@@ -530,7 +576,10 @@ QualitativeStateSetsUntilProbabilities computeQualitativeStateSetsUntilProbabili
 
     // Get all states that have probability 0 and 1 of satisfying the until-formula.
     std::pair<storm::storage::BitVector, storm::storage::BitVector> statesWithProbability01;
-    if (goal.minimize()) {
+    if (goal.getAnalysisCache()) {
+        statesWithProbability01 = goal.minimize() ? goal.getAnalysisCache()->performProb01Min(transitionMatrix, backwardTransitions, phiStates, psiStates)
+                                                  : goal.getAnalysisCache()->performProb01Max(transitionMatrix, backwardTransitions, phiStates, psiStates);
+    } else if (goal.minimize()) {
         statesWithProbability01 =
             storm::utility::graph::performProb01Min(transitionMatrix, transitionMatrix.getRowGroupIndices(), backwardTransitions, phiStates, psiStates);
     } else {
@@ -603,7 +652,8 @@ template<typename ValueType, typename SolutionType>
 void computeFixedPointSystemUntilProbabilities(storm::solver::SolveGoal<ValueType, SolutionType>& goal,
                                                storm::storage::SparseMatrix<ValueType> const& transitionMatrix,
                                                QualitativeStateSetsUntilProbabilities const& qualitativeStateSets,
-                                               storm::storage::SparseMatrix<ValueType>& submatrix, std::vector<ValueType>& b) {
+                                               storm::storage::SparseMatrix<ValueType>& submatrix, std::vector<ValueType>& b,
+                                               std::optional<storm::storage::SparseMatrixView<ValueType>>* submatrixView = nullptr) {
     if constexpr (std::is_same_v<ValueType, storm::Interval>) {
         // For non-interval based models, we can eliminate the rows and columns from the original transition probability matrix for states
         // whose probabilities are already known... However, there is information in the transition to those states.
@@ -620,8 +670,12 @@ void computeFixedPointSystemUntilProbabilities(storm::solver::SolveGoal<ValueTyp
         storm::utility::vector::setAllValues(b, transitionMatrix.getRowFilter(qualitativeStateSets.statesWithProbability1));
     } else {
         // First, we can eliminate the rows and columns from the original transition probability matrix for states
-        // whose probabilities are already known.
-        submatrix = transitionMatrix.getSubmatrix(true, qualitativeStateSets.maybeStates, qualitativeStateSets.maybeStates, false);
+        // whose probabilities are already known. If requested, we only create a view on these rows and columns instead of copying them.
+        if (submatrixView) {
+            submatrixView->emplace(transitionMatrix, qualitativeStateSets.maybeStates, qualitativeStateSets.maybeStates);
+        } else {
+            submatrix = transitionMatrix.getSubmatrix(true, qualitativeStateSets.maybeStates, qualitativeStateSets.maybeStates, false);
+        }
 
         // Prepare the right-hand side of the equation system. For entry i this corresponds to
         // the accumulated probability of going from state i to some state that has probability 1.
@@ -645,7 +699,11 @@ boost::optional<SparseMdpEndComponentInformation<ValueType>> computeFixedPointSy
     storm::storage::MaximalEndComponentDecomposition<ValueType> endComponentDecomposition;
     if (doDecomposition) {
         // Compute the states that are in MECs.
-        endComponentDecomposition = storm::storage::MaximalEndComponentDecomposition<ValueType>(transitionMatrix, backwardTransitions, candidateStates);
+        if (goal.getAnalysisCache()) {
+            endComponentDecomposition = *goal.getAnalysisCache()->getMaximalEndComponents(transitionMatrix, backwardTransitions, candidateStates);
+        } else {
+            endComponentDecomposition = storm::storage::MaximalEndComponentDecomposition<ValueType>(transitionMatrix, backwardTransitions, candidateStates);
+        }
     }
 
     // Only do more work if there are actually end-components.
@@ -730,6 +788,7 @@ MDPSparseModelCheckingHelperReturnType<SolutionType> SparseMdpPrctlHelper<ValueT
 
             // Declare the components of the equation system we will solve.
             storm::storage::SparseMatrix<ValueType> submatrix;
+            std::optional<storm::storage::SparseMatrixView<ValueType>> submatrixView;
             std::vector<ValueType> b;
 
             // If the hint information tells us that we have to eliminate MECs, we do so now.
@@ -738,13 +797,15 @@ MDPSparseModelCheckingHelperReturnType<SolutionType> SparseMdpPrctlHelper<ValueT
                 ecInformation = computeFixedPointSystemUntilProbabilitiesEliminateEndComponents(goal, transitionMatrix, backwardTransitions,
                                                                                                 qualitativeStateSets, submatrix, b, produceScheduler);
             } else {
-                // Otherwise, we compute the standard equations.
-                computeFixedPointSystemUntilProbabilities(goal, transitionMatrix, qualitativeStateSets, submatrix, b);
+                // Otherwise, we compute the standard equations. Value iteration operates on a view of the submatrix, so it does not need to be copied.
+                bool useView = env.solver().minMax().getMethod() == storm::solver::MinMaxMethod::ValueIteration;
+                computeFixedPointSystemUntilProbabilities(goal, transitionMatrix, qualitativeStateSets, submatrix, b, useView ? &submatrixView : nullptr);
             }
 
             // Now compute the results for the maybe states.
             MaybeStateResult<SolutionType> resultForMaybeStates =
-                computeValuesForMaybeStates(env, std::move(goal), std::move(submatrix), b, produceScheduler, hintInformation);
+                submatrixView ? computeValuesForMaybeStates(env, std::move(goal), std::as_const(*submatrixView), b, produceScheduler, hintInformation)
+                              : computeValuesForMaybeStates(env, std::move(goal), std::move(submatrix), b, produceScheduler, hintInformation);
 
             // If we eliminated end components, we need to extract the result differently.
             if (ecInformation && ecInformation.get().getEliminatedEndComponents()) {
@@ -797,9 +858,14 @@ MDPSparseModelCheckingHelperReturnType<SolutionType> SparseMdpPrctlHelper<ValueT
     bool useMecBasedTechnique) {
     if (useMecBasedTechnique) {
         // TODO: does this really work for minimizing objectives?
-        storm::storage::MaximalEndComponentDecomposition<ValueType> mecDecomposition(transitionMatrix, backwardTransitions, psiStates);
+        std::shared_ptr<storm::storage::MaximalEndComponentDecomposition<ValueType> const> mecDecomposition;
+        if (goal.getAnalysisCache()) {
+            mecDecomposition = goal.getAnalysisCache()->getMaximalEndComponents(transitionMatrix, backwardTransitions, psiStates);
+        } else {
+            mecDecomposition = std::make_shared<storm::storage::MaximalEndComponentDecomposition<ValueType>>(transitionMatrix, backwardTransitions, psiStates);
+        }
         storm::storage::BitVector statesInPsiMecs(transitionMatrix.getRowGroupCount());
-        for (auto const& mec : mecDecomposition) {
+        for (auto const& mec : *mecDecomposition) {
             for (auto const& stateActionsPair : mec) {
                 statesInPsiMecs.set(stateActionsPair.first, true);
             }
@@ -1270,7 +1336,7 @@ boost::optional<SparseMdpEndComponentInformation<ValueType>> computeFixedPointSy
 }
 
 template<typename ValueType, typename SolutionType>
-void computeUpperRewardBounds(SparseMdpHintType<SolutionType>& hintInformation, storm::OptimizationDirection const& direction,
+void computeUpperRewardBounds(Environment const& env, SparseMdpHintType<SolutionType>& hintInformation, storm::OptimizationDirection const& direction,
                               storm::storage::SparseMatrix<ValueType> const& submatrix, std::vector<ValueType> const& choiceRewards,
                               std::vector<ValueType> const& oneStepTargetProbabilities) {
     if constexpr (std::is_same_v<ValueType, storm::Interval>) {
@@ -1279,9 +1345,11 @@ void computeUpperRewardBounds(SparseMdpHintType<SolutionType>& hintInformation,
         // For the min-case, we use DS-MPI, for the max-case variant 2 of the Baier et al. paper (CAV'17).
         if (direction == storm::OptimizationDirection::Minimize) {
             DsMpiMdpUpperRewardBoundsComputer<ValueType> dsmpi(submatrix, choiceRewards, oneStepTargetProbabilities);
+            dsmpi.setParallel(env.solver().isUseIntelTbb());
             hintInformation.upperResultBounds = dsmpi.computeUpperBounds();
         } else {
             BaierUpperRewardBoundsComputer<ValueType> baier(submatrix, choiceRewards, oneStepTargetProbabilities);
+            baier.setParallel(env.solver().isUseIntelTbb());
             hintInformation.upperResultBound = baier.computeUpperBound();
         }
     }
@@ -1370,15 +1438,34 @@ MDPSparseModelCheckingHelperReturnType<SolutionType> SparseMdpPrctlHelper<ValueT
                                                            submatrix, b, oneStepTargetProbabilities ? &oneStepTargetProbabilities.get() : nullptr);
             }
 
+            // If requested, we shrink the equation system by eliminating states with a single choice and at most one successor. As the values of
+            // such states are recovered afterwards, we only do so if no scheduler or state-wise hints are involved.
+            boost::optional<SparseMdpChainElimination<ValueType>> chainElimination;
+            if constexpr (!std::is_same_v<ValueType, storm::Interval>) {
+                if (env.modelchecker().isChainEliminationSet() && !ecInformation && !produceScheduler && !hintInformation.hasSchedulerHint() &&
+                    !hintInformation.hasValueHint() && !hintInformation.hasUpperResultBounds()) {
+                    storm::storage::BitVector protectedStates =
+                        goal.hasRelevantValues() ? goal.relevantValues() : storm::storage::BitVector(submatrix.getRowGroupCount(), false);
+                    chainElimination = SparseMdpChainElimination<ValueType>::eliminateChains(
+                        submatrix, b, protectedStates, oneStepTargetProbabilities ? &oneStepTargetProbabilities.get() : nullptr);
+                    goal.restrictRelevantValues(chainElimination->getRemainingStates());
+                }
+            }
+
             // If we need to compute upper bounds, do so now.
             if (hintInformation.getComputeUpperBounds()) {
                 STORM_LOG_ASSERT(oneStepTargetProbabilities, "Expecting one step target probability vector to be available.");
-                computeUpperRewardBounds(hintInformation, goal.direction(), submatrix, b, oneStepTargetProbabilities.get());
+                computeUpperRewardBounds(env, hintInformation, goal.direction(), submatrix, b, oneStepTargetProbabilities.get());
             }
 
             // Now compute the results for the maybe states.
             MaybeStateResult<SolutionType> resultForMaybeStates =
                 computeValuesForMaybeStates(env, std::move(goal), std::move(submatrix), b, produceScheduler, hintInformation);
+            if constexpr (!std::is_same_v<ValueType, storm::Interval>) {
+                if (chainElimination && chainElimination->hasEliminatedStates()) {
+                    resultForMaybeStates.values = chainElimination->expandValues(resultForMaybeStates.getValues());
+                }
+            }
 
             // If we eliminated end components, we need to extract the result differently.
             if (ecInformation && ecInformation.get().getEliminatedEndComponents()) {
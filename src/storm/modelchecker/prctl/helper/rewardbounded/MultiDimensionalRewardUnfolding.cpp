@@ -1,9 +1,11 @@
 #include "storm/modelchecker/prctl/helper/rewardbounded/MultiDimensionalRewardUnfolding.h"
 
+#include <algorithm>
 #include <functional>
 #include <set>
 #include <string>
 
+#include "storm/adapters/IntelTbbAdapter.h"
 #include "storm/logic/Formulas.h"
 #include "storm/utility/macros.h"
 
@@ -394,26 +396,117 @@ MultiDimensionalRewardUnfolding<ValueType, SingleObjectiveMode>::getEpochComputa
             }
         }
     }
+    if (stopAtComputedEpochs) {
+        // Solutions might be reused for computation orders of further start epochs, so we keep them until all predecessor epochs are analyzed.
+        epochsOfComputationOrder = boost::none;
+    } else {
+        epochsOfComputationOrder = std::set<Epoch>(collectedEpochs.begin(), collectedEpochs.end());
+    }
     return std::vector<Epoch>(collectedEpochs.begin(), collectedEpochs.end());
 }
 
 template<typename ValueType, bool SingleObjectiveMode>
 EpochModel<ValueType, SingleObjectiveMode>& MultiDimensionalRewardUnfolding<ValueType, SingleObjectiveMode>::setCurrentEpoch(Epoch const& epoch) {
     STORM_LOG_DEBUG("Setting model for epoch " << epochManager.toString(epoch));
+    epochModel.epochMatrixChanged = updateEpochClass(epoch);
+    setStepSolutions(epoch, epochModel);
+    currentEpoch = epoch;
+    currentEpochBatch.clear();
+    return epochModel;
+}
+
+template<typename ValueType, bool SingleObjectiveMode>
+std::vector<std::vector<typename MultiDimensionalRewardUnfolding<ValueType, SingleObjectiveMode>::Epoch>>
+MultiDimensionalRewardUnfolding<ValueType, SingleObjectiveMode>::getEpochComputationBatches(std::vector<Epoch> const& epochOrder, uint64_t maxBatchSize) const {
+    STORM_LOG_ASSERT(maxBatchSize > 0, "Batches need to contain at least one epoch.");
+    std::vector<std::vector<Epoch>> batches;
+    std::set<Epoch> epochsInCurrentBatch;
+    for (auto const& epoch : epochOrder) {
+        // An epoch can join the current batch if it has the same epoch class and does not depend on an epoch of the current batch.
+        bool startNewBatch = batches.empty() || batches.back().size() >= maxBatchSize || !epochManager.compareEpochClass(epoch, batches.back().front());
+        if (!startNewBatch) {
+            for (auto const& step : possibleEpochSteps) {
+                if (epochsInCurrentBatch.count(epochManager.getSuccessorEpoch(epoch, step)) > 0) {
+                    startNewBatch = true;
+                    break;
+                }
+            }
+        }
+        if (startNewBatch) {
+            batches.emplace_back();
+            epochsInCurrentBatch.clear();
+        }
+        batches.back().push_back(epoch);
+        epochsInCurrentBatch.insert(epoch);
+    }
+    return batches;
+}
+
+template<typename ValueType, bool SingleObjectiveMode>
+std::vector<EpochModel<ValueType, SingleObjectiveMode>>& MultiDimensionalRewardUnfolding<ValueType, SingleObjectiveMode>::setCurrentEpochBatch(
+    std::vector<Epoch> const& epochs) {
+    STORM_LOG_ASSERT(!epochs.empty(), "Tried to set an empty batch of epochs.");
+    STORM_LOG_DEBUG("Setting models for a batch of " << epochs.size() << " epochs starting at epoch " << epochManager.toString(epochs.front()));
+    epochModel.epochMatrixChanged = updateEpochClass(epochs.front());
+    if (batchEpochModels.size() < epochs.size()) {
+        // Resizing moves the existing epoch models, so solvers that refer to their matrices need to be rebuilt.
+        batchEpochModels.resize(epochs.size());
+        numberOfUpToDateBatchEpochModels = 0;
+    }
+    // The epoch models of the batch share the data of the epoch class, which only needs to be copied if the epoch class changed.
+    for (uint64_t batchIndex = 0; batchIndex < epochs.size(); ++batchIndex) {
+        STORM_LOG_ASSERT(epochManager.compareEpochClass(epochs[batchIndex], epochs.front()), "Epochs of a batch need to have the same epoch class.");
+        auto& batchEpochModel = batchEpochModels[batchIndex];
+        if (batchIndex >= numberOfUpToDateBatchEpochModels) {
+            batchEpochModel = epochModel;
+            batchEpochModel.epochMatrixChanged = true;
+        } else {
+            batchEpochModel.epochMatrixChanged = false;
+        }
+    }
+    numberOfUpToDateBatchEpochModels = std::max<uint64_t>(numberOfUpToDateBatchEpochModels, epochs.size());
+
+    // The step solutions only depend on solutions of previous batches, so they can be computed concurrently.
+    auto setStepSolutionsForBatchIndex = [&](uint64_t batchIndex) { setStepSolutions(epochs[batchIndex], batchEpochModels[batchIndex]); };
+#ifdef STORM_HAVE_INTELTBB
+    if (epochs.size() > 1) {
+        tbb::parallel_for(tbb::blocked_range<uint64_t>(0, epochs.size()), [&](tbb::blocked_range<uint64_t> const& range) {
+            for (uint64_t batchIndex = range.begin(); batchIndex < range.end(); ++batchIndex) {
+                setStepSolutionsForBatchIndex(batchIndex);
+            }
+        });
+    } else
+#endif
+    {
+        for (uint64_t batchIndex = 0; batchIndex < epochs.size(); ++batchIndex) {
+            setStepSolutionsForBatchIndex(batchIndex);
+        }
+    }
+    currentEpoch = boost::none;
+    currentEpochBatch = epochs;
+    return batchEpochModels;
+}
 
+template<typename ValueType, bool SingleObjectiveMode>
+bool MultiDimensionalRewardUnfolding<ValueType, SingleObjectiveMode>::updateEpochClass(Epoch const& epoch) {
     // Check if we need to update the current epoch class
-    if (!currentEpoch || !epochManager.compareEpochClass(epoch, currentEpoch.get())) {
+    if (!epochOfCurrentEpochClass || !epochManager.compareEpochClass(epoch, epochOfCurrentEpochClass.get())) {
         setCurrentEpochClass(epoch);
-        epochModel.epochMatrixChanged = true;
+        epochOfCurrentEpochClass = epoch;
+        numberOfUpToDateBatchEpochModels = 0;
         if (storm::settings::getModule<storm::settings::modules::CoreSettings>().isShowStatisticsSet()) {
             if (storm::utility::graph::hasCycle(epochModel.epochMatrix)) {
                 std::cout << "Epoch model for epoch " << epochManager.toString(epoch) << " is cyclic.\n";
             }
         }
-    } else {
-        epochModel.epochMatrixChanged = false;
+        return true;
     }
+    return false;
+}
 
+template<typename ValueType, bool SingleObjectiveMode>
+void MultiDimensionalRewardUnfolding<ValueType, SingleObjectiveMode>::setStepSolutions(Epoch const& epoch,
+                                                                                      EpochModel<ValueType, SingleObjectiveMode>& targetEpochModel) const {
     bool containsLowerBoundedObjective = false;
     for (auto const& dimension : dimensions) {
         if (dimension.boundType == DimensionBoundType::LowerBound) {
@@ -430,9 +523,9 @@ EpochModel<ValueType, SingleObjectiveMode>& MultiDimensionalRewardUnfolding<Valu
             subSolutions.emplace(successorEpoch, &successorSolIt->second);
         }
     }
-    epochModel.stepSolutions.resize(epochModel.stepChoices.getNumberOfSetBits());
-    auto stepSolIt = epochModel.stepSolutions.begin();
-    for (auto reducedChoice : epochModel.stepChoices) {
+    targetEpochModel.stepSolutions.resize(targetEpochModel.stepChoices.getNumberOfSetBits());
+    auto stepSolIt = targetEpochModel.stepSolutions.begin();
+    for (auto reducedChoice : targetEpochModel.stepChoices) {
         uint64_t productChoice = epochModelToProductChoiceMap[reducedChoice];
         uint64_t productState = productModel->getProductStateFromChoice(productChoice);
         auto const& memoryState = productModel->getMemoryState(productState);
@@ -443,7 +536,7 @@ EpochModel<ValueType, SingleObjectiveMode>& MultiDimensionalRewardUnfolding<Valu
         // a) there is an upper bounded subObjective that is __still_relevant__ but the corresponding reward bound is passed after taking the choice
         // b) there is a lower bounded subObjective and the corresponding reward bound is not passed yet.
         for (uint64_t objIndex = 0; objIndex < this->objectives.size(); ++objIndex) {
-            bool rewardEarned = !storm::utility::isZero(epochModel.objectiveRewards[objIndex][reducedChoice]);
+            bool rewardEarned = !storm::utility::isZero(targetEpochModel.objectiveRewards[objIndex][reducedChoice]);
             if (rewardEarned) {
                 for (auto dim : objectiveDimensions[objIndex]) {
                     if ((dimensions[dim].boundType == DimensionBoundType::UpperBound) == epochManager.isBottomDimension(successorEpoch, dim) &&
@@ -453,7 +546,7 @@ EpochModel<ValueType, SingleObjectiveMode>& MultiDimensionalRewardUnfolding<Valu
                     }
                 }
             }
-            epochModel.objectiveRewardFilter[objIndex].set(reducedChoice, rewardEarned);
+            targetEpochModel.objectiveRewardFilter[objIndex].set(reducedChoice, rewardEarned);
         }
         // compute the solution for the stepChoices
         // For optimization purposes, we distinguish the case where the memory state does not have to be transformed
@@ -486,28 +579,14 @@ EpochModel<ValueType, SingleObjectiveMode>& MultiDimensionalRewardUnfolding<Valu
         ++stepSolIt;
     }
 
-    assert(epochModel.objectiveRewards.size() == objectives.size());
-    assert(epochModel.objectiveRewardFilter.size() == objectives.size());
-    assert(epochModel.epochMatrix.getRowCount() == epochModel.stepChoices.size());
-    assert(epochModel.stepChoices.size() == epochModel.objectiveRewards.front().size());
-    assert(epochModel.objectiveRewards.front().size() == epochModel.objectiveRewards.back().size());
-    assert(epochModel.objectiveRewards.front().size() == epochModel.objectiveRewardFilter.front().size());
-    assert(epochModel.objectiveRewards.back().size() == epochModel.objectiveRewardFilter.back().size());
-    assert(epochModel.stepChoices.getNumberOfSetBits() == epochModel.stepSolutions.size());
-
-    currentEpoch = epoch;
-    /*
-    std::cout << "Epoch model for epoch " << storm::utility::vector::toString(epoch) << '\n';
-    std::cout << "Matrix: \n" << epochModel.epochMatrix << '\n';
-    std::cout << "ObjectiveRewards: " << storm::utility::vector::toString(epochModel.objectiveRewards[0]) << '\n';
-    std::cout << "steps: " << epochModel.stepChoices << '\n';
-    std::cout << "step solutions: ";
-    for (int i = 0; i < epochModel.stepSolutions.size(); ++i) {
-        std::cout << "   " << epochModel.stepSolutions[i].weightedValue;
-    }
-    std::cout << '\n';
-    */
-    return epochModel;
+    assert(targetEpochModel.objectiveRewards.size() == objectives.size());
+    assert(targetEpochModel.objectiveRewardFilter.size() == objectives.size());
+    assert(targetEpochModel.epochMatrix.getRowCount() == targetEpochModel.stepChoices.size());
+    assert(targetEpochModel.stepChoices.size() == targetEpochModel.objectiveRewards.front().size());
+    assert(targetEpochModel.objectiveRewards.front().size() == targetEpochModel.objectiveRewards.back().size());
+    assert(targetEpochModel.objectiveRewards.front().size() == targetEpochModel.objectiveRewardFilter.front().size());
+    assert(targetEpochModel.objectiveRewards.back().size() == targetEpochModel.objectiveRewardFilter.back().size());
+    assert(targetEpochModel.stepChoices.getNumberOfSetBits() == targetEpochModel.stepSolutions.size());
 }
 
 template<typename ValueType, bool SingleObjectiveMode>
@@ -860,23 +939,53 @@ boost::optional<ValueType> MultiDimensionalRewardUnfolding<ValueType, SingleObje
 template<typename ValueType, bool SingleObjectiveMode>
 void MultiDimensionalRewardUnfolding<ValueType, SingleObjectiveMode>::setSolutionForCurrentEpoch(std::vector<SolutionType>&& inStateSolutions) {
     STORM_LOG_ASSERT(currentEpoch, "Tried to set a solution for the current epoch, but no epoch was specified before.");
+    storeEpochSolution(currentEpoch.get(), std::move(inStateSolutions));
+}
+
+template<typename ValueType, bool SingleObjectiveMode>
+void MultiDimensionalRewardUnfolding<ValueType, SingleObjectiveMode>::setSolutionsForCurrentEpochBatch(
+    std::vector<std::vector<SolutionType>>&& inStateSolutions) {
+    STORM_LOG_ASSERT(!currentEpochBatch.empty(), "Tried to set solutions for the current batch of epochs, but no batch was specified before.");
+    STORM_LOG_ASSERT(inStateSolutions.size() == currentEpochBatch.size(), "Invalid number of epoch solutions.");
+    // As the epochs of a batch do not depend on each other, no solution that is required for the batch is removed before all solutions have been computed.
+    for (uint64_t batchIndex = 0; batchIndex < currentEpochBatch.size(); ++batchIndex) {
+        storeEpochSolution(currentEpochBatch[batchIndex], std::move(inStateSolutions[batchIndex]));
+    }
+    currentEpochBatch.clear();
+}
+
+template<typename ValueType, bool SingleObjectiveMode>
+void MultiDimensionalRewardUnfolding<ValueType, SingleObjectiveMode>::storeEpochSolution(Epoch const& epoch, std::vector<SolutionType>&& inStateSolutions) {
     STORM_LOG_ASSERT(inStateSolutions.size() == epochModel.epochInStates.getNumberOfSetBits(), "Invalid number of solutions.");
 
     std::set<Epoch> predecessorEpochs, successorEpochs;
     for (auto const& step : possibleEpochSteps) {
-        epochManager.gatherPredecessorEpochs(predecessorEpochs, currentEpoch.get(), step);
-        successorEpochs.insert(epochManager.getSuccessorEpoch(currentEpoch.get(), step));
+        epochManager.gatherPredecessorEpochs(predecessorEpochs, epoch, step);
+        successorEpochs.insert(epochManager.getSuccessorEpoch(epoch, step));
+    }
+    predecessorEpochs.erase(epoch);
+    successorEpochs.erase(epoch);
+    if (epochsOfComputationOrder) {
+        // Only the predecessors that are analyzed later on will ever request this solution.
+        for (auto predecessorIt = predecessorEpochs.begin(); predecessorIt != predecessorEpochs.end();) {
+            if (epochsOfComputationOrder->count(*predecessorIt) == 0) {
+                predecessorIt = predecessorEpochs.erase(predecessorIt);
+            } else {
+                ++predecessorIt;
+            }
+        }
     }
-    predecessorEpochs.erase(currentEpoch.get());
-    successorEpochs.erase(currentEpoch.get());
 
     // clean up solutions that are not needed anymore
     for (auto const& successorEpoch : successorEpochs) {
         auto successorEpochSolutionIt = epochSolutions.find(successorEpoch);
         STORM_LOG_ASSERT(successorEpochSolutionIt != epochSolutions.end(), "Solution for successor epoch does not exist (anymore).");
-        --successorEpochSolutionIt->second.count;
-        if (successorEpochSolutionIt->second.count == 0) {
-            epochSolutions.erase(successorEpochSolutionIt);
+        // Solutions without any remaining dependent epochs are kept, e.g., the solution of the start epoch
+        if (successorEpochSolutionIt->second.count > 0) {
+            --successorEpochSolutionIt->second.count;
+            if (successorEpochSolutionIt->second.count == 0) {
+                epochSolutions.erase(successorEpochSolutionIt);
+            }
         }
     }
 
@@ -885,7 +994,7 @@ void MultiDimensionalRewardUnfolding<ValueType, SingleObjectiveMode>::setSolutio
     solution.count = predecessorEpochs.size();
     solution.productStateToSolutionVectorMap = productStateToEpochModelInStateMap;
     solution.solutions = std::move(inStateSolutions);
-    epochSolutions[currentEpoch.get()] = std::move(solution);
+    epochSolutions[epoch] = std::move(solution);
 }
 
 template<typename ValueType, bool SingleObjectiveMode>
@@ -898,7 +1007,8 @@ MultiDimensionalRewardUnfolding<ValueType, SingleObjectiveMode>::getStateSolutio
 
 template<typename ValueType, bool SingleObjectiveMode>
 typename MultiDimensionalRewardUnfolding<ValueType, SingleObjectiveMode>::EpochSolution const&
-MultiDimensionalRewardUnfolding<ValueType, SingleObjectiveMode>::getEpochSolution(std::map<Epoch, EpochSolution const*> const& solutions, Epoch const& epoch) {
+MultiDimensionalRewardUnfolding<ValueType, SingleObjectiveMode>::getEpochSolution(std::map<Epoch, EpochSolution const*> const& solutions,
+                                                                                  Epoch const& epoch) const {
     auto epochSolutionIt = solutions.find(epoch);
     STORM_LOG_ASSERT(epochSolutionIt != solutions.end(), "Requested unexisting solution for epoch " << epochManager.toString(epoch) << ".");
     return *epochSolutionIt->second;
@@ -906,7 +1016,8 @@ MultiDimensionalRewardUnfolding<ValueType, SingleObjectiveMode>::getEpochSolutio
 
 template<typename ValueType, bool SingleObjectiveMode>
 typename MultiDimensionalRewardUnfolding<ValueType, SingleObjectiveMode>::SolutionType const&
-MultiDimensionalRewardUnfolding<ValueType, SingleObjectiveMode>::getStateSolution(EpochSolution const& epochSolution, uint64_t const& productState) {
+MultiDimensionalRewardUnfolding<ValueType, SingleObjectiveMode>::getStateSolution(EpochSolution const& epochSolution,
+                                                                                  uint64_t const& productState) const {
     STORM_LOG_ASSERT(productState < epochSolution.productStateToSolutionVectorMap->size(), "Requested solution at an unexisting product state.");
     STORM_LOG_ASSERT((*epochSolution.productStateToSolutionVectorMap)[productState] < epochSolution.solutions.size(),
                      "Requested solution for epoch at product state " << productState << " for which no solution was stored.");
@@ -59,11 +59,29 @@ class MultiDimensionalRewardUnfolding {
     /*!
      * Computes a sequence of epochs that need to be analyzed to get a result at the start epoch.
      * @param stopAtComputedEpochs if set, the search for epochs that need to be computed is stopped at epochs that already have been computed earlier.
+     * In this case, solutions are kept until all their predecessor epochs are analyzed so that they can be reused for further start epochs.
+     * Otherwise, the solution of an epoch is dropped as soon as all epochs of the returned order that depend on it are analyzed.
      */
     std::vector<Epoch> getEpochComputationOrder(Epoch const& startEpoch, bool stopAtComputedEpochs = false);
 
     EpochModel<ValueType, SingleObjectiveMode>& setCurrentEpoch(Epoch const& epoch);
 
+    /*!
+     * Splits the given epoch computation order into consecutive batches of epochs that can be analyzed concurrently, i.e., all epochs of a batch belong
+     * to the same epoch class and no epoch of a batch is a successor of another epoch in the same batch.
+     * @param maxBatchSize the maximal number of epochs within a batch
+     */
+    std::vector<std::vector<Epoch>> getEpochComputationBatches(std::vector<Epoch> const& epochOrder, uint64_t maxBatchSize) const;
+
+    /*!
+     * Sets up the epoch models for the given batch of epochs (as obtained by getEpochComputationBatches).
+     * The i-th returned epoch model belongs to the i-th epoch of the batch. The epoch models are independent of each other and can thus be analyzed
+     * concurrently. They might be reused for subsequent batches, so epochMatrixChanged is only set if the epoch matrix of the i-th model changed since the
+     * last batch.
+     * @note the returned vector might contain more epoch models than there are epochs in the batch.
+     */
+    std::vector<EpochModel<ValueType, SingleObjectiveMode>>& setCurrentEpochBatch(std::vector<Epoch> const& epochs);
+
     void setEquationSystemFormatForEpochModel(storm::solver::LinearEquationSolverProblemFormat eqSysFormat);
 
     /*!
@@ -78,6 +96,10 @@ class MultiDimensionalRewardUnfolding {
     boost::optional<ValueType> getLowerObjectiveBound(uint64_t objectiveIndex = 0);
 
     void setSolutionForCurrentEpoch(std::vector<SolutionType>&& inStateSolutions);
+    /*!
+     * Sets the solutions for the epochs of the current batch, where the i-th solution belongs to the i-th epoch of the batch.
+     */
+    void setSolutionsForCurrentEpochBatch(std::vector<std::vector<SolutionType>>&& inStateSolutions);
     SolutionType getInitialStateResult(Epoch const& epoch);  // Assumes that the initial state is unique
     SolutionType getInitialStateResult(Epoch const& epoch, uint64_t initialStateIndex);
 
@@ -86,6 +108,20 @@ class MultiDimensionalRewardUnfolding {
 
    private:
     void setCurrentEpochClass(Epoch const& epoch);
+
+    /*!
+     * Updates the epoch class (if necessary) so that the given epoch can be set up.
+     * @return true iff the epoch class changed.
+     */
+    bool updateEpochClass(Epoch const& epoch);
+
+    /*!
+     * Sets the solutions and reward filters for the step choices of the given epoch in the given epoch model.
+     * Only reads previously stored epoch solutions, so it can be invoked concurrently for different epochs.
+     */
+    void setStepSolutions(Epoch const& epoch, EpochModel<ValueType, SingleObjectiveMode>& targetEpochModel) const;
+
+    void storeEpochSolution(Epoch const& epoch, std::vector<SolutionType>&& inStateSolutions);
     void initialize(std::set<storm::expressions::Variable> const& infinityBoundVariables = {});
 
     void initializeObjectives(std::vector<Epoch>& epochSteps, std::set<storm::expressions::Variable> const& infinityBoundVariables);
@@ -121,8 +157,10 @@ class MultiDimensionalRewardUnfolding {
         std::vector<SolutionType> solutions;
     };
     std::map<Epoch, EpochSolution> epochSolutions;
-    EpochSolution const& getEpochSolution(std::map<Epoch, EpochSolution const*> const& solutions, Epoch const& epoch);
-    SolutionType const& getStateSolution(EpochSolution const& epochSolution, uint64_t const& productState);
+    // If set, the count of an epoch solution only considers predecessor epochs within this set, i.e., within the most recent computation order.
+    boost::optional<std::set<Epoch>> epochsOfComputationOrder;
+    EpochSolution const& getEpochSolution(std::map<Epoch, EpochSolution const*> const& solutions, Epoch const& epoch) const;
+    SolutionType const& getStateSolution(EpochSolution const& epochSolution, uint64_t const& productState) const;
 
     storm::models::sparse::Model<ValueType> const& model;
     std::vector<storm::modelchecker::multiobjective::Objective<ValueType>> objectives;
@@ -135,6 +173,13 @@ class MultiDimensionalRewardUnfolding {
 
     EpochModel<ValueType, SingleObjectiveMode> epochModel;
     boost::optional<Epoch> currentEpoch;
+    // Some epoch of the epoch class that the epoch model currently represents
+    boost::optional<Epoch> epochOfCurrentEpochClass;
+
+    // Epoch models for the analysis of batches of epochs. The first numberOfUpToDateBatchEpochModels of them store the data of the current epoch class.
+    std::vector<EpochModel<ValueType, SingleObjectiveMode>> batchEpochModels;
+    uint64_t numberOfUpToDateBatchEpochModels = 0;
+    std::vector<Epoch> currentEpochBatch;
 
     EpochManager epochManager;
 
@@ -659,7 +659,6 @@ std::unique_ptr<CheckResult> SparseDtmcEliminationModelChecker<SparseDtmcModelTy
     std::unique_ptr<CheckResult> rightResultPointer = this->check(conditionalFormula.getConditionFormula().asEventuallyFormula().getSubformula());
     storm::storage::BitVector phiStates = leftResultPointer->asExplicitQualitativeCheckResult().getTruthValuesVector();
     storm::storage::BitVector psiStates = rightResultPointer->asExplicitQualitativeCheckResult().getTruthValuesVector();
-    storm::storage::BitVector trueStates(this->getModel().getNumberOfStates(), true);
 
     // Do some sanity checks to establish some required properties.
     // STORM_LOG_WARN_COND(storm::settings::getModule<storm::settings::modules::EliminationSettings>().getEliminationMethod() ==
@@ -671,63 +670,75 @@ std::unique_ptr<CheckResult> SparseDtmcEliminationModelChecker<SparseDtmcModelTy
                     "Cannot compute conditional probabilities for all states.");
     storm::storage::sparse::state_type initialState = *this->getModel().getInitialStates().begin();
 
-    storm::storage::SparseMatrix<ValueType> backwardTransitions = this->getModel().getBackwardTransitions();
+    std::vector<ValueType> result = computeConditionalProbabilities(this->getModel().getTransitionMatrix(), this->getModel().getBackwardTransitions(),
+                                                                    this->getModel().getInitialStates(), {phiStates}, psiStates);
+    return std::unique_ptr<CheckResult>(new ExplicitQuantitativeCheckResult<ValueType>(initialState, result.front()));
+}
+
+template<typename SparseDtmcModelType>
+std::vector<typename SparseDtmcModelType::ValueType> SparseDtmcEliminationModelChecker<SparseDtmcModelType>::computeConditionalProbabilities(
+    storm::storage::SparseMatrix<ValueType> const& probabilityMatrix, storm::storage::SparseMatrix<ValueType> const& backwardTransitions,
+    storm::storage::BitVector const& initialStates, std::vector<storm::storage::BitVector> const& targetStates,
+    storm::storage::BitVector const& conditionStates) {
+    STORM_LOG_THROW(initialStates.getNumberOfSetBits() == 1, storm::exceptions::IllegalArgumentException,
+                    "Input model is required to have exactly one initial state.");
+    storm::storage::sparse::state_type initialState = *initialStates.begin();
+    storm::storage::BitVector trueStates(probabilityMatrix.getRowCount(), true);
 
     // Compute the 'true' psi states, i.e. those psi states that can be reached without passing through another psi state first.
-    psiStates = storm::utility::graph::getReachableStates(this->getModel().getTransitionMatrix(), this->getModel().getInitialStates(), trueStates, psiStates) &
-                psiStates;
+    storm::storage::BitVector psiStates =
+        storm::utility::graph::getReachableStates(probabilityMatrix, initialStates, trueStates, conditionStates) & conditionStates;
 
     std::pair<storm::storage::BitVector, storm::storage::BitVector> statesWithProbability01 =
         storm::utility::graph::performProb01(backwardTransitions, trueStates, psiStates);
     storm::storage::BitVector statesWithProbabilityGreater0 = ~statesWithProbability01.first;
     storm::storage::BitVector statesWithProbability1 = std::move(statesWithProbability01.second);
 
-    STORM_LOG_THROW(this->getModel().getInitialStates().isSubsetOf(statesWithProbabilityGreater0), storm::exceptions::InvalidPropertyException,
+    STORM_LOG_THROW(initialStates.isSubsetOf(statesWithProbabilityGreater0), storm::exceptions::InvalidPropertyException,
                     "The condition of the conditional probability has zero probability.");
 
+    std::vector<ValueType> result;
+    result.reserve(targetStates.size());
+
     // If the initial state is known to have probability 1 of satisfying the condition, we can apply regular model checking.
-    if (this->getModel().getInitialStates().isSubsetOf(statesWithProbability1)) {
+    if (initialStates.isSubsetOf(statesWithProbability1)) {
         STORM_LOG_INFO("The condition holds with probability 1, so the regular reachability probability is computed.");
-        std::shared_ptr<storm::logic::BooleanLiteralFormula> trueFormula = std::make_shared<storm::logic::BooleanLiteralFormula>(true);
-        std::shared_ptr<storm::logic::UntilFormula> untilFormula =
-            std::make_shared<storm::logic::UntilFormula>(trueFormula, conditionalFormula.getSubformula().asSharedPointer());
-        return this->computeUntilProbabilities(env, *untilFormula);
+        for (auto const& phiStates : targetStates) {
+            std::unique_ptr<CheckResult> untilResult =
+                computeUntilProbabilities(probabilityMatrix, backwardTransitions, initialStates, trueStates, phiStates, true);
+            result.push_back(untilResult->asExplicitQuantitativeCheckResult<ValueType>()[initialState]);
+        }
+        return result;
     }
 
     // From now on, we know the condition does not have a trivial probability in the initial state.
+    storm::storage::BitVector allPhiStates(probabilityMatrix.getRowCount(), false);
+    for (auto const& phiStates : targetStates) {
+        allPhiStates |= phiStates;
+    }
 
     // Compute the states that can be reached on a path that has a psi state in it.
-    storm::storage::BitVector statesWithPsiPredecessor =
-        storm::utility::graph::performProbGreater0(this->getModel().getTransitionMatrix(), trueStates, psiStates);
-    storm::storage::BitVector statesReachingPhi = storm::utility::graph::performProbGreater0(backwardTransitions, trueStates, phiStates);
+    storm::storage::BitVector statesWithPsiPredecessor = storm::utility::graph::performProbGreater0(probabilityMatrix, trueStates, psiStates);
+    storm::storage::BitVector statesReachingPhi = storm::utility::graph::performProbGreater0(backwardTransitions, trueStates, allPhiStates);
 
     // The set of states we need to consider are those that have a non-zero probability to satisfy the condition or are on some path that has a psi state in it.
     storm::storage::BitVector maybeStates = statesWithProbabilityGreater0 | (statesWithPsiPredecessor & statesReachingPhi);
 
     // Determine the set of initial states of the sub-DTMC.
-    storm::storage::BitVector newInitialStates = this->getModel().getInitialStates() % maybeStates;
+    storm::storage::BitVector newInitialStates = initialStates % maybeStates;
 
     // Create a dummy vector for the one-step probabilities.
     std::vector<ValueType> oneStepProbabilities(maybeStates.getNumberOfSetBits(), storm::utility::zero<ValueType>());
 
     // We then build the submatrix that only has the transitions of the maybe states.
-    storm::storage::SparseMatrix<ValueType> submatrix = this->getModel().getTransitionMatrix().getSubmatrix(false, maybeStates, maybeStates);
+    storm::storage::SparseMatrix<ValueType> submatrix = probabilityMatrix.getSubmatrix(false, maybeStates, maybeStates);
     storm::storage::SparseMatrix<ValueType> submatrixTransposed = submatrix.transpose();
 
-    // The states we want to eliminate are those that are tagged with "maybe" but are not a phi or psi state.
-    phiStates = phiStates % maybeStates;
-
-    // If there are no phi states in the reduced model, the conditional probability is trivially zero.
-    if (phiStates.empty()) {
-        return std::unique_ptr<CheckResult>(new ExplicitQuantitativeCheckResult<ValueType>(initialState, storm::utility::zero<ValueType>()));
-    }
-
+    allPhiStates = allPhiStates % maybeStates;
     psiStates = psiStates % maybeStates;
 
-    // Keep only the states that we do not eliminate in the maybe states.
-    maybeStates = phiStates | psiStates;
-
-    storm::storage::BitVector statesToEliminate = ~maybeStates & ~newInitialStates;
+    // The states we want to eliminate (for all targets at once) are those that are tagged with "maybe" but are neither a phi nor a psi state.
+    storm::storage::BitVector statesToEliminate = ~(allPhiStates | psiStates) & ~newInitialStates;
 
     // Before starting the model checking process, we assign priorities to states so we can use them to
     // impose ordering constraints later.
@@ -745,24 +756,58 @@ std::unique_ptr<CheckResult> SparseDtmcEliminationModelChecker<SparseDtmcModelTy
     std::shared_ptr<StatePriorityQueue> statePriorities =
         createStatePriorityQueue(distanceBasedPriorities, flexibleMatrix, flexibleBackwardTransitions, oneStepProbabilities, statesToEliminate);
 
-    STORM_LOG_INFO("Computing conditional probilities.\n");
-    uint_fast64_t numberOfStatesToEliminate = statePriorities->size();
-    STORM_LOG_INFO("Eliminating " << numberOfStatesToEliminate << " states using the state elimination technique.\n");
-    performPrioritizedStateElimination(statePriorities, flexibleMatrix, flexibleBackwardTransitions, oneStepProbabilities, this->getModel().getInitialStates(),
-                                       true);
+    STORM_LOG_INFO("Computing conditional probilities for " << targetStates.size() << " target(s).\n");
+    STORM_LOG_INFO("Eliminating " << statePriorities->size() << " states using the state elimination technique.\n");
+    performPrioritizedStateElimination(statePriorities, flexibleMatrix, flexibleBackwardTransitions, oneStepProbabilities, newInitialStates, true);
+
+    for (uint64_t targetIndex = 0; targetIndex < targetStates.size(); ++targetIndex) {
+        storm::storage::BitVector phiStates = targetStates[targetIndex] % maybeStates;
+
+        // If there are no phi states in the reduced model, the conditional probability is trivially zero.
+        if (phiStates.empty()) {
+            result.push_back(storm::utility::zero<ValueType>());
+            continue;
+        }
+
+        // The partially eliminated matrices are shared among all targets, so we only work on copies (except for the last target).
+        bool const isLastTarget = targetIndex + 1 == targetStates.size();
+        storm::storage::FlexibleSparseMatrix<ValueType> targetMatrix = isLastTarget ? std::move(flexibleMatrix) : flexibleMatrix;
+        storm::storage::FlexibleSparseMatrix<ValueType> targetBackwardTransitions =
+            isLastTarget ? std::move(flexibleBackwardTransitions) : flexibleBackwardTransitions;
+        std::vector<ValueType> targetOneStepProbabilities = isLastTarget ? std::move(oneStepProbabilities) : oneStepProbabilities;
+
+        // Eliminate the phi states of the other targets.
+        storm::storage::BitVector otherPhiStates = allPhiStates & ~(phiStates | psiStates) & ~newInitialStates;
+        if (!otherPhiStates.empty()) {
+            std::shared_ptr<StatePriorityQueue> targetStatePriorities =
+                createStatePriorityQueue(distanceBasedPriorities, targetMatrix, targetBackwardTransitions, targetOneStepProbabilities, otherPhiStates);
+            performPrioritizedStateElimination(targetStatePriorities, targetMatrix, targetBackwardTransitions, targetOneStepProbabilities, newInitialStates,
+                                               true);
+        }
+
+        result.push_back(computeConditionalProbabilityForInitialState(targetMatrix, targetBackwardTransitions, targetOneStepProbabilities,
+                                                                      *newInitialStates.begin(), phiStates, psiStates));
+    }
+    return result;
+}
 
+template<typename SparseDtmcModelType>
+typename SparseDtmcModelType::ValueType SparseDtmcEliminationModelChecker<SparseDtmcModelType>::computeConditionalProbabilityForInitialState(
+    storm::storage::FlexibleSparseMatrix<ValueType>& flexibleMatrix, storm::storage::FlexibleSparseMatrix<ValueType>& flexibleBackwardTransitions,
+    std::vector<ValueType>& oneStepProbabilities, storm::storage::sparse::state_type initialState, storm::storage::BitVector const& phiStates,
+    storm::storage::BitVector const& psiStates) {
     storm::solver::stateelimination::ConditionalStateEliminator<ValueType> stateEliminator =
         storm::solver::stateelimination::ConditionalStateEliminator<ValueType>(flexibleMatrix, flexibleBackwardTransitions, oneStepProbabilities, phiStates,
                                                                                psiStates);
 
     // Eliminate the transitions going into the initial state (if there are any).
-    if (!flexibleBackwardTransitions.getRow(*newInitialStates.begin()).empty()) {
-        stateEliminator.eliminateState(*newInitialStates.begin(), false);
+    if (!flexibleBackwardTransitions.getRow(initialState).empty()) {
+        stateEliminator.eliminateState(initialState, false);
     }
 
     // Now we need to basically eliminate all chains of not-psi states after phi states and chains of not-phi
     // states after psi states.
-    for (auto const& trans1 : flexibleMatrix.getRow(*newInitialStates.begin())) {
+    for (auto const& trans1 : flexibleMatrix.getRow(initialState)) {
         auto initialStateSuccessor = trans1.getColumn();
 
         STORM_LOG_TRACE("Exploring successor " << initialStateSuccessor << " of the initial state.");
@@ -838,7 +883,7 @@ std::unique_ptr<CheckResult> SparseDtmcEliminationModelChecker<SparseDtmcModelTy
     ValueType numerator = storm::utility::zero<ValueType>();
     ValueType denominator = storm::utility::zero<ValueType>();
 
-    for (auto const& trans1 : flexibleMatrix.getRow(*newInitialStates.begin())) {
+    for (auto const& trans1 : flexibleMatrix.getRow(initialState)) {
         auto initialStateSuccessor = trans1.getColumn();
         if (phiStates.get(initialStateSuccessor)) {
             if (psiStates.get(initialStateSuccessor)) {
@@ -868,7 +913,7 @@ std::unique_ptr<CheckResult> SparseDtmcEliminationModelChecker<SparseDtmcModelTy
         }
     }
 
-    return std::unique_ptr<CheckResult>(new ExplicitQuantitativeCheckResult<ValueType>(initialState, numerator / denominator));
+    return numerator / denominator;
 }
 
 template<typename SparseDtmcModelType>
@@ -66,7 +66,24 @@ class SparseDtmcEliminationModelChecker : public SparsePropositionalModelChecker
                                                                    storm::storage::BitVector const& targetStates, std::vector<ValueType>& stateRewardValues,
                                                                    bool computeForInitialStatesOnly);
 
+    /*!
+     * Computes the conditional probabilities P(F target | F condition) in the (single) initial state for each of the given target sets.
+     * The states that are neither target nor condition states are eliminated only once. The partially eliminated matrix is then reused for all targets.
+     *
+     * @return the conditional probability for each of the given target sets.
+     */
+    static std::vector<ValueType> computeConditionalProbabilities(storm::storage::SparseMatrix<ValueType> const& probabilityMatrix,
+                                                                  storm::storage::SparseMatrix<ValueType> const& backwardTransitions,
+                                                                  storm::storage::BitVector const& initialStates,
+                                                                  std::vector<storm::storage::BitVector> const& targetStates,
+                                                                  storm::storage::BitVector const& conditionStates);
+
    private:
+    static ValueType computeConditionalProbabilityForInitialState(storm::storage::FlexibleSparseMatrix<ValueType>& flexibleMatrix,
+                                                                  storm::storage::FlexibleSparseMatrix<ValueType>& flexibleBackwardTransitions,
+                                                                  std::vector<ValueType>& oneStepProbabilities, storm::storage::sparse::state_type initialState,
+                                                                  storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates);
+
     static std::vector<ValueType> computeLongRunValues(storm::storage::SparseMatrix<ValueType> const& transitionMatrix,
                                                        storm::storage::SparseMatrix<ValueType> const& backwardTransitions,
                                                        storm::storage::BitVector const& initialStates, storm::storage::BitVector const& maybeStates,
@@ -84,7 +84,7 @@ ExplicitQuantitativeCheckResult<ValueType>::ExplicitQuantitativeCheckResult(Expl
 
 template<typename ValueType>
 std::unique_ptr<CheckResult> ExplicitQuantitativeCheckResult<ValueType>::clone() const {
-    return std::make_unique<ExplicitQuantitativeCheckResult<ValueType>>(this->values, this->scheduler);
+    return std::make_unique<ExplicitQuantitativeCheckResult<ValueType>>(*this);
 }
 
 template<typename ValueType>
@@ -233,6 +233,28 @@ storm::storage::Scheduler<ValueType>& ExplicitQuantitativeCheckResult<ValueType>
     return *scheduler.get();
 }
 
+template<typename ValueType>
+void ExplicitQuantitativeCheckResult<ValueType>::setApproximate(std::optional<double> const& absoluteErrorBound) {
+    approximate = true;
+    errorBound = absoluteErrorBound;
+}
+
+template<typename ValueType>
+bool ExplicitQuantitativeCheckResult<ValueType>::isApproximate() const {
+    return approximate;
+}
+
+template<typename ValueType>
+bool ExplicitQuantitativeCheckResult<ValueType>::hasErrorBound() const {
+    return errorBound.has_value();
+}
+
+template<typename ValueType>
+double ExplicitQuantitativeCheckResult<ValueType>::getErrorBound() const {
+    STORM_LOG_THROW(this->hasErrorBound(), storm::exceptions::InvalidOperationException, "Unable to retrieve non-existing error bound.");
+    return errorBound.value();
+}
+
 template<typename ValueType>
 void print(std::ostream& out, ValueType const& value) {
     if (value == storm::utility::infinity<ValueType>()) {
@@ -327,6 +349,13 @@ std::ostream& ExplicitQuantitativeCheckResult<ValueType>::writeToStream(std::ost
         std::pair<ValueType, ValueType> minmax = this->getMinMax();
         printRange(out, minmax.first, minmax.second);
     }
+    if (approximate) {
+        out << " (approximate";
+        if (errorBound) {
+            out << ", error at most " << *errorBound;
+        }
+        out << ")";
+    }
 
     return out;
 }
@@ -81,6 +81,15 @@ class ExplicitQuantitativeCheckResult : public QuantitativeCheckResult<ValueType
     storm::storage::Scheduler<ValueType> const& getScheduler() const;
     storm::storage::Scheduler<ValueType>& getScheduler();
 
+    /*!
+     * Marks the values as an approximation, e.g., because the computation was stopped at a deadline.
+     * @param absoluteErrorBound If given, each value differs from the precise value by at most this bound.
+     */
+    void setApproximate(std::optional<double> const& absoluteErrorBound = std::nullopt);
+    bool isApproximate() const;
+    bool hasErrorBound() const;
+    double getErrorBound() const;
+
     storm::json<ValueType> toJson(std::optional<storm::storage::sparse::StateValuations> const& stateValuations = std::nullopt,
                                   std::optional<storm::models::sparse::StateLabeling> const& stateLabels = std::nullopt) const;
 
@@ -90,6 +99,10 @@ class ExplicitQuantitativeCheckResult : public QuantitativeCheckResult<ValueType
 
     // An optional scheduler that accompanies the values.
     boost::optional<std::shared_ptr<storm::storage::Scheduler<ValueType>>> scheduler;
+
+    // Whether the values are only approximate and, if available, a bound on their absolute error.
+    bool approximate = false;
+    std::optional<double> errorBound;
 };
 }  // namespace modelchecker
 }  // namespace storm
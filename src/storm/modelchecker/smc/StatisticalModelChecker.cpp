@@ -0,0 +1,348 @@
+#include "storm/modelchecker/smc/StatisticalModelChecker.h"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <random>
+
+#include <boost/math/distributions/normal.hpp>
+
+#include "storm/adapters/IntelTbbAdapter.h"
+#include "storm/logic/FragmentSpecification.h"
+#include "storm/modelchecker/results/ExplicitQualitativeCheckResult.h"
+#include "storm/modelchecker/results/ExplicitQuantitativeCheckResult.h"
+#include "storm/models/sparse/Dtmc.h"
+#include "storm/models/sparse/StandardRewardModel.h"
+#include "storm/utility/constants.h"
+#include "storm/utility/macros.h"
+
+#include "storm/exceptions/InvalidArgumentException.h"
+#include "storm/exceptions/InvalidPropertyException.h"
+#include "storm/exceptions/NotSupportedException.h"
+
+namespace storm {
+namespace modelchecker {
+
+template<typename ModelType>
+void StatisticalModelChecker<ModelType>::PathStatistics::add(PathStatistics const& other) {
+    numberOfPaths += other.numberOfPaths;
+    sum += other.sum;
+    sumOfSquares += other.sumOfSquares;
+}
+
+template<typename ModelType>
+double StatisticalModelChecker<ModelType>::PathStatistics::getMean() const {
+    return numberOfPaths == 0 ? 0.0 : sum / numberOfPaths;
+}
+
+template<typename ModelType>
+double StatisticalModelChecker<ModelType>::PathStatistics::getVariance() const {
+    if (numberOfPaths < 2) {
+        return 0.0;
+    }
+    // The sample variance. Rounding errors may yield slightly negative values.
+    return std::max(0.0, (sumOfSquares - sum * getMean()) / (numberOfPaths - 1));
+}
+
+template<typename ModelType>
+StatisticalModelChecker<ModelType>::StatisticalModelChecker(storm::prism::Program const& program, Options const& options)
+    : program(program.substituteConstantsFormulas()), options(options) {
+    STORM_LOG_THROW(this->program.getModelType() == storm::prism::Program::ModelType::DTMC, storm::exceptions::NotSupportedException,
+                    "The statistical model checker only supports DTMCs.");
+    STORM_LOG_THROW(options.numberOfThreads > 0, storm::exceptions::InvalidArgumentException, "At least one thread is required for the simulation.");
+    STORM_LOG_THROW(options.batchSize > 0, storm::exceptions::InvalidArgumentException, "The batch size must be positive.");
+    STORM_LOG_THROW(options.confidence > 0 && options.confidence < 1, storm::exceptions::InvalidArgumentException, "The confidence level must be in (0,1).");
+    STORM_LOG_THROW(options.precision > 0, storm::exceptions::InvalidArgumentException, "The precision must be positive.");
+#ifndef STORM_HAVE_INTELTBB
+    STORM_LOG_WARN_COND(options.numberOfThreads == 1, "Parallel simulation requires Intel TBB. The paths are simulated sequentially.");
+#endif
+    // The simulators are created upfront as creating the underlying next-state generators is not thread-safe.
+    storm::generator::NextStateGeneratorOptions generatorOptions(true, false);
+    for (uint64_t thread = 0; thread < options.numberOfThreads; ++thread) {
+        simulators.push_back(std::make_unique<Simulator>(this->program, generatorOptions));
+    }
+}
+
+template<typename ModelType>
+bool StatisticalModelChecker<ModelType>::canHandleStatic(CheckTask<storm::logic::Formula, ValueType> const& checkTask) {
+    storm::logic::FragmentSpecification fragment = storm::logic::propositional();
+    fragment.setProbabilityOperatorsAllowed(true);
+    fragment.setBoundedUntilFormulasAllowed(true);
+    fragment.setStepBoundedUntilFormulasAllowed(true);
+    fragment.setTimeBoundedUntilFormulasAllowed(true);
+    fragment.setRewardOperatorsAllowed(true);
+    fragment.setCumulativeRewardFormulasAllowed(true);
+    fragment.setStepBoundedCumulativeRewardFormulasAllowed(true);
+    fragment.setTimeBoundedCumulativeRewardFormulasAllowed(true);
+    fragment.setInstantaneousFormulasAllowed(true);
+    fragment.setOperatorAtTopLevelRequired(true);
+    fragment.setNestedOperatorsAllowed(false);
+    return checkTask.getFormula().isInFragment(fragment) && checkTask.isOnlyInitialStatesRelevantSet();
+}
+
+template<typename ModelType>
+bool StatisticalModelChecker<ModelType>::canHandle(CheckTask<storm::logic::Formula, ValueType> const& checkTask) const {
+    return canHandleStatic(checkTask);
+}
+
+template<typename ModelType>
+template<typename PathEvaluator, typename StoppingCriterion>
+typename StatisticalModelChecker<ModelType>::PathStatistics StatisticalModelChecker<ModelType>::simulate(PathEvaluator const& evaluatePath,
+                                                                                                         uint64_t maxPaths,
+                                                                                                         StoppingCriterion const& isDone) {
+    PathStatistics result;
+    std::vector<PathStatistics> batchResults(simulators.size());
+    uint64_t nextBatch = 0;
+    uint64_t scheduledPaths = 0;
+    bool done = false;
+#ifdef STORM_HAVE_INTELTBB
+    tbb::task_arena arena(static_cast<int>(simulators.size()));
+#endif
+
+    // Simulates the paths of the given batch with the given simulator.
+    auto simulateBatch = [this, &evaluatePath](Simulator& simulator, uint64_t batchIndex, uint64_t numberOfPaths) {
+        // Each batch has its own random number stream which only depends on the seed and the batch index
+        std::seed_seq seedSequence{static_cast<uint32_t>(options.seed), static_cast<uint32_t>(options.seed >> 32), static_cast<uint32_t>(batchIndex),
+                                   static_cast<uint32_t>(batchIndex >> 32)};
+        std::array<uint32_t, 2> seed;
+        seedSequence.generate(seed.begin(), seed.end());
+        simulator.setSeed((static_cast<uint64_t>(seed[0]) << 32) | seed[1]);
+
+        PathStatistics batchResult;
+        for (uint64_t path = 0; path < numberOfPaths; ++path) {
+            double value = evaluatePath(simulator);
+            ++batchResult.numberOfPaths;
+            batchResult.sum += value;
+            batchResult.sumOfSquares += value * value;
+        }
+        return batchResult;
+    };
+
+    while (scheduledPaths < maxPaths && !done) {
+        // Simulate one batch per simulator
+        uint64_t numberOfBatches = 0;
+        std::vector<uint64_t> batchSizes;
+        for (; numberOfBatches < simulators.size() && scheduledPaths < maxPaths; ++numberOfBatches) {
+            batchSizes.push_back(std::min(options.batchSize, maxPaths - scheduledPaths));
+            scheduledPaths += batchSizes.back();
+        }
+#ifdef STORM_HAVE_INTELTBB
+        arena.execute([&]() {
+            tbb::parallel_for(tbb::blocked_range<uint64_t>(0, numberOfBatches, 1), [&](tbb::blocked_range<uint64_t> const& range) {
+                for (uint64_t index = range.begin(); index < range.end(); ++index) {
+                    batchResults[index] = simulateBatch(*simulators[index], nextBatch + index, batchSizes[index]);
+                }
+            });
+        });
+#else
+        for (uint64_t index = 0; index < numberOfBatches; ++index) {
+            batchResults[index] = simulateBatch(*simulators[index], nextBatch + index, batchSizes[index]);
+        }
+#endif
+        nextBatch += numberOfBatches;
+
+        // Combine the batches in a fixed order such that the result does not depend on the number of threads
+        for (uint64_t index = 0; index < numberOfBatches; ++index) {
+            result.add(batchResults[index]);
+            if (isDone(result)) {
+                // Results of the remaining batches are discarded
+                done = true;
+                break;
+            }
+        }
+        STORM_LOG_DEBUG("Simulated " << result.numberOfPaths << " paths. Current estimate: " << result.getMean() << ".");
+    }
+    return result;
+}
+
+template<typename ModelType>
+std::function<double(typename StatisticalModelChecker<ModelType>::Simulator&)> StatisticalModelChecker<ModelType>::createBoundedUntilEvaluator(
+    storm::logic::BoundedUntilFormula const& formula) const {
+    STORM_LOG_THROW(!formula.isMultiDimensional() && !formula.getTimeBoundReference().isRewardBound(), storm::exceptions::NotSupportedException,
+                    "The statistical model checker only supports bounded until formulas with a single step bound.");
+    STORM_LOG_THROW(formula.hasUpperBound(), storm::exceptions::InvalidPropertyException, "Formula needs to have an upper step bound.");
+    STORM_LOG_THROW(formula.hasIntegerLowerBound(), storm::exceptions::InvalidPropertyException, "Formula lower step bound must be discrete/integral.");
+    STORM_LOG_THROW(formula.hasIntegerUpperBound(), storm::exceptions::InvalidPropertyException, "Formula needs to have discrete upper step bound.");
+    uint64_t lowerBound = formula.hasLowerBound() ? formula.getNonStrictLowerBound<uint64_t>() : 0;
+    uint64_t upperBound = formula.getNonStrictUpperBound<uint64_t>();
+
+    std::map<std::string, storm::expressions::Expression> labelToExpressionMapping = program.getLabelToExpressionMapping();
+    storm::expressions::Expression conditionExpression = formula.getLeftSubformula().toExpression(program.getManager(), labelToExpressionMapping);
+    storm::expressions::Expression targetExpression = formula.getRightSubformula().toExpression(program.getManager(), labelToExpressionMapping);
+
+    return [lowerBound, upperBound, conditionExpression, targetExpression](Simulator& simulator) {
+        simulator.resetToInitial();
+        for (uint64_t step = 0;; ++step) {
+            if (step >= lowerBound && simulator.evaluateBooleanExpressionInCurrentState(targetExpression)) {
+                return 1.0;
+            }
+            if (step >= upperBound || !simulator.evaluateBooleanExpressionInCurrentState(conditionExpression)) {
+                return 0.0;
+            }
+            if (simulator.getChoices().empty()) {
+                // Deadlock states are absorbing, so the path satisfies the formula iff the target holds in this state.
+                return simulator.evaluateBooleanExpressionInCurrentState(targetExpression) ? 1.0 : 0.0;
+            }
+            simulator.step(0);
+        }
+    };
+}
+
+template<typename ModelType>
+std::pair<double, double> StatisticalModelChecker<ModelType>::estimateBoundedUntilProbability(storm::logic::BoundedUntilFormula const& formula) {
+    // By the Chernoff-Hoeffding (Okamoto) bound, this many paths suffice for the desired precision and confidence.
+    double logTerm = std::log(2 / (1 - options.confidence));
+    double requiredPaths = std::ceil(logTerm / (2 * options.precision * options.precision));
+    STORM_LOG_WARN_COND(requiredPaths <= options.maxPaths, "The desired precision requires " << requiredPaths << " paths, but only " << options.maxPaths
+                                                                                             << " paths are simulated.");
+    uint64_t numberOfPaths = requiredPaths <= options.maxPaths ? static_cast<uint64_t>(requiredPaths) : options.maxPaths;
+
+    PathStatistics statistics = simulate(createBoundedUntilEvaluator(formula), numberOfPaths, [](PathStatistics const&) { return false; });
+    double halfWidth = std::sqrt(logTerm / (2 * statistics.numberOfPaths));
+    STORM_LOG_INFO("Simulated " << statistics.numberOfPaths << " paths. Estimate: " << statistics.getMean() << " +- " << halfWidth << " with confidence "
+                                << options.confidence << ".");
+    return {statistics.getMean(), halfWidth};
+}
+
+template<typename ModelType>
+std::pair<double, double> StatisticalModelChecker<ModelType>::estimateExpectedValue(std::function<double(Simulator&)> const& evaluatePath) {
+    // The values of the paths are not bounded a priori, so the confidence interval is derived from the sample variance.
+    double z = boost::math::quantile(boost::math::normal(), 1 - (1 - options.confidence) / 2);
+    auto getHalfWidth = [z](PathStatistics const& statistics) { return z * std::sqrt(statistics.getVariance() / statistics.numberOfPaths); };
+    auto isDone = [this, &getHalfWidth](PathStatistics const& statistics) {
+        return statistics.numberOfPaths >= std::max<uint64_t>(2, options.batchSize) && getHalfWidth(statistics) <= options.precision;
+    };
+
+    PathStatistics statistics = simulate(evaluatePath, options.maxPaths, isDone);
+    STORM_LOG_WARN_COND(isDone(statistics), "Simulation did not reach the desired precision within " << options.maxPaths << " paths.");
+    double halfWidth = getHalfWidth(statistics);
+    STORM_LOG_INFO("Simulated " << statistics.numberOfPaths << " paths. Estimate: " << statistics.getMean() << " +- " << halfWidth << " with confidence "
+                                << options.confidence << ".");
+    return {statistics.getMean(), halfWidth};
+}
+
+template<typename ModelType>
+template<typename FormulaType>
+uint64_t StatisticalModelChecker<ModelType>::getRewardModelIndex(CheckTask<FormulaType, ValueType> const& checkTask) const {
+    std::vector<std::string> rewardNames = simulators.front()->getRewardNames();
+    if (checkTask.isRewardModelSet()) {
+        auto it = std::find(rewardNames.begin(), rewardNames.end(), checkTask.getRewardModel());
+        STORM_LOG_THROW(it != rewardNames.end(), storm::exceptions::InvalidPropertyException,
+                        "The program has no reward model named '" << checkTask.getRewardModel() << "'.");
+        return std::distance(rewardNames.begin(), it);
+    }
+    STORM_LOG_THROW(rewardNames.size() == 1, storm::exceptions::InvalidPropertyException,
+                    "The reward model is not specified and the program does not have a unique reward model.");
+    return 0;
+}
+
+template<typename ModelType>
+std::unique_ptr<CheckResult> StatisticalModelChecker<ModelType>::checkProbabilityOperatorFormula(
+    Environment const& env, CheckTask<storm::logic::ProbabilityOperatorFormula, ValueType> const& checkTask) {
+    storm::logic::Formula const& pathFormula = checkTask.getFormula().getSubformula();
+    if (!checkTask.isBoundSet() || !pathFormula.isBoundedUntilFormula()) {
+        return AbstractModelChecker<ModelType>::checkProbabilityOperatorFormula(env, checkTask);
+    }
+
+    // Decide the bound with a sequential probability ratio test for the hypotheses p >= threshold + indifference and p <= threshold - indifference.
+    double threshold = storm::utility::convertNumber<double>(checkTask.getBoundThreshold());
+    double upperProbability = threshold + options.indifference;
+    double lowerProbability = threshold - options.indifference;
+    if (lowerProbability <= 0 || upperProbability >= 1) {
+        // The indifference region is not within (0,1), so we compare the estimate against the threshold.
+        return AbstractModelChecker<ModelType>::checkProbabilityOperatorFormula(env, checkTask);
+    }
+    double error = 1 - options.confidence;
+    double acceptUpperThreshold = std::log(error / (1 - error));
+    double acceptLowerThreshold = std::log((1 - error) / error);
+    double successRatio = std::log(lowerProbability / upperProbability);
+    double failureRatio = std::log((1 - lowerProbability) / (1 - upperProbability));
+    auto getLogLikelihoodRatio = [successRatio, failureRatio](PathStatistics const& statistics) {
+        return statistics.sum * successRatio + (statistics.numberOfPaths - statistics.sum) * failureRatio;
+    };
+    auto isDone = [&getLogLikelihoodRatio, acceptUpperThreshold, acceptLowerThreshold](PathStatistics const& statistics) {
+        double ratio = getLogLikelihoodRatio(statistics);
+        return ratio <= acceptUpperThreshold || ratio >= acceptLowerThreshold;
+    };
+
+    PathStatistics statistics = simulate(createBoundedUntilEvaluator(pathFormula.asBoundedUntilFormula()), options.maxPaths, isDone);
+    bool aboveThreshold;
+    if (isDone(statistics)) {
+        aboveThreshold = getLogLikelihoodRatio(statistics) <= acceptUpperThreshold;
+    } else {
+        STORM_LOG_WARN("The hypothesis test did not terminate within " << options.maxPaths << " paths. The estimate is compared against the bound.");
+        aboveThreshold = statistics.getMean() >= threshold;
+    }
+    STORM_LOG_INFO("Simulated " << statistics.numberOfPaths << " paths. The probability is " << (aboveThreshold ? "above " : "below ") << threshold
+                                << " with confidence " << options.confidence << ".");
+    return std::make_unique<ExplicitQualitativeCheckResult>(0, storm::logic::isLowerBound(checkTask.getBoundComparisonType()) == aboveThreshold);
+}
+
+template<typename ModelType>
+std::unique_ptr<CheckResult> StatisticalModelChecker<ModelType>::computeBoundedUntilProbabilities(
+    Environment const&, CheckTask<storm::logic::BoundedUntilFormula, ValueType> const& checkTask) {
+    auto estimate = estimateBoundedUntilProbability(checkTask.getFormula());
+    auto result = std::make_unique<ExplicitQuantitativeCheckResult<ValueType>>(0, estimate.first);
+    result->setApproximate(estimate.second);
+    return result;
+}
+
+template<typename ModelType>
+std::unique_ptr<CheckResult> StatisticalModelChecker<ModelType>::computeCumulativeRewards(
+    Environment const&, storm::logic::RewardMeasureType, CheckTask<storm::logic::CumulativeRewardFormula, ValueType> const& checkTask) {
+    storm::logic::CumulativeRewardFormula const& rewardPathFormula = checkTask.getFormula();
+    STORM_LOG_THROW(!rewardPathFormula.isMultiDimensional() && !rewardPathFormula.getTimeBoundReference().isRewardBound(),
+                    storm::exceptions::NotSupportedException, "The statistical model checker only supports cumulative rewards with a single step bound.");
+    STORM_LOG_THROW(rewardPathFormula.hasIntegerBound(), storm::exceptions::InvalidPropertyException, "Formula needs to have a discrete step bound.");
+    uint64_t bound = rewardPathFormula.getNonStrictBound<uint64_t>();
+    uint64_t rewardIndex = getRewardModelIndex(checkTask);
+
+    auto evaluatePath = [bound, rewardIndex](Simulator& simulator) {
+        simulator.resetToInitial();
+        // The last rewards of the simulator comprise the reward of the previous action and the state reward of the current state.
+        double reward = 0;
+        for (uint64_t step = 0; step < bound; ++step) {
+            reward += storm::utility::convertNumber<double>(simulator.getLastRewards()[rewardIndex]);
+            if (simulator.getChoices().empty()) {
+                // Deadlock states are absorbing, so only the state reward is collected in the remaining steps.
+                return reward + (bound - step - 1) * storm::utility::convertNumber<double>(simulator.getCurrentStateRewards()[rewardIndex]);
+            }
+            simulator.step(0);
+        }
+        if (bound > 0) {
+            // Only the reward of the last action is collected.
+            reward += storm::utility::convertNumber<double>(simulator.getLastRewards()[rewardIndex] - simulator.getCurrentStateRewards()[rewardIndex]);
+        }
+        return reward;
+    };
+
+    auto estimate = estimateExpectedValue(evaluatePath);
+    auto result = std::make_unique<ExplicitQuantitativeCheckResult<ValueType>>(0, estimate.first);
+    result->setApproximate(estimate.second);
+    return result;
+}
+
+template<typename ModelType>
+std::unique_ptr<CheckResult> StatisticalModelChecker<ModelType>::computeInstantaneousRewards(
+    Environment const&, storm::logic::RewardMeasureType, CheckTask<storm::logic::InstantaneousRewardFormula, ValueType> const& checkTask) {
+    STORM_LOG_THROW(checkTask.getFormula().hasIntegerBound(), storm::exceptions::InvalidPropertyException, "Formula needs to have a discrete step bound.");
+    uint64_t bound = checkTask.getFormula().template getBound<uint64_t>();
+    uint64_t rewardIndex = getRewardModelIndex(checkTask);
+
+    auto evaluatePath = [bound, rewardIndex](Simulator& simulator) {
+        simulator.resetToInitial();
+        for (uint64_t step = 0; step < bound && !simulator.getChoices().empty(); ++step) {
+            simulator.step(0);
+        }
+        return storm::utility::convertNumber<double>(simulator.getCurrentStateRewards()[rewardIndex]);
+    };
+
+    auto estimate = estimateExpectedValue(evaluatePath);
+    auto result = std::make_unique<ExplicitQuantitativeCheckResult<ValueType>>(0, estimate.first);
+    result->setApproximate(estimate.second);
+    return result;
+}
+
+template class StatisticalModelChecker<storm::models::sparse::Dtmc<double>>;
+}  // namespace modelchecker
+}  // namespace storm
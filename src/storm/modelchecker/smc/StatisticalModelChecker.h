@@ -0,0 +1,129 @@
+#pragma once
+
+#include <functional>
+#include <memory>
+#include <vector>
+
+#include "storm/modelchecker/AbstractModelChecker.h"
+#include "storm/simulator/PrismProgramSimulator.h"
+#include "storm/storage/prism/Program.h"
+
+namespace storm {
+
+class Environment;
+
+namespace modelchecker {
+
+/*!
+ * Statistical model checker that estimates the values of properties of discrete-time Markov chains given as PRISM programs by simulating
+ * paths of the program, i.e., without building the state space. Supported are (step-)bounded until probabilities as well as cumulative and
+ * instantaneous rewards.
+ * Probabilities are estimated with as many paths as required by the Chernoff-Hoeffding (Okamoto) bound. Rewards are estimated until the
+ * confidence interval obtained from the sample variance is sufficiently narrow. Probability operators with a bound are decided with Wald's
+ * sequential probability ratio test.
+ * The paths are simulated in batches by multiple threads, each having its own simulator. The random number generator for each batch is seeded
+ * with the given seed and the index of the batch. The batches are combined in the order of their index and the stopping criterion is checked
+ * after each batch. Thus, the result is reproducible for a fixed seed, regardless of the scheduling and the number of threads.
+ */
+template<typename ModelType>
+class StatisticalModelChecker : public AbstractModelChecker<ModelType> {
+   public:
+    typedef typename ModelType::ValueType ValueType;
+
+    struct Options {
+        // Number of threads used for the simulation
+        uint64_t numberOfThreads = 1;
+        // Seed for the random number generators
+        uint64_t seed = 5489u;
+        // Number of paths simulated in one batch
+        uint64_t batchSize = 1000;
+        // The simulation stops after this many paths
+        uint64_t maxPaths = 100000000;
+        // Confidence level of the confidence intervals and hypothesis tests
+        double confidence = 0.95;
+        // Half-width of the confidence intervals
+        double precision = 0.01;
+        // Half-width of the indifference region of the sequential probability ratio test
+        double indifference = 0.01;
+    };
+
+    /*!
+     * Creates a statistical model checker for the given program.
+     *
+     * @param program The program, which needs to describe a DTMC with a unique initial state.
+     * @param options Options for the simulation.
+     */
+    StatisticalModelChecker(storm::prism::Program const& program, Options const& options = Options());
+
+    static bool canHandleStatic(CheckTask<storm::logic::Formula, ValueType> const& checkTask);
+
+    virtual bool canHandle(CheckTask<storm::logic::Formula, ValueType> const& checkTask) const override;
+
+    virtual std::unique_ptr<CheckResult> checkProbabilityOperatorFormula(
+        Environment const& env, CheckTask<storm::logic::ProbabilityOperatorFormula, ValueType> const& checkTask) override;
+
+    virtual std::unique_ptr<CheckResult> computeBoundedUntilProbabilities(Environment const& env,
+                                                                          CheckTask<storm::logic::BoundedUntilFormula, ValueType> const& checkTask) override;
+
+    virtual std::unique_ptr<CheckResult> computeCumulativeRewards(Environment const& env, storm::logic::RewardMeasureType rewardMeasureType,
+                                                                  CheckTask<storm::logic::CumulativeRewardFormula, ValueType> const& checkTask) override;
+
+    virtual std::unique_ptr<CheckResult> computeInstantaneousRewards(Environment const& env, storm::logic::RewardMeasureType rewardMeasureType,
+                                                                     CheckTask<storm::logic::InstantaneousRewardFormula, ValueType> const& checkTask) override;
+
+   private:
+    typedef storm::simulator::DiscreteTimePrismProgramSimulator<ValueType> Simulator;
+
+    // Statistics over the values of the simulated paths.
+    struct PathStatistics {
+        uint64_t numberOfPaths = 0;
+        double sum = 0;
+        double sumOfSquares = 0;
+
+        void add(PathStatistics const& other);
+        double getMean() const;
+        double getVariance() const;
+    };
+
+    /*!
+     * Simulates paths in batches until the given stopping criterion holds or the maximal number of paths is reached.
+     *
+     * @param evaluatePath Simulates a path with the given simulator (starting in the initial state) and returns its value.
+     * @param maxPaths The maximal number of paths to simulate.
+     * @param isDone Given the statistics of the paths so far, decides whether the simulation can stop.
+     * @return The statistics of all considered paths.
+     */
+    template<typename PathEvaluator, typename StoppingCriterion>
+    PathStatistics simulate(PathEvaluator const& evaluatePath, uint64_t maxPaths, StoppingCriterion const& isDone);
+
+    /*!
+     * Creates a function that simulates a path and returns whether it satisfies the given bounded until formula.
+     */
+    std::function<double(Simulator&)> createBoundedUntilEvaluator(storm::logic::BoundedUntilFormula const& formula) const;
+
+    /*!
+     * Estimates the probability of the given bounded until formula and returns the estimate together with the half-width of its confidence interval.
+     */
+    std::pair<double, double> estimateBoundedUntilProbability(storm::logic::BoundedUntilFormula const& formula);
+
+    /*!
+     * Estimates the expected value of the given path evaluator and returns the estimate together with the half-width of its confidence interval.
+     */
+    std::pair<double, double> estimateExpectedValue(std::function<double(Simulator&)> const& evaluatePath);
+
+    /*!
+     * Retrieves the index of the reward model of the given task in the reward vectors of the simulators.
+     */
+    template<typename FormulaType>
+    uint64_t getRewardModelIndex(CheckTask<FormulaType, ValueType> const& checkTask) const;
+
+    // The program (with constants substituted) whose paths are simulated.
+    storm::prism::Program program;
+
+    Options options;
+
+    // One simulator for each thread.
+    std::vector<std::unique_ptr<Simulator>> simulators;
+};
+}  // namespace modelchecker
+}  // namespace storm
@@ -0,0 +1,161 @@
+#include "storm/models/sparse/AnalysisCache.h"
+
+#include "storm/adapters/RationalFunctionAdapter.h"
+#include "storm/storage/MaximalEndComponentDecomposition.h"
+#include "storm/storage/SparseMatrix.h"
+#include "storm/utility/graph.h"
+
+namespace storm {
+namespace models {
+namespace sparse {
+
+namespace {
+// Bound the number of cached analyses, which would otherwise grow with the number of checked properties.
+uint64_t const maxNumberOfCachedProb01Results = 64;
+uint64_t const maxNumberOfCachedEndComponentDecompositions = 16;
+}  // namespace
+
+template<typename ValueType>
+AnalysisCache<ValueType>::AnalysisCache(AnalysisCache const&) {
+    // Intentionally left empty.
+}
+
+template<typename ValueType>
+AnalysisCache<ValueType>& AnalysisCache<ValueType>::operator=(AnalysisCache const& other) {
+    if (this != &other) {
+        std::lock_guard<std::mutex> lock(mutex);
+        boundMatrix = nullptr;
+        ++generation;
+        backwardTransitions.reset();
+        prob01Results.clear();
+        maximalEndComponents.clear();
+    }
+    return *this;
+}
+
+template<typename ValueType>
+void AnalysisCache<ValueType>::bind(storm::storage::SparseMatrix<ValueType> const& transitionMatrix) {
+    std::lock_guard<std::mutex> lock(mutex);
+    if (boundMatrix != &transitionMatrix) {
+        boundMatrix = &transitionMatrix;
+        ++generation;
+        backwardTransitions.reset();
+        prob01Results.clear();
+        maximalEndComponents.clear();
+    }
+}
+
+template<typename ValueType>
+void AnalysisCache<ValueType>::clear() {
+    std::lock_guard<std::mutex> lock(mutex);
+    ++generation;
+    backwardTransitions.reset();
+    prob01Results.clear();
+    maximalEndComponents.clear();
+}
+
+template<typename ValueType>
+std::shared_ptr<storm::storage::SparseMatrix<ValueType> const> AnalysisCache<ValueType>::getBackwardTransitions(
+    storm::storage::SparseMatrix<ValueType> const& transitionMatrix) {
+    uint64_t startGeneration;
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        if (boundMatrix == &transitionMatrix && backwardTransitions) {
+            return backwardTransitions;
+        }
+        startGeneration = generation;
+    }
+    auto result = std::make_shared<storm::storage::SparseMatrix<ValueType> const>(transitionMatrix.transpose(true));
+    std::lock_guard<std::mutex> lock(mutex);
+    if (boundMatrix == &transitionMatrix && generation == startGeneration) {
+        backwardTransitions = result;
+    }
+    return result;
+}
+
+template<typename ValueType>
+template<typename ComputeFunction>
+std::pair<storm::storage::BitVector, storm::storage::BitVector> AnalysisCache<ValueType>::getOrComputeProb01(
+    storm::storage::SparseMatrix<ValueType> const& transitionMatrix, Prob01Key&& key, ComputeFunction const& compute) {
+    uint64_t startGeneration;
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        startGeneration = generation;
+        if (boundMatrix == &transitionMatrix) {
+            auto resultIt = prob01Results.find(key);
+            if (resultIt != prob01Results.end()) {
+                return resultIt->second;
+            }
+        }
+    }
+    auto result = compute();
+    std::lock_guard<std::mutex> lock(mutex);
+    if (boundMatrix == &transitionMatrix && generation == startGeneration) {
+        if (prob01Results.size() >= maxNumberOfCachedProb01Results) {
+            prob01Results.clear();
+        }
+        prob01Results.emplace(std::move(key), result);
+    }
+    return result;
+}
+
+template<typename ValueType>
+std::pair<storm::storage::BitVector, storm::storage::BitVector> AnalysisCache<ValueType>::performProb01(
+    storm::storage::SparseMatrix<ValueType> const& transitionMatrix, storm::storage::SparseMatrix<ValueType> const& backwardTransitions,
+    storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates) {
+    return getOrComputeProb01(transitionMatrix, Prob01Key(Prob01Kind::Deterministic, phiStates, psiStates),
+                              [&]() { return storm::utility::graph::performProb01(backwardTransitions, phiStates, psiStates); });
+}
+
+template<typename ValueType>
+std::pair<storm::storage::BitVector, storm::storage::BitVector> AnalysisCache<ValueType>::performProb01Min(
+    storm::storage::SparseMatrix<ValueType> const& transitionMatrix, storm::storage::SparseMatrix<ValueType> const& backwardTransitions,
+    storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates) {
+    return getOrComputeProb01(transitionMatrix, Prob01Key(Prob01Kind::Minimize, phiStates, psiStates), [&]() {
+        return storm::utility::graph::performProb01Min(transitionMatrix, transitionMatrix.getRowGroupIndices(), backwardTransitions, phiStates, psiStates);
+    });
+}
+
+template<typename ValueType>
+std::pair<storm::storage::BitVector, storm::storage::BitVector> AnalysisCache<ValueType>::performProb01Max(
+    storm::storage::SparseMatrix<ValueType> const& transitionMatrix, storm::storage::SparseMatrix<ValueType> const& backwardTransitions,
+    storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates) {
+    return getOrComputeProb01(transitionMatrix, Prob01Key(Prob01Kind::Maximize, phiStates, psiStates), [&]() {
+        return storm::utility::graph::performProb01Max(transitionMatrix, transitionMatrix.getRowGroupIndices(), backwardTransitions, phiStates, psiStates);
+    });
+}
+
+template<typename ValueType>
+std::shared_ptr<storm::storage::MaximalEndComponentDecomposition<ValueType> const> AnalysisCache<ValueType>::getMaximalEndComponents(
+    storm::storage::SparseMatrix<ValueType> const& transitionMatrix, storm::storage::SparseMatrix<ValueType> const& backwardTransitions,
+    storm::storage::BitVector const& subsystem) {
+    uint64_t startGeneration;
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        startGeneration = generation;
+        if (boundMatrix == &transitionMatrix) {
+            auto resultIt = maximalEndComponents.find(subsystem);
+            if (resultIt != maximalEndComponents.end()) {
+                return resultIt->second;
+            }
+        }
+    }
+    auto result = std::make_shared<storm::storage::MaximalEndComponentDecomposition<ValueType> const>(transitionMatrix, backwardTransitions, subsystem);
+    std::lock_guard<std::mutex> lock(mutex);
+    if (boundMatrix == &transitionMatrix && generation == startGeneration) {
+        if (maximalEndComponents.size() >= maxNumberOfCachedEndComponentDecompositions) {
+            maximalEndComponents.clear();
+        }
+        maximalEndComponents.emplace(subsystem, result);
+    }
+    return result;
+}
+
+template class AnalysisCache<double>;
+template class AnalysisCache<storm::RationalNumber>;
+template class AnalysisCache<storm::RationalFunction>;
+template class AnalysisCache<storm::Interval>;
+
+}  // namespace sparse
+}  // namespace models
+}  // namespace storm
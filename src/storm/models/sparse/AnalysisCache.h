@@ -0,0 +1,117 @@
+#pragma once
+
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <tuple>
+#include <utility>
+
+#include "storm/storage/BitVector.h"
+
+namespace storm {
+namespace storage {
+template<typename ValueType>
+class SparseMatrix;
+
+template<typename ValueType>
+class MaximalEndComponentDecomposition;
+}  // namespace storage
+
+namespace models {
+namespace sparse {
+
+/*!
+ * Memoizes graph analyses on the transition matrix of a sparse model, such that properties that are checked on the same model can share them.
+ * This includes the backward transitions, the qualitative (prob0/prob1) state sets for pairs of phi and psi states and the maximal end
+ * components of subsystems.
+ *
+ * The cache is bound to the transition matrix of the owning model. All analyses take the transition matrix they operate on, and the cache is only
+ * consulted if this is the bound matrix; analyses on other matrices (e.g., of a product model) are computed without being cached. The owning
+ * model clears the cache whenever its transition matrix may be modified. The cache may be used by multiple threads concurrently.
+ */
+template<typename ValueType>
+class AnalysisCache {
+   public:
+    AnalysisCache() = default;
+
+    /*!
+     * Copies do not share the cached analyses, as they are typically bound to a different matrix.
+     */
+    AnalysisCache(AnalysisCache const& other);
+    AnalysisCache& operator=(AnalysisCache const& other);
+
+    /*!
+     * Binds the cache to the given matrix. If the cache was previously bound to a different matrix, all cached analyses are discarded.
+     */
+    void bind(storm::storage::SparseMatrix<ValueType> const& transitionMatrix);
+
+    /*!
+     * Discards all cached analyses.
+     */
+    void clear();
+
+    /*!
+     * Retrieves the backward transitions of the given matrix.
+     */
+    std::shared_ptr<storm::storage::SparseMatrix<ValueType> const> getBackwardTransitions(storm::storage::SparseMatrix<ValueType> const& transitionMatrix);
+
+    /*!
+     * Retrieves the states with probability 0 and 1 of satisfying phi until psi in the given deterministic model.
+     * (see storm::utility::graph::performProb01)
+     */
+    std::pair<storm::storage::BitVector, storm::storage::BitVector> performProb01(storm::storage::SparseMatrix<ValueType> const& transitionMatrix,
+                                                                                  storm::storage::SparseMatrix<ValueType> const& backwardTransitions,
+                                                                                  storm::storage::BitVector const& phiStates,
+                                                                                  storm::storage::BitVector const& psiStates);
+
+    /*!
+     * Retrieves the states with minimal probability 0 and 1 of satisfying phi until psi in the given nondeterministic model.
+     * (see storm::utility::graph::performProb01Min)
+     */
+    std::pair<storm::storage::BitVector, storm::storage::BitVector> performProb01Min(storm::storage::SparseMatrix<ValueType> const& transitionMatrix,
+                                                                                     storm::storage::SparseMatrix<ValueType> const& backwardTransitions,
+                                                                                     storm::storage::BitVector const& phiStates,
+                                                                                     storm::storage::BitVector const& psiStates);
+
+    /*!
+     * Retrieves the states with maximal probability 0 and 1 of satisfying phi until psi in the given nondeterministic model.
+     * (see storm::utility::graph::performProb01Max)
+     */
+    std::pair<storm::storage::BitVector, storm::storage::BitVector> performProb01Max(storm::storage::SparseMatrix<ValueType> const& transitionMatrix,
+                                                                                     storm::storage::SparseMatrix<ValueType> const& backwardTransitions,
+                                                                                     storm::storage::BitVector const& phiStates,
+                                                                                     storm::storage::BitVector const& psiStates);
+
+    /*!
+     * Retrieves the maximal end components of the subsystem induced by the given states.
+     */
+    std::shared_ptr<storm::storage::MaximalEndComponentDecomposition<ValueType> const> getMaximalEndComponents(
+        storm::storage::SparseMatrix<ValueType> const& transitionMatrix, storm::storage::SparseMatrix<ValueType> const& backwardTransitions,
+        storm::storage::BitVector const& subsystem);
+
+   private:
+    enum class Prob01Kind { Deterministic, Minimize, Maximize };
+    typedef std::tuple<Prob01Kind, storm::storage::BitVector, storm::storage::BitVector> Prob01Key;
+
+    template<typename ComputeFunction>
+    std::pair<storm::storage::BitVector, storm::storage::BitVector> getOrComputeProb01(storm::storage::SparseMatrix<ValueType> const& transitionMatrix,
+                                                                                       Prob01Key&& key, ComputeFunction const& compute);
+
+    // The matrix that the cached analyses refer to.
+    storm::storage::SparseMatrix<ValueType> const* boundMatrix = nullptr;
+
+    // Incremented whenever the cache is cleared, such that analyses that were started before are not stored afterwards.
+    uint64_t generation = 0;
+
+    // Analyses are performed without holding the lock, so concurrent queries on different properties do not block each other.
+    std::mutex mutex;
+
+    std::shared_ptr<storm::storage::SparseMatrix<ValueType> const> backwardTransitions;
+    std::map<Prob01Key, std::pair<storm::storage::BitVector, storm::storage::BitVector>> prob01Results;
+    std::map<storm::storage::BitVector, std::shared_ptr<storm::storage::MaximalEndComponentDecomposition<ValueType> const>> maximalEndComponents;
+};
+
+}  // namespace sparse
+}  // namespace models
+}  // namespace storm
@@ -33,7 +33,7 @@ bool ChoiceLabeling::operator==(ChoiceLabeling const& other) const {
         if (!other.containsLabel(labelIndexPair.first)) {
             return false;
         }
-        if (labelings[labelIndexPair.second] != other.getChoices(labelIndexPair.first)) {
+        if (*labelings[labelIndexPair.second] != other.getChoices(labelIndexPair.first)) {
             return false;
         }
     }
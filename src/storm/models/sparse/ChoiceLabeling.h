@@ -22,6 +22,8 @@ class ChoiceLabeling : public ItemLabeling {
     ChoiceLabeling(ItemLabeling const& other);
     ChoiceLabeling(ItemLabeling const&& other);
     ChoiceLabeling& operator=(ChoiceLabeling const& other) = default;
+    ChoiceLabeling(ChoiceLabeling&& other) = default;
+    ChoiceLabeling& operator=(ChoiceLabeling&& other) = default;
 
     virtual bool isChoiceLabeling() const override;
 
@@ -45,7 +45,7 @@ bool ItemLabeling::operator==(ItemLabeling const& other) const {
         if (!other.containsLabel(labelIndexPair.first)) {
             return false;
         }
-        if (labelings[labelIndexPair.second] != other.getItems(labelIndexPair.first)) {
+        if (*labelings[labelIndexPair.second] != other.getItems(labelIndexPair.first)) {
             return false;
         }
     }
@@ -55,7 +55,7 @@ bool ItemLabeling::operator==(ItemLabeling const& other) const {
 ItemLabeling ItemLabeling::getSubLabeling(storm::storage::BitVector const& items) const {
     ItemLabeling result(items.getNumberOfSetBits());
     for (auto const& labelIndexPair : nameToLabelingIndexMap) {
-        result.addLabel(labelIndexPair.first, labelings[labelIndexPair.second] % items);
+        result.addLabel(labelIndexPair.first, *labelings[labelIndexPair.second] % items);
     }
     return result;
 }
@@ -115,12 +115,17 @@ std::set<std::string> ItemLabeling::getLabelsOfItem(uint64_t item) const {
 
 void ItemLabeling::permuteItems(std::vector<uint64_t> const& inversePermutation) {
     STORM_LOG_THROW(inversePermutation.size() == itemCount, storm::exceptions::InvalidArgumentException, "Permutation does not match number of items");
-    std::vector<storm::storage::BitVector> newLabelings;
-    for (storm::storage::BitVector const& source : this->labelings) {
-        newLabelings.push_back(source.permute(inversePermutation));
+    for (auto& labeling : this->labelings) {
+        labeling = std::make_shared<storm::storage::BitVector>(labeling->permute(inversePermutation));
     }
+}
 
-    this->labelings = newLabelings;
+void ItemLabeling::restrictItems(storm::storage::BitVector const& items) {
+    STORM_LOG_THROW(items.size() == itemCount, storm::exceptions::InvalidArgumentException, "Selected items do not match number of items");
+    for (auto& labeling : this->labelings) {
+        labeling = std::make_shared<storm::storage::BitVector>(*labeling % items);
+    }
+    itemCount = items.getNumberOfSetBits();
 }
 
 void ItemLabeling::addLabel(std::string const& label, storage::BitVector const& labeling) {
@@ -128,7 +133,7 @@ void ItemLabeling::addLabel(std::string const& label, storage::BitVector const&
     STORM_LOG_THROW(labeling.size() == itemCount, storm::exceptions::InvalidArgumentException,
                     "Labeling vector has invalid size. Expected: " << itemCount << " Actual: " << labeling.size());
     nameToLabelingIndexMap.emplace(label, labelings.size());
-    labelings.push_back(labeling);
+    labelings.push_back(std::make_shared<storm::storage::BitVector>(labeling));
 }
 
 void ItemLabeling::addLabel(std::string const& label, storage::BitVector&& labeling) {
@@ -136,7 +141,7 @@ void ItemLabeling::addLabel(std::string const& label, storage::BitVector&& label
     STORM_LOG_THROW(labeling.size() == itemCount, storm::exceptions::InvalidArgumentException,
                     "Labeling vector has invalid size. Expected: " << itemCount << " Actual: " << labeling.size());
     nameToLabelingIndexMap.emplace(label, labelings.size());
-    labelings.emplace_back(std::move(labeling));
+    labelings.push_back(std::make_shared<storm::storage::BitVector>(std::move(labeling)));
 }
 
 std::string ItemLabeling::addUniqueLabel(std::string const& prefix, storage::BitVector const& labeling) {
@@ -158,20 +163,20 @@ bool ItemLabeling::containsLabel(std::string const& label) const {
 void ItemLabeling::addLabelToItem(std::string const& label, uint64_t item) {
     STORM_LOG_THROW(this->containsLabel(label), storm::exceptions::InvalidArgumentException, "Label '" << label << "' unknown.");
     STORM_LOG_THROW(item < itemCount, storm::exceptions::OutOfRangeException, "Item index out of range.");
-    this->labelings[nameToLabelingIndexMap.at(label)].set(item, true);
+    getMutableItems(nameToLabelingIndexMap.at(label)).set(item, true);
 }
 
 void ItemLabeling::removeLabelFromItem(std::string const& label, uint64_t item) {
     STORM_LOG_THROW(item < itemCount, storm::exceptions::OutOfRangeException, "Item index out of range.");
     STORM_LOG_THROW(this->getItemHasLabel(label, item), storm::exceptions::InvalidArgumentException,
                     "Item " << item << " does not have label '" << label << "'.");
-    this->labelings[nameToLabelingIndexMap.at(label)].set(item, false);
+    getMutableItems(nameToLabelingIndexMap.at(label)).set(item, false);
 }
 
 bool ItemLabeling::getItemHasLabel(std::string const& label, uint64_t item) const {
     STORM_LOG_THROW(this->containsLabel(label), storm::exceptions::InvalidArgumentException,
                     "The label '" << label << "' is invalid for the labeling of the model.");
-    return this->labelings[nameToLabelingIndexMap.at(label)].get(item);
+    return this->labelings[nameToLabelingIndexMap.at(label)]->get(item);
 }
 
 std::size_t ItemLabeling::getNumberOfLabels() const {
@@ -185,27 +190,36 @@ std::size_t ItemLabeling::getNumberOfItems() const {
 storm::storage::BitVector const& ItemLabeling::getItems(std::string const& label) const {
     STORM_LOG_THROW(this->containsLabel(label), storm::exceptions::InvalidArgumentException,
                     "The label " << label << " is invalid for the labeling of the model.");
-    return this->labelings[nameToLabelingIndexMap.at(label)];
+    return *this->labelings[nameToLabelingIndexMap.at(label)];
 }
 
 void ItemLabeling::setItems(std::string const& label, storage::BitVector const& labeling) {
     STORM_LOG_THROW(this->containsLabel(label), storm::exceptions::InvalidArgumentException,
                     "The label " << label << " is invalid for the labeling of the model.");
     STORM_LOG_THROW(labeling.size() == itemCount, storm::exceptions::InvalidArgumentException, "Labeling vector has invalid size.");
-    this->labelings[nameToLabelingIndexMap.at(label)] = labeling;
+    this->labelings[nameToLabelingIndexMap.at(label)] = std::make_shared<storm::storage::BitVector>(labeling);
 }
 
 void ItemLabeling::setItems(std::string const& label, storage::BitVector&& labeling) {
     STORM_LOG_THROW(this->containsLabel(label), storm::exceptions::InvalidArgumentException,
                     "The label " << label << " is invalid for the labeling of the model.");
     STORM_LOG_THROW(labeling.size() == itemCount, storm::exceptions::InvalidArgumentException, "Labeling vector has invalid size.");
-    this->labelings[nameToLabelingIndexMap.at(label)] = labeling;
+    this->labelings[nameToLabelingIndexMap.at(label)] = std::make_shared<storm::storage::BitVector>(std::move(labeling));
+}
+
+storm::storage::BitVector& ItemLabeling::getMutableItems(uint64_t labelIndex) {
+    auto& labeling = this->labelings[labelIndex];
+    // The labeling may be shared with copies of this object, so we need to copy it before modifying it.
+    if (labeling.use_count() > 1) {
+        labeling = std::make_shared<storm::storage::BitVector>(*labeling);
+    }
+    return *labeling;
 }
 
 void ItemLabeling::printLabelingInformationToStream(std::ostream& out) const {
     out << this->getNumberOfLabels() << " labels\n";
     for (auto const& labelIndexPair : this->nameToLabelingIndexMap) {
-        out << "   * " << labelIndexPair.first << " -> " << this->labelings[labelIndexPair.second].getNumberOfSetBits() << " item(s)\n";
+        out << "   * " << labelIndexPair.first << " -> " << this->labelings[labelIndexPair.second]->getNumberOfSetBits() << " item(s)\n";
     }
 }
 
@@ -213,7 +227,7 @@ void ItemLabeling::printCompleteLabelingInformationToStream(std::ostream& out) c
     out << "Labels: \t" << this->getNumberOfLabels() << '\n';
     for (auto label : nameToLabelingIndexMap) {
         out << "Label '" << label.first << "': ";
-        for (auto index : this->labelings[label.second]) {
+        for (auto index : *this->labelings[label.second]) {
             out << index << " ";
         }
         out << '\n';
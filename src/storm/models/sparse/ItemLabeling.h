@@ -1,6 +1,7 @@
 #pragma once
 
 #include <iostream>
+#include <memory>
 #include <set>
 #include <string>
 #include <unordered_map>
@@ -29,6 +30,8 @@ class ItemLabeling {
 
     ItemLabeling(ItemLabeling const& other) = default;
     ItemLabeling& operator=(ItemLabeling const& other) = default;
+    ItemLabeling(ItemLabeling&& other) = default;
+    ItemLabeling& operator=(ItemLabeling&& other) = default;
 
     virtual ~ItemLabeling() = default;
 
@@ -139,6 +142,13 @@ class ItemLabeling {
 
     void permuteItems(std::vector<uint64_t> const& inversePermutation);
 
+    /*!
+     * Restricts the labeling to the selected items in place, such that it coincides with the sub labeling for the selected items.
+     *
+     * @param items The selected set of items.
+     */
+    void restrictItems(storm::storage::BitVector const& items);
+
     virtual std::size_t hash() const;
 
     /*!
@@ -222,14 +232,19 @@ class ItemLabeling {
      */
     virtual void removeLabelFromItem(std::string const& label, uint64_t item);
 
+    /*!
+     * Retrieves the labeling of the given label for modification. If it is shared with a copy of this labeling, it is copied first.
+     */
+    storm::storage::BitVector& getMutableItems(uint64_t labelIndex);
+
     // The number of items for which this object can hold the labeling.
     uint64_t itemCount;
 
     // A mapping from labels to the index of the corresponding bit vector in the vector.
     std::unordered_map<std::string, uint64_t> nameToLabelingIndexMap;
 
-    // A vector that holds the labeling for all known labels.
-    std::vector<storm::storage::BitVector> labelings;
+    // A vector that holds the labeling for all known labels. Copies of a labeling share the bit vectors until they are modified (copy-on-write).
+    std::vector<std::shared_ptr<storm::storage::BitVector>> labelings;
 
     /*!
      * Generate a unique, previously unused label from the given prefix string.
@@ -153,6 +153,18 @@ storm::storage::SparseMatrix<ValueType> Model<ValueType, RewardModelType>::getBa
     return this->getTransitionMatrix().transpose(true);
 }
 
+template<typename ValueType, typename RewardModelType>
+AnalysisCache<ValueType>& Model<ValueType, RewardModelType>::getAnalysisCache() const {
+    // Binding is done lazily as copies of this model do not share the cache.
+    analysisCache.bind(transitionMatrix);
+    return analysisCache;
+}
+
+template<typename ValueType, typename RewardModelType>
+std::shared_ptr<storm::storage::SparseMatrix<ValueType> const> Model<ValueType, RewardModelType>::getCachedBackwardTransitions() const {
+    return getAnalysisCache().getBackwardTransitions(transitionMatrix);
+}
+
 template<typename ValueType, typename RewardModelType>
 typename storm::storage::SparseMatrix<ValueType>::const_rows Model<ValueType, RewardModelType>::getRows(storm::storage::sparse::state_type state) const {
     return this->getTransitionMatrix().getRowGroup(state);
@@ -200,6 +212,7 @@ storm::storage::SparseMatrix<ValueType> const& Model<ValueType, RewardModelType>
 
 template<typename ValueType, typename RewardModelType>
 storm::storage::SparseMatrix<ValueType>& Model<ValueType, RewardModelType>::getTransitionMatrix() {
+    analysisCache.clear();
     return transitionMatrix;
 }
 
@@ -524,7 +537,9 @@ void Model<ValueType, RewardModelType>::writeJsonToStream(std::ostream& outStrea
     STORM_LOG_WARN_COND(this->getNumberOfStates() < 10000 && this->getNumberOfTransitions() < 100000,
                         "Exporting a large model to json. This might take some time and will result in a very large file.");
     using JsonValueType = storm::RationalNumber;
-    storm::json<JsonValueType> output;
+    // The states are written one after another, so only the json representation of a single state is kept in memory.
+    storm::JsonStreamWriter<JsonValueType> writer(outStream);
+    writer.beginArray();
     for (uint64_t state = 0; state < getNumberOfStates(); ++state) {
         storm::json<JsonValueType> stateChoicesJson;
         stateChoicesJson["id"] = state;
@@ -597,9 +612,9 @@ void Model<ValueType, RewardModelType>::writeJsonToStream(std::ostream& outStrea
             choicesJson.push_back(choiceJson);
         }
         stateChoicesJson["c"] = std::move(choicesJson);
-        output.push_back(std::move(stateChoicesJson));
+        writer.value(stateChoicesJson);
     }
-    outStream << storm::dumpJson(output);
+    writer.endArray();
 }
 
 template<>
@@ -6,6 +6,7 @@
 
 #include "storm/models/Model.h"
 #include "storm/models/ModelRepresentation.h"
+#include "storm/models/sparse/AnalysisCache.h"
 #include "storm/models/sparse/ChoiceLabeling.h"
 #include "storm/models/sparse/StateLabeling.h"
 #include "storm/storage/SparseMatrix.h"
@@ -58,6 +59,21 @@ class Model : public storm::models::Model<CValueType> {
      */
     storm::storage::SparseMatrix<ValueType> getBackwardTransitions() const;
 
+    /*!
+     * Retrieves the cache of graph analyses (backward transitions, qualitative state sets, end components) of this model, which allows checking
+     * several properties without repeating these analyses. The cache is cleared whenever the transition matrix is retrieved for modification.
+     *
+     * @return The analysis cache of this model.
+     */
+    AnalysisCache<ValueType>& getAnalysisCache() const;
+
+    /*!
+     * Retrieves the backward transitions of the model from the analysis cache, i.e., they are only computed once for all properties.
+     *
+     * @return A sparse matrix that represents the backward transitions of this model.
+     */
+    std::shared_ptr<storm::storage::SparseMatrix<ValueType> const> getCachedBackwardTransitions() const;
+
     /*!
      * Returns an object representing the matrix rows associated with the given state.
      *
@@ -125,7 +141,7 @@ class Model : public storm::models::Model<CValueType> {
     storm::storage::SparseMatrix<ValueType> const& getTransitionMatrix() const;
 
     /*!
-     * Retrieves the matrix representing the transitions of the model.
+     * Retrieves the matrix representing the transitions of the model. As the matrix might be modified, this clears the analysis cache.
      *
      * @return A matrix representing the transitions of the model.
      */
@@ -454,6 +470,9 @@ class Model : public storm::models::Model<CValueType> {
     //  A matrix representing transition relation.
     storm::storage::SparseMatrix<ValueType> transitionMatrix;
 
+    // Graph analyses on the transition matrix that are shared between properties.
+    mutable AnalysisCache<ValueType> analysisCache;
+
     // The labeling of the states.
     storm::models::sparse::StateLabeling stateLabeling;
 
@@ -29,6 +29,8 @@ class StateLabeling : public ItemLabeling {
     StateLabeling(ItemLabeling const& other);
     StateLabeling(ItemLabeling const&& other);
     StateLabeling& operator=(StateLabeling const& other) = default;
+    StateLabeling(StateLabeling&& other) = default;
+    StateLabeling& operator=(StateLabeling&& other) = default;
 
     virtual bool isStateLabeling() const override;
 
@@ -187,6 +187,22 @@ storm::dd::Bdd<Type> Model<Type, ValueType>::getQualitativeTransitionMatrix(bool
     return this->getTransitionMatrix().notZero();
 }
 
+template<storm::dd::DdType Type, typename ValueType>
+void Model<Type, ValueType>::setPartitionedTransitionRelation(storm::dd::PartitionedTransitionRelation<Type> const& partitionedTransitionRelation) {
+    this->partitionedTransitionRelation = partitionedTransitionRelation;
+}
+
+template<storm::dd::DdType Type, typename ValueType>
+bool Model<Type, ValueType>::hasPartitionedTransitionRelation() const {
+    return static_cast<bool>(partitionedTransitionRelation);
+}
+
+template<storm::dd::DdType Type, typename ValueType>
+storm::dd::PartitionedTransitionRelation<Type> const& Model<Type, ValueType>::getPartitionedTransitionRelation() const {
+    STORM_LOG_THROW(hasPartitionedTransitionRelation(), storm::exceptions::InvalidOperationException, "The model has no partitioned transition relation.");
+    return *partitionedTransitionRelation;
+}
+
 template<storm::dd::DdType Type, typename ValueType>
 std::set<storm::expressions::Variable> const& Model<Type, ValueType>::getRowVariables() const {
     return rowVariables;
@@ -2,6 +2,7 @@
 #define STORM_MODELS_SYMBOLIC_MODEL_H_
 
 #include <memory>
+#include <optional>
 #include <set>
 #include <unordered_map>
 
@@ -10,6 +11,7 @@
 #include "storm/storage/dd/Add.h"
 #include "storm/storage/dd/Bdd.h"
 #include "storm/storage/dd/DdType.h"
+#include "storm/storage/dd/PartitionedTransitionRelation.h"
 #include "storm/storage/expressions/Expression.h"
 #include "storm/storage/expressions/Variable.h"
 #include "storm/utility/OsDetection.h"
@@ -202,6 +204,25 @@ class Model : public storm::models::Model<CValueType> {
      */
     virtual storm::dd::Bdd<Type> getQualitativeTransitionMatrix(bool keepNondeterminism = true) const;
 
+    /*!
+     * Sets a partitioned representation of the qualitative transition relation of the model (abstracting from the
+     * nondeterminism variables) that graph algorithms may use instead of the monolithic relation.
+     *
+     * @param partitionedTransitionRelation The partitioned relation. Its monolithic relation must coincide with the
+     * qualitative transition matrix without nondeterminism.
+     */
+    void setPartitionedTransitionRelation(storm::dd::PartitionedTransitionRelation<Type> const& partitionedTransitionRelation);
+
+    /*!
+     * Retrieves whether the model has a partitioned representation of its transition relation.
+     */
+    bool hasPartitionedTransitionRelation() const;
+
+    /*!
+     * Retrieves the partitioned representation of the transition relation of the model (if there is one).
+     */
+    storm::dd::PartitionedTransitionRelation<Type> const& getPartitionedTransitionRelation() const;
+
     /*!
      * Retrieves the meta variables used to encode the rows of the transition matrix and the vector indices.
      *
@@ -431,6 +452,9 @@ class Model : public storm::models::Model<CValueType> {
     // The reward models associated with the model.
     std::unordered_map<std::string, RewardModelType> rewardModels;
 
+    // An optional partitioned representation of the qualitative transition relation.
+    std::optional<storm::dd::PartitionedTransitionRelation<Type>> partitionedTransitionRelation;
+
     // The parameters. Only meaningful for models over rational functions.
     std::set<storm::RationalFunctionVariable> parameters;
 
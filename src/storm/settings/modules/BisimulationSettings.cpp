@@ -1,4 +1,7 @@
 #include "storm/settings/modules/BisimulationSettings.h"
+
+#include <algorithm>
+
 #include "storm/settings/Argument.h"
 #include "storm/settings/ArgumentBuilder.h"
 #include "storm/settings/Option.h"
@@ -7,6 +10,7 @@
 #include "storm/settings/modules/GeneralSettings.h"
 
 #include "storm/exceptions/InvalidSettingsException.h"
+#include "storm/utility/threads.h"
 
 namespace storm {
 namespace settings {
@@ -16,12 +20,15 @@ const std::string BisimulationSettings::moduleName = "bisimulation";
 const std::string BisimulationSettings::typeOptionName = "type";
 const std::string BisimulationSettings::representativeOptionName = "repr";
 const std::string BisimulationSettings::originalVariablesOptionName = "origvars";
+const std::string BisimulationSettings::lazyQuotientOptionName = "lazyquot";
 const std::string BisimulationSettings::quotientFormatOptionName = "quot";
 const std::string BisimulationSettings::signatureModeOptionName = "sigmode";
 const std::string BisimulationSettings::reuseOptionName = "reuse";
 const std::string BisimulationSettings::initialPartitionOptionName = "init";
 const std::string BisimulationSettings::refinementModeOptionName = "refine";
 const std::string BisimulationSettings::exactArithmeticDdOptionName = "ddexact";
+const std::string BisimulationSettings::threadsOptionName = "threads";
+const std::string BisimulationSettings::approximationOptionName = "approx";
 
 BisimulationSettings::BisimulationSettings() : ModuleSettings(moduleName) {
     std::vector<std::string> types = {"strong", "weak"};
@@ -51,6 +58,11 @@ BisimulationSettings::BisimulationSettings() : ModuleSettings(moduleName) {
                                                    "Sets whether to use the original variables in the quotient rather than the block variables.")
                         .setIsAdvanced()
                         .build());
+    this->addOption(storm::settings::OptionBuilder(moduleName, lazyQuotientOptionName, false,
+                                                   "Sets whether the sparse quotient only contains the blocks that are relevant for the result of the (single) "
+                                                   "property in the initial states.")
+                        .setIsAdvanced()
+                        .build());
     this->addOption(
         storm::settings::OptionBuilder(moduleName, exactArithmeticDdOptionName, false, "Sets whether to use exact arithmetic in dd-based bisimulation.")
             .setIsAdvanced()
@@ -91,6 +103,24 @@ BisimulationSettings::BisimulationSettings() : ModuleSettings(moduleName) {
                                          .setDefaultValueString("full")
                                          .build())
                         .build());
+
+    this->addOption(storm::settings::OptionBuilder(moduleName, threadsOptionName, false,
+                                                   "Sets the number of threads used for the partition refinement (only applies to sparse strong bisimulation).")
+                        .setIsAdvanced()
+                        .addArgument(storm::settings::ArgumentBuilder::createUnsignedIntegerArgument(
+                                         "count", "The number of threads. A value of 0 uses as many threads as there are hardware threads.")
+                                         .setDefaultValueUnsignedInteger(1)
+                                         .build())
+                        .build());
+
+    this->addOption(storm::settings::OptionBuilder(moduleName, approximationOptionName, false,
+                                                   "Computes an approximate bisimulation in which the probabilities (rates for CTMCs) of related states "
+                                                   "may differ up to the given precision (only applies to sparse strong bisimulation of DTMCs and CTMCs).")
+                        .setIsAdvanced()
+                        .addArgument(storm::settings::ArgumentBuilder::createDoubleArgument("precision", "The precision of the approximation.")
+                                         .addValidatorDouble(ArgumentValidatorFactory::createDoubleGreaterValidator(0.0))
+                                         .build())
+                        .build());
 }
 
 bool BisimulationSettings::isStrongBisimulationSet() const {
@@ -129,10 +159,30 @@ bool BisimulationSettings::isUseOriginalVariablesSet() const {
     return this->getOption(originalVariablesOptionName).getHasOptionBeenSet();
 }
 
+bool BisimulationSettings::isLazyQuotientExtractionSet() const {
+    return this->getOption(lazyQuotientOptionName).getHasOptionBeenSet();
+}
+
 bool BisimulationSettings::useExactArithmeticInDdBisimulation() const {
     return this->getOption(exactArithmeticDdOptionName).getHasOptionBeenSet();
 }
 
+uint64_t BisimulationSettings::getNumberOfThreads() const {
+    uint64_t numberOfThreads = this->getOption(threadsOptionName).getArgumentByName("count").getValueAsUnsignedInteger();
+    if (numberOfThreads == 0) {
+        numberOfThreads = std::max(1u, storm::utility::getNumberOfThreads());
+    }
+    return numberOfThreads;
+}
+
+bool BisimulationSettings::isApproximationSet() const {
+    return this->getOption(approximationOptionName).getHasOptionBeenSet();
+}
+
+double BisimulationSettings::getApproximationPrecision() const {
+    return this->getOption(approximationOptionName).getArgumentByName("precision").getValueAsDouble();
+}
+
 storm::dd::bisimulation::SignatureMode BisimulationSettings::getSignatureMode() const {
     std::string modeAsString = this->getOption(signatureModeOptionName).getArgumentByName("mode").getValueAsString();
     if (modeAsString == "eager") {
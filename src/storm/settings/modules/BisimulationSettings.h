@@ -69,6 +69,13 @@ class BisimulationSettings : public ModuleSettings {
      */
     bool isUseOriginalVariablesSet() const;
 
+    /*!
+     * Retrieves whether the sparse quotient is to be extracted lazily, i.e. only the part that is relevant for the
+     * result of the (single) property in the initial states.
+     * NOTE: only applies to DD-based bisimulation.
+     */
+    bool isLazyQuotientExtractionSet() const;
+
     /*!
      * Retrieves whether exact arithmetic is to be used in symbolic bisimulation minimization.
      *
@@ -76,6 +83,23 @@ class BisimulationSettings : public ModuleSettings {
      */
     bool useExactArithmeticInDdBisimulation() const;
 
+    /*!
+     * Retrieves the number of threads to use for the partition refinement of sparse models.
+     * NOTE: only applies to sparse (strong) bisimulation.
+     */
+    uint64_t getNumberOfThreads() const;
+
+    /*!
+     * Retrieves whether an approximate bisimulation is to be computed.
+     * NOTE: only applies to sparse (strong) bisimulation of deterministic models.
+     */
+    bool isApproximationSet() const;
+
+    /*!
+     * Retrieves the precision up to which the probabilities (or rates) of related states may differ in an approximate bisimulation.
+     */
+    double getApproximationPrecision() const;
+
     /*!
      * Retrieves the mode to compute signatures.
      */
@@ -106,6 +130,7 @@ class BisimulationSettings : public ModuleSettings {
     static const std::string typeOptionName;
     static const std::string representativeOptionName;
     static const std::string originalVariablesOptionName;
+    static const std::string lazyQuotientOptionName;
     static const std::string quotientFormatOptionName;
     static const std::string signatureModeOptionName;
     static const std::string reuseOptionName;
@@ -113,6 +138,8 @@ class BisimulationSettings : public ModuleSettings {
     static const std::string refinementModeOptionName;
     static const std::string parallelismModeOptionName;
     static const std::string exactArithmeticDdOptionName;
+    static const std::string threadsOptionName;
+    static const std::string approximationOptionName;
 };
 }  // namespace modules
 }  // namespace settings
@@ -11,6 +11,7 @@
 
 #include "storm/exceptions/IllegalArgumentValueException.h"
 #include "storm/utility/macros.h"
+#include "storm/utility/threads.h"
 
 namespace storm {
 namespace settings {
@@ -22,6 +23,9 @@ const std::string explorationOrderOptionName = "explorder";
 const std::string explorationOrderOptionShortName = "eo";
 const std::string explorationChecksOptionName = "explchecks";
 const std::string explorationChecksOptionShortName = "ec";
+const std::string explorationThreadsOptionName = "explthreads";
+const std::string stateStorageDirectoryOptionName = "state-storage-dir";
+const std::string explorationLimitOptionName = "expllimit";
 const std::string prismCompatibilityOptionName = "prismcompat";
 const std::string prismCompatibilityOptionShortName = "pc";
 const std::string dontFixDeadlockOptionName = "nofixdl";
@@ -36,6 +40,12 @@ const std::string buildObservationValuationsOptionName = "buildobsval";
 const std::string buildAllLabelsOptionName = "build-all-labels";
 const std::string buildOutOfBoundsStateOptionName = "build-out-of-bounds-state";
 const std::string buildOverlappingGuardsLabelOptionName = "build-overlapping-guards-label";
+const std::string symmetryReductionOptionName = "symmetry-reduction";
+const std::string partialOrderReductionOptionName = "partial-order-reduction";
+const std::string ddStaticVariableOrderOptionName = "dd-static-order";
+const std::string ddReachabilityStrategyOptionName = "dd-reachability";
+const std::string ddPartitionedTransitionRelationOptionName = "dd-partitioned-relation";
+const std::string symbolicReachabilityOptionName = "symbolic-reachability";
 const std::string noSimplifyOptionName = "no-simplify";
 const std::string bitsForUnboundedVariablesOptionName = "int-bits";
 const std::string performLocationElimination = "location-elimination";
@@ -71,7 +81,7 @@ BuildSettings::BuildSettings() : ModuleSettings(moduleName) {
     this->addOption(storm::settings::OptionBuilder(moduleName, buildAllLabelsOptionName, false, "If set, build all labels").setIsAdvanced().build());
     this->addOption(storm::settings::OptionBuilder(moduleName, noBuildOptionName, false, "If set, do not build the model.").setIsAdvanced().build());
 
-    std::vector<std::string> explorationOrders = {"dfs", "bfs"};
+    std::vector<std::string> explorationOrders = {"dfs", "bfs", "best"};
     this->addOption(storm::settings::OptionBuilder(moduleName, explorationOrderOptionName, false, "Sets which exploration order to use.")
                         .setShortName(explorationOrderOptionShortName)
                         .setIsAdvanced()
@@ -80,6 +90,27 @@ BuildSettings::BuildSettings() : ModuleSettings(moduleName) {
                                          .setDefaultValueString("bfs")
                                          .build())
                         .build());
+    this->addOption(storm::settings::OptionBuilder(moduleName, explorationThreadsOptionName, false,
+                                                   "Sets the number of threads used for exploring the state space (only for breadth-first exploration) and for parsing and exporting explicit DRN models.")
+                        .setIsAdvanced()
+                        .addArgument(storm::settings::ArgumentBuilder::createUnsignedIntegerArgument(
+                                         "count", "The number of threads. A value of 0 uses as many threads as there are hardware threads.")
+                                         .setDefaultValueUnsignedInteger(1)
+                                         .build())
+                        .build());
+    this->addOption(storm::settings::OptionBuilder(moduleName, stateStorageDirectoryOptionName, false,
+                                                   "If set, the explored states are stored in memory-mapped temporary files within the given directory. "
+                                                   "This allows building models whose states do not fit into main memory.")
+                        .setIsAdvanced()
+                        .addArgument(storm::settings::ArgumentBuilder::createStringArgument("directory", "The directory for the temporary files.").build())
+                        .build());
+    this->addOption(storm::settings::OptionBuilder(moduleName, explorationLimitOptionName, false,
+                                                   "If set, at most the given number of states is expanded. The remaining states are not expanded, "
+                                                   "get a self-loop and are labeled with 'unexplored'. Combined with the best-first exploration order, "
+                                                   "this yields a partial model that covers the most likely behavior.")
+                        .setIsAdvanced()
+                        .addArgument(storm::settings::ArgumentBuilder::createUnsignedIntegerArgument("count", "The maximal number of expanded states.").build())
+                        .build());
     this->addOption(storm::settings::OptionBuilder(moduleName, explorationChecksOptionName, false,
                                                    "If set, additional checks (if available) are performed during model exploration to debug the model.")
                         .setShortName(explorationChecksOptionShortName)
@@ -91,6 +122,42 @@ BuildSettings::BuildSettings() : ModuleSettings(moduleName) {
                                                    "For states where multiple guards are enabled, we add a label (for debugging DTMCs)")
                         .setIsAdvanced()
                         .build());
+    this->addOption(storm::settings::OptionBuilder(moduleName, symmetryReductionOptionName, false,
+                                                   "If set, only one representative of states that only differ by a permutation of symmetric (renamed) PRISM "
+                                                   "modules is explored.")
+                        .setIsAdvanced()
+                        .build());
+    this->addOption(storm::settings::OptionBuilder(moduleName, partialOrderReductionOptionName, false,
+                                                   "If set, independent commands of PRISM MDPs are only interleaved once. This preserves reachability "
+                                                   "properties and LTL properties without next operator, but not rewards.")
+                        .setIsAdvanced()
+                        .build());
+    this->addOption(storm::settings::OptionBuilder(moduleName, ddStaticVariableOrderOptionName, false,
+                                                   "If set, the variables of symbolic models are ordered before building the decision diagrams such "
+                                                   "that variables that are tested and updated together are close to each other.")
+                        .setIsAdvanced()
+                        .build());
+    std::vector<std::string> ddReachabilityStrategies = {"bfs", "chaining", "saturation"};
+    this->addOption(storm::settings::OptionBuilder(moduleName, ddReachabilityStrategyOptionName, false,
+                                                   "Sets how the reachable states of symbolic models are computed. Chaining and saturation split the "
+                                                   "transition relation by the module (or automaton) whose variables are changed.")
+                        .setIsAdvanced()
+                        .addArgument(storm::settings::ArgumentBuilder::createStringArgument("name", "The name of the strategy.")
+                                         .addValidatorString(ArgumentValidatorFactory::createMultipleChoiceValidator(ddReachabilityStrategies))
+                                         .setDefaultValueString("bfs")
+                                         .build())
+                        .build());
+    this->addOption(storm::settings::OptionBuilder(moduleName, ddPartitionedTransitionRelationOptionName, false,
+                                                   "If set, symbolic models additionally keep their transition relation partitioned by module (or "
+                                                   "automaton), which is used by the graph analyses.")
+                        .setIsAdvanced()
+                        .build());
+    this->addOption(storm::settings::OptionBuilder(moduleName, symbolicReachabilityOptionName, false,
+                                                   "If set, the reachable states of sparse models are computed symbolically before the transitions "
+                                                   "of these states are built explicitly (and in parallel, if multiple exploration threads are set). "
+                                                   "Only supported for PRISM programs.")
+                        .setIsAdvanced()
+                        .build());
     this->addOption(
         storm::settings::OptionBuilder(moduleName, noSimplifyOptionName, false, "If set, simplification PRISM input is disabled.").setIsAdvanced().build());
     this->addOption(storm::settings::OptionBuilder(moduleName, bitsForUnboundedVariablesOptionName, false,
@@ -165,6 +232,14 @@ bool BuildSettings::isBuildOutOfBoundsStateSet() const {
     return this->getOption(buildOutOfBoundsStateOptionName).getHasOptionBeenSet();
 }
 
+bool BuildSettings::isSymmetryReductionSet() const {
+    return this->getOption(symmetryReductionOptionName).getHasOptionBeenSet();
+}
+
+bool BuildSettings::isPartialOrderReductionSet() const {
+    return this->getOption(partialOrderReductionOptionName).getHasOptionBeenSet();
+}
+
 bool BuildSettings::isAddOverlappingGuardsLabelSet() const {
     return this->getOption(buildOverlappingGuardsLabelOptionName).getHasOptionBeenSet();
 }
@@ -179,6 +254,8 @@ storm::builder::ExplorationOrder BuildSettings::getExplorationOrder() const {
         return storm::builder::ExplorationOrder::Dfs;
     } else if (explorationOrderAsString == "bfs") {
         return storm::builder::ExplorationOrder::Bfs;
+    } else if (explorationOrderAsString == "best") {
+        return storm::builder::ExplorationOrder::BestFirst;
     }
     STORM_LOG_THROW(false, storm::exceptions::IllegalArgumentValueException, "Unknown exploration order '" << explorationOrderAsString << "'.");
 }
@@ -187,6 +264,54 @@ bool BuildSettings::isExplorationChecksSet() const {
     return this->getOption(explorationChecksOptionName).getHasOptionBeenSet();
 }
 
+uint64_t BuildSettings::getNumberOfExplorationThreads() const {
+    uint64_t numberOfThreads = this->getOption(explorationThreadsOptionName).getArgumentByName("count").getValueAsUnsignedInteger();
+    if (numberOfThreads == 0) {
+        numberOfThreads = std::max(1u, storm::utility::getNumberOfThreads());
+    }
+    return numberOfThreads;
+}
+
+bool BuildSettings::isStateStorageDirectorySet() const {
+    return this->getOption(stateStorageDirectoryOptionName).getHasOptionBeenSet();
+}
+
+std::string BuildSettings::getStateStorageDirectory() const {
+    return this->getOption(stateStorageDirectoryOptionName).getArgumentByName("directory").getValueAsString();
+}
+
+bool BuildSettings::isExplorationLimitSet() const {
+    return this->getOption(explorationLimitOptionName).getHasOptionBeenSet();
+}
+
+uint64_t BuildSettings::getExplorationLimit() const {
+    return this->getOption(explorationLimitOptionName).getArgumentByName("count").getValueAsUnsignedInteger();
+}
+
+bool BuildSettings::isDdStaticVariableOrderSet() const {
+    return this->getOption(ddStaticVariableOrderOptionName).getHasOptionBeenSet();
+}
+
+storm::builder::DdReachabilityStrategy BuildSettings::getDdReachabilityStrategy() const {
+    std::string strategyAsString = this->getOption(ddReachabilityStrategyOptionName).getArgumentByName("name").getValueAsString();
+    if (strategyAsString == "bfs") {
+        return storm::builder::DdReachabilityStrategy::Bfs;
+    } else if (strategyAsString == "chaining") {
+        return storm::builder::DdReachabilityStrategy::Chaining;
+    } else if (strategyAsString == "saturation") {
+        return storm::builder::DdReachabilityStrategy::Saturation;
+    }
+    STORM_LOG_THROW(false, storm::exceptions::IllegalArgumentValueException, "Unknown reachability strategy '" << strategyAsString << "'.");
+}
+
+bool BuildSettings::isDdPartitionedTransitionRelationSet() const {
+    return this->getOption(ddPartitionedTransitionRelationOptionName).getHasOptionBeenSet();
+}
+
+bool BuildSettings::isSymbolicReachabilitySet() const {
+    return this->getOption(symbolicReachabilityOptionName).getHasOptionBeenSet();
+}
+
 bool BuildSettings::isNoSimplifySet() const {
     return this->getOption(noSimplifyOptionName).getHasOptionBeenSet();
 }
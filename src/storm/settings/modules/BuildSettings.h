@@ -1,6 +1,7 @@
 #pragma once
 
 #include "storm-config.h"
+#include "storm/builder/DdReachabilityStrategy.h"
 #include "storm/builder/ExplorationOrder.h"
 #include "storm/settings/modules/ModuleSettings.h"
 
@@ -28,6 +29,32 @@ class BuildSettings : public ModuleSettings {
      */
     bool isExplorationChecksSet() const;
 
+    /*!
+     * Retrieves the number of threads to use for exploring the state space. If the user requested auto-detection, the number of hardware
+     * threads is returned.
+     */
+    uint64_t getNumberOfExplorationThreads() const;
+
+    /*!
+     * Retrieves whether the explored states shall be stored in memory-mapped files.
+     */
+    bool isStateStorageDirectorySet() const;
+
+    /*!
+     * Retrieves the directory in which the memory-mapped files for the explored states are created.
+     */
+    std::string getStateStorageDirectory() const;
+
+    /*!
+     * Retrieves whether the number of expanded states is limited.
+     */
+    bool isExplorationLimitSet() const;
+
+    /*!
+     * Retrieves the maximal number of states that are expanded.
+     */
+    uint64_t getExplorationLimit() const;
+
     /*!
      * Retrieves the exploration order if it was set.
      *
@@ -103,6 +130,36 @@ class BuildSettings : public ModuleSettings {
      */
     bool isBuildOutOfBoundsStateSet() const;
 
+    /*!
+     * Retrieves whether symmetry reduction is to be applied during exploration
+     */
+    bool isSymmetryReductionSet() const;
+
+    /*!
+     * Retrieves whether partial order reduction is to be applied during exploration
+     */
+    bool isPartialOrderReductionSet() const;
+
+    /*!
+     * Retrieves whether the variables of symbolic models are to be ordered statically before building the decision diagrams.
+     */
+    bool isDdStaticVariableOrderSet() const;
+
+    /*!
+     * Retrieves the strategy with which the reachable states of symbolic models are computed.
+     */
+    storm::builder::DdReachabilityStrategy getDdReachabilityStrategy() const;
+
+    /*!
+     * Retrieves whether symbolic models are to keep a partitioned representation of their transition relation.
+     */
+    bool isDdPartitionedTransitionRelationSet() const;
+
+    /*!
+     * Retrieves whether the reachable states of sparse models are to be computed symbolically before their transitions are built explicitly.
+     */
+    bool isSymbolicReachabilitySet() const;
+
     /*!
      * Retrieves whether to build the overlapping label
      */
@@ -30,6 +30,7 @@ const std::string CoreSettings::engineOptionShortName = "e";
 const std::string CoreSettings::ddLibraryOptionName = "ddlib";
 const std::string CoreSettings::intelTbbOptionName = "enable-tbb";
 const std::string CoreSettings::intelTbbOptionShortName = "tbb";
+const std::string CoreSettings::parallelGraphAnalysisOptionName = "parallel-graph";
 
 CoreSettings::CoreSettings() : ModuleSettings(moduleName), engine(storm::utility::Engine::Sparse) {
     std::vector<std::string> engines;
@@ -71,9 +72,10 @@ CoreSettings::CoreSettings() : ModuleSettings(moduleName), engine(storm::utility
                                          .build())
                         .build());
 
-    std::vector<std::string> smtSolvers = {"z3", "mathsat"};
+    std::vector<std::string> smtSolvers = {"z3", "mathsat", "portfolio"};
     this->addOption(storm::settings::OptionBuilder(moduleName, smtSolverOptionName, false, "Sets which SMT solver is preferred.")
-                        .addArgument(storm::settings::ArgumentBuilder::createStringArgument("name", "The name of an SMT solver.")
+                        .addArgument(storm::settings::ArgumentBuilder::createStringArgument(
+                                         "name", "The name of an SMT solver. 'portfolio' runs all available solvers in parallel and takes the first answer.")
                                          .addValidatorString(ArgumentValidatorFactory::createMultipleChoiceValidator(smtSolvers))
                                          .setDefaultValueString("z3")
                                          .build())
@@ -86,6 +88,11 @@ CoreSettings::CoreSettings() : ModuleSettings(moduleName), engine(storm::utility
         storm::settings::OptionBuilder(moduleName, intelTbbOptionName, false, "Sets whether to use Intel TBB (if Storm was built with support for TBB).")
             .setShortName(intelTbbOptionShortName)
             .build());
+
+    this->addOption(storm::settings::OptionBuilder(moduleName, parallelGraphAnalysisOptionName, true,
+                                                   "Sets whether the qualitative graph analyses of large models (e.g., prob0/prob1, reachability and SCC "
+                                                   "decompositions) are performed in parallel (if Storm was built with support for TBB).")
+                        .build());
 }
 
 storm::solver::EquationSolverType CoreSettings::getEquationSolver() const {
@@ -138,6 +145,8 @@ storm::solver::SmtSolverType CoreSettings::getSmtSolver() const {
         return storm::solver::SmtSolverType::Z3;
     } else if (smtSolverName == "mathsat") {
         return storm::solver::SmtSolverType::Mathsat;
+    } else if (smtSolverName == "portfolio") {
+        return storm::solver::SmtSolverType::Portfolio;
     }
     STORM_LOG_THROW(false, storm::exceptions::IllegalArgumentValueException, "Unknown SMT solver '" << smtSolverName << "'.");
 }
@@ -164,6 +173,10 @@ bool CoreSettings::isUseIntelTbbSet() const {
     return this->getOption(intelTbbOptionName).getHasOptionBeenSet();
 }
 
+bool CoreSettings::isParallelGraphAnalysisSet() const {
+    return this->getOption(parallelGraphAnalysisOptionName).getHasOptionBeenSet();
+}
+
 storm::utility::Engine CoreSettings::getEngine() const {
     return engine;
 }
@@ -184,6 +197,7 @@ bool CoreSettings::check() const {
     return true;
 #else
     STORM_LOG_WARN_COND(!isUseIntelTbbSet(), "Enabling TBB is not supported in this version of Storm as it was not built with support for it.");
+    STORM_LOG_WARN_COND(!isParallelGraphAnalysisSet(), "Parallel graph analyses are not supported in this version of Storm as it was not built with TBB.");
     return true;
 #endif
 }
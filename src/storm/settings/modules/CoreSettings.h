@@ -102,6 +102,13 @@ class CoreSettings : public ModuleSettings {
      */
     bool isUseIntelTbbSet() const;
 
+    /*!
+     * Retrieves whether the qualitative graph analyses (e.g., prob0/prob1, reachability and SCC decompositions) shall be performed in parallel.
+     *
+     * @return True iff the option was set.
+     */
+    bool isParallelGraphAnalysisSet() const;
+
     /*!
      * Retrieves the selected engine.
      *
@@ -134,6 +141,7 @@ class CoreSettings : public ModuleSettings {
     static const std::string ddLibraryOptionName;
     static const std::string intelTbbOptionName;
     static const std::string intelTbbOptionShortName;
+    static const std::string parallelGraphAnalysisOptionName;
 };
 
 }  // namespace modules
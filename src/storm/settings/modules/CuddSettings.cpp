@@ -19,6 +19,10 @@ const std::string CuddSettings::precisionOptionName = "precision";
 const std::string CuddSettings::maximalMemoryOptionName = "maxmem";
 const std::string CuddSettings::reorderOptionName = "dynreorder";
 const std::string CuddSettings::reorderTechniqueOptionName = "reordertechnique";
+const std::string CuddSettings::uniqueSlotsOptionName = "uniqueslots";
+const std::string CuddSettings::cacheSlotsOptionName = "cacheslots";
+const std::string CuddSettings::maximalCacheSlotsOptionName = "maxcache";
+const std::string CuddSettings::minimalHitRateOptionName = "minhit";
 
 CuddSettings::CuddSettings() : ModuleSettings(moduleName) {
     this->addOption(storm::settings::OptionBuilder(moduleName, precisionOptionName, true, "Sets the precision used by Cudd.")
@@ -68,6 +72,40 @@ CuddSettings::CuddSettings() : ModuleSettings(moduleName) {
                              .addValidatorString(ArgumentValidatorFactory::createMultipleChoiceValidator(reorderingTechniques))
                              .build())
             .build());
+
+    this->addOption(
+        storm::settings::OptionBuilder(moduleName, uniqueSlotsOptionName, true, "Sets the initial number of slots of each subtable of Cudd's unique table.")
+            .setIsAdvanced()
+            .addArgument(storm::settings::ArgumentBuilder::createUnsignedIntegerArgument("value", "The initial number of slots.")
+                             .setDefaultValueUnsignedInteger(256)
+                             .addValidatorUnsignedInteger(ArgumentValidatorFactory::createUnsignedGreaterValidator(0))
+                             .build())
+            .build());
+
+    this->addOption(storm::settings::OptionBuilder(moduleName, cacheSlotsOptionName, true, "Sets the initial number of slots of Cudd's operation cache.")
+                        .setIsAdvanced()
+                        .addArgument(storm::settings::ArgumentBuilder::createUnsignedIntegerArgument("value", "The initial number of slots.")
+                                         .setDefaultValueUnsignedInteger(262144)
+                                         .addValidatorUnsignedInteger(ArgumentValidatorFactory::createUnsignedGreaterValidator(0))
+                                         .build())
+                        .build());
+
+    this->addOption(
+        storm::settings::OptionBuilder(moduleName, maximalCacheSlotsOptionName, true, "Sets the number of slots up to which Cudd's operation cache may grow.")
+            .setIsAdvanced()
+            .addArgument(storm::settings::ArgumentBuilder::createUnsignedIntegerArgument("value", "The maximal number of slots (0 means Cudd's default).")
+                             .setDefaultValueUnsignedInteger(0)
+                             .build())
+            .build());
+
+    this->addOption(
+        storm::settings::OptionBuilder(moduleName, minimalHitRateOptionName, true, "Sets the hit rate above which Cudd enlarges its operation cache.")
+            .setIsAdvanced()
+            .addArgument(storm::settings::ArgumentBuilder::createUnsignedIntegerArgument("value", "The hit rate in percent.")
+                             .setDefaultValueUnsignedInteger(30)
+                             .addValidatorUnsignedInteger(ArgumentValidatorFactory::createUnsignedRangeValidatorIncluding(0, 100))
+                             .build())
+            .build());
 }
 
 double CuddSettings::getConstantPrecision() const {
@@ -78,6 +116,22 @@ uint_fast64_t CuddSettings::getMaximalMemory() const {
     return this->getOption(maximalMemoryOptionName).getArgumentByName("value").getValueAsUnsignedInteger();
 }
 
+uint_fast64_t CuddSettings::getUniqueTableSlots() const {
+    return this->getOption(uniqueSlotsOptionName).getArgumentByName("value").getValueAsUnsignedInteger();
+}
+
+uint_fast64_t CuddSettings::getCacheSlots() const {
+    return this->getOption(cacheSlotsOptionName).getArgumentByName("value").getValueAsUnsignedInteger();
+}
+
+uint_fast64_t CuddSettings::getMaximalCacheSlots() const {
+    return this->getOption(maximalCacheSlotsOptionName).getArgumentByName("value").getValueAsUnsignedInteger();
+}
+
+uint_fast64_t CuddSettings::getMinimalCacheHitRate() const {
+    return this->getOption(minimalHitRateOptionName).getArgumentByName("value").getValueAsUnsignedInteger();
+}
+
 bool CuddSettings::isReorderingEnabled() const {
     return this->getOption(reorderOptionName).getHasOptionBeenSet();
 }
@@ -67,6 +67,34 @@ class CuddSettings : public ModuleSettings {
      */
     ReorderingTechnique getReorderingTechnique() const;
 
+    /*!
+     * Retrieves the initial number of slots in each subtable of CUDD's unique table.
+     *
+     * @return The initial number of unique table slots.
+     */
+    uint_fast64_t getUniqueTableSlots() const;
+
+    /*!
+     * Retrieves the initial number of slots of CUDD's computed table (operation cache).
+     *
+     * @return The initial number of cache slots.
+     */
+    uint_fast64_t getCacheSlots() const;
+
+    /*!
+     * Retrieves the hard limit for the number of slots of CUDD's computed table (0 means that CUDD picks the limit).
+     *
+     * @return The maximal number of cache slots.
+     */
+    uint_fast64_t getMaximalCacheSlots() const;
+
+    /*!
+     * Retrieves the hit rate (in percent) above which CUDD grows its computed table.
+     *
+     * @return The minimal hit rate.
+     */
+    uint_fast64_t getMinimalCacheHitRate() const;
+
     // The name of the module.
     static const std::string moduleName;
 
@@ -76,6 +104,10 @@ class CuddSettings : public ModuleSettings {
     static const std::string maximalMemoryOptionName;
     static const std::string reorderOptionName;
     static const std::string reorderTechniqueOptionName;
+    static const std::string uniqueSlotsOptionName;
+    static const std::string cacheSlotsOptionName;
+    static const std::string maximalCacheSlotsOptionName;
+    static const std::string minimalHitRateOptionName;
 };
 
 }  // namespace modules
@@ -23,6 +23,7 @@ const std::string EigenEquationSolverSettings::maximalIterationsOptionName = "ma
 const std::string EigenEquationSolverSettings::maximalIterationsOptionShortName = "i";
 const std::string EigenEquationSolverSettings::precisionOptionName = "precision";
 const std::string EigenEquationSolverSettings::restartOptionName = "restart";
+const std::string EigenEquationSolverSettings::orderingOptionName = "ordering";
 
 EigenEquationSolverSettings::EigenEquationSolverSettings() : ModuleSettings(moduleName) {
     std::vector<std::string> methods = {"sparselu", "bicgstab", "dgmres", "gmres"};
@@ -46,6 +47,16 @@ EigenEquationSolverSettings::EigenEquationSolverSettings() : ModuleSettings(modu
                              .build())
             .build());
 
+    std::vector<std::string> orderings = {"colamd", "amd", "natural"};
+    this->addOption(
+        storm::settings::OptionBuilder(moduleName, orderingOptionName, true, "The fill-reducing ordering used for sparse LU factorizations.")
+            .setIsAdvanced()
+            .addArgument(storm::settings::ArgumentBuilder::createStringArgument("name", "The name of the ordering.")
+                             .addValidatorString(ArgumentValidatorFactory::createMultipleChoiceValidator(orderings))
+                             .setDefaultValueString("colamd")
+                             .build())
+            .build());
+
     this->addOption(
         storm::settings::OptionBuilder(moduleName, restartOptionName, true, "The number of iteration until restarted methods are actually restarted.")
             .setIsAdvanced()
@@ -111,6 +122,18 @@ storm::solver::EigenLinearEquationSolverPreconditioner EigenEquationSolverSettin
                     "Unknown preconditioning technique '" << PreconditioningMethodAsString << "' selected.");
 }
 
+storm::solver::EigenLinearEquationSolverOrdering EigenEquationSolverSettings::getOrdering() const {
+    std::string orderingAsString = this->getOption(orderingOptionName).getArgumentByName("name").getValueAsString();
+    if (orderingAsString == "colamd") {
+        return storm::solver::EigenLinearEquationSolverOrdering::Colamd;
+    } else if (orderingAsString == "amd") {
+        return storm::solver::EigenLinearEquationSolverOrdering::Amd;
+    } else if (orderingAsString == "natural") {
+        return storm::solver::EigenLinearEquationSolverOrdering::Natural;
+    }
+    STORM_LOG_THROW(false, storm::exceptions::IllegalArgumentValueException, "Unknown ordering '" << orderingAsString << "' selected.");
+}
+
 bool EigenEquationSolverSettings::isRestartIterationCountSet() const {
     return this->getOption(restartOptionName).getHasOptionBeenSet();
 }
@@ -58,6 +58,13 @@ class EigenEquationSolverSettings : public ModuleSettings {
      */
     storm::solver::EigenLinearEquationSolverPreconditioner getPreconditioningMethod() const;
 
+    /*!
+     * Retrieves the fill-reducing ordering that is applied before computing a sparse LU factorization.
+     *
+     * @return The ordering to use.
+     */
+    storm::solver::EigenLinearEquationSolverOrdering getOrdering() const;
+
     /*!
      * Retrieves whether the restart iteration count has been set.
      *
@@ -113,6 +120,7 @@ class EigenEquationSolverSettings : public ModuleSettings {
     static const std::string maximalIterationsOptionShortName;
     static const std::string precisionOptionName;
     static const std::string restartOptionName;
+    static const std::string orderingOptionName;
 };
 
 std::ostream& operator<<(std::ostream& out, EigenEquationSolverSettings::LinearEquationMethod const& method);
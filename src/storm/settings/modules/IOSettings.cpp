@@ -27,6 +27,11 @@ const std::string IOSettings::exportCdfOptionName = "exportcdf";
 const std::string IOSettings::exportCdfOptionShortName = "cdf";
 const std::string IOSettings::exportSchedulerOptionName = "exportscheduler";
 const std::string IOSettings::exportCheckResultOptionName = "exportresult";
+const std::string IOSettings::exportHintOptionName = "exporthint";
+const std::string IOSettings::importHintOptionName = "importhint";
+const std::string IOSettings::exportTraceOptionName = "exporttrace";
+const std::string IOSettings::exportSolverTelemetryOptionName = "exportsolvertelemetry";
+const std::string IOSettings::serverOptionName = "server";
 const std::string IOSettings::explicitOptionName = "explicit";
 const std::string IOSettings::explicitOptionShortName = "exp";
 const std::string IOSettings::explicitDrnOptionName = "explicit-drn";
@@ -74,7 +79,7 @@ IOSettings::IOSettings() : ModuleSettings(moduleName) {
                                          .setDefaultValueUnsignedInteger(0)
                                          .build())
                         .build());
-    std::vector<std::string> exportFormats({"auto", "dot", "drdd", "drn", "json"});
+    std::vector<std::string> exportFormats({"auto", "dot", "drdd", "drn", "drnb", "json"});
     this->addOption(
         storm::settings::OptionBuilder(moduleName, exportBuildOptionName, false, "Exports the built model to a file.")
             .addArgument(storm::settings::ArgumentBuilder::createStringArgument("file", "The output file.").build())
@@ -103,14 +108,48 @@ IOSettings::IOSettings() : ModuleSettings(moduleName) {
         storm::settings::OptionBuilder(moduleName, exportSchedulerOptionName, false,
                                        "Exports the choices of an optimal scheduler to the given file (if supported by engine).")
             .setIsAdvanced()
-            .addArgument(
-                storm::settings::ArgumentBuilder::createStringArgument("filename", "The output file. Use file extension '.json' to export in json.").build())
+            .addArgument(storm::settings::ArgumentBuilder::createStringArgument(
+                             "filename", "The output file. Use file extension '.json' to export in json and '.csv' to export comma-separated values.")
+                             .build())
             .build());
     this->addOption(storm::settings::OptionBuilder(moduleName, exportCheckResultOptionName, false,
                                                    "Exports the result to a given file (if supported by engine). The export will be in json.")
                         .setIsAdvanced()
                         .addArgument(storm::settings::ArgumentBuilder::createStringArgument("filename", "The output file.").build())
                         .build());
+    this->addOption(storm::settings::OptionBuilder(moduleName, exportHintOptionName, false,
+                                                   "Exports the results for all states and the optimal schedulers (sparse engine only) such that they can be "
+                                                   "imported as hints in a subsequent run via --" +
+                                                       importHintOptionName + ". The export will be in json.")
+                        .setIsAdvanced()
+                        .addArgument(storm::settings::ArgumentBuilder::createStringArgument("filename", "The output file.").build())
+                        .build());
+    this->addOption(storm::settings::OptionBuilder(moduleName, importHintOptionName, false,
+                                                   "Imports hints that were exported via --" + exportHintOptionName +
+                                                       " to warm-start the solvers (sparse engine only). States are matched via their valuations, so the "
+                                                       "model should be built with state valuations (--buildstateval).")
+                        .setIsAdvanced()
+                        .addArgument(storm::settings::ArgumentBuilder::createStringArgument("filename", "The input file.").build())
+                        .build());
+    this->addOption(storm::settings::OptionBuilder(moduleName, exportTraceOptionName, false,
+                                                   "Records where time is spent and exports it as a trace in the Chrome trace event (json) format.")
+                        .setIsAdvanced()
+                        .addArgument(storm::settings::ArgumentBuilder::createStringArgument("filename", "The output file.").build())
+                        .build());
+    this->addOption(storm::settings::OptionBuilder(moduleName, exportSolverTelemetryOptionName, false,
+                                                   "Exports the residual and time of each iteration of value iteration and the number of iterations of each "
+                                                   "SCC solved by the topological solvers (as json lines).")
+                        .setIsAdvanced()
+                        .addArgument(storm::settings::ArgumentBuilder::createStringArgument("filename", "The output file.").build())
+                        .build());
+    this->addOption(storm::settings::OptionBuilder(moduleName, serverOptionName, false,
+                                                   "Builds the model once and answers property queries (JSON-RPC, one request per line) at the given "
+                                                   "port of localhost until it is shut down.")
+                        .setIsAdvanced()
+                        .addArgument(storm::settings::ArgumentBuilder::createUnsignedIntegerArgument("port", "The port to listen at.")
+                                         .addValidatorUnsignedInteger(ArgumentValidatorFactory::createUnsignedRangeValidatorIncluding(1, 65535))
+                                         .build())
+                        .build());
     this->addOption(
         storm::settings::OptionBuilder(moduleName, exportExplicitOptionName, "",
                                        "If given, the loaded model will be written to the specified file in the drn format.")
@@ -137,7 +176,7 @@ IOSettings::IOSettings() : ModuleSettings(moduleName) {
                                          .addValidatorString(ArgumentValidatorFactory::createExistingFileValidator())
                                          .build())
                         .build());
-    this->addOption(storm::settings::OptionBuilder(moduleName, explicitDrnOptionName, false, "Parses the model given in the DRN format.")
+    this->addOption(storm::settings::OptionBuilder(moduleName, explicitDrnOptionName, false, "Parses the model given in the DRN format (or its binary encoding).")
                         .setShortName(explicitDrnOptionShortName)
                         .addArgument(storm::settings::ArgumentBuilder::createStringArgument("drn filename", "The name of the DRN file containing the model.")
                                          .addValidatorString(ArgumentValidatorFactory::createExistingFileValidator())
@@ -323,6 +362,30 @@ std::string IOSettings::getExportDdFilename() const {
     return this->getOption(exportDdOptionName).getArgumentByName("filename").getValueAsString();
 }
 
+bool IOSettings::isExportTraceSet() const {
+    return this->getOption(exportTraceOptionName).getHasOptionBeenSet();
+}
+
+std::string IOSettings::getExportTraceFilename() const {
+    return this->getOption(exportTraceOptionName).getArgumentByName("filename").getValueAsString();
+}
+
+bool IOSettings::isExportSolverTelemetrySet() const {
+    return this->getOption(exportSolverTelemetryOptionName).getHasOptionBeenSet();
+}
+
+std::string IOSettings::getExportSolverTelemetryFilename() const {
+    return this->getOption(exportSolverTelemetryOptionName).getArgumentByName("filename").getValueAsString();
+}
+
+bool IOSettings::isServerSet() const {
+    return this->getOption(serverOptionName).getHasOptionBeenSet();
+}
+
+uint64_t IOSettings::getServerPort() const {
+    return this->getOption(serverOptionName).getArgumentByName("port").getValueAsUnsignedInteger();
+}
+
 bool IOSettings::isExportCdfSet() const {
     return this->getOption(exportCdfOptionName).getHasOptionBeenSet();
 }
@@ -351,6 +414,22 @@ std::string IOSettings::getExportCheckResultFilename() const {
     return this->getOption(exportCheckResultOptionName).getArgumentByName("filename").getValueAsString();
 }
 
+bool IOSettings::isExportHintSet() const {
+    return this->getOption(exportHintOptionName).getHasOptionBeenSet();
+}
+
+std::string IOSettings::getExportHintFilename() const {
+    return this->getOption(exportHintOptionName).getArgumentByName("filename").getValueAsString();
+}
+
+bool IOSettings::isImportHintSet() const {
+    return this->getOption(importHintOptionName).getHasOptionBeenSet();
+}
+
+std::string IOSettings::getImportHintFilename() const {
+    return this->getOption(importHintOptionName).getArgumentByName("filename").getValueAsString();
+}
+
 bool IOSettings::isExplicitSet() const {
     return this->getOption(explicitOptionName).getHasOptionBeenSet();
 }
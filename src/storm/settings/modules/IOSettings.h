@@ -101,6 +101,36 @@ class IOSettings : public ModuleSettings {
      */
     std::string getExportDdFilename() const;
 
+    /*!
+     * Retrieves whether a trace of the instrumented regions should be exported.
+     */
+    bool isExportTraceSet() const;
+
+    /*!
+     * Retrieves the name of the file to which the trace of the instrumented regions is exported.
+     */
+    std::string getExportTraceFilename() const;
+
+    /*!
+     * Retrieves whether the iteration-level diagnostics of iterative solvers should be exported.
+     */
+    bool isExportSolverTelemetrySet() const;
+
+    /*!
+     * Retrieves the name of the file to which the iteration-level diagnostics of iterative solvers are exported.
+     */
+    std::string getExportSolverTelemetryFilename() const;
+
+    /*!
+     * Retrieves whether the model is to be kept resident and properties are to be answered via a server.
+     */
+    bool isServerSet() const;
+
+    /*!
+     * Retrieves the port at which the server listens.
+     */
+    uint64_t getServerPort() const;
+
     /*!
      * Retrieves whether the cumulative density function for reward bounded properties should be exported
      */
@@ -131,6 +161,26 @@ class IOSettings : public ModuleSettings {
      */
     std::string getExportCheckResultFilename() const;
 
+    /*!
+     * Retrieves whether the results (and schedulers) should be exported as hints for subsequent runs.
+     */
+    bool isExportHintSet() const;
+
+    /*!
+     * Retrieves a filename to which the hints should be exported.
+     */
+    std::string getExportHintFilename() const;
+
+    /*!
+     * Retrieves whether hints from a previous run should be imported.
+     */
+    bool isImportHintSet() const;
+
+    /*!
+     * Retrieves a filename from which the hints should be imported.
+     */
+    std::string getImportHintFilename() const;
+
     /*!
      * Retrieves whether the explicit option was set.
      *
@@ -392,6 +442,11 @@ class IOSettings : public ModuleSettings {
     static const std::string exportCdfOptionShortName;
     static const std::string exportSchedulerOptionName;
     static const std::string exportCheckResultOptionName;
+    static const std::string exportHintOptionName;
+    static const std::string importHintOptionName;
+    static const std::string exportTraceOptionName;
+    static const std::string exportSolverTelemetryOptionName;
+    static const std::string serverOptionName;
     static const std::string explicitOptionName;
     static const std::string explicitOptionShortName;
     static const std::string explicitDrnOptionName;
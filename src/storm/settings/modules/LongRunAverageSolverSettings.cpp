@@ -19,6 +19,7 @@ const std::string LongRunAverageSolverSettings::maximalIterationsOptionShortName
 const std::string LongRunAverageSolverSettings::precisionOptionName = "precision";
 const std::string LongRunAverageSolverSettings::absoluteOptionName = "absolute";
 const std::string LongRunAverageSolverSettings::aperiodicFactorOptionName = "aperiodicfactor";
+const std::string LongRunAverageSolverSettings::denseBsccSizeThresholdOptionName = "densebscc";
 
 LongRunAverageSolverSettings::LongRunAverageSolverSettings() : ModuleSettings(moduleName) {
     std::vector<std::string> detLraMethods = {"gb", "gain-bias-equations", "distr", "lra-distribution-equations", "vi", "value-iteration"};
@@ -69,6 +70,15 @@ LongRunAverageSolverSettings::LongRunAverageSolverSettings() : ModuleSettings(mo
                                          .addValidatorDouble(ArgumentValidatorFactory::createDoubleRangeValidatorExcluding(0.0, 1.0))
                                          .build())
                         .build());
+
+    this->addOption(storm::settings::OptionBuilder(moduleName, denseBsccSizeThresholdOptionName, false,
+                                                   "BSCCs of deterministic models with at most this many states are solved with a dense direct solver (unless "
+                                                   "sound results are required). Larger BSCCs use the selected method.")
+                        .setIsAdvanced()
+                        .addArgument(storm::settings::ArgumentBuilder::createUnsignedIntegerArgument("size", "The maximal number of states (0 to disable).")
+                                         .setDefaultValueUnsignedInteger(0)
+                                         .build())
+                        .build());
 }
 
 storm::solver::LraMethod LongRunAverageSolverSettings::getDetLraMethod() const {
@@ -107,6 +117,10 @@ bool LongRunAverageSolverSettings::isNondetLraMethodSetFromDefaultValue() const
            this->getOption(nondetLraMethodOptionName).getArgumentByName("name").wasSetFromDefaultValue();
 }
 
+uint64_t LongRunAverageSolverSettings::getDenseBsccSizeThreshold() const {
+    return this->getOption(denseBsccSizeThresholdOptionName).getArgumentByName("size").getValueAsUnsignedInteger();
+}
+
 bool LongRunAverageSolverSettings::isMaximalIterationCountSet() const {
     return this->getOption(maximalIterationsOptionName).getHasOptionBeenSet();
 }
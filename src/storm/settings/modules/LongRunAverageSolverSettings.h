@@ -73,6 +73,11 @@ class LongRunAverageSolverSettings : public ModuleSettings {
      */
     double getAperiodicFactor() const;
 
+    /*!
+     * Retrieves the maximal size of BSCCs whose steady state distribution is computed with a dense direct solver.
+     */
+    uint64_t getDenseBsccSizeThreshold() const;
+
     // The name of the module.
     static const std::string moduleName;
 
@@ -84,6 +89,7 @@ class LongRunAverageSolverSettings : public ModuleSettings {
     static const std::string precisionOptionName;
     static const std::string absoluteOptionName;
     static const std::string aperiodicFactorOptionName;
+    static const std::string denseBsccSizeThresholdOptionName;
 };
 
 }  // namespace modules
@@ -19,12 +19,16 @@ const std::string precisionOptionName = "precision";
 const std::string absoluteOptionName = "absolute";
 const std::string valueIterationMultiplicationStyleOptionName = "vimult";
 const std::string forceUniqueSolutionRequirementOptionName = "force-require-unique";
+const std::string mixedPrecisionOptionName = "mixed-precision";
+const std::string prioritizedOptionName = "prioritized";
+const std::string autoHistoryOptionName = "auto-history";
+const std::string policyEvaluationSweepsOptionName = "pi-sweeps";
 
 MinMaxEquationSolverSettings::MinMaxEquationSolverSettings() : ModuleSettings(moduleName) {
     std::vector<std::string> minMaxSolvingTechniques = {
         "vi",     "value-iteration",    "pi",  "policy-iteration",      "lp",  "linear-programming",         "rs",          "ratsearch",
         "ii",     "interval-iteration", "svi", "sound-value-iteration", "ovi", "optimistic-value-iteration", "topological", "vi-to-pi",
-        "acyclic"};
+        "acyclic", "auto"};
     this->addOption(
         storm::settings::OptionBuilder(moduleName, solvingMethodOptionName, false, "Sets which min/max linear equation solving technique is preferred.")
             .setIsAdvanced()
@@ -69,6 +73,35 @@ MinMaxEquationSolverSettings::MinMaxEquationSolverSettings() : ModuleSettings(mo
                                                    "simplify solving but causes some overhead.")
                         .setIsAdvanced()
                         .build());
+
+    this->addOption(storm::settings::OptionBuilder(moduleName, mixedPrecisionOptionName, false,
+                                                   "If set, value iteration and interval iteration first approximate the solution in single precision. Only "
+                                                   "applies to double precision equation systems with a unique solution.")
+                        .setIsAdvanced()
+                        .build());
+
+    this->addOption(storm::settings::OptionBuilder(moduleName, prioritizedOptionName, false,
+                                                   "If set, value iteration and interval iteration update states asynchronously in the order of their residual "
+                                                   "instead of sweeping over all states in each iteration.")
+                        .setIsAdvanced()
+                        .build());
+
+    this->addOption(storm::settings::OptionBuilder(moduleName, autoHistoryOptionName, false,
+                                                   "If set, the automatic method selection ('--" + moduleName + ":" + solvingMethodOptionName +
+                                                       " auto') records the solving times in the given file and prefers the fastest method for known models.")
+                        .setIsAdvanced()
+                        .addArgument(storm::settings::ArgumentBuilder::createStringArgument("file", "The file storing the solving times.").build())
+                        .build());
+
+    this->addOption(storm::settings::OptionBuilder(moduleName, policyEvaluationSweepsOptionName, false,
+                                                   "If set, policy iteration evaluates each scheduler with the given number of value iteration sweeps "
+                                                   "instead of solving the induced equation system (modified policy iteration). Does not apply to exact "
+                                                   "computations.")
+                        .setIsAdvanced()
+                        .addArgument(storm::settings::ArgumentBuilder::createUnsignedIntegerArgument("count", "The number of sweeps per scheduler.")
+                                         .addValidatorUnsignedInteger(ArgumentValidatorFactory::createUnsignedGreaterValidator(0))
+                                         .build())
+                        .build());
 }
 
 storm::solver::MinMaxMethod MinMaxEquationSolverSettings::getMinMaxEquationSolvingMethod() const {
@@ -93,6 +126,9 @@ storm::solver::MinMaxMethod MinMaxEquationSolverSettings::getMinMaxEquationSolvi
         return storm::solver::MinMaxMethod::ViToPi;
     } else if (minMaxEquationSolvingTechnique == "acyclic") {
         return storm::solver::MinMaxMethod::Acyclic;
+    } else if (minMaxEquationSolvingTechnique == "auto") {
+        // The actual method is selected once the equation system is known. Until then, we use the default method.
+        return storm::solver::MinMaxMethod::Topological;
     }
 
     STORM_LOG_THROW(false, storm::exceptions::IllegalArgumentValueException,
@@ -104,6 +140,18 @@ bool MinMaxEquationSolverSettings::isMinMaxEquationSolvingMethodSetFromDefaultVa
            this->getOption(solvingMethodOptionName).getArgumentByName("name").wasSetFromDefaultValue();
 }
 
+bool MinMaxEquationSolverSettings::isMinMaxEquationSolvingMethodAutomatic() const {
+    return this->getOption(solvingMethodOptionName).getArgumentByName("name").getValueAsString() == "auto";
+}
+
+bool MinMaxEquationSolverSettings::isAutomaticMethodSelectionHistorySet() const {
+    return this->getOption(autoHistoryOptionName).getHasOptionBeenSet();
+}
+
+std::string MinMaxEquationSolverSettings::getAutomaticMethodSelectionHistoryFilename() const {
+    return this->getOption(autoHistoryOptionName).getArgumentByName("file").getValueAsString();
+}
+
 bool MinMaxEquationSolverSettings::isMinMaxEquationSolvingMethodSet() const {
     return this->getOption(solvingMethodOptionName).getHasOptionBeenSet();
 }
@@ -147,6 +195,22 @@ bool MinMaxEquationSolverSettings::isForceUniqueSolutionRequirementSet() const {
     return this->getOption(forceUniqueSolutionRequirementOptionName).getHasOptionBeenSet();
 }
 
+bool MinMaxEquationSolverSettings::isMixedPrecisionSet() const {
+    return this->getOption(mixedPrecisionOptionName).getHasOptionBeenSet();
+}
+
+bool MinMaxEquationSolverSettings::isPrioritizedSet() const {
+    return this->getOption(prioritizedOptionName).getHasOptionBeenSet();
+}
+
+bool MinMaxEquationSolverSettings::isPolicyEvaluationSweepsSet() const {
+    return this->getOption(policyEvaluationSweepsOptionName).getHasOptionBeenSet();
+}
+
+uint64_t MinMaxEquationSolverSettings::getPolicyEvaluationSweeps() const {
+    return this->getOption(policyEvaluationSweepsOptionName).getArgumentByName("count").getValueAsUnsignedInteger();
+}
+
 }  // namespace modules
 }  // namespace settings
 }  // namespace storm
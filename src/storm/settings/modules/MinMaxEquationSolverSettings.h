@@ -41,6 +41,21 @@ class MinMaxEquationSolverSettings : public ModuleSettings {
      */
     bool isMinMaxEquationSolvingMethodSetFromDefaultValue() const;
 
+    /*!
+     * Retrieves whether the min/max equation solving method shall be selected automatically based on the equation system.
+     */
+    bool isMinMaxEquationSolvingMethodAutomatic() const;
+
+    /*!
+     * Retrieves whether a file for recording solving times of the automatic method selection has been set.
+     */
+    bool isAutomaticMethodSelectionHistorySet() const;
+
+    /*!
+     * Retrieves the name of the file in which the automatic method selection records solving times.
+     */
+    std::string getAutomaticMethodSelectionHistoryFilename() const;
+
     /*!
      * Retrieves whether the maximal iteration count has been set.
      *
@@ -95,6 +110,26 @@ class MinMaxEquationSolverSettings : public ModuleSettings {
      */
     bool isForceUniqueSolutionRequirementSet() const;
 
+    /*!
+     * @return if value iteration and interval iteration should first approximate the solution in single precision.
+     */
+    bool isMixedPrecisionSet() const;
+
+    /*!
+     * @return if value iteration and interval iteration should update states in the order of their residual (prioritized sweeping).
+     */
+    bool isPrioritizedSet() const;
+
+    /*!
+     * @return if policy iteration should evaluate schedulers with a bounded number of sweeps (modified policy iteration).
+     */
+    bool isPolicyEvaluationSweepsSet() const;
+
+    /*!
+     * @return the number of sweeps with which policy iteration evaluates a scheduler.
+     */
+    uint64_t getPolicyEvaluationSweeps() const;
+
     // The name of the module.
     static const std::string moduleName;
 };
@@ -14,6 +14,9 @@ namespace modules {
 const std::string ModelCheckerSettings::moduleName = "modelchecker";
 const std::string ModelCheckerSettings::filterRewZeroOptionName = "filterrewzero";
 const std::string ModelCheckerSettings::ltl2daToolOptionName = "ltl2datool";
+const std::string ModelCheckerSettings::ltl2daCacheOptionName = "ltl2da-cache";
+const std::string ModelCheckerSettings::hybridSccSolvingOptionName = "hybrid-scc";
+const std::string ModelCheckerSettings::chainEliminationOptionName = "eliminate-chains";
 
 ModelCheckerSettings::ModelCheckerSettings() : ModuleSettings(moduleName) {
     this->addOption(storm::settings::OptionBuilder(moduleName, filterRewZeroOptionName, false,
@@ -27,6 +30,22 @@ ModelCheckerSettings::ModelCheckerSettings() : ModuleSettings(moduleName) {
                                          "filename", "A script that can be called with a prefix formula and a name for the output automaton.")
                                          .build())
                         .build());
+    this->addOption(storm::settings::OptionBuilder(moduleName, ltl2daCacheOptionName, false,
+                                                   "If set, deterministic automata for LTL formulas are stored in the given directory and reused for "
+                                                   "formulas that only differ in the names of their atomic propositions.")
+                        .setIsAdvanced()
+                        .addArgument(storm::settings::ArgumentBuilder::createStringArgument("directory", "An existing directory for the automata.").build())
+                        .build());
+    this->addOption(storm::settings::OptionBuilder(moduleName, hybridSccSolvingOptionName, false,
+                                                   "If set, the hybrid engine decomposes the maybe states symbolically into SCCs and converts and solves "
+                                                   "them one at a time. This reduces the peak memory consumption at the cost of more symbolic operations.")
+                        .setIsAdvanced()
+                        .build());
+    this->addOption(storm::settings::OptionBuilder(moduleName, chainEliminationOptionName, false,
+                                                   "If set, states with a single choice and a single successor (e.g. chains of states without reward and "
+                                                   "nondeterminism) are eliminated before solving the equation system for expected rewards in MDPs.")
+                        .setIsAdvanced()
+                        .build());
 }
 
 bool ModelCheckerSettings::isFilterRewZeroSet() const {
@@ -41,6 +60,22 @@ std::string ModelCheckerSettings::getLtl2daTool() const {
     return this->getOption(ltl2daToolOptionName).getArgumentByName("filename").getValueAsString();
 }
 
+bool ModelCheckerSettings::isLtl2daCacheSet() const {
+    return this->getOption(ltl2daCacheOptionName).getHasOptionBeenSet();
+}
+
+std::string ModelCheckerSettings::getLtl2daCacheDirectory() const {
+    return this->getOption(ltl2daCacheOptionName).getArgumentByName("directory").getValueAsString();
+}
+
+bool ModelCheckerSettings::isHybridSccSolvingSet() const {
+    return this->getOption(hybridSccSolvingOptionName).getHasOptionBeenSet();
+}
+
+bool ModelCheckerSettings::isChainEliminationSet() const {
+    return this->getOption(chainEliminationOptionName).getHasOptionBeenSet();
+}
+
 }  // namespace modules
 }  // namespace settings
 }  // namespace storm
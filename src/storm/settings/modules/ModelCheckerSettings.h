@@ -35,6 +35,35 @@ class ModelCheckerSettings : public ModuleSettings {
      */
     std::string getLtl2daTool() const;
 
+    /*!
+     * Retrieves whether a directory for caching deterministic automata of LTL formulas has been set.
+     *
+     * @return True iff the option was set.
+     */
+    bool isLtl2daCacheSet() const;
+
+    /*!
+     * Retrieves the directory in which deterministic automata of LTL formulas are cached.
+     *
+     * @return The cache directory.
+     */
+    std::string getLtl2daCacheDirectory() const;
+
+    /*!
+     * Retrieves whether the hybrid engine is to convert and solve the maybe states SCC by SCC.
+     *
+     * @return True iff the option was set.
+     */
+    bool isHybridSccSolvingSet() const;
+
+    /*!
+     * Retrieves whether chains of states with a single choice and a single successor are to be eliminated from the equation systems for expected
+     * rewards in MDPs.
+     *
+     * @return True iff the option was set.
+     */
+    bool isChainEliminationSet() const;
+
     // The name of the module.
     static const std::string moduleName;
 
@@ -42,6 +71,9 @@ class ModelCheckerSettings : public ModuleSettings {
     // Define the string names of the options as constants.
     static const std::string filterRewZeroOptionName;
     static const std::string ltl2daToolOptionName;
+    static const std::string ltl2daCacheOptionName;
+    static const std::string hybridSccSolvingOptionName;
+    static const std::string chainEliminationOptionName;
 };
 
 }  // namespace modules
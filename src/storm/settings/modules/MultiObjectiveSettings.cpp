@@ -15,6 +15,7 @@ const std::string MultiObjectiveSettings::methodOptionName = "method";
 const std::string MultiObjectiveSettings::exportPlotOptionName = "exportplot";
 const std::string MultiObjectiveSettings::precisionOptionName = "precision";
 const std::string MultiObjectiveSettings::maxStepsOptionName = "maxsteps";
+const std::string MultiObjectiveSettings::weightVectorBatchSizeOptionName = "weightbatch";
 const std::string MultiObjectiveSettings::schedulerRestrictionOptionName = "purescheds";
 const std::string MultiObjectiveSettings::printResultsOptionName = "printres";
 const std::string MultiObjectiveSettings::encodingOptionName = "encoding";
@@ -56,6 +57,14 @@ MultiObjectiveSettings::MultiObjectiveSettings() : ModuleSettings(moduleName) {
                                          "value", "the threshold for the number of refinement steps to be performed.")
                                          .build())
                         .build());
+    this->addOption(storm::settings::OptionBuilder(moduleName, weightVectorBatchSizeOptionName, true,
+                                                   "Sets the number of weight vectors that are checked concurrently when approximating Pareto curves.")
+                        .setIsAdvanced()
+                        .addArgument(storm::settings::ArgumentBuilder::createUnsignedIntegerArgument("value", "The number of weight vectors.")
+                                         .setDefaultValueUnsignedInteger(1)
+                                         .addValidatorUnsignedInteger(ArgumentValidatorFactory::createUnsignedGreaterValidator(0))
+                                         .build())
+                        .build());
     std::vector<std::string> memoryPatterns = {"positional", "goalmemory", "arbitrary", "counter"};
     this->addOption(
         storm::settings::OptionBuilder(moduleName, schedulerRestrictionOptionName, false,
@@ -145,6 +154,10 @@ uint_fast64_t MultiObjectiveSettings::getMaxSteps() const {
     return this->getOption(maxStepsOptionName).getArgumentByName("value").getValueAsUnsignedInteger();
 }
 
+uint64_t MultiObjectiveSettings::getWeightVectorBatchSize() const {
+    return this->getOption(weightVectorBatchSizeOptionName).getArgumentByName("value").getValueAsUnsignedInteger();
+}
+
 bool MultiObjectiveSettings::hasSchedulerRestriction() const {
     return this->getOption(schedulerRestrictionOptionName).getHasOptionBeenSet();
 }
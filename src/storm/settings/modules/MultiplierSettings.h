@@ -21,11 +21,17 @@ class MultiplierSettings : public ModuleSettings {
 
     bool isMultiplierTypeSetFromDefaultValue() const;
 
+    /*!
+     * Retrieves whether the native multiplier shall use a compact matrix representation (32 bit columns and a value dictionary).
+     */
+    bool isCompactMatrixSet() const;
+
     // The name of the module.
     static const std::string moduleName;
 
    private:
     static const std::string multiplierTypeOptionName;
+    static const std::string compactMatrixOptionName;
 };
 
 }  // namespace modules
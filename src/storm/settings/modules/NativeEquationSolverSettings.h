@@ -105,6 +105,11 @@ class NativeEquationSolverSettings : public ModuleSettings {
      */
     storm::solver::MultiplicationStyle getPowerMethodMultiplicationStyle() const;
 
+    /*!
+     * Retrieves whether the power method and interval iteration should first approximate the solution in single precision.
+     */
+    bool isMixedPrecisionSet() const;
+
     /*!
      * Retrieves whether the  force bounds option has been set.
      */
@@ -126,6 +131,7 @@ class NativeEquationSolverSettings : public ModuleSettings {
     static const std::string intervalIterationSymmetricUpdatesOptionName;
     static const std::string powerMethodMultiplicationStyleOptionName;
     static const std::string forceBoundsOptionName;
+    static const std::string mixedPrecisionOptionName;
 };
 
 }  // namespace modules
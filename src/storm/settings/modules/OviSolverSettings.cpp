@@ -10,6 +10,7 @@ namespace modules {
 
 const std::string OviSolverSettings::moduleName = "ovi";
 const std::string OviSolverSettings::upperBoundGuessingFactorOptionName = "upper-bound-factor";
+const std::string OviSolverSettings::pipelinedOptionName = "pipelined";
 
 OviSolverSettings::OviSolverSettings() : ModuleSettings(moduleName) {
     this->addOption(storm::settings::OptionBuilder(moduleName, upperBoundGuessingFactorOptionName, false, "Sets how optimistic the upper bound is guessed.")
@@ -19,6 +20,10 @@ OviSolverSettings::OviSolverSettings() : ModuleSettings(moduleName) {
                                          .addValidatorDouble(ArgumentValidatorFactory::createDoubleGreaterValidator(0.0))
                                          .build())
                         .build());
+    this->addOption(storm::settings::OptionBuilder(moduleName, pipelinedOptionName, false,
+                                                   "If set, guessed upper bounds are verified on a separate thread while value iteration continues.")
+                        .setIsAdvanced()
+                        .build());
 }
 
 bool OviSolverSettings::hasUpperBoundGuessingFactorBeenSet() const {
@@ -29,6 +34,10 @@ double OviSolverSettings::getUpperBoundGuessingFactor() const {
     return this->getOption(upperBoundGuessingFactorOptionName).getArgumentByName("factor").getValueAsDouble();
 }
 
+bool OviSolverSettings::isPipelinedSet() const {
+    return this->getOption(pipelinedOptionName).getHasOptionBeenSet();
+}
+
 }  // namespace modules
 }  // namespace settings
 }  // namespace storm
@@ -24,11 +24,17 @@ class OviSolverSettings : public ModuleSettings {
      */
     double getUpperBoundGuessingFactor() const;
 
+    /*!
+     * @return true if the verification of guessed upper bounds shall run concurrently to the value iteration on the lower bounds
+     */
+    bool isPipelinedSet() const;
+
     // The name of the module.
     static const std::string moduleName;
 
    private:
     static const std::string upperBoundGuessingFactorOptionName;
+    static const std::string pipelinedOptionName;
 };
 
 }  // namespace modules
@@ -16,6 +16,9 @@ const std::string ResourceSettings::timeoutOptionShortName = "t";
 const std::string ResourceSettings::printTimeAndMemoryOptionName = "timemem";
 const std::string ResourceSettings::printTimeAndMemoryOptionShortName = "tm";
 const std::string ResourceSettings::signalWaitingTimeOptionName = "signal-timeout";
+const std::string ResourceSettings::threadsOptionName = "threads";
+const std::string ResourceSettings::pinThreadsOptionName = "pin-threads";
+const std::string ResourceSettings::startupProfileOptionName = "startup-profile";
 
 ResourceSettings::ResourceSettings() : ModuleSettings(moduleName) {
     this->addOption(storm::settings::OptionBuilder(moduleName, timeoutOptionName, false, "If given, computation will abort after the timeout has been reached.")
@@ -35,6 +38,22 @@ ResourceSettings::ResourceSettings() : ModuleSettings(moduleName) {
                                          .setDefaultValueUnsignedInteger(3)
                                          .build())
                         .build());
+    this->addOption(storm::settings::OptionBuilder(moduleName, threadsOptionName, false,
+                                                   "Sets the number of threads shared by all parallel computations (including Sylvan and bisimulation).")
+                        .setIsAdvanced()
+                        .addArgument(storm::settings::ArgumentBuilder::createUnsignedIntegerArgument(
+                                         "count", "The number of threads. A value of 0 uses as many threads as there are hardware threads.")
+                                         .setDefaultValueUnsignedInteger(0)
+                                         .build())
+                        .build());
+    this->addOption(
+        storm::settings::OptionBuilder(moduleName, pinThreadsOptionName, false, "If set, worker threads are pinned to distinct CPUs (Linux only).")
+            .setIsAdvanced()
+            .build());
+    this->addOption(storm::settings::OptionBuilder(moduleName, startupProfileOptionName, false,
+                                                   "Prints the time spent in the phases of the startup (registering and parsing the settings).")
+                        .setIsAdvanced()
+                        .build());
 }
 
 bool ResourceSettings::isTimeoutSet() const {
@@ -53,6 +72,22 @@ uint_fast64_t ResourceSettings::getSignalWaitingTimeInSeconds() const {
     return this->getOption(signalWaitingTimeOptionName).getArgumentByName("time").getValueAsUnsignedInteger();
 }
 
+bool ResourceSettings::isNumberOfThreadsSet() const {
+    return this->getOption(threadsOptionName).getHasOptionBeenSet();
+}
+
+uint_fast64_t ResourceSettings::getNumberOfThreads() const {
+    return this->getOption(threadsOptionName).getArgumentByName("count").getValueAsUnsignedInteger();
+}
+
+bool ResourceSettings::isPinThreadsSet() const {
+    return this->getOption(pinThreadsOptionName).getHasOptionBeenSet();
+}
+
+bool ResourceSettings::isStartupProfileSet() const {
+    return this->getOption(startupProfileOptionName).getHasOptionBeenSet();
+}
+
 }  // namespace modules
 }  // namespace settings
 }  // namespace storm
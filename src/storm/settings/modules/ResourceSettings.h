@@ -24,6 +24,13 @@ class ResourceSettings : public ModuleSettings {
      */
     bool isPrintTimeAndMemorySet() const;
 
+    /*!
+     * Retrieves whether the time spent in the phases of the startup (e.g., registering the settings) shall be printed.
+     *
+     * @return True iff the option was set.
+     */
+    bool isStartupProfileSet() const;
+
     /*!
      * Retrieves whether the timeout option was set.
      *
@@ -47,6 +54,27 @@ class ResourceSettings : public ModuleSettings {
      */
     uint_fast64_t getSignalWaitingTimeInSeconds() const;
 
+    /*!
+     * Retrieves whether the number of threads was set.
+     *
+     * @return True iff the option was set.
+     */
+    bool isNumberOfThreadsSet() const;
+
+    /*!
+     * Retrieves the number of threads shared by all parallel computations (0 means automatic detection).
+     *
+     * @return The number of threads.
+     */
+    uint_fast64_t getNumberOfThreads() const;
+
+    /*!
+     * Retrieves whether worker threads are to be pinned to CPUs.
+     *
+     * @return True iff the option was set.
+     */
+    bool isPinThreadsSet() const;
+
     // The name of the module.
     static const std::string moduleName;
 
@@ -57,6 +85,9 @@ class ResourceSettings : public ModuleSettings {
     static const std::string printTimeAndMemoryOptionName;
     static const std::string printTimeAndMemoryOptionShortName;
     static const std::string signalWaitingTimeOptionName;
+    static const std::string threadsOptionName;
+    static const std::string pinThreadsOptionName;
+    static const std::string startupProfileOptionName;
 };
 }  // namespace modules
 }  // namespace settings
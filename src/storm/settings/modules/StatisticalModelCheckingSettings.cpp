@@ -0,0 +1,119 @@
+#include "storm/settings/modules/StatisticalModelCheckingSettings.h"
+#include "storm/settings/Argument.h"
+#include "storm/settings/ArgumentBuilder.h"
+#include "storm/settings/Option.h"
+#include "storm/settings/OptionBuilder.h"
+#include "storm/settings/SettingsManager.h"
+#include "storm/settings/modules/CoreSettings.h"
+
+#include "storm/utility/Engine.h"
+#include "storm/utility/macros.h"
+#include "storm/utility/threads.h"
+
+namespace storm {
+namespace settings {
+namespace modules {
+
+const std::string StatisticalModelCheckingSettings::moduleName = "smc";
+const std::string StatisticalModelCheckingSettings::precisionOptionName = "precision";
+const std::string StatisticalModelCheckingSettings::confidenceOptionName = "confidence";
+const std::string StatisticalModelCheckingSettings::indifferenceOptionName = "indifference";
+const std::string StatisticalModelCheckingSettings::seedOptionName = "seed";
+const std::string StatisticalModelCheckingSettings::threadsOptionName = "threads";
+const std::string StatisticalModelCheckingSettings::batchSizeOptionName = "batchsize";
+const std::string StatisticalModelCheckingSettings::maxPathsOptionName = "maxpaths";
+
+StatisticalModelCheckingSettings::StatisticalModelCheckingSettings() : ModuleSettings(moduleName) {
+    this->addOption(storm::settings::OptionBuilder(moduleName, precisionOptionName, true, "The half-width of the confidence intervals of estimated values.")
+                        .addArgument(storm::settings::ArgumentBuilder::createDoubleArgument("value", "The half-width.")
+                                         .setDefaultValueDouble(1e-02)
+                                         .addValidatorDouble(ArgumentValidatorFactory::createDoubleGreaterValidator(0.0))
+                                         .build())
+                        .build());
+    this->addOption(storm::settings::OptionBuilder(moduleName, confidenceOptionName, true,
+                                                   "The confidence level of the confidence intervals and of the hypothesis tests.")
+                        .addArgument(storm::settings::ArgumentBuilder::createDoubleArgument("value", "The confidence level.")
+                                         .setDefaultValueDouble(0.95)
+                                         .addValidatorDouble(ArgumentValidatorFactory::createDoubleRangeValidatorExcluding(0.0, 1.0))
+                                         .build())
+                        .build());
+    this->addOption(storm::settings::OptionBuilder(moduleName, indifferenceOptionName, true,
+                                                   "The half-width of the indifference region around the probability bound for hypothesis tests.")
+                        .setIsAdvanced()
+                        .addArgument(storm::settings::ArgumentBuilder::createDoubleArgument("value", "The half-width.")
+                                         .setDefaultValueDouble(1e-02)
+                                         .addValidatorDouble(ArgumentValidatorFactory::createDoubleRangeValidatorExcluding(0.0, 0.5))
+                                         .build())
+                        .build());
+    this->addOption(storm::settings::OptionBuilder(moduleName, seedOptionName, true, "The seed for the random number generators.")
+                        .setIsAdvanced()
+                        .addArgument(storm::settings::ArgumentBuilder::createUnsignedIntegerArgument("value", "The seed.")
+                                         .setDefaultValueUnsignedInteger(5489)
+                                         .build())
+                        .build());
+    this->addOption(storm::settings::OptionBuilder(moduleName, threadsOptionName, true, "Sets the number of threads that simulate paths.")
+                        .addArgument(storm::settings::ArgumentBuilder::createUnsignedIntegerArgument(
+                                         "count", "The number of threads. A value of 0 uses as many threads as Storm may use.")
+                                         .setDefaultValueUnsignedInteger(0)
+                                         .build())
+                        .build());
+    this->addOption(storm::settings::OptionBuilder(moduleName, batchSizeOptionName, true, "Sets the number of paths that a thread simulates in one batch.")
+                        .setIsAdvanced()
+                        .addArgument(storm::settings::ArgumentBuilder::createUnsignedIntegerArgument("count", "The number of paths.")
+                                         .setDefaultValueUnsignedInteger(1000)
+                                         .addValidatorUnsignedInteger(ArgumentValidatorFactory::createUnsignedGreaterValidator(0))
+                                         .build())
+                        .build());
+    this->addOption(storm::settings::OptionBuilder(moduleName, maxPathsOptionName, true, "Sets the maximal number of paths simulated for one property.")
+                        .setIsAdvanced()
+                        .addArgument(storm::settings::ArgumentBuilder::createUnsignedIntegerArgument("count", "The number of paths.")
+                                         .setDefaultValueUnsignedInteger(100000000)
+                                         .addValidatorUnsignedInteger(ArgumentValidatorFactory::createUnsignedGreaterValidator(0))
+                                         .build())
+                        .build());
+}
+
+double StatisticalModelCheckingSettings::getPrecision() const {
+    return this->getOption(precisionOptionName).getArgumentByName("value").getValueAsDouble();
+}
+
+double StatisticalModelCheckingSettings::getConfidence() const {
+    return this->getOption(confidenceOptionName).getArgumentByName("value").getValueAsDouble();
+}
+
+double StatisticalModelCheckingSettings::getIndifference() const {
+    return this->getOption(indifferenceOptionName).getArgumentByName("value").getValueAsDouble();
+}
+
+uint64_t StatisticalModelCheckingSettings::getSeed() const {
+    return this->getOption(seedOptionName).getArgumentByName("value").getValueAsUnsignedInteger();
+}
+
+uint64_t StatisticalModelCheckingSettings::getNumberOfThreads() const {
+    uint64_t numberOfThreads = this->getOption(threadsOptionName).getArgumentByName("count").getValueAsUnsignedInteger();
+    if (numberOfThreads == 0) {
+        numberOfThreads = std::max(1u, storm::utility::getNumberOfThreads());
+    }
+    return numberOfThreads;
+}
+
+uint64_t StatisticalModelCheckingSettings::getBatchSize() const {
+    return this->getOption(batchSizeOptionName).getArgumentByName("count").getValueAsUnsignedInteger();
+}
+
+uint64_t StatisticalModelCheckingSettings::getMaximalNumberOfPaths() const {
+    return this->getOption(maxPathsOptionName).getArgumentByName("count").getValueAsUnsignedInteger();
+}
+
+bool StatisticalModelCheckingSettings::check() const {
+    bool optionsSet = this->getOption(precisionOptionName).getHasOptionBeenSet() || this->getOption(confidenceOptionName).getHasOptionBeenSet() ||
+                      this->getOption(indifferenceOptionName).getHasOptionBeenSet() || this->getOption(seedOptionName).getHasOptionBeenSet() ||
+                      this->getOption(threadsOptionName).getHasOptionBeenSet() || this->getOption(batchSizeOptionName).getHasOptionBeenSet() ||
+                      this->getOption(maxPathsOptionName).getHasOptionBeenSet();
+    STORM_LOG_WARN_COND(storm::settings::getModule<storm::settings::modules::CoreSettings>().getEngine() == storm::utility::Engine::Statistical || !optionsSet,
+                        "Statistical model checking engine is not selected, so setting options for it has no effect.");
+    return true;
+}
+}  // namespace modules
+}  // namespace settings
+}  // namespace storm
@@ -0,0 +1,85 @@
+#pragma once
+
+#include "storm/settings/modules/ModuleSettings.h"
+
+namespace storm {
+namespace settings {
+namespace modules {
+
+/*!
+ * This class represents the settings of the statistical model checking engine.
+ */
+class StatisticalModelCheckingSettings : public ModuleSettings {
+   public:
+    /*!
+     * Creates a new set of statistical model checking settings.
+     */
+    StatisticalModelCheckingSettings();
+
+    /*!
+     * Retrieves the half-width of the confidence intervals of the estimated values.
+     *
+     * @return The half-width of the confidence intervals.
+     */
+    double getPrecision() const;
+
+    /*!
+     * Retrieves the confidence level of the confidence intervals and the hypothesis tests.
+     *
+     * @return The confidence level.
+     */
+    double getConfidence() const;
+
+    /*!
+     * Retrieves the half-width of the indifference region of the sequential probability ratio test.
+     *
+     * @return The half-width of the indifference region.
+     */
+    double getIndifference() const;
+
+    /*!
+     * Retrieves the seed for the random number generators.
+     *
+     * @return The seed.
+     */
+    uint64_t getSeed() const;
+
+    /*!
+     * Retrieves the number of threads that simulate paths.
+     *
+     * @return The number of threads.
+     */
+    uint64_t getNumberOfThreads() const;
+
+    /*!
+     * Retrieves the number of paths that are simulated in one batch.
+     *
+     * @return The number of paths in one batch.
+     */
+    uint64_t getBatchSize() const;
+
+    /*!
+     * Retrieves the maximal number of paths that are simulated for one property.
+     *
+     * @return The maximal number of paths.
+     */
+    uint64_t getMaximalNumberOfPaths() const;
+
+    virtual bool check() const override;
+
+    // The name of the module.
+    static const std::string moduleName;
+
+   private:
+    // Define the string names of the options as constants.
+    static const std::string precisionOptionName;
+    static const std::string confidenceOptionName;
+    static const std::string indifferenceOptionName;
+    static const std::string seedOptionName;
+    static const std::string threadsOptionName;
+    static const std::string batchSizeOptionName;
+    static const std::string maxPathsOptionName;
+};
+}  // namespace modules
+}  // namespace settings
+}  // namespace storm
@@ -15,6 +15,9 @@ namespace modules {
 const std::string SylvanSettings::moduleName = "sylvan";
 const std::string SylvanSettings::maximalMemoryOptionName = "maxmem";
 const std::string SylvanSettings::threadCountOptionName = "threads";
+const std::string SylvanSettings::parallelConversionOptionName = "parallel-conversion";
+const std::string SylvanSettings::tableRatioOptionName = "table-ratio";
+const std::string SylvanSettings::initialRatioOptionName = "initial-ratio";
 
 SylvanSettings::SylvanSettings() : ModuleSettings(moduleName) {
     this->addOption(storm::settings::OptionBuilder(moduleName, maximalMemoryOptionName, true, "Sets the upper bound of memory available to Sylvan in MB.")
@@ -29,6 +32,28 @@ SylvanSettings::SylvanSettings() : ModuleSettings(moduleName) {
                                          "value", "The number of threads available to Sylvan (0 means 'auto-detect').")
                                          .build())
                         .build());
+    this->addOption(storm::settings::OptionBuilder(moduleName, parallelConversionOptionName, true,
+                                                   "If set, conversions of DDs to explicit matrices and vectors distribute the rows over all Sylvan threads.")
+                        .setIsAdvanced()
+                        .build());
+    this->addOption(storm::settings::OptionBuilder(moduleName, tableRatioOptionName, true,
+                                                   "Sets the ratio between the sizes of the node table and the operation cache of Sylvan.")
+                        .setIsAdvanced()
+                        .addArgument(storm::settings::ArgumentBuilder::createIntegerArgument(
+                                         "value", "The ratio as power of two (e.g. 1 means the node table is twice as large, -1 means the cache is).")
+                                         .setDefaultValueInteger(0)
+                                         .addValidatorInteger(ArgumentValidatorFactory::createIntegerRangeValidatorExcluding(-16, 16))
+                                         .build())
+                        .build());
+    this->addOption(storm::settings::OptionBuilder(moduleName, initialRatioOptionName, true,
+                                                   "Sets how much smaller the initial node table and operation cache of Sylvan are than their maximum.")
+                        .setIsAdvanced()
+                        .addArgument(storm::settings::ArgumentBuilder::createIntegerArgument(
+                                         "value", "The ratio as power of two (e.g. 2 means that the tables initially have a quarter of their maximal size).")
+                                         .setDefaultValueInteger(0)
+                                         .addValidatorInteger(ArgumentValidatorFactory::createIntegerRangeValidatorExcluding(-1, 32))
+                                         .build())
+                        .build());
 }
 
 uint_fast64_t SylvanSettings::getMaximalMemory() const {
@@ -39,6 +64,18 @@ bool SylvanSettings::isNumberOfThreadsSet() const {
     return this->getOption(threadCountOptionName).getArgumentByName("value").getHasBeenSet();
 }
 
+bool SylvanSettings::isParallelConversionSet() const {
+    return this->getOption(parallelConversionOptionName).getHasOptionBeenSet();
+}
+
+int_fast64_t SylvanSettings::getTableRatio() const {
+    return this->getOption(tableRatioOptionName).getArgumentByName("value").getValueAsInteger();
+}
+
+int_fast64_t SylvanSettings::getInitialRatio() const {
+    return this->getOption(initialRatioOptionName).getArgumentByName("value").getValueAsInteger();
+}
+
 uint_fast64_t SylvanSettings::getNumberOfThreads() const {
     if (isNumberOfThreadsSet()) {
         auto numberFromSettings = this->getOption(threadCountOptionName).getArgumentByName("value").getValueAsUnsignedInteger();
@@ -37,6 +37,29 @@ class SylvanSettings : public ModuleSettings {
      */
     bool isNumberOfThreadsSet() const;
 
+    /*!
+     * Retrieves whether the conversion of DDs to explicit matrices and vectors is to be performed by all Sylvan threads.
+     *
+     * @return True iff the option was set.
+     */
+    bool isParallelConversionSet() const;
+
+    /*!
+     * Retrieves the (log2) ratio between the sizes of Sylvan's node table and its operation cache. For positive
+     * values, the node table is larger, for negative values the cache is larger.
+     *
+     * @return The table ratio.
+     */
+    int_fast64_t getTableRatio() const;
+
+    /*!
+     * Retrieves the (log2) factor by which the initial sizes of Sylvan's node table and operation cache are smaller
+     * than their maximal sizes. This controls how often the tables are grown.
+     *
+     * @return The initial ratio.
+     */
+    int_fast64_t getInitialRatio() const;
+
     bool check() const override;
 
     // The name of the module.
@@ -46,6 +69,9 @@ class SylvanSettings : public ModuleSettings {
     // Define the string names of the options as constants.
     static const std::string maximalMemoryOptionName;
     static const std::string threadCountOptionName;
+    static const std::string parallelConversionOptionName;
+    static const std::string tableRatioOptionName;
+    static const std::string initialRatioOptionName;
 };
 
 }  // namespace modules
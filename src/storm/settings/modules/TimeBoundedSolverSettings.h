@@ -26,6 +26,11 @@ class TimeBoundedSolverSettings : public ModuleSettings {
      */
     storm::solver::MaBoundedReachabilityMethod getMaMethod() const;
 
+    /*!
+     * Retrieves the selected technique for computing transient probabilities on CTMCs.
+     */
+    storm::solver::CtmcTransientMethod getCtmcMethod() const;
+
     /*!
      * Retrieves whether the precision has been set.
      *
@@ -55,6 +60,7 @@ class TimeBoundedSolverSettings : public ModuleSettings {
 
    private:
     static const std::string maMethodOptionName;
+    static const std::string ctmcMethodOptionName;
     static const std::string precisionOptionName;
     static const std::string absoluteOptionName;
     static const std::string unifPlusKappaOptionName;
@@ -23,6 +23,8 @@ namespace modules {
 const std::string TopologicalEquationSolverSettings::moduleName = "topological";
 const std::string TopologicalEquationSolverSettings::underlyingEquationSolverOptionName = "eqsolver";
 const std::string TopologicalEquationSolverSettings::underlyingMinMaxMethodOptionName = "minmax";
+const std::string TopologicalEquationSolverSettings::directSolveSccSizeOptionName = "directscc";
+const std::string TopologicalEquationSolverSettings::denseSolveSccSizeOptionName = "densescc";
 
 TopologicalEquationSolverSettings::TopologicalEquationSolverSettings() : ModuleSettings(moduleName) {
     std::vector<std::string> linearEquationSolver = {"gmm++", "native", "eigen", "elimination"};
@@ -45,6 +47,20 @@ TopologicalEquationSolverSettings::TopologicalEquationSolverSettings() : ModuleS
                                          .setDefaultValueString("value-iteration")
                                          .build())
                         .build());
+    this->addOption(storm::settings::OptionBuilder(moduleName, directSolveSccSizeOptionName, true,
+                                                   "If set, SCCs within the given size range are solved with a sparse LU factorization.")
+                        .setIsAdvanced()
+                        .addArgument(storm::settings::ArgumentBuilder::createUnsignedIntegerArgument("min", "The minimal number of states of the SCC.").build())
+                        .addArgument(storm::settings::ArgumentBuilder::createUnsignedIntegerArgument("max", "The maximal number of states of the SCC.").build())
+                        .build());
+    this->addOption(storm::settings::OptionBuilder(moduleName, denseSolveSccSizeOptionName, true,
+                                                   "SCCs with at most the given number of states are solved with dense Gaussian elimination.")
+                        .setIsAdvanced()
+                        .addArgument(storm::settings::ArgumentBuilder::createUnsignedIntegerArgument("max", "The maximal number of states. 0 disables this.")
+                                         .addValidatorUnsignedInteger(ArgumentValidatorFactory::createUnsignedRangeValidatorIncluding(0, 64))
+                                         .setDefaultValueUnsignedInteger(64)
+                                         .build())
+                        .build());
 }
 
 bool TopologicalEquationSolverSettings::isUnderlyingEquationSolverTypeSet() const {
@@ -102,6 +118,19 @@ storm::solver::MinMaxMethod TopologicalEquationSolverSettings::getUnderlyingMinM
     STORM_LOG_THROW(false, storm::exceptions::IllegalArgumentValueException, "Unknown underlying equation solver '" << minMaxEquationSolvingTechnique << "'.");
 }
 
+bool TopologicalEquationSolverSettings::isDirectSolveSccSizeRangeSet() const {
+    return this->getOption(directSolveSccSizeOptionName).getHasOptionBeenSet();
+}
+
+std::pair<uint64_t, uint64_t> TopologicalEquationSolverSettings::getDirectSolveSccSizeRange() const {
+    auto const& option = this->getOption(directSolveSccSizeOptionName);
+    return {option.getArgumentByName("min").getValueAsUnsignedInteger(), option.getArgumentByName("max").getValueAsUnsignedInteger()};
+}
+
+uint64_t TopologicalEquationSolverSettings::getDenseSolveMaxSccSize() const {
+    return this->getOption(denseSolveSccSizeOptionName).getArgumentByName("max").getValueAsUnsignedInteger();
+}
+
 bool TopologicalEquationSolverSettings::check() const {
     if (this->isUnderlyingEquationSolverTypeSet() && getUnderlyingEquationSolverType() == storm::solver::EquationSolverType::Topological) {
         STORM_LOG_WARN("Underlying solver type of the topological solver can not be the topological solver.");
@@ -111,6 +140,10 @@ bool TopologicalEquationSolverSettings::check() const {
         STORM_LOG_WARN("Underlying minmax method of the topological solver can not be topological.");
         return false;
     }
+    if (this->isDirectSolveSccSizeRangeSet() && getDirectSolveSccSizeRange().first > getDirectSolveSccSizeRange().second) {
+        STORM_LOG_WARN("The minimal size of SCCs that are solved directly exceeds the maximal size.");
+        return false;
+    }
     return true;
 }
 
@@ -60,6 +60,27 @@ class TopologicalEquationSolverSettings : public ModuleSettings {
      */
     storm::solver::MinMaxMethod getUnderlyingMinMaxMethod() const;
 
+    /*!
+     * Retrieves whether a range of SCC sizes has been set for which a direct solver is to be used.
+     *
+     * @return True iff the range has been set.
+     */
+    bool isDirectSolveSccSizeRangeSet() const;
+
+    /*!
+     * Retrieves the minimal and maximal size of SCCs that are to be solved with a direct solver (sparse LU factorization) instead of the underlying solver.
+     *
+     * @return The (inclusive) range of SCC sizes.
+     */
+    std::pair<uint64_t, uint64_t> getDirectSolveSccSizeRange() const;
+
+    /*!
+     * Retrieves the maximal size of SCCs that are solved with dense Gaussian elimination instead of the underlying solver.
+     *
+     * @return The maximal SCC size. Zero if dense Gaussian elimination is disabled.
+     */
+    uint64_t getDenseSolveMaxSccSize() const;
+
     bool check() const override;
 
     // The name of the module.
@@ -69,6 +90,8 @@ class TopologicalEquationSolverSettings : public ModuleSettings {
     // Define the string names of the options as constants.
     static const std::string underlyingEquationSolverOptionName;
     static const std::string underlyingMinMaxMethodOptionName;
+    static const std::string directSolveSccSizeOptionName;
+    static const std::string denseSolveSccSizeOptionName;
 };
 
 }  // namespace modules
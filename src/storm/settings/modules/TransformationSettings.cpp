@@ -16,6 +16,7 @@ const std::string TransformationSettings::chainEliminationOptionName = "eliminat
 const std::string TransformationSettings::labelBehaviorOptionName = "ec-label-behavior";
 const std::string TransformationSettings::toNondetOptionName = "to-nondet";
 const std::string TransformationSettings::toDiscreteTimeOptionName = "to-discrete";
+const std::string TransformationSettings::reorderStatesOptionName = "reorder-states";
 
 TransformationSettings::TransformationSettings() : ModuleSettings(moduleName) {
     this->addOption(storm::settings::OptionBuilder(moduleName, chainEliminationOptionName, false,
@@ -46,6 +47,22 @@ TransformationSettings::TransformationSettings() : ModuleSettings(moduleName) {
                                                    "If set, CTMCs/MAs are converted to DTMCs/MDPs (which might or might not preserve the provided properties).")
                         .setIsAdvanced()
                         .build());
+    std::vector<std::string> stateOrders;
+    for (auto const& order : storm::utility::permutation::getOrderKinds()) {
+        stateOrders.push_back(storm::utility::permutation::orderKindToString(order));
+    }
+    this->addOption(
+        storm::settings::OptionBuilder(moduleName, reorderStatesOptionName, false,
+                                       "If set, the states of sparse models are reordered before model checking to improve the memory locality of solvers.")
+            .setIsAdvanced()
+            .addArgument(storm::settings::ArgumentBuilder::createStringArgument(
+                             "order",
+                             "The order of the states. 'rcm' is the reverse Cuthill-McKee order, 'scc' arranges the states in topologically sorted SCCs, "
+                             "'bfs' is a breadth first order that places likely successors next to each other.")
+                             .setDefaultValueString("rcm")
+                             .addValidatorString(ArgumentValidatorFactory::createMultipleChoiceValidator(stateOrders))
+                             .build())
+            .build());
 }
 
 bool TransformationSettings::isChainEliminationSet() const {
@@ -73,6 +90,20 @@ bool TransformationSettings::isToDiscreteTimeModelSet() const {
     return this->getOption(toDiscreteTimeOptionName).getHasOptionBeenSet();
 }
 
+bool TransformationSettings::isReorderStatesSet() const {
+    return this->getOption(reorderStatesOptionName).getHasOptionBeenSet();
+}
+
+storm::utility::permutation::OrderKind TransformationSettings::getStateOrder() const {
+    std::string orderAsString = this->getOption(reorderStatesOptionName).getArgumentByName("order").getValueAsString();
+    for (auto const& order : storm::utility::permutation::getOrderKinds()) {
+        if (storm::utility::permutation::orderKindToString(order) == orderAsString) {
+            return order;
+        }
+    }
+    STORM_LOG_THROW(false, storm::exceptions::IllegalArgumentValueException, "Illegal value '" << orderAsString << "' set as state order.");
+}
+
 bool TransformationSettings::check() const {
     // Ensure that labeling preservation is only set if chain elimination is set
     STORM_LOG_THROW(isChainEliminationSet() || !this->getOption(labelBehaviorOptionName).getHasOptionBeenSet(), storm::exceptions::InvalidSettingsException,
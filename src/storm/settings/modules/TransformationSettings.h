@@ -4,6 +4,7 @@
 #include "storm-config.h"
 #include "storm/api/transformation.h"
 #include "storm/settings/modules/ModuleSettings.h"
+#include "storm/utility/permutation.h"
 
 namespace storm {
 namespace settings {
@@ -43,6 +44,16 @@ class TransformationSettings : public ModuleSettings {
      */
     bool isToDiscreteTimeModelSet() const;
 
+    /*!
+     * Retrieves whether the states of the model shall be reordered before model checking.
+     */
+    bool isReorderStatesSet() const;
+
+    /*!
+     * Retrieves the order in which the states shall be arranged.
+     */
+    storm::utility::permutation::OrderKind getStateOrder() const;
+
     bool check() const override;
 
     void finalize() override;
@@ -56,6 +67,7 @@ class TransformationSettings : public ModuleSettings {
     static const std::string labelBehaviorOptionName;
     static const std::string toNondetOptionName;
     static const std::string toDiscreteTimeOptionName;
+    static const std::string reorderStatesOptionName;
 };
 
 }  // namespace modules
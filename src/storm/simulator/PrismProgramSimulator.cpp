@@ -1,7 +1,11 @@
 #include "storm/simulator/PrismProgramSimulator.h"
+
+#include <numeric>
+
 #include "storm/adapters/JsonAdapter.h"
 #include "storm/exceptions/NotSupportedException.h"
 #include "storm/storage/expressions/ExpressionEvaluator.h"
+#include "storm/utility/constants.h"
 
 using namespace storm::generator;
 
@@ -15,11 +19,15 @@ DiscreteTimePrismProgramSimulator<ValueType>::DiscreteTimePrismProgramSimulator(
       currentState(),
       stateGenerator(std::make_shared<storm::generator::PrismNextStateGenerator<ValueType, uint32_t>>(program, options)),
       zeroRewards(stateGenerator->getNumberOfRewardModels(), storm::utility::zero<ValueType>()),
-      lastActionRewards(zeroRewards) {
+      lastActionRewards(zeroRewards),
+      stateCacheSize(100000) {
     // Current state needs to be overwritten to actual initial state.
     // But first, let us create a state generator.
 
     clearStateCaches();
+    auto indices = stateGenerator->getInitialStates(stateToIdCallback);
+    STORM_LOG_THROW(indices.size() == 1, storm::exceptions::NotSupportedException, "Program must have a unique initial state");
+    initialState = idToState[indices[0]];
     resetToInitial();
 }
 
@@ -28,14 +36,21 @@ void DiscreteTimePrismProgramSimulator<ValueType>::setSeed(uint64_t newSeed) {
     generator = storm::utility::RandomProbabilityGenerator<ValueType>(newSeed);
 }
 
+template<typename ValueType>
+void DiscreteTimePrismProgramSimulator<ValueType>::setStateCacheSize(uint64_t maxNumberOfStates) {
+    stateCacheSize = maxNumberOfStates;
+    while (cachedStates.size() > stateCacheSize) {
+        stateToCacheEntry.erase(cachedStates.back().first);
+        cachedStates.pop_back();
+    }
+}
+
 template<typename ValueType>
 bool DiscreteTimePrismProgramSimulator<ValueType>::step(uint64_t actionNumber) {
-    uint32_t nextState = behavior.getChoices()[actionNumber].sampleFromDistribution(generator.random());
-    lastActionRewards = behavior.getChoices()[actionNumber].getRewards();
+    uint32_t nextState = current->samplers[actionNumber].sample(generator.random());
+    lastActionRewards = current->behavior.getChoices()[actionNumber].getRewards();
     STORM_LOG_ASSERT(lastActionRewards.size() == stateGenerator->getNumberOfRewardModels(), "Reward vector should have as many rewards as model.");
-    currentState = idToState[nextState];
-    // TODO we do not need to do this in every step!
-    clearStateCaches();
+    currentState = current->successors[nextState];
     explore();
     return true;
 }
@@ -44,18 +59,106 @@ template<typename ValueType>
 bool DiscreteTimePrismProgramSimulator<ValueType>::explore() {
     // Load the current state into the next state generator.
     stateGenerator->load(currentState);
+    if (stateCacheSize == 0) {
+        current = expandCurrentState();
+    } else {
+        auto cacheEntryIt = stateToCacheEntry.find(currentState);
+        if (cacheEntryIt != stateToCacheEntry.end()) {
+            // Mark the state as most recently visited.
+            cachedStates.splice(cachedStates.begin(), cachedStates, cacheEntryIt->second);
+            current = cacheEntryIt->second->second;
+        } else {
+            current = expandCurrentState();
+            if (cachedStates.size() >= stateCacheSize) {
+                stateToCacheEntry.erase(cachedStates.back().first);
+                cachedStates.pop_back();
+            }
+            cachedStates.emplace_front(currentState, current);
+            stateToCacheEntry.emplace(currentState, cachedStates.begin());
+        }
+    }
+    auto const& stateRewards = current->behavior.getStateRewards();
+    STORM_LOG_ASSERT(stateRewards.size() == lastActionRewards.size(), "Reward vectors should have same length.");
+    for (uint64_t i = 0; i < stateRewards.size(); i++) {
+        lastActionRewards[i] += stateRewards[i];
+    }
+    return true;
+}
+
+template<typename ValueType>
+std::shared_ptr<typename DiscreteTimePrismProgramSimulator<ValueType>::ExploredState const>
+DiscreteTimePrismProgramSimulator<ValueType>::expandCurrentState() {
+    // The state indices used in the behavior only need to be valid for this state.
+    clearStateCaches();
+    auto result = std::make_shared<ExploredState>();
     // TODO: This low-level code currently expands all actions, while this is not necessary.
     // However, using the next state generator ensures compatibliity with the model generator.
-    behavior = stateGenerator->expand(stateToIdCallback);
-    STORM_LOG_ASSERT(behavior.getStateRewards().size() == lastActionRewards.size(), "Reward vectors should have same length.");
-    for (uint64_t i = 0; i < behavior.getStateRewards().size(); i++) {
-        lastActionRewards[i] += behavior.getStateRewards()[i];
+    result->behavior = stateGenerator->expand(stateToIdCallback);
+    result->successors = std::move(idToState);
+    result->samplers.reserve(result->behavior.getNumberOfChoices());
+    for (auto const& choice : result->behavior.getChoices()) {
+        result->samplers.emplace_back(choice);
+    }
+    return result;
+}
+
+template<typename ValueType>
+DiscreteTimePrismProgramSimulator<ValueType>::AliasTable::AliasTable(generator::Choice<ValueType, uint32_t> const& choice) {
+    uint64_t numberOfOutcomes = choice.size();
+    outcomes.reserve(numberOfOutcomes);
+    thresholds.reserve(numberOfOutcomes);
+    aliases.resize(numberOfOutcomes);
+    std::iota(aliases.begin(), aliases.end(), 0);
+
+    // Scale the probabilities such that they are one on average and split the columns into those below and above average.
+    ValueType scalingFactor = storm::utility::convertNumber<ValueType>(numberOfOutcomes) / choice.getTotalMass();
+    std::vector<uint32_t> smallColumns, largeColumns;
+    for (auto const& entry : choice) {
+        outcomes.push_back(entry.first);
+        thresholds.push_back(entry.second * scalingFactor);
+        if (thresholds.back() < storm::utility::one<ValueType>()) {
+            smallColumns.push_back(outcomes.size() - 1);
+        } else {
+            largeColumns.push_back(outcomes.size() - 1);
+        }
+    }
+
+    // Fill up each small column with the probability of a large column.
+    while (!smallColumns.empty() && !largeColumns.empty()) {
+        uint32_t smallColumn = smallColumns.back();
+        smallColumns.pop_back();
+        uint32_t largeColumn = largeColumns.back();
+        aliases[smallColumn] = largeColumn;
+        thresholds[largeColumn] -= storm::utility::one<ValueType>() - thresholds[smallColumn];
+        if (thresholds[largeColumn] < storm::utility::one<ValueType>()) {
+            largeColumns.pop_back();
+            smallColumns.push_back(largeColumn);
+        }
+    }
+    // The remaining columns are full (up to numerical imprecision).
+    for (uint32_t column : smallColumns) {
+        thresholds[column] = storm::utility::one<ValueType>();
+    }
+    for (uint32_t column : largeColumns) {
+        thresholds[column] = storm::utility::one<ValueType>();
     }
-    return true;
+}
+
+template<typename ValueType>
+uint32_t DiscreteTimePrismProgramSimulator<ValueType>::AliasTable::sample(ValueType const& quantile) const {
+    STORM_LOG_ASSERT(!outcomes.empty(), "Cannot sample from an empty distribution.");
+    // The integral part of the scaled quantile selects the column, the fractional part decides between the column and its alias.
+    ValueType scaledQuantile = quantile * storm::utility::convertNumber<ValueType>(outcomes.size());
+    uint64_t column = std::min<uint64_t>(storm::utility::convertNumber<uint64_t>(storm::utility::floor(scaledQuantile)), outcomes.size() - 1);
+    if (scaledQuantile - storm::utility::convertNumber<ValueType>(column) < thresholds[column]) {
+        return outcomes[column];
+    }
+    return outcomes[aliases[column]];
 }
 
 template<typename ValueType>
 bool DiscreteTimePrismProgramSimulator<ValueType>::isSinkState() const {
+    auto const& behavior = current->behavior;
     if (behavior.empty()) {
         return true;
     }
@@ -68,7 +171,7 @@ bool DiscreteTimePrismProgramSimulator<ValueType>::isSinkState() const {
             }
         }
     }
-    if (idToState.at(*(successorIds.begin())) == currentState) {
+    if (current->successors.at(*(successorIds.begin())) == currentState) {
         return true;
     }
     return false;
@@ -87,7 +190,7 @@ std::vector<std::string> DiscreteTimePrismProgramSimulator<ValueType>::getCurren
 
 template<typename ValueType>
 std::vector<generator::Choice<ValueType, uint32_t>> const& DiscreteTimePrismProgramSimulator<ValueType>::getChoices() const {
-    return behavior.getChoices();
+    return current->behavior.getChoices();
 }
 
 template<typename ValueType>
@@ -95,6 +198,16 @@ std::vector<ValueType> const& DiscreteTimePrismProgramSimulator<ValueType>::getL
     return lastActionRewards;
 }
 
+template<typename ValueType>
+std::vector<ValueType> const& DiscreteTimePrismProgramSimulator<ValueType>::getCurrentStateRewards() const {
+    return current->behavior.getStateRewards();
+}
+
+template<typename ValueType>
+bool DiscreteTimePrismProgramSimulator<ValueType>::evaluateBooleanExpressionInCurrentState(storm::expressions::Expression const& expression) const {
+    return stateGenerator->evaluateBooleanExpressionInCurrentState(expression);
+}
+
 template<typename ValueType>
 CompressedState const& DiscreteTimePrismProgramSimulator<ValueType>::getCurrentState() const {
     return currentState;
@@ -123,9 +236,7 @@ storm::json<ValueType> DiscreteTimePrismProgramSimulator<ValueType>::getObservat
 template<typename ValueType>
 bool DiscreteTimePrismProgramSimulator<ValueType>::resetToInitial() {
     lastActionRewards = zeroRewards;
-    auto indices = stateGenerator->getInitialStates(stateToIdCallback);
-    STORM_LOG_THROW(indices.size() == 1, storm::exceptions::NotSupportedException, "Program must have a unique initial state");
-    currentState = idToState[indices[0]];
+    currentState = initialState;
     return explore();
 }
 
@@ -161,7 +272,7 @@ uint32_t DiscreteTimePrismProgramSimulator<ValueType>::getOrAddStateIndex(genera
 
     uint32_t actualIndex = actualIndexBucketPair.first;
     if (actualIndex == newIndex) {
-        idToState[actualIndex] = state;
+        idToState.push_back(state);
     }
     return actualIndex;
 }
@@ -1,5 +1,8 @@
 #pragma once
 
+#include <list>
+#include <unordered_map>
+
 #include "storm/generator/PrismNextStateGenerator.h"
 #include "storm/storage/expressions/SimpleValuation.h"
 #include "storm/storage/prism/Program.h"
@@ -19,6 +22,9 @@ namespace simulator {
  * as it potentially allows considering the next states.
  * Thus, while a performant alternative would be great, this simulator has its own merits.
  *
+ * To mitigate the overhead, the behavior of explored states is kept in a bounded cache with least-recently-used eviction.
+ * For every cached state, each choice is equipped with an alias table such that revisiting the state and sampling a successor takes constant time.
+ *
  * @tparam ValueType
  */
 template<typename ValueType>
@@ -35,6 +41,12 @@ class DiscreteTimePrismProgramSimulator {
      * Set the simulation seed.
      */
     void setSeed(uint64_t);
+    /**
+     * Set the maximal number of states whose behavior is cached. If the cache is full, the least recently visited state is evicted.
+     *
+     * @param maxNumberOfStates The maximal number of cached states. A value of 0 disables the cache.
+     */
+    void setStateCacheSize(uint64_t maxNumberOfStates);
     /**
      *
      * @return A list of choices that encode the possibilities in the current state.
@@ -57,6 +69,18 @@ class DiscreteTimePrismProgramSimulator {
      * @return A vector with te number of rewards.
      */
     std::vector<ValueType> const& getLastRewards() const;
+    /**
+     * Accessor for the state rewards of the current state (without the rewards of the last action).
+     * @return A vector with the number of rewards.
+     */
+    std::vector<ValueType> const& getCurrentStateRewards() const;
+    /**
+     * Evaluates the given (boolean) expression over the variables of the program in the current state.
+     *
+     * @param expression The expression, e.g., the expression of a label.
+     * @return true, if the expression holds in the current state.
+     */
+    bool evaluateBooleanExpressionInCurrentState(storm::expressions::Expression const& expression) const;
     generator::CompressedState const& getCurrentState() const;
     expressions::SimpleValuation getCurrentStateAsValuation() const;
     std::vector<std::string> getCurrentStateLabelling() const;
@@ -83,7 +107,43 @@ class DiscreteTimePrismProgramSimulator {
     std::vector<std::string> getRewardNames() const;
 
    protected:
+    /**
+     * Samples from a discrete distribution in constant time using Vose's alias method.
+     */
+    class AliasTable {
+       public:
+        AliasTable(generator::Choice<ValueType, uint32_t> const& choice);
+        /**
+         * Retrieves the outcome that corresponds to the given quantile, which needs to be in [0,1).
+         */
+        uint32_t sample(ValueType const& quantile) const;
+
+       private:
+        /// The possible outcomes, i.e., the indices of the successor states.
+        std::vector<uint32_t> outcomes;
+        /// For each column, the probability (scaled to [0,1]) with which the outcome of the column itself is taken.
+        std::vector<ValueType> thresholds;
+        /// For each column, the column whose outcome is taken otherwise.
+        std::vector<uint32_t> aliases;
+    };
+
+    /**
+     * The behavior of an explored state.
+     */
+    struct ExploredState {
+        /// The behavior of the state as obtained from the next state generator.
+        generator::StateBehavior<ValueType> behavior;
+        /// The successor states, indexed by the state indices used in the choices of the behavior.
+        std::vector<generator::CompressedState> successors;
+        /// One sampler for each choice.
+        std::vector<AliasTable> samplers;
+    };
+
     bool explore();
+    /**
+     * Expands the current state with the next state generator.
+     */
+    std::shared_ptr<ExploredState const> expandCurrentState();
     void clearStateCaches();
     /**
      * Helper function for (temp) storing states.
@@ -92,12 +152,14 @@ class DiscreteTimePrismProgramSimulator {
 
     /// The program that we are simulating.
     storm::prism::Program const& program;
+    /// The (unique) initial state of the program, in its compressed form.
+    generator::CompressedState initialState;
     /// The current state in the program, in its compressed form.
     generator::CompressedState currentState;
     /// Generator for the next states
     std::shared_ptr<storm::generator::PrismNextStateGenerator<ValueType, uint32_t>> stateGenerator;
-    /// Obtained behavior of a state
-    generator::StateBehavior<ValueType> behavior;
+    /// Obtained behavior of the current state
+    std::shared_ptr<ExploredState const> current;
     /// Helper for last action reward construction
     std::vector<ValueType> zeroRewards;
     /// Stores the action rewards from the last action.
@@ -106,8 +168,16 @@ class DiscreteTimePrismProgramSimulator {
     storm::utility::RandomProbabilityGenerator<ValueType> generator;
     /// Data structure to temp store states.
     storm::storage::BitVectorHashMap<uint32_t> stateToId;
+    /// The temp stored states, indexed by their index in stateToId.
+    std::vector<generator::CompressedState> idToState;
 
-    std::unordered_map<uint32_t, generator::CompressedState> idToState;
+    /// The maximal number of states in the cache.
+    uint64_t stateCacheSize;
+    /// The cached states, ordered from the most to the least recently visited.
+    typedef std::list<std::pair<generator::CompressedState, std::shared_ptr<ExploredState const>>> StateCache;
+    StateCache cachedStates;
+    /// Maps the cached states to their position in cachedStates.
+    std::unordered_map<generator::CompressedState, typename StateCache::iterator> stateToCacheEntry;
 
    private:
     // Create a callback for the next-state generator to enable it to request the index of states.
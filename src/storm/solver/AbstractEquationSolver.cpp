@@ -80,6 +80,11 @@ void AbstractEquationSolver<ValueType>::clearRelevantValues() {
     relevantValues = boost::none;
 }
 
+template<typename ValueType>
+uint64_t AbstractEquationSolver<ValueType>::getNumberOfIterationsOfLastSolve() const {
+    return numberOfIterationsOfLastSolve;
+}
+
 template<typename ValueType>
 bool AbstractEquationSolver<ValueType>::hasLowerBound(BoundType const& type) const {
     if (type == BoundType::Any) {
@@ -308,7 +313,13 @@ void AbstractEquationSolver<ValueType>::showProgressIterative(uint64_t iteration
 }
 
 template<typename ValueType>
-void AbstractEquationSolver<ValueType>::reportStatus(SolverStatus status, boost::optional<uint64_t> const& iterations) const {
+void AbstractEquationSolver<ValueType>::reportStatus(SolverStatus status, boost::optional<uint64_t> const& iterations,
+                                                     std::optional<double> const& abortedErrorBound) const {
+    numberOfIterationsOfLastSolve = iterations.get_value_or(0);
+    storm::utility::resources::reportSolvedEquationSystem();
+    if (status == SolverStatus::Aborted) {
+        storm::utility::resources::reportAbortedComputation(abortedErrorBound);
+    }
     if (iterations) {
         switch (status) {
             case SolverStatus::Converged:
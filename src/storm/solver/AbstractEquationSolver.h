@@ -5,6 +5,7 @@
 #include <chrono>
 #include <iostream>
 #include <memory>
+#include <optional>
 
 #include "storm/solver/SolverStatus.h"
 #include "storm/solver/TerminationCondition.h"
@@ -63,6 +64,11 @@ class AbstractEquationSolver {
      */
     void clearRelevantValues();
 
+    /*!
+     * Retrieves the number of iterations that were reported by the most recent invocation of this solver (zero if the solver is not iterative).
+     */
+    uint64_t getNumberOfIterationsOfLastSolve() const;
+
     enum class BoundType { Global, Local, Any };
 
     /*!
@@ -207,8 +213,10 @@ class AbstractEquationSolver {
      * Report the current status of the solver.
      * @param status Solver status.
      * @param iterations Number of iterations (if solver is iterative).
+     * @param abortedErrorBound If the solver was aborted, a bound on the absolute error of the current solution (if the solver can provide one).
      */
-    void reportStatus(SolverStatus status, boost::optional<uint64_t> const& iterations = boost::none) const;
+    void reportStatus(SolverStatus status, boost::optional<uint64_t> const& iterations = boost::none,
+                      std::optional<double> const& abortedErrorBound = std::nullopt) const;
 
     /*!
      * Update the status of the solver with respect to convergence, early termination, abortion, etc.
@@ -253,6 +261,9 @@ class AbstractEquationSolver {
    private:
     // Indicates the progress of this solver.
     mutable boost::optional<storm::utility::ProgressMeasurement> progressMeasurement;
+
+    // The number of iterations reported by the most recent invocation of this solver.
+    mutable uint64_t numberOfIterationsOfLastSolve{0};
 };
 
 }  // namespace solver
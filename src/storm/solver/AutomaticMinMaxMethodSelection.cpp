@@ -0,0 +1,179 @@
+#include "storm/solver/AutomaticMinMaxMethodSelection.h"
+
+#include <fstream>
+#include <sstream>
+
+#include "storm/adapters/RationalNumberAdapter.h"
+#include "storm/environment/Environment.h"
+#include "storm/environment/solver/MinMaxSolverEnvironment.h"
+#include "storm/environment/solver/MultiplierEnvironment.h"
+#include "storm/io/file.h"
+#include "storm/storage/SparseMatrix.h"
+#include "storm/storage/StronglyConnectedComponentDecomposition.h"
+#include "storm/utility/NumberTraits.h"
+#include "storm/utility/constants.h"
+#include "storm/utility/macros.h"
+
+namespace storm {
+namespace solver {
+
+// Systems with a smaller positive entry are considered to converge slowly under value iteration.
+static double const SlowConvergenceThreshold = 1e-3;
+// Policy iteration is only considered for systems with at most this many row groups, as each iteration solves a linear equation system.
+static uint64_t const PolicyIterationMaxRowGroups = 100000;
+// The compact matrix representation is used for multiplications if a double matrix has more entries than this.
+static uint64_t const CompactMatrixMinEntries = 1000000;
+
+bool MinMaxProblemStatistics::isAcyclic() const {
+    return numNontrivialSccs == 0;
+}
+
+std::string MinMaxProblemStatistics::getSignature(Environment const& env) const {
+    std::stringstream stream;
+    stream << numRowGroups << ":" << numRows << ":" << numEntries << ":";
+    if (env.solver().isForceExact()) {
+        stream << "exact";
+    } else if (env.solver().isForceSoundness()) {
+        stream << "sound";
+    } else {
+        stream << "default";
+    }
+    return stream.str();
+}
+
+template<typename ValueType>
+MinMaxProblemStatistics computeMinMaxProblemStatistics(storm::storage::SparseMatrix<ValueType> const& matrix) {
+    MinMaxProblemStatistics result;
+    result.numRowGroups = matrix.getRowGroupCount();
+    result.numRows = matrix.getRowCount();
+    result.numEntries = matrix.getEntryCount();
+    for (uint64_t group = 0; group < result.numRowGroups; ++group) {
+        result.maxRowGroupSize = std::max<uint64_t>(result.maxRowGroupSize, matrix.getRowGroupSize(group));
+    }
+    for (auto const& entry : matrix) {
+        if (!storm::utility::isZero(entry.getValue())) {
+            result.minPositiveValue = std::min(result.minPositiveValue, storm::utility::convertNumber<double>(entry.getValue()));
+        }
+    }
+    storm::storage::StronglyConnectedComponentDecomposition<ValueType> sccDecomposition(
+        matrix, storm::storage::StronglyConnectedComponentDecompositionOptions().dropNaiveSccs());
+    result.numNontrivialSccs = sccDecomposition.size();
+    for (auto const& scc : sccDecomposition) {
+        result.maxSccSize = std::max<uint64_t>(result.maxSccSize, scc.size());
+    }
+    return result;
+}
+
+/*!
+ * @return all methods that can be recorded in the history
+ */
+static std::vector<MinMaxMethod> getRecordableMethods() {
+    return {MinMaxMethod::ValueIteration,    MinMaxMethod::PolicyIteration,     MinMaxMethod::LinearProgramming,        MinMaxMethod::Topological,
+            MinMaxMethod::RationalSearch,    MinMaxMethod::IntervalIteration,   MinMaxMethod::SoundValueIteration,      MinMaxMethod::OptimisticValueIteration,
+            MinMaxMethod::ViToPi,            MinMaxMethod::Acyclic};
+}
+
+MinMaxMethodHistory::MinMaxMethodHistory(std::string const& filename) : filename(filename) {
+    if (!storm::utility::fileExistsAndIsReadable(filename)) {
+        return;
+    }
+    std::ifstream stream;
+    storm::utility::openFile(filename, stream);
+    std::string line;
+    while (storm::utility::getline(stream, line)) {
+        std::stringstream lineStream(line);
+        std::string signature, methodString;
+        double seconds;
+        if (!(lineStream >> signature >> methodString >> seconds)) {
+            STORM_LOG_WARN("Ignoring invalid line '" << line << "' in min/max method history file " << filename << ".");
+            continue;
+        }
+        for (auto const& method : getRecordableMethods()) {
+            if (toString(method) == methodString) {
+                auto insertionRes = fastestTimes[signature].emplace(method, seconds);
+                if (!insertionRes.second) {
+                    insertionRes.first->second = std::min(insertionRes.first->second, seconds);
+                }
+            }
+        }
+    }
+    storm::utility::closeFile(stream);
+}
+
+boost::optional<MinMaxMethod> MinMaxMethodHistory::getFastestMethod(std::string const& signature) const {
+    auto findRes = fastestTimes.find(signature);
+    if (findRes == fastestTimes.end() || findRes->second.empty()) {
+        return boost::none;
+    }
+    auto fastest = findRes->second.begin();
+    for (auto it = findRes->second.begin(); it != findRes->second.end(); ++it) {
+        if (it->second < fastest->second) {
+            fastest = it;
+        }
+    }
+    return fastest->first;
+}
+
+void MinMaxMethodHistory::recordTime(std::string const& signature, MinMaxMethod method, double seconds) {
+    auto insertionRes = fastestTimes[signature].emplace(method, seconds);
+    if (!insertionRes.second) {
+        insertionRes.first->second = std::min(insertionRes.first->second, seconds);
+    }
+    std::ofstream stream;
+    storm::utility::openFile(filename, stream, true, true);
+    stream << signature << " " << toString(method) << " " << seconds << '\n';
+    storm::utility::closeFile(stream);
+}
+
+MinMaxMethod selectMinMaxMethod(Environment const& env, MinMaxProblemStatistics const& statistics, bool isExact, MinMaxMethodHistory const* history) {
+    if (history) {
+        if (auto method = history->getFastestMethod(statistics.getSignature(env))) {
+            return *method;
+        }
+    }
+    if (statistics.isAcyclic()) {
+        return MinMaxMethod::Acyclic;
+    }
+    if (statistics.numNontrivialSccs > 1 && 2 * statistics.maxSccSize < statistics.numRowGroups) {
+        return MinMaxMethod::Topological;
+    }
+    if (isExact || (statistics.minPositiveValue < SlowConvergenceThreshold && statistics.numRowGroups <= PolicyIterationMaxRowGroups)) {
+        return MinMaxMethod::PolicyIteration;
+    }
+    return env.solver().isForceSoundness() ? MinMaxMethod::OptimisticValueIteration : MinMaxMethod::ValueIteration;
+}
+
+template<typename ValueType>
+std::string selectMinMaxMethodAutomatically(Environment& env, storm::storage::SparseMatrix<ValueType> const& matrix) {
+    auto const statistics = computeMinMaxProblemStatistics(matrix);
+    std::string signature = statistics.getSignature(env);
+    if (!env.solver().minMax().isMethodAutomatic()) {
+        return signature;
+    }
+    boost::optional<MinMaxMethodHistory> history;
+    if (env.solver().minMax().getAutomaticMethodHistoryFile()) {
+        history.emplace(env.solver().minMax().getAutomaticMethodHistoryFile().get());
+    }
+    bool const isExact = storm::NumberTraits<ValueType>::IsExact || env.solver().isForceExact();
+    auto const method = selectMinMaxMethod(env, statistics, isExact, history ? &history.get() : nullptr);
+    // The selected method is marked as set from default, so that solvers may still adapt it to guarantee exact or sound results.
+    env.solver().minMax().setMethod(method, true);
+    env.solver().multiplier().setType(MultiplierType::Native);
+    if (std::is_same_v<ValueType, double> && statistics.numEntries > CompactMatrixMinEntries) {
+        env.solver().multiplier().setUseCompactMatrix(true);
+    }
+    STORM_LOG_INFO("Automatically selected min/max method '"
+                   << toString(method) << "' for equation system with " << statistics.numRowGroups << " row groups, " << statistics.numRows << " rows, "
+                   << statistics.numEntries << " entries (max. row group size " << statistics.maxRowGroupSize << "), " << statistics.numNontrivialSccs
+                   << " non-trivial SCCs (max. size " << statistics.maxSccSize << "), and smallest positive entry " << statistics.minPositiveValue << "."
+                   << (history ? " Considered recorded solving times." : ""));
+    return signature;
+}
+
+template MinMaxProblemStatistics computeMinMaxProblemStatistics(storm::storage::SparseMatrix<double> const& matrix);
+template MinMaxProblemStatistics computeMinMaxProblemStatistics(storm::storage::SparseMatrix<storm::RationalNumber> const& matrix);
+template std::string selectMinMaxMethodAutomatically(Environment& env, storm::storage::SparseMatrix<double> const& matrix);
+template std::string selectMinMaxMethodAutomatically(Environment& env, storm::storage::SparseMatrix<storm::RationalNumber> const& matrix);
+
+}  // namespace solver
+}  // namespace storm
@@ -0,0 +1,93 @@
+#pragma once
+
+#include <map>
+#include <string>
+
+#include <boost/optional.hpp>
+
+#include "storm/solver/SolverSelectionOptions.h"
+
+namespace storm {
+
+class Environment;
+
+namespace storage {
+template<typename T>
+class SparseMatrix;
+}
+
+namespace solver {
+
+/*!
+ * Cheap structural statistics of a min-max equation system that guide the automatic selection of a solution method.
+ */
+struct MinMaxProblemStatistics {
+    uint64_t numRowGroups{0};
+    uint64_t numRows{0};
+    uint64_t numEntries{0};
+    uint64_t maxRowGroupSize{0};
+    /// The number of SCCs that consist of more than one state or have a self-loop.
+    uint64_t numNontrivialSccs{0};
+    /// The number of states of the largest non-trivial SCC.
+    uint64_t maxSccSize{0};
+    /// The smallest positive matrix entry. Small entries typically slow down the convergence of value iteration.
+    double minPositiveValue{1.0};
+
+    bool isAcyclic() const;
+
+    /*!
+     * @return a string that identifies equation systems of the same shape. Used to recognize models for which solving has been recorded before.
+     */
+    std::string getSignature(Environment const& env) const;
+};
+
+template<typename ValueType>
+MinMaxProblemStatistics computeMinMaxProblemStatistics(storm::storage::SparseMatrix<ValueType> const& matrix);
+
+/*!
+ * Stores the times that different min-max methods took on previously solved equation systems. The times are persisted in a file with one line
+ * `<signature> <method> <seconds>` per solve.
+ */
+class MinMaxMethodHistory {
+   public:
+    /*!
+     * Loads the history from the given file. If the file does not exist, the history is initially empty.
+     */
+    explicit MinMaxMethodHistory(std::string const& filename);
+
+    /*!
+     * @return the method with the smallest recorded time for the given signature (if there is any)
+     */
+    boost::optional<MinMaxMethod> getFastestMethod(std::string const& signature) const;
+
+    /*!
+     * Records the given time and appends it to the history file.
+     */
+    void recordTime(std::string const& signature, MinMaxMethod method, double seconds);
+
+   private:
+    std::string filename;
+    std::map<std::string, std::map<MinMaxMethod, double>> fastestTimes;
+};
+
+/*!
+ * Selects a min-max method for the given statistics.
+ * Previously recorded times take precedence (if a history is given). Otherwise:
+ * * acyclic systems are solved with the acyclic solver,
+ * * systems that decompose into several SCCs of which none dominates are solved topologically,
+ * * systems with very small probabilities (which typically make value iteration converge slowly) are solved with policy iteration,
+ * * all other systems are solved with (optimistic, if soundness is required) value iteration.
+ */
+MinMaxMethod selectMinMaxMethod(Environment const& env, MinMaxProblemStatistics const& statistics, bool isExact,
+                                MinMaxMethodHistory const* history = nullptr);
+
+/*!
+ * If the min-max method of the given environment is set to automatic, selects a method (and a multiplier) for the given matrix and stores it
+ * in the environment. The decision is logged.
+ * @return the signature of the equation system (for recording the solving time)
+ */
+template<typename ValueType>
+std::string selectMinMaxMethodAutomatically(Environment& env, storm::storage::SparseMatrix<ValueType> const& matrix);
+
+}  // namespace solver
+}  // namespace storm
@@ -1,6 +1,7 @@
 #include "storm/solver/EigenLinearEquationSolver.h"
 
 #include "storm/adapters/EigenAdapter.h"
+#include "storm/adapters/IntelTbbAdapter.h"
 
 #include "storm/adapters/RationalFunctionAdapter.h"
 
@@ -67,6 +68,69 @@ EigenLinearEquationSolverMethod EigenLinearEquationSolver<ValueType>::getMethod(
     return method;
 }
 
+template<typename ValueType>
+bool EigenLinearEquationSolver<ValueType>::solveEquationsSparseLu(Environment const& env, std::vector<ValueType>* x, std::vector<ValueType> const* b,
+                                                                  uint64_t numberOfSystems) const {
+    bool result = false;
+    switch (env.solver().eigen().getOrdering()) {
+        case EigenLinearEquationSolverOrdering::Colamd:
+            result = solveEquationsSparseLu(env, colamdFactorization, x, b, numberOfSystems);
+            break;
+        case EigenLinearEquationSolverOrdering::Amd:
+            if constexpr (std::is_same_v<ValueType, storm::RationalFunction>) {
+                // Eigen's AMD ordering assigns floating point constants to matrix entries, which is not possible for rational functions.
+                STORM_LOG_WARN("The AMD ordering is not supported for rational functions. Using COLAMD instead.");
+                result = solveEquationsSparseLu(env, colamdFactorization, x, b, numberOfSystems);
+            } else {
+                result = solveEquationsSparseLu(env, amdFactorization, x, b, numberOfSystems);
+            }
+            break;
+        case EigenLinearEquationSolverOrdering::Natural:
+            result = solveEquationsSparseLu(env, naturalFactorization, x, b, numberOfSystems);
+            break;
+    }
+    if (!this->isCachingEnabled()) {
+        clearCache();
+    }
+    return result;
+}
+
+template<typename ValueType>
+template<typename OrderingType>
+bool EigenLinearEquationSolver<ValueType>::solveEquationsSparseLu(Environment const& env, std::unique_ptr<SparseLuFactorization<OrderingType>>& factorization,
+                                                                  std::vector<ValueType>* x, std::vector<ValueType> const* b, uint64_t numberOfSystems) const {
+    if (!factorization) {
+        STORM_LOG_INFO("Computing sparse LU factorization of a matrix with " << eigenA->rows() << " rows (Eigen library).");
+        factorization = std::make_unique<SparseLuFactorization<OrderingType>>();
+        factorization->compute(*eigenA);
+    }
+    if (factorization->info() != Eigen::ComputationInfo::Success) {
+        STORM_LOG_WARN("Sparse LU factorization failed: " << factorization->lastErrorMessage());
+        return false;
+    }
+
+    // The factorization is only read while solving, so the systems can be solved concurrently. Rational functions are not thread safe.
+    auto solveSystem = [&factorization, &x, &b](uint64_t i) {
+        auto eigenX = Eigen::Matrix<ValueType, Eigen::Dynamic, 1>::Map(x[i].data(), x[i].size());
+        auto eigenB = Eigen::Matrix<ValueType, Eigen::Dynamic, 1>::Map(b[i].data(), b[i].size());
+        factorization->_solve_impl(eigenB, eigenX);
+    };
+#ifdef STORM_HAVE_INTELTBB
+    if (numberOfSystems > 1 && env.solver().isUseIntelTbb() && !std::is_same_v<ValueType, storm::RationalFunction>) {
+        tbb::parallel_for(tbb::blocked_range<uint64_t>(0, numberOfSystems), [&solveSystem](tbb::blocked_range<uint64_t> const& range) {
+            for (uint64_t i = range.begin(); i < range.end(); ++i) {
+                solveSystem(i);
+            }
+        });
+        return true;
+    }
+#endif
+    for (uint64_t i = 0; i < numberOfSystems; ++i) {
+        solveSystem(i);
+    }
+    return true;
+}
+
 #ifdef STORM_HAVE_CARL
 // Specialization for storm::RationalNumber
 template<>
@@ -75,16 +139,7 @@ bool EigenLinearEquationSolver<storm::RationalNumber>::internalSolveEquations(En
     auto solutionMethod = getMethod(env, true);
     STORM_LOG_WARN_COND(solutionMethod == EigenLinearEquationSolverMethod::SparseLU, "Switching method to SparseLU.");
     STORM_LOG_INFO("Solving linear equation system (" << x.size() << " rows) with with rational numbers using LU factorization (Eigen library).");
-
-    // Map the input vectors to Eigen's format.
-    auto eigenX = Eigen::Matrix<storm::RationalNumber, Eigen::Dynamic, 1>::Map(x.data(), x.size());
-    auto eigenB = Eigen::Matrix<storm::RationalNumber, Eigen::Dynamic, 1>::Map(b.data(), b.size());
-
-    Eigen::SparseLU<Eigen::SparseMatrix<storm::RationalNumber>, Eigen::COLAMDOrdering<int>> solver;
-    solver.compute(*eigenA);
-    solver._solve_impl(eigenB, eigenX);
-
-    return solver.info() == Eigen::ComputationInfo::Success;
+    return solveEquationsSparseLu(env, &x, &b, 1);
 }
 
 // Specialization for storm::RationalFunction
@@ -94,15 +149,7 @@ bool EigenLinearEquationSolver<storm::RationalFunction>::internalSolveEquations(
     auto solutionMethod = getMethod(env, true);
     STORM_LOG_WARN_COND(solutionMethod == EigenLinearEquationSolverMethod::SparseLU, "Switching method to SparseLU.");
     STORM_LOG_INFO("Solving linear equation system (" << x.size() << " rows) with rational functions using LU factorization (Eigen library).");
-
-    // Map the input vectors to Eigen's format.
-    auto eigenX = Eigen::Matrix<storm::RationalFunction, Eigen::Dynamic, 1>::Map(x.data(), x.size());
-    auto eigenB = Eigen::Matrix<storm::RationalFunction, Eigen::Dynamic, 1>::Map(b.data(), b.size());
-
-    Eigen::SparseLU<Eigen::SparseMatrix<storm::RationalFunction>, Eigen::COLAMDOrdering<int>> solver;
-    solver.compute(*eigenA);
-    solver._solve_impl(eigenB, eigenX);
-    return solver.info() == Eigen::ComputationInfo::Success;
+    return solveEquationsSparseLu(env, &x, &b, 1);
 }
 #endif
 
@@ -115,9 +162,7 @@ bool EigenLinearEquationSolver<ValueType>::internalSolveEquations(Environment co
     auto solutionMethod = getMethod(env, env.solver().isForceExact());
     if (solutionMethod == EigenLinearEquationSolverMethod::SparseLU) {
         STORM_LOG_INFO("Solving linear equation system (" << x.size() << " rows) with sparse LU factorization (Eigen library).");
-        Eigen::SparseLU<Eigen::SparseMatrix<ValueType>, Eigen::COLAMDOrdering<int>> solver;
-        solver.compute(*this->eigenA);
-        solver._solve_impl(eigenB, eigenX);
+        return solveEquationsSparseLu(env, &x, &b, 1);
     } else {
         bool converged = false;
         uint64_t numberOfIterations = 0;
@@ -248,6 +293,25 @@ bool EigenLinearEquationSolver<ValueType>::internalSolveEquations(Environment co
     return true;
 }
 
+template<typename ValueType>
+bool EigenLinearEquationSolver<ValueType>::internalSolveEquationsBatch(Environment const& env, std::vector<std::vector<ValueType>>& x,
+                                                                       std::vector<std::vector<ValueType>> const& b) const {
+    if (getMethod(env, storm::NumberTraits<ValueType>::IsExact || env.solver().isForceExact()) == EigenLinearEquationSolverMethod::SparseLU) {
+        STORM_LOG_INFO("Solving " << x.size() << " linear equation systems (" << eigenA->rows()
+                                  << " rows) with a common sparse LU factorization (Eigen library).");
+        return solveEquationsSparseLu(env, x.data(), b.data(), x.size());
+    }
+    return LinearEquationSolver<ValueType>::internalSolveEquationsBatch(env, x, b);
+}
+
+template<typename ValueType>
+void EigenLinearEquationSolver<ValueType>::clearCache() const {
+    colamdFactorization.reset();
+    amdFactorization.reset();
+    naturalFactorization.reset();
+    LinearEquationSolver<ValueType>::clearCache();
+}
+
 template<typename ValueType>
 LinearEquationSolverProblemFormat EigenLinearEquationSolver<ValueType>::getEquationProblemFormat(Environment const&) const {
     return LinearEquationSolverProblemFormat::EquationSystem;
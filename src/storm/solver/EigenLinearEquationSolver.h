@@ -22,17 +22,44 @@ class EigenLinearEquationSolver : public LinearEquationSolver<ValueType> {
 
     virtual LinearEquationSolverProblemFormat getEquationProblemFormat(Environment const& env) const override;
 
+    virtual void clearCache() const override;
+
    protected:
     virtual bool internalSolveEquations(Environment const& env, std::vector<ValueType>& x, std::vector<ValueType> const& b) const override;
 
+    /*!
+     * If the sparse LU method is selected, all systems are solved using a single factorization of the matrix (concurrently, if enabled).
+     * Otherwise, the systems are solved one after another.
+     */
+    virtual bool internalSolveEquationsBatch(Environment const& env, std::vector<std::vector<ValueType>>& x,
+                                             std::vector<std::vector<ValueType>> const& b) const override;
+
    private:
+    template<typename OrderingType>
+    using SparseLuFactorization = Eigen::SparseLU<Eigen::SparseMatrix<ValueType>, OrderingType>;
+
     EigenLinearEquationSolverMethod getMethod(Environment const& env, bool isExactMode) const;
 
+    /*!
+     * Solves the given number of systems with the sparse LU factorization of the matrix for the ordering selected in the environment.
+     * The factorization is computed if it is not cached yet.
+     */
+    bool solveEquationsSparseLu(Environment const& env, std::vector<ValueType>* x, std::vector<ValueType> const* b, uint64_t numberOfSystems) const;
+
+    template<typename OrderingType>
+    bool solveEquationsSparseLu(Environment const& env, std::unique_ptr<SparseLuFactorization<OrderingType>>& factorization, std::vector<ValueType>* x,
+                                std::vector<ValueType> const* b, uint64_t numberOfSystems) const;
+
     virtual uint64_t getMatrixRowCount() const override;
     virtual uint64_t getMatrixColumnCount() const override;
 
     // The (eigen) matrix associated with this equation solver.
     std::unique_ptr<Eigen::SparseMatrix<ValueType>> eigenA;
+
+    // The sparse LU factorization of eigenA for each ordering, kept across calls if caching is enabled.
+    mutable std::unique_ptr<SparseLuFactorization<Eigen::COLAMDOrdering<int>>> colamdFactorization;
+    mutable std::unique_ptr<SparseLuFactorization<Eigen::AMDOrdering<int>>> amdFactorization;
+    mutable std::unique_ptr<SparseLuFactorization<Eigen::NaturalOrdering<int>>> naturalFactorization;
 };
 
 template<typename ValueType>
@@ -146,6 +146,24 @@ template<typename ValueType, bool RawMode>
 void GlpkLpSolver<ValueType, RawMode>::addConstraint(std::string const& name, Constraint const& constraint) {
     // Add the row that will represent this constraint.
     int constraintIndex = glp_add_rows(this->lp, 1);
+    setConstraint(constraintIndex, name, constraint);
+}
+
+template<typename ValueType, bool RawMode>
+void GlpkLpSolver<ValueType, RawMode>::addConstraints(std::vector<Constraint> const& constraints) {
+    if (constraints.empty()) {
+        return;
+    }
+    // Add all rows at once, which avoids reallocating glpk's row storage for each constraint.
+    int constraintIndex = glp_add_rows(this->lp, constraints.size());
+    for (auto const& constraint : constraints) {
+        setConstraint(constraintIndex, "", constraint);
+        ++constraintIndex;
+    }
+}
+
+template<typename ValueType, bool RawMode>
+void GlpkLpSolver<ValueType, RawMode>::setConstraint(int constraintIndex, std::string const& name, Constraint const& constraint) {
     glp_set_row_name(this->lp, constraintIndex, name.c_str());
 
     // Extract constraint data
@@ -70,6 +70,7 @@ class GlpkLpSolver : public LpSolver<ValueType, RawMode> {
 
     // Methods to add constraints
     virtual void addConstraint(std::string const& name, Constraint const& constraint) override;
+    virtual void addConstraints(std::vector<Constraint> const& constraints) override;
     virtual void addIndicatorConstraint(std::string const& name, Variable indicatorVariable, bool indicatorValue, Constraint const& constraint) override;
 
     // Methods to optimize and retrieve optimality status.
@@ -94,6 +95,11 @@ class GlpkLpSolver : public LpSolver<ValueType, RawMode> {
     virtual ValueType getMILPGap(bool relative) const override;
 
    private:
+    /*!
+     * Sets the given constraint (and its name) for the (already existing) row with the given index.
+     */
+    void setConstraint(int constraintIndex, std::string const& name, Constraint const& constraint);
+
     // The glpk LP problem.
     glp_prob* lp;
 
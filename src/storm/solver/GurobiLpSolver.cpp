@@ -260,6 +260,34 @@ void GurobiLpSolver<ValueType, RawMode>::addConstraint(std::string const& name,
                     "Could not assert constraint (" << GRBgeterrormsg(**environment) << ", error code " << error << ").");
 }
 
+template<typename ValueType, bool RawMode>
+void GurobiLpSolver<ValueType, RawMode>::addConstraints(std::vector<Constraint> const& constraints) {
+    // Gurobi expects the constraints in compressed sparse row format.
+    std::vector<int> rowStarts;
+    std::vector<int> variableIndices;
+    std::vector<double> coefficients;
+    std::vector<char> senses;
+    std::vector<double> rightHandSides;
+    rowStarts.reserve(constraints.size());
+    senses.reserve(constraints.size());
+    rightHandSides.reserve(constraints.size());
+    for (auto const& constraint : constraints) {
+        if constexpr (!RawMode) {
+            STORM_LOG_ASSERT(constraint.getManager() == this->getManager(), "Constraint was not built over the proper variables.");
+        }
+        auto grbConstr = createConstraint<ValueType, RawMode>(constraint, this->variableToIndexMap);
+        rowStarts.push_back(variableIndices.size());
+        variableIndices.insert(variableIndices.end(), grbConstr.variableIndices.begin(), grbConstr.variableIndices.end());
+        coefficients.insert(coefficients.end(), grbConstr.coefficients.begin(), grbConstr.coefficients.end());
+        senses.push_back(grbConstr.sense);
+        rightHandSides.push_back(grbConstr.rhs);
+    }
+    int error = GRBaddconstrs(model, constraints.size(), variableIndices.size(), rowStarts.data(), variableIndices.data(), coefficients.data(), senses.data(),
+                              rightHandSides.data(), nullptr);
+    STORM_LOG_THROW(error == 0, storm::exceptions::InvalidStateException,
+                    "Could not assert constraints (" << GRBgeterrormsg(**environment) << ", error code " << error << ").");
+}
+
 template<typename ValueType, bool RawMode>
 void GurobiLpSolver<ValueType, RawMode>::addIndicatorConstraint(std::string const& name, Variable indicatorVariable, bool indicatorValue,
                                                                 Constraint const& constraint) {
@@ -528,6 +556,7 @@ void GurobiLpSolver<ValueType, RawMode>::pop() {
                         "Unable to delete constraints (" << GRBgeterrormsg(**environment) << ", error code " << error << ").");
         GRBgetintattr(model, GRB_INT_ATTR_NUMGENCONSTRS, &num);
         indicesToBeRemoved = storm::utility::vector::buildVectorForRange(lvl.firstGenConstraintIndex, num);
+        error = GRBdelgenconstrs(model, indicesToBeRemoved.size(), indicesToBeRemoved.data());
         STORM_LOG_THROW(error == 0, storm::exceptions::InvalidStateException,
                         "Unable to delete general constraints (" << GRBgeterrormsg(**environment) << ", error code " << error << ").");
         indicesToBeRemoved.clear();
@@ -738,6 +767,52 @@ ValueType GurobiLpSolver<ValueType, RawMode>::getMILPGap(bool relative) const {
     }
 }
 
+template<typename ValueType, bool RawMode>
+void GurobiLpSolver<ValueType, RawMode>::setMipStart(Variable const& variable, ValueType const& value) {
+    int varIndex;
+    if constexpr (RawMode) {
+        varIndex = variable;
+    } else {
+        STORM_LOG_ASSERT(variableToIndexMap.count(variable) != 0, "Setting start value of unknown variable '" << variable.getName() << "'.");
+        varIndex = variableToIndexMap.at(variable);
+    }
+
+    int error = GRBsetdblattrelement(model, GRB_DBL_ATTR_START, varIndex, storm::utility::convertNumber<double>(value));
+    STORM_LOG_THROW(error == 0, storm::exceptions::InvalidStateException,
+                    "Unable to set Gurobi start value (" << GRBgeterrormsg(**environment) << ", error code " << error << ").");
+}
+
+template<typename ValueType, bool RawMode>
+void GurobiLpSolver<ValueType, RawMode>::setVariableHint(Variable const& variable, ValueType const& value, int priority) {
+    int varIndex;
+    if constexpr (RawMode) {
+        varIndex = variable;
+    } else {
+        STORM_LOG_ASSERT(variableToIndexMap.count(variable) != 0, "Setting hint for unknown variable '" << variable.getName() << "'.");
+        varIndex = variableToIndexMap.at(variable);
+    }
+
+    int error = GRBsetdblattrelement(model, GRB_DBL_ATTR_VARHINTVAL, varIndex, storm::utility::convertNumber<double>(value));
+    STORM_LOG_THROW(error == 0, storm::exceptions::InvalidStateException,
+                    "Unable to set Gurobi variable hint (" << GRBgeterrormsg(**environment) << ", error code " << error << ").");
+    error = GRBsetintattrelement(model, GRB_INT_ATTR_VARHINTPRI, varIndex, priority);
+    STORM_LOG_THROW(error == 0, storm::exceptions::InvalidStateException,
+                    "Unable to set Gurobi variable hint priority (" << GRBgeterrormsg(**environment) << ", error code " << error << ").");
+}
+
+template<typename ValueType, bool RawMode>
+void GurobiLpSolver<ValueType, RawMode>::clearMipStartAndHints() {
+    int numberOfVariables;
+    GRBgetintattr(model, GRB_INT_ATTR_NUMVARS, &numberOfVariables);
+    std::vector<double> undefinedValues(numberOfVariables, GRB_UNDEFINED);
+    int error = GRBsetdblattrarray(model, GRB_DBL_ATTR_START, 0, numberOfVariables, undefinedValues.data());
+    STORM_LOG_THROW(error == 0, storm::exceptions::InvalidStateException,
+                    "Unable to clear Gurobi start values (" << GRBgeterrormsg(**environment) << ", error code " << error << ").");
+    error = GRBsetdblattrarray(model, GRB_DBL_ATTR_VARHINTVAL, 0, numberOfVariables, undefinedValues.data());
+    STORM_LOG_THROW(error == 0, storm::exceptions::InvalidStateException,
+                    "Unable to clear Gurobi variable hints (" << GRBgeterrormsg(**environment) << ", error code " << error << ").");
+}
+
 #else
 template<typename ValueType, bool RawMode>
 GurobiLpSolver<ValueType, RawMode>::GurobiLpSolver(std::shared_ptr<GurobiEnvironment> const&, std::string const&, OptimizationDirection const&) {
@@ -786,6 +861,12 @@ void GurobiLpSolver<ValueType, RawMode>::addConstraint(std::string const&, Const
                                                           "requires this support. Please choose a version of support with Gurobi support.";
 }
 
+template<typename ValueType, bool RawMode>
+void GurobiLpSolver<ValueType, RawMode>::addConstraints(std::vector<Constraint> const&) {
+    throw storm::exceptions::NotImplementedException() << "This version of storm was compiled without support for Gurobi. Yet, a method was called that "
+                                                          "requires this support. Please choose a version of support with Gurobi support.";
+}
+
 template<typename ValueType, bool RawMode>
 void GurobiLpSolver<ValueType, RawMode>::addIndicatorConstraint(std::string const&, Variable, bool, Constraint const&) {
     throw storm::exceptions::NotImplementedException() << "This version of storm was compiled without support for Gurobi. Yet, a method was called that "
@@ -906,6 +987,24 @@ ValueType GurobiLpSolver<ValueType, RawMode>::getMILPGap(bool) const {
                                                           "requires this support. Please choose a version of storm with Gurobi support.";
 }
 
+template<typename ValueType, bool RawMode>
+void GurobiLpSolver<ValueType, RawMode>::setMipStart(Variable const&, ValueType const&) {
+    throw storm::exceptions::NotImplementedException() << "This version of storm was compiled without support for Gurobi. Yet, a method was called that "
+                                                          "requires this support. Please choose a version of storm with Gurobi support.";
+}
+
+template<typename ValueType, bool RawMode>
+void GurobiLpSolver<ValueType, RawMode>::setVariableHint(Variable const&, ValueType const&, int) {
+    throw storm::exceptions::NotImplementedException() << "This version of storm was compiled without support for Gurobi. Yet, a method was called that "
+                                                          "requires this support. Please choose a version of storm with Gurobi support.";
+}
+
+template<typename ValueType, bool RawMode>
+void GurobiLpSolver<ValueType, RawMode>::clearMipStartAndHints() {
+    throw storm::exceptions::NotImplementedException() << "This version of storm was compiled without support for Gurobi. Yet, a method was called that "
+                                                          "requires this support. Please choose a version of storm with Gurobi support.";
+}
+
 #endif
 
 std::string toString(GurobiSolverMethod const& method) {
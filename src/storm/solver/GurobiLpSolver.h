@@ -101,6 +101,7 @@ class GurobiLpSolver : public LpSolver<ValueType, RawMode> {
 
     // Methods to add constraints
     virtual void addConstraint(std::string const& name, Constraint const& constraint) override;
+    virtual void addConstraints(std::vector<Constraint> const& constraints) override;
     virtual void addIndicatorConstraint(std::string const& name, Variable indicatorVariable, bool indicatorValue, Constraint const& constraint) override;
 
     // Methods to optimize and retrieve optimality status.
@@ -123,6 +124,10 @@ class GurobiLpSolver : public LpSolver<ValueType, RawMode> {
     virtual void setMaximalMILPGap(ValueType const& gap, bool relative) override;
     virtual ValueType getMILPGap(bool relative) const override;
 
+    virtual void setMipStart(Variable const& variable, ValueType const& value) override;
+    virtual void setVariableHint(Variable const& variable, ValueType const& value, int priority = 0) override;
+    virtual void clearMipStartAndHints() override;
+
     // Methods to retrieve values of sub-optimal solutions found along the way.
     void setMaximalSolutionCount(uint64_t value);  // How many solutions will be stored (at max)
     uint64_t getSolutionCount() const;             // How many solutions have been found
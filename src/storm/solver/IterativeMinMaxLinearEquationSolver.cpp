@@ -9,17 +9,24 @@
 #include "storm/exceptions/InvalidEnvironmentException.h"
 #include "storm/exceptions/UnmetRequirementException.h"
 #include "storm/solver/helper/IntervalterationHelper.h"
+#include "storm/solver/helper/MixedPrecisionHelper.h"
 #include "storm/solver/helper/OptimisticValueIterationHelper.h"
+#include "storm/solver/helper/PrioritizedValueIterationHelper.h"
 #include "storm/solver/helper/RationalSearchHelper.h"
 #include "storm/solver/helper/SchedulerTrackingHelper.h"
 #include "storm/solver/helper/SoundValueIterationHelper.h"
 #include "storm/solver/helper/ValueIterationHelper.h"
+#include "storm/solver/multiplier/Multiplier.h"
 #include "storm/utility/ConstantsComparator.h"
 #include "storm/utility/NumberTraits.h"
 #include "storm/utility/SignalHandler.h"
 #include "storm/utility/macros.h"
 #include "storm/utility/vector.h"
 
+#ifdef STORM_HAVE_INTELTBB
+#include "storm/adapters/IntelTbbAdapter.h"
+#endif
+
 namespace storm {
 namespace solver {
 
@@ -87,7 +94,12 @@ template<typename ValueType, typename SolutionType>
 bool IterativeMinMaxLinearEquationSolver<ValueType, SolutionType>::internalSolveEquations(Environment const& env, OptimizationDirection dir,
                                                                                           std::vector<SolutionType>& x, std::vector<ValueType> const& b) const {
     bool result = false;
-    switch (getMethod(env, storm::NumberTraits<ValueType>::IsExact || env.solver().isForceExact())) {
+    auto const method = getMethod(env, storm::NumberTraits<ValueType>::IsExact || env.solver().isForceExact());
+    if (method != MinMaxMethod::ValueIteration) {
+        // Only value iteration can operate on a matrix view.
+        this->materializeMatrix();
+    }
+    switch (method) {
         case MinMaxMethod::ValueIteration:
             result = solveEquationsValueIteration(env, dir, x, b);
             break;
@@ -120,7 +132,11 @@ template<typename ValueType, typename SolutionType>
 void IterativeMinMaxLinearEquationSolver<ValueType, SolutionType>::setUpViOperator() const {
     if (!viOperator) {
         viOperator = std::make_shared<helper::ValueIterationOperator<ValueType, false, SolutionType>>();
-        viOperator->setMatrixBackwards(*this->A);
+        if (this->A) {
+            viOperator->setMatrixBackwards(*this->A);
+        } else {
+            viOperator->template setMatrix<true>(*this->matrixView);
+        }
     }
     if (this->choiceFixedForRowGroup) {
         // Ignore those rows that are not selected
@@ -204,10 +220,14 @@ bool IterativeMinMaxLinearEquationSolver<ValueType, SolutionType>::performPolicy
         STORM_LOG_THROW(false, storm::exceptions::NotImplementedException, "We did not implement policy iteration for interval-based models.");
         return false;
     } else {
+        if (useModifiedPolicyIteration(env)) {
+            return performModifiedPolicyIteration(env, dir, x, b, std::move(initialPolicy));
+        }
         std::vector<storm::storage::sparse::state_type> scheduler = std::move(initialPolicy);
         // Get a vector for storing the right-hand side of the inner equation system.
         if (!auxiliaryRowGroupVector) {
-            auxiliaryRowGroupVector = std::make_unique<std::vector<ValueType>>(this->A->getRowGroupCount());
+            auxiliaryRowGroupVector =
+                std::make_unique<std::vector<ValueType>>(storm::utility::vector::createWithParallelFirstTouch<ValueType>(this->A->getRowGroupCount()));
         }
         std::vector<ValueType>& subB = *auxiliaryRowGroupVector;
 
@@ -304,6 +324,101 @@ bool IterativeMinMaxLinearEquationSolver<ValueType, SolutionType>::performPolicy
     }
 }
 
+template<typename ValueType, typename SolutionType>
+bool IterativeMinMaxLinearEquationSolver<ValueType, SolutionType>::useModifiedPolicyIteration(Environment const& env) const {
+    // Evaluating schedulers only approximately neither yields exact nor sound results.
+    return env.solver().minMax().getPolicyEvaluationSweeps() > 0 && !storm::NumberTraits<ValueType>::IsExact && !env.solver().isForceExact() &&
+           !env.solver().isForceSoundness();
+}
+
+template<typename ValueType, typename SolutionType>
+bool IterativeMinMaxLinearEquationSolver<ValueType, SolutionType>::performModifiedPolicyIteration(
+    Environment const& env, OptimizationDirection dir, std::vector<SolutionType>& x, std::vector<ValueType> const& b,
+    std::vector<storm::storage::sparse::state_type>&& initialPolicy) const {
+    if constexpr (std::is_same_v<ValueType, storm::Interval>) {
+        STORM_LOG_THROW(false, storm::exceptions::NotImplementedException, "We did not implement policy iteration for interval-based models.");
+        return false;
+    } else {
+        std::vector<storm::storage::sparse::state_type> scheduler = std::move(initialPolicy);
+        if (!auxiliaryRowGroupVector) {
+            auxiliaryRowGroupVector =
+                std::make_unique<std::vector<ValueType>>(storm::utility::vector::createWithParallelFirstTouch<ValueType>(this->A->getRowGroupCount()));
+        }
+        std::vector<ValueType>& subB = *auxiliaryRowGroupVector;
+        std::vector<ValueType> newX(x.size());
+        uint64_t const sweeps = env.solver().minMax().getPolicyEvaluationSweeps();
+        ValueType const precision = storm::utility::convertNumber<ValueType>(env.solver().minMax().getPrecision());
+        bool const relative = env.solver().minMax().getRelativeTerminationCriterion();
+        auto const& rowGroupIndices = this->A->getRowGroupIndices();
+
+        // Improves the choices of the given row groups w.r.t. the current values. The values are written to newX such that row groups are independent.
+        auto improveRowGroups = [&](uint64_t firstGroup, uint64_t lastGroup) {
+            for (uint64_t group = firstGroup; group < lastGroup; ++group) {
+                uint64_t const groupStart = rowGroupIndices[group];
+                ValueType bestValue = this->A->multiplyRowWithVector(groupStart + scheduler[group], x) + b[groupStart + scheduler[group]];
+                if (!this->choiceFixedForRowGroup || !this->choiceFixedForRowGroup.get()[group]) {
+                    for (uint64_t choice = groupStart; choice < rowGroupIndices[group + 1]; ++choice) {
+                        // Only switch to choices that are strictly better than the current one.
+                        ValueType choiceValue = this->A->multiplyRowWithVector(choice, x) + b[choice];
+                        if (valueImproved(dir, bestValue, choiceValue)) {
+                            scheduler[group] = choice - groupStart;
+                            bestValue = std::move(choiceValue);
+                        }
+                    }
+                }
+                newX[group] = std::move(bestValue);
+            }
+        };
+
+        SolverStatus status = SolverStatus::InProgress;
+        uint64_t iterations = 0;
+        this->startMeasureProgress();
+        do {
+            // Evaluate the current scheduler with a bounded number of sweeps, starting from the previous evaluation.
+            storm::storage::SparseMatrix<ValueType> submatrix = this->A->selectRowsFromRowGroups(scheduler, false);
+            storm::utility::vector::selectVectorValues<ValueType>(subB, scheduler, rowGroupIndices, b);
+            auto multiplier = storm::solver::MultiplierFactory<ValueType>().create(env, submatrix);
+            multiplier->repeatedMultiply(env, x, &subB, sweeps);
+
+            // Improve the scheduler. This also performs one step of value iteration.
+#ifdef STORM_HAVE_INTELTBB
+            if (env.solver().isUseIntelTbb()) {
+                tbb::parallel_for(tbb::blocked_range<uint64_t>(0, this->A->getRowGroupCount(), 100),
+                                  [&](tbb::blocked_range<uint64_t> const& range) { improveRowGroups(range.begin(), range.end()); });
+            } else {
+                improveRowGroups(0, this->A->getRowGroupCount());
+            }
+#else
+            improveRowGroups(0, this->A->getRowGroupCount());
+#endif
+
+            // We are done if the improvement step no longer changes the values.
+            if (storm::utility::vector::equalModuloPrecision<ValueType>(x, newX, precision, relative)) {
+                status = SolverStatus::Converged;
+            }
+            std::swap(x, newX);
+
+            ++iterations;
+            status = this->updateStatus(status, x, SolverGuarantee::None, iterations, env.solver().minMax().getMaximalNumberOfIterations());
+            this->showProgressIterative(iterations);
+        } while (status == SolverStatus::InProgress);
+
+        STORM_LOG_INFO("Number of iterations: " << iterations);
+        this->reportStatus(status, iterations);
+
+        // If requested, we store the scheduler for retrieval.
+        if (this->isTrackSchedulerSet()) {
+            this->schedulerChoices = std::move(scheduler);
+        }
+
+        if (!this->isCachingEnabled()) {
+            clearCache();
+        }
+
+        return status == SolverStatus::Converged || status == SolverStatus::TerminatedEarly;
+    }
+}
+
 template<typename ValueType, typename SolutionType>
 bool IterativeMinMaxLinearEquationSolver<ValueType, SolutionType>::valueImproved(OptimizationDirection dir, ValueType const& value1,
                                                                                  ValueType const& value2) const {
@@ -321,7 +436,7 @@ MinMaxLinearEquationSolverRequirements IterativeMinMaxLinearEquationSolver<Value
 
     // Check whether a linear equation solver is needed and potentially start with its requirements
     bool needsLinEqSolver = false;
-    needsLinEqSolver |= method == MinMaxMethod::PolicyIteration;
+    needsLinEqSolver |= method == MinMaxMethod::PolicyIteration && !useModifiedPolicyIteration(env);
     needsLinEqSolver |= method == MinMaxMethod::ValueIteration && (this->hasInitialScheduler() || hasInitialScheduler);
     needsLinEqSolver |= method == MinMaxMethod::ViToPi;
 
@@ -373,7 +488,8 @@ MinMaxLinearEquationSolverRequirements IterativeMinMaxLinearEquationSolver<Value
         }
     } else if (method == MinMaxMethod::PolicyIteration) {
         // The initial scheduler shall not select an end component
-        if (!this->hasUniqueSolution() && env.solver().minMax().isForceRequireUnique()) {
+        // Modified policy iteration approximates the values as value iteration does, so it can only converge to the desired solution if it is unique.
+        if (!this->hasUniqueSolution() && (env.solver().minMax().isForceRequireUnique() || useModifiedPolicyIteration(env))) {
             requirements.requireUniqueSolution();
         }
         if (!this->hasNoEndComponents() && !this->hasInitialScheduler()) {
@@ -436,6 +552,7 @@ bool IterativeMinMaxLinearEquationSolver<ValueType, SolutionType>::solveEquation
         setUpViOperator();
 
         helper::OptimisticValueIterationHelper<ValueType, false> oviHelper(viOperator);
+        oviHelper.setPipelined(env.solver().ovi().isPipelined());
         auto prec = storm::utility::convertNumber<ValueType>(env.solver().minMax().getPrecision());
         std::optional<ValueType> lowerBound, upperBound;
         if (this->hasLowerBound()) {
@@ -477,12 +594,15 @@ bool IterativeMinMaxLinearEquationSolver<ValueType, SolutionType>::solveEquation
                                                                                                 std::vector<SolutionType>& x,
                                                                                                 std::vector<ValueType> const& b) const {
     setUpViOperator();
+    viOperator->setParallelApply(env.solver().isUseIntelTbb());
     // By default, we can not provide any guarantee
     SolverGuarantee guarantee = SolverGuarantee::None;
 
     if (this->hasInitialScheduler()) {
+        this->materializeMatrix();
         if (!auxiliaryRowGroupVector) {
-            auxiliaryRowGroupVector = std::make_unique<std::vector<ValueType>>(this->A->getRowGroupCount());
+            auxiliaryRowGroupVector =
+                std::make_unique<std::vector<ValueType>>(storm::utility::vector::createWithParallelFirstTouch<ValueType>(this->A->getRowGroupCount()));
         }
         // Solve the equation system induced by the initial scheduler.
         std::unique_ptr<storm::solver::LinearEquationSolver<ValueType>> linEqSolver;
@@ -530,15 +650,41 @@ bool IterativeMinMaxLinearEquationSolver<ValueType, SolutionType>::solveEquation
     }
 
     storm::solver::helper::ValueIterationHelper<ValueType, false, SolutionType> viHelper(viOperator);
+    viHelper.setTelemetry(env.solver().getTelemetry());
     uint64_t numIterations{0};
     auto viCallback = [&](SolverStatus const& current) {
         this->showProgressIterative(numIterations);
         return this->updateStatus(current, x, guarantee, numIterations, env.solver().minMax().getMaximalNumberOfIterations());
     };
     this->startMeasureProgress();
-    auto status = viHelper.VI(x, b, numIterations, env.solver().minMax().getRelativeTerminationCriterion(),
-                              storm::utility::convertNumber<SolutionType>(env.solver().minMax().getPrecision()), dir, viCallback,
-                              env.solver().minMax().getMultiplicationStyle(), this->isUncertaintyRobust());
+    if constexpr (std::is_same_v<ValueType, double>) {
+        if (env.solver().minMax().isMixedPrecision() && guarantee == SolverGuarantee::None && this->hasUniqueSolution() && !this->hasInitialScheduler()) {
+            // Obtain an initial guess in single precision. The double precision iterations below then only need to polish this guess.
+            auto approximationCallback = [&](SolverStatus const& current) {
+                this->showProgressIterative(numIterations);
+                return this->updateStatus(current, false, numIterations, env.solver().minMax().getMaximalNumberOfIterations());
+            };
+            this->materializeMatrix();
+            helper::MixedPrecisionHelper<false> mixedPrecisionHelper(*this->A, viOperator);
+            mixedPrecisionHelper.approximate(x, b, numIterations, storm::utility::convertNumber<double>(env.solver().minMax().getPrecision()), dir,
+                                             approximationCallback);
+            STORM_LOG_INFO("Single precision value iteration took " << numIterations << " iterations.");
+        }
+    }
+    std::optional<SolverStatus> prioritizedStatus;
+    if constexpr (!std::is_same_v<ValueType, storm::Interval>) {
+        if (env.solver().minMax().isPrioritized()) {
+            this->materializeMatrix();
+            helper::PrioritizedValueIterationHelper<ValueType> prioritizedHelper(*this->A);
+            prioritizedHelper.setParallel(env.solver().isUseIntelTbb());
+            prioritizedStatus = prioritizedHelper.VI(x, b, numIterations, env.solver().minMax().getRelativeTerminationCriterion(),
+                                                     storm::utility::convertNumber<ValueType>(env.solver().minMax().getPrecision()), dir, viCallback);
+        }
+    }
+    auto status = prioritizedStatus ? *prioritizedStatus
+                                    : viHelper.VI(x, b, numIterations, env.solver().minMax().getRelativeTerminationCriterion(),
+                                                  storm::utility::convertNumber<SolutionType>(env.solver().minMax().getPrecision()), dir, viCallback,
+                                                  env.solver().minMax().getMultiplicationStyle(), this->isUncertaintyRobust());
     this->reportStatus(status, numIterations);
 
     // If requested, we store the scheduler for retrieval.
@@ -575,24 +721,70 @@ bool IterativeMinMaxLinearEquationSolver<ValueType, SolutionType>::solveEquation
         setUpViOperator();
         helper::IntervalIterationHelper<ValueType, false> iiHelper(viOperator);
         auto prec = storm::utility::convertNumber<ValueType>(env.solver().minMax().getPrecision());
-        auto lowerBoundsCallback = [&](std::vector<SolutionType>& vector) { this->createLowerBoundsVector(vector); };
-        auto upperBoundsCallback = [&](std::vector<SolutionType>& vector) { this->createUpperBoundsVector(vector); };
-
         uint64_t numIterations{0};
+        this->startMeasureProgress();
+
+        // If requested, we derive tighter initial bounds from a single precision approximation of the solution.
+        std::optional<helper::MixedPrecisionHelper<false>> mixedPrecisionHelper;
+        std::vector<double> approximation;
+        if constexpr (std::is_same_v<ValueType, double>) {
+            if (env.solver().minMax().isMixedPrecision() && this->hasUniqueSolution() && !this->hasInitialScheduler()) {
+                auto approximationCallback = [&](SolverStatus const& current) {
+                    this->showProgressIterative(numIterations);
+                    return this->updateStatus(current, false, numIterations, env.solver().minMax().getMaximalNumberOfIterations());
+                };
+                mixedPrecisionHelper.emplace(*this->A, viOperator);
+                approximation.resize(x.size());
+                this->createLowerBoundsVector(approximation);
+                mixedPrecisionHelper->approximate(approximation, b, numIterations, prec, dir, approximationCallback);
+                STORM_LOG_INFO("Single precision value iteration took " << numIterations << " iterations.");
+            }
+        }
+        auto lowerBoundsCallback = [&](std::vector<SolutionType>& vector) {
+            this->createLowerBoundsVector(vector);
+            if constexpr (std::is_same_v<ValueType, double>) {
+                if (mixedPrecisionHelper) {
+                    mixedPrecisionHelper->tightenLowerBounds(vector, approximation, b, dir);
+                }
+            }
+        };
+        auto upperBoundsCallback = [&](std::vector<SolutionType>& vector) {
+            this->createUpperBoundsVector(vector);
+            if constexpr (std::is_same_v<ValueType, double>) {
+                if (mixedPrecisionHelper) {
+                    mixedPrecisionHelper->tightenUpperBounds(vector, approximation, b, dir);
+                }
+            }
+        };
+
+        // If the solver is aborted, the (center of the) current bounds still yield a sound approximation.
+        std::optional<double> abortedErrorBound;
         auto iiCallback = [&](helper::IIData<ValueType> const& data) {
             this->showProgressIterative(numIterations);
             bool terminateEarly = this->hasCustomTerminationCondition() && this->getTerminationCondition().terminateNow(data.x, SolverGuarantee::LessOrEqual) &&
                                   this->getTerminationCondition().terminateNow(data.y, SolverGuarantee::GreaterOrEqual);
-            return this->updateStatus(data.status, terminateEarly, numIterations, env.solver().minMax().getMaximalNumberOfIterations());
+            auto status = this->updateStatus(data.status, terminateEarly, numIterations, env.solver().minMax().getMaximalNumberOfIterations());
+            if (status == SolverStatus::Aborted) {
+                abortedErrorBound = helper::getIntervalIterationErrorBound(data);
+            }
+            return status;
         };
         std::optional<storm::storage::BitVector> optionalRelevantValues;
         if (this->hasRelevantValues()) {
             optionalRelevantValues = this->getRelevantValues();
         }
-        this->startMeasureProgress();
-        auto status = iiHelper.II(x, b, numIterations, env.solver().minMax().getRelativeTerminationCriterion(), prec, lowerBoundsCallback, upperBoundsCallback,
-                                  dir, iiCallback, optionalRelevantValues);
-        this->reportStatus(status, numIterations);
+        SolverStatus status;
+        if (env.solver().minMax().isPrioritized()) {
+            this->materializeMatrix();
+            helper::PrioritizedValueIterationHelper<ValueType> prioritizedHelper(*this->A);
+            prioritizedHelper.setParallel(env.solver().isUseIntelTbb());
+            status = prioritizedHelper.II(x, b, numIterations, env.solver().minMax().getRelativeTerminationCriterion(), prec, lowerBoundsCallback,
+                                          upperBoundsCallback, dir, iiCallback, optionalRelevantValues);
+        } else {
+            status = iiHelper.II(x, b, numIterations, env.solver().minMax().getRelativeTerminationCriterion(), prec, lowerBoundsCallback, upperBoundsCallback,
+                                 dir, iiCallback, optionalRelevantValues);
+        }
+        this->reportStatus(status, numIterations, abortedErrorBound);
 
         // If requested, we store the scheduler for retrieval.
         if (this->isTrackSchedulerSet()) {
@@ -718,6 +910,7 @@ bool IterativeMinMaxLinearEquationSolver<ValueType, SolutionType>::solveEquation
             if (this->choiceFixedForRowGroup) {
                 impreciseOp->setIgnoredRows(true, fixedChoicesCallback);
             }
+            impreciseOp->setParallelApply(viOperator->isParallelApplySet());
         } else if constexpr (std::is_same_v<ValueType, double>) {
             impreciseOp = viOperator;
             exactOp = std::make_shared<helper::ValueIterationOperator<storm::RationalNumber, false>>();
@@ -725,6 +918,7 @@ bool IterativeMinMaxLinearEquationSolver<ValueType, SolutionType>::solveEquation
             if (this->choiceFixedForRowGroup) {
                 exactOp->setIgnoredRows(true, fixedChoicesCallback);
             }
+            exactOp->setParallelApply(viOperator->isParallelApplySet());
         }
 
         storm::solver::helper::RationalSearchHelper<ValueType, storm::RationalNumber, double, false> rsHelper(exactOp, impreciseOp);
@@ -751,6 +945,11 @@ bool IterativeMinMaxLinearEquationSolver<ValueType, SolutionType>::solveEquation
     }
 }
 
+template<typename ValueType, typename SolutionType>
+bool IterativeMinMaxLinearEquationSolver<ValueType, SolutionType>::canOperateOnMatrixView() const {
+    return true;
+}
+
 template<typename ValueType, typename SolutionType>
 void IterativeMinMaxLinearEquationSolver<ValueType, SolutionType>::clearCache() const {
     auxiliaryRowGroupVector.reset();
@@ -36,6 +36,9 @@ class IterativeMinMaxLinearEquationSolver : public StandardMinMaxLinearEquationS
                                                                    boost::optional<storm::solver::OptimizationDirection> const& direction = boost::none,
                                                                    bool const& hasInitialScheduler = false) const override;
 
+   protected:
+    virtual bool canOperateOnMatrixView() const override;
+
    private:
     MinMaxMethod getMethod(Environment const& env, bool isExactMode) const;
 
@@ -45,6 +48,13 @@ class IterativeMinMaxLinearEquationSolver : public StandardMinMaxLinearEquationS
     bool solveEquationsPolicyIteration(Environment const& env, OptimizationDirection dir, std::vector<SolutionType>& x, std::vector<ValueType> const& b) const;
     bool performPolicyIteration(Environment const& env, OptimizationDirection dir, std::vector<SolutionType>& x, std::vector<ValueType> const& b,
                                 std::vector<storm::storage::sparse::state_type>&& initialPolicy) const;
+    bool useModifiedPolicyIteration(Environment const& env) const;
+    /*!
+     * Performs policy iteration where each scheduler is only evaluated with a bounded number of sweeps over the induced matrix.
+     * The evaluation of the previous scheduler serves as initial guess for the evaluation of the next one.
+     */
+    bool performModifiedPolicyIteration(Environment const& env, OptimizationDirection dir, std::vector<SolutionType>& x, std::vector<ValueType> const& b,
+                                        std::vector<storm::storage::sparse::state_type>&& initialPolicy) const;
     bool valueImproved(OptimizationDirection dir, ValueType const& value1, ValueType const& value2) const;
 
     bool solveEquationsValueIteration(Environment const& env, OptimizationDirection dir, std::vector<SolutionType>& x, std::vector<ValueType> const& b) const;
@@ -15,6 +15,7 @@
 
 #include "storm/environment/solver/SolverEnvironment.h"
 
+#include "storm/exceptions/InvalidArgumentException.h"
 #include "storm/exceptions/NotSupportedException.h"
 #include "storm/exceptions/UnmetRequirementException.h"
 #include "storm/utility/macros.h"
@@ -32,6 +33,26 @@ bool LinearEquationSolver<ValueType>::solveEquations(Environment const& env, std
     return this->internalSolveEquations(env, x, b);
 }
 
+template<typename ValueType>
+bool LinearEquationSolver<ValueType>::solveEquationsBatch(Environment const& env, std::vector<std::vector<ValueType>>& x,
+                                                          std::vector<std::vector<ValueType>> const& b) const {
+    STORM_LOG_THROW(x.size() == b.size(), storm::exceptions::InvalidArgumentException, "The number of solution vectors does not match the number of offsets.");
+    if (x.empty()) {
+        return true;
+    }
+    return this->internalSolveEquationsBatch(env, x, b);
+}
+
+template<typename ValueType>
+bool LinearEquationSolver<ValueType>::internalSolveEquationsBatch(Environment const& env, std::vector<std::vector<ValueType>>& x,
+                                                                  std::vector<std::vector<ValueType>> const& b) const {
+    bool result = true;
+    for (uint64_t i = 0; i < x.size(); ++i) {
+        result &= this->internalSolveEquations(env, x[i], b[i]);
+    }
+    return result;
+}
+
 template<typename ValueType>
 LinearEquationSolverRequirements LinearEquationSolver<ValueType>::getRequirements(Environment const&) const {
     return LinearEquationSolverRequirements();
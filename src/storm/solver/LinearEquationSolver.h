@@ -48,6 +48,17 @@ class LinearEquationSolver : public AbstractEquationSolver<ValueType> {
      */
     bool solveEquations(Environment const& env, std::vector<ValueType>& x, std::vector<ValueType> const& b) const;
 
+    /*!
+     * Solves multiple equation systems with the same matrix A (but different vectors b) in the same way as <code>solveEquations</code>.
+     * Depending on the solver, the systems are either solved one after another or simultaneously.
+     *
+     * @param x The solution vectors that have to be computed. There has to be one solution vector for each vector in b.
+     * @param b The vectors b.
+     *
+     * @return true iff all systems were solved successfully
+     */
+    bool solveEquationsBatch(Environment const& env, std::vector<std::vector<ValueType>>& x, std::vector<std::vector<ValueType>> const& b) const;
+
     /*!
      * Retrieves the format in which this solver expects to solve equations. If the solver expects the equation
      * system format, it solves Ax = b. If it it expects a fixed point format, it solves Ax + b = x.
@@ -79,6 +90,12 @@ class LinearEquationSolver : public AbstractEquationSolver<ValueType> {
    protected:
     virtual bool internalSolveEquations(Environment const& env, std::vector<ValueType>& x, std::vector<ValueType> const& b) const = 0;
 
+    /*!
+     * Solves the given equation systems. By default, they are solved one after another.
+     */
+    virtual bool internalSolveEquationsBatch(Environment const& env, std::vector<std::vector<ValueType>>& x,
+                                             std::vector<std::vector<ValueType>> const& b) const;
+
     // auxiliary storage. If set, this vector has getMatrixRowCount() entries.
     mutable std::unique_ptr<std::vector<ValueType>> cachedRowVector;
 
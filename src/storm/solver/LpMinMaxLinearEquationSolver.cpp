@@ -1,10 +1,10 @@
 #include "storm/solver/LpMinMaxLinearEquationSolver.h"
 
+#include <optional>
+
 #include "storm/environment/solver/MinMaxSolverEnvironment.h"
 #include "storm/exceptions/InvalidEnvironmentException.h"
 #include "storm/exceptions/UnexpectedException.h"
-#include "storm/storage/expressions/RationalLiteralExpression.h"
-#include "storm/storage/expressions/VariableExpression.h"
 #include "storm/utility/macros.h"
 #include "storm/utility/vector.h"
 
@@ -37,12 +37,12 @@ bool LpMinMaxLinearEquationSolver<ValueType>::internalSolveEquations(Environment
     STORM_LOG_THROW(env.solver().minMax().getMethod() == MinMaxMethod::LinearProgramming, storm::exceptions::InvalidEnvironmentException,
                     "This min max solver does not support the selected technique.");
 
-    // Set up the LP solver
-    std::unique_ptr<storm::solver::LpSolver<ValueType>> solver = lpSolverFactory->create("");
+    // Set up the LP solver. The constraints are given in raw form (variable indices and coefficients) which avoids building an expression for each row.
+    std::unique_ptr<storm::solver::LpSolver<ValueType, true>> solver = lpSolverFactory->createRaw("");
     solver->setOptimizationDirection(invert(dir));
     // Create a variable for each row group
-    std::vector<storm::expressions::Expression> variableExpressions;
-    variableExpressions.reserve(this->A->getRowGroupCount());
+    STORM_LOG_ASSERT(x.size() == this->A->getRowGroupCount(), "Dimension of x-vector does not match number of varibales.");
+    std::vector<std::optional<uint64_t>> variables(this->A->getRowGroupCount());
     for (uint64_t rowGroup = 0; rowGroup < this->A->getRowGroupCount(); ++rowGroup) {
         if (this->hasLowerBound()) {
             ValueType lowerBound = this->getLowerBound(rowGroup);
@@ -50,30 +50,34 @@ bool LpMinMaxLinearEquationSolver<ValueType>::internalSolveEquations(Environment
                 ValueType upperBound = this->getUpperBound(rowGroup);
                 if (lowerBound == upperBound) {
                     // Some solvers (like glpk) don't support variables with bounds [x,x]. We therefore just use a constant instead. This should be more
-                    // efficient anyways.
-                    variableExpressions.push_back(solver->getConstant(lowerBound));
+                    // efficient anyways. The constant is stored in the solution vector.
+                    x[rowGroup] = lowerBound;
                 } else {
                     STORM_LOG_ASSERT(lowerBound <= upperBound,
                                      "Lower Bound at row group " << rowGroup << " is " << lowerBound << " which exceeds the upper bound " << upperBound << ".");
-                    variableExpressions.emplace_back(
-                        solver->addBoundedContinuousVariable("x" + std::to_string(rowGroup), lowerBound, upperBound, storm::utility::one<ValueType>()));
+                    variables[rowGroup] =
+                        solver->addBoundedContinuousVariable("x" + std::to_string(rowGroup), lowerBound, upperBound, storm::utility::one<ValueType>());
                 }
             } else {
-                variableExpressions.emplace_back(
-                    solver->addLowerBoundedContinuousVariable("x" + std::to_string(rowGroup), lowerBound, storm::utility::one<ValueType>()));
+                variables[rowGroup] = solver->addLowerBoundedContinuousVariable("x" + std::to_string(rowGroup), lowerBound, storm::utility::one<ValueType>());
             }
         } else {
             if (this->upperBound) {
-                variableExpressions.emplace_back(
-                    solver->addUpperBoundedContinuousVariable("x" + std::to_string(rowGroup), this->getUpperBound(rowGroup), storm::utility::one<ValueType>()));
+                variables[rowGroup] =
+                    solver->addUpperBoundedContinuousVariable("x" + std::to_string(rowGroup), this->getUpperBound(rowGroup), storm::utility::one<ValueType>());
             } else {
-                variableExpressions.emplace_back(solver->addUnboundedContinuousVariable("x" + std::to_string(rowGroup), storm::utility::one<ValueType>()));
+                variables[rowGroup] = solver->addUnboundedContinuousVariable("x" + std::to_string(rowGroup), storm::utility::one<ValueType>());
             }
         }
     }
     solver->update();
 
-    // Add a constraint for each row
+    // Add a constraint for each row. The constraint x_rowGroup ~ b_row + sum_j A_row,j * x_j is brought into the form
+    // x_rowGroup - sum_j A_row,j * x_j ~ b_row, where the terms of constant x_j are moved to the right-hand side.
+    storm::expressions::RelationType relationType =
+        minimize(dir) ? storm::expressions::RelationType::LessOrEqual : storm::expressions::RelationType::GreaterOrEqual;
+    std::vector<RawLpConstraint<ValueType>> constraints;
+    constraints.reserve(this->A->getRowCount());
     for (uint64_t rowGroup = 0; rowGroup < this->A->getRowGroupCount(); ++rowGroup) {
         // The rowgroup refers to the state number
         uint64_t rowIndex, rowGroupEnd;
@@ -86,21 +90,28 @@ bool LpMinMaxLinearEquationSolver<ValueType>::internalSolveEquations(Environment
         }
         for (; rowIndex < rowGroupEnd; ++rowIndex) {
             auto row = this->A->getRow(rowIndex);
-            std::vector<storm::expressions::Expression> summands;
-            summands.reserve(1 + row.getNumberOfEntries());
-            summands.push_back(solver->getConstant(b[rowIndex]));
+            RawLpConstraint<ValueType> constraint(relationType, b[rowIndex], row.getNumberOfEntries() + 1);
+            ValueType rowGroupCoefficient = storm::utility::one<ValueType>();
             for (auto const& entry : row) {
-                summands.push_back(solver->getConstant(entry.getValue()) * variableExpressions[entry.getColumn()]);
+                if (entry.getColumn() == rowGroup) {
+                    rowGroupCoefficient -= entry.getValue();
+                } else if (variables[entry.getColumn()]) {
+                    constraint.addToLhs(*variables[entry.getColumn()], -entry.getValue());
+                } else {
+                    constraint.rhs += entry.getValue() * x[entry.getColumn()];
+                }
             }
-            storm::expressions::Expression rowConstraint = storm::expressions::sum(summands);
-            if (minimize(dir)) {
-                rowConstraint = variableExpressions[rowGroup] <= rowConstraint;
+            if (variables[rowGroup]) {
+                constraint.addToLhs(*variables[rowGroup], rowGroupCoefficient);
             } else {
-                rowConstraint = variableExpressions[rowGroup] >= rowConstraint;
+                constraint.rhs -= rowGroupCoefficient * x[rowGroup];
             }
-            solver->addConstraint("", rowConstraint);
+            constraints.push_back(std::move(constraint));
         }
     }
+    solver->addConstraints(constraints);
+    constraints.clear();
+    constraints.shrink_to_fit();
 
     // Invoke optimization
     solver->optimize();
@@ -108,17 +119,10 @@ bool LpMinMaxLinearEquationSolver<ValueType>::internalSolveEquations(Environment
     STORM_LOG_THROW(!solver->isUnbounded(), storm::exceptions::UnexpectedException, "The MinMax equation system is unbounded.");
     STORM_LOG_THROW(solver->isOptimal(), storm::exceptions::UnexpectedException, "Unable to find optimal solution for MinMax equation system.");
 
-    // write the solution into the solution vector
-    STORM_LOG_ASSERT(x.size() == variableExpressions.size(), "Dimension of x-vector does not match number of varibales.");
-    auto xIt = x.begin();
-    auto vIt = variableExpressions.begin();
-    for (; xIt != x.end(); ++xIt, ++vIt) {
-        auto const& vBaseExpr = vIt->getBaseExpression();
-        if (vBaseExpr.isVariable()) {
-            *xIt = solver->getContinuousValue(vBaseExpr.asVariableExpression().getVariable());
-        } else {
-            STORM_LOG_ASSERT(vBaseExpr.isRationalLiteralExpression(), "Variable expression has unexpected type.");
-            *xIt = storm::utility::convertNumber<ValueType>(vBaseExpr.asRationalLiteralExpression().getValue());
+    // write the solution into the solution vector (the values of constant row groups are already stored there)
+    for (uint64_t rowGroup = 0; rowGroup < this->A->getRowGroupCount(); ++rowGroup) {
+        if (variables[rowGroup]) {
+            x[rowGroup] = solver->getContinuousValue(*variables[rowGroup]);
         }
     }
 
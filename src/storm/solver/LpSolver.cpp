@@ -133,6 +133,28 @@ storm::expressions::ExpressionManager const& LpSolver<ValueType, RawMode>::getMa
     return *manager;
 }
 
+template<typename ValueType, bool RawMode>
+void LpSolver<ValueType, RawMode>::addConstraints(std::vector<Constraint> const& constraints) {
+    for (auto const& constraint : constraints) {
+        addConstraint("", constraint);
+    }
+}
+
+template<typename ValueType, bool RawMode>
+void LpSolver<ValueType, RawMode>::setMipStart(Variable const&, ValueType const&) {
+    // Intentionally left empty: MIP starts are optional.
+}
+
+template<typename ValueType, bool RawMode>
+void LpSolver<ValueType, RawMode>::setVariableHint(Variable const&, ValueType const&, int) {
+    // Intentionally left empty: hints are optional.
+}
+
+template<typename ValueType, bool RawMode>
+void LpSolver<ValueType, RawMode>::clearMipStartAndHints() {
+    // Intentionally left empty.
+}
+
 template<typename ValueType, bool RawMode>
 storm::expressions::Variable LpSolver<ValueType, RawMode>::declareOrGetExpressionVariable(std::string const& name, VariableType const& type) {
     switch (type) {
@@ -253,6 +253,14 @@ class LpSolver {
      */
     virtual void addConstraint(std::string const& name, Constraint const& constraint) = 0;
 
+    /*!
+     * Adds the given (unnamed) constraints to the LP problem. This has the same effect as adding the constraints one by one, but solvers
+     * may add all of them at once, which is considerably faster for large problems (in particular in raw mode).
+     *
+     * @param constraints The constraints to add.
+     */
+    virtual void addConstraints(std::vector<Constraint> const& constraints);
+
     /*!
      * Adds the given indicator constraint to the LP problem:
      * "If indicatorVariable == indicatorValue, then constraint"
@@ -384,6 +392,25 @@ class LpSolver {
      */
     virtual ValueType getMILPGap(bool relative) const = 0;
 
+    /*!
+     * Provides a start value for the given variable that is used to construct an initial solution in subsequent calls to optimize(). The start
+     * values do not need to form a complete (or even feasible) solution; solvers may repair or discard them. Solvers without support for MIP starts
+     * ignore the given value. Start values can only be set for variables that have been incorporated via update().
+     */
+    virtual void setMipStart(Variable const& variable, ValueType const& value);
+
+    /*!
+     * Hints that the given variable likely takes the given value in an optimal solution, which may guide the heuristics of the solver. In contrast
+     * to MIP starts, hints are not used to construct an initial solution. Hints with a higher priority are considered more reliable.
+     * Solvers without support for hints ignore the given hint.
+     */
+    virtual void setVariableHint(Variable const& variable, ValueType const& value, int priority = 0);
+
+    /*!
+     * Removes all start values and hints that were previously provided.
+     */
+    virtual void clearMipStartAndHints();
+
    protected:
     storm::expressions::Variable declareOrGetExpressionVariable(std::string const& name, VariableType const& type);
 
@@ -13,6 +13,7 @@
 #include "storm/exceptions/IllegalFunctionCallException.h"
 #include "storm/exceptions/InvalidSettingsException.h"
 #include "storm/exceptions/NotImplementedException.h"
+#include "storm/storage/SparseMatrixView.h"
 #include "storm/utility/macros.h"
 
 namespace storm::solver {
@@ -28,6 +29,11 @@ MinMaxLinearEquationSolver<ValueType, SolutionType>::~MinMaxLinearEquationSolver
     // Intentionally left empty.
 }
 
+template<typename ValueType, typename SolutionType>
+void MinMaxLinearEquationSolver<ValueType, SolutionType>::setMatrix(storm::storage::SparseMatrixView<ValueType> const& matrixView) {
+    setMatrix(matrixView.toSparseMatrix());
+}
+
 template<typename ValueType, typename SolutionType>
 bool MinMaxLinearEquationSolver<ValueType, SolutionType>::solveEquations(Environment const& env, OptimizationDirection d, std::vector<SolutionType>& x,
                                                                          std::vector<ValueType> const& b) const {
@@ -219,6 +225,14 @@ std::unique_ptr<MinMaxLinearEquationSolver<ValueType, SolutionType>> MinMaxLinea
     return solver;
 }
 
+template<typename ValueType, typename SolutionType>
+std::unique_ptr<MinMaxLinearEquationSolver<ValueType, SolutionType>> MinMaxLinearEquationSolverFactory<ValueType, SolutionType>::create(
+    Environment const& env, storm::storage::SparseMatrixView<ValueType> const& matrixView) const {
+    std::unique_ptr<MinMaxLinearEquationSolver<ValueType, SolutionType>> solver = this->create(env);
+    solver->setMatrix(matrixView);
+    return solver;
+}
+
 template<typename ValueType, typename SolutionType>
 GeneralMinMaxLinearEquationSolverFactory<ValueType, SolutionType>::GeneralMinMaxLinearEquationSolverFactory()
     : MinMaxLinearEquationSolverFactory<ValueType, SolutionType>() {
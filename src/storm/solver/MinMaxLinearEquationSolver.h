@@ -23,6 +23,8 @@ class Environment;
 namespace storage {
 template<typename T>
 class SparseMatrix;
+template<typename T>
+class SparseMatrixView;
 }
 
 namespace solver {
@@ -41,6 +43,12 @@ class MinMaxLinearEquationSolver : public AbstractEquationSolver<SolutionType> {
     virtual void setMatrix(storm::storage::SparseMatrix<ValueType> const& matrix) = 0;
     virtual void setMatrix(storm::storage::SparseMatrix<ValueType>&& matrix) = 0;
 
+    /*!
+     * Sets the matrix to the submatrix given by the view. Solvers that can operate on the view directly avoid copying the submatrix; the viewed
+     * matrix then has to outlive the solver. By default, the submatrix is copied.
+     */
+    virtual void setMatrix(storm::storage::SparseMatrixView<ValueType> const& matrixView);
+
     /*!
      * Solves the equation system x = min/max(A*x + b) given by the parameters. Note that the matrix A has
      * to be given upon construction time of the solver object.
@@ -231,6 +239,8 @@ class MinMaxLinearEquationSolverFactory {
     std::unique_ptr<MinMaxLinearEquationSolver<ValueType, SolutionType>> create(Environment const& env,
                                                                                 storm::storage::SparseMatrix<ValueType> const& matrix) const;
     std::unique_ptr<MinMaxLinearEquationSolver<ValueType, SolutionType>> create(Environment const& env, storm::storage::SparseMatrix<ValueType>&& matrix) const;
+    std::unique_ptr<MinMaxLinearEquationSolver<ValueType, SolutionType>> create(Environment const& env,
+                                                                                storm::storage::SparseMatrixView<ValueType> const& matrixView) const;
     virtual std::unique_ptr<MinMaxLinearEquationSolver<ValueType, SolutionType>> create(Environment const& env) const = 0;
 
     /*!
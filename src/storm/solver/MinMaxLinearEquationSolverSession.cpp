@@ -0,0 +1,93 @@
+#include "storm/solver/MinMaxLinearEquationSolverSession.h"
+
+#include "storm/adapters/RationalNumberAdapter.h"
+#include "storm/environment/Environment.h"
+#include "storm/utility/macros.h"
+
+#include "storm/exceptions/InvalidOperationException.h"
+
+namespace storm {
+namespace solver {
+
+template<typename ValueType, typename SolutionType>
+MinMaxLinearEquationSolverSession<ValueType, SolutionType>::MinMaxLinearEquationSolverSession(Environment const& env,
+                                                                                              storm::storage::SparseMatrix<ValueType> const& matrix,
+                                                                                              bool hasUniqueSolution, bool hasNoEndComponents)
+    : matrix(matrix), useLastSchedulerAsInitialScheduler(false) {
+    GeneralMinMaxLinearEquationSolverFactory<ValueType, SolutionType> factory;
+    solver = factory.create(env, matrix);
+    solver->setHasUniqueSolution(hasUniqueSolution);
+    solver->setHasNoEndComponents(hasNoEndComponents);
+    solver->setTrackScheduler(true);
+    // Keep the data that is computed during solving (e.g. the value iteration operator) for subsequent solves.
+    solver->setCachingEnabled(true);
+    requirements = solver->getRequirements(env);
+    // From now on, meeting the requirements is up to the caller.
+    solver->setRequirementsChecked();
+}
+
+template<typename ValueType, typename SolutionType>
+MinMaxLinearEquationSolverRequirements const& MinMaxLinearEquationSolverSession<ValueType, SolutionType>::getRequirements() const {
+    return requirements;
+}
+
+template<typename ValueType, typename SolutionType>
+void MinMaxLinearEquationSolverSession<ValueType, SolutionType>::setUseLastSchedulerAsInitialScheduler(bool value) {
+    useLastSchedulerAsInitialScheduler = value;
+}
+
+template<typename ValueType, typename SolutionType>
+bool MinMaxLinearEquationSolverSession<ValueType, SolutionType>::solve(Environment const& env, OptimizationDirection dir, std::vector<SolutionType>& x,
+                                                                       std::vector<ValueType> const& b, std::optional<SolutionType> const& lowerBound,
+                                                                       std::optional<SolutionType> const& upperBound) {
+    STORM_LOG_ASSERT(x.size() == matrix.getRowGroupCount(), "Dimension of solution vector does not match the matrix.");
+    STORM_LOG_ASSERT(b.size() == matrix.getRowCount(), "Dimension of offset vector does not match the matrix.");
+    solver->clearBounds();
+    if (lowerBound) {
+        solver->setLowerBound(*lowerBound);
+    }
+    if (upperBound) {
+        solver->setUpperBound(*upperBound);
+    }
+    if (useLastSchedulerAsInitialScheduler && lastScheduler) {
+        solver->setInitialScheduler(std::vector<uint_fast64_t>(lastScheduler->begin(), lastScheduler->end()));
+    }
+    bool converged = solver->solveEquations(env, dir, x, b);
+    if (solver->hasScheduler()) {
+        auto const& choices = solver->getSchedulerChoices();
+        lastScheduler.emplace(choices.begin(), choices.end());
+    } else {
+        lastScheduler.reset();
+    }
+    return converged;
+}
+
+template<typename ValueType, typename SolutionType>
+bool MinMaxLinearEquationSolverSession<ValueType, SolutionType>::hasLastScheduler() const {
+    return lastScheduler.has_value();
+}
+
+template<typename ValueType, typename SolutionType>
+std::vector<uint64_t> const& MinMaxLinearEquationSolverSession<ValueType, SolutionType>::getLastScheduler() const {
+    STORM_LOG_THROW(lastScheduler.has_value(), storm::exceptions::InvalidOperationException, "No scheduler from a previous solve available.");
+    return *lastScheduler;
+}
+
+template<typename ValueType, typename SolutionType>
+storm::storage::SparseMatrix<ValueType> const& MinMaxLinearEquationSolverSession<ValueType, SolutionType>::getMatrix() const {
+    return matrix;
+}
+
+template<typename ValueType, typename SolutionType>
+storm::storage::SparseMatrix<ValueType> const& MinMaxLinearEquationSolverSession<ValueType, SolutionType>::getBackwardTransitions() const {
+    if (!backwardTransitions) {
+        backwardTransitions = matrix.transpose(true);
+    }
+    return *backwardTransitions;
+}
+
+template class MinMaxLinearEquationSolverSession<double>;
+template class MinMaxLinearEquationSolverSession<storm::RationalNumber>;
+
+}  // namespace solver
+}  // namespace storm
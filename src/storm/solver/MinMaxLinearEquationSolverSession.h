@@ -0,0 +1,89 @@
+#pragma once
+
+#include <memory>
+#include <optional>
+#include <vector>
+
+#include "storm/solver/MinMaxLinearEquationSolver.h"
+#include "storm/solver/MinMaxLinearEquationSolverRequirements.h"
+#include "storm/solver/OptimizationDirection.h"
+#include "storm/storage/SparseMatrix.h"
+
+namespace storm {
+
+class Environment;
+
+namespace solver {
+
+/*!
+ * A session for solving many min-max equation systems x = min/max(A*x + b) that share the same matrix A but differ in the vector b,
+ * the optimization direction, the bounds, or the initial guess.
+ * The session creates the underlying solver (and checks its requirements) only once and keeps the data that solvers cache between calls,
+ * e.g., the value iteration operator. Moreover, it caches the backward transitions of the matrix and the scheduler of the last solve.
+ */
+template<typename ValueType, typename SolutionType = ValueType>
+class MinMaxLinearEquationSolverSession {
+   public:
+    /*!
+     * Creates a session for the given matrix. The matrix must remain valid as long as the session is used.
+     * @param env The environment that determines the solver to use. Later solves should use a compatible environment.
+     * @param matrix The matrix A.
+     * @param hasUniqueSolution Whether all equation systems solved within this session are known to have a unique solution.
+     * @param hasNoEndComponents Whether the matrix is known to have no end components.
+     */
+    MinMaxLinearEquationSolverSession(Environment const& env, storm::storage::SparseMatrix<ValueType> const& matrix, bool hasUniqueSolution = false,
+                                      bool hasNoEndComponents = false);
+
+    /*!
+     * Retrieves the requirements of the underlying solver. These requirements have to be met by all equation systems solved within this session.
+     * Bound requirements can be met by providing bounds upon solving.
+     */
+    MinMaxLinearEquationSolverRequirements const& getRequirements() const;
+
+    /*!
+     * If set, the scheduler of the previous solve is used as initial scheduler for subsequent solves.
+     * This is only sound if the previous scheduler is a valid initial scheduler for the subsequent problems, e.g., if the solutions are unique.
+     */
+    void setUseLastSchedulerAsInitialScheduler(bool value = true);
+
+    /*!
+     * Solves x = min/max(A*x + b).
+     * @param x The solution vector. Its initial content is used as initial guess.
+     * @param lowerBound If given, a lower bound for all values of the solution.
+     * @param upperBound If given, an upper bound for all values of the solution.
+     * @return true iff the solver converged.
+     */
+    bool solve(Environment const& env, OptimizationDirection dir, std::vector<SolutionType>& x, std::vector<ValueType> const& b,
+               std::optional<SolutionType> const& lowerBound = std::nullopt, std::optional<SolutionType> const& upperBound = std::nullopt);
+
+    /*!
+     * Retrieves whether a scheduler from a previous solve is available.
+     */
+    bool hasLastScheduler() const;
+
+    /*!
+     * Retrieves the (choices of the) scheduler that induces the result of the previous solve.
+     */
+    std::vector<uint64_t> const& getLastScheduler() const;
+
+    /*!
+     * Retrieves the matrix for which this session was created.
+     */
+    storm::storage::SparseMatrix<ValueType> const& getMatrix() const;
+
+    /*!
+     * Retrieves the backward transitions of the matrix. They are computed upon the first call and cached afterwards.
+     */
+    storm::storage::SparseMatrix<ValueType> const& getBackwardTransitions() const;
+
+   private:
+    storm::storage::SparseMatrix<ValueType> const& matrix;
+    std::unique_ptr<MinMaxLinearEquationSolver<ValueType, SolutionType>> solver;
+    MinMaxLinearEquationSolverRequirements requirements;
+    bool useLastSchedulerAsInitialScheduler;
+    std::optional<std::vector<uint64_t>> lastScheduler;
+    mutable std::optional<storm::storage::SparseMatrix<ValueType>> backwardTransitions;
+};
+
+}  // namespace solver
+}  // namespace storm
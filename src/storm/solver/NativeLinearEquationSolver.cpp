@@ -8,6 +8,7 @@
 #include "storm/exceptions/InvalidEnvironmentException.h"
 #include "storm/exceptions/UnmetRequirementException.h"
 #include "storm/solver/helper/IntervalterationHelper.h"
+#include "storm/solver/helper/MixedPrecisionHelper.h"
 #include "storm/solver/helper/OptimisticValueIterationHelper.h"
 #include "storm/solver/helper/RationalSearchHelper.h"
 #include "storm/solver/helper/SoundValueIterationHelper.h"
@@ -65,7 +66,7 @@ bool NativeLinearEquationSolver<ValueType>::solveEquationsSOR(Environment const&
     STORM_LOG_INFO("Solving linear equation system (" << x.size() << " rows) with NativeLinearEquationSolver (Gauss-Seidel, SOR omega = " << omega << ")");
 
     if (!this->cachedRowVector) {
-        this->cachedRowVector = std::make_unique<std::vector<ValueType>>(getMatrixRowCount());
+        this->cachedRowVector = std::make_unique<std::vector<ValueType>>(storm::utility::vector::createWithParallelFirstTouch<ValueType>(getMatrixRowCount()));
     }
 
     ValueType precision = storm::utility::convertNumber<ValueType>(env.solver().native().getPrecision());
@@ -120,7 +121,7 @@ bool NativeLinearEquationSolver<ValueType>::solveEquationsJacobi(Environment con
     STORM_LOG_INFO("Solving linear equation system (" << x.size() << " rows) with NativeLinearEquationSolver (Jacobi)");
 
     if (!this->cachedRowVector) {
-        this->cachedRowVector = std::make_unique<std::vector<ValueType>>(getMatrixRowCount());
+        this->cachedRowVector = std::make_unique<std::vector<ValueType>>(storm::utility::vector::createWithParallelFirstTouch<ValueType>(getMatrixRowCount()));
     }
 
     // Get a Jacobi decomposition of the matrix A.
@@ -361,6 +362,7 @@ bool NativeLinearEquationSolver<ValueType>::solveEquationsPower(Environment cons
     STORM_LOG_INFO("Solving linear equation system (" << x.size() << " rows) with NativeLinearEquationSolver (Power)");
     // Prepare the solution vectors.
     setUpViOperator();
+    viOperator->setParallelApply(env.solver().isUseIntelTbb());
 
     SolverGuarantee guarantee = SolverGuarantee::None;
     if (this->hasCustomTerminationCondition()) {
@@ -374,12 +376,26 @@ bool NativeLinearEquationSolver<ValueType>::solveEquationsPower(Environment cons
     }
 
     storm::solver::helper::ValueIterationHelper<ValueType, true> viHelper(viOperator);
+    viHelper.setTelemetry(env.solver().getTelemetry());
     uint64_t numIterations{0};
     auto viCallback = [&](SolverStatus const& current) {
         this->showProgressIterative(numIterations);
         return this->updateStatus(current, x, guarantee, numIterations, env.solver().native().getMaximalNumberOfIterations());
     };
     this->startMeasureProgress();
+    if constexpr (std::is_same_v<ValueType, double>) {
+        if (env.solver().native().isMixedPrecision() && guarantee == SolverGuarantee::None) {
+            // Obtain an initial guess in single precision. The double precision iterations below then only need to polish this guess.
+            auto approximationCallback = [&](SolverStatus const& current) {
+                this->showProgressIterative(numIterations);
+                return this->updateStatus(current, false, numIterations, env.solver().native().getMaximalNumberOfIterations());
+            };
+            helper::MixedPrecisionHelper<true> mixedPrecisionHelper(*this->A, viOperator);
+            mixedPrecisionHelper.approximate(x, b, numIterations, storm::utility::convertNumber<double>(env.solver().native().getPrecision()), {},
+                                             approximationCallback);
+            STORM_LOG_INFO("Single precision power method took " << numIterations << " iterations.");
+        }
+    }
     auto status = viHelper.VI(x, b, numIterations, env.solver().native().getRelativeTerminationCriterion(),
                               storm::utility::convertNumber<ValueType>(env.solver().native().getPrecision()), {}, viCallback,
                               env.solver().native().getPowerMethodMultiplicationStyle());
@@ -393,6 +409,51 @@ bool NativeLinearEquationSolver<ValueType>::solveEquationsPower(Environment cons
     return status == SolverStatus::Converged || status == SolverStatus::TerminatedEarly;
 }
 
+template<typename ValueType>
+bool NativeLinearEquationSolver<ValueType>::solveEquationsPowerBatch(Environment const& env, std::vector<std::vector<ValueType>>& x,
+                                                                     std::vector<std::vector<ValueType>> const& b) const {
+    uint64_t const batchSize = x.size();
+    STORM_LOG_INFO("Solving " << batchSize << " linear equation systems (" << this->A->getRowCount()
+                              << " rows) simultaneously with NativeLinearEquationSolver (Power)");
+    setUpViOperator();
+
+    // Bring the operands and offsets into the interleaved layout, so that the matrix is only traversed once per iteration for all systems.
+    uint64_t const numRows = this->A->getRowCount();
+    std::vector<ValueType> batchOperand(numRows * batchSize);
+    std::vector<ValueType> batchOffsets(numRows * batchSize);
+    for (uint64_t j = 0; j < batchSize; ++j) {
+        STORM_LOG_ASSERT(x[j].size() == numRows && b[j].size() == numRows, "Dimension mismatch.");
+        for (uint64_t row = 0; row < numRows; ++row) {
+            batchOperand[row * batchSize + j] = x[j][row];
+            batchOffsets[row * batchSize + j] = b[j][row];
+        }
+    }
+
+    storm::solver::helper::ValueIterationHelper<ValueType, true> viHelper(viOperator);
+    uint64_t numIterations{0};
+    auto viCallback = [&](SolverStatus const& current) {
+        this->showProgressIterative(numIterations);
+        return this->updateStatus(current, false, numIterations, env.solver().native().getMaximalNumberOfIterations());
+    };
+    this->startMeasureProgress();
+    auto status = viHelper.VIBatch(batchOperand, batchOffsets, batchSize, numIterations, env.solver().native().getRelativeTerminationCriterion(),
+                                   storm::utility::convertNumber<ValueType>(env.solver().native().getPrecision()), {}, viCallback,
+                                   env.solver().native().getPowerMethodMultiplicationStyle());
+    this->reportStatus(status, numIterations);
+
+    for (uint64_t j = 0; j < batchSize; ++j) {
+        for (uint64_t row = 0; row < numRows; ++row) {
+            x[j][row] = std::move(batchOperand[row * batchSize + j]);
+        }
+    }
+
+    if (!this->isCachingEnabled()) {
+        clearCache();
+    }
+
+    return status == SolverStatus::Converged || status == SolverStatus::TerminatedEarly;
+}
+
 template<typename ValueType>
 void preserveOldRelevantValues(std::vector<ValueType> const& allValues, storm::storage::BitVector const& relevantValues, std::vector<ValueType>& oldValues) {
     storm::utility::vector::selectVectorValues(oldValues, relevantValues, allValues);
@@ -427,24 +488,61 @@ bool NativeLinearEquationSolver<ValueType>::solveEquationsIntervalIteration(Envi
     setUpViOperator();
     helper::IntervalIterationHelper<ValueType, true> iiHelper(viOperator);
     auto prec = storm::utility::convertNumber<ValueType>(env.solver().native().getPrecision());
-    auto lowerBoundsCallback = [&](std::vector<ValueType>& vector) { this->createLowerBoundsVector(vector); };
-    auto upperBoundsCallback = [&](std::vector<ValueType>& vector) { this->createUpperBoundsVector(vector); };
-
     uint64_t numIterations{0};
+    this->startMeasureProgress();
+
+    // If requested, we derive tighter initial bounds from a single precision approximation of the solution.
+    std::optional<helper::MixedPrecisionHelper<true>> mixedPrecisionHelper;
+    std::vector<double> approximation;
+    if constexpr (std::is_same_v<ValueType, double>) {
+        if (env.solver().native().isMixedPrecision()) {
+            auto approximationCallback = [&](SolverStatus const& current) {
+                this->showProgressIterative(numIterations);
+                return this->updateStatus(current, false, numIterations, env.solver().native().getMaximalNumberOfIterations());
+            };
+            mixedPrecisionHelper.emplace(*this->A, viOperator);
+            approximation.resize(x.size());
+            this->createLowerBoundsVector(approximation);
+            mixedPrecisionHelper->approximate(approximation, b, numIterations, prec, {}, approximationCallback);
+            STORM_LOG_INFO("Single precision power method took " << numIterations << " iterations.");
+        }
+    }
+    auto lowerBoundsCallback = [&](std::vector<ValueType>& vector) {
+        this->createLowerBoundsVector(vector);
+        if constexpr (std::is_same_v<ValueType, double>) {
+            if (mixedPrecisionHelper) {
+                mixedPrecisionHelper->tightenLowerBounds(vector, approximation, b);
+            }
+        }
+    };
+    auto upperBoundsCallback = [&](std::vector<ValueType>& vector) {
+        this->createUpperBoundsVector(vector);
+        if constexpr (std::is_same_v<ValueType, double>) {
+            if (mixedPrecisionHelper) {
+                mixedPrecisionHelper->tightenUpperBounds(vector, approximation, b);
+            }
+        }
+    };
+
+    // If the solver is aborted, the (center of the) current bounds still yield a sound approximation.
+    std::optional<double> abortedErrorBound;
     auto iiCallback = [&](helper::IIData<ValueType> const& data) {
         this->showProgressIterative(numIterations);
         bool terminateEarly = this->hasCustomTerminationCondition() && this->getTerminationCondition().terminateNow(data.x, SolverGuarantee::LessOrEqual) &&
                               this->getTerminationCondition().terminateNow(data.y, SolverGuarantee::GreaterOrEqual);
-        return this->updateStatus(data.status, terminateEarly, numIterations, env.solver().native().getMaximalNumberOfIterations());
+        auto status = this->updateStatus(data.status, terminateEarly, numIterations, env.solver().native().getMaximalNumberOfIterations());
+        if (status == SolverStatus::Aborted) {
+            abortedErrorBound = helper::getIntervalIterationErrorBound(data);
+        }
+        return status;
     };
     std::optional<storm::storage::BitVector> optionalRelevantValues;
     if (this->hasRelevantValues()) {
         optionalRelevantValues = this->getRelevantValues();
     }
-    this->startMeasureProgress();
     auto status = iiHelper.II(x, b, numIterations, env.solver().native().getRelativeTerminationCriterion(), prec, lowerBoundsCallback, upperBoundsCallback, {},
                               iiCallback, optionalRelevantValues);
-    this->reportStatus(status, numIterations);
+    this->reportStatus(status, numIterations, abortedErrorBound);
 
     if (!this->isCachingEnabled()) {
         clearCache();
@@ -507,6 +605,7 @@ bool NativeLinearEquationSolver<ValueType>::solveEquationsOptimisticValueIterati
     setUpViOperator();
 
     helper::OptimisticValueIterationHelper<ValueType, true> oviHelper(viOperator);
+    oviHelper.setPipelined(env.solver().ovi().isPipelined());
     auto prec = storm::utility::convertNumber<ValueType>(env.solver().native().getPrecision());
     std::optional<ValueType> lowerBound, upperBound;
     if (this->hasLowerBound()) {
@@ -548,10 +647,12 @@ bool NativeLinearEquationSolver<ValueType>::solveEquationsRationalSearch(Environ
         exactOp = viOperator;
         impreciseOp = std::make_shared<helper::ValueIterationOperator<double, true>>();
         impreciseOp->setMatrixBackwards(this->A->template toValueType<double>());
+        impreciseOp->setParallelApply(viOperator->isParallelApplySet());
     } else {
         impreciseOp = viOperator;
         exactOp = std::make_shared<helper::ValueIterationOperator<storm::RationalNumber, true>>();
         exactOp->setMatrixBackwards(this->A->template toValueType<storm::RationalNumber>());
+        exactOp->setParallelApply(viOperator->isParallelApplySet());
     }
 
     storm::solver::helper::RationalSearchHelper<ValueType, storm::RationalNumber, double, true> rsHelper(exactOp, impreciseOp);
@@ -627,6 +728,17 @@ bool NativeLinearEquationSolver<ValueType>::internalSolveEquations(Environment c
     return false;
 }
 
+template<typename ValueType>
+bool NativeLinearEquationSolver<ValueType>::internalSolveEquationsBatch(Environment const& env, std::vector<std::vector<ValueType>>& x,
+                                                                        std::vector<std::vector<ValueType>> const& b) const {
+    // Termination conditions refer to a single solution vector, so we can only solve the systems simultaneously without them.
+    if (x.size() > 1 && !this->hasCustomTerminationCondition() &&
+        getMethod(env, storm::NumberTraits<ValueType>::IsExact || env.solver().isForceExact()) == NativeLinearEquationSolverMethod::Power) {
+        return solveEquationsPowerBatch(env, x, b);
+    }
+    return LinearEquationSolver<ValueType>::internalSolveEquationsBatch(env, x, b);
+}
+
 template<typename ValueType>
 LinearEquationSolverProblemFormat NativeLinearEquationSolver<ValueType>::getEquationProblemFormat(Environment const& env) const {
     auto method = getMethod(env, storm::NumberTraits<ValueType>::IsExact || env.solver().isForceExact());
@@ -0,0 +1,217 @@
+#include "storm/solver/PortfolioSmtSolver.h"
+
+#include <condition_variable>
+#include <mutex>
+#include <optional>
+
+#include "storm/exceptions/InvalidArgumentException.h"
+#include "storm/utility/macros.h"
+
+namespace storm {
+namespace solver {
+
+PortfolioSmtSolver::PortfolioSmtSolver(storm::expressions::ExpressionManager& manager, std::vector<std::unique_ptr<SmtSolver>>&& solvers)
+    : SmtSolver(manager), solvers(std::move(solvers)), lastAnsweringSolver(0) {
+    STORM_LOG_THROW(!this->solvers.empty(), storm::exceptions::InvalidArgumentException, "A portfolio needs at least one SMT solver.");
+    for (auto const& solver : this->solvers) {
+        STORM_LOG_THROW(&solver->getManager() == &manager, storm::exceptions::InvalidArgumentException,
+                        "The solvers of a portfolio need to use the same expression manager.");
+    }
+}
+
+PortfolioSmtSolver::~PortfolioSmtSolver() {
+    if (!runningQueries.empty()) {
+        interrupt();
+        synchronize();
+    }
+}
+
+void PortfolioSmtSolver::push() {
+    synchronize();
+    for (auto& solver : solvers) {
+        solver->push();
+    }
+}
+
+void PortfolioSmtSolver::pop() {
+    synchronize();
+    for (auto& solver : solvers) {
+        solver->pop();
+    }
+}
+
+void PortfolioSmtSolver::pop(uint_fast64_t n) {
+    synchronize();
+    for (auto& solver : solvers) {
+        solver->pop(n);
+    }
+}
+
+void PortfolioSmtSolver::reset() {
+    synchronize();
+    for (auto& solver : solvers) {
+        solver->reset();
+    }
+}
+
+void PortfolioSmtSolver::add(storm::expressions::Expression const& assertion) {
+    synchronize();
+    for (auto& solver : solvers) {
+        solver->add(assertion);
+    }
+}
+
+SmtSolver::CheckResult PortfolioSmtSolver::check() {
+    return checkPortfolio([](SmtSolver& solver) { return solver.check(); });
+}
+
+SmtSolver::CheckResult PortfolioSmtSolver::checkWithAssumptions(std::set<storm::expressions::Expression> const& assumptions) {
+    // The backends that lose the race may still be running after we return, so the query needs to own the assumptions.
+    auto sharedAssumptions = std::make_shared<std::set<storm::expressions::Expression>>(assumptions);
+    return checkPortfolio([sharedAssumptions](SmtSolver& solver) { return solver.checkWithAssumptions(*sharedAssumptions); });
+}
+
+SmtSolver::CheckResult PortfolioSmtSolver::checkWithAssumptions(std::initializer_list<storm::expressions::Expression> const& assumptions) {
+    return checkWithAssumptions(std::set<storm::expressions::Expression>(assumptions));
+}
+
+storm::expressions::SimpleValuation PortfolioSmtSolver::getModelAsValuation() {
+    return getAnsweringSolver().getModelAsValuation();
+}
+
+std::shared_ptr<SmtSolver::ModelReference> PortfolioSmtSolver::getModel() {
+    return getAnsweringSolver().getModel();
+}
+
+std::vector<storm::expressions::SimpleValuation> PortfolioSmtSolver::allSat(std::vector<storm::expressions::Variable> const& important) {
+    synchronize();
+    return solvers.front()->allSat(important);
+}
+
+uint_fast64_t PortfolioSmtSolver::allSat(std::vector<storm::expressions::Variable> const& important,
+                                         std::function<bool(storm::expressions::SimpleValuation&)> const& callback) {
+    synchronize();
+    return solvers.front()->allSat(important, callback);
+}
+
+uint_fast64_t PortfolioSmtSolver::allSat(std::vector<storm::expressions::Variable> const& important, std::function<bool(ModelReference&)> const& callback) {
+    synchronize();
+    return solvers.front()->allSat(important, callback);
+}
+
+std::vector<storm::expressions::Expression> PortfolioSmtSolver::getUnsatCore() {
+    return getAnsweringSolver().getUnsatCore();
+}
+
+std::vector<storm::expressions::Expression> PortfolioSmtSolver::getUnsatAssumptions() {
+    return getAnsweringSolver().getUnsatAssumptions();
+}
+
+void PortfolioSmtSolver::setInterpolationGroup(uint_fast64_t group) {
+    synchronize();
+    for (auto& solver : solvers) {
+        solver->setInterpolationGroup(group);
+    }
+}
+
+storm::expressions::Expression PortfolioSmtSolver::getInterpolant(std::vector<uint_fast64_t> const& groupsA) {
+    return getAnsweringSolver().getInterpolant(groupsA);
+}
+
+bool PortfolioSmtSolver::setTimeout(uint_fast64_t milliseconds) {
+    synchronize();
+    bool result = false;
+    for (auto& solver : solvers) {
+        result |= solver->setTimeout(milliseconds);
+    }
+    return result;
+}
+
+bool PortfolioSmtSolver::unsetTimeout() {
+    synchronize();
+    bool result = false;
+    for (auto& solver : solvers) {
+        result |= solver->unsetTimeout();
+    }
+    return result;
+}
+
+bool PortfolioSmtSolver::interrupt() {
+    bool result = false;
+    for (auto& solver : solvers) {
+        result |= solver->interrupt();
+    }
+    return result;
+}
+
+std::string PortfolioSmtSolver::getSmtLibString() const {
+    return solvers.front()->getSmtLibString();
+}
+
+uint64_t PortfolioSmtSolver::getIndexOfLastAnsweringSolver() const {
+    return lastAnsweringSolver;
+}
+
+SmtSolver::CheckResult PortfolioSmtSolver::checkPortfolio(std::function<CheckResult(SmtSolver&)> const& query) {
+    synchronize();
+
+    // The state of the query is shared with the backend threads, which may outlive this call.
+    struct QueryState {
+        std::mutex mutex;
+        std::condition_variable finished;
+        std::vector<bool> running;
+        uint64_t numberOfFinishedSolvers = 0;
+        std::optional<uint64_t> answeringSolver;
+        CheckResult result = CheckResult::Unknown;
+    };
+    auto state = std::make_shared<QueryState>();
+    state->running.assign(solvers.size(), true);
+
+    for (uint64_t index = 0; index < solvers.size(); ++index) {
+        runningQueries.emplace_back([state, query, index, &solver = *solvers[index]]() {
+            CheckResult result = CheckResult::Unknown;
+            try {
+                result = query(solver);
+            } catch (std::exception const& e) {
+                STORM_LOG_WARN("Solver " << index << " of the SMT portfolio failed: " << e.what());
+            }
+            {
+                std::lock_guard<std::mutex> lock(state->mutex);
+                state->running[index] = false;
+                ++state->numberOfFinishedSolvers;
+                if (!state->answeringSolver && result != CheckResult::Unknown) {
+                    state->answeringSolver = index;
+                    state->result = result;
+                }
+            }
+            state->finished.notify_all();
+        });
+    }
+
+    std::unique_lock<std::mutex> lock(state->mutex);
+    state->finished.wait(lock, [&] { return state->answeringSolver.has_value() || state->numberOfFinishedSolvers == solvers.size(); });
+    // Stop the backends that are still busy. The ones that can not be interrupted are waited for upon the next operation.
+    for (uint64_t index = 0; index < solvers.size(); ++index) {
+        if (state->running[index]) {
+            solvers[index]->interrupt();
+        }
+    }
+    lastAnsweringSolver = state->answeringSolver.value_or(0);
+    STORM_LOG_DEBUG("SMT portfolio query answered by solver " << lastAnsweringSolver << ".");
+    return state->result;
+}
+
+void PortfolioSmtSolver::synchronize() {
+    for (auto& query : runningQueries) {
+        query.join();
+    }
+    runningQueries.clear();
+}
+
+SmtSolver& PortfolioSmtSolver::getAnsweringSolver() {
+    // The answering solver is idle, so there is no need to wait for the others.
+    return *solvers[lastAnsweringSolver];
+}
+
+}  // namespace solver
+}  // namespace storm
@@ -0,0 +1,107 @@
+#pragma once
+
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include "storm/solver/SmtSolver.h"
+
+namespace storm {
+namespace solver {
+
+/*!
+ * An SMT solver that maintains the same assertions in several backend solvers (possibly of different kinds or configurations) and answers
+ * satisfiability queries by running all backends in parallel, taking the first definite (sat or unsat) answer. Models, unsat cores and the
+ * like are then retrieved from the backend that gave the answer.
+ *
+ * Backends that lost the race are interrupted if they support it (see SmtSolver::interrupt). Otherwise, they keep running in the background
+ * and the next operation on the portfolio waits for them to finish.
+ */
+class PortfolioSmtSolver : public SmtSolver {
+   public:
+    /*!
+     * Creates a portfolio of the given solvers.
+     *
+     * @param manager The expression manager responsible for all expressions that interact with this solver.
+     * @param solvers The backend solvers. All of them need to use the given manager and need to be in their initial state.
+     */
+    PortfolioSmtSolver(storm::expressions::ExpressionManager& manager, std::vector<std::unique_ptr<SmtSolver>>&& solvers);
+
+    virtual ~PortfolioSmtSolver();
+
+    virtual void push() override;
+
+    virtual void pop() override;
+
+    virtual void pop(uint_fast64_t n) override;
+
+    virtual void reset() override;
+
+    virtual void add(storm::expressions::Expression const& assertion) override;
+
+    virtual CheckResult check() override;
+
+    virtual CheckResult checkWithAssumptions(std::set<storm::expressions::Expression> const& assumptions) override;
+
+    virtual CheckResult checkWithAssumptions(std::initializer_list<storm::expressions::Expression> const& assumptions) override;
+
+    virtual storm::expressions::SimpleValuation getModelAsValuation() override;
+
+    virtual std::shared_ptr<SmtSolver::ModelReference> getModel() override;
+
+    virtual std::vector<storm::expressions::SimpleValuation> allSat(std::vector<storm::expressions::Variable> const& important) override;
+
+    virtual uint_fast64_t allSat(std::vector<storm::expressions::Variable> const& important,
+                                 std::function<bool(storm::expressions::SimpleValuation&)> const& callback) override;
+
+    virtual uint_fast64_t allSat(std::vector<storm::expressions::Variable> const& important, std::function<bool(ModelReference&)> const& callback) override;
+
+    virtual std::vector<storm::expressions::Expression> getUnsatCore() override;
+
+    virtual std::vector<storm::expressions::Expression> getUnsatAssumptions() override;
+
+    virtual void setInterpolationGroup(uint_fast64_t group) override;
+
+    virtual storm::expressions::Expression getInterpolant(std::vector<uint_fast64_t> const& groupsA) override;
+
+    virtual bool setTimeout(uint_fast64_t milliseconds) override;
+
+    virtual bool unsetTimeout() override;
+
+    virtual bool interrupt() override;
+
+    virtual std::string getSmtLibString() const override;
+
+    /*!
+     * Retrieves the index of the backend that gave the answer to the last satisfiability query.
+     */
+    uint64_t getIndexOfLastAnsweringSolver() const;
+
+   private:
+    /*!
+     * Runs the given query on all backends in parallel and returns the first definite answer (or unknown if no backend gives one).
+     */
+    CheckResult checkPortfolio(std::function<CheckResult(SmtSolver&)> const& query);
+
+    /*!
+     * Waits until all backends have finished the previous query.
+     */
+    void synchronize();
+
+    /*!
+     * Retrieves the backend that gave the answer to the last satisfiability query.
+     */
+    SmtSolver& getAnsweringSolver();
+
+    // The backend solvers.
+    std::vector<std::unique_ptr<SmtSolver>> solvers;
+
+    // The threads of the previous query that might still be running.
+    std::vector<std::thread> runningQueries;
+
+    // The index of the backend that gave the answer to the last query.
+    uint64_t lastAnsweringSolver;
+};
+
+}  // namespace solver
+}  // namespace storm
@@ -92,6 +92,10 @@ bool SmtSolver::unsetTimeout() {
     return false;
 }
 
+bool SmtSolver::interrupt() {
+    return false;
+}
+
 std::string SmtSolver::getSmtLibString() const {
     STORM_LOG_THROW(false, storm::exceptions::NotSupportedException, "This solver does not support exporting the assertions in the SMT-LIB format.");
     return "ERROR";
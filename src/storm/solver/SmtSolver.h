@@ -289,6 +289,15 @@ class SmtSolver {
      */
     virtual bool unsetTimeout();
 
+    /*!
+     * If supported by the solver, this requests a currently running satisfiability query to terminate as soon as
+     * possible, in which case the query yields an unknown result. In contrast to all other methods, this may be
+     * called from a different thread than the one executing the query.
+     *
+     * @return True iff the solver supports interruption.
+     */
+    virtual bool interrupt();
+
     /*!
      * If supported by the solver, this function returns the current assertions in the SMT-LIB format.
      *
@@ -145,6 +145,11 @@ void SolveGoal<ValueType, SolutionType>::setRelevantValues(storm::storage::BitVe
     relevantValueVector = std::move(values);
 }
 
+template<typename ValueType, typename SolutionType>
+storm::models::sparse::AnalysisCache<ValueType>* SolveGoal<ValueType, SolutionType>::getAnalysisCache() const {
+    return analysisCache;
+}
+
 template class SolveGoal<double>;
 template class SolveGoal<storm::RationalNumber>;
 template class SolveGoal<storm::RationalFunction>;
@@ -31,6 +31,9 @@ namespace models {
 namespace sparse {
 template<typename ValueType, typename RewardModelType>
 class Model;
+
+template<typename ValueType>
+class AnalysisCache;
 }
 }  // namespace models
 
@@ -57,6 +60,7 @@ class SolveGoal {
             threshold = checkTask.getBoundThreshold();
         }
         robustAgainstUncertainty = checkTask.getRobustUncertainty();
+        analysisCache = &model.getAnalysisCache();
     }
 
     SolveGoal(bool minimize);
@@ -94,6 +98,12 @@ class SolveGoal {
     void restrictRelevantValues(storm::storage::BitVector const& filter);
     void setRelevantValues(storm::storage::BitVector&& values);
 
+    /*!
+     * Retrieves the analysis cache of the model this goal was created for (or nullptr if the goal was not created for a model).
+     * The cache only takes effect for analyses on the transition matrix of that model.
+     */
+    storm::models::sparse::AnalysisCache<ValueType>* getAnalysisCache() const;
+
    private:
     boost::optional<OptimizationDirection> optimizationDirection;
 
@@ -101,6 +111,7 @@ class SolveGoal {
     boost::optional<SolutionType> threshold;
     boost::optional<storm::storage::BitVector> relevantValueVector;
     bool robustAgainstUncertainty = true;  // If set to false, the uncertainty is interpreted as controllable.
+    storm::models::sparse::AnalysisCache<ValueType>* analysisCache = nullptr;
 };
 
 template<typename ValueType, typename MatrixType, typename SolutionType>
@@ -23,7 +23,7 @@ std::string toString(MinMaxMethod m) {
         case MinMaxMethod::ViToPi:
             return "vi-to-pi";
         case MinMaxMethod::Acyclic:
-            return "vi-to-pi";
+            return "acyclic";
     }
     return "invalid";
 }
@@ -34,6 +34,8 @@ std::string toString(MultiplierType t) {
             return "Native";
         case MultiplierType::Gmmxx:
             return "Gmmxx";
+        case MultiplierType::Sliced:
+            return "Sliced";
     }
     return "invalid";
 }
@@ -44,6 +46,10 @@ std::string toString(GameMethod m) {
             return "valueiteration";
         case GameMethod::PolicyIteration:
             return "PolicyIteration";
+        case GameMethod::Topological:
+            return "topological";
+        case GameMethod::IntervalIteration:
+            return "intervaliteration";
     }
     return "invalid";
 }
@@ -72,6 +78,18 @@ std::string toString(MaBoundedReachabilityMethod m) {
     return "invalid";
 }
 
+std::string toString(CtmcTransientMethod m) {
+    switch (m) {
+        case CtmcTransientMethod::Uniformization:
+            return "unif";
+        case CtmcTransientMethod::AdaptiveUniformization:
+            return "adaptive";
+        case CtmcTransientMethod::SymbolicUniformization:
+            return "symbolic";
+    }
+    return "invalid";
+}
+
 std::string toString(LpSolverType t) {
     switch (t) {
         case LpSolverType::Gurobi:
@@ -110,6 +128,8 @@ std::string toString(SmtSolverType t) {
             return "Z3";
         case SmtSolverType::Mathsat:
             return "Mathsat";
+        case SmtSolverType::Portfolio:
+            return "Portfolio";
     }
     return "invalid";
 }
@@ -187,5 +207,17 @@ std::string toString(EigenLinearEquationSolverPreconditioner t) {
     }
     return "invalid";
 }
+
+std::string toString(EigenLinearEquationSolverOrdering t) {
+    switch (t) {
+        case EigenLinearEquationSolverOrdering::Colamd:
+            return "colamd";
+        case EigenLinearEquationSolverOrdering::Amd:
+            return "amd";
+        case EigenLinearEquationSolverOrdering::Natural:
+            return "natural";
+    }
+    return "invalid";
+}
 }  // namespace solver
 }  // namespace storm
@@ -6,14 +6,16 @@
 namespace storm {
 namespace solver {
 ExtendEnumsWithSelectionField(MinMaxMethod, ValueIteration, PolicyIteration, LinearProgramming, Topological, RationalSearch, IntervalIteration,
-                              SoundValueIteration, OptimisticValueIteration, ViToPi, Acyclic) ExtendEnumsWithSelectionField(MultiplierType, Native, Gmmxx)
-    ExtendEnumsWithSelectionField(GameMethod, PolicyIteration, ValueIteration)
+                              SoundValueIteration, OptimisticValueIteration, ViToPi, Acyclic)
+    ExtendEnumsWithSelectionField(MultiplierType, Native, Gmmxx, Sliced)
+    ExtendEnumsWithSelectionField(GameMethod, PolicyIteration, ValueIteration, Topological, IntervalIteration)
         ExtendEnumsWithSelectionField(LraMethod, LinearProgramming, ValueIteration, GainBiasEquations, LraDistributionEquations)
             ExtendEnumsWithSelectionField(MaBoundedReachabilityMethod, Imca, UnifPlus)
+                ExtendEnumsWithSelectionField(CtmcTransientMethod, Uniformization, AdaptiveUniformization, SymbolicUniformization)
 
                 ExtendEnumsWithSelectionField(LpSolverType, Gurobi, Glpk, Z3, Soplex)
                     ExtendEnumsWithSelectionField(EquationSolverType, Native, Gmmxx, Eigen, Elimination, Topological, Acyclic)
-                        ExtendEnumsWithSelectionField(SmtSolverType, Z3, Mathsat)
+                        ExtendEnumsWithSelectionField(SmtSolverType, Z3, Mathsat, Portfolio)
 
                             ExtendEnumsWithSelectionField(NativeLinearEquationSolverMethod, Jacobi, GaussSeidel, SOR, WalkerChae, Power, SoundValueIteration,
                                                           OptimisticValueIteration, IntervalIteration, RationalSearch)
@@ -21,6 +23,7 @@ ExtendEnumsWithSelectionField(MinMaxMethod, ValueIteration, PolicyIteration, Lin
                                     ExtendEnumsWithSelectionField(GmmxxLinearEquationSolverPreconditioner, Ilu, Diagonal, None)
                                         ExtendEnumsWithSelectionField(EigenLinearEquationSolverMethod, SparseLU, Bicgstab, DGmres, Gmres)
                                             ExtendEnumsWithSelectionField(EigenLinearEquationSolverPreconditioner, Ilu, Diagonal, None)
+                                                ExtendEnumsWithSelectionField(EigenLinearEquationSolverOrdering, Colamd, Amd, Natural)
 }
 }  // namespace storm
 
@@ -0,0 +1,50 @@
+#include "storm/solver/SolverTelemetry.h"
+
+#include <cmath>
+#include <limits>
+#include <map>
+
+#include "storm/io/file.h"
+
+namespace storm {
+namespace solver {
+
+FileSolverTelemetry::FileSolverTelemetry(std::string const& filename) {
+    storm::utility::openFile(filename, stream);
+    stream.precision(std::numeric_limits<double>::max_digits10);
+}
+
+FileSolverTelemetry::~FileSolverTelemetry() {
+    storm::utility::closeFile(stream);
+}
+
+void FileSolverTelemetry::iterationCompleted(char const* method, uint64_t iteration, double residual, double seconds) {
+    std::lock_guard<std::mutex> lock(mutex);
+    stream << R"({"event":"iteration","method":")" << method << R"(","iteration":)" << iteration << R"(,"residual":)";
+    // JSON has no representation of infinity (e.g. in the first iteration when starting from infinite bounds).
+    if (std::isfinite(residual)) {
+        stream << residual;
+    } else {
+        stream << "null";
+    }
+    stream << R"(,"time":)" << seconds << "}\n";
+}
+
+void FileSolverTelemetry::sccSolved(uint64_t numberOfStates, uint64_t iterations, double seconds) {
+    std::lock_guard<std::mutex> lock(mutex);
+    stream << R"({"event":"scc","states":)" << numberOfStates << R"(,"iterations":)" << iterations << R"(,"time":)" << seconds << "}\n";
+}
+
+std::shared_ptr<SolverTelemetry> FileSolverTelemetry::getForFile(std::string const& filename) {
+    static std::mutex telemetriesMutex;
+    static std::map<std::string, std::shared_ptr<SolverTelemetry>> telemetries;
+    std::lock_guard<std::mutex> lock(telemetriesMutex);
+    auto& telemetry = telemetries[filename];
+    if (!telemetry) {
+        telemetry = std::make_shared<FileSolverTelemetry>(filename);
+    }
+    return telemetry;
+}
+
+}  // namespace solver
+}  // namespace storm
@@ -0,0 +1,67 @@
+#pragma once
+
+#include <cstdint>
+#include <fstream>
+#include <memory>
+#include <mutex>
+#include <string>
+
+namespace storm {
+namespace solver {
+
+/*!
+ * Receives iteration-level diagnostics from iterative solvers. A telemetry object can be set in the solver environment, in which case
+ * - value iteration reports the residual (the largest difference between two consecutive iterates) and the duration of each iteration, and
+ * - the topological solvers report the size, the number of iterations and the duration of each (non-trivial) SCC they solve.
+ * Solvers may run concurrently (e.g. SCCs of the same depth), so implementations need to be thread-safe.
+ */
+class SolverTelemetry {
+   public:
+    virtual ~SolverTelemetry() = default;
+
+    /*!
+     * Invoked after each iteration of an iterative method.
+     *
+     * @param method The name of the method.
+     * @param iteration The number of the iteration (counting from 1).
+     * @param residual The largest (relative, if the method uses a relative termination criterion) difference between the old and the new iterate.
+     * @param seconds The duration of the iteration, i.e., of the operator application and the convergence check.
+     */
+    virtual void iterationCompleted(char const* method, uint64_t iteration, double residual, double seconds) = 0;
+
+    /*!
+     * Invoked whenever a topological solver has solved a (non-trivial) SCC.
+     *
+     * @param numberOfStates The number of states (i.e. rows or row groups) of the SCC.
+     * @param iterations The number of iterations the underlying solver needed for the SCC (zero if the solver is not iterative).
+     * @param seconds The duration of solving the SCC, including setting up the subsystem.
+     */
+    virtual void sccSolved(uint64_t numberOfStates, uint64_t iterations, double seconds) = 0;
+};
+
+/*!
+ * Writes all diagnostics to a file in the JSON lines format, i.e., one JSON object per line, for example
+ *   {"event":"iteration","method":"value iteration","iteration":3,"residual":0.0125,"time":0.0004}
+ *   {"event":"scc","states":120,"iterations":57,"time":0.0213}
+ */
+class FileSolverTelemetry : public SolverTelemetry {
+   public:
+    explicit FileSolverTelemetry(std::string const& filename);
+    virtual ~FileSolverTelemetry();
+
+    virtual void iterationCompleted(char const* method, uint64_t iteration, double residual, double seconds) override;
+    virtual void sccSolved(uint64_t numberOfStates, uint64_t iterations, double seconds) override;
+
+    /*!
+     * Retrieves the telemetry writing to the given file. All requests for the same file share the same object, so that the file is only
+     * truncated once per run.
+     */
+    static std::shared_ptr<SolverTelemetry> getForFile(std::string const& filename);
+
+   private:
+    std::mutex mutex;
+    std::ofstream stream;
+};
+
+}  // namespace solver
+}  // namespace storm
@@ -100,6 +100,30 @@ void SoplexLpSolver<ValueType, RawMode>::addConstraint(std::string const& name,
         STORM_LOG_TRACE("Adding constraint " << (name == "" ? std::to_string(nextConstraintIndex) : name) << " to SoplexLpSolver:\n"
                                              << "\t" << constraint);
     }
+    if constexpr (std::is_same_v<ValueType, storm::RationalNumber>) {
+        solver.addRowRational(createRow(constraint));
+    } else {
+        solver.addRowReal(createRow(constraint));
+    }
+    ++nextConstraintIndex;
+}
+
+template<typename ValueType, bool RawMode>
+void SoplexLpSolver<ValueType, RawMode>::addConstraints(std::vector<Constraint> const& constraints) {
+    TypedLPRowSet rows(constraints.size());
+    for (auto const& constraint : constraints) {
+        rows.add(createRow(constraint));
+    }
+    if constexpr (std::is_same_v<ValueType, storm::RationalNumber>) {
+        solver.addRowsRational(rows);
+    } else {
+        solver.addRowsReal(rows);
+    }
+    nextConstraintIndex += constraints.size();
+}
+
+template<typename ValueType, bool RawMode>
+typename SoplexLpSolver<ValueType, RawMode>::TypedLPRow SoplexLpSolver<ValueType, RawMode>::createRow(Constraint const& constraint) const {
     using SoplexValueType = std::conditional_t<std::is_same_v<ValueType, storm::RationalNumber>, soplex::Rational, soplex::Real>;
     // Extract constraint data
     SoplexValueType rhs;
@@ -167,11 +191,7 @@ void SoplexLpSolver<ValueType, RawMode>::addConstraint(std::string const& name,
         default:
             STORM_LOG_ASSERT(false, "Illegal operator in LP solver constraint.");
     }
-    if constexpr (std::is_same_v<ValueType, storm::RationalNumber>) {
-        solver.addRowRational(LPRowRational(l, row, r));
-    } else {
-        solver.addRowReal(LPRow(l, row, r));
-    }
+    return TypedLPRow(l, row, r);
 }
 
 template<typename ValueType, bool RawMode>
@@ -190,6 +210,8 @@ void SoplexLpSolver<ValueType, RawMode>::optimize() const {
         solver.setIntParam(SoPlex::OBJSENSE, SoPlex::OBJSENSE_MAXIMIZE);
     }
 
+    // Clear the solution of a previous call. Soplex keeps the previous basis, so re-optimizing a modified model is warm-started.
+    primalSolution = TypedDVector(0);
     status = solver.optimize();
     STORM_LOG_TRACE("soplex status " << status);
     if (status == soplex::SPxSolver::ERROR) {
@@ -287,12 +309,42 @@ void SoplexLpSolver<ValueType, RawMode>::writeModelToFile(std::string const& fil
 
 template<typename ValueType, bool RawMode>
 void SoplexLpSolver<ValueType, RawMode>::push() {
-    STORM_LOG_THROW(false, storm::exceptions::NotImplementedException, "Push/Pop not supported on SoPlex");
+    incrementalData.push_back({nextVariableIndex, nextConstraintIndex});
 }
 
 template<typename ValueType, bool RawMode>
 void SoplexLpSolver<ValueType, RawMode>::pop() {
-    STORM_LOG_THROW(false, storm::exceptions::NotImplementedException, "Push/Pop not supported on SoPlex");
+    STORM_LOG_THROW(!incrementalData.empty(), storm::exceptions::InvalidStateException, "Tried to pop from a solver without pushing before.");
+    IncrementalLevel const& lvl = incrementalData.back();
+    // Soplex removes the given range of rows (columns) including both bounds.
+    if (nextConstraintIndex > lvl.firstConstraintIndex) {
+        if constexpr (std::is_same_v<ValueType, storm::RationalNumber>) {
+            solver.removeRowRangeRational(lvl.firstConstraintIndex, nextConstraintIndex - 1);
+        } else {
+            solver.removeRowRangeReal(lvl.firstConstraintIndex, nextConstraintIndex - 1);
+        }
+        nextConstraintIndex = lvl.firstConstraintIndex;
+    }
+    if (nextVariableIndex > lvl.firstVariableIndex) {
+        if constexpr (std::is_same_v<ValueType, storm::RationalNumber>) {
+            solver.removeColRangeRational(lvl.firstVariableIndex, nextVariableIndex - 1);
+        } else {
+            solver.removeColRangeReal(lvl.firstVariableIndex, nextVariableIndex - 1);
+        }
+        if constexpr (!RawMode) {
+            for (auto it = variableToIndexMap.begin(); it != variableToIndexMap.end();) {
+                if (it->second >= lvl.firstVariableIndex) {
+                    it = variableToIndexMap.erase(it);
+                } else {
+                    ++it;
+                }
+            }
+        }
+        nextVariableIndex = lvl.firstVariableIndex;
+    }
+    incrementalData.pop_back();
+    primalSolution = TypedDVector(0);
+    this->currentModelHasBeenOptimized = false;
 }
 
 #else
@@ -337,6 +389,12 @@ void SoplexLpSolver<ValueType, RawMode>::addConstraint(std::string const&, Const
                                                           "requires this support. Please choose a version of support with Soplex support.";
 }
 
+template<typename ValueType, bool RawMode>
+void SoplexLpSolver<ValueType, RawMode>::addConstraints(std::vector<Constraint> const&) {
+    throw storm::exceptions::NotImplementedException() << "This version of storm was compiled without support for Soplex. Yet, a method was called that "
+                                                          "requires this support. Please choose a version of support with Soplex support.";
+}
+
 template<typename ValueType, bool RawMode>
 void SoplexLpSolver<ValueType, RawMode>::addIndicatorConstraint(std::string const&, Variable, bool, Constraint const&) {
     throw storm::exceptions::NotImplementedException() << "This version of storm was compiled without support for Soplex. Yet, a method was called that "
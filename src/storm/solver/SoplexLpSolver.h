@@ -2,6 +2,7 @@
 
 #include <map>
 #include <type_traits>
+#include <vector>
 #include "storm/solver/LpSolver.h"
 // To detect whether the usage of Soplex is possible, this include is neccessary.
 #include "storm-config.h"
@@ -64,6 +65,7 @@ class SoplexLpSolver : public LpSolver<ValueType, RawMode> {
 
     // Methods to add constraints
     virtual void addConstraint(std::string const& name, Constraint const& constraint) override;
+    virtual void addConstraints(std::vector<Constraint> const& constraints) override;
     virtual void addIndicatorConstraint(std::string const& name, Variable indicatorVariable, bool indicatorValue, Constraint const& constraint) override;
 
     // Methods to optimize and retrieve optimality status.
@@ -95,6 +97,13 @@ class SoplexLpSolver : public LpSolver<ValueType, RawMode> {
 #ifdef STORM_HAVE_SOPLEX
     typedef std::conditional_t<std::is_same_v<ValueType, double>, soplex::DVector, soplex::DVectorRational> TypedDVector;
     typedef std::conditional_t<std::is_same_v<ValueType, double>, soplex::DSVector, soplex::DSVectorRational> TypedDSVector;
+    typedef std::conditional_t<std::is_same_v<ValueType, double>, soplex::LPRowReal, soplex::LPRowRational> TypedLPRow;
+    typedef std::conditional_t<std::is_same_v<ValueType, double>, soplex::LPRowSetReal, soplex::LPRowSetRational> TypedLPRowSet;
+
+    /*!
+     * Translates the given constraint into a soplex row.
+     */
+    TypedLPRow createRow(Constraint const& constraint) const;
 
     uint64_t nextVariableIndex = 0;
     uint64_t nextConstraintIndex = 0;
@@ -110,6 +119,12 @@ class SoplexLpSolver : public LpSolver<ValueType, RawMode> {
     TypedDSVector variables = TypedDSVector(0);
     // A mapping from variables to their indices.
     std::map<storm::expressions::Variable, uint64_t> variableToIndexMap;
+
+    struct IncrementalLevel {
+        uint64_t firstVariableIndex;
+        uint64_t firstConstraintIndex;
+    };
+    std::vector<IncrementalLevel> incrementalData;
 #endif
 };
 }  // namespace storm::solver
\ No newline at end of file
@@ -1,5 +1,9 @@
 #include "storm/solver/StandardGameSolver.h"
 
+#include <algorithm>
+#include <atomic>
+
+#include "storm/adapters/IntelTbbAdapter.h"
 #include "storm/solver/EigenLinearEquationSolver.h"
 #include "storm/solver/EliminationLinearEquationSolver.h"
 #include "storm/solver/GmmxxLinearEquationSolver.h"
@@ -9,8 +13,10 @@
 #include "storm/exceptions/InvalidEnvironmentException.h"
 #include "storm/exceptions/InvalidStateException.h"
 #include "storm/exceptions/NotImplementedException.h"
+#include "storm/exceptions/UncheckedRequirementException.h"
 #include "storm/settings/SettingsManager.h"
 #include "storm/settings/modules/GeneralSettings.h"
+#include "storm/storage/MaximalEndComponentDecomposition.h"
 #include "storm/utility/ConstantsComparator.h"
 #include "storm/utility/SignalHandler.h"
 #include "storm/utility/graph.h"
@@ -92,7 +98,7 @@ GameMethod StandardGameSolver<ValueType>::getMethod(Environment const& env, bool
         } else {
             STORM_LOG_WARN("The selected game method does not guarantee exact results.");
         }
-    } else if (env.solver().isForceSoundness() && method != GameMethod::PolicyIteration) {
+    } else if (env.solver().isForceSoundness() && method != GameMethod::PolicyIteration && method != GameMethod::IntervalIteration) {
         if (env.solver().game().isMethodSetFromDefault()) {
             method = GameMethod::PolicyIteration;
             STORM_LOG_INFO("Changing game method to policy-iteration to guarantee sound results. If you want to override this, specify another method.");
@@ -114,6 +120,10 @@ bool StandardGameSolver<ValueType>::solveGame(Environment const& env, Optimizati
             return solveGameValueIteration(env, player1Dir, player2Dir, x, b, player1Choices, player2Choices);
         case GameMethod::PolicyIteration:
             return solveGamePolicyIteration(env, player1Dir, player2Dir, x, b, player1Choices, player2Choices);
+        case GameMethod::IntervalIteration:
+            return solveGameIntervalIteration(env, player1Dir, player2Dir, x, b, player1Choices, player2Choices);
+        case GameMethod::Topological:
+            return solveGameTopological(env, player1Dir, player2Dir, x, b, player1Choices, player2Choices);
         default:
             STORM_LOG_THROW(false, storm::exceptions::InvalidEnvironmentException, "This solver does not implement the selected solution method");
     }
@@ -400,6 +410,472 @@ bool StandardGameSolver<ValueType>::solveGameValueIteration(Environment const& e
     return (status == SolverStatus::Converged || status == SolverStatus::TerminatedEarly);
 }
 
+template<typename ValueType>
+bool StandardGameSolver<ValueType>::solveGameIntervalIteration(Environment const& env, OptimizationDirection player1Dir, OptimizationDirection player2Dir,
+                                                               std::vector<ValueType>& x, std::vector<ValueType> const& b,
+                                                               std::vector<uint64_t>* player1Choices, std::vector<uint64_t>* player2Choices) const {
+    STORM_LOG_THROW(this->hasLowerBound() && this->hasUpperBound(), storm::exceptions::UncheckedRequirementException,
+                    "Interval iteration for games requires lower and upper bounds on the solution.");
+    if (!multiplierPlayer2Matrix) {
+        multiplierPlayer2Matrix = storm::solver::MultiplierFactory<ValueType>().create(env, player2Matrix);
+    }
+
+    if (!auxiliaryP2RowGroupVector) {
+        auxiliaryP2RowGroupVector = std::make_unique<std::vector<ValueType>>(player2Matrix.getRowGroupCount());
+    }
+
+    if (!auxiliaryP1RowGroupVector) {
+        auxiliaryP1RowGroupVector = std::make_unique<std::vector<ValueType>>(this->getNumberOfPlayer1States());
+    }
+
+    ValueType precision = storm::utility::convertNumber<ValueType>(env.solver().game().getPrecision());
+    bool relative = env.solver().game().getRelativeTerminationCriterion();
+    uint64_t maxIter = env.solver().game().getMaximalNumberOfIterations();
+
+    std::vector<ValueType>& reducedPlayer2Result = *auxiliaryP2RowGroupVector;
+
+    bool trackingSchedulersInProvidedStorage = player1Choices && player2Choices;
+    bool trackSchedulers = this->isTrackSchedulersSet() || trackingSchedulersInProvidedStorage;
+    bool trackSchedulersInValueIteration = trackSchedulers && !this->hasUniqueSolution();
+    if (trackSchedulersInValueIteration && !trackingSchedulersInProvidedStorage) {
+        this->player1SchedulerChoices = std::vector<uint_fast64_t>(this->getNumberOfPlayer1States(), 0);
+        this->player2SchedulerChoices = std::vector<uint_fast64_t>(this->getNumberOfPlayer2States(), 0);
+    }
+
+    // The lower bounds are stored in x, the upper bounds in a separate vector.
+    this->createLowerBoundsVector(x);
+    std::vector<ValueType> upperX(x.size());
+    this->createUpperBoundsVector(upperX);
+    std::vector<ValueType> newUpperX(x.size());
+
+    std::vector<ValueType>* newLowerX = auxiliaryP1RowGroupVector.get();
+    std::vector<ValueType>* currentLowerX = &x;
+    std::vector<ValueType>* currentUpperX = &upperX;
+    std::vector<ValueType>* nextUpperX = &newUpperX;
+
+    uint64_t iterations = 0;
+    uint64_t numberOfDeflations = 0;
+    SolverStatus status = SolverStatus::InProgress;
+    while (status == SolverStatus::InProgress) {
+        multiplyAndReduce(
+            env, player1Dir, player2Dir, *currentLowerX, &b, *multiplierPlayer2Matrix, reducedPlayer2Result, *newLowerX,
+            trackSchedulersInValueIteration ? (trackingSchedulersInProvidedStorage ? player1Choices : &this->player1SchedulerChoices.get()) : nullptr,
+            trackSchedulersInValueIteration ? (trackingSchedulersInProvidedStorage ? player2Choices : &this->player2SchedulerChoices.get()) : nullptr);
+        multiplyAndReduce(env, player1Dir, player2Dir, *currentUpperX, &b, *multiplierPlayer2Matrix, reducedPlayer2Result, *nextUpperX);
+
+        // If there are end components, the iteration from above might get stuck at a fixpoint that is too large. We then deflate the upper bounds.
+        if (!this->hasUniqueSolution() && storm::utility::vector::equalModuloPrecision<ValueType>(*currentUpperX, *nextUpperX, precision, relative)) {
+            deflate(player1Dir, player2Dir, *newLowerX, *nextUpperX, b);
+            ++numberOfDeflations;
+        }
+
+        std::swap(currentLowerX, newLowerX);
+        std::swap(currentUpperX, nextUpperX);
+        ++iterations;
+
+        // The midpoint of the bounds is precise enough if the bounds are close enough.
+        if (storm::utility::vector::equalModuloPrecision<ValueType>(*currentLowerX, *currentUpperX, storm::utility::convertNumber<ValueType>(2) * precision,
+                                                                     relative)) {
+            status = SolverStatus::Converged;
+        }
+        status = this->updateStatus(status, *currentLowerX, SolverGuarantee::LessOrEqual, iterations, maxIter);
+    }
+
+    this->reportStatus(status, iterations);
+    STORM_LOG_INFO_COND(numberOfDeflations == 0, "Deflated the upper bounds " << numberOfDeflations << " times.");
+
+    if (currentLowerX == auxiliaryP1RowGroupVector.get()) {
+        std::swap(x, *currentLowerX);
+    }
+    storm::utility::vector::applyPointwise<ValueType, ValueType, ValueType>(
+        x, *currentUpperX, x, [](ValueType const& lower, ValueType const& upper) { return (lower + upper) / storm::utility::convertNumber<ValueType>(2); });
+
+    // If requested, we store the scheduler for retrieval.
+    if (trackSchedulers && this->hasUniqueSolution()) {
+        if (trackingSchedulersInProvidedStorage) {
+            extractChoices(env, player1Dir, player2Dir, x, b, *auxiliaryP2RowGroupVector, *player1Choices, *player2Choices);
+        } else {
+            this->player1SchedulerChoices = std::vector<uint_fast64_t>(this->getNumberOfPlayer1States(), 0);
+            this->player2SchedulerChoices = std::vector<uint_fast64_t>(this->getNumberOfPlayer2States(), 0);
+            extractChoices(env, player1Dir, player2Dir, x, b, *auxiliaryP2RowGroupVector, this->player1SchedulerChoices.get(),
+                           this->player2SchedulerChoices.get());
+        }
+    }
+
+    if (!this->isCachingEnabled()) {
+        clearCache();
+    }
+
+    return (status == SolverStatus::Converged || status == SolverStatus::TerminatedEarly);
+}
+
+template<typename ValueType>
+void StandardGameSolver<ValueType>::deflate(OptimizationDirection player1Dir, OptimizationDirection player2Dir, std::vector<ValueType> const& lowerX,
+                                            std::vector<ValueType>& upperX, std::vector<ValueType> const& b) const {
+    uint64_t numberOfPlayer1States = this->getNumberOfPlayer1States();
+    uint64_t numberOfPlayer2States = this->getNumberOfPlayer2States();
+    bool player1Minimizes = player1Dir == OptimizationDirection::Minimize;
+    bool player2Minimizes = player2Dir == OptimizationDirection::Minimize;
+
+    std::vector<ValueType> player2LowerValues(numberOfPlayer2States);
+    for (uint64_t player2State = 0; player2State < numberOfPlayer2States; ++player2State) {
+        player2LowerValues[player2State] = computePlayer2StateValue(player2Dir, player2State, lowerX, b, nullptr);
+    }
+
+    // Build the game as an MDP whose states are the player 1 states followed by the player 2 states. The end components of this MDP are computed
+    // w.r.t. the choices that (a) do not yield any value on their own and (b) are optimal w.r.t. the lower bounds if taken by a minimizing player.
+    uint64_t numberOfPlayer1Choices = this->player1RepresentedByMatrix() ? this->getPlayer1Matrix().getRowCount() : numberOfPlayer2States;
+    uint64_t numberOfChoices = numberOfPlayer1Choices + player2Matrix.getRowCount();
+    storm::storage::SparseMatrixBuilder<ValueType> builder(numberOfChoices, numberOfPlayer1States + numberOfPlayer2States, 0, false, true,
+                                                           numberOfPlayer1States + numberOfPlayer2States);
+    storm::storage::BitVector consideredChoices(numberOfChoices, false);
+    uint64_t choice = 0;
+    for (uint64_t player1State = 0; player1State < numberOfPlayer1States; ++player1State) {
+        builder.newRowGroup(choice);
+        ValueType optimalValue = reducePlayer1State(
+            player1Dir, player1State, [&player2LowerValues](uint64_t player2State) { return player2LowerValues[player2State]; }, nullptr);
+        forEachPlayer2Successor(player1State, [&](uint64_t, uint64_t player2State) {
+            builder.addNextValue(choice, numberOfPlayer1States + player2State, storm::utility::one<ValueType>());
+            if (!player1Minimizes || player2LowerValues[player2State] == optimalValue) {
+                consideredChoices.set(choice);
+            }
+            ++choice;
+        });
+    }
+    for (uint64_t player2State = 0; player2State < numberOfPlayer2States; ++player2State) {
+        builder.newRowGroup(choice);
+        for (uint64_t row = player2Matrix.getRowGroupIndices()[player2State]; row < player2Matrix.getRowGroupIndices()[player2State + 1]; ++row) {
+            ValueType rowValue = b[row];
+            ValueType rowSum = storm::utility::zero<ValueType>();
+            for (auto const& entry : player2Matrix.getRow(row)) {
+                builder.addNextValue(choice, entry.getColumn(), entry.getValue());
+                rowValue += entry.getValue() * lowerX[entry.getColumn()];
+                rowSum += entry.getValue();
+            }
+            if (storm::utility::isZero(b[row]) && storm::utility::isAlmostOne(rowSum) &&
+                (!player2Minimizes || rowValue == player2LowerValues[player2State])) {
+                consideredChoices.set(choice);
+            }
+            ++choice;
+        }
+    }
+    storm::storage::SparseMatrix<ValueType> transitionMatrix =
+        builder.build(numberOfChoices, numberOfPlayer1States + numberOfPlayer2States, numberOfPlayer1States + numberOfPlayer2States);
+    storm::storage::SparseMatrix<ValueType> backwardTransitions = transitionMatrix.transpose(true);
+    storm::storage::MaximalEndComponentDecomposition<ValueType> endComponents(
+        transitionMatrix, backwardTransitions, storm::storage::BitVector(numberOfPlayer1States + numberOfPlayer2States, true), consideredChoices);
+
+    // Within each end component, the minimizing player(s) can enforce to either stay forever (which yields value zero) or to leave the end
+    // component via a choice of a maximizing player. Hence, the value of all states is at most the best upper bound of such a choice.
+    for (auto const& endComponent : endComponents) {
+        ValueType bestExitValue = storm::utility::zero<ValueType>();
+        for (auto const& stateChoicesPair : endComponent) {
+            uint64_t state = stateChoicesPair.first;
+            bool isPlayer1State = state < numberOfPlayer1States;
+            if (isPlayer1State ? player1Minimizes : player2Minimizes) {
+                continue;
+            }
+            uint64_t firstChoice = transitionMatrix.getRowGroupIndices()[state];
+            for (uint64_t exitChoice = firstChoice; exitChoice < transitionMatrix.getRowGroupIndices()[state + 1]; ++exitChoice) {
+                if (stateChoicesPair.second.count(exitChoice) > 0) {
+                    continue;
+                }
+                ValueType exitValue;
+                if (isPlayer1State) {
+                    uint64_t player2State = transitionMatrix.getRow(exitChoice).begin()->getColumn() - numberOfPlayer1States;
+                    exitValue = computePlayer2StateValue(player2Dir, player2State, upperX, b, nullptr);
+                } else {
+                    uint64_t row = exitChoice - numberOfPlayer1Choices;
+                    exitValue = b[row];
+                    for (auto const& entry : player2Matrix.getRow(row)) {
+                        exitValue += entry.getValue() * upperX[entry.getColumn()];
+                    }
+                }
+                bestExitValue = std::max(bestExitValue, exitValue);
+            }
+        }
+        for (auto const& stateChoicesPair : endComponent) {
+            if (stateChoicesPair.first < numberOfPlayer1States) {
+                upperX[stateChoicesPair.first] = std::min(upperX[stateChoicesPair.first], bestExitValue);
+            }
+        }
+    }
+}
+
+template<typename ValueType>
+bool StandardGameSolver<ValueType>::solveGameTopological(Environment const& env, OptimizationDirection player1Dir, OptimizationDirection player2Dir,
+                                                         std::vector<ValueType>& x, std::vector<ValueType> const& b, std::vector<uint64_t>* player1Choices,
+                                                         std::vector<uint64_t>* player2Choices) const {
+    ValueType precision = storm::utility::convertNumber<ValueType>(env.solver().game().getPrecision());
+    bool relative = env.solver().game().getRelativeTerminationCriterion();
+    uint64_t maxIter = env.solver().game().getMaximalNumberOfIterations();
+
+    bool trackingSchedulersInProvidedStorage = player1Choices && player2Choices;
+    bool trackSchedulers = this->isTrackSchedulersSet() || trackingSchedulersInProvidedStorage;
+    bool trackSchedulersInValueIteration = trackSchedulers && !this->hasUniqueSolution();
+    std::vector<uint64_t>* sccPlayer1Choices = nullptr;
+    std::vector<uint64_t>* sccPlayer2Choices = nullptr;
+    if (trackSchedulersInValueIteration) {
+        if (!trackingSchedulersInProvidedStorage) {
+            this->player1SchedulerChoices = std::vector<uint_fast64_t>(this->getNumberOfPlayer1States(), 0);
+            this->player2SchedulerChoices = std::vector<uint_fast64_t>(this->getNumberOfPlayer2States(), 0);
+        }
+        sccPlayer1Choices = trackingSchedulersInProvidedStorage ? player1Choices : &this->player1SchedulerChoices.get();
+        sccPlayer2Choices = trackingSchedulersInProvidedStorage ? player2Choices : &this->player2SchedulerChoices.get();
+    }
+
+    // SCCs of the same depth can be solved concurrently. As player 2 states might be shared among player 1 states (if player 1 is represented by a
+    // matrix), we only do so if no choices need to be written during the iterations.
+    bool parallel = parallelize(env) && !trackSchedulersInValueIteration;
+    if (!sortedSccDecomposition || (parallel && !sortedSccDecomposition->hasSccDepth())) {
+        sortedSccDecomposition = std::make_unique<storm::storage::StronglyConnectedComponentDecomposition<ValueType>>(
+            getPlayer1StateGraph(), storm::storage::StronglyConnectedComponentDecompositionOptions().forceTopologicalSort().computeSccDepths(parallel));
+    }
+    STORM_LOG_INFO("Solving game SCC-wise over " << sortedSccDecomposition->size() << " SCCs of player 1 states.");
+
+    SolverStatus status = SolverStatus::Converged;
+    uint64_t iterations = 0;
+    if (parallel) {
+#ifdef STORM_HAVE_INTELTBB
+        std::vector<std::vector<uint64_t>> sccsPerDepth(sortedSccDecomposition->getMaxSccDepth() + 1);
+        for (uint64_t sccIndex = 0; sccIndex < sortedSccDecomposition->size(); ++sccIndex) {
+            sccsPerDepth[sortedSccDecomposition->getSccDepth(sccIndex)].push_back(sccIndex);
+        }
+        std::vector<SolverStatus> sccStatus(sortedSccDecomposition->size(), SolverStatus::InProgress);
+        std::atomic<uint64_t> totalIterations{0};
+        for (auto const& sccIndices : sccsPerDepth) {
+            tbb::parallel_for(tbb::blocked_range<uint64_t>(0, sccIndices.size()), [&](tbb::blocked_range<uint64_t> const& range) {
+                for (uint64_t i = range.begin(); i < range.end(); ++i) {
+                    uint64_t sccIterations = 0;
+                    sccStatus[sccIndices[i]] = solveScc(player1Dir, player2Dir, sortedSccDecomposition->getBlock(sccIndices[i]), precision, relative, maxIter,
+                                                        x, b, nullptr, nullptr, sccIterations);
+                    totalIterations += sccIterations;
+                }
+            });
+            if (storm::utility::resources::isTerminate()) {
+                break;
+            }
+        }
+        iterations = totalIterations;
+        for (auto const& s : sccStatus) {
+            if (s != SolverStatus::Converged) {
+                status = s == SolverStatus::InProgress ? SolverStatus::Aborted : s;
+                break;
+            }
+        }
+#endif
+    } else {
+        for (auto const& scc : *sortedSccDecomposition) {
+            uint64_t sccIterations = 0;
+            SolverStatus sccStatus =
+                solveScc(player1Dir, player2Dir, scc, precision, relative, maxIter, x, b, sccPlayer1Choices, sccPlayer2Choices, sccIterations);
+            iterations += sccIterations;
+            if (sccStatus != SolverStatus::Converged) {
+                status = sccStatus;
+            }
+            if (status == SolverStatus::Aborted) {
+                break;
+            }
+        }
+    }
+
+    this->reportStatus(status, iterations);
+
+    // If requested, we store the scheduler for retrieval.
+    if (trackSchedulers && this->hasUniqueSolution()) {
+        if (!auxiliaryP2RowGroupVector) {
+            auxiliaryP2RowGroupVector = std::make_unique<std::vector<ValueType>>(player2Matrix.getRowGroupCount());
+        }
+        if (trackingSchedulersInProvidedStorage) {
+            extractChoices(env, player1Dir, player2Dir, x, b, *auxiliaryP2RowGroupVector, *player1Choices, *player2Choices);
+        } else {
+            this->player1SchedulerChoices = std::vector<uint_fast64_t>(this->getNumberOfPlayer1States(), 0);
+            this->player2SchedulerChoices = std::vector<uint_fast64_t>(this->getNumberOfPlayer2States(), 0);
+            extractChoices(env, player1Dir, player2Dir, x, b, *auxiliaryP2RowGroupVector, this->player1SchedulerChoices.get(),
+                           this->player2SchedulerChoices.get());
+        }
+    }
+
+    if (!this->isCachingEnabled()) {
+        clearCache();
+    }
+
+    return status == SolverStatus::Converged || status == SolverStatus::TerminatedEarly;
+}
+
+template<typename ValueType>
+SolverStatus StandardGameSolver<ValueType>::solveScc(OptimizationDirection player1Dir, OptimizationDirection player2Dir,
+                                                     storm::storage::StronglyConnectedComponent const& scc, ValueType const& precision, bool relative,
+                                                     uint64_t maxIter, std::vector<ValueType>& x, std::vector<ValueType> const& b,
+                                                     std::vector<uint64_t>* player1SchedulerChoices, std::vector<uint64_t>* player2SchedulerChoices,
+                                                     uint64_t& iterations) const {
+    // A single state without a selfloop only depends on states whose values are final, so one update suffices.
+    bool singleUpdate = false;
+    if (scc.size() == 1) {
+        uint64_t sccState = *scc.begin();
+        singleUpdate = true;
+        forEachPlayer2Successor(sccState, [&](uint64_t, uint64_t player2State) {
+            for (uint64_t row = player2Matrix.getRowGroupIndices()[player2State]; row < player2Matrix.getRowGroupIndices()[player2State + 1]; ++row) {
+                for (auto const& entry : player2Matrix.getRow(row)) {
+                    if (entry.getColumn() == sccState) {
+                        singleUpdate = false;
+                    }
+                }
+            }
+        });
+    }
+
+    iterations = 0;
+    SolverStatus status = SolverStatus::InProgress;
+    while (status == SolverStatus::InProgress) {
+        bool converged = true;
+        for (auto const& state : scc) {
+            ValueType newValue = computePlayer1StateValue(player1Dir, player2Dir, state, x, b, player1SchedulerChoices, player2SchedulerChoices);
+            if (converged && !storm::utility::vector::equalModuloPrecision<ValueType>(x[state], newValue, precision, relative)) {
+                converged = false;
+            }
+            x[state] = std::move(newValue);
+        }
+        ++iterations;
+
+        if (converged || singleUpdate) {
+            status = SolverStatus::Converged;
+        } else if (iterations >= maxIter) {
+            status = SolverStatus::MaximalIterationsExceeded;
+        } else if (storm::utility::resources::isTerminate()) {
+            status = SolverStatus::Aborted;
+        }
+    }
+    return status;
+}
+
+template<typename ValueType>
+ValueType StandardGameSolver<ValueType>::computePlayer1StateValue(OptimizationDirection player1Dir, OptimizationDirection player2Dir, uint64_t player1State,
+                                                                  std::vector<ValueType> const& x, std::vector<ValueType> const& b,
+                                                                  std::vector<uint64_t>* player1SchedulerChoices,
+                                                                  std::vector<uint64_t>* player2SchedulerChoices) const {
+    return reducePlayer1State(
+        player1Dir, player1State,
+        [&](uint64_t player2State) { return computePlayer2StateValue(player2Dir, player2State, x, b, player2SchedulerChoices); },
+        player1SchedulerChoices);
+}
+
+template<typename ValueType>
+ValueType StandardGameSolver<ValueType>::computePlayer2StateValue(OptimizationDirection player2Dir, uint64_t player2State, std::vector<ValueType> const& x,
+                                                                  std::vector<ValueType> const& b, std::vector<uint64_t>* player2SchedulerChoices) const {
+    uint64_t firstRow = player2Matrix.getRowGroupIndices()[player2State];
+    uint64_t endRow = player2Matrix.getRowGroupIndices()[player2State + 1];
+    // As for the multiplier, states without a choice get value zero.
+    if (firstRow >= endRow) {
+        return storm::utility::zero<ValueType>();
+    }
+
+    ValueType result = storm::utility::zero<ValueType>();
+    ValueType selectedChoiceValue = storm::utility::zero<ValueType>();
+    uint64_t bestChoice = 0;
+    for (uint64_t row = firstRow; row < endRow; ++row) {
+        ValueType rowValue = b[row];
+        for (auto const& entry : player2Matrix.getRow(row)) {
+            rowValue += entry.getValue() * x[entry.getColumn()];
+        }
+        if (player2SchedulerChoices && row - firstRow == (*player2SchedulerChoices)[player2State]) {
+            selectedChoiceValue = rowValue;
+        }
+        if (row == firstRow || (player2Dir == OptimizationDirection::Minimize ? rowValue < result : rowValue > result)) {
+            result = std::move(rowValue);
+            bestChoice = row - firstRow;
+        }
+    }
+
+    // Only update the choice if the new choice is strictly better than the selected one.
+    if (player2SchedulerChoices && result != selectedChoiceValue) {
+        (*player2SchedulerChoices)[player2State] = bestChoice;
+    }
+    return result;
+}
+
+template<typename ValueType>
+template<typename Player2ValueFunction>
+ValueType StandardGameSolver<ValueType>::reducePlayer1State(OptimizationDirection player1Dir, uint64_t player1State,
+                                                            Player2ValueFunction const& getPlayer2Value,
+                                                            std::vector<uint64_t>* player1SchedulerChoices) const {
+    bool first = true;
+    ValueType result = storm::utility::zero<ValueType>();
+    ValueType selectedChoiceValue = storm::utility::zero<ValueType>();
+    uint64_t bestChoice = 0;
+    forEachPlayer2Successor(player1State, [&](uint64_t choice, uint64_t player2State) {
+        ValueType value = getPlayer2Value(player2State);
+        if (player1SchedulerChoices && choice == (*player1SchedulerChoices)[player1State]) {
+            selectedChoiceValue = value;
+        }
+        if (first || (player1Dir == OptimizationDirection::Minimize ? value < result : value > result)) {
+            result = std::move(value);
+            bestChoice = choice;
+            first = false;
+        }
+    });
+    STORM_LOG_ASSERT(!first, "There is a choice of player 1 that does not lead to any player 2 choice");
+
+    // Only update the choice if the new choice is strictly better than the selected one.
+    if (player1SchedulerChoices && result != selectedChoiceValue) {
+        (*player1SchedulerChoices)[player1State] = bestChoice;
+    }
+    return result;
+}
+
+template<typename ValueType>
+template<typename Callback>
+void StandardGameSolver<ValueType>::forEachPlayer2Successor(uint64_t player1State, Callback const& callback) const {
+    if (this->player1RepresentedByMatrix()) {
+        // Player 1 represented by matrix.
+        uint64_t firstRow = this->getPlayer1Matrix().getRowGroupIndices()[player1State];
+        uint64_t endRow = this->getPlayer1Matrix().getRowGroupIndices()[player1State + 1];
+        for (uint64_t row = firstRow; row < endRow; ++row) {
+            auto const& player1Row = this->getPlayer1Matrix().getRow(row);
+            STORM_LOG_ASSERT(player1Row.getNumberOfEntries() == 1, "It is assumed that rows of player one have one entry, but this is not the case.");
+            callback(row - firstRow, player1Row.begin()->getColumn());
+        }
+    } else {
+        // Player 1 represented by grouping of player 2 states (vector).
+        uint64_t firstPlayer2State = this->getPlayer1Grouping()[player1State];
+        for (uint64_t player2State = firstPlayer2State; player2State < this->getPlayer1Grouping()[player1State + 1]; ++player2State) {
+            callback(player2State - firstPlayer2State, player2State);
+        }
+    }
+}
+
+template<typename ValueType>
+storm::storage::SparseMatrix<ValueType> StandardGameSolver<ValueType>::getPlayer1StateGraph() const {
+    uint64_t numberOfPlayer1States = this->getNumberOfPlayer1States();
+    storm::storage::SparseMatrixBuilder<ValueType> builder(numberOfPlayer1States, numberOfPlayer1States);
+    std::vector<uint64_t> successors;
+    for (uint64_t player1State = 0; player1State < numberOfPlayer1States; ++player1State) {
+        successors.clear();
+        forEachPlayer2Successor(player1State, [&](uint64_t, uint64_t player2State) {
+            for (uint64_t row = player2Matrix.getRowGroupIndices()[player2State]; row < player2Matrix.getRowGroupIndices()[player2State + 1]; ++row) {
+                for (auto const& entry : player2Matrix.getRow(row)) {
+                    successors.push_back(entry.getColumn());
+                }
+            }
+        });
+        std::sort(successors.begin(), successors.end());
+        successors.erase(std::unique(successors.begin(), successors.end()), successors.end());
+        for (auto const& successor : successors) {
+            builder.addNextValue(player1State, successor, storm::utility::one<ValueType>());
+        }
+    }
+    return builder.build(numberOfPlayer1States, numberOfPlayer1States);
+}
+
+template<typename ValueType>
+bool StandardGameSolver<ValueType>::parallelize(Environment const& env) const {
+#ifdef STORM_HAVE_INTELTBB
+    return env.solver().isUseIntelTbb();
+#else
+    return false;
+#endif
+}
+
 template<typename ValueType>
 void StandardGameSolver<ValueType>::repeatedMultiply(Environment const& env, OptimizationDirection player1Dir, OptimizationDirection player2Dir,
                                                      std::vector<ValueType>& x, std::vector<ValueType> const* b, uint_fast64_t n) const {
@@ -429,6 +905,25 @@ void StandardGameSolver<ValueType>::multiplyAndReduce(Environment const& env, Op
                                                       std::vector<uint64_t>* player2SchedulerChoices) const {
     multiplier.multiplyAndReduce(env, player2Dir, x, b, player2ReducedResult, player2SchedulerChoices);
 
+    if (parallelize(env)) {
+#ifdef STORM_HAVE_INTELTBB
+        // The multiplier already parallelizes the computation for player 2, so we only need to take care of the reduction for player 1.
+        if (this->player1RepresentedByMatrix()) {
+            tbb::parallel_for(tbb::blocked_range<uint64_t>(0, player1ReducedResult.size(), 100), [&](tbb::blocked_range<uint64_t> const& range) {
+                for (uint64_t player1State = range.begin(); player1State < range.end(); ++player1State) {
+                    player1ReducedResult[player1State] = reducePlayer1State(
+                        player1Dir, player1State, [&player2ReducedResult](uint64_t player2State) { return player2ReducedResult[player2State]; },
+                        nullptr);
+                }
+            });
+        } else {
+            storm::utility::vector::reduceVectorMinOrMaxParallel(player1Dir, player2ReducedResult, player1ReducedResult, this->getPlayer1Grouping(),
+                                                                 player1SchedulerChoices);
+        }
+        return;
+#endif
+    }
+
     if (this->player1RepresentedByMatrix()) {
         // Player 1 represented by matrix.
         uint_fast64_t player1State = 0;
@@ -623,6 +1118,7 @@ void StandardGameSolver<ValueType>::clearCache() const {
     auxiliaryP2RowVector.reset();
     auxiliaryP2RowGroupVector.reset();
     auxiliaryP1RowGroupVector.reset();
+    sortedSccDecomposition.reset();
     GameSolver<ValueType>::clearCache();
 }
 
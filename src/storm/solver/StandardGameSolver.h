@@ -5,6 +5,7 @@
 #include "storm/solver/LinearEquationSolver.h"
 #include "storm/solver/SolverStatus.h"
 #include "storm/solver/multiplier/Multiplier.h"
+#include "storm/storage/StronglyConnectedComponentDecomposition.h"
 
 namespace storm {
 namespace solver {
@@ -43,6 +44,50 @@ class StandardGameSolver : public GameSolver<ValueType> {
     bool solveGameValueIteration(Environment const& env, OptimizationDirection player1Dir, OptimizationDirection player2Dir, std::vector<ValueType>& x,
                                  std::vector<ValueType> const& b, std::vector<uint64_t>* player1Choices = nullptr,
                                  std::vector<uint64_t>* player2Choices = nullptr) const;
+    // Performs value iteration from below and from above until the bounds are sufficiently close.
+    bool solveGameIntervalIteration(Environment const& env, OptimizationDirection player1Dir, OptimizationDirection player2Dir, std::vector<ValueType>& x,
+                                    std::vector<ValueType> const& b, std::vector<uint64_t>* player1Choices = nullptr,
+                                    std::vector<uint64_t>* player2Choices = nullptr) const;
+
+    // Decreases the upper bounds of the player 1 states in end components to the best value with which the maximizing player(s) can leave the end
+    // component. Here, the minimizing player(s) may only use choices that are optimal w.r.t. the lower bounds.
+    void deflate(OptimizationDirection player1Dir, OptimizationDirection player2Dir, std::vector<ValueType> const& lowerX, std::vector<ValueType>& upperX,
+                 std::vector<ValueType> const& b) const;
+
+    // Performs value iteration SCC-wise, i.e., the SCCs of the graph over player 1 states are solved in topological order.
+    bool solveGameTopological(Environment const& env, OptimizationDirection player1Dir, OptimizationDirection player2Dir, std::vector<ValueType>& x,
+                              std::vector<ValueType> const& b, std::vector<uint64_t>* player1Choices = nullptr,
+                              std::vector<uint64_t>* player2Choices = nullptr) const;
+
+    // Performs value iteration (Gauss-Seidel style) on the states of the given SCC until convergence.
+    // The values of all states outside of the SCC that are reachable from the SCC are assumed to be final.
+    SolverStatus solveScc(OptimizationDirection player1Dir, OptimizationDirection player2Dir, storm::storage::StronglyConnectedComponent const& scc,
+                          ValueType const& precision, bool relative, uint64_t maxIter, std::vector<ValueType>& x, std::vector<ValueType> const& b,
+                          std::vector<uint64_t>* player1SchedulerChoices, std::vector<uint64_t>* player2SchedulerChoices, uint64_t& iterations) const;
+
+    // Computes the value of the given player 1 state w.r.t. the values in x.
+    ValueType computePlayer1StateValue(OptimizationDirection player1Dir, OptimizationDirection player2Dir, uint64_t player1State,
+                                       std::vector<ValueType> const& x, std::vector<ValueType> const& b, std::vector<uint64_t>* player1SchedulerChoices,
+                                       std::vector<uint64_t>* player2SchedulerChoices) const;
+
+    // Computes the value of the given player 2 state w.r.t. the values in x.
+    ValueType computePlayer2StateValue(OptimizationDirection player2Dir, uint64_t player2State, std::vector<ValueType> const& x,
+                                       std::vector<ValueType> const& b, std::vector<uint64_t>* player2SchedulerChoices) const;
+
+    // Picks the extremal value among the player 2 successors of the given player 1 state.
+    template<typename Player2ValueFunction>
+    ValueType reducePlayer1State(OptimizationDirection player1Dir, uint64_t player1State, Player2ValueFunction const& getPlayer2Value,
+                                 std::vector<uint64_t>* player1SchedulerChoices) const;
+
+    // Calls the given callback with (choice, player 2 state) for each choice of the given player 1 state.
+    template<typename Callback>
+    void forEachPlayer2Successor(uint64_t player1State, Callback const& callback) const;
+
+    // Retrieves the graph over player 1 states, in which each player 1 state has an edge to all player 1 states reachable via one of its choices.
+    storm::storage::SparseMatrix<ValueType> getPlayer1StateGraph() const;
+
+    // Retrieves whether the environment asks for multi-threaded computations.
+    bool parallelize(Environment const& env) const;
 
     // Computes p2Matrix * x + b, reduces the result w.r.t. player 2 choices, and then reduces the result w.r.t. player 1 choices.
     void multiplyAndReduce(Environment const& env, OptimizationDirection player1Dir, OptimizationDirection player2Dir, std::vector<ValueType>& x,
@@ -75,6 +120,7 @@ class StandardGameSolver : public GameSolver<ValueType> {
     mutable std::unique_ptr<std::vector<ValueType>> auxiliaryP2RowVector;       // player2Matrix.rowCount() entries
     mutable std::unique_ptr<std::vector<ValueType>> auxiliaryP2RowGroupVector;  // player2Matrix.rowGroupCount() entries
     mutable std::unique_ptr<std::vector<ValueType>> auxiliaryP1RowGroupVector;  // player1Matrix.rowGroupCount() entries
+    mutable std::unique_ptr<storm::storage::StronglyConnectedComponentDecomposition<ValueType>> sortedSccDecomposition;  // over player 1 states
 
     /// The factory used to obtain linear equation solvers.
     std::unique_ptr<LinearEquationSolverFactory<ValueType>> linearEquationSolverFactory;
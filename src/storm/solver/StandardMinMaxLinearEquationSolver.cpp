@@ -37,6 +37,7 @@ template<typename ValueType, typename SolutionType>
 void StandardMinMaxLinearEquationSolver<ValueType, SolutionType>::setMatrix(storm::storage::SparseMatrix<ValueType> const& matrix) {
     this->localA = nullptr;
     this->A = &matrix;
+    this->matrixView = nullptr;
     this->clearCache();
 }
 
@@ -44,9 +45,37 @@ template<typename ValueType, typename SolutionType>
 void StandardMinMaxLinearEquationSolver<ValueType, SolutionType>::setMatrix(storm::storage::SparseMatrix<ValueType>&& matrix) {
     this->localA = std::make_unique<storm::storage::SparseMatrix<ValueType>>(std::move(matrix));
     this->A = this->localA.get();
+    this->matrixView = nullptr;
     this->clearCache();
 }
 
+template<typename ValueType, typename SolutionType>
+void StandardMinMaxLinearEquationSolver<ValueType, SolutionType>::setMatrix(storm::storage::SparseMatrixView<ValueType> const& matrixView) {
+    if (canOperateOnMatrixView()) {
+        this->localA = nullptr;
+        this->A = nullptr;
+        this->matrixView = std::make_unique<storm::storage::SparseMatrixView<ValueType>>(matrixView);
+        this->clearCache();
+    } else {
+        setMatrix(matrixView.toSparseMatrix());
+    }
+}
+
+template<typename ValueType, typename SolutionType>
+bool StandardMinMaxLinearEquationSolver<ValueType, SolutionType>::canOperateOnMatrixView() const {
+    return false;
+}
+
+template<typename ValueType, typename SolutionType>
+void StandardMinMaxLinearEquationSolver<ValueType, SolutionType>::materializeMatrix() const {
+    if (!this->A) {
+        STORM_LOG_ASSERT(this->matrixView, "Neither a matrix nor a matrix view is set.");
+        STORM_LOG_INFO("Copying the submatrix of the matrix view.");
+        this->localA = std::make_unique<storm::storage::SparseMatrix<ValueType>>(this->matrixView->toSparseMatrix());
+        this->A = this->localA.get();
+    }
+}
+
 template class StandardMinMaxLinearEquationSolver<double>;
 template class StandardMinMaxLinearEquationSolver<storm::RationalNumber>;
 template class StandardMinMaxLinearEquationSolver<storm::Interval, double>;
@@ -2,6 +2,7 @@
 
 #include "storm/solver/LinearEquationSolver.h"
 #include "storm/solver/MinMaxLinearEquationSolver.h"
+#include "storm/storage/SparseMatrixView.h"
 
 namespace storm {
 
@@ -18,17 +19,32 @@ class StandardMinMaxLinearEquationSolver : public MinMaxLinearEquationSolver<Val
 
     virtual void setMatrix(storm::storage::SparseMatrix<ValueType> const& matrix) override;
     virtual void setMatrix(storm::storage::SparseMatrix<ValueType>&& matrix) override;
+    virtual void setMatrix(storm::storage::SparseMatrixView<ValueType> const& matrixView) override;
 
     virtual ~StandardMinMaxLinearEquationSolver() = default;
 
    protected:
+    /*!
+     * @return true if this solver can work with a matrix view instead of the matrix A. If not, views are copied into localA when they are set.
+     */
+    virtual bool canOperateOnMatrixView() const;
+
+    /*!
+     * Ensures that A is set by copying the submatrix of the matrix view if necessary.
+     */
+    void materializeMatrix() const;
+
     // If the solver takes posession of the matrix, we store the moved matrix in this member, so it gets deleted
     // when the solver is destructed.
-    std::unique_ptr<storm::storage::SparseMatrix<ValueType>> localA;
+    // The matrix is mutable as a matrix view is only copied on demand.
+    mutable std::unique_ptr<storm::storage::SparseMatrix<ValueType>> localA;
 
     // A reference to the original sparse matrix given to this solver. If the solver takes posession of the matrix
-    // the reference refers to localA.
-    storm::storage::SparseMatrix<ValueType> const* A;
+    // the reference refers to localA. Null if the solver operates on a matrix view (and the view has not been copied yet).
+    mutable storm::storage::SparseMatrix<ValueType> const* A;
+
+    // If set, the view on the matrix given to this solver.
+    std::unique_ptr<storm::storage::SparseMatrixView<ValueType>> matrixView;
 };
 
 }  // namespace solver
@@ -1,11 +1,17 @@
 #include "storm/solver/TopologicalLinearEquationSolver.h"
 
+#include <array>
+#include <atomic>
+
+#include "storm/adapters/IntelTbbAdapter.h"
+#include "storm/environment/solver/EigenSolverEnvironment.h"
 #include "storm/environment/solver/TopologicalSolverEnvironment.h"
 
 #include "storm/adapters/RationalFunctionAdapter.h"
 #include "storm/exceptions/InvalidEnvironmentException.h"
 #include "storm/exceptions/InvalidStateException.h"
 #include "storm/exceptions/UnexpectedException.h"
+#include "storm/solver/SolverTelemetry.h"
 #include "storm/utility/ProgressMeasurement.h"
 #include "storm/utility/SignalHandler.h"
 #include "storm/utility/Stopwatch.h"
@@ -58,6 +64,25 @@ storm::Environment TopologicalLinearEquationSolver<ValueType>::getEnvironmentFor
     return subEnv;
 }
 
+template<typename ValueType>
+storm::Environment TopologicalLinearEquationSolver<ValueType>::getEnvironmentForDirectSolver(storm::Environment const& env) const {
+    storm::Environment subEnv(env);
+    subEnv.solver().setLinearEquationSolverType(storm::solver::EquationSolverType::Eigen);
+    subEnv.solver().eigen().setMethod(storm::solver::EigenLinearEquationSolverMethod::SparseLU);
+    return subEnv;
+}
+
+template<typename ValueType>
+bool TopologicalLinearEquationSolver<ValueType>::isSolvedDirectly(storm::Environment const& env, uint64_t sccSize) const {
+    auto const& range = env.solver().topological().getDirectSolveSccSizeRange();
+    return range && range->first <= sccSize && sccSize <= range->second;
+}
+
+template<typename ValueType>
+bool TopologicalLinearEquationSolver<ValueType>::isSolvedDensely(storm::Environment const& env, uint64_t sccSize) const {
+    return sccSize <= env.solver().topological().getDenseSolveMaxSccSize();
+}
+
 template<typename ValueType>
 bool TopologicalLinearEquationSolver<ValueType>::internalSolveEquations(Environment const& env, std::vector<ValueType>& x,
                                                                         std::vector<ValueType> const& b) const {
@@ -66,10 +91,18 @@ bool TopologicalLinearEquationSolver<ValueType>::internalSolveEquations(Environm
         env.solver().isForceSoundness() &&
         env.solver().getPrecisionOfLinearEquationSolver(env.solver().topological().getUnderlyingEquationSolverType()).first.is_initialized();
 
-    if (!this->sortedSccDecomposition || (needAdaptPrecision && !this->longestSccChainSize)) {
+    // Solving SCCs in parallel requires the SCC depths. Rational functions are not thread safe, so we always solve them sequentially.
+#ifdef STORM_HAVE_INTELTBB
+    bool const parallel = env.solver().isUseIntelTbb() && !std::is_same_v<ValueType, storm::RationalFunction>;
+#else
+    STORM_LOG_WARN_COND(!env.solver().isUseIntelTbb(), "Storm was built without support for Intel TBB, defaulting to sequential version.");
+    bool const parallel = false;
+#endif
+
+    if (!this->sortedSccDecomposition || ((needAdaptPrecision || parallel) && !this->longestSccChainSize)) {
         STORM_LOG_TRACE("Creating SCC decomposition.");
         storm::utility::Stopwatch sccSw(true);
-        createSortedSccDecomposition(needAdaptPrecision);
+        createSortedSccDecomposition(needAdaptPrecision || parallel);
         sccSw.stop();
         STORM_LOG_INFO("SCC decomposition computed in "
                        << sccSw << ". Found " << this->sortedSccDecomposition->size() << " SCC(s) containing a total of " << x.size()
@@ -81,6 +114,7 @@ bool TopologicalLinearEquationSolver<ValueType>::internalSolveEquations(Environm
     needAdaptPrecision = needAdaptPrecision && (this->sortedSccDecomposition->size() != this->getMatrixRowCount());
 
     storm::Environment sccSolverEnvironment = getEnvironmentForUnderlyingSolver(env, needAdaptPrecision);
+    storm::Environment directSolverEnvironment = getEnvironmentForDirectSolver(env);
 
     if (this->longestSccChainSize) {
         STORM_LOG_INFO("Longest SCC chain size is " << this->longestSccChainSize.get() << ".");
@@ -92,9 +126,13 @@ bool TopologicalLinearEquationSolver<ValueType>::internalSolveEquations(Environm
         if (auto const& scc = *this->sortedSccDecomposition->begin(); scc.size() == 1) {
             // Catch the trivial case where the whole system is just a single state.
             returnValue = solveTrivialScc(*scc.begin(), x, b);
+        } else if (isSolvedDensely(env, scc.size())) {
+            returnValue = solveSmallScc(scc, x, b);
         } else {
-            returnValue = solveFullyConnectedEquationSystem(sccSolverEnvironment, x, b);
+            returnValue = solveFullyConnectedEquationSystem(isSolvedDirectly(env, scc.size()) ? directSolverEnvironment : sccSolverEnvironment, x, b);
         }
+    } else if (parallel) {
+        returnValue = solveSccsParallel(sccSolverEnvironment, directSolverEnvironment, x, b);
     } else {
         // Solve each SCC individually
         storm::storage::BitVector sccAsBitVector(x.size(), false);
@@ -105,16 +143,23 @@ bool TopologicalLinearEquationSolver<ValueType>::internalSolveEquations(Environm
         for (auto const& scc : *this->sortedSccDecomposition) {
             if (scc.size() == 1) {
                 returnValue = solveTrivialScc(*scc.begin(), x, b) && returnValue;
+            } else if (isSolvedDensely(env, scc.size())) {
+                returnValue = solveSmallScc(scc, x, b) && returnValue;
             } else {
                 sccAsBitVector.clear();
                 for (auto const& state : scc) {
                     sccAsBitVector.set(state, true);
                 }
-                returnValue = solveScc(sccSolverEnvironment, sccAsBitVector, x, b) && returnValue;
+                if (isSolvedDirectly(env, scc.size())) {
+                    returnValue = solveScc(directSolverEnvironment, this->directSccSolver, sccAsBitVector, x, b) && returnValue;
+                } else {
+                    returnValue = solveScc(sccSolverEnvironment, this->sccSolver, sccAsBitVector, x, b) && returnValue;
+                }
             }
             ++sccIndex;
             progress.updateProgress(sccIndex);
             if (storm::utility::resources::isTerminate()) {
+                storm::utility::resources::reportAbortedComputation();
                 STORM_LOG_WARN("Topological solver aborted after analyzing " << sccIndex << "/" << this->sortedSccDecomposition->size() << " SCCs.");
                 break;
             }
@@ -138,6 +183,73 @@ void TopologicalLinearEquationSolver<ValueType>::createSortedSccDecomposition(bo
     }
 }
 
+template<typename ValueType>
+bool TopologicalLinearEquationSolver<ValueType>::solveSccsParallel(storm::Environment const& sccSolverEnvironment,
+                                                                   storm::Environment const& directSolverEnvironment, std::vector<ValueType>& x,
+                                                                   std::vector<ValueType> const& b) const {
+#ifdef STORM_HAVE_INTELTBB
+    STORM_LOG_ASSERT(this->sortedSccDecomposition->hasSccDepth(), "Did not compute the SCC depths although they are needed.");
+    // SCCs of depth d only depend on SCCs of depth < d. Hence, SCCs of the same depth can be solved concurrently.
+    std::vector<std::vector<uint64_t>> sccsPerDepth(this->sortedSccDecomposition->getMaxSccDepth() + 1);
+    for (uint64_t sccIndex = 0; sccIndex < this->sortedSccDecomposition->size(); ++sccIndex) {
+        sccsPerDepth[this->sortedSccDecomposition->getSccDepth(sccIndex)].push_back(sccIndex);
+    }
+
+    // Each thread uses its own SCC solver
+    struct SccSolverData {
+        std::unique_ptr<storm::solver::LinearEquationSolver<ValueType>> sccSolver;
+        std::unique_ptr<storm::solver::LinearEquationSolver<ValueType>> directSccSolver;
+        storm::storage::BitVector sccAsBitVector;
+    };
+    tbb::enumerable_thread_specific<SccSolverData> threadData(
+        [&x]() { return SccSolverData{nullptr, nullptr, storm::storage::BitVector(x.size(), false)}; });
+
+    std::atomic<bool> returnValue{true};
+    uint64_t numSolvedSccs = 0;
+    storm::utility::ProgressMeasurement progress("SCCs");
+    progress.setMaxCount(this->sortedSccDecomposition->size());
+    progress.startNewMeasurement(0);
+    for (auto const& sccIndices : sccsPerDepth) {
+        tbb::parallel_for(tbb::blocked_range<uint64_t>(0, sccIndices.size()), [&](tbb::blocked_range<uint64_t> const& range) {
+            auto& data = threadData.local();
+            for (uint64_t i = range.begin(); i < range.end(); ++i) {
+                auto const& scc = this->sortedSccDecomposition->getBlock(sccIndices[i]);
+                bool sccResult;
+                if (scc.size() == 1) {
+                    sccResult = solveTrivialScc(*scc.begin(), x, b);
+                } else if (isSolvedDensely(sccSolverEnvironment, scc.size())) {
+                    sccResult = solveSmallScc(scc, x, b);
+                } else {
+                    data.sccAsBitVector.clear();
+                    for (auto const& state : scc) {
+                        data.sccAsBitVector.set(state, true);
+                    }
+                    if (isSolvedDirectly(sccSolverEnvironment, scc.size())) {
+                        sccResult = solveScc(directSolverEnvironment, data.directSccSolver, data.sccAsBitVector, x, b);
+                    } else {
+                        sccResult = solveScc(sccSolverEnvironment, data.sccSolver, data.sccAsBitVector, x, b);
+                    }
+                }
+                if (!sccResult) {
+                    returnValue = false;
+                }
+            }
+        });
+        numSolvedSccs += sccIndices.size();
+        progress.updateProgress(numSolvedSccs);
+        if (storm::utility::resources::isTerminate()) {
+            storm::utility::resources::reportAbortedComputation();
+            STORM_LOG_WARN("Topological solver aborted after analyzing " << numSolvedSccs << "/" << this->sortedSccDecomposition->size() << " SCCs.");
+            break;
+        }
+    }
+    return returnValue;
+#else
+    STORM_LOG_THROW(false, storm::exceptions::InvalidStateException, "Parallel SCC solving requires Intel TBB.");
+    return false;
+#endif
+}
+
 template<typename ValueType>
 bool TopologicalLinearEquationSolver<ValueType>::solveTrivialScc(uint64_t const& sccState, std::vector<ValueType>& globalX,
                                                                  std::vector<ValueType> const& globalB) const {
@@ -168,6 +280,90 @@ bool TopologicalLinearEquationSolver<ValueType>::solveTrivialScc(uint64_t const&
     return true;
 }
 
+template<typename ValueType>
+bool TopologicalLinearEquationSolver<ValueType>::solveSmallScc(storm::storage::StronglyConnectedComponent const& scc, std::vector<ValueType>& globalX,
+                                                               std::vector<ValueType> const& globalB) const {
+    constexpr uint64_t maxSize = storm::TopologicalSolverEnvironment::DenseSolveSccSizeLimit;
+    uint64_t const n = scc.size();
+    STORM_LOG_ASSERT(n <= maxSize, "SCC of size " << n << " is too large for dense Gaussian elimination.");
+    uint64_t const width = n + 1;
+
+    // The augmented matrix (I - A' | b') of the SCC in row major order, where A' are the transitions within the SCC and b' incorporates the values of
+    // states outside the SCC (which are already computed). For floating point numbers, we avoid a heap allocation.
+    std::conditional_t<storm::NumberTraits<ValueType>::IsExact, std::vector<ValueType>, std::array<ValueType, maxSize * (maxSize + 1)>> buffer;
+    if constexpr (storm::NumberTraits<ValueType>::IsExact) {
+        buffer.assign(n * width, storm::utility::zero<ValueType>());
+    } else {
+        std::fill_n(buffer.begin(), n * width, storm::utility::zero<ValueType>());
+    }
+    ValueType* system = buffer.data();
+    uint64_t localRow = 0;
+    for (auto const& state : scc) {
+        ValueType* row = system + localRow * width;
+        row[localRow] = storm::utility::one<ValueType>();
+        row[n] = globalB[state];
+        for (auto const& entry : this->A->getRow(state)) {
+            auto localColumnIt = std::lower_bound(scc.begin(), scc.end(), entry.getColumn());
+            if (localColumnIt != scc.end() && *localColumnIt == entry.getColumn()) {
+                row[localColumnIt - scc.begin()] -= entry.getValue();
+            } else {
+                row[n] += entry.getValue() * globalX[entry.getColumn()];
+            }
+        }
+        ++localRow;
+    }
+
+    // Forward elimination. For floating point numbers, we pick the pivot with the largest magnitude to keep the numerical error small.
+    for (uint64_t pivotIndex = 0; pivotIndex < n; ++pivotIndex) {
+        uint64_t bestRow = pivotIndex;
+        for (uint64_t candidate = pivotIndex; candidate < n; ++candidate) {
+            ValueType const& candidateValue = system[candidate * width + pivotIndex];
+            if constexpr (storm::NumberTraits<ValueType>::IsExact) {
+                if (!storm::utility::isZero(candidateValue)) {
+                    bestRow = candidate;
+                    break;
+                }
+            } else if (storm::utility::abs(candidateValue) > storm::utility::abs(system[bestRow * width + pivotIndex])) {
+                bestRow = candidate;
+            }
+        }
+        if (storm::utility::isZero(system[bestRow * width + pivotIndex])) {
+            STORM_LOG_WARN("The equation system of an SCC with " << n << " states is singular.");
+            return false;
+        }
+        if (bestRow != pivotIndex) {
+            std::swap_ranges(system + bestRow * width + pivotIndex, system + (bestRow + 1) * width, system + pivotIndex * width + pivotIndex);
+        }
+        ValueType const* pivotRow = system + pivotIndex * width;
+        for (uint64_t rowIndex = pivotIndex + 1; rowIndex < n; ++rowIndex) {
+            ValueType* row = system + rowIndex * width;
+            if (storm::utility::isZero(row[pivotIndex])) {
+                continue;
+            }
+            ValueType factor = row[pivotIndex] / pivotRow[pivotIndex];
+            for (uint64_t column = pivotIndex + 1; column < width; ++column) {
+                row[column] -= factor * pivotRow[column];
+            }
+        }
+    }
+
+    // Back substitution. The solution is stored in the last column.
+    for (uint64_t rowIndex = n; rowIndex > 0;) {
+        --rowIndex;
+        ValueType* row = system + rowIndex * width;
+        for (uint64_t column = rowIndex + 1; column < n; ++column) {
+            row[n] -= row[column] * system[column * width + n];
+        }
+        row[n] /= row[rowIndex];
+    }
+    localRow = 0;
+    for (auto const& state : scc) {
+        globalX[state] = std::move(system[localRow * width + n]);
+        ++localRow;
+    }
+    return true;
+}
+
 template<typename ValueType>
 bool TopologicalLinearEquationSolver<ValueType>::solveFullyConnectedEquationSystem(storm::Environment const& sccSolverEnvironment, std::vector<ValueType>& x,
                                                                                    std::vector<ValueType> const& b) const {
@@ -188,21 +384,24 @@ bool TopologicalLinearEquationSolver<ValueType>::solveFullyConnectedEquationSyst
 }
 
 template<typename ValueType>
-bool TopologicalLinearEquationSolver<ValueType>::solveScc(storm::Environment const& sccSolverEnvironment, storm::storage::BitVector const& scc,
-                                                          std::vector<ValueType>& globalX, std::vector<ValueType> const& globalB) const {
+bool TopologicalLinearEquationSolver<ValueType>::solveScc(storm::Environment const& sccSolverEnvironment,
+                                                          std::unique_ptr<storm::solver::LinearEquationSolver<ValueType>>& subSolver,
+                                                          storm::storage::BitVector const& scc, std::vector<ValueType>& globalX,
+                                                          std::vector<ValueType> const& globalB) const {
+    storm::utility::Stopwatch sccWatch(true);
     // Set up the SCC solver
-    if (!this->sccSolver) {
-        this->sccSolver = GeneralLinearEquationSolverFactory<ValueType>().create(sccSolverEnvironment);
-        this->sccSolver->setCachingEnabled(true);
+    if (!subSolver) {
+        subSolver = GeneralLinearEquationSolverFactory<ValueType>().create(sccSolverEnvironment);
+        subSolver->setCachingEnabled(true);
     }
 
     // Matrix
-    bool asEquationSystem = this->sccSolver->getEquationProblemFormat(sccSolverEnvironment) == LinearEquationSolverProblemFormat::EquationSystem;
+    bool asEquationSystem = subSolver->getEquationProblemFormat(sccSolverEnvironment) == LinearEquationSolverProblemFormat::EquationSystem;
     storm::storage::SparseMatrix<ValueType> sccA = this->A->getSubmatrix(true, scc, scc, asEquationSystem);
     if (asEquationSystem) {
         sccA.convertToEquationSystem();
     }
-    this->sccSolver->setMatrix(std::move(sccA));
+    subSolver->setMatrix(std::move(sccA));
 
     // x Vector
     auto sccX = storm::utility::vector::filterVector(globalX, scc);
@@ -222,21 +421,25 @@ bool TopologicalLinearEquationSolver<ValueType>::solveScc(storm::Environment con
 
     // lower/upper bounds
     if (this->hasLowerBound(storm::solver::AbstractEquationSolver<ValueType>::BoundType::Global)) {
-        this->sccSolver->setLowerBound(this->getLowerBound());
+        subSolver->setLowerBound(this->getLowerBound());
     } else if (this->hasLowerBound(storm::solver::AbstractEquationSolver<ValueType>::BoundType::Local)) {
-        this->sccSolver->setLowerBounds(storm::utility::vector::filterVector(this->getLowerBounds(), scc));
+        subSolver->setLowerBounds(storm::utility::vector::filterVector(this->getLowerBounds(), scc));
     }
     if (this->hasUpperBound(storm::solver::AbstractEquationSolver<ValueType>::BoundType::Global)) {
-        this->sccSolver->setUpperBound(this->getUpperBound());
+        subSolver->setUpperBound(this->getUpperBound());
     } else if (this->hasUpperBound(storm::solver::AbstractEquationSolver<ValueType>::BoundType::Local)) {
-        this->sccSolver->setUpperBounds(storm::utility::vector::filterVector(this->getUpperBounds(), scc));
+        subSolver->setUpperBounds(storm::utility::vector::filterVector(this->getUpperBounds(), scc));
     }
 
     // std::cout << "rhs is " << storm::utility::vector::toString(sccB) << '\n';
     // std::cout << "x is " << storm::utility::vector::toString(sccX) << '\n';
 
-    bool returnvalue = this->sccSolver->solveEquations(sccSolverEnvironment, sccX, sccB);
+    bool returnvalue = subSolver->solveEquations(sccSolverEnvironment, sccX, sccB);
     storm::utility::vector::setVectorValues(globalX, scc, sccX);
+    if (auto const& telemetry = sccSolverEnvironment.solver().getTelemetry()) {
+        sccWatch.stop();
+        telemetry->sccSolved(sccX.size(), subSolver->getNumberOfIterationsOfLastSolve(), sccWatch.getTimeInNanoseconds() / 1e9);
+    }
     return returnvalue;
 }
 
@@ -256,6 +459,7 @@ void TopologicalLinearEquationSolver<ValueType>::clearCache() const {
     sortedSccDecomposition.reset();
     longestSccChainSize = boost::none;
     sccSolver.reset();
+    directSccSolver.reset();
     LinearEquationSolver<ValueType>::clearCache();
 }
 
@@ -36,17 +36,30 @@ class TopologicalLinearEquationSolver : public LinearEquationSolver<ValueType> {
 
     storm::Environment getEnvironmentForUnderlyingSolver(storm::Environment const& env, bool adaptPrecision = false) const;
 
+    // Returns an environment that selects a direct solver (sparse LU factorization) for SCCs whose size is within the range given in the environment.
+    storm::Environment getEnvironmentForDirectSolver(storm::Environment const& env) const;
+    bool isSolvedDirectly(storm::Environment const& env, uint64_t sccSize) const;
+    // Returns true iff an SCC of the given size is to be solved with dense Gaussian elimination
+    bool isSolvedDensely(storm::Environment const& env, uint64_t sccSize) const;
+
     // Creates an SCC decomposition and sorts the SCCs according to a topological sort.
     void createSortedSccDecomposition(bool needLongestChainSize) const;
 
+    // Solves all SCCs (with more than one SCC in total). SCCs with the same depth do not depend on each other and are solved concurrently.
+    bool solveSccsParallel(storm::Environment const& sccSolverEnvironment, storm::Environment const& directSolverEnvironment, std::vector<ValueType>& x,
+                           std::vector<ValueType> const& b) const;
+
     // Solves the SCC with the given index
     // ... for the case that the SCC is trivial
     bool solveTrivialScc(uint64_t const& sccState, std::vector<ValueType>& globalX, std::vector<ValueType> const& globalB) const;
+    // ... for the case that the SCC is small enough for dense Gaussian elimination
+    bool solveSmallScc(storm::storage::StronglyConnectedComponent const& scc, std::vector<ValueType>& globalX, std::vector<ValueType> const& globalB) const;
     // ... for the case that there is just one large SCC
     bool solveFullyConnectedEquationSystem(storm::Environment const& sccSolverEnvironment, std::vector<ValueType>& x, std::vector<ValueType> const& b) const;
     // ... for the remaining cases (1 < scc.size() < x.size())
-    bool solveScc(storm::Environment const& sccSolverEnvironment, storm::storage::BitVector const& scc, std::vector<ValueType>& globalX,
-                  std::vector<ValueType> const& globalB) const;
+    // The given solver is created if it does not exist yet.
+    bool solveScc(storm::Environment const& sccSolverEnvironment, std::unique_ptr<storm::solver::LinearEquationSolver<ValueType>>& subSolver,
+                  storm::storage::BitVector const& scc, std::vector<ValueType>& globalX, std::vector<ValueType> const& globalB) const;
 
     // If the solver takes posession of the matrix, we store the moved matrix in this member, so it gets deleted
     // when the solver is destructed.
@@ -60,6 +73,7 @@ class TopologicalLinearEquationSolver : public LinearEquationSolver<ValueType> {
     mutable std::unique_ptr<storm::storage::StronglyConnectedComponentDecomposition<ValueType>> sortedSccDecomposition;
     mutable boost::optional<uint64_t> longestSccChainSize;
     mutable std::unique_ptr<storm::solver::LinearEquationSolver<ValueType>> sccSolver;
+    mutable std::unique_ptr<storm::solver::LinearEquationSolver<ValueType>> directSccSolver;
 };
 
 template<typename ValueType>
@@ -1,5 +1,8 @@
 #include "storm/solver/TopologicalMinMaxLinearEquationSolver.h"
 
+#include <atomic>
+
+#include "storm/adapters/IntelTbbAdapter.h"
 #include "storm/environment/solver/MinMaxSolverEnvironment.h"
 #include "storm/environment/solver/TopologicalSolverEnvironment.h"
 
@@ -7,6 +10,7 @@
 #include "storm/exceptions/InvalidStateException.h"
 #include "storm/exceptions/UncheckedRequirementException.h"
 #include "storm/exceptions/UnexpectedException.h"
+#include "storm/solver/SolverTelemetry.h"
 #include "storm/utility/ProgressMeasurement.h"
 #include "storm/utility/SignalHandler.h"
 #include "storm/utility/Stopwatch.h"
@@ -58,10 +62,18 @@ bool TopologicalMinMaxLinearEquationSolver<ValueType, SolutionType>::internalSol
     // For sound computations we need to increase the precision in each SCC
     bool needAdaptPrecision = env.solver().isForceSoundness();
 
-    if (!this->sortedSccDecomposition || (needAdaptPrecision && !this->longestSccChainSize)) {
+    // Solving SCCs in parallel requires the SCC depths
+#ifdef STORM_HAVE_INTELTBB
+    bool const parallel = env.solver().isUseIntelTbb();
+#else
+    STORM_LOG_WARN_COND(!env.solver().isUseIntelTbb(), "Storm was built without support for Intel TBB, defaulting to sequential version.");
+    bool const parallel = false;
+#endif
+
+    if (!this->sortedSccDecomposition || ((needAdaptPrecision || parallel) && !this->longestSccChainSize)) {
         STORM_LOG_TRACE("Creating SCC decomposition.");
         storm::utility::Stopwatch sccSw(true);
-        createSortedSccDecomposition(needAdaptPrecision);
+        createSortedSccDecomposition(needAdaptPrecision || parallel);
         sccSw.stop();
         STORM_LOG_INFO("SCC decomposition computed in "
                        << sccSw << ". Found " << this->sortedSccDecomposition->size() << " SCC(s) containing a total of " << x.size()
@@ -99,46 +111,38 @@ bool TopologicalMinMaxLinearEquationSolver<ValueType, SolutionType>::internalSol
                 this->schedulerChoices = std::vector<uint64_t>(x.size());
             }
         }
-        storm::storage::BitVector sccRowGroupsAsBitVector(x.size(), false);
-        storm::storage::BitVector sccRowsAsBitVector(b.size(), false);
-        uint64_t sccIndex = 0;
-        storm::utility::ProgressMeasurement progress("states");
-        progress.setMaxCount(x.size());
-        progress.startNewMeasurement(0);
-        for (auto const& scc : *this->sortedSccDecomposition) {
-            if (scc.size() == 1) {
-                returnValue = solveTrivialScc(*scc.begin(), dir, x, b) && returnValue;
-            } else {
-                STORM_LOG_TRACE("Solving SCC of size " << scc.size() << ".");
-                sccRowGroupsAsBitVector.clear();
-                sccRowsAsBitVector.clear();
-                for (auto const& group : scc) {  // Group refers to state
-                    sccRowGroupsAsBitVector.set(group, true);
-
-                    if (!this->choiceFixedForRowGroup || !this->choiceFixedForRowGroup.get()[group]) {
-                        for (uint64_t row = this->A->getRowGroupIndices()[group]; row < this->A->getRowGroupIndices()[group + 1]; ++row) {
-                            sccRowsAsBitVector.set(row, true);
-                        }
-                    } else {
-                        auto row = this->A->getRowGroupIndices()[group] + this->getInitialScheduler()[group];
-                        sccRowsAsBitVector.set(row, true);
-                        STORM_LOG_INFO("Fixing state " << group << " to choice " << this->getInitialScheduler()[group] << ".");
-                    }
+        if (parallel) {
+            returnValue = solveSccsParallel(sccSolverEnvironment, dir, x, b);
+        } else {
+            storm::storage::BitVector sccRowGroupsAsBitVector(x.size(), false);
+            storm::storage::BitVector sccRowsAsBitVector(b.size(), false);
+            uint64_t sccIndex = 0;
+            storm::utility::ProgressMeasurement progress("states");
+            progress.setMaxCount(x.size());
+            progress.startNewMeasurement(0);
+            for (auto const& scc : *this->sortedSccDecomposition) {
+                if (scc.size() == 1) {
+                    returnValue = solveTrivialScc(*scc.begin(), dir, x, b) && returnValue;
+                } else {
+                    STORM_LOG_TRACE("Solving SCC of size " << scc.size() << ".");
+                    getSccRowGroupsAndRows(scc, sccRowGroupsAsBitVector, sccRowsAsBitVector);
+                    returnValue = solveScc(sccSolverEnvironment, this->sccSolver, dir, sccRowGroupsAsBitVector, sccRowsAsBitVector, x, b) && returnValue;
+                }
+                ++sccIndex;
+                progress.updateProgress(sccIndex);
+                if (storm::utility::resources::isTerminate()) {
+                    storm::utility::resources::reportAbortedComputation();
+                    STORM_LOG_WARN("Topological solver aborted after analyzing " << sccIndex << "/" << this->sortedSccDecomposition->size() << " SCCs.");
+                    break;
                 }
-                returnValue = solveScc(sccSolverEnvironment, dir, sccRowGroupsAsBitVector, sccRowsAsBitVector, x, b) && returnValue;
-            }
-            ++sccIndex;
-            progress.updateProgress(sccIndex);
-            if (storm::utility::resources::isTerminate()) {
-                STORM_LOG_WARN("Topological solver aborted after analyzing " << sccIndex << "/" << this->sortedSccDecomposition->size() << " SCCs.");
-                break;
             }
         }
 
         // If requested, we store the scheduler for retrieval.
         if (this->isTrackSchedulerSet()) {
             if (!auxiliaryRowGroupVector) {
-                auxiliaryRowGroupVector = std::make_unique<std::vector<ValueType>>(this->A->getRowGroupCount());
+                auxiliaryRowGroupVector =
+                    std::make_unique<std::vector<ValueType>>(storm::utility::vector::createWithParallelFirstTouch<ValueType>(this->A->getRowGroupCount()));
             }
             this->schedulerChoices = std::vector<uint_fast64_t>(this->A->getRowGroupCount());
             this->A->multiplyAndReduce(dir, this->A->getRowGroupIndices(), x, &b, *auxiliaryRowGroupVector.get(), &this->schedulerChoices.get());
@@ -162,6 +166,85 @@ void TopologicalMinMaxLinearEquationSolver<ValueType, SolutionType>::createSorte
     }
 }
 
+template<typename ValueType, typename SolutionType>
+void TopologicalMinMaxLinearEquationSolver<ValueType, SolutionType>::getSccRowGroupsAndRows(storm::storage::StronglyConnectedComponent const& scc,
+                                                                                            storm::storage::BitVector& sccRowGroups,
+                                                                                            storm::storage::BitVector& sccRows) const {
+    sccRowGroups.clear();
+    sccRows.clear();
+    for (auto const& group : scc) {  // Group refers to state
+        sccRowGroups.set(group, true);
+
+        if (!this->choiceFixedForRowGroup || !this->choiceFixedForRowGroup.get()[group]) {
+            for (uint64_t row = this->A->getRowGroupIndices()[group]; row < this->A->getRowGroupIndices()[group + 1]; ++row) {
+                sccRows.set(row, true);
+            }
+        } else {
+            auto row = this->A->getRowGroupIndices()[group] + this->getInitialScheduler()[group];
+            sccRows.set(row, true);
+            STORM_LOG_INFO("Fixing state " << group << " to choice " << this->getInitialScheduler()[group] << ".");
+        }
+    }
+}
+
+template<typename ValueType, typename SolutionType>
+bool TopologicalMinMaxLinearEquationSolver<ValueType, SolutionType>::solveSccsParallel(storm::Environment const& sccSolverEnvironment,
+                                                                                       OptimizationDirection dir, std::vector<SolutionType>& x,
+                                                                                       std::vector<ValueType> const& b) const {
+#ifdef STORM_HAVE_INTELTBB
+    STORM_LOG_ASSERT(this->sortedSccDecomposition->hasSccDepth(), "Did not compute the SCC depths although they are needed.");
+    // SCCs of depth d only depend on SCCs of depth < d. Hence, SCCs of the same depth can be solved concurrently.
+    std::vector<std::vector<uint64_t>> sccsPerDepth(this->sortedSccDecomposition->getMaxSccDepth() + 1);
+    for (uint64_t sccIndex = 0; sccIndex < this->sortedSccDecomposition->size(); ++sccIndex) {
+        sccsPerDepth[this->sortedSccDecomposition->getSccDepth(sccIndex)].push_back(sccIndex);
+    }
+
+    // Each thread uses its own SCC solver
+    struct SccSolverData {
+        std::unique_ptr<storm::solver::MinMaxLinearEquationSolver<ValueType>> sccSolver;
+        storm::storage::BitVector sccRowGroups;
+        storm::storage::BitVector sccRows;
+    };
+    tbb::enumerable_thread_specific<SccSolverData> threadData(
+        [&x, &b]() { return SccSolverData{nullptr, storm::storage::BitVector(x.size(), false), storm::storage::BitVector(b.size(), false)}; });
+
+    std::atomic<bool> returnValue{true};
+    uint64_t numSolvedSccs = 0;
+    storm::utility::ProgressMeasurement progress("SCCs");
+    progress.setMaxCount(this->sortedSccDecomposition->size());
+    progress.startNewMeasurement(0);
+    for (auto const& sccIndices : sccsPerDepth) {
+        tbb::parallel_for(tbb::blocked_range<uint64_t>(0, sccIndices.size()), [&](tbb::blocked_range<uint64_t> const& range) {
+            auto& data = threadData.local();
+            for (uint64_t i = range.begin(); i < range.end(); ++i) {
+                auto const& scc = this->sortedSccDecomposition->getBlock(sccIndices[i]);
+                bool sccResult;
+                if (scc.size() == 1) {
+                    sccResult = solveTrivialScc(*scc.begin(), dir, x, b);
+                } else {
+                    getSccRowGroupsAndRows(scc, data.sccRowGroups, data.sccRows);
+                    sccResult = solveScc(sccSolverEnvironment, data.sccSolver, dir, data.sccRowGroups, data.sccRows, x, b);
+                }
+                if (!sccResult) {
+                    returnValue = false;
+                }
+            }
+        });
+        numSolvedSccs += sccIndices.size();
+        progress.updateProgress(numSolvedSccs);
+        if (storm::utility::resources::isTerminate()) {
+            storm::utility::resources::reportAbortedComputation();
+            STORM_LOG_WARN("Topological solver aborted after analyzing " << numSolvedSccs << "/" << this->sortedSccDecomposition->size() << " SCCs.");
+            break;
+        }
+    }
+    return returnValue;
+#else
+    STORM_LOG_THROW(false, storm::exceptions::InvalidStateException, "Parallel SCC solving requires Intel TBB.");
+    return false;
+#endif
+}
+
 template<typename ValueType, typename SolutionType>
 bool TopologicalMinMaxLinearEquationSolver<ValueType, SolutionType>::solveTrivialScc(uint64_t const& sccState, OptimizationDirection dir,
                                                                                      std::vector<ValueType>& globalX,
@@ -292,18 +375,20 @@ bool TopologicalMinMaxLinearEquationSolver<ValueType, SolutionType>::solveFullyC
 }
 
 template<typename ValueType, typename SolutionType>
-bool TopologicalMinMaxLinearEquationSolver<ValueType, SolutionType>::solveScc(storm::Environment const& sccSolverEnvironment, OptimizationDirection dir,
-                                                                              storm::storage::BitVector const& sccRowGroups,
+bool TopologicalMinMaxLinearEquationSolver<ValueType, SolutionType>::solveScc(storm::Environment const& sccSolverEnvironment,
+                                                                              std::unique_ptr<storm::solver::MinMaxLinearEquationSolver<ValueType>>& subSolver,
+                                                                              OptimizationDirection dir, storm::storage::BitVector const& sccRowGroups,
                                                                               storm::storage::BitVector const& sccRows, std::vector<ValueType>& globalX,
                                                                               std::vector<ValueType> const& globalB) const {
+    storm::utility::Stopwatch sccWatch(true);
     // Set up the SCC solver
-    if (!this->sccSolver) {
-        this->sccSolver = GeneralMinMaxLinearEquationSolverFactory<ValueType>().create(sccSolverEnvironment);
-        this->sccSolver->setCachingEnabled(true);
+    if (!subSolver) {
+        subSolver = GeneralMinMaxLinearEquationSolverFactory<ValueType>().create(sccSolverEnvironment);
+        subSolver->setCachingEnabled(true);
     }
-    this->sccSolver->setHasUniqueSolution(this->hasUniqueSolution());
-    this->sccSolver->setHasNoEndComponents(this->hasNoEndComponents());
-    this->sccSolver->setTrackScheduler(this->isTrackSchedulerSet());
+    subSolver->setHasUniqueSolution(this->hasUniqueSolution());
+    subSolver->setHasNoEndComponents(this->hasNoEndComponents());
+    subSolver->setTrackScheduler(this->isTrackSchedulerSet());
 
     storm::storage::SparseMatrix<ValueType> sccA;
     if (this->choiceFixedForRowGroup) {
@@ -317,7 +402,7 @@ bool TopologicalMinMaxLinearEquationSolver<ValueType, SolutionType>::solveScc(st
             // As we removed the entries where the choice was fixed, we need to change the scheduler.
             // We set the scheduler to 0 for those states.
             storm::utility::vector::setVectorValues<uint_fast64_t>(sccInitChoices, choiceFixedForStateSCC, 0);
-            this->sccSolver->setInitialScheduler(std::move(sccInitChoices));
+            subSolver->setInitialScheduler(std::move(sccInitChoices));
         }
 
     } else {
@@ -326,11 +411,11 @@ bool TopologicalMinMaxLinearEquationSolver<ValueType, SolutionType>::solveScc(st
         // initial scheduler
         if (this->hasInitialScheduler()) {
             auto sccInitChoices = storm::utility::vector::filterVector(this->getInitialScheduler(), sccRowGroups);
-            this->sccSolver->setInitialScheduler(std::move(sccInitChoices));
+            subSolver->setInitialScheduler(std::move(sccInitChoices));
         }
     }
 
-    this->sccSolver->setMatrix(std::move(sccA));
+    subSolver->setMatrix(std::move(sccA));
 
     // x Vector
     auto sccX = storm::utility::vector::filterVector(globalX, sccRowGroups);
@@ -350,18 +435,18 @@ bool TopologicalMinMaxLinearEquationSolver<ValueType, SolutionType>::solveScc(st
 
     // lower/upper bounds
     if (this->hasLowerBound(storm::solver::AbstractEquationSolver<ValueType>::BoundType::Global)) {
-        this->sccSolver->setLowerBound(this->getLowerBound());
+        subSolver->setLowerBound(this->getLowerBound());
     } else if (this->hasLowerBound(storm::solver::AbstractEquationSolver<ValueType>::BoundType::Local)) {
-        this->sccSolver->setLowerBounds(storm::utility::vector::filterVector(this->getLowerBounds(), sccRowGroups));
+        subSolver->setLowerBounds(storm::utility::vector::filterVector(this->getLowerBounds(), sccRowGroups));
     }
     if (this->hasUpperBound(storm::solver::AbstractEquationSolver<ValueType>::BoundType::Global)) {
-        this->sccSolver->setUpperBound(this->getUpperBound());
+        subSolver->setUpperBound(this->getUpperBound());
     } else if (this->hasUpperBound(storm::solver::AbstractEquationSolver<ValueType>::BoundType::Local)) {
-        this->sccSolver->setUpperBounds(storm::utility::vector::filterVector(this->getUpperBounds(), sccRowGroups));
+        subSolver->setUpperBounds(storm::utility::vector::filterVector(this->getUpperBounds(), sccRowGroups));
     }
 
     // Requirements
-    auto req = this->sccSolver->getRequirements(sccSolverEnvironment, dir);
+    auto req = subSolver->getRequirements(sccSolverEnvironment, dir);
     if (req.upperBounds() && this->hasUpperBound()) {
         req.clearUpperBounds();
     }
@@ -376,19 +461,24 @@ bool TopologicalMinMaxLinearEquationSolver<ValueType, SolutionType>::solveScc(st
     }
     STORM_LOG_THROW(!req.hasEnabledCriticalRequirement(), storm::exceptions::UncheckedRequirementException,
                     "Solver requirements " + req.getEnabledRequirementsAsString() + " not checked.");
-    this->sccSolver->setRequirementsChecked(true);
+    subSolver->setRequirementsChecked(true);
 
     // Invoke scc solver
-    bool res = this->sccSolver->solveEquations(sccSolverEnvironment, dir, sccX, sccB);
+    bool res = subSolver->solveEquations(sccSolverEnvironment, dir, sccX, sccB);
 
     // Set Scheduler choices
     if (this->isTrackSchedulerSet()) {
-        storm::utility::vector::setVectorValues(this->schedulerChoices.get(), sccRowGroups, this->sccSolver->getSchedulerChoices());
+        storm::utility::vector::setVectorValues(this->schedulerChoices.get(), sccRowGroups, subSolver->getSchedulerChoices());
     }
 
     // Set solution
     storm::utility::vector::setVectorValues(globalX, sccRowGroups, sccX);
 
+    if (auto const& telemetry = sccSolverEnvironment.solver().getTelemetry()) {
+        sccWatch.stop();
+        telemetry->sccSolved(sccX.size(), subSolver->getNumberOfIterationsOfLastSolve(), sccWatch.getTimeInNanoseconds() / 1e9);
+    }
+
     return res;
 }
 
@@ -378,6 +378,15 @@ bool Z3SmtSolver::unsetTimeout() {
 #endif
 }
 
+bool Z3SmtSolver::interrupt() {
+#ifdef STORM_HAVE_Z3
+    context->interrupt();
+    return true;
+#else
+    STORM_LOG_THROW(false, storm::exceptions::NotSupportedException, "Storm is compiled without Z3 support.");
+#endif
+}
+
 std::string Z3SmtSolver::getSmtLibString() const {
 #ifdef STORM_HAVE_Z3
     return solver->to_smt2();
@@ -73,6 +73,8 @@ class Z3SmtSolver : public SmtSolver {
 
     virtual bool unsetTimeout() override;
 
+    virtual bool interrupt() override;
+
     virtual std::string getSmtLibString() const override;
 
    private:
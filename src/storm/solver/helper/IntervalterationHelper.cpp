@@ -84,6 +84,15 @@ bool checkConvergence(std::pair<std::vector<ValueType>, std::vector<ValueType>>
     return true;
 }
 
+template<typename ValueType>
+double getIntervalIterationErrorBound(IIData<ValueType> const& data) {
+    ValueType maxDiff = storm::utility::zero<ValueType>();
+    for (uint64_t i = 0; i < data.x.size(); ++i) {
+        maxDiff = std::max<ValueType>(maxDiff, data.y[i] - data.x[i]);
+    }
+    return storm::utility::convertNumber<double>(maxDiff) / 2.0;
+}
+
 template<typename ValueType, bool TrivialRowGrouping>
 template<OptimizationDirection Dir>
 SolverStatus IntervalIterationHelper<ValueType, TrivialRowGrouping>::II(std::pair<std::vector<ValueType>, std::vector<ValueType>>& xy,
@@ -163,6 +172,9 @@ SolverStatus IntervalIterationHelper<ValueType, TrivialRowGrouping>::II(std::vec
     return II(operand, offsets, numIterations, relative, precision, prepareLowerBounds, prepareUpperBounds, dir, iterationCallback, relevantValues);
 }
 
+template double getIntervalIterationErrorBound(IIData<double> const& data);
+template double getIntervalIterationErrorBound(IIData<storm::RationalNumber> const& data);
+
 template class IntervalIterationHelper<double, true>;
 template class IntervalIterationHelper<double, false>;
 template class IntervalIterationHelper<storm::RationalNumber, true>;
@@ -1,3 +1,5 @@
+#pragma once
+
 #include <functional>
 #include <memory>
 #include <optional>
@@ -17,6 +19,13 @@ struct IIData {
     SolverStatus const status;
 };
 
+/*!
+ * Computes the largest distance between the center of the given lower and upper bounds and the bounds themselves, i.e., the absolute error of
+ * the solution that interval iteration yields if it is stopped with the given bounds.
+ */
+template<typename ValueType>
+double getIntervalIterationErrorBound(IIData<ValueType> const& data);
+
 /*!
  * Implements interval iteration
  * @see https://doi.org/10.1007/978-3-319-63387-9_8
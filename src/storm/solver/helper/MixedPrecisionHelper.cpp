@@ -0,0 +1,138 @@
+#include "storm/solver/helper/MixedPrecisionHelper.h"
+
+#include <cmath>
+
+#include "storm/solver/helper/ValueIterationHelper.h"
+#include "storm/solver/helper/ValueIterationOperator.h"
+#include "storm/storage/SparseMatrix.h"
+#include "storm/utility/Extremum.h"
+#include "storm/utility/macros.h"
+
+namespace storm::solver::helper {
+
+// Single precision value iteration is not run with a stricter (relative) precision than this, as it might not be able to converge otherwise.
+static double const SinglePrecisionLimit = 1e-6;
+// The relative distance between an approximation and the candidate bounds derived from it.
+static double const BoundCandidateMargin = 1e-4;
+
+template<storm::OptimizationDirection Dir, bool Lower>
+class BoundVerificationBackend {
+   public:
+    BoundVerificationBackend(std::vector<double> const& candidate) : candidate{candidate} {
+        // intentionally empty
+    }
+
+    void startNewIteration() {
+        isValid = true;
+    }
+
+    void firstRow(double&& value, [[maybe_unused]] uint64_t rowGroup, [[maybe_unused]] uint64_t row) {
+        best = std::move(value);
+    }
+
+    void nextRow(double&& value, [[maybe_unused]] uint64_t rowGroup, [[maybe_unused]] uint64_t row) {
+        best &= value;
+    }
+
+    void applyUpdate(double& currValue, uint64_t rowGroup) {
+        if constexpr (Lower) {
+            isValid = *best >= candidate[rowGroup];
+        } else {
+            isValid = *best <= candidate[rowGroup];
+        }
+        currValue = *best;
+    }
+
+    void endOfIteration() const {
+        // intentionally left empty.
+    }
+
+    bool converged() const {
+        return isValid;
+    }
+
+    bool abort() const {
+        return !isValid;
+    }
+
+   private:
+    storm::utility::Extremum<Dir, double> best;
+    std::vector<double> const& candidate;
+    bool isValid{true};
+};
+
+template<bool TrivialRowGrouping>
+MixedPrecisionHelper<TrivialRowGrouping>::MixedPrecisionHelper(storm::storage::SparseMatrix<double> const& matrix,
+                                                               std::shared_ptr<ValueIterationOperator<double, TrivialRowGrouping>> viOperator)
+    : singlePrecisionOperator(std::make_shared<ValueIterationOperator<float, TrivialRowGrouping>>()), viOperator(viOperator) {
+    if constexpr (TrivialRowGrouping) {
+        singlePrecisionOperator->template setMatrix<true>(matrix);
+    } else {
+        singlePrecisionOperator->template setMatrix<true>(matrix, &viOperator->getRowGroupIndices());
+    }
+}
+
+template<bool TrivialRowGrouping>
+SolverStatus MixedPrecisionHelper<TrivialRowGrouping>::approximate(std::vector<double>& operand, std::vector<double> const& offsets, uint64_t& numIterations,
+                                                                   double const& precision, std::optional<storm::OptimizationDirection> const& dir,
+                                                                   std::function<SolverStatus(SolverStatus const&)> const& iterationCallback) const {
+    std::vector<float> singlePrecisionOperand(operand.begin(), operand.end());
+    std::vector<float> singlePrecisionOffsets(offsets.begin(), offsets.end());
+    float const singlePrecision = static_cast<float>(std::max(precision, SinglePrecisionLimit));
+    ValueIterationHelper<float, TrivialRowGrouping> viHelper(singlePrecisionOperator);
+    auto status = viHelper.VI(singlePrecisionOperand, singlePrecisionOffsets, numIterations, true, singlePrecision, dir, iterationCallback);
+    operand.assign(singlePrecisionOperand.begin(), singlePrecisionOperand.end());
+    return status;
+}
+
+template<bool TrivialRowGrouping>
+template<bool Lower>
+bool MixedPrecisionHelper<TrivialRowGrouping>::tightenBounds(std::vector<double>& bounds, std::vector<double> const& approximation,
+                                                             std::vector<double> const& offsets, std::optional<storm::OptimizationDirection> const& dir) const {
+    STORM_LOG_ASSERT(bounds.size() == approximation.size(), "Dimension mismatch.");
+    STORM_LOG_ASSERT(TrivialRowGrouping || dir.has_value(), "no optimization direction given!");
+    std::vector<double> candidate;
+    candidate.reserve(bounds.size());
+    for (uint64_t i = 0; i < bounds.size(); ++i) {
+        double const margin = std::abs(approximation[i]) * BoundCandidateMargin;
+        if constexpr (Lower) {
+            candidate.push_back(std::max(bounds[i], approximation[i] - margin));
+        } else {
+            candidate.push_back(std::min(bounds[i], approximation[i] + margin));
+        }
+    }
+    // For equation systems with a unique solution, a vector is a lower (upper) bound if applying the operator does not decrease (increase) any value.
+    std::vector<double> result(candidate.size());
+    bool isBound;
+    if (!dir.has_value() || maximize(*dir)) {
+        BoundVerificationBackend<storm::OptimizationDirection::Maximize, Lower> backend{candidate};
+        isBound = viOperator->apply(candidate, result, offsets, backend);
+    } else {
+        BoundVerificationBackend<storm::OptimizationDirection::Minimize, Lower> backend{candidate};
+        isBound = viOperator->apply(candidate, result, offsets, backend);
+    }
+    if (isBound) {
+        bounds.swap(candidate);
+    }
+    STORM_LOG_INFO("Single precision approximation " << (isBound ? "yields" : "does not yield") << " tighter " << (Lower ? "lower" : "upper") << " bounds.");
+    return isBound;
+}
+
+template<bool TrivialRowGrouping>
+bool MixedPrecisionHelper<TrivialRowGrouping>::tightenLowerBounds(std::vector<double>& bounds, std::vector<double> const& approximation,
+                                                                  std::vector<double> const& offsets,
+                                                                  std::optional<storm::OptimizationDirection> const& dir) const {
+    return tightenBounds<true>(bounds, approximation, offsets, dir);
+}
+
+template<bool TrivialRowGrouping>
+bool MixedPrecisionHelper<TrivialRowGrouping>::tightenUpperBounds(std::vector<double>& bounds, std::vector<double> const& approximation,
+                                                                  std::vector<double> const& offsets,
+                                                                  std::optional<storm::OptimizationDirection> const& dir) const {
+    return tightenBounds<false>(bounds, approximation, offsets, dir);
+}
+
+template class MixedPrecisionHelper<true>;
+template class MixedPrecisionHelper<false>;
+
+}  // namespace storm::solver::helper
@@ -0,0 +1,71 @@
+#pragma once
+
+#include <functional>
+#include <memory>
+#include <optional>
+#include <vector>
+
+#include "storm/solver/OptimizationDirection.h"
+#include "storm/solver/SolverStatus.h"
+#include "storm/solver/helper/ValueIterationOperatorForward.h"
+
+namespace storm::storage {
+template<typename ValueType>
+class SparseMatrix;
+}
+
+namespace storm::solver::helper {
+
+/*!
+ * Implements a mixed precision scheme for equation systems over doubles.
+ * A first approximation of the solution is computed with value iteration on single precision matrix entries and operands, which halves the memory traffic
+ * of the operator. A double precision method then polishes the approximation, e.g., by using it as initial guess for value iteration or by deriving initial
+ * bounds for interval iteration from it.
+ */
+template<bool TrivialRowGrouping>
+class MixedPrecisionHelper {
+   public:
+    /*!
+     * @param matrix the matrix from which the single precision operator is built
+     * @param viOperator the double precision operator for the same matrix. Used to verify bounds.
+     */
+    MixedPrecisionHelper(storm::storage::SparseMatrix<double> const& matrix, std::shared_ptr<ValueIterationOperator<double, TrivialRowGrouping>> viOperator);
+
+    /*!
+     * Approximates the solution using value iteration in single precision, starting with the given operand.
+     * The relative termination criterion is used and the precision is at most as strict as what can reasonably be achieved with single precision.
+     * @param operand the initial values. Contains the approximation afterwards.
+     * @return the status of the single precision value iteration
+     */
+    SolverStatus approximate(std::vector<double>& operand, std::vector<double> const& offsets, uint64_t& numIterations, double const& precision,
+                             std::optional<storm::OptimizationDirection> const& dir = {},
+                             std::function<SolverStatus(SolverStatus const&)> const& iterationCallback = {}) const;
+
+    /*!
+     * Tries to tighten the given lower bounds using an approximation computed by this helper.
+     * The candidate bounds (approximation minus a small margin, but not below the given bounds) are only taken if they are a sound lower bound of the
+     * unique solution, i.e., if no value decreases when applying the operator once.
+     * @return true if the bounds have been tightened.
+     */
+    bool tightenLowerBounds(std::vector<double>& bounds, std::vector<double> const& approximation, std::vector<double> const& offsets,
+                            std::optional<storm::OptimizationDirection> const& dir = {}) const;
+
+    /*!
+     * Tries to tighten the given upper bounds using an approximation computed by this helper.
+     * The candidate bounds (approximation plus a small margin, but not above the given bounds) are only taken if they are a sound upper bound of the
+     * unique solution, i.e., if no value increases when applying the operator once.
+     * @return true if the bounds have been tightened.
+     */
+    bool tightenUpperBounds(std::vector<double>& bounds, std::vector<double> const& approximation, std::vector<double> const& offsets,
+                            std::optional<storm::OptimizationDirection> const& dir = {}) const;
+
+   private:
+    template<bool Lower>
+    bool tightenBounds(std::vector<double>& bounds, std::vector<double> const& approximation, std::vector<double> const& offsets,
+                       std::optional<storm::OptimizationDirection> const& dir) const;
+
+    std::shared_ptr<ValueIterationOperator<float, TrivialRowGrouping>> singlePrecisionOperator;
+    std::shared_ptr<ValueIterationOperator<double, TrivialRowGrouping>> viOperator;
+};
+
+}  // namespace storm::solver::helper
@@ -1,5 +1,7 @@
 #include "storm/solver/helper/OptimisticValueIterationHelper.h"
 
+#include <atomic>
+#include <thread>
 #include <type_traits>
 
 #include "storm/adapters/RationalNumberAdapter.h"
@@ -187,12 +189,25 @@ OptimisticValueIterationHelper<ValueType, TrivialRowGrouping>::OptimisticValueIt
     // Intentionally left empty.
 }
 
+template<typename ValueType, bool TrivialRowGrouping>
+void OptimisticValueIterationHelper<ValueType, TrivialRowGrouping>::setPipelined(bool value) {
+    pipelined = value;
+}
+
+template<typename ValueType, bool TrivialRowGrouping>
+bool OptimisticValueIterationHelper<ValueType, TrivialRowGrouping>::isPipelined() const {
+    return pipelined;
+}
+
 template<typename ValueType, bool TrivialRowGrouping>
 template<OptimizationDirection Dir, bool Relative>
 SolverStatus OptimisticValueIterationHelper<ValueType, TrivialRowGrouping>::OVI(
     std::pair<std::vector<ValueType>, std::vector<ValueType>>& vu, std::vector<ValueType> const& offsets, uint64_t& numIterations, ValueType const& precision,
     ValueType const& guessValue, std::optional<ValueType> const& lowerBound, std::optional<ValueType> const& upperBound,
     std::function<SolverStatus(SolverStatus const&, std::vector<ValueType> const&)> const& iterationCallback) const {
+    if (pipelined) {
+        return pipelinedOVI<Dir, Relative>(vu, offsets, numIterations, precision, guessValue, lowerBound, upperBound, iterationCallback);
+    }
     ValueType currentGuessValue = guessValue;
     for (uint64_t numTries = 1; true; ++numTries) {
         if (SolverStatus status = GSVI<Dir, Relative>(vu.first, offsets, numIterations, currentGuessValue, iterationCallback);
@@ -232,6 +247,93 @@ SolverStatus OptimisticValueIterationHelper<ValueType, TrivialRowGrouping>::OVI(
     }
 }
 
+template<typename ValueType, bool TrivialRowGrouping>
+template<OptimizationDirection Dir, bool Relative>
+SolverStatus OptimisticValueIterationHelper<ValueType, TrivialRowGrouping>::pipelinedOVI(
+    std::pair<std::vector<ValueType>, std::vector<ValueType>>& vu, std::vector<ValueType> const& offsets, uint64_t& numIterations, ValueType const& precision,
+    ValueType const& guessValue, std::optional<ValueType> const& lowerBound, std::optional<ValueType> const& upperBound,
+    std::function<SolverStatus(SolverStatus const&, std::vector<ValueType> const&)> const& iterationCallback) const {
+    // The verifier thread works on its own copy of the candidate while this thread keeps improving the lower bound in vu.first.
+    // Both threads only read the matrix of the operator. The iteration callback is only invoked by this thread.
+    std::pair<std::vector<ValueType>, std::vector<ValueType>> candidate;
+    std::thread verifier;
+    std::atomic<bool> abortVerification{false};
+    std::atomic<bool> verified{false};
+    uint64_t verificationIterations{0};
+    std::optional<ValueType> verificationError;
+    auto joinVerifier = [&verifier, &numIterations, &verificationIterations]() {
+        if (verifier.joinable()) {
+            verifier.join();
+            numIterations += verificationIterations;
+        }
+    };
+
+    // Value iteration stops as soon as the current candidate is verified.
+    auto viCallback = [&verified, &iterationCallback](SolverStatus const& current, std::vector<ValueType> const& v) {
+        if (verified) {
+            return SolverStatus::Aborted;
+        }
+        return iterationCallback ? iterationCallback(current, v) : current;
+    };
+
+    auto const two = storm::utility::convertNumber<ValueType, uint64_t>(2u);
+    ValueType currentGuessValue = guessValue;
+    for (uint64_t numTries = 1; true; ++numTries) {
+        SolverStatus status = GSVI<Dir, Relative>(vu.first, offsets, numIterations, currentGuessValue, viCallback);
+        if (status != SolverStatus::Converged && !verified) {
+            abortVerification = true;
+        }
+        joinVerifier();
+        if (verified) {
+            vu = std::move(candidate);
+            return SolverStatus::Converged;
+        } else if (status != SolverStatus::Converged) {
+            return status;
+        }
+
+        // The error of a rejected candidate tells how much more precision is needed at least.
+        ValueType nextGuessValue = currentGuessValue / two;
+        if (verificationError) {
+            nextGuessValue = std::min<ValueType>(nextGuessValue, *verificationError / two);
+            verificationError.reset();
+        }
+
+        // Start verifying the new candidate and, in the meantime, continue with a more precise value iteration.
+        candidate = vu;
+        guessCandidate<Relative>(candidate, precision, lowerBound, upperBound);
+        uint64_t maxIters;
+        if (storm::utility::isZero(currentGuessValue)) {
+            maxIters = std::numeric_limits<uint64_t>::max();
+        } else {
+            maxIters =
+                storm::utility::convertNumber<uint64_t, ValueType>(storm::utility::ceil<ValueType>(storm::utility::one<ValueType>() / currentGuessValue));
+        }
+        verificationIterations = 0;
+        verifier = std::thread([this, &candidate, &offsets, &abortVerification, &verified, &verificationIterations, &verificationError, maxIters]() {
+            OVIBackend<ValueType, Dir, Relative> backend;
+            while (verificationIterations < maxIters && !abortVerification) {
+                ++verificationIterations;
+                if (viOperator->template applyInPlace(candidate, offsets, backend)) {
+                    if (backend.allDown()) {
+                        verified = true;
+                        return;
+                    }
+                    break;
+                }
+                if (backend.abort()) {
+                    break;
+                }
+            }
+            if (verificationIterations > 0) {
+                verificationError = backend.error();
+            }
+        });
+
+        STORM_LOG_WARN_COND(numTries != 20, "Optimistic Value Iteration did not terminate after 20 refinements. It might be stuck.");
+        currentGuessValue = nextGuessValue;
+    }
+}
+
 template<typename ValueType, bool TrivialRowGrouping>
 SolverStatus OptimisticValueIterationHelper<ValueType, TrivialRowGrouping>::OVI(
     std::pair<std::vector<ValueType>, std::vector<ValueType>>& vu, std::vector<ValueType> const& offsets, uint64_t& numIterations, bool relative,
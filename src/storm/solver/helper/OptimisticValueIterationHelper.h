@@ -21,6 +21,16 @@ class OptimisticValueIterationHelper {
    public:
     OptimisticValueIterationHelper(std::shared_ptr<ValueIterationOperator<ValueType, TrivialRowGrouping>> viOperator);
 
+    /*!
+     * Sets whether the verification phase of a guessed upper bound shall run on a separate thread while value iteration on the lower bound continues.
+     */
+    void setPipelined(bool value);
+
+    /*!
+     * @return true iff the verification phase runs concurrently to the value iteration phase.
+     */
+    bool isPipelined() const;
+
     template<OptimizationDirection Dir, bool Relative>
     SolverStatus OVI(std::pair<std::vector<ValueType>, std::vector<ValueType>>& vu, std::vector<ValueType> const& offsets, uint64_t& numIterations,
                      ValueType const& precision, ValueType const& guessValue, std::optional<ValueType> const& lowerBound = {},
@@ -47,7 +57,17 @@ class OptimisticValueIterationHelper {
     SolverStatus GSVI(std::vector<ValueType>& operand, std::vector<ValueType> const& offsets, uint64_t& numIterations, ValueType const& precision,
                       std::function<SolverStatus(SolverStatus const&, std::vector<ValueType> const&)> const& iterationCallback = {}) const;
 
+    /*!
+     * Variant of OVI in which the verification of the candidate obtained after k refinements overlaps with the value iteration of refinement k+1.
+     */
+    template<OptimizationDirection Dir, bool Relative>
+    SolverStatus pipelinedOVI(std::pair<std::vector<ValueType>, std::vector<ValueType>>& vu, std::vector<ValueType> const& offsets, uint64_t& numIterations,
+                              ValueType const& precision, ValueType const& guessValue, std::optional<ValueType> const& lowerBound,
+                              std::optional<ValueType> const& upperBound,
+                              std::function<SolverStatus(SolverStatus const&, std::vector<ValueType> const&)> const& iterationCallback) const;
+
     std::shared_ptr<ValueIterationOperator<ValueType, TrivialRowGrouping>> viOperator;
+    bool pipelined{false};
 };
 
 }  // namespace storm::solver::helper
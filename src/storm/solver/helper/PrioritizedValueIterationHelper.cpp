@@ -0,0 +1,434 @@
+#include "storm/solver/helper/PrioritizedValueIterationHelper.h"
+
+#include <cmath>
+
+#include "storm/adapters/IntelTbbAdapter.h"
+#include "storm/adapters/RationalNumberAdapter.h"
+#include "storm/utility/Extremum.h"
+#include "storm/utility/constants.h"
+#include "storm/utility/macros.h"
+#include "storm/utility/vector.h"
+
+namespace storm::solver::helper {
+
+// The number of states each shard updates per round in the parallel variant.
+static uint64_t const ParallelBatchSize = 1024;
+
+/*!
+ * A bucket queue over a contiguous range of states. States are only reinserted if their bucket changes and outdated entries are skipped when popping.
+ */
+class ResidualBucketQueue {
+   public:
+    static constexpr uint64_t NumberOfBuckets = 64;
+    static constexpr uint64_t NoBucket = NumberOfBuckets;
+
+    ResidualBucketQueue(uint64_t firstState, uint64_t endState)
+        : firstState(firstState), bucketOfState(endState - firstState, NoBucket), buckets(NumberOfBuckets) {
+        // Intentionally left empty.
+    }
+
+    void update(uint64_t state, uint64_t bucket) {
+        auto& currentBucket = bucketOfState[state - firstState];
+        if (currentBucket != bucket) {
+            currentBucket = bucket;
+            if (bucket != NoBucket) {
+                buckets[bucket].push_back(state);
+                topBucket = std::max(topBucket, bucket);
+            }
+        }
+    }
+
+    /*!
+     * Removes a state of the highest non-empty bucket.
+     * @return the state or false if the queue is empty
+     */
+    bool pop(uint64_t& state) {
+        while (true) {
+            while (buckets[topBucket].empty()) {
+                if (topBucket == 0) {
+                    return false;
+                }
+                --topBucket;
+            }
+            state = buckets[topBucket].back();
+            buckets[topBucket].pop_back();
+            if (bucketOfState[state - firstState] == topBucket) {
+                bucketOfState[state - firstState] = NoBucket;
+                return true;
+            }
+        }
+    }
+
+   private:
+    uint64_t firstState;
+    std::vector<uint64_t> bucketOfState;
+    std::vector<std::vector<uint64_t>> buckets;
+    uint64_t topBucket{0};
+};
+
+template<typename ValueType>
+uint64_t getResidualBucket(ValueType const& residual, ValueType const& threshold) {
+    if (residual <= threshold) {
+        return ResidualBucketQueue::NoBucket;
+    } else if (storm::utility::isZero(threshold)) {
+        return ResidualBucketQueue::NumberOfBuckets - 1;
+    }
+    int exponent = std::ilogb(storm::utility::convertNumber<double>(residual / threshold));
+    return std::min<uint64_t>(std::max(exponent, 0), ResidualBucketQueue::NumberOfBuckets - 1);
+}
+
+template<typename ValueType, storm::OptimizationDirection Dir, bool Relative>
+class PrioritizedVIUpdater {
+   public:
+    typedef ValueType UpdateType;
+
+    PrioritizedVIUpdater(storm::storage::SparseMatrix<ValueType> const& matrix, std::vector<ValueType>& x, std::vector<ValueType> const& offsets,
+                         ValueType const& precision)
+        : matrix(matrix), x(x), offsets(offsets), precision(precision) {
+        // Intentionally left empty.
+    }
+
+    UpdateType computeUpdate(uint64_t state) const {
+        storm::utility::Extremum<Dir, ValueType> best;
+        for (auto const row : matrix.getRowGroupIndices(state)) {
+            ValueType rowValue = offsets[row];
+            for (auto const& entry : matrix.getRow(row)) {
+                rowValue += entry.getValue() * x[entry.getColumn()];
+            }
+            best &= std::move(rowValue);
+        }
+        return *best;
+    }
+
+    ValueType storeUpdate(uint64_t state, UpdateType&& value) {
+        ValueType change = storm::utility::abs<ValueType>(value - x[state]);
+        x[state] = std::move(value);
+        return change;
+    }
+
+    ValueType threshold(uint64_t state) const {
+        if constexpr (Relative) {
+            return storm::utility::abs<ValueType>(precision * x[state]);
+        } else {
+            return precision;
+        }
+    }
+
+   private:
+    storm::storage::SparseMatrix<ValueType> const& matrix;
+    std::vector<ValueType>& x;
+    std::vector<ValueType> const& offsets;
+    ValueType const precision;
+};
+
+template<typename ValueType, storm::OptimizationDirection Dir>
+class PrioritizedIIUpdater {
+   public:
+    typedef std::pair<ValueType, ValueType> UpdateType;
+
+    PrioritizedIIUpdater(storm::storage::SparseMatrix<ValueType> const& matrix, std::pair<std::vector<ValueType>, std::vector<ValueType>>& xy,
+                         std::vector<ValueType> const& offsets, ValueType const& precision)
+        : matrix(matrix), xy(xy), offsets(offsets), precision(precision) {
+        // Intentionally left empty.
+    }
+
+    UpdateType computeUpdate(uint64_t state) const {
+        storm::utility::Extremum<Dir, ValueType> xBest, yBest;
+        for (auto const row : matrix.getRowGroupIndices(state)) {
+            ValueType xRowValue = offsets[row];
+            ValueType yRowValue = offsets[row];
+            for (auto const& entry : matrix.getRow(row)) {
+                xRowValue += entry.getValue() * xy.first[entry.getColumn()];
+                yRowValue += entry.getValue() * xy.second[entry.getColumn()];
+            }
+            xBest &= std::move(xRowValue);
+            yBest &= std::move(yRowValue);
+        }
+        return {*xBest, *yBest};
+    }
+
+    ValueType storeUpdate(uint64_t state, UpdateType&& values) {
+        // As for standard interval iteration, the bounds only ever get tighter.
+        ValueType change = storm::utility::zero<ValueType>();
+        if (values.first > xy.first[state]) {
+            change = values.first - xy.first[state];
+            xy.first[state] = std::move(values.first);
+        }
+        if (values.second < xy.second[state]) {
+            change = std::max<ValueType>(change, xy.second[state] - values.second);
+            xy.second[state] = std::move(values.second);
+        }
+        return change;
+    }
+
+    ValueType threshold(uint64_t) const {
+        return precision;
+    }
+
+   private:
+    storm::storage::SparseMatrix<ValueType> const& matrix;
+    std::pair<std::vector<ValueType>, std::vector<ValueType>>& xy;
+    std::vector<ValueType> const& offsets;
+    ValueType const precision;
+};
+
+template<typename ValueType>
+bool boundsAreClose(ValueType const& l, ValueType const& u, bool relative, ValueType const& precision) {
+    if (!relative) {
+        return u - l <= precision;
+    } else if (l > storm::utility::zero<ValueType>()) {
+        return u - l <= l * precision;
+    } else if (u < storm::utility::zero<ValueType>()) {
+        return l - u >= u * precision;
+    }
+    return l == u;
+}
+
+template<typename ValueType>
+PrioritizedValueIterationHelper<ValueType>::PrioritizedValueIterationHelper(storm::storage::SparseMatrix<ValueType> const& matrix)
+    : matrix(matrix), backwardTransitions(matrix.transpose(true)) {
+    // Intentionally left empty.
+}
+
+template<typename ValueType>
+void PrioritizedValueIterationHelper<ValueType>::setParallel(bool value) {
+    parallel = value;
+}
+
+template<typename ValueType>
+template<typename UpdaterType>
+SolverStatus PrioritizedValueIterationHelper<ValueType>::updateStates(UpdaterType& updater, storm::storage::BitVector const& initialStates,
+                                                                       uint64_t& numIterations, std::function<SolverStatus()> const& sweepCallback) const {
+#ifdef STORM_HAVE_INTELTBB
+    if (parallel) {
+        return updateStatesParallel(updater, initialStates, numIterations, sweepCallback);
+    }
+#endif
+    return updateStatesSequential(updater, initialStates, numIterations, sweepCallback);
+}
+
+template<typename ValueType>
+template<typename UpdaterType>
+SolverStatus PrioritizedValueIterationHelper<ValueType>::updateStatesSequential(UpdaterType& updater, storm::storage::BitVector const& initialStates,
+                                                                                 uint64_t& numIterations,
+                                                                                 std::function<SolverStatus()> const& sweepCallback) const {
+    uint64_t const numStates = matrix.getRowGroupCount();
+    std::vector<ValueType> residuals(numStates, storm::utility::zero<ValueType>());
+    ResidualBucketQueue queue(0, numStates);
+    for (auto const state : initialStates) {
+        queue.update(state, ResidualBucketQueue::NumberOfBuckets - 1);
+    }
+
+    uint64_t updatesInSweep = 0;
+    uint64_t state;
+    while (queue.pop(state)) {
+        ValueType change = updater.storeUpdate(state, updater.computeUpdate(state));
+        residuals[state] = storm::utility::zero<ValueType>();
+        if (!storm::utility::isZero(change)) {
+            for (auto const& entry : backwardTransitions.getRow(state)) {
+                auto const predecessor = entry.getColumn();
+                residuals[predecessor] += entry.getValue() * change;
+                queue.update(predecessor, getResidualBucket(residuals[predecessor], updater.threshold(predecessor)));
+            }
+        }
+        if (++updatesInSweep == numStates) {
+            updatesInSweep = 0;
+            ++numIterations;
+            if (auto status = sweepCallback(); status != SolverStatus::InProgress) {
+                return status;
+            }
+        }
+    }
+    return SolverStatus::InProgress;
+}
+
+template<typename ValueType>
+template<typename UpdaterType>
+SolverStatus PrioritizedValueIterationHelper<ValueType>::updateStatesParallel([[maybe_unused]] UpdaterType& updater,
+                                                                               [[maybe_unused]] storm::storage::BitVector const& initialStates,
+                                                                               [[maybe_unused]] uint64_t& numIterations,
+                                                                               [[maybe_unused]] std::function<SolverStatus()> const& sweepCallback) const {
+#ifdef STORM_HAVE_INTELTBB
+    uint64_t const numStates = matrix.getRowGroupCount();
+    // Retrieve the row group indices before going parallel as they might be created on the fly.
+    matrix.getRowGroupIndices();
+    uint64_t const numShards = std::max<uint64_t>(1, std::min<uint64_t>(tbb::this_task_arena::max_concurrency(), numStates));
+    uint64_t const shardSize = (numStates + numShards - 1) / numShards;
+    auto getShard = [&shardSize](uint64_t state) { return state / shardSize; };
+
+    std::vector<ValueType> residuals(numStates, storm::utility::zero<ValueType>());
+    std::vector<ResidualBucketQueue> queues;
+    queues.reserve(numShards);
+    for (uint64_t shard = 0; shard < numShards; ++shard) {
+        queues.emplace_back(shard * shardSize, std::min((shard + 1) * shardSize, numStates));
+    }
+    for (auto const state : initialStates) {
+        queues[getShard(state)].update(state, ResidualBucketQueue::NumberOfBuckets - 1);
+    }
+
+    std::vector<std::vector<uint64_t>> batchStates(numShards);
+    std::vector<std::vector<typename UpdaterType::UpdateType>> batchUpdates(numShards);
+    // residualIncreases[i][j] holds the residual increases of states of shard j caused by updates in shard i.
+    typedef std::vector<std::pair<uint64_t, ValueType>> ResidualIncreases;
+    std::vector<std::vector<ResidualIncreases>> residualIncreases(numShards, std::vector<ResidualIncreases>(numShards));
+    uint64_t updatesInSweep = 0;
+    while (true) {
+        // Compute the new values of the most urgent states of each shard. This only reads the current values.
+        tbb::parallel_for(tbb::blocked_range<uint64_t>(0, numShards, 1), [&](tbb::blocked_range<uint64_t> const& range) {
+            for (auto shard = range.begin(); shard < range.end(); ++shard) {
+                batchStates[shard].clear();
+                batchUpdates[shard].clear();
+                uint64_t state;
+                while (batchStates[shard].size() < ParallelBatchSize && queues[shard].pop(state)) {
+                    batchStates[shard].push_back(state);
+                    batchUpdates[shard].push_back(updater.computeUpdate(state));
+                }
+            }
+        });
+        uint64_t numUpdates = 0;
+        for (auto const& states : batchStates) {
+            numUpdates += states.size();
+        }
+        if (numUpdates == 0) {
+            return SolverStatus::InProgress;
+        }
+
+        // Store the new values. Each shard only writes the values of its own states.
+        tbb::parallel_for(tbb::blocked_range<uint64_t>(0, numShards, 1), [&](tbb::blocked_range<uint64_t> const& range) {
+            for (auto shard = range.begin(); shard < range.end(); ++shard) {
+                for (uint64_t i = 0; i < batchStates[shard].size(); ++i) {
+                    auto const state = batchStates[shard][i];
+                    ValueType change = updater.storeUpdate(state, std::move(batchUpdates[shard][i]));
+                    residuals[state] = storm::utility::zero<ValueType>();
+                    if (!storm::utility::isZero(change)) {
+                        for (auto const& entry : backwardTransitions.getRow(state)) {
+                            residualIncreases[shard][getShard(entry.getColumn())].emplace_back(entry.getColumn(), entry.getValue() * change);
+                        }
+                    }
+                }
+            }
+        });
+
+        // Exchange the residual increases between the shards.
+        tbb::parallel_for(tbb::blocked_range<uint64_t>(0, numShards, 1), [&](tbb::blocked_range<uint64_t> const& range) {
+            for (auto shard = range.begin(); shard < range.end(); ++shard) {
+                for (auto& increases : residualIncreases) {
+                    for (auto const& [predecessor, increase] : increases[shard]) {
+                        residuals[predecessor] += increase;
+                        queues[shard].update(predecessor, getResidualBucket(residuals[predecessor], updater.threshold(predecessor)));
+                    }
+                    increases[shard].clear();
+                }
+            }
+        });
+
+        updatesInSweep += numUpdates;
+        if (updatesInSweep >= numStates) {
+            updatesInSweep -= numStates;
+            ++numIterations;
+            if (auto status = sweepCallback(); status != SolverStatus::InProgress) {
+                return status;
+            }
+        }
+    }
+#else
+    STORM_LOG_ASSERT(false, "Parallel prioritized value iteration requires Intel TBB.");
+    return SolverStatus::InProgress;
+#endif
+}
+
+template<typename ValueType>
+template<storm::OptimizationDirection Dir, bool Relative>
+SolverStatus PrioritizedValueIterationHelper<ValueType>::VI(std::vector<ValueType>& operand, std::vector<ValueType> const& offsets, uint64_t& numIterations,
+                                                            ValueType const& precision,
+                                                            std::function<SolverStatus(SolverStatus const&)> const& iterationCallback) const {
+    PrioritizedVIUpdater<ValueType, Dir, Relative> updater(matrix, operand, offsets, precision);
+    auto sweepCallback = [&iterationCallback]() { return iterationCallback ? iterationCallback(SolverStatus::InProgress) : SolverStatus::InProgress; };
+    auto status = updateStates(updater, storm::storage::BitVector(matrix.getRowGroupCount(), true), numIterations, sweepCallback);
+    return status == SolverStatus::InProgress ? SolverStatus::Converged : status;
+}
+
+template<typename ValueType>
+SolverStatus PrioritizedValueIterationHelper<ValueType>::VI(std::vector<ValueType>& operand, std::vector<ValueType> const& offsets, uint64_t& numIterations,
+                                                            bool relative, ValueType const& precision, std::optional<storm::OptimizationDirection> const& dir,
+                                                            std::function<SolverStatus(SolverStatus const&)> const& iterationCallback) const {
+    if (!dir.has_value() || maximize(*dir)) {
+        if (relative) {
+            return VI<storm::OptimizationDirection::Maximize, true>(operand, offsets, numIterations, precision, iterationCallback);
+        } else {
+            return VI<storm::OptimizationDirection::Maximize, false>(operand, offsets, numIterations, precision, iterationCallback);
+        }
+    } else {
+        if (relative) {
+            return VI<storm::OptimizationDirection::Minimize, true>(operand, offsets, numIterations, precision, iterationCallback);
+        } else {
+            return VI<storm::OptimizationDirection::Minimize, false>(operand, offsets, numIterations, precision, iterationCallback);
+        }
+    }
+}
+
+template<typename ValueType>
+template<storm::OptimizationDirection Dir>
+SolverStatus PrioritizedValueIterationHelper<ValueType>::II(std::pair<std::vector<ValueType>, std::vector<ValueType>>& xy,
+                                                            std::vector<ValueType> const& offsets, uint64_t& numIterations, bool relative,
+                                                            ValueType const& precision,
+                                                            std::function<SolverStatus(IIData<ValueType> const&)> const& iterationCallback,
+                                                            std::optional<storm::storage::BitVector> const& relevantValues) const {
+    PrioritizedIIUpdater<ValueType, Dir> updater(matrix, xy, offsets, precision);
+    SolverStatus status{SolverStatus::InProgress};
+    auto sweepCallback = [&]() { return iterationCallback ? iterationCallback(IIData<ValueType>({xy.first, xy.second, status})) : SolverStatus::InProgress; };
+    storm::storage::BitVector scheduledStates(matrix.getRowGroupCount(), true);
+    while (true) {
+        status = updateStates(updater, scheduledStates, numIterations, sweepCallback);
+        if (status != SolverStatus::InProgress) {
+            return status;
+        }
+        // The residuals only approximate the actual changes, so convergence is decided based on the bounds.
+        bool converged = true;
+        for (uint64_t state = 0; state < xy.first.size(); ++state) {
+            bool close = boundsAreClose(xy.first[state], xy.second[state], relative, precision);
+            scheduledStates.set(state, !close);
+            converged &= close || (relevantValues && !relevantValues->get(state));
+        }
+        if (converged) {
+            return SolverStatus::Converged;
+        }
+        // Account for the sweep that checked the bounds such that the callback can stop the iteration if no more progress is made.
+        ++numIterations;
+        if (status = sweepCallback(); status != SolverStatus::InProgress) {
+            return status;
+        }
+    }
+}
+
+template<typename ValueType>
+SolverStatus PrioritizedValueIterationHelper<ValueType>::II(std::vector<ValueType>& operand, std::vector<ValueType> const& offsets, uint64_t& numIterations,
+                                                            bool relative, ValueType const& precision,
+                                                            std::function<void(std::vector<ValueType>&)> const& prepareLowerBounds,
+                                                            std::function<void(std::vector<ValueType>&)> const& prepareUpperBounds,
+                                                            std::optional<storm::OptimizationDirection> const& dir,
+                                                            std::function<SolverStatus(IIData<ValueType> const&)> const& iterationCallback,
+                                                            std::optional<storm::storage::BitVector> const& relevantValues) const {
+    std::pair<std::vector<ValueType>, std::vector<ValueType>> xy;
+    xy.first.swap(operand);
+    xy.second.resize(xy.first.size());
+    prepareLowerBounds(xy.first);
+    prepareUpperBounds(xy.second);
+    SolverStatus status;
+    if (!dir.has_value() || maximize(*dir)) {
+        status = II<OptimizationDirection::Maximize>(xy, offsets, numIterations, relative, precision, iterationCallback, relevantValues);
+    } else {
+        status = II<OptimizationDirection::Minimize>(xy, offsets, numIterations, relative, precision, iterationCallback, relevantValues);
+    }
+    auto two = storm::utility::convertNumber<ValueType>(2.0);
+    // get the average of lower- and upper result
+    storm::utility::vector::applyPointwise<ValueType, ValueType, ValueType>(
+        xy.first, xy.second, xy.first, [&two](ValueType const& a, ValueType const& b) -> ValueType { return (a + b) / two; });
+    xy.first.swap(operand);
+    return status;
+}
+
+template class PrioritizedValueIterationHelper<double>;
+template class PrioritizedValueIterationHelper<storm::RationalNumber>;
+
+}  // namespace storm::solver::helper
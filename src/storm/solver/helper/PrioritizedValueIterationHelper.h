@@ -0,0 +1,95 @@
+#pragma once
+
+#include <functional>
+#include <optional>
+#include <vector>
+
+#include "storm/solver/OptimizationDirection.h"
+#include "storm/solver/SolverStatus.h"
+#include "storm/solver/helper/IntervalterationHelper.h"
+#include "storm/storage/BitVector.h"
+#include "storm/storage/SparseMatrix.h"
+
+namespace storm::solver::helper {
+
+/*!
+ * Implements asynchronous value iteration with prioritized updates (prioritized sweeping).
+ * Instead of sweeping over all states in every iteration, states are updated one at a time in the order of their residual, i.e., an over-approximation of
+ * how much their value changes when applying the Bellman operator. After a state has been updated, the residual of each of its predecessors is increased by
+ * the change of the value, weighted with the transition probability. States whose residual does not exceed the precision are not updated at all, so parts
+ * of the system that converged early no longer cost anything.
+ *
+ * The states are kept in a bucket queue, where the bucket of a state is the binary logarithm of its residual relative to the precision.
+ * In the parallel variant, the states are split into contiguous shards, each with its own queue. In each round, every shard updates a batch of its most
+ * urgent states and the resulting residual increases are then exchanged between the shards.
+ */
+template<typename ValueType>
+class PrioritizedValueIterationHelper {
+   public:
+    /*!
+     * @param matrix the matrix of the equation system. Needs to stay alive as long as this helper is used.
+     */
+    PrioritizedValueIterationHelper(storm::storage::SparseMatrix<ValueType> const& matrix);
+
+    /*!
+     * Sets whether the states shall be updated in parallel shards (if Storm is built with Intel TBB).
+     */
+    void setParallel(bool value);
+
+    /*!
+     * Performs prioritized value iteration until no state has a residual above the given precision.
+     * On convergence, the criterion of standard value iteration holds, i.e., applying the operator once does not change any value by more than the precision.
+     * @param numIterations is increased once every time as many updates as there are states have been performed, i.e., it counts sweep equivalents.
+     * The iteration callback is invoked after each sweep equivalent.
+     */
+    SolverStatus VI(std::vector<ValueType>& operand, std::vector<ValueType> const& offsets, uint64_t& numIterations, bool relative, ValueType const& precision,
+                    std::optional<storm::OptimizationDirection> const& dir = {},
+                    std::function<SolverStatus(SolverStatus const&)> const& iterationCallback = {}) const;
+
+    /*!
+     * Performs interval iteration where lower and upper bounds are updated in prioritized order. Updating sound bounds in any order keeps them sound.
+     * Convergence is only reported once the actual difference between the bounds is small enough. If there are no more pending updates before that,
+     * all states whose bounds are too far apart are scheduled again.
+     * The parameters are as for IntervalIterationHelper::II, where numIterations counts sweep equivalents.
+     */
+    SolverStatus II(std::vector<ValueType>& operand, std::vector<ValueType> const& offsets, uint64_t& numIterations, bool relative, ValueType const& precision,
+                    std::function<void(std::vector<ValueType>&)> const& prepareLowerBounds,
+                    std::function<void(std::vector<ValueType>&)> const& prepareUpperBounds, std::optional<storm::OptimizationDirection> const& dir = {},
+                    std::function<SolverStatus(IIData<ValueType> const&)> const& iterationCallback = {},
+                    std::optional<storm::storage::BitVector> const& relevantValues = {}) const;
+
+   private:
+    template<storm::OptimizationDirection Dir, bool Relative>
+    SolverStatus VI(std::vector<ValueType>& operand, std::vector<ValueType> const& offsets, uint64_t& numIterations, ValueType const& precision,
+                    std::function<SolverStatus(SolverStatus const&)> const& iterationCallback) const;
+
+    template<storm::OptimizationDirection Dir>
+    SolverStatus II(std::pair<std::vector<ValueType>, std::vector<ValueType>>& xy, std::vector<ValueType> const& offsets, uint64_t& numIterations,
+                    bool relative, ValueType const& precision, std::function<SolverStatus(IIData<ValueType> const&)> const& iterationCallback,
+                    std::optional<storm::storage::BitVector> const& relevantValues) const;
+
+    /*!
+     * Updates the given initial states and all states whose residual exceeds the threshold afterwards until there are no such states left.
+     * @param updater computes and stores the new values of a state
+     * @param sweepCallback is invoked after each sweep equivalent
+     * @return InProgress if there are no more pending updates and the status returned by the callback if it is not InProgress
+     */
+    template<typename UpdaterType>
+    SolverStatus updateStates(UpdaterType& updater, storm::storage::BitVector const& initialStates, uint64_t& numIterations,
+                              std::function<SolverStatus()> const& sweepCallback) const;
+
+    template<typename UpdaterType>
+    SolverStatus updateStatesSequential(UpdaterType& updater, storm::storage::BitVector const& initialStates, uint64_t& numIterations,
+                                        std::function<SolverStatus()> const& sweepCallback) const;
+
+    template<typename UpdaterType>
+    SolverStatus updateStatesParallel(UpdaterType& updater, storm::storage::BitVector const& initialStates, uint64_t& numIterations,
+                                      std::function<SolverStatus()> const& sweepCallback) const;
+
+    storm::storage::SparseMatrix<ValueType> const& matrix;
+    // For each state, the states that have a choice leading to it. Values of multiple such choices are summed up.
+    storm::storage::SparseMatrix<ValueType> backwardTransitions;
+    bool parallel{false};
+};
+
+}  // namespace storm::solver::helper
@@ -1,5 +1,6 @@
 #include "storm/solver/helper/RationalSearchHelper.h"
 
+#include "storm/adapters/IntelTbbAdapter.h"
 #include "storm/adapters/RationalNumberAdapter.h"
 #include "storm/solver/helper/ValueIterationHelper.h"
 #include "storm/solver/helper/ValueIterationOperator.h"
@@ -16,9 +17,17 @@ RationalSearchHelper<TargetValueType, ExactValueType, ImpreciseValueType, Trivia
     // Intentionally left empty
 }
 
+/*!
+ * Checks whether the sharpened vector is a fixpoint of the exact operator. The operand that is written to is never modified, so this can be used
+ * in-place as well as with applyParallel.
+ */
 template<typename ValueType, typename ExactValueType, storm::OptimizationDirection Dir>
 class RSBackend {
    public:
+    RSBackend(std::vector<ExactValueType> const& sharpOperand) : sharpOperand(sharpOperand) {
+        // Intentionally left empty
+    }
+
     void startNewIteration() {
         allEqual = true;
     }
@@ -31,8 +40,8 @@ class RSBackend {
         best &= value;
     }
 
-    void applyUpdate(ExactValueType& currValue, [[maybe_unused]] uint64_t rowGroup) {
-        if (currValue != *best) {
+    void applyUpdate([[maybe_unused]] ExactValueType& currValue, uint64_t rowGroup) {
+        if (sharpOperand[rowGroup] != *best) {
             allEqual = false;
         }
     }
@@ -41,6 +50,10 @@ class RSBackend {
         // intentionally left empty.
     }
 
+    void mergeChunk(RSBackend const& chunkBackend) {
+        allEqual &= chunkBackend.allEqual;
+    }
+
     bool converged() const {
         return allEqual;
     }
@@ -50,6 +63,7 @@ class RSBackend {
     }
 
    private:
+    std::vector<ExactValueType> const& sharpOperand;
     storm::utility::Extremum<Dir, ExactValueType> best;
     bool allEqual{true};
 };
@@ -60,8 +74,14 @@ RSResult RationalSearchHelper<TargetValueType, ExactValueType, ImpreciseValueTyp
                                                                                                                 std::vector<ValueType> const& operand,
                                                                                                                 std::vector<ExactValueType> const& exactOffsets,
                                                                                                                 std::vector<TargetValueType>& target) const {
-    RSBackend<ValueType, ExactValueType, Dir> backend;
     auto& sharpOperand = exactOperator->allocateAuxiliaryVector(operand.size());
+    RSBackend<ValueType, ExactValueType, Dir> backend(sharpOperand);
+    // Parallel applications of the operator can not be done in-place. As the backend does not write to the output operand, its content is irrelevant.
+    bool const parallel = exactOperator->isParallelApplySet();
+    std::vector<ExactValueType> validationOperand;
+    if (parallel) {
+        validationOperand.resize(operand.size());
+    }
 
     for (uint64_t p = 0; p <= precision; ++p) {
         // If we need an exact computation but are currently using imprecise values, we might need to consider switching to precise values
@@ -70,9 +90,23 @@ RSResult RationalSearchHelper<TargetValueType, ExactValueType, ImpreciseValueTyp
             exactOperator->freeAuxiliaryVector();
             return RSResult::PrecisionExceeded;
         }
+#ifdef STORM_HAVE_INTELTBB
+        if (parallel) {
+            tbb::parallel_for(tbb::blocked_range<uint64_t>(0, operand.size(), 100), [&](tbb::blocked_range<uint64_t> const& range) {
+                for (uint64_t index = range.begin(); index != range.end(); ++index) {
+                    sharpOperand[index] = storm::utility::kwek_mehlhorn::sharpen<ExactValueType, ValueType>(p, operand[index]);
+                }
+            });
+        } else {
+            storm::utility::kwek_mehlhorn::sharpen(p, operand, sharpOperand);
+        }
+#else
         storm::utility::kwek_mehlhorn::sharpen(p, operand, sharpOperand);
+#endif
 
-        if (exactOperator->applyInPlace(sharpOperand, exactOffsets, backend)) {
+        bool const isFixpoint = parallel ? exactOperator->applyParallel(sharpOperand, validationOperand, exactOffsets, backend)
+                                         : exactOperator->applyInPlace(sharpOperand, exactOffsets, backend);
+        if (isFixpoint) {
             // Put the solution into the target vector
             if constexpr (std::is_same_v<ExactValueType, TargetValueType>) {
                 target.swap(sharpOperand);
@@ -1,12 +1,19 @@
 #include "storm/solver/helper/ValueIterationHelper.h"
 
+#include <chrono>
+
 #include "storm/adapters/RationalNumberAdapter.h"
+#include "storm/solver/SolverTelemetry.h"
 #include "storm/solver/helper/ValueIterationOperator.h"
 #include "storm/utility/Extremum.h"
+#include "storm/utility/Instrumentation.h"
+#include "storm/utility/constants.h"
+
+#include "storm/exceptions/NotSupportedException.h"
 
 namespace storm::solver::helper {
 
-template<typename ValueType, storm::OptimizationDirection Dir, bool Relative>
+template<typename ValueType, storm::OptimizationDirection Dir, bool Relative, bool TrackResidual = false>
 class VIOperatorBackend {
    public:
     VIOperatorBackend(ValueType const& precision) : precision{precision} {
@@ -15,6 +22,9 @@ class VIOperatorBackend {
 
     void startNewIteration() {
         isConverged = true;
+        if constexpr (TrackResidual) {
+            residual = storm::utility::zero<ValueType>();
+        }
     }
 
     void firstRow(ValueType&& value, [[maybe_unused]] uint64_t rowGroup, [[maybe_unused]] uint64_t row) {
@@ -26,6 +36,17 @@ class VIOperatorBackend {
     }
 
     void applyUpdate(ValueType& currValue, [[maybe_unused]] uint64_t rowGroup) {
+        if constexpr (TrackResidual) {
+            ValueType difference = storm::utility::abs<ValueType>(currValue - *best);
+            if constexpr (Relative) {
+                if (!storm::utility::isZero(currValue)) {
+                    difference /= storm::utility::abs<ValueType>(currValue);
+                }
+            }
+            if (residual < difference) {
+                residual = std::move(difference);
+            }
+        }
         if (isConverged) {
             if constexpr (Relative) {
                 isConverged = storm::utility::abs<ValueType>(currValue - *best) <= storm::utility::abs<ValueType>(precision * currValue);
@@ -40,10 +61,27 @@ class VIOperatorBackend {
         // intentionally left empty.
     }
 
+    void mergeChunk(VIOperatorBackend const& chunkBackend) {
+        isConverged &= chunkBackend.isConverged;
+        if constexpr (TrackResidual) {
+            if (residual < chunkBackend.residual) {
+                residual = chunkBackend.residual;
+            }
+        }
+    }
+
     bool converged() const {
         return isConverged;
     }
 
+    /*!
+     * The largest (relative) difference between the old and the new values in the last iteration. Only available if TrackResidual is set.
+     */
+    ValueType const& getResidual() const {
+        static_assert(TrackResidual, "The residual is only tracked if TrackResidual is set.");
+        return residual;
+    }
+
     bool constexpr abort() const {
         return false;
     }
@@ -52,6 +90,61 @@ class VIOperatorBackend {
     storm::utility::Extremum<Dir, ValueType> best;
     ValueType const precision;
     bool isConverged{true};
+    ValueType residual{};
+};
+
+template<typename ValueType, storm::OptimizationDirection Dir, bool Relative>
+class BatchVIOperatorBackend {
+   public:
+    BatchVIOperatorBackend(ValueType const& precision, uint64_t batchSize) : precision{precision}, best(batchSize) {
+        // intentionally empty
+    }
+
+    void startNewIteration() {
+        isConverged = true;
+    }
+
+    void firstRow(ValueType const* values, [[maybe_unused]] uint64_t rowGroup, [[maybe_unused]] uint64_t row) {
+        std::copy(values, values + best.size(), best.begin());
+    }
+
+    void nextRow(ValueType const* values, [[maybe_unused]] uint64_t rowGroup, [[maybe_unused]] uint64_t row) {
+        for (uint64_t j = 0; j < best.size(); ++j) {
+            if (storm::solver::minimize(Dir) ? values[j] < best[j] : values[j] > best[j]) {
+                best[j] = values[j];
+            }
+        }
+    }
+
+    void applyUpdate(ValueType* currValues, [[maybe_unused]] uint64_t rowGroup) {
+        for (uint64_t j = 0; j < best.size(); ++j) {
+            if (isConverged) {
+                if constexpr (Relative) {
+                    isConverged = storm::utility::abs<ValueType>(currValues[j] - best[j]) <= storm::utility::abs<ValueType>(precision * currValues[j]);
+                } else {
+                    isConverged = storm::utility::abs<ValueType>(currValues[j] - best[j]) <= precision;
+                }
+            }
+            currValues[j] = std::move(best[j]);
+        }
+    }
+
+    void endOfIteration() const {
+        // intentionally left empty.
+    }
+
+    bool converged() const {
+        return isConverged;
+    }
+
+    bool constexpr abort() const {
+        return false;
+    }
+
+   private:
+    ValueType const precision;
+    std::vector<ValueType> best;
+    bool isConverged{true};
 };
 
 template<typename ValueType, bool TrivialRowGrouping, typename SolutionType>
@@ -61,23 +154,37 @@ ValueIterationHelper<ValueType, TrivialRowGrouping, SolutionType>::ValueIteratio
     // Intentionally left empty
 }
 
+template<typename ValueType, bool TrivialRowGrouping, typename SolutionType>
+void ValueIterationHelper<ValueType, TrivialRowGrouping, SolutionType>::setTelemetry(std::shared_ptr<storm::solver::SolverTelemetry> const& telemetry) {
+    this->telemetry = telemetry;
+}
+
 template<typename ValueType, bool TrivialRowGrouping, typename SolutionType>
 template<storm::OptimizationDirection Dir, bool Relative, storm::OptimizationDirection RobustDir>
 SolverStatus ValueIterationHelper<ValueType, TrivialRowGrouping, SolutionType>::VI(std::vector<SolutionType>& operand, std::vector<ValueType> const& offsets,
                                                                                    uint64_t& numIterations, SolutionType const& precision,
                                                                                    std::function<SolverStatus(SolverStatus const&)> const& iterationCallback,
                                                                                    MultiplicationStyle mult) const {
-    VIOperatorBackend<SolutionType, Dir, Relative> backend{precision};
+    storm::utility::instrumentation::ScopedRegion region("value iteration");
+    uint64_t const initialNumIterations = numIterations;
     std::vector<SolutionType>* operand1{&operand};
     std::vector<SolutionType>* operand2{&operand};
+    // Parallel applications of the operator can not be done in-place
+    bool const parallel = viOperator->isParallelApplySet();
+    if (parallel) {
+        mult = MultiplicationStyle::Regular;
+    }
     if (mult == MultiplicationStyle::Regular) {
         operand2 = &viOperator->allocateAuxiliaryVector(operand.size());
     }
+    storm::utility::instrumentation::recordMemory("value iteration: operator", viOperator->getSizeInMemory());
+    storm::utility::instrumentation::recordMemory("value iteration: operand", sizeof(SolutionType) * operand.capacity());
     bool resultInAuxVector{false};
     SolverStatus status{SolverStatus::InProgress};
-    while (status == SolverStatus::InProgress) {
+    auto performIteration = [&](auto& backend) {
         ++numIterations;
-        bool applyResult = viOperator->template applyRobust<RobustDir>(*operand1, *operand2, offsets, backend);
+        bool applyResult = parallel ? viOperator->template applyParallelRobust<RobustDir>(*operand1, *operand2, offsets, backend)
+                                    : viOperator->template applyRobust<RobustDir>(*operand1, *operand2, offsets, backend);
         if (applyResult) {
             status = SolverStatus::Converged;
         } else if (iterationCallback) {
@@ -87,6 +194,21 @@ SolverStatus ValueIterationHelper<ValueType, TrivialRowGrouping, SolutionType>::
             std::swap(operand1, operand2);
             resultInAuxVector = !resultInAuxVector;
         }
+    };
+    if (telemetry) {
+        VIOperatorBackend<SolutionType, Dir, Relative, true> backend{precision};
+        while (status == SolverStatus::InProgress) {
+            auto iterationStart = std::chrono::steady_clock::now();
+            performIteration(backend);
+            std::chrono::duration<double> iterationTime = std::chrono::steady_clock::now() - iterationStart;
+            telemetry->iterationCompleted("value iteration", numIterations, storm::utility::convertNumber<double>(backend.getResidual()),
+                                          iterationTime.count());
+        }
+    } else {
+        VIOperatorBackend<SolutionType, Dir, Relative> backend{precision};
+        while (status == SolverStatus::InProgress) {
+            performIteration(backend);
+        }
     }
     if (mult == MultiplicationStyle::Regular) {
         if (resultInAuxVector) {
@@ -95,6 +217,9 @@ SolverStatus ValueIterationHelper<ValueType, TrivialRowGrouping, SolutionType>::
         }
         viOperator->freeAuxiliaryVector();
     }
+    storm::utility::instrumentation::addToCounter("value iteration: iterations", numIterations - initialNumIterations);
+    storm::utility::instrumentation::addToCounter("value iteration: matrix entries touched",
+                                                  (numIterations - initialNumIterations) * viOperator->getNumberOfEntries());
     return status;
 }
 
@@ -143,6 +268,72 @@ SolverStatus ValueIterationHelper<ValueType, TrivialRowGrouping, SolutionType>::
     return VI(operand, offsets, numIterations, relative, precision, dir, iterationCallback, mult, robust);
 }
 
+template<typename ValueType, bool TrivialRowGrouping, typename SolutionType>
+template<storm::OptimizationDirection Dir, bool Relative>
+SolverStatus ValueIterationHelper<ValueType, TrivialRowGrouping, SolutionType>::VIBatch(std::vector<SolutionType>& operand,
+                                                                                        std::vector<ValueType> const& offsets, uint64_t batchSize,
+                                                                                        uint64_t& numIterations, SolutionType const& precision,
+                                                                                        std::function<SolverStatus(SolverStatus const&)> const& callback,
+                                                                                        MultiplicationStyle mult) const {
+    BatchVIOperatorBackend<SolutionType, Dir, Relative> backend{precision, batchSize};
+    std::vector<SolutionType>* operand1{&operand};
+    std::vector<SolutionType>* operand2{&operand};
+    if (mult == MultiplicationStyle::Regular) {
+        operand2 = &viOperator->allocateAuxiliaryVector(operand.size());
+    }
+    bool resultInAuxVector{false};
+    SolverStatus status{SolverStatus::InProgress};
+    while (status == SolverStatus::InProgress) {
+        ++numIterations;
+        if (viOperator->applyBatch(*operand1, *operand2, offsets, batchSize, backend)) {
+            status = SolverStatus::Converged;
+        } else if (callback) {
+            status = callback(status);
+        }
+        if (mult == MultiplicationStyle::Regular) {
+            std::swap(operand1, operand2);
+            resultInAuxVector = !resultInAuxVector;
+        }
+    }
+    if (mult == MultiplicationStyle::Regular) {
+        if (resultInAuxVector) {
+            STORM_LOG_ASSERT(&operand == operand2, "Unexpected operand address");
+            std::swap(*operand1, *operand2);
+        }
+        viOperator->freeAuxiliaryVector();
+    }
+    return status;
+}
+
+template<typename ValueType, bool TrivialRowGrouping, typename SolutionType>
+SolverStatus ValueIterationHelper<ValueType, TrivialRowGrouping, SolutionType>::VIBatch(std::vector<SolutionType>& operand,
+                                                                                        std::vector<ValueType> const& offsets, uint64_t batchSize,
+                                                                                        uint64_t& numIterations, bool relative, SolutionType const& precision,
+                                                                                        std::optional<storm::OptimizationDirection> const& dir,
+                                                                                        std::function<SolverStatus(SolverStatus const&)> const& callback,
+                                                                                        MultiplicationStyle mult) const {
+    STORM_LOG_ASSERT(TrivialRowGrouping || dir.has_value(), "no optimization direction given!");
+    if constexpr (std::is_same_v<ValueType, storm::Interval>) {
+        STORM_LOG_THROW(false, storm::exceptions::NotSupportedException, "Batched value iteration is not supported for interval models.");
+    } else {
+        if (!dir.has_value() || maximize(*dir)) {
+            if (relative) {
+                return VIBatch<storm::OptimizationDirection::Maximize, true>(operand, offsets, batchSize, numIterations, precision, callback, mult);
+            } else {
+                return VIBatch<storm::OptimizationDirection::Maximize, false>(operand, offsets, batchSize, numIterations, precision, callback, mult);
+            }
+        } else {
+            if (relative) {
+                return VIBatch<storm::OptimizationDirection::Minimize, true>(operand, offsets, batchSize, numIterations, precision, callback, mult);
+            } else {
+                return VIBatch<storm::OptimizationDirection::Minimize, false>(operand, offsets, batchSize, numIterations, precision, callback, mult);
+            }
+        }
+    }
+}
+
+template class ValueIterationHelper<float, true>;
+template class ValueIterationHelper<float, false>;
 template class ValueIterationHelper<double, true>;
 template class ValueIterationHelper<double, false>;
 template class ValueIterationHelper<storm::RationalNumber, true>;
@@ -10,6 +10,10 @@
 #include "storm/solver/SolverStatus.h"
 #include "storm/solver/helper/ValueIterationOperatorForward.h"
 
+namespace storm::solver {
+class SolverTelemetry;
+}
+
 namespace storm::solver::helper {
 
 template<typename ValueType, bool TrivialRowGrouping, typename SolutionType = ValueType>
@@ -17,6 +21,12 @@ class ValueIterationHelper {
    public:
     explicit ValueIterationHelper(std::shared_ptr<ValueIterationOperator<ValueType, TrivialRowGrouping, SolutionType>> viOperator);
 
+    /*!
+     * Sets a telemetry that is informed about the residual and the duration of each iteration of (non-batched) value iteration.
+     * Determining the residual requires an additional comparison per row group, so nothing is recorded if no telemetry is set.
+     */
+    void setTelemetry(std::shared_ptr<storm::solver::SolverTelemetry> const& telemetry);
+
     template<storm::OptimizationDirection Dir, bool Relative, storm::OptimizationDirection RobustDir>
     SolverStatus VI(std::vector<SolutionType>& operand, std::vector<ValueType> const& offsets, uint64_t& numIterations, SolutionType const& precision,
                     std::function<SolverStatus(SolverStatus const&)> const& iterationCallback = {},
@@ -36,8 +46,25 @@ class ValueIterationHelper {
                     std::optional<storm::OptimizationDirection> const& dir = {}, std::function<SolverStatus(SolverStatus const&)> const& iterationCallback = {},
                     MultiplicationStyle mult = MultiplicationStyle::GaussSeidel, bool robust = true) const;
 
+    /*!
+     * Performs value iteration for a batch of equation systems that share the matrix but have different offsets.
+     * The operands and offsets are given in the interleaved layout described in ValueIterationOperator::applyBatch.
+     * The iteration stops once all operands have converged.
+     * @note Interval models are not supported
+     */
+    template<storm::OptimizationDirection Dir, bool Relative>
+    SolverStatus VIBatch(std::vector<SolutionType>& operand, std::vector<ValueType> const& offsets, uint64_t batchSize, uint64_t& numIterations,
+                         SolutionType const& precision, std::function<SolverStatus(SolverStatus const&)> const& iterationCallback = {},
+                         MultiplicationStyle mult = MultiplicationStyle::GaussSeidel) const;
+
+    SolverStatus VIBatch(std::vector<SolutionType>& operand, std::vector<ValueType> const& offsets, uint64_t batchSize, uint64_t& numIterations,
+                         bool relative, SolutionType const& precision, std::optional<storm::OptimizationDirection> const& dir = {},
+                         std::function<SolverStatus(SolverStatus const&)> const& iterationCallback = {},
+                         MultiplicationStyle mult = MultiplicationStyle::GaussSeidel) const;
+
    private:
     std::shared_ptr<ValueIterationOperator<ValueType, TrivialRowGrouping, SolutionType>> viOperator;
+    std::shared_ptr<storm::solver::SolverTelemetry> telemetry;
 };
 
 }  // namespace storm::solver::helper
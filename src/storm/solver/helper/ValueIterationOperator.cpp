@@ -3,14 +3,56 @@
 #include <optional>
 
 #include "storm/adapters/RationalNumberAdapter.h"
+#include "storm/storage/CompactSparseMatrix.h"
 #include "storm/storage/SparseMatrix.h"
+#include "storm/storage/SparseMatrixView.h"
 
 namespace storm::solver::helper {
 
+namespace detail {
+template<typename MatrixValueType, typename FunctionType>
+void forEachEntry(storm::storage::SparseMatrix<MatrixValueType> const& matrix, uint64_t row, FunctionType&& function) {
+    for (auto const& entry : matrix.getRow(row)) {
+        function(entry.getColumn(), entry.getValue());
+    }
+}
+
+template<typename MatrixValueType, typename FunctionType>
+void forEachEntry(storm::storage::CompactSparseMatrix<MatrixValueType> const& matrix, uint64_t row, FunctionType&& function) {
+    matrix.forEachEntry(row, std::forward<FunctionType>(function));
+}
+
+template<typename MatrixValueType, typename FunctionType>
+void forEachEntry(storm::storage::SparseMatrixView<MatrixValueType> const& matrix, uint64_t row, FunctionType&& function) {
+    matrix.forEachEntry(row, std::forward<FunctionType>(function));
+}
+}  // namespace detail
+
+template<typename ValueType, bool TrivialRowGrouping, typename SolutionType>
+template<bool Backward, typename MatrixValueType>
+void ValueIterationOperator<ValueType, TrivialRowGrouping, SolutionType>::setMatrix(storm::storage::SparseMatrix<MatrixValueType> const& matrix,
+                                                                                    std::vector<IndexType> const* rowGroupIndices) {
+    setMatrixImpl<Backward>(matrix, rowGroupIndices);
+}
+
 template<typename ValueType, bool TrivialRowGrouping, typename SolutionType>
 template<bool Backward>
-void ValueIterationOperator<ValueType, TrivialRowGrouping, SolutionType>::setMatrix(storm::storage::SparseMatrix<ValueType> const& matrix,
+void ValueIterationOperator<ValueType, TrivialRowGrouping, SolutionType>::setMatrix(storm::storage::CompactSparseMatrix<ValueType> const& matrix,
                                                                                     std::vector<IndexType> const* rowGroupIndices) {
+    setMatrixImpl<Backward>(matrix, rowGroupIndices);
+}
+
+template<typename ValueType, bool TrivialRowGrouping, typename SolutionType>
+template<bool Backward>
+void ValueIterationOperator<ValueType, TrivialRowGrouping, SolutionType>::setMatrix(storm::storage::SparseMatrixView<ValueType> const& matrix,
+                                                                                    std::vector<IndexType> const* rowGroupIndices) {
+    setMatrixImpl<Backward>(matrix, rowGroupIndices);
+}
+
+template<typename ValueType, bool TrivialRowGrouping, typename SolutionType>
+template<bool Backward, typename MatrixType>
+void ValueIterationOperator<ValueType, TrivialRowGrouping, SolutionType>::setMatrixImpl(MatrixType const& matrix,
+                                                                                        std::vector<IndexType> const* rowGroupIndices) {
     if constexpr (TrivialRowGrouping) {
         STORM_LOG_ASSERT(matrix.hasTrivialRowGrouping(), "Expected a matrix with trivial row grouping");
         STORM_LOG_ASSERT(rowGroupIndices == nullptr, "Row groups given, but grouping is supposed to be trivial.");
@@ -24,35 +66,63 @@ void ValueIterationOperator<ValueType, TrivialRowGrouping, SolutionType>::setMat
     }
     this->backwards = Backward;
     this->hasSkippedRows = false;
+    if constexpr (std::is_same_v<ValueType, double>) {
+        this->useSimdRowSum = kernels::isSimdRowSumSupported();
+    }
+    updateKernelIndex();
     auto const numRows = matrix.getRowCount();
     matrixValues.clear();
     matrixColumns.clear();
-    matrixValues.reserve(matrix.getNonzeroEntryCount());
-    matrixColumns.reserve(matrix.getNonzeroEntryCount() + numRows + 1);  // matrixColumns also contain indications for when a row(group) starts
+    chunkStarts.clear();
+    matrixValues.reserve(matrix.getEntryCount());
+    matrixColumns.reserve(matrix.getEntryCount() + numRows + 1);  // matrixColumns also contain indications for when a row(group) starts
     if constexpr (!TrivialRowGrouping) {
         matrixColumns.push_back(StartOfRowGroupIndicator);  // indicate start of first row(group)
+        uint64_t iterationIndex = 0;
         for (auto groupIndex : indexRange<Backward>(0, this->rowGroupIndices->size() - 1)) {
+            if (iterationIndex % GroupsPerChunk == 0) {
+                chunkStarts.push_back({iterationIndex, matrixColumns.size() - 1, matrixValues.size()});  // The last column entry indicates the group start
+            }
+            ++iterationIndex;
             STORM_LOG_ASSERT(this->rowGroupIndices->at(groupIndex) != this->rowGroupIndices->at(groupIndex + 1),
                              "There is an empty row group. This is not expected.");
             for (auto rowIndex : indexRange<false>((*this->rowGroupIndices)[groupIndex], (*this->rowGroupIndices)[groupIndex + 1])) {
-                for (auto const& entry : matrix.getRow(rowIndex)) {
-                    matrixValues.push_back(entry.getValue());
-                    matrixColumns.push_back(entry.getColumn());
-                }
+                detail::forEachEntry(matrix, rowIndex, [this](auto const column, auto const& value) {
+                    matrixValues.push_back(static_cast<ValueType>(value));
+                    matrixColumns.push_back(column);
+                });
                 matrixColumns.push_back(StartOfRowIndicator);  // Indicate start of next row
             }
             matrixColumns.back() = StartOfRowGroupIndicator;  // This is the start of the next row group
         }
     } else {
         matrixColumns.push_back(StartOfRowIndicator);  // Indicate start of first row
+        uint64_t iterationIndex = 0;
         for (auto rowIndex : indexRange<Backward>(0, numRows)) {
-            for (auto const& entry : matrix.getRow(rowIndex)) {
-                matrixValues.push_back(entry.getValue());
-                matrixColumns.push_back(entry.getColumn());
+            if (iterationIndex % GroupsPerChunk == 0) {
+                chunkStarts.push_back({iterationIndex, matrixColumns.size() - 1, matrixValues.size()});  // The last column entry indicates the row start
             }
+            ++iterationIndex;
+            detail::forEachEntry(matrix, rowIndex, [this](auto const column, auto const& value) {
+                matrixValues.push_back(static_cast<ValueType>(value));
+                matrixColumns.push_back(column);
+            });
             matrixColumns.push_back(StartOfRowIndicator);  // Indicate start of next row
         }
     }
+    if constexpr (std::is_same_v<ValueType, storm::Interval>) {
+        // Initially, the entries of each row are ordered as in the matrix.
+        applyCache.robustOrder.resize(matrixValues.size());
+        uint64_t valueIndex = 0;
+        uint32_t localIndex = 0;
+        for (auto const column : matrixColumns) {
+            if (column >= StartOfRowIndicator) {
+                localIndex = 0;
+            } else {
+                applyCache.robustOrder[valueIndex++] = localIndex++;
+            }
+        }
+    }
 }
 
 template<typename ValueType, bool TrivialRowGrouping, typename SolutionType>
@@ -75,47 +145,27 @@ void ValueIterationOperator<ValueType, TrivialRowGrouping, SolutionType>::unsetI
         }
     }
     hasSkippedRows = false;
+    updateKernelIndex();
 }
 
 template<typename ValueType, bool TrivialRowGrouping, typename SolutionType>
-template<bool Backward>
-void ValueIterationOperator<ValueType, TrivialRowGrouping, SolutionType>::setIgnoredRows(bool useLocalRowIndices,
-                                                                                         std::function<bool(IndexType, IndexType)> const& ignore) {
-    STORM_LOG_ASSERT(!TrivialRowGrouping, "Tried to ignroe rows but the row grouping is trivial.");
-    auto colIt = matrixColumns.begin();
-    for (auto groupIndex : indexRange<Backward>(0, this->rowGroupIndices->size() - 1)) {
-        STORM_LOG_ASSERT(colIt != matrixColumns.end(), "VI Operator in invalid state.");
-        STORM_LOG_ASSERT(*colIt >= StartOfRowGroupIndicator, "VI Operator in invalid state.");
-        auto const rowIndexRange = useLocalRowIndices ? indexRange<false>(0ull, (*this->rowGroupIndices)[groupIndex + 1] - (*this->rowGroupIndices)[groupIndex])
-                                                      : indexRange<false>((*this->rowGroupIndices)[groupIndex], (*this->rowGroupIndices)[groupIndex + 1]);
-        for (auto const rowIndex : rowIndexRange) {
-            if (!ignore(groupIndex, rowIndex)) {
-                *colIt &= StartOfRowGroupIndicator;  // Clear number of skipped entries
-                moveToEndOfRow(colIt);
-            } else if ((*colIt & SkipNumEntriesMask) == 0) {  // i.e. should ignore but is not already ignored
-                auto currColIt = colIt;
-                moveToEndOfRow(colIt);
-                *currColIt += std::distance(currColIt, colIt);  // set number of skipped entries
-            }
-            STORM_LOG_ASSERT(
-                !std::all_of(rowIndexRange.begin(), rowIndexRange.end(), [&ignore, &groupIndex](IndexType rowIndex) { return ignore(groupIndex, rowIndex); }),
-                "All rows in row group " << groupIndex << " are ignored.");
-            STORM_LOG_ASSERT(colIt != matrixColumns.end(), "VI Operator in invalid state.");
-            STORM_LOG_ASSERT(*colIt >= StartOfRowIndicator, "VI Operator in invalid state.");
-        }
-        STORM_LOG_ASSERT(*colIt == StartOfRowGroupIndicator, "VI Operator in invalid state.");
-    }
-    hasSkippedRows = true;
+void ValueIterationOperator<ValueType, TrivialRowGrouping, SolutionType>::updateKernelIndex() {
+    kernelIndex = (backwards ? BackwardKernelFlag : 0) | (hasSkippedRows ? SkipIgnoredRowsKernelFlag : 0) | (useSimdRowSum ? SimdKernelFlag : 0);
 }
 
 template<typename ValueType, bool TrivialRowGrouping, typename SolutionType>
-void ValueIterationOperator<ValueType, TrivialRowGrouping, SolutionType>::setIgnoredRows(bool useLocalRowIndices,
-                                                                                         std::function<bool(IndexType, IndexType)> const& ignore) {
-    if (backwards) {
-        setIgnoredRows<true>(useLocalRowIndices, ignore);
-    } else {
-        setIgnoredRows<false>(useLocalRowIndices, ignore);
-    }
+void ValueIterationOperator<ValueType, TrivialRowGrouping, SolutionType>::setParallelApply(bool value) {
+#ifdef STORM_HAVE_INTELTBB
+    parallelApply = value;
+#else
+    STORM_LOG_WARN_COND(!value, "Storm was built without support for Intel TBB, defaulting to sequential version.");
+    parallelApply = false;
+#endif
+}
+
+template<typename ValueType, bool TrivialRowGrouping, typename SolutionType>
+bool ValueIterationOperator<ValueType, TrivialRowGrouping, SolutionType>::isParallelApplySet() const {
+    return parallelApply;
 }
 
 template<typename ValueType, bool TrivialRowGrouping, typename SolutionType>
@@ -125,6 +175,21 @@ ValueIterationOperator<ValueType, TrivialRowGrouping, SolutionType>::getRowGroup
     return *rowGroupIndices;
 }
 
+template<typename ValueType, bool TrivialRowGrouping, typename SolutionType>
+uint64_t ValueIterationOperator<ValueType, TrivialRowGrouping, SolutionType>::getNumberOfEntries() const {
+    return matrixValues.size();
+}
+
+template<typename ValueType, bool TrivialRowGrouping, typename SolutionType>
+uint64_t ValueIterationOperator<ValueType, TrivialRowGrouping, SolutionType>::getSizeInMemory() const {
+    uint64_t result = sizeof(*this) + sizeof(ValueType) * matrixValues.capacity() + sizeof(IndexType) * matrixColumns.capacity() +
+                      sizeof(ChunkStart) * chunkStarts.capacity() + sizeof(SolutionType) * auxiliaryVector.capacity();
+    if constexpr (std::is_same_v<ValueType, storm::Interval>) {
+        result += sizeof(uint32_t) * applyCache.robustOrder.capacity();
+    }
+    return result;
+}
+
 template<typename ValueType, bool TrivialRowGrouping, typename SolutionType>
 std::vector<SolutionType>& ValueIterationOperator<ValueType, TrivialRowGrouping, SolutionType>::allocateAuxiliaryVector(
     uint64_t size, std::optional<SolutionType> const& initialValue) {
@@ -174,11 +239,31 @@ uint64_t ValueIterationOperator<ValueType, TrivialRowGrouping, SolutionType>::sk
     return result;
 }
 
+template class ValueIterationOperator<float, true>;
+template class ValueIterationOperator<float, false>;
+template void ValueIterationOperator<float, true>::setMatrix<false, double>(storm::storage::SparseMatrix<double> const&, std::vector<IndexType> const*);
+template void ValueIterationOperator<float, true>::setMatrix<true, double>(storm::storage::SparseMatrix<double> const&, std::vector<IndexType> const*);
+template void ValueIterationOperator<float, false>::setMatrix<false, double>(storm::storage::SparseMatrix<double> const&, std::vector<IndexType> const*);
+template void ValueIterationOperator<float, false>::setMatrix<true, double>(storm::storage::SparseMatrix<double> const&, std::vector<IndexType> const*);
 template class ValueIterationOperator<double, true>;
 template class ValueIterationOperator<double, false>;
+template void ValueIterationOperator<double, true>::setMatrix<false>(storm::storage::CompactSparseMatrix<double> const&, std::vector<IndexType> const*);
+template void ValueIterationOperator<double, true>::setMatrix<true>(storm::storage::CompactSparseMatrix<double> const&, std::vector<IndexType> const*);
+template void ValueIterationOperator<double, false>::setMatrix<false>(storm::storage::CompactSparseMatrix<double> const&, std::vector<IndexType> const*);
+template void ValueIterationOperator<double, false>::setMatrix<true>(storm::storage::CompactSparseMatrix<double> const&, std::vector<IndexType> const*);
+template void ValueIterationOperator<double, false>::setMatrix<false>(storm::storage::SparseMatrixView<double> const&, std::vector<IndexType> const*);
+template void ValueIterationOperator<double, false>::setMatrix<true>(storm::storage::SparseMatrixView<double> const&, std::vector<IndexType> const*);
 template class ValueIterationOperator<storm::RationalNumber, true>;
 template class ValueIterationOperator<storm::RationalNumber, false>;
+template void ValueIterationOperator<storm::RationalNumber, false>::setMatrix<false>(storm::storage::SparseMatrixView<storm::RationalNumber> const&,
+                                                                                     std::vector<IndexType> const*);
+template void ValueIterationOperator<storm::RationalNumber, false>::setMatrix<true>(storm::storage::SparseMatrixView<storm::RationalNumber> const&,
+                                                                                    std::vector<IndexType> const*);
 template class ValueIterationOperator<storm::Interval, true, double>;
 template class ValueIterationOperator<storm::Interval, false, double>;
+template void ValueIterationOperator<storm::Interval, false, double>::setMatrix<false>(storm::storage::SparseMatrixView<storm::Interval> const&,
+                                                                                       std::vector<IndexType> const*);
+template void ValueIterationOperator<storm::Interval, false, double>::setMatrix<true>(storm::storage::SparseMatrixView<storm::Interval> const&,
+                                                                                      std::vector<IndexType> const*);
 
 }  // namespace storm::solver::helper
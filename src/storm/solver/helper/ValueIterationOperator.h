@@ -1,5 +1,7 @@
 #pragma once
-#include <functional>
+#include <algorithm>
+#include <array>
+#include <atomic>
 #include <optional>
 #include <utility>
 #include <vector>
@@ -7,7 +9,9 @@
 #include <boost/range/adaptor/reversed.hpp>
 #include <boost/range/irange.hpp>
 
+#include "storm/adapters/IntelTbbAdapter.h"
 #include "storm/solver/helper/ValueIterationOperatorForward.h"
+#include "storm/solver/helper/ValueIterationOperatorKernels.h"
 #include "storm/storage/sparse/StateType.h"
 #include "storm/utility/macros.h"
 #include "storm/utility/vector.h"  // TODO
@@ -18,6 +22,10 @@ class Environment;
 namespace storage {
 template<typename T>
 class SparseMatrix;
+template<typename T>
+class CompactSparseMatrix;
+template<typename T>
+class SparseMatrixView;
 }
 
 namespace solver::helper {
@@ -38,12 +46,36 @@ class ValueIterationOperator {
     /*!
      * Initializes this operator with the given data
      * @tparam backwards if true, we iterate backwards starting with the largest rowgroup. This often makes in place (Gauss-Seidel) iterations more efficient
+     * @tparam MatrixValueType the value type of the given matrix. If this differs from ValueType, the matrix entries are converted (e.g. to obtain a single
+     * precision operator for a double precision matrix)
+     * @param matrix the transition matrix
+     * @param rowGroupIndices if given, overwrites the rowGroupIndices of the matrix. Must be nullptr if TrivialRowGrouping is true
+     * @note The reference to the row group indices (either of the matrix or the given pointer) must not be invalidated as long as this operator is used.
+     */
+    template<bool Backward = true, typename MatrixValueType = ValueType>
+    void setMatrix(storm::storage::SparseMatrix<MatrixValueType> const& matrix, std::vector<IndexType> const* rowGroupIndices = nullptr);
+
+    /*!
+     * Initializes this operator with the given compact matrix. The operator is built by iterating over the compact representation, so the original
+     * SparseMatrix does not need to be kept in memory.
+     * @tparam backwards if true, we iterate backwards starting with the largest rowgroup
      * @param matrix the transition matrix
      * @param rowGroupIndices if given, overwrites the rowGroupIndices of the matrix. Must be nullptr if TrivialRowGrouping is true
      * @note The reference to the row group indices (either of the matrix or the given pointer) must not be invalidated as long as this operator is used.
      */
     template<bool Backward = true>
-    void setMatrix(storm::storage::SparseMatrix<ValueType> const& matrix, std::vector<IndexType> const* rowGroupIndices = nullptr);
+    void setMatrix(storm::storage::CompactSparseMatrix<ValueType> const& matrix, std::vector<IndexType> const* rowGroupIndices = nullptr);
+
+    /*!
+     * Initializes this operator with the given view on a submatrix. Entries outside of the view are skipped while the operator is built, so the
+     * submatrix does not need to be copied.
+     * @tparam backwards if true, we iterate backwards starting with the largest rowgroup
+     * @param matrix the view on the transition matrix
+     * @param rowGroupIndices if given, overwrites the rowGroupIndices of the view. Must be nullptr if TrivialRowGrouping is true
+     * @note The reference to the row group indices (either of the view or the given pointer) must not be invalidated as long as this operator is used.
+     */
+    template<bool Backward = true>
+    void setMatrix(storm::storage::SparseMatrixView<ValueType> const& matrix, std::vector<IndexType> const* rowGroupIndices = nullptr);
 
     /*!
      * Initializes this operator with the given data for forward iterations (starting with the smallest row group
@@ -98,21 +130,43 @@ class ValueIterationOperator {
 
     template<OptimizationDirection RobustDir, typename OperandType, typename OffsetType, typename BackendType>
     bool applyRobust(OperandType const& operandIn, OperandType& operandOut, OffsetType const& offsets, BackendType& backend) const {
-        if (hasSkippedRows) {
-            if (backwards) {
-                return apply<OperandType, OffsetType, BackendType, true, true, RobustDir>(operandOut, operandIn, offsets, backend);
-            } else {
-                return apply<OperandType, OffsetType, BackendType, false, true, RobustDir>(operandOut, operandIn, offsets, backend);
-            }
-        } else {
-            if (backwards) {
-                return apply<OperandType, OffsetType, BackendType, true, false, RobustDir>(operandOut, operandIn, offsets, backend);
-            } else {
-                return apply<OperandType, OffsetType, BackendType, false, false, RobustDir>(operandOut, operandIn, offsets, backend);
-            }
-        }
+        return applyKernel<OperandType, OffsetType, BackendType, RobustDir, false>(operandOut, operandIn, offsets, backend);
     }
 
+    /*!
+     * Same as `apply` but the row groups are split into chunks that are processed concurrently (if Storm is built with Intel TBB).
+     * Each chunk is processed using its own copy of the given backend, taken right after backend.startNewIteration() has been invoked.
+     * Instead of backend.abort() and backend.converged(), the following methods are invoked:
+     * * chunkBackend.abort(); invoked after a group is processed. If this returns true, the remaining groups of the corresponding chunk are not processed
+     * * backend.mergeChunk(chunkBackend); invoked for each chunk (in the order of the chunks) once all chunks are processed
+     * * backend.endOfIteration(); invoked after merging if no chunk was aborted
+     * * backend.converged(); invoked at the very end. Determines the return value of this method
+     *
+     * @note operandIn and operandOut must not be the same object, i.e., in-place (Gauss-Seidel) updates are not supported.
+     * @note If Storm is built without Intel TBB, this behaves like `apply`.
+     */
+    template<typename OperandType, typename OffsetType, typename BackendType>
+    bool applyParallel(OperandType const& operandIn, OperandType& operandOut, OffsetType const& offsets, BackendType& backend) const {
+        return applyParallelRobust<OptimizationDirection::Maximize>(operandIn, operandOut, offsets, backend);
+    }
+
+    template<OptimizationDirection RobustDir, typename OperandType, typename OffsetType, typename BackendType>
+    bool applyParallelRobust(OperandType const& operandIn, OperandType& operandOut, OffsetType const& offsets, BackendType& backend) const {
+        STORM_LOG_ASSERT(&operandIn != &operandOut, "Parallel application of the VI operator can not be done in-place.");
+        return applyKernel<OperandType, OffsetType, BackendType, RobustDir, true>(operandOut, operandIn, offsets, backend);
+    }
+
+    /*!
+     * Sets whether helpers using this operator shall prefer `applyParallel` over `apply` whenever they support it.
+     * @note This has no effect if Storm is built without Intel TBB.
+     */
+    void setParallelApply(bool value);
+
+    /*!
+     * @return true iff helpers using this operator shall prefer `applyParallel` over `apply` whenever they support it.
+     */
+    bool isParallelApplySet() const;
+
     /*!
      * Same as `apply` but with operandOut==operandIn
      */
@@ -126,14 +180,51 @@ class ValueIterationOperator {
         return applyRobust<RobustDir>(operand, operand, offsets, backend);
     }
 
+    /*!
+     * Applies the operator to a batch of operands that share the matrix but have different offsets. The matrix is only traversed once for all operands.
+     * The operands and offsets are stored in an interleaved layout: the value of the j'th operand for row group i is stored at operandIn[i * batchSize + j]
+     * and the offset of the j'th operand for row r at offsets[r * batchSize + j].
+     * The backend is informed as follows:
+     * * backend.startNewIteration(); at the beginning of each call
+     * * backend.firstRow(rowValues, rowGroupIndex, rowIndex); for the first (non-ignored) row of each row group. rowValues points to the batchSize
+     *                                                         results for the current row
+     * * backend.nextRow(rowValues, rowGroupIndex, rowIndex); for the remaining (non-ignored) rows of each row group
+     * * backend.applyUpdate(groupValuesOut, rowGroupIndex); once all rows of a group are processed. groupValuesOut points to the batchSize output values
+     * * backend.endOfIteration(); at the end of each call
+     * * backend.converged(); (potentially multiple times) to determine the return value
+     * * backend.abort(); (potentially multiple times) to determine whether the application can be aborted
+     * @note operandIn and operandOut may be the same object (in-place application)
+     * @note Interval models are not supported
+     * @return backend.converged()
+     */
+    template<typename BackendType>
+    bool applyBatch(std::vector<SolutionType> const& operandIn, std::vector<SolutionType>& operandOut, std::vector<ValueType> const& offsets,
+                    uint64_t batchSize, BackendType& backend) const {
+        if (backwards) {
+            return hasSkippedRows ? applyBatch<BackendType, true, true>(operandOut, operandIn, offsets, batchSize, backend)
+                                  : applyBatch<BackendType, true, false>(operandOut, operandIn, offsets, batchSize, backend);
+        } else {
+            return hasSkippedRows ? applyBatch<BackendType, false, true>(operandOut, operandIn, offsets, batchSize, backend)
+                                  : applyBatch<BackendType, false, false>(operandOut, operandIn, offsets, batchSize, backend);
+        }
+    }
+
     /*!
      * Sets rows that will be skipped when applying the operator.
      * @note each row group shall have at least one row that is not ignored
      * @param useLocalRowIndices if true, the row indices are considered to be local to the group, i.e. row i is the i'th row in the given group
      *                           if false, row indices are global, i.e. row i refers to the i'th row of the entire matrix
      * @param ignore function object that takes a row group index and a row index and returns true, iff the corresponding row shall be skipped
+     * @note This is implemented in the header so that the function object is inlined instead of being invoked through a std::function for each row
      */
-    void setIgnoredRows(bool useLocalRowIndices, std::function<bool(IndexType, IndexType)> const& ignore);
+    template<typename IgnoreFunction>
+    void setIgnoredRows(bool useLocalRowIndices, IgnoreFunction const& ignore) {
+        if (backwards) {
+            setIgnoredRows<true>(useLocalRowIndices, ignore);
+        } else {
+            setIgnoredRows<false>(useLocalRowIndices, ignore);
+        }
+    }
 
     /*!
      * Clears all ignored rows
@@ -145,6 +236,16 @@ class ValueIterationOperator {
      */
     std::vector<IndexType> const& getRowGroupIndices() const;
 
+    /*!
+     * @return The number of (nonzero) matrix entries this operator processes in each application
+     */
+    uint64_t getNumberOfEntries() const;
+
+    /*!
+     * @return the number of bytes occupied by this operator (approximately), including the auxiliary vector
+     */
+    uint64_t getSizeInMemory() const;
+
     /*!
      * Allocates additional storage that can be used e.g. when applying the operand
      * @param size the size of the auxiliary vector
@@ -163,7 +264,8 @@ class ValueIterationOperator {
      * Internal variant of `apply`
      * @note This and other apply methods are intentionally implemented in the header file as there are potentially many different BackendTypes
      */
-    template<typename OperandType, typename OffsetType, typename BackendType, bool Backward, bool SkipIgnoredRows, OptimizationDirection RobustDirection>
+    template<typename OperandType, typename OffsetType, typename BackendType, bool Backward, bool SkipIgnoredRows, OptimizationDirection RobustDirection,
+             bool UseSimd>
     bool apply(OperandType& operandOut, OperandType const& operandIn, OffsetType const& offsets, BackendType& backend) const {
         STORM_LOG_ASSERT(getSize(operandIn) == getSize(operandOut), "Input and Output Operands have different sizes.");
         auto const operandSize = getSize(operandIn);
@@ -171,22 +273,140 @@ class ValueIterationOperator {
         backend.startNewIteration();
         auto matrixValueIt = matrixValues.cbegin();
         auto matrixColumnIt = matrixColumns.cbegin();
-        for (auto groupIndex : indexRange<Backward>(0, operandSize)) {
+        if (!applyGroups<OperandType, OffsetType, BackendType, Backward, SkipIgnoredRows, RobustDirection, UseSimd>(
+                0, operandSize, matrixColumnIt, matrixValueIt, operandOut, operandIn, offsets, backend)) {
+            return backend.converged();
+        }
+        STORM_LOG_ASSERT(matrixColumnIt + 1 == matrixColumns.cend(), "Unexpected position of matrix column iterator.");
+        STORM_LOG_ASSERT(matrixValueIt == matrixValues.cend(), "Unexpected position of matrix column iterator.");
+        backend.endOfIteration();
+        return backend.converged();
+    }
+
+    /*!
+     * Internal variant of `applyBatch`
+     */
+    template<typename BackendType, bool Backward, bool SkipIgnoredRows>
+    bool applyBatch(std::vector<SolutionType>& operandOut, std::vector<SolutionType> const& operandIn, std::vector<ValueType> const& offsets,
+                    uint64_t const batchSize, BackendType& backend) const {
+        static_assert(!std::is_same_v<ValueType, storm::Interval>, "Batched application is not supported for interval models.");
+        STORM_LOG_ASSERT(operandIn.size() == operandOut.size(), "Input and Output Operands have different sizes.");
+        STORM_LOG_ASSERT(batchSize > 0 && operandIn.size() % batchSize == 0, "Operand size is not a multiple of the batch size.");
+        IndexType const numGroups = operandIn.size() / batchSize;
+        STORM_LOG_ASSERT(TrivialRowGrouping || rowGroupIndices->size() == numGroups + 1, "Dimension mismatch");
+        backend.startNewIteration();
+        std::vector<SolutionType> rowValues(batchSize);
+        auto matrixValueIt = matrixValues.cbegin();
+        auto matrixColumnIt = matrixColumns.cbegin();
+        // Computes the results of the current row for all operands and advances the iterators to the end of the row
+        auto applyRow = [&](uint64_t rowIndex) {
+            auto offsetIt = offsets.cbegin() + rowIndex * batchSize;
+            for (uint64_t j = 0; j < batchSize; ++j, ++offsetIt) {
+                rowValues[j] = *offsetIt;
+            }
+            for (++matrixColumnIt; *matrixColumnIt < StartOfRowIndicator; ++matrixColumnIt, ++matrixValueIt) {
+                SolutionType const* operandValues = operandIn.data() + *matrixColumnIt * batchSize;
+                SolutionType const matrixValue = *matrixValueIt;
+                for (uint64_t j = 0; j < batchSize; ++j) {
+                    rowValues[j] += operandValues[j] * matrixValue;
+                }
+            }
+            return rowValues.data();
+        };
+        for (auto groupIndex : indexRange<Backward>(0, numGroups)) {
+            STORM_LOG_ASSERT(*matrixColumnIt >= StartOfRowIndicator, "VI Operator in invalid state.");
+            if constexpr (TrivialRowGrouping) {
+                backend.firstRow(applyRow(groupIndex), groupIndex, groupIndex);
+            } else {
+                IndexType rowIndex = (*rowGroupIndices)[groupIndex];
+                if constexpr (SkipIgnoredRows) {
+                    rowIndex += skipMultipleIgnoredRows(matrixColumnIt, matrixValueIt);
+                }
+                backend.firstRow(applyRow(rowIndex), groupIndex, rowIndex);
+                while (*matrixColumnIt < StartOfRowGroupIndicator) {
+                    ++rowIndex;
+                    if (!SkipIgnoredRows || !skipIgnoredRow(matrixColumnIt, matrixValueIt)) {
+                        backend.nextRow(applyRow(rowIndex), groupIndex, rowIndex);
+                    }
+                }
+            }
+            backend.applyUpdate(operandOut.data() + groupIndex * batchSize, groupIndex);
+            if (backend.abort()) {
+                return backend.converged();
+            }
+        }
+        STORM_LOG_ASSERT(matrixColumnIt + 1 == matrixColumns.cend(), "Unexpected position of matrix column iterator.");
+        STORM_LOG_ASSERT(matrixValueIt == matrixValues.cend(), "Unexpected position of matrix column iterator.");
+        backend.endOfIteration();
+        return backend.converged();
+    }
+
+    /*!
+     * Internal variant of `applyParallel`
+     */
+    template<typename OperandType, typename OffsetType, typename BackendType, bool Backward, bool SkipIgnoredRows, OptimizationDirection RobustDirection,
+             bool UseSimd>
+    bool applyParallel(OperandType& operandOut, OperandType const& operandIn, OffsetType const& offsets, BackendType& backend) const {
+#ifdef STORM_HAVE_INTELTBB
+        STORM_LOG_ASSERT(getSize(operandIn) == getSize(operandOut), "Input and Output Operands have different sizes.");
+        auto const operandSize = getSize(operandIn);
+        STORM_LOG_ASSERT(TrivialRowGrouping || rowGroupIndices->size() == operandSize + 1, "Dimension mismatch");
+        backend.startNewIteration();
+        std::vector<BackendType> chunkBackends(chunkStarts.size(), backend);
+        std::atomic<bool> aborted{false};
+        tbb::parallel_for(tbb::blocked_range<uint64_t>(0, chunkStarts.size()), [&](tbb::blocked_range<uint64_t> const& range) {
+            for (auto chunkIndex = range.begin(); chunkIndex != range.end(); ++chunkIndex) {
+                auto const& chunk = chunkStarts[chunkIndex];
+                IndexType const iterationEnd = chunkIndex + 1 < chunkStarts.size() ? chunkStarts[chunkIndex + 1].iterationIndex : operandSize;
+                auto matrixColumnIt = matrixColumns.cbegin() + chunk.columnOffset;
+                auto matrixValueIt = matrixValues.cbegin() + chunk.valueOffset;
+                // In backward mode, the i'th processed row group is the (operandSize - 1 - i)'th one.
+                IndexType const groupsBegin = Backward ? operandSize - iterationEnd : chunk.iterationIndex;
+                IndexType const groupsEnd = Backward ? operandSize - chunk.iterationIndex : iterationEnd;
+                if (!applyGroups<OperandType, OffsetType, BackendType, Backward, SkipIgnoredRows, RobustDirection, UseSimd>(
+                        groupsBegin, groupsEnd, matrixColumnIt, matrixValueIt, operandOut, operandIn, offsets, chunkBackends[chunkIndex])) {
+                    aborted = true;
+                }
+            }
+        });
+        for (auto const& chunkBackend : chunkBackends) {
+            backend.mergeChunk(chunkBackend);
+        }
+        if (!aborted) {
+            backend.endOfIteration();
+        }
+        return backend.converged();
+#else
+        return apply<OperandType, OffsetType, BackendType, Backward, SkipIgnoredRows, RobustDirection, UseSimd>(operandOut, operandIn, offsets, backend);
+#endif
+    }
+
+    /*!
+     * Processes the row groups with indices in [groupsBegin, groupsEnd) (in backward order if Backward is true) and advances the given iterators accordingly.
+     * The iterators need to point to the row group indicator of the first processed group.
+     * @return false iff the application was aborted by the backend
+     */
+    template<typename OperandType, typename OffsetType, typename BackendType, bool Backward, bool SkipIgnoredRows, OptimizationDirection RobustDirection,
+             bool UseSimd>
+    bool applyGroups(IndexType const groupsBegin, IndexType const groupsEnd, std::vector<IndexType>::const_iterator& matrixColumnIt,
+                     typename std::vector<ValueType>::const_iterator& matrixValueIt, OperandType& operandOut, OperandType const& operandIn,
+                     OffsetType const& offsets, BackendType& backend) const {
+        for (auto groupIndex : indexRange<Backward>(groupsBegin, groupsEnd)) {
             STORM_LOG_ASSERT(matrixColumnIt != matrixColumns.end(), "VI Operator in invalid state.");
             STORM_LOG_ASSERT(*matrixColumnIt >= StartOfRowIndicator, "VI Operator in invalid state.");
             //            STORM_LOG_ASSERT(matrixValueIt != matrixValues.end(), "VI Operator in invalid state.");
             if constexpr (TrivialRowGrouping) {
-                backend.firstRow(applyRow<RobustDirection>(matrixColumnIt, matrixValueIt, operandIn, offsets, groupIndex), groupIndex, groupIndex);
+                backend.firstRow(applyRow<RobustDirection, UseSimd>(matrixColumnIt, matrixValueIt, operandIn, offsets, groupIndex), groupIndex, groupIndex);
             } else {
                 IndexType rowIndex = (*rowGroupIndices)[groupIndex];
                 if constexpr (SkipIgnoredRows) {
                     rowIndex += skipMultipleIgnoredRows(matrixColumnIt, matrixValueIt);
                 }
-                backend.firstRow(applyRow<RobustDirection>(matrixColumnIt, matrixValueIt, operandIn, offsets, rowIndex), groupIndex, rowIndex);
+                backend.firstRow(applyRow<RobustDirection, UseSimd>(matrixColumnIt, matrixValueIt, operandIn, offsets, rowIndex), groupIndex, rowIndex);
                 while (*matrixColumnIt < StartOfRowGroupIndicator) {
                     ++rowIndex;
                     if (!SkipIgnoredRows || !skipIgnoredRow(matrixColumnIt, matrixValueIt)) {
-                        backend.nextRow(applyRow<RobustDirection>(matrixColumnIt, matrixValueIt, operandIn, offsets, rowIndex), groupIndex, rowIndex);
+                        backend.nextRow(applyRow<RobustDirection, UseSimd>(matrixColumnIt, matrixValueIt, operandIn, offsets, rowIndex), groupIndex, rowIndex);
                     }
                 }
             }
@@ -196,13 +416,10 @@ class ValueIterationOperator {
                 backend.applyUpdate(operandOut[groupIndex], groupIndex);
             }
             if (backend.abort()) {
-                return backend.converged();
+                return false;
             }
         }
-        STORM_LOG_ASSERT(matrixColumnIt + 1 == matrixColumns.cend(), "Unexpected position of matrix column iterator.");
-        STORM_LOG_ASSERT(matrixValueIt == matrixValues.cend(), "Unexpected position of matrix column iterator.");
-        backend.endOfIteration();
-        return backend.converged();
+        return true;
     }
 
     // Auxiliary methods to deal with various OperandTypes and OffsetTypes
@@ -248,27 +465,42 @@ class ValueIterationOperator {
     /*!
      * Computes the result for a single row and advances the given iterators to the end of the row
      */
-    template<OptimizationDirection RobustDirection, typename OperandType, typename OffsetType>
+    template<OptimizationDirection RobustDirection, bool UseSimd, typename OperandType, typename OffsetType>
     auto applyRow(std::vector<IndexType>::const_iterator& matrixColumnIt, typename std::vector<ValueType>::const_iterator& matrixValueIt,
                   OperandType const& operand, OffsetType const& offsets, uint64_t offsetIndex) const {
         if constexpr (std::is_same_v<ValueType, storm::Interval>) {
             return applyRowRobust<RobustDirection>(matrixColumnIt, matrixValueIt, operand, offsets, offsetIndex);
         } else {
-            return applyRowStandard(matrixColumnIt, matrixValueIt, operand, offsets, offsetIndex);
+            return applyRowStandard<UseSimd>(matrixColumnIt, matrixValueIt, operand, offsets, offsetIndex);
         }
     }
 
-    template<typename OperandType, typename OffsetType>
+    template<bool UseSimd, typename OperandType, typename OffsetType>
     auto applyRowStandard(std::vector<IndexType>::const_iterator& matrixColumnIt, typename std::vector<ValueType>::const_iterator& matrixValueIt,
                           OperandType const& operand, OffsetType const& offsets, uint64_t offsetIndex) const {
         STORM_LOG_ASSERT(*matrixColumnIt >= StartOfRowIndicator, "VI Operator in invalid state.");
         auto result{initializeRowRes(operand, offsets, offsetIndex)};
-        for (++matrixColumnIt; *matrixColumnIt < StartOfRowIndicator; ++matrixColumnIt, ++matrixValueIt) {
-            if constexpr (isPair<OperandType>::value) {
+        if constexpr (UseSimd) {
+            static_assert(std::is_same_v<ValueType, double> && std::is_same_v<OperandType, std::vector<double>>, "Unexpected types for the vectorized kernel.");
+            ++matrixColumnIt;
+            result += kernels::simdRowSum(matrixColumnIt, matrixColumns.cend(), matrixValueIt, operand.data());
+        } else if constexpr (isPair<OperandType>::value) {
+            for (++matrixColumnIt; *matrixColumnIt < StartOfRowIndicator; ++matrixColumnIt, ++matrixValueIt) {
                 result.first += operand.first[*matrixColumnIt] * (*matrixValueIt);
                 result.second += operand.second[*matrixColumnIt] * (*matrixValueIt);
-            } else {
+            }
+        } else {
+            // Process two entries per step. As each row is followed by a row indicator, reading one entry ahead never leaves matrixColumns.
+            // The summation order is the same as for a plain loop.
+            for (++matrixColumnIt; matrixColumnIt[0] < StartOfRowIndicator && matrixColumnIt[1] < StartOfRowIndicator;
+                 matrixColumnIt += 2, matrixValueIt += 2) {
+                result += operand[matrixColumnIt[0]] * matrixValueIt[0];
+                result += operand[matrixColumnIt[1]] * matrixValueIt[1];
+            }
+            if (*matrixColumnIt < StartOfRowIndicator) {
                 result += operand[*matrixColumnIt] * (*matrixValueIt);
+                ++matrixColumnIt;
+                ++matrixValueIt;
             }
         }
         return result;
@@ -277,11 +509,11 @@ class ValueIterationOperator {
     // Aux function for applyRowRobust
     template<OptimizationDirection RobustDirection>
     struct AuxCompare {
-        bool operator()(const std::pair<SolutionType, SolutionType>& a, const std::pair<SolutionType, SolutionType>& b) const {
+        bool operator()(SolutionType const& a, SolutionType const& b) const {
             if constexpr (RobustDirection == OptimizationDirection::Maximize) {
-                return a.first > b.first;
+                return a > b;
             } else {
-                return a.first < b.first;
+                return a < b;
             }
         }
     };
@@ -291,8 +523,8 @@ class ValueIterationOperator {
                         OperandType const& operand, OffsetType const& offsets, uint64_t offsetIndex) const {
         STORM_LOG_ASSERT(*matrixColumnIt >= StartOfRowIndicator, "VI Operator in invalid state.");
         auto result{robustInitializeRowRes<RobustDirection>(operand, offsets, offsetIndex)};
-        AuxCompare<RobustDirection> compare;
-        applyCache.robustOrder.clear();
+        auto const rowColumnsBegin = matrixColumnIt + 1;
+        auto const rowValuesBegin = matrixValueIt;
 
         SolutionType remainingValue{storm::utility::one<SolutionType>()};
         for (++matrixColumnIt; *matrixColumnIt < StartOfRowIndicator; ++matrixColumnIt, ++matrixValueIt) {
@@ -304,23 +536,39 @@ class ValueIterationOperator {
                 result += operand[*matrixColumnIt] * lower;
             }
             remainingValue -= lower;
-            auto const diameter = matrixValueIt->upper() - lower;
-            if (!storm::utility::isZero(diameter)) {
-                applyCache.robustOrder.emplace_back(operand[*matrixColumnIt], diameter);
-            }
         }
         if (storm::utility::isZero(remainingValue) || storm::utility::isOne(remainingValue)) {
             return result;
         }
 
-        std::sort(applyCache.robustOrder.begin(), applyCache.robustOrder.end(), compare);
+        if constexpr (!isPair<OperandType>::value) {
+            // The successors of each row are kept ordered by their value in the previous application. As the values change only slightly between
+            // iterations, repairing this order with insertion sort takes (almost) linear time.
+            AuxCompare<RobustDirection> compare;
+            uint32_t* order = applyCache.robustOrder.data() + (rowValuesBegin - matrixValues.cbegin());
+            uint32_t const rowLength = matrixValueIt - rowValuesBegin;
+            for (uint32_t i = 1; i < rowLength; ++i) {
+                uint32_t const current = order[i];
+                SolutionType const& currentValue = operand[rowColumnsBegin[current]];
+                uint32_t j = i;
+                for (; j > 0 && compare(currentValue, operand[rowColumnsBegin[order[j - 1]]]); --j) {
+                    order[j] = order[j - 1];
+                }
+                order[j] = current;
+            }
 
-        for (auto const& pair : applyCache.robustOrder) {
-            auto availableMass = std::min(pair.second, remainingValue);
-            result += availableMass * pair.first;
-            remainingValue -= availableMass;
-            if (storm::utility::isZero(remainingValue)) {
-                return result;
+            for (uint32_t i = 0; i < rowLength; ++i) {
+                auto const& interval = rowValuesBegin[order[i]];
+                auto const diameter = interval.upper() - interval.lower();
+                if (storm::utility::isZero(diameter)) {
+                    continue;
+                }
+                auto availableMass = std::min(diameter, remainingValue);
+                result += availableMass * operand[rowColumnsBegin[order[i]]];
+                remainingValue -= availableMass;
+                if (storm::utility::isZero(remainingValue)) {
+                    return result;
+                }
             }
         }
         STORM_LOG_ASSERT(storm::utility::isAlmostZero(remainingValue), "Remaining value should be zero (all prob mass taken) but is " << remainingValue);
@@ -356,8 +604,91 @@ class ValueIterationOperator {
     /*!
      * Internal variant of setIgnoredRows
      */
-    template<bool Backward = true>
-    void setIgnoredRows(bool useLocalRowIndices, std::function<bool(IndexType, IndexType)> const& ignore);
+    template<bool Backward, typename IgnoreFunction>
+    void setIgnoredRows(bool useLocalRowIndices, IgnoreFunction const& ignore) {
+        STORM_LOG_ASSERT(!TrivialRowGrouping, "Tried to ignroe rows but the row grouping is trivial.");
+        auto colIt = matrixColumns.begin();
+        for (auto groupIndex : indexRange<Backward>(0, this->rowGroupIndices->size() - 1)) {
+            STORM_LOG_ASSERT(colIt != matrixColumns.end(), "VI Operator in invalid state.");
+            STORM_LOG_ASSERT(*colIt >= StartOfRowGroupIndicator, "VI Operator in invalid state.");
+            auto const rowIndexRange = useLocalRowIndices
+                                           ? indexRange<false>(0ull, (*this->rowGroupIndices)[groupIndex + 1] - (*this->rowGroupIndices)[groupIndex])
+                                           : indexRange<false>((*this->rowGroupIndices)[groupIndex], (*this->rowGroupIndices)[groupIndex + 1]);
+            for (auto const rowIndex : rowIndexRange) {
+                if (!ignore(groupIndex, rowIndex)) {
+                    *colIt &= StartOfRowGroupIndicator;  // Clear number of skipped entries
+                    moveToEndOfRow(colIt);
+                } else if ((*colIt & SkipNumEntriesMask) == 0) {  // i.e. should ignore but is not already ignored
+                    auto currColIt = colIt;
+                    moveToEndOfRow(colIt);
+                    *currColIt += std::distance(currColIt, colIt);  // set number of skipped entries
+                }
+                STORM_LOG_ASSERT(!std::all_of(rowIndexRange.begin(), rowIndexRange.end(),
+                                              [&ignore, &groupIndex](IndexType rowIndex) { return ignore(groupIndex, rowIndex); }),
+                                 "All rows in row group " << groupIndex << " are ignored.");
+                STORM_LOG_ASSERT(colIt != matrixColumns.end(), "VI Operator in invalid state.");
+                STORM_LOG_ASSERT(*colIt >= StartOfRowIndicator, "VI Operator in invalid state.");
+            }
+            STORM_LOG_ASSERT(*colIt == StartOfRowGroupIndicator, "VI Operator in invalid state.");
+        }
+        hasSkippedRows = true;
+        updateKernelIndex();
+    }
+
+    /*!
+     * Flags that together identify a kernel, i.e., a variant of `apply` (or `applyParallel`) that is specialized at compile time for the traversal
+     * direction, for whether ignored rows need to be skipped, and for whether rows are processed using the vectorized kernel.
+     * The model class (deterministic or not), the optimization direction of the backend, and the operand type (single vector or pair) are template
+     * parameters anyway, so each kernel is specialized for those as well.
+     */
+    static constexpr uint64_t BackwardKernelFlag = 1;
+    static constexpr uint64_t SkipIgnoredRowsKernelFlag = 2;
+    static constexpr uint64_t SimdKernelFlag = 4;
+    static constexpr uint64_t NumberOfKernels = 8;
+
+    template<typename OperandType, typename OffsetType, typename BackendType>
+    using KernelType = bool (ValueIterationOperator::*)(OperandType&, OperandType const&, OffsetType const&, BackendType&) const;
+
+    template<typename OperandType, typename OffsetType, typename BackendType, OptimizationDirection RobustDirection, bool Parallel, uint64_t KernelIndex>
+    static constexpr KernelType<OperandType, OffsetType, BackendType> getKernel() {
+        constexpr bool Backward = (KernelIndex & BackwardKernelFlag) != 0;
+        constexpr bool SkipIgnoredRows = (KernelIndex & SkipIgnoredRowsKernelFlag) != 0;
+        // The vectorized kernel only exists for (single) double operands. Otherwise, the kernel falls back to the scalar variant.
+        constexpr bool UseSimd =
+            (KernelIndex & SimdKernelFlag) != 0 && std::is_same_v<ValueType, double> && std::is_same_v<OperandType, std::vector<double>>;
+        if constexpr (Parallel) {
+            return &ValueIterationOperator::template applyParallel<OperandType, OffsetType, BackendType, Backward, SkipIgnoredRows, RobustDirection, UseSimd>;
+        } else {
+            return &ValueIterationOperator::template apply<OperandType, OffsetType, BackendType, Backward, SkipIgnoredRows, RobustDirection, UseSimd>;
+        }
+    }
+
+    template<typename OperandType, typename OffsetType, typename BackendType, OptimizationDirection RobustDirection, bool Parallel, uint64_t... KernelIndices>
+    static constexpr std::array<KernelType<OperandType, OffsetType, BackendType>, sizeof...(KernelIndices)> makeKernelTable(
+        std::integer_sequence<uint64_t, KernelIndices...>) {
+        return {getKernel<OperandType, OffsetType, BackendType, RobustDirection, Parallel, KernelIndices>()...};
+    }
+
+    /*!
+     * Applies the operator using the kernel that has been selected for the current matrix and ignored rows.
+     */
+    template<typename OperandType, typename OffsetType, typename BackendType, OptimizationDirection RobustDirection, bool Parallel>
+    bool applyKernel(OperandType& operandOut, OperandType const& operandIn, OffsetType const& offsets, BackendType& backend) const {
+        static constexpr auto kernelTable = makeKernelTable<OperandType, OffsetType, BackendType, RobustDirection, Parallel>(
+            std::make_integer_sequence<uint64_t, NumberOfKernels>());
+        return (this->*kernelTable[kernelIndex])(operandOut, operandIn, offsets, backend);
+    }
+
+    /*!
+     * Selects the kernel that fits the current matrix and ignored rows
+     */
+    void updateKernelIndex();
+
+    /*!
+     * Internal variant of `setMatrix` that can deal with different matrix representations.
+     */
+    template<bool Backward, typename MatrixType>
+    void setMatrixImpl(MatrixType const& matrix, std::vector<IndexType> const* rowGroupIndices);
 
     /*!
      * Moves the given iterator to the end of the current row
@@ -401,6 +732,40 @@ class ValueIterationOperator {
      */
     bool hasSkippedRows{false};
 
+    /*!
+     * True iff rows are processed using the vectorized kernel of ValueIterationOperatorKernels.h (only for double matrices on supporting CPUs)
+     */
+    bool useSimdRowSum{false};
+
+    /*!
+     * The index of the kernel that is used when applying this operator, see `applyKernel`
+     */
+    uint64_t kernelIndex{BackwardKernelFlag};
+
+    /*!
+     * True iff helpers shall prefer the parallel application of this operator
+     */
+    bool parallelApply{false};
+
+    /*!
+     * Position of the first row group of a chunk that can be processed independently of the other chunks
+     */
+    struct ChunkStart {
+        IndexType iterationIndex;  // The number of row groups that are processed before this chunk (in the order given by 'backwards')
+        uint64_t columnOffset;     // The position of the row group indicator of the first group of this chunk in 'matrixColumns'
+        uint64_t valueOffset;      // The position of the first entry of this chunk in 'matrixValues'
+    };
+
+    /*!
+     * The chunks used for parallel applications of this operator, in the order in which they are stored in 'matrixColumns'
+     */
+    std::vector<ChunkStart> chunkStarts;
+
+    /*!
+     * The number of row groups per chunk (except possibly the last one)
+     */
+    static uint64_t const GroupsPerChunk = 1024;
+
     /*!
      * Storage for the auxiliary vector
      */
@@ -418,7 +783,9 @@ class ValueIterationOperator {
 
     template<typename Dummy>
     struct ApplyCache<storm::Interval, Dummy> {
-        mutable std::vector<std::pair<SolutionType, SolutionType>> robustOrder;
+        // For each row, the (local) indices of its entries, ordered by the values of the successors in the last application.
+        // Rows are only touched by the thread that processes them, so this can be used with applyParallel.
+        mutable std::vector<uint32_t> robustOrder;
     };
 
     /*!
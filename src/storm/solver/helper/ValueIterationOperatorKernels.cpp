@@ -0,0 +1,175 @@
+#include "storm/solver/helper/ValueIterationOperatorKernels.h"
+
+#include <algorithm>
+
+#include "storm/utility/macros.h"
+
+#if defined(__x86_64__) && (defined(__GNUC__) || defined(__clang__))
+#define STORM_VI_OPERATOR_X86_KERNELS
+#include <immintrin.h>
+#endif
+
+namespace storm::solver::helper::kernels {
+
+namespace {
+using ColumnIterator = std::vector<uint64_t>::const_iterator;
+using ValueIterator = std::vector<double>::const_iterator;
+
+// Row indicators are exactly the entries in the column vector whose most significant bit is set (see ValueIterationOperator).
+uint64_t const StartOfRowIndicator = 1ull << 63;
+
+double rowSumRemainder(double result, ColumnIterator& columnIt, ValueIterator& valueIt, double const* operand) {
+    for (; *columnIt < StartOfRowIndicator; ++columnIt, ++valueIt) {
+        result += operand[*columnIt] * (*valueIt);
+    }
+    return result;
+}
+
+#ifdef STORM_VI_OPERATOR_X86_KERNELS
+__attribute__((target("avx2,fma"))) double rowSumAvx2(ColumnIterator& columnIt, ColumnIterator const& columnEnd, ValueIterator& valueIt,
+                                                      double const* operand) {
+    __m256d sum = _mm256_setzero_pd();
+    while (columnEnd - columnIt >= 4) {
+        __m256i const columns = _mm256_loadu_si256(reinterpret_cast<__m256i const*>(&*columnIt));
+        // The sign bits of the columns (interpreted as doubles) are set iff there is a row indicator among the next four entries.
+        if (_mm256_movemask_pd(_mm256_castsi256_pd(columns)) != 0) {
+            break;
+        }
+        __m256d const operands = _mm256_i64gather_pd(operand, columns, 8);
+        sum = _mm256_fmadd_pd(_mm256_loadu_pd(&*valueIt), operands, sum);
+        columnIt += 4;
+        valueIt += 4;
+    }
+    __m128d pairSum = _mm_add_pd(_mm256_castpd256_pd128(sum), _mm256_extractf128_pd(sum, 1));
+    double const result = _mm_cvtsd_f64(_mm_add_sd(pairSum, _mm_unpackhi_pd(pairSum, pairSum)));
+    return rowSumRemainder(result, columnIt, valueIt, operand);
+}
+
+__attribute__((target("avx512f"))) double rowSumAvx512(ColumnIterator& columnIt, ColumnIterator const& columnEnd, ValueIterator& valueIt,
+                                                       double const* operand) {
+    __m512d sum = _mm512_setzero_pd();
+    __m512i const indicatorMask = _mm512_set1_epi64(static_cast<long long>(StartOfRowIndicator));
+    while (columnEnd - columnIt >= 8) {
+        __m512i const columns = _mm512_loadu_si512(&*columnIt);
+        if (_mm512_test_epi64_mask(columns, indicatorMask) != 0) {
+            break;
+        }
+        __m512d const operands = _mm512_i64gather_pd(columns, operand, 8);
+        sum = _mm512_fmadd_pd(_mm512_loadu_pd(&*valueIt), operands, sum);
+        columnIt += 8;
+        valueIt += 8;
+    }
+    return rowSumRemainder(_mm512_reduce_add_pd(sum), columnIt, valueIt, operand);
+}
+
+static_assert(BlockRowCount == 4, "The AVX2 block kernel processes exactly four rows.");
+
+__attribute__((target("avx2,fma"))) void blockRowSumsAvx2(uint64_t const* columns, double const* values, uint64_t blockLength, double const* operand,
+                                                          double* results) {
+    __m256d sum = _mm256_loadu_pd(results);
+    for (uint64_t entry = 0; entry < blockLength; ++entry, columns += BlockRowCount, values += BlockRowCount) {
+        __m256i const blockColumns = _mm256_loadu_si256(reinterpret_cast<__m256i const*>(columns));
+        sum = _mm256_fmadd_pd(_mm256_loadu_pd(values), _mm256_i64gather_pd(operand, blockColumns, 8), sum);
+    }
+    _mm256_storeu_pd(results, sum);
+}
+
+template<bool Maximize>
+__attribute__((target("avx2"))) double extremumAvx2(double const* values, uint64_t size) {
+    if (size < 4) {
+        return Maximize ? *std::max_element(values, values + size) : *std::min_element(values, values + size);
+    }
+    __m256d extremum = _mm256_loadu_pd(values);
+    uint64_t index = 4;
+    for (; index + 4 <= size; index += 4) {
+        extremum = Maximize ? _mm256_max_pd(extremum, _mm256_loadu_pd(values + index)) : _mm256_min_pd(extremum, _mm256_loadu_pd(values + index));
+    }
+    // The remaining values are covered by (re-)processing the last four values.
+    if (index < size) {
+        __m256d const last = _mm256_loadu_pd(values + size - 4);
+        extremum = Maximize ? _mm256_max_pd(extremum, last) : _mm256_min_pd(extremum, last);
+    }
+    __m128d pair = Maximize ? _mm_max_pd(_mm256_castpd256_pd128(extremum), _mm256_extractf128_pd(extremum, 1))
+                            : _mm_min_pd(_mm256_castpd256_pd128(extremum), _mm256_extractf128_pd(extremum, 1));
+    pair = Maximize ? _mm_max_sd(pair, _mm_unpackhi_pd(pair, pair)) : _mm_min_sd(pair, _mm_unpackhi_pd(pair, pair));
+    return _mm_cvtsd_f64(pair);
+}
+#endif
+
+void blockRowSumsScalar(uint64_t const* columns, double const* values, uint64_t blockLength, double const* operand, double* results) {
+    for (uint64_t entry = 0; entry < blockLength; ++entry, columns += BlockRowCount, values += BlockRowCount) {
+        for (uint64_t row = 0; row < BlockRowCount; ++row) {
+            results[row] += values[row] * operand[columns[row]];
+        }
+    }
+}
+
+template<bool Maximize>
+double extremumScalar(double const* values, uint64_t size) {
+    return Maximize ? *std::max_element(values, values + size) : *std::min_element(values, values + size);
+}
+
+using RowSumKernel = double (*)(ColumnIterator&, ColumnIterator const&, ValueIterator&, double const*);
+
+RowSumKernel selectRowSumKernel() {
+#ifdef STORM_VI_OPERATOR_X86_KERNELS
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx512f")) {
+        return &rowSumAvx512;
+    }
+    if (__builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma")) {
+        return &rowSumAvx2;
+    }
+#endif
+    return nullptr;
+}
+
+RowSumKernel const selectedRowSumKernel = selectRowSumKernel();
+
+bool isAvx2Supported() {
+#ifdef STORM_VI_OPERATOR_X86_KERNELS
+    __builtin_cpu_init();
+    return __builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma");
+#else
+    return false;
+#endif
+}
+
+using BlockRowSumsKernel = void (*)(uint64_t const*, double const*, uint64_t, double const*, double*);
+using ExtremumKernel = double (*)(double const*, uint64_t);
+
+#ifdef STORM_VI_OPERATOR_X86_KERNELS
+BlockRowSumsKernel const selectedBlockRowSumsKernel = isAvx2Supported() ? &blockRowSumsAvx2 : &blockRowSumsScalar;
+ExtremumKernel const selectedMaximumKernel = isAvx2Supported() ? &extremumAvx2<true> : &extremumScalar<true>;
+ExtremumKernel const selectedMinimumKernel = isAvx2Supported() ? &extremumAvx2<false> : &extremumScalar<false>;
+#else
+BlockRowSumsKernel const selectedBlockRowSumsKernel = &blockRowSumsScalar;
+ExtremumKernel const selectedMaximumKernel = &extremumScalar<true>;
+ExtremumKernel const selectedMinimumKernel = &extremumScalar<false>;
+#endif
+}  // namespace
+
+bool isSimdRowSumSupported() {
+    return selectedRowSumKernel != nullptr;
+}
+
+double simdRowSum(ColumnIterator& columnIt, ColumnIterator const& columnEnd, ValueIterator& valueIt, double const* operand) {
+    STORM_LOG_ASSERT(isSimdRowSumSupported(), "No vectorized row kernel available on this CPU.");
+    return selectedRowSumKernel(columnIt, columnEnd, valueIt, operand);
+}
+
+void blockRowSums(uint64_t const* columns, double const* values, uint64_t blockLength, double const* operand, double* results) {
+    selectedBlockRowSumsKernel(columns, values, blockLength, operand, results);
+}
+
+double maximum(double const* values, uint64_t size) {
+    STORM_LOG_ASSERT(size > 0, "Expected at least one value.");
+    return selectedMaximumKernel(values, size);
+}
+
+double minimum(double const* values, uint64_t size) {
+    STORM_LOG_ASSERT(size > 0, "Expected at least one value.");
+    return selectedMinimumKernel(values, size);
+}
+
+}  // namespace storm::solver::helper::kernels
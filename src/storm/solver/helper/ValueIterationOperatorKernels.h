@@ -0,0 +1,54 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+namespace storm::solver::helper::kernels {
+
+/*!
+ * @return true iff the current CPU supports one of the vectorized row kernels (AVX-512 or AVX2 with FMA).
+ * @note The check is performed at runtime, so that a single (portable) binary can use the vectorized kernels whenever they are available.
+ */
+bool isSimdRowSumSupported();
+
+/*!
+ * Computes the sum over all entries e of a matrix row of value(e) * operand[column(e)], where the row is given in the layout of the ValueIterationOperator.
+ * Columns are read via vector loads and the corresponding operand entries are fetched using gather instructions.
+ * @param columnIt points to the first column of the row. Is advanced to the row indicator that follows the last column of the row.
+ * @param columnEnd the end of the column vector. Vector loads are never performed beyond this position.
+ * @param valueIt points to the value of the first entry of the row. Is advanced to the value past the last entry of the row.
+ * @param operand the operand vector
+ * @pre isSimdRowSumSupported() returns true
+ * @note The summation order differs from a plain sequential loop, so results may differ in the last bits.
+ */
+double simdRowSum(std::vector<uint64_t>::const_iterator& columnIt, std::vector<uint64_t>::const_iterator const& columnEnd,
+                  std::vector<double>::const_iterator& valueIt, double const* operand);
+
+/*!
+ * The number of rows that are processed simultaneously by blockRowSums.
+ */
+uint64_t constexpr BlockRowCount = 4;
+
+/*!
+ * Adds the products of BlockRowCount matrix rows with the operand to the given results. The rows are stored interleaved (and padded to a common length),
+ * i.e., the k-th entry of the j-th row is at position k * BlockRowCount + j of the given columns and values. Padding entries shall have value zero.
+ * @param columns the (interleaved) columns of the rows
+ * @param values the (interleaved) values of the rows
+ * @param blockLength the number of entries of each (padded) row
+ * @param operand the operand vector
+ * @param results the BlockRowCount row results to which the products are added
+ * @note Uses a gather based kernel whenever the CPU supports AVX2 with FMA and a scalar loop otherwise.
+ */
+void blockRowSums(uint64_t const* columns, double const* values, uint64_t blockLength, double const* operand, double* results);
+
+/*!
+ * @return the largest of the given (at least one) values. Uses vector instructions if the CPU supports AVX2.
+ */
+double maximum(double const* values, uint64_t size);
+
+/*!
+ * @return the smallest of the given (at least one) values. Uses vector instructions if the CPU supports AVX2.
+ */
+double minimum(double const* values, uint64_t size);
+
+}  // namespace storm::solver::helper::kernels
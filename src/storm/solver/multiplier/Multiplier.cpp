@@ -14,6 +14,7 @@
 
 #include "storm/solver/SolverSelectionOptions.h"
 #include "storm/solver/multiplier/GmmxxMultiplier.h"
+#include "storm/solver/multiplier/SlicedMultiplier.h"
 #include "storm/utility/ProgressMeasurement.h"
 #include "storm/utility/SignalHandler.h"
 #include "storm/utility/macros.h"
@@ -52,6 +53,7 @@ void Multiplier<ValueType>::repeatedMultiply(Environment const& env, std::vector
         progress.updateProgress(i);
         multiply(env, x, b, x);
         if (storm::utility::resources::isTerminate()) {
+            storm::utility::resources::reportAbortedComputation();
             STORM_LOG_WARN("Aborting after " << i << " of " << n << " multiplications.");
             break;
         }
@@ -67,6 +69,7 @@ void Multiplier<ValueType>::repeatedMultiplyAndReduce(Environment const& env, Op
     for (uint64_t i = 0; i < n; ++i) {
         multiplyAndReduce(env, dir, x, b, x);
         if (storm::utility::resources::isTerminate()) {
+            storm::utility::resources::reportAbortedComputation();
             STORM_LOG_WARN("Aborting after " << i << " of " << n << " multiplications");
             break;
         }
@@ -107,6 +110,13 @@ std::unique_ptr<Multiplier<ValueType>> MultiplierFactory<ValueType>::create(Envi
             return std::make_unique<GmmxxMultiplier<ValueType>>(matrix);
         case MultiplierType::Native:
             return std::make_unique<NativeMultiplier<ValueType>>(matrix);
+        case MultiplierType::Sliced:
+            if constexpr (std::is_same_v<ValueType, double>) {
+                return std::make_unique<SlicedMultiplier<ValueType>>(matrix);
+            } else {
+                STORM_LOG_WARN("The sliced multiplier is only supported for double values. Falling back to the native multiplier.");
+                return std::make_unique<NativeMultiplier<ValueType>>(matrix);
+            }
     }
     STORM_LOG_THROW(false, storm::exceptions::IllegalArgumentException, "Unknown MultiplierType");
 }
@@ -3,6 +3,7 @@
 #include "storm-config.h"
 
 #include "storm/environment/solver/MultiplierEnvironment.h"
+#include "storm/environment/solver/SolverEnvironment.h"
 
 #include "storm/storage/SparseMatrix.h"
 
@@ -10,19 +11,48 @@
 #include "storm/adapters/RationalFunctionAdapter.h"
 #include "storm/adapters/RationalNumberAdapter.h"
 
+#include "storm/exceptions/NotSupportedException.h"
+#include "storm/utility/constants.h"
 #include "storm/utility/macros.h"
 
 namespace storm {
 namespace solver {
 
 template<typename ValueType>
-NativeMultiplier<ValueType>::NativeMultiplier(storm::storage::SparseMatrix<ValueType> const& matrix) : Multiplier<ValueType>(matrix) {
+NativeMultiplier<ValueType>::NativeMultiplier(storm::storage::SparseMatrix<ValueType> const& matrix)
+    : Multiplier<ValueType>(matrix), cachedColorClassesForRowGroups(false) {
     // Intentionally left empty.
 }
 
+template<typename ValueType>
+void NativeMultiplier<ValueType>::clearCache() const {
+    cachedCompactMatrix.reset();
+    cachedColorClasses.reset();
+    Multiplier<ValueType>::clearCache();
+}
+
 template<typename ValueType>
 bool NativeMultiplier<ValueType>::parallelize(Environment const& env) const {
+#ifdef STORM_HAVE_INTELTBB
+    return env.solver().isUseIntelTbb();
+#else
     return false;
+#endif
+}
+
+template<typename ValueType>
+storm::storage::CompactSparseMatrix<ValueType> const* NativeMultiplier<ValueType>::getCompactMatrix(Environment const& env) const {
+    if constexpr (std::is_same_v<ValueType, double>) {
+        if (env.solver().multiplier().isUseCompactMatrix()) {
+            if (!cachedCompactMatrix) {
+                cachedCompactMatrix = std::make_unique<storm::storage::CompactSparseMatrix<ValueType>>(this->matrix);
+            }
+            return cachedCompactMatrix.get();
+        }
+    } else {
+        STORM_LOG_WARN_COND(!env.solver().multiplier().isUseCompactMatrix(), "A compact matrix representation is only supported for double values.");
+    }
+    return nullptr;
 }
 
 template<typename ValueType>
@@ -39,6 +69,8 @@ void NativeMultiplier<ValueType>::multiply(Environment const& env, std::vector<V
     }
     if (parallelize(env)) {
         multAddParallel(x, b, *target);
+    } else if (auto compactMatrix = getCompactMatrix(env)) {
+        compactMatrix->multiplyWithVector(x, *target, b);
     } else {
         multAdd(x, b, *target);
     }
@@ -50,7 +82,11 @@ void NativeMultiplier<ValueType>::multiply(Environment const& env, std::vector<V
 template<typename ValueType>
 void NativeMultiplier<ValueType>::multiplyGaussSeidel(Environment const& env, std::vector<ValueType>& x, std::vector<ValueType> const* b,
                                                       bool backwards) const {
-    if (backwards) {
+    if (parallelize(env)) {
+        multAddGaussSeidelParallel(x, b, backwards);
+    } else if (auto compactMatrix = getCompactMatrix(env)) {
+        compactMatrix->multiplyWithVectorGaussSeidel(x, b, backwards);
+    } else if (backwards) {
         this->matrix.multiplyWithVectorBackward(x, x, b);
     } else {
         this->matrix.multiplyWithVectorForward(x, x, b);
@@ -72,6 +108,8 @@ void NativeMultiplier<ValueType>::multiplyAndReduce(Environment const& env, Opti
     }
     if (parallelize(env)) {
         multAddReduceParallel(dir, rowGroupIndices, x, b, *target, choices);
+    } else if (auto compactMatrix = getCompactMatrix(env)) {
+        compactMatrix->multiplyAndReduce(dir, rowGroupIndices, x, b, *target, choices);
     } else {
         multAddReduce(dir, rowGroupIndices, x, b, *target, choices);
     }
@@ -84,7 +122,11 @@ template<typename ValueType>
 void NativeMultiplier<ValueType>::multiplyAndReduceGaussSeidel(Environment const& env, OptimizationDirection const& dir,
                                                                std::vector<uint64_t> const& rowGroupIndices, std::vector<ValueType>& x,
                                                                std::vector<ValueType> const* b, std::vector<uint_fast64_t>* choices, bool backwards) const {
-    if (backwards) {
+    if (parallelize(env)) {
+        multAddReduceGaussSeidelParallel(dir, rowGroupIndices, x, b, choices, backwards);
+    } else if (auto compactMatrix = getCompactMatrix(env)) {
+        compactMatrix->multiplyAndReduceGaussSeidel(dir, rowGroupIndices, x, b, choices, backwards);
+    } else if (backwards) {
         this->matrix.multiplyAndReduceBackward(dir, rowGroupIndices, x, b, x, choices);
     } else {
         this->matrix.multiplyAndReduceForward(dir, rowGroupIndices, x, b, x, choices);
@@ -141,6 +183,168 @@ void NativeMultiplier<ValueType>::multAddReduceParallel(storm::solver::Optimizat
 #endif
 }
 
+template<typename ValueType>
+std::vector<std::vector<uint64_t>> const& NativeMultiplier<ValueType>::getColorClasses(std::vector<uint64_t> const* rowGroupIndices) const {
+    bool const forRowGroups = rowGroupIndices != nullptr;
+    uint64_t const numGroups = forRowGroups ? rowGroupIndices->size() - 1 : this->matrix.getRowCount();
+    if (cachedColorClasses && cachedColorClassesForRowGroups == forRowGroups) {
+        return *cachedColorClasses;
+    }
+    STORM_LOG_ASSERT(this->matrix.getColumnCount() == numGroups, "Gauss-Seidel style multiplication requires one column per row group.");
+
+    // Collect the dependencies between row groups. Each dependency is only stored at the larger of the two involved row groups,
+    // as the row groups are colored in ascending order below.
+    std::vector<uint64_t> neighborIndications(numGroups + 1, 0);
+    auto forEachDependency = [&](auto&& callback) {
+        for (uint64_t group = 0; group < numGroups; ++group) {
+            uint64_t const rowEnd = forRowGroups ? (*rowGroupIndices)[group + 1] : group + 1;
+            for (uint64_t row = forRowGroups ? (*rowGroupIndices)[group] : group; row < rowEnd; ++row) {
+                for (auto const& entry : this->matrix.getRow(row)) {
+                    if (entry.getColumn() < group) {
+                        callback(group, entry.getColumn());
+                    } else if (entry.getColumn() > group) {
+                        callback(entry.getColumn(), group);
+                    }
+                }
+            }
+        }
+    };
+    forEachDependency([&neighborIndications](uint64_t larger, uint64_t) { ++neighborIndications[larger + 1]; });
+    for (uint64_t group = 0; group < numGroups; ++group) {
+        neighborIndications[group + 1] += neighborIndications[group];
+    }
+    std::vector<uint64_t> neighbors(neighborIndications.back());
+    std::vector<uint64_t> insertPositions(neighborIndications.begin(), neighborIndications.end() - 1);
+    forEachDependency([&neighbors, &insertPositions](uint64_t larger, uint64_t smaller) { neighbors[insertPositions[larger]++] = smaller; });
+
+    // Greedily assign the smallest color that is not taken by an already colored neighbor.
+    cachedColorClasses = std::make_unique<std::vector<std::vector<uint64_t>>>();
+    cachedColorClassesForRowGroups = forRowGroups;
+    std::vector<uint64_t> colors(numGroups);
+    // Stores for each color the (incremented) last row group that was forbidden to take this color.
+    std::vector<uint64_t> forbiddenFor;
+    for (uint64_t group = 0; group < numGroups; ++group) {
+        for (uint64_t i = neighborIndications[group]; i < neighborIndications[group + 1]; ++i) {
+            forbiddenFor[colors[neighbors[i]]] = group + 1;
+        }
+        uint64_t color = 0;
+        while (color < forbiddenFor.size() && forbiddenFor[color] == group + 1) {
+            ++color;
+        }
+        if (color == forbiddenFor.size()) {
+            forbiddenFor.push_back(0);
+            cachedColorClasses->emplace_back();
+        }
+        colors[group] = color;
+        (*cachedColorClasses)[color].push_back(group);
+    }
+    STORM_LOG_INFO("Partitioned " << numGroups << " " << (forRowGroups ? "row groups" : "rows") << " into " << cachedColorClasses->size()
+                                  << " color classes for parallel Gauss-Seidel style multiplication.");
+    return *cachedColorClasses;
+}
+
+template<typename ValueType>
+void NativeMultiplier<ValueType>::multAddGaussSeidelParallel(std::vector<ValueType>& x, std::vector<ValueType> const* b, bool backwards) const {
+#ifdef STORM_HAVE_INTELTBB
+    auto const& colorClasses = getColorClasses(nullptr);
+    for (uint64_t i = 0; i < colorClasses.size(); ++i) {
+        auto const& colorClass = colorClasses[backwards ? colorClasses.size() - 1 - i : i];
+        tbb::parallel_for(tbb::blocked_range<uint64_t>(0, colorClass.size(), 100), [&](tbb::blocked_range<uint64_t> const& range) {
+            for (auto rowIt = colorClass.begin() + range.begin(), rowIte = colorClass.begin() + range.end(); rowIt != rowIte; ++rowIt) {
+                ValueType newValue = b ? (*b)[*rowIt] : storm::utility::zero<ValueType>();
+                for (auto const& entry : this->matrix.getRow(*rowIt)) {
+                    newValue += entry.getValue() * x[entry.getColumn()];
+                }
+                x[*rowIt] = std::move(newValue);
+            }
+        });
+    }
+#else
+    STORM_LOG_WARN("Storm was built without support for Intel TBB, defaulting to sequential version.");
+    if (backwards) {
+        this->matrix.multiplyWithVectorBackward(x, x, b);
+    } else {
+        this->matrix.multiplyWithVectorForward(x, x, b);
+    }
+#endif
+}
+
+template<typename ValueType>
+void NativeMultiplier<ValueType>::multAddReduceGaussSeidelParallel(storm::solver::OptimizationDirection const& dir,
+                                                                   std::vector<uint64_t> const& rowGroupIndices, std::vector<ValueType>& x,
+                                                                   std::vector<ValueType> const* b, std::vector<uint64_t>* choices, bool backwards) const {
+#ifdef STORM_HAVE_INTELTBB
+    if constexpr (std::is_same_v<ValueType, storm::RationalFunction>) {
+        STORM_LOG_THROW(false, storm::exceptions::NotSupportedException, "This operation is not supported.");
+    } else if (dir == storm::OptimizationDirection::Minimize) {
+        multAddReduceGaussSeidelParallel<storm::utility::ElementLess<ValueType>>(rowGroupIndices, x, b, choices, backwards);
+    } else {
+        multAddReduceGaussSeidelParallel<storm::utility::ElementGreater<ValueType>>(rowGroupIndices, x, b, choices, backwards);
+    }
+#else
+    STORM_LOG_WARN("Storm was built without support for Intel TBB, defaulting to sequential version.");
+    if (backwards) {
+        this->matrix.multiplyAndReduceBackward(dir, rowGroupIndices, x, b, x, choices);
+    } else {
+        this->matrix.multiplyAndReduceForward(dir, rowGroupIndices, x, b, x, choices);
+    }
+#endif
+}
+
+#ifdef STORM_HAVE_INTELTBB
+template<typename ValueType>
+template<typename Compare>
+void NativeMultiplier<ValueType>::multAddReduceGaussSeidelParallel(std::vector<uint64_t> const& rowGroupIndices, std::vector<ValueType>& x,
+                                                                   std::vector<ValueType> const* b, std::vector<uint64_t>* choices, bool backwards) const {
+    auto multiplyRow = [this, &x, b](uint64_t row) {
+        ValueType value = b ? (*b)[row] : storm::utility::zero<ValueType>();
+        for (auto const& entry : this->matrix.getRow(row)) {
+            value += entry.getValue() * x[entry.getColumn()];
+        }
+        return value;
+    };
+    auto const& colorClasses = getColorClasses(&rowGroupIndices);
+    for (uint64_t i = 0; i < colorClasses.size(); ++i) {
+        auto const& colorClass = colorClasses[backwards ? colorClasses.size() - 1 - i : i];
+        tbb::parallel_for(tbb::blocked_range<uint64_t>(0, colorClass.size(), 100), [&](tbb::blocked_range<uint64_t> const& range) {
+            Compare compare;
+            for (auto groupIt = colorClass.begin() + range.begin(), groupIte = colorClass.begin() + range.end(); groupIt != groupIte; ++groupIt) {
+                uint64_t const groupStart = rowGroupIndices[*groupIt];
+                uint64_t const groupEnd = rowGroupIndices[*groupIt + 1];
+                // Only multiply and reduce if there is at least one row in the group.
+                if (groupStart == groupEnd) {
+                    continue;
+                }
+                ValueType currentValue = multiplyRow(groupStart);
+
+                // Variables for correctly tracking choices (only update if new choice is strictly better).
+                ValueType oldSelectedChoiceValue;
+                uint64_t selectedChoice = 0;
+                if (choices && (*choices)[*groupIt] == 0) {
+                    oldSelectedChoiceValue = currentValue;
+                }
+
+                for (uint64_t row = groupStart + 1; row < groupEnd; ++row) {
+                    ValueType newValue = multiplyRow(row);
+                    if (choices && row == (*choices)[*groupIt] + groupStart) {
+                        oldSelectedChoiceValue = newValue;
+                    }
+                    if (compare(newValue, currentValue)) {
+                        currentValue = std::move(newValue);
+                        selectedChoice = row - groupStart;
+                    }
+                }
+
+                if (choices && compare(currentValue, oldSelectedChoiceValue)) {
+                    (*choices)[*groupIt] = selectedChoice;
+                }
+                x[*groupIt] = std::move(currentValue);
+            }
+        });
+    }
+}
+#endif
+
 template class NativeMultiplier<double>;
 template class NativeMultiplier<storm::RationalNumber>;
 template class NativeMultiplier<storm::RationalFunction>;
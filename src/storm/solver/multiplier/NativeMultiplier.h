@@ -3,6 +3,7 @@
 #include "storm/solver/multiplier/Multiplier.h"
 
 #include "storm/solver/OptimizationDirection.h"
+#include "storm/storage/CompactSparseMatrix.h"
 
 namespace storm {
 namespace storage {
@@ -18,6 +19,8 @@ class NativeMultiplier : public Multiplier<ValueType> {
     NativeMultiplier(storm::storage::SparseMatrix<ValueType> const& matrix);
     virtual ~NativeMultiplier() = default;
 
+    virtual void clearCache() const override;
+
     virtual void multiply(Environment const& env, std::vector<ValueType> const& x, std::vector<ValueType> const* b,
                           std::vector<ValueType>& result) const override;
     virtual void multiplyGaussSeidel(Environment const& env, std::vector<ValueType>& x, std::vector<ValueType> const* b, bool backwards = true) const override;
@@ -34,6 +37,11 @@ class NativeMultiplier : public Multiplier<ValueType> {
    private:
     bool parallelize(Environment const& env) const;
 
+    /*!
+     * @return the (cached) compact representation of the matrix if it shall be used for multiplications and nullptr otherwise.
+     */
+    storm::storage::CompactSparseMatrix<ValueType> const* getCompactMatrix(Environment const& env) const;
+
     void multAdd(std::vector<ValueType> const& x, std::vector<ValueType> const* b, std::vector<ValueType>& result) const;
 
     void multAddReduce(storm::solver::OptimizationDirection const& dir, std::vector<uint64_t> const& rowGroupIndices, std::vector<ValueType> const& x,
@@ -42,6 +50,26 @@ class NativeMultiplier : public Multiplier<ValueType> {
     void multAddParallel(std::vector<ValueType> const& x, std::vector<ValueType> const* b, std::vector<ValueType>& result) const;
     void multAddReduceParallel(storm::solver::OptimizationDirection const& dir, std::vector<uint64_t> const& rowGroupIndices, std::vector<ValueType> const& x,
                                std::vector<ValueType> const* b, std::vector<ValueType>& result, std::vector<uint64_t>* choices = nullptr) const;
+
+    /*!
+     * Returns a (cached) partition of the row groups into color classes such that no row group of a color class depends on another row group of the same
+     * color class, i.e., there is no matrix entry between two row groups with the same color. The row groups of one color class can thus be updated in
+     * parallel while still using the most recent values of all other color classes (multicolor Gauss-Seidel).
+     * @param rowGroupIndices the row groups to consider. If null, each row is considered as a row group of its own.
+     */
+    std::vector<std::vector<uint64_t>> const& getColorClasses(std::vector<uint64_t> const* rowGroupIndices) const;
+
+    void multAddGaussSeidelParallel(std::vector<ValueType>& x, std::vector<ValueType> const* b, bool backwards) const;
+    void multAddReduceGaussSeidelParallel(storm::solver::OptimizationDirection const& dir, std::vector<uint64_t> const& rowGroupIndices,
+                                          std::vector<ValueType>& x, std::vector<ValueType> const* b, std::vector<uint64_t>* choices, bool backwards) const;
+    template<typename Compare>
+    void multAddReduceGaussSeidelParallel(std::vector<uint64_t> const& rowGroupIndices, std::vector<ValueType>& x, std::vector<ValueType> const* b,
+                                          std::vector<uint64_t>* choices, bool backwards) const;
+
+    mutable std::unique_ptr<storm::storage::CompactSparseMatrix<ValueType>> cachedCompactMatrix;
+    mutable std::unique_ptr<std::vector<std::vector<uint64_t>>> cachedColorClasses;
+    // True if the cached color classes refer to row groups, false if they refer to single rows.
+    mutable bool cachedColorClassesForRowGroups;
 };
 
 }  // namespace solver
@@ -0,0 +1,245 @@
+#include "SlicedMultiplier.h"
+
+#include <algorithm>
+
+#include "storm-config.h"
+
+#include "storm/environment/solver/SolverEnvironment.h"
+
+#include "storm/storage/SparseMatrix.h"
+
+#include "storm/adapters/IntelTbbAdapter.h"
+#include "storm/solver/helper/ValueIterationOperatorKernels.h"
+
+#include "storm/utility/constants.h"
+#include "storm/utility/macros.h"
+
+namespace storm {
+namespace solver {
+
+using storm::solver::helper::kernels::BlockRowCount;
+
+template<typename ValueType>
+SlicedMultiplier<ValueType>::SlicedMultiplier(storm::storage::SparseMatrix<ValueType> const& matrix)
+    : Multiplier<ValueType>(matrix), nativeMultiplier(matrix) {
+    // Intentionally left empty.
+}
+
+template<typename ValueType>
+void SlicedMultiplier<ValueType>::clearCache() const {
+    cachedSlicedMatrix.reset();
+    cachedRowResults.reset();
+    nativeMultiplier.clearCache();
+    Multiplier<ValueType>::clearCache();
+}
+
+template<typename ValueType>
+bool SlicedMultiplier<ValueType>::parallelize(Environment const& env) const {
+#ifdef STORM_HAVE_INTELTBB
+    return env.solver().isUseIntelTbb();
+#else
+    return false;
+#endif
+}
+
+template<typename ValueType>
+typename SlicedMultiplier<ValueType>::SlicedMatrix const& SlicedMultiplier<ValueType>::getSlicedMatrix() const {
+    if (cachedSlicedMatrix) {
+        return *cachedSlicedMatrix;
+    }
+    cachedSlicedMatrix = std::make_unique<SlicedMatrix>();
+    SlicedMatrix& sliced = *cachedSlicedMatrix;
+    uint64_t const numberOfRows = this->matrix.getRowCount();
+    uint64_t const numberOfSlices = (numberOfRows + BlockRowCount - 1) / BlockRowCount;
+    sliced.sliceStarts.reserve(numberOfSlices + 1);
+    sliced.sliceStarts.push_back(0);
+    sliced.tailStarts.reserve(numberOfRows + 1);
+    sliced.tailStarts.push_back(0);
+    for (uint64_t sliceStartRow = 0; sliceStartRow < numberOfRows; sliceStartRow += BlockRowCount) {
+        uint64_t const sliceEndRow = std::min(sliceStartRow + BlockRowCount, numberOfRows);
+        // Only complete slices are interleaved. The rows of the last slice might thus be stored in the tails completely.
+        uint64_t sliceLength = 0;
+        if (sliceEndRow - sliceStartRow == BlockRowCount) {
+            sliceLength = this->matrix.getRow(sliceStartRow).getNumberOfEntries();
+            for (uint64_t row = sliceStartRow + 1; row < sliceEndRow; ++row) {
+                sliceLength = std::min<uint64_t>(sliceLength, this->matrix.getRow(row).getNumberOfEntries());
+            }
+        }
+        uint64_t const sliceOffset = sliced.sliceColumns.size();
+        sliced.sliceColumns.resize(sliceOffset + sliceLength * BlockRowCount);
+        sliced.sliceValues.resize(sliceOffset + sliceLength * BlockRowCount);
+        for (uint64_t row = sliceStartRow; row < sliceEndRow; ++row) {
+            uint64_t position = sliceOffset + (row - sliceStartRow);
+            uint64_t entryIndex = 0;
+            for (auto const& entry : this->matrix.getRow(row)) {
+                if (entryIndex < sliceLength) {
+                    sliced.sliceColumns[position] = entry.getColumn();
+                    sliced.sliceValues[position] = entry.getValue();
+                    position += BlockRowCount;
+                } else {
+                    sliced.tailColumns.push_back(entry.getColumn());
+                    sliced.tailValues.push_back(entry.getValue());
+                }
+                ++entryIndex;
+            }
+            sliced.tailStarts.push_back(sliced.tailColumns.size());
+        }
+        sliced.sliceStarts.push_back(sliced.sliceStarts.back() + sliceLength);
+    }
+    STORM_LOG_INFO("Stored " << sliced.sliceColumns.size() << " of " << this->matrix.getEntryCount() << " matrix entries in " << numberOfSlices
+                             << " interleaved slices.");
+    return sliced;
+}
+
+template<typename ValueType>
+void SlicedMultiplier<ValueType>::computeRowResults(uint64_t firstSlice, uint64_t lastSlice, std::vector<ValueType> const& x,
+                                                    std::vector<ValueType> const* b, std::vector<ValueType>& rowResults) const {
+    SlicedMatrix const& sliced = getSlicedMatrix();
+    uint64_t const numberOfRows = this->matrix.getRowCount();
+    for (uint64_t slice = firstSlice; slice < lastSlice; ++slice) {
+        uint64_t const sliceStartRow = slice * BlockRowCount;
+        uint64_t const sliceEndRow = std::min(sliceStartRow + BlockRowCount, numberOfRows);
+        for (uint64_t row = sliceStartRow; row < sliceEndRow; ++row) {
+            rowResults[row] = b ? (*b)[row] : storm::utility::zero<ValueType>();
+        }
+        uint64_t const sliceLength = sliced.sliceStarts[slice + 1] - sliced.sliceStarts[slice];
+        // Only complete slices have a non-empty interleaved part.
+        if (sliceLength > 0) {
+            uint64_t const sliceOffset = sliced.sliceStarts[slice] * BlockRowCount;
+            storm::solver::helper::kernels::blockRowSums(sliced.sliceColumns.data() + sliceOffset, sliced.sliceValues.data() + sliceOffset, sliceLength,
+                                                         x.data(), rowResults.data() + sliceStartRow);
+        }
+        for (uint64_t row = sliceStartRow; row < sliceEndRow; ++row) {
+            ValueType& rowResult = rowResults[row];
+            for (uint64_t position = sliced.tailStarts[row]; position < sliced.tailStarts[row + 1]; ++position) {
+                rowResult += sliced.tailValues[position] * x[sliced.tailColumns[position]];
+            }
+        }
+    }
+}
+
+template<typename ValueType>
+void SlicedMultiplier<ValueType>::computeRowResults(Environment const& env, std::vector<ValueType> const& x, std::vector<ValueType> const* b,
+                                                    std::vector<ValueType>& rowResults) const {
+    uint64_t const numberOfSlices = getSlicedMatrix().sliceStarts.size() - 1;
+    if (parallelize(env)) {
+#ifdef STORM_HAVE_INTELTBB
+        tbb::parallel_for(tbb::blocked_range<uint64_t>(0, numberOfSlices, 64), [&](tbb::blocked_range<uint64_t> const& range) {
+            computeRowResults(range.begin(), range.end(), x, b, rowResults);
+        });
+#endif
+    } else {
+        computeRowResults(0, numberOfSlices, x, b, rowResults);
+    }
+}
+
+template<typename ValueType>
+void SlicedMultiplier<ValueType>::multiply(Environment const& env, std::vector<ValueType> const& x, std::vector<ValueType> const* b,
+                                           std::vector<ValueType>& result) const {
+    std::vector<ValueType>* target = &result;
+    if (&x == &result) {
+        if (this->cachedVector) {
+            this->cachedVector->resize(x.size());
+        } else {
+            this->cachedVector = std::make_unique<std::vector<ValueType>>(x.size());
+        }
+        target = this->cachedVector.get();
+    }
+    computeRowResults(env, x, b, *target);
+    if (&x == &result) {
+        std::swap(result, *this->cachedVector);
+    }
+}
+
+template<typename ValueType>
+void SlicedMultiplier<ValueType>::multiplyGaussSeidel(Environment const& env, std::vector<ValueType>& x, std::vector<ValueType> const* b,
+                                                      bool backwards) const {
+    nativeMultiplier.multiplyGaussSeidel(env, x, b, backwards);
+}
+
+template<typename ValueType>
+void SlicedMultiplier<ValueType>::multiplyAndReduce(Environment const& env, OptimizationDirection const& dir, std::vector<uint64_t> const& rowGroupIndices,
+                                                    std::vector<ValueType> const& x, std::vector<ValueType> const* b, std::vector<ValueType>& result,
+                                                    std::vector<uint_fast64_t>* choices) const {
+    // As the row results are stored separately, the result can be written directly even if it coincides with x.
+    if (cachedRowResults) {
+        cachedRowResults->resize(this->matrix.getRowCount());
+    } else {
+        cachedRowResults = std::make_unique<std::vector<ValueType>>(this->matrix.getRowCount());
+    }
+    computeRowResults(env, x, b, *cachedRowResults);
+
+    uint64_t const numberOfGroups = rowGroupIndices.size() - 1;
+    auto reduceGroups = [&](uint64_t firstGroup, uint64_t lastGroup) {
+        if (dir == storm::OptimizationDirection::Minimize) {
+            reduce<storm::utility::ElementLess<ValueType>>(firstGroup, lastGroup, rowGroupIndices, *cachedRowResults, result, choices);
+        } else {
+            reduce<storm::utility::ElementGreater<ValueType>>(firstGroup, lastGroup, rowGroupIndices, *cachedRowResults, result, choices);
+        }
+    };
+    if (parallelize(env)) {
+#ifdef STORM_HAVE_INTELTBB
+        tbb::parallel_for(tbb::blocked_range<uint64_t>(0, numberOfGroups, 256),
+                          [&](tbb::blocked_range<uint64_t> const& range) { reduceGroups(range.begin(), range.end()); });
+#endif
+    } else {
+        reduceGroups(0, numberOfGroups);
+    }
+}
+
+template<typename ValueType>
+template<typename Compare>
+void SlicedMultiplier<ValueType>::reduce(uint64_t firstGroup, uint64_t lastGroup, std::vector<uint64_t> const& rowGroupIndices,
+                                         std::vector<ValueType> const& rowResults, std::vector<ValueType>& result, std::vector<uint64_t>* choices) const {
+    Compare compare;
+    for (uint64_t group = firstGroup; group < lastGroup; ++group) {
+        uint64_t const groupStart = rowGroupIndices[group];
+        uint64_t const groupEnd = rowGroupIndices[group + 1];
+        // Only reduce if there is at least one row in the group.
+        if (groupStart == groupEnd) {
+            continue;
+        }
+        ValueType currentValue = rowResults[groupStart];
+
+        // Variables for correctly tracking choices (only update if new choice is strictly better).
+        ValueType oldSelectedChoiceValue = currentValue;
+        uint64_t selectedChoice = 0;
+        for (uint64_t row = groupStart + 1; row < groupEnd; ++row) {
+            if (choices && row == (*choices)[group] + groupStart) {
+                oldSelectedChoiceValue = rowResults[row];
+            }
+            if (compare(rowResults[row], currentValue)) {
+                currentValue = rowResults[row];
+                selectedChoice = row - groupStart;
+            }
+        }
+
+        if (choices && compare(currentValue, oldSelectedChoiceValue)) {
+            (*choices)[group] = selectedChoice;
+        }
+        result[group] = currentValue;
+    }
+}
+
+template<typename ValueType>
+void SlicedMultiplier<ValueType>::multiplyAndReduceGaussSeidel(Environment const& env, OptimizationDirection const& dir,
+                                                               std::vector<uint64_t> const& rowGroupIndices, std::vector<ValueType>& x,
+                                                               std::vector<ValueType> const* b, std::vector<uint_fast64_t>* choices, bool backwards) const {
+    nativeMultiplier.multiplyAndReduceGaussSeidel(env, dir, rowGroupIndices, x, b, choices, backwards);
+}
+
+template<typename ValueType>
+void SlicedMultiplier<ValueType>::multiplyRow(uint64_t const& rowIndex, std::vector<ValueType> const& x, ValueType& value) const {
+    nativeMultiplier.multiplyRow(rowIndex, x, value);
+}
+
+template<typename ValueType>
+void SlicedMultiplier<ValueType>::multiplyRow2(uint64_t const& rowIndex, std::vector<ValueType> const& x1, ValueType& val1, std::vector<ValueType> const& x2,
+                                               ValueType& val2) const {
+    nativeMultiplier.multiplyRow2(rowIndex, x1, val1, x2, val2);
+}
+
+template class SlicedMultiplier<double>;
+
+}  // namespace solver
+}  // namespace storm
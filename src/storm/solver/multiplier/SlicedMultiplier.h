@@ -0,0 +1,81 @@
+#pragma once
+
+#include "storm/solver/multiplier/Multiplier.h"
+#include "storm/solver/multiplier/NativeMultiplier.h"
+
+#include "storm/solver/OptimizationDirection.h"
+
+namespace storm {
+namespace storage {
+template<typename ValueType>
+class SparseMatrix;
+}
+
+namespace solver {
+
+/*!
+ * A multiplier that keeps the matrix in a sliced layout (as used for SIMD units and accelerators): consecutive rows are grouped to slices of
+ * kernels::BlockRowCount rows whose entries are stored interleaved up to the length of the shortest row of the slice. The remaining entries of each
+ * row are stored separately, so no padding is needed. The interleaved part is processed with one vector lane per row, which avoids the horizontal
+ * reductions of row-wise kernels.
+ * Gauss-Seidel style multiplications and single rows are delegated to the native multiplier.
+ * @note only available for double values, the MultiplierFactory uses the native multiplier for other value types.
+ */
+template<typename ValueType>
+class SlicedMultiplier : public Multiplier<ValueType> {
+   public:
+    SlicedMultiplier(storm::storage::SparseMatrix<ValueType> const& matrix);
+    virtual ~SlicedMultiplier() = default;
+
+    virtual void clearCache() const override;
+
+    virtual void multiply(Environment const& env, std::vector<ValueType> const& x, std::vector<ValueType> const* b,
+                          std::vector<ValueType>& result) const override;
+    virtual void multiplyGaussSeidel(Environment const& env, std::vector<ValueType>& x, std::vector<ValueType> const* b, bool backwards = true) const override;
+    virtual void multiplyAndReduce(Environment const& env, OptimizationDirection const& dir, std::vector<uint64_t> const& rowGroupIndices,
+                                   std::vector<ValueType> const& x, std::vector<ValueType> const* b, std::vector<ValueType>& result,
+                                   std::vector<uint_fast64_t>* choices = nullptr) const override;
+    virtual void multiplyAndReduceGaussSeidel(Environment const& env, OptimizationDirection const& dir, std::vector<uint64_t> const& rowGroupIndices,
+                                              std::vector<ValueType>& x, std::vector<ValueType> const* b, std::vector<uint_fast64_t>* choices = nullptr,
+                                              bool backwards = true) const override;
+    virtual void multiplyRow(uint64_t const& rowIndex, std::vector<ValueType> const& x, ValueType& value) const override;
+    virtual void multiplyRow2(uint64_t const& rowIndex, std::vector<ValueType> const& x1, ValueType& val1, std::vector<ValueType> const& x2,
+                              ValueType& val2) const override;
+
+   private:
+    struct SlicedMatrix {
+        // The (interleaved) entries of slice i are at positions BlockRowCount * sliceStarts[i], ... BlockRowCount * sliceStarts[i+1] - 1.
+        std::vector<uint64_t> sliceStarts;
+        std::vector<uint64_t> sliceColumns;
+        std::vector<ValueType> sliceValues;
+        // The entries of row r that are not part of the interleaved slice are at positions tailStarts[r], ... tailStarts[r+1] - 1.
+        std::vector<uint64_t> tailStarts;
+        std::vector<uint64_t> tailColumns;
+        std::vector<ValueType> tailValues;
+    };
+
+    bool parallelize(Environment const& env) const;
+
+    /*!
+     * @return the (cached) sliced representation of the matrix.
+     */
+    SlicedMatrix const& getSlicedMatrix() const;
+
+    /*!
+     * Computes A*x + b for the rows of the given slices and writes the results to the corresponding positions of the given vector.
+     */
+    void computeRowResults(uint64_t firstSlice, uint64_t lastSlice, std::vector<ValueType> const& x, std::vector<ValueType> const* b,
+                           std::vector<ValueType>& rowResults) const;
+    void computeRowResults(Environment const& env, std::vector<ValueType> const& x, std::vector<ValueType> const* b, std::vector<ValueType>& rowResults) const;
+
+    template<typename Compare>
+    void reduce(uint64_t firstGroup, uint64_t lastGroup, std::vector<uint64_t> const& rowGroupIndices, std::vector<ValueType> const& rowResults,
+                std::vector<ValueType>& result, std::vector<uint64_t>* choices) const;
+
+    NativeMultiplier<ValueType> nativeMultiplier;
+    mutable std::unique_ptr<SlicedMatrix> cachedSlicedMatrix;
+    mutable std::unique_ptr<std::vector<ValueType>> cachedRowResults;
+};
+
+}  // namespace solver
+}  // namespace storm
@@ -2,6 +2,7 @@
 
 #include "storm/adapters/RationalFunctionAdapter.h"
 
+#include "storm/storage/FlexibleSparseMatrix.h"
 #include "storm/utility/constants.h"
 #include "storm/utility/macros.h"
 
@@ -18,57 +19,110 @@ DynamicStatePriorityQueue<ValueType>::DynamicStatePriorityQueue(
       transitionMatrix(transitionMatrix),
       backwardTransitions(backwardTransitions),
       oneStepProbabilities(oneStepProbabilities),
-      priorityQueue(),
-      stateToPriorityQueueEntry(),
+      heap(),
+      stateToHeapPosition(transitionMatrix.getRowCount(), noHeapPosition),
       penaltyFunction(penaltyFunction) {
     // Insert all state-penalty pairs into our priority queue.
+    heap.reserve(sortedStatePenaltyPairs.size());
     for (auto const& statePenalty : sortedStatePenaltyPairs) {
-        auto it = priorityQueue.insert(priorityQueue.end(), statePenalty);
-        stateToPriorityQueueEntry.emplace(statePenalty.first, it);
+        if (statePenalty.first >= stateToHeapPosition.size()) {
+            stateToHeapPosition.resize(statePenalty.first + 1, noHeapPosition);
+        }
+        placeEntry(heap.size(), statePenalty);
+        siftUp(heap.size() - 1);
     }
 }
 
 template<typename ValueType>
 bool DynamicStatePriorityQueue<ValueType>::hasNext() const {
-    return !priorityQueue.empty();
+    return !heap.empty();
 }
 
 template<typename ValueType>
 storm::storage::sparse::state_type DynamicStatePriorityQueue<ValueType>::pop() {
-    auto it = priorityQueue.begin();
-    STORM_LOG_TRACE("Popping state " << it->first << " with priority " << it->second << ".");
-    storm::storage::sparse::state_type result = it->first;
-    priorityQueue.erase(priorityQueue.begin());
-    stateToPriorityQueueEntry.erase(result);
+    STORM_LOG_TRACE("Popping state " << heap.front().first << " with priority " << heap.front().second << ".");
+    storm::storage::sparse::state_type result = heap.front().first;
+    stateToHeapPosition[result] = noHeapPosition;
+    if (heap.size() > 1) {
+        placeEntry(0, heap.back());
+        heap.pop_back();
+        siftDown(0);
+    } else {
+        heap.pop_back();
+    }
     return result;
 }
 
 template<typename ValueType>
 void DynamicStatePriorityQueue<ValueType>::update(storm::storage::sparse::state_type state) {
-    // First, we need to find the old priority queue entry for the state.
-    auto priorityQueueEntryIt = stateToPriorityQueueEntry.find(state);
-
     // If the priority queue does not store the priority of the given state, we must not update it.
-    if (priorityQueueEntryIt == stateToPriorityQueueEntry.end()) {
+    if (state >= stateToHeapPosition.size() || stateToHeapPosition[state] == noHeapPosition) {
         return;
     }
+    uint64_t position = stateToHeapPosition[state];
 
     // Compute the new priority.
     uint_fast64_t newPriority = penaltyFunction(state, transitionMatrix, backwardTransitions, oneStepProbabilities);
 
-    if (priorityQueueEntryIt->second->second != newPriority) {
-        // Erase and re-insert the entry into priority queue (with the new priority).
-        priorityQueue.erase(priorityQueueEntryIt->second);
-        stateToPriorityQueueEntry.erase(priorityQueueEntryIt);
-
-        auto newElementIt = priorityQueue.emplace(state, newPriority);
-        stateToPriorityQueueEntry.emplace(state, newElementIt.first);
+    uint_fast64_t oldPriority = heap[position].second;
+    if (oldPriority != newPriority) {
+        // Move the entry within the heap according to its new priority.
+        heap[position].second = newPriority;
+        if (newPriority < oldPriority) {
+            siftUp(position);
+        } else {
+            siftDown(position);
+        }
     }
 }
 
 template<typename ValueType>
 std::size_t DynamicStatePriorityQueue<ValueType>::size() const {
-    return priorityQueue.size();
+    return heap.size();
+}
+
+template<typename ValueType>
+void DynamicStatePriorityQueue<ValueType>::siftUp(uint64_t position) {
+    PriorityComparator comparator;
+    std::pair<storm::storage::sparse::state_type, uint_fast64_t> entry = heap[position];
+    while (position > 0) {
+        uint64_t parent = (position - 1) / 2;
+        if (!comparator(entry, heap[parent])) {
+            break;
+        }
+        placeEntry(position, heap[parent]);
+        position = parent;
+    }
+    placeEntry(position, entry);
+}
+
+template<typename ValueType>
+void DynamicStatePriorityQueue<ValueType>::siftDown(uint64_t position) {
+    PriorityComparator comparator;
+    std::pair<storm::storage::sparse::state_type, uint_fast64_t> entry = heap[position];
+    uint64_t size = heap.size();
+    while (2 * position + 1 < size) {
+        uint64_t child = 2 * position + 1;
+        if (child + 1 < size && comparator(heap[child + 1], heap[child])) {
+            ++child;
+        }
+        if (!comparator(heap[child], entry)) {
+            break;
+        }
+        placeEntry(position, heap[child]);
+        position = child;
+    }
+    placeEntry(position, entry);
+}
+
+template<typename ValueType>
+void DynamicStatePriorityQueue<ValueType>::placeEntry(uint64_t position, std::pair<storm::storage::sparse::state_type, uint_fast64_t> const& entry) {
+    if (position == heap.size()) {
+        heap.push_back(entry);
+    } else {
+        heap[position] = entry;
+    }
+    stateToHeapPosition[entry.first] = position;
 }
 
 template class DynamicStatePriorityQueue<double>;
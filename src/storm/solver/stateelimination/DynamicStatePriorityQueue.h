@@ -1,8 +1,7 @@
 #pragma once
 
 #include <functional>
-#include <set>
-#include <unordered_map>
+#include <limits>
 #include <vector>
 
 #include "storm/solver/stateelimination/StatePriorityQueue.h"
@@ -42,14 +41,24 @@ class DynamicStatePriorityQueue : public StatePriorityQueue {
     virtual std::size_t size() const override;
 
    private:
-    typedef std::set<std::pair<storm::storage::sparse::state_type, uint_fast64_t>, PriorityComparator> PriorityQueue;
-    typedef std::unordered_map<storm::storage::sparse::state_type, PriorityQueue::const_iterator> StatePriorityQueueEntryMap;
+    // Moves the entry at the given position of the heap towards the root or the leaves until the heap property is restored.
+    void siftUp(uint64_t position);
+    void siftDown(uint64_t position);
+
+    // Places the given entry at the given position of the heap and records the position for its state.
+    void placeEntry(uint64_t position, std::pair<storm::storage::sparse::state_type, uint_fast64_t> const& entry);
 
     storm::storage::FlexibleSparseMatrix<ValueType> const& transitionMatrix;
     storm::storage::FlexibleSparseMatrix<ValueType> const& backwardTransitions;
     std::vector<ValueType> const& oneStepProbabilities;
-    PriorityQueue priorityQueue;
-    StatePriorityQueueEntryMap stateToPriorityQueueEntry;
+
+    // A binary min-heap of state-penalty pairs (w.r.t. the PriorityComparator) that is updated in place, i.e., without allocations.
+    std::vector<std::pair<storm::storage::sparse::state_type, uint_fast64_t>> heap;
+
+    // For each state, the position of its entry in the heap (or noHeapPosition if it is not in the queue).
+    std::vector<uint64_t> stateToHeapPosition;
+    static constexpr uint64_t noHeapPosition = std::numeric_limits<uint64_t>::max();
+
     PenaltyFunctionType penaltyFunction;
 };
 
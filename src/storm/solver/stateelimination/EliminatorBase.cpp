@@ -1,5 +1,8 @@
 #include "storm/solver/stateelimination/EliminatorBase.h"
 
+#include <algorithm>
+#include <iterator>
+
 #include "storm/utility/constants.h"
 #include "storm/utility/macros.h"
 #include "storm/utility/stateelimination.h"
@@ -55,8 +58,7 @@ void EliminatorBase<ValueType, Mode>::eliminate(uint64_t row, uint64_t column, b
         if (hasEntryInColumn) {
             STORM_LOG_ASSERT(columnValue != storm::utility::one<ValueType>(),
                              "The scaling mode 'divide-one-minus' requires a non-one value in the given column.");
-            columnValue = storm::utility::one<ValueType>() / (storm::utility::one<ValueType>() - columnValue);
-            columnValue = storm::utility::simplify(columnValue);
+            columnValue = operationCache.inverseOfOneMinus(columnValue);
         }
     }
 
@@ -64,7 +66,7 @@ void EliminatorBase<ValueType, Mode>::eliminate(uint64_t row, uint64_t column, b
         for (auto entryIt = entriesInRow.begin(), entryIte = entriesInRow.end(); entryIt != entryIte; ++entryIt) {
             // Only scale the entries in a different column.
             if (entryIt->getColumn() != column) {
-                entryIt->setValue(storm::utility::simplify((ValueType)(entryIt->getValue() * columnValue)));
+                entryIt->setValue(operationCache.multiply(entryIt->getValue(), columnValue));
             }
         }
         updateValue(row, columnValue);
@@ -78,10 +80,13 @@ void EliminatorBase<ValueType, Mode>::eliminate(uint64_t row, uint64_t column, b
     FlexibleRowType rowsKeepingEntryInColumnEqualRow;
 
     // For each entry in the row d, we need to build a list of other rows that will contain an element in the
-    // column d.
-    std::vector<FlexibleRowType> newBackwardEntries(entriesInRow.size());
-    for (auto& backwardEntry : newBackwardEntries) {
-        backwardEntry.reserve(elementsWithEntryInColumnEqualRow.size());
+    // column d. The lists of previous eliminations are recycled to avoid reallocations.
+    if (newBackwardEntries.size() < entriesInRow.size()) {
+        newBackwardEntries.resize(entriesInRow.size());
+    }
+    for (uint_fast64_t index = 0; index < entriesInRow.size(); ++index) {
+        newBackwardEntries[index].clear();
+        newBackwardEntries[index].reserve(elementsWithEntryInColumnEqualRow.size());
     }
 
     // Now go through the rows with an entry in the column corresponding to the current row and substitute
@@ -106,13 +111,14 @@ void EliminatorBase<ValueType, Mode>::eliminate(uint64_t row, uint64_t column, b
 
         // First, find the probability with which the predecessor can move to the current state, because
         // the forward probabilities of the state to be eliminated need to be scaled with this factor.
+        // As rows are sorted by column, the entry can be found by a binary search.
         FlexibleRowType& predecessorForwardTransitions = matrix.getRow(predecessor);
-        FlexibleRowIterator multiplyElement = std::find_if(predecessorForwardTransitions.begin(), predecessorForwardTransitions.end(),
-                                                           [&](MatrixEntry const& a) { return a.getColumn() == column; });
+        FlexibleRowIterator multiplyElement = std::lower_bound(predecessorForwardTransitions.begin(), predecessorForwardTransitions.end(), column,
+                                                               [](MatrixEntry const& a, uint64_t col) { return a.getColumn() < col; });
 
         // Make sure we have found the probability and set it to zero.
-        STORM_LOG_THROW(multiplyElement != predecessorForwardTransitions.end(), storm::exceptions::InvalidStateException,
-                        "No probability for successor found.");
+        STORM_LOG_THROW(multiplyElement != predecessorForwardTransitions.end() && multiplyElement->getColumn() == column,
+                        storm::exceptions::InvalidStateException, "No probability for successor found.");
         ValueType multiplyFactor = multiplyElement->getValue();
         multiplyElement->setValue(storm::utility::zero<ValueType>());
 
@@ -122,9 +128,10 @@ void EliminatorBase<ValueType, Mode>::eliminate(uint64_t row, uint64_t column, b
         FlexibleRowIterator first2 = entriesInRow.begin();
         FlexibleRowIterator last2 = entriesInRow.end();
 
-        FlexibleRowType newSuccessors;
+        FlexibleRowType& newSuccessors = mergeBuffer;
+        newSuccessors.clear();
         newSuccessors.reserve((last1 - first1) + (last2 - first2));
-        std::insert_iterator<FlexibleRowType> result(newSuccessors, newSuccessors.end());
+        auto result = std::back_inserter(newSuccessors);
 
         uint_fast64_t successorOffsetInNewBackwardTransitions = 0;
         // Now we merge the two successor lists. (Code taken from std::set_union and modified to suit our needs).
@@ -145,7 +152,7 @@ void EliminatorBase<ValueType, Mode>::eliminate(uint64_t row, uint64_t column, b
                 break;
             }
             if (first2->getColumn() < first1->getColumn()) {
-                ValueType successorValue = storm::utility::simplify<ValueType>((first2->getValue() * multiplyFactor));
+                ValueType successorValue = operationCache.multiply(first2->getValue(), multiplyFactor);
                 *result = MatrixEntry(first2->getColumn(), successorValue);
                 newBackwardEntries[successorOffsetInNewBackwardTransitions].emplace_back(predecessor, successorValue);
                 ++first2;
@@ -154,9 +161,7 @@ void EliminatorBase<ValueType, Mode>::eliminate(uint64_t row, uint64_t column, b
                 *result = *first1;
                 ++first1;
             } else {
-                ValueType sprod = multiplyFactor * first2->getValue();
-                ValueType sum = first1->getValue() + storm::utility::simplify(sprod);
-                auto probability = storm::utility::simplify(sum);
+                ValueType probability = operationCache.add(first1->getValue(), operationCache.multiply(first2->getValue(), multiplyFactor));
                 *result = MatrixEntry(first1->getColumn(), probability);
                 newBackwardEntries[successorOffsetInNewBackwardTransitions].emplace_back(predecessor, probability);
                 ++first1;
@@ -166,15 +171,15 @@ void EliminatorBase<ValueType, Mode>::eliminate(uint64_t row, uint64_t column, b
         }
         for (; first2 != last2; ++first2) {
             if (first2->getColumn() != column) {
-                ValueType probability = storm::utility::simplify<ValueType>(first2->getValue() * multiplyFactor);
+                ValueType probability = operationCache.multiply(first2->getValue(), multiplyFactor);
                 *result = MatrixEntry(first2->getColumn(), probability);
                 newBackwardEntries[successorOffsetInNewBackwardTransitions].emplace_back(predecessor, probability);
                 ++successorOffsetInNewBackwardTransitions;
             }
         }
 
-        // Now move the new transitions in place.
-        predecessorForwardTransitions = std::move(newSuccessors);
+        // Now move the new transitions in place. The storage of the old transitions is kept for the next merge.
+        predecessorForwardTransitions.swap(newSuccessors);
         STORM_LOG_TRACE("Fixed new next-state probabilities of predecessor state " << predecessor << ".");
 
         updatePredecessor(predecessor, multiplyFactor, row);
@@ -195,9 +200,9 @@ void EliminatorBase<ValueType, Mode>::eliminate(uint64_t row, uint64_t column, b
         // Delete the current state as a predecessor of the successor state only if we are going to remove the
         // current state's forward transitions.
         if (clearRow) {
-            FlexibleRowIterator elimIt = std::find_if(successorBackwardTransitions.begin(), successorBackwardTransitions.end(),
-                                                      [&](MatrixEntry const& a) { return a.getColumn() == row; });
-            STORM_LOG_ASSERT(elimIt != successorBackwardTransitions.end(),
+            FlexibleRowIterator elimIt = std::lower_bound(successorBackwardTransitions.begin(), successorBackwardTransitions.end(), row,
+                                                          [](MatrixEntry const& a, uint64_t col) { return a.getColumn() < col; });
+            STORM_LOG_ASSERT(elimIt != successorBackwardTransitions.end() && elimIt->getColumn() == row,
                              "Expected a proper backward transition from " << successorEntry.getColumn() << " to " << column << ", but found none.");
             successorBackwardTransitions.erase(elimIt);
         }
@@ -207,9 +212,10 @@ void EliminatorBase<ValueType, Mode>::eliminate(uint64_t row, uint64_t column, b
         FlexibleRowIterator first2 = newBackwardEntries[successorOffsetInNewBackwardTransitions].begin();
         FlexibleRowIterator last2 = newBackwardEntries[successorOffsetInNewBackwardTransitions].end();
 
-        FlexibleRowType newPredecessors;
+        FlexibleRowType& newPredecessors = mergeBuffer;
+        newPredecessors.clear();
         newPredecessors.reserve((last1 - first1) + (last2 - first2));
-        std::insert_iterator<FlexibleRowType> result(newPredecessors, newPredecessors.end());
+        auto result = std::back_inserter(newPredecessors);
 
         for (; first1 != last1; ++result) {
             if (first2 == last2) {
@@ -239,8 +245,8 @@ void EliminatorBase<ValueType, Mode>::eliminate(uint64_t row, uint64_t column, b
         } else {
             std::copy_if(first2, last2, result, [&](MatrixEntry const& a) { return a.getColumn() != row; });
         }
-        // Now move the new predecessors in place.
-        successorBackwardTransitions = std::move(newPredecessors);
+        // Now move the new predecessors in place. The storage of the old predecessors is kept for the next merge.
+        successorBackwardTransitions.swap(newPredecessors);
         ++successorOffsetInNewBackwardTransitions;
     }
     STORM_LOG_TRACE("Fixed predecessor lists of successor states.");
@@ -284,8 +290,7 @@ void EliminatorBase<ValueType, Mode>::eliminateLoop(uint64_t state) {
         if (hasEntryInColumn) {
             STORM_LOG_ASSERT(columnValue != storm::utility::one<ValueType>(),
                              "The scaling mode 'divide-one-minus' requires a non-one value in the given column.");
-            columnValue = storm::utility::one<ValueType>() / (storm::utility::one<ValueType>() - columnValue);
-            columnValue = storm::utility::simplify(columnValue);
+            columnValue = operationCache.inverseOfOneMinus(columnValue);
         }
     }
 
@@ -293,7 +298,7 @@ void EliminatorBase<ValueType, Mode>::eliminateLoop(uint64_t state) {
         for (auto entryIt = entriesInRow.begin(), entryIte = entriesInRow.end(); entryIt != entryIte; ++entryIt) {
             // Scale the entries in a different column, set state transition probability to 0.
             if (entryIt->getColumn() != state) {
-                entryIt->setValue(storm::utility::simplify((ValueType)(entryIt->getValue() * columnValue)));
+                entryIt->setValue(operationCache.multiply(entryIt->getValue(), columnValue));
             } else {
                 entryIt->setValue(storm::utility::zero<ValueType>());
             }
@@ -2,6 +2,7 @@
 
 #include "storm/storage/sparse/StateType.h"
 
+#include "storm/solver/stateelimination/OperationCache.h"
 #include "storm/storage/FlexibleSparseMatrix.h"
 
 namespace storm {
@@ -34,6 +35,14 @@ class EliminatorBase {
    protected:
     storm::storage::FlexibleSparseMatrix<ValueType>& matrix;
     storm::storage::FlexibleSparseMatrix<ValueType>& transposedMatrix;
+
+    // Stores the results of the arithmetic operations of the elimination.
+    OperationCache<ValueType> operationCache;
+
+   private:
+    // Buffers that are reused across eliminations, such that merging rows does not allocate new rows each time.
+    FlexibleRowType mergeBuffer;
+    std::vector<FlexibleRowType> newBackwardEntries;
 };
 
 }  // namespace stateelimination
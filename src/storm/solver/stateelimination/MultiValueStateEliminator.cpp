@@ -25,9 +25,9 @@ MultiValueStateEliminator<ValueType>::MultiValueStateEliminator(storm::storage::
 
 template<typename ValueType>
 void MultiValueStateEliminator<ValueType>::updateValue(storm::storage::sparse::state_type const& state, ValueType const& loopProbability) {
-    this->stateValues[state] = storm::utility::simplify((ValueType)(loopProbability * this->stateValues[state]));
+    this->stateValues[state] = this->operationCache.multiply(loopProbability, this->stateValues[state]);
     for (auto additionalStateValueVectorRef : additionalStateValues) {
-        additionalStateValueVectorRef.get()[state] = storm::utility::simplify((ValueType)(loopProbability * additionalStateValueVectorRef.get()[state]));
+        additionalStateValueVectorRef.get()[state] = this->operationCache.multiply(loopProbability, additionalStateValueVectorRef.get()[state]);
     }
 }
 
@@ -35,11 +35,10 @@ template<typename ValueType>
 void MultiValueStateEliminator<ValueType>::updatePredecessor(storm::storage::sparse::state_type const& predecessor, ValueType const& probability,
                                                              storm::storage::sparse::state_type const& state) {
     this->stateValues[predecessor] =
-        storm::utility::simplify((ValueType)(this->stateValues[predecessor] + storm::utility::simplify((ValueType)(probability * this->stateValues[state]))));
+        this->operationCache.add(this->stateValues[predecessor], this->operationCache.multiply(probability, this->stateValues[state]));
     for (auto additionalStateValueVectorRef : additionalStateValues) {
-        additionalStateValueVectorRef.get()[predecessor] =
-            storm::utility::simplify((ValueType)(additionalStateValueVectorRef.get()[predecessor] +
-                                                 storm::utility::simplify((ValueType)(probability * additionalStateValueVectorRef.get()[state]))));
+        additionalStateValueVectorRef.get()[predecessor] = this->operationCache.add(
+            additionalStateValueVectorRef.get()[predecessor], this->operationCache.multiply(probability, additionalStateValueVectorRef.get()[state]));
     }
 }
 
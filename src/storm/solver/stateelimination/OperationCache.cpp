@@ -0,0 +1,108 @@
+#include "storm/solver/stateelimination/OperationCache.h"
+
+#include <type_traits>
+
+#include <boost/functional/hash.hpp>
+
+#include "storm/adapters/RationalFunctionAdapter.h"
+#include "storm/utility/constants.h"
+
+namespace storm {
+namespace solver {
+namespace stateelimination {
+
+template<typename ValueType>
+constexpr bool isCached() {
+#ifdef STORM_HAVE_CARL
+    return std::is_same<ValueType, storm::RationalFunction>::value;
+#else
+    return false;
+#endif
+}
+
+template<typename ValueType>
+OperationCache<ValueType>::OperationCache(uint64_t maximalSize) : maximalSize(maximalSize), numberOfHits(0), numberOfMisses(0) {
+    // Intentionally left empty.
+}
+
+template<typename ValueType>
+ValueType OperationCache<ValueType>::multiply(ValueType const& first, ValueType const& second) {
+    auto operation = [&first, &second]() { return storm::utility::simplify((ValueType)(first * second)); };
+    if constexpr (isCached<ValueType>()) {
+        return lookupOrCompute(products, std::make_pair(first, second), operation);
+    } else {
+        return operation();
+    }
+}
+
+template<typename ValueType>
+ValueType OperationCache<ValueType>::add(ValueType const& first, ValueType const& second) {
+    auto operation = [&first, &second]() { return storm::utility::simplify((ValueType)(first + second)); };
+    if constexpr (isCached<ValueType>()) {
+        return lookupOrCompute(sums, std::make_pair(first, second), operation);
+    } else {
+        return operation();
+    }
+}
+
+template<typename ValueType>
+ValueType OperationCache<ValueType>::inverseOfOneMinus(ValueType const& value) {
+    auto operation = [&value]() {
+        return storm::utility::simplify((ValueType)(storm::utility::one<ValueType>() / (storm::utility::one<ValueType>() - value)));
+    };
+    if constexpr (isCached<ValueType>()) {
+        return lookupOrCompute(inversesOfOneMinus, value, operation);
+    } else {
+        return operation();
+    }
+}
+
+template<typename ValueType>
+template<typename KeyType, typename MapType, typename OperationType>
+ValueType OperationCache<ValueType>::lookupOrCompute(MapType& results, KeyType const& key, OperationType const& operation) {
+    auto resultIt = results.find(key);
+    if (resultIt != results.end()) {
+        ++numberOfHits;
+        return resultIt->second;
+    }
+    ++numberOfMisses;
+    if (results.size() >= maximalSize) {
+        results.clear();
+    }
+    return results.emplace(key, operation()).first->second;
+}
+
+template<typename ValueType>
+void OperationCache<ValueType>::clear() {
+    products.clear();
+    sums.clear();
+    inversesOfOneMinus.clear();
+}
+
+template<typename ValueType>
+uint64_t OperationCache<ValueType>::getNumberOfHits() const {
+    return numberOfHits;
+}
+
+template<typename ValueType>
+uint64_t OperationCache<ValueType>::getNumberOfMisses() const {
+    return numberOfMisses;
+}
+
+template<typename ValueType>
+std::size_t OperationCache<ValueType>::PairHash::operator()(std::pair<ValueType, ValueType> const& key) const {
+    std::size_t seed = 0;
+    boost::hash_combine(seed, std::hash<ValueType>()(key.first));
+    boost::hash_combine(seed, std::hash<ValueType>()(key.second));
+    return seed;
+}
+
+template class OperationCache<double>;
+
+#ifdef STORM_HAVE_CARL
+template class OperationCache<storm::RationalNumber>;
+template class OperationCache<storm::RationalFunction>;
+#endif
+}  // namespace stateelimination
+}  // namespace solver
+}  // namespace storm
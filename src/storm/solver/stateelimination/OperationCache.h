@@ -0,0 +1,67 @@
+#pragma once
+
+#include <cstdint>
+#include <unordered_map>
+#include <utility>
+
+namespace storm {
+namespace solver {
+namespace stateelimination {
+
+/*!
+ * Stores the results of the arithmetic operations performed during state elimination.
+ * For rational functions, every operation normalizes its result, which requires expensive gcd computations. As the same
+ * functions typically occur at many transitions, the results are looked up before they are recomputed.
+ * For all other value types, the operations are performed directly.
+ */
+template<typename ValueType>
+class OperationCache {
+   public:
+    /*!
+     * Creates an empty cache.
+     * @param maximalSize The maximal number of results stored per operation. Once reached, the results of that operation are discarded.
+     */
+    OperationCache(uint64_t maximalSize = 100000);
+
+    /*!
+     * Computes the simplified product of the given values.
+     */
+    ValueType multiply(ValueType const& first, ValueType const& second);
+
+    /*!
+     * Computes the simplified sum of the given values.
+     */
+    ValueType add(ValueType const& first, ValueType const& second);
+
+    /*!
+     * Computes the simplified value of 1/(1-value).
+     */
+    ValueType inverseOfOneMinus(ValueType const& value);
+
+    /*!
+     * Discards all stored results.
+     */
+    void clear();
+
+    uint64_t getNumberOfHits() const;
+    uint64_t getNumberOfMisses() const;
+
+   private:
+    struct PairHash {
+        std::size_t operator()(std::pair<ValueType, ValueType> const& key) const;
+    };
+
+    template<typename KeyType, typename MapType, typename OperationType>
+    ValueType lookupOrCompute(MapType& results, KeyType const& key, OperationType const& operation);
+
+    uint64_t maximalSize;
+    std::unordered_map<std::pair<ValueType, ValueType>, ValueType, PairHash> products;
+    std::unordered_map<std::pair<ValueType, ValueType>, ValueType, PairHash> sums;
+    std::unordered_map<ValueType, ValueType> inversesOfOneMinus;
+    uint64_t numberOfHits;
+    uint64_t numberOfMisses;
+};
+
+}  // namespace stateelimination
+}  // namespace solver
+}  // namespace storm
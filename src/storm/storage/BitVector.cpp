@@ -1,4 +1,5 @@
 #include <algorithm>
+#include <atomic>
 #include <bitset>
 #include <iostream>
 
@@ -13,9 +14,262 @@
 #define ASSERT_BITVECTOR
 #endif
 
+#if defined(__x86_64__) && (defined(__GNUC__) || defined(__clang__))
+#define STORM_BITVECTOR_X86_KERNELS
+#include <immintrin.h>
+#endif
+
 namespace storm {
 namespace storage {
 
+namespace {
+// The bulk operations on the buckets of bit vectors. The vectorized kernels are selected at runtime, so that a single (portable) binary uses them
+// whenever the CPU supports them.
+enum class BucketOperation { And, Or, Xor, Not, Implies, AndNot, AndImplication };
+
+// The number of operands of the operations, where the result is op(a, b, c).
+template<BucketOperation Operation>
+constexpr uint64_t numberOfOperands() {
+    if constexpr (Operation == BucketOperation::Not) {
+        return 1;
+    } else if constexpr (Operation == BucketOperation::AndImplication) {
+        return 3;
+    } else {
+        return 2;
+    }
+}
+
+template<BucketOperation Operation>
+inline uint64_t applyToBucket(uint64_t a, uint64_t b, uint64_t c) {
+    switch (Operation) {
+        case BucketOperation::And:
+            return a & b;
+        case BucketOperation::Or:
+            return a | b;
+        case BucketOperation::Xor:
+            return a ^ b;
+        case BucketOperation::Not:
+            return ~a;
+        case BucketOperation::Implies:
+            return ~a | b;
+        case BucketOperation::AndNot:
+            return a & ~b;
+        case BucketOperation::AndImplication:
+            return a & (~b | c);
+    }
+    return 0;
+}
+
+template<BucketOperation Operation>
+void transformBucketsScalar(uint64_t* result, uint64_t const* a, uint64_t const* b, uint64_t const* c, uint64_t begin, uint64_t end) {
+    for (uint64_t i = begin; i < end; ++i) {
+        result[i] = applyToBucket<Operation>(a[i], numberOfOperands<Operation>() > 1 ? b[i] : 0, numberOfOperands<Operation>() > 2 ? c[i] : 0);
+    }
+}
+
+uint64_t popcountScalar(uint64_t const* buckets, uint64_t count) {
+    uint64_t result = 0;
+    for (uint64_t i = 0; i < count; ++i) {
+#if (defined(__GNUG__) || defined(__clang__))
+        result += __builtin_popcountll(buckets[i]);
+#else
+        uint64_t bitset = buckets[i];
+        for (; bitset; ++result) {
+            bitset &= bitset - 1;
+        }
+#endif
+    }
+    return result;
+}
+
+#ifdef STORM_BITVECTOR_X86_KERNELS
+template<BucketOperation Operation>
+__attribute__((target("avx2"))) void transformBucketsAvx2(uint64_t* result, uint64_t const* a, uint64_t const* b, uint64_t const* c, uint64_t count) {
+    __m256i const allOnes = _mm256_set1_epi64x(-1ll);
+    uint64_t i = 0;
+    for (; i + 4 <= count; i += 4) {
+        __m256i const va = _mm256_loadu_si256(reinterpret_cast<__m256i const*>(a + i));
+        __m256i vb = va, vc = va, vr;
+        if constexpr (numberOfOperands<Operation>() > 1) {
+            vb = _mm256_loadu_si256(reinterpret_cast<__m256i const*>(b + i));
+        }
+        if constexpr (numberOfOperands<Operation>() > 2) {
+            vc = _mm256_loadu_si256(reinterpret_cast<__m256i const*>(c + i));
+        }
+        if constexpr (Operation == BucketOperation::And) {
+            vr = _mm256_and_si256(va, vb);
+        } else if constexpr (Operation == BucketOperation::Or) {
+            vr = _mm256_or_si256(va, vb);
+        } else if constexpr (Operation == BucketOperation::Xor) {
+            vr = _mm256_xor_si256(va, vb);
+        } else if constexpr (Operation == BucketOperation::Not) {
+            vr = _mm256_xor_si256(va, allOnes);
+        } else if constexpr (Operation == BucketOperation::Implies) {
+            vr = _mm256_or_si256(_mm256_xor_si256(va, allOnes), vb);
+        } else if constexpr (Operation == BucketOperation::AndNot) {
+            vr = _mm256_andnot_si256(vb, va);
+        } else {
+            // a & ~(b & ~c)
+            vr = _mm256_andnot_si256(_mm256_andnot_si256(vc, vb), va);
+        }
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(result + i), vr);
+    }
+    transformBucketsScalar<Operation>(result, a, b, c, i, count);
+}
+
+// The truth tables of the operations as required by the ternary logic instruction, where a, b and c correspond to 0xF0, 0xCC and 0xAA, respectively.
+template<BucketOperation Operation>
+constexpr int ternaryLogicTable() {
+    switch (Operation) {
+        case BucketOperation::And:
+            return 0xC0;
+        case BucketOperation::Or:
+            return 0xFC;
+        case BucketOperation::Xor:
+            return 0x3C;
+        case BucketOperation::Not:
+            return 0x0F;
+        case BucketOperation::Implies:
+            return 0xCF;
+        case BucketOperation::AndNot:
+            return 0x30;
+        case BucketOperation::AndImplication:
+            return 0xB0;
+    }
+    return 0;
+}
+
+template<BucketOperation Operation>
+__attribute__((target("avx512f"))) void transformBucketsAvx512(uint64_t* result, uint64_t const* a, uint64_t const* b, uint64_t const* c, uint64_t count) {
+    uint64_t i = 0;
+    for (; i + 8 <= count; i += 8) {
+        __m512i const va = _mm512_loadu_si512(a + i);
+        __m512i vb = va, vc = va;
+        if constexpr (numberOfOperands<Operation>() > 1) {
+            vb = _mm512_loadu_si512(b + i);
+        }
+        if constexpr (numberOfOperands<Operation>() > 2) {
+            vc = _mm512_loadu_si512(c + i);
+        }
+        _mm512_storeu_si512(result + i, _mm512_ternarylogic_epi64(va, vb, vc, ternaryLogicTable<Operation>()));
+    }
+    transformBucketsScalar<Operation>(result, a, b, c, i, count);
+}
+
+__attribute__((target("popcnt"))) uint64_t popcountPopcnt(uint64_t const* buckets, uint64_t count) {
+    uint64_t result = 0;
+    for (uint64_t i = 0; i < count; ++i) {
+        result += __builtin_popcountll(buckets[i]);
+    }
+    return result;
+}
+
+__attribute__((target("avx2,popcnt"))) uint64_t popcountAvx2(uint64_t const* buckets, uint64_t count) {
+    // Count the bits of each nibble via a lookup table and sum the bytes of each 64-bit lane.
+    __m256i const lookup = _mm256_setr_epi8(0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4, 0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4);
+    __m256i const lowNibbleMask = _mm256_set1_epi8(0x0F);
+    __m256i sum = _mm256_setzero_si256();
+    uint64_t i = 0;
+    for (; i + 4 <= count; i += 4) {
+        __m256i const v = _mm256_loadu_si256(reinterpret_cast<__m256i const*>(buckets + i));
+        __m256i const lowCounts = _mm256_shuffle_epi8(lookup, _mm256_and_si256(v, lowNibbleMask));
+        __m256i const highCounts = _mm256_shuffle_epi8(lookup, _mm256_and_si256(_mm256_srli_epi16(v, 4), lowNibbleMask));
+        sum = _mm256_add_epi64(sum, _mm256_sad_epu8(_mm256_add_epi8(lowCounts, highCounts), _mm256_setzero_si256()));
+    }
+    uint64_t result = static_cast<uint64_t>(_mm256_extract_epi64(sum, 0)) + static_cast<uint64_t>(_mm256_extract_epi64(sum, 1)) +
+                      static_cast<uint64_t>(_mm256_extract_epi64(sum, 2)) + static_cast<uint64_t>(_mm256_extract_epi64(sum, 3));
+    for (; i < count; ++i) {
+        result += __builtin_popcountll(buckets[i]);
+    }
+    return result;
+}
+
+__attribute__((target("avx512f,avx512vpopcntdq,popcnt"))) uint64_t popcountAvx512(uint64_t const* buckets, uint64_t count) {
+    __m512i sum = _mm512_setzero_si512();
+    uint64_t i = 0;
+    for (; i + 8 <= count; i += 8) {
+        sum = _mm512_add_epi64(sum, _mm512_popcnt_epi64(_mm512_loadu_si512(buckets + i)));
+    }
+    uint64_t laneSums[8];
+    _mm512_storeu_si512(laneSums, sum);
+    uint64_t result = 0;
+    for (uint64_t lane = 0; lane < 8; ++lane) {
+        result += laneSums[lane];
+    }
+    for (; i < count; ++i) {
+        result += __builtin_popcountll(buckets[i]);
+    }
+    return result;
+}
+#endif
+
+enum class SimdLevel { None, Avx2, Avx512 };
+
+SimdLevel detectSimdLevel() {
+#ifdef STORM_BITVECTOR_X86_KERNELS
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx512f")) {
+        return SimdLevel::Avx512;
+    }
+    if (__builtin_cpu_supports("avx2")) {
+        return SimdLevel::Avx2;
+    }
+#endif
+    return SimdLevel::None;
+}
+
+SimdLevel getSimdLevel() {
+    // Detected on first use, as bit vectors may be used during static initialization.
+    static SimdLevel const simdLevel = detectSimdLevel();
+    return simdLevel;
+}
+
+// Below this number of buckets, the plain loops are used as the vectorized kernels do not pay off.
+uint64_t const minimalBucketCountForKernels = 16;
+
+template<BucketOperation Operation>
+void transformBuckets(uint64_t* result, uint64_t const* a, uint64_t const* b, uint64_t const* c, uint64_t count) {
+#ifdef STORM_BITVECTOR_X86_KERNELS
+    if (count >= minimalBucketCountForKernels) {
+        switch (getSimdLevel()) {
+            case SimdLevel::Avx512:
+                transformBucketsAvx512<Operation>(result, a, b, c, count);
+                return;
+            case SimdLevel::Avx2:
+                transformBucketsAvx2<Operation>(result, a, b, c, count);
+                return;
+            case SimdLevel::None:
+                break;
+        }
+    }
+#endif
+    transformBucketsScalar<Operation>(result, a, b, c, 0, count);
+}
+
+using PopcountKernel = uint64_t (*)(uint64_t const*, uint64_t);
+
+PopcountKernel selectPopcountKernel() {
+#ifdef STORM_BITVECTOR_X86_KERNELS
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx512vpopcntdq")) {
+        return &popcountAvx512;
+    }
+    if (__builtin_cpu_supports("avx2") && __builtin_cpu_supports("popcnt")) {
+        return &popcountAvx2;
+    }
+    if (__builtin_cpu_supports("popcnt")) {
+        return &popcountPopcnt;
+    }
+#endif
+    return &popcountScalar;
+}
+
+uint64_t popcountBuckets(uint64_t const* buckets, uint64_t count) {
+    static PopcountKernel const kernel = selectPopcountKernel();
+    return kernel(buckets, count);
+}
+}  // namespace
+
 BitVector::const_iterator::const_iterator(uint64_t const* dataPtr, uint_fast64_t startIndex, uint_fast64_t endIndex, bool setOnFirstBit)
     : dataPtr(dataPtr), endIndex(endIndex) {
     if (setOnFirstBit) {
@@ -241,6 +495,16 @@ void BitVector::set(uint_fast64_t index, bool value) {
     }
 }
 
+bool BitVector::setAtomic(uint_fast64_t index) {
+    STORM_LOG_ASSERT(index < bitCount, "Invalid call to BitVector::setAtomic: written index " << index << " out of bounds.");
+    uint64_t const mask = 1ull << (63 - (index & mod64mask));
+#if (defined(__GNUG__) || defined(__clang__))
+    return (__atomic_fetch_or(buckets + (index >> 6), mask, __ATOMIC_RELAXED) & mask) == 0;
+#else
+    return (reinterpret_cast<std::atomic<uint64_t>*>(buckets + (index >> 6))->fetch_or(mask, std::memory_order_relaxed) & mask) == 0;
+#endif
+}
+
 template<typename InputIterator>
 void BitVector::set(InputIterator begin, InputIterator end, bool value) {
     for (InputIterator it = begin; it != end; ++it) {
@@ -344,38 +608,33 @@ void BitVector::grow(uint_fast64_t minimumLength, bool init) {
 BitVector BitVector::operator&(BitVector const& other) const {
     STORM_LOG_ASSERT(bitCount == other.bitCount, "Length of the bit vectors does not match.");
     BitVector result(bitCount);
-    std::transform(this->buckets, this->buckets + this->bucketCount(), other.buckets, result.buckets,
-                   [](uint64_t const& a, uint64_t const& b) { return a & b; });
+    transformBuckets<BucketOperation::And>(result.buckets, this->buckets, other.buckets, nullptr, this->bucketCount());
     return result;
 }
 
 BitVector& BitVector::operator&=(BitVector const& other) {
     STORM_LOG_ASSERT(bitCount == other.bitCount, "Length of the bit vectors does not match.");
-    std::transform(this->buckets, this->buckets + this->bucketCount(), other.buckets, this->buckets,
-                   [](uint64_t const& a, uint64_t const& b) { return a & b; });
+    transformBuckets<BucketOperation::And>(this->buckets, this->buckets, other.buckets, nullptr, this->bucketCount());
     return *this;
 }
 
 BitVector BitVector::operator|(BitVector const& other) const {
     STORM_LOG_ASSERT(bitCount == other.bitCount, "Length of the bit vectors does not match.");
     BitVector result(bitCount);
-    std::transform(this->buckets, this->buckets + this->bucketCount(), other.buckets, result.buckets,
-                   [](uint64_t const& a, uint64_t const& b) { return a | b; });
+    transformBuckets<BucketOperation::Or>(result.buckets, this->buckets, other.buckets, nullptr, this->bucketCount());
     return result;
 }
 
 BitVector& BitVector::operator|=(BitVector const& other) {
     STORM_LOG_ASSERT(bitCount == other.bitCount, "Length of the bit vectors does not match.");
-    std::transform(this->buckets, this->buckets + this->bucketCount(), other.buckets, this->buckets,
-                   [](uint64_t const& a, uint64_t const& b) { return a | b; });
+    transformBuckets<BucketOperation::Or>(this->buckets, this->buckets, other.buckets, nullptr, this->bucketCount());
     return *this;
 }
 
 BitVector BitVector::operator^(BitVector const& other) const {
     STORM_LOG_ASSERT(bitCount == other.bitCount, "Length of the bit vectors does not match.");
     BitVector result(bitCount);
-    std::transform(this->buckets, this->buckets + this->bucketCount(), other.buckets, result.buckets,
-                   [](uint64_t const& a, uint64_t const& b) { return a ^ b; });
+    transformBuckets<BucketOperation::Xor>(result.buckets, this->buckets, other.buckets, nullptr, this->bucketCount());
     result.truncateLastBucket();
     return result;
 }
@@ -410,13 +669,13 @@ BitVector BitVector::operator%(BitVector const& filter) const {
 
 BitVector BitVector::operator~() const {
     BitVector result(this->bitCount);
-    std::transform(this->buckets, this->buckets + this->bucketCount(), result.buckets, [](uint64_t const& a) { return ~a; });
+    transformBuckets<BucketOperation::Not>(result.buckets, this->buckets, nullptr, nullptr, this->bucketCount());
     result.truncateLastBucket();
     return result;
 }
 
 void BitVector::complement() {
-    std::transform(this->buckets, this->buckets + this->bucketCount(), this->buckets, [](uint64_t const& a) { return ~a; });
+    transformBuckets<BucketOperation::Not>(this->buckets, this->buckets, nullptr, nullptr, this->bucketCount());
     truncateLastBucket();
 }
 
@@ -450,12 +709,23 @@ BitVector BitVector::implies(BitVector const& other) const {
     STORM_LOG_ASSERT(bitCount == other.bitCount, "Length of the bit vectors does not match.");
 
     BitVector result(bitCount);
-    std::transform(this->buckets, this->buckets + this->bucketCount(), other.buckets, result.buckets,
-                   [](uint64_t const& a, uint64_t const& b) { return (~a | b); });
+    transformBuckets<BucketOperation::Implies>(result.buckets, this->buckets, other.buckets, nullptr, this->bucketCount());
     result.truncateLastBucket();
     return result;
 }
 
+BitVector& BitVector::andNot(BitVector const& other) {
+    STORM_LOG_ASSERT(bitCount == other.bitCount, "Length of the bit vectors does not match.");
+    transformBuckets<BucketOperation::AndNot>(this->buckets, this->buckets, other.buckets, nullptr, this->bucketCount());
+    return *this;
+}
+
+BitVector& BitVector::andImplication(BitVector const& premise, BitVector const& conclusion) {
+    STORM_LOG_ASSERT(bitCount == premise.bitCount && bitCount == conclusion.bitCount, "Length of the bit vectors does not match.");
+    transformBuckets<BucketOperation::AndImplication>(this->buckets, this->buckets, premise.buckets, conclusion.buckets, this->bucketCount());
+    return *this;
+}
+
 bool BitVector::isSubsetOf(BitVector const& other) const {
     STORM_LOG_ASSERT(bitCount == other.bitCount, "Length of the bit vectors does not match.");
 
@@ -695,23 +965,7 @@ uint_fast64_t BitVector::getNumberOfSetBitsBeforeIndex(uint_fast64_t index) cons
 
     // First, count all full buckets.
     uint_fast64_t bucket = index >> 6;
-    for (uint_fast64_t i = 0; i < bucket; ++i) {
-        // Check if we are using g++ or clang++ and, if so, use the built-in function
-#if (defined(__GNUG__) || defined(__clang__))
-        result += __builtin_popcountll(buckets[i]);
-#elif defined WINDOWS
-#include <nmmintrin.h>
-        // If the target machine does not support SSE4, this will fail.
-        result += _mm_popcnt_u64(bucketVector[i]);
-#else
-        uint_fast32_t cnt;
-        uint_fast64_t bitset = buckets[i];
-        for (cnt = 0; bitset; cnt++) {
-            bitset &= bitset - 1;
-        }
-        result += cnt;
-#endif
-    }
+    result += popcountBuckets(buckets, bucket);
 
     // Now check if we have to count part of a bucket.
     uint64_t tmp = index & mod64mask;
@@ -739,13 +993,13 @@ std::vector<uint_fast64_t> BitVector::getNumberOfSetBitsBeforeIndices() const {
     bitsSetBeforeIndices.reserve(this->size());
     uint_fast64_t lastIndex = 0;
     uint_fast64_t currentNumberOfSetBits = 0;
-    for (auto index : *this) {
+    forEachSetIndex([&](uint64_t index) {
         while (lastIndex <= index) {
             bitsSetBeforeIndices.push_back(currentNumberOfSetBits);
             ++lastIndex;
         }
         ++currentNumberOfSetBits;
-    }
+    });
     return bitsSetBeforeIndices;
 }
 
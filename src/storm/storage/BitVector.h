@@ -11,6 +11,9 @@
 namespace storm {
 namespace storage {
 
+template<typename ValueType, typename Hash>
+class BitVectorHashMap;
+
 /*!
  * A bit vector that is internally represented as a vector of 64-bit values.
  */
@@ -281,6 +284,15 @@ class BitVector {
      */
     void set(uint_fast64_t index, bool value = true);
 
+    /*!
+     * Atomically sets the bit at the given index. This may be called concurrently for the same bit vector (also for bits in the same bucket),
+     * but must not be interleaved with other modifications.
+     *
+     * @param index The index of the bit to set.
+     * @return True iff the bit was not set before, i.e., this call has set it.
+     */
+    bool setAtomic(uint_fast64_t index);
+
     /*!
      * Sets all bits in the given iterator range [first, last).
      *
@@ -431,6 +443,25 @@ class BitVector {
      */
     BitVector implies(BitVector const& other) const;
 
+    /*!
+     * Performs a logical "and" with the complement of the given bit vector and assigns the result to the current bit vector,
+     * i.e., this &= ~other, without creating a temporary bit vector.
+     *
+     * @param other A reference to the bit vector whose complement to use for the operation.
+     * @return A reference to the current bit vector.
+     */
+    BitVector& andNot(BitVector const& other);
+
+    /*!
+     * Performs a logical "and" with the implication of the two given bit vectors and assigns the result to the current
+     * bit vector, i.e., this &= (~premise | conclusion), without creating temporary bit vectors.
+     *
+     * @param premise A reference to the bit vector that serves as the premise of the implication.
+     * @param conclusion A reference to the bit vector that serves as the conclusion of the implication.
+     * @return A reference to the current bit vector.
+     */
+    BitVector& andImplication(BitVector const& premise, BitVector const& conclusion);
+
     /*!
      * Checks whether all bits that are set in the current bit vector are also set in the given bit vector.
      *
@@ -567,6 +598,37 @@ class BitVector {
      */
     std::vector<uint_fast64_t> getNumberOfSetBitsBeforeIndices() const;
 
+    /*!
+     * Invokes the given function for the indices of all set bits from smallest to largest. This is faster than iterating
+     * over the set bits via const_iterator, as all set bits of a bucket are decoded at once.
+     *
+     * @param function The function to invoke with the index of each set bit.
+     */
+    template<typename FunctionType>
+    void forEachSetIndex(FunctionType&& function) const {
+        uint64_t const* bucketIt = buckets;
+        for (uint64_t offset = 0; offset < bitCount; offset += 64, ++bucketIt) {
+            uint64_t bucket = *bucketIt;
+            if (bitCount - offset < 64) {
+                // Ignore the bits of the last bucket that are beyond the size of the bit vector.
+                bucket &= ~(-1ull >> (bitCount - offset));
+            }
+            while (bucket != 0) {
+                // Index 0 of a bucket is its most significant bit.
+#if (defined(__GNUG__) || defined(__clang__))
+                uint64_t const indexInBucket = __builtin_clzll(bucket);
+#else
+                uint64_t indexInBucket = 0;
+                while ((bucket & (1ull << (63 - indexInBucket))) == 0) {
+                    ++indexInBucket;
+                }
+#endif
+                bucket &= ~(1ull << (63 - indexInBucket));
+                function(offset + indexInBucket);
+            }
+        }
+    }
+
     /*!
      * Retrieves the number of bits this bit vector can store.
      *
@@ -681,6 +743,10 @@ class BitVector {
     template<typename StateType>
     friend struct Murmur3BitVectorHash;
 
+    // The hash map stores its keys as plain 64-bit words.
+    template<typename ValueType, typename Hash>
+    friend class BitVectorHashMap;
+
    private:
     /*!
      * Creates an empty bit vector with the given number of buckets.
@@ -42,7 +42,8 @@ std::pair<storm::storage::BitVector, ValueType> BitVectorHashMap<ValueType, Hash
 }
 
 template<class ValueType, class Hash>
-BitVectorHashMap<ValueType, Hash>::BitVectorHashMap(uint64_t bucketSize, uint64_t initialSize, double loadFactor)
+BitVectorHashMap<ValueType, Hash>::BitVectorHashMap(uint64_t bucketSize, uint64_t initialSize, double loadFactor,
+                                                    boost::optional<std::string> const& storageDirectory)
     : loadFactor(loadFactor), bucketSize(bucketSize), currentSize(1), numberOfElements(0) {
     STORM_LOG_ASSERT(bucketSize % 64 == 0, "Bucket size must be a multiple of 64.");
 
@@ -52,7 +53,7 @@ BitVectorHashMap<ValueType, Hash>::BitVectorHashMap(uint64_t bucketSize, uint64_
     }
 
     // Create the underlying containers.
-    buckets = storm::storage::BitVector(bucketSize * (1ull << currentSize));
+    buckets = storm::storage::WordBuffer((bucketSize >> 6) * (1ull << currentSize), storageDirectory);
     occupied = storm::storage::BitVector(1ull << currentSize);
     values = std::vector<ValueType>(1ull << currentSize);
 }
@@ -72,13 +73,22 @@ uint64_t BitVectorHashMap<ValueType, Hash>::capacity() const {
     return 1ull << currentSize;
 }
 
+template<class ValueType, class Hash>
+uint64_t BitVectorHashMap<ValueType, Hash>::getSizeInMemory() const {
+    uint64_t result = sizeof(*this) + occupied.getSizeInBytes() + sizeof(ValueType) * values.capacity();
+    if (!buckets.isFileBacked()) {
+        result += sizeof(uint64_t) * buckets.size();
+    }
+    return result;
+}
+
 template<class ValueType, class Hash>
 void BitVectorHashMap<ValueType, Hash>::increaseSize() {
     ++currentSize;
     STORM_LOG_TRACE("Increasing size of hash map from " << (1ull << (currentSize - 1)) << " to " << (1ull << currentSize) << ".");
 
     // Create new containers and swap them with the old ones.
-    storm::storage::BitVector oldBuckets(bucketSize * (1ull << currentSize));
+    storm::storage::WordBuffer oldBuckets((bucketSize >> 6) * (1ull << currentSize), buckets.getDirectory());
     std::swap(oldBuckets, buckets);
     storm::storage::BitVector oldOccupied = storm::storage::BitVector(1ull << currentSize);
     std::swap(oldOccupied, occupied);
@@ -89,7 +99,10 @@ void BitVectorHashMap<ValueType, Hash>::increaseSize() {
     uint64_t oldSize = numberOfElements;
     numberOfElements = 0;
     for (auto bucketIndex : oldOccupied) {
-        findOrAddAndGetBucket(oldBuckets.get(bucketIndex * bucketSize, bucketSize), oldValues[bucketIndex]);
+        // Rehashing requires the key as bit vector.
+        storm::storage::BitVector key(bucketSize >> 6, bucketSize);
+        std::copy(oldBuckets.data() + bucketIndex * (bucketSize >> 6), oldBuckets.data() + (bucketIndex + 1) * (bucketSize >> 6), key.buckets);
+        findOrAddAndGetBucket(key, oldValues[bucketIndex]);
     }
     STORM_LOG_ASSERT(oldSize == numberOfElements, "Size mismatch in rehashing. Size before was " << oldSize << " and new size is " << numberOfElements << ".");
 }
@@ -108,7 +121,7 @@ std::pair<ValueType, uint64_t> BitVectorHashMap<ValueType, Hash>::findOrAddAndGe
         return std::make_pair(values[flagAndBucket.second], flagAndBucket.second);
     } else {
         // Insert the new bits into the bucket.
-        buckets.set(flagAndBucket.second * bucketSize, key);
+        std::copy(key.buckets, key.buckets + (bucketSize >> 6), buckets.data() + flagAndBucket.second * (bucketSize >> 6));
         occupied.set(flagAndBucket.second);
         values[flagAndBucket.second] = value;
         ++numberOfElements;
@@ -164,7 +177,7 @@ std::pair<bool, uint64_t> BitVectorHashMap<ValueType, Hash>::findBucket(storm::s
     uint64_t bucket = hasher(key) >> this->getCurrentShiftWidth();
 
     while (isBucketOccupied(bucket)) {
-        if (buckets.matches(bucket * bucketSize, key)) {
+        if (std::equal(key.buckets, key.buckets + (bucketSize >> 6), buckets.data() + bucket * (bucketSize >> 6))) {
             return std::make_pair(true, bucket);
         }
         ++bucket;
@@ -178,7 +191,9 @@ std::pair<bool, uint64_t> BitVectorHashMap<ValueType, Hash>::findBucket(storm::s
 
 template<class ValueType, class Hash>
 std::pair<storm::storage::BitVector, ValueType> BitVectorHashMap<ValueType, Hash>::getBucketAndValue(uint64_t bucket) const {
-    return std::make_pair(buckets.get(bucket * bucketSize, bucketSize), values[bucket]);
+    storm::storage::BitVector key(bucketSize >> 6, bucketSize);
+    std::copy(buckets.data() + bucket * (bucketSize >> 6), buckets.data() + (bucket + 1) * (bucketSize >> 6), key.buckets);
+    return std::make_pair(std::move(key), values[bucket]);
 }
 
 template<class ValueType, class Hash>
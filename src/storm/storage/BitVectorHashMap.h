@@ -4,7 +4,10 @@
 #include <cstdint>
 #include <functional>
 
+#include <boost/optional.hpp>
+
 #include "storm/storage/BitVector.h"
+#include "storm/storage/WordBuffer.h"
 
 namespace storm {
 namespace storage {
@@ -56,8 +59,10 @@ class BitVectorHashMap {
      * @param initialSize The number of buckets that is initially available.
      * @param loadFactor The load factor that determines at which point the size of the underlying storage is
      * increased.
+     * @param storageDirectory If given, the keys are stored in memory-mapped temporary files within this directory instead of main memory.
      */
-    BitVectorHashMap(uint64_t bucketSize = 64, uint64_t initialSize = 1000, double loadFactor = 0.75);
+    BitVectorHashMap(uint64_t bucketSize = 64, uint64_t initialSize = 1000, double loadFactor = 0.75,
+                     boost::optional<std::string> const& storageDirectory = boost::none);
 
     BitVectorHashMap(BitVectorHashMap const&) = default;
     BitVectorHashMap(BitVectorHashMap&&) = default;
@@ -145,6 +150,12 @@ class BitVectorHashMap {
      */
     uint64_t capacity() const;
 
+    /*!
+     * Returns (an approximation of) the number of bytes occupied by this map in main memory. Buckets that are kept in a memory-mapped file are
+     * not counted.
+     */
+    uint64_t getSizeInMemory() const;
+
     /*!
      * Performs a remapping of all values stored by applying the given remapping.
      *
@@ -206,8 +217,8 @@ class BitVectorHashMap {
     // The number of buckets is 2^currentSize.
     uint64_t currentSize;
 
-    // The buckets that hold the elements of the map.
-    storm::storage::BitVector buckets;
+    // The buckets that hold the elements of the map. Each bucket consists of bucketSize / 64 words.
+    storm::storage::WordBuffer buckets;
 
     // A bit vector that stores which buckets actually hold a value.
     storm::storage::BitVector occupied;
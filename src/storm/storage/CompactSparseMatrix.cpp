@@ -0,0 +1,222 @@
+#include "storm/storage/CompactSparseMatrix.h"
+
+#include <limits>
+#include <unordered_map>
+
+#include "storm/storage/SparseMatrix.h"
+#include "storm/utility/constants.h"
+#include "storm/utility/macros.h"
+
+#include "storm/exceptions/InvalidArgumentException.h"
+
+namespace storm {
+namespace storage {
+
+template<typename ValueType>
+CompactSparseMatrix<ValueType>::CompactSparseMatrix(storm::storage::SparseMatrix<ValueType> const& matrix, bool useValueDictionary)
+    : columnCount(matrix.getColumnCount()) {
+    STORM_LOG_THROW(matrix.getColumnCount() <= std::numeric_limits<index_type>::max(), storm::exceptions::InvalidArgumentException,
+                    "The matrix has too many columns for a compact representation.");
+    uint64_t const numRows = matrix.getRowCount();
+    uint64_t const numEntries = matrix.getEntryCount();
+    rowIndications.reserve(numRows + 1);
+    columns.reserve(numEntries);
+
+    // First try to find a value dictionary. We give up as soon as there are too many distinct values.
+    std::unordered_map<ValueType, uint16_t> valueToIndex;
+    if (useValueDictionary) {
+        valueIndices.reserve(numEntries);
+        for (auto const& entry : matrix) {
+            auto findRes = valueToIndex.try_emplace(entry.getValue(), valueDictionary.size());
+            if (findRes.second) {
+                if (valueDictionary.size() > std::numeric_limits<uint16_t>::max()) {
+                    valueDictionary.clear();
+                    valueIndices.clear();
+                    valueIndices.shrink_to_fit();
+                    break;
+                }
+                valueDictionary.push_back(entry.getValue());
+            }
+            valueIndices.push_back(findRes.first->second);
+        }
+    }
+    if (valueDictionary.empty()) {
+        values.reserve(numEntries);
+    }
+
+    for (uint64_t row = 0; row < numRows; ++row) {
+        rowIndications.push_back(columns.size());
+        for (auto const& entry : matrix.getRow(row)) {
+            columns.push_back(static_cast<index_type>(entry.getColumn()));
+            if (valueDictionary.empty()) {
+                values.push_back(entry.getValue());
+            }
+        }
+    }
+    rowIndications.push_back(columns.size());
+
+    if (!matrix.hasTrivialRowGrouping()) {
+        rowGroupIndices = matrix.getRowGroupIndices();
+    }
+    STORM_LOG_INFO("Compact matrix representation takes " << getSizeInMemory() << " bytes" << (hasValueDictionary() ? " using a value dictionary" : "") << ".");
+}
+
+template<typename ValueType>
+uint64_t CompactSparseMatrix<ValueType>::getRowCount() const {
+    return rowIndications.size() - 1;
+}
+
+template<typename ValueType>
+uint64_t CompactSparseMatrix<ValueType>::getColumnCount() const {
+    return columnCount;
+}
+
+template<typename ValueType>
+uint64_t CompactSparseMatrix<ValueType>::getEntryCount() const {
+    return columns.size();
+}
+
+template<typename ValueType>
+uint64_t CompactSparseMatrix<ValueType>::getRowGroupCount() const {
+    return hasTrivialRowGrouping() ? getRowCount() : rowGroupIndices.size() - 1;
+}
+
+template<typename ValueType>
+std::vector<uint64_t> const& CompactSparseMatrix<ValueType>::getRowGroupIndices() const {
+    if (hasTrivialRowGrouping()) {
+        if (trivialRowGroupIndices.size() != getRowCount() + 1) {
+            trivialRowGroupIndices.resize(getRowCount() + 1);
+            for (uint64_t i = 0; i < trivialRowGroupIndices.size(); ++i) {
+                trivialRowGroupIndices[i] = i;
+            }
+        }
+        return trivialRowGroupIndices;
+    }
+    return rowGroupIndices;
+}
+
+template<typename ValueType>
+bool CompactSparseMatrix<ValueType>::hasTrivialRowGrouping() const {
+    return rowGroupIndices.empty();
+}
+
+template<typename ValueType>
+bool CompactSparseMatrix<ValueType>::hasValueDictionary() const {
+    return !valueDictionary.empty();
+}
+
+template<typename ValueType>
+uint64_t CompactSparseMatrix<ValueType>::getSizeInMemory() const {
+    return sizeof(*this) + sizeof(uint64_t) * (rowIndications.size() + rowGroupIndices.size() + trivialRowGroupIndices.size()) +
+           sizeof(index_type) * columns.size() + sizeof(ValueType) * (values.size() + valueDictionary.size()) + sizeof(uint16_t) * valueIndices.size();
+}
+
+template<typename ValueType>
+ValueType CompactSparseMatrix<ValueType>::multiplyRowWithVector(uint64_t row, std::vector<ValueType> const& vector) const {
+    ValueType result = storm::utility::zero<ValueType>();
+    forEachEntry(row, [&result, &vector](index_type column, ValueType const& value) { result += value * vector[column]; });
+    return result;
+}
+
+template<typename ValueType>
+void CompactSparseMatrix<ValueType>::multiplyWithVector(std::vector<ValueType> const& vector, std::vector<ValueType>& result,
+                                                        std::vector<ValueType> const* summand) const {
+    STORM_LOG_ASSERT(&vector != &result, "Input and output vector must not be the same object.");
+    uint64_t const numRows = getRowCount();
+    for (uint64_t row = 0; row < numRows; ++row) {
+        result[row] = multiplyRowWithVector(row, vector);
+        if (summand) {
+            result[row] += (*summand)[row];
+        }
+    }
+}
+
+template<typename ValueType>
+void CompactSparseMatrix<ValueType>::multiplyWithVectorGaussSeidel(std::vector<ValueType>& x, std::vector<ValueType> const* summand, bool backwards) const {
+    uint64_t const numRows = getRowCount();
+    for (uint64_t i = 0; i < numRows; ++i) {
+        uint64_t const row = backwards ? numRows - 1 - i : i;
+        ValueType newValue = multiplyRowWithVector(row, x);
+        if (summand) {
+            newValue += (*summand)[row];
+        }
+        x[row] = std::move(newValue);
+    }
+}
+
+template<typename ValueType>
+void CompactSparseMatrix<ValueType>::multiplyAndReduce(storm::solver::OptimizationDirection const& dir, std::vector<uint64_t> const& rowGroupIndices,
+                                                       std::vector<ValueType> const& vector, std::vector<ValueType> const* summand,
+                                                       std::vector<ValueType>& result, std::vector<uint64_t>* choices) const {
+    STORM_LOG_ASSERT(&vector != &result, "Input and output vector must not be the same object.");
+    if (dir == storm::OptimizationDirection::Minimize) {
+        multiplyAndReduce<storm::utility::ElementLess<ValueType>, false>(rowGroupIndices, vector, summand, result, choices, false);
+    } else {
+        multiplyAndReduce<storm::utility::ElementGreater<ValueType>, false>(rowGroupIndices, vector, summand, result, choices, false);
+    }
+}
+
+template<typename ValueType>
+void CompactSparseMatrix<ValueType>::multiplyAndReduceGaussSeidel(storm::solver::OptimizationDirection const& dir, std::vector<uint64_t> const& rowGroupIndices,
+                                                                  std::vector<ValueType>& x, std::vector<ValueType> const* summand,
+                                                                  std::vector<uint64_t>* choices, bool backwards) const {
+    if (dir == storm::OptimizationDirection::Minimize) {
+        multiplyAndReduce<storm::utility::ElementLess<ValueType>, true>(rowGroupIndices, x, summand, x, choices, backwards);
+    } else {
+        multiplyAndReduce<storm::utility::ElementGreater<ValueType>, true>(rowGroupIndices, x, summand, x, choices, backwards);
+    }
+}
+
+template<typename ValueType>
+template<typename Compare, bool GaussSeidel>
+void CompactSparseMatrix<ValueType>::multiplyAndReduce(std::vector<uint64_t> const& rowGroupIndices, std::vector<ValueType> const& vector,
+                                                       std::vector<ValueType> const* summand, std::vector<ValueType>& result, std::vector<uint64_t>* choices,
+                                                       bool backwards) const {
+    Compare compare;
+    auto multiplyRow = [this, &vector, summand](uint64_t row) {
+        ValueType value = multiplyRowWithVector(row, vector);
+        if (summand) {
+            value += (*summand)[row];
+        }
+        return value;
+    };
+    uint64_t const numGroups = rowGroupIndices.size() - 1;
+    for (uint64_t i = 0; i < numGroups; ++i) {
+        uint64_t const group = (GaussSeidel && backwards) ? numGroups - 1 - i : i;
+        uint64_t const groupStart = rowGroupIndices[group];
+        uint64_t const groupEnd = rowGroupIndices[group + 1];
+        // Only multiply and reduce if there is at least one row in the group.
+        if (groupStart == groupEnd) {
+            continue;
+        }
+        ValueType currentValue = multiplyRow(groupStart);
+
+        // Variables for correctly tracking choices (only update if new choice is strictly better).
+        ValueType oldSelectedChoiceValue;
+        uint64_t selectedChoice = 0;
+        if (choices && (*choices)[group] == 0) {
+            oldSelectedChoiceValue = currentValue;
+        }
+
+        for (uint64_t row = groupStart + 1; row < groupEnd; ++row) {
+            ValueType newValue = multiplyRow(row);
+            if (choices && row == (*choices)[group] + groupStart) {
+                oldSelectedChoiceValue = newValue;
+            }
+            if (compare(newValue, currentValue)) {
+                currentValue = std::move(newValue);
+                selectedChoice = row - groupStart;
+            }
+        }
+
+        if (choices && compare(currentValue, oldSelectedChoiceValue)) {
+            (*choices)[group] = selectedChoice;
+        }
+        result[group] = std::move(currentValue);
+    }
+}
+
+template class CompactSparseMatrix<double>;
+
+}  // namespace storage
+}  // namespace storm
@@ -0,0 +1,130 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include "storm/solver/OptimizationDirection.h"
+
+namespace storm {
+namespace storage {
+
+template<typename T>
+class SparseMatrix;
+
+/*!
+ * A read-only representation of a sparse matrix that is tailored for repeated matrix-vector multiplications.
+ * Compared to the SparseMatrix (which stores 64 bit column indices along with each value), this class
+ * * stores 32 bit column indices and
+ * * if the matrix has few distinct values, stores a 16 bit index into a dictionary of the distinct values instead of the value itself.
+ * For double matrices with few distinct values, an entry thus takes 6 instead of 16 bytes, which reduces the memory traffic of multiplications considerably.
+ */
+template<typename ValueType>
+class CompactSparseMatrix {
+   public:
+    typedef uint32_t index_type;
+    typedef ValueType value_type;
+
+    /*!
+     * Constructs a compact matrix with the same entries and row grouping as the given matrix.
+     * @param matrix the matrix. Must have less than 2^32 columns.
+     * @param useValueDictionary if true, a value dictionary is used whenever the matrix has at most 2^16 distinct values.
+     */
+    explicit CompactSparseMatrix(storm::storage::SparseMatrix<ValueType> const& matrix, bool useValueDictionary = true);
+
+    uint64_t getRowCount() const;
+    uint64_t getColumnCount() const;
+    uint64_t getEntryCount() const;
+    uint64_t getRowGroupCount() const;
+    std::vector<uint64_t> const& getRowGroupIndices() const;
+    bool hasTrivialRowGrouping() const;
+
+    /*!
+     * @return true iff the values are stored in a value dictionary
+     */
+    bool hasValueDictionary() const;
+
+    /*!
+     * @return the number of bytes occupied by this matrix (approximately)
+     */
+    uint64_t getSizeInMemory() const;
+
+    /*!
+     * Invokes the given function for each entry of the given row (in ascending order of the columns).
+     * @param function invoked with the column and the value of each entry
+     */
+    template<typename FunctionType>
+    void forEachEntry(uint64_t row, FunctionType&& function) const {
+        uint64_t const rowEnd = rowIndications[row + 1];
+        if (valueDictionary.empty()) {
+            for (uint64_t entry = rowIndications[row]; entry < rowEnd; ++entry) {
+                function(columns[entry], values[entry]);
+            }
+        } else {
+            for (uint64_t entry = rowIndications[row]; entry < rowEnd; ++entry) {
+                function(columns[entry], valueDictionary[valueIndices[entry]]);
+            }
+        }
+    }
+
+    /*!
+     * Computes the scalar product of the given row and the given vector.
+     */
+    ValueType multiplyRowWithVector(uint64_t row, std::vector<ValueType> const& vector) const;
+
+    /*!
+     * Computes result = A * vector + summand. The vector and the result must not be the same object.
+     */
+    void multiplyWithVector(std::vector<ValueType> const& vector, std::vector<ValueType>& result, std::vector<ValueType> const* summand = nullptr) const;
+
+    /*!
+     * Performs the multiplication x = A * x + summand in Gauss-Seidel style, i.e., uses updated values as soon as they are available.
+     * @param backwards if true, the rows are processed starting with the last row
+     */
+    void multiplyWithVectorGaussSeidel(std::vector<ValueType>& x, std::vector<ValueType> const* summand, bool backwards) const;
+
+    /*!
+     * Computes A * vector + summand and reduces the result over the given row groups. Follows the semantic of SparseMatrix::multiplyAndReduce.
+     * The vector and the result must not be the same object.
+     */
+    void multiplyAndReduce(storm::solver::OptimizationDirection const& dir, std::vector<uint64_t> const& rowGroupIndices, std::vector<ValueType> const& vector,
+                           std::vector<ValueType> const* summand, std::vector<ValueType>& result, std::vector<uint64_t>* choices) const;
+
+    /*!
+     * Same as multiplyAndReduce but performed in place and in Gauss-Seidel style.
+     * @param backwards if true, the row groups are processed starting with the last row group
+     */
+    void multiplyAndReduceGaussSeidel(storm::solver::OptimizationDirection const& dir, std::vector<uint64_t> const& rowGroupIndices, std::vector<ValueType>& x,
+                                      std::vector<ValueType> const* summand, std::vector<uint64_t>* choices, bool backwards) const;
+
+   private:
+    template<typename Compare, bool GaussSeidel>
+    void multiplyAndReduce(std::vector<uint64_t> const& rowGroupIndices, std::vector<ValueType> const& vector, std::vector<ValueType> const* summand,
+                           std::vector<ValueType>& result, std::vector<uint64_t>* choices, bool backwards) const;
+
+    // The number of columns of this matrix
+    uint64_t columnCount;
+
+    // For each row the position of its first entry. The last entry is the number of entries.
+    std::vector<uint64_t> rowIndications;
+
+    // The column of each entry
+    std::vector<index_type> columns;
+
+    // The value of each entry. Empty if a value dictionary is used.
+    std::vector<ValueType> values;
+
+    // The distinct values of the matrix. Empty if no value dictionary is used.
+    std::vector<ValueType> valueDictionary;
+
+    // For each entry the position of its value in the value dictionary. Empty if no value dictionary is used.
+    std::vector<uint16_t> valueIndices;
+
+    // The row groups of this matrix. Empty if the row grouping is trivial.
+    std::vector<uint64_t> rowGroupIndices;
+
+    // The row groups for a trivial row grouping, only computed on demand.
+    mutable std::vector<uint64_t> trivialRowGroupIndices;
+};
+
+}  // namespace storage
+}  // namespace storm
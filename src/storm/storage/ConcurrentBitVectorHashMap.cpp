@@ -0,0 +1,239 @@
+#include "storm/storage/ConcurrentBitVectorHashMap.h"
+
+#include <mutex>
+#include <thread>
+
+#include "storm/utility/macros.h"
+
+namespace storm {
+namespace storage {
+
+// The smallest size exponent of a segment.
+static uint64_t const MinimalSegmentSizeExponent = 4;
+
+template<typename ValueType, typename Hash>
+ConcurrentBitVectorHashMap<ValueType, Hash>::Segment::Segment(uint64_t sizeExponent, uint64_t wordsPerKey)
+    : sizeExponent(sizeExponent),
+      states(1ull << sizeExponent),
+      keys((1ull << sizeExponent) * wordsPerKey),
+      values(1ull << sizeExponent),
+      numberOfElements(0) {
+    // Intentionally left empty.
+}
+
+template<typename ValueType, typename Hash>
+ConcurrentBitVectorHashMap<ValueType, Hash>::ConcurrentBitVectorHashMap(uint64_t bucketSize, uint64_t initialSize, double loadFactor,
+                                                                        uint64_t numberOfSegments)
+    : loadFactor(loadFactor), bucketSize(bucketSize), wordsPerKey(bucketSize / 64), segmentBits(0) {
+    STORM_LOG_ASSERT(bucketSize % 64 == 0, "Bucket size must be a multiple of 64.");
+    STORM_LOG_ASSERT(loadFactor > 0.0 && loadFactor < 1.0, "Load factor must be in (0,1).");
+    while ((1ull << segmentBits) < numberOfSegments) {
+        ++segmentBits;
+    }
+    uint64_t segmentSizeExponent = MinimalSegmentSizeExponent;
+    while ((1ull << (segmentSizeExponent + segmentBits)) < initialSize) {
+        ++segmentSizeExponent;
+    }
+    for (uint64_t segment = 0; segment < (1ull << segmentBits); ++segment) {
+        segments.push_back(std::make_unique<Segment>(segmentSizeExponent, wordsPerKey));
+    }
+}
+
+template<typename ValueType, typename Hash>
+typename ConcurrentBitVectorHashMap<ValueType, Hash>::Segment& ConcurrentBitVectorHashMap<ValueType, Hash>::getSegment(uint64_t hash) const {
+    // The lower bits select the segment, the upper bits select the bucket within the segment.
+    return *segments[hash & ((1ull << segmentBits) - 1)];
+}
+
+template<typename ValueType, typename Hash>
+uint64_t ConcurrentBitVectorHashMap<ValueType, Hash>::getInitialBucket(Segment const& segment, uint64_t hash) const {
+    return hash >> (64 - segment.sizeExponent);
+}
+
+template<typename ValueType, typename Hash>
+bool ConcurrentBitVectorHashMap<ValueType, Hash>::matches(Segment const& segment, uint64_t bucket, storm::storage::BitVector const& key) const {
+    uint64_t const* storedKey = segment.keys.data() + bucket * wordsPerKey;
+    for (uint64_t word = 0; word < wordsPerKey; ++word) {
+        if (storedKey[word] != key.getAsInt(word * 64, 64)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+template<typename ValueType, typename Hash>
+boost::optional<uint64_t> ConcurrentBitVectorHashMap<ValueType, Hash>::findBucket(Segment const& segment, uint64_t hash,
+                                                                                  storm::storage::BitVector const& key) const {
+    uint64_t const bucketMask = (1ull << segment.sizeExponent) - 1;
+    uint64_t bucket = getInitialBucket(segment, hash);
+    for (uint64_t probes = 0; probes <= bucketMask; ++probes) {
+        uint8_t state = segment.states[bucket].load(std::memory_order_acquire);
+        while (state == BucketState::Writing) {
+            std::this_thread::yield();
+            state = segment.states[bucket].load(std::memory_order_acquire);
+        }
+        if (state == BucketState::Empty) {
+            return boost::none;
+        }
+        if (matches(segment, bucket, key)) {
+            return bucket;
+        }
+        bucket = (bucket + 1) & bucketMask;
+    }
+    return boost::none;
+}
+
+template<typename ValueType, typename Hash>
+std::pair<ValueType, bool> ConcurrentBitVectorHashMap<ValueType, Hash>::findOrAdd(storm::storage::BitVector const& key, ValueType const& value) {
+    return findOrAdd(key, [&value]() { return value; });
+}
+
+template<typename ValueType, typename Hash>
+std::pair<ValueType, bool> ConcurrentBitVectorHashMap<ValueType, Hash>::findOrAdd(storm::storage::BitVector const& key,
+                                                                                  std::function<ValueType()> const& valueGenerator) {
+    STORM_LOG_ASSERT(key.size() == bucketSize, "Size of bit vector and size of buckets do not match");
+    uint64_t const hash = hasher(key);
+    Segment& segment = getSegment(hash);
+
+    while (true) {
+        uint64_t observedSizeExponent;
+        {
+            std::shared_lock<std::shared_mutex> lock(segment.mutex);
+            observedSizeExponent = segment.sizeExponent;
+            uint64_t const segmentCapacity = 1ull << segment.sizeExponent;
+            if (segment.numberOfElements.load(std::memory_order_relaxed) < loadFactor * segmentCapacity) {
+                uint64_t const bucketMask = segmentCapacity - 1;
+                uint64_t bucket = getInitialBucket(segment, hash);
+                for (uint64_t probes = 0; probes < segmentCapacity; ++probes) {
+                    uint8_t state = segment.states[bucket].load(std::memory_order_acquire);
+                    if (state == BucketState::Empty) {
+                        uint8_t expected = BucketState::Empty;
+                        if (segment.states[bucket].compare_exchange_strong(expected, BucketState::Writing, std::memory_order_acq_rel)) {
+                            // We claimed the bucket, so we can write the key and the value without interference.
+                            uint64_t* storedKey = segment.keys.data() + bucket * wordsPerKey;
+                            for (uint64_t word = 0; word < wordsPerKey; ++word) {
+                                storedKey[word] = key.getAsInt(word * 64, 64);
+                            }
+                            ValueType value = valueGenerator();
+                            segment.values[bucket] = value;
+                            segment.numberOfElements.fetch_add(1, std::memory_order_relaxed);
+                            segment.states[bucket].store(BucketState::Occupied, std::memory_order_release);
+                            return std::make_pair(value, true);
+                        }
+                        state = expected;
+                    }
+                    // Another thread might currently write this bucket, possibly with the same key.
+                    while (state == BucketState::Writing) {
+                        std::this_thread::yield();
+                        state = segment.states[bucket].load(std::memory_order_acquire);
+                    }
+                    if (matches(segment, bucket, key)) {
+                        return std::make_pair(segment.values[bucket], false);
+                    }
+                    bucket = (bucket + 1) & bucketMask;
+                }
+            }
+        }
+        // The segment is too full. Resize it and try again.
+        increaseSize(segment, observedSizeExponent);
+    }
+}
+
+template<typename ValueType, typename Hash>
+void ConcurrentBitVectorHashMap<ValueType, Hash>::increaseSize(Segment& segment, uint64_t oldSizeExponent) {
+    std::unique_lock<std::shared_mutex> lock(segment.mutex);
+    if (segment.sizeExponent != oldSizeExponent) {
+        // Another thread resized the segment in the meantime.
+        return;
+    }
+    uint64_t const newSizeExponent = segment.sizeExponent + 1;
+    STORM_LOG_TRACE("Increasing size of hash map segment from " << (1ull << segment.sizeExponent) << " to " << (1ull << newSizeExponent) << ".");
+    STORM_LOG_ASSERT(newSizeExponent + segmentBits <= 64, "Hash map segment can not grow any further.");
+
+    std::vector<std::atomic<uint8_t>> newStates(1ull << newSizeExponent);
+    std::vector<uint64_t> newKeys((1ull << newSizeExponent) * wordsPerKey);
+    std::vector<ValueType> newValues(1ull << newSizeExponent);
+    uint64_t const newBucketMask = (1ull << newSizeExponent) - 1;
+    for (uint64_t oldBucket = 0; oldBucket < segment.states.size(); ++oldBucket) {
+        if (segment.states[oldBucket].load(std::memory_order_relaxed) != BucketState::Occupied) {
+            continue;
+        }
+        uint64_t const* oldKey = segment.keys.data() + oldBucket * wordsPerKey;
+        // Recompute the hash of the key to find its bucket in the enlarged segment.
+        storm::storage::BitVector key(bucketSize);
+        for (uint64_t word = 0; word < wordsPerKey; ++word) {
+            key.setFromInt(word * 64, 64, oldKey[word]);
+        }
+        uint64_t newBucket = hasher(key) >> (64 - newSizeExponent);
+        while (newStates[newBucket].load(std::memory_order_relaxed) != BucketState::Empty) {
+            newBucket = (newBucket + 1) & newBucketMask;
+        }
+        newStates[newBucket].store(BucketState::Occupied, std::memory_order_relaxed);
+        std::copy(oldKey, oldKey + wordsPerKey, newKeys.data() + newBucket * wordsPerKey);
+        newValues[newBucket] = segment.values[oldBucket];
+    }
+    segment.states = std::move(newStates);
+    segment.keys = std::move(newKeys);
+    segment.values = std::move(newValues);
+    segment.sizeExponent = newSizeExponent;
+}
+
+template<typename ValueType, typename Hash>
+bool ConcurrentBitVectorHashMap<ValueType, Hash>::contains(storm::storage::BitVector const& key) const {
+    uint64_t const hash = hasher(key);
+    Segment const& segment = getSegment(hash);
+    std::shared_lock<std::shared_mutex> lock(segment.mutex);
+    return findBucket(segment, hash, key).is_initialized();
+}
+
+template<typename ValueType, typename Hash>
+ValueType ConcurrentBitVectorHashMap<ValueType, Hash>::getValue(storm::storage::BitVector const& key) const {
+    uint64_t const hash = hasher(key);
+    Segment const& segment = getSegment(hash);
+    std::shared_lock<std::shared_mutex> lock(segment.mutex);
+    auto bucket = findBucket(segment, hash, key);
+    STORM_LOG_ASSERT(bucket, "Unknown key.");
+    return segment.values[bucket.get()];
+}
+
+template<typename ValueType, typename Hash>
+uint64_t ConcurrentBitVectorHashMap<ValueType, Hash>::size() const {
+    uint64_t result = 0;
+    for (auto const& segment : segments) {
+        result += segment->numberOfElements.load(std::memory_order_relaxed);
+    }
+    return result;
+}
+
+template<typename ValueType, typename Hash>
+uint64_t ConcurrentBitVectorHashMap<ValueType, Hash>::capacity() const {
+    uint64_t result = 0;
+    for (auto const& segment : segments) {
+        std::shared_lock<std::shared_mutex> lock(segment->mutex);
+        result += 1ull << segment->sizeExponent;
+    }
+    return result;
+}
+
+template<typename ValueType, typename Hash>
+BitVectorHashMap<ValueType> ConcurrentBitVectorHashMap<ValueType, Hash>::toBitVectorHashMap() const {
+    BitVectorHashMap<ValueType> result(bucketSize, size());
+    storm::storage::BitVector key(bucketSize);
+    for (auto const& segment : segments) {
+        for (uint64_t bucket = 0; bucket < segment->states.size(); ++bucket) {
+            if (segment->states[bucket].load(std::memory_order_relaxed) == BucketState::Occupied) {
+                uint64_t const* storedKey = segment->keys.data() + bucket * wordsPerKey;
+                for (uint64_t word = 0; word < wordsPerKey; ++word) {
+                    key.setFromInt(word * 64, 64, storedKey[word]);
+                }
+                result.findOrAdd(key, segment->values[bucket]);
+            }
+        }
+    }
+    return result;
+}
+
+template class ConcurrentBitVectorHashMap<uint64_t>;
+template class ConcurrentBitVectorHashMap<uint32_t>;
+}  // namespace storage
+}  // namespace storm
@@ -0,0 +1,148 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <shared_mutex>
+#include <vector>
+
+#include <boost/optional.hpp>
+
+#include "storm/storage/BitVector.h"
+#include "storm/storage/BitVectorHashMap.h"
+
+namespace storm {
+namespace storage {
+
+/*!
+ * This class represents a hash-map whose keys are bit vectors and that can be queried and extended by multiple threads concurrently.
+ * As for the BitVectorHashMap, only queries and insertions are supported and the keys must be bit vectors with a length that is a multiple of 64.
+ *
+ * The map is split into segments that are selected by the hash value of the key. Each segment is an open-addressing table with linear probing.
+ * Buckets are claimed by a compare-and-swap on their state, so insertions into the same segment do not block each other. If a segment becomes
+ * too full, only this segment is resized, i.e., threads that work on other segments are not interrupted.
+ */
+template<typename ValueType, typename Hash = Murmur3BitVectorHash<uint64_t>>
+class ConcurrentBitVectorHashMap {
+   public:
+    /*!
+     * Creates a new hash map with the given bucket size and initial size.
+     *
+     * @param bucketSize The size of the keys that this map can hold. This value must be a multiple of 64.
+     * @param initialSize The number of buckets that is initially available (in total).
+     * @param loadFactor The load factor that determines at which point the size of a segment is increased.
+     * @param numberOfSegments The number of segments. This is rounded up to the next power of two. More segments reduce the contention upon resizing.
+     */
+    ConcurrentBitVectorHashMap(uint64_t bucketSize = 64, uint64_t initialSize = 1000, double loadFactor = 0.75, uint64_t numberOfSegments = 64);
+
+    /*!
+     * Searches for the given key in the map. If it is found, the mapped-to value is returned. Otherwise, the key is inserted with the given value.
+     * This method may be called concurrently.
+     *
+     * @param key The key to search or insert.
+     * @param value The value that is inserted if the key is not already found in the map.
+     * @return A pair whose first component is the found value if the key is already contained in the map and the provided new value otherwise and
+     * whose second component indicates whether the key was inserted.
+     */
+    std::pair<ValueType, bool> findOrAdd(storm::storage::BitVector const& key, ValueType const& value);
+
+    /*!
+     * Searches for the given key in the map. If it is found, the mapped-to value is returned. Otherwise, the key is inserted with the value
+     * obtained from the given generator. The generator is called at most once and only if the key is inserted by this call, which allows to,
+     * e.g., hand out consecutive indices to newly found states. This method may be called concurrently.
+     *
+     * @param key The key to search or insert.
+     * @param valueGenerator A function that yields the value to insert.
+     * @return A pair whose first component is the value mapped to the key and whose second component indicates whether the key was inserted.
+     */
+    std::pair<ValueType, bool> findOrAdd(storm::storage::BitVector const& key, std::function<ValueType()> const& valueGenerator);
+
+    /*!
+     * Checks if the given key is contained in the map. This method may be called concurrently.
+     */
+    bool contains(storm::storage::BitVector const& key) const;
+
+    /*!
+     * Retrieves the value associated with the given key. If the key does not exist, the behaviour is undefined.
+     * This method may be called concurrently.
+     */
+    ValueType getValue(storm::storage::BitVector const& key) const;
+
+    /*!
+     * Retrieves the size of the map in terms of the number of key-value pairs it stores.
+     */
+    uint64_t size() const;
+
+    /*!
+     * Retrieves the total capacity of the segments.
+     */
+    uint64_t capacity() const;
+
+    /*!
+     * Copies the content of this map into a (sequential) BitVectorHashMap, e.g., to store it in a StateStorage after a parallel exploration.
+     * This method must not be called while other threads insert into this map.
+     */
+    BitVectorHashMap<ValueType> toBitVectorHashMap() const;
+
+   private:
+    enum BucketState : uint8_t { Empty = 0, Writing = 1, Occupied = 2 };
+
+    struct Segment {
+        explicit Segment(uint64_t sizeExponent, uint64_t wordsPerKey);
+
+        // Held shared while accessing the segment and exclusively while resizing it.
+        mutable std::shared_mutex mutex;
+        // The capacity of the segment is 2^sizeExponent.
+        uint64_t sizeExponent;
+        std::vector<std::atomic<uint8_t>> states;
+        std::vector<uint64_t> keys;
+        std::vector<ValueType> values;
+        std::atomic<uint64_t> numberOfElements;
+    };
+
+    /*!
+     * Retrieves the segment that is responsible for the given hash value.
+     */
+    Segment& getSegment(uint64_t hash) const;
+
+    /*!
+     * Retrieves the bucket of the given segment at which the search for a key with the given hash value starts.
+     */
+    uint64_t getInitialBucket(Segment const& segment, uint64_t hash) const;
+
+    /*!
+     * Checks whether the key stored in the given (occupied) bucket matches the given key.
+     */
+    bool matches(Segment const& segment, uint64_t bucket, storm::storage::BitVector const& key) const;
+
+    /*!
+     * Searches for the given key in the segment. The caller must hold (at least) a shared lock of the segment.
+     *
+     * @return the bucket of the key, if it is contained.
+     */
+    boost::optional<uint64_t> findBucket(Segment const& segment, uint64_t hash, storm::storage::BitVector const& key) const;
+
+    /*!
+     * Doubles the size of the given segment if it is (still) too full. Acquires an exclusive lock of the segment.
+     */
+    void increaseSize(Segment& segment, uint64_t oldSizeExponent);
+
+    // The load factor determining when the size of a segment is increased.
+    double loadFactor;
+
+    // The size of one key in bits and in 64-bit words.
+    uint64_t bucketSize;
+    uint64_t wordsPerKey;
+
+    // The number of bits of the hash value that select the segment.
+    uint64_t segmentBits;
+
+    std::vector<std::unique_ptr<Segment>> segments;
+
+    // The function object used to hash the keys.
+    Hash hasher;
+};
+
+}  // namespace storage
+}  // namespace storm
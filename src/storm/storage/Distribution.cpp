@@ -23,6 +23,11 @@ void Distribution<ValueType, StateType>::reserve(uint64_t size) {
     this->distribution.reserve(size);
 }
 
+template<typename ValueType, typename StateType>
+void Distribution<ValueType, StateType>::clear() {
+    this->distribution.clear();
+}
+
 template<typename ValueType, typename StateType>
 void Distribution<ValueType, StateType>::add(Distribution const& other) {
     container_type newDistribution;
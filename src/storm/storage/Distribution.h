@@ -34,6 +34,11 @@ class Distribution {
      */
     void reserve(uint64_t size);
 
+    /*!
+     * Removes all entries from the distribution, but keeps the allocated memory.
+     */
+    void clear();
+
     /*!
      * Adds the given distribution to the current one.
      */
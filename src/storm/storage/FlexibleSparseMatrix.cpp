@@ -11,7 +11,7 @@
 namespace storm {
 namespace storage {
 template<typename ValueType>
-FlexibleSparseMatrix<ValueType>::FlexibleSparseMatrix(index_type rows) : data(rows), columnCount(0), nonzeroEntryCount(0) {
+FlexibleSparseMatrix<ValueType>::FlexibleSparseMatrix(index_type rows) : data(rows), columnCount(0), nonzeroEntryCount(0), trivialRowGrouping(true) {
     // Intentionally left empty.
 }
 
@@ -143,6 +143,15 @@ void FlexibleSparseMatrix<ValueType>::updateDimensions() {
     }
 }
 
+template<typename ValueType>
+void FlexibleSparseMatrix<ValueType>::resize(index_type rowCount, index_type columnCount) {
+    STORM_LOG_THROW(hasTrivialRowGrouping(), storm::exceptions::InvalidArgumentException, "Resizing is only supported for matrices with trivial row grouping.");
+    STORM_LOG_THROW(rowCount >= getRowCount() && columnCount >= getColumnCount(), storm::exceptions::InvalidArgumentException,
+                    "Resizing can not remove rows or columns.");
+    this->data.resize(rowCount);
+    this->columnCount = columnCount;
+}
+
 template<typename ValueType>
 bool FlexibleSparseMatrix<ValueType>::empty() const {
     for (auto const& row : this->data) {
@@ -195,9 +204,7 @@ storm::storage::SparseMatrix<ValueType> FlexibleSparseMatrix<ValueType>::createS
                 ++rowGroupIndexIt;
             }
         }
-        for (auto const& entry : row) {
-            matrixBuilder.addNextValue(currRowIndex, entry.getColumn(), entry.getValue());
-        }
+        matrixBuilder.addNextRow(currRowIndex, row);
         ++currRowIndex;
     }
     // The matrix might end with one or more empty row groups
@@ -144,6 +144,15 @@ class FlexibleSparseMatrix {
      */
     void updateDimensions();
 
+    /*!
+     * Enlarges the matrix to the given number of rows and columns. The new rows are empty.
+     * This is only supported for matrices with trivial row grouping.
+     *
+     * @param rowCount The new number of rows (at least the current number of rows).
+     * @param columnCount The new number of columns (at least the current number of columns).
+     */
+    void resize(index_type rowCount, index_type columnCount);
+
     /*!
      * Checks if the matrix has no elements.
      * @return True, if the matrix is empty.
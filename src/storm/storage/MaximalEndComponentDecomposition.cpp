@@ -128,15 +128,20 @@ void MaximalEndComponentDecomposition<ValueType>::performMaximalEndComponentDeco
 
         // process the MECs that we've found, i.e. SCCs where every state can stay inside the SCC
         ecSccIndices &= nonTrivSccIndices;
-        for (auto sccIndex : ecSccIndices) {
-            MaximalEndComponent newMec;
+        if (!ecSccIndices.empty()) {
+            // Create the MECs upfront so that all their states can be collected in a single pass over the candidates.
+            std::vector<uint64_t> sccToMecIndexMap(sccDecRes.sccCount, 0);
+            for (auto sccIndex : ecSccIndices) {
+                sccToMecIndexMap[sccIndex] = this->blocks.size();
+                this->blocks.emplace_back();
+            }
+            storm::storage::BitVector newMecStates(remainingEcCandidates.size(), false);
             for (auto state : remainingEcCandidates) {
-                // skip states from different SCCs
-                if (sccDecRes.stateToSccMapping[state] != sccIndex) {
+                auto const sccIndex = sccDecRes.stateToSccMapping[state];
+                if (!ecSccIndices.get(sccIndex)) {
                     continue;
                 }
-                // This is no longer a candidate
-                remainingEcCandidates.set(state, false);
+                newMecStates.set(state, true);
                 // Add choices to the MEC
                 MaximalEndComponent::set_type containedChoices;
                 for (auto ecChoiceIt = ecChoices.begin(nondeterministicChoiceIndices[state]); *ecChoiceIt < nondeterministicChoiceIndices[state + 1];
@@ -144,9 +149,10 @@ void MaximalEndComponentDecomposition<ValueType>::performMaximalEndComponentDeco
                     containedChoices.insert(*ecChoiceIt);
                 }
                 STORM_LOG_ASSERT(!containedChoices.empty(), "The contained choices of any state in an MEC must be non-empty.");
-                newMec.addState(state, std::move(containedChoices));
+                this->blocks[sccToMecIndexMap[sccIndex]].addState(state, std::move(containedChoices));
             }
-            this->blocks.emplace_back(std::move(newMec));
+            // These states are no longer candidates
+            remainingEcCandidates &= ~newMecStates;
         }
 
         if (nonTrivSccIndices == ecSccIndices) {
@@ -155,10 +161,13 @@ void MaximalEndComponentDecomposition<ValueType>::performMaximalEndComponentDeco
         }
 
         // prepare next iteration.
-        // It suffices to keep the candidates that have the possibility to always stay in the candidate set
-        remainingEcCandidates = storm::utility::graph::performProbGreater0A(transitionMatrix, nondeterministicChoiceIndices, backwardTransitions,
-                                                                            remainingEcCandidates, ~remainingEcCandidates, false, 0, ecChoices);
-        remainingEcCandidates.complement();
+        // It suffices to keep the candidates that have the possibility to always stay in the candidate set.
+        // Since the remaining choices of the candidates never leave their SCC, only states that have been removed from an SCC of this iteration can
+        // force a candidate to leave the candidate set. We therefore start the backward search from these states only, which keeps the work of each
+        // iteration proportional to the SCCs that are affected by removed choices.
+        storm::storage::BitVector removedStates = sccDecRes.nonTrivialStates & ~remainingEcCandidates;
+        remainingEcCandidates &= ~storm::utility::graph::performProbGreater0A(transitionMatrix, nondeterministicChoiceIndices, backwardTransitions,
+                                                                              remainingEcCandidates, removedStates, false, 0, ecChoices);
         sccDecOptions.subsystem(remainingEcCandidates);
         sccDecOptions.choices(ecChoices);
     }
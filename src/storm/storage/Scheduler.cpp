@@ -1,5 +1,6 @@
 
 #include <boost/algorithm/string/join.hpp>
+#include <sstream>
 
 #include "storm/adapters/JsonAdapter.h"
 #include "storm/adapters/RationalFunctionAdapter.h"
@@ -304,10 +305,29 @@ void Scheduler<ValueType>::printToStream(std::ostream& out, std::shared_ptr<stor
 template<typename ValueType>
 void Scheduler<ValueType>::printJsonToStream(std::ostream& out, std::shared_ptr<storm::models::sparse::Model<ValueType>> model, bool skipUniqueChoices,
                                              bool skipDontCareStates) const {
+    // The entries are written one after another, so only the json representation of a single state is kept in memory.
+    storm::JsonStreamWriter<storm::RationalNumber> writer(out);
+    writer.beginArray();
+    forEachJsonEntry(model, skipUniqueChoices, skipDontCareStates,
+                     [&writer](storm::json<storm::RationalNumber>&& stateChoicesJson) { writer.value(stateChoicesJson); });
+    writer.endArray();
+}
+
+template<typename ValueType>
+storm::json<storm::RationalNumber> Scheduler<ValueType>::toJson(std::shared_ptr<storm::models::sparse::Model<ValueType>> model, bool skipUniqueChoices,
+                                                                bool skipDontCareStates) const {
+    storm::json<storm::RationalNumber> output;
+    forEachJsonEntry(model, skipUniqueChoices, skipDontCareStates,
+                     [&output](storm::json<storm::RationalNumber>&& stateChoicesJson) { output.push_back(std::move(stateChoicesJson)); });
+    return output;
+}
+
+template<typename ValueType>
+void Scheduler<ValueType>::forEachJsonEntry(std::shared_ptr<storm::models::sparse::Model<ValueType>> model, bool skipUniqueChoices, bool skipDontCareStates,
+                                            std::function<void(storm::json<storm::RationalNumber>&&)> const& function) const {
     STORM_LOG_THROW(model == nullptr || model->getNumberOfStates() == schedulerChoices.front().size(), storm::exceptions::InvalidOperationException,
                     "The given model is not compatible with this scheduler.");
     STORM_LOG_WARN_COND(!(skipUniqueChoices && model == nullptr), "Can not skip unique choices if the model is not given.");
-    storm::json<storm::RationalNumber> output;
     for (uint64_t state = 0; state < schedulerChoices.front().size(); ++state) {
         // Check whether the state is skipped
         if (skipUniqueChoices && model != nullptr && model->getTransitionMatrix().getRowGroupSize(state) == 1) {
@@ -375,10 +395,92 @@ void Scheduler<ValueType>::printJsonToStream(std::ostream& out, std::shared_ptr<
                 choicesJson = "undefined";
             }
             stateChoicesJson["c"] = std::move(choicesJson);
-            output.push_back(std::move(stateChoicesJson));
+            function(std::move(stateChoicesJson));
+        }
+    }
+}
+
+template<typename ValueType>
+void Scheduler<ValueType>::printCsvToStream(std::ostream& out, std::shared_ptr<storm::models::sparse::Model<ValueType>> model, bool skipUniqueChoices,
+                                            bool skipDontCareStates) const {
+    STORM_LOG_THROW(model == nullptr || model->getNumberOfStates() == schedulerChoices.front().size(), storm::exceptions::InvalidOperationException,
+                    "The given model is not compatible with this scheduler.");
+    STORM_LOG_WARN_COND(!(skipUniqueChoices && model == nullptr), "Can not skip unique choices if the model is not given.");
+    STORM_LOG_THROW(isMemorylessScheduler() || model != nullptr, storm::exceptions::InvalidOperationException,
+                    "Schedulers with memory can only be printed when the model is passed.");
+    bool const stateValuationsGiven = model != nullptr && model->hasStateValuations() && model->getNumberOfStates() > 0;
+    uint64_t const numberOfStates = schedulerChoices.front().size();
+
+    auto isSkipped = [&](uint64_t state, uint64_t memoryState) {
+        return (skipUniqueChoices && model != nullptr && model->getTransitionMatrix().getRowGroupSize(state) == 1) ||
+               (skipDontCareStates && isDontCare(state, memoryState));
+    };
+
+    // Header
+    out << "state";
+    if (stateValuationsGiven) {
+        auto const& valueAssignment = model->getStateValuations().at(0);
+        for (auto valIt = valueAssignment.begin(); valIt != valueAssignment.end(); ++valIt) {
+            out << ',' << valIt.getName();
+        }
+    }
+    out << ",memory,choice,probability\n";
+
+    // Choices
+    for (uint64_t state = 0; state < numberOfStates; ++state) {
+        std::string stateColumns = std::to_string(state);
+        if (stateValuationsGiven) {
+            std::stringstream valuationStream;
+            auto const& valueAssignment = model->getStateValuations().at(state);
+            for (auto valIt = valueAssignment.begin(); valIt != valueAssignment.end(); ++valIt) {
+                valuationStream << ',';
+                if (valIt.isBoolean()) {
+                    valuationStream << (valIt.getBooleanValue() ? '1' : '0');
+                } else if (valIt.isInteger()) {
+                    valuationStream << valIt.getIntegerValue();
+                } else if (valIt.isRational()) {
+                    valuationStream << valIt.getRationalValue();
+                } else {
+                    valuationStream << valIt.getLabelValue();
+                }
+            }
+            stateColumns += valuationStream.str();
+        }
+        for (uint64_t memoryState = 0; memoryState < getNumberOfMemoryStates(); ++memoryState) {
+            if (isSkipped(state, memoryState)) {
+                continue;
+            }
+            auto const& choice = schedulerChoices[memoryState][state];
+            if (choice.isDefined()) {
+                for (auto const& choiceProbPair : choice.getChoiceAsDistribution()) {
+                    out << stateColumns << ',' << memoryState << ',' << choiceProbPair.first << ',' << choiceProbPair.second << '\n';
+                }
+            } else {
+                out << stateColumns << ',' << memoryState << ",,\n";
+            }
+        }
+    }
+
+    // Memory updates
+    if (!isMemorylessScheduler()) {
+        auto const& matrix = model->getTransitionMatrix();
+        out << "\nmemory,state,choice,successor,next memory\n";
+        for (uint64_t state = 0; state < numberOfStates; ++state) {
+            for (uint64_t memoryState = 0; memoryState < getNumberOfMemoryStates(); ++memoryState) {
+                auto const& choice = schedulerChoices[memoryState][state];
+                if (isSkipped(state, memoryState) || !choice.isDefined()) {
+                    continue;
+                }
+                for (auto const& choiceProbPair : choice.getChoiceAsDistribution()) {
+                    uint64_t row = matrix.getRowGroupIndices()[state] + choiceProbPair.first;
+                    for (auto entryIt = matrix.getRow(row).begin(); entryIt < matrix.getRow(row).end(); ++entryIt) {
+                        out << memoryState << ',' << state << ',' << choiceProbPair.first << ',' << entryIt->getColumn() << ','
+                            << this->memoryStructure->getSuccessorMemoryState(memoryState, entryIt - matrix.begin()) << '\n';
+                    }
+                }
+            }
         }
     }
-    out << storm::dumpJson(output);
 }
 
 template class Scheduler<double>;
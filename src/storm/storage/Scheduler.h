@@ -1,6 +1,9 @@
 #pragma once
 
 #include <cstdint>
+#include <functional>
+#include "storm/adapters/JsonForward.h"
+#include "storm/adapters/RationalNumberForward.h"
 #include "storm/storage/BitVector.h"
 #include "storm/storage/SchedulerChoice.h"
 #include "storm/storage/memorystructure/MemoryStructure.h"
@@ -149,7 +152,36 @@ class Scheduler {
     void printJsonToStream(std::ostream& out, std::shared_ptr<storm::models::sparse::Model<ValueType>> model = nullptr, bool skipUniqueChoices = false,
                            bool skipDontCareStates = false) const;
 
+    /*!
+     * Retrieves the scheduler in the json format that is also used by printJsonToStream.
+     */
+    storm::json<storm::RationalNumber> toJson(std::shared_ptr<storm::models::sparse::Model<ValueType>> model = nullptr, bool skipUniqueChoices = false,
+                                              bool skipDontCareStates = false) const;
+
+    /*!
+     * Prints the scheduler as comma-separated values to the given output stream. Each line describes one choice of a pair of model and memory state:
+     * "state,[state variables,]memory,choice,probability" where choice is the local index of the choice within the state.
+     * The values of the state variables are only given if the model has state valuations.
+     * For schedulers with memory, a second table (separated by an empty line) gives the memory updates for the transitions of the chosen choices:
+     * "memory,state,choice,successor,next memory".
+     * The format can be read without a json parser and is considerably smaller than the json output.
+     *
+     * @param out The output stream
+     * @param model If given, provides additional information for printing (e.g., the state valuations). Must be passed if the scheduler is not memoryless.
+     * @param skipUniqueChoices If true, the (unique) choice for deterministic states (i.e., states with only one enabled choice) is not printed explicitly.
+     *                          Requires a model to be given.
+     * @param skipDontCareStates If true, the choice for dontCareStates states is not printed explicitly.
+     */
+    void printCsvToStream(std::ostream& out, std::shared_ptr<storm::models::sparse::Model<ValueType>> model = nullptr, bool skipUniqueChoices = false,
+                          bool skipDontCareStates = false) const;
+
    private:
+    /*!
+     * Invokes the given function for the json representation of each (printed) pair of model and memory state in the order used by toJson.
+     */
+    void forEachJsonEntry(std::shared_ptr<storm::models::sparse::Model<ValueType>> model, bool skipUniqueChoices, bool skipDontCareStates,
+                          std::function<void(storm::json<storm::RationalNumber>&&)> const& function) const;
+
     boost::optional<storm::storage::MemoryStructure> memoryStructure;
     std::vector<std::vector<SchedulerChoice<ValueType>>> schedulerChoices;
     std::vector<storm::storage::BitVector> dontCareStates;
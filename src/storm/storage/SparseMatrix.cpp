@@ -17,6 +17,7 @@
 
 #include "storm/utility/macros.h"
 
+#include <atomic>
 #include <iterator>
 
 namespace storm {
@@ -238,6 +239,135 @@ void SparseMatrixBuilder<ValueType>::addNextValue(index_type row, index_type col
     }
 
     // In case we did not expect this value, we throw an exception.
+    checkInitialDimensions();
+}
+
+template<typename ValueType>
+void SparseMatrixBuilder<ValueType>::addNextValue(index_type row, index_type column, ValueType&& value) {
+    // If the entry can be appended directly, we move it into the matrix. Otherwise, the general case is handled above.
+    if (pendingDiagonalEntry || row < lastRow || (row == lastRow && column <= lastColumn && rowIndications.back() < currentEntryCount)) {
+        addNextValue(row, column, static_cast<ValueType const&>(value));
+        return;
+    }
+    STORM_LOG_ASSERT(columnsAndValues.size() == currentEntryCount, "Unexpected size of columnsAndValues vector.");
+
+    if (row != lastRow) {
+        assert(rowIndications.size() == lastRow + 1);
+        rowIndications.resize(row + 1, currentEntryCount);
+        lastRow = row;
+    }
+    lastColumn = column;
+    columnsAndValues.emplace_back(column, std::move(value));
+    highestColumn = std::max(highestColumn, column);
+    ++currentEntryCount;
+
+    checkInitialDimensions();
+}
+
+template<typename ValueType>
+void SparseMatrixBuilder<ValueType>::addNextRow(index_type row, std::vector<MatrixEntry<index_type, value_type>> const& entries) {
+    addNextRowEntries(row, entries.begin(), entries.end());
+}
+
+template<typename ValueType>
+void SparseMatrixBuilder<ValueType>::addNextRow(index_type row, typename SparseMatrix<value_type>::const_rows const& entries) {
+    addNextRowEntries(row, entries.begin(), entries.end());
+}
+
+template<typename ValueType>
+template<typename InputIterator>
+void SparseMatrixBuilder<ValueType>::addNextRowEntries(index_type row, InputIterator first, InputIterator last) {
+    if (first == last) {
+        return;
+    }
+    STORM_LOG_THROW(row >= lastRow, storm::exceptions::InvalidArgumentException,
+                    "Adding an element in row " << row << ", but an element in row " << lastRow << " has already been added.");
+
+    // The entries can be appended in bulk if they start a new row and are sorted without duplicates. Otherwise, we add them one by one.
+    bool startsNewRow = row > lastRow || rowIndications.back() == currentEntryCount;
+    bool sorted = std::adjacent_find(first, last, [](MatrixEntry<index_type, value_type> const& a, MatrixEntry<index_type, value_type> const& b) {
+                      return a.getColumn() >= b.getColumn();
+                  }) == last;
+    if (pendingDiagonalEntry || !startsNewRow || !sorted) {
+        for (; first != last; ++first) {
+            addNextValue(row, first->getColumn(), first->getValue());
+        }
+        return;
+    }
+    STORM_LOG_ASSERT(columnsAndValues.size() == currentEntryCount, "Unexpected size of columnsAndValues vector.");
+
+    if (row != lastRow) {
+        assert(rowIndications.size() == lastRow + 1);
+        rowIndications.resize(row + 1, currentEntryCount);
+        lastRow = row;
+    }
+    columnsAndValues.insert(columnsAndValues.end(), first, last);
+    currentEntryCount = columnsAndValues.size();
+    lastColumn = columnsAndValues.back().getColumn();
+    highestColumn = std::max(highestColumn, lastColumn);
+
+    checkInitialDimensions();
+}
+
+template<typename ValueType>
+void SparseMatrixBuilder<ValueType>::reserve(index_type rows, index_type entries, index_type rowGroups) {
+    rowIndications.reserve(rows + 1);
+    columnsAndValues.reserve(entries);
+    if (hasCustomRowGrouping) {
+        rowGroupIndices.get().reserve(rowGroups + 1);
+    }
+}
+
+template<typename ValueType>
+void SparseMatrixBuilder<ValueType>::appendRows(SparseMatrixBuilder<ValueType>&& other, index_type firstRow) {
+    STORM_LOG_THROW(hasCustomRowGrouping == other.hasCustomRowGrouping, storm::exceptions::InvalidArgumentException,
+                    "Cannot append rows of a matrix builder with a different kind of row grouping.");
+    STORM_LOG_THROW(firstRow > lastRow || (firstRow == lastRow && rowIndications.back() == currentEntryCount && !pendingDiagonalEntry),
+                    storm::exceptions::InvalidArgumentException,
+                    "Appending rows starting at row " << firstRow << ", but an element in row " << lastRow << " has already been added.");
+    flushPendingDiagonalEntry();
+    other.flushPendingDiagonalEntry();
+    STORM_LOG_ASSERT(columnsAndValues.size() == currentEntryCount, "Unexpected size of columnsAndValues vector.");
+
+    if (other.currentEntryCount > 0) {
+        // Close all rows before the first appended row and shift the row indications of the other builder.
+        assert(rowIndications.size() == lastRow + 1);
+        rowIndications.resize(firstRow, currentEntryCount);
+        for (auto const& rowIndication : other.rowIndications) {
+            rowIndications.push_back(rowIndication + currentEntryCount);
+        }
+        columnsAndValues.insert(columnsAndValues.end(), std::make_move_iterator(other.columnsAndValues.begin()),
+                                std::make_move_iterator(other.columnsAndValues.end()));
+        currentEntryCount += other.currentEntryCount;
+        lastRow = firstRow + other.lastRow;
+        lastColumn = other.lastColumn;
+        highestColumn = std::max(highestColumn, other.highestColumn);
+    }
+
+    if (hasCustomRowGrouping) {
+        for (auto const& rowGroupIndex : other.rowGroupIndices.get()) {
+            rowGroupIndices.get().push_back(rowGroupIndex + firstRow);
+        }
+        currentRowGroupCount += other.currentRowGroupCount;
+    }
+
+    other.columnsAndValues.clear();
+    other.rowIndications.clear();
+    checkInitialDimensions();
+}
+
+template<typename ValueType>
+void SparseMatrixBuilder<ValueType>::flushPendingDiagonalEntry() {
+    if (pendingDiagonalEntry) {
+        index_type diagColumn = hasCustomRowGrouping ? currentRowGroupCount - 1 : lastRow;
+        ValueType diagValue = std::move(pendingDiagonalEntry.get());
+        pendingDiagonalEntry = boost::none;  // clear now, so addNextValue works properly
+        addNextValue(lastRow, diagColumn, std::move(diagValue));
+    }
+}
+
+template<typename ValueType>
+void SparseMatrixBuilder<ValueType>::checkInitialDimensions() const {
     if (forceInitialDimensions) {
         STORM_LOG_THROW(!initialRowCountSet || lastRow < initialRowCount, storm::exceptions::OutOfRangeException,
                         "Cannot insert value at illegal row " << lastRow << ".");
@@ -280,12 +410,7 @@ template<typename ValueType>
 SparseMatrix<ValueType> SparseMatrixBuilder<ValueType>::build(index_type overriddenRowCount, index_type overriddenColumnCount,
                                                               index_type overriddenRowGroupCount) {
     // If there still is a pending diagonal entry, we need to add it now
-    if (pendingDiagonalEntry) {
-        index_type diagColumn = hasCustomRowGrouping ? currentRowGroupCount - 1 : lastRow;
-        ValueType diagValue = std::move(pendingDiagonalEntry.get());
-        pendingDiagonalEntry = boost::none;  // clear now, so addNextValue works properly
-        addNextValue(lastRow, diagColumn, diagValue);
-    }
+    flushPendingDiagonalEntry();
 
     bool hasEntries = currentEntryCount != 0;
 
@@ -348,6 +473,10 @@ SparseMatrix<ValueType> SparseMatrixBuilder<ValueType>::build(index_type overrid
         }
     }
 
+    // So far, all entries were written by the building thread. Distribute them such that the rows reside close to the threads that process them.
+    storm::utility::vector::redistributeWithParallelFirstTouch(columnsAndValues, &rowIndications);
+    storm::utility::vector::redistributeWithParallelFirstTouch(rowIndications);
+
     return SparseMatrix<ValueType>(columnCount, std::move(rowIndications), std::move(columnsAndValues), std::move(rowGroupIndices));
 }
 
@@ -690,6 +819,16 @@ typename SparseMatrix<ValueType>::index_type SparseMatrix<ValueType>::getNonzero
     return nonzeroEntryCount;
 }
 
+template<typename ValueType>
+uint64_t SparseMatrix<ValueType>::getSizeInMemory() const {
+    uint64_t result =
+        sizeof(*this) + sizeof(MatrixEntry<index_type, value_type>) * columnsAndValues.capacity() + sizeof(index_type) * rowIndications.capacity();
+    if (rowGroupIndices) {
+        result += sizeof(index_type) * rowGroupIndices->capacity();
+    }
+    return result;
+}
+
 template<typename ValueType>
 void SparseMatrix<ValueType>::updateNonzeroEntryCount() const {
     this->nonzeroEntryCount = 0;
@@ -1116,6 +1255,45 @@ std::vector<ValueType> SparseMatrix<ValueType>::getConstrainedRowGroupSumVector(
     return result;
 }
 
+#ifdef STORM_HAVE_INTELTBB
+namespace {
+// Below this number of entries, transposing and extracting submatrices is done sequentially.
+uint64_t const minimalEntryCountForParallelConstruction = 1ull << 18;
+
+/*!
+ * Constructs the rows of a matrix concurrently. The given function is called as writeRow(row, addEntry) and has to call addEntry(column, value)
+ * for each entry of the row in ascending column order. It is called twice for each row: once to determine the size of the row and once to write
+ * its entries.
+ */
+template<typename ValueType, typename RowFunction>
+void constructRowsInParallel(uint64_t rowCount, RowFunction const& writeRow, std::vector<uint64_t>& rowIndications,
+                             std::vector<MatrixEntry<uint64_t, ValueType>>& columnsAndValues) {
+    rowIndications.assign(rowCount + 1, 0);
+    tbb::parallel_for(tbb::blocked_range<uint64_t>(0, rowCount, 100), [&](tbb::blocked_range<uint64_t> const& range) {
+        for (uint64_t row = range.begin(); row < range.end(); ++row) {
+            uint64_t rowSize = 0;
+            writeRow(row, [&rowSize](uint64_t, ValueType const&) { ++rowSize; });
+            rowIndications[row + 1] = rowSize;
+        }
+    });
+    std::partial_sum(rowIndications.begin(), rowIndications.end(), rowIndications.begin());
+
+    columnsAndValues.clear();
+    storm::utility::vector::reserveWithParallelFirstTouch(columnsAndValues, rowIndications.back(), &rowIndications);
+    columnsAndValues.resize(rowIndications.back());
+    tbb::parallel_for(tbb::blocked_range<uint64_t>(0, rowCount, 100), [&](tbb::blocked_range<uint64_t> const& range) {
+        for (uint64_t row = range.begin(); row < range.end(); ++row) {
+            auto entryIt = columnsAndValues.begin() + rowIndications[row];
+            writeRow(row, [&entryIt](uint64_t column, ValueType const& value) {
+                *entryIt = MatrixEntry<uint64_t, ValueType>(column, value);
+                ++entryIt;
+            });
+        }
+    });
+}
+}  // namespace
+#endif
+
 template<typename ValueType>
 SparseMatrix<ValueType> SparseMatrix<ValueType>::getSubmatrix(bool useGroups, storm::storage::BitVector const& rowConstraint,
                                                               storm::storage::BitVector const& columnConstraint, bool insertDiagonalElements,
@@ -1163,6 +1341,11 @@ SparseMatrix<ValueType> SparseMatrix<ValueType>::getSubmatrix(storm::storage::Bi
                                                               storm::storage::BitVector const& columnConstraint, std::vector<index_type> const& rowGroupIndices,
                                                               bool insertDiagonalEntries, storm::storage::BitVector const& makeZeroColumns) const {
     STORM_LOG_THROW(!rowGroupConstraint.empty() && !columnConstraint.empty(), storm::exceptions::InvalidArgumentException, "Cannot build empty submatrix.");
+#ifdef STORM_HAVE_INTELTBB
+    if (this->getEntryCount() >= minimalEntryCountForParallelConstruction) {
+        return getSubmatrixParallel(rowGroupConstraint, columnConstraint, rowGroupIndices, insertDiagonalEntries, makeZeroColumns);
+    }
+#endif
     index_type submatrixColumnCount = columnConstraint.getNumberOfSetBits();
 
     // Start by creating a temporary vector that stores for each index whose bit is set to true the number of
@@ -1241,6 +1424,11 @@ SparseMatrix<ValueType> SparseMatrix<ValueType>::getSubmatrix(storm::storage::Bi
 template<typename ValueType>
 SparseMatrix<ValueType> SparseMatrix<ValueType>::restrictRows(storm::storage::BitVector const& rowsToKeep, bool allowEmptyRowGroups) const {
     STORM_LOG_ASSERT(rowsToKeep.size() == this->getRowCount(), "Dimensions mismatch.");
+#ifdef STORM_HAVE_INTELTBB
+    if (this->getEntryCount() >= minimalEntryCountForParallelConstruction) {
+        return restrictRowsParallel(rowsToKeep, allowEmptyRowGroups);
+    }
+#endif
 
     // Count the number of entries of the resulting matrix
     index_type entryCount = 0;
@@ -1269,9 +1457,7 @@ SparseMatrix<ValueType> SparseMatrix<ValueType>::restrictRows(storm::storage::Bi
         for (index_type row = rowsToKeep.getNextSetIndex(this->getRowGroupIndices()[rowGroup]); row < this->getRowGroupIndices()[rowGroup + 1];
              row = rowsToKeep.getNextSetIndex(row + 1)) {
             rowGroupEmpty = false;
-            for (auto const& entry : this->getRow(row)) {
-                builder.addNextValue(newRow, entry.getColumn(), entry.getValue());
-            }
+            builder.addNextRow(newRow, this->getRow(row));
             ++newRow;
         }
         STORM_LOG_THROW(allowEmptyRowGroups || !rowGroupEmpty, storm::exceptions::InvalidArgumentException,
@@ -1294,9 +1480,7 @@ SparseMatrix<ValueType> SparseMatrix<ValueType>::filterEntries(storm::storage::B
     // Build the resulting matrix.
     SparseMatrixBuilder<ValueType> builder(getRowCount(), getColumnCount(), entryCount);
     for (auto row : rowFilter) {
-        for (auto const& entry : getRow(row)) {
-            builder.addNextValue(row, entry.getColumn(), entry.getValue());
-        }
+        builder.addNextRow(row, getRow(row));
     }
     SparseMatrix<ValueType> result = builder.build();
 
@@ -1331,6 +1515,11 @@ void SparseMatrix<ValueType>::dropZeroEntries() {
 template<typename ValueType>
 SparseMatrix<ValueType> SparseMatrix<ValueType>::selectRowsFromRowGroups(std::vector<index_type> const& rowGroupToRowIndexMapping,
                                                                          bool insertDiagonalEntries) const {
+#ifdef STORM_HAVE_INTELTBB
+    if (this->getEntryCount() >= minimalEntryCountForParallelConstruction) {
+        return selectRowsFromRowGroupsParallel(rowGroupToRowIndexMapping, insertDiagonalEntries);
+    }
+#endif
     // First, we need to count how many non-zero entries the resulting matrix will have and reserve space for
     // diagonal entries if requested.
     index_type subEntries = 0;
@@ -1423,6 +1612,69 @@ SparseMatrix<ValueType> SparseMatrix<ValueType>::selectRowsFromRowIndexSequence(
     return matrixBuilder.build();
 }
 
+template<typename ValueType>
+void SparseMatrix<ValueType>::restrictInPlace(storm::storage::BitVector const& rowsToKeep, storm::storage::BitVector const& columnsToKeep,
+                                              bool dropZeroEntries) {
+    STORM_LOG_ASSERT(rowsToKeep.size() == this->getRowCount() && columnsToKeep.size() == this->getColumnCount(), "Dimensions mismatch.");
+    STORM_LOG_THROW(!rowsToKeep.empty() && !columnsToKeep.empty(), storm::exceptions::InvalidArgumentException, "Cannot build empty submatrix.");
+    std::vector<index_type> newColumnIndices = columnsToKeep.getNumberOfSetBitsBeforeIndices();
+
+    // Rows and entries are only moved towards the front, so the compaction can be done in a single pass over the existing storage.
+    index_type newRow = 0;
+    index_type newEntry = 0;
+    index_type newNonzeroEntryCount = 0;
+    auto keepRow = [&](index_type row) {
+        index_type rowStart = rowIndications[row];
+        index_type rowEnd = rowIndications[row + 1];
+        rowIndications[newRow++] = newEntry;
+        for (index_type entry = rowStart; entry < rowEnd; ++entry) {
+            if (!columnsToKeep.get(columnsAndValues[entry].getColumn()) || (dropZeroEntries && storm::utility::isZero(columnsAndValues[entry].getValue()))) {
+                continue;
+            }
+            if (newEntry != entry) {
+                columnsAndValues[newEntry] = std::move(columnsAndValues[entry]);
+            }
+            columnsAndValues[newEntry].setColumn(newColumnIndices[columnsAndValues[newEntry].getColumn()]);
+            if (!storm::utility::isZero(columnsAndValues[newEntry].getValue())) {
+                ++newNonzeroEntryCount;
+            }
+            ++newEntry;
+        }
+    };
+
+    if (this->hasTrivialRowGrouping()) {
+        for (auto row : rowsToKeep) {
+            keepRow(row);
+        }
+        rowGroupIndices = boost::none;
+    } else {
+        std::vector<index_type>& groupIndices = rowGroupIndices.get();
+        index_type newGroup = 0;
+        // The group indices are overwritten as well, so the bounds of the current group have to be read before.
+        index_type groupStart = groupIndices.front();
+        for (index_type group = 0; group + 1 < groupIndices.size(); ++group) {
+            index_type groupEnd = groupIndices[group + 1];
+            index_type groupStartRow = newRow;
+            for (auto row = rowsToKeep.getNextSetIndex(groupStart); row < groupEnd; row = rowsToKeep.getNextSetIndex(row + 1)) {
+                keepRow(row);
+            }
+            if (newRow > groupStartRow) {
+                groupIndices[++newGroup] = newRow;
+            }
+            groupStart = groupEnd;
+        }
+        groupIndices.resize(newGroup + 1);
+    }
+    rowIndications[newRow] = newEntry;
+    rowIndications.resize(newRow + 1);
+    columnsAndValues.resize(newEntry);
+
+    rowCount = newRow;
+    columnCount = columnsToKeep.getNumberOfSetBits();
+    entryCount = newEntry;
+    nonzeroEntryCount = newNonzeroEntryCount;
+}
+
 template<typename ValueType>
 SparseMatrix<ValueType> SparseMatrix<ValueType>::permuteRows(std::vector<index_type> const& inversePermutation) const {
     // Now create the matrix to be returned with the appropriate size.
@@ -1433,10 +1685,7 @@ SparseMatrix<ValueType> SparseMatrix<ValueType>::permuteRows(std::vector<index_t
 
     for (index_type writeTo = 0; writeTo < inversePermutation.size(); ++writeTo) {
         index_type const& readFrom = inversePermutation[writeTo];
-        auto row = this->getRow(readFrom);
-        for (auto const& entry : row) {
-            matrixBuilder.addNextValue(writeTo, entry.getColumn(), entry.getValue());
-        }
+        matrixBuilder.addNextRow(writeTo, this->getRow(readFrom));
     }
     // Finally create matrix and return result.
     auto result = matrixBuilder.build();
@@ -1446,8 +1695,41 @@ SparseMatrix<ValueType> SparseMatrix<ValueType>::permuteRows(std::vector<index_t
     return result;
 }
 
+template<typename ValueType>
+SparseMatrix<ValueType> SparseMatrix<ValueType>::permuteRowGroupsAndColumns(std::vector<index_type> const& inverseRowGroupPermutation,
+                                                                            std::vector<index_type> const& columnPermutation) const {
+    STORM_LOG_ASSERT(inverseRowGroupPermutation.size() == this->getRowGroupCount(), "Unexpected size of the row group permutation.");
+    STORM_LOG_ASSERT(columnPermutation.size() == this->getColumnCount(), "Unexpected size of the column permutation.");
+    bool const trivialRowGrouping = this->hasTrivialRowGrouping();
+    SparseMatrixBuilder<ValueType> matrixBuilder(rowCount, columnCount, entryCount, true, !trivialRowGrouping, trivialRowGrouping ? 0 : getRowGroupCount());
+
+    std::vector<MatrixEntry<index_type, value_type>> newRow;
+    index_type newRowIndex = 0;
+    for (auto const& oldRowGroup : inverseRowGroupPermutation) {
+        if (!trivialRowGrouping) {
+            matrixBuilder.newRowGroup(newRowIndex);
+        }
+        for (auto const oldRowIndex : this->getRowGroupIndices(oldRowGroup)) {
+            // As the columns are permuted, the entries of the row need to be sorted again.
+            newRow.clear();
+            for (auto const& entry : this->getRow(oldRowIndex)) {
+                newRow.emplace_back(columnPermutation[entry.getColumn()], entry.getValue());
+            }
+            std::sort(newRow.begin(), newRow.end(), [](auto const& lhs, auto const& rhs) { return lhs.getColumn() < rhs.getColumn(); });
+            matrixBuilder.addNextRow(newRowIndex, newRow);
+            ++newRowIndex;
+        }
+    }
+    return matrixBuilder.build();
+}
+
 template<typename ValueType>
 SparseMatrix<ValueType> SparseMatrix<ValueType>::transpose(bool joinGroups, bool keepZeros) const {
+#ifdef STORM_HAVE_INTELTBB
+    if (this->getEntryCount() >= minimalEntryCountForParallelConstruction) {
+        return transposeParallel(joinGroups, keepZeros);
+    }
+#endif
     index_type rowCount = this->getColumnCount();
     index_type columnCount = joinGroups ? this->getRowGroupCount() : this->getRowCount();
     index_type entryCount;
@@ -1495,6 +1777,181 @@ SparseMatrix<ValueType> SparseMatrix<ValueType>::transpose(bool joinGroups, bool
     return transposedMatrix;
 }
 
+#ifdef STORM_HAVE_INTELTBB
+template<typename ValueType>
+SparseMatrix<ValueType> SparseMatrix<ValueType>::transposeParallel(bool joinGroups, bool keepZeros) const {
+    index_type rowCount = this->getColumnCount();
+    index_type columnCount = joinGroups ? this->getRowGroupCount() : this->getRowCount();
+
+    // First, we count how many entries each column has.
+    std::vector<std::atomic<index_type>> nextIndices(rowCount);
+    tbb::parallel_for(tbb::blocked_range<index_type>(0, this->getRowCount(), 100), [&](tbb::blocked_range<index_type> const& range) {
+        for (index_type row = range.begin(); row < range.end(); ++row) {
+            for (auto const& transition : this->getRow(row)) {
+                if (transition.getValue() != storm::utility::zero<ValueType>() || keepZeros) {
+                    nextIndices[transition.getColumn()].fetch_add(1, std::memory_order_relaxed);
+                }
+            }
+        }
+    });
+
+    // Now compute the accumulated offsets, which are also the indices for the next value to be added for each row of the transposed matrix.
+    std::vector<index_type> rowIndications(rowCount + 1);
+    for (index_type i = 0; i < rowCount; ++i) {
+        rowIndications[i + 1] = rowIndications[i] + nextIndices[i].load(std::memory_order_relaxed);
+        nextIndices[i].store(rowIndications[i], std::memory_order_relaxed);
+    }
+
+    // Fill in the entries. As the threads claim positions in an arbitrary order, we store the original row of each entry and sort the rows of the
+    // transposed matrix afterwards, which restores the order of the sequential transposition.
+    std::vector<MatrixEntry<index_type, ValueType>> columnsAndValues;
+    storm::utility::vector::reserveWithParallelFirstTouch(columnsAndValues, rowIndications.back(), &rowIndications);
+    columnsAndValues.resize(rowIndications.back());
+    tbb::parallel_for(tbb::blocked_range<index_type>(0, this->getRowCount(), 100), [&](tbb::blocked_range<index_type> const& range) {
+        for (index_type row = range.begin(); row < range.end(); ++row) {
+            for (auto const& transition : this->getRow(row)) {
+                if (transition.getValue() != storm::utility::zero<ValueType>() || keepZeros) {
+                    index_type position = nextIndices[transition.getColumn()].fetch_add(1, std::memory_order_relaxed);
+                    columnsAndValues[position] = MatrixEntry<index_type, ValueType>(row, transition.getValue());
+                }
+            }
+        }
+    });
+    // Retrieve the row groups before entering the parallel region, as they might be created on demand.
+    std::vector<index_type> const* groupIndices = joinGroups ? &this->getRowGroupIndices() : nullptr;
+    tbb::parallel_for(tbb::blocked_range<index_type>(0, rowCount, 100), [&](tbb::blocked_range<index_type> const& range) {
+        for (index_type row = range.begin(); row < range.end(); ++row) {
+            auto rowBegin = columnsAndValues.begin() + rowIndications[row];
+            auto rowEnd = columnsAndValues.begin() + rowIndications[row + 1];
+            std::sort(rowBegin, rowEnd, [](MatrixEntry<index_type, ValueType> const& a, MatrixEntry<index_type, ValueType> const& b) {
+                return a.getColumn() < b.getColumn();
+            });
+            if (groupIndices) {
+                for (auto entryIt = rowBegin; entryIt != rowEnd; ++entryIt) {
+                    entryIt->setColumn(std::upper_bound(groupIndices->begin(), groupIndices->end(), entryIt->getColumn()) - groupIndices->begin() - 1);
+                }
+            }
+        }
+    });
+
+    return SparseMatrix<ValueType>(columnCount, std::move(rowIndications), std::move(columnsAndValues), boost::none);
+}
+
+template<typename ValueType>
+SparseMatrix<ValueType> SparseMatrix<ValueType>::getSubmatrixParallel(storm::storage::BitVector const& rowGroupConstraint,
+                                                                      storm::storage::BitVector const& columnConstraint,
+                                                                      std::vector<index_type> const& rowGroupIndices, bool insertDiagonalEntries,
+                                                                      storm::storage::BitVector const& makeZeroColumns) const {
+    index_type submatrixColumnCount = columnConstraint.getNumberOfSetBits();
+    std::vector<index_type> columnBitsSetBeforeIndex = columnConstraint.getNumberOfSetBitsBeforeIndices();
+    std::unique_ptr<std::vector<index_type>> tmp;
+    if (rowGroupConstraint != columnConstraint) {
+        tmp = std::make_unique<std::vector<index_type>>(rowGroupConstraint.getNumberOfSetBitsBeforeIndices());
+    }
+    std::vector<index_type> const& rowBitsSetBeforeIndex = tmp ? *tmp : columnBitsSetBeforeIndex;
+
+    // Determine the rows of the submatrix together with the row group they belong to.
+    std::vector<index_type> subRowGroupIndices(1, 0);
+    std::vector<index_type> selectedRowGroups;
+    std::vector<index_type> subRowToRowGroup;
+    for (auto index : rowGroupConstraint) {
+        subRowGroupIndices.push_back(subRowGroupIndices.back() + rowGroupIndices[index + 1] - rowGroupIndices[index]);
+        subRowToRowGroup.insert(subRowToRowGroup.end(), rowGroupIndices[index + 1] - rowGroupIndices[index], selectedRowGroups.size());
+        selectedRowGroups.push_back(index);
+    }
+
+    auto writeRow = [&](index_type subRow, auto const& addEntry) {
+        index_type subRowGroup = subRowToRowGroup[subRow];
+        index_type index = selectedRowGroups[subRowGroup];
+        index_type row = rowGroupIndices[index] + subRow - subRowGroupIndices[subRowGroup];
+        bool insertedDiagonalElement = false;
+        for (auto const& entry : this->getRow(row)) {
+            if (columnConstraint.get(entry.getColumn()) && (makeZeroColumns.size() == 0 || !makeZeroColumns.get(entry.getColumn()))) {
+                if (columnBitsSetBeforeIndex[entry.getColumn()] == rowBitsSetBeforeIndex[index]) {
+                    insertedDiagonalElement = true;
+                } else if (insertDiagonalEntries && !insertedDiagonalElement && columnBitsSetBeforeIndex[entry.getColumn()] > rowBitsSetBeforeIndex[index]) {
+                    addEntry(subRowGroup, storm::utility::zero<ValueType>());
+                    insertedDiagonalElement = true;
+                }
+                addEntry(columnBitsSetBeforeIndex[entry.getColumn()], entry.getValue());
+            }
+        }
+        if (insertDiagonalEntries && !insertedDiagonalElement && subRowGroup < submatrixColumnCount) {
+            addEntry(subRowGroup, storm::utility::zero<ValueType>());
+        }
+    };
+
+    std::vector<index_type> subRowIndications;
+    std::vector<MatrixEntry<index_type, ValueType>> subColumnsAndValues;
+    constructRowsInParallel<ValueType>(subRowToRowGroup.size(), writeRow, subRowIndications, subColumnsAndValues);
+    boost::optional<std::vector<index_type>> resultRowGroupIndices;
+    if (!this->hasTrivialRowGrouping()) {
+        resultRowGroupIndices = std::move(subRowGroupIndices);
+    }
+    return SparseMatrix<ValueType>(submatrixColumnCount, std::move(subRowIndications), std::move(subColumnsAndValues), std::move(resultRowGroupIndices));
+}
+
+template<typename ValueType>
+SparseMatrix<ValueType> SparseMatrix<ValueType>::restrictRowsParallel(storm::storage::BitVector const& rowsToKeep, bool allowEmptyRowGroups) const {
+    // Determine the kept rows. The row grouping will always be considered as nontrivial.
+    std::vector<index_type> keptRows;
+    keptRows.reserve(rowsToKeep.getNumberOfSetBits());
+    std::vector<index_type> newRowGroupIndices;
+    newRowGroupIndices.reserve(this->getRowGroupCount() + 1);
+    for (index_type rowGroup = 0; rowGroup < this->getRowGroupCount(); ++rowGroup) {
+        newRowGroupIndices.push_back(keptRows.size());
+        for (index_type row = rowsToKeep.getNextSetIndex(this->getRowGroupIndices()[rowGroup]); row < this->getRowGroupIndices()[rowGroup + 1];
+             row = rowsToKeep.getNextSetIndex(row + 1)) {
+            keptRows.push_back(row);
+        }
+        STORM_LOG_THROW(allowEmptyRowGroups || newRowGroupIndices.back() != keptRows.size(), storm::exceptions::InvalidArgumentException,
+                        "Empty rows are not allowed, but row group " << rowGroup << " is empty.");
+    }
+    newRowGroupIndices.push_back(keptRows.size());
+
+    auto writeRow = [&](index_type newRow, auto const& addEntry) {
+        for (auto const& entry : this->getRow(keptRows[newRow])) {
+            addEntry(entry.getColumn(), entry.getValue());
+        }
+    };
+
+    std::vector<index_type> newRowIndications;
+    std::vector<MatrixEntry<index_type, ValueType>> newColumnsAndValues;
+    constructRowsInParallel<ValueType>(keptRows.size(), writeRow, newRowIndications, newColumnsAndValues);
+    return SparseMatrix<ValueType>(this->getColumnCount(), std::move(newRowIndications), std::move(newColumnsAndValues), std::move(newRowGroupIndices));
+}
+
+template<typename ValueType>
+SparseMatrix<ValueType> SparseMatrix<ValueType>::selectRowsFromRowGroupsParallel(std::vector<index_type> const& rowGroupToRowIndexMapping,
+                                                                                 bool insertDiagonalEntries) const {
+    std::vector<index_type> const& groupIndices = this->getRowGroupIndices();
+    auto writeRow = [&](index_type rowGroupIndex, auto const& addEntry) {
+        if (rowGroupIndex >= rowGroupToRowIndexMapping.size()) {
+            return;
+        }
+        // This also inserts a zero element on the diagonal if there is no entry yet.
+        bool insertedDiagonalElement = false;
+        for (auto const& entry : this->getRow(groupIndices[rowGroupIndex] + rowGroupToRowIndexMapping[rowGroupIndex])) {
+            if (entry.getColumn() == rowGroupIndex) {
+                insertedDiagonalElement = true;
+            } else if (insertDiagonalEntries && !insertedDiagonalElement && entry.getColumn() > rowGroupIndex) {
+                addEntry(rowGroupIndex, storm::utility::zero<ValueType>());
+                insertedDiagonalElement = true;
+            }
+            addEntry(entry.getColumn(), entry.getValue());
+        }
+        if (insertDiagonalEntries && !insertedDiagonalElement) {
+            addEntry(rowGroupIndex, storm::utility::zero<ValueType>());
+        }
+    };
+
+    std::vector<index_type> newRowIndications;
+    std::vector<MatrixEntry<index_type, ValueType>> newColumnsAndValues;
+    constructRowsInParallel<ValueType>(groupIndices.size() - 1, writeRow, newRowIndications, newColumnsAndValues);
+    return SparseMatrix<ValueType>(columnCount, std::move(newRowIndications), std::move(newColumnsAndValues), boost::none);
+}
+#endif
+
 template<typename ValueType>
 SparseMatrix<ValueType> SparseMatrix<ValueType>::transposeSelectedRowsFromRowGroups(std::vector<uint64_t> const& rowGroupChoices, bool keepZeros) const {
     index_type rowCount = this->getColumnCount();
@@ -180,6 +180,54 @@ class SparseMatrixBuilder {
      */
     void addNextValue(index_type row, index_type column, value_type const& value);
 
+    /*!
+     * Sets the matrix entry at the given row and column to the given value (see above). If the entry can directly be appended, the value is
+     * moved into the matrix, which avoids copying values that are expensive to copy (e.g., rational functions).
+     *
+     * @param row The row in which the matrix entry is to be set.
+     * @param column The column in which the matrix entry is to be set.
+     * @param value The value that is to be set at the specified row and column.
+     */
+    void addNextValue(index_type row, index_type column, value_type&& value);
+
+    /*!
+     * Adds all given entries to the given row. This is equivalent to calling addNextValue for each entry (in particular, the same constraints
+     * apply), but if the entries are sorted by column without duplicates, they are appended in bulk.
+     *
+     * @param row The row to which the entries are added.
+     * @param entries The entries that are to be added.
+     */
+    void addNextRow(index_type row, std::vector<MatrixEntry<index_type, value_type>> const& entries);
+
+    /*!
+     * Adds all entries of the given row (of some other matrix) to the given row (see above).
+     *
+     * @param row The row to which the entries are added.
+     * @param entries The row whose entries are to be added.
+     */
+    void addNextRow(index_type row, typename SparseMatrix<value_type>::const_rows const& entries);
+
+    /*!
+     * Reserves storage for the given number of rows, entries and row groups of the resulting matrix. This is useful if these numbers are only
+     * known after the builder has been created. The numbers are not enforced on the resulting matrix.
+     *
+     * @param rows The number of rows of the resulting matrix.
+     * @param entries The number of entries of the resulting matrix.
+     * @param rowGroups The number of row groups of the resulting matrix (only relevant for a custom row grouping).
+     */
+    void reserve(index_type rows, index_type entries, index_type rowGroups = 0);
+
+    /*!
+     * Appends the rows (and row groups) of the given builder to this builder, such that the first row of the other builder becomes the given
+     * row of this builder. The entries are moved, so consecutive blocks of rows can be constructed by separate builders (e.g., by parallel
+     * workers) and are then merged in order. Both builders have to agree on whether they use a custom row grouping. All pending entries of
+     * this builder must be in rows before the given row.
+     *
+     * @param other The builder whose rows are appended. It must not be used afterwards.
+     * @param firstRow The row of this builder at which the rows of the other builder start.
+     */
+    void appendRows(SparseMatrixBuilder<value_type>&& other, index_type firstRow);
+
     /*!
      * Starts a new row group in the matrix. Note that this needs to be called before any entries in the new row
      * group are added.
@@ -250,6 +298,16 @@ class SparseMatrixBuilder {
     void addDiagonalEntry(index_type row, ValueType const& value);
 
    private:
+    // Adds the given entries to the given row, appending them in bulk if possible.
+    template<typename InputIterator>
+    void addNextRowEntries(index_type row, InputIterator first, InputIterator last);
+
+    // Adds the pending diagonal entry (if any) at its position.
+    void flushPendingDiagonalEntry();
+
+    // Checks that the entries added so far do not exceed the dimensions given upon construction (if they are to be enforced).
+    void checkInitialDimensions() const;
+
     // A flag indicating whether a row count was set upon construction.
     bool initialRowCountSet;
 
@@ -544,6 +602,11 @@ class SparseMatrix {
      */
     index_type getNonzeroEntryCount() const;
 
+    /*!
+     * Returns (an approximation of) the number of bytes occupied by this matrix, including reserved but unused capacity.
+     */
+    uint64_t getSizeInMemory() const;
+
     /*!
      * Recompute the nonzero entry count
      */
@@ -754,6 +817,17 @@ class SparseMatrix {
      */
     SparseMatrix restrictRows(storm::storage::BitVector const& rowsToKeep, bool allowEmptyRowGroups = false) const;
 
+    /*!
+     * Restricts this matrix to the given rows and columns in place. This has the same effect as assigning getSubmatrix(false, rowsToKeep, columnsToKeep)
+     * to this matrix, i.e., the kept columns are renumbered consecutively and row groups without kept rows are dropped. However, the entries are
+     * compacted within the existing storage, so no second copy of the matrix is created.
+     *
+     * @param rowsToKeep A bit vector indicating which rows to keep.
+     * @param columnsToKeep A bit vector indicating which columns to keep.
+     * @param dropZeroEntries If set, zero entries are dropped as well.
+     */
+    void restrictInPlace(storm::storage::BitVector const& rowsToKeep, storm::storage::BitVector const& columnsToKeep, bool dropZeroEntries = false);
+
     /*
      * Permute rows of the matrix according to the vector.
      * That is, in row i, write the entry of row inversePermutation[i].
@@ -762,6 +836,17 @@ class SparseMatrix {
      */
     SparseMatrix permuteRows(std::vector<index_type> const& inversePermutation) const;
 
+    /*!
+     * Permutes the row groups and the columns of this matrix.
+     * That is, the i'th row group of the result consists of the rows of row group inverseRowGroupPermutation[i] (in their original order)
+     * and an entry in column j is moved to column columnPermutation[j].
+     * If the row grouping is trivial, each row is considered as a row group of its own.
+     *
+     * @param inverseRowGroupPermutation for each new row group the old row group. Must be a permutation.
+     * @param columnPermutation for each old column the new column. Must be a permutation.
+     */
+    SparseMatrix permuteRowGroupsAndColumns(std::vector<index_type> const& inverseRowGroupPermutation, std::vector<index_type> const& columnPermutation) const;
+
     /*!
      * Returns a copy of this matrix that only considers entries in the selected rows.
      * Non-selected rows will not have any entries
@@ -1215,6 +1300,20 @@ class SparseMatrix {
                               std::vector<index_type> const& rowGroupIndices, bool insertDiagonalEntries = false,
                               storm::storage::BitVector const& makeZeroColumns = storm::storage::BitVector()) const;
 
+#ifdef STORM_HAVE_INTELTBB
+    /*!
+     * Parallel counterparts of the methods above that are used for large matrices. Instead of passing the entries through a matrix builder, the
+     * sizes of all rows of the result are determined concurrently, a prefix sum over the sizes yields the row indications and finally all rows
+     * are written concurrently into storage of the exact size. The results coincide with the ones of the sequential methods.
+     */
+    SparseMatrix transposeParallel(bool joinGroups, bool keepZeros) const;
+    SparseMatrix getSubmatrixParallel(storm::storage::BitVector const& rowGroupConstraint, storm::storage::BitVector const& columnConstraint,
+                                      std::vector<index_type> const& rowGroupIndices, bool insertDiagonalEntries,
+                                      storm::storage::BitVector const& makeZeroColumns) const;
+    SparseMatrix restrictRowsParallel(storm::storage::BitVector const& rowsToKeep, bool allowEmptyRowGroups) const;
+    SparseMatrix selectRowsFromRowGroupsParallel(std::vector<index_type> const& rowGroupToRowIndexMapping, bool insertDiagonalEntries) const;
+#endif
+
     // The number of rows of the matrix.
     index_type rowCount;
 
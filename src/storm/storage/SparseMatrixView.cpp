@@ -0,0 +1,80 @@
+#include "storm/storage/SparseMatrixView.h"
+
+#include "storm/adapters/RationalNumberAdapter.h"
+#include "storm/utility/macros.h"
+
+namespace storm {
+namespace storage {
+
+template<typename ValueType>
+SparseMatrixView<ValueType>::SparseMatrixView(storm::storage::SparseMatrix<ValueType> const& matrix, storm::storage::BitVector const& rowGroupConstraint,
+                                              storm::storage::BitVector const& columnConstraint)
+    : matrix(&matrix),
+      rowGroupConstraint(rowGroupConstraint),
+      columnConstraint(columnConstraint),
+      columnRemap(columnConstraint.getNumberOfSetBitsBeforeIndices()),
+      entryCount(0) {
+    STORM_LOG_ASSERT(rowGroupConstraint.size() == matrix.getRowGroupCount(), "Dimensions mismatch.");
+    STORM_LOG_ASSERT(columnConstraint.size() == matrix.getColumnCount(), "Dimensions mismatch.");
+    rowGroupIndices.reserve(rowGroupConstraint.getNumberOfSetBits() + 1);
+    rowGroupIndices.push_back(0);
+    for (auto rowGroup : rowGroupConstraint) {
+        for (auto row : matrix.getRowGroupIndices(rowGroup)) {
+            rows.push_back(row);
+            for (auto const& entry : matrix.getRow(row)) {
+                if (columnConstraint.get(entry.getColumn())) {
+                    ++entryCount;
+                }
+            }
+        }
+        rowGroupIndices.push_back(rows.size());
+    }
+}
+
+template<typename ValueType>
+uint64_t SparseMatrixView<ValueType>::getRowCount() const {
+    return rows.size();
+}
+
+template<typename ValueType>
+uint64_t SparseMatrixView<ValueType>::getColumnCount() const {
+    return columnConstraint.getNumberOfSetBits();
+}
+
+template<typename ValueType>
+uint64_t SparseMatrixView<ValueType>::getEntryCount() const {
+    return entryCount;
+}
+
+template<typename ValueType>
+uint64_t SparseMatrixView<ValueType>::getRowGroupCount() const {
+    return rowGroupIndices.size() - 1;
+}
+
+template<typename ValueType>
+std::vector<uint64_t> const& SparseMatrixView<ValueType>::getRowGroupIndices() const {
+    return rowGroupIndices;
+}
+
+template<typename ValueType>
+bool SparseMatrixView<ValueType>::hasTrivialRowGrouping() const {
+    return matrix->hasTrivialRowGrouping();
+}
+
+template<typename ValueType>
+storm::storage::SparseMatrix<ValueType> SparseMatrixView<ValueType>::toSparseMatrix() const {
+    return matrix->getSubmatrix(true, rowGroupConstraint, columnConstraint);
+}
+
+template<typename ValueType>
+uint64_t SparseMatrixView<ValueType>::getSizeInMemory() const {
+    return sizeof(*this) + (rowGroupConstraint.size() + columnConstraint.size()) / 8 +
+           sizeof(uint64_t) * (columnRemap.size() + rows.size() + rowGroupIndices.size());
+}
+
+template class SparseMatrixView<double>;
+template class SparseMatrixView<storm::RationalNumber>;
+template class SparseMatrixView<storm::Interval>;
+
+}  // namespace storage
+}  // namespace storm
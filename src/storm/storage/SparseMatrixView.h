@@ -0,0 +1,82 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include "storm/storage/BitVector.h"
+#include "storm/storage/SparseMatrix.h"
+
+namespace storm {
+namespace storage {
+
+/*!
+ * A read-only view on the submatrix of a sparse matrix that keeps the given row groups and columns, i.e., the matrix that
+ * matrix.getSubmatrix(true, rowGroupConstraint, columnConstraint) would return. Instead of copying the entries, the view filters the entries of the
+ * viewed matrix on the fly and maps their columns to the columns of the submatrix. It only stores the selected rows and a column remap table, which
+ * saves the memory of the copy in particular if most of the rows are kept.
+ *
+ * The viewed matrix must not be modified or destroyed while the view is used.
+ */
+template<typename ValueType>
+class SparseMatrixView {
+   public:
+    /*!
+     * Creates a view on the submatrix of the given matrix.
+     * @param matrix the viewed matrix
+     * @param rowGroupConstraint the row groups to keep
+     * @param columnConstraint the columns to keep
+     */
+    SparseMatrixView(storm::storage::SparseMatrix<ValueType> const& matrix, storm::storage::BitVector const& rowGroupConstraint,
+                     storm::storage::BitVector const& columnConstraint);
+
+    uint64_t getRowCount() const;
+    uint64_t getColumnCount() const;
+    uint64_t getEntryCount() const;
+    uint64_t getRowGroupCount() const;
+    std::vector<uint64_t> const& getRowGroupIndices() const;
+    bool hasTrivialRowGrouping() const;
+
+    /*!
+     * Invokes the given function for each entry of the given row of the submatrix (in ascending order of the columns).
+     * @param function invoked with the column (of the submatrix) and the value of each entry
+     */
+    template<typename FunctionType>
+    void forEachEntry(uint64_t row, FunctionType&& function) const {
+        for (auto const& entry : matrix->getRow(rows[row])) {
+            if (columnConstraint.get(entry.getColumn())) {
+                function(columnRemap[entry.getColumn()], entry.getValue());
+            }
+        }
+    }
+
+    /*!
+     * Copies the viewed submatrix.
+     */
+    storm::storage::SparseMatrix<ValueType> toSparseMatrix() const;
+
+    /*!
+     * @return the number of bytes occupied by this view (excluding the viewed matrix)
+     */
+    uint64_t getSizeInMemory() const;
+
+   private:
+    // The viewed matrix.
+    storm::storage::SparseMatrix<ValueType> const* matrix;
+
+    storm::storage::BitVector rowGroupConstraint;
+    storm::storage::BitVector columnConstraint;
+
+    // For each column of the viewed matrix the corresponding column of the submatrix (only meaningful for the columns that are kept).
+    std::vector<uint64_t> columnRemap;
+
+    // For each row of the submatrix the corresponding row of the viewed matrix.
+    std::vector<uint64_t> rows;
+
+    // The row groups of the submatrix.
+    std::vector<uint64_t> rowGroupIndices;
+
+    uint64_t entryCount;
+};
+
+}  // namespace storage
+}  // namespace storm
@@ -1,6 +1,12 @@
 #include "storm/storage/StronglyConnectedComponentDecomposition.h"
 
+#include <atomic>
+#include <numeric>
+
+#include "storm/adapters/IntelTbbAdapter.h"
 #include "storm/adapters/RationalFunctionAdapter.h"
+#include "storm/settings/SettingsManager.h"
+#include "storm/settings/modules/CoreSettings.h"
 #include "storm/storage/SparseMatrix.h"
 #include "storm/utility/constants.h"
 #include "storm/utility/macros.h"
@@ -223,6 +229,370 @@ void performSccDecompositionGCM(storm::storage::SparseMatrix<ValueType> const& t
     }
 }
 
+#ifdef STORM_HAVE_INTELTBB
+namespace {
+// Smaller subsystems are decomposed sequentially, as the parallel decomposition does not pay off.
+uint64_t const minimalNumberOfStatesForParallelDecomposition = 1ull << 16;
+
+// Once fewer states are left without an SCC, their SCCs are computed sequentially.
+uint64_t const minimalNumberOfStatesForColoring = 1ull << 12;
+
+// Frontiers with fewer elements are processed sequentially.
+uint64_t const minimalFrontierSizeForParallelProcessing = 1024;
+
+uint64_t const noScc = std::numeric_limits<uint64_t>::max();
+
+bool useParallelDecomposition(uint64_t numberOfStates) {
+    return numberOfStates >= minimalNumberOfStatesForParallelDecomposition && storm::settings::hasModule<storm::settings::modules::CoreSettings>() &&
+           storm::settings::getModule<storm::settings::modules::CoreSettings>().isParallelGraphAnalysisSet();
+}
+
+/*!
+ * The transitions between the states of the considered subsystem in both directions, where self-loops are omitted.
+ */
+struct StateGraph {
+    template<typename Function>
+    void forEachSuccessor(uint64_t state, Function const& function) const {
+        for (uint64_t index = successorIndications[state]; index < successorIndications[state + 1]; ++index) {
+            function(successors[index]);
+        }
+    }
+
+    template<typename Function>
+    void forEachPredecessor(uint64_t state, Function const& function) const {
+        for (uint64_t index = predecessorIndications[state]; index < predecessorIndications[state + 1]; ++index) {
+            function(predecessors[index]);
+        }
+    }
+
+    std::vector<uint64_t> successorIndications, successors, predecessorIndications, predecessors;
+    storm::storage::BitVector selfLoopStates;
+};
+
+template<typename ValueType>
+StateGraph buildStateGraph(storm::storage::SparseMatrix<ValueType> const& transitionMatrix, storm::OptionalRef<storm::storage::BitVector const> subsystem,
+                           storm::OptionalRef<storm::storage::BitVector const> choices, std::vector<uint64_t> const& states) {
+    uint64_t numberOfStates = transitionMatrix.getRowGroupCount();
+    // Retrieving the row groups is not thread-safe if they are created on demand.
+    auto const& rowGroupIndices = transitionMatrix.getRowGroupIndices();
+    auto forEachMatrixSuccessor = [&](uint64_t state, auto const& function) {
+        for (uint64_t row = rowGroupIndices[state], rowEnd = rowGroupIndices[state + 1]; row != rowEnd; ++row) {
+            if (choices && !choices->get(row)) {
+                continue;
+            }
+            for (auto const& successor : transitionMatrix.getRow(row)) {
+                if ((!subsystem || subsystem->get(successor.getColumn())) && !storm::utility::isZero(successor.getValue())) {
+                    function(successor.getColumn());
+                }
+            }
+        }
+    };
+
+    StateGraph graph;
+    graph.selfLoopStates = storm::storage::BitVector(numberOfStates);
+    graph.successorIndications.assign(numberOfStates + 1, 0);
+    std::vector<std::atomic<uint64_t>> predecessorCounts(numberOfStates);
+    tbb::parallel_for(tbb::blocked_range<uint64_t>(0, states.size()), [&](tbb::blocked_range<uint64_t> const& range) {
+        for (uint64_t index = range.begin(); index < range.end(); ++index) {
+            uint64_t state = states[index];
+            forEachMatrixSuccessor(state, [&](uint64_t successor) {
+                if (successor == state) {
+                    graph.selfLoopStates.setAtomic(state);
+                } else {
+                    ++graph.successorIndications[state + 1];
+                    predecessorCounts[successor].fetch_add(1, std::memory_order_relaxed);
+                }
+            });
+        }
+    });
+    graph.predecessorIndications.assign(numberOfStates + 1, 0);
+    for (uint64_t state = 0; state < numberOfStates; ++state) {
+        graph.successorIndications[state + 1] += graph.successorIndications[state];
+        graph.predecessorIndications[state + 1] = graph.predecessorIndications[state] + predecessorCounts[state].load(std::memory_order_relaxed);
+        // From now on, the counts serve as the next free positions for the predecessors of the state.
+        predecessorCounts[state].store(graph.predecessorIndications[state], std::memory_order_relaxed);
+    }
+
+    graph.successors.resize(graph.successorIndications.back());
+    graph.predecessors.resize(graph.predecessorIndications.back());
+    tbb::parallel_for(tbb::blocked_range<uint64_t>(0, states.size()), [&](tbb::blocked_range<uint64_t> const& range) {
+        for (uint64_t index = range.begin(); index < range.end(); ++index) {
+            uint64_t state = states[index];
+            uint64_t position = graph.successorIndications[state];
+            forEachMatrixSuccessor(state, [&](uint64_t successor) {
+                if (successor != state) {
+                    graph.successors[position++] = successor;
+                    graph.predecessors[predecessorCounts[successor].fetch_add(1, std::memory_order_relaxed)] = state;
+                }
+            });
+        }
+    });
+    return graph;
+}
+
+/*!
+ * Processes the given frontier level by level. Processing an element means calling process(element, level, push), where push(e) adds e
+ * to the frontier of the next level. Duplicates are removed from every frontier.
+ */
+template<typename ProcessFunction>
+void processLevelSynchronously(std::vector<uint64_t>&& frontier, ProcessFunction const& process) {
+    tbb::enumerable_thread_specific<std::vector<uint64_t>> nextFrontiers;
+    auto processElements = [&](uint64_t begin, uint64_t end, uint64_t level, std::vector<uint64_t>& nextFrontier) {
+        auto push = [&nextFrontier](uint64_t element) { nextFrontier.push_back(element); };
+        for (uint64_t index = begin; index < end; ++index) {
+            process(frontier[index], level, push);
+        }
+    };
+
+    for (uint64_t level = 0; !frontier.empty(); ++level) {
+        if (frontier.size() < minimalFrontierSizeForParallelProcessing) {
+            processElements(0, frontier.size(), level, nextFrontiers.local());
+        } else {
+            tbb::parallel_for(tbb::blocked_range<uint64_t>(0, frontier.size(), 256), [&](tbb::blocked_range<uint64_t> const& range) {
+                processElements(range.begin(), range.end(), level, nextFrontiers.local());
+            });
+        }
+        frontier.clear();
+        for (auto& nextFrontier : nextFrontiers) {
+            frontier.insert(frontier.end(), nextFrontier.begin(), nextFrontier.end());
+            nextFrontier.clear();
+        }
+        tbb::parallel_sort(frontier.begin(), frontier.end());
+        frontier.erase(std::unique(frontier.begin(), frontier.end()), frontier.end());
+    }
+}
+
+/*!
+ * Repeatedly removes the given states that have no predecessor or no successor among the remaining states. Each removed state forms an SCC on
+ * its own and is labeled accordingly.
+ */
+void trimStates(StateGraph const& graph, std::vector<uint64_t> const& states, std::vector<uint64_t>& sccLabels) {
+    uint64_t numberOfStates = sccLabels.size();
+    std::vector<std::atomic<uint64_t>> predecessorCounts(numberOfStates), successorCounts(numberOfStates);
+    storm::storage::BitVector trimmedStates(numberOfStates);
+    tbb::enumerable_thread_specific<std::vector<uint64_t>> initialFrontiers;
+    tbb::parallel_for(tbb::blocked_range<uint64_t>(0, states.size()), [&](tbb::blocked_range<uint64_t> const& range) {
+        for (uint64_t index = range.begin(); index < range.end(); ++index) {
+            uint64_t state = states[index];
+            uint64_t predecessorCount = 0, successorCount = 0;
+            graph.forEachPredecessor(state, [&](uint64_t predecessor) { predecessorCount += sccLabels[predecessor] == noScc; });
+            graph.forEachSuccessor(state, [&](uint64_t successor) { successorCount += sccLabels[successor] == noScc; });
+            predecessorCounts[state].store(predecessorCount, std::memory_order_relaxed);
+            successorCounts[state].store(successorCount, std::memory_order_relaxed);
+            if ((predecessorCount == 0 || successorCount == 0) && trimmedStates.setAtomic(state)) {
+                initialFrontiers.local().push_back(state);
+            }
+        }
+    });
+    std::vector<uint64_t> frontier;
+    for (auto const& initialFrontier : initialFrontiers) {
+        frontier.insert(frontier.end(), initialFrontier.begin(), initialFrontier.end());
+    }
+
+    // The labels are only read while trimming and are assigned afterwards.
+    processLevelSynchronously(std::move(frontier), [&](uint64_t state, uint64_t, auto const& push) {
+        graph.forEachSuccessor(state, [&](uint64_t successor) {
+            if (sccLabels[successor] == noScc && predecessorCounts[successor].fetch_sub(1, std::memory_order_relaxed) == 1 &&
+                trimmedStates.setAtomic(successor)) {
+                push(successor);
+            }
+        });
+        graph.forEachPredecessor(state, [&](uint64_t predecessor) {
+            if (sccLabels[predecessor] == noScc && successorCounts[predecessor].fetch_sub(1, std::memory_order_relaxed) == 1 &&
+                trimmedStates.setAtomic(predecessor)) {
+                push(predecessor);
+            }
+        });
+    });
+    trimmedStates.forEachSetIndex([&sccLabels](uint64_t state) { sccLabels[state] = state; });
+}
+
+bool raiseAtomically(std::atomic<uint64_t>& value, uint64_t newValue) {
+    uint64_t currentValue = value.load(std::memory_order_relaxed);
+    while (currentValue < newValue) {
+        if (value.compare_exchange_weak(currentValue, newValue, std::memory_order_relaxed)) {
+            return true;
+        }
+    }
+    return false;
+}
+
+/*!
+ * Performs one round of the coloring algorithm on the given states: every state receives the largest index of a state that can reach it
+ * (its color). The states of a color that can reach the state whose index is the color then form an SCC.
+ */
+void labelSccsByColoring(StateGraph const& graph, std::vector<uint64_t> const& states, std::vector<uint64_t>& sccLabels) {
+    std::vector<std::atomic<uint64_t>> colors(sccLabels.size());
+    tbb::parallel_for(tbb::blocked_range<uint64_t>(0, states.size()), [&](tbb::blocked_range<uint64_t> const& range) {
+        for (uint64_t index = range.begin(); index < range.end(); ++index) {
+            colors[states[index]].store(states[index], std::memory_order_relaxed);
+        }
+    });
+    processLevelSynchronously(std::vector<uint64_t>(states), [&](uint64_t state, uint64_t, auto const& push) {
+        uint64_t color = colors[state].load(std::memory_order_relaxed);
+        graph.forEachSuccessor(state, [&](uint64_t successor) {
+            if (sccLabels[successor] == noScc && raiseAtomically(colors[successor], color)) {
+                push(successor);
+            }
+        });
+    });
+
+    // The states of different colors are disjoint, so the backward searches do not interfere with each other.
+    tbb::parallel_for(tbb::blocked_range<uint64_t>(0, states.size()), [&](tbb::blocked_range<uint64_t> const& range) {
+        std::vector<uint64_t> stack;
+        for (uint64_t index = range.begin(); index < range.end(); ++index) {
+            uint64_t root = states[index];
+            if (colors[root].load(std::memory_order_relaxed) != root) {
+                continue;
+            }
+            sccLabels[root] = root;
+            stack.push_back(root);
+            while (!stack.empty()) {
+                uint64_t state = stack.back();
+                stack.pop_back();
+                graph.forEachPredecessor(state, [&](uint64_t predecessor) {
+                    if (colors[predecessor].load(std::memory_order_relaxed) == root && sccLabels[predecessor] == noScc) {
+                        sccLabels[predecessor] = root;
+                        stack.push_back(predecessor);
+                    }
+                });
+            }
+        }
+    });
+}
+
+std::vector<uint64_t> getUnlabeledStates(std::vector<uint64_t> const& states, std::vector<uint64_t> const& sccLabels) {
+    std::vector<uint64_t> result;
+    std::copy_if(states.begin(), states.end(), std::back_inserter(result), [&sccLabels](uint64_t state) { return sccLabels[state] == noScc; });
+    return result;
+}
+
+/*!
+ * Computes the SCC decomposition using a multistep approach: states that trivially form SCCs on their own are trimmed and the remaining
+ * SCCs are found by coloring. Once only few states are left, their SCCs are computed sequentially.
+ * The SCCs are ordered by their depth and, within the same depth, by their smallest state. This is a reverse topological order that does not
+ * depend on the scheduling of the threads.
+ */
+template<typename ValueType>
+void performSccDecompositionParallel(storm::storage::SparseMatrix<ValueType> const& transitionMatrix,
+                                     StronglyConnectedComponentDecompositionOptions const& options, std::vector<uint64_t> const& states,
+                                     SccDecompositionResult& result, SccDecompositionMemoryCache& cache) {
+    uint64_t numberOfStates = transitionMatrix.getRowGroupCount();
+    StateGraph graph = buildStateGraph(transitionMatrix, options.optSubsystem, options.optChoices, states);
+
+    // Label every state with a representative state of its SCC.
+    std::vector<uint64_t> sccLabels(numberOfStates, noScc);
+    std::vector<uint64_t> remainingStates = states;
+    while (!remainingStates.empty()) {
+        trimStates(graph, remainingStates, sccLabels);
+        remainingStates = getUnlabeledStates(remainingStates, sccLabels);
+        if (remainingStates.size() < minimalNumberOfStatesForColoring) {
+            break;
+        }
+        labelSccsByColoring(graph, remainingStates, sccLabels);
+        remainingStates = getUnlabeledStates(remainingStates, sccLabels);
+    }
+    if (!remainingStates.empty()) {
+        storm::storage::BitVector remainingSubsystem(numberOfStates);
+        for (auto state : remainingStates) {
+            remainingSubsystem.set(state);
+        }
+        SccDecompositionResult remainingResult;
+        remainingResult.initialize(numberOfStates, false);
+        cache.initialize(numberOfStates);
+        uint64_t currentIndex = 0;
+        for (auto state : remainingStates) {
+            if (!cache.hasPreorderNumber(state)) {
+                performSccDecompositionGCM(transitionMatrix, remainingSubsystem, options.optChoices, false, state, currentIndex, remainingResult, cache);
+            }
+        }
+        std::vector<uint64_t> representatives(remainingResult.sccCount, noScc);
+        for (auto state : remainingStates) {
+            uint64_t& representative = representatives[remainingResult.stateToSccMapping[state]];
+            if (representative == noScc) {
+                representative = state;
+            }
+            sccLabels[state] = representative;
+        }
+    }
+
+    // Number the SCCs by their smallest state and collect their states.
+    std::vector<uint64_t> labelToScc(numberOfStates, noScc);
+    std::vector<uint64_t> sccSizes;
+    for (auto state : states) {
+        uint64_t& scc = labelToScc[sccLabels[state]];
+        if (scc == noScc) {
+            scc = sccSizes.size();
+            sccSizes.push_back(0);
+        }
+        ++sccSizes[scc];
+    }
+    uint64_t sccCount = sccSizes.size();
+    std::vector<uint64_t> sccIndications(sccCount + 1, 0);
+    for (uint64_t scc = 0; scc < sccCount; ++scc) {
+        sccIndications[scc + 1] = sccIndications[scc] + sccSizes[scc];
+    }
+    std::vector<uint64_t> sccStates(states.size());
+    for (auto state : states) {
+        sccStates[sccIndications[labelToScc[sccLabels[state]]] + --sccSizes[labelToScc[sccLabels[state]]]] = state;
+    }
+    auto getScc = [&](uint64_t state) { return labelToScc[sccLabels[state]]; };
+
+    // Compute the depths of the SCCs by repeatedly removing the SCCs all of whose successor SCCs have been removed.
+    std::vector<std::atomic<uint64_t>> successorEdgeCounts(sccCount);
+    tbb::enumerable_thread_specific<std::vector<uint64_t>> bottomSccs;
+    tbb::parallel_for(tbb::blocked_range<uint64_t>(0, sccCount), [&](tbb::blocked_range<uint64_t> const& range) {
+        for (uint64_t scc = range.begin(); scc < range.end(); ++scc) {
+            uint64_t successorEdgeCount = 0;
+            for (uint64_t index = sccIndications[scc]; index < sccIndications[scc + 1]; ++index) {
+                graph.forEachSuccessor(sccStates[index], [&](uint64_t successor) { successorEdgeCount += getScc(successor) != scc; });
+            }
+            successorEdgeCounts[scc].store(successorEdgeCount, std::memory_order_relaxed);
+            if (successorEdgeCount == 0) {
+                bottomSccs.local().push_back(scc);
+            }
+        }
+    });
+    std::vector<uint64_t> frontier;
+    for (auto const& threadBottomSccs : bottomSccs) {
+        frontier.insert(frontier.end(), threadBottomSccs.begin(), threadBottomSccs.end());
+    }
+    std::vector<uint64_t> sccDepths(sccCount);
+    processLevelSynchronously(std::move(frontier), [&](uint64_t scc, uint64_t level, auto const& push) {
+        sccDepths[scc] = level;
+        for (uint64_t index = sccIndications[scc]; index < sccIndications[scc + 1]; ++index) {
+            graph.forEachPredecessor(sccStates[index], [&](uint64_t predecessor) {
+                uint64_t predecessorScc = getScc(predecessor);
+                if (predecessorScc != scc && successorEdgeCounts[predecessorScc].fetch_sub(1, std::memory_order_relaxed) == 1) {
+                    push(predecessorScc);
+                }
+            });
+        }
+    });
+
+    // Order the SCCs by their depth, where the sort is stable w.r.t. the smallest states.
+    std::vector<uint64_t> sccOrder(sccCount);
+    std::iota(sccOrder.begin(), sccOrder.end(), 0);
+    std::stable_sort(sccOrder.begin(), sccOrder.end(), [&sccDepths](uint64_t first, uint64_t second) { return sccDepths[first] < sccDepths[second]; });
+    result.sccCount = sccCount;
+    for (uint64_t sccIndex = 0; sccIndex < sccCount; ++sccIndex) {
+        uint64_t scc = sccOrder[sccIndex];
+        bool nonSingletonScc = sccIndications[scc + 1] - sccIndications[scc] > 1;
+        for (uint64_t index = sccIndications[scc]; index < sccIndications[scc + 1]; ++index) {
+            uint64_t state = sccStates[index];
+            result.stateToSccMapping[state] = sccIndex;
+            if (nonSingletonScc || graph.selfLoopStates.get(state)) {
+                result.nonTrivialStates.set(state, true);
+            }
+        }
+        if (result.sccDepths) {
+            result.sccDepths->push_back(sccDepths[scc]);
+        }
+    }
+}
+}  // namespace
+#endif
+
 template<typename ValueType>
 void StronglyConnectedComponentDecomposition<ValueType>::performSccDecomposition(storm::storage::SparseMatrix<ValueType> const& transitionMatrix,
                                                                                  StronglyConnectedComponentDecompositionOptions const& options) {
@@ -284,6 +654,22 @@ void performSccDecomposition(storm::storage::SparseMatrix<ValueType> const& tran
     result.initialize(numberOfStates, options.isComputeSccDepthsSet || options.areOnlyBottomSccsConsidered);
     cache.initialize(numberOfStates);
 
+#ifdef STORM_HAVE_INTELTBB
+    uint64_t numberOfConsideredStates = options.optSubsystem ? options.optSubsystem->getNumberOfSetBits() : numberOfStates;
+    if (useParallelDecomposition(numberOfConsideredStates)) {
+        std::vector<uint64_t> states;
+        states.reserve(numberOfConsideredStates);
+        if (options.optSubsystem) {
+            options.optSubsystem->forEachSetIndex([&states](uint64_t state) { states.push_back(state); });
+        } else {
+            states.resize(numberOfStates);
+            std::iota(states.begin(), states.end(), 0);
+        }
+        performSccDecompositionParallel(transitionMatrix, options, states, result, cache);
+        return;
+    }
+#endif
+
     // Start the search for SCCs from every state in the block.
     uint64_t currentIndex = 0;
     auto performSccDecompFromState = [&](uint64_t startState) {
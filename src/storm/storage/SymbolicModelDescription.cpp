@@ -219,6 +219,14 @@ std::vector<storm::expressions::Variable> SymbolicModelDescription::getUndefined
     return result;
 }
 
+bool SymbolicModelDescription::constantsAreGraphPreserving(std::set<storm::expressions::Variable> const& constants) const {
+    if (this->isPrismProgram()) {
+        return this->asPrismProgram().constantsAreGraphPreserving(constants);
+    } else {
+        return this->asJaniModel().constantsAreGraphPreserving(constants);
+    }
+}
+
 std::ostream& operator<<(std::ostream& out, SymbolicModelDescription const& model) {
     if (model.isPrismProgram()) {
         out << model.asPrismProgram();
@@ -57,6 +57,7 @@ class SymbolicModelDescription {
     void requireNoUndefinedConstants() const;
     bool hasUndefinedConstants() const;
     std::vector<storm::expressions::Variable> getUndefinedConstants() const;
+    bool constantsAreGraphPreserving(std::set<storm::expressions::Variable> const& constants) const;
 
    private:
     boost::optional<boost::variant<storm::jani::Model, storm::prism::Program>> modelDescription;
@@ -0,0 +1,112 @@
+#include "storm/storage/WordBuffer.h"
+
+#include <algorithm>
+#include <cstdlib>
+
+#include "storm/utility/OsDetection.h"
+#include "storm/utility/macros.h"
+
+#include "storm/exceptions/FileIoException.h"
+#include "storm/exceptions/NotSupportedException.h"
+
+namespace storm {
+namespace storage {
+
+WordBuffer::WordBuffer(uint64_t size, boost::optional<std::string> const& directory) : numberOfWords(size), directory(directory), mappedWords(nullptr) {
+    if (!directory) {
+        memoryWords.resize(numberOfWords, 0);
+        return;
+    }
+#if defined LINUX || defined MACOS
+    if (numberOfWords == 0) {
+        return;
+    }
+    std::string filename = directory.get() + "/storm-buffer-XXXXXX";
+    int fileDescriptor = mkstemp(&filename[0]);
+    STORM_LOG_THROW(fileDescriptor >= 0, storm::exceptions::FileIoException, "Could not create temporary file in directory " << directory.get() << ".");
+    // Remove the directory entry right away, such that the file is deleted once it is unmapped and closed.
+    unlink(filename.c_str());
+    uint64_t const numberOfBytes = numberOfWords * sizeof(uint64_t);
+    // Extending the file yields zero bytes without actually writing them.
+    if (ftruncate(fileDescriptor, numberOfBytes) != 0) {
+        close(fileDescriptor);
+        STORM_LOG_THROW(false, storm::exceptions::FileIoException,
+                        "Could not allocate " << numberOfBytes << " bytes in temporary file in directory " << directory.get() << ".");
+    }
+    void* mapping = mmap(nullptr, numberOfBytes, PROT_READ | PROT_WRITE, MAP_SHARED, fileDescriptor, 0);
+    // The mapping remains valid after closing the file descriptor.
+    close(fileDescriptor);
+    STORM_LOG_THROW(mapping != MAP_FAILED, storm::exceptions::FileIoException, "Could not map temporary file in directory " << directory.get() << ".");
+    mappedWords = static_cast<uint64_t*>(mapping);
+#else
+    STORM_LOG_THROW(false, storm::exceptions::NotSupportedException, "File-backed storage is not supported on this platform.");
+#endif
+}
+
+WordBuffer::WordBuffer(WordBuffer const& other) : WordBuffer(other.numberOfWords, other.directory) {
+    std::copy(other.data(), other.data() + numberOfWords, data());
+}
+
+WordBuffer::WordBuffer(WordBuffer&& other)
+    : numberOfWords(other.numberOfWords), directory(std::move(other.directory)), memoryWords(std::move(other.memoryWords)), mappedWords(other.mappedWords) {
+    other.numberOfWords = 0;
+    other.directory = boost::none;
+    other.mappedWords = nullptr;
+}
+
+WordBuffer& WordBuffer::operator=(WordBuffer const& other) {
+    if (this != &other) {
+        *this = WordBuffer(other);
+    }
+    return *this;
+}
+
+WordBuffer& WordBuffer::operator=(WordBuffer&& other) {
+    if (this != &other) {
+        unmap();
+        numberOfWords = other.numberOfWords;
+        directory = std::move(other.directory);
+        memoryWords = std::move(other.memoryWords);
+        mappedWords = other.mappedWords;
+        other.numberOfWords = 0;
+        other.directory = boost::none;
+        other.mappedWords = nullptr;
+    }
+    return *this;
+}
+
+WordBuffer::~WordBuffer() {
+    unmap();
+}
+
+void WordBuffer::unmap() {
+#if defined LINUX || defined MACOS
+    if (mappedWords != nullptr) {
+        munmap(mappedWords, numberOfWords * sizeof(uint64_t));
+        mappedWords = nullptr;
+    }
+#endif
+}
+
+uint64_t* WordBuffer::data() {
+    return directory ? mappedWords : memoryWords.data();
+}
+
+uint64_t const* WordBuffer::data() const {
+    return directory ? mappedWords : memoryWords.data();
+}
+
+uint64_t WordBuffer::size() const {
+    return numberOfWords;
+}
+
+bool WordBuffer::isFileBacked() const {
+    return directory.is_initialized();
+}
+
+boost::optional<std::string> const& WordBuffer::getDirectory() const {
+    return directory;
+}
+
+}  // namespace storage
+}  // namespace storm
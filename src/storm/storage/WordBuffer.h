@@ -0,0 +1,72 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include <boost/optional.hpp>
+
+namespace storm {
+namespace storage {
+
+/*!
+ * A zero-initialized array of 64-bit words of fixed size. The words are either held in main memory or in a temporary file in a given directory
+ * that is mapped into memory. In the latter case, the operating system writes pages that have not been accessed recently to that file
+ * instead of keeping them in main memory, i.e., the size of the buffer is bounded by the available disk space rather than by the main memory.
+ * The temporary file is removed as soon as the buffer is destroyed.
+ */
+class WordBuffer {
+   public:
+    /*!
+     * Creates a buffer of the given size.
+     *
+     * @param size The number of words.
+     * @param directory If given, the words are stored in a memory-mapped temporary file within this directory.
+     */
+    WordBuffer(uint64_t size = 0, boost::optional<std::string> const& directory = boost::none);
+
+    WordBuffer(WordBuffer const& other);
+    WordBuffer(WordBuffer&& other);
+    WordBuffer& operator=(WordBuffer const& other);
+    WordBuffer& operator=(WordBuffer&& other);
+    ~WordBuffer();
+
+    uint64_t* data();
+    uint64_t const* data() const;
+
+    /*!
+     * Retrieves the number of words in this buffer.
+     */
+    uint64_t size() const;
+
+    /*!
+     * Retrieves whether the words are stored in a memory-mapped file.
+     */
+    bool isFileBacked() const;
+
+    /*!
+     * Retrieves the directory in which the words are stored (if any).
+     */
+    boost::optional<std::string> const& getDirectory() const;
+
+   private:
+    /*!
+     * Releases the mapping (if any).
+     */
+    void unmap();
+
+    // The number of words.
+    uint64_t numberOfWords;
+
+    // The directory of the memory-mapped file (if the buffer is file-backed).
+    boost::optional<std::string> directory;
+
+    // The words if the buffer lives in main memory.
+    std::vector<uint64_t> memoryWords;
+
+    // The mapped words if the buffer is file-backed.
+    uint64_t* mappedWords;
+};
+
+}  // namespace storage
+}  // namespace storm
@@ -2,6 +2,7 @@
 
 #include <chrono>
 
+#include "storm/adapters/IntelTbbAdapter.h"
 #include "storm/adapters/RationalFunctionAdapter.h"
 #include "storm/exceptions/AbortException.h"
 #include "storm/exceptions/IllegalFunctionCallException.h"
@@ -21,6 +22,7 @@
 #include "storm/settings/SettingsManager.h"
 #include "storm/settings/modules/CoreSettings.h"
 
+#include "storm/storage/DistributionWithReward.h"
 #include "storm/storage/bisimulation/DeterministicBlockData.h"
 
 #include "storm/utility/SignalHandler.h"
@@ -60,10 +62,15 @@ BisimulationDecomposition<ModelType, BlockDataType>::Options::Options()
       psiStates(),
       respectedAtomicPropositions(),
       buildQuotient(true),
+      numberOfThreads(storm::settings::getModule<storm::settings::modules::BisimulationSettings>().getNumberOfThreads()),
+      approximationPrecision(),
       keepRewards(false),
       type(BisimulationType::Strong),
       bounded(false) {
-    // Intentionally left empty.
+    auto const& bisimulationSettings = storm::settings::getModule<storm::settings::modules::BisimulationSettings>();
+    if (bisimulationSettings.isApproximationSet()) {
+        approximationPrecision = bisimulationSettings.getApproximationPrecision();
+    }
 }
 
 template<typename ModelType, typename BlockDataType>
@@ -220,10 +227,25 @@ void BisimulationDecomposition<ModelType, BlockDataType>::computeBisimulationDec
     STORM_LOG_WARN_COND(partition.size() > 1, "Initial partition consists only of a single block.");
     std::chrono::high_resolution_clock::duration initialPartitionTime = std::chrono::high_resolution_clock::now() - initialPartitionStart;
 
-    this->initialize();
+    bool useSignatureBasedRefinement = options.numberOfThreads > 1 && options.getType() == BisimulationType::Strong;
+    STORM_LOG_WARN_COND(!useSignatureBasedRefinement || !options.approximationPrecision,
+                        "Approximate bisimulation is only computed by the sequential refinement. Ignoring the number of threads.");
+    useSignatureBasedRefinement = useSignatureBasedRefinement && !options.approximationPrecision;
+#ifndef STORM_HAVE_INTELTBB
+    STORM_LOG_WARN_COND(!useSignatureBasedRefinement, "Parallel partition refinement requires Intel TBB. Falling back to the sequential refinement.");
+    useSignatureBasedRefinement = false;
+#endif
 
     std::chrono::high_resolution_clock::time_point refinementStart = std::chrono::high_resolution_clock::now();
-    this->performPartitionRefinement();
+    if (useSignatureBasedRefinement) {
+        // The signature-based refinement does not need the auxiliary data structures, so we only initialize them
+        // for the final partition (as they may be needed to build the quotient).
+        this->performSignatureBasedPartitionRefinement();
+        this->initialize();
+    } else {
+        this->initialize();
+        this->performPartitionRefinement();
+    }
     std::chrono::high_resolution_clock::duration refinementTime = std::chrono::high_resolution_clock::now() - refinementStart;
 
     std::chrono::high_resolution_clock::time_point extractionStart = std::chrono::high_resolution_clock::now();
@@ -288,6 +310,116 @@ void BisimulationDecomposition<ModelType, BlockDataType>::performPartitionRefine
     }
 }
 
+template<typename ModelType, typename BlockDataType>
+void BisimulationDecomposition<ModelType, BlockDataType>::performSignatureBasedPartitionRefinement() {
+#ifdef STORM_HAVE_INTELTBB
+    STORM_LOG_ASSERT(options.getType() == BisimulationType::Strong, "Signature-based refinement is only available for strong bisimulation.");
+    STORM_LOG_INFO("Performing signature-based partition refinement with " << options.numberOfThreads << " threads.");
+
+    auto const& transitionMatrix = model.getTransitionMatrix();
+    auto const& rowGroupIndices = transitionMatrix.getRowGroupIndices();
+    bool useStateActionRewards =
+        model.isNondeterministicModel() && options.getKeepRewards() && model.hasRewardModel() && model.getUniqueRewardModel().hasStateActionRewards();
+
+    // The signature of a state is the sorted set of distributions over the current blocks induced by its choices.
+    std::vector<std::vector<storm::storage::DistributionWithReward<ValueType>>> signatures(model.getNumberOfStates());
+    auto signatureLess = [this, &signatures](storm::storage::sparse::state_type const& a, storm::storage::sparse::state_type const& b) {
+        auto const& first = signatures[a];
+        auto const& second = signatures[b];
+        if (first.size() != second.size()) {
+            return first.size() < second.size();
+        }
+        for (uint_fast64_t index = 0; index < first.size(); ++index) {
+            if (first[index].less(second[index], this->comparator)) {
+                return true;
+            } else if (second[index].less(first[index], this->comparator)) {
+                return false;
+            }
+        }
+        return false;
+    };
+    auto isRefinable = [](Block<BlockDataType> const& block) { return block.getNumberOfStates() > 1 && !block.data().absorbing(); };
+
+    tbb::task_arena arena(options.numberOfThreads);
+    uint_fast64_t iterations = 0;
+    bool refined = true;
+    while (refined) {
+        ++iterations;
+
+        // Compute the signatures of all states in blocks that can still be split.
+        arena.execute([&]() {
+            tbb::parallel_for(tbb::blocked_range<storm::storage::sparse::state_type>(0, model.getNumberOfStates()),
+                              [&](tbb::blocked_range<storm::storage::sparse::state_type> const& range) {
+                                  for (auto state = range.begin(); state < range.end(); ++state) {
+                                      auto& signature = signatures[state];
+                                      signature.clear();
+                                      if (!isRefinable(partition.getBlock(state))) {
+                                          continue;
+                                      }
+                                      for (uint_fast64_t choice = rowGroupIndices[state]; choice < rowGroupIndices[state + 1]; ++choice) {
+                                          storm::storage::DistributionWithReward<ValueType> distribution(
+                                              useStateActionRewards ? model.getUniqueRewardModel().getStateActionReward(choice)
+                                                                    : storm::utility::zero<ValueType>());
+                                          for (auto const& entry : transitionMatrix.getRow(choice)) {
+                                              if (!this->comparator.isZero(entry.getValue())) {
+                                                  distribution.addProbability(partition.getBlock(entry.getColumn()).getId(), entry.getValue());
+                                              }
+                                          }
+                                          signature.push_back(std::move(distribution));
+                                      }
+                                      std::sort(signature.begin(), signature.end(),
+                                                [this](storm::storage::DistributionWithReward<ValueType> const& first,
+                                                       storm::storage::DistributionWithReward<ValueType> const& second) {
+                                                    return first.less(second, this->comparator);
+                                                });
+                                      signature.erase(std::unique(signature.begin(), signature.end(),
+                                                                  [this](storm::storage::DistributionWithReward<ValueType> const& first,
+                                                                         storm::storage::DistributionWithReward<ValueType> const& second) {
+                                                                      return first.equals(second, this->comparator);
+                                                                  }),
+                                                      signature.end());
+                                  }
+                              });
+        });
+
+        // Sort the states of the blocks according to their signatures and determine the ranges of equal signatures.
+        uint_fast64_t numberOfBlocks = partition.size();
+        std::vector<std::vector<uint_fast64_t>> splitPositions(numberOfBlocks);
+        arena.execute([&]() {
+            tbb::parallel_for(tbb::blocked_range<uint_fast64_t>(0, numberOfBlocks), [&](tbb::blocked_range<uint_fast64_t> const& range) {
+                for (auto blockIndex = range.begin(); blockIndex < range.end(); ++blockIndex) {
+                    Block<BlockDataType>& block = *partition.getBlocks()[blockIndex];
+                    if (!isRefinable(block)) {
+                        continue;
+                    }
+                    tbb::parallel_sort(partition.begin(block), partition.end(block), signatureLess);
+                    partition.mapStatesToPositions(block);
+                    splitPositions[blockIndex] = partition.computeRangesOfEqualValue(block.getBeginIndex(), block.getEndIndex(), signatureLess);
+                }
+            });
+        });
+
+        // Finally, split the blocks. This needs to be done sequentially, as it modifies the list of blocks.
+        for (uint_fast64_t blockIndex = 0; blockIndex < numberOfBlocks; ++blockIndex) {
+            auto const& positions = splitPositions[blockIndex];
+            for (uint_fast64_t index = 1; index + 1 < positions.size(); ++index) {
+                partition.splitBlock(*partition.getBlocks()[blockIndex], positions[index]);
+            }
+        }
+        refined = partition.size() > numberOfBlocks;
+        STORM_LOG_TRACE("Partition after " << iterations << " iterations of signature-based refinement has " << partition.size() << " blocks.");
+
+        if (storm::utility::resources::isTerminate()) {
+            std::cout << "Performed " << iterations << " iterations of partition refinement before abort.\n";
+            STORM_LOG_THROW(false, storm::exceptions::AbortException, "Aborted in bisimulation computation.");
+        }
+    }
+    STORM_LOG_INFO("Signature-based partition refinement took " << iterations << " iterations and produced " << partition.size() << " blocks.");
+#else
+    STORM_LOG_THROW(false, storm::exceptions::InvalidOptionException, "Signature-based partition refinement requires Intel TBB.");
+#endif
+}
+
 template<typename ModelType, typename BlockDataType>
 std::shared_ptr<ModelType> BisimulationDecomposition<ModelType, BlockDataType>::getQuotient() const {
     STORM_LOG_THROW(this->quotient != nullptr, storm::exceptions::IllegalFunctionCallException,
@@ -126,6 +126,14 @@ class BisimulationDecomposition : public Decomposition<StateBlock> {
         /// A flag that governs whether the quotient model is actually built or only the decomposition is computed.
         bool buildQuotient;
 
+        /// The number of threads used for the partition refinement. If this is larger than one, strong bisimulation
+        /// is computed by a parallel signature-based refinement instead of the splitter-based one.
+        uint64_t numberOfThreads;
+
+        /// If set, an approximate (strong) bisimulation of a deterministic model is computed, i.e., the probabilities (rates for CTMCs) of related
+        /// states to move to a block may differ. Probabilities are quantized to multiples of this precision, so the relation remains an equivalence.
+        boost::optional<double> approximationPrecision;
+
        private:
         boost::optional<OptimizationDirection> optimalityType;
 
@@ -208,6 +216,14 @@ class BisimulationDecomposition : public Decomposition<StateBlock> {
      */
     void performPartitionRefinement();
 
+    /*!
+     * Performs the partition refinement by repeatedly splitting all blocks with respect to the signatures of their
+     * states, i.e., the sets of distributions over the current blocks induced by the choices of the states. The
+     * signatures are computed and the blocks are sorted in parallel using the number of threads given in the options.
+     * This may only be used for strong bisimulation.
+     */
+    void performSignatureBasedPartitionRefinement();
+
     /*!
      * Refines the partition by considering the given splitter. All blocks that become potential splitters
      * because of this refinement, are marked as splitters and inserted into the splitter vector.
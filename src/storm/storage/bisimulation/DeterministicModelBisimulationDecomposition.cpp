@@ -3,6 +3,7 @@
 #include <algorithm>
 #include <boost/iterator/zip_iterator.hpp>
 #include <chrono>
+#include <cmath>
 #include <iomanip>
 #include <unordered_map>
 
@@ -32,7 +33,16 @@ DeterministicModelBisimulationDecomposition<ModelType>::DeterministicModelBisimu
     ModelType const& model, typename BisimulationDecomposition<ModelType, DeterministicModelBisimulationDecomposition::BlockDataType>::Options const& options)
     : BisimulationDecomposition<ModelType, DeterministicModelBisimulationDecomposition::BlockDataType>(model, options),
       probabilitiesToCurrentSplitter(model.getNumberOfStates(), storm::utility::zero<ValueType>()) {
-    // Intentionally left empty.
+    STORM_LOG_THROW(!this->options.approximationPrecision || !std::is_same<ValueType, storm::RationalFunction>::value,
+                    storm::exceptions::IllegalFunctionCallException, "Approximate bisimulation is not supported for parametric models.");
+    STORM_LOG_THROW(!this->options.approximationPrecision || this->options.getType() == BisimulationType::Strong,
+                    storm::exceptions::IllegalFunctionCallException, "Approximate bisimulation is only supported for strong bisimulation.");
+}
+
+template<typename ModelType>
+double DeterministicModelBisimulationDecomposition<ModelType>::getApproximationError() const {
+    STORM_LOG_THROW(approximationError, storm::exceptions::IllegalFunctionCallException, "No quotient of an approximate bisimulation was built.");
+    return approximationError.get();
 }
 
 template<typename ModelType>
@@ -161,6 +171,43 @@ DeterministicModelBisimulationDecomposition<ModelType>::getProbabilityToSplitter
     return probabilitiesToCurrentSplitter[state];
 }
 
+template<typename ModelType>
+int64_t DeterministicModelBisimulationDecomposition<ModelType>::getQuantizedProbabilityToSplitter(storm::storage::sparse::state_type const& state) const {
+    if constexpr (std::is_same<ValueType, storm::RationalFunction>::value) {
+        STORM_LOG_THROW(false, storm::exceptions::IllegalFunctionCallException, "Unable to quantize parametric probabilities.");
+        return 0;
+    } else {
+        return static_cast<int64_t>(
+            std::floor(storm::utility::convertNumber<double>(getProbabilityToSplitter(state)) / this->options.approximationPrecision.get() + 0.5));
+    }
+}
+
+template<typename ModelType>
+double DeterministicModelBisimulationDecomposition<ModelType>::computeDeviation(
+    storm::storage::sparse::state_type const& state, std::map<storm::storage::sparse::state_type, ValueType> const& blockProbability) const {
+    if constexpr (std::is_same<ValueType, storm::RationalFunction>::value) {
+        STORM_LOG_THROW(false, storm::exceptions::IllegalFunctionCallException, "Unable to compute deviations of parametric probabilities.");
+        return 0.0;
+    } else {
+        std::map<storm::storage::sparse::state_type, ValueType> stateProbability;
+        for (auto const& entry : this->model.getTransitionMatrix().getRow(state)) {
+            stateProbability[this->partition.getBlock(entry.getColumn()).getId()] += entry.getValue();
+        }
+        ValueType deviation = storm::utility::zero<ValueType>();
+        for (auto const& entry : stateProbability) {
+            auto blockIt = blockProbability.find(entry.first);
+            ValueType const& blockValue = blockIt == blockProbability.end() ? storm::utility::zero<ValueType>() : blockIt->second;
+            deviation += storm::utility::abs<ValueType>(entry.second - blockValue);
+        }
+        for (auto const& entry : blockProbability) {
+            if (stateProbability.count(entry.first) == 0) {
+                deviation += storm::utility::abs<ValueType>(entry.second);
+            }
+        }
+        return storm::utility::convertNumber<double>(deviation);
+    }
+}
+
 template<typename ModelType>
 bool DeterministicModelBisimulationDecomposition<ModelType>::isSilent(storm::storage::sparse::state_type const& state) const {
     return this->comparator.isOne(silentProbabilities[state]);
@@ -199,6 +246,10 @@ void DeterministicModelBisimulationDecomposition<ModelType>::refinePredecessorBl
     split |= this->partition.splitBlock(
         *blockToRefineProbabilistically,
         [this](storm::storage::sparse::state_type state1, storm::storage::sparse::state_type state2) {
+            if (this->options.approximationPrecision) {
+                // Comparing the rounded probabilities keeps the relation transitive.
+                return getQuantizedProbabilityToSplitter(state1) < getQuantizedProbabilityToSplitter(state2);
+            }
             return this->comparator.isLess(getProbabilityToSplitter(state1), getProbabilityToSplitter(state2));
         },
         [&splitterQueue, &block](Block<BlockDataType>& newBlock) {
@@ -617,6 +668,10 @@ void DeterministicModelBisimulationDecomposition<ModelType>::buildQuotient() {
         stateRewards = std::vector<ValueType>(this->blocks.size());
     }
 
+    if (this->options.approximationPrecision) {
+        approximationError = 0.0;
+    }
+
     // Now build (a) and (b) by traversing all blocks.
     for (uint_fast64_t blockIndex = 0; blockIndex < this->blocks.size(); ++blockIndex) {
         auto const& block = this->blocks[blockIndex];
@@ -673,6 +728,13 @@ void DeterministicModelBisimulationDecomposition<ModelType>::buildQuotient() {
                 }
             }
 
+            // For an approximate bisimulation, the states of the block may deviate from the representative.
+            if (this->options.approximationPrecision) {
+                for (auto const& state : block) {
+                    approximationError = std::max(approximationError.get(), computeDeviation(state, blockProbability));
+                }
+            }
+
             // Now add them to the actual matrix.
             for (auto const& probabilityEntry : blockProbability) {
                 if (this->options.getType() == BisimulationType::Weak && this->model.getType() == storm::models::ModelType::Dtmc &&
@@ -723,6 +785,10 @@ void DeterministicModelBisimulationDecomposition<ModelType>::buildQuotient() {
 
     // Finally construct the quotient model.
     this->quotient = std::shared_ptr<ModelType>(new ModelType(builder.build(), std::move(newLabeling), std::move(rewardModels)));
+
+    STORM_LOG_WARN_COND(!approximationError, "The quotient of the approximate bisimulation has an error of "
+                                                 << approximationError.get()
+                                                 << ", i.e., the transitions of a state and its block differ by at most this value in the L1 norm.");
 }
 
 template class DeterministicModelBisimulationDecomposition<storm::models::sparse::Dtmc<double>>;
@@ -27,6 +27,15 @@ class DeterministicModelBisimulationDecomposition : public BisimulationDecomposi
     DeterministicModelBisimulationDecomposition(ModelType const& model, typename BisimulationDecomposition<ModelType, BlockDataType>::Options const& options =
                                                                             typename BisimulationDecomposition<ModelType, BlockDataType>::Options());
 
+    /*!
+     * Retrieves the error of an approximate bisimulation (see Options::approximationPrecision). The error is the maximal L1 distance between the
+     * outgoing probabilities (rates for CTMCs) of a state, lifted to the blocks of the partition, and the outgoing transitions of its block in
+     * the quotient. For DTMCs, the probability of a property with step bound k thus differs by at most k times half of this error between a
+     * state and its block. For unbounded properties, there is no such bound in general.
+     * The error is only available if the quotient was built for an approximate bisimulation.
+     */
+    double getApproximationError() const;
+
    protected:
     virtual std::pair<storm::storage::BitVector, storm::storage::BitVector> getStatesWithProbability01() override;
 
@@ -69,6 +78,13 @@ class DeterministicModelBisimulationDecomposition : public BisimulationDecomposi
     // Retrieves the probability of going into the splitter for the given state.
     ValueType const& getProbabilityToSplitter(storm::storage::sparse::state_type const& state) const;
 
+    // Retrieves the probability of going into the splitter for the given state, rounded to a multiple of the approximation precision.
+    int64_t getQuantizedProbabilityToSplitter(storm::storage::sparse::state_type const& state) const;
+
+    // Computes the L1 distance between the outgoing transitions of the given state lifted to the current blocks and the given block distribution.
+    double computeDeviation(storm::storage::sparse::state_type const& state,
+                            std::map<storm::storage::sparse::state_type, ValueType> const& blockProbability) const;
+
     // Retrieves the silent probability for the given state.
     ValueType getSilentProbability(storm::storage::sparse::state_type const& state) const;
 
@@ -133,6 +149,9 @@ class DeterministicModelBisimulationDecomposition : public BisimulationDecomposi
 
     // A vector mapping each state to its silent probability.
     std::vector<ValueType> silentProbabilities;
+
+    // The error of an approximate bisimulation (if the quotient was built).
+    boost::optional<double> approximationError;
 };
 }  // namespace storage
 }  // namespace storm
@@ -26,6 +26,9 @@ NondeterministicModelBisimulationDecomposition<ModelType>::NondeterministicModel
       orderedQuotientDistributions(model.getNumberOfChoices()) {
     STORM_LOG_THROW(options.getType() == BisimulationType::Strong, storm::exceptions::IllegalFunctionCallException,
                     "Weak bisimulation is currently not supported for nondeterministic models.");
+    STORM_LOG_WARN_COND(!options.approximationPrecision,
+                        "Approximate bisimulation is not supported for nondeterministic models. Computing exact bisimulation.");
+    this->options.approximationPrecision = boost::none;
 }
 
 template<typename ModelType>
@@ -41,11 +41,13 @@ bool Add<LibraryType, ValueType>::operator!=(Add<LibraryType, ValueType> const&
 
 template<DdType LibraryType, typename ValueType>
 Add<LibraryType, ValueType> Add<LibraryType, ValueType>::operator+(Add<LibraryType, ValueType> const& other) const {
+    DdOperationStatistics::Measurement measurement(this->getDdManager().getOperationStatistics(), DdOperationType::Apply);
     return Add<LibraryType, ValueType>(this->getDdManager(), internalAdd + other.internalAdd, Dd<LibraryType>::joinMetaVariables(*this, other));
 }
 
 template<DdType LibraryType, typename ValueType>
 Add<LibraryType, ValueType>& Add<LibraryType, ValueType>::operator+=(Add<LibraryType, ValueType> const& other) {
+    DdOperationStatistics::Measurement measurement(this->getDdManager().getOperationStatistics(), DdOperationType::Apply);
     this->addMetaVariables(other.getContainedMetaVariables());
     internalAdd += other.internalAdd;
     return *this;
@@ -53,11 +55,13 @@ Add<LibraryType, ValueType>& Add<LibraryType, ValueType>::operator+=(Add<Library
 
 template<DdType LibraryType, typename ValueType>
 Add<LibraryType, ValueType> Add<LibraryType, ValueType>::operator*(Add<LibraryType, ValueType> const& other) const {
+    DdOperationStatistics::Measurement measurement(this->getDdManager().getOperationStatistics(), DdOperationType::Apply);
     return Add<LibraryType, ValueType>(this->getDdManager(), internalAdd * other.internalAdd, Dd<LibraryType>::joinMetaVariables(*this, other));
 }
 
 template<DdType LibraryType, typename ValueType>
 Add<LibraryType, ValueType>& Add<LibraryType, ValueType>::operator*=(Add<LibraryType, ValueType> const& other) {
+    DdOperationStatistics::Measurement measurement(this->getDdManager().getOperationStatistics(), DdOperationType::Apply);
     this->addMetaVariables(other.getContainedMetaVariables());
     internalAdd *= other.internalAdd;
     return *this;
@@ -65,6 +69,7 @@ Add<LibraryType, ValueType>& Add<LibraryType, ValueType>::operator*=(Add<Library
 
 template<DdType LibraryType, typename ValueType>
 Add<LibraryType, ValueType> Add<LibraryType, ValueType>::operator-(Add<LibraryType, ValueType> const& other) const {
+    DdOperationStatistics::Measurement measurement(this->getDdManager().getOperationStatistics(), DdOperationType::Apply);
     return Add<LibraryType, ValueType>(this->getDdManager(), internalAdd - other.internalAdd, Dd<LibraryType>::joinMetaVariables(*this, other));
 }
 
@@ -75,6 +80,7 @@ Add<LibraryType, ValueType> Add<LibraryType, ValueType>::operator-() const {
 
 template<DdType LibraryType, typename ValueType>
 Add<LibraryType, ValueType>& Add<LibraryType, ValueType>::operator-=(Add<LibraryType, ValueType> const& other) {
+    DdOperationStatistics::Measurement measurement(this->getDdManager().getOperationStatistics(), DdOperationType::Apply);
     this->addMetaVariables(other.getContainedMetaVariables());
     internalAdd -= other.internalAdd;
     return *this;
@@ -82,11 +88,13 @@ Add<LibraryType, ValueType>& Add<LibraryType, ValueType>::operator-=(Add<Library
 
 template<DdType LibraryType, typename ValueType>
 Add<LibraryType, ValueType> Add<LibraryType, ValueType>::operator/(Add<LibraryType, ValueType> const& other) const {
+    DdOperationStatistics::Measurement measurement(this->getDdManager().getOperationStatistics(), DdOperationType::Apply);
     return Add<LibraryType, ValueType>(this->getDdManager(), internalAdd / other.internalAdd, Dd<LibraryType>::joinMetaVariables(*this, other));
 }
 
 template<DdType LibraryType, typename ValueType>
 Add<LibraryType, ValueType>& Add<LibraryType, ValueType>::operator/=(Add<LibraryType, ValueType> const& other) {
+    DdOperationStatistics::Measurement measurement(this->getDdManager().getOperationStatistics(), DdOperationType::Apply);
     this->addMetaVariables(other.getContainedMetaVariables());
     internalAdd /= other.internalAdd;
     return *this;
@@ -371,6 +379,7 @@ Add<LibraryType, ValueType> Add<LibraryType, ValueType>::permuteVariables(
 template<DdType LibraryType, typename ValueType>
 Add<LibraryType, ValueType> Add<LibraryType, ValueType>::multiplyMatrix(Add<LibraryType, ValueType> const& otherMatrix,
                                                                         std::set<storm::expressions::Variable> const& summationMetaVariables) const {
+    DdOperationStatistics::Measurement measurement(this->getDdManager().getOperationStatistics(), DdOperationType::MatrixMultiplication);
     // Create the summation variables.
     std::vector<InternalBdd<LibraryType>> summationDdVariables;
     for (auto const& metaVariable : summationMetaVariables) {
@@ -390,6 +399,7 @@ Add<LibraryType, ValueType> Add<LibraryType, ValueType>::multiplyMatrix(Add<Libr
 template<DdType LibraryType, typename ValueType>
 Add<LibraryType, ValueType> Add<LibraryType, ValueType>::multiplyMatrix(Bdd<LibraryType> const& otherMatrix,
                                                                         std::set<storm::expressions::Variable> const& summationMetaVariables) const {
+    DdOperationStatistics::Measurement measurement(this->getDdManager().getOperationStatistics(), DdOperationType::MatrixMultiplication);
     // Create the summation variables.
     std::vector<InternalBdd<LibraryType>> summationDdVariables;
     for (auto const& metaVariable : summationMetaVariables) {
@@ -697,9 +707,10 @@ storm::storage::SparseMatrix<ValueType> Add<LibraryType, ValueType>::toMatrix(st
         ++i;
     }
 
-    // Count the number of elements in the rows.
-    rowIndications = this->notZero().template toAdd<uint_fast64_t>().sumAbstract(columnMetaVariables).toVector(rowOdd);
-    rowIndications.emplace_back();
+    // Count the number of elements in the rows. This traverses the DD just like the conversion itself but only
+    // increments the row indications, so no intermediate DD or vector needs to be built.
+    internalAdd.toMatrixComponents(trivialRowGroupIndices, rowIndications, columnsAndValues, rowOdd, columnOdd, ddRowVariableIndices, ddColumnVariableIndices,
+                                   false);
 
     // Now that we computed the number of entries in each row, compute the corresponding offsets in the entry vector.
     uint_fast64_t tmp = 0;
@@ -856,10 +867,9 @@ typename Add<LibraryType, ValueType>::MatrixAndLabeling Add<LibraryType, ValueTy
         auto const& group = groups[i];
         auto groupNotZero = group.notZero();
 
-        std::vector<uint64_t> tmpRowIndications = groupNotZero.template toAdd<uint_fast64_t>().sumAbstract(columnMetaVariables).toVector(rowOdd);
-        for (uint64_t offset = 0; offset < tmpRowIndications.size(); ++offset) {
-            rowIndications[rowGroupIndices[offset]] += tmpRowIndications[offset];
-        }
+        // Count the number of elements in the rows of this group (without writing any entries).
+        group.internalAdd.toMatrixComponents(rowGroupIndices, rowIndications, columnsAndValues, rowOdd, columnOdd, ddRowVariableIndices,
+                                             ddColumnVariableIndices, false);
 
         statesWithGroupEnabled[i] = groupNotZero.existsAbstract(columnMetaVariables).template toAdd<uint_fast64_t>();
         if (buildLabeling) {
@@ -1082,10 +1092,9 @@ std::pair<storm::storage::SparseMatrix<ValueType>, std::vector<std::vector<Value
         std::vector<Add<LibraryType, ValueType>> const& group = groups[i];
         Bdd<LibraryType> matrixDdNotZero = group.back().notZero();
 
-        std::vector<uint64_t> tmpRowIndications = matrixDdNotZero.template toAdd<uint_fast64_t>().sumAbstract(columnMetaVariables).toVector(rowOdd);
-        for (uint64_t offset = 0; offset < tmpRowIndications.size(); ++offset) {
-            rowIndications[rowGroupIndices[offset]] += tmpRowIndications[offset];
-        }
+        // Count the number of elements in the rows of this group (without writing any entries).
+        group.back().internalAdd.toMatrixComponents(rowGroupIndices, rowIndications, columnsAndValues, rowOdd, columnOdd, ddRowVariableIndices,
+                                                    ddColumnVariableIndices, false);
 
         Bdd<LibraryType> vectorDdNotZero = this->getDdManager().getBddZero();
         for (uint64_t vectorIndex = 0; vectorIndex < vectors.size(); ++vectorIndex) {
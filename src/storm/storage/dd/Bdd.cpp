@@ -111,6 +111,7 @@ bool Bdd<LibraryType>::operator!=(Bdd<LibraryType> const& other) const {
 
 template<DdType LibraryType>
 Bdd<LibraryType> Bdd<LibraryType>::ite(Bdd<LibraryType> const& thenBdd, Bdd<LibraryType> const& elseBdd) const {
+    DdOperationStatistics::Measurement measurement(this->getDdManager().getOperationStatistics(), DdOperationType::Ite);
     std::set<storm::expressions::Variable> metaVariables = Dd<LibraryType>::joinMetaVariables(thenBdd, elseBdd);
     metaVariables.insert(this->getContainedMetaVariables().begin(), this->getContainedMetaVariables().end());
     return Bdd<LibraryType>(this->getDdManager(), internalBdd.ite(thenBdd.internalBdd, elseBdd.internalBdd), metaVariables);
@@ -119,6 +120,7 @@ Bdd<LibraryType> Bdd<LibraryType>::ite(Bdd<LibraryType> const& thenBdd, Bdd<Libr
 template<DdType LibraryType>
 template<typename ValueType>
 Add<LibraryType, ValueType> Bdd<LibraryType>::ite(Add<LibraryType, ValueType> const& thenAdd, Add<LibraryType, ValueType> const& elseAdd) const {
+    DdOperationStatistics::Measurement measurement(this->getDdManager().getOperationStatistics(), DdOperationType::Ite);
     std::set<storm::expressions::Variable> metaVariables = Dd<LibraryType>::joinMetaVariables(thenAdd, elseAdd);
     metaVariables.insert(this->getContainedMetaVariables().begin(), this->getContainedMetaVariables().end());
     return Add<LibraryType, ValueType>(this->getDdManager(), internalBdd.ite(thenAdd.internalAdd, elseAdd.internalAdd), metaVariables);
@@ -126,11 +128,13 @@ Add<LibraryType, ValueType> Bdd<LibraryType>::ite(Add<LibraryType, ValueType> co
 
 template<DdType LibraryType>
 Bdd<LibraryType> Bdd<LibraryType>::operator||(Bdd<LibraryType> const& other) const {
+    DdOperationStatistics::Measurement measurement(this->getDdManager().getOperationStatistics(), DdOperationType::Apply);
     return Bdd<LibraryType>(this->getDdManager(), internalBdd || other.internalBdd, Dd<LibraryType>::joinMetaVariables(*this, other));
 }
 
 template<DdType LibraryType>
 Bdd<LibraryType>& Bdd<LibraryType>::operator|=(Bdd<LibraryType> const& other) {
+    DdOperationStatistics::Measurement measurement(this->getDdManager().getOperationStatistics(), DdOperationType::Apply);
     this->addMetaVariables(other.getContainedMetaVariables());
     internalBdd |= other.internalBdd;
     return *this;
@@ -138,11 +142,13 @@ Bdd<LibraryType>& Bdd<LibraryType>::operator|=(Bdd<LibraryType> const& other) {
 
 template<DdType LibraryType>
 Bdd<LibraryType> Bdd<LibraryType>::operator&&(Bdd<LibraryType> const& other) const {
+    DdOperationStatistics::Measurement measurement(this->getDdManager().getOperationStatistics(), DdOperationType::Apply);
     return Bdd<LibraryType>(this->getDdManager(), internalBdd && other.internalBdd, Dd<LibraryType>::joinMetaVariables(*this, other));
 }
 
 template<DdType LibraryType>
 Bdd<LibraryType>& Bdd<LibraryType>::operator&=(Bdd<LibraryType> const& other) {
+    DdOperationStatistics::Measurement measurement(this->getDdManager().getOperationStatistics(), DdOperationType::Apply);
     this->addMetaVariables(other.getContainedMetaVariables());
     internalBdd &= other.internalBdd;
     return *this;
@@ -194,6 +200,7 @@ Bdd<LibraryType> Bdd<LibraryType>::universalAbstract(std::set<storm::expressions
 
 template<DdType LibraryType>
 Bdd<LibraryType> Bdd<LibraryType>::andExists(Bdd<LibraryType> const& other, std::set<storm::expressions::Variable> const& existentialVariables) const {
+    DdOperationStatistics::Measurement measurement(this->getDdManager().getOperationStatistics(), DdOperationType::AndExists);
     Bdd<LibraryType> cube = getCube(this->getDdManager(), existentialVariables);
 
     std::set<storm::expressions::Variable> unionOfMetaVariables;
@@ -219,6 +226,7 @@ Bdd<LibraryType> Bdd<LibraryType>::restrict(Bdd<LibraryType> const& constraint)
 template<DdType LibraryType>
 Bdd<LibraryType> Bdd<LibraryType>::relationalProduct(Bdd<LibraryType> const& relation, std::set<storm::expressions::Variable> const& rowMetaVariables,
                                                      std::set<storm::expressions::Variable> const& columnMetaVariables) const {
+    DdOperationStatistics::Measurement measurement(this->getDdManager().getOperationStatistics(), DdOperationType::RelationalProduct);
     std::set<storm::expressions::Variable> newMetaVariables;
     std::set_difference(relation.getContainedMetaVariables().begin(), relation.getContainedMetaVariables().end(), columnMetaVariables.begin(),
                         columnMetaVariables.end(), std::inserter(newMetaVariables, newMetaVariables.begin()));
@@ -245,6 +253,7 @@ Bdd<LibraryType> Bdd<LibraryType>::relationalProduct(Bdd<LibraryType> const& rel
 template<DdType LibraryType>
 Bdd<LibraryType> Bdd<LibraryType>::inverseRelationalProduct(Bdd<LibraryType> const& relation, std::set<storm::expressions::Variable> const& rowMetaVariables,
                                                             std::set<storm::expressions::Variable> const& columnMetaVariables) const {
+    DdOperationStatistics::Measurement measurement(this->getDdManager().getOperationStatistics(), DdOperationType::RelationalProduct);
     std::set<storm::expressions::Variable> newMetaVariables;
     std::set_difference(relation.getContainedMetaVariables().begin(), relation.getContainedMetaVariables().end(), columnMetaVariables.begin(),
                         columnMetaVariables.end(), std::inserter(newMetaVariables, newMetaVariables.begin()));
@@ -273,6 +282,7 @@ template<DdType LibraryType>
 Bdd<LibraryType> Bdd<LibraryType>::inverseRelationalProductWithExtendedRelation(Bdd<LibraryType> const& relation,
                                                                                 std::set<storm::expressions::Variable> const& rowMetaVariables,
                                                                                 std::set<storm::expressions::Variable> const& columnMetaVariables) const {
+    DdOperationStatistics::Measurement measurement(this->getDdManager().getOperationStatistics(), DdOperationType::RelationalProduct);
     std::set<storm::expressions::Variable> newMetaVariables;
     std::set_difference(relation.getContainedMetaVariables().begin(), relation.getContainedMetaVariables().end(), columnMetaVariables.begin(),
                         columnMetaVariables.end(), std::inserter(newMetaVariables, newMetaVariables.begin()));
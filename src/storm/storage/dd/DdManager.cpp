@@ -2,6 +2,9 @@
 
 #include "storm/storage/expressions/ExpressionManager.h"
 
+#include "storm/settings/SettingsManager.h"
+#include "storm/settings/modules/CoreSettings.h"
+
 #include "storm/exceptions/InvalidArgumentException.h"
 #include "storm/utility/constants.h"
 #include "storm/utility/macros.h"
@@ -18,8 +21,8 @@
 namespace storm {
 namespace dd {
 template<DdType LibraryType>
-DdManager<LibraryType>::DdManager() : internalDdManager(), metaVariableMap(), manager(new storm::expressions::ExpressionManager()) {
-    // Intentionally left empty.
+DdManager<LibraryType>::DdManager() : internalDdManager(), metaVariableMap(), manager(new storm::expressions::ExpressionManager()), operationStatistics() {
+    operationStatistics.setEnabled(storm::settings::getModule<storm::settings::modules::CoreSettings>().isShowStatisticsSet());
 }
 
 template<DdType LibraryType>
@@ -519,6 +522,27 @@ void DdManager<LibraryType>::execute(std::function<void()> const& f) const {
     internalDdManager.execute(f);
 }
 
+template<DdType LibraryType>
+DdOperationStatistics& DdManager<LibraryType>::getOperationStatistics() {
+    return operationStatistics;
+}
+
+template<DdType LibraryType>
+DdOperationStatistics const& DdManager<LibraryType>::getOperationStatistics() const {
+    return operationStatistics;
+}
+
+template<DdType LibraryType>
+void DdManager<LibraryType>::printStatisticsToStream(std::ostream& out) const {
+    internalDdManager.printStatisticsToStream(out);
+    operationStatistics.printToStream(out);
+}
+
+template<DdType LibraryType>
+uint64_t DdManager<LibraryType>::getSizeInMemory() const {
+    return internalDdManager.getSizeInMemory();
+}
+
 template class DdManager<DdType::CUDD>;
 
 template Add<DdType::CUDD, double> DdManager<DdType::CUDD>::getAddZero() const;
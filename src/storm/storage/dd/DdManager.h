@@ -3,6 +3,7 @@
 
 #include <boost/optional.hpp>
 #include <functional>
+#include <ostream>
 #include <set>
 #include <unordered_map>
 
@@ -10,6 +11,7 @@
 #include "storm/storage/dd/AddIterator.h"
 #include "storm/storage/dd/Bdd.h"
 #include "storm/storage/dd/DdMetaVariable.h"
+#include "storm/storage/dd/DdOperationStatistics.h"
 #include "storm/storage/dd/DdType.h"
 #include "storm/storage/dd/MetaVariablePosition.h"
 
@@ -344,6 +346,37 @@ class DdManager : public std::enable_shared_from_this<DdManager<LibraryType>> {
      */
     void execute(std::function<void()> const& f) const;
 
+    /*!
+     * Retrieves the statistics about the operations performed through this manager. Statistics are collected iff
+     * statistics were requested on the command line or collection was enabled explicitly.
+     *
+     * @return The operation statistics.
+     */
+    DdOperationStatistics& getOperationStatistics();
+
+    /*!
+     * Retrieves the statistics about the operations performed through this manager.
+     *
+     * @return The operation statistics.
+     */
+    DdOperationStatistics const& getOperationStatistics() const;
+
+    /*!
+     * Prints the statistics of the underlying DD library (e.g. cache hit rates, garbage collections and node counts)
+     * together with the operation statistics to the given stream.
+     *
+     * @param out The stream to print to.
+     */
+    void printStatisticsToStream(std::ostream& out) const;
+
+    /*!
+     * Retrieves (an approximation of) the number of bytes currently occupied by the underlying DD library, in particular by the nodes and
+     * the operation cache.
+     *
+     * @return The number of bytes.
+     */
+    uint64_t getSizeInMemory() const;
+
    private:
     /*!
      * Creates a meta variable with the given number of DD variables and layers.
@@ -410,6 +443,9 @@ class DdManager : public std::enable_shared_from_this<DdManager<LibraryType>> {
 
     // The manager responsible for the variables.
     std::shared_ptr<storm::expressions::ExpressionManager> manager;
+
+    // The statistics about the operations performed on DDs of this manager.
+    DdOperationStatistics operationStatistics;
 };
 }  // namespace dd
 }  // namespace storm
@@ -0,0 +1,37 @@
+#include "storm/storage/dd/DdOperationStatistics.h"
+
+namespace storm {
+namespace dd {
+
+DdOperationStatistics::DdOperationStatistics() : enabled(false) {
+    reset();
+}
+
+void DdOperationStatistics::setEnabled(bool value) {
+    enabled = value;
+}
+
+uint64_t DdOperationStatistics::getNumberOfOperations(DdOperationType type) const {
+    return numberOfOperations[static_cast<uint64_t>(type)];
+}
+
+uint64_t DdOperationStatistics::getTimeInNanoseconds(DdOperationType type) const {
+    return timeInNanoseconds[static_cast<uint64_t>(type)];
+}
+
+void DdOperationStatistics::reset() {
+    numberOfOperations.fill(0);
+    timeInNanoseconds.fill(0);
+}
+
+void DdOperationStatistics::printToStream(std::ostream& out) const {
+    static const std::array<char const*, numberOfOperationTypes> names = {"and-exists", "relational product", "if-then-else", "apply",
+                                                                           "matrix multiplication"};
+    out << "Operation statistics:\n";
+    for (uint64_t index = 0; index < numberOfOperationTypes; ++index) {
+        out << "   * " << names[index] << ": " << numberOfOperations[index] << " calls, " << (timeInNanoseconds[index] / 1000000) << "ms\n";
+    }
+}
+
+}  // namespace dd
+}  // namespace storm
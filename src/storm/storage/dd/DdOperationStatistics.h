@@ -0,0 +1,99 @@
+#pragma once
+
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <ostream>
+
+namespace storm {
+namespace dd {
+
+// The kinds of DD operations for which statistics are collected.
+enum class DdOperationType { AndExists, RelationalProduct, Ite, Apply, MatrixMultiplication };
+
+/*!
+ * Collects the number of invocations and the time spent in the most expensive operations of a DD manager.
+ * Collection is disabled by default, in which case measurements amount to a single branch.
+ */
+class DdOperationStatistics {
+   public:
+    /*!
+     * Measures the duration of one operation from construction to destruction.
+     */
+    class Measurement {
+       public:
+        Measurement(DdOperationStatistics& statistics, DdOperationType type);
+        ~Measurement();
+
+        Measurement(Measurement const& other) = delete;
+        Measurement& operator=(Measurement const& other) = delete;
+
+       private:
+        DdOperationStatistics& statistics;
+        DdOperationType type;
+        bool enabled;
+        std::chrono::steady_clock::time_point start;
+    };
+
+    DdOperationStatistics();
+
+    /*!
+     * Sets whether statistics are collected.
+     */
+    void setEnabled(bool value);
+
+    /*!
+     * Retrieves whether statistics are collected.
+     */
+    bool isEnabled() const;
+
+    /*!
+     * Retrieves how often operations of the given type were performed.
+     */
+    uint64_t getNumberOfOperations(DdOperationType type) const;
+
+    /*!
+     * Retrieves the accumulated time (in nanoseconds) spent in operations of the given type.
+     */
+    uint64_t getTimeInNanoseconds(DdOperationType type) const;
+
+    /*!
+     * Resets all counters to zero.
+     */
+    void reset();
+
+    /*!
+     * Prints the collected statistics to the given stream.
+     */
+    void printToStream(std::ostream& out) const;
+
+   private:
+    static const uint64_t numberOfOperationTypes = 5;
+
+    bool enabled;
+    std::array<uint64_t, numberOfOperationTypes> numberOfOperations;
+    std::array<uint64_t, numberOfOperationTypes> timeInNanoseconds;
+};
+
+inline DdOperationStatistics::Measurement::Measurement(DdOperationStatistics& statistics, DdOperationType type)
+    : statistics(statistics), type(type), enabled(statistics.isEnabled()) {
+    if (enabled) {
+        start = std::chrono::steady_clock::now();
+    }
+}
+
+inline DdOperationStatistics::Measurement::~Measurement() {
+    if (enabled) {
+        uint64_t index = static_cast<uint64_t>(type);
+        ++statistics.numberOfOperations[index];
+        statistics.timeInNanoseconds[index] +=
+            static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start).count());
+    }
+}
+
+inline bool DdOperationStatistics::isEnabled() const {
+    return enabled;
+}
+
+}  // namespace dd
+}  // namespace storm
@@ -0,0 +1,136 @@
+#include "storm/storage/dd/PartitionedTransitionRelation.h"
+
+#include "storm/storage/dd/DdManager.h"
+
+#include "storm/exceptions/InvalidArgumentException.h"
+#include "storm/utility/macros.h"
+
+namespace storm {
+namespace dd {
+
+template<storm::dd::DdType Type>
+PartitionedTransitionRelation<Type>::PartitionedTransitionRelation(
+    TransitionRelationPartitioning partitioning, std::vector<storm::dd::Bdd<Type>> const& parts,
+    std::vector<std::pair<storm::expressions::Variable, storm::expressions::Variable>> const& rowColumnMetaVariablePairs)
+    : partitioning(partitioning), rowColumnMetaVariablePairs(rowColumnMetaVariablePairs) {
+    STORM_LOG_THROW(!parts.empty(), storm::exceptions::InvalidArgumentException, "Partitioned transition relation requires at least one part.");
+    if (partitioning == TransitionRelationPartitioning::Disjunctive) {
+        initializeDisjunctiveParts(parts);
+    } else {
+        initializeConjunctiveParts(parts);
+    }
+    STORM_LOG_TRACE("Created " << (partitioning == TransitionRelationPartitioning::Disjunctive ? "disjunctively" : "conjunctively")
+                               << " partitioned transition relation with " << parts.size() << " part(s) (monolithic size " << relation.getNodeCount()
+                               << " nodes).");
+}
+
+template<storm::dd::DdType Type>
+void PartitionedTransitionRelation<Type>::initializeDisjunctiveParts(std::vector<storm::dd::Bdd<Type>> const& parts) {
+    storm::dd::DdManager<Type> const& manager = parts.front().getDdManager();
+    relation = manager.getBddZero();
+    for (auto const& part : parts) {
+        relation |= part;
+
+        // Remove the frame conditions of all variables the part does not change. If the part implies row = column for
+        // a variable, it equals the conjunction of this identity with the part in which the column variable is abstracted.
+        Part newPart;
+        newPart.relation = part;
+        std::set<storm::expressions::Variable> unchangedColumnVariables;
+        for (auto const& metaVariablePair : rowColumnMetaVariablePairs) {
+            if ((part && !manager.getIdentity(metaVariablePair.first, metaVariablePair.second)).isZero()) {
+                unchangedColumnVariables.insert(metaVariablePair.second);
+            } else {
+                newPart.imageQuantificationVariables.insert(metaVariablePair.first);
+                newPart.preimageQuantificationVariables.insert(metaVariablePair.second);
+                newPart.rowColumnMetaVariablePairs.push_back(metaVariablePair);
+            }
+        }
+        newPart.relation = newPart.relation.existsAbstract(unchangedColumnVariables);
+        this->parts.push_back(std::move(newPart));
+    }
+}
+
+template<storm::dd::DdType Type>
+void PartitionedTransitionRelation<Type>::initializeConjunctiveParts(std::vector<storm::dd::Bdd<Type>> const& parts) {
+    storm::dd::DdManager<Type> const& manager = parts.front().getDdManager();
+    relation = manager.getBddOne();
+    for (auto const& part : parts) {
+        relation &= part;
+        Part newPart;
+        newPart.relation = part;
+        this->parts.push_back(std::move(newPart));
+    }
+
+    // Schedule the quantification of every variable right after the last part that depends on it. Variables that no
+    // part depends on only occur in the states and are quantified together with the first part.
+    for (auto const& metaVariablePair : rowColumnMetaVariablePairs) {
+        uint64_t lastRowOccurrence = 0;
+        uint64_t lastColumnOccurrence = 0;
+        for (uint64_t partIndex = 0; partIndex < parts.size(); ++partIndex) {
+            std::set<storm::expressions::Variable> const& containedMetaVariables = parts[partIndex].getContainedMetaVariables();
+            if (containedMetaVariables.count(metaVariablePair.first) > 0) {
+                lastRowOccurrence = partIndex;
+            }
+            if (containedMetaVariables.count(metaVariablePair.second) > 0) {
+                lastColumnOccurrence = partIndex;
+            }
+        }
+        this->parts[lastRowOccurrence].imageQuantificationVariables.insert(metaVariablePair.first);
+        this->parts[lastColumnOccurrence].preimageQuantificationVariables.insert(metaVariablePair.second);
+    }
+}
+
+template<storm::dd::DdType Type>
+TransitionRelationPartitioning PartitionedTransitionRelation<Type>::getPartitioning() const {
+    return partitioning;
+}
+
+template<storm::dd::DdType Type>
+uint64_t PartitionedTransitionRelation<Type>::getNumberOfParts() const {
+    return parts.size();
+}
+
+template<storm::dd::DdType Type>
+storm::dd::Bdd<Type> const& PartitionedTransitionRelation<Type>::getRelation() const {
+    return relation;
+}
+
+template<storm::dd::DdType Type>
+storm::dd::Bdd<Type> PartitionedTransitionRelation<Type>::image(storm::dd::Bdd<Type> const& states) const {
+    if (partitioning == TransitionRelationPartitioning::Disjunctive) {
+        storm::dd::Bdd<Type> result = states.getDdManager().getBddZero();
+        for (auto const& part : parts) {
+            result |= states.andExists(part.relation, part.imageQuantificationVariables).swapVariables(part.rowColumnMetaVariablePairs);
+        }
+        return result;
+    } else {
+        storm::dd::Bdd<Type> result = states;
+        for (auto const& part : parts) {
+            result = result.andExists(part.relation, part.imageQuantificationVariables);
+        }
+        return result.swapVariables(rowColumnMetaVariablePairs);
+    }
+}
+
+template<storm::dd::DdType Type>
+storm::dd::Bdd<Type> PartitionedTransitionRelation<Type>::preimage(storm::dd::Bdd<Type> const& states) const {
+    if (partitioning == TransitionRelationPartitioning::Disjunctive) {
+        storm::dd::Bdd<Type> result = states.getDdManager().getBddZero();
+        for (auto const& part : parts) {
+            result |= states.swapVariables(part.rowColumnMetaVariablePairs).andExists(part.relation, part.preimageQuantificationVariables);
+        }
+        return result;
+    } else {
+        storm::dd::Bdd<Type> result = states.swapVariables(rowColumnMetaVariablePairs);
+        for (auto const& part : parts) {
+            result = result.andExists(part.relation, part.preimageQuantificationVariables);
+        }
+        return result;
+    }
+}
+
+template class PartitionedTransitionRelation<storm::dd::DdType::CUDD>;
+template class PartitionedTransitionRelation<storm::dd::DdType::Sylvan>;
+
+}  // namespace dd
+}  // namespace storm
@@ -0,0 +1,91 @@
+#pragma once
+
+#include <set>
+#include <utility>
+#include <vector>
+
+#include "storm/storage/dd/Bdd.h"
+#include "storm/storage/dd/DdType.h"
+#include "storm/storage/expressions/Variable.h"
+
+namespace storm {
+namespace dd {
+
+// Whether the parts of a partitioned transition relation are to be combined by disjunction or by conjunction.
+enum class TransitionRelationPartitioning { Disjunctive, Conjunctive };
+
+/*!
+ * A transition relation (over row and column meta variables) that is represented by several parts instead of one
+ * monolithic BDD. For disjunctive partitionings, the relation is the union of the parts, which typically correspond
+ * to the transitions of individual modules (or automata). For these, the frame conditions (identities on variables
+ * that a part does not change) are removed from the parts, so that image computations only touch the variables that
+ * actually change. For conjunctive partitionings, the relation is the intersection of the parts and the image
+ * computations quantify every variable as soon as the remaining parts no longer depend on it (early quantification).
+ */
+template<storm::dd::DdType Type>
+class PartitionedTransitionRelation {
+   public:
+    /*!
+     * Creates a partitioned transition relation.
+     *
+     * @param partitioning How the parts are to be combined.
+     * @param parts The parts of the relation (over the given row and column meta variables only). For conjunctive
+     * partitionings, the parts are combined in the given order.
+     * @param rowColumnMetaVariablePairs All pairs of row/column meta variables the relation is defined over.
+     */
+    PartitionedTransitionRelation(TransitionRelationPartitioning partitioning, std::vector<storm::dd::Bdd<Type>> const& parts,
+                                  std::vector<std::pair<storm::expressions::Variable, storm::expressions::Variable>> const& rowColumnMetaVariablePairs);
+
+    /*!
+     * Retrieves how the parts are combined.
+     */
+    TransitionRelationPartitioning getPartitioning() const;
+
+    /*!
+     * Retrieves the number of parts.
+     */
+    uint64_t getNumberOfParts() const;
+
+    /*!
+     * Retrieves the monolithic relation represented by the parts.
+     */
+    storm::dd::Bdd<Type> const& getRelation() const;
+
+    /*!
+     * Computes the successors of the given states (over the row meta variables).
+     *
+     * @return The successor states (over the row meta variables).
+     */
+    storm::dd::Bdd<Type> image(storm::dd::Bdd<Type> const& states) const;
+
+    /*!
+     * Computes the predecessors of the given states (over the row meta variables).
+     *
+     * @return The predecessor states (over the row meta variables).
+     */
+    storm::dd::Bdd<Type> preimage(storm::dd::Bdd<Type> const& states) const;
+
+   private:
+    struct Part {
+        // The part itself, where variables that are not changed by disjunctive parts are abstracted.
+        storm::dd::Bdd<Type> relation;
+
+        // The row and column meta variables to quantify when combining the part in an image or preimage, respectively.
+        std::set<storm::expressions::Variable> imageQuantificationVariables;
+        std::set<storm::expressions::Variable> preimageQuantificationVariables;
+
+        // The pairs of meta variables that need to be swapped when combining a (disjunctive) part.
+        std::vector<std::pair<storm::expressions::Variable, storm::expressions::Variable>> rowColumnMetaVariablePairs;
+    };
+
+    void initializeDisjunctiveParts(std::vector<storm::dd::Bdd<Type>> const& parts);
+    void initializeConjunctiveParts(std::vector<storm::dd::Bdd<Type>> const& parts);
+
+    TransitionRelationPartitioning partitioning;
+    std::vector<Part> parts;
+    storm::dd::Bdd<Type> relation;
+    std::vector<std::pair<storm::expressions::Variable, storm::expressions::Variable>> rowColumnMetaVariablePairs;
+};
+
+}  // namespace dd
+}  // namespace storm
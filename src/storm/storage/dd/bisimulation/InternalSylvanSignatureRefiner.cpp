@@ -11,6 +11,8 @@
 
 #include "sylvan_cache.h"
 
+#include <algorithm>
+
 namespace storm {
 namespace dd {
 namespace bisimulation {
@@ -59,12 +61,9 @@ Partition<storm::dd::DdType::Sylvan, ValueType> InternalSignatureRefiner<storm::
 
 template<typename ValueType>
 void InternalSignatureRefiner<storm::dd::DdType::Sylvan, ValueType>::clearCaches() {
-    for (auto& e : this->table) {
-        e = NO_ELEMENT_MARKER;
-    }
-    for (auto& e : this->signatures) {
-        e = 0ull;
-    }
+    // The table may have grown considerably during the refinement, so we clear it using all workers.
+    RUN(sylvan_clear_table, 0, this->currentCapacity, this);
+    std::fill(this->signatures.begin(), this->signatures.end(), 0ull);
 }
 
 template<typename ValueType>
@@ -161,6 +160,17 @@ VOID_TASK_3(sylvan_rehash, size_t, first, size_t, count, InternalSylvanSignature
     }
 }
 
+VOID_TASK_3(sylvan_clear_table, size_t, first, size_t, count, InternalSylvanSignatureRefinerBase*, refiner) {
+    if (count > 4096) {
+        SPAWN(sylvan_clear_table, first, count / 2, refiner);
+        CALL(sylvan_clear_table, first + count / 2, count - count / 2, refiner);
+        SYNC(sylvan_clear_table);
+        return;
+    }
+
+    std::fill(refiner->table.begin() + first * 3, refiner->table.begin() + (first + count) * 3, NO_ELEMENT_MARKER);
+}
+
 VOID_TASK_1(sylvan_grow_it, InternalSylvanSignatureRefinerBase*, refiner) {
     refiner->oldTable = std::move(refiner->table);
 
@@ -70,7 +70,7 @@ Partition<DdType, ValueType> PartitionRefiner<DdType, ValueType>::internalRefine
             totalRefinementTime += (refinementEnd - refinementStart);
 
             signatureTime += std::chrono::duration_cast<std::chrono::milliseconds>(signatureEnd - signatureStart).count();
-            refinementTime = std::chrono::duration_cast<std::chrono::milliseconds>(refinementEnd - refinementStart).count();
+            refinementTime += std::chrono::duration_cast<std::chrono::milliseconds>(refinementEnd - refinementStart).count();
 
             // Potentially exit early in case we have refined the partition already.
             if (newPartition.getNumberOfBlocks() > oldPartition.getNumberOfBlocks()) {
@@ -79,8 +79,9 @@ Partition<DdType, ValueType> PartitionRefiner<DdType, ValueType>::internalRefine
         }
 
         auto totalTimeInRefinement = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::high_resolution_clock::now() - start).count();
-        STORM_LOG_INFO("Refinement " << refinements << " produced " << newPartition.getNumberOfBlocks() << " blocks and was completed in "
-                                     << totalTimeInRefinement << "ms (signature: " << signatureTime << "ms, refinement: " << refinementTime << "ms).");
+        STORM_LOG_INFO("Refinement " << refinements << " produced " << newPartition.getNumberOfBlocks() << " blocks (" << newPartition.getNodeCount()
+                                     << " nodes) and was completed in " << totalTimeInRefinement << "ms (signature: " << signatureTime
+                                     << "ms, refinement: " << refinementTime << "ms).");
         ++refinements;
         return newPartition;
     } else {
@@ -1,10 +1,12 @@
 #include "storm/storage/dd/bisimulation/PreservationInformation.h"
 
+#include "storm/builder/TerminalStatesGetter.h"
 #include "storm/logic/Formulas.h"
 
 #include "storm/models/symbolic/Model.h"
 
 #include "storm/models/symbolic/StandardRewardModel.h"
+#include "storm/storage/dd/DdManager.h"
 
 #include "storm/exceptions/InvalidPropertyException.h"
 #include "storm/utility/macros.h"
@@ -73,6 +75,48 @@ PreservationInformation<DdType, ValueType>::PreservationInformation(storm::model
                 }
             }
         }
+
+        if (formulas.size() == 1) {
+            computeTerminalStates(model, *formulas.front());
+        }
+    }
+}
+
+template<storm::dd::DdType DdType, typename ValueType>
+void PreservationInformation<DdType, ValueType>::computeTerminalStates(storm::models::symbolic::Model<DdType, ValueType> const& model,
+                                                                       storm::logic::Formula const& formula) {
+    storm::builder::TerminalStates formulaTerminalStates = storm::builder::getTerminalStatesFromFormula(formula);
+    storm::dd::Bdd<DdType> states = model.getManager().getBddZero();
+    for (auto const& expression : formulaTerminalStates.terminalExpressions) {
+        states |= model.getStates(expression);
+    }
+    for (auto const& expression : formulaTerminalStates.negatedTerminalExpressions) {
+        states |= !model.getStates(expression);
+    }
+    for (auto const& label : formulaTerminalStates.terminalLabels) {
+        states |= model.getStates(label);
+    }
+    for (auto const& label : formulaTerminalStates.negatedTerminalLabels) {
+        states |= !model.getStates(label);
+    }
+    terminalStates = states && model.getReachableStates();
+
+    // For step-bounded formulas, states beyond the bound are irrelevant.
+    if (model.isDiscreteTimeModel() && formula.isOperatorFormula()) {
+        storm::logic::Formula const& subformula = formula.asOperatorFormula().getSubformula();
+        if (subformula.isBoundedUntilFormula()) {
+            storm::logic::BoundedUntilFormula const& boundedUntilFormula = subformula.asBoundedUntilFormula();
+            if (!boundedUntilFormula.isMultiDimensional() && boundedUntilFormula.getTimeBoundReference().isTimeBound() &&
+                boundedUntilFormula.hasUpperBound() && boundedUntilFormula.hasIntegerUpperBound()) {
+                maximalExplorationDepth = boundedUntilFormula.getNonStrictUpperBound<uint64_t>();
+            }
+        } else if (subformula.isCumulativeRewardFormula()) {
+            storm::logic::CumulativeRewardFormula const& cumulativeRewardFormula = subformula.asCumulativeRewardFormula();
+            if (!cumulativeRewardFormula.isMultiDimensional() && cumulativeRewardFormula.getTimeBoundReference().isTimeBound() &&
+                cumulativeRewardFormula.hasIntegerBound()) {
+                maximalExplorationDepth = cumulativeRewardFormula.getBound<uint64_t>();
+            }
+        }
     }
 }
 
@@ -106,6 +150,22 @@ std::set<std::string> const& PreservationInformation<DdType, ValueType>::getRewa
     return rewardModelNames;
 }
 
+template<storm::dd::DdType DdType, typename ValueType>
+bool PreservationInformation<DdType, ValueType>::hasTerminalStates() const {
+    return static_cast<bool>(terminalStates);
+}
+
+template<storm::dd::DdType DdType, typename ValueType>
+storm::dd::Bdd<DdType> const& PreservationInformation<DdType, ValueType>::getTerminalStates() const {
+    STORM_LOG_ASSERT(terminalStates, "No terminal states available.");
+    return *terminalStates;
+}
+
+template<storm::dd::DdType DdType, typename ValueType>
+std::optional<uint64_t> const& PreservationInformation<DdType, ValueType>::getMaximalExplorationDepth() const {
+    return maximalExplorationDepth;
+}
+
 template class PreservationInformation<storm::dd::DdType::CUDD, double>;
 
 template class PreservationInformation<storm::dd::DdType::Sylvan, double>;
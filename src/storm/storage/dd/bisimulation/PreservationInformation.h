@@ -1,11 +1,13 @@
 #pragma once
 
 #include <memory>
+#include <optional>
 #include <set>
 #include <string>
 #include <vector>
 
 #include "storm/storage/bisimulation/BisimulationType.h"
+#include "storm/storage/dd/Bdd.h"
 #include "storm/storage/dd/DdType.h"
 
 #include "storm/logic/Formula.h"
@@ -41,10 +43,31 @@ class PreservationInformation {
     std::set<storm::expressions::Expression> const& getExpressions() const;
     std::set<std::string> const& getRewardModelNames() const;
 
+    /*!
+     * Retrieves whether the states from which the (single) preserved formula does not require further exploration are known.
+     */
+    bool hasTerminalStates() const;
+
+    /*!
+     * Retrieves the states from which the preserved formula does not require further exploration. These are unions of
+     * blocks of any partition respecting this preservation information.
+     */
+    storm::dd::Bdd<DdType> const& getTerminalStates() const;
+
+    /*!
+     * Retrieves the maximal number of steps that are relevant for the preserved formula (if it is step-bounded).
+     */
+    std::optional<uint64_t> const& getMaximalExplorationDepth() const;
+
    private:
+    void computeTerminalStates(storm::models::symbolic::Model<DdType, ValueType> const& model, storm::logic::Formula const& formula);
+
     std::set<std::string> labels;
     std::set<storm::expressions::Expression> expressions;
     std::set<std::string> rewardModelNames;
+
+    std::optional<storm::dd::Bdd<DdType>> terminalStates;
+    std::optional<uint64_t> maximalExplorationDepth;
 };
 
 }  // namespace bisimulation
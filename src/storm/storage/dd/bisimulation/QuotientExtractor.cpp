@@ -25,6 +25,7 @@
 #include "storm/settings/modules/BisimulationSettings.h"
 
 #include "storm/exceptions/NotSupportedException.h"
+#include "storm/utility/dd.h"
 #include "storm/utility/macros.h"
 
 #include "storm/storage/BitVector.h"
@@ -905,6 +906,7 @@ QuotientExtractor<DdType, ValueType, ExportValueType>::QuotientExtractor(storm::
     auto const& settings = storm::settings::getModule<storm::settings::modules::BisimulationSettings>();
     this->useRepresentatives = settings.isUseRepresentativesSet();
     this->useOriginalVariables = settings.isUseOriginalVariablesSet();
+    this->lazyExtraction = settings.isLazyQuotientExtractionSet();
 }
 
 template<storm::dd::DdType DdType, typename ValueType, typename ExportValueType>
@@ -942,14 +944,26 @@ std::shared_ptr<storm::models::sparse::Model<ExportValueType>> QuotientExtractor
         "Representatives size does not match that of the partition: " << representatives.getNonZeroCount() << " vs. " << partition.getNumberOfBlocks() << ".");
     STORM_LOG_ASSERT((representatives && partitionAsBdd).existsAbstract(model.getRowVariables()) == partitionAsBdd.existsAbstract(model.getRowVariables()),
                      "Representatives do not cover all blocks.");
-    InternalSparseQuotientExtractor<DdType, ValueType, ExportValueType> sparseExtractor(model, partitionAsBdd, partition.getBlockVariable(),
-                                                                                        partition.getNumberOfBlocks(), representatives);
-    storm::storage::SparseMatrix<ExportValueType> quotientTransitionMatrix = sparseExtractor.extractTransitionMatrix(model.getTransitionMatrix());
+
+    uint64_t numberOfBlocks = partition.getNumberOfBlocks();
+    storm::dd::Add<DdType, ValueType> transitionMatrix = model.getTransitionMatrix();
+    if (this->lazyExtraction && preservationInformation.hasTerminalStates() &&
+        (model.getType() == storm::models::ModelType::Dtmc || model.getType() == storm::models::ModelType::Mdp)) {
+        restrictToRelevantBlocks(model, preservationInformation, partition.getBlockVariable(), partitionAsBdd, representatives, transitionMatrix);
+        numberOfBlocks = representatives.getNonZeroCount();
+        STORM_LOG_INFO("Lazy quotient extraction restricts the quotient to " << numberOfBlocks << " of " << partition.getNumberOfBlocks() << " blocks.");
+    } else if (this->lazyExtraction) {
+        STORM_LOG_WARN("Lazy quotient extraction requires a single property on a DTMC or MDP. Extracting the full quotient.");
+    }
+
+    InternalSparseQuotientExtractor<DdType, ValueType, ExportValueType> sparseExtractor(model, partitionAsBdd, partition.getBlockVariable(), numberOfBlocks,
+                                                                                        representatives);
+    storm::storage::SparseMatrix<ExportValueType> quotientTransitionMatrix = sparseExtractor.extractTransitionMatrix(transitionMatrix);
     auto end = std::chrono::high_resolution_clock::now();
     STORM_LOG_INFO("Quotient transition matrix extracted in " << std::chrono::duration_cast<std::chrono::milliseconds>(end - start).count() << "ms.");
 
     start = std::chrono::high_resolution_clock::now();
-    storm::models::sparse::StateLabeling quotientStateLabeling(partition.getNumberOfBlocks());
+    storm::models::sparse::StateLabeling quotientStateLabeling(numberOfBlocks);
     quotientStateLabeling.addLabel("init", sparseExtractor.extractSetExists(model.getInitialStates()));
     quotientStateLabeling.addLabel("deadlock", sparseExtractor.extractSetExists(model.getDeadlockStates()));
 
@@ -1016,6 +1030,44 @@ std::shared_ptr<storm::models::sparse::Model<ExportValueType>> QuotientExtractor
     return result;
 }
 
+template<storm::dd::DdType DdType, typename ValueType, typename ExportValueType>
+void QuotientExtractor<DdType, ValueType, ExportValueType>::restrictToRelevantBlocks(storm::models::symbolic::Model<DdType, ValueType> const& model,
+                                                                                     PreservationInformation<DdType, ValueType> const& preservationInformation,
+                                                                                     storm::expressions::Variable const& blockVariable,
+                                                                                     storm::dd::Bdd<DdType>& partitionBdd,
+                                                                                     storm::dd::Bdd<DdType>& representatives,
+                                                                                     storm::dd::Add<DdType, ValueType>& transitionMatrix) const {
+    // Explore the model from the initial states outwards, but do not explore beyond terminal states or the maximal depth.
+    // Since bisimilar states have the same successor blocks, a block needs to be explored iff it contains an explored state.
+    storm::dd::Bdd<DdType> transitions = model.getQualitativeTransitionMatrix(false);
+    storm::dd::Bdd<DdType> const& terminalStates = preservationInformation.getTerminalStates();
+    std::optional<uint64_t> const& maximalDepth = preservationInformation.getMaximalExplorationDepth();
+    storm::dd::Bdd<DdType> relevantStates = model.getInitialStates();
+    storm::dd::Bdd<DdType> exploredStates = model.getManager().getBddZero();
+    storm::dd::Bdd<DdType> frontier = relevantStates && !terminalStates;
+    for (uint64_t depth = 0; !frontier.isZero() && (!maximalDepth || depth < maximalDepth.value()); ++depth) {
+        exploredStates |= frontier;
+        frontier = frontier.relationalProduct(transitions, model.getRowVariables(), model.getColumnVariables()) && !relevantStates;
+        relevantStates |= frontier;
+        frontier &= !terminalStates;
+    }
+
+    std::set<storm::expressions::Variable> blockVariableSet = {blockVariable};
+    storm::dd::Bdd<DdType> relevantBlocks = (relevantStates && partitionBdd).existsAbstract(model.getRowVariables());
+    partitionBdd &= relevantBlocks;
+    representatives &= partitionBdd.existsAbstract(blockVariableSet);
+    storm::dd::Bdd<DdType> exploredRepresentatives =
+        representatives && (exploredStates && partitionBdd).existsAbstract(model.getRowVariables()).andExists(partitionBdd, blockVariableSet);
+    storm::dd::Bdd<DdType> absorbingRepresentatives = representatives && !exploredRepresentatives;
+
+    // Keep the transitions of the explored blocks and make all other relevant blocks absorbing (keeping their choices).
+    storm::dd::Bdd<DdType> absorbingChoices =
+        transitionMatrix.notZero().existsAbstract(model.getColumnVariables()) && absorbingRepresentatives;
+    transitionMatrix =
+        transitionMatrix * exploredRepresentatives.template toAdd<ValueType>() +
+        (absorbingChoices && storm::utility::dd::getRowColumnDiagonal(model.getManager(), model.getRowColumnMetaVariablePairs())).template toAdd<ValueType>();
+}
+
 template<storm::dd::DdType DdType, typename ValueType, typename ExportValueType>
 std::shared_ptr<storm::models::symbolic::Model<DdType, ExportValueType>> QuotientExtractor<DdType, ValueType, ExportValueType>::extractDdQuotient(
     storm::models::symbolic::Model<DdType, ValueType> const& model, Partition<DdType, ValueType> const& partition,
@@ -39,8 +39,19 @@ class QuotientExtractor {
         storm::models::symbolic::Model<DdType, ValueType> const& model, Partition<DdType, ValueType> const& partition,
         PreservationInformation<DdType, ValueType> const& preservationInformation);
 
+    /*!
+     * Restricts the partition, the representatives and the transition matrix to the blocks relevant for the preserved
+     * formula, i.e. the blocks reachable from the initial blocks without passing terminal states (and not exceeding the
+     * maximal exploration depth). All relevant blocks that need not be explored further are made absorbing.
+     */
+    void restrictToRelevantBlocks(storm::models::symbolic::Model<DdType, ValueType> const& model,
+                                  PreservationInformation<DdType, ValueType> const& preservationInformation, storm::expressions::Variable const& blockVariable,
+                                  storm::dd::Bdd<DdType>& partitionBdd, storm::dd::Bdd<DdType>& representatives,
+                                  storm::dd::Add<DdType, ValueType>& transitionMatrix) const;
+
     bool useRepresentatives;
     bool useOriginalVariables;
+    bool lazyExtraction;
     storm::dd::bisimulation::QuotientFormat quotientFormat;
 };
 
@@ -8,13 +8,23 @@
 namespace storm {
 namespace dd {
 
-InternalDdManager<DdType::CUDD>::InternalDdManager() : cuddManager(), reorderingTechnique(CUDD_REORDER_NONE), numberOfDdVariables(0) {
+InternalDdManager<DdType::CUDD>::InternalDdManager()
+    : cuddManager(0, 0, static_cast<unsigned int>(storm::settings::getModule<storm::settings::modules::CuddSettings>().getUniqueTableSlots()),
+                  static_cast<unsigned int>(storm::settings::getModule<storm::settings::modules::CuddSettings>().getCacheSlots())),
+      reorderingTechnique(CUDD_REORDER_NONE),
+      numberOfDdVariables(0) {
     this->cuddManager.SetMaxMemory(
         static_cast<unsigned long>(storm::settings::getModule<storm::settings::modules::CuddSettings>().getMaximalMemory() * 1024ul * 1024ul));
 
     auto const& settings = storm::settings::getModule<storm::settings::modules::CuddSettings>();
     this->cuddManager.SetEpsilon(settings.getConstantPrecision());
 
+    // Set up how the operation cache is allowed to grow.
+    if (settings.getMaximalCacheSlots() > 0) {
+        Cudd_SetMaxCacheHard(this->cuddManager.getManager(), static_cast<unsigned int>(settings.getMaximalCacheSlots()));
+    }
+    Cudd_SetMinHit(this->cuddManager.getManager(), static_cast<unsigned int>(settings.getMinimalCacheHitRate()));
+
     // Now set the selected reordering technique.
     storm::settings::modules::CuddSettings::ReorderingTechnique reorderingTechniqueAsSetting = settings.getReorderingTechnique();
     switch (reorderingTechniqueAsSetting) {
@@ -205,6 +215,27 @@ void InternalDdManager<DdType::CUDD>::execute(std::function<void()> const& f) co
     f();
 }
 
+void InternalDdManager<DdType::CUDD>::printStatisticsToStream(std::ostream& out) const {
+    ::DdManager* manager = cuddManager.getManager();
+    double lookups = Cudd_ReadCacheLookUps(manager);
+    double hits = Cudd_ReadCacheHits(manager);
+
+    out << "CUDD statistics:\n";
+    out << "   * nodes: " << Cudd_ReadNodeCount(manager) << " (peak " << Cudd_ReadPeakNodeCount(manager) << ", peak live "
+        << Cudd_ReadPeakLiveNodeCount(manager) << ")\n";
+    out << "   * unique table slots: " << Cudd_ReadSlots(manager) << "\n";
+    out << "   * cache slots: " << Cudd_ReadCacheSlots(manager) << " (max " << Cudd_ReadMaxCacheHard(manager) << ", "
+        << (Cudd_ReadCacheUsedSlots(manager) * 100) << "% used)\n";
+    out << "   * cache lookups: " << static_cast<uint64_t>(lookups) << " (hit rate " << (lookups > 0 ? hits * 100 / lookups : 0.0) << "%)\n";
+    out << "   * garbage collections: " << Cudd_ReadGarbageCollections(manager) << " (" << Cudd_ReadGarbageCollectionTime(manager) << "ms)\n";
+    out << "   * reorderings: " << Cudd_ReadReorderings(manager) << " (" << Cudd_ReadReorderingTime(manager) << "ms)\n";
+    out << "   * memory in use: " << (Cudd_ReadMemoryInUse(manager) / (1024 * 1024)) << "MB\n";
+}
+
+uint64_t InternalDdManager<DdType::CUDD>::getSizeInMemory() const {
+    return Cudd_ReadMemoryInUse(cuddManager.getManager());
+}
+
 cudd::Cudd& InternalDdManager<DdType::CUDD>::getCuddManager() {
     return cuddManager;
 }
@@ -3,6 +3,7 @@
 
 #include <boost/optional.hpp>
 #include <functional>
+#include <ostream>
 
 #include "storm/storage/dd/DdType.h"
 #include "storm/storage/dd/InternalDdManager.h"
@@ -141,6 +142,20 @@ class InternalDdManager<DdType::CUDD> {
      */
     void execute(std::function<void()> const& f) const;
 
+    /*!
+     * Prints the statistics of CUDD (node counts, cache usage, garbage collections and reorderings) to the given stream.
+     *
+     * @param out The stream to print to.
+     */
+    void printStatisticsToStream(std::ostream& out) const;
+
+    /*!
+     * Retrieves the number of bytes currently allocated by CUDD.
+     *
+     * @return The number of bytes.
+     */
+    uint64_t getSizeInMemory() const;
+
     /*!
      * Retrieves the number of DD variables managed by this manager.
      *
@@ -15,6 +15,26 @@
 
 #include "storm-config.h"
 
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wzero-length-array"
+#pragma clang diagnostic ignored "-Wc99-extensions"
+#endif
+
+VOID_TASK_3(sylvan_matrix_components_jobs, uint64_t, first, uint64_t, count, std::function<void(uint64_t)> const*, processJob) {
+    if (count > 1) {
+        SPAWN(sylvan_matrix_components_jobs, first, count / 2, processJob);
+        CALL(sylvan_matrix_components_jobs, first + count / 2, count - count / 2, processJob);
+        SYNC(sylvan_matrix_components_jobs);
+    } else if (count == 1) {
+        (*processJob)(first);
+    }
+}
+
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
+
 namespace storm {
 namespace dd {
 template<typename ValueType>
@@ -966,8 +986,34 @@ template<typename ValueType>
 void InternalAdd<DdType::Sylvan, ValueType>::composeWithExplicitVector(storm::dd::Odd const& odd, std::vector<uint_fast64_t> const& ddVariableIndices,
                                                                        std::vector<ValueType>& targetVector,
                                                                        std::function<ValueType(ValueType const&, ValueType const&)> const& function) const {
-    forEachRec(this->getSylvanMtbdd().GetMTBDD(), 0, ddVariableIndices.size(), 0, odd, ddVariableIndices,
-               [&function, &targetVector](uint64_t const& offset, ValueType const& value) { targetVector[offset] = function(targetVector[offset], value); });
+    std::function<void(uint64_t const&, ValueType const&)> composeEntry = [&function, &targetVector](uint64_t const& offset, ValueType const& value) {
+        targetVector[offset] = function(targetVector[offset], value);
+    };
+
+    // Subtrees of the ADD cover disjoint ranges of offsets, so they can be enumerated in parallel and write their entries directly to the
+    // (preallocated) target vector. As copying non-primitive values is not thread-safe for all number types, this is only done for
+    // primitive values.
+    uint64_t numberOfWorkers = lace_workers();
+    if (ddManager->isParallelConversionEnabled() && numberOfWorkers > 1 && std::is_arithmetic<ValueType>::value) {
+        // Split into (a few times) more subtrees than there are workers to balance the load.
+        uint_fast64_t splitLevels = 2;
+        while ((1ull << splitLevels) < numberOfWorkers) {
+            ++splitLevels;
+        }
+        splitLevels = std::min<uint_fast64_t>(splitLevels + 2, ddVariableIndices.size());
+
+        std::vector<EnumerationSubtree> subtrees;
+        collectSubtreesRec(this->getSylvanMtbdd().GetMTBDD(), 0, splitLevels, 0, odd, ddVariableIndices, subtrees);
+
+        std::function<void(uint64_t)> processSubtree = [&](uint64_t index) {
+            EnumerationSubtree const& subtree = subtrees[index];
+            forEachRec(subtree.dd, splitLevels, ddVariableIndices.size(), subtree.offset, *subtree.odd, ddVariableIndices, composeEntry);
+        };
+        RUN(sylvan_matrix_components_jobs, 0, subtrees.size(), &processSubtree);
+        return;
+    }
+
+    forEachRec(this->getSylvanMtbdd().GetMTBDD(), 0, ddVariableIndices.size(), 0, odd, ddVariableIndices, composeEntry);
 }
 
 template<typename ValueType>
@@ -987,6 +1033,29 @@ void InternalAdd<DdType::Sylvan, ValueType>::forEach(Odd const& odd, std::vector
     forEachRec(this->getSylvanMtbdd().GetMTBDD(), 0, ddVariableIndices.size(), 0, odd, ddVariableIndices, function);
 }
 
+template<typename ValueType>
+void InternalAdd<DdType::Sylvan, ValueType>::collectSubtreesRec(MTBDD dd, uint_fast64_t currentLevel, uint_fast64_t splitLevel,
+                                                                uint_fast64_t currentOffset, Odd const& odd,
+                                                                std::vector<uint_fast64_t> const& ddVariableIndices,
+                                                                std::vector<EnumerationSubtree>& subtrees) const {
+    // Subtrees without any entries do not need to be enumerated.
+    if (mtbdd_isleaf(dd) && mtbdd_iszero(dd)) {
+        return;
+    }
+
+    if (currentLevel == splitLevel) {
+        subtrees.push_back({dd, currentOffset, &odd});
+    } else if (mtbdd_isleaf(dd) || ddVariableIndices[currentLevel] < mtbdd_getvar(dd)) {
+        // If we skipped a level, both successors of the ODD refer to the same subtree.
+        collectSubtreesRec(dd, currentLevel + 1, splitLevel, currentOffset, odd.getElseSuccessor(), ddVariableIndices, subtrees);
+        collectSubtreesRec(dd, currentLevel + 1, splitLevel, currentOffset + odd.getElseOffset(), odd.getThenSuccessor(), ddVariableIndices, subtrees);
+    } else {
+        collectSubtreesRec(mtbdd_getlow(dd), currentLevel + 1, splitLevel, currentOffset, odd.getElseSuccessor(), ddVariableIndices, subtrees);
+        collectSubtreesRec(mtbdd_gethigh(dd), currentLevel + 1, splitLevel, currentOffset + odd.getElseOffset(), odd.getThenSuccessor(), ddVariableIndices,
+                           subtrees);
+    }
+}
+
 template<typename ValueType>
 void InternalAdd<DdType::Sylvan, ValueType>::forEachRec(MTBDD dd, uint_fast64_t currentLevel, uint_fast64_t maxLevel, uint_fast64_t currentOffset,
                                                         Odd const& odd, std::vector<uint_fast64_t> const& ddVariableIndices,
@@ -1231,6 +1300,36 @@ void InternalAdd<DdType::Sylvan, ValueType>::toMatrixComponents(std::vector<uint
                                                                 std::vector<storm::storage::MatrixEntry<uint_fast64_t, ValueType>>& columnsAndValues,
                                                                 Odd const& rowOdd, Odd const& columnOdd, std::vector<uint_fast64_t> const& ddRowVariableIndices,
                                                                 std::vector<uint_fast64_t> const& ddColumnVariableIndices, bool writeValues) const {
+    // Parts of the matrix that cover disjoint rows can be filled in parallel, because they write to disjoint
+    // positions of both the row indications and the entries. As copying non-primitive values is not thread-safe
+    // for all number types, the values are only written in parallel for primitive values.
+    uint64_t numberOfWorkers = lace_workers();
+    if (ddManager->isParallelConversionEnabled() && numberOfWorkers > 1 && ddRowVariableIndices.size() == ddColumnVariableIndices.size() &&
+        (!writeValues || std::is_arithmetic<ValueType>::value)) {
+        // Split into (a few times) more parts than there are workers to balance the load.
+        uint_fast64_t splitLevels = 2;
+        while ((1ull << splitLevels) < numberOfWorkers) {
+            ++splitLevels;
+        }
+        splitLevels = std::min<uint_fast64_t>(splitLevels + 2, ddRowVariableIndices.size());
+
+        std::vector<MatrixComponentsJob> jobs(1ull << splitLevels);
+        splitMatrixComponentsRec(mtbdd_regular(this->getSylvanMtbdd().GetMTBDD()), mtbdd_hascomp(this->getSylvanMtbdd().GetMTBDD()), rowOdd, columnOdd, 0,
+                                 splitLevels, 0, 0, 0, ddRowVariableIndices, ddColumnVariableIndices, jobs);
+
+        uint_fast64_t maxLevel = ddRowVariableIndices.size() + ddColumnVariableIndices.size();
+        std::function<void(uint64_t)> processJob = [&](uint64_t index) {
+            MatrixComponentsJob const& job = jobs[index];
+            for (auto const& fragment : job.fragments) {
+                toMatrixComponentsRec(std::get<0>(fragment), std::get<1>(fragment), rowGroupIndices, rowIndications, columnsAndValues, *job.rowOdd,
+                                      *std::get<2>(fragment), splitLevels, splitLevels, maxLevel, job.rowOffset, std::get<3>(fragment), ddRowVariableIndices,
+                                      ddColumnVariableIndices, writeValues);
+            }
+        };
+        RUN(sylvan_matrix_components_jobs, 0, jobs.size(), &processJob);
+        return;
+    }
+
     return toMatrixComponentsRec(mtbdd_regular(this->getSylvanMtbdd().GetMTBDD()), mtbdd_hascomp(this->getSylvanMtbdd().GetMTBDD()), rowGroupIndices,
                                  rowIndications, columnsAndValues, rowOdd, columnOdd, 0, 0, ddRowVariableIndices.size() + ddColumnVariableIndices.size(), 0, 0,
                                  ddRowVariableIndices, ddColumnVariableIndices, writeValues);
@@ -1305,6 +1404,71 @@ void InternalAdd<DdType::Sylvan, ValueType>::toMatrixComponentsRec(MTBDD dd, boo
     }
 }
 
+template<typename ValueType>
+void InternalAdd<DdType::Sylvan, ValueType>::splitMatrixComponentsRec(MTBDD dd, bool negated, Odd const& rowOdd, Odd const& columnOdd,
+                                                                      uint_fast64_t currentLevel, uint_fast64_t splitLevels, uint_fast64_t rowPath,
+                                                                      uint_fast64_t currentRowOffset, uint_fast64_t currentColumnOffset,
+                                                                      std::vector<uint_fast64_t> const& ddRowVariableIndices,
+                                                                      std::vector<uint_fast64_t> const& ddColumnVariableIndices,
+                                                                      std::vector<MatrixComponentsJob>& jobs) const {
+    // For the empty DD, there is nothing to convert.
+    if (mtbdd_isleaf(dd) && mtbdd_iszero(dd)) {
+        return;
+    }
+
+    // If we split along sufficiently many levels, the remaining DD is converted as part of the job of its rows.
+    if (currentLevel == splitLevels) {
+        MatrixComponentsJob& job = jobs[rowPath];
+        job.rowOdd = &rowOdd;
+        job.rowOffset = currentRowOffset;
+        job.fragments.emplace_back(dd, negated, &columnOdd, currentColumnOffset);
+        return;
+    }
+
+    // The successors are determined exactly as in the conversion itself.
+    MTBDD elseElse;
+    MTBDD elseThen;
+    MTBDD thenElse;
+    MTBDD thenThen;
+
+    if (mtbdd_isleaf(dd) || ddColumnVariableIndices[currentLevel] < mtbdd_getvar(dd)) {
+        elseElse = elseThen = thenElse = thenThen = dd;
+    } else if (ddRowVariableIndices[currentLevel] < mtbdd_getvar(dd)) {
+        elseElse = thenElse = mtbdd_getlow(dd);
+        elseThen = thenThen = mtbdd_gethigh(dd);
+    } else {
+        MTBDD elseNode = mtbdd_getlow(dd);
+        if (mtbdd_isleaf(elseNode) || ddColumnVariableIndices[currentLevel] < mtbdd_getvar(elseNode)) {
+            elseElse = elseThen = elseNode;
+        } else {
+            elseElse = mtbdd_getlow(elseNode);
+            elseThen = mtbdd_gethigh(elseNode);
+        }
+
+        MTBDD thenNode = mtbdd_gethigh(dd);
+        if (mtbdd_isleaf(thenNode) || ddColumnVariableIndices[currentLevel] < mtbdd_getvar(thenNode)) {
+            thenElse = thenThen = thenNode;
+        } else {
+            thenElse = mtbdd_getlow(thenNode);
+            thenThen = mtbdd_gethigh(thenNode);
+        }
+    }
+
+    // Visit the successors in the same order as the conversion, so the fragments of each job are sorted by column.
+    splitMatrixComponentsRec(mtbdd_regular(elseElse), mtbdd_hascomp(elseElse) ^ negated, rowOdd.getElseSuccessor(), columnOdd.getElseSuccessor(),
+                             currentLevel + 1, splitLevels, rowPath << 1, currentRowOffset, currentColumnOffset, ddRowVariableIndices, ddColumnVariableIndices,
+                             jobs);
+    splitMatrixComponentsRec(mtbdd_regular(elseThen), mtbdd_hascomp(elseThen) ^ negated, rowOdd.getElseSuccessor(), columnOdd.getThenSuccessor(),
+                             currentLevel + 1, splitLevels, rowPath << 1, currentRowOffset, currentColumnOffset + columnOdd.getElseOffset(),
+                             ddRowVariableIndices, ddColumnVariableIndices, jobs);
+    splitMatrixComponentsRec(mtbdd_regular(thenElse), mtbdd_hascomp(thenElse) ^ negated, rowOdd.getThenSuccessor(), columnOdd.getElseSuccessor(),
+                             currentLevel + 1, splitLevels, (rowPath << 1) | 1, currentRowOffset + rowOdd.getElseOffset(), currentColumnOffset,
+                             ddRowVariableIndices, ddColumnVariableIndices, jobs);
+    splitMatrixComponentsRec(mtbdd_regular(thenThen), mtbdd_hascomp(thenThen) ^ negated, rowOdd.getThenSuccessor(), columnOdd.getThenSuccessor(),
+                             currentLevel + 1, splitLevels, (rowPath << 1) | 1, currentRowOffset + rowOdd.getElseOffset(),
+                             currentColumnOffset + columnOdd.getElseOffset(), ddRowVariableIndices, ddColumnVariableIndices, jobs);
+}
+
 template<typename ValueType>
 InternalAdd<DdType::Sylvan, ValueType> InternalAdd<DdType::Sylvan, ValueType>::fromVector(InternalDdManager<DdType::Sylvan> const* ddManager,
                                                                                           std::vector<ValueType> const& values, storm::dd::Odd const& odd,
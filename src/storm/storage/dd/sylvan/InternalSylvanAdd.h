@@ -2,6 +2,7 @@
 #define STORM_STORAGE_DD_SYLVAN_INTERNALSYLVANADD_H_
 
 #include <set>
+#include <tuple>
 #include <unordered_map>
 
 #include "storm/storage/dd/DdType.h"
@@ -708,6 +709,28 @@ class InternalAdd<DdType::Sylvan, ValueType> {
     void forEachRec(MTBDD dd, uint_fast64_t currentLevel, uint_fast64_t maxLevel, uint_fast64_t currentOffset, Odd const& odd,
                     std::vector<uint_fast64_t> const& ddVariableIndices, std::function<void(uint64_t const&, ValueType const&)> const& function) const;
 
+    // A subtree of an ADD that covers a range of offsets disjoint from all other subtrees and can thus be enumerated
+    // independently of them.
+    struct EnumerationSubtree {
+        MTBDD dd;
+        uint_fast64_t offset;
+        Odd const* odd;
+    };
+
+    /*!
+     * Collects the (non-zero) subtrees of the ADD at the given split level together with their offsets and ODD nodes.
+     *
+     * @param dd The DD to traverse.
+     * @param currentLevel The currently considered level in the DD.
+     * @param splitLevel The level at which the subtrees are collected.
+     * @param currentOffset The current offset.
+     * @param odd The ODD used for the translation.
+     * @param ddVariableIndices The (sorted) indices of all DD variables that need to be considered.
+     * @param subtrees The vector to which the subtrees are added (in the order of increasing offsets).
+     */
+    void collectSubtreesRec(MTBDD dd, uint_fast64_t currentLevel, uint_fast64_t splitLevel, uint_fast64_t currentOffset, Odd const& odd,
+                            std::vector<uint_fast64_t> const& ddVariableIndices, std::vector<EnumerationSubtree>& subtrees) const;
+
     /*!
      * Splits the given matrix DD into the labelings of the gropus using the given group variables.
      *
@@ -813,6 +836,38 @@ class InternalAdd<DdType::Sylvan, ValueType> {
                                uint_fast64_t currentColumnOffset, std::vector<uint_fast64_t> const& ddRowVariableIndices,
                                std::vector<uint_fast64_t> const& ddColumnVariableIndices, bool writeValues) const;
 
+    // A part of a matrix that covers a set of rows disjoint from all other parts and can thus be converted
+    // independently of them.
+    struct MatrixComponentsJob {
+        // The row ODD and offset of the rows covered by this part.
+        Odd const* rowOdd = nullptr;
+        uint_fast64_t rowOffset = 0;
+
+        // The sub-DDs (with their negation flag, column ODD and column offset) to convert in the order of their columns.
+        std::vector<std::tuple<MTBDD, bool, Odd const*, uint_fast64_t>> fragments;
+    };
+
+    /*!
+     * Recursively splits the matrix along the topmost row and column variables into parts that cover disjoint rows.
+     *
+     * @param dd The DD to split.
+     * @param negated A flag indicating whether the DD is to be interpreted as negated.
+     * @param rowOdd The ODD used for the row translation.
+     * @param columnOdd The ODD used for the column translation.
+     * @param currentLevel The currently considered (row and column) level in the DD.
+     * @param splitLevels The number of row levels along which to split.
+     * @param rowPath The encoding of the row choices made so far, which identifies the part.
+     * @param currentRowOffset The current row offset.
+     * @param currentColumnOffset The current column offset.
+     * @param ddRowVariableIndices The (sorted) indices of all DD row variables that need to be considered.
+     * @param ddColumnVariableIndices The (sorted) indices of all DD column variables that need to be considered.
+     * @param jobs The parts, indexed by their row path, to which the sub-DDs are added.
+     */
+    void splitMatrixComponentsRec(MTBDD dd, bool negated, Odd const& rowOdd, Odd const& columnOdd, uint_fast64_t currentLevel, uint_fast64_t splitLevels,
+                                  uint_fast64_t rowPath, uint_fast64_t currentRowOffset, uint_fast64_t currentColumnOffset,
+                                  std::vector<uint_fast64_t> const& ddRowVariableIndices, std::vector<uint_fast64_t> const& ddColumnVariableIndices,
+                                  std::vector<MatrixComponentsJob>& jobs) const;
+
     /*!
      * Retrieves the sylvan representation of the given double value.
      *
@@ -1,5 +1,7 @@
 #include "storm/storage/dd/sylvan/InternalSylvanDdManager.h"
 
+#include <algorithm>
+#include <chrono>
 #include <cmath>
 #include <iostream>
 
@@ -12,6 +14,7 @@
 #include "storm/utility/macros.h"
 
 #include "storm/adapters/sylvan.h"
+#include "sylvan_cache.h"
 
 #include "storm-config.h"
 
@@ -24,15 +27,26 @@ namespace dd {
 #pragma clang diagnostic ignored "-Wc99-extensions"
 #endif
 
-#ifndef NDEBUG
+// Statistics about the garbage collections of sylvan. As sylvan only has one global table, these are global as well.
+static uint64_t numberOfGarbageCollections = 0;
+static std::chrono::nanoseconds garbageCollectionTime(0);
+static std::chrono::steady_clock::time_point garbageCollectionStart;
+static size_t peakTableSize = 0;
+
 VOID_TASK_0(gc_start) {
     STORM_LOG_TRACE("Starting sylvan garbage collection...");
+    // Garbage collections are triggered when the table is full, so its size is the peak number of nodes so far.
+    size_t tableSize = 0;
+    CALL(sylvan_table_usage, nullptr, &tableSize);
+    peakTableSize = std::max(peakTableSize, tableSize);
+    garbageCollectionStart = std::chrono::steady_clock::now();
 }
 
 VOID_TASK_0(gc_end) {
+    garbageCollectionTime += std::chrono::steady_clock::now() - garbageCollectionStart;
+    ++numberOfGarbageCollections;
     STORM_LOG_TRACE("Sylvan garbage collection done.");
 }
-#endif
 
 VOID_TASK_2(execute_sylvan, std::function<void()> const*, f, std::exception_ptr*, e) {
     try {
@@ -62,7 +76,8 @@ uint_fast64_t findLargestPowerOfTwoFitting(uint_fast64_t number) {
     return 0;
 }
 
-InternalDdManager<DdType::Sylvan>::InternalDdManager() {
+InternalDdManager<DdType::Sylvan>::InternalDdManager()
+    : parallelConversion(storm::settings::getModule<storm::settings::modules::SylvanSettings>().isParallelConversionSet()) {
     if (numberOfInstances == 0) {
         storm::settings::modules::SylvanSettings const& settings = storm::settings::getModule<storm::settings::modules::SylvanSettings>();
         size_t const task_deque_size = 1024 * 1024;
@@ -71,17 +86,15 @@ InternalDdManager<DdType::Sylvan>::InternalDdManager() {
 
         lace_start(settings.getNumberOfThreads(), task_deque_size);
 
-        sylvan_set_limits(storm::settings::getModule<storm::settings::modules::SylvanSettings>().getMaximalMemory() * 1024 * 1024, 0, 0);
+        sylvan_set_limits(settings.getMaximalMemory() * 1024 * 1024, static_cast<int>(settings.getTableRatio()), static_cast<int>(settings.getInitialRatio()));
         sylvan_init_package();
 
         sylvan::Sylvan::initBdd();
         sylvan::Sylvan::initMtbdd();
         sylvan::Sylvan::initCustomMtbdd();
 
-#ifndef NDEBUG
         sylvan_gc_hook_pregc(TASK(gc_start));
         sylvan_gc_hook_postgc(TASK(gc_end));
-#endif
         // TODO: uncomment these to disable lace threads whenever they are not used. This requires that *all* DD code is run through execute
         // lace_suspend();
         // suspended = true;
@@ -228,22 +241,62 @@ bool InternalDdManager<DdType::Sylvan>::supportsOrderedInsertion() const {
     return false;
 }
 
-void InternalDdManager<DdType::Sylvan>::allowDynamicReordering(bool) {
-    STORM_LOG_THROW(false, storm::exceptions::NotSupportedException, "Operation is not supported by sylvan.");
+void InternalDdManager<DdType::Sylvan>::allowDynamicReordering(bool value) {
+    // Sylvan identifies the level of a node with its variable index, so the variable order is fixed once the variables are created.
+    STORM_LOG_WARN_COND(!value, "Sylvan does not support dynamic reordering, the variable order is kept fixed. A static variable order can be computed "
+                                "before building the model via --dd-static-order.");
 }
 
 bool InternalDdManager<DdType::Sylvan>::isDynamicReorderingAllowed() const {
-    STORM_LOG_THROW(false, storm::exceptions::NotSupportedException, "Operation is not supported by sylvan.");
+    return false;
 }
 
 void InternalDdManager<DdType::Sylvan>::triggerReordering() {
-    STORM_LOG_THROW(false, storm::exceptions::NotSupportedException, "Operation is not supported by sylvan.");
+    STORM_LOG_WARN("Sylvan does not support reordering, the variable order is kept fixed.");
 }
 
 void InternalDdManager<DdType::Sylvan>::debugCheck() const {
     STORM_LOG_THROW(false, storm::exceptions::NotSupportedException, "Operation is not supported by sylvan.");
 }
 
+void InternalDdManager<DdType::Sylvan>::printStatisticsToStream(std::ostream& out) const {
+    size_t filled = 0;
+    size_t total = 0;
+    sylvan_stats_t statistics;
+    this->execute([&]() {
+        sylvan_table_usage(&filled, &total);
+        sylvan_stats_snapshot(&statistics);
+    });
+
+    // The operation counters come in triples (calls, cache insertions, cache hits).
+    uint64_t lookups = 0;
+    uint64_t hits = 0;
+    for (uint64_t counter = BDD_ITE; counter + 2 <= ZDD_COVER_TO_BDD_CACHED; counter += 3) {
+        lookups += statistics.counters[counter];
+        hits += statistics.counters[counter + 2];
+    }
+
+    out << "Sylvan statistics:\n";
+    out << "   * node table: " << filled << " of " << total << " entries used (peak " << std::max(peakTableSize, filled) << ")\n";
+    out << "   * cache: " << cache_getused() << " of " << cache_getsize() << " entries used (max " << cache_getmaxsize() << ")\n";
+    if (lookups > 0) {
+        out << "   * cache lookups: " << lookups << " (hit rate " << (static_cast<double>(hits) * 100 / lookups) << "%)\n";
+    } else {
+        out << "   * cache lookups: not recorded (requires sylvan to be built with SYLVAN_STATS)\n";
+    }
+    out << "   * garbage collections: " << numberOfGarbageCollections << " ("
+        << std::chrono::duration_cast<std::chrono::milliseconds>(garbageCollectionTime).count() << "ms)\n";
+}
+
+uint64_t InternalDdManager<DdType::Sylvan>::getSizeInMemory() const {
+    size_t filled = 0;
+    size_t total = 0;
+    this->execute([&]() { sylvan_table_usage(&filled, &total); });
+    // Each entry of the node table consists of the node itself (16 bytes) and its hash bucket (8 bytes). Each entry of the operation cache
+    // holds the operands and the result (32 bytes) and a status word (4 bytes).
+    return 24 * static_cast<uint64_t>(total) + 36 * static_cast<uint64_t>(cache_getsize());
+}
+
 void InternalDdManager<DdType::Sylvan>::execute(std::function<void()> const& f) const {
     // Only wake up the sylvan (i.e. lace) threads when they are suspended.
     std::exception_ptr e = nullptr;  // propagate exception
@@ -266,6 +319,14 @@ uint_fast64_t InternalDdManager<DdType::Sylvan>::getNumberOfDdVariables() const
     return nextFreeVariableIndex;
 }
 
+bool InternalDdManager<DdType::Sylvan>::isParallelConversionEnabled() const {
+    return parallelConversion;
+}
+
+void InternalDdManager<DdType::Sylvan>::setParallelConversion(bool value) {
+    parallelConversion = value;
+}
+
 template InternalAdd<DdType::Sylvan, double> InternalDdManager<DdType::Sylvan>::getAddUndefined() const;
 template InternalAdd<DdType::Sylvan, uint_fast64_t> InternalDdManager<DdType::Sylvan>::getAddUndefined() const;
 
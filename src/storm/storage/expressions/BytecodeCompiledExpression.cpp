@@ -0,0 +1,376 @@
+#include "storm/storage/expressions/BytecodeCompiledExpression.h"
+
+#include <algorithm>
+#include <cmath>
+
+#include "storm/storage/expressions/ExpressionVisitor.h"
+#include "storm/storage/expressions/Expressions.h"
+#include "storm/storage/expressions/Variable.h"
+
+#include "storm/exceptions/NotSupportedException.h"
+#include "storm/utility/macros.h"
+
+namespace storm {
+namespace expressions {
+
+/*!
+ * Translates an expression into instructions. Each subexpression is compiled such that its value ends up in a given target register.
+ * Registers above the target register are used for intermediate results, so the number of registers is bounded by the depth of the expression.
+ */
+class BytecodeCompiler : public ExpressionVisitor {
+   public:
+    typedef BytecodeCompiledExpression::OpCode OpCode;
+
+    BytecodeCompiler(BytecodeCompiledExpression& result) : result(result) {
+        // Intentionally left empty.
+    }
+
+    void compile(Expression const& expression) {
+        result.numberOfRegisters = 1;
+        compile(*expression.getBaseExpressionPointer(), 0);
+    }
+
+    boost::any visit(IfThenElseExpression const& expression, boost::any const& data) override {
+        uint32_t target = boost::any_cast<uint32_t>(data);
+        compile(*expression.getCondition(), target);
+        uint64_t jumpToElse = emit(OpCode::JumpIfZero, target, target);
+        compile(*expression.getThenExpression(), target);
+        uint64_t jumpToEnd = emit(OpCode::Jump, target);
+        setJumpTarget(jumpToElse);
+        compile(*expression.getElseExpression(), target);
+        setJumpTarget(jumpToEnd);
+        return boost::any();
+    }
+
+    boost::any visit(BinaryBooleanFunctionExpression const& expression, boost::any const& data) override {
+        uint32_t target = boost::any_cast<uint32_t>(data);
+        switch (expression.getOperatorType()) {
+            case BinaryBooleanFunctionExpression::OperatorType::And:
+            case BinaryBooleanFunctionExpression::OperatorType::Or:
+            case BinaryBooleanFunctionExpression::OperatorType::Implies: {
+                // Skip the second operand if the first one already determines the result.
+                compile(*expression.getFirstOperand(), target);
+                uint64_t jump;
+                if (expression.getOperatorType() == BinaryBooleanFunctionExpression::OperatorType::And) {
+                    jump = emit(OpCode::JumpIfZero, target, target);
+                } else {
+                    if (expression.getOperatorType() == BinaryBooleanFunctionExpression::OperatorType::Implies) {
+                        emit(OpCode::Not, target, target);
+                    }
+                    jump = emit(OpCode::JumpIfNonZero, target, target);
+                }
+                compile(*expression.getSecondOperand(), target);
+                setJumpTarget(jump);
+                break;
+            }
+            case BinaryBooleanFunctionExpression::OperatorType::Xor:
+                compileBinary(OpCode::Xor, expression, target);
+                break;
+            case BinaryBooleanFunctionExpression::OperatorType::Iff:
+                compileBinary(OpCode::Equal, expression, target);
+                break;
+        }
+        return boost::any();
+    }
+
+    boost::any visit(BinaryNumericalFunctionExpression const& expression, boost::any const& data) override {
+        uint32_t target = boost::any_cast<uint32_t>(data);
+        switch (expression.getOperatorType()) {
+            case BinaryNumericalFunctionExpression::OperatorType::Plus:
+                compileBinary(OpCode::Plus, expression, target);
+                break;
+            case BinaryNumericalFunctionExpression::OperatorType::Minus:
+                compileBinary(OpCode::Minus, expression, target);
+                break;
+            case BinaryNumericalFunctionExpression::OperatorType::Times:
+                compileBinary(OpCode::Times, expression, target);
+                break;
+            case BinaryNumericalFunctionExpression::OperatorType::Divide:
+                compileBinary(OpCode::Divide, expression, target);
+                break;
+            case BinaryNumericalFunctionExpression::OperatorType::Min:
+                compileBinary(OpCode::Min, expression, target);
+                break;
+            case BinaryNumericalFunctionExpression::OperatorType::Max:
+                compileBinary(OpCode::Max, expression, target);
+                break;
+            case BinaryNumericalFunctionExpression::OperatorType::Power:
+                compileBinary(OpCode::Power, expression, target);
+                break;
+            case BinaryNumericalFunctionExpression::OperatorType::Modulo:
+                compileBinary(OpCode::Modulo, expression, target);
+                break;
+            case BinaryNumericalFunctionExpression::OperatorType::Logarithm:
+                compileBinary(OpCode::Logarithm, expression, target);
+                break;
+        }
+        return boost::any();
+    }
+
+    boost::any visit(BinaryRelationExpression const& expression, boost::any const& data) override {
+        uint32_t target = boost::any_cast<uint32_t>(data);
+        switch (expression.getRelationType()) {
+            case RelationType::Equal:
+                compileBinary(OpCode::Equal, expression, target);
+                break;
+            case RelationType::NotEqual:
+                compileBinary(OpCode::NotEqual, expression, target);
+                break;
+            case RelationType::Less:
+                compileBinary(OpCode::Less, expression, target);
+                break;
+            case RelationType::LessOrEqual:
+                compileBinary(OpCode::LessOrEqual, expression, target);
+                break;
+            case RelationType::Greater:
+                compileBinary(OpCode::Greater, expression, target);
+                break;
+            case RelationType::GreaterOrEqual:
+                compileBinary(OpCode::GreaterOrEqual, expression, target);
+                break;
+        }
+        return boost::any();
+    }
+
+    boost::any visit(VariableExpression const& expression, boost::any const& data) override {
+        uint32_t target = boost::any_cast<uint32_t>(data);
+        Variable const& variable = expression.getVariable();
+        uint32_t offset = static_cast<uint32_t>(variable.getOffset());
+        if (variable.hasBooleanType()) {
+            emit(OpCode::LoadBooleanVariable, target, offset);
+        } else if (variable.hasIntegerType()) {
+            emit(OpCode::LoadIntegerVariable, target, offset);
+        } else {
+            STORM_LOG_THROW(variable.hasRationalType(), storm::exceptions::NotSupportedException,
+                            "Unable to compile variable '" << variable.getName() << "' of unsupported type.");
+            emit(OpCode::LoadRationalVariable, target, offset);
+        }
+        return boost::any();
+    }
+
+    boost::any visit(UnaryBooleanFunctionExpression const& expression, boost::any const& data) override {
+        uint32_t target = boost::any_cast<uint32_t>(data);
+        compile(*expression.getOperand(), target);
+        emit(OpCode::Not, target, target);
+        return boost::any();
+    }
+
+    boost::any visit(UnaryNumericalFunctionExpression const& expression, boost::any const& data) override {
+        uint32_t target = boost::any_cast<uint32_t>(data);
+        compile(*expression.getOperand(), target);
+        switch (expression.getOperatorType()) {
+            case UnaryNumericalFunctionExpression::OperatorType::Minus:
+                emit(OpCode::Negate, target, target);
+                break;
+            case UnaryNumericalFunctionExpression::OperatorType::Floor:
+                emit(OpCode::Floor, target, target);
+                break;
+            case UnaryNumericalFunctionExpression::OperatorType::Ceil:
+                emit(OpCode::Ceil, target, target);
+                break;
+        }
+        return boost::any();
+    }
+
+    boost::any visit(BooleanLiteralExpression const& expression, boost::any const& data) override {
+        emitConstant(boost::any_cast<uint32_t>(data), expression.getValue() ? 1.0 : 0.0);
+        return boost::any();
+    }
+
+    boost::any visit(IntegerLiteralExpression const& expression, boost::any const& data) override {
+        emitConstant(boost::any_cast<uint32_t>(data), static_cast<double>(expression.getValue()));
+        return boost::any();
+    }
+
+    boost::any visit(RationalLiteralExpression const& expression, boost::any const& data) override {
+        emitConstant(boost::any_cast<uint32_t>(data), expression.getValueAsDouble());
+        return boost::any();
+    }
+
+    boost::any visit(PredicateExpression const& expression, boost::any const& data) override {
+        // Count the operands that are true and compare the count against the bound of the predicate.
+        uint32_t target = boost::any_cast<uint32_t>(data);
+        uint32_t operandRegister = useRegister(target + 1);
+        emitConstant(target, 0.0);
+        for (uint64_t operandIndex = 0; operandIndex < expression.getArity(); ++operandIndex) {
+            compile(*expression.getOperand(operandIndex), operandRegister);
+            emit(OpCode::AddIfNonZero, target, target, operandRegister);
+        }
+        switch (expression.getPredicateType()) {
+            case PredicateExpression::PredicateType::AtLeastOneOf:
+                emitConstant(operandRegister, 0.0);
+                emit(OpCode::Greater, target, target, operandRegister);
+                break;
+            case PredicateExpression::PredicateType::AtMostOneOf:
+                emitConstant(operandRegister, 1.0);
+                emit(OpCode::LessOrEqual, target, target, operandRegister);
+                break;
+            case PredicateExpression::PredicateType::ExactlyOneOf:
+                emitConstant(operandRegister, 1.0);
+                emit(OpCode::Equal, target, target, operandRegister);
+                break;
+        }
+        return boost::any();
+    }
+
+   private:
+    void compile(BaseExpression const& expression, uint32_t target) {
+        expression.accept(*this, target);
+    }
+
+    void compileBinary(OpCode opCode, BinaryExpression const& expression, uint32_t target) {
+        uint32_t secondRegister = useRegister(target + 1);
+        compile(*expression.getFirstOperand(), target);
+        compile(*expression.getSecondOperand(), secondRegister);
+        emit(opCode, target, target, secondRegister);
+    }
+
+    uint32_t useRegister(uint32_t reg) {
+        result.numberOfRegisters = std::max<uint64_t>(result.numberOfRegisters, reg + 1);
+        return reg;
+    }
+
+    uint64_t emit(OpCode opCode, uint32_t target, uint32_t firstOperand = 0, uint32_t secondOperand = 0) {
+        result.instructions.push_back({opCode, target, firstOperand, secondOperand});
+        return result.instructions.size() - 1;
+    }
+
+    void emitConstant(uint32_t target, double value) {
+        auto constantIt = std::find(result.constants.begin(), result.constants.end(), value);
+        if (constantIt == result.constants.end()) {
+            result.constants.push_back(value);
+            constantIt = result.constants.end() - 1;
+        }
+        emit(OpCode::LoadConstant, target, static_cast<uint32_t>(constantIt - result.constants.begin()));
+    }
+
+    // Lets the given jump instruction continue after the last emitted instruction.
+    void setJumpTarget(uint64_t jumpInstruction) {
+        result.instructions[jumpInstruction].secondOperand = static_cast<uint32_t>(result.instructions.size());
+    }
+
+    BytecodeCompiledExpression& result;
+};
+
+BytecodeCompiledExpression::BytecodeCompiledExpression(Expression const& expression) : numberOfRegisters(1) {
+    BytecodeCompiler(*this).compile(expression);
+}
+
+double BytecodeCompiledExpression::evaluate(double* registers, double const* booleanValues, double const* integerValues, double const* rationalValues) const {
+    Instruction const* const first = instructions.data();
+    Instruction const* const last = first + instructions.size();
+    Instruction const* current = first;
+    while (current != last) {
+        Instruction const& instruction = *current;
+        double& target = registers[instruction.target];
+        switch (instruction.opCode) {
+            case OpCode::LoadConstant:
+                target = constants[instruction.firstOperand];
+                break;
+            case OpCode::LoadBooleanVariable:
+                target = booleanValues[instruction.firstOperand];
+                break;
+            case OpCode::LoadIntegerVariable:
+                target = integerValues[instruction.firstOperand];
+                break;
+            case OpCode::LoadRationalVariable:
+                target = rationalValues[instruction.firstOperand];
+                break;
+            case OpCode::Plus:
+                target = registers[instruction.firstOperand] + registers[instruction.secondOperand];
+                break;
+            case OpCode::Minus:
+                target = registers[instruction.firstOperand] - registers[instruction.secondOperand];
+                break;
+            case OpCode::Times:
+                target = registers[instruction.firstOperand] * registers[instruction.secondOperand];
+                break;
+            case OpCode::Divide:
+                target = registers[instruction.firstOperand] / registers[instruction.secondOperand];
+                break;
+            case OpCode::Min:
+                target = std::min(registers[instruction.firstOperand], registers[instruction.secondOperand]);
+                break;
+            case OpCode::Max:
+                target = std::max(registers[instruction.firstOperand], registers[instruction.secondOperand]);
+                break;
+            case OpCode::Power:
+                target = std::pow(registers[instruction.firstOperand], registers[instruction.secondOperand]);
+                break;
+            case OpCode::Modulo:
+                target = std::fmod(registers[instruction.firstOperand], registers[instruction.secondOperand]);
+                break;
+            case OpCode::Logarithm:
+                target = std::log(registers[instruction.firstOperand]) / std::log(registers[instruction.secondOperand]);
+                break;
+            case OpCode::Negate:
+                target = -registers[instruction.firstOperand];
+                break;
+            case OpCode::Floor:
+                target = std::floor(registers[instruction.firstOperand]);
+                break;
+            case OpCode::Ceil:
+                target = std::ceil(registers[instruction.firstOperand]);
+                break;
+            case OpCode::Not:
+                target = registers[instruction.firstOperand] == 0.0 ? 1.0 : 0.0;
+                break;
+            case OpCode::Xor:
+                target = (registers[instruction.firstOperand] != 0.0) != (registers[instruction.secondOperand] != 0.0) ? 1.0 : 0.0;
+                break;
+            case OpCode::Equal:
+                target = registers[instruction.firstOperand] == registers[instruction.secondOperand] ? 1.0 : 0.0;
+                break;
+            case OpCode::NotEqual:
+                target = registers[instruction.firstOperand] != registers[instruction.secondOperand] ? 1.0 : 0.0;
+                break;
+            case OpCode::Less:
+                target = registers[instruction.firstOperand] < registers[instruction.secondOperand] ? 1.0 : 0.0;
+                break;
+            case OpCode::LessOrEqual:
+                target = registers[instruction.firstOperand] <= registers[instruction.secondOperand] ? 1.0 : 0.0;
+                break;
+            case OpCode::Greater:
+                target = registers[instruction.firstOperand] > registers[instruction.secondOperand] ? 1.0 : 0.0;
+                break;
+            case OpCode::GreaterOrEqual:
+                target = registers[instruction.firstOperand] >= registers[instruction.secondOperand] ? 1.0 : 0.0;
+                break;
+            case OpCode::AddIfNonZero:
+                target = registers[instruction.firstOperand] + (registers[instruction.secondOperand] != 0.0 ? 1.0 : 0.0);
+                break;
+            case OpCode::Jump:
+                current = first + instruction.secondOperand;
+                continue;
+            case OpCode::JumpIfZero:
+                if (registers[instruction.firstOperand] == 0.0) {
+                    current = first + instruction.secondOperand;
+                    continue;
+                }
+                break;
+            case OpCode::JumpIfNonZero:
+                if (registers[instruction.firstOperand] != 0.0) {
+                    current = first + instruction.secondOperand;
+                    continue;
+                }
+                break;
+        }
+        ++current;
+    }
+    return registers[0];
+}
+
+uint64_t BytecodeCompiledExpression::getNumberOfRegisters() const {
+    return numberOfRegisters;
+}
+
+std::vector<BytecodeCompiledExpression::Instruction> const& BytecodeCompiledExpression::getInstructions() const {
+    return instructions;
+}
+
+bool BytecodeCompiledExpression::isBytecodeCompiledExpression() const {
+    return true;
+}
+
+}  // namespace expressions
+}  // namespace storm
@@ -0,0 +1,105 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include "storm/storage/expressions/CompiledExpression.h"
+
+namespace storm {
+namespace expressions {
+
+class Expression;
+
+/*!
+ * An expression that is compiled into a flat sequence of instructions operating on registers.
+ * All values (including booleans and integers) are represented as doubles, booleans being 0 or 1. This matches the semantics of the ExprTk evaluator.
+ */
+class BytecodeCompiledExpression : public CompiledExpression {
+   public:
+    enum class OpCode : uint8_t {
+        LoadConstant,
+        LoadBooleanVariable,
+        LoadIntegerVariable,
+        LoadRationalVariable,
+        Plus,
+        Minus,
+        Times,
+        Divide,
+        Min,
+        Max,
+        Power,
+        Modulo,
+        Logarithm,
+        Negate,
+        Floor,
+        Ceil,
+        Not,
+        Xor,
+        Equal,
+        NotEqual,
+        Less,
+        LessOrEqual,
+        Greater,
+        GreaterOrEqual,
+        AddIfNonZero,
+        Jump,
+        JumpIfZero,
+        JumpIfNonZero
+    };
+
+    /*!
+     * A single instruction. The result is always written to the target register.
+     * Depending on the opcode, the operands are registers, an index of a constant, an offset of a variable or the index of the instruction to jump to.
+     */
+    struct Instruction {
+        OpCode opCode;
+        uint32_t target;
+        uint32_t firstOperand;
+        uint32_t secondOperand;
+    };
+
+    /*!
+     * Compiles the given expression.
+     *
+     * @param expression The expression to compile.
+     */
+    BytecodeCompiledExpression(Expression const& expression);
+
+    /*!
+     * Evaluates the compiled expression.
+     *
+     * @param registers The registers used during evaluation. Needs to hold at least getNumberOfRegisters() values.
+     * @param booleanValues The values of the boolean variables (indexed by their offset).
+     * @param integerValues The values of the integer variables (indexed by their offset).
+     * @param rationalValues The values of the rational variables (indexed by their offset).
+     * @return The value of the expression.
+     */
+    double evaluate(double* registers, double const* booleanValues, double const* integerValues, double const* rationalValues) const;
+
+    /*!
+     * Retrieves the number of registers required to evaluate the expression.
+     */
+    uint64_t getNumberOfRegisters() const;
+
+    /*!
+     * Retrieves the instructions of the compiled expression.
+     */
+    std::vector<Instruction> const& getInstructions() const;
+
+    virtual bool isBytecodeCompiledExpression() const override;
+
+   private:
+    friend class BytecodeCompiler;
+
+    // The instructions that are executed in order (unless a jump occurs). The result is found in register 0.
+    std::vector<Instruction> instructions;
+
+    // The constants occurring in the expression.
+    std::vector<double> constants;
+
+    // The number of registers used by the instructions.
+    uint64_t numberOfRegisters;
+};
+
+}  // namespace expressions
+}  // namespace storm
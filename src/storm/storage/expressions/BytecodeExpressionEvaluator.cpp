@@ -0,0 +1,97 @@
+#include "storm/storage/expressions/BytecodeExpressionEvaluator.h"
+
+#include "storm/storage/expressions/ExpressionManager.h"
+
+#include "storm/exceptions/InvalidArgumentException.h"
+#include "storm/exceptions/NotSupportedException.h"
+#include "storm/utility/macros.h"
+
+namespace storm {
+namespace expressions {
+
+BytecodeExpressionEvaluator::BytecodeExpressionEvaluator(storm::expressions::ExpressionManager const& manager)
+    : ExpressionEvaluatorBase<double>(manager),
+      booleanValues(manager.getNumberOfBooleanVariables()),
+      integerValues(manager.getNumberOfIntegerVariables()),
+      rationalValues(manager.getNumberOfRationalVariables()) {
+    // Intentionally left empty.
+}
+
+bool BytecodeExpressionEvaluator::asBool(Expression const& expression) const {
+    return evaluate(getCompiledExpression(expression)) != 0.0;
+}
+
+int_fast64_t BytecodeExpressionEvaluator::asInt(Expression const& expression) const {
+    return static_cast<int_fast64_t>(evaluate(getCompiledExpression(expression)));
+}
+
+double BytecodeExpressionEvaluator::asRational(Expression const& expression) const {
+    return evaluate(getCompiledExpression(expression));
+}
+
+void BytecodeExpressionEvaluator::setBooleanValue(storm::expressions::Variable const& variable, bool value) {
+    this->booleanValues[variable.getOffset()] = value ? 1.0 : 0.0;
+}
+
+void BytecodeExpressionEvaluator::setIntegerValue(storm::expressions::Variable const& variable, int_fast64_t value) {
+    this->integerValues[variable.getOffset()] = static_cast<double>(value);
+}
+
+void BytecodeExpressionEvaluator::setRationalValue(storm::expressions::Variable const& variable, double value) {
+    this->rationalValues[variable.getOffset()] = value;
+}
+
+void BytecodeExpressionEvaluator::evaluateBatch(Expression const& expression, std::vector<storm::expressions::Variable> const& variables,
+                                                std::vector<double> const& values, std::vector<double>& result) {
+    uint64_t const numberOfVariables = variables.size();
+    STORM_LOG_THROW(numberOfVariables > 0 ? values.size() % numberOfVariables == 0 : values.empty(), storm::exceptions::InvalidArgumentException,
+                    "The number of values does not match the number of variables.");
+    BytecodeCompiledExpression const& compiledExpression = getCompiledExpression(expression);
+
+    std::vector<double*> valueReferences;
+    std::vector<bool> isBoolean;
+    valueReferences.reserve(numberOfVariables);
+    isBoolean.reserve(numberOfVariables);
+    for (auto const& variable : variables) {
+        valueReferences.push_back(&getValueReference(variable));
+        isBoolean.push_back(variable.hasBooleanType());
+    }
+
+    uint64_t const numberOfValuations = numberOfVariables > 0 ? values.size() / numberOfVariables : 0;
+    result.resize(numberOfValuations);
+    auto valueIt = values.begin();
+    for (uint64_t valuation = 0; valuation < numberOfValuations; ++valuation) {
+        for (uint64_t variableIndex = 0; variableIndex < numberOfVariables; ++variableIndex, ++valueIt) {
+            *valueReferences[variableIndex] = isBoolean[variableIndex] ? (*valueIt != 0.0 ? 1.0 : 0.0) : *valueIt;
+        }
+        result[valuation] = evaluate(compiledExpression);
+    }
+}
+
+BytecodeCompiledExpression const& BytecodeExpressionEvaluator::getCompiledExpression(storm::expressions::Expression const& expression) const {
+    if (!expression.hasCompiledExpression() || !expression.getCompiledExpression().isBytecodeCompiledExpression()) {
+        expression.setCompiledExpression(std::make_shared<BytecodeCompiledExpression>(expression));
+    }
+    BytecodeCompiledExpression const& compiledExpression = expression.getCompiledExpression().asBytecodeCompiledExpression();
+    if (registers.size() < compiledExpression.getNumberOfRegisters()) {
+        registers.resize(compiledExpression.getNumberOfRegisters());
+    }
+    return compiledExpression;
+}
+
+double BytecodeExpressionEvaluator::evaluate(BytecodeCompiledExpression const& compiledExpression) const {
+    return compiledExpression.evaluate(registers.data(), booleanValues.data(), integerValues.data(), rationalValues.data());
+}
+
+double& BytecodeExpressionEvaluator::getValueReference(storm::expressions::Variable const& variable) {
+    if (variable.hasBooleanType()) {
+        return booleanValues[variable.getOffset()];
+    } else if (variable.hasIntegerType()) {
+        return integerValues[variable.getOffset()];
+    }
+    STORM_LOG_THROW(variable.hasRationalType(), storm::exceptions::NotSupportedException, "Variable '" << variable.getName() << "' has an unsupported type.");
+    return rationalValues[variable.getOffset()];
+}
+
+}  // namespace expressions
+}  // namespace storm
@@ -0,0 +1,73 @@
+#pragma once
+
+#include <vector>
+
+#include "storm/storage/expressions/BytecodeCompiledExpression.h"
+#include "storm/storage/expressions/ExpressionEvaluatorBase.h"
+
+namespace storm {
+namespace expressions {
+
+/*!
+ * An evaluator that compiles expressions (once) into register-based bytecode which is then interpreted without traversing the expression tree.
+ * The compiled expression is cached in the expression object. As for the ExprTk evaluator, all computations are carried out on doubles.
+ */
+class BytecodeExpressionEvaluator : public ExpressionEvaluatorBase<double> {
+   public:
+    /*!
+     * Creates an expression evaluator that is capable of evaluating expressions managed by the given manager.
+     *
+     * @param manager The manager responsible for the expressions.
+     */
+    BytecodeExpressionEvaluator(storm::expressions::ExpressionManager const& manager);
+
+    bool asBool(Expression const& expression) const override;
+    int_fast64_t asInt(Expression const& expression) const override;
+    double asRational(Expression const& expression) const override;
+
+    void setBooleanValue(storm::expressions::Variable const& variable, bool value) override;
+    void setIntegerValue(storm::expressions::Variable const& variable, int_fast64_t value) override;
+    void setRationalValue(storm::expressions::Variable const& variable, double value) override;
+
+    /*!
+     * Evaluates the given expression under multiple valuations. The expression is compiled only once and the variables are resolved only once.
+     * Variables that are not given keep the value that is currently set. Afterwards, the given variables hold the values of the last valuation.
+     *
+     * @param expression The expression to evaluate.
+     * @param variables The variables whose values differ between the valuations.
+     * @param values The values of the given variables. The i-th valuation is given by the entries i*variables.size(), ..., (i+1)*variables.size()-1.
+     * Boolean values are given as 0 (false) or any other value (true).
+     * @param result Is filled with the value of the expression under each of the valuations (booleans being represented as 0 or 1).
+     */
+    void evaluateBatch(Expression const& expression, std::vector<storm::expressions::Variable> const& variables, std::vector<double> const& values,
+                       std::vector<double>& result);
+
+   private:
+    /*!
+     * Retrieves a compiled version of the given expression.
+     *
+     * @param expression The expression that is to be compiled.
+     */
+    BytecodeCompiledExpression const& getCompiledExpression(storm::expressions::Expression const& expression) const;
+
+    /*!
+     * Evaluates the given compiled expression with the currently set values.
+     */
+    double evaluate(BytecodeCompiledExpression const& compiledExpression) const;
+
+    /*!
+     * Retrieves the place where the value of the given variable is stored.
+     */
+    double& getValueReference(storm::expressions::Variable const& variable);
+
+    // The values of the variables (indexed by their offset).
+    std::vector<double> booleanValues;
+    std::vector<double> integerValues;
+    std::vector<double> rationalValues;
+
+    // The registers used during evaluation.
+    mutable std::vector<double> registers;
+};
+
+}  // namespace expressions
+}  // namespace storm
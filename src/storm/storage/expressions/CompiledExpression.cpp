@@ -1,5 +1,6 @@
 #include "storm/storage/expressions/CompiledExpression.h"
 
+#include "storm/storage/expressions/BytecodeCompiledExpression.h"
 #include "storm/storage/expressions/ExprtkCompiledExpression.h"
 
 namespace storm {
@@ -17,5 +18,17 @@ ExprtkCompiledExpression const& CompiledExpression::asExprtkCompiledExpression()
     return static_cast<ExprtkCompiledExpression const&>(*this);
 }
 
+bool CompiledExpression::isBytecodeCompiledExpression() const {
+    return false;
+}
+
+BytecodeCompiledExpression& CompiledExpression::asBytecodeCompiledExpression() {
+    return static_cast<BytecodeCompiledExpression&>(*this);
+}
+
+BytecodeCompiledExpression const& CompiledExpression::asBytecodeCompiledExpression() const {
+    return static_cast<BytecodeCompiledExpression const&>(*this);
+}
+
 }  // namespace expressions
 }  // namespace storm
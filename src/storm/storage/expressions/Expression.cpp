@@ -14,6 +14,7 @@
 #include "storm/storage/expressions/RestrictSyntaxVisitor.h"
 #include "storm/storage/expressions/SubstitutionVisitor.h"
 #include "storm/storage/expressions/SyntacticalEqualityCheckVisitor.h"
+#include "storm/storage/expressions/UniqueExpressionTable.h"
 #include "storm/utility/macros.h"
 
 namespace storm {
@@ -35,10 +36,12 @@ Expression::~Expression() {
 }
 
 Expression::Expression(std::shared_ptr<BaseExpression const> const& expressionPtr) : expressionPtr(expressionPtr) {
-    // Intentionally left empty.
+    if (this->expressionPtr && this->expressionPtr->getManager().isHashConsingEnabled()) {
+        this->expressionPtr = this->expressionPtr->getManager().getUniqueExpressionTable().getUniqueExpression(this->expressionPtr);
+    }
 }
 
-Expression::Expression(Variable const& variable) : expressionPtr(std::shared_ptr<BaseExpression>(new VariableExpression(variable))) {
+Expression::Expression(Variable const& variable) : Expression(std::shared_ptr<BaseExpression const>(new VariableExpression(variable))) {
     // Intentionally left empty.
 }
 
@@ -76,6 +79,9 @@ storm::RationalNumber Expression::evaluateAsRational() const {
 }
 
 Expression Expression::simplify() const {
+    if (this->getManager().isHashConsingEnabled()) {
+        return Expression(this->getManager().getUniqueExpressionTable().simplify(this->expressionPtr));
+    }
     return Expression(this->getBaseExpression().simplify());
 }
 
@@ -3,6 +3,7 @@
 #include "storm/exceptions/InvalidArgumentException.h"
 #include "storm/exceptions/InvalidStateException.h"
 #include "storm/storage/expressions/Expressions.h"
+#include "storm/storage/expressions/UniqueExpressionTable.h"
 #include "storm/storage/expressions/Variable.h"
 #include "storm/utility/macros.h"
 
@@ -78,7 +79,11 @@ ExpressionManager::~ExpressionManager() {
 }
 
 std::shared_ptr<ExpressionManager> ExpressionManager::clone() const {
-    return std::shared_ptr<ExpressionManager>(new ExpressionManager(*this));
+    auto result = std::shared_ptr<ExpressionManager>(new ExpressionManager(*this));
+    // The unique expressions refer to this manager, so the clone needs its own table.
+    result->setHashConsing(false);
+    result->setHashConsing(this->isHashConsingEnabled());
+    return result;
 }
 
 Expression ExpressionManager::boolean(bool value) const {
@@ -328,6 +333,23 @@ std::shared_ptr<ExpressionManager const> ExpressionManager::getSharedPointer() c
     return this->shared_from_this();
 }
 
+void ExpressionManager::setHashConsing(bool enabled) {
+    if (!enabled) {
+        uniqueExpressionTable.reset();
+    } else if (!uniqueExpressionTable) {
+        uniqueExpressionTable = std::make_shared<UniqueExpressionTable>();
+    }
+}
+
+bool ExpressionManager::isHashConsingEnabled() const {
+    return static_cast<bool>(uniqueExpressionTable);
+}
+
+UniqueExpressionTable& ExpressionManager::getUniqueExpressionTable() const {
+    STORM_LOG_ASSERT(uniqueExpressionTable, "Hash-consing is not enabled.");
+    return *uniqueExpressionTable;
+}
+
 std::ostream& operator<<(std::ostream& out, ExpressionManager const& manager) {
     out << "manager {\n";
 
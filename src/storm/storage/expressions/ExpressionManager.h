@@ -17,6 +17,8 @@
 
 namespace storm {
 namespace expressions {
+class UniqueExpressionTable;
+
 // Forward-declare manager class for iterator class.
 class ExpressionManager;
 
@@ -395,6 +397,27 @@ class ExpressionManager : public std::enable_shared_from_this<ExpressionManager>
      */
     std::shared_ptr<ExpressionManager const> getSharedPointer() const;
 
+    /*!
+     * Enables or disables hash-consing of expressions. If enabled, all expressions created with this manager are represented by unique nodes,
+     * i.e., structurally identical expressions share their nodes. This reduces memory consumption if many identical subexpressions are created
+     * and makes syntactical equality checks trivial. Results of simplifications are cached.
+     * Disabling hash-consing releases the table of unique expressions (expressions that are still in use stay valid).
+     * Note that hash-consing makes the creation of expressions not thread safe.
+     *
+     * @param enabled Flag indicating whether hash-consing is to be enabled.
+     */
+    void setHashConsing(bool enabled);
+
+    /*!
+     * Retrieves whether hash-consing of expressions is enabled.
+     */
+    bool isHashConsingEnabled() const;
+
+    /*!
+     * Retrieves the table of unique expressions. May only be called if hash-consing is enabled.
+     */
+    UniqueExpressionTable& getUniqueExpressionTable() const;
+
     friend std::ostream& operator<<(std::ostream& out, ExpressionManager const& manager);
 
    private:
@@ -487,6 +510,9 @@ class ExpressionManager : public std::enable_shared_from_this<ExpressionManager>
     mutable boost::optional<Type> rationalType;
     mutable std::unordered_set<Type> arrayTypes;
 
+    // The table of unique expressions (only present if hash-consing is enabled).
+    std::shared_ptr<UniqueExpressionTable> uniqueExpressionTable;
+
     // A mask that can be used to query whether a variable is an auxiliary variable.
     static const uint64_t auxiliaryMask = (1ull << 50);
 
@@ -1,12 +1,25 @@
 #include "storm/storage/expressions/SyntacticalEqualityCheckVisitor.h"
 
+#include "storm/storage/expressions/ExpressionManager.h"
 #include "storm/storage/expressions/Expressions.h"
+#include "storm/storage/expressions/UniqueExpressionTable.h"
 
 namespace storm {
 namespace expressions {
 
 bool SyntacticalEqualityCheckVisitor::isSyntacticallyEqual(storm::expressions::Expression const& expression1,
                                                            storm::expressions::Expression const& expression2) {
+    if (expression1.getBaseExpressionPointer() == expression2.getBaseExpressionPointer()) {
+        return true;
+    }
+    // Distinct unique expressions of the same manager are never syntactically equal.
+    ExpressionManager const& manager = expression1.getManager();
+    if (manager.isHashConsingEnabled() && &manager == &expression2.getManager()) {
+        UniqueExpressionTable const& table = manager.getUniqueExpressionTable();
+        if (table.isUniqueExpression(&expression1.getBaseExpression()) && table.isUniqueExpression(&expression2.getBaseExpression())) {
+            return false;
+        }
+    }
     return boost::any_cast<bool>(expression1.accept(*this, std::ref(expression2.getBaseExpression())));
 }
 
@@ -0,0 +1,219 @@
+#include "storm/storage/expressions/UniqueExpressionTable.h"
+
+#include <vector>
+
+#include <boost/functional/hash.hpp>
+
+#include "storm/storage/expressions/Expressions.h"
+
+namespace storm {
+namespace expressions {
+
+namespace {
+enum class NodeKind { Unknown, IfThenElse, BinaryBooleanFunction, BinaryNumericalFunction, BinaryRelation, UnaryBooleanFunction, UnaryNumericalFunction,
+                      BooleanLiteral, IntegerLiteral, RationalLiteral, Variable, Predicate };
+
+NodeKind getKind(BaseExpression const& expression) {
+    if (expression.isIfThenElseExpression()) {
+        return NodeKind::IfThenElse;
+    } else if (expression.isBinaryBooleanFunctionExpression()) {
+        return NodeKind::BinaryBooleanFunction;
+    } else if (expression.isBinaryNumericalFunctionExpression()) {
+        return NodeKind::BinaryNumericalFunction;
+    } else if (expression.isBinaryRelationExpression()) {
+        return NodeKind::BinaryRelation;
+    } else if (expression.isUnaryBooleanFunctionExpression()) {
+        return NodeKind::UnaryBooleanFunction;
+    } else if (expression.isUnaryNumericalFunctionExpression()) {
+        return NodeKind::UnaryNumericalFunction;
+    } else if (expression.isBooleanLiteralExpression()) {
+        return NodeKind::BooleanLiteral;
+    } else if (expression.isIntegerLiteralExpression()) {
+        return NodeKind::IntegerLiteral;
+    } else if (expression.isRationalLiteralExpression()) {
+        return NodeKind::RationalLiteral;
+    } else if (expression.isVariableExpression()) {
+        return NodeKind::Variable;
+    } else if (expression.isPredicateExpression()) {
+        return NodeKind::Predicate;
+    }
+    return NodeKind::Unknown;
+}
+
+/*!
+ * Retrieves the data that distinguishes nodes of the same kind apart from their operands and their type (operator, value or variable index).
+ * Rational literals are only distinguished by their approximate value here.
+ */
+uint64_t getNodeData(BaseExpression const& expression, NodeKind kind) {
+    switch (kind) {
+        case NodeKind::BinaryBooleanFunction:
+            return static_cast<uint64_t>(expression.asBinaryBooleanFunctionExpression().getOperatorType());
+        case NodeKind::BinaryNumericalFunction:
+            return static_cast<uint64_t>(expression.asBinaryNumericalFunctionExpression().getOperatorType());
+        case NodeKind::BinaryRelation:
+            return static_cast<uint64_t>(expression.asBinaryRelationExpression().getRelationType());
+        case NodeKind::UnaryBooleanFunction:
+            return static_cast<uint64_t>(expression.asUnaryBooleanFunctionExpression().getOperatorType());
+        case NodeKind::UnaryNumericalFunction:
+            return static_cast<uint64_t>(expression.asUnaryNumericalFunctionExpression().getOperatorType());
+        case NodeKind::BooleanLiteral:
+            return expression.asBooleanLiteralExpression().getValue() ? 1 : 0;
+        case NodeKind::IntegerLiteral:
+            return static_cast<uint64_t>(expression.asIntegerLiteralExpression().getValue());
+        case NodeKind::RationalLiteral:
+            return std::hash<double>()(expression.asRationalLiteralExpression().getValueAsDouble());
+        case NodeKind::Variable:
+            return expression.asVariableExpression().getVariable().getIndex();
+        case NodeKind::Predicate:
+            return static_cast<uint64_t>(expression.asPredicateExpression().getPredicateType());
+        default:
+            return 0;
+    }
+}
+
+/*!
+ * Creates a copy of the given node with the given operands.
+ */
+std::shared_ptr<BaseExpression const> rebuild(BaseExpression const& expression, NodeKind kind, std::vector<std::shared_ptr<BaseExpression const>> const& operands) {
+    ExpressionManager const& manager = expression.getManager();
+    Type const& type = expression.getType();
+    switch (kind) {
+        case NodeKind::IfThenElse:
+            return std::make_shared<IfThenElseExpression>(manager, type, operands[0], operands[1], operands[2]);
+        case NodeKind::BinaryBooleanFunction:
+            return std::make_shared<BinaryBooleanFunctionExpression>(manager, type, operands[0], operands[1],
+                                                                     expression.asBinaryBooleanFunctionExpression().getOperatorType());
+        case NodeKind::BinaryNumericalFunction:
+            return std::make_shared<BinaryNumericalFunctionExpression>(manager, type, operands[0], operands[1],
+                                                                       expression.asBinaryNumericalFunctionExpression().getOperatorType());
+        case NodeKind::BinaryRelation:
+            return std::make_shared<BinaryRelationExpression>(manager, type, operands[0], operands[1], expression.asBinaryRelationExpression().getRelationType());
+        case NodeKind::UnaryBooleanFunction:
+            return std::make_shared<UnaryBooleanFunctionExpression>(manager, type, operands[0], expression.asUnaryBooleanFunctionExpression().getOperatorType());
+        case NodeKind::UnaryNumericalFunction:
+            return std::make_shared<UnaryNumericalFunctionExpression>(manager, type, operands[0],
+                                                                      expression.asUnaryNumericalFunctionExpression().getOperatorType());
+        case NodeKind::Predicate:
+            return std::make_shared<PredicateExpression>(manager, type, operands, expression.asPredicateExpression().getPredicateType());
+        default:
+            // Nodes without operands never need to be rebuilt.
+            return expression.getSharedPointer();
+    }
+}
+}  // namespace
+
+std::shared_ptr<BaseExpression const> UniqueExpressionTable::getUniqueExpression(std::shared_ptr<BaseExpression const> const& expression) {
+    auto result = makeUnique(expression);
+    return result ? result : expression;
+}
+
+bool UniqueExpressionTable::isUniqueExpression(BaseExpression const* expression) const {
+    return uniqueExpressionAddresses.count(expression) > 0;
+}
+
+std::shared_ptr<BaseExpression const> UniqueExpressionTable::simplify(std::shared_ptr<BaseExpression const> const& expression) {
+    auto cacheIt = simplificationCache.find(expression.get());
+    if (cacheIt != simplificationCache.end()) {
+        return cacheIt->second;
+    }
+    auto result = getUniqueExpression(expression->simplify());
+    // Only unique expressions are cached, as only those are guaranteed to stay alive as long as the cache entry.
+    if (isUniqueExpression(expression.get())) {
+        simplificationCache.emplace(expression.get(), result);
+    }
+    return result;
+}
+
+uint64_t UniqueExpressionTable::getNumberOfUniqueExpressions() const {
+    return uniqueExpressions.size();
+}
+
+void UniqueExpressionTable::removeUnusedExpressions() {
+    simplificationCache.clear();
+    // Removing an expression may release its operands, so we repeat until nothing changes.
+    bool changed = true;
+    while (changed) {
+        changed = false;
+        for (auto it = uniqueExpressions.begin(); it != uniqueExpressions.end();) {
+            if (it->use_count() == 1) {
+                uniqueExpressionAddresses.erase(it->get());
+                it = uniqueExpressions.erase(it);
+                changed = true;
+            } else {
+                ++it;
+            }
+        }
+    }
+}
+
+std::shared_ptr<BaseExpression const> UniqueExpressionTable::makeUnique(std::shared_ptr<BaseExpression const> const& expression) {
+    if (isUniqueExpression(expression.get())) {
+        return expression;
+    }
+    NodeKind kind = getKind(*expression);
+    if (kind == NodeKind::Unknown) {
+        return nullptr;
+    }
+
+    // First make the operands unique and replace this node if any of the operands changed.
+    std::shared_ptr<BaseExpression const> node = expression;
+    uint64_t arity = expression->getArity();
+    if (arity > 0) {
+        std::vector<std::shared_ptr<BaseExpression const>> operands;
+        operands.reserve(arity);
+        bool operandChanged = false;
+        for (uint64_t operandIndex = 0; operandIndex < arity; ++operandIndex) {
+            auto operand = expression->getOperand(operandIndex);
+            auto uniqueOperand = makeUnique(operand);
+            if (!uniqueOperand) {
+                return nullptr;
+            }
+            operandChanged |= uniqueOperand != operand;
+            operands.push_back(std::move(uniqueOperand));
+        }
+        if (operandChanged) {
+            node = rebuild(*expression, kind, operands);
+        }
+    }
+
+    auto insertionResult = uniqueExpressions.insert(node);
+    if (insertionResult.second) {
+        uniqueExpressionAddresses.insert(node.get());
+    }
+    return *insertionResult.first;
+}
+
+std::size_t UniqueExpressionTable::ShallowHash::operator()(std::shared_ptr<BaseExpression const> const& expression) const {
+    NodeKind kind = getKind(*expression);
+    std::size_t seed = static_cast<std::size_t>(kind);
+    boost::hash_combine(seed, getNodeData(*expression, kind));
+    boost::hash_combine(seed, expression->getType().getMask());
+    for (uint64_t operandIndex = 0; operandIndex < expression->getArity(); ++operandIndex) {
+        boost::hash_combine(seed, expression->getOperand(operandIndex).get());
+    }
+    return seed;
+}
+
+bool UniqueExpressionTable::ShallowEqual::operator()(std::shared_ptr<BaseExpression const> const& first,
+                                                     std::shared_ptr<BaseExpression const> const& second) const {
+    if (first == second) {
+        return true;
+    }
+    NodeKind kind = getKind(*first);
+    if (kind != getKind(*second) || getNodeData(*first, kind) != getNodeData(*second, kind) || !(first->getType() == second->getType()) ||
+        first->getArity() != second->getArity()) {
+        return false;
+    }
+    if (kind == NodeKind::RationalLiteral && first->asRationalLiteralExpression().getValue() != second->asRationalLiteralExpression().getValue()) {
+        return false;
+    }
+    for (uint64_t operandIndex = 0; operandIndex < first->getArity(); ++operandIndex) {
+        if (first->getOperand(operandIndex) != second->getOperand(operandIndex)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+}  // namespace expressions
+}  // namespace storm
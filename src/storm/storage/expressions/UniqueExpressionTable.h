@@ -0,0 +1,81 @@
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <unordered_map>
+#include <unordered_set>
+
+namespace storm {
+namespace expressions {
+
+class BaseExpression;
+
+/*!
+ * A table of unique (hash-consed) expressions. Structurally identical expressions are represented by the same node, which means that
+ * two unique expressions are syntactically equal iff they are the same object.
+ *
+ * Expressions involving nodes of unknown kind (e.g. JANI array expressions) are not made unique and are returned as they are.
+ * The table is not thread safe.
+ */
+class UniqueExpressionTable {
+   public:
+    /*!
+     * Retrieves the unique representative of the given expression. Subexpressions are made unique as well.
+     *
+     * @param expression The expression.
+     * @return The unique node that is structurally identical to the given expression, or the expression itself if it can not be made unique.
+     */
+    std::shared_ptr<BaseExpression const> getUniqueExpression(std::shared_ptr<BaseExpression const> const& expression);
+
+    /*!
+     * Retrieves whether the given node is the unique representative of its structure.
+     */
+    bool isUniqueExpression(BaseExpression const* expression) const;
+
+    /*!
+     * Simplifies the given unique expression. The result is cached, so each unique expression is simplified at most once.
+     *
+     * @param expression The (unique) expression to simplify.
+     * @return The unique representative of the simplified expression.
+     */
+    std::shared_ptr<BaseExpression const> simplify(std::shared_ptr<BaseExpression const> const& expression);
+
+    /*!
+     * Retrieves the number of unique expressions that are currently stored.
+     */
+    uint64_t getNumberOfUniqueExpressions() const;
+
+    /*!
+     * Removes all expressions that are not referenced from outside the table (including cached simplification results).
+     */
+    void removeUnusedExpressions();
+
+   private:
+    /*!
+     * Retrieves the unique representative of the given expression or a null pointer if the expression (or one of its subexpressions)
+     * can not be made unique.
+     */
+    std::shared_ptr<BaseExpression const> makeUnique(std::shared_ptr<BaseExpression const> const& expression);
+
+    // Hashes a node based on its kind, operator, literal value and the addresses of its (unique) operands.
+    struct ShallowHash {
+        std::size_t operator()(std::shared_ptr<BaseExpression const> const& expression) const;
+    };
+
+    // Compares two nodes based on their kind, operator, literal value and the addresses of their (unique) operands.
+    struct ShallowEqual {
+        bool operator()(std::shared_ptr<BaseExpression const> const& first, std::shared_ptr<BaseExpression const> const& second) const;
+    };
+
+    // The unique expressions.
+    std::unordered_set<std::shared_ptr<BaseExpression const>, ShallowHash, ShallowEqual> uniqueExpressions;
+
+    // The addresses of the unique expressions allowing a fast check whether an expression is already unique.
+    std::unordered_set<BaseExpression const*> uniqueExpressionAddresses;
+
+    // The results of simplifying unique expressions.
+    std::unordered_map<BaseExpression const*, std::shared_ptr<BaseExpression const>> simplificationCache;
+};
+
+}  // namespace expressions
+}  // namespace storm
@@ -68,13 +68,14 @@ std::shared_ptr<Polytope<ValueType>> NativePolytope<ValueType>::create(boost::op
 }
 
 template<typename ValueType>
-NativePolytope<ValueType>::NativePolytope(NativePolytope<ValueType> const& other) : emptyStatus(other.emptyStatus), A(other.A), b(other.b) {
+NativePolytope<ValueType>::NativePolytope(NativePolytope<ValueType> const& other)
+    : emptyStatus(other.emptyStatus), A(other.A), b(other.b), vertices(other.vertices) {
     // Intentionally left empty
 }
 
 template<typename ValueType>
 NativePolytope<ValueType>::NativePolytope(NativePolytope<ValueType>&& other)
-    : emptyStatus(std::move(other.emptyStatus)), A(std::move(other.A)), b(std::move(other.b)) {
+    : emptyStatus(std::move(other.emptyStatus)), A(std::move(other.A)), b(std::move(other.b)), vertices(std::move(other.vertices)) {
     // Intentionally left empty
 }
 
@@ -97,7 +98,7 @@ NativePolytope<ValueType>::~NativePolytope() {
 
 template<typename ValueType>
 std::vector<typename Polytope<ValueType>::Point> NativePolytope<ValueType>::getVertices() const {
-    std::vector<EigenVector> eigenVertices = getEigenVertices();
+    std::vector<EigenVector> const& eigenVertices = getEigenVertices();
     std::vector<Point> result;
     result.reserve(eigenVertices.size());
     for (auto const& p : eigenVertices) {
@@ -240,9 +241,16 @@ std::shared_ptr<Polytope<ValueType>> NativePolytope<ValueType>::convexUnion(std:
 
     STORM_LOG_WARN_COND_DEBUG(false, "Implementation of convex union of two polytopes only works if the polytopes are bounded. This is not checked.");
 
-    std::vector<EigenVector> rhsVertices = dynamic_cast<NativePolytope<ValueType> const&>(*rhs).getEigenVertices();
+    NativePolytope<ValueType> const& nativeRhs = dynamic_cast<NativePolytope<ValueType> const&>(*rhs);
+    std::vector<EigenVector> const& rhsVertices = nativeRhs.getEigenVertices();
     std::vector<EigenVector> resultVertices = this->getEigenVertices();
-    resultVertices.insert(resultVertices.end(), std::make_move_iterator(rhsVertices.begin()), std::make_move_iterator(rhsVertices.end()));
+    // If one of the polytopes contains the other one, the convex hull does not need to be recomputed
+    if (this->containsAll(rhsVertices)) {
+        return std::make_shared<NativePolytope<ValueType>>(*this);
+    } else if (nativeRhs.containsAll(resultVertices)) {
+        return std::make_shared<NativePolytope<ValueType>>(nativeRhs);
+    }
+    resultVertices.insert(resultVertices.end(), rhsVertices.begin(), rhsVertices.end());
 
     storm::storage::geometry::QuickHull<ValueType> qh;
     qh.generateHalfspacesFromPoints(resultVertices, false);
@@ -312,7 +320,16 @@ std::shared_ptr<Polytope<ValueType>> NativePolytope<ValueType>::affineTransforma
     }
     EigenMatrix newA = A * luMatrix.inverse();
     EigenVector newb = b + (newA * eigenVector);
-    return std::make_shared<NativePolytope<ValueType>>(emptyStatus, std::move(newA), std::move(newb));
+    auto result = std::make_shared<NativePolytope<ValueType>>(emptyStatus, std::move(newA), std::move(newb));
+    if (vertices) {
+        // The transformation is invertible, so it maps the vertices to the vertices of the result
+        result->vertices = std::vector<EigenVector>();
+        result->vertices->reserve(vertices->size());
+        for (auto const& vertex : vertices.get()) {
+            result->vertices->push_back(eigenMatrix * vertex + eigenVector);
+        }
+    }
+    return result;
 }
 
 template<typename ValueType>
@@ -381,10 +398,25 @@ bool NativePolytope<ValueType>::isNativePolytope() const {
     return true;
 }
 template<typename ValueType>
-std::vector<typename NativePolytope<ValueType>::EigenVector> NativePolytope<ValueType>::getEigenVertices() const {
-    storm::storage::geometry::HyperplaneEnumeration<ValueType> he;
-    he.generateVerticesFromConstraints(A, b, false);
-    return he.getResultVertices();
+std::vector<typename NativePolytope<ValueType>::EigenVector> const& NativePolytope<ValueType>::getEigenVertices() const {
+    if (!vertices) {
+        storm::storage::geometry::HyperplaneEnumeration<ValueType> he;
+        he.generateVerticesFromConstraints(A, b, false);
+        vertices = std::move(he.getResultVertices());
+    }
+    return vertices.get();
+}
+
+template<typename ValueType>
+bool NativePolytope<ValueType>::containsAll(std::vector<EigenVector> const& points) const {
+    for (auto const& point : points) {
+        for (Eigen::Index row = 0; row < A.rows(); ++row) {
+            if ((A.row(row) * point)(0) > b(row)) {
+                return false;
+            }
+        }
+    }
+    return true;
 }
 
 template<typename ValueType>
@@ -448,7 +480,11 @@ std::shared_ptr<Polytope<ValueType>> NativePolytope<ValueType>::clean() {
     for (auto row : keptConstraints) {
         newHalfspaces.emplace_back(storm::adapters::EigenAdapter::toStdVector(EigenVector(A.row(row))), b(row));
     }
-    return create(newHalfspaces, boost::none);
+    // Only redundant constraints are removed, so the result describes the same (non-empty) set
+    auto result = std::make_shared<NativePolytope<ValueType>>(newHalfspaces);
+    result->emptyStatus = EmptyStatus::Nonempty;
+    result->vertices = vertices;
+    return result;
 }
 
 template class NativePolytope<double>;
@@ -141,7 +141,10 @@ class NativePolytope : public Polytope<ValueType> {
 
    private:
     // returns the vertices of this polytope as EigenVectors
-    std::vector<EigenVector> getEigenVertices() const;
+    std::vector<EigenVector> const& getEigenVertices() const;
+
+    // returns true iff all given points are inside of this polytope
+    bool containsAll(std::vector<EigenVector> const& points) const;
 
     // As optimize(..) but with EigenVectors
     std::pair<EigenVector, bool> optimize(EigenVector const& direction) const;
@@ -152,6 +155,9 @@ class NativePolytope : public Polytope<ValueType> {
     // Intern representation of the polytope as { x | Ax<=b }
     EigenMatrix A;
     EigenVector b;
+
+    // The vertices of the polytope. These are computed on demand and kept by operations that preserve (or simply transform) them
+    mutable boost::optional<std::vector<EigenVector>> vertices;
 };
 
 }  // namespace geometry
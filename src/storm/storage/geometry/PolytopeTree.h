@@ -25,46 +25,54 @@ class PolytopeTree {
     /*!
      * Substracts the given rhs from this polytope.
      * Points that lie on the boundary of rhs might still be included.
+     * @return true iff this set might have changed. Inner nodes whose children did not change keep their polytope.
      */
-    void setMinus(std::shared_ptr<Polytope<ValueType>> const& rhs) {
+    bool setMinus(std::shared_ptr<Polytope<ValueType>> const& rhs) {
         // This operation only has an effect if the intersection of this and rhs is non-empty.
-        if (!isEmpty() && !polytope->intersection(rhs)->isEmpty()) {
-            if (children.empty()) {
-                // This is a leaf node.
-                // Apply splitting.
-                auto newChildren = polytope->setMinus(rhs);
-                if (newChildren.empty()) {
-                    // Delete this node.
-                    polytope = nullptr;
-                } else if (newChildren.size() == 1) {
-                    // Replace this node with its only child
-                    polytope = newChildren.front()->clean();
-                } else {
-                    // Add the new children to this node. There is no need to traverse them.
-                    for (auto& c : newChildren) {
-                        children.push_back(c->clean());
-                    }
-                }
+        if (isEmpty() || polytope->intersection(rhs)->isEmpty()) {
+            return false;
+        }
+        if (children.empty()) {
+            // This is a leaf node.
+            // Apply splitting.
+            auto newChildren = polytope->setMinus(rhs);
+            if (newChildren.empty()) {
+                // Delete this node.
+                polytope = nullptr;
+            } else if (newChildren.size() == 1) {
+                // Replace this node with its only child
+                polytope = newChildren.front()->clean();
             } else {
-                // This is an inner node. Traverse the children and set this to the convex union of its children.
-                std::vector<PolytopeTree<ValueType>> newChildren;
-                std::vector<std::vector<ValueType>> newPolytopeVertices;
-                for (auto& c : children) {
-                    c.setMinus(rhs);
-                    if (c.polytope != nullptr) {
-                        newChildren.push_back(c);
-                        auto cVertices = c.polytope->getVertices();
-                        newPolytopeVertices.insert(newPolytopeVertices.end(), cVertices.begin(), cVertices.end());
-                    }
+                // Add the new children to this node. There is no need to traverse them.
+                for (auto& c : newChildren) {
+                    children.push_back(c->clean());
                 }
-                if (newPolytopeVertices.empty()) {
-                    polytope = nullptr;
-                } else {
-                    polytope = storm::storage::geometry::Polytope<ValueType>::create(newPolytopeVertices);
+            }
+            return true;
+        }
+        // This is an inner node. Traverse the children and, if one of them changed, set this to the convex union of its children.
+        bool changed = false;
+        for (auto& c : children) {
+            changed |= c.setMinus(rhs);
+        }
+        if (changed) {
+            std::vector<PolytopeTree<ValueType>> newChildren;
+            std::vector<std::vector<ValueType>> newPolytopeVertices;
+            for (auto& c : children) {
+                if (c.polytope != nullptr) {
+                    auto cVertices = c.polytope->getVertices();
+                    newPolytopeVertices.insert(newPolytopeVertices.end(), cVertices.begin(), cVertices.end());
+                    newChildren.push_back(std::move(c));
                 }
-                children = std::move(newChildren);
             }
+            if (newPolytopeVertices.empty()) {
+                polytope = nullptr;
+            } else {
+                polytope = storm::storage::geometry::Polytope<ValueType>::create(newPolytopeVertices);
+            }
+            children = std::move(newChildren);
         }
+        return changed;
     }
 
     /*!
@@ -1,4 +1,7 @@
 #include "storm/storage/geometry/ReduceVertexCloud.h"
+
+#include <algorithm>
+
 #include "storm/utility/Stopwatch.h"
 #include "storm/utility/constants.h"
 #undef _DEBUG_REDUCE_VERTEX_CLOUD
@@ -26,21 +29,41 @@ template<typename ValueType>
 std::pair<storm::storage::BitVector, bool> ReduceVertexCloud<ValueType>::eliminate(std::vector<std::map<uint64_t, ValueType>> const& input,
                                                                                    uint64_t maxdimension) {
     std::shared_ptr<storm::expressions::ExpressionManager> expressionManager = std::make_shared<storm::expressions::ExpressionManager>();
-    std::vector<storm::storage::BitVector> supports;
     std::vector<storm::expressions::Variable> weightVariables;
     std::vector<storm::expressions::Expression> weightVariableExpressions;
 
+    // Group the points by their support vectors to quickly determine which input points could be relevant:
+    // Only points whose support is a subset of the support of a point can be combined to that point.
+    std::map<storm::storage::BitVector, uint64_t> supportToGroup;
+    std::vector<storm::storage::BitVector> groupSupports;
+    std::vector<std::vector<uint64_t>> groupPoints;
+    std::vector<uint64_t> pointToGroup;
+    pointToGroup.reserve(input.size());
     for (uint64_t pointIndex = 0; pointIndex < input.size(); ++pointIndex) {
-        // Compute the support vectors to quickly determine which input points could be relevant.
-        supports.push_back(storm::storage::BitVector(maxdimension));
+        storm::storage::BitVector support(maxdimension);
         for (auto const& entry : input[pointIndex]) {
-            supports.back().set(entry.first, true);
+            support.set(entry.first, true);
+        }
+        auto groupIt = supportToGroup.emplace(std::move(support), groupSupports.size());
+        if (groupIt.second) {
+            groupSupports.push_back(groupIt.first->first);
+            groupPoints.emplace_back();
         }
+        pointToGroup.push_back(groupIt.first->second);
+        groupPoints[groupIt.first->second].push_back(pointIndex);
         // Add a weight variable for each input point
         weightVariables.push_back(expressionManager->declareRationalVariable("w_" + std::to_string(pointIndex)));
         // For convenience and performance, obtain the expression.
         weightVariableExpressions.push_back(weightVariables.back().getExpression());
     }
+    std::vector<std::vector<uint64_t>> subsetGroups(groupSupports.size());
+    for (uint64_t group = 0; group < groupSupports.size(); ++group) {
+        for (uint64_t potentialSubsetGroup = 0; potentialSubsetGroup < groupSupports.size(); ++potentialSubsetGroup) {
+            if (groupSupports[potentialSubsetGroup].isSubsetOf(groupSupports[group])) {
+                subsetGroups[group].push_back(potentialSubsetGroup);
+            }
+        }
+    }
 
     std::unique_ptr<storm::solver::SmtSolver> smtSolver = smtSolverFactory->create(*expressionManager);
     for (auto const& weightVariableExpr : weightVariableExpressions) {
@@ -54,6 +77,7 @@ std::pair<storm::storage::BitVector, bool> ReduceVertexCloud<ValueType>::elimina
         smtSolver->add(storm::expressions::sum(weightVariableExpressions) <= expressionManager->rational(1 + wiggle));
         smtSolver->add(storm::expressions::sum(weightVariableExpressions) >= expressionManager->rational(1 - wiggle));
     }
+    ValueType const maxWeightSum = storm::utility::one<ValueType>() + wiggle;
 
     storm::utility::Stopwatch solverTime;
     storm::utility::Stopwatch totalTime(true);
@@ -62,62 +86,88 @@ std::pair<storm::storage::BitVector, bool> ReduceVertexCloud<ValueType>::elimina
 #ifdef _DEBUG_REUCE_VERTEX_CLOUD
         std::cout << pointIndex << " out of " << input.size() << '\n';
 #endif
-        smtSolver->push();
-        std::map<uint64_t, std::vector<storm::expressions::Expression>> dimensionTerms;
+        storm::storage::BitVector candidates(input.size());
+        // A weighted sum of the candidates with nonnegative weights that sum up to at most maxWeightSum is bounded by the (scaled) bounding box of the
+        // candidates and the origin in each dimension. Points outside of this box are vertices, there is no need to invoke the solver.
+        std::map<uint64_t, std::pair<ValueType, ValueType>> bounds;
         for (auto const& entry : input[pointIndex]) {
-            dimensionTerms[entry.first] = {expressionManager->rational(-entry.second)};
+            bounds.emplace(entry.first, std::make_pair(storm::utility::zero<ValueType>(), storm::utility::zero<ValueType>()));
         }
-        for (uint64_t potentialSupport = 0; potentialSupport < input.size(); ++potentialSupport) {
-            if (pointIndex == potentialSupport) {
-                smtSolver->add(weightVariableExpressions[potentialSupport] == expressionManager->rational(0.0));
-            } else if (potentialSupport < pointIndex && !vertices.get(potentialSupport)) {
-                smtSolver->add(weightVariableExpressions[potentialSupport] == expressionManager->rational(0.0));
-            } else if (supports[potentialSupport].isSubsetOf(supports[pointIndex])) {
-                for (auto const& entry : input[potentialSupport]) {
-                    dimensionTerms[entry.first].push_back(weightVariableExpressions[potentialSupport] * expressionManager->rational(entry.second));
+        for (auto group : subsetGroups[pointToGroup[pointIndex]]) {
+            for (auto potentialSupport : groupPoints[group]) {
+                if (pointIndex != potentialSupport && (potentialSupport > pointIndex || vertices.get(potentialSupport))) {
+                    candidates.set(potentialSupport, true);
+                    for (auto const& entry : input[potentialSupport]) {
+                        auto& bound = bounds.at(entry.first);
+                        bound.first = std::min(bound.first, entry.second);
+                        bound.second = std::max(bound.second, entry.second);
+                    }
                 }
-            } else {
-                smtSolver->add(weightVariableExpressions[potentialSupport] == expressionManager->rational(0.0));
             }
         }
-        for (auto const& entry : dimensionTerms) {
-            smtSolver->add(storm::expressions::sum(entry.second) == expressionManager->rational(0.0));
+        bool outsideOfBounds = false;
+        for (auto const& entry : input[pointIndex]) {
+            auto const& bound = bounds.at(entry.first);
+            if (entry.second < maxWeightSum * bound.first || entry.second > maxWeightSum * bound.second) {
+                outsideOfBounds = true;
+                break;
+            }
         }
+        if (outsideOfBounds) {
+            vertices.set(pointIndex, true);
+        } else {
+            smtSolver->push();
+            std::map<uint64_t, std::vector<storm::expressions::Expression>> dimensionTerms;
+            for (auto const& entry : input[pointIndex]) {
+                dimensionTerms[entry.first] = {expressionManager->rational(-entry.second)};
+            }
+            for (uint64_t potentialSupport = 0; potentialSupport < input.size(); ++potentialSupport) {
+                if (candidates.get(potentialSupport)) {
+                    for (auto const& entry : input[potentialSupport]) {
+                        dimensionTerms[entry.first].push_back(weightVariableExpressions[potentialSupport] * expressionManager->rational(entry.second));
+                    }
+                } else {
+                    smtSolver->add(weightVariableExpressions[potentialSupport] == expressionManager->rational(0.0));
+                }
+            }
+            for (auto const& entry : dimensionTerms) {
+                smtSolver->add(storm::expressions::sum(entry.second) == expressionManager->rational(0.0));
+            }
 
-        solverTime.start();
-        auto result = smtSolver->check();
-        solverTime.stop();
-        if (result == storm::solver::SmtSolver::CheckResult::Unsat) {
+            solverTime.start();
+            auto result = smtSolver->check();
+            solverTime.stop();
+            if (result == storm::solver::SmtSolver::CheckResult::Unsat) {
 #ifdef _DEBUG_REDUCE_VERTEX_CLOUD
-            if (input[pointIndex].size() == 2) {
-                std::cout << "point " << toString(input[pointIndex]) << " is a vertex:";
-                std::cout << smtSolver->getSmtLibString() << '\n';
-            }
+                if (input[pointIndex].size() == 2) {
+                    std::cout << "point " << toString(input[pointIndex]) << " is a vertex:";
+                    std::cout << smtSolver->getSmtLibString() << '\n';
+                }
 #endif
-            vertices.set(pointIndex, true);
-        }
+                vertices.set(pointIndex, true);
+            }
 #ifdef _DEBUG_REDUCE_VERTEX_CLOUD
-        else {
-            std::cout << "point " << toString(input[pointIndex]) << " is a convex combination of ";
-            auto val = smtSolver->getModelAsValuation();
-            uint64_t varIndex = 0;
-            for (auto const& wvar : weightVariables) {
-                if (!storm::utility::isZero(val.getRationalValue(wvar))) {
-                    std::cout << toString(input[varIndex]) << " (weight: " << val.getRationalValue(wvar) << ")";
+            else {
+                std::cout << "point " << toString(input[pointIndex]) << " is a convex combination of ";
+                auto val = smtSolver->getModelAsValuation();
+                uint64_t varIndex = 0;
+                for (auto const& wvar : weightVariables) {
+                    if (!storm::utility::isZero(val.getRationalValue(wvar))) {
+                        std::cout << toString(input[varIndex]) << " (weight: " << val.getRationalValue(wvar) << ")";
+                    }
+                    varIndex++;
                 }
-                varIndex++;
+                std::cout << '\n';
             }
-            std::cout << '\n';
-        }
-        if (timeOut >)
 #endif
-            if (timeOut > 0 && static_cast<uint64_t>(totalTime.getTimeInMilliseconds()) > timeOut) {
-                for (uint64_t remainingPoint = pointIndex + 1; remainingPoint < input.size(); ++remainingPoint) {
-                    vertices.set(remainingPoint);
-                }
-                return {vertices, true};
+            smtSolver->pop();
+        }
+        if (timeOut > 0 && static_cast<uint64_t>(totalTime.getTimeInMilliseconds()) > timeOut) {
+            for (uint64_t remainingPoint = pointIndex + 1; remainingPoint < input.size(); ++remainingPoint) {
+                vertices.set(remainingPoint);
             }
-        smtSolver->pop();
+            return {vertices, true};
+        }
 #ifdef _DEBUG_REDUCE_VERTEX_CLOUD
         std::cout << "Solver time " << solverTime.getTimeInMilliseconds() << '\n';
         std::cout << "Total time " << totalTime.getTimeInMilliseconds() << '\n';
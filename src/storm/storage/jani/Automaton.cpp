@@ -1,5 +1,8 @@
 #include "storm/storage/jani/Automaton.h"
 
+#include <algorithm>
+#include <numeric>
+
 #include "storm/storage/expressions/ExpressionManager.h"
 #include "storm/storage/jani/Edge.h"
 #include "storm/storage/jani/Location.h"
@@ -307,6 +310,51 @@ void Automaton::addEdge(Edge const& edge) {
     }
 }
 
+void Automaton::addEdges(std::vector<Edge> const& newEdges) {
+    if (newEdges.empty()) {
+        return;
+    }
+    for (auto const& edge : newEdges) {
+        STORM_LOG_THROW(edge.getSourceLocationIndex() < locations.size(), storm::exceptions::InvalidArgumentException,
+                        "Cannot add edge with unknown source location index '" << edge.getSourceLocationIndex() << "'.");
+    }
+    assert(validate());
+
+    // Group the new edges by their source location (keeping their relative order).
+    std::vector<uint64_t> newEdgeOrder(newEdges.size());
+    std::iota(newEdgeOrder.begin(), newEdgeOrder.end(), 0);
+    std::stable_sort(newEdgeOrder.begin(), newEdgeOrder.end(), [&newEdges](uint64_t first, uint64_t second) {
+        return newEdges[first].getSourceLocationIndex() < newEdges[second].getSourceLocationIndex();
+    });
+
+    // Merge them into the existing edges, such that the edges of each location stay sorted by action index.
+    std::vector<Edge>& concreteEdges = edges.getConcreteEdges();
+    std::vector<Edge> mergedEdges;
+    mergedEdges.reserve(concreteEdges.size() + newEdges.size());
+    std::vector<uint64_t> newLocationToStartingIndex(locationToStartingIndex.size());
+    auto newEdgeIt = newEdgeOrder.begin();
+    for (uint64_t locationIndex = 0; locationIndex < locations.size(); ++locationIndex) {
+        newLocationToStartingIndex[locationIndex] = mergedEdges.size();
+        for (uint64_t edgeIndex = locationToStartingIndex[locationIndex]; edgeIndex < locationToStartingIndex[locationIndex + 1]; ++edgeIndex) {
+            mergedEdges.push_back(std::move(concreteEdges[edgeIndex]));
+        }
+        bool addedEdges = false;
+        for (; newEdgeIt != newEdgeOrder.end() && newEdges[*newEdgeIt].getSourceLocationIndex() == locationIndex; ++newEdgeIt) {
+            mergedEdges.push_back(newEdges[*newEdgeIt]);
+            actionIndices.insert(newEdges[*newEdgeIt].getActionIndex());
+            addedEdges = true;
+        }
+        if (addedEdges) {
+            std::stable_sort(mergedEdges.begin() + newLocationToStartingIndex[locationIndex], mergedEdges.end(),
+                             [](Edge const& first, Edge const& second) { return first.getActionIndex() < second.getActionIndex(); });
+        }
+    }
+    newLocationToStartingIndex.back() = mergedEdges.size();
+
+    concreteEdges = std::move(mergedEdges);
+    locationToStartingIndex = std::move(newLocationToStartingIndex);
+}
+
 std::vector<Edge>& Automaton::getEdges() {
     return edges.getConcreteEdges();
 }
@@ -208,6 +208,11 @@ class Automaton {
      */
     void addEdge(Edge const& edge);
 
+    /*!
+     * Adds the given edges to the automaton. In contrast to adding the edges one by one, the edge container is only rebuilt once.
+     */
+    void addEdges(std::vector<Edge> const& newEdges);
+
     bool validate() const;
 
     /*!
@@ -1,6 +1,8 @@
 #include "storm/storage/jani/Model.h"
 
 #include <algorithm>
+#include <limits>
+#include <optional>
 
 #include "storm/storage/expressions/ExpressionManager.h"
 
@@ -22,6 +24,7 @@
 #include "storm/storage/jani/visitor/JaniExpressionSubstitutionVisitor.h"
 
 #include "storm/storage/expressions/LinearityCheckVisitor.h"
+#include "storm/storage/expressions/VariableExpression.h"
 
 #include "storm/utility/combinatorics.h"
 
@@ -33,6 +36,7 @@
 #include "storm/utility/macros.h"
 #include "storm/utility/vector.h"
 
+#include "storm/adapters/IntelTbbAdapter.h"
 #include "storm/solver/SmtSolver.h"
 
 namespace storm {
@@ -227,122 +231,175 @@ ConditionalMetaEdge createSynchronizedMetaEdge(Automaton& automaton, std::vector
     return result;
 }
 
-std::vector<ConditionalMetaEdge> createSynchronizingMetaEdges(Model const& oldModel, Model& newModel, Automaton& newAutomaton,
-                                                              std::vector<std::set<uint64_t>>& synchronizingActionIndices, SynchronizationVector const& vector,
-                                                              std::vector<std::reference_wrapper<Automaton const>> const& composedAutomata,
-                                                              storm::solver::SmtSolver& solver) {
-    std::vector<ConditionalMetaEdge> result;
+/*!
+ * Over-approximates the valuations that satisfy a guard by an interval for each variable.
+ * The intervals are obtained syntactically from the conjuncts of the guard that compare a variable with a constant value.
+ */
+struct GuardBox {
+    void restrict(storm::expressions::Variable const& variable, int64_t lower, int64_t upper) {
+        auto interval = intervals.emplace(variable, std::make_pair(lower, upper)).first;
+        interval->second.first = std::max(interval->second.first, lower);
+        interval->second.second = std::min(interval->second.second, upper);
+        empty |= interval->second.first > interval->second.second;
+    }
 
-    // Gather all participating automata and the corresponding input symbols.
+    void intersect(GuardBox const& other) {
+        exact &= other.exact;
+        empty |= other.empty;
+        for (auto const& [variable, interval] : other.intervals) {
+            restrict(variable, interval.first, interval.second);
+        }
+    }
+
+    std::map<storm::expressions::Variable, std::pair<int64_t, int64_t>> intervals;
+    // Whether the box describes exactly the valuations satisfying the guard, i.e., whether all conjuncts have been captured.
+    bool exact{true};
+    // Whether it is known that no valuation satisfies the guard.
+    bool empty{false};
+};
+
+/*!
+ * Restricts the given box by the given expression, in which all defined constants need to be substituted.
+ */
+void restrictGuardBox(storm::expressions::Expression const& expression, GuardBox& box) {
+    int64_t const minusInfinity = std::numeric_limits<int64_t>::min();
+    int64_t const infinity = std::numeric_limits<int64_t>::max();
+    if (!expression.containsVariables()) {
+        box.empty |= !expression.evaluateAsBool();
+        return;
+    }
+    if (expression.isVariable() && expression.hasBooleanType()) {
+        box.restrict(expression.getBaseExpression().asVariableExpression().getVariable(), 1, 1);
+        return;
+    }
+    if (expression.isFunctionApplication()) {
+        auto const op = expression.getOperator();
+        if (op == storm::expressions::OperatorType::And) {
+            for (uint64_t i = 0; i < expression.getArity(); ++i) {
+                restrictGuardBox(expression.getOperand(i), box);
+            }
+            return;
+        }
+        if (op == storm::expressions::OperatorType::Not && expression.getOperand(0).isVariable()) {
+            box.restrict(expression.getOperand(0).getBaseExpression().asVariableExpression().getVariable(), 0, 0);
+            return;
+        }
+        if (expression.isRelationalExpression() && op != storm::expressions::OperatorType::NotEqual) {
+            // Bring the relation into the form 'variable op bound'.
+            auto variableSide = expression.getOperand(0);
+            auto boundSide = expression.getOperand(1);
+            bool mirrored = !variableSide.isVariable();
+            if (mirrored) {
+                std::swap(variableSide, boundSide);
+            }
+            if (variableSide.isVariable() && variableSide.hasIntegerType() && !boundSide.containsVariables() && boundSide.hasIntegerType()) {
+                auto const& variable = variableSide.getBaseExpression().asVariableExpression().getVariable();
+                int64_t const bound = boundSide.evaluateAsInt();
+                bool const less = mirrored ? (op == storm::expressions::OperatorType::Greater || op == storm::expressions::OperatorType::GreaterOrEqual)
+                                           : (op == storm::expressions::OperatorType::Less || op == storm::expressions::OperatorType::LessOrEqual);
+                bool const strict = op == storm::expressions::OperatorType::Less || op == storm::expressions::OperatorType::Greater;
+                if (op == storm::expressions::OperatorType::Equal) {
+                    box.restrict(variable, bound, bound);
+                } else if (less) {
+                    box.restrict(variable, minusInfinity, strict ? bound - 1 : bound);
+                } else {
+                    box.restrict(variable, strict ? bound + 1 : bound, infinity);
+                }
+                return;
+            }
+        }
+    }
+    // The expression can not be captured by the box.
+    box.exact = false;
+}
+
+/*!
+ * Enumerates the combinations of edges (one from each participating automaton) whose guards might be satisfiable together.
+ * A combination is pruned as soon as the boxes of the edges chosen so far are disjoint, so the combinations are never materialized.
+ * @param edgeBoxes for each participating automaton, the boxes of its possible edges
+ * @param callback receives the indices of the chosen edges and whether the combination is certainly satisfiable, i.e., whether all involved boxes are exact
+ */
+void forEachPossibleEdgeCombination(std::vector<std::vector<GuardBox const*>> const& edgeBoxes, uint64_t automaton, GuardBox const& prefixBox,
+                                    std::vector<uint64_t>& combination, std::function<void(std::vector<uint64_t> const&, bool)> const& callback) {
+    if (automaton == edgeBoxes.size()) {
+        callback(combination, prefixBox.exact);
+        return;
+    }
+    for (uint64_t edge = 0; edge < edgeBoxes[automaton].size(); ++edge) {
+        GuardBox box = prefixBox;
+        box.intersect(*edgeBoxes[automaton][edge]);
+        if (!box.empty) {
+            combination[automaton] = edge;
+            forEachPossibleEdgeCombination(edgeBoxes, automaton + 1, box, combination, callback);
+        }
+    }
+}
+
+/*!
+ * The edges that can take part in the synchronization described by a synchronization vector.
+ */
+struct SynchronizationCandidates {
+    // The participating automata.
     std::vector<uint64_t> components;
-    std::vector<std::pair<std::reference_wrapper<Automaton const>, uint64_t>> participatingAutomataAndActions;
+    // For each participating automaton, the indices of the edges with the participating action.
+    std::vector<std::vector<uint64_t>> edgeIndices;
+    uint64_t resultingActionIndex;
+};
+
+std::optional<SynchronizationCandidates> getSynchronizationCandidates(Model const& oldModel, Model& newModel,
+                                                                      std::vector<std::set<uint64_t>>& synchronizingActionIndices,
+                                                                      SynchronizationVector const& vector,
+                                                                      std::vector<std::reference_wrapper<Automaton const>> const& composedAutomata) {
+    SynchronizationCandidates result;
+
+    // Gather all participating automata and the corresponding input symbols.
+    std::vector<uint64_t> actionIndices;
     for (uint64_t i = 0; i < composedAutomata.size(); ++i) {
         std::string const& actionName = vector.getInput(i);
         if (!SynchronizationVector::isNoActionInput(actionName)) {
-            components.push_back(i);
-            uint64_t actionIndex = oldModel.getActionIndex(actionName);
-            // store that automaton occurs in the sync vector.
-            participatingAutomataAndActions.push_back(std::make_pair(composedAutomata[i], actionIndex));
+            result.components.push_back(i);
+            actionIndices.push_back(oldModel.getActionIndex(actionName));
             // Store for later that this action is one of the possible actions that synchronise
-            synchronizingActionIndices[i].insert(actionIndex);
+            synchronizingActionIndices[i].insert(actionIndices.back());
         }
     }
 
     // What is the action label that should be attached to the composed actions
-    uint64_t resultingActionIndex = Model::SILENT_ACTION_INDEX;
+    result.resultingActionIndex = Model::SILENT_ACTION_INDEX;
     if (vector.getOutput() != Model::SILENT_ACTION_NAME) {
         if (newModel.hasAction(vector.getOutput())) {
-            resultingActionIndex = newModel.getActionIndex(vector.getOutput());
+            result.resultingActionIndex = newModel.getActionIndex(vector.getOutput());
         } else {
-            resultingActionIndex = newModel.addAction(vector.getOutput());
+            result.resultingActionIndex = newModel.addAction(vector.getOutput());
         }
     }
 
-    bool noCombinations = false;
-
     // Prepare the list that stores for each automaton the list of edges with the participating action.
-    std::vector<std::vector<std::reference_wrapper<storm::jani::Edge const>>> possibleEdges;
-
-    for (auto const& automatonActionPair : participatingAutomataAndActions) {
-        possibleEdges.emplace_back();
-        for (auto const& edge : automatonActionPair.first.get().getEdges()) {
-            if (edge.getActionIndex() == automatonActionPair.second) {
-                possibleEdges.back().push_back(edge);
+    for (uint64_t i = 0; i < result.components.size(); ++i) {
+        result.edgeIndices.emplace_back();
+        auto const& edges = composedAutomata[result.components[i]].get().getEdges();
+        for (uint64_t edgeIndex = 0; edgeIndex < edges.size(); ++edgeIndex) {
+            if (edges[edgeIndex].getActionIndex() == actionIndices[i]) {
+                result.edgeIndices.back().push_back(edgeIndex);
             }
         }
 
         // If there were no edges with the participating action index, then there is no synchronization possible.
-        if (possibleEdges.back().empty()) {
-            noCombinations = true;
-            break;
+        if (result.edgeIndices.back().empty()) {
+            return std::nullopt;
         }
     }
+    return result;
+}
 
-    // If there are no valid combinations for the action, we need to skip the generation of synchronizing edges.
-    if (!noCombinations) {
-        // Save state of solver so that we can always restore the point where we have exactly the constant values
-        // and variables bounds on the assertion stack.
-        solver.push();
-
-        // Start by creating a fresh auxiliary variable for each edge and link it with the guard.
-        std::vector<std::vector<storm::expressions::Variable>> edgeVariables(possibleEdges.size());
-        std::vector<storm::expressions::Variable> allEdgeVariables;
-        for (uint_fast64_t outerIndex = 0; outerIndex < possibleEdges.size(); ++outerIndex) {
-            // Create auxiliary variables and link them with the guards.
-            for (uint_fast64_t innerIndex = 0; innerIndex < possibleEdges[outerIndex].size(); ++innerIndex) {
-                edgeVariables[outerIndex].push_back(newModel.getManager().declareFreshBooleanVariable());
-                allEdgeVariables.push_back(edgeVariables[outerIndex].back());
-                storm::expressions::Expression guard = eliminateFunctionCallsInExpression(possibleEdges[outerIndex][innerIndex].get().getGuard(), oldModel);
-                solver.add(implies(edgeVariables[outerIndex].back(), guard));
-            }
-
-            storm::expressions::Expression atLeastOneEdgeFromAutomaton = newModel.getManager().boolean(false);
-            for (auto const& edgeVariable : edgeVariables[outerIndex]) {
-                atLeastOneEdgeFromAutomaton = atLeastOneEdgeFromAutomaton || edgeVariable;
-            }
-            solver.add(atLeastOneEdgeFromAutomaton);
-
-            storm::expressions::Expression atMostOneEdgeFromAutomaton = newModel.getManager().boolean(true);
-            for (uint64_t first = 0; first < possibleEdges[outerIndex].size(); ++first) {
-                for (uint64_t second = first + 1; second < possibleEdges[outerIndex].size(); ++second) {
-                    atMostOneEdgeFromAutomaton = atMostOneEdgeFromAutomaton && !(edgeVariables[outerIndex][first] && edgeVariables[outerIndex][second]);
-                }
-            }
-            solver.add(atMostOneEdgeFromAutomaton);
-        }
-
-        // Now enumerate all possible combinations.
-        solver.allSat(allEdgeVariables, [&](storm::solver::SmtSolver::ModelReference& modelReference) -> bool {
-            // Now we need to reconstruct the chosen edges from the valuation of the edge variables.
-            std::vector<std::reference_wrapper<Edge const>> chosenEdges;
-
-            for (uint_fast64_t outerIndex = 0; outerIndex < edgeVariables.size(); ++outerIndex) {
-                for (uint_fast64_t innerIndex = 0; innerIndex < edgeVariables[outerIndex].size(); ++innerIndex) {
-                    if (modelReference.getBooleanValue(edgeVariables[outerIndex][innerIndex])) {
-                        chosenEdges.emplace_back(possibleEdges[outerIndex][innerIndex]);
-                        break;
-                    }
-                }
-            }
-
-            // Get a basic conditional meta edge that represents the synchronization of the provided edges.
-            // Note that there is still information missing, which we need to add (like the action index etc.).
-            ConditionalMetaEdge conditionalMetaEdge = createSynchronizedMetaEdge(newAutomaton, chosenEdges);
-
-            // Set the participating components.
-            conditionalMetaEdge.components = components;
-
-            // Set the action index.
-            conditionalMetaEdge.actionIndex = resultingActionIndex;
-
-            result.push_back(conditionalMetaEdge);
-
-            return true;
-        });
-
-        solver.pop();
+bool isPossiblySatisfiable(Model const& oldModel, std::vector<std::reference_wrapper<Edge const>> const& chosenEdges, storm::solver::SmtSolver& solver) {
+    // The solver already holds the values of the constants and the variable bounds.
+    solver.push();
+    for (auto const& edge : chosenEdges) {
+        solver.add(eliminateFunctionCallsInExpression(edge.get().getGuard(), oldModel));
     }
-
+    bool result = solver.check() != storm::solver::SmtSolver::CheckResult::Unsat;
+    solver.pop();
     return result;
 }
 
@@ -535,19 +592,89 @@ Model Model::flattenComposition(std::shared_ptr<storm::utility::solver::SmtSolve
         solver->add(variable.getRangeExpression());
     }
 
-    // Perform all necessary synchronizations and keep track which action indices participate in synchronization.
+    // Over-approximate the guards of all edges and the variable bounds by boxes. Combinations of edges whose boxes are disjoint can not be enabled
+    // together. If all involved boxes are exact, the combination can be enabled. Only the remaining combinations need to be checked by the solver.
+    // Guards with function calls or arrays are not analyzed, so that all combinations are checked by the solver.
+    auto constantsSubstitution = getConstantsSubstitution();
+    bool const analyzeGuards = !this->getModelFeatures().hasFunctions() && !this->getModelFeatures().hasArrays();
+    GuardBox variableBoundsBox;
+    variableBoundsBox.exact = analyzeGuards;
+    for (auto const& variable : newAutomaton.getVariables().getBoundedIntegerVariables()) {
+        if (auto range = variable.getRangeExpression(); analyzeGuards && range.isInitialized()) {
+            restrictGuardBox(substituteJaniExpression(range, constantsSubstitution), variableBoundsBox);
+        }
+    }
+    std::vector<std::vector<GuardBox>> guardBoxes;
+    for (auto const& automaton : composedAutomata) {
+        guardBoxes.emplace_back(automaton.get().getEdges().size());
+        for (uint64_t edgeIndex = 0; analyzeGuards && edgeIndex < guardBoxes.back().size(); ++edgeIndex) {
+            restrictGuardBox(substituteJaniExpression(automaton.get().getEdges()[edgeIndex].getGuard(), constantsSubstitution), guardBoxes.back()[edgeIndex]);
+        }
+    }
+
+    // Gather the candidate edges of all necessary synchronizations and keep track which action indices participate in synchronization.
     std::vector<std::set<uint64_t>> synchronizingActionIndices(composedAutomata.size());
-    std::vector<ConditionalMetaEdge> conditionalMetaEdges;
+    std::vector<SynchronizationCandidates> allCandidates;
     for (auto const& vector : parallelComposition.getSynchronizationVectors()) {
         // If less then 2 automata participate, there is no need to perform a synchronization.
         if (vector.getNumberOfActionInputs() <= 1) {
             continue;
         }
+        if (auto candidates = getSynchronizationCandidates(*this, flattenedModel, synchronizingActionIndices, vector, composedAutomata)) {
+            allCandidates.push_back(std::move(*candidates));
+        }
+    }
+    auto getEdgeBoxes = [&guardBoxes](SynchronizationCandidates const& candidates) {
+        std::vector<std::vector<GuardBox const*>> edgeBoxes;
+        for (uint64_t i = 0; i < candidates.components.size(); ++i) {
+            edgeBoxes.emplace_back();
+            for (auto const edgeIndex : candidates.edgeIndices[i]) {
+                edgeBoxes.back().push_back(&guardBoxes[candidates.components[i]][edgeIndex]);
+            }
+        }
+        return edgeBoxes;
+    };
 
-        // Create all conditional template edges corresponding to this synchronization vector.
-        std::vector<ConditionalMetaEdge> newConditionalMetaEdges =
-            createSynchronizingMetaEdges(*this, flattenedModel, newAutomaton, synchronizingActionIndices, vector, composedAutomata, *solver);
-        conditionalMetaEdges.insert(conditionalMetaEdges.end(), newConditionalMetaEdges.begin(), newConditionalMetaEdges.end());
+    // Create the conditional meta edges for all combinations of edges that can be enabled together.
+    std::vector<ConditionalMetaEdge> conditionalMetaEdges;
+    auto addSynchronizingMetaEdge = [&](SynchronizationCandidates const& candidates, std::vector<uint64_t> const& combination, bool satisfiable) {
+        std::vector<std::reference_wrapper<Edge const>> chosenEdges;
+        for (uint64_t i = 0; i < candidates.components.size(); ++i) {
+            chosenEdges.emplace_back(composedAutomata[candidates.components[i]].get().getEdges()[candidates.edgeIndices[i][combination[i]]]);
+        }
+        if (satisfiable || isPossiblySatisfiable(*this, chosenEdges, *solver)) {
+            // Get a basic conditional meta edge that represents the synchronization of the provided edges and add the missing information.
+            conditionalMetaEdges.push_back(createSynchronizedMetaEdge(newAutomaton, chosenEdges));
+            conditionalMetaEdges.back().components = candidates.components;
+            conditionalMetaEdges.back().actionIndex = candidates.resultingActionIndex;
+        }
+    };
+    bool combinationsProcessed = false;
+#ifdef STORM_HAVE_INTELTBB
+    if (allCandidates.size() > 1) {
+        // Enumerating the combinations only involves the boxes, so it can be done for all synchronization vectors in parallel.
+        std::vector<std::vector<std::pair<std::vector<uint64_t>, bool>>> combinations(allCandidates.size());
+        tbb::parallel_for(tbb::blocked_range<uint64_t>(0, allCandidates.size(), 1), [&](tbb::blocked_range<uint64_t> const& range) {
+            for (auto i = range.begin(); i < range.end(); ++i) {
+                std::vector<uint64_t> combination(allCandidates[i].components.size());
+                forEachPossibleEdgeCombination(getEdgeBoxes(allCandidates[i]), 0, variableBoundsBox, combination,
+                                               [&](std::vector<uint64_t> const& c, bool satisfiable) { combinations[i].emplace_back(c, satisfiable); });
+            }
+        });
+        for (uint64_t i = 0; i < allCandidates.size(); ++i) {
+            for (auto const& [combination, satisfiable] : combinations[i]) {
+                addSynchronizingMetaEdge(allCandidates[i], combination, satisfiable);
+            }
+        }
+        combinationsProcessed = true;
+    }
+#endif
+    if (!combinationsProcessed) {
+        for (auto const& candidates : allCandidates) {
+            std::vector<uint64_t> combination(candidates.components.size());
+            forEachPossibleEdgeCombination(getEdgeBoxes(candidates), 0, variableBoundsBox, combination,
+                                           [&](std::vector<uint64_t> const& c, bool satisfiable) { addSynchronizingMetaEdge(candidates, c, satisfiable); });
+        }
     }
 
     // Now add all edges with action indices that were not mentioned in synchronization vectors.
@@ -1484,6 +1611,11 @@ bool Model::undefinedConstantsAreGraphPreserving() const {
             undefinedConstantVariables.insert(constant.getExpressionVariable());
         }
     }
+    return constantsAreGraphPreserving(undefinedConstantVariables);
+}
+
+bool Model::constantsAreGraphPreserving(std::set<storm::expressions::Variable> const& constants) const {
+    std::set<storm::expressions::Variable> undefinedConstantVariables = constants;
 
     // Start by checking the defining expressions of all defined constants. If it contains a currently undefined
     // constant, we need to mark the target constant as undefined as well.
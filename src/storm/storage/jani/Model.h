@@ -585,6 +585,13 @@ class Model {
      */
     bool undefinedConstantsAreGraphPreserving() const;
 
+    /*!
+     * Checks that the given constants preserve the graph of the underlying model, i.e., assigning different values to them only changes the
+     * probabilities and the values of transient assignments. Defined constants whose defining expression refers to one of the given constants are
+     * considered as well.
+     */
+    bool constantsAreGraphPreserving(std::set<storm::expressions::Variable> const& constants) const;
+
     /*!
      * Lifts the common edge destination assignments of transient variables to edge assignments.
      * @param maxLevel the maximum level of assignments that are to be lifted.
@@ -1,5 +1,6 @@
 #include "AutomaticAction.h"
 
+#include <algorithm>
 #include <boost/graph/strong_components.hpp>
 #include "EliminateAutomaticallyAction.h"
 #include "RebuildWithoutUnreachableAction.h"
@@ -73,6 +74,7 @@ void AutomaticAction::processAutomaton(JaniLocalEliminator::Session &session, co
 
         RebuildWithoutUnreachableAction rebuildAfterUnfoldingAction;
         rebuildAfterUnfoldingAction.doAction(session);
+        uint64_t locationsAfterUnfolding = session.getModel().getAutomaton(autName).getNumberOfLocations();
 
         EliminateAutomaticallyAction eliminateAction(autName, EliminateAutomaticallyAction::EliminationOrder::NewTransitionCount, newTransitionLimit,
                                                      !isOnlyAutomaton);
@@ -80,6 +82,13 @@ void AutomaticAction::processAutomaton(JaniLocalEliminator::Session &session, co
 
         RebuildWithoutUnreachableAction rebuildAfterEliminationAction;
         rebuildAfterEliminationAction.doAction(session);
+
+        // If no location could be eliminated, further unfolding only adds locations and edges that the builder has to process as well, so the
+        // preprocessing would not pay off.
+        if (session.getModel().getAutomaton(autName).getNumberOfLocations() >= locationsAfterUnfolding) {
+            STORM_LOG_TRACE("No location could be eliminated after unfolding, stopping.");
+            break;
+        }
     }
 }
 
@@ -112,8 +121,8 @@ void AutomaticAction::unfoldGroupAndDependencies(JaniLocalEliminator::Session &s
 
 std::map<std::string, double> AutomaticAction::getAssignmentCountByVariable(JaniLocalEliminator::Session &session, std::string const &automatonName) {
     std::map<std::string, double> res;
-    auto automaton = session.getModel().getAutomaton(automatonName);
-    for (auto edge : automaton.getEdges()) {
+    auto const &automaton = session.getModel().getAutomaton(automatonName);
+    for (auto const &edge : automaton.getEdges()) {
         size_t numDest = edge.getNumberOfDestinations();
 
         // The factor is used to ensure all edges contribute equally. Otherwise, a single edge with hundreds of destinations may skew the scores
@@ -145,8 +154,14 @@ boost::optional<uint32_t> AutomaticAction::chooseNextUnfold(JaniLocalEliminator:
 
     std::set<uint32_t> groupsWithoutDependencies = dependencyGraph.getGroupsWithNoDependencies();
 
+    // Unfolding a group multiplies the number of edges by (at most) its domain size. Candidates are ordered by their number of occurrences and, for
+    // equally many occurrences, by this estimated growth. Unfolds that would leave more edges than can be eliminated within the limits are skipped.
+    uint64_t numberOfEdges = session.getModel().getAutomaton(automatonName).getNumberOfEdges();
+    uint64_t edgeBudget = std::max(numberOfEdges, locationLimit * newTransitionLimit);
+
     STORM_LOG_TRACE("\tAnalysing groups without dependencies:");
-    uint32_t bestValue = 0;
+    double bestValue = 0;
+    uint64_t bestEstimatedEdges = 0;
     uint32_t bestGroup = 0;
     for (auto groupIndex : groupsWithoutDependencies) {
         bool containsPropertyVariable = false;
@@ -165,14 +180,17 @@ boost::optional<uint32_t> AutomaticAction::chooseNextUnfold(JaniLocalEliminator:
         if (onlyPropertyVariables && !containsPropertyVariable) {
             continue;
         }
-        STORM_LOG_TRACE("\t\t{" + group.getVariablesAsString() + "}: " + std::to_string(totalOccurrences) + " occurrences");
-        if (dependencyGraph.variableGroups[groupIndex].domainSize < maxDomainSize) {
-            if (totalOccurrences > bestValue) {
-                bestValue = totalOccurrences;
-                bestGroup = groupIndex;
-            }
-        } else {
+        uint64_t estimatedEdges = numberOfEdges * group.domainSize;
+        STORM_LOG_TRACE("\t\t{" + group.getVariablesAsString() + "}: " + std::to_string(totalOccurrences) + " occurrences, about " +
+                        std::to_string(estimatedEdges) + " edges after unfolding");
+        if (group.domainSize >= maxDomainSize) {
             STORM_LOG_TRACE("\t\t\tSkipped (domain size too large)");
+        } else if (estimatedEdges > edgeBudget) {
+            STORM_LOG_TRACE("\t\t\tSkipped (too many edges after unfolding)");
+        } else if (totalOccurrences > bestValue || (totalOccurrences == bestValue && estimatedEdges < bestEstimatedEdges)) {
+            bestValue = totalOccurrences;
+            bestEstimatedEdges = estimatedEdges;
+            bestGroup = groupIndex;
         }
     }
 
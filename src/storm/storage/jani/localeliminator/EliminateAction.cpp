@@ -1,6 +1,7 @@
 #include "EliminateAction.h"
 #include <boost/format.hpp>
 #include <boost/graph/adjacency_list.hpp>
+#include <iterator>
 #include "storm/exceptions/NotImplementedException.h"
 #include "storm/storage/expressions/ExpressionManager.h"
 
@@ -22,70 +23,69 @@ void EliminateAction::doAction(JaniLocalEliminator::Session& session) {
     Automaton& automaton = session.getModel().getAutomaton(automatonName);
     uint64_t locIndex = automaton.getLocationIndex(locationName);
 
-    // The basic idea is to iterate over the edges and eliminate those that are incident to the location.
-    // There are a few complications:
-    // - When we modify the edges, the edge container is rebuilt and we have to call automaton.getEdges()
-    //   again instead of continuing with the current list of edges.
-    // - Edges are ordered according to the index of the outgoing location. This means that if we add a new
-    //   edge, that doesn't append it to the end of the edge list, but inserts it somewhere into the list.
-    // - We only remove one destination per step. If an edge has two destinations leading to the location we
-    //   want to eliminate, we eliminate one, add a new edge and then later visit the new edge to eliminate
-    //   the other destination. This means that a single pass is not sufficient to perform elimination.
-    // The basic idea is therefore to iterate over the edges until we've completed a full iteration without
-    // performing any eliminations.
-
-    uint64_t edgeIndex = 0;
-    uint64_t stepsWithoutChange = 0;
-    std::vector<Edge>& edges = automaton.getEdges();
-    while (stepsWithoutChange <= edges.size()) {
-        Edge edge = edges[edgeIndex];
-
-        if (edge.getGuard().containsVariables() || edge.getGuard().evaluateAsBool()) {
-            uint64_t destCount = edge.getNumberOfDestinations();
-            for (uint64_t j = 0; j < destCount; j++) {
-                const EdgeDestination& dest = edge.getDestination(j);
-                if (dest.getLocationIndex() == locIndex) {
-                    detail::Edges outgoingEdges = automaton.getEdgesFromLocation(locationName);
-                    eliminateDestination(session, automaton, edges[edgeIndex], j, outgoingEdges);
-                    // eliminateDestination adds new edges to the edge container, so we need to get the
-                    // new list of edges:
-                    edges = automaton.getEdges();
-                    stepsWithoutChange = 0;
-                    break;
-                }
+    // Every enabled edge with a destination leading to the location is replaced by one new edge per outgoing edge of the location. If an edge has
+    // several such destinations, only one of them is eliminated per step, and the resulting edges are processed again. The incoming edges are
+    // disabled by setting their guards to false, and all new edges are added at once in the end, such that the edge container is only rebuilt once.
+    auto isEnabled = [](Edge const& edge) { return edge.getGuard().containsVariables() || edge.getGuard().evaluateAsBool(); };
+    auto findIncomingDestination = [locIndex](Edge const& edge) -> uint64_t {
+        for (uint64_t j = 0; j < edge.getNumberOfDestinations(); ++j) {
+            if (edge.getDestination(j).getLocationIndex() == locIndex) {
+                return j;
             }
         }
+        return edge.getNumberOfDestinations();
+    };
 
-        edgeIndex++;
-        stepsWithoutChange++;
-        if (edgeIndex >= edges.size()) {
-            edgeIndex -= edges.size();
+    detail::ConstEdges outgoingEdges = static_cast<Automaton const&>(automaton).getEdgesFromLocation(locIndex);
+    std::vector<Edge> newEdges;
+    std::vector<Edge> pendingEdges;
+    std::vector<Edge> expandedEdges;
+    for (Edge& edge : automaton.getEdges()) {
+        if (!isEnabled(edge)) {
+            continue;
+        }
+        uint64_t destIndex = findIncomingDestination(edge);
+        if (destIndex == edge.getNumberOfDestinations()) {
+            continue;
+        }
+
+        eliminateDestination(session, edge, destIndex, outgoingEdges, pendingEdges);
+        edge.setGuard(edge.getGuard().getManager().boolean(false));  // Instead of deleting the edge
+
+        while (!pendingEdges.empty()) {
+            Edge pendingEdge = std::move(pendingEdges.back());
+            pendingEdges.pop_back();
+            if (!isEnabled(pendingEdge)) {
+                continue;
+            }
+            destIndex = findIncomingDestination(pendingEdge);
+            if (destIndex == pendingEdge.getNumberOfDestinations()) {
+                newEdges.push_back(std::move(pendingEdge));
+            } else {
+                eliminateDestination(session, pendingEdge, destIndex, outgoingEdges, expandedEdges);
+                std::move(expandedEdges.begin(), expandedEdges.end(), std::back_inserter(pendingEdges));
+                expandedEdges.clear();
+            }
         }
     }
+    automaton.addEdges(newEdges);
 
     // The elimination is now complete. To make sure nothing went wrong, we go over all the edges one more
     // time. If any are still incident to the location we want to eliminate, something went wrong.
-    for (Edge& edge : automaton.getEdges()) {
-        if (!edge.getGuard().containsVariables() && !edge.getGuard().evaluateAsBool())
-            continue;
-        for (const EdgeDestination& dest : edge.getDestinations()) {
-            if (dest.getLocationIndex() == locIndex) {
-                STORM_LOG_THROW(false, storm::exceptions::IllegalArgumentException, "Could not eliminate location");
-            }
+    for (Edge const& edge : automaton.getEdges()) {
+        if (isEnabled(edge) && findIncomingDestination(edge) != edge.getNumberOfDestinations()) {
+            STORM_LOG_THROW(false, storm::exceptions::IllegalArgumentException, "Could not eliminate location");
         }
     }
 }
 
-void EliminateAction::eliminateDestination(JaniLocalEliminator::Session& session, Automaton& automaton, Edge& edge, const uint64_t destIndex,
-                                           detail::Edges& outgoing) {
+void EliminateAction::eliminateDestination(JaniLocalEliminator::Session& session, Edge const& edge, const uint64_t destIndex,
+                                           detail::ConstEdges const& outgoing, std::vector<Edge>& newEdges) {
     uint64_t sourceIndex = edge.getSourceLocationIndex();
     uint64_t actionIndex = edge.getActionIndex();
-    EdgeDestination dest = edge.getDestination(destIndex);
+    EdgeDestination const& dest = edge.getDestination(destIndex);
 
-    std::vector<Edge>
-        newEdges;  // Don't add the new edges immediately -- we cannot safely iterate over the outgoing edges while adding new edges to the structure
-
-    for (Edge& outEdge : outgoing) {
+    for (Edge const& outEdge : outgoing) {
         if (!outEdge.getGuard().containsVariables() && !outEdge.getGuard().evaluateAsBool())
             continue;
 
@@ -115,13 +115,7 @@ void EliminateAction::eliminateDestination(JaniLocalEliminator::Session& session
         }
 
         STORM_LOG_THROW(!edge.hasRate() && !outEdge.hasRate(), storm::exceptions::NotImplementedException, "Edge Rates are not implemented");
-        newEdges.emplace_back(Edge(sourceIndex, actionIndex, boost::none, templateEdge, destinationLocationsAndProbabilities));
-    }
-
-    edge.setGuard(edge.getGuard().getManager().boolean(false));  // Instead of deleting the edge
-
-    for (const Edge& newEdge : newEdges) {
-        automaton.addEdge(newEdge);
+        newEdges.emplace_back(sourceIndex, actionIndex, boost::none, templateEdge, destinationLocationsAndProbabilities);
     }
 }
 }  // namespace elimination_actions
@@ -5,7 +5,7 @@
 // EliminateAction removes the given location from the model. For this, the location must not be initial, satisfy the property, or have a loop. This action
 // assumes that these properties already hold.
 // Since it is not cheap to delete edges, their guards are instead only set to false. It is recommended to execute a RebuildWithoutUnreachableAction after
-// eliminating locations to actually remove edges and the now-unreachable locations.
+// eliminating locations to actually remove edges and the now-unreachable locations. All new edges are collected first and then added in a single step.
 
 namespace storm {
 namespace jani {
@@ -18,7 +18,8 @@ class EliminateAction : public JaniLocalEliminator::Action {
     void doAction(JaniLocalEliminator::Session &session) override;
 
    private:
-    void eliminateDestination(JaniLocalEliminator::Session &session, Automaton &automaton, Edge &edge, uint64_t destIndex, detail::Edges &outgoing);
+    void eliminateDestination(JaniLocalEliminator::Session &session, Edge const &edge, uint64_t destIndex, detail::ConstEdges const &outgoing,
+                              std::vector<Edge> &newEdges);
 
     std::string automatonName;
     std::string locationName;
@@ -1,6 +1,9 @@
 #include "EliminateAutomaticallyAction.h"
 #include "EliminateAction.h"
 
+#include <algorithm>
+#include <limits>
+
 #include "storm/exceptions/NotImplementedException.h"
 
 namespace storm {
@@ -76,30 +79,49 @@ void EliminateAutomaticallyAction::doAction(JaniLocalEliminator::Session& sessio
 
             bool done = false;
             while (!done) {
-                uint64_t minNewEdges = 18446744073709551615U;  // max value of uint64
+                // Estimate the number of new transitions for all locations in a single pass over the edges. Disabled edges are skipped, as they are
+                // not expanded by an elimination.
+                uint64_t const cap = static_cast<uint64_t>(transitionCountThreshold) + 1;
+                auto cappedProduct = [cap](uint64_t first, uint64_t second) {
+                    return (first != 0 && second > cap / first) ? cap : std::min(cap, first * second);
+                };
+                std::vector<uint64_t> outgoing(automaton->getNumberOfLocations(), 0);
+                std::vector<uint64_t> incoming(automaton->getNumberOfLocations(), 0);
+                auto isEnabled = [](Edge const& edge) { return edge.getGuard().containsVariables() || edge.getGuard().evaluateAsBool(); };
+                for (const auto& edge : automaton->getEdges()) {
+                    if (isEnabled(edge)) {
+                        ++outgoing[edge.getSourceLocationIndex()];
+                    }
+                }
+                std::map<uint64_t, uint64_t> addedTransitions;
+                for (const auto& edge : automaton->getEdges()) {
+                    if (!isEnabled(edge)) {
+                        continue;
+                    }
+                    addedTransitions.clear();
+                    for (const auto& dest : edge.getDestinations()) {
+                        uint64_t locIndex = dest.getLocationIndex();
+                        if (outgoing[locIndex] == 0) {
+                            continue;
+                        }
+                        auto insertionRes = addedTransitions.emplace(locIndex, 1);
+                        // Stop once we hit the threshold -- otherwise there is a risk of causing
+                        // an overflow due to the exponential growth of the added transitions:
+                        insertionRes.first->second = cappedProduct(insertionRes.first->second, outgoing[locIndex]);
+                    }
+                    for (auto const& locAndTransitions : addedTransitions) {
+                        incoming[locAndTransitions.first] = std::min(cap, incoming[locAndTransitions.first] + locAndTransitions.second - 1);
+                    }
+                }
+
+                uint64_t minNewEdges = std::numeric_limits<uint64_t>::max();
                 int bestLocIndex = -1;
                 for (const auto& loc : automaton->getLocations()) {
                     if (uneliminable[loc.getName()])
                         continue;
 
                     auto locIndex = automaton->getLocationIndex(loc.getName());
-                    uint64_t outgoing = automaton->getEdgesFromLocation(locIndex).size();
-                    uint64_t incoming = 0;
-                    for (const auto& edge : automaton->getEdges()) {
-                        uint64_t addedTransitions = 1;
-                        for (const auto& dest : edge.getDestinations()) {
-                            if (dest.getLocationIndex() == locIndex) {
-                                addedTransitions *= outgoing;
-                                // Stop once we hit the threshold -- otherwise there is a risk of causing
-                                // an overflow due to the exponential growth of addedTransitions:
-                                if (addedTransitions > transitionCountThreshold) {
-                                    break;
-                                }
-                            }
-                        }
-                        incoming += addedTransitions - 1;
-                    }
-                    uint64_t newEdges = incoming * outgoing;
+                    uint64_t newEdges = cappedProduct(incoming[locIndex], outgoing[locIndex]);
 
                     if (newEdges <= minNewEdges) {
                         minNewEdges = newEdges;
@@ -805,17 +805,23 @@ void JsonExporter::toFile(storm::jani::Model const& janiModel, std::vector<storm
 
 void JsonExporter::toStream(storm::jani::Model const& janiModel, std::vector<storm::jani::Property> const& formulas, std::ostream& os, bool checkValid,
                             bool compact) {
+    ExportJsonType json = toJson(janiModel, formulas, checkValid, !compact);
+    STORM_LOG_INFO("Producing json output... " << janiModel.getName() << ".");
+    os << storm::dumpJson(json, compact) << '\n';
+    STORM_LOG_INFO("Conversion completed " << janiModel.getName() << ".");
+}
+
+ExportJsonType JsonExporter::toJson(storm::jani::Model const& janiModel, std::vector<storm::jani::Property> const& formulas, bool checkValid,
+                                    bool commentExpressions) {
     if (checkValid) {
         janiModel.checkValid();
     }
     JsonExporter exporter;
     STORM_LOG_INFO("Started to convert model " << janiModel.getName() << ".");
-    exporter.convertModel(janiModel, !compact);
+    exporter.convertModel(janiModel, commentExpressions);
     STORM_LOG_INFO("Started to convert properties of model " << janiModel.getName() << ".");
     exporter.convertProperties(formulas, janiModel);
-    STORM_LOG_INFO("Producing json output... " << janiModel.getName() << ".");
-    os << storm::dumpJson(exporter.finalize(), compact) << '\n';
-    STORM_LOG_INFO("Conversion completed " << janiModel.getName() << ".");
+    return exporter.finalize();
 }
 
 ExportJsonType buildActionArray(std::vector<storm::jani::Action> const& actions) {
@@ -1153,8 +1159,15 @@ void JsonExporter::convertModel(storm::jani::Model const& janiModel, bool commen
 
 ExportJsonType JsonExporter::getEdgeAsJson(storm::jani::Model const& janiModel, uint64_t automatonIndex, uint64_t edgeIndex, bool commentExpressions) {
     auto const& automaton = janiModel.getAutomaton(automatonIndex);
-    return buildEdge(automaton.getEdge(edgeIndex), janiModel.getActionIndexToNameMap(), automaton.buildIdToLocationNameMap(), janiModel.getConstants(),
-                     janiModel.getGlobalVariables(), automaton.getVariables(), commentExpressions);
+    return getEdgeAsJson(janiModel, automatonIndex, automaton.getEdge(edgeIndex), janiModel.getActionIndexToNameMap(), automaton.buildIdToLocationNameMap(),
+                         commentExpressions);
+}
+
+ExportJsonType JsonExporter::getEdgeAsJson(storm::jani::Model const& janiModel, uint64_t automatonIndex, storm::jani::Edge const& edge,
+                                           std::map<uint64_t, std::string> const& actionNames, std::map<uint64_t, std::string> const& locationNames,
+                                           bool commentExpressions) {
+    return buildEdge(edge, actionNames, locationNames, janiModel.getConstants(), janiModel.getGlobalVariables(),
+                     janiModel.getAutomaton(automatonIndex).getVariables(), commentExpressions);
 }
 
 std::string janiFilterTypeString(storm::modelchecker::FilterType const& ft) {
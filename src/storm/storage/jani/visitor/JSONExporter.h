@@ -96,8 +96,17 @@ class JsonExporter {
                        bool checkValid = true, bool compact = false);
     static void toStream(storm::jani::Model const& janiModel, std::vector<storm::jani::Property> const& formulas, std::ostream& ostream,
                          bool checkValid = false, bool compact = false);
+    static ExportJsonType toJson(storm::jani::Model const& janiModel, std::vector<storm::jani::Property> const& formulas, bool checkValid = false,
+                                 bool commentExpressions = true);
 
     static ExportJsonType getEdgeAsJson(storm::jani::Model const& janiModel, uint64_t automatonIndex, uint64_t edgeIndex, bool commentExpressions = true);
+    /*!
+     * Translates an edge that does not need to be part of the given automaton, e.g., to write it out without storing it in the model.
+     * The action and location names are passed explicitly so that they need not be rebuilt for every edge.
+     */
+    static ExportJsonType getEdgeAsJson(storm::jani::Model const& janiModel, uint64_t automatonIndex, storm::jani::Edge const& edge,
+                                        std::map<uint64_t, std::string> const& actionNames, std::map<uint64_t, std::string> const& locationNames,
+                                        bool commentExpressions = true);
 
    private:
     void convertModel(storm::jani::Model const& model, bool commentExpressions = true);
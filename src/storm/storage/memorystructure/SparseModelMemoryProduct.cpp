@@ -15,6 +15,7 @@
 #include "storm/utility/macros.h"
 
 #include "storm/exceptions/InvalidOperationException.h"
+#include "storm/exceptions/NotSupportedException.h"
 
 namespace storm {
 namespace storage {
@@ -44,8 +45,9 @@ template<typename ValueType, typename RewardModelType>
 void SparseModelMemoryProduct<ValueType, RewardModelType>::initialize() {
     if (!isInitialized) {
         uint64_t modelStateCount = model.getNumberOfStates();
-
-        computeMemorySuccessors();
+        STORM_LOG_THROW(memoryStateCount < std::numeric_limits<uint32_t>::max(), storm::exceptions::NotSupportedException,
+                        "The memory structure has too many states.");
+        memorySuccessors.resize(memoryStateCount);
 
         // Get the initial states and reachable states. A stateIndex s corresponds to the model state (s / memoryStateCount) and memory state (s %
         // memoryStateCount)
@@ -68,8 +70,10 @@ void SparseModelMemoryProduct<ValueType, RewardModelType>::initialize() {
         computeReachableStates(initialStates);
 
         // Compute the mapping to the states of the result
+        STORM_LOG_THROW(reachableStates.getNumberOfSetBits() < std::numeric_limits<uint32_t>::max(), storm::exceptions::NotSupportedException,
+                        "The product of model and memory structure has too many states.");
         uint64_t reachableStateCount = 0;
-        toResultStateMapping = std::vector<uint64_t>(model.getNumberOfStates() * memoryStateCount, std::numeric_limits<uint64_t>::max());
+        toResultStateMapping = std::vector<uint32_t>(model.getNumberOfStates() * memoryStateCount, std::numeric_limits<uint32_t>::max());
         for (auto reachableState : reachableStates) {
             toResultStateMapping[reachableState] = reachableStateCount;
             ++reachableStateCount;
@@ -99,10 +103,8 @@ std::shared_ptr<storm::models::sparse::Model<ValueType, RewardModelType>> Sparse
     storm::storage::SparseMatrix<ValueType> transitionMatrix;
     if (scheduler) {
         transitionMatrix = buildTransitionMatrixForScheduler();
-    } else if (model.getTransitionMatrix().hasTrivialRowGrouping()) {
-        transitionMatrix = buildDeterministicTransitionMatrix();
     } else {
-        transitionMatrix = buildNondeterministicTransitionMatrix();
+        transitionMatrix = buildTransitionMatrix();
     }
     storm::models::sparse::StateLabeling labeling = buildStateLabeling(transitionMatrix);
     std::unordered_map<std::string, RewardModelType> rewardModels = buildRewardModels(transitionMatrix);
@@ -119,34 +121,43 @@ bool SparseModelMemoryProduct<ValueType, RewardModelType>::isStateReachable(uint
 }
 
 template<typename ValueType, typename RewardModelType>
-uint64_t const& SparseModelMemoryProduct<ValueType, RewardModelType>::getResultState(uint64_t const& modelState, uint64_t const& memoryState) {
+uint64_t SparseModelMemoryProduct<ValueType, RewardModelType>::getResultState(uint64_t const& modelState, uint64_t const& memoryState) {
     initialize();
     STORM_LOG_ASSERT(isStateReachable(modelState, memoryState), "Tried to get unreachable product state (" << modelState << "," << memoryState << ")");
     return toResultStateMapping[modelState * memoryStateCount + memoryState];
 }
 
 template<typename ValueType, typename RewardModelType>
-void SparseModelMemoryProduct<ValueType, RewardModelType>::computeMemorySuccessors() {
-    uint64_t modelTransitionCount = model.getTransitionMatrix().getEntryCount();
-    memorySuccessors = std::vector<uint64_t>(modelTransitionCount * memoryStateCount, std::numeric_limits<uint64_t>::max());
-
-    for (uint64_t memoryState = 0; memoryState < memoryStateCount; ++memoryState) {
-        for (uint64_t transitionGoal = 0; transitionGoal < memoryStateCount; ++transitionGoal) {
-            auto const& memoryTransition = memory.getTransitionMatrix()[memoryState][transitionGoal];
-            if (memoryTransition) {
-                for (auto modelTransitionIndex : memoryTransition.get()) {
-                    memorySuccessors[modelTransitionIndex * memoryStateCount + memoryState] = transitionGoal;
-                }
+void SparseModelMemoryProduct<ValueType, RewardModelType>::computeMemorySuccessors(uint64_t memoryState) {
+    std::vector<uint32_t>& successors = memorySuccessors[memoryState];
+    if (!successors.empty() || model.getTransitionMatrix().getEntryCount() == 0) {
+        return;
+    }
+    successors.assign(model.getTransitionMatrix().getEntryCount(), std::numeric_limits<uint32_t>::max());
+    for (uint64_t transitionGoal = 0; transitionGoal < memoryStateCount; ++transitionGoal) {
+        auto const& memoryTransition = memory.getTransitionMatrix()[memoryState][transitionGoal];
+        if (memoryTransition) {
+            for (auto modelTransitionIndex : memoryTransition.get()) {
+                successors[modelTransitionIndex] = transitionGoal;
             }
         }
     }
 }
 
+template<typename ValueType, typename RewardModelType>
+uint64_t SparseModelMemoryProduct<ValueType, RewardModelType>::getMemorySuccessor(uint64_t modelTransition, uint64_t memoryState) const {
+    STORM_LOG_ASSERT(modelTransition < memorySuccessors[memoryState].size(), "Memory successors of memory state " << memoryState << " are not available.");
+    return memorySuccessors[memoryState][modelTransition];
+}
+
 template<typename ValueType, typename RewardModelType>
 void SparseModelMemoryProduct<ValueType, RewardModelType>::computeReachableStates(storm::storage::BitVector const& initialStates) {
     // Explore the reachable states via DFS.
     // A state s on the stack corresponds to the model state (s / memoryStateCount) and memory state (s % memoryStateCount)
     reachableStates |= initialStates;
+    for (auto stateIndex : reachableStates) {
+        computeMemorySuccessors(stateIndex % memoryStateCount);
+    }
     if (!reachableStates.full()) {
         std::vector<uint64_t> stack(reachableStates.begin(), reachableStates.end());
         while (!stack.empty()) {
@@ -166,10 +177,11 @@ void SparseModelMemoryProduct<ValueType, RewardModelType>::computeReachableState
                         if (!storm::utility::isZero(modelTransitionIt->getValue())) {
                             uint64_t successorModelState = modelTransitionIt->getColumn();
                             uint64_t modelTransitionId = modelTransitionIt - model.getTransitionMatrix().begin();
-                            uint64_t successorMemoryState = memorySuccessors[modelTransitionId * memoryStateCount + memoryState];
+                            uint64_t successorMemoryState = getMemorySuccessor(modelTransitionId, memoryState);
                             uint64_t successorStateIndex = successorModelState * memoryStateCount + successorMemoryState;
                             if (!reachableStates.get(successorStateIndex)) {
                                 reachableStates.set(successorStateIndex, true);
+                                computeMemorySuccessors(successorMemoryState);
                                 stack.push_back(successorStateIndex);
                             }
                         }
@@ -181,10 +193,11 @@ void SparseModelMemoryProduct<ValueType, RewardModelType>::computeReachableState
                     if (!storm::utility::isZero(modelTransitionIt->getValue())) {
                         uint64_t successorModelState = modelTransitionIt->getColumn();
                         uint64_t modelTransitionId = modelTransitionIt - model.getTransitionMatrix().begin();
-                        uint64_t successorMemoryState = memorySuccessors[modelTransitionId * memoryStateCount + memoryState];
+                        uint64_t successorMemoryState = getMemorySuccessor(modelTransitionId, memoryState);
                         uint64_t successorStateIndex = successorModelState * memoryStateCount + successorMemoryState;
                         if (!reachableStates.get(successorStateIndex)) {
                             reachableStates.set(successorStateIndex, true);
+                            computeMemorySuccessors(successorMemoryState);
                             stack.push_back(successorStateIndex);
                         }
                     }
@@ -195,63 +208,53 @@ void SparseModelMemoryProduct<ValueType, RewardModelType>::computeReachableState
 }
 
 template<typename ValueType, typename RewardModelType>
-storm::storage::SparseMatrix<ValueType> SparseModelMemoryProduct<ValueType, RewardModelType>::buildDeterministicTransitionMatrix() {
-    uint64_t numResStates = reachableStates.getNumberOfSetBits();
-    uint64_t numResTransitions = 0;
-    for (auto stateIndex : reachableStates) {
-        numResTransitions += model.getTransitionMatrix().getRow(stateIndex / memoryStateCount).getNumberOfEntries();
-    }
-
-    storm::storage::SparseMatrixBuilder<ValueType> builder(numResStates, numResStates, numResTransitions, true);
-    uint64_t currentRow = 0;
-    for (auto stateIndex : reachableStates) {
-        uint64_t modelState = stateIndex / memoryStateCount;
-        uint64_t memoryState = stateIndex % memoryStateCount;
-        auto const& modelRow = model.getTransitionMatrix().getRow(modelState);
-        for (auto entryIt = modelRow.begin(); entryIt != modelRow.end(); ++entryIt) {
-            uint64_t transitionId = entryIt - model.getTransitionMatrix().begin();
-            uint64_t successorMemoryState = memorySuccessors[transitionId * memoryStateCount + memoryState];
-            builder.addNextValue(currentRow, getResultState(entryIt->getColumn(), successorMemoryState), entryIt->getValue());
-        }
-        ++currentRow;
-    }
-
-    return builder.build();
-}
-
-template<typename ValueType, typename RewardModelType>
-storm::storage::SparseMatrix<ValueType> SparseModelMemoryProduct<ValueType, RewardModelType>::buildNondeterministicTransitionMatrix() {
+storm::storage::SparseMatrix<ValueType> SparseModelMemoryProduct<ValueType, RewardModelType>::buildTransitionMatrix() {
+    // Each product row copies a row of the model, so the compressed rows can be written directly. As the result states are ordered like the model states,
+    // the entries of each row remain sorted.
+    auto const& modelMatrix = model.getTransitionMatrix();
+    bool const trivialRowGrouping = modelMatrix.hasTrivialRowGrouping();
     uint64_t numResStates = reachableStates.getNumberOfSetBits();
     uint64_t numResChoices = 0;
     uint64_t numResTransitions = 0;
     for (auto stateIndex : reachableStates) {
         uint64_t modelState = stateIndex / memoryStateCount;
-        for (uint64_t modelRow = model.getTransitionMatrix().getRowGroupIndices()[modelState];
-             modelRow < model.getTransitionMatrix().getRowGroupIndices()[modelState + 1]; ++modelRow) {
-            ++numResChoices;
-            numResTransitions += model.getTransitionMatrix().getRow(modelRow).getNumberOfEntries();
-        }
+        numResChoices += modelMatrix.getRowGroupSize(modelState);
+        numResTransitions += modelMatrix.getRowGroupEntryCount(modelState);
     }
 
-    storm::storage::SparseMatrixBuilder<ValueType> builder(numResChoices, numResStates, numResTransitions, true, true, numResStates);
-    uint64_t currentRow = 0;
+    std::vector<uint64_t> rowIndications;
+    rowIndications.reserve(numResChoices + 1);
+    std::vector<storm::storage::MatrixEntry<uint64_t, ValueType>> entries;
+    entries.reserve(numResTransitions);
+    boost::optional<std::vector<uint64_t>> rowGroupIndices;
+    if (!trivialRowGrouping) {
+        rowGroupIndices = std::vector<uint64_t>();
+        rowGroupIndices->reserve(numResStates + 1);
+    }
     for (auto stateIndex : reachableStates) {
         uint64_t modelState = stateIndex / memoryStateCount;
         uint64_t memoryState = stateIndex % memoryStateCount;
-        builder.newRowGroup(currentRow);
-        for (uint64_t modelRowIndex = model.getTransitionMatrix().getRowGroupIndices()[modelState];
-             modelRowIndex < model.getTransitionMatrix().getRowGroupIndices()[modelState + 1]; ++modelRowIndex) {
-            auto const& modelRow = model.getTransitionMatrix().getRow(modelRowIndex);
+        if (!trivialRowGrouping) {
+            rowGroupIndices->push_back(rowIndications.size());
+        }
+        for (uint64_t modelRowIndex = modelMatrix.getRowGroupIndices()[modelState]; modelRowIndex < modelMatrix.getRowGroupIndices()[modelState + 1];
+             ++modelRowIndex) {
+            rowIndications.push_back(entries.size());
+            auto const& modelRow = modelMatrix.getRow(modelRowIndex);
             for (auto entryIt = modelRow.begin(); entryIt != modelRow.end(); ++entryIt) {
-                uint64_t transitionId = entryIt - model.getTransitionMatrix().begin();
-                uint64_t successorMemoryState = memorySuccessors[transitionId * memoryStateCount + memoryState];
-                builder.addNextValue(currentRow, getResultState(entryIt->getColumn(), successorMemoryState), entryIt->getValue());
+                uint64_t transitionId = entryIt - modelMatrix.begin();
+                uint64_t successorMemoryState = getMemorySuccessor(transitionId, memoryState);
+                STORM_LOG_ASSERT(reachableStates.get(entryIt->getColumn() * memoryStateCount + successorMemoryState), "Unexpected unreachable successor.");
+                entries.emplace_back(toResultStateMapping[entryIt->getColumn() * memoryStateCount + successorMemoryState], entryIt->getValue());
             }
-            ++currentRow;
         }
     }
+    rowIndications.push_back(entries.size());
+    if (!trivialRowGrouping) {
+        rowGroupIndices->push_back(rowIndications.size() - 1);
+    }
 
-    return builder.build();
+    return storm::storage::SparseMatrix<ValueType>(numResStates, std::move(rowIndications), std::move(entries), std::move(rowGroupIndices));
 }
 
 template<typename ValueType, typename RewardModelType>
@@ -308,7 +311,7 @@ storm::storage::SparseMatrix<ValueType> SparseModelMemoryProduct<ValueType, Rewa
                 auto const& modelRow = model.getTransitionMatrix().getRow(modelRowIndex);
                 for (auto entryIt = modelRow.begin(); entryIt != modelRow.end(); ++entryIt) {
                     uint64_t transitionId = entryIt - model.getTransitionMatrix().begin();
-                    uint64_t successorMemoryState = memorySuccessors[transitionId * memoryStateCount + memoryState];
+                    uint64_t successorMemoryState = getMemorySuccessor(transitionId, memoryState);
                     builder.addNextValue(currentRow, getResultState(entryIt->getColumn(), successorMemoryState), entryIt->getValue());
                 }
             } else {
@@ -319,7 +322,7 @@ storm::storage::SparseMatrix<ValueType> SparseModelMemoryProduct<ValueType, Rewa
                         auto const& modelRow = model.getTransitionMatrix().getRow(modelRowIndex);
                         for (auto entryIt = modelRow.begin(); entryIt != modelRow.end(); ++entryIt) {
                             uint64_t transitionId = entryIt - model.getTransitionMatrix().begin();
-                            uint64_t successorMemoryState = memorySuccessors[transitionId * memoryStateCount + memoryState];
+                            uint64_t successorMemoryState = getMemorySuccessor(transitionId, memoryState);
                             ValueType transitionValue = choiceIndex.second * entryIt->getValue();
                             auto insertionRes = transitions.insert(std::make_pair(getResultState(entryIt->getColumn(), successorMemoryState), transitionValue));
                             if (!insertionRes.second) {
@@ -339,7 +342,7 @@ storm::storage::SparseMatrix<ValueType> SparseModelMemoryProduct<ValueType, Rewa
                 auto const& modelRow = model.getTransitionMatrix().getRow(modelRowIndex);
                 for (auto entryIt = modelRow.begin(); entryIt != modelRow.end(); ++entryIt) {
                     uint64_t transitionId = entryIt - model.getTransitionMatrix().begin();
-                    uint64_t successorMemoryState = memorySuccessors[transitionId * memoryStateCount + memoryState];
+                    uint64_t successorMemoryState = getMemorySuccessor(transitionId, memoryState);
                     builder.addNextValue(currentRow, getResultState(entryIt->getColumn(), successorMemoryState), entryIt->getValue());
                 }
                 ++currentRow;
@@ -469,7 +472,7 @@ std::unordered_map<std::string, RewardModelType> SparseModelMemoryProduct<ValueT
                                     ++transitionEntryIt;
                                 }
                                 uint64_t transitionId = transitionEntryIt - model.getTransitionMatrix().begin();
-                                uint64_t successorMemoryState = memorySuccessors[transitionId * memoryStateCount + memoryState];
+                                uint64_t successorMemoryState = getMemorySuccessor(transitionId, memoryState);
                                 auto insertionRes =
                                     rewards.insert(std::make_pair(getResultState(rewardEntry.getColumn(), successorMemoryState), rewardEntry.getValue()));
                                 if (!insertionRes.second) {
@@ -493,7 +496,7 @@ std::unordered_map<std::string, RewardModelType> SparseModelMemoryProduct<ValueT
                                     ++transitionEntryIt;
                                 }
                                 uint64_t transitionId = transitionEntryIt - model.getTransitionMatrix().begin();
-                                uint64_t successorMemoryState = memorySuccessors[transitionId * memoryStateCount + memoryState];
+                                uint64_t successorMemoryState = getMemorySuccessor(transitionId, memoryState);
                                 builder.addNextValue(resRowIndex, getResultState(rewardEntry.getColumn(), successorMemoryState), rewardEntry.getValue());
                             }
                         }
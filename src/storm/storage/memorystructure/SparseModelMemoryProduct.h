@@ -44,7 +44,7 @@ class SparseModelMemoryProduct {
 
     // Retrieves the state of the resulting model that represents the given memory and model state.
     // This method should only be called if the given state is reachable.
-    uint64_t const& getResultState(uint64_t const& modelState, uint64_t const& memoryState);
+    uint64_t getResultState(uint64_t const& modelState, uint64_t const& memoryState);
 
     // Invokes the building of the product under the specified scheduler (if given).
     std::shared_ptr<storm::models::sparse::Model<ValueType, RewardModelType>> build();
@@ -56,18 +56,18 @@ class SparseModelMemoryProduct {
     // Initializes auxiliary data for building the product
     void initialize();
 
-    // Computes for each pair of memory state and model transition index the successor memory state
-    // The resulting vector maps (modelTransition * memoryStateCount) + memoryState to the corresponding successor state of the memory structure
-    void computeMemorySuccessors();
+    // Computes for the given memory state and each model transition index the successor memory state (if this has not been done before)
+    void computeMemorySuccessors(uint64_t memoryState);
+
+    // Retrieves the successor memory state when taking the given model transition in the given memory state
+    uint64_t getMemorySuccessor(uint64_t modelTransition, uint64_t memoryState) const;
 
     // Computes the reachable states of the resulting model
     void computeReachableStates(storm::storage::BitVector const& initialStates);
 
     // Methods that build the model components
-    // Matrix for deterministic models
-    storm::storage::SparseMatrix<ValueType> buildDeterministicTransitionMatrix();
-    // Matrix for nondeterministic models
-    storm::storage::SparseMatrix<ValueType> buildNondeterministicTransitionMatrix();
+    // Matrix for models that do not consider a scheduler. The row grouping is trivial iff it is trivial for the model
+    storm::storage::SparseMatrix<ValueType> buildTransitionMatrix();
     // Matrix for models that consider a scheduler
     storm::storage::SparseMatrix<ValueType> buildTransitionMatrixForScheduler();
     // State labeling.
@@ -83,11 +83,12 @@ class SparseModelMemoryProduct {
     // Stores whether this builder has already been initialized.
     bool isInitialized;
 
-    // stores the successor memory states for each transition in the product
-    std::vector<uint64_t> memorySuccessors;
+    // stores for each memory state the successor memory states for each model transition. Only memory states that occur in a reachable state of the
+    // product are considered, the remaining vectors are empty
+    std::vector<std::vector<uint32_t>> memorySuccessors;
 
     // Maps (modelState * memoryStateCount) + memoryState to the state in the result that represents (memoryState,modelState)
-    std::vector<uint64_t> toResultStateMapping;
+    std::vector<uint32_t> toResultStateMapping;
 
     // Indicates which states are considered reachable. (s, m) is reachable if this BitVector is true at (s * memoryStateCount) + m
     storm::storage::BitVector reachableStates;
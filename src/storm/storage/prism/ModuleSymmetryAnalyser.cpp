@@ -0,0 +1,280 @@
+#include "storm/storage/prism/ModuleSymmetryAnalyser.h"
+
+#include <algorithm>
+#include <sstream>
+
+#include <boost/optional.hpp>
+
+#include "storm/storage/expressions/Expressions.h"
+
+#include "storm/storage/prism/Program.h"
+#include "storm/utility/macros.h"
+
+namespace storm {
+namespace prism {
+
+namespace {
+std::map<storm::expressions::Variable, storm::expressions::Expression> toSubstitution(
+    std::map<storm::expressions::Variable, storm::expressions::Variable> const& swap) {
+    std::map<storm::expressions::Variable, storm::expressions::Expression> substitution;
+    for (auto const& variablePair : swap) {
+        substitution.emplace(variablePair.first, variablePair.second.getExpression());
+    }
+    return substitution;
+}
+
+/*!
+ * Retrieves a name for the operator of the given expression if it is associative and commutative.
+ */
+boost::optional<std::string> getAssociativeCommutativeOperator(storm::expressions::BaseExpression const& expression) {
+    if (expression.isBinaryBooleanFunctionExpression()) {
+        switch (expression.asBinaryBooleanFunctionExpression().getOperatorType()) {
+            case storm::expressions::BinaryBooleanFunctionExpression::OperatorType::And:
+                return std::string("&");
+            case storm::expressions::BinaryBooleanFunctionExpression::OperatorType::Or:
+                return std::string("|");
+            default:
+                return boost::none;
+        }
+    } else if (expression.isBinaryNumericalFunctionExpression()) {
+        switch (expression.asBinaryNumericalFunctionExpression().getOperatorType()) {
+            case storm::expressions::BinaryNumericalFunctionExpression::OperatorType::Plus:
+                return std::string("+");
+            case storm::expressions::BinaryNumericalFunctionExpression::OperatorType::Times:
+                return std::string("*");
+            case storm::expressions::BinaryNumericalFunctionExpression::OperatorType::Min:
+                return std::string("min");
+            case storm::expressions::BinaryNumericalFunctionExpression::OperatorType::Max:
+                return std::string("max");
+            default:
+                return boost::none;
+        }
+    }
+    return boost::none;
+}
+
+std::string toNormalizedString(storm::expressions::BaseExpression const& expression);
+
+void gatherNormalizedOperands(storm::expressions::BaseExpression const& expression, std::string const& op, std::vector<std::string>& operands) {
+    auto expressionOperator = getAssociativeCommutativeOperator(expression);
+    if (expressionOperator && expressionOperator.get() == op) {
+        gatherNormalizedOperands(*expression.getOperand(0), op, operands);
+        gatherNormalizedOperands(*expression.getOperand(1), op, operands);
+    } else {
+        operands.push_back(toNormalizedString(expression));
+    }
+}
+
+/*!
+ * Retrieves a string representation of the given expression in which the operands of (nested) associative and commutative operators are
+ * sorted. Hence, expressions that only differ in the order of such operands have the same representation.
+ */
+std::string toNormalizedString(storm::expressions::BaseExpression const& expression) {
+    std::vector<std::string> operands;
+    std::string op;
+    if (auto expressionOperator = getAssociativeCommutativeOperator(expression)) {
+        op = expressionOperator.get();
+        gatherNormalizedOperands(expression, op, operands);
+    } else if (expression.isBinaryRelationExpression() &&
+               (expression.asBinaryRelationExpression().getRelationType() == storm::expressions::RelationType::Equal ||
+                expression.asBinaryRelationExpression().getRelationType() == storm::expressions::RelationType::NotEqual)) {
+        op = expression.asBinaryRelationExpression().getRelationType() == storm::expressions::RelationType::Equal ? "=" : "!=";
+        operands.push_back(toNormalizedString(*expression.getOperand(0)));
+        operands.push_back(toNormalizedString(*expression.getOperand(1)));
+    } else {
+        std::stringstream stream;
+        stream << expression;
+        return stream.str();
+    }
+    std::sort(operands.begin(), operands.end());
+    std::stringstream stream;
+    stream << op << "(";
+    for (auto const& operand : operands) {
+        stream << operand << ";";
+    }
+    stream << ")";
+    return stream.str();
+}
+
+bool isMappedTo(storm::expressions::Expression const& expression, storm::expressions::Expression const& otherExpression,
+                std::map<storm::expressions::Variable, storm::expressions::Expression> const& substitution) {
+    if (expression.isInitialized() != otherExpression.isInitialized()) {
+        return false;
+    }
+    if (!expression.isInitialized()) {
+        return true;
+    }
+    storm::expressions::Expression mappedExpression = expression.substitute(substitution).simplify();
+    storm::expressions::Expression simplifiedOtherExpression = otherExpression.simplify();
+    return mappedExpression.isSyntacticallyEqual(simplifiedOtherExpression) ||
+           toNormalizedString(mappedExpression.getBaseExpression()) == toNormalizedString(simplifiedOtherExpression.getBaseExpression());
+}
+}  // namespace
+
+ModuleSymmetryAnalyser::ModuleSymmetryAnalyser(Program const& program) : program(program) {
+    STORM_LOG_ASSERT(program.getNumberOfFormulas() == 0, "Symmetries can only be detected for programs without formulas.");
+    for (auto const& module : program.getModules()) {
+        std::set<storm::expressions::Variable> variables;
+        for (auto const& command : module.getCommands()) {
+            command.getGuardExpression().gatherVariables(variables);
+            for (auto const& update : command.getUpdates()) {
+                update.getLikelihoodExpression().gatherVariables(variables);
+                for (auto const& assignment : update.getAssignments()) {
+                    variables.insert(assignment.getVariable());
+                    assignment.getExpression().gatherVariables(variables);
+                }
+            }
+        }
+        occurringVariables.push_back(std::move(variables));
+    }
+
+    std::vector<bool> isGrouped(program.getNumberOfModules(), false);
+    for (uint_fast64_t first = 0; first < program.getNumberOfModules(); ++first) {
+        if (isGrouped[first]) {
+            continue;
+        }
+        std::vector<uint_fast64_t> group = {first};
+        for (uint_fast64_t second = first + 1; second < program.getNumberOfModules(); ++second) {
+            if (!isGrouped[second] && areRenamedCopies(first, second) && isSwapInvariant(first, second)) {
+                group.push_back(second);
+                isGrouped[second] = true;
+            }
+        }
+        if (group.size() > 1) {
+            STORM_LOG_INFO("Found " << group.size() << " symmetric copies of module " << program.getModule(first).getName() << ".");
+            symmetricModuleGroups.push_back(std::move(group));
+        }
+    }
+}
+
+std::vector<std::vector<uint_fast64_t>> const& ModuleSymmetryAnalyser::getSymmetricModuleGroups() const {
+    return symmetricModuleGroups;
+}
+
+std::vector<storm::expressions::Variable> ModuleSymmetryAnalyser::getLocalVariables(uint_fast64_t moduleIndex) const {
+    Module const& module = program.getModule(moduleIndex);
+    std::vector<storm::expressions::Variable> result;
+    for (auto const& booleanVariable : module.getBooleanVariables()) {
+        result.push_back(booleanVariable.getExpressionVariable());
+    }
+    for (auto const& integerVariable : module.getIntegerVariables()) {
+        result.push_back(integerVariable.getExpressionVariable());
+    }
+    return result;
+}
+
+bool ModuleSymmetryAnalyser::isSymmetric(storm::expressions::Expression const& expression) const {
+    // The transpositions of the first module with any other module generate all permutations of a group.
+    for (auto const& group : symmetricModuleGroups) {
+        for (uint_fast64_t index = 1; index < group.size(); ++index) {
+            if (!isMappedTo(expression, expression, toSubstitution(getSwap(group.front(), group[index])))) {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+bool ModuleSymmetryAnalyser::areRenamedCopies(uint_fast64_t firstModuleIndex, uint_fast64_t secondModuleIndex) const {
+    Module const& first = program.getModule(firstModuleIndex);
+    Module const& second = program.getModule(secondModuleIndex);
+    if (first.getNumberOfBooleanVariables() != second.getNumberOfBooleanVariables() ||
+        first.getNumberOfIntegerVariables() != second.getNumberOfIntegerVariables() || first.getNumberOfClockVariables() != 0 ||
+        second.getNumberOfClockVariables() != 0 || first.getNumberOfCommands() != second.getNumberOfCommands()) {
+        return false;
+    }
+
+    auto swap = getSwap(firstModuleIndex, secondModuleIndex);
+    auto substitution = toSubstitution(swap);
+    // Note that the expressions of missing initial values or bounds are uninitialized.
+    for (uint_fast64_t index = 0; index < first.getNumberOfBooleanVariables(); ++index) {
+        if (!isMappedTo(first.getBooleanVariables()[index].getInitialValueExpression(), second.getBooleanVariables()[index].getInitialValueExpression(),
+                        substitution)) {
+            return false;
+        }
+    }
+    for (uint_fast64_t index = 0; index < first.getNumberOfIntegerVariables(); ++index) {
+        auto const& firstVariable = first.getIntegerVariables()[index];
+        auto const& secondVariable = second.getIntegerVariables()[index];
+        if (!isMappedTo(firstVariable.getInitialValueExpression(), secondVariable.getInitialValueExpression(), substitution) ||
+            !isMappedTo(firstVariable.getLowerBoundExpression(), secondVariable.getLowerBoundExpression(), substitution) ||
+            !isMappedTo(firstVariable.getUpperBoundExpression(), secondVariable.getUpperBoundExpression(), substitution)) {
+            return false;
+        }
+    }
+    return commandsMatch(first, second, swap);
+}
+
+bool ModuleSymmetryAnalyser::isSwapInvariant(uint_fast64_t firstModuleIndex, uint_fast64_t secondModuleIndex) const {
+    auto swap = getSwap(firstModuleIndex, secondModuleIndex);
+    for (uint_fast64_t moduleIndex = 0; moduleIndex < program.getNumberOfModules(); ++moduleIndex) {
+        if (moduleIndex == firstModuleIndex || moduleIndex == secondModuleIndex) {
+            continue;
+        }
+        bool readsSwappedVariable = false;
+        for (auto const& variablePair : swap) {
+            if (occurringVariables[moduleIndex].count(variablePair.first) > 0) {
+                readsSwappedVariable = true;
+                break;
+            }
+        }
+        if (readsSwappedVariable && !commandsMatch(program.getModule(moduleIndex), program.getModule(moduleIndex), swap)) {
+            return false;
+        }
+    }
+    if (program.hasInitialConstruct()) {
+        auto const& initialStatesExpression = program.getInitialStatesExpression();
+        return isMappedTo(initialStatesExpression, initialStatesExpression, toSubstitution(swap));
+    }
+    return true;
+}
+
+bool ModuleSymmetryAnalyser::commandsMatch(Module const& first, Module const& second,
+                                           std::map<storm::expressions::Variable, storm::expressions::Variable> const& swap) const {
+    if (first.getNumberOfCommands() != second.getNumberOfCommands()) {
+        return false;
+    }
+    auto substitution = toSubstitution(swap);
+    for (uint_fast64_t commandIndex = 0; commandIndex < first.getNumberOfCommands(); ++commandIndex) {
+        Command const& firstCommand = first.getCommand(commandIndex);
+        Command const& secondCommand = second.getCommand(commandIndex);
+        if (firstCommand.getActionIndex() != secondCommand.getActionIndex() || firstCommand.isMarkovian() != secondCommand.isMarkovian() ||
+            firstCommand.getNumberOfUpdates() != secondCommand.getNumberOfUpdates() ||
+            !isMappedTo(firstCommand.getGuardExpression(), secondCommand.getGuardExpression(), substitution)) {
+            return false;
+        }
+        for (uint_fast64_t updateIndex = 0; updateIndex < firstCommand.getNumberOfUpdates(); ++updateIndex) {
+            Update const& firstUpdate = firstCommand.getUpdate(updateIndex);
+            Update const& secondUpdate = secondCommand.getUpdate(updateIndex);
+            if (firstUpdate.getNumberOfAssignments() != secondUpdate.getNumberOfAssignments() ||
+                !isMappedTo(firstUpdate.getLikelihoodExpression(), secondUpdate.getLikelihoodExpression(), substitution)) {
+                return false;
+            }
+            auto secondAssignments = secondUpdate.getAsVariableToExpressionMap();
+            for (auto const& assignment : firstUpdate.getAssignments()) {
+                auto swapIt = swap.find(assignment.getVariable());
+                auto secondAssignmentIt = secondAssignments.find(swapIt == swap.end() ? assignment.getVariable() : swapIt->second);
+                if (secondAssignmentIt == secondAssignments.end() || !isMappedTo(assignment.getExpression(), secondAssignmentIt->second, substitution)) {
+                    return false;
+                }
+            }
+        }
+    }
+    return true;
+}
+
+std::map<storm::expressions::Variable, storm::expressions::Variable> ModuleSymmetryAnalyser::getSwap(uint_fast64_t firstModuleIndex,
+                                                                                                     uint_fast64_t secondModuleIndex) const {
+    auto firstVariables = getLocalVariables(firstModuleIndex);
+    auto secondVariables = getLocalVariables(secondModuleIndex);
+    STORM_LOG_ASSERT(firstVariables.size() == secondVariables.size(), "Modules can only be swapped if they have the same number of variables.");
+    std::map<storm::expressions::Variable, storm::expressions::Variable> result;
+    for (uint_fast64_t index = 0; index < firstVariables.size(); ++index) {
+        result.emplace(firstVariables[index], secondVariables[index]);
+        result.emplace(secondVariables[index], firstVariables[index]);
+    }
+    return result;
+}
+
+}  // namespace prism
+}  // namespace storm
@@ -0,0 +1,74 @@
+#pragma once
+
+#include <cstdint>
+#include <map>
+#include <set>
+#include <vector>
+
+#include "storm/storage/expressions/Expression.h"
+#include "storm/storage/expressions/Variable.h"
+
+namespace storm {
+namespace prism {
+class Program;
+class Module;
+
+/*!
+ * Detects symmetries of a PRISM program that stem from replicated modules, i.e., modules that are obtained from one another by renaming
+ * their local variables. A group of such modules is symmetric if swapping the local variables of any two modules of the group leaves the
+ * program unchanged. Hence, permuting the values of the local variables of the modules of a group maps reachable states to reachable states
+ * with the same behaviour.
+ *
+ * The checks are syntactical: they are sound, but a symmetry might be missed if it is only established by semantically equivalent expressions.
+ * The program is expected to not contain any formulas.
+ */
+class ModuleSymmetryAnalyser {
+   public:
+    ModuleSymmetryAnalyser(Program const& program);
+
+    /*!
+     * Retrieves the groups of symmetric modules. Every group contains at least two modules. The local variables of the modules of a group
+     * correspond to one another by the order in which they are declared, see getLocalVariables.
+     */
+    std::vector<std::vector<uint_fast64_t>> const& getSymmetricModuleGroups() const;
+
+    /*!
+     * Retrieves the local variables of the given module: first the boolean and then the integer variables, each in the order of their declaration.
+     */
+    std::vector<storm::expressions::Variable> getLocalVariables(uint_fast64_t moduleIndex) const;
+
+    /*!
+     * Checks whether the given expression is (syntactically) invariant under permutations of the modules within the symmetric groups.
+     */
+    bool isSymmetric(storm::expressions::Expression const& expression) const;
+
+   private:
+    /*!
+     * Checks whether the given modules are copies of one another, i.e., whether swapping their local variables maps one to the other.
+     */
+    bool areRenamedCopies(uint_fast64_t firstModuleIndex, uint_fast64_t secondModuleIndex) const;
+
+    /*!
+     * Checks whether swapping the local variables of the given modules leaves all other modules and the initial states unchanged.
+     */
+    bool isSwapInvariant(uint_fast64_t firstModuleIndex, uint_fast64_t secondModuleIndex) const;
+
+    /*!
+     * Checks whether applying the given swap of variables to the commands of the first module yields the commands of the second module.
+     */
+    bool commandsMatch(Module const& first, Module const& second, std::map<storm::expressions::Variable, storm::expressions::Variable> const& swap) const;
+
+    /*!
+     * Retrieves the mapping that swaps the local variables of the given modules.
+     */
+    std::map<storm::expressions::Variable, storm::expressions::Variable> getSwap(uint_fast64_t firstModuleIndex, uint_fast64_t secondModuleIndex) const;
+
+    Program const& program;
+
+    // For every module, the variables occurring in its commands.
+    std::vector<std::set<storm::expressions::Variable>> occurringVariables;
+
+    std::vector<std::vector<uint_fast64_t>> symmetricModuleGroups;
+};
+}  // namespace prism
+}  // namespace storm
@@ -303,6 +303,11 @@ bool Program::undefinedConstantsAreGraphPreserving() const {
             undefinedConstantVariables.insert(constant.getExpressionVariable());
         }
     }
+    return constantsAreGraphPreserving(undefinedConstantVariables);
+}
+
+bool Program::constantsAreGraphPreserving(std::set<storm::expressions::Variable> const& constants) const {
+    std::set<storm::expressions::Variable> undefinedConstantVariables = constants;
 
     // Start by checking the defining expressions of all defined constants. If it contains a currently undefined
     // constant, we need to mark the target constant as undefined as well.
@@ -313,6 +318,12 @@ bool Program::undefinedConstantsAreGraphPreserving() const {
             }
         }
     }
+    // The same holds for formulas that have not been substituted yet.
+    for (auto const& formula : this->getFormulas()) {
+        if (formula.hasExpressionVariable() && formula.getExpression().containsVariable(undefinedConstantVariables)) {
+            undefinedConstantVariables.insert(formula.getExpressionVariable());
+        }
+    }
 
     // Now check initial value and range expressions of global variables.
     for (auto const& booleanVariable : this->getGlobalBooleanVariables()) {
@@ -120,6 +120,15 @@ class Program : public LocatedInformation {
      */
     bool undefinedConstantsAreGraphPreserving() const;
 
+    /*!
+     * Checks that the given constants preserve the graph of the underlying model, i.e., assigning different values to them only changes the
+     * probabilities and rewards. Defined constants whose defining expression refers to one of the given constants are considered as well.
+     *
+     * @param constants The expression variables of the constants to check.
+     * @return True iff the given constants are graph-preserving.
+     */
+    bool constantsAreGraphPreserving(std::set<storm::expressions::Variable> const& constants) const;
+
     /*!
      * Retrieves the undefined constants in the program.
      *
@@ -556,6 +556,10 @@ std::map<std::string, std::string> const& ToJaniConverter::getRewardModelRenamin
     return rewardModelRenaming;
 }
 
+std::map<storm::expressions::Variable, storm::expressions::Expression> const& ToJaniConverter::getFormulaToFunctionCallMap() const {
+    return formulaToFunctionCallMap;
+}
+
 storm::jani::Property ToJaniConverter::applyRenaming(storm::jani::Property const& property) const {
     storm::jani::Property result;
     bool initialized = false;
@@ -25,6 +25,7 @@ class ToJaniConverter {
     bool rewardModelsWereRenamed() const;
     std::map<std::string, std::string> const& getLabelRenaming() const;
     std::map<std::string, std::string> const& getRewardModelRenaming() const;
+    std::map<storm::expressions::Variable, storm::expressions::Expression> const& getFormulaToFunctionCallMap() const;
 
     storm::jani::Property applyRenaming(storm::jani::Property const& property) const;
     std::vector<storm::jani::Property> applyRenaming(std::vector<storm::jani::Property> const& property) const;
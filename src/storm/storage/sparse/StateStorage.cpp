@@ -5,8 +5,8 @@ namespace storage {
 namespace sparse {
 
 template<typename StateType>
-StateStorage<StateType>::StateStorage(uint64_t bitsPerState)
-    : stateToId(bitsPerState, 100000), initialStateIndices(), deadlockStateIndices(), bitsPerState(bitsPerState) {
+StateStorage<StateType>::StateStorage(uint64_t bitsPerState, boost::optional<std::string> const& storageDirectory)
+    : stateToId(bitsPerState, 100000, 0.75, storageDirectory), initialStateIndices(), deadlockStateIndices(), bitsPerState(bitsPerState) {
     // Intentionally left empty.
 }
 
@@ -15,6 +15,11 @@ uint_fast64_t StateStorage<StateType>::getNumberOfStates() const {
     return stateToId.size();
 }
 
+template<typename StateType>
+uint64_t StateStorage<StateType>::getSizeInMemory() const {
+    return stateToId.getSizeInMemory() + sizeof(StateType) * (initialStateIndices.capacity() + deadlockStateIndices.capacity());
+}
+
 template struct StateStorage<uint32_t>;
 template struct StateStorage<uint_fast64_t>;
 }  // namespace sparse
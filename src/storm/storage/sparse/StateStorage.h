@@ -1,6 +1,9 @@
 #pragma once
 
 #include <cstdint>
+#include <string>
+
+#include <boost/optional.hpp>
 
 #include "storm/storage/BitVectorHashMap.h"
 
@@ -11,8 +14,9 @@ namespace sparse {
 // A structure holding information about the reachable state space while building it.
 template<typename StateType>
 struct StateStorage {
-    // Creates an empty state storage structure for storing states of the given bit width.
-    StateStorage(uint64_t bitsPerState);
+    // Creates an empty state storage structure for storing states of the given bit width. If a directory is given, the states are kept in
+    // memory-mapped files within this directory.
+    StateStorage(uint64_t bitsPerState, boost::optional<std::string> const& storageDirectory = boost::none);
 
     // This member stores all the states and maps them to their unique indices.
     storm::storage::BitVectorHashMap<StateType> stateToId;
@@ -28,6 +32,9 @@ struct StateStorage {
 
     // Get the number of states that were found in the exploration so far.
     uint64_t getNumberOfStates() const;
+
+    // Get (an approximation of) the number of bytes occupied by the stored states in main memory.
+    uint64_t getSizeInMemory() const;
 };
 
 }  // namespace sparse
@@ -1,34 +1,41 @@
 #include "storm/storage/sparse/StateValuations.h"
 
+#include <algorithm>
 #include <boost/algorithm/string/join.hpp>
+#include <cstring>
+#include <ostream>
 
 #include "storm/adapters/JsonAdapter.h"
 
-#include "storm/adapters/RationalNumberForward.h"
+#include "storm/adapters/RationalNumberAdapter.h"
 
 #include "storm/storage/BitVector.h"
 
 #include "storm/exceptions/InvalidTypeException.h"
+#include "storm/exceptions/WrongFormatException.h"
+#include "storm/storage/expressions/ExpressionManager.h"
+#include "storm/utility/constants.h"
 #include "storm/utility/macros.h"
-#include "storm/utility/vector.h"
 
 namespace storm {
 namespace storage {
 namespace sparse {
 
-StateValuations::StateValuation::StateValuation(std::vector<bool>&& booleanValues, std::vector<int64_t>&& integerValues,
-                                                std::vector<storm::RationalNumber>&& rationalValues, std::vector<int64_t>&& observationLabelValues)
-    : booleanValues(std::move(booleanValues)),
-      integerValues(std::move(integerValues)),
-      rationalValues(std::move(rationalValues)),
-      observationLabelValues(std::move(observationLabelValues)) {
-    // Intentionally left empty
+int64_t StateValuations::getPackedValue(storm::storage::sparse::state_type const& stateIndex, PackedColumn const& column) const {
+    if (column.bitWidth == 0) {
+        return column.lowerBound;
+    }
+    uint64_t offset = packedValues.getAsInt(stateIndex * bitsPerState + column.bitOffset, column.bitWidth);
+    return static_cast<int64_t>(static_cast<uint64_t>(column.lowerBound) + offset);
+}
+
+int64_t StateValuations::getLabelValue(storm::storage::sparse::state_type const& stateIndex, uint64_t labelIndex) const {
+    STORM_LOG_ASSERT(labelIndex < labelColumns.size(), "Label index " << labelIndex << " larger than number of labels " << labelColumns.size());
+    return getPackedValue(stateIndex, labelColumns[labelIndex]);
 }
 
-typename StateValuations::StateValuation const& StateValuations::getValuation(storm::storage::sparse::state_type const& stateIndex) const {
-    STORM_LOG_ASSERT(stateIndex < valuations.size(), "Invalid state index.");
-    STORM_LOG_ASSERT(assertValuation(valuations[stateIndex]), "Invalid  state valuations");
-    return valuations[stateIndex];
+uint64_t StateValuations::getNumberOfRationalVariables() const {
+    return numberOfStates == 0 ? 0 : rationalValues.size() / numberOfStates;
 }
 
 StateValuations::StateValueIterator::StateValueIterator(typename std::map<storm::expressions::Variable, uint64_t>::const_iterator variableIt,
@@ -36,14 +43,16 @@ StateValuations::StateValueIterator::StateValueIterator(typename std::map<storm:
                                                         typename std::map<storm::expressions::Variable, uint64_t>::const_iterator variableBegin,
                                                         typename std::map<storm::expressions::Variable, uint64_t>::const_iterator variableEnd,
                                                         typename std::map<std::string, uint64_t>::const_iterator labelBegin,
-                                                        typename std::map<std::string, uint64_t>::const_iterator labelEnd, StateValuation const* valuation)
+                                                        typename std::map<std::string, uint64_t>::const_iterator labelEnd,
+                                                        StateValuations const* valuations, storm::storage::sparse::state_type state)
     : variableIt(variableIt),
       labelIt(labelIt),
       variableBegin(variableBegin),
       variableEnd(variableEnd),
       labelBegin(labelBegin),
       labelEnd(labelEnd),
-      valuation(valuation) {
+      valuations(valuations),
+      state(state) {
     // Intentionally left empty.
 }
 
@@ -83,28 +92,26 @@ std::string const& StateValuations::StateValueIterator::getName() const {
 
 bool StateValuations::StateValueIterator::getBooleanValue() const {
     STORM_LOG_ASSERT(isBoolean(), "Variable has no boolean type.");
-    return valuation->booleanValues[variableIt->second];
+    return valuations->packedValues.get(state * valuations->bitsPerState + variableIt->second);
 }
 
 int64_t StateValuations::StateValueIterator::getIntegerValue() const {
     STORM_LOG_ASSERT(isInteger(), "Variable has no integer type.");
-    return valuation->integerValues[variableIt->second];
+    return valuations->getPackedValue(state, valuations->integerColumns[variableIt->second]);
 }
 
 int64_t StateValuations::StateValueIterator::getLabelValue() const {
     STORM_LOG_ASSERT(isLabelAssignment(), "Not a label assignment");
-    STORM_LOG_ASSERT(labelIt->second < valuation->observationLabelValues.size(),
-                     "Label index " << labelIt->second << " larger than number of labels " << valuation->observationLabelValues.size());
-    return valuation->observationLabelValues[labelIt->second];
+    return valuations->getLabelValue(state, labelIt->second);
 }
 
 storm::RationalNumber StateValuations::StateValueIterator::getRationalValue() const {
     STORM_LOG_ASSERT(isRational(), "Variable has no rational type.");
-    return valuation->rationalValues[variableIt->second];
+    return valuations->rationalValues[state * valuations->getNumberOfRationalVariables() + variableIt->second];
 }
 
 bool StateValuations::StateValueIterator::operator==(StateValueIterator const& other) {
-    STORM_LOG_ASSERT(valuation == valuation, "Comparing iterators for different states");
+    STORM_LOG_ASSERT(valuations == other.valuations && state == other.state, "Comparing iterators for different states");
     return variableIt == other.variableIt && labelIt == other.labelIt;
 }
 bool StateValuations::StateValueIterator::operator!=(StateValueIterator const& other) {
@@ -131,42 +138,43 @@ typename StateValuations::StateValueIterator& StateValuations::StateValueIterato
 }
 
 StateValuations::StateValueIteratorRange::StateValueIteratorRange(std::map<storm::expressions::Variable, uint64_t> const& variableMap,
-                                                                  std::map<std::string, uint64_t> const& labelMap, StateValuation const* valuation)
-    : variableMap(variableMap), labelMap(labelMap), valuation(valuation) {
+                                                                  std::map<std::string, uint64_t> const& labelMap, StateValuations const* valuations,
+                                                                  storm::storage::sparse::state_type state)
+    : variableMap(variableMap), labelMap(labelMap), valuations(valuations), state(state) {
     // Intentionally left empty.
 }
 
 StateValuations::StateValueIterator StateValuations::StateValueIteratorRange::begin() const {
-    return StateValueIterator(variableMap.cbegin(), labelMap.cbegin(), variableMap.cbegin(), variableMap.cend(), labelMap.cbegin(), labelMap.cend(), valuation);
+    return StateValueIterator(variableMap.cbegin(), labelMap.cbegin(), variableMap.cbegin(), variableMap.cend(), labelMap.cbegin(), labelMap.cend(), valuations,
+                              state);
 }
 
 StateValuations::StateValueIterator StateValuations::StateValueIteratorRange::end() const {
-    return StateValueIterator(variableMap.cend(), labelMap.cend(), variableMap.cbegin(), variableMap.cend(), labelMap.cbegin(), labelMap.cend(), valuation);
+    return StateValueIterator(variableMap.cend(), labelMap.cend(), variableMap.cbegin(), variableMap.cend(), labelMap.cbegin(), labelMap.cend(), valuations,
+                              state);
 }
 
 bool StateValuations::getBooleanValue(storm::storage::sparse::state_type const& stateIndex, storm::expressions::Variable const& booleanVariable) const {
-    auto const& valuation = getValuation(stateIndex);
+    STORM_LOG_ASSERT(stateIndex < numberOfStates && statesWithValuation.get(stateIndex), "Invalid state index.");
     STORM_LOG_ASSERT(variableToIndexMap.count(booleanVariable) > 0, "Variable " << booleanVariable.getName() << " is not part of this valuation.");
-    return valuation.booleanValues[variableToIndexMap.at(booleanVariable)];
+    return packedValues.get(stateIndex * bitsPerState + variableToIndexMap.at(booleanVariable));
 }
 
-int64_t const& StateValuations::getIntegerValue(storm::storage::sparse::state_type const& stateIndex,
-                                                storm::expressions::Variable const& integerVariable) const {
-    auto const& valuation = getValuation(stateIndex);
+int64_t StateValuations::getIntegerValue(storm::storage::sparse::state_type const& stateIndex, storm::expressions::Variable const& integerVariable) const {
+    STORM_LOG_ASSERT(stateIndex < numberOfStates && statesWithValuation.get(stateIndex), "Invalid state index.");
     STORM_LOG_ASSERT(variableToIndexMap.count(integerVariable) > 0, "Variable " << integerVariable.getName() << " is not part of this valuation.");
-    return valuation.integerValues[variableToIndexMap.at(integerVariable)];
+    return getPackedValue(stateIndex, integerColumns[variableToIndexMap.at(integerVariable)]);
 }
 
 storm::RationalNumber const& StateValuations::getRationalValue(storm::storage::sparse::state_type const& stateIndex,
                                                                storm::expressions::Variable const& rationalVariable) const {
-    auto const& valuation = getValuation(stateIndex);
+    STORM_LOG_ASSERT(stateIndex < numberOfStates && statesWithValuation.get(stateIndex), "Invalid state index.");
     STORM_LOG_ASSERT(variableToIndexMap.count(rationalVariable) > 0, "Variable " << rationalVariable.getName() << " is not part of this valuation.");
-    return valuation.rationalValues[variableToIndexMap.at(rationalVariable)];
+    return rationalValues[stateIndex * getNumberOfRationalVariables() + variableToIndexMap.at(rationalVariable)];
 }
 
 bool StateValuations::isEmpty(storm::storage::sparse::state_type const& stateIndex) const {
-    auto const& valuation = valuations[stateIndex];  // Do not use getValuations, as that is only valid after adding stuff.
-    return valuation.booleanValues.empty() && valuation.integerValues.empty() && valuation.rationalValues.empty() && valuation.observationLabelValues.empty();
+    return stateIndex >= numberOfStates || !statesWithValuation.get(stateIndex);
 }
 
 std::string StateValuations::toString(storm::storage::sparse::state_type const& stateIndex, bool pretty,
@@ -257,43 +265,6 @@ storm::json<JsonRationalType> StateValuations::toJson(storm::storage::sparse::st
     return result;
 }
 
-bool StateValuations::assertValuation(StateValuation const& valuation) const {
-    storm::storage::BitVector foundBooleanValues(valuation.booleanValues.size(), false);
-    storm::storage::BitVector foundIntegerValues(valuation.integerValues.size(), false);
-    storm::storage::BitVector foundRationalValues(valuation.rationalValues.size(), false);
-    for (auto const& varIndex : variableToIndexMap) {
-        storm::storage::BitVector* bv;
-        if (varIndex.first.hasBooleanType()) {
-            bv = &foundBooleanValues;
-        } else if (varIndex.first.hasIntegerType()) {
-            bv = &foundIntegerValues;
-        } else if (varIndex.first.hasRationalType()) {
-            bv = &foundRationalValues;
-        } else {
-            STORM_LOG_THROW(false, storm::exceptions::InvalidTypeException, "Unexpected variable type.");
-        }
-        if (varIndex.second < bv->size()) {
-            if (bv->get(varIndex.second)) {
-                STORM_LOG_ERROR("Multiple variables refer to the same value index");
-                return false;
-            }
-            bv->set(varIndex.second, true);
-        } else {
-            STORM_LOG_ERROR("Valuation does not provide a value for all variables");
-            return false;
-        }
-    }
-    if (!(foundBooleanValues.full() && foundIntegerValues.full() && foundRationalValues.full())) {
-        STORM_LOG_ERROR("Valuation has too many entries.");
-    }
-    return true;
-}
-
-StateValuations::StateValuations(std::map<storm::expressions::Variable, uint64_t> const& variableToIndexMap, std::vector<StateValuation>&& valuations)
-    : variableToIndexMap(variableToIndexMap), valuations(valuations) {
-    // Intentionally left empty
-}
-
 std::string StateValuations::getStateInfo(state_type const& state) const {
     STORM_LOG_ASSERT(state < getNumberOfStates(), "Invalid state index.");
     return this->toString(state);
@@ -301,40 +272,212 @@ std::string StateValuations::getStateInfo(state_type const& state) const {
 
 typename StateValuations::StateValueIteratorRange StateValuations::at(state_type const& state) const {
     STORM_LOG_ASSERT(state < getNumberOfStates(), "Invalid state index.");
-    return StateValueIteratorRange({variableToIndexMap, observationLabels, &(valuations[state])});
+    return StateValueIteratorRange(variableToIndexMap, observationLabels, this, state);
 }
 
 uint_fast64_t StateValuations::getNumberOfStates() const {
-    return valuations.size();
+    return numberOfStates;
+}
+
+uint64_t StateValuations::getSizeInMemory() const {
+    // Note that this does not count the (dynamically allocated) digits of rational values.
+    return sizeof(*this) + packedValues.getSizeInBytes() + statesWithValuation.getSizeInBytes() + sizeof(storm::RationalNumber) * rationalValues.capacity() +
+           sizeof(PackedColumn) * (integerColumns.capacity() + labelColumns.capacity());
 }
 
 std::size_t StateValuations::hash() const {
     return 0;
 }
 
+StateValuations StateValuations::createEmptyCopy(StateValuations const& other, uint64_t numberOfStates) {
+    StateValuations result;
+    result.variableToIndexMap = other.variableToIndexMap;
+    result.observationLabels = other.observationLabels;
+    result.numberOfBooleanVariables = other.numberOfBooleanVariables;
+    result.integerColumns = other.integerColumns;
+    result.labelColumns = other.labelColumns;
+    result.bitsPerState = other.bitsPerState;
+    result.numberOfStates = numberOfStates;
+    result.packedValues = storm::storage::BitVector(numberOfStates * other.bitsPerState);
+    result.rationalValues.resize(numberOfStates * other.getNumberOfRationalVariables(), storm::utility::zero<storm::RationalNumber>());
+    result.statesWithValuation = storm::storage::BitVector(numberOfStates);
+    return result;
+}
+
+void StateValuations::copyState(StateValuations const& source, storm::storage::sparse::state_type sourceState, storm::storage::sparse::state_type targetState) {
+    if (!source.statesWithValuation.get(sourceState)) {
+        return;
+    }
+    statesWithValuation.set(targetState);
+    // Copy the record in blocks of (at most) 64 bits.
+    uint64_t sourceOffset = sourceState * bitsPerState;
+    uint64_t targetOffset = targetState * bitsPerState;
+    for (uint64_t bit = 0; bit < bitsPerState; bit += 64) {
+        uint64_t width = std::min<uint64_t>(64, bitsPerState - bit);
+        packedValues.setFromInt(targetOffset + bit, width, source.packedValues.getAsInt(sourceOffset + bit, width));
+    }
+    uint64_t numberOfRationalVariables = getNumberOfRationalVariables();
+    std::copy_n(source.rationalValues.begin() + sourceState * numberOfRationalVariables, numberOfRationalVariables,
+                rationalValues.begin() + targetState * numberOfRationalVariables);
+}
+
 StateValuations StateValuations::selectStates(storm::storage::BitVector const& selectedStates) const {
-    return StateValuations(variableToIndexMap, storm::utility::vector::filterVector(valuations, selectedStates));
+    StateValuations result = createEmptyCopy(*this, selectedStates.getNumberOfSetBits());
+    uint64_t newState = 0;
+    for (auto const& oldState : selectedStates) {
+        result.copyState(*this, oldState, newState);
+        ++newState;
+    }
+    return result;
 }
 
 StateValuations StateValuations::selectStates(std::vector<storm::storage::sparse::state_type> const& selectedStates) const {
-    std::vector<StateValuation> selectedValuations;
-    selectedValuations.reserve(selectedStates.size());
-    for (auto const& selectedState : selectedStates) {
-        if (selectedState < valuations.size()) {
-            selectedValuations.push_back(valuations[selectedState]);
-        } else {
-            selectedValuations.emplace_back();
+    StateValuations result = createEmptyCopy(*this, selectedStates.size());
+    for (uint64_t newState = 0; newState < selectedStates.size(); ++newState) {
+        if (selectedStates[newState] < numberOfStates) {
+            result.copyState(*this, selectedStates[newState], newState);
         }
     }
-    return StateValuations(variableToIndexMap, std::move(selectedValuations));
+    return result;
 }
 
 StateValuations StateValuations::blowup(const std::vector<uint64_t>& mapNewToOld) const {
-    std::vector<StateValuation> newValuations;
-    for (auto const& oldState : mapNewToOld) {
-        newValuations.push_back(valuations[oldState]);
+    StateValuations result = createEmptyCopy(*this, mapNewToOld.size());
+    for (uint64_t newState = 0; newState < mapNewToOld.size(); ++newState) {
+        result.copyState(*this, mapNewToOld[newState], newState);
+    }
+    return result;
+}
+
+namespace {
+// Magic bytes at the beginning of binary state valuations
+constexpr char binaryMagic[8] = {'S', 'T', 'O', 'R', 'M', 'S', 'V', 'B'};
+
+template<typename T>
+void writeBinaryValue(std::ostream& out, T const& value) {
+    out.write(reinterpret_cast<char const*>(&value), sizeof(T));
+}
+
+void writeBinaryString(std::ostream& out, std::string const& str) {
+    writeBinaryValue<uint64_t>(out, str.size());
+    out.write(str.data(), str.size());
+}
+
+class BinaryValuationsReader {
+   public:
+    BinaryValuationsReader(char const* data, char const* dataEnd) : current(data), end(dataEnd) {
+        // Intentionally left empty.
+    }
+
+    template<typename T>
+    T read() {
+        STORM_LOG_THROW(static_cast<uint64_t>(end - current) >= sizeof(T), storm::exceptions::WrongFormatException, "Unexpected end of state valuations.");
+        T value;
+        std::memcpy(&value, current, sizeof(T));
+        current += sizeof(T);
+        return value;
+    }
+
+    std::string readString() {
+        uint64_t size = read<uint64_t>();
+        STORM_LOG_THROW(static_cast<uint64_t>(end - current) >= size, storm::exceptions::WrongFormatException, "Unexpected end of state valuations.");
+        std::string result(current, size);
+        current += size;
+        return result;
+    }
+
+    bool isAtEnd() const {
+        return current == end;
+    }
+
+   private:
+    char const* current;
+    char const* end;
+};
+}  // namespace
+
+void StateValuations::writeBinary(std::ostream& out) const {
+    out.write(binaryMagic, sizeof(binaryMagic));
+    writeBinaryValue<uint64_t>(out, variableToIndexMap.size());
+    for (auto const& variableIndex : variableToIndexMap) {
+        writeBinaryString(out, variableIndex.first.getName());
+        writeBinaryValue<uint64_t>(out, variableIndex.second);
+    }
+    writeBinaryValue<uint64_t>(out, observationLabels.size());
+    for (auto const& labelIndex : observationLabels) {
+        writeBinaryString(out, labelIndex.first);
+        writeBinaryValue<uint64_t>(out, labelIndex.second);
+    }
+    writeBinaryValue<uint64_t>(out, numberOfBooleanVariables);
+    for (auto const* columns : {&integerColumns, &labelColumns}) {
+        writeBinaryValue<uint64_t>(out, columns->size());
+        for (auto const& column : *columns) {
+            writeBinaryValue(out, column.bitOffset);
+            writeBinaryValue(out, column.bitWidth);
+            writeBinaryValue(out, column.lowerBound);
+        }
+    }
+    writeBinaryValue<uint64_t>(out, bitsPerState);
+    writeBinaryValue<uint64_t>(out, numberOfStates);
+    for (auto const* bits : {&packedValues, &statesWithValuation}) {
+        for (uint64_t bit = 0; bit < bits->size(); bit += 64) {
+            writeBinaryValue<uint64_t>(out, bits->getAsInt(bit, std::min<uint64_t>(64, bits->size() - bit)));
+        }
+    }
+    for (auto const& value : rationalValues) {
+        writeBinaryString(out, storm::utility::to_string(value));
     }
-    return StateValuations(variableToIndexMap, std::move(newValuations));
+}
+
+StateValuations StateValuations::readBinary(char const* data, char const* dataEnd, storm::expressions::ExpressionManager const& manager) {
+    STORM_LOG_THROW(dataEnd - data >= 8 && std::equal(data, data + 8, binaryMagic), storm::exceptions::WrongFormatException,
+                    "Data does not contain binary state valuations.");
+    BinaryValuationsReader reader(data + 8, dataEnd);
+    StateValuations result;
+    uint64_t numberOfVariables = reader.read<uint64_t>();
+    for (uint64_t i = 0; i < numberOfVariables; ++i) {
+        std::string name = reader.readString();
+        STORM_LOG_THROW(manager.hasVariable(name), storm::exceptions::WrongFormatException, "Unknown variable " << name << " in state valuations.");
+        result.variableToIndexMap[manager.getVariable(name)] = reader.read<uint64_t>();
+    }
+    uint64_t numberOfLabels = reader.read<uint64_t>();
+    for (uint64_t i = 0; i < numberOfLabels; ++i) {
+        std::string label = reader.readString();
+        result.observationLabels[label] = reader.read<uint64_t>();
+    }
+    result.numberOfBooleanVariables = reader.read<uint64_t>();
+    for (auto* columns : {&result.integerColumns, &result.labelColumns}) {
+        columns->resize(reader.read<uint64_t>());
+        for (auto& column : *columns) {
+            column.bitOffset = reader.read<uint64_t>();
+            column.bitWidth = reader.read<uint64_t>();
+            column.lowerBound = reader.read<int64_t>();
+        }
+    }
+    result.bitsPerState = reader.read<uint64_t>();
+    result.numberOfStates = reader.read<uint64_t>();
+    result.packedValues = storm::storage::BitVector(result.numberOfStates * result.bitsPerState);
+    result.statesWithValuation = storm::storage::BitVector(result.numberOfStates);
+    for (auto* bits : {&result.packedValues, &result.statesWithValuation}) {
+        for (uint64_t bit = 0; bit < bits->size(); bit += 64) {
+            uint64_t width = std::min<uint64_t>(64, bits->size() - bit);
+            uint64_t word = reader.read<uint64_t>();
+            STORM_LOG_THROW(width == 64 || (word >> width) == 0, storm::exceptions::WrongFormatException, "Invalid packed values in state valuations.");
+            bits->setFromInt(bit, width, word);
+        }
+    }
+    uint64_t numberOfRationalVariables = 0;
+    for (auto const& variableIndex : result.variableToIndexMap) {
+        if (variableIndex.first.hasRationalType()) {
+            ++numberOfRationalVariables;
+        }
+    }
+    result.rationalValues.reserve(result.numberOfStates * numberOfRationalVariables);
+    for (uint64_t i = 0; i < result.numberOfStates * numberOfRationalVariables; ++i) {
+        result.rationalValues.push_back(storm::utility::convertNumber<storm::RationalNumber>(reader.readString()));
+    }
+    STORM_LOG_THROW(reader.isAtEnd(), storm::exceptions::WrongFormatException, "Unexpected data at the end of state valuations.");
+    return result;
 }
 
 StateValuationsBuilder::StateValuationsBuilder() : booleanVarCount(0), integerVarCount(0), rationalVarCount(0), labelCount(0) {
@@ -342,7 +485,7 @@ StateValuationsBuilder::StateValuationsBuilder() : booleanVarCount(0), integerVa
 }
 
 void StateValuationsBuilder::addVariable(storm::expressions::Variable const& variable) {
-    STORM_LOG_ASSERT(currentStateValuations.valuations.empty(), "Tried to add a variable, although a state has already been added before.");
+    STORM_LOG_ASSERT(statesWithValuation.empty(), "Tried to add a variable, although a state has already been added before.");
     STORM_LOG_ASSERT(currentStateValuations.variableToIndexMap.count(variable) == 0, "Variable " << variable.getName() << " already added.");
     if (variable.hasBooleanType()) {
         currentStateValuations.variableToIndexMap[variable] = booleanVarCount++;
@@ -366,17 +509,24 @@ void StateValuationsBuilder::addState(storm::storage::sparse::state_type const&
 
 void StateValuationsBuilder::addState(storm::storage::sparse::state_type const& state, std::vector<bool>&& booleanValues, std::vector<int64_t>&& integerValues,
                                       std::vector<storm::RationalNumber>&& rationalValues, std::vector<int64_t>&& observationLabelValues) {
-    if (state > currentStateValuations.valuations.size()) {
-        currentStateValuations.valuations.resize(state);
-    }
-    if (state == currentStateValuations.valuations.size()) {
-        currentStateValuations.valuations.emplace_back(std::move(booleanValues), std::move(integerValues), std::move(rationalValues),
-                                                       std::move(observationLabelValues));
-    } else {
-        STORM_LOG_ASSERT(currentStateValuations.isEmpty(state), "Adding a valuation to the same state multiple times.");
-        currentStateValuations.valuations[state] = typename StateValuations::StateValuation(std::move(booleanValues), std::move(integerValues),
-                                                                                            std::move(rationalValues), std::move(observationLabelValues));
+    STORM_LOG_ASSERT(booleanValues.size() == booleanVarCount, "Unexpected number of boolean values.");
+    STORM_LOG_ASSERT(integerValues.size() == integerVarCount, "Unexpected number of integer values.");
+    STORM_LOG_ASSERT(rationalValues.size() == rationalVarCount, "Unexpected number of rational values.");
+    if (state >= statesWithValuation.size()) {
+        statesWithValuation.resize(state + 1, false);
+        this->booleanValues.resize((state + 1) * booleanVarCount, false);
+        this->integerValues.resize((state + 1) * integerVarCount, 0);
+        this->rationalValues.resize((state + 1) * rationalVarCount, storm::utility::zero<storm::RationalNumber>());
+        this->labelValues.resize((state + 1) * labelCount, 0);
     }
+    STORM_LOG_ASSERT(!statesWithValuation[state], "Adding a valuation to the same state multiple times.");
+    statesWithValuation[state] = true;
+    std::copy_n(booleanValues.begin(), std::min<uint64_t>(booleanValues.size(), booleanVarCount), this->booleanValues.begin() + state * booleanVarCount);
+    std::copy_n(integerValues.begin(), std::min<uint64_t>(integerValues.size(), integerVarCount), this->integerValues.begin() + state * integerVarCount);
+    std::move(rationalValues.begin(), rationalValues.begin() + std::min<uint64_t>(rationalValues.size(), rationalVarCount),
+              this->rationalValues.begin() + state * rationalVarCount);
+    // Observation labels may be given by fewer values than there are labels (the remaining values are zero).
+    std::copy_n(observationLabelValues.begin(), std::min<uint64_t>(observationLabelValues.size(), labelCount), this->labelValues.begin() + state * labelCount);
 }
 
 uint64_t StateValuationsBuilder::getBooleanVarCount() const {
@@ -391,11 +541,74 @@ uint64_t StateValuationsBuilder::getLabelCount() const {
     return labelCount;
 }
 
+std::vector<StateValuations::PackedColumn> StateValuationsBuilder::computePackedColumns(std::vector<int64_t> const& values, uint64_t numberOfColumns,
+                                                                                      uint64_t& bitOffset) {
+    std::vector<StateValuations::PackedColumn> columns(numberOfColumns);
+    std::vector<int64_t> upperBounds(numberOfColumns, 0);
+    for (uint64_t column = 0; column < numberOfColumns; ++column) {
+        for (uint64_t index = column; index < values.size(); index += numberOfColumns) {
+            if (index == column || values[index] < columns[column].lowerBound) {
+                columns[column].lowerBound = values[index];
+            }
+            if (index == column || values[index] > upperBounds[column]) {
+                upperBounds[column] = values[index];
+            }
+        }
+        uint64_t range = static_cast<uint64_t>(upperBounds[column]) - static_cast<uint64_t>(columns[column].lowerBound);
+        columns[column].bitOffset = bitOffset;
+        while (columns[column].bitWidth < 64 && (range >> columns[column].bitWidth) != 0) {
+            ++columns[column].bitWidth;
+        }
+        bitOffset += columns[column].bitWidth;
+    }
+    return columns;
+}
+
 StateValuations StateValuationsBuilder::build() {
+    StateValuations& result = currentStateValuations;
+    uint64_t numberOfStates = statesWithValuation.size();
+
+    // Compute the layout of the records
+    result.numberOfBooleanVariables = booleanVarCount;
+    uint64_t bitOffset = booleanVarCount;
+    result.integerColumns = computePackedColumns(integerValues, integerVarCount, bitOffset);
+    result.labelColumns = computePackedColumns(labelValues, labelCount, bitOffset);
+    result.bitsPerState = bitOffset;
+
+    // Pack the values
+    result.numberOfStates = numberOfStates;
+    result.packedValues = storm::storage::BitVector(numberOfStates * result.bitsPerState);
+    result.statesWithValuation = storm::storage::BitVector(numberOfStates);
+    for (uint64_t state = 0; state < numberOfStates; ++state) {
+        if (!statesWithValuation[state]) {
+            continue;
+        }
+        result.statesWithValuation.set(state);
+        uint64_t recordOffset = state * result.bitsPerState;
+        for (uint64_t var = 0; var < booleanVarCount; ++var) {
+            result.packedValues.set(recordOffset + var, booleanValues[state * booleanVarCount + var]);
+        }
+        for (auto const& [columns, values] : {std::make_pair(&result.integerColumns, &integerValues), std::make_pair(&result.labelColumns, &labelValues)}) {
+            for (uint64_t column = 0; column < columns->size(); ++column) {
+                auto const& packedColumn = (*columns)[column];
+                if (packedColumn.bitWidth > 0) {
+                    uint64_t value = static_cast<uint64_t>((*values)[state * columns->size() + column]) - static_cast<uint64_t>(packedColumn.lowerBound);
+                    result.packedValues.setFromInt(recordOffset + packedColumn.bitOffset, packedColumn.bitWidth, value);
+                }
+            }
+        }
+    }
+    result.rationalValues = std::move(rationalValues);
+
     booleanVarCount = 0;
     integerVarCount = 0;
     rationalVarCount = 0;
     labelCount = 0;
+    booleanValues.clear();
+    integerValues.clear();
+    rationalValues.clear();
+    labelValues.clear();
+    statesWithValuation.clear();
     return std::move(currentStateValuations);
 }
 
@@ -2,6 +2,9 @@
 
 #include <boost/optional.hpp>
 #include <cstdint>
+#include <iosfwd>
+#include <map>
+#include <set>
 #include <string>
 
 #include "storm/adapters/JsonForward.h"
@@ -17,25 +20,17 @@ namespace sparse {
 
 class StateValuationsBuilder;
 
-// A structure holding information about the reachable state space that can be retrieved from the outside.
+/*!
+ * A structure holding information about the reachable state space that can be retrieved from the outside.
+ *
+ * The values of boolean and integer variables as well as observation labels are stored bit-packed: each state is represented by a record of fixed width
+ * in a single bit vector (similar to CompressedState). Integer values are stored relative to the smallest value occurring in the respective column and
+ * only use the number of bits required for the range of occurring values. Rational values (which are rare) are stored separately.
+ */
 class StateValuations : public storm::models::sparse::StateAnnotation {
    public:
     friend class StateValuationsBuilder;
 
-    class StateValuation {
-       public:
-        friend class StateValuations;
-        StateValuation() = default;
-        StateValuation(std::vector<bool>&& booleanValues, std::vector<int64_t>&& integerValues, std::vector<storm::RationalNumber>&& rationalValues,
-                       std::vector<int64_t>&& observationLabelValues = {});
-
-       private:
-        std::vector<bool> booleanValues;
-        std::vector<int64_t> integerValues;
-        std::vector<storm::RationalNumber> rationalValues;
-        std::vector<int64_t> observationLabelValues;
-    };
-
     class StateValueIterator {
        public:
         StateValueIterator(typename std::map<storm::expressions::Variable, uint64_t>::const_iterator variableIt,
@@ -43,7 +38,8 @@ class StateValuations : public storm::models::sparse::StateAnnotation {
                            typename std::map<storm::expressions::Variable, uint64_t>::const_iterator variableBegin,
                            typename std::map<storm::expressions::Variable, uint64_t>::const_iterator variableEnd,
                            typename std::map<std::string, uint64_t>::const_iterator labelBegin,
-                           typename std::map<std::string, uint64_t>::const_iterator labelEnd, StateValuation const* valuation);
+                           typename std::map<std::string, uint64_t>::const_iterator labelEnd, StateValuations const* valuations,
+                           storm::storage::sparse::state_type state);
         bool operator==(StateValueIterator const& other);
         bool operator!=(StateValueIterator const& other);
         StateValueIterator& operator++();
@@ -73,20 +69,22 @@ class StateValuations : public storm::models::sparse::StateAnnotation {
         typename std::map<std::string, uint64_t>::const_iterator labelBegin;
         typename std::map<std::string, uint64_t>::const_iterator labelEnd;
 
-        StateValuation const* const valuation;
+        StateValuations const* const valuations;
+        storm::storage::sparse::state_type const state;
     };
 
     class StateValueIteratorRange {
        public:
         StateValueIteratorRange(std::map<storm::expressions::Variable, uint64_t> const& variableMap, std::map<std::string, uint64_t> const& labelMap,
-                                StateValuation const* valuation);
+                                StateValuations const* valuations, storm::storage::sparse::state_type state);
         StateValueIterator begin() const;
         StateValueIterator end() const;
 
        private:
         std::map<storm::expressions::Variable, uint64_t> const& variableMap;
         std::map<std::string, uint64_t> const& labelMap;
-        StateValuation const* const valuation;
+        StateValuations const* const valuations;
+        storm::storage::sparse::state_type const state;
     };
 
     StateValuations() = default;
@@ -95,7 +93,7 @@ class StateValuations : public storm::models::sparse::StateAnnotation {
     StateValueIteratorRange at(storm::storage::sparse::state_type const& state) const;
 
     bool getBooleanValue(storm::storage::sparse::state_type const& stateIndex, storm::expressions::Variable const& booleanVariable) const;
-    int64_t const& getIntegerValue(storm::storage::sparse::state_type const& stateIndex, storm::expressions::Variable const& integerVariable) const;
+    int64_t getIntegerValue(storm::storage::sparse::state_type const& stateIndex, storm::expressions::Variable const& integerVariable) const;
     storm::RationalNumber const& getRationalValue(storm::storage::sparse::state_type const& stateIndex,
                                                   storm::expressions::Variable const& rationalVariable) const;
     /// Returns true, if this valuation does not contain any value.
@@ -122,6 +120,9 @@ class StateValuations : public storm::models::sparse::StateAnnotation {
     // Returns the (current) number of states that this object describes.
     uint_fast64_t getNumberOfStates() const;
 
+    // Returns (an approximation of) the number of bytes occupied by the valuations of all states.
+    uint64_t getSizeInMemory() const;
+
     /*
      * Derive new state valuations from this by selecting the given states.
      */
@@ -137,15 +138,55 @@ class StateValuations : public storm::models::sparse::StateAnnotation {
 
     virtual std::size_t hash() const;
 
+    /*!
+     * Writes the state valuations in a binary format to the given stream.
+     * The packed values are written as one block of 64 bit words, so files can be mapped into memory and loaded without any tokenization.
+     * Numbers are stored in the byte order of the exporting machine.
+     */
+    void writeBinary(std::ostream& out) const;
+
+    /*!
+     * Loads state valuations that were written with writeBinary.
+     *
+     * @param data The beginning of the binary data.
+     * @param dataEnd The end of the binary data.
+     * @param manager The manager that knows the variables (identified by their names) of the valuations.
+     */
+    static StateValuations readBinary(char const* data, char const* dataEnd, storm::expressions::ExpressionManager const& manager);
+
    private:
-    StateValuations(std::map<storm::expressions::Variable, uint64_t> const& variableToIndexMap, std::vector<StateValuation>&& valuations);
-    bool assertValuation(StateValuation const& valuation) const;
-    StateValuation const& getValuation(storm::storage::sparse::state_type const& stateIndex) const;
+    // The position of a value within the record of a state.
+    struct PackedColumn {
+        uint64_t bitOffset = 0;
+        uint64_t bitWidth = 0;
+        int64_t lowerBound = 0;
+    };
+
+    // Creates state valuations with the same variables and record layout as the given one but without any states.
+    static StateValuations createEmptyCopy(StateValuations const& other, uint64_t numberOfStates);
+    // Copies the values of the given state of the given valuations to the given state of this object.
+    void copyState(StateValuations const& source, storm::storage::sparse::state_type sourceState, storm::storage::sparse::state_type targetState);
+
+    int64_t getPackedValue(storm::storage::sparse::state_type const& stateIndex, PackedColumn const& column) const;
+    int64_t getLabelValue(storm::storage::sparse::state_type const& stateIndex, uint64_t labelIndex) const;
+    uint64_t getNumberOfRationalVariables() const;
 
     std::map<storm::expressions::Variable, uint64_t> variableToIndexMap;
     std::map<std::string, uint64_t> observationLabels;
-    // A mapping from state indices to their variable valuations.
-    std::vector<StateValuation> valuations;
+
+    // The layout of a state record: booleans occupy one bit each, starting at the beginning of the record.
+    uint64_t numberOfBooleanVariables = 0;
+    std::vector<PackedColumn> integerColumns;
+    std::vector<PackedColumn> labelColumns;
+    uint64_t bitsPerState = 0;
+
+    uint64_t numberOfStates = 0;
+    // The bit-packed records of all states.
+    storm::storage::BitVector packedValues;
+    // The values of rational variables, stored state by state.
+    std::vector<storm::RationalNumber> rationalValues;
+    // The states that have a valuation.
+    storm::storage::BitVector statesWithValuation;
 };
 
 class StateValuationsBuilder {
@@ -187,11 +228,21 @@ class StateValuationsBuilder {
     uint64_t getLabelCount() const;
 
    private:
+    // Computes the layout of packed columns (starting at the given bit offset) such that all given values (stored state by state) can be represented.
+    static std::vector<StateValuations::PackedColumn> computePackedColumns(std::vector<int64_t> const& values, uint64_t numberOfColumns, uint64_t& bitOffset);
+
     StateValuations currentStateValuations;
     uint64_t booleanVarCount;
     uint64_t integerVarCount;
     uint64_t rationalVarCount;
     uint64_t labelCount;
+
+    // The values of the added states (stored state by state) which are packed when the state valuations are built.
+    std::vector<bool> booleanValues;
+    std::vector<int64_t> integerValues;
+    std::vector<storm::RationalNumber> rationalValues;
+    std::vector<int64_t> labelValues;
+    std::vector<bool> statesWithValuation;
 };
 }  // namespace sparse
 }  // namespace storage
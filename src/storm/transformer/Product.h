@@ -1,6 +1,14 @@
 #pragma once
 
+#include <cstdint>
+#include <limits>
 #include <memory>
+#include <utility>
+#include <vector>
+
+#include <parallel_hashmap/phmap.h>
+
+#include "storm/storage/sparse/StateType.h"
 
 namespace storm {
 namespace transformer {
@@ -11,15 +19,21 @@ class Product {
 
     typedef storm::storage::sparse::state_type state_type;
     typedef std::pair<state_type, state_type> product_state_type;
-    typedef std::map<product_state_type, state_type> product_state_to_product_index_map;
-    typedef std::vector<product_state_type> product_index_to_product_state_vector;
+
+    // Model states, automaton states and product indices are stored with 32 bits, as the product typically has many more states than the model.
+    typedef uint32_t compact_state_type;
+    typedef std::pair<compact_state_type, compact_state_type> compact_product_state_type;
+    typedef phmap::flat_hash_map<compact_product_state_type, compact_state_type> product_state_to_product_index_map;
+    typedef std::vector<compact_product_state_type> product_index_to_product_state_vector;
+
+    static constexpr state_type maximalNumberOfCompactStates = std::numeric_limits<compact_state_type>::max();
 
     Product(Model&& productModel, std::string&& productStateOfInterestLabel, product_state_to_product_index_map&& productStateToProductIndex,
             product_index_to_product_state_vector&& productIndexToProductState)
-        : productModel(productModel),
-          productStateOfInterestLabel(productStateOfInterestLabel),
-          productStateToProductIndex(productStateToProductIndex),
-          productIndexToProductState(productIndexToProductState) {}
+        : productModel(std::move(productModel)),
+          productStateOfInterestLabel(std::move(productStateOfInterestLabel)),
+          productStateToProductIndex(std::move(productStateToProductIndex)),
+          productIndexToProductState(std::move(productIndexToProductState)) {}
 
     Product(Product<Model>&& product) = default;
     Product& operator=(Product<Model>&& product) = default;
@@ -32,7 +46,7 @@ class Product {
         return productStateOfInterestLabel;
     }
 
-    product_state_to_product_index_map getProductStateToProductIndex(){
+    product_state_to_product_index_map& getProductStateToProductIndex(){
         return productStateToProductIndex;
     }
 
@@ -49,11 +63,14 @@ class Product {
     }
 
     state_type getProductStateIndex(state_type modelState, state_type automatonState) const {
-        return productStateToProductIndex.at(product_state_type(modelState, automatonState));
+        return productStateToProductIndex.at(compact_product_state_type(modelState, automatonState));
     }
 
     bool isValidProductState(state_type modelState, state_type automatonState) const {
-        return (productStateToProductIndex.count(product_state_type(modelState, automatonState)) > 0);
+        if (modelState > maximalNumberOfCompactStates || automatonState > maximalNumberOfCompactStates) {
+            return false;
+        }
+        return (productStateToProductIndex.count(compact_product_state_type(modelState, automatonState)) > 0);
     }
 
     storm::storage::BitVector liftFromAutomaton(const storm::storage::BitVector& vector) const {
@@ -1,11 +1,12 @@
 #pragma once
 
+#include "storm/exceptions/NotSupportedException.h"
 #include "storm/models/sparse/StateLabeling.h"
 #include "storm/storage/BitVector.h"
 #include "storm/storage/SparseMatrix.h"
+#include "storm/transformer/Product.h"
+#include "storm/utility/macros.h"
 
-#include <deque>
-#include <map>
 #include <vector>
 
 namespace storm {
@@ -16,100 +17,67 @@ class ProductBuilder {
    public:
     typedef storm::storage::SparseMatrix<typename Model::ValueType> matrix_type;
 
+    /*!
+     * Builds the product of the given matrix with the product operator, restricted to the product states that are reachable from the states of interest.
+     * Product states are explored on the fly and stored compactly, i.e., no product state that is unreachable is ever created.
+     */
     template<typename ProductOperator>
     static typename Product<Model>::ptr buildProduct(const matrix_type& originalMatrix, ProductOperator& prodOp,
                                                      const storm::storage::BitVector& statesOfInterest) {
         bool deterministic = originalMatrix.hasTrivialRowGrouping();
 
         typedef storm::storage::sparse::state_type state_type;
-        typedef std::pair<state_type, state_type> product_state_type;
+        typedef typename Product<Model>::compact_state_type compact_state_type;
+        typedef typename Product<Model>::compact_product_state_type compact_product_state_type;
 
-        state_type nextState = 0;
-        std::map<product_state_type, state_type> productStateToProductIndex;
-        std::vector<product_state_type> productIndexToProductState;
-        std::vector<state_type> prodInitial;
+        STORM_LOG_THROW(originalMatrix.getRowGroupCount() <= Product<Model>::maximalNumberOfCompactStates, storm::exceptions::NotSupportedException,
+                        "The model has too many states to build a product.");
 
-        // use deque for todo so that the states are handled in the order
-        // of their index in the product model, which is required due to the
-        // use of the SparseMatrixBuilder that can only handle linear addNextValue
-        // calls
-        std::deque<state_type> todo;
-        for (state_type s_0 : statesOfInterest) {
-            state_type q_0 = prodOp.getInitialState(s_0);
+        typename Product<Model>::product_state_to_product_index_map productStateToProductIndex;
+        typename Product<Model>::product_index_to_product_state_vector productIndexToProductState;
+        std::vector<state_type> prodInitial;
 
-            // std::cout << "Initial: " << s_0 << ", " << q_0 << " = " << nextState << "\n";
+        // Retrieves the index of the given product state, exploring it if it has not been seen before.
+        auto getProductIndex = [&productStateToProductIndex, &productIndexToProductState](state_type modelState, state_type automatonState) {
+            STORM_LOG_THROW(automatonState <= Product<Model>::maximalNumberOfCompactStates, storm::exceptions::NotSupportedException,
+                            "The automaton has too many states to build a product.");
+            auto insertionResult = productStateToProductIndex.emplace(
+                compact_product_state_type(modelState, automatonState), static_cast<compact_state_type>(productIndexToProductState.size()));
+            if (insertionResult.second) {
+                STORM_LOG_THROW(productIndexToProductState.size() < Product<Model>::maximalNumberOfCompactStates, storm::exceptions::NotSupportedException,
+                                "The product has too many states.");
+                productIndexToProductState.push_back(insertionResult.first->first);
+            }
+            return static_cast<state_type>(insertionResult.first->second);
+        };
 
-            product_state_type s_q(s_0, q_0);
-            state_type index = nextState++;
-            productStateToProductIndex[s_q] = index;
-            productIndexToProductState.push_back(s_q);
-            prodInitial.push_back(index);
-            todo.push_back(index);
+        for (state_type s_0 : statesOfInterest) {
+            prodInitial.push_back(getProductIndex(s_0, prodOp.getInitialState(s_0)));
         }
 
+        // Product states are handled in the order of their index in the product model, which is required due to the
+        // use of the SparseMatrixBuilder that can only handle linear addNextValue calls. As new states get the next
+        // free index, the states that still need to be explored are exactly the ones after the current one.
         storm::storage::SparseMatrixBuilder<typename Model::ValueType> builder(0, 0, 0, false, deterministic ? false : true, 0);
         std::size_t curRow = 0;
-        while (!todo.empty()) {
-            state_type prodIndexFrom = todo.front();
-            todo.pop_front();
-
-            product_state_type from = productIndexToProductState.at(prodIndexFrom);
-            // std::cout << "Handle " << from.first << "," << from.second << " (prodIndexFrom = " << prodIndexFrom << "):\n";
-            if (deterministic) {
-                typename matrix_type::const_rows row = originalMatrix.getRow(from.first);
-                for (auto const& entry : row) {
-                    state_type t = entry.getColumn();
-                    state_type p = prodOp.getSuccessor(from.second, t);
-                    // std::cout << " p = " << p << "\n";
-                    product_state_type t_p(t, p);
-                    state_type prodIndexTo;
-                    auto it = productStateToProductIndex.find(t_p);
-                    if (it == productStateToProductIndex.end()) {
-                        prodIndexTo = nextState++;
-                        todo.push_back(prodIndexTo);
-                        productIndexToProductState.push_back(t_p);
-                        productStateToProductIndex[t_p] = prodIndexTo;
-                        // std::cout << " Adding " << t_p.first << "," << t_p.second << " as " << prodIndexTo << "\n";
-                    } else {
-                        prodIndexTo = it->second;
-                    }
-                    // std::cout << " " << t_p.first << "," << t_p.second << ": to = " << prodIndexTo << "\n";
-
-                    // std::cout << " addNextValue(" << prodIndexFrom << "," << prodIndexTo << "," << entry.getValue() << ")\n";
-                    builder.addNextValue(prodIndexFrom, prodIndexTo, entry.getValue());
-                }
-            } else {
-                std::size_t numRows = originalMatrix.getRowGroupSize(from.first);
+        for (state_type prodIndexFrom = 0; prodIndexFrom < productIndexToProductState.size(); ++prodIndexFrom) {
+            compact_product_state_type from = productIndexToProductState[prodIndexFrom];
+            if (!deterministic) {
                 builder.newRowGroup(curRow);
-                for (std::size_t i = 0; i < numRows; i++) {
-                    auto const& row = originalMatrix.getRow(from.first, i);
-                    for (auto const& entry : row) {
-                        state_type t = entry.getColumn();
-                        state_type p = prodOp.getSuccessor(from.second, t);
-                        // std::cout << " p = " << p << "\n";
-                        product_state_type t_p(t, p);
-                        state_type prodIndexTo;
-                        auto it = productStateToProductIndex.find(t_p);
-                        if (it == productStateToProductIndex.end()) {
-                            prodIndexTo = nextState++;
-                            todo.push_back(prodIndexTo);
-                            productIndexToProductState.push_back(t_p);
-                            productStateToProductIndex[t_p] = prodIndexTo;
-                            // std::cout << " Adding " << t_p.first << "," << t_p.second << " as " << prodIndexTo << "\n";
-                        } else {
-                            prodIndexTo = it->second;
-                        }
-                        // std::cout << " " << t_p.first << "," << t_p.second << ": to = " << prodIndexTo << "\n";
-
-                        // std::cout << " addNextValue(" << prodIndexFrom << "," << prodIndexTo << "," << entry.getValue() << ")\n";
-                        builder.addNextValue(curRow, prodIndexTo, entry.getValue());
-                    }
-                    curRow++;
+            }
+            state_type row = deterministic ? from.first : originalMatrix.getRowGroupIndices()[from.first];
+            state_type rowEnd = deterministic ? row + 1 : originalMatrix.getRowGroupIndices()[from.first + 1];
+            for (; row < rowEnd; ++row) {
+                for (auto const& entry : originalMatrix.getRow(row)) {
+                    state_type t = entry.getColumn();
+                    state_type prodIndexTo = getProductIndex(t, prodOp.getSuccessor(from.second, t));
+                    builder.addNextValue(curRow, prodIndexTo, entry.getValue());
                 }
+                ++curRow;
             }
         }
 
-        state_type numberOfProductStates = nextState;
+        state_type numberOfProductStates = productIndexToProductState.size();
 
         Model product(builder.build(), storm::models::sparse::StateLabeling(numberOfProductStates));
         storm::storage::BitVector productStatesOfInterest(product.getNumberOfStates());
@@ -118,9 +86,6 @@ class ProductBuilder {
         }
         std::string prodSoiLabel = product.getStateLabeling().addUniqueLabel("soi", productStatesOfInterest);
 
-        // const storm::models::sparse::StateLabeling& orignalLabels = dtmc->getStateLabeling();
-        // for (originalLabels.)
-
         return typename Product<Model>::ptr(
             new Product<Model>(std::move(product), std::move(prodSoiLabel), std::move(productStateToProductIndex), std::move(productIndexToProductState)));
     }
@@ -0,0 +1,129 @@
+#include "storm/transformer/StatePermuter.h"
+
+#include "storm/adapters/RationalFunctionAdapter.h"
+
+#include "storm/models/sparse/Ctmc.h"
+#include "storm/models/sparse/MarkovAutomaton.h"
+#include "storm/models/sparse/StandardRewardModel.h"
+#include "storm/storage/sparse/ModelComponents.h"
+#include "storm/utility/builder.h"
+#include "storm/utility/macros.h"
+#include "storm/utility/vector.h"
+
+#include "storm/exceptions/InvalidArgumentException.h"
+#include "storm/exceptions/NotSupportedException.h"
+
+namespace storm {
+namespace transformer {
+
+template<typename RewardModelType>
+RewardModelType permuteRewardModel(RewardModelType const& originalRewardModel, std::vector<uint64_t> const& inverseStatePermutation,
+                                   std::vector<uint64_t> const& statePermutation, std::vector<uint64_t> const& inverseChoicePermutation,
+                                   std::vector<uint64_t> const& originalRowGroupIndices) {
+    std::optional<std::vector<typename RewardModelType::ValueType>> stateRewardVector;
+    std::optional<std::vector<typename RewardModelType::ValueType>> stateActionRewardVector;
+    std::optional<storm::storage::SparseMatrix<typename RewardModelType::ValueType>> transitionRewardMatrix;
+    if (originalRewardModel.hasStateRewards()) {
+        stateRewardVector = storm::utility::vector::applyInversePermutation(inverseStatePermutation, originalRewardModel.getStateRewardVector());
+    }
+    if (originalRewardModel.hasStateActionRewards()) {
+        stateActionRewardVector = storm::utility::vector::applyInversePermutation(inverseChoicePermutation, originalRewardModel.getStateActionRewardVector());
+    }
+    if (originalRewardModel.hasTransitionRewards()) {
+        // The rows of the transition reward matrix correspond to the choices of the model, so we let it have the same row grouping as the transition matrix.
+        auto groupedMatrix = originalRewardModel.getTransitionRewardMatrix();
+        bool const hadTrivialRowGrouping = groupedMatrix.hasTrivialRowGrouping();
+        groupedMatrix.setRowGroupIndices(originalRowGroupIndices);
+        transitionRewardMatrix = groupedMatrix.permuteRowGroupsAndColumns(inverseStatePermutation, statePermutation);
+        if (hadTrivialRowGrouping) {
+            transitionRewardMatrix->makeRowGroupingTrivial();
+        }
+    }
+    return RewardModelType(std::move(stateRewardVector), std::move(stateActionRewardVector), std::move(transitionRewardMatrix));
+}
+
+template<typename ValueType, typename RewardModelType>
+std::shared_ptr<storm::models::sparse::Model<ValueType, RewardModelType>> permuteStates(
+    storm::models::sparse::Model<ValueType, RewardModelType> const& originalModel, std::vector<uint64_t> const& inverseStatePermutation) {
+    STORM_LOG_THROW(
+        inverseStatePermutation.size() == originalModel.getNumberOfStates() && storm::utility::permutation::isValidPermutation(inverseStatePermutation),
+        storm::exceptions::InvalidArgumentException, "The given state permutation is invalid.");
+    auto const& originalMatrix = originalModel.getTransitionMatrix();
+    auto const statePermutation = storm::utility::permutation::invertPermutation(inverseStatePermutation);
+    std::vector<uint64_t> inverseChoicePermutation;
+    inverseChoicePermutation.reserve(originalMatrix.getRowCount());
+    for (auto const& oldState : inverseStatePermutation) {
+        for (auto const oldChoice : originalMatrix.getRowGroupIndices(oldState)) {
+            inverseChoicePermutation.push_back(oldChoice);
+        }
+    }
+
+    storm::storage::sparse::ModelComponents<ValueType, RewardModelType> components(
+        originalMatrix.permuteRowGroupsAndColumns(inverseStatePermutation, statePermutation), originalModel.getStateLabeling());
+    components.stateLabeling.permuteItems(inverseStatePermutation);
+    for (auto const& rewardModel : originalModel.getRewardModels()) {
+        components.rewardModels.emplace(rewardModel.first, permuteRewardModel(rewardModel.second, inverseStatePermutation, statePermutation,
+                                                                              inverseChoicePermutation, originalMatrix.getRowGroupIndices()));
+    }
+    if (originalModel.hasChoiceLabeling()) {
+        components.choiceLabeling = originalModel.getChoiceLabeling();
+        components.choiceLabeling->permuteItems(inverseChoicePermutation);
+    }
+    if (originalModel.hasStateValuations()) {
+        components.stateValuations = originalModel.getStateValuations().selectStates(inverseStatePermutation);
+    }
+    if (originalModel.hasChoiceOrigins()) {
+        components.choiceOrigins = originalModel.getChoiceOrigins()->selectChoices(inverseChoicePermutation);
+    }
+
+    if (originalModel.isOfType(storm::models::ModelType::MarkovAutomaton)) {
+        auto const& ma = *originalModel.template as<storm::models::sparse::MarkovAutomaton<ValueType, RewardModelType>>();
+        components.markovianStates = ma.getMarkovianStates().permute(inverseStatePermutation);
+        components.exitRates = storm::utility::vector::applyInversePermutation(inverseStatePermutation, ma.getExitRates());
+        components.rateTransitions = false;  // Note that originalModel.getTransitionMatrix() contains probabilities
+    } else if (originalModel.isOfType(storm::models::ModelType::Ctmc)) {
+        auto const& ctmc = *originalModel.template as<storm::models::sparse::Ctmc<ValueType, RewardModelType>>();
+        components.exitRates = storm::utility::vector::applyInversePermutation(inverseStatePermutation, ctmc.getExitRateVector());
+        components.rateTransitions = true;
+    } else {
+        STORM_LOG_THROW(originalModel.isOfType(storm::models::ModelType::Dtmc) || originalModel.isOfType(storm::models::ModelType::Mdp),
+                        storm::exceptions::NotSupportedException, "Permuting the states of a " << originalModel.getType() << " is not supported.");
+    }
+    return storm::utility::builder::buildModelFromComponents(originalModel.getType(), std::move(components));
+}
+
+template<typename ValueType, typename RewardModelType>
+std::shared_ptr<storm::models::sparse::Model<ValueType, RewardModelType>> permuteStates(
+    storm::models::sparse::Model<ValueType, RewardModelType> const& originalModel, storm::utility::permutation::OrderKind order,
+    std::vector<uint64_t>* inverseStatePermutation) {
+    auto permutation = storm::utility::permutation::createPermutation(order, originalModel.getTransitionMatrix(), originalModel.getInitialStates());
+    auto result = permuteStates(originalModel, permutation);
+    if (inverseStatePermutation) {
+        *inverseStatePermutation = std::move(permutation);
+    }
+    return result;
+}
+
+template std::shared_ptr<storm::models::sparse::Model<double>> permuteStates(storm::models::sparse::Model<double> const& originalModel,
+                                                                             std::vector<uint64_t> const& inverseStatePermutation);
+template std::shared_ptr<storm::models::sparse::Model<storm::RationalNumber>> permuteStates(
+    storm::models::sparse::Model<storm::RationalNumber> const& originalModel, std::vector<uint64_t> const& inverseStatePermutation);
+template std::shared_ptr<storm::models::sparse::Model<storm::RationalFunction>> permuteStates(
+    storm::models::sparse::Model<storm::RationalFunction> const& originalModel, std::vector<uint64_t> const& inverseStatePermutation);
+template std::shared_ptr<storm::models::sparse::Model<storm::Interval>> permuteStates(storm::models::sparse::Model<storm::Interval> const& originalModel,
+                                                                                     std::vector<uint64_t> const& inverseStatePermutation);
+template std::shared_ptr<storm::models::sparse::Model<double>> permuteStates(storm::models::sparse::Model<double> const& originalModel,
+                                                                             storm::utility::permutation::OrderKind order,
+                                                                             std::vector<uint64_t>* inverseStatePermutation);
+template std::shared_ptr<storm::models::sparse::Model<storm::RationalNumber>> permuteStates(
+    storm::models::sparse::Model<storm::RationalNumber> const& originalModel, storm::utility::permutation::OrderKind order,
+    std::vector<uint64_t>* inverseStatePermutation);
+template std::shared_ptr<storm::models::sparse::Model<storm::RationalFunction>> permuteStates(
+    storm::models::sparse::Model<storm::RationalFunction> const& originalModel, storm::utility::permutation::OrderKind order,
+    std::vector<uint64_t>* inverseStatePermutation);
+template std::shared_ptr<storm::models::sparse::Model<storm::Interval>> permuteStates(storm::models::sparse::Model<storm::Interval> const& originalModel,
+                                                                                     storm::utility::permutation::OrderKind order,
+                                                                                     std::vector<uint64_t>* inverseStatePermutation);
+
+}  // namespace transformer
+}  // namespace storm
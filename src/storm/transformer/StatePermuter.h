@@ -0,0 +1,52 @@
+#pragma once
+
+#include <memory>
+#include <vector>
+
+#include "storm/models/sparse/Model.h"
+#include "storm/models/sparse/StandardRewardModel.h"
+#include "storm/utility/permutation.h"
+
+namespace storm {
+namespace transformer {
+
+/*!
+ * Builds a model that coincides with the given model up to a renaming of the states.
+ * The state labeling, reward models, choice labeling, state valuations, and choice origins are permuted accordingly.
+ * The choices of each state keep their relative order.
+ *
+ * @param originalModel The original model.
+ * @param inverseStatePermutation For each state of the resulting model, the index of the corresponding state in the original model.
+ * @return The permuted model.
+ */
+template<typename ValueType, typename RewardModelType = storm::models::sparse::StandardRewardModel<ValueType>>
+std::shared_ptr<storm::models::sparse::Model<ValueType, RewardModelType>> permuteStates(
+    storm::models::sparse::Model<ValueType, RewardModelType> const& originalModel, std::vector<uint64_t> const& inverseStatePermutation);
+
+/*!
+ * Builds a model with the states of the given model reordered according to the given order.
+ * @see storm::utility::permutation::createPermutation
+ * @param inverseStatePermutation if given, the used inverse permutation is stored here. It can be used to map results back to the original model.
+ */
+template<typename ValueType, typename RewardModelType = storm::models::sparse::StandardRewardModel<ValueType>>
+std::shared_ptr<storm::models::sparse::Model<ValueType, RewardModelType>> permuteStates(
+    storm::models::sparse::Model<ValueType, RewardModelType> const& originalModel, storm::utility::permutation::OrderKind order,
+    std::vector<uint64_t>* inverseStatePermutation = nullptr);
+
+/*!
+ * Maps the given state values of a permuted model back to the states of the original model.
+ * @param permutedValues the values for each state of the permuted model
+ * @param inverseStatePermutation the inverse permutation that has been used to obtain the permuted model
+ * @return the values for each state of the original model
+ */
+template<typename T>
+std::vector<T> restoreOriginalStateOrder(std::vector<T> const& permutedValues, std::vector<uint64_t> const& inverseStatePermutation) {
+    std::vector<T> result(permutedValues.size());
+    for (uint64_t newState = 0; newState < inverseStatePermutation.size(); ++newState) {
+        result[inverseStatePermutation[newState]] = permutedValues[newState];
+    }
+    return result;
+}
+
+}  // namespace transformer
+}  // namespace storm
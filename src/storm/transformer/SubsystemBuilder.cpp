@@ -65,11 +65,84 @@ RewardModelType transformRewardModel(RewardModelType const& originalRewardModel,
     return RewardModelType(std::move(stateRewardVector), std::move(stateActionRewardVector), std::move(transitionRewardMatrix));
 }
 
+template<typename RewardModelType>
+void restrictRewardModelInPlace(RewardModelType& rewardModel, storm::storage::BitVector const& subsystem, storm::storage::BitVector const& subsystemActions,
+                                bool makeRowGroupingTrivial) {
+    if (rewardModel.hasStateRewards()) {
+        storm::utility::vector::filterVectorInPlace(rewardModel.getStateRewardVector(), subsystem);
+    }
+    if (rewardModel.hasStateActionRewards()) {
+        storm::utility::vector::filterVectorInPlace(rewardModel.getStateActionRewardVector(), subsystemActions);
+    }
+    if (rewardModel.hasTransitionRewards()) {
+        auto& transitionRewardMatrix = rewardModel.getTransitionRewardMatrix();
+        transitionRewardMatrix.restrictInPlace(subsystemActions, subsystem);
+        if (makeRowGroupingTrivial) {
+            STORM_LOG_ASSERT(transitionRewardMatrix.getColumnCount() == transitionRewardMatrix.getRowCount(), "Matrix should be square");
+            transitionRewardMatrix.makeRowGroupingTrivial();
+        }
+    }
+}
+
+/*
+ * Moves the components out of the given model and restricts them to the subsystem in place. The model must not be used afterwards.
+ */
+template<typename ValueType, typename RewardModelType>
+void compactModelComponents(storm::models::sparse::Model<ValueType, RewardModelType>& model, storm::storage::BitVector const& subsystem,
+                            storm::storage::BitVector const& keptActions, storm::storage::BitVector const& deadlockStates, bool makeRowGroupingTrivial,
+                            storm::storage::sparse::ModelComponents<ValueType, RewardModelType>& components) {
+    if (model.isOfType(storm::models::ModelType::MarkovAutomaton)) {
+        auto& ma = *model.template as<storm::models::sparse::MarkovAutomaton<ValueType, RewardModelType>>();
+        components.markovianStates = ma.getMarkovianStates() % subsystem;
+        components.exitRates = std::move(ma.getExitRates());
+        storm::utility::vector::filterVectorInPlace(components.exitRates.get(), subsystem);
+        components.rateTransitions = false;  // Note that the transition matrix contains probabilities
+    } else if (model.isOfType(storm::models::ModelType::Ctmc)) {
+        auto& ctmc = *model.template as<storm::models::sparse::Ctmc<ValueType, RewardModelType>>();
+        components.exitRates = std::move(ctmc.getExitRateVector());
+        storm::utility::vector::filterVectorInPlace(components.exitRates.get(), subsystem);
+        components.rateTransitions = true;
+    } else {
+        STORM_LOG_THROW(model.isOfType(storm::models::ModelType::Dtmc) || model.isOfType(storm::models::ModelType::Mdp), storm::exceptions::UnexpectedException,
+                        "Unexpected model type.");
+    }
+
+    components.transitionMatrix = std::move(model.getTransitionMatrix());
+    if (!deadlockStates.empty()) {
+        // make deadlock choices a selfloop
+        components.transitionMatrix.makeRowGroupsAbsorbing(deadlockStates);
+    }
+    components.transitionMatrix.restrictInPlace(keptActions, subsystem, !deadlockStates.empty());
+    if (makeRowGroupingTrivial) {
+        STORM_LOG_ASSERT(components.transitionMatrix.getColumnCount() == components.transitionMatrix.getRowCount(), "Matrix should be square");
+        components.transitionMatrix.makeRowGroupingTrivial();
+    }
+
+    components.stateLabeling = std::move(model.getStateLabeling());
+    components.stateLabeling.restrictItems(subsystem);
+    for (auto& rewardModel : model.getRewardModels()) {
+        restrictRewardModelInPlace(rewardModel.second, subsystem, keptActions, makeRowGroupingTrivial);
+        components.rewardModels.emplace(rewardModel.first, std::move(rewardModel.second));
+    }
+    if (model.hasChoiceLabeling()) {
+        components.choiceLabeling = std::move(model.getOptionalChoiceLabeling());
+        components.choiceLabeling->restrictItems(keptActions);
+    }
+    // State valuations and choice origins can not be restricted in place.
+    if (model.hasStateValuations()) {
+        components.stateValuations = model.getStateValuations().selectStates(subsystem);
+    }
+    if (model.hasChoiceOrigins()) {
+        components.choiceOrigins = model.getChoiceOrigins()->selectChoices(keptActions);
+    }
+}
+
 template<typename ValueType, typename RewardModelType>
 SubsystemBuilderReturnType<ValueType, RewardModelType> internalBuildSubsystem(storm::models::sparse::Model<ValueType, RewardModelType> const& originalModel,
                                                                               storm::storage::BitVector const& subsystemStates,
                                                                               storm::storage::BitVector const& subsystemActions,
-                                                                              SubsystemBuilderOptions const& options) {
+                                                                              SubsystemBuilderOptions const& options,
+                                                                              storm::models::sparse::Model<ValueType, RewardModelType>* modelToCompact) {
     auto const& groupIndices = originalModel.getTransitionMatrix().getRowGroupIndices();
     SubsystemBuilderReturnType<ValueType, RewardModelType> result;
     uint_fast64_t subsystemStateCount = subsystemStates.getNumberOfSetBits();
@@ -131,33 +204,38 @@ SubsystemBuilderReturnType<ValueType, RewardModelType> internalBuildSubsystem(st
 
     // Transform the components of the model
     storm::storage::sparse::ModelComponents<ValueType, RewardModelType> components;
-    if (hasDeadlockStates) {
-        // make deadlock choices a selfloop
-        components.transitionMatrix = originalModel.getTransitionMatrix();
-        components.transitionMatrix.makeRowGroupsAbsorbing(deadlockStates);
-        components.transitionMatrix.dropZeroEntries();
-        components.transitionMatrix = components.transitionMatrix.getSubmatrix(false, keptActions, subsystemStates);
+    if (modelToCompact) {
+        compactModelComponents(*modelToCompact, subsystemStates, keptActions, deadlockStates, options.makeRowGroupingTrivial, components);
     } else {
-        components.transitionMatrix = originalModel.getTransitionMatrix().getSubmatrix(false, keptActions, subsystemStates);
-    }
-    if (options.makeRowGroupingTrivial) {
-        STORM_LOG_ASSERT(components.transitionMatrix.getColumnCount() == components.transitionMatrix.getRowCount(), "Matrix should be square");
-        components.transitionMatrix.makeRowGroupingTrivial();
-    }
+        if (hasDeadlockStates) {
+            // make deadlock choices a selfloop
+            components.transitionMatrix = originalModel.getTransitionMatrix();
+            components.transitionMatrix.makeRowGroupsAbsorbing(deadlockStates);
+            components.transitionMatrix.dropZeroEntries();
+            components.transitionMatrix = components.transitionMatrix.getSubmatrix(false, keptActions, subsystemStates);
+        } else {
+            components.transitionMatrix = originalModel.getTransitionMatrix().getSubmatrix(false, keptActions, subsystemStates);
+        }
+        if (options.makeRowGroupingTrivial) {
+            STORM_LOG_ASSERT(components.transitionMatrix.getColumnCount() == components.transitionMatrix.getRowCount(), "Matrix should be square");
+            components.transitionMatrix.makeRowGroupingTrivial();
+        }
 
-    components.stateLabeling = originalModel.getStateLabeling().getSubLabeling(subsystemStates);
-    for (auto const& rewardModel : originalModel.getRewardModels()) {
-        components.rewardModels.insert(
-            std::make_pair(rewardModel.first, transformRewardModel(rewardModel.second, subsystemStates, keptActions, options.makeRowGroupingTrivial)));
-    }
-    if (originalModel.hasChoiceLabeling()) {
-        components.choiceLabeling = originalModel.getChoiceLabeling().getSubLabeling(keptActions);
-    }
-    if (originalModel.hasStateValuations()) {
-        components.stateValuations = originalModel.getStateValuations().selectStates(subsystemStates);
-    }
-    if (originalModel.hasChoiceOrigins()) {
-        components.choiceOrigins = originalModel.getChoiceOrigins()->selectChoices(keptActions);
+        components.stateLabeling = originalModel.getStateLabeling().getSubLabeling(subsystemStates);
+        for (auto const& rewardModel : originalModel.getRewardModels()) {
+            components.rewardModels.insert(
+                std::make_pair(rewardModel.first, transformRewardModel(rewardModel.second, subsystemStates, keptActions, options.makeRowGroupingTrivial)));
+        }
+        if (originalModel.hasChoiceLabeling()) {
+            components.choiceLabeling = originalModel.getChoiceLabeling().getSubLabeling(keptActions);
+        }
+        if (originalModel.hasStateValuations()) {
+            components.stateValuations = originalModel.getStateValuations().selectStates(subsystemStates);
+        }
+        if (originalModel.hasChoiceOrigins()) {
+            components.choiceOrigins = originalModel.getChoiceOrigins()->selectChoices(keptActions);
+        }
+        transformModelSpecificComponents<ValueType, RewardModelType>(originalModel, subsystemStates, components);
     }
 
     if (hasDeadlockStates) {
@@ -193,7 +271,6 @@ SubsystemBuilderReturnType<ValueType, RewardModelType> internalBuildSubsystem(st
         components.stateLabeling.addLabel(result.deadlockLabel.get(), std::move(subDeadlockStates));
     }
 
-    transformModelSpecificComponents<ValueType, RewardModelType>(originalModel, subsystemStates, components);
     models::ModelType newModelType = originalModel.getType();
     if (components.transitionMatrix.hasTrivialRowGrouping() && originalModel.getType() == models::ModelType::Mdp) {
         newModelType = models::ModelType::Dtmc;
@@ -204,24 +281,48 @@ SubsystemBuilderReturnType<ValueType, RewardModelType> internalBuildSubsystem(st
 }
 
 template<typename ValueType, typename RewardModelType>
-SubsystemBuilderReturnType<ValueType, RewardModelType> buildSubsystem(storm::models::sparse::Model<ValueType, RewardModelType> const& originalModel,
-                                                                      storm::storage::BitVector const& subsystemStates,
-                                                                      storm::storage::BitVector const& subsystemActions, bool keepUnreachableStates,
-                                                                      SubsystemBuilderOptions options) {
+SubsystemBuilderReturnType<ValueType, RewardModelType> prepareAndBuildSubsystem(storm::models::sparse::Model<ValueType, RewardModelType> const& originalModel,
+                                                                                storm::storage::BitVector const& subsystemStates,
+                                                                                storm::storage::BitVector const& subsystemActions, bool keepUnreachableStates,
+                                                                                SubsystemBuilderOptions const& options,
+                                                                                storm::models::sparse::Model<ValueType, RewardModelType>* modelToCompact) {
     STORM_LOG_DEBUG("Invoked subsystem builder on model with " << originalModel.getNumberOfStates() << " states.");
     storm::storage::BitVector initialStates = originalModel.getInitialStates() & subsystemStates;
     STORM_LOG_THROW(!initialStates.empty(), storm::exceptions::InvalidArgumentException, "The subsystem would not contain any initial states");
 
     STORM_LOG_THROW(!subsystemStates.empty(), storm::exceptions::InvalidArgumentException, "Invoked SubsystemBuilder for an empty subsystem.");
     if (keepUnreachableStates) {
-        return internalBuildSubsystem(originalModel, subsystemStates, subsystemActions, options);
+        return internalBuildSubsystem(originalModel, subsystemStates, subsystemActions, options, modelToCompact);
     } else {
         auto actualSubsystem = storm::utility::graph::getReachableStates(originalModel.getTransitionMatrix(), initialStates, subsystemStates,
                                                                          storm::storage::BitVector(subsystemStates.size(), false), false, 0, subsystemActions);
-        return internalBuildSubsystem(originalModel, actualSubsystem, subsystemActions, options);
+        return internalBuildSubsystem(originalModel, actualSubsystem, subsystemActions, options, modelToCompact);
     }
 }
 
+template<typename ValueType, typename RewardModelType>
+SubsystemBuilderReturnType<ValueType, RewardModelType> buildSubsystem(storm::models::sparse::Model<ValueType, RewardModelType> const& originalModel,
+                                                                      storm::storage::BitVector const& subsystemStates,
+                                                                      storm::storage::BitVector const& subsystemActions, bool keepUnreachableStates,
+                                                                      SubsystemBuilderOptions options) {
+    return prepareAndBuildSubsystem(originalModel, subsystemStates, subsystemActions, keepUnreachableStates, options, nullptr);
+}
+
+template<typename ValueType, typename RewardModelType>
+SubsystemBuilderReturnType<ValueType, RewardModelType> buildSubsystemInPlace(
+    std::shared_ptr<storm::models::sparse::Model<ValueType, RewardModelType>>&& originalModel, storm::storage::BitVector const& subsystemStates,
+    storm::storage::BitVector const& subsystemActions, bool keepUnreachableStates, SubsystemBuilderOptions options) {
+    STORM_LOG_THROW(originalModel, storm::exceptions::InvalidArgumentException, "Invoked SubsystemBuilder without a model.");
+    std::shared_ptr<storm::models::sparse::Model<ValueType, RewardModelType>> model = std::move(originalModel);
+    if (model.use_count() > 1) {
+        STORM_LOG_DEBUG("The model is shared, so the subsystem is built from a copy of its components.");
+        return prepareAndBuildSubsystem(*model, subsystemStates, subsystemActions, keepUnreachableStates, options, nullptr);
+    }
+    // The selections might refer to components of the model (e.g., its labeling), which are modified during the compaction.
+    storm::storage::BitVector selectedStates(subsystemStates), selectedActions(subsystemActions);
+    return prepareAndBuildSubsystem(*model, selectedStates, selectedActions, keepUnreachableStates, options, model.get());
+}
+
 template SubsystemBuilderReturnType<double> buildSubsystem(storm::models::sparse::Model<double> const& originalModel,
                                                            storm::storage::BitVector const& subsystemStates, storm::storage::BitVector const& subsystemActions,
                                                            bool keepUnreachableStates = true, SubsystemBuilderOptions options = SubsystemBuilderOptions());
@@ -243,5 +344,24 @@ template SubsystemBuilderReturnType<storm::Interval> buildSubsystem(storm::model
                                                                     storm::storage::BitVector const& subsystemActions, bool keepUnreachableStates = true,
                                                                     SubsystemBuilderOptions options = SubsystemBuilderOptions());
 
+template SubsystemBuilderReturnType<double> buildSubsystemInPlace(std::shared_ptr<storm::models::sparse::Model<double>>&& originalModel,
+                                                                  storm::storage::BitVector const& subsystemStates,
+                                                                  storm::storage::BitVector const& subsystemActions, bool keepUnreachableStates = true,
+                                                                  SubsystemBuilderOptions options = SubsystemBuilderOptions());
+template SubsystemBuilderReturnType<double, storm::models::sparse::StandardRewardModel<storm::Interval>> buildSubsystemInPlace(
+    std::shared_ptr<storm::models::sparse::Model<double, storm::models::sparse::StandardRewardModel<storm::Interval>>>&& originalModel,
+    storm::storage::BitVector const& subsystemStates, storm::storage::BitVector const& subsystemActions, bool keepUnreachableStates = true,
+    SubsystemBuilderOptions options = SubsystemBuilderOptions());
+template SubsystemBuilderReturnType<storm::RationalNumber> buildSubsystemInPlace(
+    std::shared_ptr<storm::models::sparse::Model<storm::RationalNumber>>&& originalModel, storm::storage::BitVector const& subsystemStates,
+    storm::storage::BitVector const& subsystemActions, bool keepUnreachableStates = true, SubsystemBuilderOptions options = SubsystemBuilderOptions());
+template SubsystemBuilderReturnType<storm::RationalFunction> buildSubsystemInPlace(
+    std::shared_ptr<storm::models::sparse::Model<storm::RationalFunction>>&& originalModel, storm::storage::BitVector const& subsystemStates,
+    storm::storage::BitVector const& subsystemActions, bool keepUnreachableStates = true, SubsystemBuilderOptions options = SubsystemBuilderOptions());
+template SubsystemBuilderReturnType<storm::Interval> buildSubsystemInPlace(std::shared_ptr<storm::models::sparse::Model<storm::Interval>>&& originalModel,
+                                                                           storm::storage::BitVector const& subsystemStates,
+                                                                           storm::storage::BitVector const& subsystemActions, bool keepUnreachableStates = true,
+                                                                           SubsystemBuilderOptions options = SubsystemBuilderOptions());
+
 }  // namespace transformer
 }  // namespace storm
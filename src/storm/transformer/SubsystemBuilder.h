@@ -59,5 +59,21 @@ SubsystemBuilderReturnType<ValueType, RewardModelType> buildSubsystem(storm::mod
                                                                       storm::storage::BitVector const& subsystemActions, bool keepUnreachableStates = true,
                                                                       SubsystemBuilderOptions options = SubsystemBuilderOptions());
 
+/*
+ * Removes all states and actions that are not part of the subsystem (see buildSubsystem).
+ * If the given pointer is the sole owner of the model, the components of the model (transition matrix, labelings, reward models and model specific
+ * components) are moved into the resulting model and compacted in place, such that no second copy of the model is created. Otherwise, the
+ * components are copied as in buildSubsystem. In both cases, the given pointer is reset.
+ *
+ * @param originalModel The original model.
+ * @param subsystemStates The selected states.
+ * @param subsystemActions The selected actions
+ * @param keepUnreachableStates if true, states that are not reachable from the initial state are kept
+ */
+template<typename ValueType, typename RewardModelType = storm::models::sparse::StandardRewardModel<ValueType>>
+SubsystemBuilderReturnType<ValueType, RewardModelType> buildSubsystemInPlace(
+    std::shared_ptr<storm::models::sparse::Model<ValueType, RewardModelType>>&& originalModel, storm::storage::BitVector const& subsystemStates,
+    storm::storage::BitVector const& subsystemActions, bool keepUnreachableStates = true, SubsystemBuilderOptions options = SubsystemBuilderOptions());
+
 }  // namespace transformer
 }  // namespace storm
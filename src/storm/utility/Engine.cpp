@@ -6,6 +6,7 @@
 #include "storm/modelchecker/prctl/SparseDtmcPrctlModelChecker.h"
 #include "storm/modelchecker/prctl/SparseMdpPrctlModelChecker.h"
 #include "storm/modelchecker/rpatl/SparseSmgRpatlModelChecker.h"
+#include "storm/modelchecker/smc/StatisticalModelChecker.h"
 #include "storm/models/sparse/StandardRewardModel.h"
 #include "storm/models/symbolic/MarkovAutomaton.h"
 #include "storm/models/symbolic/StandardRewardModel.h"
@@ -52,6 +53,8 @@ std::string toString(Engine const& engine) {
             return "expl";
         case Engine::AbstractionRefinement:
             return "abs";
+        case Engine::Statistical:
+            return "smc";
         case Engine::Automatic:
             return "automatic";
         case Engine::Unknown:
@@ -95,6 +98,8 @@ storm::builder::BuilderType getBuilderType(Engine const& engine) {
             return storm::builder::BuilderType::Explicit;
         case Engine::AbstractionRefinement:
             return storm::builder::BuilderType::Dd;
+        case Engine::Statistical:
+            return storm::builder::BuilderType::Explicit;
         default:
             STORM_LOG_THROW(false, storm::exceptions::InvalidArgumentException, "The given engine has no builder type to it.");
             return storm::builder::BuilderType::Explicit;
@@ -190,6 +195,21 @@ bool canHandle(storm::utility::Engine const& engine, storm::storage::SymbolicMod
                     return false;
             }
             break;
+        case Engine::Statistical:
+            // The statistical model checker is only available for floating point values.
+            if constexpr (std::is_same_v<ValueType, double>) {
+                switch (modelType) {
+                    case ModelType::DTMC:
+                        return storm::modelchecker::StatisticalModelChecker<storm::models::sparse::Dtmc<ValueType>>::canHandleStatic(checkTask);
+                    case ModelType::MDP:
+                    case ModelType::CTMC:
+                    case ModelType::MA:
+                    case ModelType::POMDP:
+                    case ModelType::SMG:
+                        return false;
+                }
+            }
+            return false;
         default:
             STORM_LOG_ERROR("The selected engine " << engine << " is not considered.");
     }
@@ -251,6 +271,7 @@ bool canHandle<storm::RationalFunction>(storm::utility::Engine const& engine, st
             break;
         case Engine::Exploration:
         case Engine::AbstractionRefinement:
+        case Engine::Statistical:
             return false;
         default:
             STORM_LOG_ERROR("The selected engine" << engine << " is not considered.");
@@ -131,6 +131,8 @@ void Extremum<Dir, ValueType>::reset() {
     }
 }
 
+template class Extremum<storm::OptimizationDirection::Minimize, float>;
+template class Extremum<storm::OptimizationDirection::Maximize, float>;
 template class Extremum<storm::OptimizationDirection::Minimize, double>;
 template class Extremum<storm::OptimizationDirection::Maximize, double>;
 template class Extremum<storm::OptimizationDirection::Minimize, storm::RationalNumber>;
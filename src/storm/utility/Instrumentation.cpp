@@ -0,0 +1,258 @@
+#include "storm/utility/Instrumentation.h"
+
+#include <algorithm>
+#include <fstream>
+#include <iomanip>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+#include "storm/io/file.h"
+
+namespace storm {
+namespace utility {
+namespace instrumentation {
+
+namespace detail {
+std::atomic<bool> enabled{false};
+}  // namespace detail
+
+namespace {
+
+struct RegionEvent {
+    char const* name;
+    uint64_t start;
+    uint64_t end;
+};
+
+struct MemorySample {
+    char const* name;
+    uint64_t time;
+    uint64_t bytes;
+};
+
+// The data recorded by a single thread.
+struct ThreadData {
+    uint64_t threadIndex;
+    std::vector<RegionEvent> events;
+    std::unordered_map<char const*, uint64_t> counters;
+    std::vector<MemorySample> memorySamples;
+};
+
+class Recorder {
+   public:
+    Recorder() : origin(std::chrono::steady_clock::now()) {
+        // Intentionally left empty.
+    }
+
+    uint64_t now() const {
+        return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - origin).count();
+    }
+
+    ThreadData& getThreadData() {
+        // The data of a thread is kept alive until the end of the program, so the pointer never dangles.
+        thread_local ThreadData* threadData = nullptr;
+        if (!threadData) {
+            std::lock_guard<std::mutex> lock(mutex);
+            threads.push_back(std::make_unique<ThreadData>());
+            threads.back()->threadIndex = threads.size() - 1;
+            threadData = threads.back().get();
+        }
+        return *threadData;
+    }
+
+    template<typename Callback>
+    void forEachThread(Callback const& callback) {
+        std::lock_guard<std::mutex> lock(mutex);
+        for (auto const& thread : threads) {
+            callback(*thread);
+        }
+    }
+
+   private:
+    std::chrono::steady_clock::time_point origin;
+    std::mutex mutex;
+    std::vector<std::unique_ptr<ThreadData>> threads;
+};
+
+Recorder& getRecorder() {
+    static Recorder recorder;
+    return recorder;
+}
+
+// A node in the tree of nested regions.
+struct RegionNode {
+    uint64_t calls = 0;
+    uint64_t totalTime = 0;
+    std::map<std::string, RegionNode> children;
+};
+
+/*!
+ * Sorts the events of the given thread such that each region comes right before the regions nested in it.
+ */
+std::vector<RegionEvent> getSortedEvents(ThreadData const& thread) {
+    std::vector<RegionEvent> events = thread.events;
+    std::sort(events.begin(), events.end(), [](RegionEvent const& lhs, RegionEvent const& rhs) {
+        return lhs.start < rhs.start || (lhs.start == rhs.start && lhs.end > rhs.end);
+    });
+    return events;
+}
+
+void addToTree(RegionNode& root, ThreadData const& thread) {
+    // The stack of currently open regions, given by their end time and their node in the tree.
+    std::vector<std::pair<uint64_t, RegionNode*>> openRegions;
+    for (auto const& event : getSortedEvents(thread)) {
+        while (!openRegions.empty() && openRegions.back().first <= event.start) {
+            openRegions.pop_back();
+        }
+        RegionNode& parent = openRegions.empty() ? root : *openRegions.back().second;
+        RegionNode& node = parent.children[event.name];
+        ++node.calls;
+        node.totalTime += event.end - event.start;
+        openRegions.emplace_back(event.end, &node);
+    }
+}
+
+void printTree(std::ostream& out, std::map<std::string, RegionNode> const& nodes, uint64_t depth) {
+    for (auto const& [name, node] : nodes) {
+        std::string indentedName = std::string(2 * depth, ' ') + name;
+        out << "  " << std::left << std::setw(50) << indentedName << std::right << std::setw(10) << node.calls << std::setw(14) << std::fixed
+            << std::setprecision(3) << static_cast<double>(node.totalTime) / 1e9 << "s\n";
+        printTree(out, node.children, depth + 1);
+    }
+}
+
+std::map<std::string, uint64_t> getCounterTotals() {
+    std::map<std::string, uint64_t> totals;
+    getRecorder().forEachThread([&totals](ThreadData const& thread) {
+        for (auto const& counter : thread.counters) {
+            totals[counter.first] += counter.second;
+        }
+    });
+    return totals;
+}
+
+std::map<std::string, uint64_t> getPeakMemory() {
+    std::map<std::string, uint64_t> peaks;
+    getRecorder().forEachThread([&peaks](ThreadData const& thread) {
+        for (auto const& sample : thread.memorySamples) {
+            auto& peak = peaks[sample.name];
+            peak = std::max(peak, sample.bytes);
+        }
+    });
+    return peaks;
+}
+
+std::string escape(std::string const& name) {
+    std::string result;
+    for (char c : name) {
+        if (c == '"' || c == '\\') {
+            result += '\\';
+        }
+        result += c;
+    }
+    return result;
+}
+
+}  // namespace
+
+namespace detail {
+uint64_t now() {
+    return getRecorder().now();
+}
+
+void recordRegion(char const* name, uint64_t start, uint64_t end) {
+    getRecorder().getThreadData().events.push_back({name, start, end});
+}
+
+void recordCounter(char const* name, uint64_t value) {
+    getRecorder().getThreadData().counters[name] += value;
+}
+
+void recordMemory(char const* name, uint64_t bytes) {
+    getRecorder().getThreadData().memorySamples.push_back({name, now(), bytes});
+}
+}  // namespace detail
+
+void setEnabled(bool enabled) {
+    detail::enabled.store(enabled, std::memory_order_relaxed);
+}
+
+void printSummary(std::ostream& out) {
+    RegionNode root;
+    getRecorder().forEachThread([&root](ThreadData const& thread) { addToTree(root, thread); });
+    auto counters = getCounterTotals();
+    auto memory = getPeakMemory();
+    if (root.children.empty() && counters.empty() && memory.empty()) {
+        return;
+    }
+
+    std::ios_base::fmtflags oldFlags(out.flags());
+    out << "Instrumented regions (accumulated over all threads):\n";
+    out << "  " << std::left << std::setw(50) << "region" << std::right << std::setw(10) << "calls" << std::setw(15) << "time" << '\n';
+    printTree(out, root.children, 0);
+    if (!counters.empty()) {
+        out << "Counters:\n";
+        for (auto const& counter : counters) {
+            out << "  " << std::left << std::setw(50) << counter.first << std::right << std::setw(24) << counter.second << '\n';
+        }
+    }
+    if (!memory.empty()) {
+        out << "Memory (largest recorded size):\n";
+        for (auto const& peak : memory) {
+            out << "  " << std::left << std::setw(50) << peak.first << std::right << std::setw(21) << std::fixed << std::setprecision(3)
+                << static_cast<double>(peak.second) / (1024 * 1024) << "MB\n";
+        }
+    }
+    out.flags(oldFlags);
+}
+
+void exportChromeTrace(std::string const& filename) {
+    std::ofstream stream;
+    storm::utility::openFile(filename, stream);
+    stream << "{\"traceEvents\":[\n";
+    bool first = true;
+    auto separator = [&first]() {
+        char const* result = first ? "" : ",\n";
+        first = false;
+        return result;
+    };
+    uint64_t end = 0;
+    stream << std::fixed << std::setprecision(3);
+    getRecorder().forEachThread([&](ThreadData const& thread) {
+        stream << separator() << R"({"name":"thread_name","ph":"M","pid":0,"tid":)" << thread.threadIndex << R"(,"args":{"name":"thread )"
+               << thread.threadIndex << "\"}}";
+        // Timestamps and durations are given in microseconds.
+        for (auto const& event : getSortedEvents(thread)) {
+            stream << separator() << R"({"name":")" << escape(event.name) << R"(","cat":"storm","ph":"X","pid":0,"tid":)" << thread.threadIndex
+                   << ",\"ts\":" << static_cast<double>(event.start) / 1e3 << ",\"dur\":" << static_cast<double>(event.end - event.start) / 1e3 << "}";
+            end = std::max(end, event.end);
+        }
+        for (auto const& sample : thread.memorySamples) {
+            stream << separator() << R"({"name":")" << escape(sample.name) << R"( (bytes)","ph":"C","pid":0,"tid":0,"ts":)"
+                   << static_cast<double>(sample.time) / 1e3 << R"(,"args":{"value":)" << sample.bytes << "}}";
+            end = std::max(end, sample.time);
+        }
+    });
+    // Counters are only accumulated, so they are reported once at the end of the trace.
+    for (auto const& counter : getCounterTotals()) {
+        stream << separator() << R"({"name":")" << escape(counter.first) << R"(","ph":"C","pid":0,"tid":0,"ts":)" << static_cast<double>(end) / 1e3
+               << R"(,"args":{"value":)" << counter.second << "}}";
+    }
+    stream << "\n]}\n";
+    storm::utility::closeFile(stream);
+}
+
+void reset() {
+    getRecorder().forEachThread([](ThreadData& thread) {
+        thread.events.clear();
+        thread.counters.clear();
+        thread.memorySamples.clear();
+    });
+}
+
+}  // namespace instrumentation
+}  // namespace utility
+}  // namespace storm
@@ -0,0 +1,111 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <iosfwd>
+#include <string>
+
+namespace storm {
+namespace utility {
+namespace instrumentation {
+
+/*!
+ * A central, low-overhead instrumentation of where time is spent. Code can be annotated with (nested) regions and counters:
+ *
+ *   storm::utility::instrumentation::ScopedRegion region("value iteration");
+ *   storm::utility::instrumentation::addToCounter("value iteration: iterations", numIterations);
+ *   storm::utility::instrumentation::recordMemory("explicit model building: transition matrix", matrix.getSizeInMemory());
+ *
+ * Recording is disabled by default, in which case regions and counters only cost a single check of an atomic flag. Once enabled, each thread
+ * records into its own buffer, so no synchronization is necessary. The recorded data can be printed as a hierarchical summary or exported in
+ * the Chrome trace event format, which can be viewed with chrome://tracing or https://ui.perfetto.dev.
+ *
+ * The names of regions and counters need to be string literals (or otherwise outlive the recording). Reporting (and resetting) must not happen
+ * while instrumented code is running on other threads.
+ */
+
+namespace detail {
+extern std::atomic<bool> enabled;
+
+uint64_t now();
+void recordRegion(char const* name, uint64_t start, uint64_t end);
+void recordCounter(char const* name, uint64_t value);
+void recordMemory(char const* name, uint64_t bytes);
+}  // namespace detail
+
+/*!
+ * Enables or disables the recording.
+ */
+void setEnabled(bool enabled);
+
+/*!
+ * Retrieves whether the recording is enabled.
+ */
+inline bool isEnabled() {
+    return detail::enabled.load(std::memory_order_relaxed);
+}
+
+/*!
+ * Adds the given value to the counter with the given name.
+ */
+inline void addToCounter(char const* name, uint64_t value = 1) {
+    if (isEnabled()) {
+        detail::recordCounter(name, value);
+    }
+}
+
+/*!
+ * Records that the data structure with the given name currently occupies the given number of bytes. The summary reports the largest recorded
+ * size for each name, the trace contains all samples over time.
+ */
+inline void recordMemory(char const* name, uint64_t bytes) {
+    if (isEnabled()) {
+        detail::recordMemory(name, bytes);
+    }
+}
+
+/*!
+ * Records the time between its construction and its destruction as a region with the given name.
+ * Regions that are opened (on the same thread) while this region is open are nested into this region.
+ */
+class ScopedRegion {
+   public:
+    explicit ScopedRegion(char const* name) : name(isEnabled() ? name : nullptr), start(this->name ? detail::now() : 0) {
+        // Intentionally left empty.
+    }
+
+    ~ScopedRegion() {
+        if (name) {
+            detail::recordRegion(name, start, detail::now());
+        }
+    }
+
+    ScopedRegion(ScopedRegion const&) = delete;
+    ScopedRegion& operator=(ScopedRegion const&) = delete;
+
+   private:
+    // The name of the region or nullptr if the recording was disabled when the region was opened.
+    char const* name;
+    uint64_t start;
+};
+
+/*!
+ * Prints the recorded regions (as a tree of nested regions with their number of calls and accumulated times), the totals of all counters and
+ * the peak sizes of all recorded data structures.
+ */
+void printSummary(std::ostream& out);
+
+/*!
+ * Exports the recorded regions, counters and memory samples in the Chrome trace event format.
+ */
+void exportChromeTrace(std::string const& filename);
+
+/*!
+ * Discards everything that was recorded so far.
+ */
+void reset();
+
+}  // namespace instrumentation
+}  // namespace utility
+}  // namespace storm
@@ -1,5 +1,9 @@
 #include "storm/utility/KwekMehlhorn.h"
 
+#include <cmath>
+#include <limits>
+#include <type_traits>
+
 #include "storm/adapters/RationalNumberAdapter.h"
 
 #include "storm/utility/constants.h"
@@ -52,10 +56,43 @@ std::pair<typename NumberTraits<RationalType>::IntegerType, typename NumberTrait
                           storm::utility::convertNumber<typename NumberTraits<RationalType>::IntegerType>(powerOfTen));
 }
 
+namespace {
+/*!
+ * Performs the same computation as findRational on integers that fit into machine words, which avoids allocating arbitrary precision integers.
+ * All intermediate results are bounded by the given (non-negative) arguments.
+ */
+std::pair<uint64_t, uint64_t> findRationalInMachineWords(uint64_t alpha, uint64_t beta, uint64_t gamma, uint64_t delta) {
+    uint64_t alphaDivBeta = alpha / beta;
+    uint64_t alphaModBeta = alpha % beta;
+    uint64_t gammaDivDelta = gamma / delta;
+    uint64_t gammaModDelta = gamma % delta;
+
+    if (alphaDivBeta == gammaDivDelta && alphaModBeta != 0) {
+        std::pair<uint64_t, uint64_t> subresult = findRationalInMachineWords(delta, gammaModDelta, beta, alphaModBeta);
+        return std::make_pair(alphaDivBeta * subresult.first + subresult.second, subresult.first);
+    } else {
+        return std::make_pair(alphaModBeta == 0 ? alphaDivBeta : alphaDivBeta + 1, static_cast<uint64_t>(1));
+    }
+}
+}  // namespace
+
 template<typename RationalType, typename ImpreciseType>
 RationalType findRational(uint64_t precision, ImpreciseType const& value) {
     typedef typename NumberTraits<RationalType>::IntegerType IntegerType;
 
+    if constexpr (std::is_same_v<ImpreciseType, double>) {
+        // For the precisions that doubles support, the truncated value and the power of ten fit into machine words, so the (typically small)
+        // result can be computed without arbitrary precision arithmetic and only needs to be converted at the end.
+        if (precision <= static_cast<uint64_t>(std::numeric_limits<double>::max_digits10) && value >= 0.0 && value < 1.0) {
+            double powerOfTen = std::pow(10, precision);
+            uint64_t truncated = static_cast<uint64_t>(std::trunc(value * powerOfTen));
+            uint64_t denominator = static_cast<uint64_t>(powerOfTen);
+            std::pair<uint64_t, uint64_t> result = findRationalInMachineWords(truncated, denominator, truncated + 1, denominator);
+            return storm::utility::convertNumber<RationalType>(static_cast<uint_fast64_t>(result.first)) /
+                   storm::utility::convertNumber<RationalType>(static_cast<uint_fast64_t>(result.second));
+        }
+    }
+
     std::pair<IntegerType, IntegerType> truncatedFraction = truncateToRational<RationalType>(value, precision);
     std::pair<IntegerType, IntegerType> result = findRational<IntegerType>(
         truncatedFraction.first, truncatedFraction.second, truncatedFraction.first + storm::utility::one<IntegerType>(), truncatedFraction.second);
@@ -69,6 +106,10 @@ RationalType sharpen(uint64_t precision, ImpreciseType const& value) {
     ImpreciseType integer = storm::utility::floor(value);
     ImpreciseType fraction = value - integer;
     auto rational = findRational<RationalType>(precision, fraction);
+    if (storm::utility::isZero(integer)) {
+        // Avoid the conversion and addition for the common case of values in [0,1).
+        return rational;
+    }
     return storm::utility::convertNumber<RationalType>(integer) + rational;
 }
 
@@ -1,7 +1,10 @@
 #pragma once
 
+#include <algorithm>
+#include <chrono>
 #include <cstdint>
 #include <cstdlib>
+#include <optional>
 
 #include "storm-config.h"
 #include "storm/utility/OsDetection.h"
@@ -105,15 +108,124 @@ inline void resetTimeoutAlarm() {
     alarm(0);
 }
 
+namespace detail {
+// The point in time at which the computation of the current thread is to be aborted (if any).
+inline thread_local std::chrono::steady_clock::time_point threadDeadline = std::chrono::steady_clock::time_point::max();
+}  // namespace detail
+
 /*!
- * Check whether the program should terminate (due to some abort signal).
+ * Check whether the program should terminate (due to some abort signal) or the time limit of the current thread (if any) is exceeded.
  *
  * @return True iff program should terminate.
  */
 inline bool isTerminate() {
-    return SignalInformation::infos().isTerminate();
+    return SignalInformation::infos().isTerminate() ||
+           (detail::threadDeadline != std::chrono::steady_clock::time_point::max() && std::chrono::steady_clock::now() >= detail::threadDeadline);
+}
+
+/*!
+ * Limits the time of the computations of the current thread: once the limit is exceeded, isTerminate() holds on this thread (but not on others),
+ * so that these computations are aborted in the same way as for a timeout of the whole program.
+ * Note that computations which the current thread delegates to other threads do not observe this limit.
+ */
+class ThreadTimeLimit {
+   public:
+    explicit ThreadTimeLimit(std::chrono::milliseconds const& limit) : ThreadTimeLimit(std::chrono::steady_clock::now() + limit) {
+        // Intentionally left empty.
+    }
+
+    explicit ThreadTimeLimit(std::chrono::steady_clock::time_point const& deadline) : previousDeadline(detail::threadDeadline) {
+        detail::threadDeadline = std::min(previousDeadline, deadline);
+    }
+
+    ~ThreadTimeLimit() {
+        detail::threadDeadline = previousDeadline;
+    }
+
+    ThreadTimeLimit(ThreadTimeLimit const&) = delete;
+    ThreadTimeLimit& operator=(ThreadTimeLimit const&) = delete;
+
+    /*!
+     * @return True iff the limit is exceeded.
+     */
+    bool isExceeded() const {
+        return std::chrono::steady_clock::now() >= detail::threadDeadline;
+    }
+
+   private:
+    std::chrono::steady_clock::time_point previousDeadline;
+};
+
+namespace detail {
+// Counts (for the current thread) the computations that were performed and those that were stopped early because isTerminate() held.
+struct ComputationCounters {
+    uint64_t solvedEquationSystems = 0;
+    uint64_t abortedComputations = 0;
+    uint64_t abortedComputationsWithoutErrorBound = 0;
+    double lastErrorBound = 0.0;
+};
+inline thread_local ComputationCounters computationCounters;
+}  // namespace detail
+
+/*!
+ * Reports that an equation system was solved (regardless of whether the solver converged).
+ */
+inline void reportSolvedEquationSystem() {
+    ++detail::computationCounters.solvedEquationSystems;
 }
 
+/*!
+ * Reports that a computation was stopped early because isTerminate() held, such that its result is only an approximation.
+ * Every computation that stops early (and does not throw) has to report this, as otherwise the approximate result is taken to be precise.
+ *
+ * @param absoluteErrorBound If given, the absolute difference between each value of the approximate result and the precise value is at most
+ * this bound (as for the center of the bounds obtained by interval iteration).
+ */
+inline void reportAbortedComputation(std::optional<double> const& absoluteErrorBound = std::nullopt) {
+    ++detail::computationCounters.abortedComputations;
+    if (absoluteErrorBound) {
+        detail::computationCounters.lastErrorBound = *absoluteErrorBound;
+    } else {
+        ++detail::computationCounters.abortedComputationsWithoutErrorBound;
+    }
+}
+
+/*!
+ * Observes whether the computations that the current thread performs while this object exists are stopped early, i.e., whether their result
+ * is only an approximation.
+ */
+class ApproximationTracker {
+   public:
+    ApproximationTracker() : start(detail::computationCounters) {
+        // Intentionally left empty.
+    }
+
+    /*!
+     * @return True iff some computation was stopped early.
+     */
+    bool isApproximate() const {
+        return detail::computationCounters.abortedComputations > start.abortedComputations;
+    }
+
+    /*!
+     * Retrieves a bound on the absolute error of the approximate result. This is only available if the result stems from a single equation
+     * system whose solver was stopped early and could bound its error; errors of multiple (dependent) computations are not combined.
+     *
+     * @return The error bound (if available).
+     */
+    std::optional<double> getErrorBound() const {
+        auto const& current = detail::computationCounters;
+        if (current.solvedEquationSystems == start.solvedEquationSystems + 1 && current.abortedComputations == start.abortedComputations + 1 &&
+            current.abortedComputationsWithoutErrorBound == start.abortedComputationsWithoutErrorBound) {
+            return current.lastErrorBound;
+        }
+        return std::nullopt;
+    }
+
+   private:
+    detail::ComputationCounters start;
+};
+
 /*!
  * Register some signal handlers to detect and correctly handle abortion (due to timeout for example).
  */
@@ -959,6 +959,17 @@ template typename NumberTraits<double>::IntegerType trunc(double const& number);
 template double mod(double const& first, double const& second);
 template std::string to_string(double const& value);
 
+// float
+template float one();
+template float zero();
+template float infinity();
+template bool isOne(float const& value);
+template bool isZero(float const& value);
+template bool isInfinity(float const& value);
+template float abs(float const& number);
+template float convertNumber(double const& number);
+template double convertNumber(float const& number);
+
 // int
 template int one();
 template int zero();
@@ -3,11 +3,15 @@
 #include "storm/storage/dd/Add.h"
 #include "storm/storage/dd/Bdd.h"
 #include "storm/storage/dd/DdManager.h"
+#include "storm/storage/dd/PartitionedTransitionRelation.h"
 
 #include "storm/adapters/RationalFunctionAdapter.h"
 
 #include "storm/utility/macros.h"
 
+#include <algorithm>
+#include <chrono>
+
 namespace storm {
 namespace utility {
 namespace dd {
@@ -49,6 +53,119 @@ std::pair<storm::dd::Bdd<Type>, uint64_t> computeReachableStates(storm::dd::Bdd<
     return {reachableStates, iteration};
 }
 
+template<storm::dd::DdType Type>
+std::pair<storm::dd::Bdd<Type>, uint64_t> computeReachableStates(storm::dd::Bdd<Type> const& initialStates,
+                                                                 std::vector<storm::dd::Bdd<Type>> const& transitionPartitions,
+                                                                 std::set<storm::expressions::Variable> const& rowMetaVariables,
+                                                                 std::set<storm::expressions::Variable> const& columnMetaVariables,
+                                                                 storm::builder::DdReachabilityStrategy const& strategy) {
+    STORM_LOG_TRACE("Computing reachable states (" << strategy << ") for a transition relation with " << transitionPartitions.size() << " part(s).");
+
+    auto start = std::chrono::high_resolution_clock::now();
+    storm::dd::Bdd<Type> reachableStates = initialStates;
+    uint_fast64_t iteration = 0;
+
+    if (strategy == storm::builder::DdReachabilityStrategy::Bfs) {
+        bool changed = true;
+        do {
+            storm::dd::Bdd<Type> newReachableStates = initialStates.getDdManager().getBddZero();
+            for (auto const& partition : transitionPartitions) {
+                newReachableStates |= reachableStates.relationalProduct(partition, rowMetaVariables, columnMetaVariables);
+            }
+            newReachableStates &= !reachableStates;
+            changed = !newReachableStates.isZero();
+            reachableStates |= newReachableStates;
+            ++iteration;
+        } while (changed);
+    } else if (strategy == storm::builder::DdReachabilityStrategy::Chaining) {
+        // Apply the parts one after another such that later parts already see the states found by earlier ones.
+        bool changed = true;
+        do {
+            changed = false;
+            for (auto const& partition : transitionPartitions) {
+                storm::dd::Bdd<Type> newReachableStates =
+                    reachableStates.relationalProduct(partition, rowMetaVariables, columnMetaVariables) && !reachableStates;
+                if (!newReachableStates.isZero()) {
+                    changed = true;
+                    reachableStates |= newReachableStates;
+                }
+            }
+            ++iteration;
+        } while (changed);
+    } else {
+        // Saturate the states with respect to each part (starting with the lowest one) and go back to the lowest part
+        // whenever a part found new states.
+        uint64_t partitionIndex = 0;
+        while (partitionIndex < transitionPartitions.size()) {
+            storm::dd::Bdd<Type> const& partition = transitionPartitions[partitionIndex];
+            bool changed = false;
+            storm::dd::Bdd<Type> frontier = reachableStates;
+            while (true) {
+                frontier = frontier.relationalProduct(partition, rowMetaVariables, columnMetaVariables) && !reachableStates;
+                ++iteration;
+                if (frontier.isZero()) {
+                    break;
+                }
+                changed = true;
+                reachableStates |= frontier;
+            }
+            partitionIndex = (changed && partitionIndex > 0) ? 0 : partitionIndex + 1;
+        }
+    }
+
+    auto end = std::chrono::high_resolution_clock::now();
+    STORM_LOG_TRACE("Reachability computation completed in " << iteration << " iterations ("
+                                                             << std::chrono::duration_cast<std::chrono::milliseconds>(end - start).count() << "ms).");
+
+    return {reachableStates, iteration};
+}
+
+template<storm::dd::DdType Type>
+std::vector<storm::dd::Bdd<Type>> partitionTransitionRelation(
+    storm::dd::Bdd<Type> const& transitions,
+    std::vector<std::vector<std::pair<storm::expressions::Variable, storm::expressions::Variable>>> const& variableGroups) {
+    storm::dd::DdManager<Type> const& manager = transitions.getDdManager();
+
+    // Pair every non-empty part with the (top) level of its group's variables to sort them afterwards.
+    std::vector<std::pair<uint64_t, storm::dd::Bdd<Type>>> partitionsWithLevel;
+    for (auto const& group : variableGroups) {
+        if (group.empty()) {
+            continue;
+        }
+        storm::dd::Bdd<Type> groupIdentity = getRowColumnDiagonal(manager, group);
+        storm::dd::Bdd<Type> partition = transitions && !groupIdentity;
+        if (!partition.isZero()) {
+            partitionsWithLevel.emplace_back(groupIdentity.getLevel(), partition);
+        }
+    }
+    std::stable_sort(partitionsWithLevel.begin(), partitionsWithLevel.end(),
+                     [](std::pair<uint64_t, storm::dd::Bdd<Type>> const& first, std::pair<uint64_t, storm::dd::Bdd<Type>> const& second) {
+                         return first.first > second.first;
+                     });
+
+    std::vector<storm::dd::Bdd<Type>> result;
+    for (auto& partition : partitionsWithLevel) {
+        result.push_back(std::move(partition.second));
+    }
+    STORM_LOG_TRACE("Split transition relation into " << result.size() << " part(s).");
+    return result;
+}
+
+template<storm::dd::DdType Type>
+storm::dd::PartitionedTransitionRelation<Type> createPartitionedTransitionRelation(
+    storm::dd::Bdd<Type> const& transitions,
+    std::vector<std::vector<std::pair<storm::expressions::Variable, storm::expressions::Variable>>> const& variableGroups,
+    std::vector<std::pair<storm::expressions::Variable, storm::expressions::Variable>> const& rowColumnMetaVariablePairs) {
+    std::vector<storm::dd::Bdd<Type>> parts = partitionTransitionRelation(transitions, variableGroups);
+
+    // The parts per group do not contain the self-loops, so we add them as a separate part.
+    storm::dd::Bdd<Type> selfLoops = transitions && getRowColumnDiagonal(transitions.getDdManager(), rowColumnMetaVariablePairs);
+    if (!selfLoops.isZero() || parts.empty()) {
+        parts.push_back(selfLoops);
+    }
+    return storm::dd::PartitionedTransitionRelation<Type>(storm::dd::TransitionRelationPartitioning::Disjunctive, parts, rowColumnMetaVariablePairs);
+}
+
 template<storm::dd::DdType Type>
 storm::dd::Bdd<Type> computeBackwardsReachableStates(storm::dd::Bdd<Type> const& initialStates, storm::dd::Bdd<Type> const& constraintStates,
                                                      storm::dd::Bdd<Type> const& transitions, std::set<storm::expressions::Variable> const& rowMetaVariables,
@@ -87,6 +204,41 @@ storm::dd::Bdd<Type> computeBackwardsReachableStates(storm::dd::Bdd<Type> const&
     return reachableStates;
 }
 
+template<storm::dd::DdType Type>
+storm::dd::Bdd<Type> computeBottomChunk(storm::dd::Bdd<Type> const& states, storm::dd::Bdd<Type> const& transitions,
+                                        std::set<storm::expressions::Variable> const& rowMetaVariables,
+                                        std::set<storm::expressions::Variable> const& columnMetaVariables) {
+    STORM_LOG_ASSERT(!states.isZero(), "Expected non-empty set of states.");
+
+    // Only keep the transitions that start in one of the given states. Note that this still leaves transitions
+    // that target states outside of the given states, which however can not be left again.
+    storm::dd::Bdd<Type> restrictedTransitions = transitions && states;
+
+    // If there are states without successors among the given states, we can treat all of them at once.
+    storm::dd::Bdd<Type> statesWithSuccessors = states.inverseRelationalProduct(restrictedTransitions, rowMetaVariables, columnMetaVariables) && states;
+    storm::dd::Bdd<Type> statesWithoutSuccessors = states && !statesWithSuccessors;
+    if (!statesWithoutSuccessors.isZero()) {
+        return statesWithoutSuccessors;
+    }
+
+    // Otherwise, we search for a bottom SCC. For this, we pick a state and compute its forward reachable states. If
+    // all of them can reach the picked state, they form a bottom SCC. If not, we pick a state that cannot reach the
+    // picked state and repeat the procedure. As the set of forward reachable states shrinks in each iteration, this
+    // terminates.
+    storm::dd::Bdd<Type> candidates = states;
+    while (true) {
+        storm::dd::Bdd<Type> pivot = candidates.existsAbstractRepresentative(rowMetaVariables);
+        storm::dd::Bdd<Type> forwardStates =
+            computeReachableStates(pivot, restrictedTransitions, rowMetaVariables, columnMetaVariables).first && states;
+        storm::dd::Bdd<Type> backwardStates =
+            computeBackwardsReachableStates(pivot, forwardStates, restrictedTransitions, rowMetaVariables, columnMetaVariables);
+        candidates = forwardStates && !backwardStates;
+        if (candidates.isZero()) {
+            return forwardStates;
+        }
+    }
+}
+
 template<storm::dd::DdType Type>
 storm::dd::Bdd<Type> getRowColumnDiagonal(
     storm::dd::DdManager<Type> const& ddManager,
@@ -102,6 +254,31 @@ template std::pair<storm::dd::Bdd<storm::dd::DdType::Sylvan>, uint64_t> computeR
     storm::dd::Bdd<storm::dd::DdType::Sylvan> const& initialStates, storm::dd::Bdd<storm::dd::DdType::Sylvan> const& transitions,
     std::set<storm::expressions::Variable> const& rowMetaVariables, std::set<storm::expressions::Variable> const& columnMetaVariables);
 
+template std::pair<storm::dd::Bdd<storm::dd::DdType::CUDD>, uint64_t> computeReachableStates(
+    storm::dd::Bdd<storm::dd::DdType::CUDD> const& initialStates, std::vector<storm::dd::Bdd<storm::dd::DdType::CUDD>> const& transitionPartitions,
+    std::set<storm::expressions::Variable> const& rowMetaVariables, std::set<storm::expressions::Variable> const& columnMetaVariables,
+    storm::builder::DdReachabilityStrategy const& strategy);
+template std::pair<storm::dd::Bdd<storm::dd::DdType::Sylvan>, uint64_t> computeReachableStates(
+    storm::dd::Bdd<storm::dd::DdType::Sylvan> const& initialStates, std::vector<storm::dd::Bdd<storm::dd::DdType::Sylvan>> const& transitionPartitions,
+    std::set<storm::expressions::Variable> const& rowMetaVariables, std::set<storm::expressions::Variable> const& columnMetaVariables,
+    storm::builder::DdReachabilityStrategy const& strategy);
+
+template std::vector<storm::dd::Bdd<storm::dd::DdType::CUDD>> partitionTransitionRelation(
+    storm::dd::Bdd<storm::dd::DdType::CUDD> const& transitions,
+    std::vector<std::vector<std::pair<storm::expressions::Variable, storm::expressions::Variable>>> const& variableGroups);
+template std::vector<storm::dd::Bdd<storm::dd::DdType::Sylvan>> partitionTransitionRelation(
+    storm::dd::Bdd<storm::dd::DdType::Sylvan> const& transitions,
+    std::vector<std::vector<std::pair<storm::expressions::Variable, storm::expressions::Variable>>> const& variableGroups);
+
+template storm::dd::PartitionedTransitionRelation<storm::dd::DdType::CUDD> createPartitionedTransitionRelation(
+    storm::dd::Bdd<storm::dd::DdType::CUDD> const& transitions,
+    std::vector<std::vector<std::pair<storm::expressions::Variable, storm::expressions::Variable>>> const& variableGroups,
+    std::vector<std::pair<storm::expressions::Variable, storm::expressions::Variable>> const& rowColumnMetaVariablePairs);
+template storm::dd::PartitionedTransitionRelation<storm::dd::DdType::Sylvan> createPartitionedTransitionRelation(
+    storm::dd::Bdd<storm::dd::DdType::Sylvan> const& transitions,
+    std::vector<std::vector<std::pair<storm::expressions::Variable, storm::expressions::Variable>>> const& variableGroups,
+    std::vector<std::pair<storm::expressions::Variable, storm::expressions::Variable>> const& rowColumnMetaVariablePairs);
+
 template storm::dd::Bdd<storm::dd::DdType::CUDD> computeBackwardsReachableStates(storm::dd::Bdd<storm::dd::DdType::CUDD> const& initialStates,
                                                                                  storm::dd::Bdd<storm::dd::DdType::CUDD> const& constraintStates,
                                                                                  storm::dd::Bdd<storm::dd::DdType::CUDD> const& transitions,
@@ -113,6 +290,15 @@ template storm::dd::Bdd<storm::dd::DdType::Sylvan> computeBackwardsReachableStat
                                                                                    std::set<storm::expressions::Variable> const& rowMetaVariables,
                                                                                    std::set<storm::expressions::Variable> const& columnMetaVariables);
 
+template storm::dd::Bdd<storm::dd::DdType::CUDD> computeBottomChunk(storm::dd::Bdd<storm::dd::DdType::CUDD> const& states,
+                                                                    storm::dd::Bdd<storm::dd::DdType::CUDD> const& transitions,
+                                                                    std::set<storm::expressions::Variable> const& rowMetaVariables,
+                                                                    std::set<storm::expressions::Variable> const& columnMetaVariables);
+template storm::dd::Bdd<storm::dd::DdType::Sylvan> computeBottomChunk(storm::dd::Bdd<storm::dd::DdType::Sylvan> const& states,
+                                                                      storm::dd::Bdd<storm::dd::DdType::Sylvan> const& transitions,
+                                                                      std::set<storm::expressions::Variable> const& rowMetaVariables,
+                                                                      std::set<storm::expressions::Variable> const& columnMetaVariables);
+
 template storm::dd::Bdd<storm::dd::DdType::CUDD> getRowColumnDiagonal(
     storm::dd::DdManager<storm::dd::DdType::CUDD> const& ddManager,
     std::vector<std::pair<storm::expressions::Variable, storm::expressions::Variable>> const& rowColumnMetaVariablePairs);
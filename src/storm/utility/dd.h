@@ -4,6 +4,7 @@
 #include <set>
 #include <vector>
 
+#include "storm/builder/DdReachabilityStrategy.h"
 #include "storm/storage/dd/DdType.h"
 
 namespace storm {
@@ -19,6 +20,9 @@ class Bdd;
 
 template<storm::dd::DdType Type, typename ValueType>
 class Add;
+
+template<storm::dd::DdType Type>
+class PartitionedTransitionRelation;
 }  // namespace dd
 
 namespace utility {
@@ -29,11 +33,73 @@ std::pair<storm::dd::Bdd<Type>, uint64_t> computeReachableStates(storm::dd::Bdd<
                                                                  std::set<storm::expressions::Variable> const& rowMetaVariables,
                                                                  std::set<storm::expressions::Variable> const& columnMetaVariables);
 
+/*!
+ * Computes the states reachable from the initial states, where the transition relation is given as a set of parts
+ * whose union is the full transition relation. The parts are applied according to the given strategy. The parts are
+ * expected to be ordered bottom-up (as returned by partitionTransitionRelation), which is the order used for chaining
+ * and saturation.
+ *
+ * @return The reachable states and the number of iterations that were performed.
+ */
+template<storm::dd::DdType Type>
+std::pair<storm::dd::Bdd<Type>, uint64_t> computeReachableStates(storm::dd::Bdd<Type> const& initialStates,
+                                                                 std::vector<storm::dd::Bdd<Type>> const& transitionPartitions,
+                                                                 std::set<storm::expressions::Variable> const& rowMetaVariables,
+                                                                 std::set<storm::expressions::Variable> const& columnMetaVariables,
+                                                                 storm::builder::DdReachabilityStrategy const& strategy);
+
+/*!
+ * Splits the given transition relation into one part per group of variables such that the part of a group contains
+ * the transitions changing at least one of the variables of the group. Transitions that change none of the variables
+ * are self-loops (provided the groups cover all variables) and are dropped. For asynchronous models whose groups are
+ * the variables of the individual modules (or automata), the parts are essentially the transitions of the modules.
+ * The resulting parts are ordered bottom-up with respect to the position of the variables in the variable order.
+ *
+ * @param transitions The transition relation over row and column meta variables.
+ * @param variableGroups The groups given as pairs of row and column meta variables.
+ * @return The non-empty parts of the transition relation.
+ */
+template<storm::dd::DdType Type>
+std::vector<storm::dd::Bdd<Type>> partitionTransitionRelation(
+    storm::dd::Bdd<Type> const& transitions,
+    std::vector<std::vector<std::pair<storm::expressions::Variable, storm::expressions::Variable>>> const& variableGroups);
+
+/*!
+ * Creates a disjunctively partitioned representation of the given transition relation with one part per group of
+ * variables (see partitionTransitionRelation) and one part for the self-loops.
+ *
+ * @param transitions The transition relation over row and column meta variables.
+ * @param variableGroups The groups given as pairs of row and column meta variables. They need to cover all variables.
+ * @param rowColumnMetaVariablePairs All pairs of row and column meta variables.
+ * @return The partitioned transition relation.
+ */
+template<storm::dd::DdType Type>
+storm::dd::PartitionedTransitionRelation<Type> createPartitionedTransitionRelation(
+    storm::dd::Bdd<Type> const& transitions,
+    std::vector<std::vector<std::pair<storm::expressions::Variable, storm::expressions::Variable>>> const& variableGroups,
+    std::vector<std::pair<storm::expressions::Variable, storm::expressions::Variable>> const& rowColumnMetaVariablePairs);
+
 template<storm::dd::DdType Type>
 storm::dd::Bdd<Type> computeBackwardsReachableStates(storm::dd::Bdd<Type> const& initialStates, storm::dd::Bdd<Type> const& constraintStates,
                                                      storm::dd::Bdd<Type> const& transitions, std::set<storm::expressions::Variable> const& rowMetaVariables,
                                                      std::set<storm::expressions::Variable> const& columnMetaVariables);
 
+/*!
+ * Computes a non-empty subset of the given states that can be treated independently of the remaining given states,
+ * i.e., no transition leads from the subset to one of the given states outside of the subset. If some of the given
+ * states have no successor among the given states, the subset consists of all these states. Otherwise, the subset
+ * is a bottom SCC of the transitions restricted to the given states. Repeatedly removing the computed subset thus
+ * enumerates the given states in reverse topological order.
+ *
+ * @param states The (non-empty) set of states to consider.
+ * @param transitions The transitions (over row and column meta variables) between states.
+ * @return The computed subset of the given states.
+ */
+template<storm::dd::DdType Type>
+storm::dd::Bdd<Type> computeBottomChunk(storm::dd::Bdd<Type> const& states, storm::dd::Bdd<Type> const& transitions,
+                                        std::set<storm::expressions::Variable> const& rowMetaVariables,
+                                        std::set<storm::expressions::Variable> const& columnMetaVariables);
+
 template<storm::dd::DdType Type, typename ValueType>
 storm::dd::Add<Type, ValueType> getRowColumnDiagonal(
     storm::dd::DdManager<Type> const& ddManager,
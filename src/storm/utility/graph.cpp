@@ -4,11 +4,13 @@
 #include "storm-config.h"
 #include "utility/OsDetection.h"
 
+#include "storm/adapters/IntelTbbAdapter.h"
 #include "storm/adapters/RationalFunctionAdapter.h"
 
 #include "storm/storage/dd/Add.h"
 #include "storm/storage/dd/Bdd.h"
 #include "storm/storage/dd/DdManager.h"
+#include "storm/storage/dd/PartitionedTransitionRelation.h"
 #include "storm/storage/sparse/StateType.h"
 
 #include "storm/storage/ExplicitGameStrategyPair.h"
@@ -23,6 +25,8 @@
 #include "storm/models/symbolic/StochasticTwoPlayerGame.h"
 
 #include "storm/exceptions/InvalidArgumentException.h"
+#include "storm/settings/SettingsManager.h"
+#include "storm/settings/modules/CoreSettings.h"
 #include "storm/utility/constants.h"
 #include "storm/utility/macros.h"
 
@@ -32,6 +36,209 @@ namespace storm {
 namespace utility {
 namespace graph {
 
+#ifdef STORM_HAVE_INTELTBB
+namespace {
+// Smaller models are analyzed sequentially, as the parallel search does not pay off.
+uint64_t const minimalNumberOfStatesForParallelAnalysis = 1ull << 16;
+
+// Frontiers with fewer states are expanded sequentially.
+uint64_t const minimalFrontierSizeForParallelExpansion = 1024;
+
+bool useParallelAnalysis(uint64_t numberOfStates) {
+    return numberOfStates >= minimalNumberOfStatesForParallelAnalysis && storm::settings::hasModule<storm::settings::modules::CoreSettings>() &&
+           storm::settings::getModule<storm::settings::modules::CoreSettings>().isParallelGraphAnalysisSet();
+}
+
+/*!
+ * Performs a level-synchronous search in which all states of a frontier are expanded in parallel. Expanding a state s means calling
+ * expand(s, discover), which in turn calls discover(t, explore) for the states t found from s. States that are not yet contained in the
+ * result are added to it and, if explore is true, to the next frontier. The result is only modified between two levels, so expand may read
+ * it (and any set that is derived from it) without synchronization.
+ */
+template<typename ExpandFunction>
+void searchLevelSynchronously(storm::storage::BitVector& result, std::vector<uint64_t>&& frontier, ExpandFunction const& expand) {
+    struct Discoveries {
+        std::vector<uint64_t> explored;
+        std::vector<uint64_t> unexplored;
+    };
+    // The states that were discovered in the current level, such that every state is only discovered once.
+    storm::storage::BitVector claimedStates(result.size());
+    tbb::enumerable_thread_specific<Discoveries> threadDiscoveries;
+    auto expandStates = [&](uint64_t begin, uint64_t end, Discoveries& discoveries) {
+        auto discover = [&](uint64_t state, bool explore) {
+            if (!result.get(state) && claimedStates.setAtomic(state)) {
+                (explore ? discoveries.explored : discoveries.unexplored).push_back(state);
+            }
+        };
+        for (uint64_t index = begin; index < end; ++index) {
+            expand(frontier[index], discover);
+        }
+    };
+
+    while (!frontier.empty()) {
+        if (frontier.size() < minimalFrontierSizeForParallelExpansion) {
+            expandStates(0, frontier.size(), threadDiscoveries.local());
+        } else {
+            tbb::parallel_for(tbb::blocked_range<uint64_t>(0, frontier.size(), 256),
+                              [&](tbb::blocked_range<uint64_t> const& range) { expandStates(range.begin(), range.end(), threadDiscoveries.local()); });
+        }
+        frontier.clear();
+        for (auto& discoveries : threadDiscoveries) {
+            for (auto state : discoveries.explored) {
+                result.set(state);
+                frontier.push_back(state);
+            }
+            for (auto state : discoveries.unexplored) {
+                result.set(state);
+            }
+            discoveries.explored.clear();
+            discoveries.unexplored.clear();
+        }
+    }
+}
+
+std::vector<uint64_t> getSetIndices(storm::storage::BitVector const& states) {
+    std::vector<uint64_t> result;
+    result.reserve(states.getNumberOfSetBits());
+    states.forEachSetIndex([&result](uint64_t state) { result.push_back(state); });
+    return result;
+}
+
+template<typename T>
+storm::storage::BitVector getReachableStatesParallel(storm::storage::SparseMatrix<T> const& transitionMatrix, storm::storage::BitVector const& initialStates,
+                                                     storm::storage::BitVector const& constraintStates, storm::storage::BitVector const& targetStates,
+                                                     boost::optional<storm::storage::BitVector> const& choiceFilter) {
+    storm::storage::BitVector reachableStates(initialStates);
+    storm::storage::BitVector initialFrontier(initialStates);
+    initialFrontier &= constraintStates;
+    // Retrieving the row groups is not thread-safe if they are created on demand.
+    auto const& rowGroupIndices = transitionMatrix.getRowGroupIndices();
+    searchLevelSynchronously(reachableStates, getSetIndices(initialFrontier), [&](uint64_t state, auto const& discover) {
+        uint64_t row = choiceFilter ? choiceFilter->getNextSetIndex(rowGroupIndices[state]) : rowGroupIndices[state];
+        for (; row < rowGroupIndices[state + 1]; row = choiceFilter ? choiceFilter->getNextSetIndex(row + 1) : row + 1) {
+            for (auto const& successor : transitionMatrix.getRow(row)) {
+                if (storm::utility::isZero(successor.getValue())) {
+                    continue;
+                }
+                // Target states are included, but not explored further.
+                if (targetStates.get(successor.getColumn())) {
+                    discover(successor.getColumn(), false);
+                } else if (constraintStates.get(successor.getColumn())) {
+                    discover(successor.getColumn(), true);
+                }
+            }
+        }
+    });
+    return reachableStates;
+}
+
+template<typename T>
+storm::storage::BitVector performProbGreater0Parallel(storm::storage::SparseMatrix<T> const& backwardTransitions, storm::storage::BitVector const& phiStates,
+                                                      storm::storage::BitVector const& psiStates) {
+    storm::storage::BitVector statesWithProbabilityGreater0(psiStates);
+    searchLevelSynchronously(statesWithProbabilityGreater0, getSetIndices(psiStates), [&](uint64_t state, auto const& discover) {
+        for (auto const& predecessor : backwardTransitions.getRow(state)) {
+            if (phiStates.get(predecessor.getColumn())) {
+                discover(predecessor.getColumn(), true);
+            }
+        }
+    });
+    return statesWithProbabilityGreater0;
+}
+
+template<typename T>
+storm::storage::BitVector performProbGreater0AParallel(storm::storage::SparseMatrix<T> const& transitionMatrix,
+                                                       std::vector<uint_fast64_t> const& nondeterministicChoiceIndices,
+                                                       storm::storage::SparseMatrix<T> const& backwardTransitions, storm::storage::BitVector const& phiStates,
+                                                       storm::storage::BitVector const& psiStates,
+                                                       boost::optional<storm::storage::BitVector> const& choiceConstraint) {
+    storm::storage::BitVector statesWithProbabilityGreater0(psiStates);
+    searchLevelSynchronously(statesWithProbabilityGreater0, getSetIndices(psiStates), [&](uint64_t state, auto const& discover) {
+        for (auto const& predecessorEntry : backwardTransitions.getRow(state)) {
+            uint64_t const predecessor = predecessorEntry.getColumn();
+            if (!phiStates.get(predecessor) || statesWithProbabilityGreater0.get(predecessor)) {
+                continue;
+            }
+            // Check whether every (enabled) choice of the predecessor has a successor with positive probability.
+            uint64_t row = nondeterministicChoiceIndices[predecessor];
+            uint64_t const endOfGroup = nondeterministicChoiceIndices[predecessor + 1];
+            if (choiceConstraint && choiceConstraint->getNextSetIndex(row) >= endOfGroup) {
+                continue;
+            }
+            bool allChoicesHaveSuccessorWithProbabilityGreater0 = true;
+            for (; row < endOfGroup && allChoicesHaveSuccessorWithProbabilityGreater0; ++row) {
+                if (!choiceConstraint || choiceConstraint->get(row)) {
+                    auto const& choice = transitionMatrix.getRow(row);
+                    allChoicesHaveSuccessorWithProbabilityGreater0 = std::any_of(choice.begin(), choice.end(), [&](auto const& successor) {
+                        return statesWithProbabilityGreater0.get(successor.getColumn());
+                    });
+                }
+            }
+            if (allChoicesHaveSuccessorWithProbabilityGreater0) {
+                discover(predecessor, true);
+            }
+        }
+    });
+    return statesWithProbabilityGreater0;
+}
+
+/*!
+ * Computes the greatest fixpoint of the prob1E (Universal = false) or prob1A (Universal = true) analysis, where every iteration is a
+ * level-synchronous backward search.
+ */
+template<bool Universal, typename T>
+storm::storage::BitVector performProb1Parallel(storm::storage::SparseMatrix<T> const& transitionMatrix,
+                                               std::vector<uint_fast64_t> const& nondeterministicChoiceIndices,
+                                               storm::storage::SparseMatrix<T> const& backwardTransitions, storm::storage::BitVector const& phiStates,
+                                               storm::storage::BitVector const& psiStates,
+                                               boost::optional<storm::storage::BitVector> const& choiceConstraint) {
+    storm::storage::BitVector currentStates(phiStates.size(), true);
+    std::vector<uint64_t> const psiStateIndices = getSetIndices(psiStates);
+    while (true) {
+        storm::storage::BitVector nextStates(psiStates);
+        // A choice is valid if all its successors are in the current states and at least one of them is in the next states.
+        auto isValidChoice = [&](uint64_t row) {
+            bool hasNextStateSuccessor = false;
+            for (auto const& successor : transitionMatrix.getRow(row)) {
+                if (!currentStates.get(successor.getColumn())) {
+                    return false;
+                }
+                hasNextStateSuccessor |= nextStates.get(successor.getColumn());
+            }
+            return hasNextStateSuccessor;
+        };
+        searchLevelSynchronously(nextStates, std::vector<uint64_t>(psiStateIndices), [&](uint64_t state, auto const& discover) {
+            for (auto const& predecessorEntry : backwardTransitions.getRow(state)) {
+                uint64_t const predecessor = predecessorEntry.getColumn();
+                if (!phiStates.get(predecessor) || nextStates.get(predecessor)) {
+                    continue;
+                }
+                bool addPredecessor = Universal;
+                for (uint64_t row = nondeterministicChoiceIndices[predecessor]; row < nondeterministicChoiceIndices[predecessor + 1]; ++row) {
+                    if constexpr (Universal) {
+                        if (!isValidChoice(row)) {
+                            addPredecessor = false;
+                            break;
+                        }
+                    } else if ((!choiceConstraint || choiceConstraint->get(row)) && isValidChoice(row)) {
+                        addPredecessor = true;
+                        break;
+                    }
+                }
+                if (addPredecessor) {
+                    discover(predecessor, true);
+                }
+            }
+        });
+        if (currentStates == nextStates) {
+            return currentStates;
+        }
+        currentStates = std::move(nextStates);
+    }
+}
+}  // namespace
+#endif
+
 template<typename T>
 storm::storage::BitVector getReachableOneStep(storm::storage::SparseMatrix<T> const& transitionMatrix, storm::storage::BitVector const& initialStates) {
     storm::storage::BitVector result{initialStates.size()};
@@ -48,6 +255,11 @@ template<typename T>
 storm::storage::BitVector getReachableStates(storm::storage::SparseMatrix<T> const& transitionMatrix, storm::storage::BitVector const& initialStates,
                                              storm::storage::BitVector const& constraintStates, storm::storage::BitVector const& targetStates,
                                              bool useStepBound, uint_fast64_t maximalSteps, boost::optional<storm::storage::BitVector> const& choiceFilter) {
+#ifdef STORM_HAVE_INTELTBB
+    if (!useStepBound && useParallelAnalysis(transitionMatrix.getRowGroupCount())) {
+        return getReachableStatesParallel(transitionMatrix, initialStates, constraintStates, targetStates, choiceFilter);
+    }
+#endif
     storm::storage::BitVector reachableStates(initialStates);
 
     uint_fast64_t numberOfStates = transitionMatrix.getRowGroupCount();
@@ -321,6 +533,11 @@ std::vector<uint_fast64_t> getDistances(storm::storage::SparseMatrix<T> const& t
 template<typename T>
 storm::storage::BitVector performProbGreater0(storm::storage::SparseMatrix<T> const& backwardTransitions, storm::storage::BitVector const& phiStates,
                                               storm::storage::BitVector const& psiStates, bool useStepBound, uint_fast64_t maximalSteps) {
+#ifdef STORM_HAVE_INTELTBB
+    if (!useStepBound && useParallelAnalysis(phiStates.size())) {
+        return performProbGreater0Parallel(backwardTransitions, phiStates, psiStates);
+    }
+#endif
     // Prepare the resulting bit vector.
     uint_fast64_t numberOfStates = phiStates.size();
     storm::storage::BitVector statesWithProbabilityGreater0(numberOfStates);
@@ -419,6 +636,19 @@ std::pair<storm::storage::BitVector, storm::storage::BitVector> performProb01(st
     return result;
 }
 
+/*!
+ * Retrieves the partitioned transition relation of the model if it represents exactly the given relation (without
+ * nondeterminism), and nullptr otherwise, e.g. if the given relation is restricted to some states.
+ */
+template<storm::dd::DdType Type, typename ValueType>
+storm::dd::PartitionedTransitionRelation<Type> const* getMatchingPartitionedTransitionRelation(storm::models::symbolic::Model<Type, ValueType> const& model,
+                                                                                              storm::dd::Bdd<Type> const& transitionRelation) {
+    if (model.hasPartitionedTransitionRelation() && model.getPartitionedTransitionRelation().getRelation() == transitionRelation) {
+        return &model.getPartitionedTransitionRelation();
+    }
+    return nullptr;
+}
+
 template<storm::dd::DdType Type, typename ValueType>
 storm::dd::Bdd<Type> performProbGreater0(storm::models::symbolic::Model<Type, ValueType> const& model, storm::dd::Bdd<Type> const& transitionMatrix,
                                          storm::dd::Bdd<Type> const& phiStates, storm::dd::Bdd<Type> const& psiStates,
@@ -427,6 +657,7 @@ storm::dd::Bdd<Type> performProbGreater0(storm::models::symbolic::Model<Type, Va
     storm::dd::DdManager<Type> const& manager = model.getManager();
     storm::dd::Bdd<Type> lastIterationStates = manager.getBddZero();
     storm::dd::Bdd<Type> statesWithProbabilityGreater0 = psiStates;
+    storm::dd::PartitionedTransitionRelation<Type> const* partitionedTransitionRelation = getMatchingPartitionedTransitionRelation(model, transitionMatrix);
 
     uint_fast64_t iterations = 0;
     while (lastIterationStates != statesWithProbabilityGreater0) {
@@ -435,8 +666,12 @@ storm::dd::Bdd<Type> performProbGreater0(storm::models::symbolic::Model<Type, Va
         }
 
         lastIterationStates = statesWithProbabilityGreater0;
-        statesWithProbabilityGreater0 =
-            statesWithProbabilityGreater0.inverseRelationalProduct(transitionMatrix, model.getRowVariables(), model.getColumnVariables());
+        if (partitionedTransitionRelation) {
+            statesWithProbabilityGreater0 = partitionedTransitionRelation->preimage(statesWithProbabilityGreater0);
+        } else {
+            statesWithProbabilityGreater0 =
+                statesWithProbabilityGreater0.inverseRelationalProduct(transitionMatrix, model.getRowVariables(), model.getColumnVariables());
+        }
         statesWithProbabilityGreater0 &= phiStates;
         statesWithProbabilityGreater0 |= lastIterationStates;
         ++iterations;
@@ -546,7 +781,7 @@ void computeSchedulerProbGreater0E(storm::storage::SparseMatrix<T> const& transi
 
     std::vector<uint_fast64_t> stack;
     storm::storage::BitVector currentStates(psiStates);  // the states that are either psiStates or for which we have found a valid choice.
-    stack.insert(stack.end(), currentStates.begin(), currentStates.end());
+    currentStates.forEachSetIndex([&stack](uint64_t state) { stack.push_back(state); });
     uint_fast64_t currentState = 0;
 
     while (!stack.empty()) {
@@ -638,7 +873,7 @@ void computeSchedulerProb1E(storm::storage::BitVector const& prob1EStates, storm
     std::vector<uint_fast64_t> const& nondeterministicChoiceIndices = transitionMatrix.getRowGroupIndices();
     std::vector<uint_fast64_t> stack;
     storm::storage::BitVector currentStates(psiStates);
-    stack.insert(stack.end(), currentStates.begin(), currentStates.end());
+    currentStates.forEachSetIndex([&stack](uint64_t state) { stack.push_back(state); });
     uint_fast64_t currentState = 0;
 
     while (!stack.empty()) {
@@ -688,6 +923,12 @@ void computeSchedulerProb1E(storm::storage::BitVector const& prob1EStates, storm
 template<typename T>
 storm::storage::BitVector performProbGreater0E(storm::storage::SparseMatrix<T> const& backwardTransitions, storm::storage::BitVector const& phiStates,
                                                storm::storage::BitVector const& psiStates, bool useStepBound, uint_fast64_t maximalSteps) {
+#ifdef STORM_HAVE_INTELTBB
+    // Without a step bound, a state has positive probability for some scheduler iff it has a path to a psi state.
+    if (!useStepBound && useParallelAnalysis(phiStates.size())) {
+        return performProbGreater0Parallel(backwardTransitions, phiStates, psiStates);
+    }
+#endif
     size_t numberOfStates = phiStates.size();
 
     // Prepare resulting bit vector.
@@ -758,6 +999,11 @@ storm::storage::BitVector performProb1E(storm::storage::SparseMatrix<T> const& t
                                         std::vector<uint_fast64_t> const& nondeterministicChoiceIndices,
                                         storm::storage::SparseMatrix<T> const& backwardTransitions, storm::storage::BitVector const& phiStates,
                                         storm::storage::BitVector const& psiStates, boost::optional<storm::storage::BitVector> const& choiceConstraint) {
+#ifdef STORM_HAVE_INTELTBB
+    if (useParallelAnalysis(phiStates.size())) {
+        return performProb1Parallel<false>(transitionMatrix, nondeterministicChoiceIndices, backwardTransitions, phiStates, psiStates, choiceConstraint);
+    }
+#endif
     size_t numberOfStates = phiStates.size();
 
     // Initialize the environment for the iterative algorithm.
@@ -771,7 +1017,7 @@ storm::storage::BitVector performProb1E(storm::storage::SparseMatrix<T> const& t
     while (!done) {
         stack.clear();
         storm::storage::BitVector nextStates(psiStates);
-        stack.insert(stack.end(), psiStates.begin(), psiStates.end());
+        psiStates.forEachSetIndex([&stack](uint64_t state) { stack.push_back(state); });
 
         while (!stack.empty()) {
             currentState = stack.back();
@@ -859,6 +1105,11 @@ storm::storage::BitVector performProbGreater0A(storm::storage::SparseMatrix<T> c
                                                storm::storage::SparseMatrix<T> const& backwardTransitions, storm::storage::BitVector const& phiStates,
                                                storm::storage::BitVector const& psiStates, bool useStepBound, uint_fast64_t maximalSteps,
                                                boost::optional<storm::storage::BitVector> const& choiceConstraint) {
+#ifdef STORM_HAVE_INTELTBB
+    if (!useStepBound && useParallelAnalysis(phiStates.size())) {
+        return performProbGreater0AParallel(transitionMatrix, nondeterministicChoiceIndices, backwardTransitions, phiStates, psiStates, choiceConstraint);
+    }
+#endif
     size_t numberOfStates = phiStates.size();
 
     // Prepare resulting bit vector.
@@ -1005,6 +1256,11 @@ storm::storage::BitVector performProb1A(storm::storage::SparseMatrix<T> const& t
                                         std::vector<uint_fast64_t> const& nondeterministicChoiceIndices,
                                         storm::storage::SparseMatrix<T> const& backwardTransitions, storm::storage::BitVector const& phiStates,
                                         storm::storage::BitVector const& psiStates) {
+#ifdef STORM_HAVE_INTELTBB
+    if (useParallelAnalysis(phiStates.size())) {
+        return performProb1Parallel<true>(transitionMatrix, nondeterministicChoiceIndices, backwardTransitions, phiStates, psiStates, boost::none);
+    }
+#endif
     size_t numberOfStates = phiStates.size();
 
     // Initialize the environment for the iterative algorithm.
@@ -1018,7 +1274,7 @@ storm::storage::BitVector performProb1A(storm::storage::SparseMatrix<T> const& t
     while (!done) {
         stack.clear();
         storm::storage::BitVector nextStates(psiStates);
-        stack.insert(stack.end(), psiStates.begin(), psiStates.end());
+        psiStates.forEachSetIndex([&stack](uint64_t state) { stack.push_back(state); });
 
         while (!stack.empty()) {
             currentState = stack.back();
@@ -1129,10 +1385,16 @@ storm::dd::Bdd<Type> performProbGreater0E(storm::models::symbolic::Nondeterminis
     storm::dd::Bdd<Type> statesWithProbabilityGreater0E = psiStates;
 
     storm::dd::Bdd<Type> abstractedTransitionMatrix = transitionMatrix.existsAbstract(model.getNondeterminismVariables());
+    storm::dd::PartitionedTransitionRelation<Type> const* partitionedTransitionRelation =
+        getMatchingPartitionedTransitionRelation(model, abstractedTransitionMatrix);
     while (lastIterationStates != statesWithProbabilityGreater0E) {
         lastIterationStates = statesWithProbabilityGreater0E;
-        statesWithProbabilityGreater0E =
-            statesWithProbabilityGreater0E.inverseRelationalProduct(abstractedTransitionMatrix, model.getRowVariables(), model.getColumnVariables());
+        if (partitionedTransitionRelation) {
+            statesWithProbabilityGreater0E = partitionedTransitionRelation->preimage(statesWithProbabilityGreater0E);
+        } else {
+            statesWithProbabilityGreater0E =
+                statesWithProbabilityGreater0E.inverseRelationalProduct(abstractedTransitionMatrix, model.getRowVariables(), model.getColumnVariables());
+        }
         statesWithProbabilityGreater0E &= phiStates;
         statesWithProbabilityGreater0E |= lastIterationStates;
     }
@@ -1538,7 +1800,7 @@ ExplicitGameProb01Result performProb1(storm::storage::SparseMatrix<ValueType> co
         storm::storage::BitVector player2Solution(result.player2States.size());
 
         stack.clear();
-        stack.insert(stack.end(), psiStates.begin(), psiStates.end());
+        psiStates.forEachSetIndex([&stack](uint64_t state) { stack.push_back(state); });
 
         // Perform the actual DFS.
         uint_fast64_t currentState;
@@ -0,0 +1,178 @@
+#include "storm/utility/lazyShortestPaths.h"
+
+#include <stdexcept>
+
+#include "storm/exceptions/NotSupportedException.h"
+#include "storm/generator/NextStateGenerator.h"
+#include "storm/utility/constants.h"
+#include "storm/utility/macros.h"
+
+namespace storm {
+namespace utility {
+namespace ksp {
+
+template<typename ValueType, typename StateType>
+LazyShortestPathsGenerator<ValueType, StateType>::LazyShortestPathsGenerator(
+    std::shared_ptr<storm::generator::NextStateGenerator<ValueType, StateType>> const& generator, storm::expressions::Expression const& targetExpression)
+    : generator(generator), targetExpression(targetExpression), stateToId(generator->getStateSize()), maximalNumberOfPops(0) {
+    STORM_LOG_THROW(generator->getModelType() == storm::generator::ModelType::DTMC, storm::exceptions::NotSupportedException,
+                    "Lazy k-shortest paths are only supported for DTMCs.");
+
+    std::vector<StateType> initialStates =
+        generator->getInitialStates([this](storm::generator::CompressedState const& state) { return getOrAddStateIndex(state); });
+    for (auto const& initialState : initialStates) {
+        candidates.emplace(storm::utility::one<ValueType>(), pathNodes.size());
+        pathNodes.push_back({initialState, boost::none, storm::utility::one<ValueType>()});
+    }
+}
+
+template<typename ValueType, typename StateType>
+bool LazyShortestPathsGenerator<ValueType, StateType>::hasPath(uint64_t k) {
+    computePaths(k);
+    return k <= kShortestPaths.size();
+}
+
+template<typename ValueType, typename StateType>
+ValueType LazyShortestPathsGenerator<ValueType, StateType>::getDistance(uint64_t k) {
+    if (!hasPath(k)) {
+        throw std::invalid_argument("Cannot compute " + std::to_string(k) + "-shortest path, because there are only " + std::to_string(kShortestPaths.size()) +
+                                    " paths.");
+    }
+    return pathNodes[kShortestPaths[k - 1]].probability;
+}
+
+template<typename ValueType, typename StateType>
+std::vector<StateType> LazyShortestPathsGenerator<ValueType, StateType>::getPathAsList(uint64_t k) {
+    if (!hasPath(k)) {
+        throw std::invalid_argument("Cannot compute " + std::to_string(k) + "-shortest path, because there are only " + std::to_string(kShortestPaths.size()) +
+                                    " paths.");
+    }
+
+    std::vector<StateType> backToFrontList;
+    boost::optional<uint64_t> currentNode = kShortestPaths[k - 1];
+    while (currentNode) {
+        backToFrontList.push_back(pathNodes[currentNode.get()].state);
+        currentNode = pathNodes[currentNode.get()].predecessor;
+    }
+    return backToFrontList;
+}
+
+template<typename ValueType, typename StateType>
+storm::generator::CompressedState const& LazyShortestPathsGenerator<ValueType, StateType>::getState(StateType index) const {
+    return idToState[index];
+}
+
+template<typename ValueType, typename StateType>
+uint64_t LazyShortestPathsGenerator<ValueType, StateType>::getNumberOfDiscoveredStates() const {
+    return idToState.size();
+}
+
+template<typename ValueType, typename StateType>
+uint64_t LazyShortestPathsGenerator<ValueType, StateType>::getNumberOfExpandedStates() const {
+    uint64_t result = 0;
+    for (auto const& stateSuccessors : successors) {
+        if (stateSuccessors) {
+            ++result;
+        }
+    }
+    return result;
+}
+
+template<typename ValueType, typename StateType>
+void LazyShortestPathsGenerator<ValueType, StateType>::computePaths(uint64_t k) {
+    STORM_LOG_ASSERT(k >= 1, "The paths are numbered starting from one.");
+    if (k > maximalNumberOfPops) {
+        maximalNumberOfPops = k;
+        for (auto const& node : deferredCandidates) {
+            candidates.emplace(pathNodes[node].probability, node);
+        }
+        deferredCandidates.clear();
+    }
+    while (kShortestPaths.size() < k && computeNextPath()) {
+        // Intentionally left empty.
+    }
+}
+
+template<typename ValueType, typename StateType>
+bool LazyShortestPathsGenerator<ValueType, StateType>::computeNextPath() {
+    while (!candidates.empty()) {
+        uint64_t node = candidates.top().second;
+        candidates.pop();
+
+        StateType state = pathNodes[node].state;
+        if (numberOfPops[state] >= maximalNumberOfPops) {
+            deferredCandidates.push_back(node);
+            continue;
+        }
+        ++numberOfPops[state];
+
+        expand(state);
+        if (targetStates.get(state)) {
+            kShortestPaths.push_back(node);
+            return true;
+        }
+
+        // Extend the path by all successors. The probability is copied, as adding nodes may reallocate the path tree.
+        ValueType probability = pathNodes[node].probability;
+        for (auto const& successor : successors[state].get()) {
+            ValueType successorProbability = probability * successor.second;
+            candidates.emplace(successorProbability, pathNodes.size());
+            pathNodes.push_back({successor.first, node, successorProbability});
+        }
+    }
+    return false;
+}
+
+template<typename ValueType, typename StateType>
+void LazyShortestPathsGenerator<ValueType, StateType>::expand(StateType state) {
+    if (successors[state]) {
+        return;
+    }
+
+    // Discovering new states may reallocate the storage of the states, so the generator needs to operate on a copy.
+    storm::generator::CompressedState compressedState = idToState[state];
+    generator->load(compressedState);
+    std::vector<std::pair<StateType, ValueType>> stateSuccessors;
+    if (generator->satisfies(targetExpression)) {
+        targetStates.set(state);
+    } else {
+        auto behavior =
+            generator->expand([this](storm::generator::CompressedState const& successorState) { return getOrAddStateIndex(successorState); });
+        STORM_LOG_THROW(behavior.getNumberOfChoices() <= 1, storm::exceptions::NotSupportedException,
+                        "Lazy k-shortest paths are only supported for deterministic models.");
+        for (auto const& choice : behavior) {
+            for (auto const& entry : choice) {
+                stateSuccessors.emplace_back(entry.first, entry.second);
+            }
+        }
+        generator->recycle(std::move(behavior));
+    }
+    successors[state] = std::move(stateSuccessors);
+}
+
+template<typename ValueType, typename StateType>
+StateType LazyShortestPathsGenerator<ValueType, StateType>::getOrAddStateIndex(storm::generator::CompressedState const& state) {
+    if (generator->hasStateCanonicalizer()) {
+        // Only the representatives of the orbits of the symmetries of the model are stored (and explored).
+        storm::generator::CompressedState representative(state);
+        if (generator->canonicalizeState(representative)) {
+            return getOrAddStateIndex(representative);
+        }
+    }
+
+    StateType newIndex = static_cast<StateType>(idToState.size());
+    StateType actualIndex = stateToId.findOrAdd(state, newIndex);
+    if (actualIndex == newIndex) {
+        idToState.push_back(state);
+        successors.emplace_back();
+        numberOfPops.push_back(0);
+        targetStates.resize(idToState.size());
+    }
+    return actualIndex;
+}
+
+template class LazyShortestPathsGenerator<double>;
+
+}  // namespace ksp
+}  // namespace utility
+}  // namespace storm
@@ -0,0 +1,150 @@
+#pragma once
+
+#include <memory>
+#include <queue>
+#include <vector>
+
+#include <boost/optional.hpp>
+
+#include "storm/generator/CompressedState.h"
+#include "storm/storage/BitVector.h"
+#include "storm/storage/BitVectorHashMap.h"
+#include "storm/storage/expressions/Expression.h"
+
+namespace storm {
+namespace generator {
+template<typename ValueType, typename StateType>
+class NextStateGenerator;
+}
+
+namespace utility {
+namespace ksp {
+
+/*!
+ * Enumerates the most probable paths from the initial states to a set of target states of a DTMC in order of descending probability.
+ * In contrast to the ShortestPathsGenerator, this does not need the model to be built. Instead, the state space is explored on demand via
+ * the given next-state generator and a path is only computed once it is requested.
+ *
+ * Paths are enumerated best-first: partial paths (stored as a prefix tree) are kept in a heap ordered by their probability and the most
+ * probable one is extended by the successors of its last state. As the probability of a path can only decrease when it is extended, the
+ * k-th path popped from the heap that ends in a target state is the k-th most probable path. Target states are considered absorbing, i.e.
+ * every path ends with its first visit of a target state. Only states that appear on a popped path are ever expanded.
+ *
+ * As the i-th path popped for a state is the i-th most probable path to it, the k most probable paths to the targets only need the k most
+ * probable paths to each state. Further paths are deferred until more paths are requested, which also guarantees termination in the presence
+ * of cycles with probability one.
+ */
+template<typename ValueType, typename StateType = uint32_t>
+class LazyShortestPathsGenerator {
+   public:
+    /*!
+     * Creates a generator for the paths to the states satisfying the given expression.
+     *
+     * @param generator The generator used to explore the model. It needs to describe a DTMC.
+     * @param targetExpression An expression over the variables of the model characterizing the target states.
+     */
+    LazyShortestPathsGenerator(std::shared_ptr<storm::generator::NextStateGenerator<ValueType, StateType>> const& generator,
+                               storm::expressions::Expression const& targetExpression);
+
+    /*!
+     * Retrieves whether there are at least k paths to the target states. Computes the paths if not yet computed.
+     */
+    bool hasPath(uint64_t k);
+
+    /*!
+     * Returns the probability of the k-th most probable path (k >= 1).
+     * Computes the path if not yet computed.
+     * @throws std::invalid_argument if no such path exists
+     */
+    ValueType getDistance(uint64_t k);
+
+    /*!
+     * Returns the states of the k-th most probable path as back-to-front traversal (as ShortestPathsGenerator::getPathAsList does).
+     * Computes the path if not yet computed.
+     * @throws std::invalid_argument if no such path exists
+     */
+    std::vector<StateType> getPathAsList(uint64_t k);
+
+    /*!
+     * Retrieves the state with the given index. The indices are the ones used in the paths.
+     */
+    storm::generator::CompressedState const& getState(StateType index) const;
+
+    /*!
+     * Retrieves the number of states that were discovered so far.
+     */
+    uint64_t getNumberOfDiscoveredStates() const;
+
+    /*!
+     * Retrieves the number of states that were expanded so far.
+     */
+    uint64_t getNumberOfExpandedStates() const;
+
+   private:
+    // A node of the prefix tree of partial paths.
+    struct PathNode {
+        StateType state;
+        boost::optional<uint64_t> predecessor;
+        ValueType probability;
+    };
+
+    /*!
+     * Computes the next most probable path if there is one.
+     *
+     * @return True iff there was another path.
+     */
+    bool computeNextPath();
+
+    /*!
+     * Computes paths until k paths are known or there are no more paths.
+     */
+    void computePaths(uint64_t k);
+
+    /*!
+     * Expands the given state if it was not yet expanded, i.e. determines whether it is a target state and, if not, its successors.
+     */
+    void expand(StateType state);
+
+    /*!
+     * Retrieves the index of the given state, adding it if it is not yet known.
+     */
+    StateType getOrAddStateIndex(storm::generator::CompressedState const& state);
+
+    // The generator used to explore the model.
+    std::shared_ptr<storm::generator::NextStateGenerator<ValueType, StateType>> generator;
+
+    // The expression characterizing the target states.
+    storm::expressions::Expression targetExpression;
+
+    // A mapping from the discovered states to their indices and the reverse mapping.
+    storm::storage::BitVectorHashMap<StateType> stateToId;
+    std::vector<storm::generator::CompressedState> idToState;
+
+    // For each discovered state, the successors (with their probabilities) if the state was already expanded.
+    std::vector<boost::optional<std::vector<std::pair<StateType, ValueType>>>> successors;
+
+    // The (expanded) target states.
+    storm::storage::BitVector targetStates;
+
+    // The prefix tree of all partial paths that were created so far.
+    std::vector<PathNode> pathNodes;
+
+    // The partial paths that are yet to be extended, given by their probability and their last node.
+    std::priority_queue<std::pair<ValueType, uint64_t>> candidates;
+
+    // The partial paths that were deferred, because their last state was already popped sufficiently often.
+    std::vector<uint64_t> deferredCandidates;
+
+    // For each discovered state, how often a path ending in it was popped.
+    std::vector<uint64_t> numberOfPops;
+
+    // The number of times a state may currently be popped (the largest number of paths requested so far).
+    uint64_t maximalNumberOfPops;
+
+    // The last nodes of the paths computed so far, sorted by descending probability.
+    std::vector<uint64_t> kShortestPaths;
+};
+
+}  // namespace ksp
+}  // namespace utility
+}  // namespace storm
@@ -0,0 +1,198 @@
+#include "storm/utility/permutation.h"
+
+#include <algorithm>
+#include <numeric>
+
+#include "storm/adapters/RationalFunctionAdapter.h"
+#include "storm/adapters/RationalNumberAdapter.h"
+#include "storm/storage/BitVector.h"
+#include "storm/storage/SparseMatrix.h"
+#include "storm/storage/StronglyConnectedComponentDecomposition.h"
+#include "storm/utility/macros.h"
+
+#include "storm/exceptions/InvalidArgumentException.h"
+
+namespace storm {
+namespace utility {
+namespace permutation {
+
+std::string orderKindToString(OrderKind order) {
+    switch (order) {
+        case OrderKind::ReverseCuthillMcKee:
+            return "rcm";
+        case OrderKind::SccTopological:
+            return "scc";
+        case OrderKind::LocalityBfs:
+            return "bfs";
+    }
+    STORM_LOG_THROW(false, storm::exceptions::InvalidArgumentException, "unhandled order kind");
+}
+
+std::vector<OrderKind> getOrderKinds() {
+    return {OrderKind::ReverseCuthillMcKee, OrderKind::SccTopological, OrderKind::LocalityBfs};
+}
+
+/*!
+ * Computes for each state the (distinct) states that are either a successor or a predecessor of it.
+ */
+template<typename ValueType>
+std::vector<std::vector<uint64_t>> getUndirectedNeighbors(storm::storage::SparseMatrix<ValueType> const& transitionMatrix) {
+    uint64_t const numStates = transitionMatrix.getRowGroupCount();
+    std::vector<std::vector<uint64_t>> neighbors(numStates);
+    for (uint64_t state = 0; state < numStates; ++state) {
+        for (auto const& entry : transitionMatrix.getRowGroup(state)) {
+            if (entry.getColumn() != state) {
+                neighbors[state].push_back(entry.getColumn());
+                neighbors[entry.getColumn()].push_back(state);
+            }
+        }
+    }
+    for (auto& stateNeighbors : neighbors) {
+        std::sort(stateNeighbors.begin(), stateNeighbors.end());
+        stateNeighbors.erase(std::unique(stateNeighbors.begin(), stateNeighbors.end()), stateNeighbors.end());
+    }
+    return neighbors;
+}
+
+template<typename ValueType>
+std::vector<uint64_t> createReverseCuthillMcKeePermutation(storm::storage::SparseMatrix<ValueType> const& transitionMatrix) {
+    uint64_t const numStates = transitionMatrix.getRowGroupCount();
+    auto const neighbors = getUndirectedNeighbors(transitionMatrix);
+    auto lowerDegree = [&neighbors](uint64_t lhs, uint64_t rhs) { return neighbors[lhs].size() < neighbors[rhs].size(); };
+
+    // Each connected component is explored starting with a state of minimal degree.
+    std::vector<uint64_t> startCandidates(numStates);
+    std::iota(startCandidates.begin(), startCandidates.end(), 0ull);
+    std::stable_sort(startCandidates.begin(), startCandidates.end(), lowerDegree);
+
+    std::vector<uint64_t> result;
+    result.reserve(numStates);
+    storm::storage::BitVector visited(numStates, false);
+    std::vector<uint64_t> newNeighbors;
+    for (auto const& start : startCandidates) {
+        if (visited.get(start)) {
+            continue;
+        }
+        visited.set(start);
+        result.push_back(start);
+        for (uint64_t queueIndex = result.size() - 1; queueIndex < result.size(); ++queueIndex) {
+            newNeighbors.clear();
+            for (auto const& neighbor : neighbors[result[queueIndex]]) {
+                if (!visited.get(neighbor)) {
+                    visited.set(neighbor);
+                    newNeighbors.push_back(neighbor);
+                }
+            }
+            std::stable_sort(newNeighbors.begin(), newNeighbors.end(), lowerDegree);
+            result.insert(result.end(), newNeighbors.begin(), newNeighbors.end());
+        }
+    }
+    std::reverse(result.begin(), result.end());
+    return result;
+}
+
+template<typename ValueType>
+std::vector<uint64_t> createSccTopologicalPermutation(storm::storage::SparseMatrix<ValueType> const& transitionMatrix) {
+    storm::storage::StronglyConnectedComponentDecomposition<ValueType> sccDecomposition(
+        transitionMatrix, storm::storage::StronglyConnectedComponentDecompositionOptions().forceTopologicalSort());
+    std::vector<uint64_t> result;
+    result.reserve(transitionMatrix.getRowGroupCount());
+    for (auto const& scc : sccDecomposition) {
+        result.insert(result.end(), scc.begin(), scc.end());
+    }
+    return result;
+}
+
+template<typename ValueType>
+std::vector<uint64_t> createLocalityBfsPermutation(storm::storage::SparseMatrix<ValueType> const& transitionMatrix,
+                                                   storm::storage::BitVector const& initialStates) {
+    uint64_t const numStates = transitionMatrix.getRowGroupCount();
+    std::vector<uint64_t> result;
+    result.reserve(numStates);
+    storm::storage::BitVector visited(numStates, false);
+    // Successors that are taken with a high probability are explored first so that they get an index close to their predecessor.
+    std::vector<std::pair<ValueType, uint64_t>> newSuccessors;
+    auto explore = [&](uint64_t start) {
+        visited.set(start);
+        result.push_back(start);
+        for (uint64_t queueIndex = result.size() - 1; queueIndex < result.size(); ++queueIndex) {
+            newSuccessors.clear();
+            for (auto const& entry : transitionMatrix.getRowGroup(result[queueIndex])) {
+                if (!visited.get(entry.getColumn())) {
+                    visited.set(entry.getColumn());
+                    newSuccessors.emplace_back(entry.getValue(), entry.getColumn());
+                }
+            }
+            if constexpr (!std::is_same_v<ValueType, storm::RationalFunction> && !std::is_same_v<ValueType, storm::Interval>) {
+                std::stable_sort(newSuccessors.begin(), newSuccessors.end(), [](auto const& lhs, auto const& rhs) { return lhs.first > rhs.first; });
+            }
+            for (auto const& successor : newSuccessors) {
+                result.push_back(successor.second);
+            }
+        }
+    };
+    for (auto const& initialState : initialStates) {
+        if (!visited.get(initialState)) {
+            explore(initialState);
+        }
+    }
+    // Explore the states that are not reachable from the initial states.
+    for (uint64_t state = 0; state < numStates; ++state) {
+        if (!visited.get(state)) {
+            explore(state);
+        }
+    }
+    return result;
+}
+
+template<typename ValueType>
+std::vector<uint64_t> createPermutation(OrderKind order, storm::storage::SparseMatrix<ValueType> const& transitionMatrix,
+                                        storm::storage::BitVector const& initialStates) {
+    STORM_LOG_ASSERT(transitionMatrix.getRowGroupCount() == transitionMatrix.getColumnCount(), "Expected a square transition matrix.");
+    std::vector<uint64_t> result;
+    switch (order) {
+        case OrderKind::ReverseCuthillMcKee:
+            result = createReverseCuthillMcKeePermutation(transitionMatrix);
+            break;
+        case OrderKind::SccTopological:
+            result = createSccTopologicalPermutation(transitionMatrix);
+            break;
+        case OrderKind::LocalityBfs:
+            result = createLocalityBfsPermutation(transitionMatrix, initialStates);
+            break;
+    }
+    STORM_LOG_ASSERT(isValidPermutation(result), "Created an invalid permutation.");
+    return result;
+}
+
+std::vector<uint64_t> invertPermutation(std::vector<uint64_t> const& permutation) {
+    std::vector<uint64_t> result(permutation.size());
+    for (uint64_t i = 0; i < permutation.size(); ++i) {
+        result[permutation[i]] = i;
+    }
+    return result;
+}
+
+bool isValidPermutation(std::vector<uint64_t> const& permutation) {
+    storm::storage::BitVector occurred(permutation.size(), false);
+    for (auto const& i : permutation) {
+        if (i >= permutation.size() || occurred.get(i)) {
+            return false;
+        }
+        occurred.set(i);
+    }
+    return true;
+}
+
+template std::vector<uint64_t> createPermutation(OrderKind order, storm::storage::SparseMatrix<double> const& transitionMatrix,
+                                                 storm::storage::BitVector const& initialStates);
+template std::vector<uint64_t> createPermutation(OrderKind order, storm::storage::SparseMatrix<storm::RationalNumber> const& transitionMatrix,
+                                                 storm::storage::BitVector const& initialStates);
+template std::vector<uint64_t> createPermutation(OrderKind order, storm::storage::SparseMatrix<storm::RationalFunction> const& transitionMatrix,
+                                                 storm::storage::BitVector const& initialStates);
+template std::vector<uint64_t> createPermutation(OrderKind order, storm::storage::SparseMatrix<storm::Interval> const& transitionMatrix,
+                                                 storm::storage::BitVector const& initialStates);
+
+}  // namespace permutation
+}  // namespace utility
+}  // namespace storm
@@ -0,0 +1,51 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace storm {
+namespace storage {
+template<typename ValueType>
+class SparseMatrix;
+class BitVector;
+}  // namespace storage
+
+namespace utility {
+namespace permutation {
+
+/*!
+ * The kinds of state orders that aim at improving the memory locality of (iterative) numerical methods.
+ */
+enum class OrderKind {
+    ReverseCuthillMcKee,  /// Reverse Cuthill-McKee ordering of the (undirected) transition graph. Reduces the bandwidth of the transition matrix.
+    SccTopological,       /// The states of each SCC are consecutive and SCCs are ordered such that successor SCCs come first.
+    LocalityBfs           /// Breadth first search from the initial states where states that were discovered by the same state are consecutive.
+};
+
+std::string orderKindToString(OrderKind order);
+std::vector<OrderKind> getOrderKinds();
+
+/*!
+ * Creates a permutation of the states of the given transition matrix that follows the given order.
+ * @param transitionMatrix the transition matrix (possibly with non-trivial row grouping)
+ * @param initialStates the initial states. Only relevant for orders that are based on a search starting from the initial states.
+ * @return the inverse permutation, i.e., the i'th entry is the (old) index of the state that gets new index i.
+ */
+template<typename ValueType>
+std::vector<uint64_t> createPermutation(OrderKind order, storm::storage::SparseMatrix<ValueType> const& transitionMatrix,
+                                        storm::storage::BitVector const& initialStates);
+
+/*!
+ * Inverts the given permutation.
+ */
+std::vector<uint64_t> invertPermutation(std::vector<uint64_t> const& permutation);
+
+/*!
+ * @return true iff the given vector is a permutation of the numbers 0, 1, ..., n-1, where n is the size of the given vector.
+ */
+bool isValidPermutation(std::vector<uint64_t> const& permutation);
+
+}  // namespace permutation
+}  // namespace utility
+}  // namespace storm
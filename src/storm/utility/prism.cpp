@@ -44,6 +44,33 @@ void requireNoUndefinedConstants(storm::prism::Program const& program) {
         STORM_LOG_THROW(false, storm::exceptions::InvalidArgumentException, "Program still contains these undefined constants: " + stream.str());
     }
 }
+
+storm::expressions::Expression getChangedModuleGuard(storm::prism::Program const& previousProgram, storm::prism::Program const& program,
+                                                     std::string const& moduleName) {
+    storm::expressions::ExpressionManager const& manager = program.getManager();
+    storm::expressions::Expression result = manager.boolean(false);
+    if (program.hasModule(moduleName)) {
+        for (auto const& command : program.getModule(moduleName).getCommands()) {
+            result = result || command.getGuardExpression();
+        }
+    }
+    if (previousProgram.hasModule(moduleName)) {
+        for (auto const& command : previousProgram.getModule(moduleName).getCommands()) {
+            // The guard needs to refer to the variables of the current program.
+            std::map<storm::expressions::Variable, storm::expressions::Expression> renaming;
+            for (auto const& variable : command.getGuardExpression().getVariables()) {
+                if (!manager.hasVariable(variable.getName())) {
+                    // The guard can not be evaluated in the current program, so all states need to be expanded.
+                    STORM_LOG_WARN("Variable '" << variable.getName() << "' of the previous program does not exist anymore.");
+                    return manager.boolean(true);
+                }
+                renaming.emplace(variable, manager.getVariableExpression(variable.getName()));
+            }
+            result = result || command.getGuardExpression().substitute(renaming);
+        }
+    }
+    return result.simplify();
+}
 }  // namespace prism
 }  // namespace utility
 }  // namespace storm
@@ -3,6 +3,7 @@
 
 #include <map>
 #include <set>
+#include <string>
 #include <vector>
 
 #include <boost/optional.hpp>
@@ -27,6 +28,19 @@ storm::prism::Program preprocess(storm::prism::Program const& program, std::stri
 
 void requireNoUndefinedConstants(storm::prism::Program const& program);
 
+/*!
+ * Retrieves an expression that holds in every state in which a command of the given module is enabled in the previous or in the current version
+ * of the program. The expression refers to the variables of the current program. After editing only this module, the remaining states keep their
+ * behavior, which allows to build the model of the current program incrementally (see ExplicitModelBuilder::setPreviousBuild).
+ * Both programs need to be preprocessed, i.e., their guards must not refer to constants or formulas.
+ *
+ * @param previousProgram The program before the module was edited.
+ * @param program The program after the module was edited.
+ * @param moduleName The name of the edited module. It may be missing in one of the programs.
+ */
+storm::expressions::Expression getChangedModuleGuard(storm::prism::Program const& previousProgram, storm::prism::Program const& program,
+                                                     std::string const& moduleName);
+
 }  // namespace prism
 }  // namespace utility
 }  // namespace storm
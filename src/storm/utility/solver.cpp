@@ -7,6 +7,7 @@
 #include "storm/solver/GlpkLpSolver.h"
 #include "storm/solver/GurobiLpSolver.h"
 #include "storm/solver/MathsatSmtSolver.h"
+#include "storm/solver/PortfolioSmtSolver.h"
 #include "storm/solver/SoplexLpSolver.h"
 #include "storm/solver/Z3LpSolver.h"
 #include "storm/solver/Z3SmtSolver.h"
@@ -139,6 +140,8 @@ std::unique_ptr<storm::solver::SmtSolver> SmtSolverFactory::create(storm::expres
             return std::unique_ptr<storm::solver::SmtSolver>(new storm::solver::Z3SmtSolver(manager));
         case storm::solver::SmtSolverType::Mathsat:
             return std::unique_ptr<storm::solver::SmtSolver>(new storm::solver::MathsatSmtSolver(manager));
+        case storm::solver::SmtSolverType::Portfolio:
+            return PortfolioSmtSolverFactory().create(manager);
     }
     return nullptr;
 }
@@ -151,6 +154,18 @@ std::unique_ptr<storm::solver::SmtSolver> MathsatSmtSolverFactory::create(storm:
     return std::unique_ptr<storm::solver::SmtSolver>(new storm::solver::MathsatSmtSolver(manager));
 }
 
+std::unique_ptr<storm::solver::SmtSolver> PortfolioSmtSolverFactory::create(storm::expressions::ExpressionManager& manager) const {
+    std::vector<std::unique_ptr<storm::solver::SmtSolver>> solvers;
+#ifdef STORM_HAVE_Z3
+    solvers.push_back(std::make_unique<storm::solver::Z3SmtSolver>(manager));
+#endif
+#ifdef STORM_HAVE_MSAT
+    solvers.push_back(std::make_unique<storm::solver::MathsatSmtSolver>(manager));
+#endif
+    STORM_LOG_THROW(!solvers.empty(), storm::exceptions::InvalidOperationException, "Requested an SMT solver but none was installed.");
+    return std::make_unique<storm::solver::PortfolioSmtSolver>(manager, std::move(solvers));
+}
+
 std::unique_ptr<storm::solver::SmtSolver> getSmtSolver(storm::expressions::ExpressionManager& manager) {
     std::unique_ptr<storm::utility::solver::SmtSolverFactory> factory(new SmtSolverFactory());
     return factory->create(manager);
@@ -108,5 +108,13 @@ class MathsatSmtSolverFactory : public SmtSolverFactory {
     virtual std::unique_ptr<storm::solver::SmtSolver> create(storm::expressions::ExpressionManager& manager) const;
 };
 
+/*!
+ * Creates portfolio solvers that run all available SMT solvers in parallel.
+ */
+class PortfolioSmtSolverFactory : public SmtSolverFactory {
+   public:
+    virtual std::unique_ptr<storm::solver::SmtSolver> create(storm::expressions::ExpressionManager& manager) const;
+};
+
 std::unique_ptr<storm::solver::SmtSolver> getSmtSolver(storm::expressions::ExpressionManager& manager);
 }  // namespace storm::utility::solver
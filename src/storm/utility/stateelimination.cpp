@@ -41,7 +41,8 @@ bool eliminationOrderNeedsReversedDistances(storm::settings::modules::Eliminatio
 bool eliminationOrderIsPenaltyBased(storm::settings::modules::EliminationSettings::EliminationOrder const& order) {
     return order == storm::settings::modules::EliminationSettings::EliminationOrder::StaticPenalty ||
            order == storm::settings::modules::EliminationSettings::EliminationOrder::DynamicPenalty ||
-           order == storm::settings::modules::EliminationSettings::EliminationOrder::RegularExpression;
+           order == storm::settings::modules::EliminationSettings::EliminationOrder::RegularExpression ||
+           order == storm::settings::modules::EliminationSettings::EliminationOrder::DynamicDegree;
 }
 
 bool eliminationOrderIsStatic(storm::settings::modules::EliminationSettings::EliminationOrder const& order) {
@@ -67,6 +68,25 @@ uint_fast64_t estimateComplexity(storm::RationalFunction const& value) {
 }
 #endif
 
+template<typename ValueType>
+uint_fast64_t estimateDegree(ValueType const&) {
+    return 0;
+}
+
+#ifdef STORM_HAVE_CARL
+template<>
+uint_fast64_t estimateDegree(storm::RationalFunction const& value) {
+    if (storm::utility::isConstant(value)) {
+        return 0;
+    }
+    uint_fast64_t degree = value.nominator().polynomialWithCoefficient().totalDegree();
+    if (!value.denominator().isConstant()) {
+        degree += value.denominator().polynomialWithCoefficient().totalDegree();
+    }
+    return degree;
+}
+#endif
+
 template<typename ValueType>
 uint_fast64_t computeStatePenalty(storm::storage::sparse::state_type const& state, storm::storage::FlexibleSparseMatrix<ValueType> const& transitionMatrix,
                                   storm::storage::FlexibleSparseMatrix<ValueType> const& backwardTransitions,
@@ -100,6 +120,36 @@ uint_fast64_t computeStatePenaltyRegularExpression(storm::storage::sparse::state
     return backwardTransitions.getRow(state).size() * transitionMatrix.getRow(state).size();
 }
 
+template<typename ValueType>
+uint_fast64_t computeStatePenaltyDegree(storm::storage::sparse::state_type const& state, storm::storage::FlexibleSparseMatrix<ValueType> const& transitionMatrix,
+                                        storm::storage::FlexibleSparseMatrix<ValueType> const& backwardTransitions,
+                                        std::vector<ValueType> const& oneStepProbabilities) {
+    // Eliminating a self-loop scales all outgoing transitions with 1/(1-loop).
+    uint_fast64_t loopDegree = 0;
+    for (auto const& successor : transitionMatrix.getRow(state)) {
+        if (successor.getColumn() == state) {
+            loopDegree = estimateDegree(successor.getValue());
+        }
+    }
+
+    // Every pair of predecessor and successor yields a (new or updated) transition whose degree is roughly the sum of the degrees of its factors.
+    // Adding one per pair also accounts for the number of transitions that are created.
+    uint_fast64_t penalty = 0;
+    for (auto const& predecessor : backwardTransitions.getRow(state)) {
+        if (predecessor.getColumn() == state) {
+            continue;
+        }
+        uint_fast64_t predecessorDegree = estimateDegree(predecessor.getValue()) + loopDegree;
+        for (auto const& successor : transitionMatrix.getRow(state)) {
+            if (successor.getColumn() != state) {
+                penalty += predecessorDegree + estimateDegree(successor.getValue()) + 1;
+            }
+        }
+        penalty += predecessorDegree + estimateDegree(oneStepProbabilities[state]) + 1;
+    }
+    return penalty;
+}
+
 template<typename ValueType>
 std::shared_ptr<StatePriorityQueue> createStatePriorityQueue(boost::optional<std::vector<uint_fast64_t>> const& distanceBasedStatePriorities,
                                                              storm::storage::FlexibleSparseMatrix<ValueType> const& transitionMatrix,
@@ -129,9 +179,12 @@ std::shared_ptr<StatePriorityQueue> createStatePriorityQueue(boost::optional<std
             return std::make_unique<StaticStatePriorityQueue>(sortedStates);
         } else if (eliminationOrderIsPenaltyBased(order)) {
             std::vector<std::pair<storm::storage::sparse::state_type, uint_fast64_t>> statePenalties(sortedStates.size());
-            typename DynamicStatePriorityQueue<ValueType>::PenaltyFunctionType penaltyFunction =
-                order == storm::settings::modules::EliminationSettings::EliminationOrder::RegularExpression ? computeStatePenaltyRegularExpression<ValueType>
-                                                                                                            : computeStatePenalty<ValueType>;
+            typename DynamicStatePriorityQueue<ValueType>::PenaltyFunctionType penaltyFunction = computeStatePenalty<ValueType>;
+            if (order == storm::settings::modules::EliminationSettings::EliminationOrder::RegularExpression) {
+                penaltyFunction = computeStatePenaltyRegularExpression<ValueType>;
+            } else if (order == storm::settings::modules::EliminationSettings::EliminationOrder::DynamicDegree) {
+                penaltyFunction = computeStatePenaltyDegree<ValueType>;
+            }
             for (uint_fast64_t index = 0; index < sortedStates.size(); ++index) {
                 statePenalties[index] =
                     std::make_pair(sortedStates[index], penaltyFunction(sortedStates[index], transitionMatrix, backwardTransitions, oneStepProbabilities));
@@ -229,6 +282,7 @@ std::vector<uint_fast64_t> getStateDistances(storm::storage::SparseMatrix<ValueT
 }
 
 template uint_fast64_t estimateComplexity(double const& value);
+template uint_fast64_t estimateDegree(double const& value);
 template std::shared_ptr<StatePriorityQueue> createStatePriorityQueue(boost::optional<std::vector<uint_fast64_t>> const& distanceBasedStatePriorities,
                                                                       storm::storage::FlexibleSparseMatrix<double> const& transitionMatrix,
                                                                       storm::storage::FlexibleSparseMatrix<double> const& backwardTransitions,
@@ -237,6 +291,10 @@ template uint_fast64_t computeStatePenalty(storm::storage::sparse::state_type co
                                            storm::storage::FlexibleSparseMatrix<double> const& transitionMatrix,
                                            storm::storage::FlexibleSparseMatrix<double> const& backwardTransitions,
                                            std::vector<double> const& oneStepProbabilities);
+template uint_fast64_t computeStatePenaltyDegree(storm::storage::sparse::state_type const& state,
+                                                 storm::storage::FlexibleSparseMatrix<double> const& transitionMatrix,
+                                                 storm::storage::FlexibleSparseMatrix<double> const& backwardTransitions,
+                                                 std::vector<double> const& oneStepProbabilities);
 template uint_fast64_t computeStatePenaltyRegularExpression(storm::storage::sparse::state_type const& state,
                                                             storm::storage::FlexibleSparseMatrix<double> const& transitionMatrix,
                                                             storm::storage::FlexibleSparseMatrix<double> const& backwardTransitions,
@@ -252,6 +310,7 @@ template std::vector<uint_fast64_t> getStateDistances(storm::storage::SparseMatr
 
 #ifdef STORM_HAVE_CARL
 template uint_fast64_t estimateComplexity(storm::RationalNumber const& value);
+template uint_fast64_t estimateDegree(storm::RationalNumber const& value);
 template std::shared_ptr<StatePriorityQueue> createStatePriorityQueue(boost::optional<std::vector<uint_fast64_t>> const& distanceBasedStatePriorities,
                                                                       storm::storage::FlexibleSparseMatrix<storm::RationalNumber> const& transitionMatrix,
                                                                       storm::storage::FlexibleSparseMatrix<storm::RationalNumber> const& backwardTransitions,
@@ -261,6 +320,10 @@ template uint_fast64_t computeStatePenalty(storm::storage::sparse::state_type co
                                            storm::storage::FlexibleSparseMatrix<storm::RationalNumber> const& transitionMatrix,
                                            storm::storage::FlexibleSparseMatrix<storm::RationalNumber> const& backwardTransitions,
                                            std::vector<storm::RationalNumber> const& oneStepProbabilities);
+template uint_fast64_t computeStatePenaltyDegree(storm::storage::sparse::state_type const& state,
+                                                 storm::storage::FlexibleSparseMatrix<storm::RationalNumber> const& transitionMatrix,
+                                                 storm::storage::FlexibleSparseMatrix<storm::RationalNumber> const& backwardTransitions,
+                                                 std::vector<storm::RationalNumber> const& oneStepProbabilities);
 template uint_fast64_t computeStatePenaltyRegularExpression(storm::storage::sparse::state_type const& state,
                                                             storm::storage::FlexibleSparseMatrix<storm::RationalNumber> const& transitionMatrix,
                                                             storm::storage::FlexibleSparseMatrix<storm::RationalNumber> const& backwardTransitions,
@@ -283,6 +346,10 @@ template uint_fast64_t computeStatePenalty(storm::storage::sparse::state_type co
                                            storm::storage::FlexibleSparseMatrix<storm::RationalFunction> const& transitionMatrix,
                                            storm::storage::FlexibleSparseMatrix<storm::RationalFunction> const& backwardTransitions,
                                            std::vector<storm::RationalFunction> const& oneStepProbabilities);
+template uint_fast64_t computeStatePenaltyDegree(storm::storage::sparse::state_type const& state,
+                                                 storm::storage::FlexibleSparseMatrix<storm::RationalFunction> const& transitionMatrix,
+                                                 storm::storage::FlexibleSparseMatrix<storm::RationalFunction> const& backwardTransitions,
+                                                 std::vector<storm::RationalFunction> const& oneStepProbabilities);
 template uint_fast64_t computeStatePenaltyRegularExpression(storm::storage::sparse::state_type const& state,
                                                             storm::storage::FlexibleSparseMatrix<storm::RationalFunction> const& transitionMatrix,
                                                             storm::storage::FlexibleSparseMatrix<storm::RationalFunction> const& backwardTransitions,
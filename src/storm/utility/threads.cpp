@@ -1,8 +1,16 @@
 #include "storm/utility/threads.h"
 
 #include <cstdlib>
+#include <memory>
 #include <thread>
+#include <vector>
 
+#ifdef __linux__
+#include <pthread.h>
+#include <sched.h>
+#endif
+
+#include "storm/adapters/IntelTbbAdapter.h"
 #include "storm/io/file.h"
 
 namespace storm::utility {
@@ -48,6 +56,47 @@ uint tryReadFromCgroups() {
     return 0u;
 }
 
+#ifdef STORM_HAVE_INTELTBB
+// Limits the parallelism of the TBB scheduler for as long as it is alive.
+static std::unique_ptr<tbb::global_control> parallelismLimit;
+
+#ifdef __linux__
+/*!
+ * Pins each thread that enters the TBB scheduler to one of the CPUs available to the process (determined by its slot in the arena).
+ */
+class PinningObserver : public tbb::task_scheduler_observer {
+   public:
+    PinningObserver() {
+        cpu_set_t availableCpus;
+        CPU_ZERO(&availableCpus);
+        if (sched_getaffinity(0, sizeof(availableCpus), &availableCpus) == 0) {
+            for (int cpu = 0; cpu < CPU_SETSIZE; ++cpu) {
+                if (CPU_ISSET(cpu, &availableCpus)) {
+                    cpus.push_back(cpu);
+                }
+            }
+        }
+    }
+
+    void on_scheduler_entry(bool) override {
+        int index = tbb::this_task_arena::current_thread_index();
+        if (cpus.empty() || index < 0) {
+            return;
+        }
+        cpu_set_t cpuSet;
+        CPU_ZERO(&cpuSet);
+        CPU_SET(cpus[index % cpus.size()], &cpuSet);
+        pthread_setaffinity_np(pthread_self(), sizeof(cpuSet), &cpuSet);
+    }
+
+   private:
+    std::vector<int> cpus;
+};
+
+static std::unique_ptr<PinningObserver> pinningObserver;
+#endif
+#endif
+
 }  // namespace detail
 
 uint getNumberOfThreads() {
@@ -65,4 +114,30 @@ uint getNumberOfThreads() {
     }
     return detail::num_threads;
 }
+
+void setNumberOfThreads(uint numberOfThreads) {
+    detail::num_threads = numberOfThreads;
+    auto const actualNumberOfThreads = getNumberOfThreads();
+#ifdef STORM_HAVE_INTELTBB
+    // Replace the previous limit (if any) such that the last call determines the parallelism of TBB.
+    detail::parallelismLimit.reset();
+    detail::parallelismLimit = std::make_unique<tbb::global_control>(tbb::global_control::max_allowed_parallelism, actualNumberOfThreads);
+#else
+    STORM_LOG_WARN_COND(actualNumberOfThreads <= 1, "Storm was built without TBB. Only some components will use multiple threads.");
+#endif
+}
+
+void setThreadPinning(bool enable) {
+#if defined(STORM_HAVE_INTELTBB) && defined(__linux__)
+    if (enable && !detail::pinningObserver) {
+        detail::pinningObserver = std::make_unique<detail::PinningObserver>();
+        detail::pinningObserver->observe(true);
+    } else if (!enable && detail::pinningObserver) {
+        detail::pinningObserver->observe(false);
+        detail::pinningObserver.reset();
+    }
+#else
+    STORM_LOG_WARN_COND(!enable, "Pinning threads to CPUs is not supported on this platform or without TBB.");
+#endif
+}
 }  // namespace storm::utility
\ No newline at end of file
@@ -2,6 +2,27 @@
 
 namespace storm {
 namespace utility {
+
+/*!
+ * Retrieves the number of threads that Storm may use. Unless set explicitly, this is derived from the hardware and limitations imposed via Slurm
+ * or cgroups. All parallel components (TBB-based computations, state space exploration, bisimulation and Sylvan) default to this number.
+ */
 uint getNumberOfThreads();
-}
-}  // namespace storm
\ No newline at end of file
+
+/*!
+ * Sets the number of threads that Storm may use. This also limits the number of worker threads of the (shared) TBB scheduler, such that all
+ * parallel computations draw from the same pool of threads.
+ *
+ * @param numberOfThreads The number of threads. A value of 0 restores the automatic detection.
+ */
+void setNumberOfThreads(uint numberOfThreads);
+
+/*!
+ * Sets whether the worker threads of the TBB scheduler are pinned to distinct CPUs (if supported by the platform). CPUs are assigned in the
+ * order in which the operating system enumerates the CPUs available to the process, which keeps threads with neighbouring indices on the same
+ * socket (and hence NUMA node).
+ */
+void setThreadPinning(bool enable);
+
+}  // namespace utility
+}  // namespace storm
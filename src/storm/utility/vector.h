@@ -4,7 +4,9 @@
 #include <algorithm>
 #include <functional>
 #include <iosfwd>
+#include <iterator>
 #include <numeric>
+#include <type_traits>
 #include "storm/adapters/IntelTbbAdapter.h"
 #include "storm/adapters/RationalNumberAdapter.h"
 
@@ -54,6 +56,82 @@ std::size_t findOrInsert(std::vector<T>& vector, T&& element) {
     return position;
 }
 
+namespace detail {
+// Vectors below this size (in bytes) are not worth distributing among the threads.
+uint64_t const minimalParallelFirstTouchSize = 4ull << 20;
+uint64_t const assumedPageSize = 4096;
+}  // namespace detail
+
+/*!
+ * Reserves storage for the given number of elements in the given (empty) vector such that the first write to each memory page of the storage is
+ * performed by the threads of the TBB scheduler, each thread writing a contiguous range of rows.
+ * On NUMA systems, the operating system places a page on the node of the thread that touches it first. Hence, the rows end up close to the
+ * threads that process them in parallel computations, instead of all residing on the node of the allocating thread.
+ *
+ * @param vector The vector for which to reserve storage. It must be empty.
+ * @param size The number of elements to reserve.
+ * @param rowIndications If given, row i consists of the elements rowIndications[i], ..., rowIndications[i+1]-1 (as for the entries of a sparse
+ * matrix). Otherwise, every element forms a row.
+ */
+template<typename T>
+void reserveWithParallelFirstTouch(std::vector<T>& vector, uint64_t size, std::vector<uint64_t> const* rowIndications = nullptr) {
+    STORM_LOG_ASSERT(vector.empty(), "Expected an empty vector.");
+    vector.reserve(size);
+#ifdef STORM_HAVE_INTELTBB
+    // Objects that manage memory of their own would not benefit.
+    if constexpr (std::is_trivially_copyable<T>::value) {
+        if (size * sizeof(T) < detail::minimalParallelFirstTouchSize || tbb::this_task_arena::max_concurrency() <= 1) {
+            return;
+        }
+        // Writing a single byte per page suffices to determine its placement. The elements are constructed later.
+        char* storage = reinterpret_cast<char*>(vector.data());
+        uint64_t numberOfRows = rowIndications ? rowIndications->size() - 1 : size;
+        // Use the same grain size as the parallel matrix-vector multiplications, but distribute the rows statically, such that each thread
+        // touches one contiguous chunk.
+        tbb::parallel_for(
+            tbb::blocked_range<uint64_t>(0, numberOfRows, 100),
+            [&](tbb::blocked_range<uint64_t> const& range) {
+                uint64_t first = (rowIndications ? (*rowIndications)[range.begin()] : range.begin()) * sizeof(T);
+                uint64_t last = (rowIndications ? (*rowIndications)[range.end()] : range.end()) * sizeof(T);
+                for (uint64_t byte = first; byte < last; byte += detail::assumedPageSize) {
+                    storage[byte] = 0;
+                }
+            },
+            tbb::static_partitioner());
+    }
+#endif
+}
+
+/*!
+ * Creates a vector of the given size whose storage is distributed among the threads (see reserveWithParallelFirstTouch).
+ */
+template<typename T>
+std::vector<T> createWithParallelFirstTouch(uint64_t size, T const& value = T()) {
+    std::vector<T> result;
+    reserveWithParallelFirstTouch(result, size);
+    result.resize(size, value);
+    return result;
+}
+
+/*!
+ * Moves the elements of the given vector to storage that is distributed among the threads (see reserveWithParallelFirstTouch). Vectors that are
+ * too small to benefit are left untouched.
+ */
+template<typename T>
+void redistributeWithParallelFirstTouch(std::vector<T>& vector, std::vector<uint64_t> const* rowIndications = nullptr) {
+#ifdef STORM_HAVE_INTELTBB
+    if constexpr (std::is_trivially_copyable<T>::value) {
+        if (vector.size() * sizeof(T) < detail::minimalParallelFirstTouchSize || tbb::this_task_arena::max_concurrency() <= 1) {
+            return;
+        }
+        std::vector<T> redistributed;
+        reserveWithParallelFirstTouch(redistributed, vector.size(), rowIndications);
+        redistributed.insert(redistributed.end(), std::make_move_iterator(vector.begin()), std::make_move_iterator(vector.end()));
+        vector = std::move(redistributed);
+    }
+#endif
+}
+
 template<typename T>
 void setAllValues(std::vector<T>& vec, storm::storage::BitVector const& positions, T const& positiveValue = storm::utility::one<T>(),
                   T const& negativeValue = storm::utility::zero<T>()) {
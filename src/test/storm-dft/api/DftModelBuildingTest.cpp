@@ -3,6 +3,7 @@
 
 #include "storm-dft/api/storm-dft.h"
 #include "storm-dft/builder/ExplicitDFTModelBuilder.h"
+#include "storm-dft/utility/SymmetryFinder.h"
 #include "storm-parsers/api/storm-parsers.h"
 
 namespace {
@@ -87,4 +88,29 @@ TEST(DftModelBuildingTest, RelevantEvents) {
     EXPECT_EQ(13ul, model->getNumberOfTransitions());
 }
 
+TEST(DftModelBuildingTest, NestedSymmetries) {
+    // Three levels of nested symmetric subtrees with 8 identical BEs
+    std::string file = STORM_TEST_RESOURCES_DIR "/dft/symmetry_nested.dft";
+    std::shared_ptr<storm::dft::storage::DFT<double>> dft = storm::dft::api::loadDFTGalileoFile<double>(file);
+    EXPECT_TRUE(storm::dft::api::isWellFormed(*dft).first);
+    dft->setRelevantEvents(storm::dft::utility::RelevantEvents{}, false);
+
+    // Build model without symmetry reduction
+    storm::dft::storage::DftSymmetries noSymmetries;
+    storm::dft::builder::ExplicitDFTModelBuilder<double> builder(*dft, noSymmetries);
+    builder.buildModel(0, 0.0);
+    std::shared_ptr<storm::models::sparse::Model<double>> model = builder.getModel();
+    EXPECT_EQ(256ul, model->getNumberOfStates());
+    EXPECT_EQ(0ul, builder.getNrSymmetricStates());
+
+    // Build model with symmetry reduction
+    // Each state is given by the multiset of the states of the two subtrees (recursively): 3 -> 6 -> 21 states
+    storm::dft::storage::DftSymmetries symmetries = storm::dft::utility::SymmetryFinder<double>::findSymmetries(*dft);
+    storm::dft::builder::ExplicitDFTModelBuilder<double> builder2(*dft, symmetries);
+    builder2.buildModel(0, 0.0);
+    model = builder2.getModel();
+    EXPECT_EQ(21ul, model->getNumberOfStates());
+    EXPECT_LT(0ul, builder2.getNrSymmetricStates());
+}
+
 }  // namespace
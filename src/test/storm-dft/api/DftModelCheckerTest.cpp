@@ -301,6 +301,12 @@ TYPED_TEST(DftModelCheckerTest, Symmetry) {
     EXPECT_NEAR(result, 6553 / 5376.0, this->precision());
     result = this->analyzeReliability(STORM_TEST_RESOURCES_DIR "/dft/pdep_symmetry.dft", 1.0);
     EXPECT_NEAR(result, 0.4223514414, this->precisionReliability());
+
+    // Maximum of 8 exponential distributions with rate 0.5
+    result = this->analyzeMTTF(STORM_TEST_RESOURCES_DIR "/dft/symmetry_nested.dft");
+    EXPECT_NEAR(result, 761 / 140.0, this->precision());
+    result = this->analyzeReliability(STORM_TEST_RESOURCES_DIR "/dft/symmetry_nested.dft", 1.0);
+    EXPECT_NEAR(result, 0.0005744962, this->precisionReliability());
 }
 
 TYPED_TEST(DftModelCheckerTest, HecsReliability) {
@@ -0,0 +1,69 @@
+#include "storm-config.h"
+#include "test/storm_gtest.h"
+
+#include <carl/core/VariablePool.h>
+#include "storm-dft/api/storm-dft.h"
+#include "storm-dft/modelchecker/DftSkeletonChecker.h"
+#include "storm-dft/transformations/DftInstantiator.h"
+#include "storm-parsers/api/storm-parsers.h"
+
+namespace {
+
+// Compare results of the skeleton against the analysis of the instantiated DFT
+void checkAgainstInstantiation(storm::dft::storage::DFT<storm::RationalFunction> const& dft,
+                               std::vector<storm::utility::parametric::Valuation<storm::RationalFunction>> const& valuations) {
+    std::vector<std::shared_ptr<storm::logic::Formula const>> properties =
+        storm::api::extractFormulasFromProperties(storm::api::parseProperties("Tmin=? [F \"failed\"]; Pmin=? [F<=1 \"failed\"]"));
+
+    storm::dft::modelchecker::DftSkeletonChecker checker(dft, properties);
+    storm::dft::transformations::DftInstantiator<storm::RationalFunction, double> instantiator(dft);
+
+    for (auto const& valuation : valuations) {
+        std::vector<double> results = checker.check(valuation);
+        ASSERT_EQ(2ul, results.size());
+
+        std::shared_ptr<storm::dft::storage::DFT<double>> instDft = instantiator.instantiate(valuation);
+        auto expected = storm::dft::api::analyzeDFT<double>(*instDft, properties, true, false);
+        EXPECT_NEAR(boost::get<double>(expected[0]), results[0], 1e-6);
+        EXPECT_NEAR(boost::get<double>(expected[1]), results[1], 1e-6);
+    }
+}
+
+TEST(DftSkeletonCheckerTest, And) {
+    carl::VariablePool::getInstance().clear();
+
+    std::string file = STORM_TEST_RESOURCES_DIR "/dft/and_param.dft";
+    std::shared_ptr<storm::dft::storage::DFT<storm::RationalFunction>> dft = storm::dft::api::loadDFTGalileoFile<storm::RationalFunction>(file);
+    dft = storm::dft::api::prepareForMarkovAnalysis<storm::RationalFunction>(*dft);
+
+    storm::RationalFunctionVariable const& x = carl::VariablePool::getInstance().findVariableWithName("x");
+    ASSERT_NE(x, carl::Variable::NO_VARIABLE);
+
+    std::vector<storm::utility::parametric::Valuation<storm::RationalFunction>> valuations;
+    for (double value : {0.5, 1.0, 3.0}) {
+        valuations.push_back({{x, storm::utility::convertNumber<storm::RationalFunctionCoefficient>(value)}});
+    }
+    checkAgainstInstantiation(*dft, valuations);
+}
+
+TEST(DftSkeletonCheckerTest, Symmetry) {
+    carl::VariablePool::getInstance().clear();
+
+    std::string file = STORM_TEST_RESOURCES_DIR "/dft/symmetry_param.dft";
+    std::shared_ptr<storm::dft::storage::DFT<storm::RationalFunction>> dft = storm::dft::api::loadDFTGalileoFile<storm::RationalFunction>(file);
+    dft = storm::dft::api::prepareForMarkovAnalysis<storm::RationalFunction>(*dft);
+
+    storm::RationalFunctionVariable const& x = carl::VariablePool::getInstance().findVariableWithName("x");
+    ASSERT_NE(x, carl::Variable::NO_VARIABLE);
+    storm::RationalFunctionVariable const& y = carl::VariablePool::getInstance().findVariableWithName("y");
+    ASSERT_NE(y, carl::Variable::NO_VARIABLE);
+
+    std::vector<storm::utility::parametric::Valuation<storm::RationalFunction>> valuations;
+    for (auto const& [xValue, yValue] : std::vector<std::pair<double, double>>{{5, 0.01}, {1, 0.5}, {0.2, 2}}) {
+        valuations.push_back({{x, storm::utility::convertNumber<storm::RationalFunctionCoefficient>(xValue)},
+                              {y, storm::utility::convertNumber<storm::RationalFunctionCoefficient>(yValue)}});
+    }
+    checkAgainstInstantiation(*dft, valuations);
+}
+
+}  // namespace
@@ -1,6 +1,8 @@
 #include <gmm/gmm_std.h>
 #include "test/storm_gtest.h"
 
+#include <algorithm>
+#include <map>
 #include <vector>
 
 #include "storm-config.h"
@@ -122,6 +124,85 @@ TEST_P(SftBddTest, RRW) {
     expectVectorNear(checker->getAllRRWsAtTimebound(1), param.RRW);
 }
 
+TEST_P(SftBddTest, Timepoints) {
+    std::vector<double> const timepoints{0.5, 1, 2};
+    // Use a chunk size that does not divide the number of timepoints
+    auto const probabilities{checker->getProbabilitiesAtTimepoints(timepoints, 2)};
+    auto const birnbaumFactors{checker->getAllBirnbaumFactorsAtTimepoints(timepoints, 2)};
+    auto const basicElements{checker->getDFT()->getBasicElements()};
+    ASSERT_EQ(probabilities.size(), timepoints.size());
+    ASSERT_EQ(birnbaumFactors.size(), basicElements.size());
+    for (size_t i{0}; i < timepoints.size(); ++i) {
+        EXPECT_NEAR(probabilities[i], checker->getProbabilityAtTimebound(timepoints[i]), 1e-6);
+        auto const expectedBirnbaumFactors{checker->getAllBirnbaumFactorsAtTimebound(timepoints[i])};
+        for (size_t beIndex{0}; beIndex < basicElements.size(); ++beIndex) {
+            EXPECT_NEAR(birnbaumFactors[beIndex][i], expectedBirnbaumFactors[beIndex], 1e-6);
+        }
+    }
+    auto const firstBirnbaumFactors{checker->getBirnbaumFactorsAtTimepoints(basicElements.front()->name(), timepoints)};
+    expectVectorNear(firstBirnbaumFactors, std::vector<double>{birnbaumFactors[0][0], birnbaumFactors[0][1], birnbaumFactors[0][2]});
+}
+
+TEST_P(SftBddTest, MinimalCutSets) {
+    auto const minimalCutSets{checker->getMinimalCutSetsAsIndices()};
+    ASSERT_FALSE(minimalCutSets.empty());
+    EXPECT_EQ(checker->getNumberOfMinimalCutSets(), minimalCutSets.size());
+
+    size_t const maxOrder{2};
+    std::vector<std::vector<uint32_t>> smallCutSets{};
+    checker->forEachMinimalCutSet(
+        [&smallCutSets](std::vector<uint32_t> const &cutSet) {
+            smallCutSets.push_back(cutSet);
+            return true;
+        },
+        {maxOrder});
+    auto const expectedSmallCutSets{
+        std::count_if(minimalCutSets.begin(), minimalCutSets.end(), [maxOrder](auto const &cutSet) { return cutSet.size() <= maxOrder; })};
+    EXPECT_EQ(smallCutSets.size(), static_cast<size_t>(expectedSmallCutSets));
+    EXPECT_EQ(checker->getNumberOfMinimalCutSets(maxOrder), smallCutSets.size());
+
+    // The enumeration can be aborted
+    size_t visited{0};
+    checker->forEachMinimalCutSet([&visited](std::vector<uint32_t> const &) { return ++visited < 1; });
+    EXPECT_EQ(visited, 1ul);
+
+    // Compare the most probable cut sets with the probabilities of all cut sets
+    auto const sylvanBddManager{checker->getSylvanBddManager()};
+    std::map<uint32_t, double> indexToProbability{};
+    for (auto const &be : checker->getDFT()->getBasicElements()) {
+        indexToProbability[sylvanBddManager->getIndex(be->name())] = be->getUnreliability(1);
+    }
+    std::vector<double> probabilities{};
+    for (auto const &cutSet : minimalCutSets) {
+        double probability{1};
+        for (auto const index : cutSet) {
+            probability *= indexToProbability.at(index);
+        }
+        probabilities.push_back(probability);
+    }
+    std::sort(probabilities.begin(), probabilities.end(), std::greater<double>());
+
+    size_t const k{3};
+    auto const mostProbable{checker->getMostProbableMinimalCutSets(k, 1)};
+    ASSERT_EQ(mostProbable.size(), std::min(k, minimalCutSets.size()));
+    for (size_t i{0}; i < mostProbable.size(); ++i) {
+        EXPECT_NEAR(mostProbable[i].second, probabilities[i], 1e-6);
+    }
+
+    // Avoid rounding issues at the cutoff
+    double const minProbability{probabilities.front() * (1 - 1e-9)};
+    std::vector<std::vector<uint32_t>> probableCutSets{};
+    checker->forEachMinimalCutSet(
+        [&probableCutSets](std::vector<uint32_t> const &cutSet) {
+            probableCutSets.push_back(cutSet);
+            return true;
+        },
+        {0, minProbability, 1});
+    auto const expectedProbableCutSets{
+        std::count_if(probabilities.begin(), probabilities.end(), [minProbability](double const probability) { return probability >= minProbability; })};
+    EXPECT_EQ(probableCutSets.size(), static_cast<size_t>(expectedProbableCutSets));
+}
+
 static std::vector<SftTestData> sftTestData{
     {
         "And",
@@ -28,6 +28,16 @@ TEST_P(BddModularizerTest, ProbabilityAtTimeOne) {
     EXPECT_NEAR(checker->getProbabilityAtTimebound(1), param.probabilityAtTimeboundOne, 1e-6);
 }
 
+TEST_P(BddModularizerTest, ProbabilityAtTimeOneParallel) {
+    auto const &param{TestWithParam::GetParam()};
+    auto dft{storm::dft::api::loadDFTGalileoFile<double>(param.filepath)};
+    storm::dft::modelchecker::DftModularizationChecker<double> parallelChecker{dft, 4};
+    auto const probabilities{parallelChecker.getProbabilitiesAtTimepoints({0.5, 1})};
+    ASSERT_EQ(probabilities.size(), 2ul);
+    EXPECT_NEAR(probabilities[1], param.probabilityAtTimeboundOne, 1e-6);
+    EXPECT_NEAR(probabilities[0], checker->getProbabilityAtTimebound(0.5), 1e-6);
+}
+
 static std::vector<ModularizerTestData> modularizerTestData{
     {
         "And",
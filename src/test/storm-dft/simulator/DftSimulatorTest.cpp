@@ -3,6 +3,7 @@
 
 #include "storm-dft/api/storm-dft.h"
 #include "storm-dft/generator/DftNextStateGenerator.h"
+#include "storm-dft/simulator/DFTSimulationEngine.h"
 #include "storm-dft/simulator/DFTTraceSimulator.h"
 #include "storm-dft/storage/DftSymmetries.h"
 
@@ -43,6 +44,20 @@ std::pair<double, double> simulateDft(std::string const& file, double timebound,
     return std::make_pair(count, invalid);
 }
 
+storm::dft::simulator::SimulationEstimate simulateDftParallel(std::string const& file, double timebound,
+                                                             storm::dft::simulator::DFTSimulationEngine<double>::Options const& options) {
+    // Load, build and prepare DFT
+    std::shared_ptr<storm::dft::storage::DFT<double>> dft =
+        storm::dft::api::prepareForMarkovAnalysis<double>(*(storm::dft::api::loadDFTGalileoFile<double>(file)));
+    storm::dft::utility::RelevantEvents relevantEvents = storm::dft::api::computeRelevantEvents({}, {});
+    dft->setRelevantEvents(relevantEvents, false);
+    storm::dft::storage::DftSymmetries symmetries;
+    storm::dft::storage::DFTStateGenerationInfo stateGenerationInfo(dft->buildStateGenerationInfo(symmetries));
+
+    storm::dft::simulator::DFTSimulationEngine<double> engine(*dft, stateGenerationInfo, options);
+    return engine.estimateUnreliability(timebound);
+}
+
 double simulateDftProb(std::string const& file, double timebound, size_t noRuns) {
     size_t count;
     size_t invalid;
@@ -188,4 +203,33 @@ TEST(DftSimulatorTest, HecsUnreliability) {
     EXPECT_NEAR(result, 0.00021997582, 0.001);
 }
 
+TEST(DftSimulatorTest, ParallelSimulation) {
+    storm::dft::simulator::DFTSimulationEngine<double>::Options options;
+    options.batchSize = 1000;
+    options.maxTraces = 20000;
+    auto result = simulateDftParallel(STORM_TEST_RESOURCES_DIR "/dft/spare3.dft", 1, options);
+    EXPECT_EQ(20000ul, result.getNumberOfTraces());
+    EXPECT_FALSE(result.converged);
+    EXPECT_NEAR(result.probability, 0.4660673246, 0.02);
+
+    // The result only depends on the seed and not on the number of threads
+    options.numberOfThreads = 4;
+    auto resultParallel = simulateDftParallel(STORM_TEST_RESOURCES_DIR "/dft/spare3.dft", 1, options);
+    EXPECT_EQ(result.successfulTraces, resultParallel.successfulTraces);
+    EXPECT_EQ(result.unsuccessfulTraces, resultParallel.unsuccessfulTraces);
+
+    // Stop as soon as the confidence interval is small enough
+    options.maxTraces = 1000000;
+    options.maxHalfWidth = 0.01;
+    resultParallel = simulateDftParallel(STORM_TEST_RESOURCES_DIR "/dft/spare3.dft", 1, options);
+    EXPECT_TRUE(resultParallel.converged);
+    EXPECT_LE(resultParallel.halfWidth, 0.01);
+    EXPECT_LT(resultParallel.getNumberOfTraces(), options.maxTraces);
+    EXPECT_NEAR(resultParallel.probability, 0.4660673246, 0.02);
+    options.numberOfThreads = 1;
+    result = simulateDftParallel(STORM_TEST_RESOURCES_DIR "/dft/spare3.dft", 1, options);
+    EXPECT_EQ(result.getNumberOfTraces(), resultParallel.getNumberOfTraces());
+    EXPECT_EQ(result.successfulTraces, resultParallel.successfulTraces);
+}
+
 }  // namespace
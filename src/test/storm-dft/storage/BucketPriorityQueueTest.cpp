@@ -0,0 +1,43 @@
+#include "storm-config.h"
+#include "test/storm_gtest.h"
+
+#include "storm-dft/storage/BucketPriorityQueue.h"
+
+namespace {
+
+using Heuristic = storm::dft::builder::DFTExplorationHeuristic<double>;
+using HeuristicDepth = storm::dft::builder::DFTExplorationHeuristicDepth<double>;
+
+TEST(BucketPriorityQueueTest, PopBatch) {
+    storm::dft::storage::BucketPriorityQueue<Heuristic> queue(10, 0, 0.9, false);
+    auto initial = std::make_shared<HeuristicDepth>(0);
+    auto first = std::make_shared<HeuristicDepth>(1, *initial);
+    auto second = std::make_shared<HeuristicDepth>(2, *initial);
+    auto third = std::make_shared<HeuristicDepth>(3, *first);
+    auto immediate = std::make_shared<HeuristicDepth>(4);
+    immediate->markExpand();
+    queue.push(first);
+    queue.push(third);
+    queue.push(second);
+    queue.push(immediate);
+    EXPECT_EQ(4ul, queue.size());
+
+    // Items which should be considered immediately are returned first
+    auto batch = queue.popBatch(10);
+    ASSERT_EQ(1ul, batch.size());
+    EXPECT_EQ(4ul, batch[0]->getId());
+
+    // Only items of the current bucket are returned
+    batch = queue.popBatch(10);
+    ASSERT_EQ(2ul, batch.size());
+    EXPECT_EQ(3ul, batch[0]->getId() + batch[1]->getId());
+    EXPECT_EQ(1ul, queue.size());
+
+    batch = queue.popBatch(10);
+    ASSERT_EQ(1ul, batch.size());
+    EXPECT_EQ(3ul, batch[0]->getId());
+    EXPECT_TRUE(queue.empty());
+    EXPECT_TRUE(queue.popBatch(10).empty());
+}
+
+}  // namespace
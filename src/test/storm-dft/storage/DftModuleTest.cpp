@@ -107,4 +107,17 @@ TEST(DftModuleTest, ModularizationOverlapping) {
     EXPECT_EQ(++it, modulesF6.end());
 }
 
+TEST(DftModuleTest, ModularizationRepeated) {
+    std::string file = STORM_TEST_RESOURCES_DIR "/dft/modules2.dft";
+    std::shared_ptr<storm::dft::storage::DFT<double>> dft = storm::dft::api::loadDFTGalileoFile<double>(file);
+
+    // The same modularizer can be used several times
+    storm::dft::utility::DftModularizer<double> modularizer;
+    auto topModule = modularizer.computeModules(*dft);
+    auto topModule2 = modularizer.computeModules(*dft);
+    EXPECT_EQ(topModule.getRepresentative(), topModule2.getRepresentative());
+    EXPECT_EQ(topModule.getAllElements(), topModule2.getAllElements());
+    EXPECT_EQ(topModule.getSubModules().size(), topModule2.getSubModules().size());
+}
+
 }  // namespace
@@ -161,6 +161,19 @@ void SparseDerivativeInstantiationModelCheckerTest<TestType>::testModel(std::sha
             ASSERT_NEAR(storm::utility::convertNumber<double>(derivative->getValueVector()[0]), storm::utility::convertNumber<double>(expectedResult), 1e-6)
                 << instantiation;
         }
+
+        // All parameters at once
+        std::vector<VariableType<ValueType>> parametersToCheck;
+        for (auto const& position : instantiation) {
+            parametersToCheck.push_back(position.first);
+        }
+        auto allDerivatives = derivativeModelChecker.checkMultipleParameters(env(), instantiation, parametersToCheck);
+        ASSERT_EQ(parametersToCheck.size(), allDerivatives.size());
+        for (auto const& parameter : parametersToCheck) {
+            ASSERT_NEAR(storm::utility::convertNumber<double>(allDerivatives.at(parameter)->getValueVector()[0]),
+                        storm::utility::convertNumber<double>(testCase.second.at(parameter)), 1e-6)
+                << instantiation;
+        }
     }
 }
 
@@ -0,0 +1,68 @@
+#include "storm-config.h"
+#include "test/storm_gtest.h"
+
+#ifdef STORM_HAVE_CARL
+
+#include <carl/core/VariablePool.h>
+#include "storm/adapters/RationalFunctionAdapter.h"
+
+#include "storm-pars/modelchecker/instantiation/SparseDtmcInstantiationModelChecker.h"
+#include "storm-parsers/api/storm-parsers.h"
+#include "storm/api/storm.h"
+#include "storm/environment/Environment.h"
+#include "storm/modelchecker/results/ExplicitQualitativeCheckResult.h"
+#include "storm/modelchecker/results/ExplicitQuantitativeCheckResult.h"
+#include "storm/models/sparse/Dtmc.h"
+
+TEST(SparseDtmcInstantiationModelCheckerTest, BrpProb_Batch) {
+    carl::VariablePool::getInstance().clear();
+    std::string programFile = STORM_TEST_RESOURCES_DIR "/pdtmc/brp16_2.pm";
+    std::string formulaAsString = "P=? [F s=5 ]; P<=0.84 [F s=5 ]";
+
+    storm::prism::Program program = storm::api::parseProgram(programFile);
+    std::vector<std::shared_ptr<const storm::logic::Formula>> formulas =
+        storm::api::extractFormulasFromProperties(storm::api::parsePropertiesForPrismProgram(formulaAsString, program));
+    std::shared_ptr<storm::models::sparse::Dtmc<storm::RationalFunction>> dtmc =
+        storm::api::buildSparseModel<storm::RationalFunction>(program, formulas)->as<storm::models::sparse::Dtmc<storm::RationalFunction>>();
+    uint64_t initialState = *dtmc->getInitialStates().begin();
+
+    storm::RationalFunctionVariable const& pL = carl::VariablePool::getInstance().findVariableWithName("pL");
+    storm::RationalFunctionVariable const& pK = carl::VariablePool::getInstance().findVariableWithName("pK");
+    std::vector<storm::utility::parametric::Valuation<storm::RationalFunction>> valuations;
+    for (double valueL : {0.5, 0.8, 0.95}) {
+        for (double valueK : {0.6, 0.9}) {
+            storm::utility::parametric::Valuation<storm::RationalFunction> valuation;
+            valuation.emplace(pL, storm::utility::convertNumber<storm::RationalFunctionCoefficient>(valueL));
+            valuation.emplace(pK, storm::utility::convertNumber<storm::RationalFunctionCoefficient>(valueK));
+            valuations.push_back(std::move(valuation));
+        }
+    }
+
+    storm::Environment env;
+    storm::modelchecker::SparseDtmcInstantiationModelChecker<storm::models::sparse::Dtmc<storm::RationalFunction>, double> modelChecker(*dtmc);
+    modelChecker.setInstantiationsAreGraphPreserving(true);
+    storm::modelchecker::SparseDtmcInstantiationModelChecker<storm::models::sparse::Dtmc<storm::RationalFunction>, double> referenceModelChecker(*dtmc);
+
+    // Quantitative formula
+    modelChecker.specifyFormula(storm::modelchecker::CheckTask<storm::logic::Formula, storm::RationalFunction>(*formulas[0], true));
+    referenceModelChecker.specifyFormula(storm::modelchecker::CheckTask<storm::logic::Formula, storm::RationalFunction>(*formulas[0], true));
+    auto results = modelChecker.checkBatch(env, valuations);
+    ASSERT_EQ(valuations.size(), results.size());
+    for (uint64_t sample = 0; sample < valuations.size(); ++sample) {
+        double expected = referenceModelChecker.check(env, valuations[sample])->asExplicitQuantitativeCheckResult<double>()[initialState];
+        EXPECT_NEAR(expected, results[sample]->asExplicitQuantitativeCheckResult<double>()[initialState], 1e-6);
+    }
+
+    // Qualitative formula
+    modelChecker.specifyFormula(storm::modelchecker::CheckTask<storm::logic::Formula, storm::RationalFunction>(*formulas[1], true));
+    referenceModelChecker.specifyFormula(storm::modelchecker::CheckTask<storm::logic::Formula, storm::RationalFunction>(*formulas[1], true));
+    results = modelChecker.checkBatch(env, valuations);
+    ASSERT_EQ(valuations.size(), results.size());
+    for (uint64_t sample = 0; sample < valuations.size(); ++sample) {
+        bool expected = referenceModelChecker.check(env, valuations[sample])->asExplicitQualitativeCheckResult()[initialState];
+        EXPECT_EQ(expected, results[sample]->asExplicitQualitativeCheckResult()[initialState]);
+    }
+    carl::VariablePool::getInstance().clear();
+}
+
+#endif
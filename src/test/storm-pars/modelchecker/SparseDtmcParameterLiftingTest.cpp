@@ -3,6 +3,9 @@
 
 #ifdef STORM_HAVE_CARL
 
+#include <cstdio>
+#include <filesystem>
+
 #include "storm/adapters/RationalFunctionAdapter.h"
 
 #include "storm-pars/api/storm-pars.h"
@@ -109,6 +112,39 @@ TYPED_TEST(SparseDtmcParameterLiftingTest, Brp_Prob) {
                                            storm::modelchecker::RegionResult::Unknown, true));
 }
 
+TYPED_TEST(SparseDtmcParameterLiftingTest, Brp_Prob_subregions) {
+    typedef typename TestFixture::ValueType ValueType;
+
+    std::string programFile = STORM_TEST_RESOURCES_DIR "/pdtmc/brp16_2.pm";
+    std::string formulaAsString = "P<=0.84 [F s=5 ]";
+
+    // Program and formula
+    storm::prism::Program program = storm::api::parseProgram(programFile);
+    std::vector<std::shared_ptr<const storm::logic::Formula>> formulas =
+        storm::api::extractFormulasFromProperties(storm::api::parsePropertiesForPrismProgram(formulaAsString, program));
+    std::shared_ptr<storm::models::sparse::Dtmc<storm::RationalFunction>> model =
+        storm::api::buildSparseModel<storm::RationalFunction>(program, formulas)->as<storm::models::sparse::Dtmc<storm::RationalFunction>>();
+    auto modelParameters = storm::models::sparse::getProbabilityParameters(*model);
+
+    auto regionChecker = storm::api::initializeParameterLiftingRegionModelChecker<storm::RationalFunction, ValueType>(
+        this->env(), model, storm::api::createTask<storm::RationalFunction>(formulas[0], true));
+    auto referenceChecker = storm::api::initializeParameterLiftingRegionModelChecker<storm::RationalFunction, ValueType>(
+        this->env(), model, storm::api::createTask<storm::RationalFunction>(formulas[0], true));
+
+    // The results for the subregions have to be the same regardless of whether the results for the parent region are reused.
+    auto parentRegion = storm::api::parseRegion<storm::RationalFunction>("0.4<=pL<=0.9,0.6<=pK<=0.95", modelParameters);
+    std::vector<storm::storage::ParameterRegion<storm::RationalFunction>> subRegions;
+    parentRegion.split(parentRegion.getCenterPoint(), subRegions);
+    for (auto dir : {storm::OptimizationDirection::Minimize, storm::OptimizationDirection::Maximize}) {
+        regionChecker->getBoundAtInitState(this->env(), parentRegion, dir);
+        for (auto const& subRegion : subRegions) {
+            EXPECT_TRUE(parentRegion.isSubRegion(subRegion));
+            EXPECT_NEAR(storm::utility::convertNumber<double>(referenceChecker->getBoundAtInitState(this->env(), subRegion, dir)),
+                        storm::utility::convertNumber<double>(regionChecker->getBoundAtInitState(this->env(), subRegion, dir)), 1e-6);
+        }
+    }
+}
+
 TYPED_TEST(SparseDtmcParameterLiftingTest, Brp_Prob_no_simplification) {
     typedef typename TestFixture::ValueType ValueType;
 
@@ -584,5 +620,129 @@ TYPED_TEST(SparseDtmcParameterLiftingTest, ZeroConf) {
               regionChecker->analyzeRegion(this->env(), allVioRegion, storm::modelchecker::RegionResultHypothesis::Unknown,
                                            storm::modelchecker::RegionResult::Unknown, true));
 }
+
+TEST(SparseDtmcParameterLiftingRefinementTest, Brp_Prob_parallelRefinement) {
+    carl::VariablePool::getInstance().clear();
+    std::string programFile = STORM_TEST_RESOURCES_DIR "/pdtmc/brp16_2.pm";
+    std::string formulaAsString = "P<=0.84 [F s=5 ]";
+
+    storm::prism::Program program = storm::api::parseProgram(programFile);
+    std::vector<std::shared_ptr<const storm::logic::Formula>> formulas =
+        storm::api::extractFormulasFromProperties(storm::api::parsePropertiesForPrismProgram(formulaAsString, program));
+    std::shared_ptr<storm::models::sparse::Dtmc<storm::RationalFunction>> model =
+        storm::api::buildSparseModel<storm::RationalFunction>(program, formulas)->as<storm::models::sparse::Dtmc<storm::RationalFunction>>();
+    auto modelParameters = storm::models::sparse::getProbabilityParameters(*model);
+    auto region = storm::api::parseRegion<storm::RationalFunction>("0.4<=pL<=0.9,0.4<=pK<=0.9", modelParameters);
+    auto task = storm::api::createTask<storm::RationalFunction>(formulas[0], true);
+    auto engine = storm::modelchecker::RegionCheckEngine::ParameterLifting;
+    storm::RationalFunction coverageThreshold = storm::utility::zero<storm::RationalFunction>();
+    uint64_t depthLimit = 4;
+
+    auto sequentialResult =
+        storm::api::checkAndRefineRegionWithSparseEngine<storm::RationalFunction>(model, task, region, engine, coverageThreshold, depthLimit);
+    auto parallelResult = storm::api::checkAndRefineRegionWithSparseEngineInParallel<storm::RationalFunction>(
+        model, task, region, engine, coverageThreshold, depthLimit, storm::modelchecker::RegionResultHypothesis::Unknown, true, 3);
+
+    // Without a coverage threshold, both refinements analyze the same subregions.
+    EXPECT_EQ(sequentialResult->getRegionResults().size(), parallelResult->getRegionResults().size());
+    EXPECT_EQ(sequentialResult->getSatFraction(), parallelResult->getSatFraction());
+    EXPECT_EQ(sequentialResult->getUnsatFraction(), parallelResult->getUnsatFraction());
+    carl::VariablePool::getInstance().clear();
+}
+
+TEST(SparseDtmcParameterLiftingRefinementTest, Brp_Prob_checkpoint) {
+    carl::VariablePool::getInstance().clear();
+    std::string programFile = STORM_TEST_RESOURCES_DIR "/pdtmc/brp16_2.pm";
+    std::string formulaAsString = "P<=0.84 [F s=5 ]";
+
+    storm::prism::Program program = storm::api::parseProgram(programFile);
+    std::vector<std::shared_ptr<const storm::logic::Formula>> formulas =
+        storm::api::extractFormulasFromProperties(storm::api::parsePropertiesForPrismProgram(formulaAsString, program));
+    std::shared_ptr<storm::models::sparse::Dtmc<storm::RationalFunction>> model =
+        storm::api::buildSparseModel<storm::RationalFunction>(program, formulas)->as<storm::models::sparse::Dtmc<storm::RationalFunction>>();
+    auto modelParameters = storm::models::sparse::getProbabilityParameters(*model);
+    auto region = storm::api::parseRegion<storm::RationalFunction>("0.4<=pL<=0.9,0.4<=pK<=0.9", modelParameters);
+    auto task = storm::api::createTask<storm::RationalFunction>(formulas[0], true);
+    auto engine = storm::modelchecker::RegionCheckEngine::ParameterLifting;
+    auto hypothesis = storm::modelchecker::RegionResultHypothesis::Unknown;
+    storm::RationalFunction coverageThreshold = storm::utility::zero<storm::RationalFunction>();
+    storm::RationalFunction coarseCoverageThreshold = storm::utility::convertNumber<storm::RationalFunction>(0.3);
+    uint64_t depthLimit = 4;
+    std::string checkpointFile = (std::filesystem::temp_directory_path() / "storm_refinement_checkpoint_test.txt").string();
+    std::string resultCacheFile = (std::filesystem::temp_directory_path() / "storm_region_results_test.txt").string();
+    std::remove(checkpointFile.c_str());
+    std::remove(resultCacheFile.c_str());
+
+    auto directResult =
+        storm::api::checkAndRefineRegionWithSparseEngine<storm::RationalFunction>(model, task, region, engine, coverageThreshold, depthLimit);
+
+    // Refine with a coarse threshold first and then resume the refinement with the tighter threshold.
+    storm::api::RefinementPersistenceSetting persistenceSetting(checkpointFile, 1, true, resultCacheFile);
+    auto coarseResult = storm::api::checkAndRefineRegionWithSparseEngine<storm::RationalFunction>(
+        model, task, region, engine, coarseCoverageThreshold, depthLimit, hypothesis, true, storm::api::MonotonicitySetting(), 0, persistenceSetting);
+    EXPECT_LE(coarseResult->getSatFraction(), directResult->getSatFraction());
+    auto resumedResult = storm::api::checkAndRefineRegionWithSparseEngine<storm::RationalFunction>(
+        model, task, region, engine, coverageThreshold, depthLimit, hypothesis, true, storm::api::MonotonicitySetting(), 0, persistenceSetting);
+    EXPECT_EQ(directResult->getRegionResults().size(), resumedResult->getRegionResults().size());
+    EXPECT_EQ(directResult->getSatFraction(), resumedResult->getSatFraction());
+    EXPECT_EQ(directResult->getUnsatFraction(), resumedResult->getUnsatFraction());
+
+    // A new refinement takes the conclusive results from the cache file
+    auto cache = std::make_shared<storm::modelchecker::RegionResultCache<storm::RationalFunction>>(resultCacheFile);
+    EXPECT_LT(0ull, cache->getNumberOfEntries());
+    storm::Environment env;
+    auto regionChecker = storm::api::initializeParameterLiftingRegionModelChecker<storm::RationalFunction, double>(env, model, task);
+    regionChecker->setResultCache(cache, storm::modelchecker::RegionResultCache<storm::RationalFunction>::getKey(*model, task.getFormula()));
+    auto cachedResult = regionChecker->performRegionRefinement(env, region, coverageThreshold, depthLimit);
+    EXPECT_EQ(cache->getNumberOfEntries(), cache->getNumberOfHits());
+    EXPECT_EQ(directResult->getRegionResults().size(), cachedResult->getRegionResults().size());
+    EXPECT_EQ(directResult->getSatFraction(), cachedResult->getSatFraction());
+    EXPECT_EQ(directResult->getUnsatFraction(), cachedResult->getUnsatFraction());
+
+    std::remove(checkpointFile.c_str());
+    std::remove(resultCacheFile.c_str());
+    carl::VariablePool::getInstance().clear();
+}
+
+TEST(SparseDtmcParameterLiftingIntervalModelTest, Brp_Prob) {
+    carl::VariablePool::getInstance().clear();
+    std::string programFile = STORM_TEST_RESOURCES_DIR "/pdtmc/brp16_2.pm";
+    std::string formulaAsString = "P<=0.84 [F s=5 ]";
+
+    storm::prism::Program program = storm::api::parseProgram(programFile);
+    std::vector<std::shared_ptr<const storm::logic::Formula>> formulas =
+        storm::api::extractFormulasFromProperties(storm::api::parsePropertiesForPrismProgram(formulaAsString, program));
+    std::shared_ptr<storm::models::sparse::Dtmc<storm::RationalFunction>> model =
+        storm::api::buildSparseModel<storm::RationalFunction>(program, formulas)->as<storm::models::sparse::Dtmc<storm::RationalFunction>>();
+    auto modelParameters = storm::models::sparse::getProbabilityParameters(*model);
+    auto region = storm::api::parseRegion<storm::RationalFunction>("0.4<=pL<=0.9,0.6<=pK<=0.95", modelParameters);
+    auto task = storm::api::createTask<storm::RationalFunction>(formulas[0], true);
+    storm::Environment env;
+    env.solver().minMax().setMethod(storm::solver::MinMaxMethod::ValueIteration);
+    env.solver().minMax().setPrecision(storm::utility::convertNumber<storm::RationalNumber>(1e-8));
+
+    for (bool allowModelSimplification : {false, true}) {
+        auto regionChecker =
+            storm::api::initializeParameterLiftingRegionModelChecker<storm::RationalFunction, double>(env, model, task, false, allowModelSimplification);
+        auto intervalChecker = storm::api::initializeParameterLiftingRegionModelChecker<storm::RationalFunction, double>(
+            env, model, task, false, allowModelSimplification, false, storm::api::MonotonicitySetting(), boost::none, true);
+        auto minBound = storm::utility::convertNumber<double>(regionChecker->getBoundAtInitState(env, region, storm::OptimizationDirection::Minimize));
+        auto maxBound = storm::utility::convertNumber<double>(regionChecker->getBoundAtInitState(env, region, storm::OptimizationDirection::Maximize));
+        auto intervalMinBound =
+            storm::utility::convertNumber<double>(intervalChecker->getBoundAtInitState(env, region, storm::OptimizationDirection::Minimize));
+        auto intervalMaxBound =
+            storm::utility::convertNumber<double>(intervalChecker->getBoundAtInitState(env, region, storm::OptimizationDirection::Maximize));
+        if (allowModelSimplification) {
+            // The interval model might be less precise as dependencies between the transitions of a state are lost
+            EXPECT_LE(intervalMinBound, minBound + 1e-6);
+            EXPECT_GE(intervalMaxBound, maxBound - 1e-6);
+        } else {
+            // Without simplification, the transitions of each state are either constant or of the form p and 1-p, so the interval model is exact
+            EXPECT_NEAR(minBound, intervalMinBound, 1e-6);
+            EXPECT_NEAR(maxBound, intervalMaxBound, 1e-6);
+        }
+    }
+    carl::VariablePool::getInstance().clear();
+}
 }  // namespace
 #endif
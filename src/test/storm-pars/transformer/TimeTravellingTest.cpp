@@ -14,6 +14,7 @@
 #include "storm-pars/modelchecker/instantiation/SparseInstantiationModelChecker.h"
 #include "storm-pars/modelchecker/region/SparseDtmcParameterLiftingModelChecker.h"
 #include "storm-pars/modelchecker/region/SparseParameterLiftingModelChecker.h"
+#include "storm-pars/transformer/SparseParametricDtmcPreprocessor.h"
 #include "storm-pars/transformer/TimeTravelling.h"
 #include "storm-parsers/api/model_descriptions.h"
 #include "storm-parsers/api/properties.h"
@@ -109,3 +110,30 @@ TEST(TimeTravelling, Herman) {
     std::string constantsAsString = "";  // e.g. pL=0.9,TOACK=0.5
     testModel(programFile, formulaAsString, constantsAsString);
 }
+
+TEST(TimeTravelling, PreprocessingPipeline) {
+    std::string programFile = STORM_TEST_RESOURCES_DIR "/pdtmc/nand-5-2.pm";
+    std::string formulaAsString = "P=? [F \"target\"]";
+    std::string constantsAsString = "";  // e.g. pL=0.9,TOACK=0.5
+    storm::prism::Program program = storm::api::parseProgram(programFile);
+    program = storm::utility::prism::preprocess(program, constantsAsString);
+    std::vector<std::shared_ptr<const storm::logic::Formula>> formulas =
+        storm::api::extractFormulasFromProperties(storm::api::parsePropertiesForPrismProgram(formulaAsString, program));
+    std::shared_ptr<storm::models::sparse::Dtmc<storm::RationalFunction>> dtmc =
+        storm::api::buildSparseModel<storm::RationalFunction>(program, formulas)->as<storm::models::sparse::Dtmc<storm::RationalFunction>>();
+    storm::modelchecker::CheckTask<storm::logic::Formula, storm::RationalFunction> const checkTask(*formulas[0]);
+
+    storm::transformer::SparseParametricDtmcPreprocessor::Options options;
+    options.timeTravel = true;
+    storm::transformer::SparseParametricDtmcPreprocessor preprocessor(options);
+    auto preprocessedDtmc = preprocessor.preprocess(dtmc, formulas[0]);
+    ASSERT_EQ(1ull, preprocessor.getStageStatistics().size());
+    EXPECT_EQ(preprocessedDtmc->getNumberOfStates(), preprocessor.getStageStatistics().front().numberOfStates);
+
+    // The pipeline has to yield the same model as invoking time-travelling directly
+    storm::transformer::TimeTravelling timeTravelling;
+    auto timeTravelledDtmc = timeTravelling.timeTravel(*dtmc, checkTask);
+    EXPECT_EQ(timeTravelledDtmc.getNumberOfStates(), preprocessedDtmc->getNumberOfStates());
+    EXPECT_EQ(timeTravelledDtmc.getNumberOfTransitions(), preprocessedDtmc->getNumberOfTransitions());
+    EXPECT_EQ(timeTravelledDtmc.getTransitionMatrix(), preprocessedDtmc->getTransitionMatrix());
+}
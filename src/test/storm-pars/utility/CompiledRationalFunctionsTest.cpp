@@ -0,0 +1,69 @@
+#include "storm-config.h"
+#include "test/storm_gtest.h"
+
+#ifdef STORM_HAVE_CARL
+
+#include <carl/core/VariablePool.h>
+#include "storm/adapters/RationalFunctionAdapter.h"
+
+#include "storm-pars/utility/CompiledRationalFunctions.h"
+#include "storm-pars/utility/parametric.h"
+#include "storm-parsers/parser/ValueParser.h"
+
+namespace {
+template<typename ConstantType>
+void testCompiledRationalFunctions() {
+    carl::VariablePool::getInstance().clear();
+    storm::parser::ValueParser<storm::RationalFunction> parser;
+    parser.addParameter("p");
+    parser.addParameter("q");
+    std::vector<storm::RationalFunction> functions = {parser.parseValue("((5*p^(3))+(q*p*7)+2)/2"), parser.parseValue("(p*q)/(1+p^(2)*q)"),
+                                                      parser.parseValue("1-p"), parser.parseValue("3")};
+    storm::RationalFunctionVariable p = carl::VariablePool::getInstance().findVariableWithName("p");
+    storm::RationalFunctionVariable q = carl::VariablePool::getInstance().findVariableWithName("q");
+
+    storm::utility::CompiledRationalFunctions<ConstantType> compiled({q, p});
+    EXPECT_EQ(1ull, compiled.getVariableIndex(p));
+    for (auto const& function : functions) {
+        compiled.addFunction(function);
+    }
+    ASSERT_EQ(functions.size(), compiled.getNumberOfFunctions());
+
+    std::vector<std::pair<std::string, std::string>> points = {{"1/3", "1/2"}, {"0", "1"}, {"9/10", "1/10"}};
+    std::vector<ConstantType> batch(2 * points.size());
+    for (uint64_t sample = 0; sample < points.size(); ++sample) {
+        batch[sample] = storm::utility::convertNumber<ConstantType>(storm::utility::convertNumber<storm::RationalNumber>(points[sample].second));
+        batch[points.size() + sample] = storm::utility::convertNumber<ConstantType>(storm::utility::convertNumber<storm::RationalNumber>(points[sample].first));
+    }
+    for (uint64_t function = 0; function < functions.size(); ++function) {
+        std::vector<ConstantType> batchResult;
+        compiled.evaluate(function, batch, points.size(), batchResult);
+        ASSERT_EQ(points.size(), batchResult.size());
+        for (uint64_t sample = 0; sample < points.size(); ++sample) {
+            storm::utility::parametric::Valuation<storm::RationalFunction> valuation;
+            valuation.emplace(p, storm::utility::convertNumber<storm::RationalFunctionCoefficient>(points[sample].first));
+            valuation.emplace(q, storm::utility::convertNumber<storm::RationalFunctionCoefficient>(points[sample].second));
+            ConstantType expected = storm::utility::convertNumber<ConstantType>(storm::utility::parametric::evaluate(functions[function], valuation));
+            ConstantType single = compiled.evaluate(function, {batch[sample], batch[points.size() + sample]});
+            if constexpr (std::is_same<ConstantType, double>::value) {
+                EXPECT_NEAR(expected, batchResult[sample], 1e-12);
+                EXPECT_NEAR(expected, single, 1e-12);
+            } else {
+                EXPECT_EQ(expected, batchResult[sample]);
+                EXPECT_EQ(expected, single);
+            }
+        }
+    }
+    carl::VariablePool::getInstance().clear();
+}
+}  // namespace
+
+TEST(CompiledRationalFunctionsTest, Double) {
+    testCompiledRationalFunctions<double>();
+}
+
+TEST(CompiledRationalFunctionsTest, RationalNumber) {
+    testCompiledRationalFunctions<storm::RationalNumber>();
+}
+
+#endif
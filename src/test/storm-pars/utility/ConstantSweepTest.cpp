@@ -0,0 +1,81 @@
+#include "storm-config.h"
+#include "test/storm_gtest.h"
+
+#ifdef STORM_HAVE_CARL
+
+#include "storm-parsers/api/storm-parsers.h"
+#include "storm-parsers/parser/PrismParser.h"
+#include "storm-pars/utility/ConstantSweep.h"
+#include "storm/api/storm.h"
+#include "storm/environment/Environment.h"
+#include "storm/modelchecker/results/ExplicitQuantitativeCheckResult.h"
+#include "storm/modelchecker/results/QuantitativeCheckResult.h"
+
+namespace {
+
+std::string const sweepProgram = R"(
+dtmc
+const int N;
+const double p;
+const double q = 1 - p;
+
+module counter
+    x : [0..N] init 0;
+    [] x < N -> p : (x'=x+1) + q : (x'=0);
+    [] x = N -> 1 : true;
+endmodule
+
+rewards "steps"
+    x < N : p;
+endrewards
+
+label "done" = x = N;
+)";
+
+double checkInstance(storm::prism::Program const& program, std::string const& constants, std::string const& formula) {
+    auto instance = storm::storage::SymbolicModelDescription(program).preprocess(constants).asPrismProgram();
+    auto formulas = storm::api::extractFormulasFromProperties(storm::api::parsePropertiesForPrismProgram(formula, instance));
+    auto model = storm::api::buildSparseModel<double>(instance, formulas);
+    auto result = storm::api::verifyWithSparseEngine<double>(model, storm::api::createTask<double>(formulas.front(), true));
+    return result->asExplicitQuantitativeCheckResult<double>()[*model->getInitialStates().begin()];
+}
+
+TEST(ConstantSweepTest, StructuralAndInstantiatedConstants) {
+    storm::prism::Program program = storm::parser::PrismParser::parseFromString(sweepProgram, "testfile");
+    auto const& manager = program.getManager();
+    auto N = manager.getVariable("N");
+    auto p = manager.getVariable("p");
+    EXPECT_FALSE(program.constantsAreGraphPreserving({N}));
+    EXPECT_TRUE(program.constantsAreGraphPreserving({p}));
+
+    std::vector<std::string> formulas = {"P=? [F<=6 \"done\"]", "R{\"steps\"}=? [C<=4]"};
+    auto properties = storm::api::parsePropertiesForPrismProgram(formulas[0] + ";" + formulas[1], program);
+    std::map<storm::expressions::Variable, std::vector<storm::RationalNumber>> values;
+    auto rational = [](std::string const& value) { return storm::utility::convertNumber<storm::RationalNumber>(value); };
+    values[N] = {rational("2"), rational("3")};
+    values[p] = {rational("0.3"), rational("0.5"), rational("0.7")};
+
+    storm::utility::ConstantSweep<double> sweep(program, properties, values);
+    sweep.setParallel(true);
+    EXPECT_EQ(std::vector<storm::expressions::Variable>({N}), sweep.getStructuralConstants());
+    EXPECT_EQ(std::vector<storm::expressions::Variable>({p}), sweep.getInstantiatedConstants());
+    EXPECT_EQ(6ull, sweep.getNumberOfPoints());
+
+    std::vector<std::string> expectedPoints = {"N=2,p=0.3", "N=2,p=0.5", "N=2,p=0.7", "N=3,p=0.3", "N=3,p=0.5", "N=3,p=0.7"};
+    uint64_t numberOfResults = 0;
+    // The results come point by point, with one result for each property.
+    sweep.check(storm::Environment(), [&](auto const& point, storm::jani::Property const&, std::unique_ptr<storm::modelchecker::CheckResult>&& result) {
+        ASSERT_LT(numberOfResults / 2, expectedPoints.size());
+        std::string const& constants = expectedPoints[numberOfResults / 2];
+        EXPECT_EQ(rational(constants.substr(2, 1)), point.at(N));
+        ASSERT_TRUE(result);
+        auto const& quantitativeResult = result->asQuantitativeCheckResult<double>();
+        EXPECT_NEAR(checkInstance(program, constants, formulas[numberOfResults % 2]), quantitativeResult.getMin(), 1e-6);
+        ++numberOfResults;
+    });
+    EXPECT_EQ(12ull, numberOfResults);
+}
+
+}  // namespace
+
+#endif
@@ -58,7 +58,7 @@ TEST(ModelInstantiatorTest, BrpProb) {
                 for (auto const& paramEntry : dtmc->getTransitionMatrix().getRow(row)) {
                     EXPECT_EQ(paramEntry.getColumn(), instantiatedEntry->getColumn());
                     double evaluatedValue = carl::toDouble(paramEntry.getValue().evaluate(valuation));
-                    EXPECT_EQ(evaluatedValue, instantiatedEntry->getValue());
+                    EXPECT_NEAR(evaluatedValue, instantiatedEntry->getValue(), 1e-12);
                     ++instantiatedEntry;
                 }
                 EXPECT_EQ(instantiated.getTransitionMatrix().getRow(row).end(), instantiatedEntry);
@@ -93,7 +93,7 @@ TEST(ModelInstantiatorTest, BrpProb) {
                 for (auto const& paramEntry : dtmc->getTransitionMatrix().getRow(row)) {
                     EXPECT_EQ(paramEntry.getColumn(), instantiatedEntry->getColumn());
                     double evaluatedValue = carl::toDouble(paramEntry.getValue().evaluate(valuation));
-                    EXPECT_EQ(evaluatedValue, instantiatedEntry->getValue());
+                    EXPECT_NEAR(evaluatedValue, instantiatedEntry->getValue(), 1e-12);
                     ++instantiatedEntry;
                 }
                 EXPECT_EQ(instantiated.getTransitionMatrix().getRow(row).end(), instantiatedEntry);
@@ -127,7 +127,7 @@ TEST(ModelInstantiatorTest, BrpProb) {
                 for (auto const& paramEntry : dtmc->getTransitionMatrix().getRow(row)) {
                     EXPECT_EQ(paramEntry.getColumn(), instantiatedEntry->getColumn());
                     double evaluatedValue = carl::toDouble(paramEntry.getValue().evaluate(valuation));
-                    EXPECT_EQ(evaluatedValue, instantiatedEntry->getValue());
+                    EXPECT_NEAR(evaluatedValue, instantiatedEntry->getValue(), 1e-12);
                     ++instantiatedEntry;
                 }
                 EXPECT_EQ(instantiated.getTransitionMatrix().getRow(row).end(), instantiatedEntry);
@@ -188,7 +188,7 @@ TEST(ModelInstantiatorTest, Brp_Rew) {
                 for (auto const& paramEntry : dtmc->getTransitionMatrix().getRow(row)) {
                     EXPECT_EQ(paramEntry.getColumn(), instantiatedEntry->getColumn());
                     double evaluatedValue = carl::toDouble(paramEntry.getValue().evaluate(valuation));
-                    EXPECT_EQ(evaluatedValue, instantiatedEntry->getValue());
+                    EXPECT_NEAR(evaluatedValue, instantiatedEntry->getValue(), 1e-12);
                     ++instantiatedEntry;
                 }
                 EXPECT_EQ(instantiated.getTransitionMatrix().getRow(row).end(), instantiatedEntry);
@@ -203,7 +203,7 @@ TEST(ModelInstantiatorTest, Brp_Rew) {
         ASSERT_EQ(stateActionEntries, instantiated.getUniqueRewardModel().getStateActionRewardVector().size());
         for (std::size_t i = 0; i < stateActionEntries; ++i) {
             double evaluatedValue = carl::toDouble(dtmc->getUniqueRewardModel().getStateActionRewardVector()[i].evaluate(valuation));
-            EXPECT_EQ(evaluatedValue, instantiated.getUniqueRewardModel().getStateActionRewardVector()[i]);
+            EXPECT_NEAR(evaluatedValue, instantiated.getUniqueRewardModel().getStateActionRewardVector()[i], 1e-12);
         }
         EXPECT_EQ(dtmc->getStateLabeling(), instantiated.getStateLabeling());
         EXPECT_EQ(dtmc->getOptionalChoiceLabeling(), instantiated.getOptionalChoiceLabeling());
@@ -252,7 +252,7 @@ TEST(ModelInstantiatorTest, Consensus) {
             for (auto const& paramEntry : mdp->getTransitionMatrix().getRow(row)) {
                 EXPECT_EQ(paramEntry.getColumn(), instantiatedEntry->getColumn());
                 double evaluatedValue = carl::toDouble(paramEntry.getValue().evaluate(valuation));
-                EXPECT_EQ(evaluatedValue, instantiatedEntry->getValue());
+                EXPECT_NEAR(evaluatedValue, instantiatedEntry->getValue(), 1e-12);
                 ++instantiatedEntry;
             }
             EXPECT_EQ(instantiated.getTransitionMatrix().getRow(row).end(), instantiatedEntry);
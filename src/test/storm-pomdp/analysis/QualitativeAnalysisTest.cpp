@@ -5,7 +5,9 @@
 #include "storm-pomdp/analysis/IterativePolicySearch.h"
 #include "storm-pomdp/analysis/JaniBeliefSupportMdpGenerator.h"
 #include "storm-pomdp/analysis/OneShotPolicySearch.h"
+#include "storm-pomdp/analysis/PolicySearchPortfolio.h"
 #include "storm-pomdp/analysis/QualitativeAnalysisOnGraphs.h"
+#include "storm-pomdp/analysis/SymbolicBeliefSupportMdpGenerator.h"
 #include "storm/api/storm.h"
 #include "storm/builder/ExplicitModelBuilder.h"
 #include "storm/models/sparse/StandardRewardModel.h"
@@ -77,6 +79,41 @@ void iterativesearch_test(std::string const& path, std::string const& constants,
     }
 }
 
+void portfolio_test(std::string const& path, std::string const& constants, std::string formulaString, bool wr) {
+    storm::prism::Program program = storm::parser::PrismParser::parse(path);
+    program = storm::utility::prism::preprocess(program, constants);
+    std::shared_ptr<storm::logic::Formula const> formula = storm::api::parsePropertiesForPrismProgram(formulaString, program).front().getRawFormula();
+    std::shared_ptr<storm::models::sparse::Pomdp<double>> pomdp =
+        storm::api::buildSparseModel<double>(program, {formula})->as<storm::models::sparse::Pomdp<double>>();
+    storm::transformer::MakePOMDPCanonic<double> makeCanonic(*pomdp);
+    pomdp = makeCanonic.transform();
+
+    // Run graph algorithm
+    auto formulaInfo = storm::pomdp::analysis::getFormulaInformation(*pomdp, *formula);
+    storm::analysis::QualitativeAnalysisOnGraphs<double> qualitativeAnalysis(*pomdp);
+    storm::storage::BitVector surelyNotAlmostSurelyReachTarget = qualitativeAnalysis.analyseProbSmaller1(formula->asProbabilityOperatorFormula());
+    pomdp->getTransitionMatrix().makeRowGroupsAbsorbing(surelyNotAlmostSurelyReachTarget);
+    storm::storage::BitVector targetStates = qualitativeAnalysis.analyseProb1(formula->asProbabilityOperatorFormula());
+
+    std::shared_ptr<storm::utility::solver::SmtSolverFactory> smtSolverFactory = std::make_shared<storm::utility::solver::Z3SmtSolverFactory>();
+    storm::pomdp::MemlessSearchOptions options;
+    uint64_t lookahead = pomdp->getNumberOfStates();
+    auto configurations = storm::pomdp::PolicySearchPortfolio<double>::createDefaultConfigurations(options, lookahead);
+    storm::pomdp::PolicySearchPortfolio<double> portfolio(*pomdp, targetStates, surelyNotAlmostSurelyReachTarget, smtSolverFactory, configurations);
+    if (wr) {
+        portfolio.computeWinningRegion();
+        EXPECT_TRUE(portfolio.getConclusiveConfiguration().has_value());
+    } else {
+        // A positive answer of a single search must be confirmed by the portfolio.
+        storm::pomdp::IterativePolicySearch<double> search(*pomdp, targetStates, surelyNotAlmostSurelyReachTarget, smtSolverFactory, options);
+        if (search.analyzeForInitialStates(lookahead)) {
+            EXPECT_TRUE(portfolio.analyzeForInitialStates());
+        } else {
+            portfolio.analyzeForInitialStates();
+        }
+    }
+}
+
 void symbolicbelsup_test(std::string const& path, std::string const& constants, std::string formulaString, bool wr) {
     storm::prism::Program program = storm::parser::PrismParser::parse(path);
     program = storm::utility::prism::preprocess(program, constants);
@@ -97,6 +134,13 @@ void symbolicbelsup_test(std::string const& path, std::string const& constants,
     janicreator.generate(targetStates, surelyNotAlmostSurelyReachTarget);
     bool initialOnly = !wr;
     janicreator.verifySymbolic(initialOnly);
+
+    storm::pomdp::qualitative::SymbolicBeliefSupportMdpGenerator<double> symbolicCreator(*pomdp);
+    symbolicCreator.generate(targetStates, surelyNotAlmostSurelyReachTarget);
+    symbolicCreator.verifySymbolic(initialOnly);
+    if (initialOnly) {
+        EXPECT_EQ(janicreator.isInitialWinning(), symbolicCreator.isInitialWinning());
+    }
 }
 
 TEST(QualitativeAnalysis, GraphAlgorithm_Simple) {
@@ -145,6 +189,22 @@ TEST(QualitativeAnalysis, Iterative_Maze) {
     iterativesearch_test(STORM_TEST_RESOURCES_DIR "/pomdp/maze2.prism", "sl=0.0", "Pmax=? [!\"bad\" U \"goal\"]", true);
 }
 
+TEST(QualitativeAnalysis, Portfolio_Simple) {
+    portfolio_test(STORM_TEST_RESOURCES_DIR "/pomdp/simple.prism", "slippery=0.4", "Pmax=? [F \"goal\" ]", false);
+    portfolio_test(STORM_TEST_RESOURCES_DIR "/pomdp/simple.prism", "slippery=0.0", "Pmax=? [F \"goal\" ]", false);
+
+    portfolio_test(STORM_TEST_RESOURCES_DIR "/pomdp/simple.prism", "slippery=0.4", "Pmax=? [F \"goal\" ]", true);
+    portfolio_test(STORM_TEST_RESOURCES_DIR "/pomdp/simple.prism", "slippery=0.0", "Pmax=? [F \"goal\" ]", true);
+}
+
+TEST(QualitativeAnalysis, Portfolio_Maze) {
+    portfolio_test(STORM_TEST_RESOURCES_DIR "/pomdp/maze2.prism", "sl=0.4", "Pmax=? [F \"goal\" ]", false);
+    portfolio_test(STORM_TEST_RESOURCES_DIR "/pomdp/maze2.prism", "sl=0.0", "Pmax=? [!\"bad\" U \"goal\"]", false);
+
+    portfolio_test(STORM_TEST_RESOURCES_DIR "/pomdp/maze2.prism", "sl=0.4", "Pmax=? [F \"goal\" ]", true);
+    portfolio_test(STORM_TEST_RESOURCES_DIR "/pomdp/maze2.prism", "sl=0.0", "Pmax=? [!\"bad\" U \"goal\"]", true);
+}
+
 TEST(QualitativeAnalysis, SymbolicBelSup_Simple) {
     symbolicbelsup_test(STORM_TEST_RESOURCES_DIR "/pomdp/simple.prism", "slippery=0.4", "Pmax=? [F \"goal\" ]", false);
     symbolicbelsup_test(STORM_TEST_RESOURCES_DIR "/pomdp/simple.prism", "slippery=0.0", "Pmax=? [F \"goal\" ]", false);
@@ -10,6 +10,7 @@
 #include "storm/api/storm.h"
 
 #include "storm/environment/solver/MinMaxSolverEnvironment.h"
+#include "storm/environment/solver/SolverEnvironment.h"
 
 namespace {
 enum class PreprocessingType { None, SelfloopReduction, QualitativeReduction, All };
@@ -86,6 +87,25 @@ class PreprocessedDefaultDoubleVIEnvironment {
     static PreprocessingType const preprocessingType = PreprocessingType::All;
 };
 
+class EvictBeliefsDoubleVIEnvironment {
+   public:
+    typedef double ValueType;
+    static storm::Environment createEnvironment() {
+        storm::Environment env;
+        env.solver().minMax().setMethod(storm::solver::MinMaxMethod::ValueIteration);
+        env.solver().minMax().setPrecision(storm::utility::convertNumber<storm::RationalNumber>(1e-6));
+        return env;
+    }
+    static bool const isExactModelChecking = false;
+    static ValueType precision() {
+        return storm::utility::convertNumber<ValueType>(0.12);
+    }  // there actually aren't any precision guarantees, but we still want to detect if results are weird.
+    static void adaptOptions(storm::pomdp::modelchecker::BeliefExplorationPomdpModelCheckerOptions<ValueType>& options) {
+        options.evictExploredBeliefs = true;
+    }
+    static PreprocessingType const preprocessingType = PreprocessingType::None;
+};
+
 class FineDoubleVIEnvironment {
    public:
     typedef double ValueType;
@@ -125,6 +145,49 @@ class RefineDoubleVIEnvironment {
     }
 };
 
+class RefineDenseDoubleVIEnvironment {
+   public:
+    typedef double ValueType;
+    static storm::Environment createEnvironment() {
+        storm::Environment env;
+        env.solver().minMax().setMethod(storm::solver::MinMaxMethod::ValueIteration);
+        env.solver().minMax().setPrecision(storm::utility::convertNumber<storm::RationalNumber>(1e-6));
+        return env;
+    }
+    static bool const isExactModelChecking = false;
+    static ValueType precision() {
+        return storm::utility::convertNumber<ValueType>(0.005);
+    }
+    static PreprocessingType const preprocessingType = PreprocessingType::None;
+    static void adaptOptions(storm::pomdp::modelchecker::BeliefExplorationPomdpModelCheckerOptions<ValueType>& options) {
+        options.refine = true;
+        options.refinePrecision = precision();
+        options.useDenseValueIteration = true;
+    }
+};
+
+class RefineParallelExpansionDoubleVIEnvironment {
+   public:
+    typedef double ValueType;
+    static storm::Environment createEnvironment() {
+        storm::Environment env;
+        env.solver().minMax().setMethod(storm::solver::MinMaxMethod::ValueIteration);
+        env.solver().minMax().setPrecision(storm::utility::convertNumber<storm::RationalNumber>(1e-6));
+        env.solver().setUseIntelTbb(true);
+        return env;
+    }
+    static bool const isExactModelChecking = false;
+    static ValueType precision() {
+        return storm::utility::convertNumber<ValueType>(0.005);
+    }
+    static PreprocessingType const preprocessingType = PreprocessingType::None;
+    static void adaptOptions(storm::pomdp::modelchecker::BeliefExplorationPomdpModelCheckerOptions<ValueType>& options) {
+        options.refine = true;
+        options.refinePrecision = precision();
+        options.parallelExpansionBatchSize = 4;
+    }
+};
+
 class PreprocessedRefineDoubleVIEnvironment {
    public:
     typedef double ValueType;
@@ -292,7 +355,8 @@ class BeliefExplorationTest : public ::testing::Test {
 };
 
 typedef ::testing::Types<DefaultDoubleVIEnvironment, SelfloopReductionDefaultDoubleVIEnvironment, QualitativeReductionDefaultDoubleVIEnvironment,
-                         PreprocessedDefaultDoubleVIEnvironment, FineDoubleVIEnvironment, RefineDoubleVIEnvironment, PreprocessedRefineDoubleVIEnvironment,
+                         PreprocessedDefaultDoubleVIEnvironment, EvictBeliefsDoubleVIEnvironment, FineDoubleVIEnvironment, RefineDoubleVIEnvironment,
+                         RefineDenseDoubleVIEnvironment, RefineParallelExpansionDoubleVIEnvironment, PreprocessedRefineDoubleVIEnvironment,
                          DefaultDoubleOVIEnvironment, DefaultRationalPIEnvironment, PreprocessedDefaultRationalPIEnvironment>
     TestingTypes;
 
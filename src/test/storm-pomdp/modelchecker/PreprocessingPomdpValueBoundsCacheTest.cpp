@@ -0,0 +1,45 @@
+#include "storm-config.h"
+#include "test/storm_gtest.h"
+
+#include <filesystem>
+
+#include "storm-parsers/api/storm-parsers.h"
+#include "storm-pomdp/modelchecker/PreprocessingPomdpValueBoundsModelChecker.h"
+#include "storm-pomdp/storage/PreprocessingPomdpValueBoundsCache.h"
+#include "storm-pomdp/transformer/MakePOMDPCanonic.h"
+#include "storm/api/storm.h"
+
+TEST(PreprocessingPomdpValueBoundsCacheTest, simple_Pmax) {
+    storm::prism::Program program = storm::api::parseProgram(STORM_TEST_RESOURCES_DIR "/pomdp/simple.prism");
+    program = storm::utility::prism::preprocess(program, "slippery=0.4");
+    auto formula = storm::api::parsePropertiesForPrismProgram("Pmax=? [F \"goal\" ]", program).front().getRawFormula();
+    auto pomdp = storm::api::buildSparseModel<double>(program, {formula})->as<storm::models::sparse::Pomdp<double>>();
+    storm::transformer::MakePOMDPCanonic<double> makeCanonic(*pomdp);
+    pomdp = makeCanonic.transform();
+
+    std::string directory = std::filesystem::temp_directory_path().string();
+    storm::pomdp::storage::PreprocessingPomdpValueBoundsCache<double> cache(directory);
+    storm::pomdp::modelchecker::PreprocessingPomdpValueBoundsModelChecker<double> preprocessingChecker(*pomdp);
+    auto bounds = preprocessingChecker.getValueBounds(*formula);
+    cache.storeValueBounds(*pomdp, *formula, bounds);
+    ASSERT_TRUE(cache.getValueBounds(*pomdp, *formula).has_value());
+
+    // A fresh cache reads the bounds from the directory.
+    storm::pomdp::storage::PreprocessingPomdpValueBoundsCache<double> otherCache(directory);
+    auto cachedBounds = otherCache.getValueBounds(*pomdp, *formula);
+    ASSERT_TRUE(cachedBounds.has_value());
+    EXPECT_EQ(bounds.lower, cachedBounds->lower);
+    EXPECT_EQ(bounds.upper, cachedBounds->upper);
+    ASSERT_EQ(bounds.lowerSchedulers.size(), cachedBounds->lowerSchedulers.size());
+    for (uint64_t i = 0; i < bounds.lowerSchedulers.size(); ++i) {
+        for (uint64_t state = 0; state < pomdp->getNumberOfStates(); ++state) {
+            EXPECT_TRUE(bounds.lowerSchedulers[i].getChoice(state).getChoiceAsDistribution().equals(
+                cachedBounds->lowerSchedulers[i].getChoice(state).getChoiceAsDistribution()));
+        }
+    }
+    EXPECT_TRUE(cachedBounds->upperSchedulers.empty());
+
+    // Bounds for a different formula are not in the cache.
+    auto otherFormula = storm::api::parsePropertiesForPrismProgram("Pmin=? [F \"goal\" ]", program).front().getRawFormula();
+    EXPECT_FALSE(otherCache.getValueBounds(*pomdp, *otherFormula).has_value());
+}
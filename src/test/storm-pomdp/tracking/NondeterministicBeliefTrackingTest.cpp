@@ -0,0 +1,74 @@
+#include "storm-config.h"
+#include "storm-parsers/api/model_descriptions.h"
+#include "storm-parsers/api/properties.h"
+#include "storm-parsers/parser/PrismParser.h"
+#include "storm-pomdp/generator/NondeterministicBeliefTracker.h"
+#include "storm-pomdp/transformer/MakePOMDPCanonic.h"
+#include "storm/api/storm.h"
+#include "storm/builder/ExplicitModelBuilder.h"
+#include "storm/models/sparse/StandardRewardModel.h"
+#include "test/storm_gtest.h"
+
+namespace {
+std::shared_ptr<storm::models::sparse::Pomdp<double>> buildMaze() {
+    storm::prism::Program program = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR "/pomdp/maze2.prism");
+    program = storm::utility::prism::preprocess(program, "sl=0.4");
+    std::shared_ptr<storm::logic::Formula const> formula = storm::api::parsePropertiesForPrismProgram("Pmax=? [F \"goal\" ]", program).front().getRawFormula();
+    std::shared_ptr<storm::models::sparse::Pomdp<double>> pomdp =
+        storm::api::buildSparseModel<double>(program, {formula})->as<storm::models::sparse::Pomdp<double>>();
+    storm::transformer::MakePOMDPCanonic<double> makeCanonic(*pomdp);
+    return makeCanonic.transform();
+}
+
+// Observations along a path that always takes the last choice and moves to the last successor.
+std::vector<uint32_t> getTrace(storm::models::sparse::Pomdp<double> const& pomdp, uint64_t length) {
+    uint64_t state = pomdp.getInitialStates().getNextSetIndex(0);
+    std::vector<uint32_t> trace = {pomdp.getObservation(state)};
+    for (uint64_t step = 0; step < length; ++step) {
+        auto row = pomdp.getTransitionMatrix().getRow(pomdp.getNondeterministicChoiceIndices()[state + 1] - 1);
+        state = (row.end() - 1)->getColumn();
+        trace.push_back(pomdp.getObservation(state));
+    }
+    return trace;
+}
+}  // namespace
+
+TEST(NondeterministicBeliefTracking, Maze) {
+    auto pomdp = buildMaze();
+    std::vector<double> risk(pomdp->getNumberOfStates(), 0.0);
+    for (auto state : pomdp->getStates("goal")) {
+        risk[state] = 1.0;
+    }
+    auto trace = getTrace(*pomdp, 8);
+
+    typedef storm::generator::NondeterministicBeliefTracker<double, storm::generator::SparseBeliefState<double>> Tracker;
+    Tracker exactTracker(*pomdp);
+    exactTracker.setRisk(risk);
+    Tracker::Options boundedOptions;
+    boundedOptions.maxNumberOfBeliefs = 2;
+    Tracker boundedTracker(*pomdp, boundedOptions);
+    boundedTracker.setRisk(risk);
+    Tracker::Options pruningOptions;
+    pruningOptions.pruningThreshold = 1e-9;
+    Tracker pruningTracker(*pomdp, pruningOptions);
+    pruningTracker.setRisk(risk);
+
+    ASSERT_TRUE(exactTracker.reset(trace.front()));
+    ASSERT_TRUE(boundedTracker.reset(trace.front()));
+    ASSERT_TRUE(pruningTracker.reset(trace.front()));
+    // The bounded tracker might drop all beliefs that are consistent with the trace.
+    bool boundedTrackerHasBeliefs = true;
+    for (uint64_t step = 1; step < trace.size(); ++step) {
+        ASSERT_TRUE(exactTracker.track(trace[step]));
+        ASSERT_TRUE(pruningTracker.track(trace[step]));
+        EXPECT_EQ(trace[step], exactTracker.getCurrentObservation());
+        if (boundedTrackerHasBeliefs) {
+            boundedTrackerHasBeliefs = boundedTracker.track(trace[step]);
+            EXPECT_LE(boundedTracker.getNumberOfBeliefs(), 2ul);
+        }
+        EXPECT_LE(pruningTracker.getNumberOfBeliefs(), exactTracker.getNumberOfBeliefs());
+        EXPECT_NEAR(exactTracker.getCurrentRisk(), pruningTracker.getCurrentRisk(), 1e-6);
+        EXPECT_NEAR(exactTracker.getCurrentRisk(false), pruningTracker.getCurrentRisk(false), 1e-6);
+    }
+    EXPECT_EQ(0ul, exactTracker.getNumberOfPrunedBeliefs());
+}
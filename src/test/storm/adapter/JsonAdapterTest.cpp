@@ -0,0 +1,57 @@
+#include "storm-config.h"
+#include "test/storm_gtest.h"
+
+#include <sstream>
+
+#include "storm/adapters/JsonAdapter.h"
+#include "storm/adapters/RationalNumberAdapter.h"
+#include "storm/utility/constants.h"
+
+namespace {
+
+template<typename ValueType>
+storm::json<ValueType> createEntry(uint64_t index) {
+    storm::json<ValueType> entry;
+    entry["id"] = index;
+    entry["s"]["x"] = storm::utility::convertNumber<ValueType, uint64_t>(index) / storm::utility::convertNumber<ValueType, uint64_t>(4);
+    entry["lab"] = std::vector<std::string>({"init", "with \"quotes\""});
+    entry["c"] = storm::json<ValueType>::array();
+    return entry;
+}
+
+template<typename ValueType>
+void checkStreamedDocument(bool compact) {
+    storm::json<ValueType> document;
+    std::stringstream stream;
+    storm::JsonStreamWriter<ValueType> writer(stream, compact);
+    writer.beginObject();
+    writer.key("empty");
+    writer.beginObject();
+    writer.endObject();
+    writer.key("states");
+    writer.beginArray();
+    for (uint64_t index = 0; index < 3; ++index) {
+        document["states"].push_back(createEntry<ValueType>(index));
+        writer.value(createEntry<ValueType>(index));
+    }
+    writer.endArray();
+    writer.key("value");
+    writer.value(storm::utility::convertNumber<ValueType, uint64_t>(2));
+    writer.endObject();
+    document["empty"] = storm::json<ValueType>::object();
+    document["value"] = storm::utility::convertNumber<ValueType, uint64_t>(2);
+
+    EXPECT_EQ(storm::dumpJson(document, compact), stream.str());
+}
+
+TEST(JsonAdapter, StreamWriterDouble) {
+    checkStreamedDocument<double>(false);
+    checkStreamedDocument<double>(true);
+}
+
+TEST(JsonAdapter, StreamWriterRationalNumber) {
+    checkStreamedDocument<storm::RationalNumber>(false);
+    checkStreamedDocument<storm::RationalNumber>(true);
+}
+
+}  // namespace
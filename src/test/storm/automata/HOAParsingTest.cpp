@@ -1,4 +1,5 @@
 #include "storm/automata/DeterministicAutomaton.h"
+#include "storm/exceptions/WrongFormatException.h"
 #include "test/storm_gtest.h"
 
 #include <sstream>
@@ -29,3 +30,36 @@ TEST(DeterministicAutomaton, ParseAutomaton) {
     ASSERT_NO_THROW(da = storm::automata::DeterministicAutomaton::parse(in));
     // da->printHOA(std::cout);
 }
+
+TEST(DeterministicAutomaton, BinaryRoundTrip) {
+    std::string aUb =
+        "HOA: v1\n"
+        "States: 3\n"
+        "Start: 0\n"
+        "Acceptance: 2 (Fin(0) & Inf(1))\n"
+        "AP: 2 \"a\" \"b\""
+        "--BODY--\n"
+        "State: 0 { 0 }\n"
+        "  2 0 1 1\n"
+        "State: 1 { 1 }\n"
+        "  1 1 1 1\n"
+        "State: 2 { 0 }\n"
+        "  2 2 2 2\n"
+        "--END--\n";
+
+    std::istringstream in = std::istringstream(aUb);
+    storm::automata::DeterministicAutomaton::ptr da = storm::automata::DeterministicAutomaton::parse(in);
+    std::ostringstream out;
+    da->writeBinary(out);
+    std::string binary = out.str();
+
+    storm::automata::DeterministicAutomaton::ptr loaded;
+    ASSERT_NO_THROW(loaded = storm::automata::DeterministicAutomaton::readBinary(binary.data(), binary.data() + binary.size()));
+    std::ostringstream expectedHOA, loadedHOA;
+    da->printHOA(expectedHOA);
+    loaded->printHOA(loadedHOA);
+    EXPECT_EQ(expectedHOA.str(), loadedHOA.str());
+
+    STORM_SILENT_EXPECT_THROW(storm::automata::DeterministicAutomaton::readBinary(binary.data(), binary.data() + binary.size() - 1),
+                              storm::exceptions::WrongFormatException);
+}
@@ -10,6 +10,7 @@
 #include "storm/settings/SettingsManager.h"
 #include "storm/settings/modules/BuildSettings.h"
 #include "storm/storage/SymbolicModelDescription.h"
+#include "storm/utility/dd.h"
 #include "test/storm_gtest.h"
 
 TEST(DdPrismModelBuilderTest_Sylvan, Dtmc) {
@@ -346,6 +347,80 @@ TEST(DdPrismModelBuilderTest_Cudd, Composition) {
     EXPECT_EQ(21ul, mdp->getNumberOfChoices());
 }
 
+template<storm::dd::DdType Type>
+void checkReachabilityStrategies(std::string const& path) {
+    storm::prism::Program program = storm::parser::PrismParser::parse(path).preprocess().asPrismProgram();
+    std::shared_ptr<storm::models::symbolic::Model<Type>> model = storm::builder::DdPrismModelBuilder<Type>().build(program);
+
+    storm::dd::Bdd<Type> transitions = model->getTransitionMatrix().notZero().existsAbstract(model->getNondeterminismVariables());
+    std::vector<std::vector<std::pair<storm::expressions::Variable, storm::expressions::Variable>>> variableGroups;
+    for (auto const& variablePair : model->getRowColumnMetaVariablePairs()) {
+        variableGroups.push_back({variablePair});
+    }
+    std::vector<storm::dd::Bdd<Type>> partitions = storm::utility::dd::partitionTransitionRelation(transitions, variableGroups);
+    EXPECT_LT(1ul, partitions.size());
+
+    for (auto strategy : {storm::builder::DdReachabilityStrategy::Bfs, storm::builder::DdReachabilityStrategy::Chaining,
+                          storm::builder::DdReachabilityStrategy::Saturation}) {
+        storm::dd::Bdd<Type> reachableStates = storm::utility::dd::computeReachableStates(model->getInitialStates(), partitions, model->getRowVariables(),
+                                                                                          model->getColumnVariables(), strategy)
+                                                   .first;
+        EXPECT_TRUE(reachableStates == model->getReachableStates()) << "Strategy " << strategy << " computed a wrong set of reachable states.";
+    }
+}
+
+TEST(DdPrismModelBuilderTest_Sylvan, ReachabilityStrategies) {
+    checkReachabilityStrategies<storm::dd::DdType::Sylvan>(STORM_TEST_RESOURCES_DIR "/dtmc/leader-3-5.pm");
+    checkReachabilityStrategies<storm::dd::DdType::Sylvan>(STORM_TEST_RESOURCES_DIR "/mdp/leader3.nm");
+}
+
+TEST(DdPrismModelBuilderTest_Cudd, ReachabilityStrategies) {
+    checkReachabilityStrategies<storm::dd::DdType::CUDD>(STORM_TEST_RESOURCES_DIR "/dtmc/leader-3-5.pm");
+    checkReachabilityStrategies<storm::dd::DdType::CUDD>(STORM_TEST_RESOURCES_DIR "/mdp/leader3.nm");
+}
+
+template<storm::dd::DdType Type>
+void checkPartitionedTransitionRelation(std::string const& path) {
+    storm::prism::Program program = storm::parser::PrismParser::parse(path).preprocess().asPrismProgram();
+    std::shared_ptr<storm::models::symbolic::Model<Type>> model = storm::builder::DdPrismModelBuilder<Type>().build(program);
+
+    storm::dd::Bdd<Type> transitions = model->getQualitativeTransitionMatrix(false);
+    std::vector<std::vector<std::pair<storm::expressions::Variable, storm::expressions::Variable>>> variableGroups;
+    for (auto const& variablePair : model->getRowColumnMetaVariablePairs()) {
+        variableGroups.push_back({variablePair});
+    }
+    storm::dd::PartitionedTransitionRelation<Type> disjunctiveRelation =
+        storm::utility::dd::createPartitionedTransitionRelation(transitions, variableGroups, model->getRowColumnMetaVariablePairs());
+    EXPECT_TRUE(disjunctiveRelation.getRelation() == transitions);
+
+    // Split the relation conjunctively into the reachable sources and the implication from reachable sources to the transitions.
+    storm::dd::PartitionedTransitionRelation<Type> conjunctiveRelation(storm::dd::TransitionRelationPartitioning::Conjunctive,
+                                                                       {model->getReachableStates(), !model->getReachableStates() || transitions},
+                                                                       model->getRowColumnMetaVariablePairs());
+    EXPECT_TRUE(conjunctiveRelation.getRelation() == transitions);
+
+    storm::dd::Bdd<Type> states = model->getInitialStates();
+    for (uint64_t step = 0; step < 5; ++step) {
+        storm::dd::Bdd<Type> successors = states.relationalProduct(transitions, model->getRowVariables(), model->getColumnVariables());
+        EXPECT_TRUE(disjunctiveRelation.image(states) == successors);
+        EXPECT_TRUE(conjunctiveRelation.image(states) == successors);
+        storm::dd::Bdd<Type> predecessors = successors.inverseRelationalProduct(transitions, model->getRowVariables(), model->getColumnVariables());
+        EXPECT_TRUE(disjunctiveRelation.preimage(successors) == predecessors);
+        EXPECT_TRUE(conjunctiveRelation.preimage(successors) == predecessors);
+        states |= successors;
+    }
+}
+
+TEST(DdPrismModelBuilderTest_Sylvan, PartitionedTransitionRelation) {
+    checkPartitionedTransitionRelation<storm::dd::DdType::Sylvan>(STORM_TEST_RESOURCES_DIR "/dtmc/leader-3-5.pm");
+    checkPartitionedTransitionRelation<storm::dd::DdType::Sylvan>(STORM_TEST_RESOURCES_DIR "/mdp/leader3.nm");
+}
+
+TEST(DdPrismModelBuilderTest_Cudd, PartitionedTransitionRelation) {
+    checkPartitionedTransitionRelation<storm::dd::DdType::CUDD>(STORM_TEST_RESOURCES_DIR "/dtmc/leader-3-5.pm");
+    checkPartitionedTransitionRelation<storm::dd::DdType::CUDD>(STORM_TEST_RESOURCES_DIR "/mdp/leader3.nm");
+}
+
 TEST(UnboundedTest_Sylvan, Mdp) {
     storm::storage::SymbolicModelDescription modelDescription = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR "/mdp/unbounded.nm");
     storm::prism::Program program = modelDescription.preprocess("N=1").asPrismProgram();
@@ -0,0 +1,28 @@
+#include "storm-config.h"
+#include "test/storm_gtest.h"
+
+#include "storm/builder/DdVariableOrdering.h"
+#include "storm/storage/expressions/ExpressionManager.h"
+
+TEST(DdVariableOrderingTest, Force) {
+    storm::expressions::ExpressionManager manager;
+    storm::expressions::Variable a = manager.declareBooleanVariable("a");
+    storm::expressions::Variable b = manager.declareBooleanVariable("b");
+    storm::expressions::Variable c = manager.declareIntegerVariable("c");
+    storm::expressions::Variable d = manager.declareIntegerVariable("d");
+    storm::expressions::Variable e = manager.declareIntegerVariable("e");
+
+    std::vector<storm::expressions::Variable> variables = {a, b, c, d};
+    // Variable e does not appear in the list of variables and must be ignored.
+    std::vector<std::set<storm::expressions::Variable>> clusters = {{a, d}, {b}, {c, e}};
+    EXPECT_EQ(3ul, storm::builder::computeTotalSpan(variables, clusters));
+
+    std::vector<storm::expressions::Variable> order = storm::builder::computeForceVariableOrder(variables, clusters);
+    ASSERT_EQ(4ul, order.size());
+    EXPECT_EQ(1ul, storm::builder::computeTotalSpan(order, clusters));
+    EXPECT_EQ(std::set<storm::expressions::Variable>(variables.begin(), variables.end()), std::set<storm::expressions::Variable>(order.begin(), order.end()));
+
+    // An order in which all clusters are contiguous is not changed.
+    std::vector<std::set<storm::expressions::Variable>> contiguousClusters = {{a, b}, {c, d}};
+    EXPECT_EQ(variables, storm::builder::computeForceVariableOrder(variables, contiguousClusters));
+}
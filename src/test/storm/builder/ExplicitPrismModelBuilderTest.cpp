@@ -1,11 +1,15 @@
+#include <numeric>
 #include <storm/generator/PrismNextStateGenerator.h>
 #include "storm-config.h"
+#include "storm-parsers/parser/FormulaParser.h"
 #include "storm-parsers/parser/PrismParser.h"
+#include "storm/api/builder.h"
 #include "storm/builder/ExplicitModelBuilder.h"
 #include "storm/exceptions/WrongFormatException.h"
 #include "storm/models/sparse/MarkovAutomaton.h"
 #include "storm/models/sparse/StandardRewardModel.h"
 #include "storm/storage/expressions/ExpressionManager.h"
+#include "storm/utility/prism.h"
 #include "test/storm_gtest.h"
 
 TEST(ExplicitPrismModelBuilderTest, Dtmc) {
@@ -155,6 +159,224 @@ TEST(ExplicitPrismModelBuilderTest, POMdp) {
     model = storm::builder::ExplicitModelBuilder<double>(program).build();
 }
 
+TEST(ExplicitPrismModelBuilderTest, ParallelExploration) {
+    storm::builder::ExplicitModelBuilder<double>::Options sequentialOptions;
+    sequentialOptions.explorationOrder = storm::builder::ExplorationOrder::Bfs;
+    sequentialOptions.numberOfThreads = 1;
+    storm::builder::ExplicitModelBuilder<double>::Options parallelOptions = sequentialOptions;
+    parallelOptions.numberOfThreads = 4;
+    storm::generator::NextStateGeneratorOptions generatorOptions;
+    generatorOptions.setBuildAllLabels();
+    generatorOptions.setBuildAllRewardModels();
+
+    for (std::string const& file : {"/dtmc/crowds-5-5.pm", "/dtmc/nand-5-2.pm", "/mdp/two_dice.nm", "/mdp/coin2-2.nm"}) {
+        storm::prism::Program program = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR + file);
+        auto sequentialModel = storm::builder::ExplicitModelBuilder<double>(program, generatorOptions, sequentialOptions).build();
+        auto parallelModel = storm::builder::ExplicitModelBuilder<double>(program, generatorOptions, parallelOptions).build();
+        // The parallel exploration yields exactly the same state numbering as the sequential one.
+        EXPECT_TRUE(sequentialModel->getTransitionMatrix() == parallelModel->getTransitionMatrix()) << file;
+        EXPECT_TRUE(sequentialModel->getStateLabeling() == parallelModel->getStateLabeling()) << file;
+        ASSERT_EQ(sequentialModel->getRewardModels().size(), parallelModel->getRewardModels().size()) << file;
+        for (auto const& rewardModel : sequentialModel->getRewardModels()) {
+            auto const& parallelRewardModel = parallelModel->getRewardModel(rewardModel.first);
+            ASSERT_EQ(rewardModel.second.hasStateRewards(), parallelRewardModel.hasStateRewards()) << file;
+            if (rewardModel.second.hasStateRewards()) {
+                EXPECT_EQ(rewardModel.second.getStateRewardVector(), parallelRewardModel.getStateRewardVector()) << file;
+            }
+            ASSERT_EQ(rewardModel.second.hasStateActionRewards(), parallelRewardModel.hasStateActionRewards()) << file;
+            if (rewardModel.second.hasStateActionRewards()) {
+                EXPECT_EQ(rewardModel.second.getStateActionRewardVector(), parallelRewardModel.getStateActionRewardVector()) << file;
+            }
+        }
+    }
+}
+
+TEST(ExplicitPrismModelBuilderTest, SynchronousUpdates) {
+    // The updates of synchronizing commands must read the values of the original state, even though they are applied one after the other.
+    std::string input =
+        "dtmc\n"
+        "module first\n"
+        "    x : [0..3] init 0;\n"
+        "    b : bool init false;\n"
+        "    [step] x < 3 -> 0.5 : (x'=y+1) & (b'=!b) + 0.5 : (x'=1+y) & (b'=c);\n"
+        "    [] x = 3 -> true;\n"
+        "endmodule\n"
+        "module second\n"
+        "    y : [0..3] init 0;\n"
+        "    c : bool init true;\n"
+        "    [step] true -> (y'=x) & (c'=b);\n"
+        "endmodule\n"
+        "label \"done\" = x = 3 & y = 2 & b & !c;\n";
+    storm::prism::Program program = storm::parser::PrismParser::parseFromString(input, "testfile");
+    std::shared_ptr<storm::models::sparse::Model<double>> model = storm::builder::ExplicitModelBuilder<double>(program).build();
+    // (x,y) evolves as (0,0) -> (1,0) -> (1,1) -> (2,1) -> (2,2) -> (3,2) and b, c are swapped in each step. Both updates of the command lead
+    // to the same successor, because b is always the negation of c.
+    EXPECT_EQ(6ul, model->getNumberOfStates());
+    EXPECT_EQ(6ul, model->getNumberOfTransitions());
+    EXPECT_EQ(1ul, model->getStates("done").getNumberOfSetBits());
+}
+
+TEST(ExplicitPrismModelBuilderTest, GuardIndex) {
+    // The commands are indexed by the value of s, which includes commands that do not constrain s and a command that is never enabled.
+    std::string input =
+        "mdp\n"
+        "module main\n"
+        "    s : [0..2] init 0;\n"
+        "    x : [0..2] init 0;\n"
+        "    [] s=0 -> (s'=1);\n"
+        "    [] s=1 & x<2 -> (x'=x+1);\n"
+        "    [] 1=s -> (s'=2);\n"
+        "    [] s=3 -> (s'=0);\n"
+        "    [] s=2 & x<2 -> (x'=x+1);\n"
+        "    [] s=2 & x=2 -> (s'=0) & (x'=0);\n"
+        "    [] x=1 -> (x'=2);\n"
+        "endmodule\n";
+    storm::prism::Program program = storm::parser::PrismParser::parseFromString(input, "testfile");
+    std::shared_ptr<storm::models::sparse::Model<double>> model = storm::builder::ExplicitModelBuilder<double>(program).build();
+    EXPECT_EQ(7ul, model->getNumberOfStates());
+    EXPECT_EQ(11ul, model->getNumberOfChoices());
+    EXPECT_EQ(11ul, model->getNumberOfTransitions());
+}
+
+TEST(ExplicitPrismModelBuilderTest, SymmetryReduction) {
+    std::string input =
+        "dtmc\n"
+        "module p1\n"
+        "    s1 : [0..2] init 0;\n"
+        "    [] s1<2 -> 0.5 : (s1'=s1+1) + 0.5 : true;\n"
+        "    [] s1=2 -> (s1'=0);\n"
+        "endmodule\n"
+        "module p2 = p1 [s1=s2] endmodule\n"
+        "module p3 = p1 [s1=s3] endmodule\n"
+        "label \"all\" = s1=2 & s2=2 & s3=2;\n"
+        "rewards \"progress\"\n"
+        "    true : s1 + s2 + s3;\n"
+        "endrewards\n";
+    storm::prism::Program program = storm::parser::PrismParser::parseFromString(input, "testfile");
+    storm::generator::NextStateGeneratorOptions options(true, true);
+    std::shared_ptr<storm::models::sparse::Model<double>> model = storm::builder::ExplicitModelBuilder<double>(program, options).build();
+    EXPECT_EQ(27ul, model->getNumberOfStates());
+
+    // Only one state per multiset of local states remains.
+    options.setSymmetryReduction();
+    model = storm::builder::ExplicitModelBuilder<double>(program, options).build();
+    EXPECT_EQ(10ul, model->getNumberOfStates());
+    EXPECT_EQ(1ul, model->getStates("all").getNumberOfSetBits());
+    for (uint64_t state = 0; state < model->getNumberOfStates(); ++state) {
+        EXPECT_NEAR(1.0, model->getTransitionMatrix().getRowSum(state), 1e-12);
+    }
+
+    // Asymmetric labels prevent the reduction.
+    program = storm::parser::PrismParser::parseFromString(input + "label \"first\" = s1=2;\n", "testfile");
+    model = storm::builder::ExplicitModelBuilder<double>(program, options).build();
+    EXPECT_EQ(27ul, model->getNumberOfStates());
+}
+
+TEST(ExplicitPrismModelBuilderTest, PartialOrderReduction) {
+    std::string input =
+        "mdp\n"
+        "module coin\n"
+        "    c : [0..2] init 0;\n"
+        "    [] c=0 -> 0.5 : (c'=1) + 0.5 : (c'=2);\n"
+        "endmodule\n"
+        "module first\n"
+        "    a : [0..2] init 0;\n"
+        "    [] a<2 -> (a'=a+1);\n"
+        "endmodule\n"
+        "module second\n"
+        "    b : [0..2] init 0;\n"
+        "    [] b<2 -> (b'=b+1);\n"
+        "endmodule\n"
+        "label \"heads\" = c=1;\n";
+    storm::prism::Program program = storm::parser::PrismParser::parseFromString(input, "testfile");
+    storm::generator::NextStateGeneratorOptions options(true, true);
+    std::shared_ptr<storm::models::sparse::Model<double>> model = storm::builder::ExplicitModelBuilder<double>(program, options).build();
+    EXPECT_EQ(27ul, model->getNumberOfStates());
+    EXPECT_EQ(9ul, model->getStates("heads").getNumberOfSetBits());
+
+    // The invisible counters are only interleaved in one order before the coin is flipped.
+    options.setPartialOrderReduction();
+    model = storm::builder::ExplicitModelBuilder<double>(program, options).build();
+    EXPECT_EQ(7ul, model->getNumberOfStates());
+    EXPECT_EQ(1ul, model->getStates("heads").getNumberOfSetBits());
+
+    // Commands that change visible variables are always explored.
+    program = storm::parser::PrismParser::parseFromString(input + "label \"twice\" = a=2;\n", "testfile");
+    model = storm::builder::ExplicitModelBuilder<double>(program, options).build();
+    EXPECT_EQ(11ul, model->getNumberOfStates());
+}
+
+TEST(ExplicitPrismModelBuilderTest, TerminalStatesFromFormulas) {
+    storm::prism::Program program = storm::parser::PrismParser::parseFromString(
+        "dtmc\n"
+        "module main\n"
+        "    s : [0..3] init 0;\n"
+        "    [] s=0 -> 0.5 : (s'=1) + 0.5 : (s'=2);\n"
+        "    [] s=1 -> (s'=3);\n"
+        "endmodule\n"
+        "label \"goal\" = s=1;\n",
+        "testfile");
+    storm::parser::FormulaParser formulaParser(program);
+    auto getFormulas = [&formulaParser](std::string const& input) {
+        std::vector<std::shared_ptr<storm::logic::Formula const>> formulas;
+        for (auto const& property : formulaParser.parseFromString(input)) {
+            formulas.push_back(property.getRawFormula());
+        }
+        return formulas;
+    };
+
+    // The goal states are terminal for both formulas, so their successors are not explored.
+    storm::builder::BuilderOptions options(getFormulas("P=? [F \"goal\"]; P=? [F<=3 \"goal\"]"), program);
+    EXPECT_TRUE(options.hasTerminalStates());
+    std::shared_ptr<storm::models::sparse::Model<double>> model = storm::builder::ExplicitModelBuilder<double>(program, options).build();
+    EXPECT_EQ(3ul, model->getNumberOfStates());
+
+    // There is no common terminal state condition.
+    options = storm::builder::BuilderOptions(getFormulas("P=? [F \"goal\"]; P=? [F s=3]"), program);
+    EXPECT_FALSE(options.hasTerminalStates());
+    model = storm::builder::ExplicitModelBuilder<double>(program, options).build();
+    EXPECT_EQ(4ul, model->getNumberOfStates());
+}
+
+TEST(ExplicitPrismModelBuilderTest, BestFirstExploration) {
+    storm::prism::Program program = storm::parser::PrismParser::parseFromString(
+        "dtmc\n"
+        "module main\n"
+        "    s : [0..4] init 0;\n"
+        "    [] s=0 -> 0.1 : (s'=1) + 0.9 : (s'=2);\n"
+        "    [] s=1 -> (s'=3);\n"
+        "    [] s=2 -> (s'=4);\n"
+        "    [] s>2 -> true;\n"
+        "endmodule\n"
+        "label \"likely\" = s=4;\n",
+        "testfile");
+    storm::generator::NextStateGeneratorOptions generatorOptions(false, true);
+    storm::builder::ExplicitModelBuilder<double>::Options options;
+    options.explorationOrder = storm::builder::ExplorationOrder::BestFirst;
+    options.numberOfThreads = 1;
+    std::shared_ptr<storm::models::sparse::Model<double>> model = storm::builder::ExplicitModelBuilder<double>(program, generatorOptions, options).build();
+    EXPECT_EQ(5ul, model->getNumberOfStates());
+    EXPECT_EQ(6ul, model->getNumberOfTransitions());
+    EXPECT_FALSE(model->hasLabel("unexplored"));
+
+    // The breadth-first exploration expands the unlikely branch, whereas the best-first exploration follows the likely one.
+    options.explorationLimit = 2;
+    options.explorationOrder = storm::builder::ExplorationOrder::Bfs;
+    model = storm::builder::ExplicitModelBuilder<double>(program, generatorOptions, options).build();
+    EXPECT_EQ(4ul, model->getNumberOfStates());
+    EXPECT_EQ(2ul, model->getStates("unexplored").getNumberOfSetBits());
+    EXPECT_TRUE(model->getStates("likely").empty());
+
+    options.explorationOrder = storm::builder::ExplorationOrder::BestFirst;
+    model = storm::builder::ExplicitModelBuilder<double>(program, generatorOptions, options).build();
+    EXPECT_EQ(4ul, model->getNumberOfStates());
+    EXPECT_EQ(2ul, model->getStates("unexplored").getNumberOfSetBits());
+    EXPECT_EQ(1ul, model->getStates("likely").getNumberOfSetBits());
+    for (uint64_t state = 0; state < model->getNumberOfStates(); ++state) {
+        EXPECT_NEAR(1.0, model->getTransitionMatrix().getRowSum(state), 1e-12);
+    }
+}
+
 TEST(ExplicitPrismModelBuilderTest, FailComposition) {
     storm::prism::Program program = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR "/mdp/system_composition.nm");
 
@@ -182,6 +404,86 @@ TEST(ExplicitPrismModelBuilderTest, ExportExplicitLookup) {
     EXPECT_EQ(1ul, model->getLabelsOfState(lookup.lookup({{svar, manager.integer(7)}, {dvar, manager.integer(2)}})).count("two"));
 }
 
+TEST(ExplicitPrismModelBuilderTest, IncrementalRebuild) {
+    std::string const modelPrefix =
+        "dtmc\n"
+        "module a\n"
+        "    x : [0..2] init 0;\n"
+        "    [] x<2 -> 0.5 : (x'=x+1) + 0.5 : (x'=0);\n"
+        "    [] x=2 -> true;\n"
+        "endmodule\n";
+    std::string const modelSuffix =
+        "rewards \"steps\"\n"
+        "    x<2 : 1;\n"
+        "endrewards\n";
+    std::string const previousModule =
+        "module b\n"
+        "    y : [0..2] init 0;\n"
+        "    [] x=2 & y<2 -> (y'=y+1);\n"
+        "endmodule\n";
+    std::string const changedModule =
+        "module b\n"
+        "    y : [0..2] init 0;\n"
+        "    [] x=2 & y<2 -> 0.5 : (y'=y+1) + 0.5 : (y'=0);\n"
+        "endmodule\n";
+    storm::prism::Program previousProgram = storm::parser::PrismParser::parseFromString(modelPrefix + previousModule + modelSuffix, "testfile");
+    storm::prism::Program program = storm::parser::PrismParser::parseFromString(modelPrefix + changedModule + modelSuffix, "testfile");
+    storm::generator::NextStateGeneratorOptions generatorOptions;
+    generatorOptions.setBuildAllRewardModels();
+    generatorOptions.setBuildAllLabels();
+
+    storm::builder::ExplicitModelBuilder<double> previousBuilder(previousProgram, generatorOptions);
+    std::shared_ptr<storm::models::sparse::Model<double>> previousModel = previousBuilder.build();
+    std::shared_ptr<storm::models::sparse::Model<double>> expectedModel = storm::builder::ExplicitModelBuilder<double>(program, generatorOptions).build();
+
+    storm::builder::ExplicitModelBuilder<double> builder(program, generatorOptions);
+    builder.setPreviousBuild(previousModel, previousBuilder.exportExplicitStateLookup(),
+                             storm::utility::prism::getChangedModuleGuard(previousProgram, program, "b"));
+    std::shared_ptr<storm::models::sparse::Model<double>> model = builder.build();
+
+    EXPECT_EQ(expectedModel->getNumberOfStates(), model->getNumberOfStates());
+    EXPECT_EQ(expectedModel->getNumberOfTransitions(), model->getNumberOfTransitions());
+    EXPECT_EQ(expectedModel->getStates("deadlock").getNumberOfSetBits(), model->getStates("deadlock").getNumberOfSetBits());
+    auto const& expectedRewards = expectedModel->getRewardModel("steps").getStateRewardVector();
+    auto const& rewards = model->getRewardModel("steps").getStateRewardVector();
+    EXPECT_NEAR(std::accumulate(expectedRewards.begin(), expectedRewards.end(), 0.0), std::accumulate(rewards.begin(), rewards.end(), 0.0), 1e-12);
+    auto lookup = builder.exportExplicitStateLookup();
+    auto x = program.getManager().getVariable("x");
+    auto y = program.getManager().getVariable("y");
+    auto& manager = program.getManager();
+    uint64_t state = lookup.lookup({{x, manager.integer(2)}, {y, manager.integer(1)}});
+    ASSERT_LT(state, model->getNumberOfStates());
+    // The changed module now also leads back to y=0.
+    EXPECT_EQ(3ul, model->getTransitionMatrix().getRow(state).getNumberOfEntries());
+}
+
+TEST(ExplicitPrismModelBuilderTest, SymbolicReachability) {
+    for (std::string const& file : {"/dtmc/crowds-5-5.pm", "/mdp/coin2-2.nm", "/ctmc/cluster2.sm"}) {
+        storm::prism::Program program = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR + file, true);
+        storm::generator::NextStateGeneratorOptions options;
+        options.setBuildAllLabels();
+        options.setBuildAllRewardModels();
+        auto expectedModel = storm::builder::ExplicitModelBuilder<double>(program, options).build();
+        auto model = storm::api::buildSparseModelWithSymbolicReachability<storm::dd::DdType::Sylvan, double>(program, options);
+        EXPECT_EQ(expectedModel->getNumberOfStates(), model->getNumberOfStates()) << file;
+        EXPECT_EQ(expectedModel->getNumberOfTransitions(), model->getNumberOfTransitions()) << file;
+        EXPECT_EQ(expectedModel->getNumberOfChoices(), model->getNumberOfChoices()) << file;
+        for (auto const& label : expectedModel->getStateLabeling().getLabels()) {
+            EXPECT_EQ(expectedModel->getStates(label).getNumberOfSetBits(), model->getStates(label).getNumberOfSetBits()) << file << ": " << label;
+        }
+    }
+
+    // A terminal state cuts off the states that are only reachable through it.
+    storm::prism::Program program = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR "/dtmc/die.pm");
+    storm::generator::NextStateGeneratorOptions options;
+    options.addTerminalExpression(program.getManager().getVariableExpression("s") == program.getManager().integer(2), true);
+    auto expectedModel = storm::builder::ExplicitModelBuilder<double>(program, options).build();
+    auto model = storm::api::buildSparseModelWithSymbolicReachability<storm::dd::DdType::Sylvan, double>(program, options);
+    EXPECT_EQ(8ul, model->getNumberOfStates());
+    EXPECT_EQ(expectedModel->getNumberOfStates(), model->getNumberOfStates());
+    EXPECT_EQ(expectedModel->getNumberOfTransitions(), model->getNumberOfTransitions());
+}
+
 bool trivial_true_mask(storm::expressions::SimpleValuation const&, uint64_t) {
     return true;
 }
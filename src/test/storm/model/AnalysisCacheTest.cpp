@@ -0,0 +1,44 @@
+#include "storm-config.h"
+#include "test/storm_gtest.h"
+
+#include "storm-parsers/parser/PrismParser.h"
+#include "storm/builder/ExplicitModelBuilder.h"
+#include "storm/models/sparse/Mdp.h"
+#include "storm/models/sparse/StandardRewardModel.h"
+#include "storm/storage/MaximalEndComponentDecomposition.h"
+#include "storm/utility/graph.h"
+
+TEST(AnalysisCacheTest, SharesAnalysesUntilModification) {
+    storm::prism::Program program = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR "/mdp/two_dice.nm");
+    std::shared_ptr<storm::models::sparse::Model<double>> model = storm::builder::ExplicitModelBuilder<double>(program).build();
+    auto const& constModel = *model;
+    auto& cache = constModel.getAnalysisCache();
+    auto const& matrix = constModel.getTransitionMatrix();
+
+    auto backwardTransitions = constModel.getCachedBackwardTransitions();
+    EXPECT_EQ(backwardTransitions, constModel.getCachedBackwardTransitions());
+    EXPECT_EQ(constModel.getBackwardTransitions(), *backwardTransitions);
+
+    storm::storage::BitVector phiStates(model->getNumberOfStates(), true);
+    storm::storage::BitVector const& psiStates = model->getStates("two");
+    auto expected = storm::utility::graph::performProb01Max(matrix, matrix.getRowGroupIndices(), *backwardTransitions, phiStates, psiStates);
+    auto result = cache.performProb01Max(matrix, *backwardTransitions, phiStates, psiStates);
+    EXPECT_EQ(expected.first, result.first);
+    EXPECT_EQ(expected.second, result.second);
+    result = cache.performProb01Max(matrix, *backwardTransitions, phiStates, psiStates);
+    EXPECT_EQ(expected.first, result.first);
+    EXPECT_EQ(expected.second, result.second);
+
+    auto mecs = cache.getMaximalEndComponents(matrix, *backwardTransitions, ~psiStates);
+    EXPECT_EQ(mecs, cache.getMaximalEndComponents(matrix, *backwardTransitions, ~psiStates));
+
+    // Analyses of other matrices are not cached.
+    storm::storage::SparseMatrix<double> copy = matrix;
+    EXPECT_NE(mecs, cache.getMaximalEndComponents(copy, *backwardTransitions, ~psiStates));
+    EXPECT_NE(cache.getBackwardTransitions(copy), cache.getBackwardTransitions(copy));
+
+    // Retrieving the matrix for modification invalidates the cache.
+    model->getTransitionMatrix();
+    EXPECT_NE(backwardTransitions, constModel.getCachedBackwardTransitions());
+    EXPECT_NE(mecs, cache.getMaximalEndComponents(matrix, *backwardTransitions, ~psiStates));
+}
@@ -31,3 +31,22 @@ TEST(StateLabelingTest, RemoveLabel) {
     EXPECT_EQ(1ul, labeling.getNumberOfLabels());
     EXPECT_TRUE(labeling.getStateHasLabel("test2", 5));
 }
+
+TEST(StateLabelingTest, CopyOnWrite) {
+    storm::models::sparse::StateLabeling labeling(10);
+    labeling.addLabel("test1", storm::storage::BitVector(10, {1, 4, 6, 7}));
+    labeling.addLabel("test2", storm::storage::BitVector(10, {2, 6}));
+
+    storm::models::sparse::StateLabeling copy(labeling);
+    EXPECT_EQ(&labeling.getStates("test1"), &copy.getStates("test1"));
+
+    copy.addLabelToState("test1", 5);
+    EXPECT_TRUE(copy.getStateHasLabel("test1", 5));
+    EXPECT_FALSE(labeling.getStateHasLabel("test1", 5));
+    EXPECT_NE(&labeling.getStates("test1"), &copy.getStates("test1"));
+    EXPECT_EQ(&labeling.getStates("test2"), &copy.getStates("test2"));
+
+    labeling.removeLabelFromState("test2", 6);
+    EXPECT_FALSE(labeling.getStateHasLabel("test2", 6));
+    EXPECT_TRUE(copy.getStateHasLabel("test2", 6));
+}
@@ -9,6 +9,8 @@
 #include "storm/environment/solver/EigenSolverEnvironment.h"
 #include "storm/environment/solver/GmmxxSolverEnvironment.h"
 #include "storm/environment/solver/NativeSolverEnvironment.h"
+#include "storm/environment/solver/TimeBoundedSolverEnvironment.h"
+#include "storm/exceptions/InvalidArgumentException.h"
 #include "storm/logic/Formulas.h"
 #include "storm/modelchecker/csl/HybridCtmcCslModelChecker.h"
 #include "storm/modelchecker/csl/SparseCtmcCslModelChecker.h"
@@ -161,6 +163,23 @@ class HybridSylvanGmmxxGmresEnvironment {
     }
 };
 
+class HybridSylvanSymbolicUniformizationEnvironment {
+   public:
+    static const storm::dd::DdType ddType = storm::dd::DdType::Sylvan;
+    static const CtmcEngine engine = CtmcEngine::PrismHybrid;
+    static const bool isExact = false;
+    typedef double ValueType;
+    typedef storm::models::symbolic::Ctmc<ddType, ValueType> ModelType;
+    static storm::Environment createEnvironment() {
+        storm::Environment env;
+        env.solver().setLinearEquationSolverType(storm::solver::EquationSolverType::Gmmxx);
+        env.solver().gmmxx().setMethod(storm::solver::GmmxxLinearEquationSolverMethod::Gmres);
+        env.solver().gmmxx().setPrecision(storm::utility::convertNumber<storm::RationalNumber>(1e-8));
+        env.solver().timeBounded().setCtmcMethod(storm::solver::CtmcTransientMethod::SymbolicUniformization);
+        return env;
+    }
+};
+
 template<typename TestType>
 class CtmcCslModelCheckerTest : public ::testing::Test {
    public:
@@ -279,7 +298,8 @@ class CtmcCslModelCheckerTest : public ::testing::Test {
 };
 
 typedef ::testing::Types<SparseGmmxxGmresIluEnvironment, JaniSparseGmmxxGmresIluEnvironment, SparseEigenDGmresEnvironment, SparseEigenDoubleLUEnvironment,
-                         SparseNativeSorEnvironment, HybridCuddGmmxxGmresEnvironment, JaniHybridCuddGmmxxGmresEnvironment, HybridSylvanGmmxxGmresEnvironment>
+                         SparseNativeSorEnvironment, HybridCuddGmmxxGmresEnvironment, JaniHybridCuddGmmxxGmresEnvironment, HybridSylvanGmmxxGmresEnvironment,
+                         HybridSylvanSymbolicUniformizationEnvironment>
     TestingTypes;
 
 TYPED_TEST_SUITE(CtmcCslModelCheckerTest, TestingTypes, );
@@ -435,6 +455,86 @@ TEST(CtmcCslModelCheckerTest, TransientProbabilities) {
     EXPECT_NEAR(0.595957, result[1], 1e-6);
 }
 
+TEST(CtmcCslModelCheckerTest, AdaptiveUniformization) {
+    // A stiff chain: the fast states 2 and 3 are only reached after leaving the slow states 0 and 1.
+    storm::storage::SparseMatrixBuilder<double> matrixBuilder;
+    matrixBuilder.addNextValue(0, 1, 0.5);
+    matrixBuilder.addNextValue(1, 0, 0.2);
+    matrixBuilder.addNextValue(1, 2, 0.1);
+    matrixBuilder.addNextValue(2, 3, 1000.0);
+    matrixBuilder.addNextValue(3, 2, 500.0);
+    matrixBuilder.addNextValue(3, 4, 2.0);
+    matrixBuilder.addNextValue(4, 4, 1.0);
+    storm::storage::SparseMatrix<double> matrix = matrixBuilder.build();
+    storm::storage::SparseMatrix<double> backwardTransitions = matrix.transpose(true);
+
+    std::vector<double> exitRates = {0.5, 0.3, 1000, 502, 1};
+    storm::storage::BitVector initialStates(5);
+    initialStates.set(0);
+    storm::storage::BitVector phiStates(5, true);
+    storm::storage::BitVector psiStates(5);
+    psiStates.set(4);
+
+    storm::Environment env;
+    storm::Environment adaptiveEnv;
+    adaptiveEnv.solver().timeBounded().setCtmcMethod(storm::solver::CtmcTransientMethod::AdaptiveUniformization);
+
+    std::vector<double> expected =
+        storm::modelchecker::helper::SparseCtmcCslHelper::computeAllTransientProbabilities(env, matrix, initialStates, phiStates, psiStates, exitRates, 2.0);
+    std::vector<double> result = storm::modelchecker::helper::SparseCtmcCslHelper::computeAllTransientProbabilities(adaptiveEnv, matrix, initialStates,
+                                                                                                                    phiStates, psiStates, exitRates, 2.0);
+    ASSERT_EQ(expected.size(), result.size());
+    for (uint64_t state = 0; state < expected.size(); ++state) {
+        EXPECT_NEAR(expected[state], result[state], 1e-6);
+    }
+
+    for (double timeBound : {0.0, 1.0, 5.0}) {
+        expected = storm::modelchecker::helper::SparseCtmcCslHelper::computeBoundedUntilProbabilities(
+            env, storm::solver::SolveGoal<double>(), matrix, backwardTransitions, phiStates, psiStates, exitRates, false, 0.0, timeBound);
+        result = storm::modelchecker::helper::SparseCtmcCslHelper::computeBoundedUntilProbabilities(
+            adaptiveEnv, storm::solver::SolveGoal<double>(storm::OptimizationDirection::Minimize, initialStates), matrix, backwardTransitions, phiStates,
+            psiStates, exitRates, false, 0.0, timeBound);
+        EXPECT_NEAR(expected[0], result[0], 1e-6);
+    }
+}
+
+TEST(CtmcCslModelCheckerTest, BoundedUntilMultipleTimeBounds) {
+    storm::storage::SparseMatrixBuilder<double> matrixBuilder;
+    matrixBuilder.addNextValue(0, 1, 3.0);
+    matrixBuilder.addNextValue(1, 0, 2.0);
+    matrixBuilder.addNextValue(1, 2, 1.0);
+    matrixBuilder.addNextValue(2, 2, 1.0);
+    storm::storage::SparseMatrix<double> matrix = matrixBuilder.build();
+    storm::storage::SparseMatrix<double> backwardTransitions = matrix.transpose(true);
+
+    std::vector<double> exitRates = {3, 3, 1};
+    storm::storage::BitVector phiStates(3, true);
+    storm::storage::BitVector psiStates(3);
+    psiStates.set(2);
+    storm::Environment env;
+    std::vector<double> timeBounds = {0.0, 0.5, 1.0, 2.5, 10.0};
+    std::vector<std::vector<double>> results = storm::modelchecker::helper::SparseCtmcCslHelper::computeBoundedUntilProbabilities(
+        env, storm::solver::SolveGoal<double>(), matrix, backwardTransitions, phiStates, psiStates, exitRates, false, timeBounds);
+
+    ASSERT_EQ(timeBounds.size(), results.size());
+    for (uint64_t boundIndex = 0; boundIndex < timeBounds.size(); ++boundIndex) {
+        std::vector<double> expected = storm::modelchecker::helper::SparseCtmcCslHelper::computeBoundedUntilProbabilities(
+            env, storm::solver::SolveGoal<double>(), matrix, backwardTransitions, phiStates, psiStates, exitRates, false, 0.0, timeBounds[boundIndex]);
+        ASSERT_EQ(expected.size(), results[boundIndex].size());
+        for (uint64_t state = 0; state < expected.size(); ++state) {
+            EXPECT_NEAR(expected[state], results[boundIndex][state], 1e-6);
+        }
+    }
+    EXPECT_EQ(0.0, results.front()[0]);
+    EXPECT_EQ(1.0, results.front()[2]);
+
+    std::vector<double> unsortedTimeBounds = {1.0, 0.5};
+    storm::solver::SolveGoal<double> goal;
+    STORM_SILENT_EXPECT_THROW(storm::modelchecker::helper::SparseCtmcCslHelper::computeBoundedUntilProbabilities(
+                                  env, std::move(goal), matrix, backwardTransitions, phiStates, psiStates, exitRates, false, unsortedTimeBounds),
+                              storm::exceptions::InvalidArgumentException);
+}
+
 TYPED_TEST(CtmcCslModelCheckerTest, LtlProbabilitiesEmbedded) {
 #ifdef STORM_HAVE_LTL_MODELCHECKING_SUPPORT
     std::string formulasString = "P=?  [ X F (!\"down\" U \"fail_sensors\") ]";
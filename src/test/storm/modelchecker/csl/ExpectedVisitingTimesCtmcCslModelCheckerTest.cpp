@@ -6,7 +6,9 @@
 #include "storm/environment/solver/EigenSolverEnvironment.h"
 #include "storm/environment/solver/GmmxxSolverEnvironment.h"
 #include "storm/environment/solver/NativeSolverEnvironment.h"
+#include "storm/environment/solver/TopologicalSolverEnvironment.h"
 #include "storm/modelchecker/csl/SparseCtmcCslModelChecker.h"
+#include "storm/modelchecker/helper/indefinitehorizon/visitingtimes/SparseDeterministicVisitingTimesHelper.h"
 #include "storm/modelchecker/results/ExplicitQuantitativeCheckResult.h"
 #include "storm/models/sparse/Ctmc.h"
 #include "storm/models/sparse/StandardRewardModel.h"
@@ -145,4 +147,44 @@ TYPED_TEST(ExpectedVisitingTimesCtmcCslModelCheckerTest, expvisittimestest) {
     EXPECT_EQ(sortedVector[9], storm::utility::infinity<ValueType>())
         << "Result of expected visiting times computation is " << storm::utility::vector::toString(resultVector) << '\n';
 }
+
+TYPED_TEST(ExpectedVisitingTimesCtmcCslModelCheckerTest, multipleDistributions) {
+    typedef typename TestFixture::ValueType ValueType;
+
+    auto model = this->buildJaniModel(STORM_TEST_RESOURCES_DIR "/ctmc/expvisittimes.jani");
+    ASSERT_EQ(model->getType(), storm::models::ModelType::Ctmc);
+    auto probabilisticTransitions = model->computeProbabilityMatrix();
+    uint64_t const numberOfStates = model->getNumberOfStates();
+
+    // One distribution for each (Dirac) initial state and a uniform distribution
+    std::vector<std::vector<ValueType>> distributions;
+    for (uint64_t state = 0; state < numberOfStates; ++state) {
+        distributions.emplace_back(numberOfStates, storm::utility::zero<ValueType>());
+        distributions.back()[state] = storm::utility::one<ValueType>();
+    }
+    distributions.emplace_back(numberOfStates, storm::utility::one<ValueType>() / storm::utility::convertNumber<ValueType, uint64_t>(numberOfStates));
+
+    auto topologicalEnv = this->env();
+    topologicalEnv.solver().topological().setUnderlyingEquationSolverType(topologicalEnv.solver().getLinearEquationSolverType());
+    topologicalEnv.solver().setLinearEquationSolverType(storm::solver::EquationSolverType::Topological);
+    topologicalEnv.solver().setUseIntelTbb(true);
+
+    for (auto const& env : {this->env(), topologicalEnv}) {
+        storm::modelchecker::helper::SparseDeterministicVisitingTimesHelper<ValueType> helper(probabilisticTransitions, model->getExitRateVector());
+        auto results = distributions;
+        helper.computeExpectedVisitingTimes(env, results);
+        ASSERT_EQ(distributions.size(), results.size());
+        for (uint64_t i = 0; i < distributions.size(); ++i) {
+            auto expected = distributions[i];
+            helper.computeExpectedVisitingTimes(env, expected);
+            for (uint64_t state = 0; state < numberOfStates; ++state) {
+                if (storm::utility::isInfinity(expected[state])) {
+                    EXPECT_TRUE(storm::utility::isInfinity(results[i][state])) << "Distribution " << i << ", state " << state;
+                } else {
+                    EXPECT_NEAR(expected[state], results[i][state], this->precision()) << "Distribution " << i << ", state " << state;
+                }
+            }
+        }
+    }
+}
 }  // namespace
@@ -44,6 +44,21 @@ class SparseDoubleValueIterationEnvironment {
         return env;
     }
 };
+class SparseDoubleValueIterationParallelEnvironment {
+   public:
+    static const storm::dd::DdType ddType = storm::dd::DdType::Sylvan;  // Unused for sparse models
+    static const MaEngine engine = MaEngine::PrismSparse;
+    static const bool isExact = false;
+    typedef double ValueType;
+    typedef storm::models::sparse::MarkovAutomaton<ValueType> ModelType;
+    static storm::Environment createEnvironment() {
+        storm::Environment env;
+        env.solver().minMax().setMethod(storm::solver::MinMaxMethod::ValueIteration, true);
+        env.solver().minMax().setPrecision(storm::utility::convertNumber<storm::RationalNumber>(1e-10));
+        env.solver().setUseIntelTbb(true);
+        return env;
+    }
+};
 class JaniSparseDoubleValueIterationEnvironment {
    public:
     static const storm::dd::DdType ddType = storm::dd::DdType::Sylvan;  // Unused for sparse models
@@ -226,8 +241,9 @@ class MarkovAutomatonCslModelCheckerTest : public ::testing::Test {
     }
 };
 
-typedef ::testing::Types<SparseDoubleValueIterationEnvironment, JaniSparseDoubleValueIterationEnvironment, JaniHybridDoubleValueIterationEnvironment,
-                         SparseDoubleIntervalIterationEnvironment, SparseRationalPolicyIterationEnvironment, SparseRationalRationalSearchEnvironment>
+typedef ::testing::Types<SparseDoubleValueIterationEnvironment, SparseDoubleValueIterationParallelEnvironment, JaniSparseDoubleValueIterationEnvironment,
+                         JaniHybridDoubleValueIterationEnvironment, SparseDoubleIntervalIterationEnvironment, SparseRationalPolicyIterationEnvironment,
+                         SparseRationalRationalSearchEnvironment>
     TestingTypes;
 
 TYPED_TEST_SUITE(MarkovAutomatonCslModelCheckerTest, TestingTypes, );
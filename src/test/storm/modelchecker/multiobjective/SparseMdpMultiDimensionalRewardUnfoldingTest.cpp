@@ -5,6 +5,7 @@
 #include "storm/api/storm.h"
 #include "storm/environment/Environment.h"
 #include "storm/environment/solver/MinMaxSolverEnvironment.h"
+#include "storm/environment/solver/SolverEnvironment.h"
 #include "storm/modelchecker/multiobjective/multiObjectiveModelChecking.h"
 #include "storm/modelchecker/results/ExplicitParetoCurveCheckResult.h"
 #include "storm/modelchecker/results/ExplicitQualitativeCheckResult.h"
@@ -100,6 +101,43 @@ TEST(SparseMdpMultiDimensionalRewardUnfoldingTest, single_obj_one_dim_walk_large
     EXPECT_EQ(expectedResult, result->asExplicitQuantitativeCheckResult<storm::RationalNumber>()[initState]);
 }
 
+TEST(SparseMdpMultiDimensionalRewardUnfoldingTest, single_obj_one_dim_walk_large_parallel) {
+#ifndef STORM_HAVE_INTELTBB
+    GTEST_SKIP() << "Intel TBB not available.";
+#endif
+    storm::Environment env;
+    env.solver().setUseIntelTbb(true);
+
+    std::string programFile = STORM_TEST_RESOURCES_DIR "/mdp/one_dim_walk.nm";
+    std::string constantsDef = "N=10";
+    std::string formulasAsString = "Pmax=? [ F{\"r\"}<=5 x=N ] ";
+    formulasAsString += "; \n Pmin=? [ F{\"r\"}<=5,{\"l\"}<=3 x=N ] ";
+
+    // programm, model,  formula
+    storm::prism::Program program = storm::api::parseProgram(programFile);
+    program = storm::utility::prism::preprocess(program, constantsDef);
+    std::vector<std::shared_ptr<storm::logic::Formula const>> formulas =
+        storm::api::extractFormulasFromProperties(storm::api::parsePropertiesForPrismProgram(formulasAsString, program));
+    std::shared_ptr<storm::models::sparse::Mdp<storm::RationalNumber>> mdp =
+        storm::api::buildSparseModel<storm::RationalNumber>(program, formulas)->as<storm::models::sparse::Mdp<storm::RationalNumber>>();
+    uint_fast64_t const initState = *mdp->getInitialStates().begin();
+
+    // Analyzing independent epochs in parallel has to yield the same results as the sequential analysis.
+    for (auto const& formula : formulas) {
+        auto task = storm::api::createTask<storm::RationalNumber>(formula, true);
+        std::unique_ptr<storm::modelchecker::CheckResult> sequentialResult = storm::api::verifyWithSparseEngine(mdp, task);
+        std::unique_ptr<storm::modelchecker::CheckResult> parallelResult = storm::api::verifyWithSparseEngine(env, mdp, task);
+        ASSERT_TRUE(sequentialResult->isExplicitQuantitativeCheckResult());
+        ASSERT_TRUE(parallelResult->isExplicitQuantitativeCheckResult());
+        EXPECT_EQ(sequentialResult->asExplicitQuantitativeCheckResult<storm::RationalNumber>()[initState],
+                  parallelResult->asExplicitQuantitativeCheckResult<storm::RationalNumber>()[initState]);
+    }
+    std::unique_ptr<storm::modelchecker::CheckResult> result =
+        storm::api::verifyWithSparseEngine(env, mdp, storm::api::createTask<storm::RationalNumber>(formulas[0], true));
+    storm::RationalNumber expectedResult = storm::utility::pow(storm::utility::convertNumber<storm::RationalNumber>(0.5), 5);
+    EXPECT_EQ(expectedResult, result->asExplicitQuantitativeCheckResult<storm::RationalNumber>()[initState]);
+}
+
 TEST(SparseMdpMultiDimensionalRewardUnfoldingTest, single_obj_tiny_ec) {
     storm::Environment env;
 
@@ -8,11 +8,14 @@
 #include "storm-parsers/parser/PrismParser.h"
 #include "storm/api/builder.h"
 #include "storm/api/properties.h"
+#include "storm/environment/modelchecker/ModelCheckerEnvironment.h"
 #include "storm/environment/solver/EigenSolverEnvironment.h"
 #include "storm/environment/solver/GmmxxSolverEnvironment.h"
 #include "storm/environment/solver/NativeSolverEnvironment.h"
 #include "storm/environment/solver/TopologicalSolverEnvironment.h"
+#include "storm/exceptions/InvalidArgumentException.h"
 #include "storm/logic/Formulas.h"
+#include "storm/modelchecker/helper/finitehorizon/SparseDeterministicStepBoundedHorizonHelper.h"
 #include "storm/modelchecker/prctl/HybridDtmcPrctlModelChecker.h"
 #include "storm/modelchecker/prctl/SparseDtmcPrctlModelChecker.h"
 #include "storm/modelchecker/prctl/SymbolicDtmcPrctlModelChecker.h"
@@ -310,6 +313,43 @@ class SparseTopologicalEigenLUEnvironment {
     }
 };
 
+class SparseTopologicalEigenLUParallelEnvironment {
+   public:
+    static const storm::dd::DdType ddType = storm::dd::DdType::Sylvan;  // unused for sparse models
+    static const DtmcEngine engine = DtmcEngine::PrismSparse;
+    static const bool isExact = true;
+    typedef storm::RationalNumber ValueType;
+    typedef storm::models::sparse::Dtmc<ValueType> ModelType;
+    static storm::Environment createEnvironment() {
+        storm::Environment env;
+        env.solver().setLinearEquationSolverType(storm::solver::EquationSolverType::Topological);
+        env.solver().topological().setUnderlyingEquationSolverType(storm::solver::EquationSolverType::Eigen);
+        env.solver().eigen().setMethod(storm::solver::EigenLinearEquationSolverMethod::SparseLU);
+        env.solver().setUseIntelTbb(true);
+        return env;
+    }
+};
+
+class SparseTopologicalDirectSccEnvironment {
+   public:
+    static const storm::dd::DdType ddType = storm::dd::DdType::Sylvan;  // unused for sparse models
+    static const DtmcEngine engine = DtmcEngine::PrismSparse;
+    static const bool isExact = false;
+    typedef double ValueType;
+    typedef storm::models::sparse::Dtmc<ValueType> ModelType;
+    static storm::Environment createEnvironment() {
+        storm::Environment env;
+        env.solver().setLinearEquationSolverType(storm::solver::EquationSolverType::Topological);
+        env.solver().topological().setUnderlyingEquationSolverType(storm::solver::EquationSolverType::Native);
+        env.solver().native().setMethod(storm::solver::NativeLinearEquationSolverMethod::Jacobi);
+        env.solver().native().setPrecision(storm::utility::convertNumber<storm::RationalNumber>(1e-8));
+        env.solver().topological().setDirectSolveSccSizeRange(std::pair<uint64_t, uint64_t>(2, 1000));
+        env.solver().topological().setDenseSolveMaxSccSize(0);
+        env.solver().eigen().setOrdering(storm::solver::EigenLinearEquationSolverOrdering::Amd);
+        return env;
+    }
+};
+
 class HybridSylvanGmmxxGmresEnvironment {
    public:
     static const storm::dd::DdType ddType = storm::dd::DdType::Sylvan;
@@ -342,6 +382,23 @@ class HybridCuddNativeJacobiEnvironment {
     }
 };
 
+class HybridCuddNativeJacobiSccEnvironment {
+   public:
+    static const storm::dd::DdType ddType = storm::dd::DdType::CUDD;
+    static const DtmcEngine engine = DtmcEngine::Hybrid;
+    static const bool isExact = false;
+    typedef double ValueType;
+    typedef storm::models::symbolic::Dtmc<ddType, ValueType> ModelType;
+    static storm::Environment createEnvironment() {
+        storm::Environment env;
+        env.modelchecker().setHybridSccSolving(true);
+        env.solver().setLinearEquationSolverType(storm::solver::EquationSolverType::Native);
+        env.solver().native().setMethod(storm::solver::NativeLinearEquationSolverMethod::Jacobi);
+        env.solver().native().setPrecision(storm::utility::convertNumber<storm::RationalNumber>(1e-8));
+        return env;
+    }
+};
+
 class HybridCuddNativeSoundValueIterationEnvironment {
    public:
     static const storm::dd::DdType ddType = storm::dd::DdType::CUDD;
@@ -557,9 +614,11 @@ typedef ::testing::Types<SparseGmmxxGmresIluEnvironment, JaniSparseGmmxxGmresIlu
                          SparseEigenDGmresEnvironment, SparseEigenDoubleLUEnvironment, SparseEigenRationalLUEnvironment, SparseRationalEliminationEnvironment,
                          SparseNativeJacobiEnvironment, SparseNativeWalkerChaeEnvironment, SparseNativeSorEnvironment, SparseNativePowerEnvironment,
                          SparseNativeSoundValueIterationEnvironment, SparseNativeOptimisticValueIterationEnvironment, SparseNativeIntervalIterationEnvironment,
-                         SparseNativeRationalSearchEnvironment, SparseTopologicalEigenLUEnvironment, HybridSylvanGmmxxGmresEnvironment,
-                         HybridCuddNativeJacobiEnvironment, HybridCuddNativeSoundValueIterationEnvironment, HybridSylvanNativeRationalSearchEnvironment,
-                         DdSylvanNativePowerEnvironment, JaniDdSylvanNativePowerEnvironment, DdCuddNativeJacobiEnvironment, DdSylvanRationalSearchEnvironment>
+                         SparseNativeRationalSearchEnvironment, SparseTopologicalEigenLUEnvironment, SparseTopologicalEigenLUParallelEnvironment,
+                         SparseTopologicalDirectSccEnvironment,
+                         HybridSylvanGmmxxGmresEnvironment, HybridCuddNativeJacobiEnvironment, HybridCuddNativeJacobiSccEnvironment,
+                         HybridCuddNativeSoundValueIterationEnvironment, HybridSylvanNativeRationalSearchEnvironment, DdSylvanNativePowerEnvironment, JaniDdSylvanNativePowerEnvironment,
+                         DdCuddNativeJacobiEnvironment, DdSylvanRationalSearchEnvironment>
     TestingTypes;
 
 TYPED_TEST_SUITE(DtmcPrctlModelCheckerTest, TestingTypes, );
@@ -695,6 +754,49 @@ TEST(DtmcPrctlModelCheckerTest, AllUntilProbabilities) {
     EXPECT_NEAR(0, result[12], 1e-6);
 }
 
+TEST(DtmcPrctlModelCheckerTest, StepBoundedUntilProbabilitiesForAllStepBounds) {
+    storm::prism::Program program = storm::api::parseProgram(STORM_TEST_RESOURCES_DIR "/dtmc/die.pm");
+    auto formulas = storm::api::extractFormulasFromProperties(storm::api::parsePropertiesForPrismProgram("P=? [F<=10 \"done\"]", program));
+    auto model = storm::api::buildSparseModel<double>(program, formulas)->template as<storm::models::sparse::Dtmc<double>>();
+    EXPECT_EQ(13ul, model->getNumberOfStates());
+
+    storm::storage::BitVector phiStates(13, true);
+    storm::storage::BitVector psiStates(13);
+    for (uint64_t state = 7; state < 13; ++state) {
+        psiStates.set(state);
+    }
+    storm::Environment env;
+    storm::modelchecker::helper::SparseDeterministicStepBoundedHorizonHelper<double> helper;
+    auto allResults = helper.computeForAllStepBounds(env, storm::solver::SolveGoal<double>(storm::OptimizationDirection::Maximize),
+                                                     model->getTransitionMatrix(), model->getBackwardTransitions(), phiStates, psiStates, 10);
+    ASSERT_EQ(11ul, allResults.getNumberOfStepBounds());
+    EXPECT_NEAR(0.0, allResults.getValue(2, 0), 1e-6);
+    EXPECT_NEAR(0.75, allResults.getValue(3, 0), 1e-6);
+    EXPECT_NEAR(1.0, allResults.getValue(0, 7), 1e-6);
+    for (uint64_t stepBound = 0; stepBound <= 10; ++stepBound) {
+        std::vector<double> expected =
+            helper.compute(env, storm::solver::SolveGoal<double>(storm::OptimizationDirection::Maximize), model->getTransitionMatrix(),
+                           model->getBackwardTransitions(), phiStates, psiStates, 0, stepBound);
+        std::vector<double> values = allResults.getValues(stepBound);
+        ASSERT_EQ(expected.size(), values.size());
+        for (uint64_t state = 0; state < values.size(); ++state) {
+            EXPECT_NEAR(expected[state], values[state], 1e-6) << "for state " << state << " and step bound " << stepBound;
+        }
+    }
+
+    // Only keep the values of the initial state
+    storm::storage::BitVector relevantStates(13);
+    relevantStates.set(0);
+    auto initialStateResults =
+        helper.computeForAllStepBounds(env, storm::solver::SolveGoal<double>(storm::OptimizationDirection::Maximize, relevantStates),
+                                       model->getTransitionMatrix(), model->getBackwardTransitions(), phiStates, psiStates, 10);
+    for (uint64_t stepBound = 0; stepBound <= 10; ++stepBound) {
+        EXPECT_NEAR(allResults.getValue(stepBound, 0), initialStateResults.getValue(stepBound, 0), 1e-6);
+    }
+    STORM_SILENT_EXPECT_THROW(initialStateResults.getValue(3, 1), storm::exceptions::InvalidArgumentException);
+    STORM_SILENT_EXPECT_THROW(initialStateResults.getValue(11, 0), storm::exceptions::InvalidArgumentException);
+}
+
 TYPED_TEST(DtmcPrctlModelCheckerTest, LtlProbabilitiesDie) {
 #ifdef STORM_HAVE_LTL_MODELCHECKING_SUPPORT
     std::string formulasString = "P=? [(X s>0) U (s=7 & d=2)]";
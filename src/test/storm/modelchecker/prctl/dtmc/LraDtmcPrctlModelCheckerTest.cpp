@@ -155,6 +155,29 @@ class ValueIterationEnvironment {
     }
 };
 
+class DenseBsccDoubleEnvironment {
+   public:
+    typedef double ValueType;
+    static const bool isExact = false;
+    static storm::Environment createEnvironment() {
+        storm::Environment env;
+        env.solver().lra().setDenseBsccSizeThreshold(100);
+        env.solver().setUseIntelTbb(true);
+        return env;
+    }
+};
+
+class DenseBsccRationalEnvironment {
+   public:
+    typedef storm::RationalNumber ValueType;
+    static const bool isExact = true;
+    static storm::Environment createEnvironment() {
+        storm::Environment env;
+        env.solver().lra().setDenseBsccSizeThreshold(100);
+        return env;
+    }
+};
+
 template<typename TestType>
 class LraDtmcPrctlModelCheckerTest : public ::testing::Test {
    public:
@@ -176,7 +199,7 @@ class LraDtmcPrctlModelCheckerTest : public ::testing::Test {
 
 typedef ::testing::Types<GBGmmxxDoubleGmresEnvironment, GBEigenDoubleDGmresEnvironment, GBEigenRationalLUEnvironment, GBNativeSorEnvironment,
                          GBNativeWalkerChaeEnvironment, DistrGmmxxDoubleGmresEnvironment, DistrEigenRationalLUEnvironment, DistrNativeWalkerChaeEnvironment,
-                         ValueIterationEnvironment>
+                         ValueIterationEnvironment, DenseBsccDoubleEnvironment, DenseBsccRationalEnvironment>
     TestingTypes;
 
 TYPED_TEST_SUITE(LraDtmcPrctlModelCheckerTest, TestingTypes, );
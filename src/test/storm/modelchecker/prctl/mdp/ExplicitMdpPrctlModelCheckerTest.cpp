@@ -8,7 +8,9 @@
 #include "storm/models/sparse/StandardRewardModel.h"
 #include "storm/solver/StandardMinMaxLinearEquationSolver.h"
 
+#include "storm/environment/modelchecker/ModelCheckerEnvironment.h"
 #include "storm/environment/solver/MinMaxSolverEnvironment.h"
+#include "storm/environment/solver/SolverEnvironment.h"
 
 #include "storm-parsers/parser/AutoParser.h"
 #include "storm-parsers/parser/PrismParser.h"
@@ -202,3 +204,28 @@ TEST(ExplicitMdpPrctlModelCheckerTest, AsynchronousLeader) {
 
     EXPECT_NEAR(30.0 / 7.0, quantitativeResult6[0], precision);
 }
+
+TEST(ExplicitMdpPrctlModelCheckerTest, DeadlineYieldsApproximation) {
+    std::shared_ptr<storm::models::sparse::Model<double>> abstractModel =
+        storm::parser::AutoParser<>::parseModel(STORM_TEST_RESOURCES_DIR "/tra/two_dice.tra", STORM_TEST_RESOURCES_DIR "/lab/two_dice.lab");
+    std::shared_ptr<storm::models::sparse::Mdp<double>> mdp = abstractModel->as<storm::models::sparse::Mdp<double>>();
+    storm::modelchecker::SparseMdpPrctlModelChecker<storm::models::sparse::Mdp<double>> checker(*mdp);
+    std::shared_ptr<storm::logic::Formula const> formula = storm::parser::FormulaParser().parseSingleFormulaFromString("Pmax=? [F \"two\"]");
+
+    storm::Environment env;
+    env.solver().setForceSoundness(true);
+    env.solver().minMax().setMethod(storm::solver::MinMaxMethod::IntervalIteration);
+    std::unique_ptr<storm::modelchecker::CheckResult> result = checker.check(env, *formula);
+    EXPECT_FALSE(result->asExplicitQuantitativeCheckResult<double>().isApproximate());
+
+    // With a deadline that has already passed, interval iteration is stopped right away but still yields sound bounds.
+    env.modelchecker().setDeadline(std::chrono::steady_clock::now());
+    result = checker.check(env, *formula);
+    auto const& quantitativeResult = result->asExplicitQuantitativeCheckResult<double>();
+    EXPECT_TRUE(quantitativeResult.isApproximate());
+    ASSERT_TRUE(quantitativeResult.hasErrorBound());
+    EXPECT_LE(std::abs(1.0 / 36.0 - quantitativeResult[0]), quantitativeResult.getErrorBound());
+    std::stringstream stream;
+    stream << quantitativeResult;
+    EXPECT_NE(std::string::npos, stream.str().find("(approximate, error at most"));
+}
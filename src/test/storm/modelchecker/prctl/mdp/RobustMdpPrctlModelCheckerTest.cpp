@@ -8,6 +8,7 @@
 #include "storm/api/properties.h"
 #include "storm/api/verification.h"
 #include "storm/environment/solver/MinMaxSolverEnvironment.h"
+#include "storm/environment/solver/SolverEnvironment.h"
 #include "storm/modelchecker/prctl/SparseMdpPrctlModelChecker.h"
 #include "storm/modelchecker/results/ExplicitQualitativeCheckResult.h"
 #include "storm/modelchecker/results/ExplicitQuantitativeCheckResult.h"
@@ -143,3 +144,31 @@ TEST(RobustMDPModelCheckingTest, AddUncertaintyCoin22max) {
     makeUncertainAndCheck(STORM_TEST_RESOURCES_DIR "/mdp/coin2-2.nm", "Pmax=? [F \"all_coins_equal_1\"]", 0.1);
     makeUncertainAndCheck(STORM_TEST_RESOURCES_DIR "/mdp/coin2-2.nm", "Pmax=? [F \"all_coins_equal_1\"]", 0.2);
 }
+
+TEST(RobustMDPModelCheckingTest, AddUncertaintyCoin22Parallel) {
+    storm::prism::Program program = storm::api::parseProgram(STORM_TEST_RESOURCES_DIR "/mdp/coin2-2.nm");
+    program = storm::utility::prism::preprocess(program, "");
+    std::vector<std::shared_ptr<storm::logic::Formula const>> formulas =
+        storm::api::extractFormulasFromProperties(storm::api::parsePropertiesForPrismProgram("Pmax=? [F \"all_coins_equal_1\"]", program));
+    std::shared_ptr<storm::models::sparse::Model<double>> modelPtr = storm::api::buildSparseModel<double>(program, formulas);
+    auto imdp = storm::transformer::AddUncertainty(modelPtr).transform(0.1)->as<storm::models::sparse::Mdp<storm::Interval>>();
+    auto ichecker = storm::modelchecker::SparseMdpPrctlModelChecker<storm::models::sparse::Mdp<storm::Interval>>(*imdp);
+    auto task = storm::modelchecker::CheckTask<storm::logic::Formula, double>(*formulas[0]);
+
+    // Applying the operator in parallel yields the same values as the sequential application.
+    storm::Environment env;
+    env.solver().minMax().setMethod(storm::solver::MinMaxMethod::ValueIteration);
+    storm::Environment parallelEnv(env);
+    parallelEnv.solver().setUseIntelTbb(true);
+    for (bool robust : {true, false}) {
+        task.setRobustUncertainty(robust);
+        auto result = ichecker.check(env, task);
+        auto parallelResult = ichecker.check(parallelEnv, task);
+        auto const& values = result->asExplicitQuantitativeCheckResult<double>().getValueVector();
+        auto const& parallelValues = parallelResult->asExplicitQuantitativeCheckResult<double>().getValueVector();
+        ASSERT_EQ(values.size(), parallelValues.size());
+        for (uint64_t state = 0; state < values.size(); ++state) {
+            EXPECT_NEAR(values[state], parallelValues[state], 1e-6);
+        }
+    }
+}
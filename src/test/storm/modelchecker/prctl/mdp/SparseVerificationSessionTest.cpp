@@ -0,0 +1,49 @@
+#include "storm-config.h"
+#include "test/storm_gtest.h"
+
+#include <future>
+
+#include "storm-parsers/parser/AutoParser.h"
+#include "storm-parsers/parser/FormulaParser.h"
+#include "storm/api/verification.h"
+#include "storm/modelchecker/results/ExplicitQuantitativeCheckResult.h"
+
+namespace {
+
+TEST(SparseVerificationSessionTest, Dice) {
+    std::shared_ptr<storm::models::sparse::Model<double>> model =
+        storm::parser::AutoParser<>::parseModel(STORM_TEST_RESOURCES_DIR "/tra/two_dice.tra", STORM_TEST_RESOURCES_DIR "/lab/two_dice.lab", "",
+                                                STORM_TEST_RESOURCES_DIR "/rew/two_dice.flip.trans.rew");
+    ASSERT_EQ(model->getType(), storm::models::ModelType::Mdp);
+    storm::Environment env;
+    env.solver().minMax().setPrecision(storm::utility::convertNumber<storm::RationalNumber>(1e-8));
+    double const precision = 1e-6;
+
+    storm::parser::FormulaParser formulaParser;
+    std::vector<std::shared_ptr<storm::logic::Formula const>> formulas;
+    formulas.push_back(formulaParser.parseSingleFormulaFromString("Pmin=? [F \"two\"]"));
+    formulas.push_back(formulaParser.parseSingleFormulaFromString("Pmax=? [F \"two\"]"));
+    formulas.push_back(formulaParser.parseSingleFormulaFromString("Pmin=? [F \"three\"]"));
+    formulas.push_back(formulaParser.parseSingleFormulaFromString("Rmin=? [F \"done\"]"));
+    std::vector<double> expected = {1.0 / 36.0, 1.0 / 36.0, 2.0 / 36.0, 22.0 / 3.0};
+
+    storm::api::SparseVerificationSession<double> session(model, env);
+    for (uint64_t i = 0; i < formulas.size(); ++i) {
+        auto result = session.check(formulas[i]);
+        ASSERT_TRUE(result != nullptr);
+        EXPECT_NEAR(expected[i], result->asExplicitQuantitativeCheckResult<double>()[0], precision);
+    }
+
+    // Check the same formulas concurrently
+    std::vector<std::future<std::unique_ptr<storm::modelchecker::CheckResult>>> futures;
+    for (auto const& formula : formulas) {
+        futures.push_back(std::async(std::launch::async, [&session, formula]() { return session.check(formula); }));
+    }
+    for (uint64_t i = 0; i < formulas.size(); ++i) {
+        auto result = futures[i].get();
+        ASSERT_TRUE(result != nullptr);
+        EXPECT_NEAR(expected[i], result->asExplicitQuantitativeCheckResult<double>()[0], precision);
+    }
+}
+
+}  // namespace
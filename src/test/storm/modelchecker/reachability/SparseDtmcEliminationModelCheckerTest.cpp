@@ -107,6 +107,22 @@ TEST(SparseDtmcEliminationModelCheckerTest, Crowds) {
     storm::modelchecker::ExplicitQuantitativeCheckResult<double>& quantitativeResult5 = result->asExplicitQuantitativeCheckResult<double>();
 
     EXPECT_NEAR(0.96592521978041668, quantitativeResult5[0], storm::settings::getModule<storm::settings::modules::GeneralSettings>().getPrecision());
+
+    formula = formulaParser.parseSingleFormulaFromString("P=? [F \"observeIGreater1\" || F \"observe0Greater1\"]");
+
+    result = checker.check(storm::modelchecker::CheckTask<storm::logic::Formula>(*formula).setOnlyInitialStatesRelevant(true));
+    double const quantitativeResult6 = result->asExplicitQuantitativeCheckResult<double>()[0];
+
+    // Check all targets for the same condition at once.
+    std::vector<storm::storage::BitVector> targetStates = {dtmc->getStates("observeOnlyTrueSender"), dtmc->getStates("observe0Greater1"),
+                                                           dtmc->getStates("observeIGreater1")};
+    std::vector<double> batchResult =
+        storm::modelchecker::SparseDtmcEliminationModelChecker<storm::models::sparse::Dtmc<double>>::computeConditionalProbabilities(
+            dtmc->getTransitionMatrix(), dtmc->getBackwardTransitions(), dtmc->getInitialStates(), targetStates, dtmc->getStates("observe0Greater1"));
+    ASSERT_EQ(3ull, batchResult.size());
+    EXPECT_NEAR(0.96592521978041668, batchResult[0], storm::settings::getModule<storm::settings::modules::GeneralSettings>().getPrecision());
+    EXPECT_NEAR(1.0, batchResult[1], storm::settings::getModule<storm::settings::modules::GeneralSettings>().getPrecision());
+    EXPECT_NEAR(quantitativeResult6, batchResult[2], storm::settings::getModule<storm::settings::modules::GeneralSettings>().getPrecision());
 }
 
 TEST(SparseDtmcEliminationModelCheckerTest, SynchronousLeader) {
@@ -0,0 +1,75 @@
+#include "storm-config.h"
+#include "test/storm_gtest.h"
+
+#include "storm-parsers/parser/FormulaParser.h"
+#include "storm-parsers/parser/PrismParser.h"
+#include "storm/logic/Formulas.h"
+#include "storm/modelchecker/results/ExplicitQualitativeCheckResult.h"
+#include "storm/modelchecker/results/ExplicitQuantitativeCheckResult.h"
+#include "storm/modelchecker/smc/StatisticalModelChecker.h"
+#include "storm/models/sparse/Dtmc.h"
+#include "storm/models/sparse/StandardRewardModel.h"
+
+namespace {
+typedef storm::modelchecker::StatisticalModelChecker<storm::models::sparse::Dtmc<double>> StatisticalModelChecker;
+
+std::unique_ptr<storm::modelchecker::CheckResult> check(StatisticalModelChecker& checker, std::string const& formulaString) {
+    storm::parser::FormulaParser formulaParser;
+    std::shared_ptr<storm::logic::Formula const> formula = formulaParser.parseSingleFormulaFromString(formulaString);
+    storm::modelchecker::CheckTask<> task(*formula, true);
+    EXPECT_TRUE(checker.canHandle(task));
+    return checker.check(task);
+}
+}  // namespace
+
+TEST(StatisticalModelCheckerTest, Die) {
+    storm::prism::Program program = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR "/dtmc/die.pm");
+    StatisticalModelChecker::Options options;
+    options.numberOfThreads = 2;
+    options.confidence = 0.99;
+    options.precision = 0.02;
+    StatisticalModelChecker checker(program, options);
+
+    auto result = check(checker, "P=? [F<=3 \"one\"]");
+    auto const& quantitativeResult1 = result->asExplicitQuantitativeCheckResult<double>();
+    EXPECT_NEAR(0.125, quantitativeResult1[0], options.precision);
+    EXPECT_TRUE(quantitativeResult1.hasErrorBound());
+    EXPECT_NEAR(options.precision, quantitativeResult1.getErrorBound(), 1e-4);
+
+    result = check(checker, "P=? [!\"two\" U<=100 \"one\"]");
+    EXPECT_NEAR(1.0 / 6.0, result->asExplicitQuantitativeCheckResult<double>()[0], options.precision);
+
+    result = check(checker, "R{\"coin_flips\"}=? [C<=100]");
+    EXPECT_NEAR(11.0 / 3.0, result->asExplicitQuantitativeCheckResult<double>()[0], 2 * options.precision);
+
+    result = check(checker, "R{\"coin_flips\"}=? [I=2]");
+    EXPECT_EQ(0.0, result->asExplicitQuantitativeCheckResult<double>()[0]);
+
+    // Bounds are decided with a hypothesis test.
+    result = check(checker, "P>=0.1 [F<=3 \"one\"]");
+    EXPECT_TRUE(result->asExplicitQualitativeCheckResult()[0]);
+    result = check(checker, "P>0.15 [F<=3 \"one\"]");
+    EXPECT_FALSE(result->asExplicitQualitativeCheckResult()[0]);
+
+    // Unbounded properties are not supported.
+    storm::parser::FormulaParser formulaParser;
+    auto formula = formulaParser.parseSingleFormulaFromString("P=? [F \"one\"]");
+    EXPECT_FALSE(checker.canHandle(storm::modelchecker::CheckTask<>(*formula, true)));
+}
+
+TEST(StatisticalModelCheckerTest, Reproducible) {
+    storm::prism::Program program = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR "/dtmc/die.pm");
+    StatisticalModelChecker::Options options;
+    options.precision = 0.05;
+    options.batchSize = 100;
+    StatisticalModelChecker sequentialChecker(program, options);
+    options.numberOfThreads = 3;
+    StatisticalModelChecker parallelChecker(program, options);
+
+    // The result only depends on the seed, not on the number of threads.
+    for (std::string const& formulaString : {"P=? [F<=10 \"two\"]", "R{\"coin_flips\"}=? [C<=5]"}) {
+        auto sequentialResult = check(sequentialChecker, formulaString);
+        auto parallelResult = check(parallelChecker, formulaString);
+        EXPECT_EQ(sequentialResult->asExplicitQuantitativeCheckResult<double>()[0], parallelResult->asExplicitQuantitativeCheckResult<double>()[0]);
+    }
+}
@@ -0,0 +1,159 @@
+#include "storm-config.h"
+#include "test/storm_gtest.h"
+
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <sstream>
+
+#include "storm-parsers/api/explicit_models.h"
+#include "storm-parsers/parser/BinaryEncodingParser.h"
+#include "storm-parsers/parser/DirectEncodingParser.h"
+#include "storm-parsers/parser/PrismParser.h"
+#include "storm/api/builder.h"
+#include "storm/api/export.h"
+#include "storm/models/sparse/Ctmc.h"
+#include "storm/models/sparse/MarkovAutomaton.h"
+#include "storm/models/sparse/StandardRewardModel.h"
+#include "storm/storage/expressions/ExpressionManager.h"
+
+namespace {
+
+// Export the given DRN file in binary encoding, load it again and compare both models
+void checkRoundTrip(std::string const& drnFile, bool buildChoiceLabeling = false) {
+    storm::parser::DirectEncodingParserOptions options;
+    options.buildChoiceLabeling = buildChoiceLabeling;
+    std::shared_ptr<storm::models::sparse::Model<double>> original = storm::parser::DirectEncodingParser<double>::parseModel(drnFile, options);
+
+    std::string binaryFile = (std::filesystem::temp_directory_path() / "storm_binary_encoding_test.drnb").string();
+    storm::api::exportSparseModelAsDrnb(original, binaryFile);
+    EXPECT_TRUE(storm::parser::BinaryEncodingParser::isBinaryEncoding(binaryFile));
+    EXPECT_FALSE(storm::parser::BinaryEncodingParser::isBinaryEncoding(drnFile));
+    // Loading via the DRN api detects the binary encoding
+    std::shared_ptr<storm::models::sparse::Model<double>> loaded = storm::api::buildExplicitDRNModel<double>(binaryFile);
+    std::remove(binaryFile.c_str());
+
+    ASSERT_EQ(original->getType(), loaded->getType());
+    EXPECT_EQ(original->getTransitionMatrix(), loaded->getTransitionMatrix());
+    EXPECT_EQ(original->getStateLabeling(), loaded->getStateLabeling());
+    EXPECT_EQ(original->hasChoiceLabeling(), loaded->hasChoiceLabeling());
+    if (original->hasChoiceLabeling()) {
+        EXPECT_EQ(original->getChoiceLabeling(), loaded->getChoiceLabeling());
+    }
+    ASSERT_EQ(original->getNumberOfRewardModels(), loaded->getNumberOfRewardModels());
+    for (auto const& rewardModel : original->getRewardModels()) {
+        ASSERT_TRUE(loaded->hasRewardModel(rewardModel.first));
+        auto const& loadedRewardModel = loaded->getRewardModel(rewardModel.first);
+        ASSERT_EQ(rewardModel.second.hasStateRewards(), loadedRewardModel.hasStateRewards());
+        if (rewardModel.second.hasStateRewards()) {
+            EXPECT_EQ(rewardModel.second.getStateRewardVector(), loadedRewardModel.getStateRewardVector());
+        }
+        ASSERT_EQ(rewardModel.second.hasStateActionRewards(), loadedRewardModel.hasStateActionRewards());
+        if (rewardModel.second.hasStateActionRewards()) {
+            EXPECT_EQ(rewardModel.second.getStateActionRewardVector(), loadedRewardModel.getStateActionRewardVector());
+        }
+    }
+    if (original->isOfType(storm::models::ModelType::Ctmc)) {
+        EXPECT_EQ(original->as<storm::models::sparse::Ctmc<double>>()->getExitRateVector(),
+                  loaded->as<storm::models::sparse::Ctmc<double>>()->getExitRateVector());
+    } else if (original->isOfType(storm::models::ModelType::MarkovAutomaton)) {
+        auto originalMa = original->as<storm::models::sparse::MarkovAutomaton<double>>();
+        auto loadedMa = loaded->as<storm::models::sparse::MarkovAutomaton<double>>();
+        EXPECT_EQ(originalMa->getExitRates(), loadedMa->getExitRates());
+        EXPECT_EQ(originalMa->getMarkovianStates(), loadedMa->getMarkovianStates());
+    }
+}
+
+TEST(BinaryEncodingParserTest, Dtmc) {
+    checkRoundTrip(STORM_TEST_RESOURCES_DIR "/dtmc/crowds-5-5.drn");
+}
+
+TEST(BinaryEncodingParserTest, Mdp) {
+    checkRoundTrip(STORM_TEST_RESOURCES_DIR "/mdp/two_dice.drn", true);
+}
+
+TEST(BinaryEncodingParserTest, Ctmc) {
+    checkRoundTrip(STORM_TEST_RESOURCES_DIR "/ctmc/cluster2.drn");
+}
+
+TEST(BinaryEncodingParserTest, MarkovAutomaton) {
+    checkRoundTrip(STORM_TEST_RESOURCES_DIR "/ma/jobscheduler.drn");
+}
+
+TEST(BinaryEncodingParserTest, ModelParts) {
+    std::shared_ptr<storm::models::sparse::Model<double>> original =
+        storm::parser::DirectEncodingParser<double>::parseModel(STORM_TEST_RESOURCES_DIR "/mdp/two_dice.drn");
+    std::string binaryFile = (std::filesystem::temp_directory_path() / "storm_binary_encoding_parts_test.drnb").string();
+    storm::api::exportSparseModelAsDrnb(original, binaryFile);
+
+    auto const& matrix = original->getTransitionMatrix();
+    std::vector<uint64_t> bounds = storm::parser::BinaryEncodingParser::computeStatePartition(binaryFile, 3);
+    ASSERT_EQ(4ul, bounds.size());
+    EXPECT_EQ(0ul, bounds.front());
+    EXPECT_EQ(original->getNumberOfStates(), bounds.back());
+    for (uint64_t i = 0; i < 3; ++i) {
+        ASSERT_LE(bounds[i], bounds[i + 1]);
+        auto part = storm::parser::BinaryEncodingParser::parseModelPart(binaryFile, bounds[i], bounds[i + 1]);
+        EXPECT_EQ(original->getType(), part.modelType);
+        EXPECT_EQ(original->getNumberOfStates(), part.numberOfStates);
+        EXPECT_EQ(matrix.getRowGroupIndices()[bounds[i]], part.firstChoice);
+        ASSERT_EQ(bounds[i + 1] - bounds[i], part.transitionMatrix.getRowGroupCount());
+        EXPECT_EQ(matrix.getColumnCount(), part.transitionMatrix.getColumnCount());
+        for (uint64_t state = bounds[i]; state < bounds[i + 1]; ++state) {
+            uint64_t const partState = state - bounds[i];
+            ASSERT_EQ(matrix.getRowGroupSize(state), part.transitionMatrix.getRowGroupSize(partState));
+            for (uint64_t choice = 0; choice < matrix.getRowGroupSize(state); ++choice) {
+                auto originalRow = matrix.getRow(state, choice);
+                auto partRow = part.transitionMatrix.getRow(partState, choice);
+                EXPECT_TRUE(std::equal(originalRow.begin(), originalRow.end(), partRow.begin(), partRow.end()));
+            }
+            for (auto const& label : original->getStateLabeling().getLabels()) {
+                EXPECT_EQ(original->getStateLabeling().getStateHasLabel(label, state), part.stateLabeling.getStateHasLabel(label, partState));
+            }
+        }
+        ASSERT_EQ(original->getNumberOfRewardModels(), part.rewardModels.size());
+        for (auto const& rewardModel : original->getRewardModels()) {
+            auto const& partRewardModel = part.rewardModels.at(rewardModel.first);
+            if (rewardModel.second.hasStateActionRewards()) {
+                auto const& rewards = rewardModel.second.getStateActionRewardVector();
+                std::vector<double> expected(rewards.begin() + part.firstChoice,
+                                             rewards.begin() + part.firstChoice + part.transitionMatrix.getRowCount());
+                EXPECT_EQ(expected, partRewardModel.getStateActionRewardVector());
+            }
+        }
+    }
+    std::remove(binaryFile.c_str());
+}
+
+TEST(BinaryEncodingParserTest, StateValuationsFromMemory) {
+    storm::prism::Program program = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR "/mdp/two_dice.nm");
+    storm::builder::BuilderOptions options;
+    options.setBuildStateValuations();
+    auto original = storm::api::buildSparseModel<double>(program, options);
+    ASSERT_TRUE(original->hasStateValuations());
+
+    std::string binaryFile = (std::filesystem::temp_directory_path() / "storm_binary_encoding_valuations_test.drnb").string();
+    storm::api::exportSparseModelAsDrnb(original, binaryFile);
+    std::stringstream buffer;
+    {
+        std::ifstream stream(binaryFile, std::ios::binary);
+        buffer << stream.rdbuf();
+    }
+    std::remove(binaryFile.c_str());
+    std::string const data = buffer.str();
+
+    // Without expression manager, the valuations are skipped
+    auto withoutValuations = storm::parser::BinaryEncodingParser::parseModel(data.data(), data.data() + data.size());
+    EXPECT_FALSE(withoutValuations->hasStateValuations());
+    EXPECT_EQ(original->getTransitionMatrix(), withoutValuations->getTransitionMatrix());
+
+    auto manager = std::make_shared<storm::expressions::ExpressionManager>();
+    auto loaded = storm::parser::BinaryEncodingParser::parseModel(data.data(), data.data() + data.size(), manager);
+    EXPECT_EQ(original->getTransitionMatrix(), loaded->getTransitionMatrix());
+    ASSERT_TRUE(loaded->hasStateValuations());
+    for (uint64_t state = 0; state < original->getNumberOfStates(); ++state) {
+        EXPECT_EQ(original->getStateValuations().toString(state), loaded->getStateValuations().toString(state));
+    }
+}
+
+}  // namespace
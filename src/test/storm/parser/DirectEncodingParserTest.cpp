@@ -97,3 +97,40 @@ TEST(DirectEncodingParserTest, IntervalDtmcTest) {
     ASSERT_EQ(613ul, dtmc->getNumberOfStates());
     EXPECT_TRUE(modelPtr->hasUncertainty());
 }
+
+void checkParallelParsing(std::string const& drnFile) {
+    std::shared_ptr<storm::models::sparse::Model<double>> sequential = storm::parser::DirectEncodingParser<double>::parseModel(drnFile);
+    storm::parser::DirectEncodingParserOptions options;
+    options.numberOfThreads = 4;
+    std::shared_ptr<storm::models::sparse::Model<double>> parallel = storm::parser::DirectEncodingParser<double>::parseModel(drnFile, options);
+
+    ASSERT_EQ(sequential->getType(), parallel->getType());
+    EXPECT_EQ(sequential->getTransitionMatrix(), parallel->getTransitionMatrix());
+    EXPECT_EQ(sequential->getStateLabeling(), parallel->getStateLabeling());
+    ASSERT_EQ(sequential->getNumberOfRewardModels(), parallel->getNumberOfRewardModels());
+    for (auto const& rewardModel : sequential->getRewardModels()) {
+        ASSERT_TRUE(parallel->hasRewardModel(rewardModel.first));
+        auto const& parallelRewardModel = parallel->getRewardModel(rewardModel.first);
+        ASSERT_EQ(rewardModel.second.hasStateRewards(), parallelRewardModel.hasStateRewards());
+        if (rewardModel.second.hasStateRewards()) {
+            EXPECT_EQ(rewardModel.second.getStateRewardVector(), parallelRewardModel.getStateRewardVector());
+        }
+        ASSERT_EQ(rewardModel.second.hasStateActionRewards(), parallelRewardModel.hasStateActionRewards());
+        if (rewardModel.second.hasStateActionRewards()) {
+            EXPECT_EQ(rewardModel.second.getStateActionRewardVector(), parallelRewardModel.getStateActionRewardVector());
+        }
+    }
+    if (sequential->isOfType(storm::models::ModelType::MarkovAutomaton)) {
+        auto sequentialMa = sequential->as<storm::models::sparse::MarkovAutomaton<double>>();
+        auto parallelMa = parallel->as<storm::models::sparse::MarkovAutomaton<double>>();
+        EXPECT_EQ(sequentialMa->getExitRates(), parallelMa->getExitRates());
+        EXPECT_EQ(sequentialMa->getMarkovianStates(), parallelMa->getMarkovianStates());
+    }
+}
+
+TEST(DirectEncodingParserTest, ParallelParsing) {
+    checkParallelParsing(STORM_TEST_RESOURCES_DIR "/dtmc/crowds-5-5.drn");
+    checkParallelParsing(STORM_TEST_RESOURCES_DIR "/mdp/two_dice.drn");
+    checkParallelParsing(STORM_TEST_RESOURCES_DIR "/ctmc/cluster2.drn");
+    checkParallelParsing(STORM_TEST_RESOURCES_DIR "/ma/jobscheduler.drn");
+}
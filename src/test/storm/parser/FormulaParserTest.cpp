@@ -65,6 +65,27 @@ TEST(FormulaParserTest, ExpressionTest3) {
     STORM_SILENT_ASSERT_THROW(formulaParser.parseSingleFormulaFromString(input), storm::exceptions::WrongFormatException);
 }
 
+TEST(FormulaParserTest, IdentifierExpressionTest) {
+    std::shared_ptr<storm::expressions::ExpressionManager> manager(new storm::expressions::ExpressionManager());
+    storm::expressions::Variable x = manager->declareIntegerVariable("x");
+
+    // Identifiers added before the first use (i.e., before the grammar is constructed) are kept, also in copies.
+    storm::parser::FormulaParser formulaParser(manager);
+    formulaParser.addIdentifierExpression("big", x > manager->integer(3));
+    storm::parser::FormulaParser copy(formulaParser);
+
+    std::shared_ptr<storm::logic::Formula const> formula(nullptr);
+    ASSERT_NO_THROW(formula = formulaParser.parseSingleFormulaFromString("big"));
+    EXPECT_TRUE(formula->isAtomicExpressionFormula());
+    ASSERT_NO_THROW(formula = copy.parseSingleFormulaFromString("P=? [F big]"));
+    EXPECT_TRUE(formula->isProbabilityOperatorFormula());
+
+    // Constants defined in a parsed property are known to copies of the parser.
+    ASSERT_NO_THROW(formulaParser.parseFromString("const int k = 5; P=? [F x>k]"));
+    storm::parser::FormulaParser copyAfterParsing(formulaParser);
+    ASSERT_NO_THROW(formula = copyAfterParsing.parseSingleFormulaFromString("P=? [F x<k]"));
+}
+
 TEST(FormulaParserTest, LabelAndExpressionTest) {
     std::shared_ptr<storm::expressions::ExpressionManager> manager(new storm::expressions::ExpressionManager());
     manager->declareBooleanVariable("x");
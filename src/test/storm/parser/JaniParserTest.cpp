@@ -1,10 +1,16 @@
 #include <storm/exceptions/InvalidArgumentException.h>
 #include "storm-config.h"
+
+#include <cstdio>
+#include <filesystem>
+
 #include "storm-parsers/api/model_descriptions.h"
 #include "storm-parsers/parser/JaniParser.h"
+#include "storm/api/export.h"
 #include "storm/storage/jani/Model.h"
 #include "storm/storage/jani/ModelType.h"
 #include "storm/storage/jani/Property.h"
+#include "storm/storage/jani/visitor/JSONExporter.h"
 #include "test/storm_gtest.h"
 
 TEST(JaniParser, DieExampleTest) {
@@ -414,3 +420,22 @@ TEST(JaniParser, UnassignedVariablesTest) {
     EXPECT_TRUE(result.first.hasConstant("c"));
     EXPECT_EQ(2ul, result.first.getNumberOfAutomata());
 }
+
+TEST(JaniParser, BinaryRoundTripTest) {
+    std::pair<storm::jani::Model, std::vector<storm::jani::Property>> original, loaded;
+    EXPECT_NO_THROW(original = storm::api::parseJaniModel(STORM_TEST_RESOURCES_DIR "/ma/ftwc.jani"));
+    std::string binaryFile = (std::filesystem::temp_directory_path() / "storm_jani_binary_test.janib").string();
+    storm::api::exportJaniModelAsBinary(original.first, original.second, binaryFile);
+    EXPECT_NO_THROW(loaded = storm::api::parseJaniModel(binaryFile));
+    std::remove(binaryFile.c_str());
+
+    EXPECT_EQ(original.first.getModelType(), loaded.first.getModelType());
+    EXPECT_EQ(original.first.getNumberOfAutomata(), loaded.first.getNumberOfAutomata());
+    ASSERT_EQ(original.second.size(), loaded.second.size());
+    for (uint64_t i = 0; i < original.second.size(); ++i) {
+        EXPECT_EQ(original.second[i].getName(), loaded.second[i].getName());
+    }
+    // Both models have the same JANI representation
+    EXPECT_EQ(storm::dumpJson(storm::jani::JsonExporter::toJson(original.first, original.second, false, false)),
+              storm::dumpJson(storm::jani::JsonExporter::toJson(loaded.first, loaded.second, false, false)));
+}
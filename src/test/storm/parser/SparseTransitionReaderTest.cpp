@@ -0,0 +1,43 @@
+#include "storm-config.h"
+#include "test/storm_gtest.h"
+
+#include <vector>
+
+#include "storm-parsers/parser/MappedFile.h"
+#include "storm-parsers/parser/SparseTransitionReader.h"
+
+namespace {
+
+std::vector<storm::parser::TransitionLine> readLines(std::string const& filename, bool nondeterministic, uint64_t numberOfThreads, uint64_t bytesPerChunk) {
+    storm::parser::MappedFile file(filename.c_str());
+    storm::parser::SparseTransitionReader reader(file, nondeterministic, numberOfThreads, bytesPerChunk);
+    std::vector<storm::parser::TransitionLine> lines;
+    reader.forEachLine([&lines](storm::parser::TransitionLine const& line) { lines.push_back(line); });
+    return lines;
+}
+
+// Reading with many small chunks has to yield the same lines in the same order as reading sequentially
+void checkChunkedReading(std::string const& filename, bool nondeterministic, uint64_t expectedNumberOfLines) {
+    std::vector<storm::parser::TransitionLine> sequential = readLines(filename, nondeterministic, 1, 1ull << 22);
+    ASSERT_EQ(expectedNumberOfLines, sequential.size());
+    for (uint64_t bytesPerChunk : {1ull, 7ull, 64ull}) {
+        std::vector<storm::parser::TransitionLine> chunked = readLines(filename, nondeterministic, 4, bytesPerChunk);
+        ASSERT_EQ(sequential.size(), chunked.size());
+        for (uint64_t i = 0; i < sequential.size(); ++i) {
+            EXPECT_EQ(sequential[i].source, chunked[i].source);
+            EXPECT_EQ(sequential[i].choice, chunked[i].choice);
+            EXPECT_EQ(sequential[i].target, chunked[i].target);
+            EXPECT_EQ(sequential[i].value, chunked[i].value);
+        }
+    }
+}
+
+TEST(SparseTransitionReaderTest, Deterministic) {
+    checkChunkedReading(STORM_TEST_RESOURCES_DIR "/tra/dtmc_general.tra", false, 17ul);
+}
+
+TEST(SparseTransitionReaderTest, Nondeterministic) {
+    checkChunkedReading(STORM_TEST_RESOURCES_DIR "/tra/mdp_general.tra", true, 22ul);
+}
+
+}  // namespace
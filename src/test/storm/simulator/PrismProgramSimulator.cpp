@@ -48,3 +48,40 @@ TEST(PrismProgramSimulatorTest, KnuthYaoDieTest) {
     EXPECT_TRUE(std::count(labels.begin(), labels.end(), "done") == 1);
     EXPECT_TRUE(std::count(labels.begin(), labels.end(), "five") == 1);
 }
+
+TEST(PrismProgramSimulatorTest, StateCacheTest) {
+    storm::prism::Program program = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR "/mdp/die_c1.nm");
+    storm::builder::BuilderOptions options;
+    options.setBuildAllRewardModels();
+
+    storm::simulator::DiscreteTimePrismProgramSimulator<double> cachedSim(program, options);
+    storm::simulator::DiscreteTimePrismProgramSimulator<double> uncachedSim(program, options);
+    cachedSim.setStateCacheSize(3);
+    uncachedSim.setStateCacheSize(0);
+    cachedSim.setSeed(42);
+    uncachedSim.setSeed(42);
+
+    // The cache must not affect the simulated paths.
+    storm::expressions::Variable s = program.getManager().getVariable("s");
+    uint64_t firstSuccessorCount = 0;
+    uint64_t const numberOfPaths = 10000;
+    for (uint64_t path = 0; path < numberOfPaths; ++path) {
+        cachedSim.resetToInitial();
+        uncachedSim.resetToInitial();
+        // Take the biased action in the initial state.
+        cachedSim.step(1);
+        uncachedSim.step(1);
+        ASSERT_EQ(cachedSim.getCurrentState(), uncachedSim.getCurrentState());
+        if (cachedSim.getCurrentStateAsValuation().getIntegerValue(s) == 1) {
+            ++firstSuccessorCount;
+        }
+        for (uint64_t step = 0; step < 5; ++step) {
+            cachedSim.step(0);
+            uncachedSim.step(0);
+            ASSERT_EQ(cachedSim.getCurrentState(), uncachedSim.getCurrentState());
+            ASSERT_EQ(cachedSim.getLastRewards(), uncachedSim.getLastRewards());
+            ASSERT_EQ(cachedSim.getCurrentStateLabelling(), uncachedSim.getCurrentStateLabelling());
+        }
+    }
+    EXPECT_NEAR(0.2, static_cast<double>(firstSuccessorCount) / numberOfPaths, 0.02);
+}
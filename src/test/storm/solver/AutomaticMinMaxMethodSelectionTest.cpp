@@ -0,0 +1,109 @@
+#include "storm-config.h"
+#include "test/storm_gtest.h"
+
+#include <cstdio>
+#include <filesystem>
+
+#include "storm/environment/solver/MinMaxSolverEnvironment.h"
+#include "storm/solver/AutomaticMinMaxMethodSelection.h"
+#include "storm/storage/SparseMatrix.h"
+
+namespace {
+
+storm::storage::SparseMatrix<double> buildAcyclicMatrix() {
+    storm::storage::SparseMatrixBuilder<double> builder(3, 2, 2, true, true, 2);
+    builder.newRowGroup(0);
+    builder.addNextValue(0, 1, 0.5);
+    builder.addNextValue(1, 1, 1.0);
+    builder.newRowGroup(2);
+    return builder.build();
+}
+
+storm::storage::SparseMatrix<double> buildCyclicMatrix() {
+    // The transition to state 1 has a small probability, i.e., value iteration converges slowly.
+    storm::storage::SparseMatrixBuilder<double> builder(3, 2, 4, true, true, 2);
+    builder.newRowGroup(0);
+    builder.addNextValue(0, 0, 0.9999);
+    builder.addNextValue(0, 1, 0.0001);
+    builder.addNextValue(1, 0, 1.0);
+    builder.newRowGroup(2);
+    builder.addNextValue(2, 1, 1.0);
+    return builder.build();
+}
+
+TEST(AutomaticMinMaxMethodSelectionTest, Statistics) {
+    auto acyclicStatistics = storm::solver::computeMinMaxProblemStatistics(buildAcyclicMatrix());
+    EXPECT_EQ(2ull, acyclicStatistics.numRowGroups);
+    EXPECT_EQ(3ull, acyclicStatistics.numRows);
+    EXPECT_EQ(2ull, acyclicStatistics.maxRowGroupSize);
+    EXPECT_TRUE(acyclicStatistics.isAcyclic());
+    EXPECT_EQ(0.5, acyclicStatistics.minPositiveValue);
+
+    auto cyclicStatistics = storm::solver::computeMinMaxProblemStatistics(buildCyclicMatrix());
+    EXPECT_FALSE(cyclicStatistics.isAcyclic());
+    EXPECT_EQ(2ull, cyclicStatistics.numNontrivialSccs);
+    EXPECT_EQ(1ull, cyclicStatistics.maxSccSize);
+    EXPECT_NEAR(0.0001, cyclicStatistics.minPositiveValue, 1e-12);
+}
+
+TEST(AutomaticMinMaxMethodSelectionTest, Heuristics) {
+    storm::Environment env;
+    auto acyclicStatistics = storm::solver::computeMinMaxProblemStatistics(buildAcyclicMatrix());
+    EXPECT_EQ(storm::solver::MinMaxMethod::Acyclic, storm::solver::selectMinMaxMethod(env, acyclicStatistics, false));
+
+    storm::solver::MinMaxProblemStatistics statistics;
+    statistics.numRowGroups = 1000;
+    statistics.numRows = 2000;
+    statistics.numEntries = 5000;
+    statistics.numNontrivialSccs = 1;
+    statistics.maxSccSize = 1000;
+    statistics.minPositiveValue = 0.1;
+    EXPECT_EQ(storm::solver::MinMaxMethod::ValueIteration, storm::solver::selectMinMaxMethod(env, statistics, false));
+    EXPECT_EQ(storm::solver::MinMaxMethod::PolicyIteration, storm::solver::selectMinMaxMethod(env, statistics, true));
+    statistics.minPositiveValue = 1e-5;
+    EXPECT_EQ(storm::solver::MinMaxMethod::PolicyIteration, storm::solver::selectMinMaxMethod(env, statistics, false));
+
+    // Many small SCCs are solved topologically.
+    statistics.numNontrivialSccs = 100;
+    statistics.maxSccSize = 10;
+    EXPECT_EQ(storm::solver::MinMaxMethod::Topological, storm::solver::selectMinMaxMethod(env, statistics, false));
+}
+
+TEST(AutomaticMinMaxMethodSelectionTest, Environment) {
+    storm::Environment env;
+    env.solver().minMax().setMethodAutomatic(true);
+    auto matrix = buildAcyclicMatrix();
+    auto signature = storm::solver::selectMinMaxMethodAutomatically(env, matrix);
+    EXPECT_EQ(storm::solver::computeMinMaxProblemStatistics(matrix).getSignature(env), signature);
+    EXPECT_FALSE(env.solver().minMax().isMethodAutomatic());
+    EXPECT_EQ(storm::solver::MinMaxMethod::Acyclic, env.solver().minMax().getMethod());
+    EXPECT_TRUE(env.solver().minMax().isMethodSetFromDefault());
+}
+
+TEST(AutomaticMinMaxMethodSelectionTest, History) {
+    std::string filename = (std::filesystem::temp_directory_path() / "storm_minmax_method_history_test.txt").string();
+    std::remove(filename.c_str());
+
+    storm::Environment env;
+    auto statistics = storm::solver::computeMinMaxProblemStatistics(buildCyclicMatrix());
+    std::string signature = statistics.getSignature(env);
+    {
+        storm::solver::MinMaxMethodHistory history(filename);
+        EXPECT_FALSE(history.getFastestMethod(signature).is_initialized());
+        history.recordTime(signature, storm::solver::MinMaxMethod::PolicyIteration, 2.0);
+        history.recordTime(signature, storm::solver::MinMaxMethod::Acyclic, 3.0);
+        history.recordTime(signature, storm::solver::MinMaxMethod::ValueIteration, 1.0);
+        history.recordTime("other", storm::solver::MinMaxMethod::IntervalIteration, 0.5);
+        EXPECT_EQ(storm::solver::MinMaxMethod::ValueIteration, history.getFastestMethod(signature).get());
+    }
+
+    // The recorded times are restored from the file and take precedence over the heuristics.
+    storm::solver::MinMaxMethodHistory history(filename);
+    ASSERT_TRUE(history.getFastestMethod(signature).is_initialized());
+    EXPECT_EQ(storm::solver::MinMaxMethod::ValueIteration, history.getFastestMethod(signature).get());
+    EXPECT_EQ(storm::solver::MinMaxMethod::IntervalIteration, history.getFastestMethod("other").get());
+    EXPECT_EQ(storm::solver::MinMaxMethod::ValueIteration, storm::solver::selectMinMaxMethod(env, statistics, false, &history));
+    std::remove(filename.c_str());
+}
+
+}  // namespace
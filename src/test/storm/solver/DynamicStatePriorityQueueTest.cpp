@@ -0,0 +1,42 @@
+#include "storm-config.h"
+#include "test/storm_gtest.h"
+
+#include "storm/solver/stateelimination/DynamicStatePriorityQueue.h"
+#include "storm/storage/FlexibleSparseMatrix.h"
+#include "storm/storage/SparseMatrix.h"
+
+TEST(DynamicStatePriorityQueueTest, PopsAndUpdates) {
+    storm::storage::SparseMatrixBuilder<double> builder(5, 5);
+    for (uint64_t state = 0; state < 5; ++state) {
+        builder.addNextValue(state, (state + 1) % 5, 1.0);
+    }
+    storm::storage::FlexibleSparseMatrix<double> matrix(builder.build());
+    std::vector<double> oneStepProbabilities(5, 0.0);
+
+    std::vector<uint_fast64_t> penalties = {3, 1, 4, 1, 5};
+    auto penaltyFunction = [&penalties](storm::storage::sparse::state_type const& state, storm::storage::FlexibleSparseMatrix<double> const&,
+                                        storm::storage::FlexibleSparseMatrix<double> const&, std::vector<double> const&) { return penalties[state]; };
+
+    // State 4 is not in the queue.
+    std::vector<std::pair<storm::storage::sparse::state_type, uint_fast64_t>> statePenalties = {{1, 1}, {3, 1}, {0, 3}, {2, 4}};
+    storm::solver::stateelimination::DynamicStatePriorityQueue<double> queue(statePenalties, matrix, matrix, oneStepProbabilities, penaltyFunction);
+    EXPECT_EQ(4ull, queue.size());
+
+    // Ties are broken by the state index.
+    EXPECT_EQ(1ull, queue.pop());
+
+    // Increasing and decreasing penalties reorders the states, states not in the queue are ignored.
+    penalties[3] = 6;
+    queue.update(3);
+    penalties[2] = 0;
+    queue.update(2);
+    penalties[4] = 0;
+    queue.update(4);
+    EXPECT_EQ(3ull, queue.size());
+
+    EXPECT_EQ(2ull, queue.pop());
+    EXPECT_EQ(0ull, queue.pop());
+    EXPECT_TRUE(queue.hasNext());
+    EXPECT_EQ(3ull, queue.pop());
+    EXPECT_FALSE(queue.hasNext());
+}
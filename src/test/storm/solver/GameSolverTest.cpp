@@ -132,4 +132,99 @@ TYPED_TEST(GameSolverTest, SolveEquations) {
     EXPECT_NEAR(this->parseNumber("1"), result[0], this->precision());
 }
 
+TEST(GameSolverTest, SolveEquationsTopological) {
+    // Construct a game whose player 1 states form three SCCs. Player 1 is represented by a grouping of the player 2 states.
+    storm::storage::SparseMatrixBuilder<double> player2MatrixBuilder(0, 0, 0, false, true);
+    player2MatrixBuilder.newRowGroup(0);
+    player2MatrixBuilder.addNextValue(0, 0, 0.5);
+    player2MatrixBuilder.addNextValue(0, 1, 0.5);
+    player2MatrixBuilder.addNextValue(1, 2, 0.5);
+    player2MatrixBuilder.newRowGroup(2);
+    player2MatrixBuilder.addNextValue(2, 1, 0.4);
+    player2MatrixBuilder.newRowGroup(3);
+    player2MatrixBuilder.addNextValue(3, 1, 0.5);
+    player2MatrixBuilder.addNextValue(4, 2, 1);
+    player2MatrixBuilder.newRowGroup(5);
+    player2MatrixBuilder.addNextValue(5, 2, 0.5);
+    storm::storage::SparseMatrix<double> player2Matrix = player2MatrixBuilder.build();
+    std::vector<uint64_t> player1Grouping = {0, 2, 3, 4};
+    std::vector<double> b = {0, 0.2, 0.1, 0.5, 0, 0.25};
+
+    std::vector<storm::Environment> environments(3);
+    environments[0].solver().game().setMethod(storm::solver::GameMethod::ValueIteration);
+    environments[1].solver().game().setMethod(storm::solver::GameMethod::Topological);
+    environments[2].solver().game().setMethod(storm::solver::GameMethod::Topological);
+    environments[2].solver().setUseIntelTbb(true);
+
+    for (auto& env : environments) {
+        env.solver().game().setPrecision(storm::utility::convertNumber<storm::RationalNumber>(1e-8));
+        storm::solver::GameSolverFactory<double> factory;
+        auto solver = factory.create(env, player1Grouping, player2Matrix);
+        solver->setTrackSchedulers(true);
+
+        std::vector<double> result(3);
+        solver->solveGame(env, storm::OptimizationDirection::Minimize, storm::OptimizationDirection::Minimize, result, b);
+        EXPECT_NEAR(0.3, result[0], 1e-6);
+        EXPECT_EQ(1ull, solver->getPlayer1SchedulerChoices()[0]);
+
+        result = std::vector<double>(3);
+        solver->solveGame(env, storm::OptimizationDirection::Minimize, storm::OptimizationDirection::Maximize, result, b);
+        EXPECT_NEAR(0.5, result[0], 1e-6);
+
+        result = std::vector<double>(3);
+        solver->solveGame(env, storm::OptimizationDirection::Maximize, storm::OptimizationDirection::Minimize, result, b);
+        EXPECT_NEAR(0.45, result[0], 1e-6);
+        EXPECT_EQ(0ull, solver->getPlayer1SchedulerChoices()[0]);
+        EXPECT_EQ(1ull, solver->getPlayer2SchedulerChoices()[0]);
+
+        result = std::vector<double>(3);
+        solver->solveGame(env, storm::OptimizationDirection::Maximize, storm::OptimizationDirection::Maximize, result, b);
+        EXPECT_NEAR(1.0, result[0], 1e-5);
+    }
+}
+
+TEST(GameSolverTest, SolveEquationsIntervalIteration) {
+    // Construct a game with end components, in which iterating from above does not converge without deflation.
+    storm::storage::SparseMatrixBuilder<double> player2MatrixBuilder(0, 0, 0, false, true);
+    player2MatrixBuilder.newRowGroup(0);
+    player2MatrixBuilder.addNextValue(0, 1, 1);
+    player2MatrixBuilder.newRowGroup(1);
+    player2MatrixBuilder.newRowGroup(2);
+    player2MatrixBuilder.addNextValue(2, 0, 1);
+    player2MatrixBuilder.addNextValue(3, 2, 1);
+    player2MatrixBuilder.newRowGroup(4);
+    player2MatrixBuilder.addNextValue(4, 2, 1);
+    storm::storage::SparseMatrix<double> player2Matrix = player2MatrixBuilder.build();
+    std::vector<uint64_t> player1Grouping = {0, 2, 3, 4};
+    std::vector<double> b = {0, 0.5, 0, 0, 0};
+
+    storm::Environment env;
+    env.solver().game().setMethod(storm::solver::GameMethod::IntervalIteration);
+    env.solver().game().setPrecision(storm::utility::convertNumber<storm::RationalNumber>(1e-6));
+    env.solver().game().setRelativeTerminationCriterion(false);
+    env.solver().game().setMaximalNumberOfIterations(1000);
+
+    storm::solver::GameSolverFactory<double> factory;
+    auto solver = factory.create(env, player1Grouping, player2Matrix);
+    solver->setBounds(0.0, 1.0);
+
+    std::vector<double> result(3);
+    EXPECT_TRUE(solver->solveGame(env, storm::OptimizationDirection::Minimize, storm::OptimizationDirection::Minimize, result, b));
+    EXPECT_NEAR(0.0, result[0], 1e-6);
+
+    result = std::vector<double>(3);
+    EXPECT_TRUE(solver->solveGame(env, storm::OptimizationDirection::Minimize, storm::OptimizationDirection::Maximize, result, b));
+    EXPECT_NEAR(0.0, result[0], 1e-6);
+
+    result = std::vector<double>(3);
+    EXPECT_TRUE(solver->solveGame(env, storm::OptimizationDirection::Maximize, storm::OptimizationDirection::Minimize, result, b));
+    EXPECT_NEAR(0.5, result[0], 1e-6);
+    EXPECT_NEAR(0.0, result[1], 1e-6);
+
+    result = std::vector<double>(3);
+    EXPECT_TRUE(solver->solveGame(env, storm::OptimizationDirection::Maximize, storm::OptimizationDirection::Maximize, result, b));
+    EXPECT_NEAR(0.5, result[0], 1e-6);
+    EXPECT_NEAR(0.5, result[1], 1e-6);
+}
+
 }  // namespace
@@ -4,6 +4,7 @@
 #include "storm/environment/solver/EigenSolverEnvironment.h"
 #include "storm/environment/solver/GmmxxSolverEnvironment.h"
 #include "storm/environment/solver/NativeSolverEnvironment.h"
+#include "storm/environment/solver/OviSolverEnvironment.h"
 #include "storm/environment/solver/TopologicalSolverEnvironment.h"
 #include "storm/solver/LinearEquationSolver.h"
 
@@ -37,6 +38,34 @@ class NativeDoublePowerRegMultEnvironment {
     }
 };
 
+class NativeDoublePowerParallelEnvironment {
+   public:
+    typedef double ValueType;
+    static const bool isExact = false;
+    static storm::Environment createEnvironment() {
+        storm::Environment env;
+        env.solver().setLinearEquationSolverType(storm::solver::EquationSolverType::Native);
+        env.solver().native().setMethod(storm::solver::NativeLinearEquationSolverMethod::Power);
+        env.solver().native().setPrecision(storm::utility::convertNumber<storm::RationalNumber, std::string>("1e-10"));
+        env.solver().setUseIntelTbb(true);
+        return env;
+    }
+};
+
+class NativeDoublePowerMixedPrecisionEnvironment {
+   public:
+    typedef double ValueType;
+    static const bool isExact = false;
+    static storm::Environment createEnvironment() {
+        storm::Environment env;
+        env.solver().setLinearEquationSolverType(storm::solver::EquationSolverType::Native);
+        env.solver().native().setMethod(storm::solver::NativeLinearEquationSolverMethod::Power);
+        env.solver().native().setPrecision(storm::utility::convertNumber<storm::RationalNumber, std::string>("1e-10"));
+        env.solver().native().setMixedPrecision(true);
+        return env;
+    }
+};
+
 class NativeDoubleSoundValueIterationEnvironment {
    public:
     typedef double ValueType;
@@ -67,6 +96,22 @@ class NativeDoubleOptimisticValueIterationEnvironment {
     }
 };
 
+class NativeDoubleOptimisticValueIterationPipelinedEnvironment {
+   public:
+    typedef double ValueType;
+    static const bool isExact = false;
+    static storm::Environment createEnvironment() {
+        storm::Environment env;
+        env.solver().setForceSoundness(true);
+        env.solver().setLinearEquationSolverType(storm::solver::EquationSolverType::Native);
+        env.solver().native().setMethod(storm::solver::NativeLinearEquationSolverMethod::OptimisticValueIteration);
+        env.solver().native().setRelativeTerminationCriterion(false);
+        env.solver().native().setPrecision(storm::utility::convertNumber<storm::RationalNumber, std::string>("1e-6"));
+        env.solver().ovi().setPipelined(true);
+        return env;
+    }
+};
+
 class NativeDoubleIntervalIterationEnvironment {
    public:
     typedef double ValueType;
@@ -82,6 +127,22 @@ class NativeDoubleIntervalIterationEnvironment {
     }
 };
 
+class NativeDoubleIntervalIterationMixedPrecisionEnvironment {
+   public:
+    typedef double ValueType;
+    static const bool isExact = false;
+    static storm::Environment createEnvironment() {
+        storm::Environment env;
+        env.solver().setForceSoundness(true);
+        env.solver().setLinearEquationSolverType(storm::solver::EquationSolverType::Native);
+        env.solver().native().setMethod(storm::solver::NativeLinearEquationSolverMethod::IntervalIteration);
+        env.solver().native().setRelativeTerminationCriterion(false);
+        env.solver().native().setPrecision(storm::utility::convertNumber<storm::RationalNumber, std::string>("1e-6"));
+        env.solver().native().setMixedPrecision(true);
+        return env;
+    }
+};
+
 class NativeDoubleJacobiEnvironment {
    public:
     typedef double ValueType;
@@ -282,6 +343,20 @@ class EigenDoubleLUEnvironment {
     }
 };
 
+class EigenDoubleLUAmdParallelEnvironment {
+   public:
+    typedef double ValueType;
+    static const bool isExact = false;
+    static storm::Environment createEnvironment() {
+        storm::Environment env;
+        env.solver().setLinearEquationSolverType(storm::solver::EquationSolverType::Eigen);
+        env.solver().eigen().setMethod(storm::solver::EigenLinearEquationSolverMethod::SparseLU);
+        env.solver().eigen().setOrdering(storm::solver::EigenLinearEquationSolverOrdering::Amd);
+        env.solver().setUseIntelTbb(true);
+        return env;
+    }
+};
+
 class EigenRationalLUEnvironment {
    public:
     typedef storm::RationalNumber ValueType;
@@ -307,6 +382,20 @@ class TopologicalEigenRationalLUEnvironment {
     }
 };
 
+class TopologicalEigenRationalLUNoDenseEnvironment {
+   public:
+    typedef storm::RationalNumber ValueType;
+    static const bool isExact = true;
+    static storm::Environment createEnvironment() {
+        storm::Environment env;
+        env.solver().setLinearEquationSolverType(storm::solver::EquationSolverType::Topological);
+        env.solver().topological().setUnderlyingEquationSolverType(storm::solver::EquationSolverType::Eigen);
+        env.solver().topological().setDenseSolveMaxSccSize(0);
+        env.solver().eigen().setMethod(storm::solver::EigenLinearEquationSolverMethod::SparseLU);
+        return env;
+    }
+};
+
 template<typename TestType>
 class LinearEquationSolverTest : public ::testing::Test {
    public:
@@ -326,13 +415,16 @@ class LinearEquationSolverTest : public ::testing::Test {
     storm::Environment _environment;
 };
 
-typedef ::testing::Types<NativeDoublePowerEnvironment, NativeDoublePowerRegMultEnvironment, NativeDoubleSoundValueIterationEnvironment,
-                         NativeDoubleOptimisticValueIterationEnvironment, NativeDoubleIntervalIterationEnvironment, NativeDoubleJacobiEnvironment,
-                         NativeDoubleGaussSeidelEnvironment, NativeDoubleSorEnvironment, NativeDoubleWalkerChaeEnvironment,
-                         NativeRationalRationalSearchEnvironment, EliminationRationalEnvironment, GmmGmresIluEnvironment, GmmGmresDiagonalEnvironment,
-                         GmmGmresNoneEnvironment, GmmBicgstabIluEnvironment, GmmQmrDiagonalEnvironment, EigenDGmresDiagonalEnvironment,
-                         EigenGmresIluEnvironment, EigenBicgstabNoneEnvironment, EigenDoubleLUEnvironment, EigenRationalLUEnvironment,
-                         TopologicalEigenRationalLUEnvironment>
+typedef ::testing::Types<NativeDoublePowerEnvironment, NativeDoublePowerRegMultEnvironment, NativeDoublePowerParallelEnvironment,
+                         NativeDoublePowerMixedPrecisionEnvironment, NativeDoubleSoundValueIterationEnvironment,
+                         NativeDoubleOptimisticValueIterationEnvironment, NativeDoubleOptimisticValueIterationPipelinedEnvironment,
+                         NativeDoubleIntervalIterationEnvironment,
+                         NativeDoubleIntervalIterationMixedPrecisionEnvironment, NativeDoubleJacobiEnvironment, NativeDoubleGaussSeidelEnvironment,
+                         NativeDoubleSorEnvironment, NativeDoubleWalkerChaeEnvironment, NativeRationalRationalSearchEnvironment, EliminationRationalEnvironment,
+                         GmmGmresIluEnvironment, GmmGmresDiagonalEnvironment, GmmGmresNoneEnvironment, GmmBicgstabIluEnvironment, GmmQmrDiagonalEnvironment,
+                         EigenDGmresDiagonalEnvironment, EigenGmresIluEnvironment, EigenBicgstabNoneEnvironment, EigenDoubleLUEnvironment,
+                         EigenDoubleLUAmdParallelEnvironment, EigenRationalLUEnvironment, TopologicalEigenRationalLUEnvironment,
+                         TopologicalEigenRationalLUNoDenseEnvironment>
     TestingTypes;
 
 TYPED_TEST_SUITE(LinearEquationSolverTest, TestingTypes, );
@@ -373,4 +465,49 @@ TYPED_TEST(LinearEquationSolverTest, solveEquationSystem) {
     EXPECT_NEAR(x[1], this->parseNumber("457/9"), this->precision());
     EXPECT_NEAR(x[2], this->parseNumber("875/18"), this->precision());
 }
+
+TYPED_TEST(LinearEquationSolverTest, solveEquationSystemBatch) {
+    typedef typename TestFixture::ValueType ValueType;
+    storm::storage::SparseMatrixBuilder<ValueType> builder;
+    ASSERT_NO_THROW(builder.addNextValue(0, 0, this->parseNumber("1/5")));
+    ASSERT_NO_THROW(builder.addNextValue(0, 1, this->parseNumber("2/5")));
+    ASSERT_NO_THROW(builder.addNextValue(0, 2, this->parseNumber("2/5")));
+    ASSERT_NO_THROW(builder.addNextValue(1, 0, this->parseNumber("1/50")));
+    ASSERT_NO_THROW(builder.addNextValue(1, 1, this->parseNumber("48/50")));
+    ASSERT_NO_THROW(builder.addNextValue(1, 2, this->parseNumber("1/50")));
+    ASSERT_NO_THROW(builder.addNextValue(2, 0, this->parseNumber("4/10")));
+    ASSERT_NO_THROW(builder.addNextValue(2, 1, this->parseNumber("3/10")));
+    ASSERT_NO_THROW(builder.addNextValue(2, 2, this->parseNumber("0")));
+
+    storm::storage::SparseMatrix<ValueType> A;
+    ASSERT_NO_THROW(A = builder.build());
+
+    // The solution for the second vector is twice the solution for the first one.
+    std::vector<std::vector<ValueType>> x(3, std::vector<ValueType>(3));
+    std::vector<std::vector<ValueType>> b = {{this->parseNumber("3"), this->parseNumber("-0.01"), this->parseNumber("12")},
+                                             {this->parseNumber("6"), this->parseNumber("-0.02"), this->parseNumber("24")},
+                                             {this->parseNumber("0"), this->parseNumber("0"), this->parseNumber("0")}};
+
+    auto factory = storm::solver::GeneralLinearEquationSolverFactory<ValueType>();
+    if (factory.getEquationProblemFormat(this->env()) == storm::solver::LinearEquationSolverProblemFormat::EquationSystem) {
+        A.convertToEquationSystem();
+    }
+
+    auto requirements = factory.getRequirements(this->env());
+    requirements.clearUpperBounds();
+    requirements.clearLowerBounds();
+    ASSERT_FALSE(requirements.hasEnabledRequirement());
+    auto solver = factory.create(this->env(), A);
+    solver->setBounds(this->parseNumber("-200"), this->parseNumber("200"));
+    ASSERT_NO_THROW(solver->solveEquationsBatch(this->env(), x, b));
+    EXPECT_NEAR(x[0][0], this->parseNumber("481/9"), this->precision());
+    EXPECT_NEAR(x[0][1], this->parseNumber("457/9"), this->precision());
+    EXPECT_NEAR(x[0][2], this->parseNumber("875/18"), this->precision());
+    EXPECT_NEAR(x[1][0], this->parseNumber("962/9"), this->precision() * this->parseNumber("2"));
+    EXPECT_NEAR(x[1][1], this->parseNumber("914/9"), this->precision() * this->parseNumber("2"));
+    EXPECT_NEAR(x[1][2], this->parseNumber("875/9"), this->precision() * this->parseNumber("2"));
+    EXPECT_NEAR(x[2][0], this->parseNumber("0"), this->precision());
+    EXPECT_NEAR(x[2][1], this->parseNumber("0"), this->precision());
+    EXPECT_NEAR(x[2][2], this->parseNumber("0"), this->precision());
+}
 }  // namespace
\ No newline at end of file
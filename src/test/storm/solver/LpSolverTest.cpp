@@ -197,6 +197,43 @@ TYPED_TEST(LpSolverTest, LPOptimizeMaxRaw) {
     EXPECT_NEAR(this->parseNumber("59/4"), solver->getObjectiveValue(), this->precision());
 }
 
+TYPED_TEST(LpSolverTest, LPOptimizeMaxRawBulk) {
+    typedef typename TestFixture::ValueType ValueType;
+    auto solver = this->factory()->createRaw("");
+    solver->setOptimizationDirection(storm::OptimizationDirection::Maximize);
+    ASSERT_EQ(0u, solver->addBoundedContinuousVariable("x", 0, 1, -1));
+    ASSERT_EQ(1u, solver->addLowerBoundedContinuousVariable("y", 0, 2));
+    ASSERT_EQ(2u, solver->addLowerBoundedContinuousVariable("z", 0, 1));
+    ASSERT_NO_THROW(solver->update());
+
+    std::vector<storm::solver::RawLpConstraint<ValueType>> constraints;
+    // x + y + z <= 12
+    constraints.emplace_back(storm::expressions::RelationType::LessOrEqual, this->parseNumber("12"), 3);
+    constraints.back().addToLhs(0, this->parseNumber("1"));
+    constraints.back().addToLhs(1, this->parseNumber("1"));
+    constraints.back().addToLhs(2, this->parseNumber("1"));
+    // -x + 1/2 * y + z == 5
+    constraints.emplace_back(storm::expressions::RelationType::Equal, this->parseNumber("5"), 3);
+    constraints.back().addToLhs(0, -this->parseNumber("1"));
+    constraints.back().addToLhs(1, this->parseNumber("1/2"));
+    constraints.back().addToLhs(2, this->parseNumber("1"));
+    // -x + y <= 11/2
+    constraints.emplace_back(storm::expressions::RelationType::LessOrEqual, this->parseNumber("11/2"), 2);
+    constraints.back().addToLhs(0, -this->parseNumber("1"));
+    constraints.back().addToLhs(1, this->parseNumber("1"));
+    ASSERT_NO_THROW(solver->addConstraints(constraints));
+    ASSERT_NO_THROW(solver->update());
+
+    ASSERT_NO_THROW(solver->optimize());
+    ASSERT_TRUE(solver->isOptimal());
+    ASSERT_FALSE(solver->isUnbounded());
+    ASSERT_FALSE(solver->isInfeasible());
+    EXPECT_NEAR(this->parseNumber("1"), solver->getContinuousValue(0), this->precision());
+    EXPECT_NEAR(this->parseNumber("13/2"), solver->getContinuousValue(1), this->precision());
+    EXPECT_NEAR(this->parseNumber("11/4"), solver->getContinuousValue(2), this->precision());
+    EXPECT_NEAR(this->parseNumber("59/4"), solver->getObjectiveValue(), this->precision());
+}
+
 TYPED_TEST(LpSolverTest, LPOptimizeMin) {
     typedef typename TestFixture::ValueType ValueType;
     auto solver = this->factory()->create("");
@@ -295,6 +332,42 @@ TYPED_TEST(LpSolverTest, MILPOptimizeMax) {
     EXPECT_NEAR(this->parseNumber("14"), solver->getObjectiveValue(), this->precision());
 }
 
+TYPED_TEST(LpSolverTest, MILPStartAndHints) {
+    if (!this->supportsInteger()) {
+        GTEST_SKIP();
+    }
+    auto solver = this->factory()->create("");
+    solver->setOptimizationDirection(storm::OptimizationDirection::Maximize);
+    storm::expressions::Variable x;
+    storm::expressions::Variable y;
+    storm::expressions::Variable z;
+    ASSERT_NO_THROW(x = solver->addBinaryVariable("x", -1));
+    ASSERT_NO_THROW(y = solver->addLowerBoundedIntegerVariable("y", 0, 2));
+    ASSERT_NO_THROW(z = solver->addLowerBoundedContinuousVariable("z", 0, 1));
+    ASSERT_NO_THROW(solver->update());
+
+    ASSERT_NO_THROW(solver->addConstraint("", x + y + z <= solver->getConstant(12)));
+    ASSERT_NO_THROW(solver->addConstraint("", solver->getConstant(this->parseNumber("1/2")) * y + z - x == solver->getConstant(5)));
+    ASSERT_NO_THROW(solver->addConstraint("", y - x <= solver->getConstant(this->parseNumber("11/2"))));
+    ASSERT_NO_THROW(solver->update());
+
+    // A feasible but suboptimal start solution and a misleading hint must not affect the optimum.
+    ASSERT_NO_THROW(solver->setMipStart(x, this->parseNumber("0")));
+    ASSERT_NO_THROW(solver->setMipStart(y, this->parseNumber("0")));
+    ASSERT_NO_THROW(solver->setMipStart(z, this->parseNumber("5")));
+    ASSERT_NO_THROW(solver->setVariableHint(y, this->parseNumber("2"), 1));
+    ASSERT_NO_THROW(solver->optimize());
+    ASSERT_TRUE(solver->isOptimal());
+    EXPECT_TRUE(solver->getBinaryValue(x));
+    EXPECT_EQ(6, solver->getIntegerValue(y));
+    EXPECT_NEAR(this->parseNumber("14"), solver->getObjectiveValue(), this->precision());
+
+    ASSERT_NO_THROW(solver->clearMipStartAndHints());
+    ASSERT_NO_THROW(solver->optimize());
+    ASSERT_TRUE(solver->isOptimal());
+    EXPECT_NEAR(this->parseNumber("14"), solver->getObjectiveValue(), this->precision());
+}
+
 TYPED_TEST(LpSolverTest, MILPOptimizeMaxRaw) {
     if (!this->supportsInteger()) {
         GTEST_SKIP();
@@ -5,9 +5,12 @@
 
 #include "storm/environment/solver/MinMaxSolverEnvironment.h"
 #include "storm/environment/solver/NativeSolverEnvironment.h"
+#include "storm/environment/solver/OviSolverEnvironment.h"
 #include "storm/environment/solver/TopologicalSolverEnvironment.h"
 #include "storm/solver/MinMaxLinearEquationSolver.h"
+#include "storm/solver/MinMaxLinearEquationSolverSession.h"
 #include "storm/solver/SolverSelectionOptions.h"
+#include "storm/solver/SolverTelemetry.h"
 #include "storm/storage/SparseMatrix.h"
 
 namespace {
@@ -37,6 +40,59 @@ class DoubleViRegMultEnvironment {
     }
 };
 
+class DoubleViParallelEnvironment {
+   public:
+    typedef double ValueType;
+    static const bool isExact = false;
+    static storm::Environment createEnvironment() {
+        storm::Environment env;
+        env.solver().minMax().setMethod(storm::solver::MinMaxMethod::ValueIteration);
+        env.solver().minMax().setPrecision(storm::utility::convertNumber<storm::RationalNumber>(1e-8));
+        env.solver().setUseIntelTbb(true);
+        return env;
+    }
+};
+
+class DoubleViMixedPrecisionEnvironment {
+   public:
+    typedef double ValueType;
+    static const bool isExact = false;
+    static storm::Environment createEnvironment() {
+        storm::Environment env;
+        env.solver().minMax().setMethod(storm::solver::MinMaxMethod::ValueIteration);
+        env.solver().minMax().setPrecision(storm::utility::convertNumber<storm::RationalNumber>(1e-8));
+        env.solver().minMax().setMixedPrecision(true);
+        return env;
+    }
+};
+
+class DoubleViPrioritizedEnvironment {
+   public:
+    typedef double ValueType;
+    static const bool isExact = false;
+    static storm::Environment createEnvironment() {
+        storm::Environment env;
+        env.solver().minMax().setMethod(storm::solver::MinMaxMethod::ValueIteration);
+        env.solver().minMax().setPrecision(storm::utility::convertNumber<storm::RationalNumber>(1e-8));
+        env.solver().minMax().setPrioritized(true);
+        return env;
+    }
+};
+
+class DoubleViPrioritizedParallelEnvironment {
+   public:
+    typedef double ValueType;
+    static const bool isExact = false;
+    static storm::Environment createEnvironment() {
+        storm::Environment env;
+        env.solver().minMax().setMethod(storm::solver::MinMaxMethod::ValueIteration);
+        env.solver().minMax().setPrecision(storm::utility::convertNumber<storm::RationalNumber>(1e-8));
+        env.solver().minMax().setPrioritized(true);
+        env.solver().setUseIntelTbb(true);
+        return env;
+    }
+};
+
 class DoubleSoundViEnvironment {
    public:
     typedef double ValueType;
@@ -63,6 +119,20 @@ class DoubleIntervalIterationEnvironment {
     }
 };
 
+class DoubleIntervalIterationMixedPrecisionEnvironment {
+   public:
+    typedef double ValueType;
+    static const bool isExact = false;
+    static storm::Environment createEnvironment() {
+        storm::Environment env;
+        env.solver().minMax().setMethod(storm::solver::MinMaxMethod::IntervalIteration);
+        env.solver().setForceSoundness(true);
+        env.solver().minMax().setPrecision(storm::utility::convertNumber<storm::RationalNumber>(1e-6));
+        env.solver().minMax().setMixedPrecision(true);
+        return env;
+    }
+};
+
 class DoubleOptimisticViEnvironment {
    public:
     typedef double ValueType;
@@ -76,6 +146,34 @@ class DoubleOptimisticViEnvironment {
     }
 };
 
+class DoubleIntervalIterationPrioritizedEnvironment {
+   public:
+    typedef double ValueType;
+    static const bool isExact = false;
+    static storm::Environment createEnvironment() {
+        storm::Environment env;
+        env.solver().minMax().setMethod(storm::solver::MinMaxMethod::IntervalIteration);
+        env.solver().setForceSoundness(true);
+        env.solver().minMax().setPrecision(storm::utility::convertNumber<storm::RationalNumber>(1e-6));
+        env.solver().minMax().setPrioritized(true);
+        return env;
+    }
+};
+
+class DoubleOptimisticViPipelinedEnvironment {
+   public:
+    typedef double ValueType;
+    static const bool isExact = false;
+    static storm::Environment createEnvironment() {
+        storm::Environment env;
+        env.solver().minMax().setMethod(storm::solver::MinMaxMethod::OptimisticValueIteration);
+        env.solver().setForceSoundness(true);
+        env.solver().minMax().setPrecision(storm::utility::convertNumber<storm::RationalNumber>(1e-6));
+        env.solver().ovi().setPipelined(true);
+        return env;
+    }
+};
+
 class DoubleTopologicalViEnvironment {
    public:
     typedef double ValueType;
@@ -103,6 +201,31 @@ class DoublePIEnvironment {
         return env;
     }
 };
+class DoubleModifiedPIEnvironment {
+   public:
+    typedef double ValueType;
+    static const bool isExact = false;
+    static storm::Environment createEnvironment() {
+        storm::Environment env;
+        env.solver().minMax().setMethod(storm::solver::MinMaxMethod::PolicyIteration);
+        env.solver().minMax().setPrecision(storm::utility::convertNumber<storm::RationalNumber>(1e-8));
+        env.solver().minMax().setPolicyEvaluationSweeps(5);
+        return env;
+    }
+};
+class DoubleModifiedPIParallelEnvironment {
+   public:
+    typedef double ValueType;
+    static const bool isExact = false;
+    static storm::Environment createEnvironment() {
+        storm::Environment env;
+        env.solver().minMax().setMethod(storm::solver::MinMaxMethod::PolicyIteration);
+        env.solver().minMax().setPrecision(storm::utility::convertNumber<storm::RationalNumber>(1e-8));
+        env.solver().minMax().setPolicyEvaluationSweeps(5);
+        env.solver().setUseIntelTbb(true);
+        return env;
+    }
+};
 class RationalPIEnvironment {
    public:
     typedef storm::RationalNumber ValueType;
@@ -123,6 +246,17 @@ class RationalRationalSearchEnvironment {
         return env;
     }
 };
+class RationalRationalSearchParallelEnvironment {
+   public:
+    typedef storm::RationalNumber ValueType;
+    static const bool isExact = true;
+    static storm::Environment createEnvironment() {
+        storm::Environment env;
+        env.solver().minMax().setMethod(storm::solver::MinMaxMethod::RationalSearch);
+        env.solver().setUseIntelTbb(true);
+        return env;
+    }
+};
 
 template<typename TestType>
 class MinMaxLinearEquationSolverTest : public ::testing::Test {
@@ -143,9 +277,12 @@ class MinMaxLinearEquationSolverTest : public ::testing::Test {
     storm::Environment _environment;
 };
 
-typedef ::testing::Types<DoubleViEnvironment, DoubleViRegMultEnvironment, DoubleSoundViEnvironment, DoubleIntervalIterationEnvironment,
-                         DoubleOptimisticViEnvironment, DoubleTopologicalViEnvironment, DoublePIEnvironment, RationalPIEnvironment,
-                         RationalRationalSearchEnvironment>
+typedef ::testing::Types<DoubleViEnvironment, DoubleViRegMultEnvironment, DoubleViParallelEnvironment, DoubleViMixedPrecisionEnvironment,
+                         DoubleViPrioritizedEnvironment, DoubleViPrioritizedParallelEnvironment, DoubleSoundViEnvironment,
+                         DoubleIntervalIterationEnvironment, DoubleIntervalIterationMixedPrecisionEnvironment, DoubleIntervalIterationPrioritizedEnvironment,
+                         DoubleOptimisticViEnvironment, DoubleOptimisticViPipelinedEnvironment, DoubleTopologicalViEnvironment, DoublePIEnvironment,
+                         DoubleModifiedPIEnvironment, DoubleModifiedPIParallelEnvironment, RationalPIEnvironment, RationalRationalSearchEnvironment,
+                         RationalRationalSearchParallelEnvironment>
     TestingTypes;
 
 TYPED_TEST_SUITE(MinMaxLinearEquationSolverTest, TestingTypes, );
@@ -177,4 +314,112 @@ TYPED_TEST(MinMaxLinearEquationSolverTest, SolveEquations) {
     ASSERT_NO_THROW(solver->solveEquations(this->env(), storm::OptimizationDirection::Maximize, x, b));
     EXPECT_NEAR(x[0], this->parseNumber("0.99"), this->precision());
 }
+
+TYPED_TEST(MinMaxLinearEquationSolverTest, SolveEquationsWithSession) {
+    typedef typename TestFixture::ValueType ValueType;
+
+    storm::storage::SparseMatrixBuilder<ValueType> builder(0, 0, 0, false, true);
+    ASSERT_NO_THROW(builder.newRowGroup(0));
+    ASSERT_NO_THROW(builder.addNextValue(0, 0, this->parseNumber("0.9")));
+
+    storm::storage::SparseMatrix<ValueType> A;
+    ASSERT_NO_THROW(A = builder.build(2));
+
+    storm::solver::MinMaxLinearEquationSolverSession<ValueType> session(this->env(), A, true, true);
+    auto req = session.getRequirements();
+    req.clearBounds();
+    ASSERT_FALSE(req.hasEnabledRequirement());
+    session.setUseLastSchedulerAsInitialScheduler();
+    EXPECT_FALSE(session.hasLastScheduler());
+
+    std::vector<ValueType> x(1);
+    std::vector<ValueType> b = {this->parseNumber("0.099"), this->parseNumber("0.5")};
+    ValueType const lower = this->parseNumber("0");
+    ValueType const upper = this->parseNumber("2");
+    ASSERT_NO_THROW(session.solve(this->env(), storm::OptimizationDirection::Minimize, x, b, lower, upper));
+    EXPECT_NEAR(x[0], this->parseNumber("0.5"), this->precision());
+    ASSERT_TRUE(session.hasLastScheduler());
+    EXPECT_EQ(1ull, session.getLastScheduler()[0]);
+
+    ASSERT_NO_THROW(session.solve(this->env(), storm::OptimizationDirection::Maximize, x, b, lower, upper));
+    EXPECT_NEAR(x[0], this->parseNumber("0.99"), this->precision());
+    EXPECT_EQ(0ull, session.getLastScheduler()[0]);
+
+    // Solve again with a different offset vector.
+    b = {this->parseNumber("0.05"), this->parseNumber("0.2")};
+    ASSERT_NO_THROW(session.solve(this->env(), storm::OptimizationDirection::Maximize, x, b, lower, upper));
+    EXPECT_NEAR(x[0], this->parseNumber("0.5"), this->precision());
+    EXPECT_EQ(0ull, session.getLastScheduler()[0]);
+
+    ASSERT_NO_THROW(session.solve(this->env(), storm::OptimizationDirection::Minimize, x, b, lower, upper));
+    EXPECT_NEAR(x[0], this->parseNumber("0.2"), this->precision());
+    EXPECT_EQ(1ull, session.getLastScheduler()[0]);
+
+    EXPECT_EQ(A.getEntryCount(), session.getBackwardTransitions().getEntryCount());
+}
+
+class RecordingTelemetry : public storm::solver::SolverTelemetry {
+   public:
+    virtual void iterationCompleted(char const*, uint64_t iteration, double residual, double) override {
+        iterations.push_back(iteration);
+        residuals.push_back(residual);
+    }
+
+    virtual void sccSolved(uint64_t numberOfStates, uint64_t iterations, double) override {
+        sccs.emplace_back(numberOfStates, iterations);
+    }
+
+    std::vector<uint64_t> iterations;
+    std::vector<double> residuals;
+    std::vector<std::pair<uint64_t, uint64_t>> sccs;
+};
+
+TEST(MinMaxLinearEquationSolverTelemetryTest, ValueIterationAndTopological) {
+    // States 0 and 1 form an SCC, state 2 moves to state 0.
+    storm::storage::SparseMatrixBuilder<double> builder(0, 0, 0, false, true);
+    ASSERT_NO_THROW(builder.newRowGroup(0));
+    ASSERT_NO_THROW(builder.addNextValue(0, 0, 0.4));
+    ASSERT_NO_THROW(builder.addNextValue(0, 1, 0.5));
+    ASSERT_NO_THROW(builder.newRowGroup(1));
+    ASSERT_NO_THROW(builder.addNextValue(1, 0, 0.5));
+    ASSERT_NO_THROW(builder.addNextValue(1, 1, 0.4));
+    ASSERT_NO_THROW(builder.newRowGroup(2));
+    ASSERT_NO_THROW(builder.addNextValue(2, 0, 1.0));
+    storm::storage::SparseMatrix<double> A;
+    ASSERT_NO_THROW(A = builder.build(3, 3, 3));
+    std::vector<double> b = {0.1, 0.1, 0.0};
+
+    storm::Environment env = DoubleViEnvironment::createEnvironment();
+    auto telemetry = std::make_shared<RecordingTelemetry>();
+    env.solver().setTelemetry(telemetry);
+    auto solveAndCheck = [&]() {
+        auto solver = storm::solver::GeneralMinMaxLinearEquationSolverFactory<double>().create(env, A);
+        solver->setHasUniqueSolution(true);
+        solver->setHasNoEndComponents(true);
+        solver->setBounds(0.0, 2.0);
+        solver->setRequirementsChecked();
+        std::vector<double> x(3);
+        ASSERT_NO_THROW(solver->solveEquations(env, storm::OptimizationDirection::Maximize, x, b));
+        EXPECT_NEAR(1.0, x[0], 1e-6);
+        EXPECT_NEAR(1.0, x[2], 1e-6);
+    };
+
+    solveAndCheck();
+    ASSERT_FALSE(telemetry->iterations.empty());
+    for (uint64_t i = 0; i < telemetry->iterations.size(); ++i) {
+        EXPECT_EQ(i + 1, telemetry->iterations[i]);
+    }
+    EXPECT_LE(telemetry->residuals.back(), 1e-8);
+    EXPECT_GT(telemetry->residuals.front(), telemetry->residuals.back());
+    EXPECT_TRUE(telemetry->sccs.empty());
+
+    // The topological solver reports the non-trivial SCC together with the iterations of the underlying solver.
+    *telemetry = RecordingTelemetry();
+    env.solver().minMax().setMethod(storm::solver::MinMaxMethod::Topological);
+    env.solver().topological().setUnderlyingMinMaxMethod(storm::solver::MinMaxMethod::ValueIteration);
+    solveAndCheck();
+    ASSERT_EQ(1ull, telemetry->sccs.size());
+    EXPECT_EQ(2ull, telemetry->sccs.front().first);
+    EXPECT_EQ(telemetry->iterations.size(), telemetry->sccs.front().second);
+}
 }  // namespace
@@ -2,6 +2,7 @@
 #include "test/storm_gtest.h"
 
 #include "storm/environment/solver/MultiplierEnvironment.h"
+#include "storm/environment/solver/SolverEnvironment.h"
 #include "storm/solver/multiplier/Multiplier.h"
 #include "storm/storage/SparseMatrix.h"
 
@@ -19,6 +20,53 @@ class NativeEnvironment {
     }
 };
 
+class NativeParallelEnvironment {
+   public:
+    typedef double ValueType;
+    static const bool isExact = false;
+    static storm::Environment createEnvironment() {
+        storm::Environment env;
+        env.solver().multiplier().setType(storm::solver::MultiplierType::Native);
+        env.solver().setUseIntelTbb(true);
+        return env;
+    }
+};
+
+class NativeCompactEnvironment {
+   public:
+    typedef double ValueType;
+    static const bool isExact = false;
+    static storm::Environment createEnvironment() {
+        storm::Environment env;
+        env.solver().multiplier().setType(storm::solver::MultiplierType::Native);
+        env.solver().multiplier().setUseCompactMatrix(true);
+        return env;
+    }
+};
+
+class SlicedEnvironment {
+   public:
+    typedef double ValueType;
+    static const bool isExact = false;
+    static storm::Environment createEnvironment() {
+        storm::Environment env;
+        env.solver().multiplier().setType(storm::solver::MultiplierType::Sliced);
+        return env;
+    }
+};
+
+class SlicedParallelEnvironment {
+   public:
+    typedef double ValueType;
+    static const bool isExact = false;
+    static storm::Environment createEnvironment() {
+        storm::Environment env;
+        env.solver().multiplier().setType(storm::solver::MultiplierType::Sliced);
+        env.solver().setUseIntelTbb(true);
+        return env;
+    }
+};
+
 class GmmxxEnvironment {
    public:
     typedef double ValueType;
@@ -49,7 +97,8 @@ class MultiplierTest : public ::testing::Test {
     storm::Environment _environment;
 };
 
-typedef ::testing::Types<NativeEnvironment, GmmxxEnvironment> TestingTypes;
+typedef ::testing::Types<NativeEnvironment, NativeParallelEnvironment, NativeCompactEnvironment, SlicedEnvironment, SlicedParallelEnvironment,
+                         GmmxxEnvironment> TestingTypes;
 
 TYPED_TEST_SUITE(MultiplierTest, TestingTypes, );
 
@@ -78,6 +127,37 @@ TYPED_TEST(MultiplierTest, repeatedMultiplyTest) {
     EXPECT_NEAR(x[0], this->parseNumber("1"), this->precision());
 }
 
+TYPED_TEST(MultiplierTest, multiplyGaussSeidelTest) {
+    typedef typename TestFixture::ValueType ValueType;
+    storm::storage::SparseMatrixBuilder<ValueType> builder;
+    ASSERT_NO_THROW(builder.addNextValue(0, 1, this->parseNumber("0.5")));
+    ASSERT_NO_THROW(builder.addNextValue(0, 4, this->parseNumber("0.5")));
+    ASSERT_NO_THROW(builder.addNextValue(1, 2, this->parseNumber("0.5")));
+    ASSERT_NO_THROW(builder.addNextValue(1, 4, this->parseNumber("0.5")));
+    ASSERT_NO_THROW(builder.addNextValue(2, 3, this->parseNumber("0.5")));
+    ASSERT_NO_THROW(builder.addNextValue(2, 4, this->parseNumber("0.5")));
+    ASSERT_NO_THROW(builder.addNextValue(3, 4, this->parseNumber("1")));
+    ASSERT_NO_THROW(builder.addNextValue(4, 4, this->parseNumber("1")));
+
+    storm::storage::SparseMatrix<ValueType> A;
+    ASSERT_NO_THROW(A = builder.build());
+
+    auto factory = storm::solver::MultiplierFactory<ValueType>();
+    auto multiplier = factory.create(this->env(), A);
+
+    // The number of sweeps required depends on the order in which the rows are processed. Four sweeps suffice for any order.
+    for (bool backwards : {true, false}) {
+        std::vector<ValueType> x(5);
+        x[4] = this->parseNumber("1");
+        for (uint64_t i = 0; i < 4; ++i) {
+            ASSERT_NO_THROW(multiplier->multiplyGaussSeidel(this->env(), x, nullptr, backwards));
+        }
+        for (auto const& value : x) {
+            EXPECT_NEAR(value, this->parseNumber("1"), this->precision());
+        }
+    }
+}
+
 TYPED_TEST(MultiplierTest, repeatedMultiplyAndReduceTest) {
     typedef typename TestFixture::ValueType ValueType;
 
@@ -123,4 +203,46 @@ TYPED_TEST(MultiplierTest, repeatedMultiplyAndReduceTest) {
     EXPECT_NEAR(x[0], this->parseNumber("0.923808265834023387639"), this->precision());
 }
 
+TYPED_TEST(MultiplierTest, multiplyAndReduceGaussSeidelTest) {
+    typedef typename TestFixture::ValueType ValueType;
+
+    storm::storage::SparseMatrixBuilder<ValueType> builder(0, 0, 0, false, true);
+    ASSERT_NO_THROW(builder.newRowGroup(0));
+    ASSERT_NO_THROW(builder.addNextValue(0, 0, this->parseNumber("0.9")));
+    ASSERT_NO_THROW(builder.addNextValue(0, 1, this->parseNumber("0.099")));
+    ASSERT_NO_THROW(builder.addNextValue(0, 2, this->parseNumber("0.001")));
+    ASSERT_NO_THROW(builder.addNextValue(1, 1, this->parseNumber("0.5")));
+    ASSERT_NO_THROW(builder.addNextValue(1, 2, this->parseNumber("0.5")));
+    ASSERT_NO_THROW(builder.newRowGroup(2));
+    ASSERT_NO_THROW(builder.addNextValue(2, 1, this->parseNumber("1")));
+    ASSERT_NO_THROW(builder.newRowGroup(3));
+    ASSERT_NO_THROW(builder.addNextValue(3, 2, this->parseNumber("1")));
+
+    storm::storage::SparseMatrix<ValueType> A;
+    ASSERT_NO_THROW(A = builder.build());
+
+    std::vector<ValueType> initialX = {this->parseNumber("0"), this->parseNumber("1"), this->parseNumber("0")};
+    std::vector<ValueType> x;
+    std::vector<uint_fast64_t> choices(3, 0);
+
+    auto factory = storm::solver::MultiplierFactory<ValueType>();
+    auto multiplier = factory.create(this->env(), A);
+
+    x = initialX;
+    for (uint64_t i = 0; i < 20; ++i) {
+        ASSERT_NO_THROW(multiplier->multiplyAndReduceGaussSeidel(this->env(), storm::OptimizationDirection::Minimize, A.getRowGroupIndices(), x, nullptr,
+                                                                 &choices));
+    }
+    EXPECT_NEAR(x[0], this->parseNumber("0.5"), this->precision());
+    EXPECT_EQ(1ull, choices[0]);
+
+    x = initialX;
+    for (uint64_t i = 0; i < 20; ++i) {
+        ASSERT_NO_THROW(multiplier->multiplyAndReduceGaussSeidel(this->env(), storm::OptimizationDirection::Maximize, A.getRowGroupIndices(), x, nullptr,
+                                                                 &choices, false));
+    }
+    EXPECT_NEAR(x[0], this->parseNumber("0.923808265834023387639"), this->precision());
+    EXPECT_EQ(0ull, choices[0]);
+}
+
 }  // namespace
\ No newline at end of file
@@ -0,0 +1,43 @@
+#include "storm-config.h"
+#include "test/storm_gtest.h"
+
+#include "storm-parsers/parser/ValueParser.h"
+#include "storm/adapters/RationalFunctionAdapter.h"
+#include "storm/solver/stateelimination/OperationCache.h"
+#include "storm/utility/constants.h"
+
+TEST(OperationCacheTest, RationalFunction) {
+    storm::parser::ValueParser<storm::RationalFunction> parser;
+    parser.addParameter("p");
+    parser.addParameter("q");
+    auto p = parser.parseValue("p");
+    auto q = parser.parseValue("q");
+    auto oneMinusP = parser.parseValue("1-p");
+
+    storm::solver::stateelimination::OperationCache<storm::RationalFunction> cache;
+    auto product = cache.multiply(p, oneMinusP);
+    EXPECT_EQ(storm::utility::simplify((storm::RationalFunction)(p * oneMinusP)), product);
+    EXPECT_EQ(product, cache.multiply(p, oneMinusP));
+    EXPECT_EQ(storm::utility::simplify((storm::RationalFunction)(p + q)), cache.add(p, q));
+    EXPECT_EQ(storm::utility::simplify((storm::RationalFunction)(storm::utility::one<storm::RationalFunction>() / oneMinusP)), cache.inverseOfOneMinus(p));
+    EXPECT_EQ(1ull, cache.getNumberOfHits());
+    EXPECT_EQ(3ull, cache.getNumberOfMisses());
+
+    // Results are recomputed once the cache is full.
+    storm::solver::stateelimination::OperationCache<storm::RationalFunction> smallCache(1);
+    smallCache.multiply(p, q);
+    smallCache.multiply(p, oneMinusP);
+    EXPECT_EQ(storm::utility::simplify((storm::RationalFunction)(p * q)), smallCache.multiply(p, q));
+    EXPECT_EQ(0ull, smallCache.getNumberOfHits());
+}
+
+TEST(OperationCacheTest, Double) {
+    storm::solver::stateelimination::OperationCache<double> cache;
+    EXPECT_EQ(0.25, cache.multiply(0.5, 0.5));
+    EXPECT_EQ(0.25, cache.multiply(0.5, 0.5));
+    EXPECT_EQ(1.0, cache.add(0.5, 0.5));
+    EXPECT_EQ(2.0, cache.inverseOfOneMinus(0.5));
+    // Doubles are not cached.
+    EXPECT_EQ(0ull, cache.getNumberOfHits());
+    EXPECT_EQ(0ull, cache.getNumberOfMisses());
+}
@@ -0,0 +1,64 @@
+#include "storm-config.h"
+#include "test/storm_gtest.h"
+
+#ifdef STORM_HAVE_Z3
+#include "storm/solver/PortfolioSmtSolver.h"
+#include "storm/solver/Z3SmtSolver.h"
+
+namespace {
+std::unique_ptr<storm::solver::PortfolioSmtSolver> createPortfolio(storm::expressions::ExpressionManager& manager) {
+    std::vector<std::unique_ptr<storm::solver::SmtSolver>> solvers;
+    solvers.push_back(std::make_unique<storm::solver::Z3SmtSolver>(manager));
+    solvers.push_back(std::make_unique<storm::solver::Z3SmtSolver>(manager));
+    return std::make_unique<storm::solver::PortfolioSmtSolver>(manager, std::move(solvers));
+}
+}  // namespace
+
+TEST(PortfolioSmtSolver, Backtracking) {
+    std::shared_ptr<storm::expressions::ExpressionManager> manager(new storm::expressions::ExpressionManager());
+    auto s = createPortfolio(*manager);
+    storm::solver::SmtSolver::CheckResult result = storm::solver::SmtSolver::CheckResult::Unknown;
+
+    storm::expressions::Expression expr1 = manager->boolean(true);
+    storm::expressions::Expression expr2 = manager->boolean(false);
+
+    ASSERT_NO_THROW(s->add(expr1));
+    ASSERT_NO_THROW(result = s->check());
+    ASSERT_TRUE(result == storm::solver::SmtSolver::CheckResult::Sat);
+    ASSERT_NO_THROW(s->push());
+    ASSERT_NO_THROW(s->add(expr2));
+    ASSERT_NO_THROW(result = s->check());
+    ASSERT_TRUE(result == storm::solver::SmtSolver::CheckResult::Unsat);
+    ASSERT_NO_THROW(s->pop());
+    ASSERT_NO_THROW(result = s->check());
+    ASSERT_TRUE(result == storm::solver::SmtSolver::CheckResult::Sat);
+}
+
+TEST(PortfolioSmtSolver, AssumptionsAndModel) {
+    std::shared_ptr<storm::expressions::ExpressionManager> manager(new storm::expressions::ExpressionManager());
+    auto s = createPortfolio(*manager);
+    storm::solver::SmtSolver::CheckResult result = storm::solver::SmtSolver::CheckResult::Unknown;
+
+    storm::expressions::Variable a = manager->declareIntegerVariable("a");
+    storm::expressions::Variable b = manager->declareIntegerVariable("b");
+    storm::expressions::Variable c = manager->declareIntegerVariable("c");
+    storm::expressions::Expression exprFormula =
+        a > manager->integer(0) && a < manager->integer(5) && b > manager->integer(7) && c == a + b - manager->integer(1) && b + a > c;
+    storm::expressions::Variable f2 = manager->declareBooleanVariable("f2");
+    storm::expressions::Expression exprFormula2 = storm::expressions::implies(f2, c > a + b + manager->integer(1));
+
+    ASSERT_NO_THROW(s->add(exprFormula));
+    ASSERT_NO_THROW(s->add(exprFormula2));
+    ASSERT_NO_THROW(result = s->checkWithAssumptions({f2}));
+    ASSERT_TRUE(result == storm::solver::SmtSolver::CheckResult::Unsat);
+    ASSERT_NO_THROW(result = s->checkWithAssumptions({!f2}));
+    ASSERT_TRUE(result == storm::solver::SmtSolver::CheckResult::Sat);
+    EXPECT_LT(s->getIndexOfLastAnsweringSolver(), 2u);
+
+    std::shared_ptr<storm::solver::SmtSolver::ModelReference> model = s->getModel();
+    int_fast64_t aEval = model->getIntegerValue(a);
+    int_fast64_t bEval = model->getIntegerValue(b);
+    int_fast64_t cEval = model->getIntegerValue(c);
+    EXPECT_EQ(aEval + bEval - 1, cEval);
+}
+#endif
@@ -1,6 +1,7 @@
 #include "test/storm_gtest.h"
 
 #include <cstdint>
+#include <filesystem>
 
 #include "storm/storage/BitVector.h"
 #include "storm/storage/BitVectorHashMap.h"
@@ -67,3 +68,33 @@ TEST(BitVectorHashMapTest, FindOrAdd) {
     EXPECT_EQ(5ul, map.findOrAdd(fifth, 0));
     EXPECT_EQ(6ul, map.findOrAdd(sixth, 0));
 }
+
+TEST(BitVectorHashMapTest, FileBackedStorage) {
+    std::string directory = std::filesystem::temp_directory_path().string();
+    storm::storage::BitVectorHashMap<uint64_t> map(128, 3, 0.75, directory);
+    storm::storage::BitVectorHashMap<uint64_t> inMemoryMap(128, 3);
+
+    // Insert enough keys to trigger several resizings.
+    for (uint64_t number = 0; number < 5000; ++number) {
+        storm::storage::BitVector key(128);
+        key.setFromInt(0, 64, number);
+        key.setFromInt(64, 64, number * 31);
+        EXPECT_EQ(number, map.findOrAdd(key, number));
+        inMemoryMap.findOrAdd(key, number);
+    }
+    EXPECT_EQ(5000ul, map.size());
+
+    storm::storage::BitVector key(128);
+    key.setFromInt(0, 64, 42);
+    key.setFromInt(64, 64, 42 * 31);
+    EXPECT_TRUE(map.contains(key));
+    EXPECT_EQ(42ul, map.findOrAdd(key, 0));
+    EXPECT_EQ(42ul, map.getValue(key));
+
+    // Copies are independent of the original map.
+    auto copy = map;
+    for (auto const& keyValuePair : map) {
+        EXPECT_EQ(inMemoryMap.getValue(keyValuePair.first), keyValuePair.second);
+        EXPECT_EQ(keyValuePair.second, copy.getValue(keyValuePair.first));
+    }
+}
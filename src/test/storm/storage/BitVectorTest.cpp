@@ -644,3 +644,61 @@ TEST(BitVectorTest, Assignment) {
     v1.set(9999);
     ASSERT_TRUE(v1.get(9999));
 }
+
+TEST(BitVectorTest, BulkOperations) {
+    // Large enough to use the vectorized kernels (if available) and not a multiple of the vector width.
+    uint64_t const size = 64 * 37 + 5;
+    storm::storage::BitVector a(size), b(size), c(size);
+    for (uint64_t i = 0; i < size; ++i) {
+        a.set(i, i % 3 == 0);
+        b.set(i, i % 5 == 0 || i % 7 == 0);
+        c.set(i, i % 2 == 0);
+    }
+
+    storm::storage::BitVector conjunction = a & b;
+    storm::storage::BitVector disjunction = a | b;
+    storm::storage::BitVector exclusiveDisjunction = a ^ b;
+    storm::storage::BitVector negation = ~a;
+    storm::storage::BitVector implication = a.implies(b);
+    storm::storage::BitVector difference(a);
+    difference.andNot(b);
+    storm::storage::BitVector fused(a);
+    fused.andImplication(b, c);
+    uint64_t numberOfSetBits = 0;
+    for (uint64_t i = 0; i < size; ++i) {
+        ASSERT_EQ(a.get(i) && b.get(i), conjunction.get(i));
+        ASSERT_EQ(a.get(i) || b.get(i), disjunction.get(i));
+        ASSERT_EQ(a.get(i) != b.get(i), exclusiveDisjunction.get(i));
+        ASSERT_EQ(!a.get(i), negation.get(i));
+        ASSERT_EQ(!a.get(i) || b.get(i), implication.get(i));
+        ASSERT_EQ(a.get(i) && !b.get(i), difference.get(i));
+        ASSERT_EQ(a.get(i) && (!b.get(i) || c.get(i)), fused.get(i));
+        if (a.get(i)) {
+            ++numberOfSetBits;
+        }
+    }
+    EXPECT_EQ(numberOfSetBits, a.getNumberOfSetBits());
+    EXPECT_EQ(size - numberOfSetBits, negation.getNumberOfSetBits());
+    storm::storage::BitVector prefix(size);
+    prefix.setMultiple(0, 1000);
+    EXPECT_EQ(a.getNumberOfSetBitsBeforeIndex(1000), (a & prefix).getNumberOfSetBits());
+}
+
+TEST(BitVectorTest, ForEachSetIndex) {
+    storm::storage::BitVector vector(200, {0, 1, 63, 64, 65, 127, 150, 199});
+    std::vector<uint64_t> indices;
+    vector.forEachSetIndex([&indices](uint64_t index) { indices.push_back(index); });
+    EXPECT_EQ(std::vector<uint64_t>(vector.begin(), vector.end()), indices);
+
+    storm::storage::BitVector empty(100);
+    empty.forEachSetIndex([](uint64_t) { FAIL(); });
+}
+
+TEST(BitVectorTest, SetAtomic) {
+    storm::storage::BitVector vector(130);
+    EXPECT_TRUE(vector.setAtomic(0));
+    EXPECT_TRUE(vector.setAtomic(64));
+    EXPECT_TRUE(vector.setAtomic(129));
+    EXPECT_FALSE(vector.setAtomic(64));
+    EXPECT_EQ(storm::storage::BitVector(130, {0, 64, 129}), vector);
+}
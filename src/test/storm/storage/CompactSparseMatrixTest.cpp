@@ -0,0 +1,87 @@
+#include "storm/storage/CompactSparseMatrix.h"
+#include "storm/storage/SparseMatrix.h"
+#include "test/storm_gtest.h"
+
+namespace {
+
+storm::storage::SparseMatrix<double> buildTestMatrix() {
+    storm::storage::SparseMatrixBuilder<double> matrixBuilder(5, 4, 9);
+    matrixBuilder.addNextValue(0, 1, 1.0);
+    matrixBuilder.addNextValue(0, 2, 1.2);
+    matrixBuilder.addNextValue(1, 0, 0.5);
+    matrixBuilder.addNextValue(1, 1, 0.7);
+    matrixBuilder.addNextValue(2, 0, 0.5);
+    matrixBuilder.addNextValue(3, 2, 1.1);
+    matrixBuilder.addNextValue(4, 0, 0.1);
+    matrixBuilder.addNextValue(4, 1, 0.2);
+    matrixBuilder.addNextValue(4, 3, 0.3);
+    return matrixBuilder.build();
+}
+
+}  // namespace
+
+TEST(CompactSparseMatrix, Creation) {
+    storm::storage::SparseMatrix<double> matrix = buildTestMatrix();
+    for (bool useValueDictionary : {true, false}) {
+        storm::storage::CompactSparseMatrix<double> compactMatrix(matrix, useValueDictionary);
+        EXPECT_EQ(5ul, compactMatrix.getRowCount());
+        EXPECT_EQ(4ul, compactMatrix.getColumnCount());
+        EXPECT_EQ(9ul, compactMatrix.getEntryCount());
+        EXPECT_TRUE(compactMatrix.hasTrivialRowGrouping());
+        EXPECT_EQ(useValueDictionary, compactMatrix.hasValueDictionary());
+
+        for (uint64_t row = 0; row < matrix.getRowCount(); ++row) {
+            auto entryIt = matrix.getRow(row).begin();
+            compactMatrix.forEachEntry(row, [&entryIt](uint32_t column, double value) {
+                EXPECT_EQ(entryIt->getColumn(), column);
+                EXPECT_EQ(entryIt->getValue(), value);
+                ++entryIt;
+            });
+            EXPECT_EQ(matrix.getRow(row).end(), entryIt);
+        }
+    }
+}
+
+TEST(CompactSparseMatrix, MatrixVectorMultiply) {
+    storm::storage::SparseMatrix<double> matrix = buildTestMatrix();
+    storm::storage::CompactSparseMatrix<double> compactMatrix(matrix);
+
+    std::vector<double> x = {1, 0.3, 1.4, 7.1};
+    std::vector<double> b = {0.1, 0.2, 0.3, 0.4, 0.5};
+    std::vector<double> result(matrix.getRowCount());
+    std::vector<double> correctResult(matrix.getRowCount());
+
+    ASSERT_NO_THROW(compactMatrix.multiplyWithVector(x, result, &b));
+    matrix.multiplyWithVector(x, correctResult, &b);
+    for (std::size_t index = 0; index < correctResult.size(); ++index) {
+        EXPECT_NEAR(result[index], correctResult[index], 1e-12);
+    }
+}
+
+TEST(CompactSparseMatrix, MultiplyAndReduce) {
+    storm::storage::SparseMatrixBuilder<double> matrixBuilder(0, 0, 0, false, true);
+    matrixBuilder.newRowGroup(0);
+    matrixBuilder.addNextValue(0, 0, 0.9);
+    matrixBuilder.addNextValue(0, 1, 0.1);
+    matrixBuilder.addNextValue(1, 1, 1.0);
+    matrixBuilder.newRowGroup(2);
+    matrixBuilder.addNextValue(2, 0, 0.5);
+    matrixBuilder.addNextValue(2, 1, 0.5);
+    matrixBuilder.addNextValue(3, 0, 0.1);
+    matrixBuilder.addNextValue(3, 1, 0.9);
+    storm::storage::SparseMatrix<double> matrix = matrixBuilder.build();
+    storm::storage::CompactSparseMatrix<double> compactMatrix(matrix);
+    EXPECT_EQ(2ul, compactMatrix.getRowGroupCount());
+
+    std::vector<double> x = {0.2, 0.7};
+    for (auto dir : {storm::OptimizationDirection::Minimize, storm::OptimizationDirection::Maximize}) {
+        std::vector<double> result(2), correctResult(2);
+        std::vector<uint64_t> choices(2, 0), correctChoices(2, 0);
+        ASSERT_NO_THROW(compactMatrix.multiplyAndReduce(dir, compactMatrix.getRowGroupIndices(), x, nullptr, result, &choices));
+        matrix.multiplyAndReduce(dir, matrix.getRowGroupIndices(), x, nullptr, correctResult, &correctChoices);
+        for (std::size_t index = 0; index < correctResult.size(); ++index) {
+            EXPECT_NEAR(result[index], correctResult[index], 1e-12);
+            EXPECT_EQ(correctChoices[index], choices[index]);
+        }
+    }
+}
@@ -0,0 +1,103 @@
+#include "test/storm_gtest.h"
+
+#include <atomic>
+#include <cstdint>
+#include <thread>
+
+#include "storm/storage/BitVector.h"
+#include "storm/storage/ConcurrentBitVectorHashMap.h"
+
+namespace {
+
+storm::storage::BitVector createKey(uint64_t bucketSize, uint64_t number) {
+    storm::storage::BitVector key(bucketSize);
+    key.setFromInt(0, 64, number);
+    key.setFromInt(bucketSize - 64, 64, number * 7);
+    return key;
+}
+
+TEST(ConcurrentBitVectorHashMapTest, FindOrAdd) {
+    storm::storage::ConcurrentBitVectorHashMap<uint64_t> map(64, 3, 0.75, 2);
+
+    storm::storage::BitVector first(64);
+    first.set(4);
+    first.set(47);
+    EXPECT_EQ(std::make_pair<uint64_t>(1, true), map.findOrAdd(first, 1));
+
+    storm::storage::BitVector second(64);
+    second.set(8);
+    second.set(18);
+    EXPECT_EQ(std::make_pair<uint64_t>(2, true), map.findOrAdd(second, 2));
+
+    EXPECT_EQ(std::make_pair<uint64_t>(1, false), map.findOrAdd(first, 3));
+    EXPECT_EQ(std::make_pair<uint64_t>(2, false), map.findOrAdd(second, 3));
+    EXPECT_EQ(2ul, map.size());
+    EXPECT_TRUE(map.contains(first));
+    EXPECT_EQ(2ul, map.getValue(second));
+
+    // Insert enough keys to trigger resizing of the segments.
+    for (uint64_t number = 0; number < 1000; ++number) {
+        map.findOrAdd(createKey(64, number + 1000), number);
+    }
+    EXPECT_EQ(1002ul, map.size());
+    EXPECT_LE(map.size(), map.capacity());
+    for (uint64_t number = 0; number < 1000; ++number) {
+        EXPECT_EQ(number, map.getValue(createKey(64, number + 1000)));
+    }
+    EXPECT_EQ(1ul, map.getValue(first));
+
+    storm::storage::BitVector third(64);
+    third.set(10);
+    EXPECT_FALSE(map.contains(third));
+
+    auto sequentialMap = map.toBitVectorHashMap();
+    EXPECT_EQ(map.size(), sequentialMap.size());
+    for (auto const& keyValuePair : sequentialMap) {
+        EXPECT_EQ(map.getValue(keyValuePair.first), keyValuePair.second);
+    }
+}
+
+TEST(ConcurrentBitVectorHashMapTest, ConcurrentInsertion) {
+    uint64_t const bucketSize = 128;
+    uint64_t const numberOfKeys = 20000;
+    uint64_t const numberOfThreads = 4;
+    storm::storage::ConcurrentBitVectorHashMap<uint32_t> map(bucketSize, 10);
+    std::atomic<uint32_t> nextIndex(0);
+
+    // All threads insert the same keys (in different orders). Each key must be inserted exactly once.
+    std::vector<std::thread> threads;
+    std::vector<uint64_t> insertions(numberOfThreads, 0);
+    for (uint64_t thread = 0; thread < numberOfThreads; ++thread) {
+        threads.emplace_back([&, thread]() {
+            for (uint64_t i = 0; i < numberOfKeys; ++i) {
+                uint64_t number = (i * (2 * thread + 1)) % numberOfKeys;
+                auto result = map.findOrAdd(createKey(bucketSize, number), [&nextIndex]() { return nextIndex++; });
+                if (result.second) {
+                    ++insertions[thread];
+                }
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    uint64_t totalInsertions = 0;
+    for (auto const& count : insertions) {
+        totalInsertions += count;
+    }
+    EXPECT_EQ(numberOfKeys, totalInsertions);
+    EXPECT_EQ(numberOfKeys, map.size());
+    EXPECT_EQ(numberOfKeys, nextIndex.load());
+
+    // The indices form a permutation of 0, ..., numberOfKeys-1.
+    storm::storage::BitVector seenIndices(numberOfKeys);
+    for (uint64_t number = 0; number < numberOfKeys; ++number) {
+        auto index = map.getValue(createKey(bucketSize, number));
+        ASSERT_LT(index, numberOfKeys);
+        EXPECT_FALSE(seenIndices.get(index));
+        seenIndices.set(index);
+    }
+}
+
+}  // namespace
@@ -11,6 +11,8 @@
 
 #include "storm/storage/SparseMatrix.h"
 
+#include <sstream>
+
 TEST(CuddDd, AddConstants) {
     std::shared_ptr<storm::dd::DdManager<storm::dd::DdType::CUDD>> manager(new storm::dd::DdManager<storm::dd::DdType::CUDD>());
     storm::dd::Add<storm::dd::DdType::CUDD, double> zero;
@@ -566,6 +568,40 @@ TEST(CuddDd, MultiplyMatrixTest) {
     EXPECT_TRUE(dd3 == dd2 * manager->template getConstant<double>(2));
 }
 
+TEST(CuddDd, OperationStatisticsTest) {
+    std::shared_ptr<storm::dd::DdManager<storm::dd::DdType::CUDD>> manager(new storm::dd::DdManager<storm::dd::DdType::CUDD>());
+    std::pair<storm::expressions::Variable, storm::expressions::Variable> x = manager->addMetaVariable("x", 1, 9);
+
+    storm::dd::Bdd<storm::dd::DdType::CUDD> range = manager->getRange(x.first);
+    storm::dd::Bdd<storm::dd::DdType::CUDD> relation = manager->getRange(x.first) && manager->getRange(x.second);
+
+    storm::dd::DdOperationStatistics& statistics = manager->getOperationStatistics();
+    statistics.setEnabled(true);
+    statistics.reset();
+
+    storm::dd::Bdd<storm::dd::DdType::CUDD> successors = range.relationalProduct(relation, {x.first}, {x.second});
+    storm::dd::Bdd<storm::dd::DdType::CUDD> projected = range.andExists(relation, {x.first});
+    storm::dd::Add<storm::dd::DdType::CUDD, double> values = range.template toAdd<double>() + range.template toAdd<double>();
+    storm::dd::Add<storm::dd::DdType::CUDD, double> selected = range.ite(values, manager->template getAddZero<double>());
+
+    EXPECT_TRUE(successors == range);
+    EXPECT_TRUE(projected == manager->getRange(x.second));
+    EXPECT_EQ(1ul, statistics.getNumberOfOperations(storm::dd::DdOperationType::RelationalProduct));
+    EXPECT_EQ(1ul, statistics.getNumberOfOperations(storm::dd::DdOperationType::AndExists));
+    EXPECT_EQ(1ul, statistics.getNumberOfOperations(storm::dd::DdOperationType::Ite));
+    EXPECT_LE(1ul, statistics.getNumberOfOperations(storm::dd::DdOperationType::Apply));
+    EXPECT_EQ(0ul, statistics.getNumberOfOperations(storm::dd::DdOperationType::MatrixMultiplication));
+
+    std::stringstream stream;
+    ASSERT_NO_THROW(manager->printStatisticsToStream(stream));
+    EXPECT_FALSE(stream.str().empty());
+
+    statistics.setEnabled(false);
+    statistics.reset();
+    successors = range && successors;
+    EXPECT_EQ(0ul, statistics.getNumberOfOperations(storm::dd::DdOperationType::Apply));
+}
+
 TEST(CuddDd, MultiplyMatrixTest2) {
     std::shared_ptr<storm::dd::DdManager<storm::dd::DdType::CUDD>> manager(new storm::dd::DdManager<storm::dd::DdType::CUDD>());
     std::pair<storm::expressions::Variable, storm::expressions::Variable> x = manager->addMetaVariable("x", 0, 2);
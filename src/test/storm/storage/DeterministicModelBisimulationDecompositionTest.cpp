@@ -126,3 +126,70 @@ TEST(DeterministicModelBisimulationDecomposition, Crowds) {
     EXPECT_EQ(65ul, result->getNumberOfStates());
     EXPECT_EQ(105ul, result->getNumberOfTransitions());
 }
+
+TEST(DeterministicModelBisimulationDecomposition, CrowdsParallel) {
+    std::shared_ptr<storm::models::sparse::Model<double>> abstractModel =
+        storm::parser::AutoParser<>::parseModel(STORM_TEST_RESOURCES_DIR "/tra/crowds5_5.tra", STORM_TEST_RESOURCES_DIR "/lab/crowds5_5.lab", "", "");
+
+    ASSERT_EQ(abstractModel->getType(), storm::models::ModelType::Dtmc);
+    std::shared_ptr<storm::models::sparse::Dtmc<double>> dtmc = abstractModel->as<storm::models::sparse::Dtmc<double>>();
+
+    typename storm::storage::DeterministicModelBisimulationDecomposition<storm::models::sparse::Dtmc<double>>::Options options;
+    options.numberOfThreads = 4;
+
+    storm::storage::DeterministicModelBisimulationDecomposition<storm::models::sparse::Dtmc<double>> bisim(*dtmc, options);
+    std::shared_ptr<storm::models::sparse::Model<double>> result;
+    ASSERT_NO_THROW(bisim.computeBisimulationDecomposition());
+    ASSERT_NO_THROW(result = bisim.getQuotient());
+
+    EXPECT_EQ(storm::models::ModelType::Dtmc, result->getType());
+    EXPECT_EQ(334ul, result->getNumberOfStates());
+    EXPECT_EQ(546ul, result->getNumberOfTransitions());
+
+    storm::parser::FormulaParser formulaParser;
+    std::shared_ptr<storm::logic::Formula const> formula = formulaParser.parseSingleFormulaFromString("P=? [F \"observe0Greater1\"]");
+
+    typename storm::storage::DeterministicModelBisimulationDecomposition<storm::models::sparse::Dtmc<double>>::Options options2(*dtmc, *formula);
+    options2.numberOfThreads = 4;
+
+    storm::storage::DeterministicModelBisimulationDecomposition<storm::models::sparse::Dtmc<double>> bisim2(*dtmc, options2);
+    ASSERT_NO_THROW(bisim2.computeBisimulationDecomposition());
+    ASSERT_NO_THROW(result = bisim2.getQuotient());
+
+    EXPECT_EQ(storm::models::ModelType::Dtmc, result->getType());
+    EXPECT_EQ(64ul, result->getNumberOfStates());
+    EXPECT_EQ(104ul, result->getNumberOfTransitions());
+}
+
+TEST(DeterministicModelBisimulationDecomposition, Approximate) {
+    // States 1 and 2 move to the "a" state 3 with almost the same probability, so they are only related approximately
+    storm::storage::SparseMatrixBuilder<double> matrixBuilder(5, 5, 8);
+    matrixBuilder.addNextValue(0, 1, 0.5);
+    matrixBuilder.addNextValue(0, 2, 0.5);
+    matrixBuilder.addNextValue(1, 3, 0.3);
+    matrixBuilder.addNextValue(1, 4, 0.7);
+    matrixBuilder.addNextValue(2, 3, 0.3001);
+    matrixBuilder.addNextValue(2, 4, 0.6999);
+    matrixBuilder.addNextValue(3, 3, 1.0);
+    matrixBuilder.addNextValue(4, 4, 1.0);
+    storm::models::sparse::StateLabeling labeling(5);
+    labeling.addLabel("init", storm::storage::BitVector(5, std::vector<uint_fast64_t>({0})));
+    labeling.addLabel("a", storm::storage::BitVector(5, std::vector<uint_fast64_t>({3})));
+    storm::models::sparse::Dtmc<double> dtmc(matrixBuilder.build(), std::move(labeling));
+
+    typename storm::storage::DeterministicModelBisimulationDecomposition<storm::models::sparse::Dtmc<double>>::Options options;
+    options.respectedAtomicPropositions = std::set<std::string>({"a"});
+    options.numberOfThreads = 1;
+
+    storm::storage::DeterministicModelBisimulationDecomposition<storm::models::sparse::Dtmc<double>> bisim(dtmc, options);
+    ASSERT_NO_THROW(bisim.computeBisimulationDecomposition());
+    EXPECT_EQ(5ul, bisim.getQuotient()->getNumberOfStates());
+
+    options.approximationPrecision = 0.01;
+    storm::storage::DeterministicModelBisimulationDecomposition<storm::models::sparse::Dtmc<double>> bisim2(dtmc, options);
+    ASSERT_NO_THROW(bisim2.computeBisimulationDecomposition());
+    std::shared_ptr<storm::models::sparse::Dtmc<double>> result = bisim2.getQuotient();
+    EXPECT_EQ(4ul, result->getNumberOfStates());
+    EXPECT_NEAR(0.0002, bisim2.getApproximationError(), 1e-9);
+    EXPECT_EQ(1ul, result->getStates("a").getNumberOfSetBits());
+}
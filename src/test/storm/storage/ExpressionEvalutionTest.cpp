@@ -1,6 +1,7 @@
 #include "adapters/RationalNumberAdapter.h"
 #include "storage/expressions/OperatorType.h"
 #include "storm-parsers/parser/ExpressionCreator.h"
+#include "storm/storage/expressions/BytecodeExpressionEvaluator.h"
 #include "storm/storage/expressions/Expression.h"
 #include "storm/storage/expressions/ExpressionManager.h"
 #include "storm/storage/expressions/ExprtkExpressionEvaluator.h"
@@ -64,6 +65,47 @@ TEST(ExpressionEvaluation, ExprTkEvaluation) {
     }
 }
 
+TEST(ExpressionEvaluation, BytecodeEvaluation) {
+    std::shared_ptr<storm::expressions::ExpressionManager> manager(new storm::expressions::ExpressionManager());
+
+    storm::expressions::Variable x;
+    storm::expressions::Variable y;
+    storm::expressions::Variable z;
+    ASSERT_NO_THROW(x = manager->declareBooleanVariable("x"));
+    ASSERT_NO_THROW(y = manager->declareIntegerVariable("y"));
+    ASSERT_NO_THROW(z = manager->declareRationalVariable("z"));
+
+    storm::expressions::Expression iteExpression = storm::expressions::ite(x, y + z, manager->integer(3) * z);
+    storm::expressions::Expression guardExpression =
+        (x && y > manager->integer(10)) || storm::expressions::implies(!x, storm::expressions::maximum(z, manager->rational(2.0)) <= manager->integer(4));
+    storm::expressions::Expression predicateExpression = storm::expressions::exactlyOneOf({x, y > manager->integer(500), z > manager->integer(50)});
+    storm::expressions::BytecodeExpressionEvaluator eval(*manager);
+    storm::expressions::SimpleValuation valuation(manager);
+
+    for (int_fast64_t i = 0; i < 1000; ++i) {
+        bool xValue = i % 3 == 0;
+        double zValue = i / static_cast<double>(10);
+        eval.setBooleanValue(x, xValue);
+        eval.setIntegerValue(y, i);
+        eval.setRationalValue(z, zValue);
+        valuation.setBooleanValue(x, xValue);
+        valuation.setIntegerValue(y, i);
+        valuation.setRationalValue(z, zValue);
+        EXPECT_NEAR(iteExpression.evaluateAsDouble(&valuation), eval.asRational(iteExpression), 1e-6);
+        EXPECT_EQ(guardExpression.evaluateAsBool(&valuation), eval.asBool(guardExpression));
+        EXPECT_EQ(predicateExpression.evaluateAsBool(&valuation), eval.asBool(predicateExpression));
+    }
+
+    // Evaluate the ite expression for the valuations (x, y) = (true, 1), (false, 2), (true, 3) with z fixed.
+    eval.setRationalValue(z, 5.5);
+    std::vector<double> result;
+    eval.evaluateBatch(iteExpression, {x, y}, {1.0, 1.0, 0.0, 2.0, 1.0, 3.0}, result);
+    ASSERT_EQ(3ul, result.size());
+    EXPECT_NEAR(6.5, result[0], 1e-6);
+    EXPECT_NEAR(16.5, result[1], 1e-6);
+    EXPECT_NEAR(8.5, result[2], 1e-6);
+}
+
 TEST(ExpressionEvaluation, NegativeModulo) {
     std::shared_ptr<storm::expressions::ExpressionManager> manager(new storm::expressions::ExpressionManager());
 
@@ -11,6 +11,7 @@
 #include "storm/storage/expressions/RationalFunctionToExpression.h"
 #include "storm/storage/expressions/SimpleValuation.h"
 #include "storm/storage/expressions/ToRationalFunctionVisitor.h"
+#include "storm/storage/expressions/UniqueExpressionTable.h"
 #include "test/storm_gtest.h"
 
 TEST(Expression, FactoryMethodTest) {
@@ -343,6 +344,35 @@ TEST(Expression, SimplificationTest) {
     EXPECT_TRUE(simplifiedExpression.isFalse());
 }
 
+TEST(Expression, HashConsingTest) {
+    std::shared_ptr<storm::expressions::ExpressionManager> manager(new storm::expressions::ExpressionManager());
+    manager->setHashConsing(true);
+    storm::expressions::Variable x = manager->declareIntegerVariable("x");
+    storm::expressions::Variable y = manager->declareIntegerVariable("y");
+
+    storm::expressions::Expression first = (x + manager->integer(1)) * y > manager->integer(3);
+    storm::expressions::Expression second = (x + manager->integer(1)) * y > manager->integer(3);
+    storm::expressions::Expression third = (x + manager->integer(2)) * y > manager->integer(3);
+    EXPECT_EQ(first.getBaseExpressionPointer(), second.getBaseExpressionPointer());
+    EXPECT_TRUE(first.isSyntacticallyEqual(second));
+    EXPECT_FALSE(first.isSyntacticallyEqual(third));
+
+    // Subexpressions created by substitution are shared as well.
+    std::map<storm::expressions::Variable, storm::expressions::Expression> substitution = {{y, x + manager->integer(1)}};
+    storm::expressions::Expression substituted = (y * y).substitute(substitution);
+    EXPECT_EQ(substituted.getOperand(0).getBaseExpressionPointer(), substituted.getOperand(1).getBaseExpressionPointer());
+    EXPECT_EQ(substituted.getOperand(0).getBaseExpressionPointer(), first.getOperand(0).getOperand(0).getBaseExpressionPointer());
+
+    storm::expressions::Expression simplified = (manager->integer(2) + manager->integer(3)).simplify();
+    EXPECT_EQ(simplified.getBaseExpressionPointer(), manager->integer(5).getBaseExpressionPointer());
+
+    uint64_t numberOfUniqueExpressions = manager->getUniqueExpressionTable().getNumberOfUniqueExpressions();
+    third = manager->boolean(true);
+    manager->getUniqueExpressionTable().removeUnusedExpressions();
+    EXPECT_LT(manager->getUniqueExpressionTable().getNumberOfUniqueExpressions(), numberOfUniqueExpressions);
+    EXPECT_TRUE(first.isSyntacticallyEqual(second));
+}
+
 TEST(Expression, SimpleEvaluationTest) {
     std::shared_ptr<storm::expressions::ExpressionManager> manager(new storm::expressions::ExpressionManager());
 
@@ -179,3 +179,35 @@ TEST(MaximalEndComponentDecomposition, Example2) {
     EXPECT_TRUE((mecDecomposition[1].getChoicesForState(0) == storm::storage::MaximalEndComponent::set_type{0, 1}));
     EXPECT_TRUE((mecDecomposition[1].getChoicesForState(1) == storm::storage::MaximalEndComponent::set_type{3}));
 }
+
+TEST(MaximalEndComponentDecomposition, NestedEndComponents) {
+    // The SCC {0,1,2,3} needs to be refined twice: First, state 3 is removed since it can not stay in the SCC. Afterwards, the choice of state 2 that
+    // leads to state 3 needs to be removed as well.
+    storm::storage::SparseMatrixBuilder<double> builder(6, 5, 8, true, true, 5);
+    builder.newRowGroup(0);
+    builder.addNextValue(0, 1, 1.0);
+    builder.newRowGroup(1);
+    builder.addNextValue(1, 0, 0.5);
+    builder.addNextValue(1, 2, 0.5);
+    builder.newRowGroup(2);
+    builder.addNextValue(2, 1, 1.0);
+    builder.addNextValue(3, 3, 1.0);
+    builder.newRowGroup(4);
+    builder.addNextValue(4, 2, 0.5);
+    builder.addNextValue(4, 4, 0.5);
+    builder.newRowGroup(5);
+    builder.addNextValue(5, 4, 1.0);
+    storm::storage::SparseMatrix<double> matrix = builder.build();
+
+    storm::storage::MaximalEndComponentDecomposition<double> mecDecomposition(matrix, matrix.transpose(true));
+
+    ASSERT_EQ(2ull, mecDecomposition.size());
+
+    ASSERT_TRUE(mecDecomposition[0].getStateSet() == storm::storage::MaximalEndComponent::set_type{4});
+    EXPECT_TRUE(mecDecomposition[0].getChoicesForState(4) == storm::storage::MaximalEndComponent::set_type{5});
+
+    ASSERT_TRUE((mecDecomposition[1].getStateSet() == storm::storage::MaximalEndComponent::set_type{0, 1, 2}));
+    EXPECT_TRUE(mecDecomposition[1].getChoicesForState(0) == storm::storage::MaximalEndComponent::set_type{0});
+    EXPECT_TRUE(mecDecomposition[1].getChoicesForState(1) == storm::storage::MaximalEndComponent::set_type{1});
+    EXPECT_TRUE(mecDecomposition[1].getChoicesForState(2) == storm::storage::MaximalEndComponent::set_type{2});
+}
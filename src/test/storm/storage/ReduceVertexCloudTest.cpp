@@ -0,0 +1,25 @@
+#include "storm-config.h"
+#include "test/storm_gtest.h"
+
+#ifdef STORM_HAVE_Z3
+
+#include "storm/storage/geometry/ReduceVertexCloud.h"
+
+TEST(ReduceVertexCloudTest, Eliminate) {
+    std::vector<std::map<uint64_t, double>> points;
+    points.push_back({{0, 1.0}});
+    points.push_back({{1, 1.0}});
+    points.push_back({{0, 0.5}, {1, 0.5}});
+    points.push_back({{0, 0.2}, {1, 0.2}});
+    points.push_back({{0, 0.9}, {1, 0.9}});
+    points.push_back({{0, 0.5}});
+    points.push_back({{1, 0.5}});
+
+    std::shared_ptr<storm::utility::solver::SmtSolverFactory> smtSolverFactory = std::make_shared<storm::utility::solver::Z3SmtSolverFactory>();
+    storm::storage::geometry::ReduceVertexCloud<double> reduceVertexCloud(smtSolverFactory);
+    auto result = reduceVertexCloud.eliminate(points, 2);
+    EXPECT_FALSE(result.second);
+    EXPECT_EQ(storm::storage::BitVector(7, {0, 1, 4}), result.first);
+}
+
+#endif
@@ -1,4 +1,7 @@
 #include "storm-config.h"
+
+#include <sstream>
+
 #include "storm/exceptions/InvalidOperationException.h"
 #include "storm/storage/Scheduler.h"
 #include "test/storm_gtest.h"
@@ -50,3 +53,16 @@ TEST(SchedulerTest, PartialDeterministicMemorylessScheduler) {
     ASSERT_FALSE(scheduler.getChoice(1).isDefined());
     ASSERT_FALSE(scheduler.getChoice(2).isDefined());
 }
+
+TEST(SchedulerTest, CsvExport) {
+    storm::storage::Scheduler<double> scheduler(3);
+    storm::storage::Distribution<double, uint_fast64_t> distribution;
+    distribution.addProbability(0, 0.25);
+    distribution.addProbability(2, 0.75);
+    ASSERT_NO_THROW(scheduler.setChoice(1, 0));
+    ASSERT_NO_THROW(scheduler.setChoice(distribution, 2));
+
+    std::stringstream stream;
+    scheduler.printCsvToStream(stream);
+    EXPECT_EQ("state,memory,choice,probability\n0,0,1,1\n1,0,,\n2,0,0,0.25\n2,0,2,0.75\n", stream.str());
+}
@@ -5,6 +5,9 @@
 #include "storm/storage/SparseMatrix.h"
 #include "test/storm_gtest.h"
 
+#include <algorithm>
+#include <set>
+
 TEST(SparseMatrixBuilder, CreationWithDimensions) {
     storm::storage::SparseMatrixBuilder<double> matrixBuilder(3, 4, 5);
     ASSERT_NO_THROW(matrixBuilder.addNextValue(0, 1, 1.0));
@@ -95,6 +98,74 @@ TEST(SparseMatrixBuilder, AddNextValue) {
     ASSERT_NO_THROW(matrixBuilder4.addNextValue(3, 1, 0.2));
 }
 
+TEST(SparseMatrixBuilder, AddNextRow) {
+    storm::storage::SparseMatrixBuilder<double> referenceBuilder(3, 4, 5);
+    referenceBuilder.addNextValue(0, 1, 1.0);
+    referenceBuilder.addNextValue(0, 2, 1.2);
+    referenceBuilder.addNextValue(2, 0, 0.5);
+    referenceBuilder.addNextValue(2, 1, 0.7);
+    referenceBuilder.addNextValue(2, 3, 0.2);
+    storm::storage::SparseMatrix<double> reference = referenceBuilder.build();
+
+    // Rows of other matrices are appended in bulk, unsorted rows are handled like single insertions.
+    storm::storage::SparseMatrixBuilder<double> matrixBuilder(3, 4, 5);
+    ASSERT_NO_THROW(matrixBuilder.addNextRow(0, reference.getRow(0)));
+    ASSERT_NO_THROW(matrixBuilder.addNextRow(1, reference.getRow(1)));
+    std::vector<storm::storage::MatrixEntry<uint_fast64_t, double>> row = {{3, 0.2}, {0, 0.5}, {1, 0.7}};
+    ASSERT_NO_THROW(matrixBuilder.addNextRow(2, row));
+    STORM_SILENT_ASSERT_THROW(matrixBuilder.addNextRow(1, reference.getRow(0)), storm::exceptions::InvalidArgumentException);
+    storm::storage::SparseMatrix<double> matrix;
+    ASSERT_NO_THROW(matrix = matrixBuilder.build());
+    ASSERT_TRUE(matrix == reference);
+
+    // A diagonal entry is merged with the entries of the row.
+    storm::storage::SparseMatrixBuilder<double> diagonalBuilder;
+    diagonalBuilder.addDiagonalEntry(0, 1.0);
+    ASSERT_NO_THROW(diagonalBuilder.addNextRow(0, reference.getRow(0)));
+    ASSERT_NO_THROW(matrix = diagonalBuilder.build());
+    ASSERT_EQ(3ul, matrix.getEntryCount());
+    ASSERT_EQ(1.0, matrix.getRow(0).begin()->getValue());
+}
+
+TEST(SparseMatrixBuilder, AppendRows) {
+    storm::storage::SparseMatrixBuilder<double> referenceBuilder(0, 0, 0, false, true);
+    referenceBuilder.newRowGroup(0);
+    referenceBuilder.addNextValue(0, 1, 1.0);
+    referenceBuilder.addNextValue(1, 0, 1.0);
+    referenceBuilder.newRowGroup(2);
+    referenceBuilder.newRowGroup(3);
+    referenceBuilder.addNextValue(3, 0, 0.3);
+    referenceBuilder.addNextValue(3, 2, 0.7);
+    referenceBuilder.addNextValue(4, 2, 1.0);
+    storm::storage::SparseMatrix<double> reference = referenceBuilder.build();
+
+    // Build the row groups in separate builders (as done by parallel workers) and merge them in order.
+    storm::storage::SparseMatrixBuilder<double> firstBuilder(0, 0, 0, false, true);
+    firstBuilder.reserve(2, 2, 1);
+    firstBuilder.newRowGroup(0);
+    firstBuilder.addNextRow(0, reference.getRow(0));
+    firstBuilder.addNextRow(1, reference.getRow(1));
+    storm::storage::SparseMatrixBuilder<double> secondBuilder(0, 0, 0, false, true);
+    secondBuilder.newRowGroup(0);
+    storm::storage::SparseMatrixBuilder<double> thirdBuilder(0, 0, 0, false, true);
+    thirdBuilder.newRowGroup(0);
+    thirdBuilder.addNextRow(0, reference.getRow(3));
+    thirdBuilder.addNextRow(1, reference.getRow(4));
+
+    storm::storage::SparseMatrixBuilder<double> matrixBuilder(0, 0, 0, false, true);
+    matrixBuilder.reserve(5, 5, 3);
+    ASSERT_NO_THROW(matrixBuilder.appendRows(std::move(firstBuilder), 0));
+    ASSERT_NO_THROW(matrixBuilder.appendRows(std::move(secondBuilder), 2));
+    ASSERT_NO_THROW(matrixBuilder.appendRows(std::move(thirdBuilder), 3));
+    storm::storage::SparseMatrix<double> matrix;
+    ASSERT_NO_THROW(matrix = matrixBuilder.build());
+    ASSERT_TRUE(matrix == reference);
+
+    storm::storage::SparseMatrixBuilder<double> trivialBuilder;
+    STORM_SILENT_ASSERT_THROW(trivialBuilder.appendRows(storm::storage::SparseMatrixBuilder<double>(0, 0, 0, false, true), 0),
+                              storm::exceptions::InvalidArgumentException);
+}
+
 TEST(SparseMatrix, Build) {
     storm::storage::SparseMatrixBuilder<double> matrixBuilder1(3, 4, 5);
     ASSERT_NO_THROW(matrixBuilder1.addNextValue(0, 1, 1.0));
@@ -768,6 +839,53 @@ TEST(SparseMatrix, RowSum) {
     ASSERT_EQ(0.1 + 0.2 + 0.3, matrix.getRowSum(4));
 }
 
+TEST(SparseMatrix, RestrictInPlace) {
+    storm::storage::SparseMatrixBuilder<double> matrixBuilder(7, 4, 10, true, true, 3);
+    ASSERT_NO_THROW(matrixBuilder.newRowGroup(0));
+    ASSERT_NO_THROW(matrixBuilder.addNextValue(0, 1, 1.0));
+    ASSERT_NO_THROW(matrixBuilder.addNextValue(0, 2, 1.2));
+    ASSERT_NO_THROW(matrixBuilder.addNextValue(1, 0, 0.5));
+    ASSERT_NO_THROW(matrixBuilder.addNextValue(1, 1, 0.7));
+    ASSERT_NO_THROW(matrixBuilder.newRowGroup(2));
+    ASSERT_NO_THROW(matrixBuilder.addNextValue(2, 0, 0.5));
+    ASSERT_NO_THROW(matrixBuilder.addNextValue(3, 2, 1.1));
+    ASSERT_NO_THROW(matrixBuilder.addNextValue(3, 3, 0.0));
+    ASSERT_NO_THROW(matrixBuilder.newRowGroup(4));
+    ASSERT_NO_THROW(matrixBuilder.addNextValue(4, 0, 0.1));
+    ASSERT_NO_THROW(matrixBuilder.addNextValue(4, 1, 0.2));
+    ASSERT_NO_THROW(matrixBuilder.addNextValue(6, 3, 0.3));
+    storm::storage::SparseMatrix<double> matrix;
+    ASSERT_NO_THROW(matrix = matrixBuilder.build());
+
+    // The second row group is dropped entirely.
+    storm::storage::BitVector rows(7, {0, 1, 4, 6});
+    storm::storage::BitVector columns(4, {0, 1, 3});
+    storm::storage::SparseMatrix<double> restrictedMatrix = matrix;
+    restrictedMatrix.restrictInPlace(rows, columns);
+    EXPECT_EQ(matrix.getSubmatrix(false, rows, columns), restrictedMatrix);
+    EXPECT_EQ(2ull, restrictedMatrix.getRowGroupCount());
+    EXPECT_EQ(6ull, restrictedMatrix.getEntryCount());
+
+    rows = storm::storage::BitVector(7, {1, 3, 5});
+    columns = storm::storage::BitVector(4, true);
+    storm::storage::SparseMatrix<double> expectedMatrix = matrix.getSubmatrix(false, rows, columns);
+    restrictedMatrix = matrix;
+    restrictedMatrix.restrictInPlace(rows, columns);
+    EXPECT_EQ(expectedMatrix, restrictedMatrix);
+    EXPECT_EQ(3ull, restrictedMatrix.getNonzeroEntryCount());
+    expectedMatrix.dropZeroEntries();
+    restrictedMatrix = matrix;
+    restrictedMatrix.restrictInPlace(rows, columns, true);
+    EXPECT_EQ(expectedMatrix, restrictedMatrix);
+    EXPECT_EQ(3ull, restrictedMatrix.getEntryCount());
+
+    matrix.makeRowGroupingTrivial();
+    restrictedMatrix = matrix;
+    restrictedMatrix.restrictInPlace(rows, columns);
+    EXPECT_EQ(matrix.getSubmatrix(false, rows, columns), restrictedMatrix);
+    EXPECT_TRUE(restrictedMatrix.hasTrivialRowGrouping());
+}
+
 TEST(SparseMatrix, IsSubmatrix) {
     storm::storage::SparseMatrixBuilder<double> matrixBuilder(5, 4, 8);
     ASSERT_NO_THROW(matrixBuilder.addNextValue(0, 1, 1.0));
@@ -933,4 +1051,94 @@ TEST(SparseMatrix, DropZeroEntries) {
 
     ASSERT_TRUE(matrixX == matrix4);
     ASSERT_FALSE(matrixX.getEntryCount() == matrix4.getEntryCount());
-}
\ No newline at end of file
+}
+
+TEST(SparseMatrix, SizeInMemory) {
+    storm::storage::SparseMatrixBuilder<double> matrixBuilder(3, 4, 5);
+    ASSERT_NO_THROW(matrixBuilder.addNextValue(0, 1, 1.0));
+    ASSERT_NO_THROW(matrixBuilder.addNextValue(0, 2, 1.2));
+    ASSERT_NO_THROW(matrixBuilder.addNextValue(1, 0, 0.5));
+    ASSERT_NO_THROW(matrixBuilder.addNextValue(1, 1, 0.7));
+    ASSERT_NO_THROW(matrixBuilder.addNextValue(1, 3, 0.2));
+    storm::storage::SparseMatrix<double> matrix;
+    ASSERT_NO_THROW(matrix = matrixBuilder.build());
+
+    uint64_t minimalSize = 5 * sizeof(storm::storage::MatrixEntry<uint_fast64_t, double>) + 4 * sizeof(uint_fast64_t);
+    EXPECT_LE(minimalSize, matrix.getSizeInMemory());
+    EXPECT_GT(minimalSize + 1024, matrix.getSizeInMemory());
+}
+
+TEST(SparseMatrix, LargeMatrixOperations) {
+    // The matrix is large enough to be transposed and restricted in parallel (if TBB is available).
+    uint64_t const numberOfGroups = 40000;
+    storm::storage::SparseMatrixBuilder<double> matrixBuilder(0, numberOfGroups, 0, false, true);
+    uint64_t row = 0;
+    for (uint64_t group = 0; group < numberOfGroups; ++group) {
+        matrixBuilder.newRowGroup(row);
+        for (uint64_t choice = 0; choice < (group % 7 == 0 ? 3 : 2); ++choice, ++row) {
+            std::set<uint64_t> columns;
+            for (uint64_t k = 0; k < 4; ++k) {
+                columns.insert((group * 13 + k * k * 97 + choice) % numberOfGroups);
+            }
+            for (auto column : columns) {
+                matrixBuilder.addNextValue(row, column, 1.0 / columns.size());
+            }
+        }
+    }
+    storm::storage::SparseMatrix<double> matrix = matrixBuilder.build();
+
+    // Transposing, with and without joining the row groups.
+    for (bool joinGroups : {false, true}) {
+        std::vector<std::vector<storm::storage::MatrixEntry<uint64_t, double>>> transposedRows(matrix.getColumnCount());
+        for (uint64_t group = 0; group < matrix.getRowGroupCount(); ++group) {
+            for (uint64_t r = matrix.getRowGroupIndices()[group]; r < matrix.getRowGroupIndices()[group + 1]; ++r) {
+                for (auto const& entry : matrix.getRow(r)) {
+                    transposedRows[entry.getColumn()].emplace_back(joinGroups ? group : r, entry.getValue());
+                }
+            }
+        }
+        std::vector<uint64_t> rowIndications(1, 0);
+        std::vector<storm::storage::MatrixEntry<uint64_t, double>> columnsAndValues;
+        for (auto const& transposedRow : transposedRows) {
+            columnsAndValues.insert(columnsAndValues.end(), transposedRow.begin(), transposedRow.end());
+            rowIndications.push_back(columnsAndValues.size());
+        }
+        storm::storage::SparseMatrix<double> expected(joinGroups ? matrix.getRowGroupCount() : matrix.getRowCount(), std::move(rowIndications),
+                                                      std::move(columnsAndValues), boost::none);
+        EXPECT_EQ(expected, matrix.transpose(joinGroups));
+    }
+
+    // Restricting rows, keeping the first row of each group.
+    storm::storage::BitVector rowsToKeep(matrix.getRowCount(), false);
+    storm::storage::SparseMatrixBuilder<double> restrictedBuilder(0, numberOfGroups, 0, false, true);
+    uint64_t newRow = 0;
+    for (uint64_t group = 0; group < matrix.getRowGroupCount(); ++group) {
+        restrictedBuilder.newRowGroup(newRow);
+        for (uint64_t r = matrix.getRowGroupIndices()[group]; r < matrix.getRowGroupIndices()[group + 1]; ++r) {
+            if (r == matrix.getRowGroupIndices()[group] || r % 3 == 0) {
+                rowsToKeep.set(r);
+                for (auto const& entry : matrix.getRow(r)) {
+                    restrictedBuilder.addNextValue(newRow, entry.getColumn(), entry.getValue());
+                }
+                ++newRow;
+            }
+        }
+    }
+    EXPECT_EQ(restrictedBuilder.build(0, matrix.getColumnCount()), matrix.restrictRows(rowsToKeep));
+
+    // Selecting one row of each group (without inserting diagonal entries).
+    std::vector<uint64_t> selection(matrix.getRowGroupCount());
+    for (uint64_t group = 0; group < selection.size(); ++group) {
+        selection[group] = group % 2;
+    }
+    storm::storage::SparseMatrix<double> selected = matrix.selectRowsFromRowGroups(selection, false);
+    ASSERT_EQ(matrix.getRowGroupCount(), selected.getRowCount());
+    for (uint64_t group = 0; group < selection.size(); ++group) {
+        EXPECT_EQ(matrix.getRow(group, selection[group]).getNumberOfEntries(), selected.getRow(group).getNumberOfEntries());
+        EXPECT_TRUE(std::equal(selected.getRow(group).begin(), selected.getRow(group).end(), matrix.getRow(group, selection[group]).begin()));
+    }
+
+    // Taking the submatrix of all row groups and columns yields the same matrix.
+    storm::storage::BitVector all(numberOfGroups, true);
+    EXPECT_EQ(matrix, matrix.getSubmatrix(true, all, all));
+}
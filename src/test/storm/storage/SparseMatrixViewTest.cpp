@@ -0,0 +1,84 @@
+#include "storm-config.h"
+#include "test/storm_gtest.h"
+
+#include "storm/environment/solver/MinMaxSolverEnvironment.h"
+#include "storm/solver/MinMaxLinearEquationSolver.h"
+#include "storm/solver/SolverSelectionOptions.h"
+#include "storm/storage/SparseMatrix.h"
+#include "storm/storage/SparseMatrixView.h"
+
+namespace {
+
+storm::storage::SparseMatrix<double> buildTestMatrix() {
+    storm::storage::SparseMatrixBuilder<double> matrixBuilder(5, 4, 9, true, true, 4);
+    matrixBuilder.newRowGroup(0);
+    matrixBuilder.addNextValue(0, 1, 0.5);
+    matrixBuilder.addNextValue(0, 2, 0.5);
+    matrixBuilder.addNextValue(1, 0, 0.5);
+    matrixBuilder.addNextValue(1, 3, 0.5);
+    matrixBuilder.newRowGroup(2);
+    matrixBuilder.addNextValue(2, 0, 0.4);
+    matrixBuilder.addNextValue(2, 2, 0.3);
+    matrixBuilder.addNextValue(2, 3, 0.3);
+    matrixBuilder.newRowGroup(3);
+    matrixBuilder.addNextValue(3, 2, 1.0);
+    matrixBuilder.newRowGroup(4);
+    matrixBuilder.addNextValue(4, 3, 1.0);
+    return matrixBuilder.build();
+}
+
+}  // namespace
+
+TEST(SparseMatrixView, Creation) {
+    storm::storage::SparseMatrix<double> matrix = buildTestMatrix();
+    storm::storage::BitVector maybeStates(4, {0, 1});
+    storm::storage::SparseMatrixView<double> view(matrix, maybeStates, maybeStates);
+    storm::storage::SparseMatrix<double> submatrix = matrix.getSubmatrix(true, maybeStates, maybeStates, false);
+
+    EXPECT_EQ(submatrix.getRowCount(), view.getRowCount());
+    EXPECT_EQ(submatrix.getColumnCount(), view.getColumnCount());
+    EXPECT_EQ(submatrix.getEntryCount(), view.getEntryCount());
+    EXPECT_EQ(submatrix.getRowGroupCount(), view.getRowGroupCount());
+    EXPECT_EQ(submatrix.getRowGroupIndices(), view.getRowGroupIndices());
+    EXPECT_FALSE(view.hasTrivialRowGrouping());
+    EXPECT_EQ(submatrix, view.toSparseMatrix());
+
+    for (uint64_t row = 0; row < submatrix.getRowCount(); ++row) {
+        auto entryIt = submatrix.getRow(row).begin();
+        view.forEachEntry(row, [&entryIt](uint64_t column, double value) {
+            EXPECT_EQ(entryIt->getColumn(), column);
+            EXPECT_EQ(entryIt->getValue(), value);
+            ++entryIt;
+        });
+        EXPECT_EQ(submatrix.getRow(row).end(), entryIt);
+    }
+}
+
+TEST(SparseMatrixView, SolveEquations) {
+    storm::storage::SparseMatrix<double> matrix = buildTestMatrix();
+    storm::storage::BitVector maybeStates(4, {0, 1});
+    storm::storage::BitVector targetStates(4, {2});
+    storm::storage::SparseMatrixView<double> view(matrix, maybeStates, maybeStates);
+    std::vector<double> b = matrix.getConstrainedRowGroupSumVector(maybeStates, targetStates);
+
+    // Value iteration operates on the view, policy iteration copies the submatrix.
+    for (auto method : {storm::solver::MinMaxMethod::ValueIteration, storm::solver::MinMaxMethod::PolicyIteration}) {
+        storm::Environment env;
+        env.solver().minMax().setMethod(method);
+        env.solver().minMax().setPrecision(storm::utility::convertNumber<storm::RationalNumber>(1e-8));
+        auto solver = storm::solver::GeneralMinMaxLinearEquationSolverFactory<double>().create(env, view);
+        solver->setHasUniqueSolution(true);
+        solver->setHasNoEndComponents(true);
+        solver->setBounds(0.0, 1.0);
+        solver->setRequirementsChecked();
+
+        std::vector<double> x(2);
+        ASSERT_NO_THROW(solver->solveEquations(env, storm::OptimizationDirection::Maximize, x, b));
+        EXPECT_NEAR(0.8125, x[0], 1e-6);
+        EXPECT_NEAR(0.625, x[1], 1e-6);
+
+        ASSERT_NO_THROW(solver->solveEquations(env, storm::OptimizationDirection::Minimize, x, b));
+        EXPECT_NEAR(0.0, x[0], 1e-6);
+        EXPECT_NEAR(0.3, x[1], 1e-6);
+    }
+}
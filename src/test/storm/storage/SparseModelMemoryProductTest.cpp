@@ -0,0 +1,51 @@
+#include "storm-config.h"
+#include "test/storm_gtest.h"
+
+#include "storm/models/sparse/Dtmc.h"
+#include "storm/storage/memorystructure/MemoryStructureBuilder.h"
+#include "storm/storage/memorystructure/SparseModelMemoryProduct.h"
+
+TEST(SparseModelMemoryProductTest, OnlyReachableStates) {
+    // State 0 moves to 1 or 2, state 1 moves back to 0, state 2 is absorbing
+    storm::storage::SparseMatrixBuilder<double> matrixBuilder(3, 3, 4);
+    matrixBuilder.addNextValue(0, 1, 0.5);
+    matrixBuilder.addNextValue(0, 2, 0.5);
+    matrixBuilder.addNextValue(1, 0, 1.0);
+    matrixBuilder.addNextValue(2, 2, 1.0);
+    storm::models::sparse::StateLabeling labeling(3);
+    labeling.addLabel("init", storm::storage::BitVector(3, std::vector<uint_fast64_t>({0})));
+    storm::models::sparse::Dtmc<double> dtmc(matrixBuilder.build(), std::move(labeling));
+
+    // The memory remembers whether state 1 was just visited. Memory state 2 can not be reached
+    storm::storage::MemoryStructureBuilder<double> memoryBuilder(3, dtmc);
+    memoryBuilder.setTransition(0, 0, storm::storage::BitVector(3, {0, 2}));
+    memoryBuilder.setTransition(0, 1, storm::storage::BitVector(3, std::vector<uint_fast64_t>({1})));
+    memoryBuilder.setTransition(1, 0, storm::storage::BitVector(3, {0, 2}));
+    memoryBuilder.setTransition(1, 1, storm::storage::BitVector(3, std::vector<uint_fast64_t>({1})));
+    memoryBuilder.setTransition(2, 2, storm::storage::BitVector(3, true));
+    memoryBuilder.setLabel(1, "visited");
+    storm::storage::MemoryStructure memory = memoryBuilder.build();
+
+    storm::storage::SparseModelMemoryProduct<double> product = memory.product(dtmc);
+    auto result = product.build();
+    ASSERT_EQ(3ull, result->getNumberOfStates());
+    EXPECT_TRUE(result->getTransitionMatrix().hasTrivialRowGrouping());
+    EXPECT_TRUE(product.isStateReachable(0, 0));
+    EXPECT_TRUE(product.isStateReachable(1, 1));
+    EXPECT_TRUE(product.isStateReachable(2, 0));
+    EXPECT_FALSE(product.isStateReachable(1, 0));
+    EXPECT_FALSE(product.isStateReachable(0, 2));
+    EXPECT_EQ(0ull, product.getResultState(0, 0));
+    EXPECT_EQ(1ull, product.getResultState(1, 1));
+    EXPECT_EQ(2ull, product.getResultState(2, 0));
+
+    auto const& matrix = result->getTransitionMatrix();
+    EXPECT_EQ(4ull, matrix.getEntryCount());
+    EXPECT_EQ(storm::storage::BitVector(3, std::vector<uint_fast64_t>({1})), result->getStates("visited"));
+    EXPECT_EQ(storm::storage::BitVector(3, std::vector<uint_fast64_t>({0})), result->getInitialStates());
+    ASSERT_EQ(2ull, matrix.getRow(0).getNumberOfEntries());
+    EXPECT_EQ(1ull, matrix.getRow(0).begin()->getColumn());
+    EXPECT_EQ(2ull, (matrix.getRow(0).begin() + 1)->getColumn());
+    EXPECT_EQ(0ull, matrix.getRow(1).begin()->getColumn());
+    EXPECT_EQ(2ull, matrix.getRow(2).begin()->getColumn());
+}
@@ -0,0 +1,88 @@
+#include "storm-config.h"
+#include "test/storm_gtest.h"
+
+#include <sstream>
+
+#include "storm/adapters/RationalNumberAdapter.h"
+#include "storm/storage/BitVector.h"
+#include "storm/storage/expressions/ExpressionManager.h"
+#include "storm/storage/sparse/StateValuations.h"
+#include "storm/utility/constants.h"
+
+namespace {
+
+class StateValuationsTest : public ::testing::Test {
+   protected:
+    void SetUp() override {
+        manager = std::make_shared<storm::expressions::ExpressionManager>();
+        b = manager->declareBooleanVariable("b");
+        x = manager->declareIntegerVariable("x");
+        y = manager->declareIntegerVariable("y");
+        r = manager->declareRationalVariable("r");
+
+        storm::storage::sparse::StateValuationsBuilder builder;
+        builder.addVariable(b);
+        builder.addVariable(x);
+        builder.addVariable(y);
+        builder.addVariable(r);
+        for (uint64_t state = 0; state < 100; ++state) {
+            // x has a negative lower bound, y is constant and thus does not need any bits
+            builder.addState(state, {state % 2 == 0}, {static_cast<int64_t>(state) - 50, 7}, {rationalValue(state)});
+        }
+        valuations = builder.build();
+    }
+
+    void expectState(storm::storage::sparse::StateValuations const& val, uint64_t state, uint64_t originalState) {
+        EXPECT_EQ(originalState % 2 == 0, val.getBooleanValue(state, b));
+        EXPECT_EQ(static_cast<int64_t>(originalState) - 50, val.getIntegerValue(state, x));
+        EXPECT_EQ(7, val.getIntegerValue(state, y));
+        EXPECT_EQ(rationalValue(originalState), val.getRationalValue(state, r));
+    }
+
+    static storm::RationalNumber rationalValue(uint64_t state) {
+        return storm::utility::convertNumber<storm::RationalNumber>(state) / storm::utility::convertNumber<storm::RationalNumber>(static_cast<uint64_t>(3));
+    }
+
+    std::shared_ptr<storm::expressions::ExpressionManager> manager;
+    storm::expressions::Variable b, x, y, r;
+    storm::storage::sparse::StateValuations valuations;
+};
+
+TEST_F(StateValuationsTest, Access) {
+    ASSERT_EQ(100ul, valuations.getNumberOfStates());
+    for (uint64_t state = 0; state < 100; ++state) {
+        expectState(valuations, state, state);
+    }
+    EXPECT_NE(std::string::npos, valuations.toString(1).find("!b"));
+    EXPECT_NE(std::string::npos, valuations.toString(1).find("x=-49"));
+    EXPECT_NE(std::string::npos, valuations.toString(1).find("y=7"));
+}
+
+TEST_F(StateValuationsTest, SelectStates) {
+    storm::storage::BitVector selected(100, false);
+    selected.set(3);
+    selected.set(42);
+    auto selectedValuations = valuations.selectStates(selected);
+    ASSERT_EQ(2ul, selectedValuations.getNumberOfStates());
+    expectState(selectedValuations, 0, 3);
+    expectState(selectedValuations, 1, 42);
+
+    auto selectedByIndex = valuations.selectStates(std::vector<uint64_t>({99, 200}));
+    ASSERT_EQ(2ul, selectedByIndex.getNumberOfStates());
+    expectState(selectedByIndex, 0, 99);
+    EXPECT_TRUE(selectedByIndex.isEmpty(1));
+}
+
+TEST_F(StateValuationsTest, Binary) {
+    std::stringstream stream;
+    valuations.writeBinary(stream);
+    std::string data = stream.str();
+    auto loaded = storm::storage::sparse::StateValuations::readBinary(data.data(), data.data() + data.size(), *manager);
+    ASSERT_EQ(100ul, loaded.getNumberOfStates());
+    for (uint64_t state = 0; state < 100; ++state) {
+        expectState(loaded, state, state);
+        EXPECT_EQ(valuations.toString(state), loaded.toString(state));
+    }
+}
+
+}  // namespace
@@ -2,6 +2,9 @@
 #include "storm-parsers/parser/AutoParser.h"
 #include "storm/models/sparse/MarkovAutomaton.h"
 #include "storm/models/sparse/StandardRewardModel.h"
+#include "storm/settings/SettingMemento.h"
+#include "storm/settings/SettingsManager.h"
+#include "storm/settings/modules/CoreSettings.h"
 #include "storm/storage/SparseMatrix.h"
 #include "storm/storage/StronglyConnectedComponentDecomposition.h"
 #include "test/storm_gtest.h"
@@ -90,3 +93,54 @@ TEST(StronglyConnectedComponentDecomposition, FullSystem2) {
 
     markovAutomaton = nullptr;
 }
+
+TEST(StronglyConnectedComponentDecomposition, ParallelDecomposition) {
+    // A system that is large enough to be decomposed in parallel. It consists of cycles of 100 states each, where some states jump to
+    // pseudo-random states and every 1000th state is a sink.
+    uint64_t const numberOfStates = 1ull << 17;
+    storm::storage::SparseMatrixBuilder<double> matrixBuilder(numberOfStates, numberOfStates);
+    for (uint64_t state = 0; state < numberOfStates; ++state) {
+        if (state % 1000 == 999) {
+            matrixBuilder.addNextValue(state, state, 1.0);
+            continue;
+        }
+        uint64_t cycleSuccessor = state % 100 == 99 ? state - 99 : std::min(state + 1, numberOfStates - 1);
+        uint64_t jumpTarget = state % 7 == 0 ? (state * 7919) % numberOfStates : cycleSuccessor;
+        if (jumpTarget == cycleSuccessor) {
+            matrixBuilder.addNextValue(state, cycleSuccessor, 1.0);
+        } else {
+            matrixBuilder.addNextValue(state, std::min(cycleSuccessor, jumpTarget), 0.5);
+            matrixBuilder.addNextValue(state, std::max(cycleSuccessor, jumpTarget), 0.5);
+        }
+    }
+    storm::storage::SparseMatrix<double> matrix = matrixBuilder.build();
+
+    storm::storage::StronglyConnectedComponentDecompositionOptions options;
+    options.computeSccDepths();
+    storm::storage::StronglyConnectedComponentDecomposition<double> sequentialDecomposition(matrix, options);
+    std::unique_ptr<storm::settings::SettingMemento> parallelGraphAnalysis =
+        storm::settings::mutableManager().getModule(storm::settings::modules::CoreSettings::moduleName).overrideOption("parallel-graph", true);
+    storm::storage::StronglyConnectedComponentDecomposition<double> parallelDecomposition(matrix, options);
+
+    // Both decompositions have the same SCCs, but they may be ordered differently.
+    ASSERT_EQ(sequentialDecomposition.size(), parallelDecomposition.size());
+    std::vector<uint64_t> sequentialSccIndices = sequentialDecomposition.computeStateToSccIndexMap(numberOfStates);
+    std::vector<uint64_t> parallelSccIndices = parallelDecomposition.computeStateToSccIndexMap(numberOfStates);
+    for (auto const& scc : parallelDecomposition) {
+        uint64_t sequentialSccIndex = sequentialSccIndices[*scc.begin()];
+        EXPECT_EQ(sequentialDecomposition[sequentialSccIndex], scc);
+        EXPECT_EQ(sequentialDecomposition.getSccDepth(sequentialSccIndex), parallelDecomposition.getSccDepth(parallelSccIndices[*scc.begin()]));
+    }
+
+    // The SCCs are sorted topologically.
+    for (uint64_t state = 0; state < numberOfStates; ++state) {
+        for (auto const& entry : matrix.getRow(state)) {
+            EXPECT_LE(parallelSccIndices[entry.getColumn()], parallelSccIndices[state]);
+        }
+    }
+
+    options.onlyBottomSccs();
+    storm::storage::StronglyConnectedComponentDecomposition<double> parallelBottomSccs(matrix, options);
+    parallelGraphAnalysis.reset();
+    EXPECT_EQ(storm::storage::StronglyConnectedComponentDecomposition<double>(matrix, options).size(), parallelBottomSccs.size());
+}
@@ -15,6 +15,7 @@
 
 #include <iostream>
 #include <memory>
+#include <sstream>
 
 TEST(SylvanDd, Constants) {
     std::shared_ptr<storm::dd::DdManager<storm::dd::DdType::Sylvan>> manager(new storm::dd::DdManager<storm::dd::DdType::Sylvan>());
@@ -723,6 +724,40 @@ TEST(SylvanDd, MultiplyMatrixTest) {
     EXPECT_TRUE(dd3 == dd2 * manager->template getConstant<double>(2));
 }
 
+TEST(SylvanDd, OperationStatisticsTest) {
+    std::shared_ptr<storm::dd::DdManager<storm::dd::DdType::Sylvan>> manager(new storm::dd::DdManager<storm::dd::DdType::Sylvan>());
+    std::pair<storm::expressions::Variable, storm::expressions::Variable> x = manager->addMetaVariable("x", 1, 9);
+
+    storm::dd::Bdd<storm::dd::DdType::Sylvan> range = manager->getRange(x.first);
+    storm::dd::Bdd<storm::dd::DdType::Sylvan> relation = manager->getRange(x.first) && manager->getRange(x.second);
+
+    storm::dd::DdOperationStatistics& statistics = manager->getOperationStatistics();
+    statistics.setEnabled(true);
+    statistics.reset();
+
+    storm::dd::Bdd<storm::dd::DdType::Sylvan> successors = range.relationalProduct(relation, {x.first}, {x.second});
+    storm::dd::Bdd<storm::dd::DdType::Sylvan> projected = range.andExists(relation, {x.first});
+    storm::dd::Add<storm::dd::DdType::Sylvan, double> values = range.template toAdd<double>() + range.template toAdd<double>();
+    storm::dd::Add<storm::dd::DdType::Sylvan, double> selected = range.ite(values, manager->template getAddZero<double>());
+
+    EXPECT_TRUE(successors == range);
+    EXPECT_TRUE(projected == manager->getRange(x.second));
+    EXPECT_EQ(1ul, statistics.getNumberOfOperations(storm::dd::DdOperationType::RelationalProduct));
+    EXPECT_EQ(1ul, statistics.getNumberOfOperations(storm::dd::DdOperationType::AndExists));
+    EXPECT_EQ(1ul, statistics.getNumberOfOperations(storm::dd::DdOperationType::Ite));
+    EXPECT_LE(1ul, statistics.getNumberOfOperations(storm::dd::DdOperationType::Apply));
+    EXPECT_EQ(0ul, statistics.getNumberOfOperations(storm::dd::DdOperationType::MatrixMultiplication));
+
+    std::stringstream stream;
+    ASSERT_NO_THROW(manager->printStatisticsToStream(stream));
+    EXPECT_FALSE(stream.str().empty());
+
+    statistics.setEnabled(false);
+    statistics.reset();
+    successors = range && successors;
+    EXPECT_EQ(0ul, statistics.getNumberOfOperations(storm::dd::DdOperationType::Apply));
+}
+
 TEST(SylvanDd, GetSetValueTest) {
     std::shared_ptr<storm::dd::DdManager<storm::dd::DdType::Sylvan>> manager(new storm::dd::DdManager<storm::dd::DdType::Sylvan>());
     std::pair<storm::expressions::Variable, storm::expressions::Variable> x = manager->addMetaVariable("x", 1, 9);
@@ -830,6 +865,62 @@ TEST(SylvanDd, AddOddTest) {
     EXPECT_EQ(106ul, matrix.getNonzeroEntryCount());
 }
 
+TEST(SylvanDd, AddParallelMatrixConversionTest) {
+    std::shared_ptr<storm::dd::DdManager<storm::dd::DdType::Sylvan>> manager(new storm::dd::DdManager<storm::dd::DdType::Sylvan>());
+    std::pair<storm::expressions::Variable, storm::expressions::Variable> a = manager->addMetaVariable("a");
+    std::pair<storm::expressions::Variable, storm::expressions::Variable> x = manager->addMetaVariable("x", 0, 200);
+
+    // Create a matrix with a self-loop in each row, an entry in the first column and an entry for the successor.
+    storm::dd::Add<storm::dd::DdType::Sylvan, double> dd =
+        manager->template getIdentity<double>(x.first).equals(manager->template getIdentity<double>(x.second)).template toAdd<double>();
+    dd += manager->getEncoding(x.second, 0).template toAdd<double>() * manager->template getConstant<double>(2.0);
+    dd += (manager->template getIdentity<double>(x.first) + manager->template getAddOne<double>())
+              .equals(manager->template getIdentity<double>(x.second))
+              .template toAdd<double>() *
+          manager->template getIdentity<double>(x.second);
+    dd *= manager->getRange(x.first).template toAdd<double>() * manager->getRange(x.second).template toAdd<double>();
+
+    storm::dd::Odd rowOdd = manager->getRange(x.first).template toAdd<double>().createOdd();
+    storm::dd::Odd columnOdd = manager->getRange(x.second).template toAdd<double>().createOdd();
+
+    storm::storage::SparseMatrix<double> sequentialMatrix = dd.toMatrix({x.first}, {x.second}, rowOdd, columnOdd);
+    manager->getInternalDdManager().setParallelConversion(true);
+    storm::storage::SparseMatrix<double> parallelMatrix = dd.toMatrix({x.first}, {x.second}, rowOdd, columnOdd);
+    manager->getInternalDdManager().setParallelConversion(false);
+    EXPECT_EQ(201ul, parallelMatrix.getRowCount());
+    EXPECT_EQ(sequentialMatrix.getNonzeroEntryCount(), parallelMatrix.getNonzeroEntryCount());
+    EXPECT_TRUE(sequentialMatrix == parallelMatrix);
+
+    // Also check a matrix with row groups.
+    dd = manager->getEncoding(a.first, 0).ite(dd, dd * manager->template getConstant<double>(3.0));
+    sequentialMatrix = dd.toMatrix({a.first}, rowOdd, columnOdd);
+    manager->getInternalDdManager().setParallelConversion(true);
+    parallelMatrix = dd.toMatrix({a.first}, rowOdd, columnOdd);
+    manager->getInternalDdManager().setParallelConversion(false);
+    EXPECT_EQ(402ul, parallelMatrix.getRowCount());
+    EXPECT_EQ(201ul, parallelMatrix.getRowGroupCount());
+    EXPECT_TRUE(sequentialMatrix == parallelMatrix);
+}
+
+TEST(SylvanDd, AddParallelVectorConversionTest) {
+    std::shared_ptr<storm::dd::DdManager<storm::dd::DdType::Sylvan>> manager(new storm::dd::DdManager<storm::dd::DdType::Sylvan>());
+    std::pair<storm::expressions::Variable, storm::expressions::Variable> x = manager->addMetaVariable("x", 0, 1000);
+    std::pair<storm::expressions::Variable, storm::expressions::Variable> y = manager->addMetaVariable("y", 0, 2);
+
+    // Create a vector in which some parts of the domain of x are missing and y does not influence some of the values.
+    storm::dd::Add<storm::dd::DdType::Sylvan, double> dd =
+        manager->template getIdentity<double>(x.first) * manager->getRange(y.first).template toAdd<double>() + manager->template getIdentity<double>(y.first);
+    dd *= manager->template getIdentity<double>(x.first).greater(500.0).template toAdd<double>();
+    storm::dd::Odd odd = (manager->getRange(x.first) && manager->getRange(y.first)).template toAdd<double>().createOdd();
+
+    std::vector<double> sequentialVector = dd.toVector(odd);
+    manager->getInternalDdManager().setParallelConversion(true);
+    std::vector<double> parallelVector = dd.toVector(odd);
+    manager->getInternalDdManager().setParallelConversion(false);
+    EXPECT_EQ(3003ul, parallelVector.size());
+    EXPECT_EQ(sequentialVector, parallelVector);
+}
+
 TEST(SylvanDd, AddSharpenTest) {
     std::shared_ptr<storm::dd::DdManager<storm::dd::DdType::Sylvan>> manager(new storm::dd::DdManager<storm::dd::DdType::Sylvan>());
     std::pair<storm::expressions::Variable, storm::expressions::Variable> x = manager->addMetaVariable("x", 1, 9);
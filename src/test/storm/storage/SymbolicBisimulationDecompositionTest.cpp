@@ -9,9 +9,11 @@
 #include "storm/storage/SymbolicModelDescription.h"
 #include "storm/storage/dd/BisimulationDecomposition.h"
 
+#include "storm/modelchecker/prctl/SparseDtmcPrctlModelChecker.h"
 #include "storm/modelchecker/prctl/SymbolicDtmcPrctlModelChecker.h"
 #include "storm/modelchecker/prctl/SymbolicMdpPrctlModelChecker.h"
 #include "storm/modelchecker/results/CheckResult.h"
+#include "storm/modelchecker/results/ExplicitQuantitativeCheckResult.h"
 #include "storm/modelchecker/results/QuantitativeCheckResult.h"
 #include "storm/modelchecker/results/SymbolicQualitativeCheckResult.h"
 
@@ -21,6 +23,7 @@
 #include "storm-parsers/parser/FormulaParser.h"
 #include "storm/logic/Formulas.h"
 
+#include "storm/models/sparse/Dtmc.h"
 #include "storm/models/sparse/Mdp.h"
 #include "storm/models/sparse/StandardRewardModel.h"
 
@@ -28,6 +31,10 @@
 #include "storm/models/symbolic/Mdp.h"
 #include "storm/models/symbolic/StandardRewardModel.h"
 
+#include "storm/settings/SettingMemento.h"
+#include "storm/settings/SettingsManager.h"
+#include "storm/settings/modules/BisimulationSettings.h"
+
 TEST(SymbolicModelBisimulationDecomposition, Die_Cudd) {
     storm::prism::Program program = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR "/dtmc/die.pm");
 
@@ -159,6 +166,52 @@ TEST(SymbolicModelBisimulationDecomposition, DiePartialQuotient_Cudd) {
     EXPECT_NEAR(resultBounds.first, static_cast<double>(1) / 6, 1e-6);
 }
 
+TEST(SymbolicModelBisimulationDecomposition, DieLazyQuotient_Cudd) {
+    storm::prism::Program program = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR "/dtmc/die.pm");
+
+    std::shared_ptr<storm::models::symbolic::Model<storm::dd::DdType::CUDD, double>> model =
+        storm::builder::DdPrismModelBuilder<storm::dd::DdType::CUDD, double>().build(program);
+
+    storm::parser::FormulaParser formulaParser;
+    for (std::string const& formulaString : {"P=? [F \"two\"]", "P=? [F<=2 \"two\"]"}) {
+        std::vector<std::shared_ptr<storm::logic::Formula const>> formulas = {formulaParser.parseSingleFormulaFromString(formulaString)};
+
+        auto checkInitialState = [&formulas](std::shared_ptr<storm::models::Model<double>> const& quotient) {
+            auto quotientDtmc = quotient->as<storm::models::sparse::Dtmc<double>>();
+            storm::modelchecker::SparseDtmcPrctlModelChecker<storm::models::sparse::Dtmc<double>> checker(*quotientDtmc);
+            std::unique_ptr<storm::modelchecker::CheckResult> result = checker.check(*formulas.front());
+            return result->asExplicitQuantitativeCheckResult<double>()[*quotientDtmc->getInitialStates().begin()];
+        };
+
+        storm::dd::BisimulationDecomposition<storm::dd::DdType::CUDD, double> decomposition(*model, formulas, storm::storage::BisimulationType::Strong);
+        decomposition.compute();
+        std::shared_ptr<storm::models::Model<double>> fullQuotient = decomposition.getQuotient(storm::dd::bisimulation::QuotientFormat::Sparse);
+
+        std::shared_ptr<storm::models::Model<double>> lazyQuotient;
+        {
+            std::unique_ptr<storm::settings::SettingMemento> lazyExtraction =
+                storm::settings::mutableManager().getModule(storm::settings::modules::BisimulationSettings::moduleName).overrideOption("lazyquot", true);
+            lazyQuotient = decomposition.getQuotient(storm::dd::bisimulation::QuotientFormat::Sparse);
+        }
+
+        ASSERT_EQ(storm::models::ModelType::Dtmc, lazyQuotient->getType());
+        EXPECT_TRUE(lazyQuotient->isSparseModel());
+        EXPECT_LE(lazyQuotient->getNumberOfStates(), fullQuotient->getNumberOfStates());
+        EXPECT_NEAR(checkInitialState(fullQuotient), checkInitialState(lazyQuotient), 1e-6);
+    }
+
+    // The target cannot be reached within two steps, so the lazy quotient for the bounded formula omits its block.
+    std::vector<std::shared_ptr<storm::logic::Formula const>> formulas = {formulaParser.parseSingleFormulaFromString("P=? [F<=2 \"two\"]")};
+    storm::dd::BisimulationDecomposition<storm::dd::DdType::CUDD, double> decomposition(*model, formulas, storm::storage::BisimulationType::Strong);
+    decomposition.compute();
+    std::shared_ptr<storm::models::Model<double>> fullQuotient = decomposition.getQuotient(storm::dd::bisimulation::QuotientFormat::Sparse);
+    std::unique_ptr<storm::settings::SettingMemento> lazyExtraction =
+        storm::settings::mutableManager().getModule(storm::settings::modules::BisimulationSettings::moduleName).overrideOption("lazyquot", true);
+    std::shared_ptr<storm::models::Model<double>> lazyQuotient = decomposition.getQuotient(storm::dd::bisimulation::QuotientFormat::Sparse);
+    EXPECT_LT(lazyQuotient->getNumberOfStates(), fullQuotient->getNumberOfStates());
+    EXPECT_TRUE(lazyQuotient->as<storm::models::sparse::Dtmc<double>>()->getStates("two").empty());
+}
+
 TEST(SymbolicModelBisimulationDecomposition, Die_Sylvan) {
     storm::prism::Program program = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR "/dtmc/die.pm");
 
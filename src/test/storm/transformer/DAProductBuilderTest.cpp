@@ -81,6 +81,19 @@ TEST(DAProductBuilderTest_aUb, Dtmc) {
     ASSERT_EQ(product->getAcceptance()->isAccepting(scc), false);
     scc.insert(12);
     ASSERT_EQ(product->getAcceptance()->isAccepting(scc), false);
+
+    // Only reachable product states are built and the mapping between product states and their indices is consistent.
+    uint64_t numberOfProductStates = product->getProductModel().getNumberOfStates();
+    EXPECT_LT(numberOfProductStates, dtmc->getNumberOfStates() * da->getNumberOfStates());
+    EXPECT_EQ(numberOfProductStates, product->getProductIndexToProductState().size());
+    for (uint64_t productState = 0; productState < numberOfProductStates; ++productState) {
+        uint64_t modelState = product->getModelState(productState);
+        uint64_t automatonState = product->getAutomatonState(productState);
+        EXPECT_TRUE(product->isValidProductState(modelState, automatonState));
+        EXPECT_EQ(productState, product->getProductStateIndex(modelState, automatonState));
+    }
+    EXPECT_FALSE(product->isValidProductState(0, da->getNumberOfStates()));
+    EXPECT_FALSE(product->isValidProductState(1ull << 40, 0));
 }
 
 TEST(DAProductBuilderTest_aWb, Dtmc) {
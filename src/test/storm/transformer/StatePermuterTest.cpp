@@ -0,0 +1,96 @@
+#include "storm-config.h"
+#include "test/storm_gtest.h"
+
+#include "storm-parsers/api/storm-parsers.h"
+#include "storm-parsers/parser/PrismParser.h"
+#include "storm/api/storm.h"
+#include "storm/modelchecker/results/ExplicitQuantitativeCheckResult.h"
+#include "storm/transformer/StatePermuter.h"
+
+namespace {
+
+std::vector<double> check(std::shared_ptr<storm::models::sparse::Model<double>> const& model, std::shared_ptr<storm::logic::Formula const> const& formula) {
+    auto result = storm::api::verifyWithSparseEngine<double>(model, storm::api::createTask<double>(formula, false));
+    return result->asExplicitQuantitativeCheckResult<double>().getValueVector();
+}
+
+TEST(StatePermuterTest, PermutationUtility) {
+    storm::storage::SparseMatrixBuilder<double> builder(4, 4, 6);
+    builder.addNextValue(0, 2, 0.5);
+    builder.addNextValue(0, 3, 0.5);
+    builder.addNextValue(1, 1, 1.0);
+    builder.addNextValue(2, 1, 0.9);
+    builder.addNextValue(2, 2, 0.1);
+    builder.addNextValue(3, 3, 1.0);
+    auto matrix = builder.build();
+    storm::storage::BitVector initialStates(4, std::vector<uint_fast64_t>({0}));
+
+    for (auto const& order : storm::utility::permutation::getOrderKinds()) {
+        auto inversePermutation = storm::utility::permutation::createPermutation(order, matrix, initialStates);
+        EXPECT_EQ(4ull, inversePermutation.size()) << storm::utility::permutation::orderKindToString(order);
+        EXPECT_TRUE(storm::utility::permutation::isValidPermutation(inversePermutation)) << storm::utility::permutation::orderKindToString(order);
+    }
+
+    // The breadth first order explores the states reachable from the initial state first.
+    auto bfsPermutation = storm::utility::permutation::createPermutation(storm::utility::permutation::OrderKind::LocalityBfs, matrix, initialStates);
+    EXPECT_EQ(std::vector<uint64_t>({0, 2, 3, 1}), bfsPermutation);
+
+    // In the topological order, each state only has transitions to itself and to states with a smaller index.
+    auto sccPermutation = storm::utility::permutation::createPermutation(storm::utility::permutation::OrderKind::SccTopological, matrix, initialStates);
+    auto permutedMatrix = matrix.permuteRowGroupsAndColumns(sccPermutation, storm::utility::permutation::invertPermutation(sccPermutation));
+    EXPECT_EQ(matrix.getEntryCount(), permutedMatrix.getEntryCount());
+    for (uint64_t row = 0; row < permutedMatrix.getRowCount(); ++row) {
+        for (auto const& entry : permutedMatrix.getRow(row)) {
+            EXPECT_LE(entry.getColumn(), row);
+        }
+    }
+    EXPECT_FALSE(storm::utility::permutation::isValidPermutation({0, 2, 2}));
+}
+
+TEST(StatePermuterTest, Dtmc) {
+    storm::prism::Program program = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR "/dtmc/die.pm");
+    std::string formulasString = "P=? [ F \"one\"]; R=? [ F \"done\"]";
+    auto formulas = storm::api::extractFormulasFromProperties(storm::api::parsePropertiesForPrismProgram(formulasString, program));
+    auto model = storm::api::buildSparseModel<double>(program, formulas);
+
+    for (auto const& order : storm::utility::permutation::getOrderKinds()) {
+        std::vector<uint64_t> inversePermutation;
+        auto permutedModel = storm::transformer::permuteStates(*model, order, &inversePermutation);
+        EXPECT_EQ(model->getNumberOfStates(), permutedModel->getNumberOfStates());
+        EXPECT_EQ(model->getNumberOfTransitions(), permutedModel->getNumberOfTransitions());
+        EXPECT_EQ(model->getInitialStates().getNumberOfSetBits(), permutedModel->getInitialStates().getNumberOfSetBits());
+        for (auto const& formula : formulas) {
+            auto expected = check(model, formula);
+            auto actual = storm::transformer::restoreOriginalStateOrder(check(permutedModel, formula), inversePermutation);
+            ASSERT_EQ(expected.size(), actual.size());
+            for (uint64_t state = 0; state < expected.size(); ++state) {
+                EXPECT_NEAR(expected[state], actual[state], 1e-6) << storm::utility::permutation::orderKindToString(order);
+            }
+        }
+    }
+}
+
+TEST(StatePermuterTest, Mdp) {
+    storm::prism::Program program = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR "/mdp/coin2-2.nm");
+    std::string formulasString = "Pmax=? [ F \"all_coins_equal_1\"]; Pmin=? [ F \"all_coins_equal_0\"]";
+    auto formulas = storm::api::extractFormulasFromProperties(storm::api::parsePropertiesForPrismProgram(formulasString, program));
+    auto model = storm::api::buildSparseModel<double>(program, formulas);
+
+    for (auto const& order : storm::utility::permutation::getOrderKinds()) {
+        std::vector<uint64_t> inversePermutation;
+        auto permutedModel = storm::transformer::permuteStates(*model, order, &inversePermutation);
+        EXPECT_EQ(model->getNumberOfStates(), permutedModel->getNumberOfStates());
+        EXPECT_EQ(model->getNumberOfChoices(), permutedModel->getNumberOfChoices());
+        EXPECT_EQ(model->getNumberOfTransitions(), permutedModel->getNumberOfTransitions());
+        for (auto const& formula : formulas) {
+            auto expected = check(model, formula);
+            auto actual = storm::transformer::restoreOriginalStateOrder(check(permutedModel, formula), inversePermutation);
+            ASSERT_EQ(expected.size(), actual.size());
+            for (uint64_t state = 0; state < expected.size(); ++state) {
+                EXPECT_NEAR(expected[state], actual[state], 1e-6) << storm::utility::permutation::orderKindToString(order);
+            }
+        }
+    }
+}
+
+}  // namespace
@@ -0,0 +1,62 @@
+#include "storm-config.h"
+#include "test/storm_gtest.h"
+
+#include "storm-parsers/parser/PrismParser.h"
+#include "storm/builder/ExplicitModelBuilder.h"
+#include "storm/models/sparse/Mdp.h"
+#include "storm/models/sparse/StandardRewardModel.h"
+#include "storm/transformer/SubsystemBuilder.h"
+
+namespace {
+
+std::shared_ptr<storm::models::sparse::Model<double>> buildTwoDice() {
+    storm::prism::Program program = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR "/mdp/two_dice.nm");
+    storm::generator::NextStateGeneratorOptions generatorOptions;
+    generatorOptions.setBuildAllLabels();
+    generatorOptions.setBuildAllRewardModels();
+    generatorOptions.setBuildChoiceLabels();
+    return storm::builder::ExplicitModelBuilder<double>(program, generatorOptions).build();
+}
+
+void expectEqualSubsystems(storm::transformer::SubsystemBuilderReturnType<double> const& expected,
+                           storm::transformer::SubsystemBuilderReturnType<double> const& actual) {
+    EXPECT_TRUE(expected.model->getType() == actual.model->getType());
+    EXPECT_EQ(expected.model->getTransitionMatrix(), actual.model->getTransitionMatrix());
+    EXPECT_EQ(expected.model->getStateLabeling(), actual.model->getStateLabeling());
+    EXPECT_EQ(expected.model->getChoiceLabeling(), actual.model->getChoiceLabeling());
+    EXPECT_EQ(expected.model->getUniqueRewardModel().getStateActionRewardVector(), actual.model->getUniqueRewardModel().getStateActionRewardVector());
+    EXPECT_EQ(expected.newToOldStateIndexMapping, actual.newToOldStateIndexMapping);
+    EXPECT_EQ(expected.keptActions, actual.keptActions);
+    EXPECT_TRUE(expected.deadlockLabel == actual.deadlockLabel);
+}
+
+TEST(SubsystemBuilderTest, InPlaceCompaction) {
+    auto model = buildTwoDice();
+    storm::storage::BitVector subsystemStates = ~model->getStates("two");
+    storm::storage::BitVector subsystemActions(model->getNumberOfChoices(), true);
+    storm::transformer::SubsystemBuilderOptions options;
+    options.fixDeadlocks = true;
+    auto expected = storm::transformer::buildSubsystem(*model, subsystemStates, subsystemActions, false, options);
+    EXPECT_LT(expected.model->getNumberOfStates(), model->getNumberOfStates());
+    EXPECT_TRUE(expected.deadlockLabel.is_initialized());
+
+    // The model is shared, so it remains intact.
+    std::shared_ptr<storm::models::sparse::Model<double>> sharedModel = model;
+    uint64_t numberOfStates = model->getNumberOfStates();
+    expectEqualSubsystems(expected, storm::transformer::buildSubsystemInPlace(std::move(sharedModel), subsystemStates, subsystemActions, false, options));
+    EXPECT_EQ(nullptr, sharedModel);
+    EXPECT_EQ(numberOfStates, model->getNumberOfStates());
+
+    // The model is solely owned, so its components are compacted in place.
+    auto result = storm::transformer::buildSubsystemInPlace(std::move(model), subsystemStates, subsystemActions, false, options);
+    EXPECT_EQ(nullptr, model);
+    expectEqualSubsystems(expected, result);
+
+    // The selections may refer to the labeling of the model.
+    model = buildTwoDice();
+    storm::storage::BitVector const& initialStates = model->getStates("init");
+    expected = storm::transformer::buildSubsystem(*model, initialStates, subsystemActions, true, options);
+    expectEqualSubsystems(expected, storm::transformer::buildSubsystemInPlace(std::move(model), initialStates, subsystemActions, true, options));
+}
+
+}  // namespace
@@ -0,0 +1,37 @@
+#include "storm-config.h"
+#include "test/storm_gtest.h"
+
+#include <sstream>
+
+#include "storm-parsers/parser/DirectEncodingParser.h"
+#include "storm/io/DirectEncodingExporter.h"
+#include "storm/models/sparse/StandardRewardModel.h"
+
+namespace {
+
+// Exporting in parallel chunks has to yield exactly the same output as the sequential export
+void checkParallelExport(std::string const& drnFile) {
+    storm::parser::DirectEncodingParserOptions parserOptions;
+    parserOptions.buildChoiceLabeling = true;
+    std::shared_ptr<storm::models::sparse::Model<double>> model = storm::parser::DirectEncodingParser<double>::parseModel(drnFile, parserOptions);
+
+    std::stringstream sequential;
+    storm::exporter::explicitExportSparseModel(sequential, model, {});
+
+    storm::exporter::DirectEncodingOptions options;
+    options.numberOfThreads = 4;
+    options.statesPerChunk = 7;
+    std::stringstream parallel;
+    storm::exporter::explicitExportSparseModel(parallel, model, {}, options);
+
+    EXPECT_EQ(sequential.str(), parallel.str());
+}
+
+TEST(DirectEncodingExporterTest, ParallelExport) {
+    checkParallelExport(STORM_TEST_RESOURCES_DIR "/dtmc/crowds-5-5.drn");
+    checkParallelExport(STORM_TEST_RESOURCES_DIR "/mdp/two_dice.drn");
+    checkParallelExport(STORM_TEST_RESOURCES_DIR "/ctmc/cluster2.drn");
+    checkParallelExport(STORM_TEST_RESOURCES_DIR "/ma/jobscheduler.drn");
+}
+
+}  // namespace
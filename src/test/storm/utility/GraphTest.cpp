@@ -10,6 +10,9 @@
 #include "storm/models/symbolic/Dtmc.h"
 #include "storm/models/symbolic/Mdp.h"
 #include "storm/models/symbolic/StandardRewardModel.h"
+#include "storm/settings/SettingMemento.h"
+#include "storm/settings/SettingsManager.h"
+#include "storm/settings/modules/CoreSettings.h"
 #include "storm/storage/SymbolicModelDescription.h"
 #include "storm/storage/dd/Add.h"
 #include "storm/storage/dd/Bdd.h"
@@ -329,3 +332,50 @@ TEST(GraphTest, ExplicitProb01MinMax) {
     EXPECT_EQ(993ull, statesWithProbability01.first.getNumberOfSetBits());
     EXPECT_EQ(16ull, statesWithProbability01.second.getNumberOfSetBits());
 }
+
+TEST(GraphTest, ExplicitParallelProb01MinMax) {
+    // An MDP that is large enough to be analyzed in parallel. Every state may either advance to its successor or jump to a pseudo-random state,
+    // and every 1000th state is an absorbing sink.
+    uint64_t const numberOfStates = 1ull << 17;
+    storm::storage::SparseMatrixBuilder<double> builder(0, 0, 0, false, true);
+    uint64_t row = 0;
+    for (uint64_t state = 0; state < numberOfStates; ++state) {
+        builder.newRowGroup(row);
+        if (state % 1000 == 999 || state + 1 == numberOfStates) {
+            builder.addNextValue(row++, state, 1.0);
+            continue;
+        }
+        builder.addNextValue(row++, state + 1, 1.0);
+        uint64_t jumpTarget = (state * 7919) % numberOfStates;
+        if (jumpTarget == state) {
+            builder.addNextValue(row++, state, 1.0);
+        } else {
+            builder.addNextValue(row, std::min(state, jumpTarget), 0.5);
+            builder.addNextValue(row++, std::max(state, jumpTarget), 0.5);
+        }
+    }
+    storm::storage::SparseMatrix<double> matrix = builder.build();
+    storm::storage::SparseMatrix<double> backwardTransitions = matrix.transpose(true);
+
+    storm::storage::BitVector phiStates(numberOfStates, true);
+    storm::storage::BitVector psiStates(numberOfStates, {numberOfStates - 1, numberOfStates / 2});
+    storm::storage::BitVector initialStates(numberOfStates, std::vector<uint_fast64_t>({0}));
+
+    auto sequentialMin = storm::utility::graph::performProb01Min(matrix, matrix.getRowGroupIndices(), backwardTransitions, phiStates, psiStates);
+    auto sequentialMax = storm::utility::graph::performProb01Max(matrix, matrix.getRowGroupIndices(), backwardTransitions, phiStates, psiStates);
+    auto sequentialReachable = storm::utility::graph::getReachableStates(matrix, initialStates, phiStates, psiStates);
+
+    std::unique_ptr<storm::settings::SettingMemento> parallelGraphAnalysis =
+        storm::settings::mutableManager().getModule(storm::settings::modules::CoreSettings::moduleName).overrideOption("parallel-graph", true);
+    auto parallelMin = storm::utility::graph::performProb01Min(matrix, matrix.getRowGroupIndices(), backwardTransitions, phiStates, psiStates);
+    auto parallelMax = storm::utility::graph::performProb01Max(matrix, matrix.getRowGroupIndices(), backwardTransitions, phiStates, psiStates);
+    auto parallelReachable = storm::utility::graph::getReachableStates(matrix, initialStates, phiStates, psiStates);
+
+    EXPECT_EQ(sequentialMin.first, parallelMin.first);
+    EXPECT_EQ(sequentialMin.second, parallelMin.second);
+    EXPECT_EQ(sequentialMax.first, parallelMax.first);
+    EXPECT_EQ(sequentialMax.second, parallelMax.second);
+    EXPECT_EQ(sequentialReachable, parallelReachable);
+    EXPECT_FALSE(sequentialMax.first.full());
+    EXPECT_FALSE(sequentialMin.second.empty());
+}
@@ -0,0 +1,63 @@
+#include "storm-config.h"
+#include "test/storm_gtest.h"
+
+#include <filesystem>
+
+#include "storm-parsers/api/storm-parsers.h"
+#include "storm-parsers/parser/PrismParser.h"
+#include "storm/api/storm.h"
+#include "storm/modelchecker/results/ExplicitQuantitativeCheckResult.h"
+#include "storm/transformer/StatePermuter.h"
+
+namespace {
+
+TEST(HintExportTest, ImportIntoPermutedModel) {
+    storm::prism::Program program = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR "/mdp/two_dice.nm");
+    auto formulas = storm::api::extractFormulasFromProperties(storm::api::parsePropertiesForPrismProgram("Rmin=? [ F \"done\"]", program));
+    storm::builder::BuilderOptions options(formulas, program);
+    options.setBuildStateValuations().setBuildChoiceOrigins();
+    auto model = storm::api::buildSparseModel<double>(program, options);
+
+    auto task = storm::api::createTask<double>(formulas.front(), false);
+    task.setProduceSchedulers(true);
+    auto result = storm::api::verifyWithSparseEngine<double>(model, task);
+    auto const& quantitativeResult = result->asExplicitQuantitativeCheckResult<double>();
+    ASSERT_TRUE(quantitativeResult.hasScheduler());
+
+    std::string hintFile = (std::filesystem::temp_directory_path() / "storm_hint_export_test.json").string();
+    storm::api::exportHint(model, *result, hintFile);
+
+    // The hint is matched via the state valuations and the choice origins, so it survives a renumbering of the states.
+    std::vector<uint64_t> inversePermutation;
+    auto permutedModel = storm::transformer::permuteStates(*model, storm::utility::permutation::OrderKind::LocalityBfs, &inversePermutation);
+    auto hint = storm::api::importHint(permutedModel, hintFile);
+    std::filesystem::remove(hintFile);
+    ASSERT_TRUE(hint->hasResultHint());
+    ASSERT_TRUE(hint->hasSchedulerHint());
+
+    auto values = storm::transformer::restoreOriginalStateOrder(hint->getResultHint(), inversePermutation);
+    std::vector<uint64_t> permutedChoices;
+    for (uint64_t state = 0; state < permutedModel->getNumberOfStates(); ++state) {
+        permutedChoices.push_back(hint->getSchedulerHint().getChoice(state).getDeterministicChoice());
+    }
+    auto choices = storm::transformer::restoreOriginalStateOrder(permutedChoices, inversePermutation);
+    auto const& scheduler = quantitativeResult.getScheduler();
+    for (uint64_t state = 0; state < model->getNumberOfStates(); ++state) {
+        EXPECT_NEAR(quantitativeResult[state], values[state], 1e-6);
+        if (!scheduler.isDontCare(state)) {
+            EXPECT_EQ(scheduler.getChoice(state).getDeterministicChoice(), choices[state]);
+        }
+    }
+
+    // Checking the permuted model with the hint yields the same result.
+    auto permutedTask = storm::api::createTask<double>(formulas.front(), false);
+    permutedTask.setHint(hint);
+    auto permutedResult = storm::api::verifyWithSparseEngine<double>(permutedModel, permutedTask);
+    auto restoredResult =
+        storm::transformer::restoreOriginalStateOrder(permutedResult->asExplicitQuantitativeCheckResult<double>().getValueVector(), inversePermutation);
+    for (uint64_t state = 0; state < model->getNumberOfStates(); ++state) {
+        EXPECT_NEAR(quantitativeResult[state], restoredResult[state], 1e-6);
+    }
+}
+
+}  // namespace
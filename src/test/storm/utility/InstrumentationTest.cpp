@@ -0,0 +1,79 @@
+#include "test/storm_gtest.h"
+
+#include <filesystem>
+#include <fstream>
+#include <sstream>
+
+#include "storm/utility/Instrumentation.h"
+
+TEST(InstrumentationTest, DisabledByDefault) {
+    storm::utility::instrumentation::reset();
+    {
+        storm::utility::instrumentation::ScopedRegion region("not recorded");
+        storm::utility::instrumentation::addToCounter("not recorded counter", 5);
+    }
+    std::stringstream summary;
+    storm::utility::instrumentation::printSummary(summary);
+    EXPECT_EQ("", summary.str());
+}
+
+TEST(InstrumentationTest, NestedRegionsAndCounters) {
+    storm::utility::instrumentation::reset();
+    storm::utility::instrumentation::setEnabled(true);
+    {
+        storm::utility::instrumentation::ScopedRegion outer("outer");
+        for (uint64_t i = 0; i < 3; ++i) {
+            storm::utility::instrumentation::ScopedRegion inner("inner");
+            storm::utility::instrumentation::addToCounter("iterations");
+        }
+        storm::utility::instrumentation::addToCounter("iterations", 7);
+    }
+    storm::utility::instrumentation::setEnabled(false);
+
+    std::stringstream summary;
+    storm::utility::instrumentation::printSummary(summary);
+    std::string output = summary.str();
+    // The inner region is printed (indented) after the outer one.
+    auto outerPos = output.find("  outer ");
+    auto innerPos = output.find("    inner ");
+    ASSERT_NE(std::string::npos, outerPos);
+    ASSERT_NE(std::string::npos, innerPos);
+    EXPECT_LT(outerPos, innerPos);
+    EXPECT_NE(std::string::npos, output.find("iterations"));
+    EXPECT_NE(std::string::npos, output.find("10\n"));
+
+    std::string filename = (std::filesystem::temp_directory_path() / "storm_instrumentation_test.json").string();
+    storm::utility::instrumentation::exportChromeTrace(filename);
+    std::ifstream file(filename);
+    std::stringstream trace;
+    trace << file.rdbuf();
+    file.close();
+    std::filesystem::remove(filename);
+    EXPECT_EQ(0ull, trace.str().find("{\"traceEvents\":["));
+    EXPECT_NE(std::string::npos, trace.str().find("\"name\":\"outer\""));
+    EXPECT_NE(std::string::npos, trace.str().find("\"name\":\"inner\""));
+    EXPECT_NE(std::string::npos, trace.str().find("\"args\":{\"value\":10}"));
+
+    storm::utility::instrumentation::reset();
+}
+
+TEST(InstrumentationTest, Memory) {
+    storm::utility::instrumentation::reset();
+    storm::utility::instrumentation::setEnabled(true);
+    storm::utility::instrumentation::recordMemory("matrix", 1024 * 1024);
+    storm::utility::instrumentation::recordMemory("matrix", 3 * 1024 * 1024);
+    storm::utility::instrumentation::recordMemory("matrix", 2 * 1024 * 1024);
+    storm::utility::instrumentation::setEnabled(false);
+    storm::utility::instrumentation::recordMemory("matrix", 5 * 1024 * 1024);
+
+    std::stringstream summary;
+    storm::utility::instrumentation::printSummary(summary);
+    std::string output = summary.str();
+    // Only the largest size recorded while the recording was enabled is reported.
+    auto memoryPos = output.find("Memory");
+    ASSERT_NE(std::string::npos, memoryPos);
+    EXPECT_NE(std::string::npos, output.find("3.000MB", memoryPos));
+    EXPECT_EQ(std::string::npos, output.find("5.000MB", memoryPos));
+
+    storm::utility::instrumentation::reset();
+}
@@ -3,9 +3,11 @@
 
 #include "storm-parsers/parser/PrismParser.h"
 #include "storm/builder/ExplicitModelBuilder.h"
+#include "storm/generator/PrismNextStateGenerator.h"
 #include "storm/models/sparse/Dtmc.h"
 #include "storm/storage/SymbolicModelDescription.h"
 #include "storm/utility/graph.h"
+#include "storm/utility/lazyShortestPaths.h"
 #include "storm/utility/shortestPaths.h"
 
 // NOTE: The KSPs / distances of these tests were generated by the
@@ -105,3 +107,23 @@ TEST(KSPTest, kspPathAsList) {
     //    161, 154, 146, 140, 134, 127, 119, 112, 104, 98, 92, 85, 77, 70, 81, 74, 65, 58, 52, 45, 37, 30, 22, 17, 12, 9, 6, 4, 2, 1, 0}; EXPECT_EQ(reference,
     //    list);
 }
+
+TEST(KSPTest, lazyOnTheFly) {
+    storm::prism::Program program = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR "/dtmc/die.pm");
+    auto generator = std::make_shared<storm::generator::PrismNextStateGenerator<double, uint32_t>>(program);
+    storm::utility::ksp::LazyShortestPathsGenerator<double> spg(generator, program.getLabelExpression("one"));
+
+    // The most probable path is 0 -> 1 -> 3 -> target and every further path loops once more between s=1 and s=3.
+    EXPECT_NEAR(0.125, spg.getDistance(1), 1e-12);
+    EXPECT_EQ(4ul, spg.getPathAsList(1).size());
+    EXPECT_NEAR(0.03125, spg.getDistance(2), 1e-12);
+    EXPECT_EQ(6ul, spg.getPathAsList(2).size());
+
+    // The probability mass of the paths converges to the reachability probability 1/6.
+    double probability = 0;
+    for (uint64_t k = 1; k <= 20; ++k) {
+        probability += spg.getDistance(k);
+    }
+    EXPECT_NEAR(1.0 / 6.0, probability, 1e-12);
+    EXPECT_TRUE(spg.hasPath(100));
+}
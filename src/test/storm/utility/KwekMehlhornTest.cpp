@@ -0,0 +1,32 @@
+#include "storm-config.h"
+#include "test/storm_gtest.h"
+
+#include "storm/adapters/RationalNumberAdapter.h"
+#include "storm/utility/KwekMehlhorn.h"
+#include "storm/utility/constants.h"
+
+#include <cmath>
+
+TEST(KwekMehlhornTest, Sharpen) {
+    auto rational = [](uint64_t numerator, uint64_t denominator) {
+        return storm::utility::convertNumber<storm::RationalNumber>(numerator) / storm::utility::convertNumber<storm::RationalNumber>(denominator);
+    };
+    EXPECT_EQ(rational(1, 3), (storm::utility::kwek_mehlhorn::sharpen<storm::RationalNumber, double>(3, 0.3333333)));
+    EXPECT_EQ(rational(1, 2), (storm::utility::kwek_mehlhorn::sharpen<storm::RationalNumber, double>(1, 0.5)));
+    EXPECT_EQ(rational(5, 4), (storm::utility::kwek_mehlhorn::sharpen<storm::RationalNumber, double>(3, 1.25)));
+    EXPECT_EQ(rational(0, 1), (storm::utility::kwek_mehlhorn::sharpen<storm::RationalNumber, double>(5, 0.0)));
+
+    // The result is a fraction with a small denominator that lies in the interval given by the truncated value.
+    for (double value : {0.1, 0.123456789, 0.5 / 3, 2.0 / 7, 0.999999999}) {
+        for (uint64_t precision = 0; precision <= 15; ++precision) {
+            double powerOfTen = std::pow(10, precision);
+            storm::RationalNumber truncated = storm::utility::convertNumber<storm::RationalNumber>(std::trunc(value * powerOfTen));
+            storm::RationalNumber result = storm::utility::kwek_mehlhorn::sharpen<storm::RationalNumber, double>(precision, value);
+            EXPECT_LE(truncated / storm::utility::convertNumber<storm::RationalNumber>(powerOfTen), result) << value << " " << precision;
+            EXPECT_LE(result, (truncated + storm::utility::one<storm::RationalNumber>()) / storm::utility::convertNumber<storm::RationalNumber>(powerOfTen))
+                << value << " " << precision;
+            EXPECT_LE(storm::utility::convertNumber<storm::RationalNumber>(storm::utility::denominator(result)),
+                      storm::utility::convertNumber<storm::RationalNumber>(powerOfTen));
+        }
+    }
+}
@@ -0,0 +1,20 @@
+#include "storm-config.h"
+#include "test/storm_gtest.h"
+
+#include "storm/adapters/IntelTbbAdapter.h"
+#include "storm/utility/threads.h"
+
+TEST(ThreadsTest, SetNumberOfThreads) {
+    uint const detected = storm::utility::getNumberOfThreads();
+    EXPECT_GE(detected, 1u);
+
+    storm::utility::setNumberOfThreads(3);
+    EXPECT_EQ(3u, storm::utility::getNumberOfThreads());
+#ifdef STORM_HAVE_INTELTBB
+    EXPECT_EQ(3u, tbb::global_control::active_value(tbb::global_control::max_allowed_parallelism));
+#endif
+
+    // Resetting restores the automatic detection.
+    storm::utility::setNumberOfThreads(0);
+    EXPECT_EQ(detected, storm::utility::getNumberOfThreads());
+}
@@ -38,4 +38,18 @@ TEST(VectorTest, permute) {
     EXPECT_EQ(aperm[1], a[3]);
     EXPECT_EQ(aperm[2], a[1]);
     EXPECT_EQ(aperm[3], a[2]);
-}
\ No newline at end of file
+}
+TEST(VectorTest, parallelFirstTouch) {
+    // Large enough to be distributed among the threads.
+    uint64_t const size = 1ull << 20;
+    std::vector<double> a = storm::utility::vector::createWithParallelFirstTouch<double>(size, 0.5);
+    ASSERT_EQ(size, a.size());
+    EXPECT_EQ(0.5 * size, storm::utility::vector::sum_if(a, storm::storage::BitVector(size, true)));
+
+    std::vector<uint64_t> rowIndications = {0, 1, size / 2, size};
+    std::vector<double> b(size);
+    std::iota(b.begin(), b.end(), 0.0);
+    std::vector<double> original = b;
+    storm::utility::vector::redistributeWithParallelFirstTouch(b, &rowIndications);
+    EXPECT_EQ(original, b);
+}